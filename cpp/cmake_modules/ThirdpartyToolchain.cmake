@@ -254,6 +254,11 @@ if(NOT ARROW_COMPUTE)
   set(ARROW_WITH_UTF8PROC OFF)
 endif()
 
+if(NOT ARROW_COMPUTE)
+  # re2 is only used in kernels (and Gandiva) for now
+  set(ARROW_WITH_RE2 OFF)
+endif()
+
 # ----------------------------------------------------------------------
 # Versions and URLs for toolchain builds, which also can be used to configure
 # offline builds
@@ -2043,9 +2048,13 @@ macro(build_re2)
   list(APPEND ARROW_BUNDLED_STATIC_LIBS RE2::re2)
 endmacro()
 
-if(ARROW_GANDIVA)
+if(ARROW_WITH_RE2 OR ARROW_GANDIVA)
   resolve_dependency(RE2)
 
+  if(ARROW_WITH_RE2)
+    add_definitions(-DARROW_WITH_RE2)
+  endif()
+
   # TODO: Don't use global includes but rather target_include_directories
   get_target_property(RE2_INCLUDE_DIR RE2::re2 INTERFACE_INCLUDE_DIRECTORIES)
   include_directories(SYSTEM ${RE2_INCLUDE_DIR})
@@ -19,9 +19,14 @@
 #include "arrow/adapters/orc/adapter_util.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <deque>
+#include <functional>
 #include <list>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -32,6 +37,7 @@
 #include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/table_builder.h"
@@ -39,11 +45,16 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/future.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/range.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/visibility.h"
+#include "arrow/visitor_inline.h"
 
 #include "orc/Exceptions.hh"
 #include "orc/OrcFile.hh"
@@ -163,6 +174,134 @@ class OrcStripeReader : public RecordBatchReader {
   int64_t batch_size_;
 };
 
+// Yields the record batches of a sequence of stripes in order.  Each stripe is
+// decoded as a whole; with max_stripes_ahead > 0 that many stripes are decoded
+// ahead of the consumer on the CPU thread pool.
+class OrcFileRecordBatchReader : public RecordBatchReader {
+ public:
+  using DecodeStripe = std::function<Result<RecordBatchVector>(int64_t)>;
+
+  OrcFileRecordBatchReader(std::shared_ptr<Schema> schema, std::vector<int64_t> stripes,
+                           DecodeStripe decode_stripe, int max_stripes_ahead)
+      : schema_(std::move(schema)),
+        stripes_(std::move(stripes)),
+        decode_stripe_(std::move(decode_stripe)),
+        max_stripes_ahead_(max_stripes_ahead) {}
+
+  ~OrcFileRecordBatchReader() override {
+    // The decoding tasks refer to the ORCFileReader, don't let them outlive us
+    for (auto& future : pending_stripes_) {
+      future.Wait();
+    }
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    while (next_batch_ == batches_.size()) {
+      batches_.clear();
+      next_batch_ = 0;
+      if (max_stripes_ahead_ == 0) {
+        if (next_stripe_ == stripes_.size()) {
+          out->reset();
+          return Status::OK();
+        }
+        ARROW_ASSIGN_OR_RAISE(batches_, decode_stripe_(stripes_[next_stripe_++]));
+        continue;
+      }
+      RETURN_NOT_OK(ScheduleStripes());
+      if (pending_stripes_.empty()) {
+        out->reset();
+        return Status::OK();
+      }
+      auto future = std::move(pending_stripes_.front());
+      pending_stripes_.pop_front();
+      ARROW_ASSIGN_OR_RAISE(batches_, future.result());
+    }
+    *out = std::move(batches_[next_batch_++]);
+    return Status::OK();
+  }
+
+ private:
+  Status ScheduleStripes() {
+    auto* thread_pool = ::arrow::internal::GetCpuThreadPool();
+    while (next_stripe_ < stripes_.size() &&
+           static_cast<int>(pending_stripes_.size()) < max_stripes_ahead_) {
+      ARROW_ASSIGN_OR_RAISE(auto future,
+                            thread_pool->Submit(decode_stripe_, stripes_[next_stripe_]));
+      pending_stripes_.push_back(std::move(future));
+      ++next_stripe_;
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema_;
+  std::vector<int64_t> stripes_;
+  DecodeStripe decode_stripe_;
+  int max_stripes_ahead_;
+  size_t next_stripe_ = 0;
+  std::deque<Future<RecordBatchVector>> pending_stripes_;
+  RecordBatchVector batches_;
+  size_t next_batch_ = 0;
+};
+
+// Convert the bounds of ORC column statistics to scalars of the column's Arrow
+// type.  Unsupported types and missing bounds leave min and max null.
+static Status StatisticsAsScalars(const liborc::ColumnStatistics& stats,
+                                  const std::shared_ptr<DataType>& type,
+                                  std::shared_ptr<Scalar>* min,
+                                  std::shared_ptr<Scalar>* max) {
+  switch (type->id()) {
+    case Type::INT8:
+    case Type::INT16:
+    case Type::INT32:
+    case Type::INT64: {
+      auto int_stats = dynamic_cast<const liborc::IntegerColumnStatistics*>(&stats);
+      if (int_stats == nullptr || !int_stats->hasMinimum() || !int_stats->hasMaximum()) {
+        break;
+      }
+      ARROW_ASSIGN_OR_RAISE(*min, MakeScalar(type, int_stats->getMinimum()));
+      ARROW_ASSIGN_OR_RAISE(*max, MakeScalar(type, int_stats->getMaximum()));
+      break;
+    }
+    case Type::FLOAT:
+    case Type::DOUBLE: {
+      auto double_stats = dynamic_cast<const liborc::DoubleColumnStatistics*>(&stats);
+      if (double_stats == nullptr || !double_stats->hasMinimum() ||
+          !double_stats->hasMaximum() || std::isnan(double_stats->getMinimum()) ||
+          std::isnan(double_stats->getMaximum())) {
+        break;
+      }
+      ARROW_ASSIGN_OR_RAISE(*min, MakeScalar(type, double_stats->getMinimum()));
+      ARROW_ASSIGN_OR_RAISE(*max, MakeScalar(type, double_stats->getMaximum()));
+      break;
+    }
+    case Type::STRING: {
+      auto string_stats = dynamic_cast<const liborc::StringColumnStatistics*>(&stats);
+      if (string_stats == nullptr || !string_stats->hasMinimum() ||
+          !string_stats->hasMaximum()) {
+        break;
+      }
+      *min = std::make_shared<StringScalar>(string_stats->getMinimum());
+      *max = std::make_shared<StringScalar>(string_stats->getMaximum());
+      break;
+    }
+    case Type::DATE32: {
+      auto date_stats = dynamic_cast<const liborc::DateColumnStatistics*>(&stats);
+      if (date_stats == nullptr || !date_stats->hasMinimum() ||
+          !date_stats->hasMaximum()) {
+        break;
+      }
+      ARROW_ASSIGN_OR_RAISE(*min, MakeScalar(type, date_stats->getMinimum()));
+      ARROW_ASSIGN_OR_RAISE(*max, MakeScalar(type, date_stats->getMaximum()));
+      break;
+    }
+    default:
+      break;
+  }
+  return Status::OK();
+}
+
 class ORCFileReader::Impl {
  public:
   Impl() {}
@@ -209,13 +348,22 @@ class ORCFileReader::Impl {
 
   Status ReadSchema(const liborc::RowReaderOptions& opts, std::shared_ptr<Schema>* out) {
     std::unique_ptr<liborc::RowReader> row_reader;
+    RETURN_NOT_OK(CreateRowReader(opts, &row_reader));
+    const liborc::Type& type = row_reader->getSelectedType();
+    return GetArrowSchema(type, out);
+  }
+
+  // The liborc Reader is not thread-safe, but the row readers it creates can be
+  // used concurrently as our input stream only issues positional reads.
+  Status CreateRowReader(const liborc::RowReaderOptions& opts,
+                         std::unique_ptr<liborc::RowReader>* out) {
+    std::lock_guard<std::mutex> lock(reader_mutex_);
     try {
-      row_reader = reader_->createRowReader(opts);
+      *out = reader_->createRowReader(opts);
     } catch (const liborc::ParseError& e) {
       return Status::Invalid(e.what());
     }
-    const liborc::Type& type = row_reader->getSelectedType();
-    return GetArrowSchema(type, out);
+    return Status::OK();
   }
 
   Status GetArrowSchema(const liborc::Type& type, std::shared_ptr<Schema>* out) {
@@ -328,12 +476,18 @@ class ORCFileReader::Impl {
 
   Status ReadTable(const liborc::RowReaderOptions& row_opts,
                    const std::shared_ptr<Schema>& schema, std::shared_ptr<Table>* out) {
-    liborc::RowReaderOptions opts(row_opts);
     std::vector<std::shared_ptr<RecordBatch>> batches(stripes_.size());
-    for (size_t stripe = 0; stripe < stripes_.size(); stripe++) {
-      opts.range(stripes_[stripe].offset, stripes_[stripe].length);
-      RETURN_NOT_OK(ReadBatch(opts, schema, stripes_[stripe].num_rows, &batches[stripe]));
-    }
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        use_threads_, static_cast<int>(stripes_.size()), [&](int stripe) {
+          liborc::RowReaderOptions opts(row_opts);
+          opts.range(stripes_[stripe].offset, stripes_[stripe].length);
+          try {
+            return ReadBatch(opts, schema, stripes_[stripe].num_rows, &batches[stripe]);
+          } catch (const liborc::ParseError& e) {
+            // Don't let exceptions escape the thread pool
+            return Status::Invalid(e.what());
+          }
+        }));
     return Table::FromRecordBatches(schema, std::move(batches)).Value(out);
   }
 
@@ -341,9 +495,9 @@ class ORCFileReader::Impl {
                    const std::shared_ptr<Schema>& schema, int64_t nrows,
                    std::shared_ptr<RecordBatch>* out) {
     std::unique_ptr<liborc::RowReader> row_reader;
+    RETURN_NOT_OK(CreateRowReader(opts, &row_reader));
     std::unique_ptr<liborc::ColumnVectorBatch> batch;
     try {
-      row_reader = reader_->createRowReader(opts);
       batch = row_reader->createRowBatch(std::min(nrows, kReadRowsBatch));
     } catch (const liborc::ParseError& e) {
       return Status::Invalid(e.what());
@@ -389,8 +543,8 @@ class ORCFileReader::Impl {
     std::shared_ptr<Schema> schema;
     RETURN_NOT_OK(ReadSchema(opts, &schema));
     std::unique_ptr<liborc::RowReader> row_reader;
+    RETURN_NOT_OK(CreateRowReader(opts, &row_reader));
     try {
-      row_reader = reader_->createRowReader(opts);
       row_reader->seekToRow(current_row_);
       current_row_ = stripe_info.first_row_of_stripe + stripe_info.num_rows;
     } catch (const liborc::ParseError& e) {
@@ -406,11 +560,100 @@ class ORCFileReader::Impl {
     return NextStripeReader(batch_size, {}, out);
   }
 
+  Status GetRecordBatchReader(int64_t batch_size, const std::vector<int>& include_fields,
+                              const std::vector<int>& stripes,
+                              std::shared_ptr<RecordBatchReader>* out) {
+    liborc::RowReaderOptions opts;
+    if (!include_fields.empty()) {
+      std::list<uint64_t> include_fields_list;
+      for (int field_index : include_fields) {
+        ARROW_RETURN_IF(field_index < 0, Status::Invalid("Negative field index"));
+        include_fields_list.push_back(field_index);
+      }
+      opts.include(include_fields_list);
+    }
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(ReadSchema(opts, &schema));
+
+    std::vector<int64_t> selected_stripes;
+    if (stripes.empty()) {
+      selected_stripes.resize(stripes_.size());
+      std::iota(selected_stripes.begin(), selected_stripes.end(), 0);
+    } else {
+      for (int stripe : stripes) {
+        ARROW_RETURN_IF(stripe < 0 || stripe >= NumberOfStripes(),
+                        Status::Invalid("Out of bounds stripe: ", stripe));
+        selected_stripes.push_back(stripe);
+      }
+    }
+
+    auto decode_stripe = [this, opts, schema,
+                          batch_size](int64_t stripe) -> Result<RecordBatchVector> {
+      liborc::RowReaderOptions stripe_opts(opts);
+      RETURN_NOT_OK(SelectStripe(&stripe_opts, stripe));
+      std::unique_ptr<liborc::RowReader> row_reader;
+      RETURN_NOT_OK(CreateRowReader(stripe_opts, &row_reader));
+      OrcStripeReader stripe_reader(std::move(row_reader), schema, batch_size, pool_);
+      RecordBatchVector batches;
+      try {
+        RETURN_NOT_OK(stripe_reader.ReadAll(&batches));
+      } catch (const liborc::ParseError& e) {
+        return Status::Invalid(e.what());
+      }
+      return batches;
+    };
+    int max_stripes_ahead =
+        use_threads_ ? ::arrow::internal::GetCpuThreadPool()->GetCapacity() : 0;
+    *out = std::make_shared<OrcFileRecordBatchReader>(
+        std::move(schema), std::move(selected_stripes), std::move(decode_stripe),
+        max_stripes_ahead);
+    return Status::OK();
+  }
+
+  Status ReadStripeColumnStatistics(int64_t stripe, int field_index,
+                                    StripeColumnStatistics* out) {
+    ARROW_RETURN_IF(stripe < 0 || stripe >= NumberOfStripes(),
+                    Status::Invalid("Out of bounds stripe: ", stripe));
+    const liborc::Type& type = reader_->getType();
+    ARROW_RETURN_IF(
+        field_index < 0 || static_cast<uint64_t>(field_index) >= type.getSubtypeCount(),
+        Status::Invalid("Out of bounds field index: ", field_index));
+    const liborc::Type* field_type = type.getSubtype(field_index);
+    std::shared_ptr<DataType> arrow_type;
+    RETURN_NOT_OK(GetArrowType(field_type, &arrow_type));
+
+    std::unique_ptr<liborc::StripeStatistics> stripe_stats;
+    {
+      std::lock_guard<std::mutex> lock(reader_mutex_);
+      try {
+        stripe_stats = reader_->getStripeStatistics(stripe);
+      } catch (const liborc::ParseError& e) {
+        return Status::Invalid(e.what());
+      }
+    }
+
+    *out = StripeColumnStatistics();
+    auto column_id = static_cast<uint32_t>(field_type->getColumnId());
+    const liborc::ColumnStatistics* stats = stripe_stats->getColumnStatistics(column_id);
+    if (stats == nullptr) {
+      return Status::OK();
+    }
+    out->has_null = stats->hasNull();
+    out->num_values = static_cast<int64_t>(stats->getNumberOfValues());
+    return StatisticsAsScalars(*stats, arrow_type, &out->min, &out->max);
+  }
+
+  bool use_threads() const { return use_threads_; }
+
+  void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
+
  private:
   MemoryPool* pool_;
   std::unique_ptr<liborc::Reader> reader_;
+  std::mutex reader_mutex_;
   std::vector<StripeInformation> stripes_;
   int64_t current_row_;
+  bool use_threads_ = false;
 };
 
 ORCFileReader::ORCFileReader() { impl_.reset(new ORCFileReader::Impl()); }
@@ -469,10 +712,191 @@ Status ORCFileReader::NextStripeReader(int64_t batch_size,
   return impl_->NextStripeReader(batch_size, include_indices, out);
 }
 
+Status ORCFileReader::GetRecordBatchReader(int64_t batch_size,
+                                           const std::vector<int>& include_fields,
+                                           const std::vector<int>& stripes,
+                                           std::shared_ptr<RecordBatchReader>* out) {
+  return impl_->GetRecordBatchReader(batch_size, include_fields, stripes, out);
+}
+
+Status ORCFileReader::GetRecordBatchReader(int64_t batch_size,
+                                           const std::vector<int>& include_fields,
+                                           std::shared_ptr<RecordBatchReader>* out) {
+  return impl_->GetRecordBatchReader(batch_size, include_fields, {}, out);
+}
+
+Status ORCFileReader::ReadStripeColumnStatistics(int64_t stripe, int field_index,
+                                                 StripeColumnStatistics* out) {
+  return impl_->ReadStripeColumnStatistics(stripe, field_index, out);
+}
+
+bool ORCFileReader::use_threads() const { return impl_->use_threads(); }
+
+void ORCFileReader::set_use_threads(bool use_threads) {
+  impl_->set_use_threads(use_threads);
+}
+
 int64_t ORCFileReader::NumberOfStripes() { return impl_->NumberOfStripes(); }
 
 int64_t ORCFileReader::NumberOfRows() { return impl_->NumberOfRows(); }
 
+class ArrowOutputStream : public liborc::OutputStream {
+ public:
+  explicit ArrowOutputStream(io::OutputStream* output_stream)
+      : output_stream_(output_stream), length_(0) {}
+
+  uint64_t getLength() const override { return length_; }
+
+  uint64_t getNaturalWriteSize() const override { return 128 * 1024; }
+
+  void write(const void* buf, size_t length) override {
+    ORC_THROW_NOT_OK(output_stream_->Write(buf, static_cast<int64_t>(length)));
+    length_ += static_cast<uint64_t>(length);
+  }
+
+  const std::string& getName() const override {
+    static const std::string filename("ArrowOutputFile");
+    return filename;
+  }
+
+  // The stream belongs to the caller, who closes it
+  void close() override {}
+
+ private:
+  io::OutputStream* output_stream_;
+  uint64_t length_;
+};
+
+static Status GetOrcCompression(Compression::type compression,
+                                liborc::CompressionKind* out) {
+  switch (compression) {
+    case Compression::UNCOMPRESSED:
+      *out = liborc::CompressionKind_NONE;
+      break;
+    case Compression::GZIP:
+      *out = liborc::CompressionKind_ZLIB;
+      break;
+    case Compression::SNAPPY:
+      *out = liborc::CompressionKind_SNAPPY;
+      break;
+    case Compression::LZO:
+      *out = liborc::CompressionKind_LZO;
+      break;
+    case Compression::LZ4:
+      *out = liborc::CompressionKind_LZ4;
+      break;
+    case Compression::ZSTD:
+      *out = liborc::CompressionKind_ZSTD;
+      break;
+    default:
+      return Status::NotImplemented("Compression codec ",
+                                    util::Codec::GetCodecAsString(compression),
+                                    " is not supported by ORC");
+  }
+  return Status::OK();
+}
+
+class ORCFileWriter::Impl {
+ public:
+  Status Open(const std::shared_ptr<Schema>& schema, io::OutputStream* output_stream,
+              const WriteOptions& options) {
+    ARROW_RETURN_IF(options.batch_size <= 0,
+                    Status::Invalid("ORC write batch size must be positive"));
+    liborc::WriterOptions orc_options;
+    orc_options.setStripeSize(static_cast<uint64_t>(options.stripe_size));
+    orc_options.setCompressionBlockSize(
+        static_cast<uint64_t>(options.compression_block_size));
+    orc_options.setRowIndexStride(static_cast<uint64_t>(options.row_index_stride));
+    liborc::CompressionKind compression;
+    RETURN_NOT_OK(GetOrcCompression(options.compression, &compression));
+    orc_options.setCompression(compression);
+
+    // liborc keeps a reference to the type
+    RETURN_NOT_OK(GetOrcType(*schema, &orc_type_));
+    schema_ = schema;
+    batch_size_ = options.batch_size;
+    out_stream_.reset(new ArrowOutputStream(output_stream));
+    try {
+      writer_ = liborc::createWriter(*orc_type_, out_stream_.get(), orc_options);
+      batch_ = writer_->createRowBatch(static_cast<uint64_t>(batch_size_));
+    } catch (const std::exception& e) {
+      return Status::IOError(e.what());
+    }
+    return Status::OK();
+  }
+
+  Status Write(const RecordBatch& batch) {
+    if (!batch.schema()->Equals(*schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("Cannot write a batch of schema ",
+                             batch.schema()->ToString(), " to an ORC file of schema ",
+                             schema_->ToString());
+    }
+    auto root = checked_cast<liborc::StructVectorBatch*>(batch_.get());
+    try {
+      for (int64_t offset = 0; offset < batch.num_rows(); offset += batch_size_) {
+        const int64_t length = std::min(batch_size_, batch.num_rows() - offset);
+        root->numElements = length;
+        for (int i = 0; i < batch.num_columns(); i++) {
+          RETURN_NOT_OK(WriteBatch(*batch.column(i), offset, length, root->fields[i]));
+        }
+        writer_->add(*batch_);
+      }
+    } catch (const std::exception& e) {
+      return Status::IOError(e.what());
+    }
+    return Status::OK();
+  }
+
+  Status Write(const Table& table) {
+    TableBatchReader reader(table);
+    reader.set_chunksize(batch_size_);
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader.ReadNext(&batch));
+      if (batch == nullptr) {
+        return Status::OK();
+      }
+      RETURN_NOT_OK(Write(*batch));
+    }
+  }
+
+  Status Close() {
+    try {
+      writer_->close();
+    } catch (const std::exception& e) {
+      return Status::IOError(e.what());
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  int64_t batch_size_;
+  ORC_UNIQUE_PTR<liborc::Type> orc_type_;
+  std::unique_ptr<ArrowOutputStream> out_stream_;
+  std::unique_ptr<liborc::Writer> writer_;
+  std::unique_ptr<liborc::ColumnVectorBatch> batch_;
+};
+
+ORCFileWriter::ORCFileWriter() { impl_.reset(new ORCFileWriter::Impl()); }
+
+ORCFileWriter::~ORCFileWriter() {}
+
+Status ORCFileWriter::Open(const std::shared_ptr<Schema>& schema,
+                           io::OutputStream* output_stream, const WriteOptions& options,
+                           std::unique_ptr<ORCFileWriter>* writer) {
+  auto result = std::unique_ptr<ORCFileWriter>(new ORCFileWriter());
+  RETURN_NOT_OK(result->impl_->Open(schema, output_stream, options));
+  *writer = std::move(result);
+  return Status::OK();
+}
+
+Status ORCFileWriter::Write(const RecordBatch& batch) { return impl_->Write(batch); }
+
+Status ORCFileWriter::Write(const Table& table) { return impl_->Write(table); }
+
+Status ORCFileWriter::Close() { return impl_->Close(); }
+
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
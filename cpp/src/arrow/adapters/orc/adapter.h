@@ -26,6 +26,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -34,6 +35,18 @@ namespace adapters {
 
 namespace orc {
 
+/// \brief Statistics of a top-level column within a single stripe
+struct StripeColumnStatistics {
+  /// \brief The smallest non-null value, or null if unknown
+  std::shared_ptr<Scalar> min;
+  /// \brief The largest non-null value, or null if unknown
+  std::shared_ptr<Scalar> max;
+  /// \brief Whether the column may contain nulls within the stripe
+  bool has_null = true;
+  /// \brief The number of non-null values within the stripe, or -1 if unknown
+  int64_t num_values = -1;
+};
+
 /// \class ORCFileReader
 /// \brief Read an Arrow Table or RecordBatch from an ORC file.
 class ARROW_EXPORT ORCFileReader {
@@ -130,6 +143,53 @@ class ARROW_EXPORT ORCFileReader {
   Status NextStripeReader(int64_t batch_size, const std::vector<int>& include_indices,
                           std::shared_ptr<RecordBatchReader>* out);
 
+  /// \brief Get a record batch reader over several stripes
+  ///
+  /// Unlike NextStripeReader, the returned reader iterates over all the
+  /// selected stripes. With use_threads, upcoming stripes are decoded on the
+  /// CPU thread pool while the current one is being consumed.
+  ///
+  /// The ORCFileReader must outlive the returned reader.
+  ///
+  /// \param[in] batch_size the maximum number of rows in each record batch
+  /// \param[in] include_fields the selected top-level field indices to read,
+  ///            or empty to read all fields. Unlike include_indices elsewhere,
+  ///            these are not ORC type ids.
+  /// \param[in] stripes the selected stripe indices to read, or empty to read
+  ///            all stripes
+  /// \param[out] out the returned reader
+  Status GetRecordBatchReader(int64_t batch_size, const std::vector<int>& include_fields,
+                              const std::vector<int>& stripes,
+                              std::shared_ptr<RecordBatchReader>* out);
+
+  /// \brief Get a record batch reader over the whole file
+  ///
+  /// \param[in] batch_size the maximum number of rows in each record batch
+  /// \param[in] include_fields the selected top-level field indices to read,
+  ///            or empty to read all fields
+  /// \param[out] out the returned reader
+  Status GetRecordBatchReader(int64_t batch_size, const std::vector<int>& include_fields,
+                              std::shared_ptr<RecordBatchReader>* out);
+
+  /// \brief Read the statistics of a top-level field within a stripe
+  ///
+  /// Bounds are only reported for integer, floating point, string and date
+  /// fields.
+  ///
+  /// \param[in] stripe the stripe index
+  /// \param[in] field_index the top-level field index
+  /// \param[out] out the returned statistics
+  Status ReadStripeColumnStatistics(int64_t stripe, int field_index,
+                                    StripeColumnStatistics* out);
+
+  /// \brief Set whether to use multiple threads to decode stripes
+  ///
+  /// This applies to Read and GetRecordBatchReader. Default is false.
+  void set_use_threads(bool use_threads);
+
+  /// \brief Whether multiple threads are used to decode stripes
+  bool use_threads() const;
+
   /// \brief The number of stripes in the file
   int64_t NumberOfStripes();
 
@@ -142,6 +202,57 @@ class ARROW_EXPORT ORCFileReader {
   ORCFileReader();
 };
 
+/// \brief Options for writing ORC files
+struct ARROW_EXPORT WriteOptions {
+  /// \brief The number of rows converted to ORC at a time
+  int64_t batch_size = 1024;
+  /// \brief The target size of each stripe, in bytes
+  int64_t stripe_size = 64 * 1024 * 1024;
+  /// \brief The compression codec; GZIP stands for ORC's ZLIB
+  Compression::type compression = Compression::GZIP;
+  /// \brief The size of each compression block, in bytes
+  int64_t compression_block_size = 64 * 1024;
+  /// \brief The number of rows between row index entries, or 0 for no index
+  int64_t row_index_stride = 10000;
+};
+
+/// \class ORCFileWriter
+/// \brief Write Arrow Tables or RecordBatches to an ORC file.
+class ARROW_EXPORT ORCFileWriter {
+ public:
+  ~ORCFileWriter();
+
+  /// \brief Creates a new ORC writer.
+  ///
+  /// \param[in] schema the schema of the data to write
+  /// \param[in] output_stream the destination, which must outlive the writer.
+  ///            It is not closed by the writer.
+  /// \param[in] options the writer options
+  /// \param[out] writer the returned writer object
+  /// \return Status
+  static Status Open(const std::shared_ptr<Schema>& schema,
+                     io::OutputStream* output_stream, const WriteOptions& options,
+                     std::unique_ptr<ORCFileWriter>* writer);
+
+  /// \brief Write a RecordBatch
+  ///
+  /// \param[in] batch the batch to write, which must have the writer's schema
+  Status Write(const RecordBatch& batch);
+
+  /// \brief Write a Table
+  ///
+  /// \param[in] table the table to write, which must have the writer's schema
+  Status Write(const Table& table);
+
+  /// \brief Finish writing the file, including its footer
+  Status Close();
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+  ORCFileWriter();
+};
+
 }  // namespace orc
 
 }  // namespace adapters
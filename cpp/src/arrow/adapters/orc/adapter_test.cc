@@ -20,6 +20,9 @@
 #include "arrow/adapters/orc/adapter.h"
 #include "arrow/array.h"
 #include "arrow/io/api.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
 
 #include <gtest/gtest.h>
 #include <orc/OrcFile.hh>
@@ -157,4 +160,212 @@ TEST(TestAdapter, readIntAndStringFileMultipleStripes) {
     EXPECT_TRUE(stripe_reader->ReadNext(&record_batch).ok());
   }
 }
+
+TEST(TestAdapter, readFileWithThreads) {
+  MemoryOutputStream mem_stream(DEFAULT_MEM_STREAM_SIZE);
+  ORC_UNIQUE_PTR<liborc::Type> type(
+      liborc::Type::buildTypeFromString("struct<col1:bigint,col2:double>"));
+
+  constexpr uint64_t stripe_size = 1024;  // 1K
+  constexpr uint64_t stripe_count = 8;
+  constexpr uint64_t stripe_row_count = 10000;
+  constexpr uint64_t reader_batch_size = 3000;
+
+  liborc::WriterOptions options;
+  options.setStripeSize(stripe_size);
+  options.setMemoryPool(liborc::getDefaultPool());
+  auto writer = liborc::createWriter(*type, &mem_stream, options);
+  auto batch = writer->createRowBatch(stripe_row_count);
+  auto struct_batch = dynamic_cast<liborc::StructVectorBatch*>(batch.get());
+  auto long_batch = dynamic_cast<liborc::LongVectorBatch*>(struct_batch->fields[0]);
+  auto double_batch = dynamic_cast<liborc::DoubleVectorBatch*>(struct_batch->fields[1]);
+  for (uint64_t j = 0; j < stripe_count; ++j) {
+    for (uint64_t i = 0; i < stripe_row_count; ++i) {
+      long_batch->data[i] = static_cast<int64_t>(j * stripe_row_count + i);
+      double_batch->data[i] = static_cast<double>(i);
+    }
+    struct_batch->numElements = stripe_row_count;
+    long_batch->numElements = stripe_row_count;
+    double_batch->numElements = stripe_row_count;
+    writer->add(*batch);
+  }
+  writer->close();
+
+  std::shared_ptr<io::RandomAccessFile> in_stream(new io::BufferReader(
+      std::make_shared<Buffer>(reinterpret_cast<const uint8_t*>(mem_stream.getData()),
+                               static_cast<int64_t>(mem_stream.getLength()))));
+
+  std::unique_ptr<adapters::orc::ORCFileReader> reader;
+  ASSERT_TRUE(
+      adapters::orc::ORCFileReader::Open(in_stream, default_memory_pool(), &reader).ok());
+  ASSERT_EQ(stripe_count, reader->NumberOfStripes());
+  reader->set_use_threads(true);
+
+  std::shared_ptr<Table> table;
+  ASSERT_TRUE(reader->Read(&table).ok());
+  ASSERT_TRUE(table->ValidateFull().ok());
+  ASSERT_EQ(stripe_row_count * stripe_count, table->num_rows());
+
+  // Only read col1, from all stripes and then from a subset of them
+  for (const auto& stripes : std::vector<std::vector<int>>{{}, {1, 6}}) {
+    std::shared_ptr<RecordBatchReader> batch_reader;
+    ASSERT_TRUE(reader->GetRecordBatchReader(reader_batch_size, {0}, stripes,
+                                             &batch_reader)
+                    .ok());
+    ASSERT_EQ(1, batch_reader->schema()->num_fields());
+    size_t stripe_index = 0;
+    int64_t expected = stripes.empty() ? 0 : stripes[0] * stripe_row_count;
+    std::shared_ptr<RecordBatch> record_batch;
+    ASSERT_TRUE(batch_reader->ReadNext(&record_batch).ok());
+    while (record_batch) {
+      ASSERT_LE(record_batch->num_rows(), static_cast<int64_t>(reader_batch_size));
+      auto int64_array = std::dynamic_pointer_cast<Int64Array>(record_batch->column(0));
+      for (int64_t i = 0; i < record_batch->num_rows(); ++i) {
+        ASSERT_EQ(expected, int64_array->Value(i));
+        ++expected;
+        if (!stripes.empty() && expected % stripe_row_count == 0 &&
+            ++stripe_index < stripes.size()) {
+          expected = stripes[stripe_index] * stripe_row_count;
+        }
+      }
+      ASSERT_TRUE(batch_reader->ReadNext(&record_batch).ok());
+    }
+    int64_t last_stripe = stripes.empty() ? stripe_count - 1 : stripes.back();
+    ASSERT_EQ((last_stripe + 1) * static_cast<int64_t>(stripe_row_count), expected);
+  }
+
+  adapters::orc::StripeColumnStatistics stats;
+  ASSERT_TRUE(reader->ReadStripeColumnStatistics(3, 0, &stats).ok());
+  ASSERT_FALSE(stats.has_null);
+  ASSERT_EQ(static_cast<int64_t>(stripe_row_count), stats.num_values);
+  ASSERT_TRUE(stats.min->Equals(Int64Scalar(3 * stripe_row_count)));
+  ASSERT_TRUE(stats.max->Equals(Int64Scalar(4 * stripe_row_count - 1)));
+  ASSERT_TRUE(reader->ReadStripeColumnStatistics(3, 1, &stats).ok());
+  ASSERT_TRUE(stats.min->Equals(DoubleScalar(0)));
+  ASSERT_TRUE(stats.max->Equals(DoubleScalar(stripe_row_count - 1)));
+  ASSERT_FALSE(reader->ReadStripeColumnStatistics(stripe_count, 0, &stats).ok());
+  ASSERT_FALSE(reader->ReadStripeColumnStatistics(0, 2, &stats).ok());
+}
+
+class TestORCWriter : public ::testing::Test {
+ public:
+  std::shared_ptr<Table> RoundTrip(const Table& table,
+                                   const adapters::orc::WriteOptions& options) {
+    EXPECT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+    std::unique_ptr<adapters::orc::ORCFileWriter> writer;
+    ARROW_EXPECT_OK(
+        adapters::orc::ORCFileWriter::Open(table.schema(), sink.get(), options, &writer));
+    ARROW_EXPECT_OK(writer->Write(table));
+    ARROW_EXPECT_OK(writer->Close());
+    EXPECT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    std::unique_ptr<adapters::orc::ORCFileReader> reader;
+    ARROW_EXPECT_OK(adapters::orc::ORCFileReader::Open(
+        std::make_shared<io::BufferReader>(buffer), default_memory_pool(), &reader));
+    num_stripes_ = reader->NumberOfStripes();
+    std::shared_ptr<Table> out;
+    ARROW_EXPECT_OK(reader->Read(&out));
+    return out;
+  }
+
+ protected:
+  int64_t num_stripes_ = 0;
+};
+
+TEST_F(TestORCWriter, RoundTrip) {
+  auto table = TableFromJSON(
+      schema({field("bool", boolean()), field("int8", int8()), field("int16", int16()),
+              field("int32", int32()), field("int64", int64()),
+              field("float", float32()), field("double", float64()),
+              field("string", utf8()), field("binary", binary()),
+              field("date", date32()), field("timestamp", timestamp(TimeUnit::NANO)),
+              field("decimal64", decimal(10, 2)), field("decimal128", decimal(25, 5)),
+              field("list", list(int32())),
+              field("struct", struct_({field("a", int64()), field("b", utf8())}))}),
+      {R"([
+        [true, 1, 2, 3, 4, 1.5, 2.5, "foo", "bar", 1, 1000000001, "12.34",
+         "12345678901234567890.12345", [1, 2], {"a": 1, "b": "x"}],
+        [null, null, null, null, null, null, null, null, null, null, null, null,
+         null, null, null],
+        [false, -1, -2, -3, -4, -1.5, -2.5, "", "", -1, -1000000001, "-12.34",
+         "-0.00001", [], {"a": null, "b": null}]
+      ])",
+       R"([
+        [true, 127, 32767, 2147483647, 9223372036854775807, 0, 0, "baz", "quux",
+         18000, 0, "0.00", "0.00000", [null, 3], {"a": 2, "b": "y"}]
+      ])"});
+
+  for (auto compression : {Compression::UNCOMPRESSED, Compression::GZIP}) {
+    adapters::orc::WriteOptions options;
+    options.compression = compression;
+    options.batch_size = 2;
+    AssertTablesEqual(*table, *RoundTrip(*table, options), /*same_chunk_layout=*/false);
+  }
+}
+
+TEST_F(TestORCWriter, ConvertedTypes) {
+  auto table = TableFromJSON(
+      schema({field("large_string", large_utf8()), field("date64", date64()),
+              field("timestamp", timestamp(TimeUnit::MILLI)),
+              field("fixed_size_list", fixed_size_list(int16(), 2))}),
+      {R"([
+        ["foo", 86400000, 1500, [1, 2]],
+        [null, -1, -1500, null]
+      ])"});
+  auto expected = TableFromJSON(
+      schema({field("large_string", utf8()), field("date64", date32()),
+              field("timestamp", timestamp(TimeUnit::NANO)),
+              field("fixed_size_list", list(int16()))}),
+      {R"([
+        ["foo", 1, 1500000000, [1, 2]],
+        [null, -1, -1500000000, null]
+      ])"});
+
+  AssertTablesEqual(*expected, *RoundTrip(*table, adapters::orc::WriteOptions()),
+                    /*same_chunk_layout=*/false);
+}
+
+TEST_F(TestORCWriter, StripeSize) {
+  Int64Builder builder;
+  ASSERT_OK(builder.Reserve(100000));
+  for (int64_t i = 0; i < 100000; ++i) {
+    builder.UnsafeAppend(i * 7919);
+  }
+  std::shared_ptr<Array> array;
+  ASSERT_OK(builder.Finish(&array));
+  auto table = Table::Make(schema({field("i64", int64())}), ArrayVector{array});
+
+  adapters::orc::WriteOptions options;
+  options.compression = Compression::UNCOMPRESSED;
+  options.stripe_size = 64 * 1024;
+  AssertTablesEqual(*table, *RoundTrip(*table, options), /*same_chunk_layout=*/false);
+  ASSERT_GT(num_stripes_, 1);
+
+  options.stripe_size = 64 * 1024 * 1024;
+  AssertTablesEqual(*table, *RoundTrip(*table, options), /*same_chunk_layout=*/false);
+  ASSERT_EQ(num_stripes_, 1);
+}
+
+TEST_F(TestORCWriter, Errors) {
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  std::unique_ptr<adapters::orc::ORCFileWriter> writer;
+
+  auto unsupported = schema({field("dict", dictionary(int32(), utf8()))});
+  ASSERT_RAISES(NotImplemented,
+                adapters::orc::ORCFileWriter::Open(
+                    unsupported, sink.get(), adapters::orc::WriteOptions(), &writer));
+
+  adapters::orc::WriteOptions options;
+  options.compression = Compression::BROTLI;
+  ASSERT_RAISES(NotImplemented, adapters::orc::ORCFileWriter::Open(
+                                    schema({field("i64", int64())}), sink.get(),
+                                    options, &writer));
+
+  ASSERT_OK(adapters::orc::ORCFileWriter::Open(schema({field("i64", int64())}),
+                                               sink.get(), adapters::orc::WriteOptions(),
+                                               &writer));
+  auto other = TableFromJSON(schema({field("i32", int32())}), {"[[1]]"});
+  ASSERT_RAISES(Invalid, writer->Write(*other));
+  ASSERT_OK(writer->Close());
+}
 }  // namespace arrow
@@ -16,12 +16,16 @@
 // under the License.
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "arrow/adapters/orc/adapter_util.h"
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/array/builder_base.h"
 #include "arrow/builder.h"
 #include "arrow/status.h"
+#include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/range.h"
@@ -425,6 +429,348 @@ Status GetArrowType(const liborc::Type* type, std::shared_ptr<DataType>* out) {
   return Status::OK();
 }
 
+// The number of milliseconds in a day
+constexpr int64_t kOneDayMillis = 86400000LL;
+
+template <class array_type, class batch_type, class target_type>
+Status WriteNumericBatch(const Array& array, int64_t offset, int64_t length,
+                         liborc::ColumnVectorBatch* cbatch) {
+  const auto& numeric_array = checked_cast<const array_type&>(array);
+  auto batch = checked_cast<batch_type*>(cbatch);
+  for (int64_t i = 0; i < length; i++) {
+    batch->data[i] = static_cast<target_type>(numeric_array.Value(offset + i));
+  }
+  return Status::OK();
+}
+
+Status WriteDate64Batch(const Array& array, int64_t offset, int64_t length,
+                        liborc::ColumnVectorBatch* cbatch) {
+  const auto& date_array = checked_cast<const Date64Array&>(array);
+  auto batch = checked_cast<liborc::LongVectorBatch*>(cbatch);
+  for (int64_t i = 0; i < length; i++) {
+    const int64_t millis = date_array.Value(offset + i);
+    int64_t days = millis / kOneDayMillis;
+    if (millis % kOneDayMillis < 0) {
+      days--;
+    }
+    batch->data[i] = days;
+  }
+  return Status::OK();
+}
+
+Status WriteTimestampBatch(const Array& array, int64_t offset, int64_t length,
+                           liborc::ColumnVectorBatch* cbatch) {
+  const auto& timestamp_array = checked_cast<const TimestampArray&>(array);
+  auto batch = checked_cast<liborc::TimestampVectorBatch*>(cbatch);
+
+  int64_t units_per_second = 1;
+  switch (checked_cast<const TimestampType&>(*array.type()).unit()) {
+    case TimeUnit::SECOND:
+      units_per_second = 1;
+      break;
+    case TimeUnit::MILLI:
+      units_per_second = 1000;
+      break;
+    case TimeUnit::MICRO:
+      units_per_second = 1000000;
+      break;
+    case TimeUnit::NANO:
+      units_per_second = kOneSecondNanos;
+      break;
+  }
+  const int64_t nanos_per_unit = kOneSecondNanos / units_per_second;
+
+  for (int64_t i = 0; i < length; i++) {
+    const int64_t value = timestamp_array.Value(offset + i);
+    int64_t seconds = value / units_per_second;
+    int64_t remainder = value % units_per_second;
+    if (remainder < 0) {
+      seconds--;
+      remainder += units_per_second;
+    }
+    batch->data[i] = seconds;
+    batch->nanoseconds[i] = remainder * nanos_per_unit;
+  }
+  return Status::OK();
+}
+
+template <class array_type>
+Status WriteBinaryBatch(const Array& array, int64_t offset, int64_t length,
+                        liborc::ColumnVectorBatch* cbatch) {
+  const auto& binary_array = checked_cast<const array_type&>(array);
+  auto batch = checked_cast<liborc::StringVectorBatch*>(cbatch);
+  for (int64_t i = 0; i < length; i++) {
+    if (binary_array.IsValid(offset + i)) {
+      // No copy, liborc only reads the data when the batch is written
+      auto view = binary_array.GetView(offset + i);
+      batch->data[i] = const_cast<char*>(view.data());
+      batch->length[i] = static_cast<int64_t>(view.size());
+    } else {
+      batch->data[i] = nullptr;
+      batch->length[i] = 0;
+    }
+  }
+  return Status::OK();
+}
+
+Status WriteDecimalBatch(const Array& array, int64_t offset, int64_t length,
+                         liborc::ColumnVectorBatch* cbatch) {
+  const auto& decimal_array = checked_cast<const Decimal128Array&>(array);
+  const auto& type = checked_cast<const Decimal128Type&>(*array.type());
+  if (type.precision() > 18) {
+    auto batch = checked_cast<liborc::Decimal128VectorBatch*>(cbatch);
+    batch->precision = type.precision();
+    batch->scale = type.scale();
+    for (int64_t i = 0; i < length; i++) {
+      const Decimal128 value(decimal_array.GetValue(offset + i));
+      batch->values[i] = liborc::Int128(value.high_bits(), value.low_bits());
+    }
+  } else {
+    auto batch = checked_cast<liborc::Decimal64VectorBatch*>(cbatch);
+    batch->precision = type.precision();
+    batch->scale = type.scale();
+    for (int64_t i = 0; i < length; i++) {
+      const Decimal128 value(decimal_array.GetValue(offset + i));
+      batch->values[i] = static_cast<int64_t>(value.low_bits());
+    }
+  }
+  return Status::OK();
+}
+
+Status WriteStructBatch(const Array& array, int64_t offset, int64_t length,
+                        liborc::ColumnVectorBatch* cbatch) {
+  const auto& struct_array = checked_cast<const StructArray&>(array);
+  auto batch = checked_cast<liborc::StructVectorBatch*>(cbatch);
+  for (int i = 0; i < struct_array.num_fields(); i++) {
+    RETURN_NOT_OK(WriteBatch(*struct_array.field(i), offset, length, batch->fields[i]));
+  }
+  return Status::OK();
+}
+
+// liborc expects the child values of a list or map batch to be packed, without
+// values for null entries.  Fill the offsets of the batch and return the
+// ranges of child values to write.
+template <class array_type>
+void GetListValueRanges(const array_type& list_array, int64_t offset, int64_t length,
+                        liborc::DataBuffer<int64_t>* offsets,
+                        std::vector<std::pair<int64_t, int64_t>>* ranges) {
+  int64_t num_values = 0;
+  (*offsets)[0] = 0;
+  for (int64_t i = 0; i < length; i++) {
+    const int64_t value_length = list_array.value_length(offset + i);
+    if (list_array.IsValid(offset + i) && value_length > 0) {
+      const int64_t value_offset = list_array.value_offset(offset + i);
+      if (!ranges->empty() &&
+          ranges->back().first + ranges->back().second == value_offset) {
+        ranges->back().second += value_length;
+      } else {
+        ranges->emplace_back(value_offset, value_length);
+      }
+      num_values += value_length;
+    }
+    (*offsets)[i + 1] = num_values;
+  }
+}
+
+Status WriteListValues(const Array& values,
+                       const std::vector<std::pair<int64_t, int64_t>>& ranges,
+                       liborc::ColumnVectorBatch* batch) {
+  if (ranges.empty()) {
+    return WriteBatch(values, 0, 0, batch);
+  }
+  if (ranges.size() == 1) {
+    return WriteBatch(values, ranges[0].first, ranges[0].second, batch);
+  }
+  // Only null entries with non-empty values need copying
+  ArrayVector pieces;
+  for (const auto& range : ranges) {
+    pieces.push_back(values.Slice(range.first, range.second));
+  }
+  ARROW_ASSIGN_OR_RAISE(auto packed, Concatenate(pieces));
+  return WriteBatch(*packed, 0, packed->length(), batch);
+}
+
+template <class array_type>
+Status WriteListBatch(const Array& array, int64_t offset, int64_t length,
+                      liborc::ColumnVectorBatch* cbatch) {
+  const auto& list_array = checked_cast<const array_type&>(array);
+  auto batch = checked_cast<liborc::ListVectorBatch*>(cbatch);
+  std::vector<std::pair<int64_t, int64_t>> ranges;
+  GetListValueRanges(list_array, offset, length, &batch->offsets, &ranges);
+  return WriteListValues(*list_array.values(), ranges, batch->elements.get());
+}
+
+Status WriteMapBatch(const Array& array, int64_t offset, int64_t length,
+                     liborc::ColumnVectorBatch* cbatch) {
+  const auto& map_array = checked_cast<const MapArray&>(array);
+  auto batch = checked_cast<liborc::MapVectorBatch*>(cbatch);
+  std::vector<std::pair<int64_t, int64_t>> ranges;
+  GetListValueRanges(map_array, offset, length, &batch->offsets, &ranges);
+  RETURN_NOT_OK(WriteListValues(*map_array.keys(), ranges, batch->keys.get()));
+  return WriteListValues(*map_array.items(), ranges, batch->elements.get());
+}
+
+Status WriteBatch(const Array& array, int64_t offset, int64_t length,
+                  liborc::ColumnVectorBatch* batch) {
+  if (batch->capacity < static_cast<uint64_t>(length)) {
+    batch->resize(length);
+  }
+  batch->numElements = length;
+  batch->hasNulls = array.null_count() > 0;
+  if (batch->hasNulls) {
+    for (int64_t i = 0; i < length; i++) {
+      batch->notNull[i] = array.IsValid(offset + i);
+    }
+  }
+
+  switch (array.type_id()) {
+    case Type::BOOL:
+      return WriteNumericBatch<BooleanArray, liborc::LongVectorBatch, int64_t>(
+          array, offset, length, batch);
+    case Type::INT8:
+      return WriteNumericBatch<Int8Array, liborc::LongVectorBatch, int64_t>(
+          array, offset, length, batch);
+    case Type::INT16:
+      return WriteNumericBatch<Int16Array, liborc::LongVectorBatch, int64_t>(
+          array, offset, length, batch);
+    case Type::INT32:
+      return WriteNumericBatch<Int32Array, liborc::LongVectorBatch, int64_t>(
+          array, offset, length, batch);
+    case Type::INT64:
+      return WriteNumericBatch<Int64Array, liborc::LongVectorBatch, int64_t>(
+          array, offset, length, batch);
+    case Type::FLOAT:
+      return WriteNumericBatch<FloatArray, liborc::DoubleVectorBatch, double>(
+          array, offset, length, batch);
+    case Type::DOUBLE:
+      return WriteNumericBatch<DoubleArray, liborc::DoubleVectorBatch, double>(
+          array, offset, length, batch);
+    case Type::DATE32:
+      return WriteNumericBatch<Date32Array, liborc::LongVectorBatch, int64_t>(
+          array, offset, length, batch);
+    case Type::DATE64:
+      return WriteDate64Batch(array, offset, length, batch);
+    case Type::TIMESTAMP:
+      return WriteTimestampBatch(array, offset, length, batch);
+    case Type::STRING:
+      return WriteBinaryBatch<StringArray>(array, offset, length, batch);
+    case Type::LARGE_STRING:
+      return WriteBinaryBatch<LargeStringArray>(array, offset, length, batch);
+    case Type::BINARY:
+      return WriteBinaryBatch<BinaryArray>(array, offset, length, batch);
+    case Type::LARGE_BINARY:
+      return WriteBinaryBatch<LargeBinaryArray>(array, offset, length, batch);
+    case Type::FIXED_SIZE_BINARY:
+      return WriteBinaryBatch<FixedSizeBinaryArray>(array, offset, length, batch);
+    case Type::DECIMAL:
+      return WriteDecimalBatch(array, offset, length, batch);
+    case Type::STRUCT:
+      return WriteStructBatch(array, offset, length, batch);
+    case Type::LIST:
+      return WriteListBatch<ListArray>(array, offset, length, batch);
+    case Type::LARGE_LIST:
+      return WriteListBatch<LargeListArray>(array, offset, length, batch);
+    case Type::FIXED_SIZE_LIST:
+      return WriteListBatch<FixedSizeListArray>(array, offset, length, batch);
+    case Type::MAP:
+      return WriteMapBatch(array, offset, length, batch);
+    default:
+      return Status::NotImplemented("Writing Arrow type ", array.type()->ToString(),
+                                    " to ORC is not supported");
+  }
+}
+
+Status GetOrcType(const DataType& type, ORC_UNIQUE_PTR<liborc::Type>* out) {
+  switch (type.id()) {
+    case Type::BOOL:
+      *out = liborc::createPrimitiveType(liborc::BOOLEAN);
+      break;
+    case Type::INT8:
+      *out = liborc::createPrimitiveType(liborc::BYTE);
+      break;
+    case Type::INT16:
+      *out = liborc::createPrimitiveType(liborc::SHORT);
+      break;
+    case Type::INT32:
+      *out = liborc::createPrimitiveType(liborc::INT);
+      break;
+    case Type::INT64:
+      *out = liborc::createPrimitiveType(liborc::LONG);
+      break;
+    case Type::FLOAT:
+      *out = liborc::createPrimitiveType(liborc::FLOAT);
+      break;
+    case Type::DOUBLE:
+      *out = liborc::createPrimitiveType(liborc::DOUBLE);
+      break;
+    case Type::STRING:
+    case Type::LARGE_STRING:
+      *out = liborc::createPrimitiveType(liborc::STRING);
+      break;
+    case Type::BINARY:
+    case Type::LARGE_BINARY:
+    case Type::FIXED_SIZE_BINARY:
+      *out = liborc::createPrimitiveType(liborc::BINARY);
+      break;
+    case Type::DATE32:
+    case Type::DATE64:
+      *out = liborc::createPrimitiveType(liborc::DATE);
+      break;
+    case Type::TIMESTAMP:
+      *out = liborc::createPrimitiveType(liborc::TIMESTAMP);
+      break;
+    case Type::DECIMAL: {
+      const auto& decimal_type = checked_cast<const Decimal128Type&>(type);
+      *out = liborc::createDecimalType(static_cast<uint64_t>(decimal_type.precision()),
+                                       static_cast<uint64_t>(decimal_type.scale()));
+      break;
+    }
+    case Type::LIST:
+    case Type::LARGE_LIST:
+    case Type::FIXED_SIZE_LIST: {
+      ORC_UNIQUE_PTR<liborc::Type> elemtype;
+      RETURN_NOT_OK(GetOrcType(*checked_cast<const BaseListType&>(type).value_type(),
+                               &elemtype));
+      *out = liborc::createListType(std::move(elemtype));
+      break;
+    }
+    case Type::MAP: {
+      const auto& map_type = checked_cast<const MapType&>(type);
+      ORC_UNIQUE_PTR<liborc::Type> keytype;
+      ORC_UNIQUE_PTR<liborc::Type> valtype;
+      RETURN_NOT_OK(GetOrcType(*map_type.key_type(), &keytype));
+      RETURN_NOT_OK(GetOrcType(*map_type.item_type(), &valtype));
+      *out = liborc::createMapType(std::move(keytype), std::move(valtype));
+      break;
+    }
+    case Type::STRUCT: {
+      ORC_UNIQUE_PTR<liborc::Type> struct_type = liborc::createStructType();
+      for (const auto& child : type.fields()) {
+        ORC_UNIQUE_PTR<liborc::Type> elemtype;
+        RETURN_NOT_OK(GetOrcType(*child->type(), &elemtype));
+        struct_type->addStructField(child->name(), std::move(elemtype));
+      }
+      *out = std::move(struct_type);
+      break;
+    }
+    default:
+      return Status::NotImplemented("Writing Arrow type ", type.ToString(),
+                                    " to ORC is not supported");
+  }
+  return Status::OK();
+}
+
+Status GetOrcType(const Schema& schema, ORC_UNIQUE_PTR<liborc::Type>* out) {
+  ORC_UNIQUE_PTR<liborc::Type> struct_type = liborc::createStructType();
+  for (const auto& field : schema.fields()) {
+    ORC_UNIQUE_PTR<liborc::Type> elemtype;
+    RETURN_NOT_OK(GetOrcType(*field->type(), &elemtype));
+    struct_type->addStructField(field->name(), std::move(elemtype));
+  }
+  *out = std::move(struct_type);
+  return Status::OK();
+}
+
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
@@ -36,6 +36,17 @@ Status GetArrowType(const liborc::Type* type, std::shared_ptr<DataType>* out);
 
 Status AppendBatch(const liborc::Type* type, liborc::ColumnVectorBatch* batch,
                    int64_t offset, int64_t length, ArrayBuilder* builder);
+
+Status GetOrcType(const DataType& type, ORC_UNIQUE_PTR<liborc::Type>* out);
+
+Status GetOrcType(const Schema& schema, ORC_UNIQUE_PTR<liborc::Type>* out);
+
+/// \brief Write a range of an Arrow array into an ORC ColumnVectorBatch
+///
+/// The batch is grown as needed. Binary data is not copied: the batch points
+/// into the array's buffers, which must stay alive until the batch is written.
+Status WriteBatch(const Array& array, int64_t offset, int64_t length,
+                  liborc::ColumnVectorBatch* batch);
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
@@ -21,6 +21,7 @@
 #include <memory>
 
 #include "arrow/array/array_base.h"
+#include "arrow/array/binary_view_internal.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
@@ -43,6 +44,21 @@ Status ValidateStringData(const StringArrayType& array) {
   return Status::OK();
 }
 
+// The values of offset-based string arrays are contiguous: if all their bytes
+// are ASCII, which is checked with SIMD where available, they are all valid.
+template <typename StringArrayType>
+Status ValidateContiguousStringData(const StringArrayType& array) {
+  if (array.length() > 0 && array.value_data() != nullptr) {
+    const int64_t begin = array.value_offset(0);
+    const int64_t end = array.value_offset(array.length());
+    if (begin >= 0 && begin <= end && end <= array.value_data()->size() &&
+        util::ValidateAscii(array.value_data()->data() + begin, end - begin)) {
+      return Status::OK();
+    }
+  }
+  return ValidateStringData(array);
+}
+
 }  // namespace
 
 BinaryArray::BinaryArray(const std::shared_ptr<ArrayData>& data) {
@@ -85,7 +101,9 @@ StringArray::StringArray(int64_t length, const std::shared_ptr<Buffer>& value_of
                           offset));
 }
 
-Status StringArray::ValidateUTF8() const { return ValidateStringData(*this); }
+Status StringArray::ValidateUTF8() const {
+  return ValidateContiguousStringData(*this);
+}
 
 LargeStringArray::LargeStringArray(const std::shared_ptr<ArrayData>& data) {
   ARROW_CHECK_EQ(data->type->id(), Type::LARGE_STRING);
@@ -101,7 +119,47 @@ LargeStringArray::LargeStringArray(int64_t length,
                           null_count, offset));
 }
 
-Status LargeStringArray::ValidateUTF8() const { return ValidateStringData(*this); }
+Status LargeStringArray::ValidateUTF8() const {
+  return ValidateContiguousStringData(*this);
+}
+
+BinaryViewArray::BinaryViewArray(const std::shared_ptr<ArrayData>& data) {
+  ARROW_CHECK_EQ(data->type->id(), Type::BINARY_VIEW);
+  SetData(data);
+}
+
+BinaryViewArray::BinaryViewArray(const std::shared_ptr<DataType>& type, int64_t length,
+                                 const std::shared_ptr<Buffer>& views,
+                                 BufferVector data_buffers,
+                                 const std::shared_ptr<Buffer>& null_bitmap,
+                                 int64_t null_count, int64_t offset) {
+  data_buffers.insert(data_buffers.begin(), {null_bitmap, views});
+  SetData(ArrayData::Make(type, length, std::move(data_buffers), null_count, offset));
+}
+
+void BinaryViewArray::SetData(const std::shared_ptr<ArrayData>& data) {
+  this->Array::SetData(data);
+  raw_views_ = data->GetValuesSafe<c_type>(1, /*offset=*/0);
+}
+
+util::string_view BinaryViewArray::GetView(int64_t i) const {
+  return internal::GetBinaryView(raw_views_[i + data_->offset],
+                                 data_->buffers.data() + 2);
+}
+
+StringViewArray::StringViewArray(const std::shared_ptr<ArrayData>& data) {
+  ARROW_CHECK_EQ(data->type->id(), Type::STRING_VIEW);
+  SetData(data);
+}
+
+StringViewArray::StringViewArray(int64_t length, const std::shared_ptr<Buffer>& views,
+                                 BufferVector data_buffers,
+                                 const std::shared_ptr<Buffer>& null_bitmap,
+                                 int64_t null_count, int64_t offset)
+    : BinaryViewArray(utf8_view(), length, views, std::move(data_buffers), null_bitmap,
+                      null_count, offset) {}
+
+Status StringViewArray::ValidateUTF8() const { return ValidateStringData(*this); }
 
 FixedSizeBinaryArray::FixedSizeBinaryArray(const std::shared_ptr<ArrayData>& data) {
   SetData(data);
@@ -196,6 +196,75 @@ class ARROW_EXPORT LargeStringArray : public LargeBinaryArray {
   Status ValidateUTF8() const;
 };
 
+// ----------------------------------------------------------------------
+// Binary and String views
+
+/// Concrete Array class for variable-size binary data stored as views
+class ARROW_EXPORT BinaryViewArray : public FlatArray {
+ public:
+  using TypeClass = BinaryViewType;
+  using c_type = BinaryViewType::c_type;
+
+  explicit BinaryViewArray(const std::shared_ptr<ArrayData>& data);
+
+  /// \brief Construct a BinaryViewArray
+  ///
+  /// \param[in] type a BinaryViewType or StringViewType instance
+  /// \param[in] length the number of values
+  /// \param[in] views the buffer of value views
+  /// \param[in] data_buffers the buffers referenced by the views of values
+  /// too long to be stored inline
+  /// \param[in] null_bitmap the optional validity bitmap
+  /// \param[in] null_count the number of nulls, if known
+  /// \param[in] offset the array offset
+  BinaryViewArray(const std::shared_ptr<DataType>& type, int64_t length,
+                  const std::shared_ptr<Buffer>& views, BufferVector data_buffers,
+                  const std::shared_ptr<Buffer>& null_bitmap = NULLPTR,
+                  int64_t null_count = kUnknownNullCount, int64_t offset = 0);
+
+  /// \brief Get binary value as a string_view
+  util::string_view GetView(int64_t i) const;
+
+  /// \brief Get binary value as a std::string
+  std::string GetString(int64_t i) const { return std::string(GetView(i)); }
+
+  /// Note that this buffer does not account for any slice offset
+  const std::shared_ptr<Buffer>& views() const { return data_->buffers[1]; }
+
+  const c_type* raw_views() const { return raw_views_ + data_->offset; }
+
+  /// The number of buffers holding out-of-line value data
+  int64_t num_data_buffers() const {
+    return static_cast<int64_t>(data_->buffers.size()) - 2;
+  }
+
+ protected:
+  // For subclasses
+  BinaryViewArray() = default;
+
+  void SetData(const std::shared_ptr<ArrayData>& data);
+
+  const c_type* raw_views_ = NULLPTR;
+};
+
+/// Concrete Array class for variable-size string (utf-8) data stored as views
+class ARROW_EXPORT StringViewArray : public BinaryViewArray {
+ public:
+  using TypeClass = StringViewType;
+
+  explicit StringViewArray(const std::shared_ptr<ArrayData>& data);
+
+  StringViewArray(int64_t length, const std::shared_ptr<Buffer>& views,
+                  BufferVector data_buffers,
+                  const std::shared_ptr<Buffer>& null_bitmap = NULLPTR,
+                  int64_t null_count = kUnknownNullCount, int64_t offset = 0);
+
+  /// \brief Validate that this array contains only valid UTF8 entries
+  ///
+  /// This check is also implied by ValidateFull()
+  Status ValidateUTF8() const;
+};
+
 // ----------------------------------------------------------------------
 // Fixed width binary
 
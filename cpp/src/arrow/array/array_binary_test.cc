@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <memory>
@@ -48,6 +49,9 @@ using StringTypes =
 
 using UTF8Types = ::testing::Types<StringType, LargeStringType>;
 
+using BinaryDataTypes = ::testing::Types<StringType, LargeStringType, BinaryType,
+                                         LargeBinaryType, StringViewType, BinaryViewType>;
+
 // ----------------------------------------------------------------------
 // String / Binary tests
 
@@ -233,6 +237,51 @@ class TestStringArray : public ::testing::Test {
         equal_array.Array::Slice(1)->RangeEquals(0, 2, 0, equal_array2.Array::Slice(1)));
   }
 
+  void TestCompareLongRanges() {
+    // Spans several validity words, some of them all valid and some mixed
+    const int64_t length = 300;
+    std::vector<uint8_t> is_valid(length);
+    BuilderType builder, other_builder;
+    for (int64_t i = 0; i < length; ++i) {
+      is_valid[i] = i < 128 || i % 3 != 0;
+      const std::string value(i % 5, static_cast<char>('a' + i % 7));
+      ASSERT_OK(builder.Append(value));
+      // Null slots hold different data, of a different length
+      ASSERT_OK(other_builder.Append(is_valid[i] ? value : "garbage"));
+    }
+    std::shared_ptr<Array> values, other_values;
+    ASSERT_OK(builder.Finish(&values));
+    ASSERT_OK(other_builder.Finish(&other_values));
+    ASSERT_OK_AND_ASSIGN(auto null_bitmap, internal::BytesToBits(is_valid));
+    const int64_t null_count = std::count(is_valid.begin(), is_valid.end(), 0);
+
+    const auto& v1 = checked_cast<const ArrayType&>(*values);
+    const auto& v2 = checked_cast<const ArrayType&>(*other_values);
+    auto array = std::make_shared<ArrayType>(length, v1.value_offsets(), v1.value_data(),
+                                             null_bitmap, null_count);
+    auto other = std::make_shared<ArrayType>(length, v2.value_offsets(), v2.value_data(),
+                                             null_bitmap, null_count);
+    ASSERT_TRUE(array->RangeEquals(other, 0, length, 0));
+    ASSERT_TRUE(array->RangeEquals(other, 10, 290, 10));
+    ASSERT_TRUE(array->Slice(5)->RangeEquals(0, length - 5, 5, other));
+
+    // Same lengths, different data in a valid slot
+    BuilderType modified_builder;
+    for (int64_t i = 0; i < length; ++i) {
+      ASSERT_OK(modified_builder.Append(i == 202 ? "zz" : v1.GetView(i)));
+    }
+    ASSERT_OK(modified_builder.Finish(&other_values));
+    const auto& v3 = checked_cast<const ArrayType&>(*other_values);
+    ASSERT_TRUE(is_valid[202]);
+    ASSERT_EQ(v1.value_length(202), v3.value_length(202));
+    other = std::make_shared<ArrayType>(length, v3.value_offsets(), v3.value_data(),
+                                        null_bitmap, null_count);
+    ASSERT_FALSE(array->Equals(other));
+    ASSERT_FALSE(array->RangeEquals(other, 0, length, 0));
+    ASSERT_TRUE(array->RangeEquals(other, 0, 202, 0));
+    ASSERT_TRUE(array->RangeEquals(other, 203, length, 203));
+  }
+
   void TestSliceGetString() {
     BuilderType builder;
 
@@ -349,6 +398,8 @@ TYPED_TEST(TestStringArray, TestEmptyStringComparison) {
 
 TYPED_TEST(TestStringArray, CompareNullByteSlots) { this->TestCompareNullByteSlots(); }
 
+TYPED_TEST(TestStringArray, CompareLongRanges) { this->TestCompareLongRanges(); }
+
 TYPED_TEST(TestStringArray, TestSliceGetString) { this->TestSliceGetString(); }
 
 TYPED_TEST(TestStringArray, TestValidateOffsets) { this->TestValidateOffsets(); }
@@ -570,6 +621,28 @@ class TestStringBuilder : public TestBuilder {
     ASSERT_EQ(reps * 40, result_->value_data()->size());
   }
 
+  void TestAppendOffsetsAndData() {
+    // Offsets of ["bb", "a", <null>, "ccc"] within a larger buffer
+    const std::string data = "xxbbaccc";
+    const std::vector<offset_type> offsets = {2, 4, 5, 5, 8};
+    // Validity bits 1, 1, 0, 1 starting at bit 3
+    const uint8_t bitmap[] = {0xd8};
+
+    ASSERT_OK(builder_->Append("first"));
+    ASSERT_OK(builder_->AppendValues(offsets.data(),
+                                     reinterpret_cast<const uint8_t*>(data.data()), 4,
+                                     bitmap, 3));
+    // Without bitmap, all values are valid
+    ASSERT_OK(builder_->AppendValues(offsets.data(),
+                                     reinterpret_cast<const uint8_t*>(data.data()), 2));
+    ASSERT_OK(builder_->AppendValues(offsets.data(), nullptr, 0));
+    Done();
+
+    CheckStringArray(*result_, {"first", "bb", "a", "", "ccc", "bb", "a"},
+                     {1, 1, 1, 0, 1, 1, 1});
+    ASSERT_EQ(1, result_->null_count());
+  }
+
   void TestZeroLength() {
     // All buffers are null
     Done();
@@ -600,6 +673,10 @@ TYPED_TEST(TestStringBuilder, TestAppendCStringsWithoutValidBytes) {
 
 TYPED_TEST(TestStringBuilder, TestCapacityReserve) { this->TestCapacityReserve(); }
 
+TYPED_TEST(TestStringBuilder, TestAppendOffsetsAndData) {
+  this->TestAppendOffsetsAndData();
+}
+
 TYPED_TEST(TestStringBuilder, TestZeroLength) { this->TestZeroLength(); }
 
 // ----------------------------------------------------------------------
@@ -775,6 +852,88 @@ struct BinaryAppender {
   std::vector<util::string_view> data;
 };
 
+// ----------------------------------------------------------------------
+// BinaryView / StringView tests
+
+TEST(TestBinaryViewArray, Builder) {
+  const std::string long_value(100, 'x');
+  StringViewBuilder builder;
+  ASSERT_OK(builder.Append("short"));
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK(builder.Append(""));
+  ASSERT_OK(builder.Append("exactly 12 b"));
+  ASSERT_OK(builder.Append(long_value));
+  ASSERT_OK(builder.AppendNulls(2));
+
+  std::shared_ptr<StringViewArray> array;
+  ASSERT_OK(builder.Finish(&array));
+  ASSERT_OK(array->ValidateFull());
+  ASSERT_EQ(7, array->length());
+  ASSERT_EQ(3, array->null_count());
+  // Only the long value is stored out of line
+  ASSERT_EQ(1, array->num_data_buffers());
+  ASSERT_TRUE(array->raw_views()[3].is_inline());
+  ASSERT_FALSE(array->raw_views()[4].is_inline());
+
+  ASSERT_EQ("short", array->GetView(0));
+  ASSERT_EQ("", array->GetView(2));
+  ASSERT_EQ("exactly 12 b", array->GetView(3));
+  ASSERT_EQ(long_value, array->GetString(4));
+  ASSERT_OK_AND_ASSIGN(auto scalar, array->Slice(4)->GetScalar(0));
+  AssertScalarsEqual(StringViewScalar(long_value), *scalar);
+}
+
+TEST(TestBinaryViewArray, ManyBlocks) {
+  const std::string long_value(BinaryViewBuilder::kBlockSize / 3, 'y');
+  BinaryViewBuilder builder;
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_OK(builder.Append(long_value + std::to_string(i)));
+  }
+  std::shared_ptr<BinaryViewArray> array;
+  ASSERT_OK(builder.Finish(&array));
+  ASSERT_OK(array->ValidateFull());
+  ASSERT_GT(array->num_data_buffers(), 1);
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_EQ(long_value + std::to_string(i), array->GetString(i));
+  }
+}
+
+TEST(TestBinaryViewArray, Equals) {
+  auto array = ArrayFromJSON(
+      utf8_view(), R"(["abc", null, "a long value stored out of line", "abd"])");
+  ASSERT_TRUE(array->Equals(ArrayFromJSON(
+      utf8_view(), R"(["abc", null, "a long value stored out of line", "abd"])")));
+  ASSERT_FALSE(array->Equals(ArrayFromJSON(
+      utf8_view(), R"(["abc", null, "a long value stored out of line!", "abd"])")));
+  ASSERT_FALSE(array->Equals(ArrayFromJSON(
+      utf8_view(), R"(["abc", null, "a long value stored out of linE", "abd"])")));
+  ASSERT_TRUE(array->Slice(2)->Equals(
+      ArrayFromJSON(utf8_view(), R"(["a long value stored out of line", "abd"])")));
+  ASSERT_FALSE(array->Equals(ArrayFromJSON(
+      binary_view(), R"(["abc", null, "a long value stored out of line", "abd"])")));
+}
+
+TEST(TestBinaryViewArray, Validate) {
+  auto array = ArrayFromJSON(binary_view(), R"(["a long value stored out of line"])");
+  auto data = array->data()->Copy();
+  // Missing data buffer
+  data->buffers.resize(2);
+  ASSERT_RAISES(Invalid, MakeArray(data)->ValidateFull());
+
+  // Prefix not matching the data
+  ASSERT_OK_AND_ASSIGN(auto views, data->buffers[1]->CopySlice(0, 16));
+  data = array->data()->Copy();
+  data->buffers[1] = views;
+  reinterpret_cast<BinaryViewType::c_type*>(views->mutable_data())->prefix[0] = 'b';
+  ASSERT_RAISES(Invalid, MakeArray(data)->ValidateFull());
+
+  // Invalid UTF8
+  StringViewBuilder builder;
+  ASSERT_OK(builder.Append("\xff"));
+  ASSERT_OK(builder.Finish(&array));
+  ASSERT_RAISES(Invalid, array->ValidateFull());
+}
+
 template <typename T>
 class TestBinaryDataVisitor : public ::testing::Test {
  public:
@@ -804,7 +963,7 @@ class TestBinaryDataVisitor : public ::testing::Test {
   std::shared_ptr<DataType> type_;
 };
 
-TYPED_TEST_SUITE(TestBinaryDataVisitor, StringTypes);
+TYPED_TEST_SUITE(TestBinaryDataVisitor, BinaryDataTypes);
 
 TYPED_TEST(TestBinaryDataVisitor, Basics) { this->TestBasics(); }
 
@@ -21,6 +21,7 @@
 #include <climits>
 #include <cstdint>
 #include <limits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -29,7 +30,9 @@
 #include "arrow/array/dict_internal.h"
 #include "arrow/array/util.h"
 #include "arrow/buffer.h"
+#include "arrow/chunked_array.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
@@ -37,6 +40,8 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/int_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -181,6 +186,32 @@ class DictionaryUnifierImpl : public DictionaryUnifier {
 
   Status Unify(const Array& dictionary) override { return Unify(dictionary, nullptr); }
 
+  Status GetResultWithIndexType(const std::shared_ptr<DataType>& index_type,
+                                std::shared_ptr<Array>* out_dict) override {
+    if (!is_integer(index_type->id())) {
+      return Status::TypeError("Dictionary index type must be integer, got ",
+                               index_type->ToString());
+    }
+    const auto& integer_type = checked_cast<const IntegerType&>(*index_type);
+    const int bit_width = integer_type.bit_width();
+    const bool is_signed = integer_type.is_signed();
+    const uint64_t max_length = bit_width == 64
+                                    ? static_cast<uint64_t>(
+                                          std::numeric_limits<int64_t>::max())
+                                    : (uint64_t(1) << (bit_width - is_signed));
+    const int64_t dict_length = memo_table_.size();
+    if (static_cast<uint64_t>(dict_length) > max_length) {
+      return Status::Invalid("The unified dictionary of ", dict_length,
+                             " values does not fit in index type ",
+                             index_type->ToString());
+    }
+    std::shared_ptr<ArrayData> data;
+    RETURN_NOT_OK(DictTraits::GetDictionaryArrayData(pool_, value_type_, memo_table_,
+                                                     0 /* start_offset */, &data));
+    *out_dict = MakeArray(data);
+    return Status::OK();
+  }
+
   Status GetResult(std::shared_ptr<DataType>* out_type,
                    std::shared_ptr<Array>* out_dict) override {
     int64_t dict_length = memo_table_.size();
@@ -240,6 +271,133 @@ Result<std::unique_ptr<DictionaryUnifier>> DictionaryUnifier::Make(
   return std::move(maker.result);
 }
 
+// ----------------------------------------------------------------------
+// ChunkedArray and Table dictionary unification
+
+namespace {
+
+// Distinct dictionaries unified by a single task of the first level of
+// UnifyChunkedArray's reduction
+constexpr int kMinDictionariesPerTask = 8;
+
+// The transpose map of each distinct dictionary of a ChunkedArray, computed
+// as a two-level tree reduction: contiguous groups of dictionaries are
+// unified in parallel, then the group dictionaries are unified in order,
+// which gives the same unified dictionary as unifying all of them in order.
+Status UnifyDictionariesParallel(const std::shared_ptr<DataType>& value_type,
+                                 const std::shared_ptr<DataType>& index_type,
+                                 const std::vector<std::shared_ptr<Array>>& dictionaries,
+                                 MemoryPool* pool,
+                                 std::vector<std::shared_ptr<Buffer>>* transpose_maps,
+                                 std::shared_ptr<Array>* out_dict) {
+  const int num_dictionaries = static_cast<int>(dictionaries.size());
+  const int num_groups =
+      std::max(1, std::min(GetCpuThreadPoolCapacity(),
+                           num_dictionaries / kMinDictionariesPerTask));
+  transpose_maps->resize(num_dictionaries);
+  if (num_groups == 1) {
+    ARROW_ASSIGN_OR_RAISE(auto unifier, DictionaryUnifier::Make(value_type, pool));
+    for (int i = 0; i < num_dictionaries; ++i) {
+      RETURN_NOT_OK(unifier->Unify(*dictionaries[i], &(*transpose_maps)[i]));
+    }
+    return unifier->GetResultWithIndexType(index_type, out_dict);
+  }
+
+  auto group_begin = [&](int group) {
+    return static_cast<int>(static_cast<int64_t>(num_dictionaries) * group / num_groups);
+  };
+  std::vector<std::shared_ptr<Array>> group_dicts(num_groups);
+  RETURN_NOT_OK(internal::ParallelFor(num_groups, [&](int group) -> Status {
+    ARROW_ASSIGN_OR_RAISE(auto unifier, DictionaryUnifier::Make(value_type, pool));
+    for (int i = group_begin(group); i < group_begin(group + 1); ++i) {
+      RETURN_NOT_OK(unifier->Unify(*dictionaries[i], &(*transpose_maps)[i]));
+    }
+    std::shared_ptr<DataType> unused_type;
+    return unifier->GetResult(&unused_type, &group_dicts[group]);
+  }));
+
+  ARROW_ASSIGN_OR_RAISE(auto unifier, DictionaryUnifier::Make(value_type, pool));
+  std::vector<std::shared_ptr<Buffer>> group_maps(num_groups);
+  for (int group = 0; group < num_groups; ++group) {
+    RETURN_NOT_OK(unifier->Unify(*group_dicts[group], &group_maps[group]));
+  }
+  RETURN_NOT_OK(unifier->GetResultWithIndexType(index_type, out_dict));
+
+  // Compose the transpose maps in place
+  return internal::ParallelFor(num_groups, [&](int group) -> Status {
+    const auto group_map = reinterpret_cast<const int32_t*>(group_maps[group]->data());
+    for (int i = group_begin(group); i < group_begin(group + 1); ++i) {
+      auto map = reinterpret_cast<int32_t*>((*transpose_maps)[i]->mutable_data());
+      const int64_t length = dictionaries[i]->length();
+      for (int64_t j = 0; j < length; ++j) {
+        map[j] = group_map[map[j]];
+      }
+    }
+    return Status::OK();
+  });
+}
+
+}  // namespace
+
+Result<std::shared_ptr<ChunkedArray>> DictionaryUnifier::UnifyChunkedArray(
+    const std::shared_ptr<ChunkedArray>& array, MemoryPool* pool) {
+  if (array->type()->id() != Type::DICTIONARY) {
+    return Status::TypeError("Expected a dictionary type, got ",
+                             array->type()->ToString());
+  }
+  const auto& dict_type = checked_cast<const DictionaryType&>(*array->type());
+
+  // Collect the distinct dictionaries. Consecutive chunks, e.g. from the row
+  // groups of a file, often have equal dictionaries that are not shared.
+  std::vector<std::shared_ptr<Array>> dictionaries;
+  std::vector<int> chunk_dictionary(array->num_chunks());
+  std::unordered_map<const ArrayData*, int> dictionary_ids;
+  for (int i = 0; i < array->num_chunks(); ++i) {
+    const auto& chunk = checked_cast<const DictionaryArray&>(*array->chunk(i));
+    const ArrayData* dict_data = chunk.data()->dictionary.get();
+    auto it = dictionary_ids.find(dict_data);
+    if (it != dictionary_ids.end()) {
+      chunk_dictionary[i] = it->second;
+      continue;
+    }
+    if (dictionaries.empty() || !dictionaries.back()->Equals(*chunk.dictionary())) {
+      dictionaries.push_back(chunk.dictionary());
+    }
+    chunk_dictionary[i] = static_cast<int>(dictionaries.size()) - 1;
+    dictionary_ids.emplace(dict_data, chunk_dictionary[i]);
+  }
+  if (dictionary_ids.size() <= 1) {
+    // All chunks already share their dictionary
+    return array;
+  }
+
+  std::vector<std::shared_ptr<Buffer>> transpose_maps;
+  std::shared_ptr<Array> unified_dict;
+  RETURN_NOT_OK(UnifyDictionariesParallel(dict_type.value_type(), dict_type.index_type(),
+                                          dictionaries, pool, &transpose_maps,
+                                          &unified_dict));
+
+  ArrayVector chunks(array->num_chunks());
+  RETURN_NOT_OK(internal::ParallelFor(array->num_chunks(), [&](int i) -> Status {
+    const auto& chunk = checked_cast<const DictionaryArray&>(*array->chunk(i));
+    const auto map =
+        reinterpret_cast<const int32_t*>(transpose_maps[chunk_dictionary[i]]->data());
+    return chunk.Transpose(array->type(), unified_dict, map, pool).Value(&chunks[i]);
+  }));
+  return std::make_shared<ChunkedArray>(std::move(chunks), array->type());
+}
+
+Result<std::shared_ptr<Table>> DictionaryUnifier::UnifyTable(const Table& table,
+                                                             MemoryPool* pool) {
+  ChunkedArrayVector columns = table.columns();
+  for (auto& column : columns) {
+    if (column->type()->id() == Type::DICTIONARY) {
+      ARROW_ASSIGN_OR_RAISE(column, UnifyChunkedArray(column, pool));
+    }
+  }
+  return Table::Make(table.schema(), std::move(columns), table.num_rows());
+}
+
 // ----------------------------------------------------------------------
 // DictionaryArray transposition
 
@@ -295,7 +453,7 @@ Result<std::shared_ptr<Array>> DictionaryArray::Transpose(
   // Default path: compute a buffer of transposed indices.
   ARROW_ASSIGN_OR_RAISE(
       auto out_buffer,
-      AllocateBuffer(data_->length * out_index_type.bit_width() * CHAR_BIT, pool));
+      AllocateBuffer(data_->length * out_index_type.bit_width() / CHAR_BIT, pool));
 
   // Shift null buffer if the original offset is non-zero
   std::shared_ptr<Buffer> null_bitmap;
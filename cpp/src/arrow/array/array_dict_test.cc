@@ -26,8 +26,10 @@
 
 #include "arrow/array.h"
 #include "arrow/builder.h"
+#include "arrow/chunked_array.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
@@ -1359,4 +1361,124 @@ TEST(TestDictionary, IndicesArray) {
   ASSERT_OK(arr->indices()->ValidateFull());
 }
 
+// Check that the chunks of `unified` all have dictionary `expected_dict` and
+// the same values as the chunks of `original`
+void AssertDictionariesUnified(const ChunkedArray& original, const ChunkedArray& unified,
+                               const Array& expected_dict) {
+  ASSERT_OK(unified.ValidateFull());
+  ASSERT_TRUE(unified.type()->Equals(*original.type()));
+  ASSERT_EQ(original.num_chunks(), unified.num_chunks());
+  for (int i = 0; i < original.num_chunks(); ++i) {
+    const auto& before = checked_cast<const DictionaryArray&>(*original.chunk(i));
+    const auto& after = checked_cast<const DictionaryArray&>(*unified.chunk(i));
+    AssertArraysEqual(expected_dict, *after.dictionary(), /*verbose=*/true);
+    ASSERT_EQ(before.length(), after.length());
+    for (int64_t j = 0; j < before.length(); ++j) {
+      ASSERT_EQ(before.IsNull(j), after.IsNull(j));
+      if (before.IsValid(j)) {
+        ASSERT_OK_AND_ASSIGN(auto before_value,
+                             before.dictionary()->GetScalar(before.GetValueIndex(j)));
+        ASSERT_OK_AND_ASSIGN(auto after_value,
+                             after.dictionary()->GetScalar(after.GetValueIndex(j)));
+        AssertScalarsEqual(*before_value, *after_value);
+      }
+    }
+  }
+}
+
+TEST(TestDictionary, UnifyChunkedArray) {
+  auto type = dictionary(int8(), utf8());
+  auto dict1 = ArrayFromJSON(utf8(), R"(["a", "b"])");
+  auto dict2 = ArrayFromJSON(utf8(), R"(["c", "b"])");
+  auto chunk1 = DictArrayFromJSON(type, "[1, 0, null]", R"(["a", "b"])");
+  auto chunk2 = std::make_shared<DictionaryArray>(
+      type, ArrayFromJSON(int8(), "[0, 1, 0]"), dict2);
+  // Shares the dictionary of chunk2
+  auto chunk3 = std::make_shared<DictionaryArray>(
+      type, ArrayFromJSON(int8(), "[1, null]"), dict2);
+  // Equal to the dictionary of chunk1
+  auto chunk4 = std::make_shared<DictionaryArray>(
+      type, ArrayFromJSON(int8(), "[1, 1]"), dict1);
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{chunk1, chunk2, chunk3, chunk4->Slice(1)});
+
+  ASSERT_OK_AND_ASSIGN(auto unified, DictionaryUnifier::UnifyChunkedArray(chunked));
+  AssertDictionariesUnified(*chunked, *unified,
+                            *ArrayFromJSON(utf8(), R"(["a", "b", "c"])"));
+  // The indices of a chunk whose dictionary is a prefix of the unified
+  // dictionary are reused
+  ASSERT_EQ(chunk1->data()->buffers[1], unified->chunk(0)->data()->buffers[1]);
+
+  // Chunks already sharing a dictionary are returned unchanged
+  ASSERT_OK_AND_ASSIGN(auto unified_again, DictionaryUnifier::UnifyChunkedArray(unified));
+  ASSERT_EQ(unified, unified_again);
+  auto empty = std::make_shared<ChunkedArray>(ArrayVector{}, type);
+  ASSERT_OK_AND_ASSIGN(unified_again, DictionaryUnifier::UnifyChunkedArray(empty));
+  ASSERT_EQ(empty, unified_again);
+
+  ASSERT_RAISES(TypeError, DictionaryUnifier::UnifyChunkedArray(
+                               std::make_shared<ChunkedArray>(dict1)));
+}
+
+TEST(TestDictionary, UnifyChunkedArrayManyDictionaries) {
+  // Enough dictionaries to be unified in several tasks
+  for (auto index_type : {int16(), uint8()}) {
+    auto type = dictionary(index_type, int32());
+    ArrayVector chunks;
+    for (int32_t i = 0; i < 200; ++i) {
+      Int32Builder dict_builder;
+      for (int32_t value = i; value < i + 5; ++value) {
+        ASSERT_OK(dict_builder.Append(value * 7 % 250));
+      }
+      std::shared_ptr<Array> dict;
+      ASSERT_OK(dict_builder.Finish(&dict));
+      chunks.push_back(std::make_shared<DictionaryArray>(
+          type, ArrayFromJSON(index_type, "[4, 0, null, 2, 1, 3]"), dict));
+    }
+    auto chunked = std::make_shared<ChunkedArray>(chunks);
+
+    Int32Builder expected_builder;
+    for (int32_t value = 0; value < 204; ++value) {
+      ASSERT_OK(expected_builder.Append(value * 7 % 250));
+    }
+    std::shared_ptr<Array> expected_dict;
+    ASSERT_OK(expected_builder.Finish(&expected_dict));
+
+    ASSERT_OK_AND_ASSIGN(auto unified, DictionaryUnifier::UnifyChunkedArray(chunked));
+    AssertDictionariesUnified(*chunked, *unified, *expected_dict);
+  }
+
+  // The unified dictionary does not fit in int8 indices
+  auto type = dictionary(int8(), int32());
+  ArrayVector chunks;
+  for (int32_t i = 0; i < 130; ++i) {
+    Int32Builder dict_builder;
+    ASSERT_OK(dict_builder.Append(i));
+    std::shared_ptr<Array> dict;
+    ASSERT_OK(dict_builder.Finish(&dict));
+    chunks.push_back(
+        std::make_shared<DictionaryArray>(type, ArrayFromJSON(int8(), "[0]"), dict));
+  }
+  ASSERT_RAISES(Invalid, DictionaryUnifier::UnifyChunkedArray(
+                             std::make_shared<ChunkedArray>(chunks)));
+}
+
+TEST(TestDictionary, UnifyTable) {
+  auto type = dictionary(int32(), utf8());
+  auto dict_column = std::make_shared<ChunkedArray>(ArrayVector{
+      DictArrayFromJSON(type, "[0, 1]", R"(["x", "y"])"),
+      DictArrayFromJSON(type, "[1, null]", R"(["z", "x"])")});
+  auto int_column = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(int64(), "[1, 2]"), ArrayFromJSON(int64(), "[3, 4]")});
+  auto table = Table::Make(schema({field("d", type), field("i", int64())}),
+                           {dict_column, int_column});
+
+  ASSERT_OK_AND_ASSIGN(auto unified, DictionaryUnifier::UnifyTable(*table));
+  ASSERT_OK(unified->ValidateFull());
+  AssertSchemaEqual(*table->schema(), *unified->schema());
+  AssertDictionariesUnified(*dict_column, *unified->column(0),
+                            *ArrayFromJSON(utf8(), R"(["x", "y", "z"])"));
+  ASSERT_EQ(int_column, unified->column(1));
+}
+
 }  // namespace arrow
@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/array/array_run_end.h"
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/array/run_end_internal.h"
+#include "arrow/array/util.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+// ----------------------------------------------------------------------
+// RunEndEncodedArray
+
+RunEndEncodedArray::RunEndEncodedArray(const std::shared_ptr<ArrayData>& data) {
+  ARROW_CHECK_EQ(data->type->id(), Type::RUN_END_ENCODED);
+  ARROW_CHECK_EQ(data->child_data.size(), 2);
+  SetData(data);
+}
+
+RunEndEncodedArray::RunEndEncodedArray(const std::shared_ptr<DataType>& type,
+                                       int64_t length,
+                                       const std::shared_ptr<Array>& run_ends,
+                                       const std::shared_ptr<Array>& values,
+                                       int64_t offset) {
+  ARROW_CHECK_EQ(type->id(), Type::RUN_END_ENCODED);
+  const auto& ree_type = checked_cast<const RunEndEncodedType&>(*type);
+  DCHECK(ree_type.run_end_type()->Equals(*run_ends->type()));
+  DCHECK(ree_type.value_type()->Equals(*values->type()));
+  SetData(ArrayData::Make(type, length, {nullptr}, {run_ends->data(), values->data()},
+                          /*null_count=*/0, offset));
+}
+
+Result<std::shared_ptr<RunEndEncodedArray>> RunEndEncodedArray::Make(
+    int64_t length, const std::shared_ptr<Array>& run_ends,
+    const std::shared_ptr<Array>& values, int64_t offset) {
+  ARROW_ASSIGN_OR_RAISE(auto type,
+                        RunEndEncodedType::Make(run_ends->type(), values->type()));
+  if (run_ends->length() != values->length()) {
+    return Status::Invalid("Run end encoded array has ", run_ends->length(),
+                           " run ends but ", values->length(), " values");
+  }
+  auto out = std::make_shared<RunEndEncodedArray>(type, length, run_ends, values, offset);
+  RETURN_NOT_OK(out->ValidateFull());
+  return out;
+}
+
+void RunEndEncodedArray::SetData(const std::shared_ptr<ArrayData>& data) {
+  this->Array::SetData(data);
+  run_ends_ = MakeArray(data->child_data[0]);
+  values_ = MakeArray(data->child_data[1]);
+}
+
+int64_t RunEndEncodedArray::FindPhysicalOffset() const {
+  return internal::FindPhysicalIndex(*data_, 0);
+}
+
+int64_t RunEndEncodedArray::FindPhysicalLength() const {
+  if (length() == 0) {
+    return 0;
+  }
+  return internal::FindPhysicalIndex(*data_, length() - 1) - FindPhysicalOffset() + 1;
+}
+
+namespace internal {
+
+int64_t FindPhysicalIndex(const ArrayData& data, int64_t i) {
+  const ArrayData& run_ends = *data.child_data[0];
+  switch (run_ends.type->id()) {
+    case Type::INT16:
+      return FindPhysicalIndex(run_ends.GetValues<int16_t>(1), run_ends.length,
+                               data.offset + i);
+    case Type::INT32:
+      return FindPhysicalIndex(run_ends.GetValues<int32_t>(1), run_ends.length,
+                               data.offset + i);
+    case Type::INT64:
+      return FindPhysicalIndex(run_ends.GetValues<int64_t>(1), run_ends.length,
+                               data.offset + i);
+    default:
+      DCHECK(false) << "Invalid run end type: " << run_ends.type->ToString();
+      return run_ends.length;
+  }
+}
+
+}  // namespace internal
+
+}  // namespace arrow
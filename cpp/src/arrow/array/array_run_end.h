@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/array/array_base.h"
+#include "arrow/array/data.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+// ----------------------------------------------------------------------
+// RunEndEncodedArray
+
+/// \brief Array type for run-end encoded data
+///
+/// A run-end encoded array stores each run of equal values once, along with
+/// the logical index at which the run ends. For example, the array
+///
+///   [1, 1, 1, null, null, 2]
+///
+/// would have run-end encoded representation
+///
+///   run_ends: [3, 5, 6]
+///   values: [1, null, 2]
+///
+/// Slicing only changes the logical offset and length of the array; the
+/// children are kept as-is.
+class ARROW_EXPORT RunEndEncodedArray : public Array {
+ public:
+  using TypeClass = RunEndEncodedType;
+
+  explicit RunEndEncodedArray(const std::shared_ptr<ArrayData>& data);
+
+  RunEndEncodedArray(const std::shared_ptr<DataType>& type, int64_t length,
+                     const std::shared_ptr<Array>& run_ends,
+                     const std::shared_ptr<Array>& values, int64_t offset = 0);
+
+  /// \brief Construct a RunEndEncodedArray from run ends and values, checking
+  /// that the children are consistent with each other and with the logical
+  /// length and offset
+  ///
+  /// \param[in] length the logical length of the array
+  /// \param[in] run_ends an int16, int32 or int64 array without nulls
+  /// \param[in] values the value of each run, with the same length as run_ends
+  /// \param[in] offset the logical offset of the array
+  static Result<std::shared_ptr<RunEndEncodedArray>> Make(
+      int64_t length, const std::shared_ptr<Array>& run_ends,
+      const std::shared_ptr<Array>& values, int64_t offset = 0);
+
+  const std::shared_ptr<Array>& run_ends() const { return run_ends_; }
+  const std::shared_ptr<Array>& values() const { return values_; }
+
+  /// \brief Return the index of the first run overlapping the array bounds
+  int64_t FindPhysicalOffset() const;
+
+  /// \brief Return the number of runs overlapping the array bounds
+  int64_t FindPhysicalLength() const;
+
+ private:
+  void SetData(const std::shared_ptr<ArrayData>& data);
+
+  std::shared_ptr<Array> run_ends_;
+  std::shared_ptr<Array> values_;
+};
+
+}  // namespace arrow
@@ -0,0 +1,148 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/scalar.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+class TestRunEndEncodedArray : public ::testing::Test {
+ public:
+  void SetUp() override {
+    // [1, 1, 1, null, null, 2]
+    run_ends_ = ArrayFromJSON(int32(), "[3, 5, 6]");
+    values_ = ArrayFromJSON(int64(), "[1, null, 2]");
+    ASSERT_OK_AND_ASSIGN(array_, RunEndEncodedArray::Make(6, run_ends_, values_));
+  }
+
+ protected:
+  std::shared_ptr<Array> run_ends_;
+  std::shared_ptr<Array> values_;
+  std::shared_ptr<RunEndEncodedArray> array_;
+};
+
+TEST_F(TestRunEndEncodedArray, Basics) {
+  ASSERT_TRUE(array_->type()->Equals(run_end_encoded(int32(), int64())));
+  ASSERT_EQ(6, array_->length());
+  ASSERT_EQ(0, array_->null_count());
+  ASSERT_EQ(0, array_->FindPhysicalOffset());
+  ASSERT_EQ(3, array_->FindPhysicalLength());
+  AssertArraysEqual(*run_ends_, *array_->run_ends());
+  AssertArraysEqual(*values_, *array_->values());
+  ASSERT_EQ("run_end_encoded<run_ends: int32, values: int64>",
+            array_->type()->ToString());
+}
+
+TEST_F(TestRunEndEncodedArray, InvalidType) {
+  ASSERT_RAISES(TypeError, RunEndEncodedType::Make(int8(), int64()));
+  ASSERT_RAISES(TypeError, RunEndEncodedType::Make(uint32(), int64()));
+  ASSERT_OK(RunEndEncodedType::Make(int16(), utf8()));
+}
+
+TEST_F(TestRunEndEncodedArray, Validate) {
+  // Run ends must be strictly increasing
+  ASSERT_RAISES(Invalid, RunEndEncodedArray::Make(
+                             6, ArrayFromJSON(int32(), "[3, 3, 6]"), values_));
+  // Run ends must not be null
+  ASSERT_RAISES(Invalid, RunEndEncodedArray::Make(
+                             6, ArrayFromJSON(int32(), "[3, null, 6]"), values_));
+  // Runs must cover the logical length
+  ASSERT_RAISES(Invalid, RunEndEncodedArray::Make(7, run_ends_, values_));
+  // Children lengths must match
+  ASSERT_RAISES(Invalid, RunEndEncodedArray::Make(
+                             6, run_ends_, ArrayFromJSON(int64(), "[1, 2]")));
+  ASSERT_OK(RunEndEncodedArray::Make(2, run_ends_, values_, /*offset=*/4));
+}
+
+TEST_F(TestRunEndEncodedArray, Slice) {
+  auto CheckSlice = [&](int64_t offset, int64_t length, int64_t physical_offset,
+                        int64_t physical_length) {
+    auto slice = array_->Slice(offset, length);
+    ASSERT_OK(slice->ValidateFull());
+    const auto& ree = checked_cast<const RunEndEncodedArray&>(*slice);
+    ASSERT_EQ(physical_offset, ree.FindPhysicalOffset());
+    ASSERT_EQ(physical_length, ree.FindPhysicalLength());
+  };
+  CheckSlice(2, 3, 0, 2);
+  CheckSlice(3, 3, 1, 2);
+  CheckSlice(5, 1, 2, 1);
+  CheckSlice(6, 0, 3, 0);
+}
+
+TEST_F(TestRunEndEncodedArray, GetScalar) {
+  ASSERT_OK_AND_ASSIGN(auto scalar, array_->GetScalar(2));
+  AssertScalarsEqual(RunEndEncodedScalar(MakeScalar(int64_t(1)), array_->type()),
+                     *scalar);
+  ASSERT_OK_AND_ASSIGN(scalar, array_->Slice(3)->GetScalar(2));
+  AssertScalarsEqual(RunEndEncodedScalar(MakeScalar(int64_t(2)), array_->type()),
+                     *scalar);
+}
+
+TEST_F(TestRunEndEncodedArray, Equals) {
+  // Same logical values with a different run layout
+  ASSERT_OK_AND_ASSIGN(auto other,
+                       RunEndEncodedArray::Make(
+                           6, ArrayFromJSON(int32(), "[1, 3, 4, 5, 6]"),
+                           ArrayFromJSON(int64(), "[1, 1, null, null, 2]")));
+  ASSERT_TRUE(array_->Equals(*other));
+  ASSERT_TRUE(array_->Slice(1, 4)->Equals(*other->Slice(1, 4)));
+  ASSERT_TRUE(array_->RangeEquals(3, 6, 0, other->Slice(3)));
+
+  ASSERT_OK_AND_ASSIGN(other, RunEndEncodedArray::Make(
+                                  6, run_ends_, ArrayFromJSON(int64(), "[1, null, 3]")));
+  ASSERT_FALSE(array_->Equals(*other));
+  ASSERT_TRUE(array_->Slice(0, 5)->Equals(*other->Slice(0, 5)));
+}
+
+TEST_F(TestRunEndEncodedArray, Concatenate) {
+  ASSERT_OK_AND_ASSIGN(auto concatenated,
+                       Concatenate({array_->Slice(4), array_, array_->Slice(1, 2)}));
+  ASSERT_OK(concatenated->ValidateFull());
+  ASSERT_EQ(10, concatenated->length());
+  const auto& ree = checked_cast<const RunEndEncodedArray&>(*concatenated);
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 2, 5, 7, 8, 10]"), *ree.run_ends());
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[null, 2, 1, null, 2, 1]"), *ree.values());
+}
+
+TEST_F(TestRunEndEncodedArray, MakeArrayOfNull) {
+  ASSERT_OK_AND_ASSIGN(auto nulls, MakeArrayOfNull(array_->type(), 5));
+  ASSERT_OK(nulls->ValidateFull());
+  const auto& ree = checked_cast<const RunEndEncodedArray&>(*nulls);
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[5]"), *ree.run_ends());
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[null]"), *ree.values());
+}
+
+TEST_F(TestRunEndEncodedArray, MakeArrayFromScalar) {
+  RunEndEncodedScalar scalar(MakeScalar(int64_t(7)), array_->type());
+  ASSERT_OK_AND_ASSIGN(auto repeated, MakeArrayFromScalar(scalar, 4));
+  ASSERT_OK(repeated->ValidateFull());
+  const auto& ree = checked_cast<const RunEndEncodedArray&>(*repeated);
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[4]"), *ree.run_ends());
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[7]"), *ree.values());
+}
+
+}  // namespace arrow
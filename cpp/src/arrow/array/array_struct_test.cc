@@ -343,6 +343,42 @@ TEST_F(TestStructBuilder, BulkAppend) {
                            list_lengths, list_offsets, int_values);
 }
 
+TEST_F(TestStructBuilder, BulkAppendUnsafe) {
+  std::vector<int32_t> int_values = {1, 2, 3, 4};
+  std::vector<char> list_values = {'j', 'o', 'e', 'b', 'o', 'b', 'm', 'a', 'r', 'k'};
+  std::vector<int> list_lengths = {3, 0, 3, 4};
+  std::vector<int> list_offsets = {0, 3, 3, 6};
+  std::vector<uint8_t> list_is_valid = {1, 0, 1, 1};
+  std::vector<uint8_t> struct_is_valid = {1, 1, 1, 1};
+  // All valid, starting at bit 4
+  const uint8_t struct_bitmap[] = {0xf0};
+
+  ListBuilder* list_vb = checked_cast<ListBuilder*>(builder_->field_builder(0));
+  Int8Builder* char_vb = checked_cast<Int8Builder*>(list_vb->value_builder());
+  Int32Builder* int_vb = checked_cast<Int32Builder*>(builder_->field_builder(1));
+
+  ASSERT_OK(builder_->AppendValues(struct_is_valid.size(), struct_bitmap, 4));
+  ASSERT_OK(list_vb->Reserve(list_lengths.size()));
+  ASSERT_OK(char_vb->Reserve(list_values.size()));
+
+  int pos = 0;
+  for (size_t i = 0; i < list_lengths.size(); ++i) {
+    if (list_is_valid[i]) {
+      list_vb->UnsafeAppend();
+    } else {
+      list_vb->UnsafeAppendNull();
+    }
+    for (int j = 0; j < list_lengths[i]; ++j) {
+      char_vb->UnsafeAppend(list_values[pos++]);
+    }
+  }
+  ASSERT_OK(int_vb->AppendValues(int_values));
+
+  Done();
+  ValidateBasicStructArray(result_.get(), struct_is_valid, list_values, list_is_valid,
+                           list_lengths, list_offsets, int_values);
+}
+
 TEST_F(TestStructBuilder, BulkAppendInvalid) {
   std::vector<int32_t> int_values = {1, 2, 3, 4};
   std::vector<char> list_values = {'j', 'o', 'e', 'b', 'o', 'b', 'm', 'a', 'r', 'k'};
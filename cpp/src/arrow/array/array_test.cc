@@ -246,6 +246,38 @@ TEST_F(TestArray, SliceRecomputeNullCount) {
   ASSERT_EQ(0, arr->null_count());
 }
 
+TEST_F(TestArray, ArraySpanSlice) {
+  auto array = ArrayFromJSON(int32(), "[1, null, 3, 4, null, 6, null, null, null]");
+  auto sliced = array->Slice(1, 7);
+
+  ArraySpan span(*sliced->data());
+  ASSERT_EQ(span.data, sliced->data().get());
+  ASSERT_EQ(span.offset, 1);
+  ASSERT_EQ(span.length, 7);
+  ASSERT_EQ(span.type().id(), Type::INT32);
+  ASSERT_EQ(span.GetValues<int32_t>(1), sliced->data()->GetValues<int32_t>(1));
+
+  // Slices are relative to the span, and clamped to its length
+  auto sub_span = span.Slice(2, 10);
+  ASSERT_EQ(sub_span.offset, 3);
+  ASSERT_EQ(sub_span.length, 5);
+  ASSERT_EQ(sub_span.GetValues<int32_t>(1)[0], 4);
+  ASSERT_EQ(sub_span.null_count, kUnknownNullCount);
+  ASSERT_EQ(sub_span.GetNullCount(), 3);
+  ASSERT_TRUE(sub_span.MayHaveNulls());
+
+  sub_span.SetSlice(1, 2);
+  ASSERT_EQ(sub_span.GetNullCount(), 1);
+  auto sub_array = MakeArray(sub_span.ToArrayData());
+  ASSERT_OK(sub_array->ValidateFull());
+  AssertArraysEqual(*array->Slice(4, 2), *sub_array);
+
+  // All null slices keep their null count
+  auto null_array = std::make_shared<NullArray>(10);
+  auto null_span = ArraySpan(*null_array->data()).Slice(3, 6);
+  ASSERT_EQ(null_span.null_count, 6);
+}
+
 TEST_F(TestArray, NullArraySliceNullCount) {
   auto null_arr = std::make_shared<NullArray>(10);
   auto null_arr_sliced = null_arr->Slice(3, 6);
@@ -849,6 +881,24 @@ TEST(NumericBuilderAccessors, TestSettersGetters) {
   ASSERT_EQ(((const NumericBuilder<Int64Type>&)builder)[0], new_datum);
 }
 
+TEST(NumericBuilderAccessors, AppendValuesBitmap) {
+  Int32Builder builder;
+  const std::vector<int32_t> values = {1, 2, 3, 4, 5};
+  // Validity bits 1, 0, 1, 1, 0 starting at bit 5
+  const uint8_t bitmap[] = {0xa0, 0x01};
+
+  ASSERT_OK(builder.Append(0));
+  ASSERT_OK(builder.AppendValues(values.data(), 5, bitmap, 5));
+  ASSERT_EQ(builder.length(), 6);
+  ASSERT_EQ(builder.null_count(), 2);
+  // Without bitmap, all values are valid
+  ASSERT_OK(builder.AppendValues(values.data(), 2, nullptr, 0));
+
+  std::shared_ptr<Array> out;
+  FinishAndCheckPadding(&builder, &out);
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[0, 1, null, 3, 4, null, 1, 2]"), *out);
+}
+
 typedef ::testing::Types<PBoolean, PUInt8, PUInt16, PUInt32, PUInt64, PInt8, PInt16,
                          PInt32, PInt64, PFloat, PDouble>
     Primitives;
@@ -1607,6 +1657,45 @@ TEST(TestPrimitiveAdHoc, FloatingInfinityEquality) {
   CheckFloatingInfinityEquality<DoubleType>();
 }
 
+TEST(TestPrimitiveAdHoc, EqualsLongRangesWithNulls) {
+  // Spans several validity words, some of them all valid and some mixed
+  const int64_t length = 300;
+  std::vector<uint8_t> is_valid(length);
+  std::vector<int32_t> values(length), other_values(length);
+  for (int64_t i = 0; i < length; ++i) {
+    is_valid[i] = i < 128 || i % 3 != 0;
+    values[i] = static_cast<int32_t>(i);
+    // Null slots hold different values
+    other_values[i] = is_valid[i] ? values[i] : -1;
+  }
+  ASSERT_OK_AND_ASSIGN(auto null_bitmap, internal::BytesToBits(is_valid));
+  const int64_t null_count = std::count(is_valid.begin(), is_valid.end(), 0);
+  auto array = std::make_shared<Int32Array>(length, Buffer::Wrap(values), null_bitmap,
+                                            null_count);
+  auto other = std::make_shared<Int32Array>(length, Buffer::Wrap(other_values),
+                                            null_bitmap, null_count);
+
+  ASSERT_TRUE(array->Equals(other));
+  ASSERT_TRUE(array->RangeEquals(other, 0, length, 0));
+  ASSERT_TRUE(array->RangeEquals(other, 10, 290, 10));
+  ASSERT_TRUE(array->Slice(5)->Equals(other->Slice(5)));
+
+  // A different value in a valid slot of a mixed word
+  ASSERT_TRUE(is_valid[200]);
+  other_values[200] = -2;
+  ASSERT_FALSE(array->Equals(other));
+  ASSERT_FALSE(array->RangeEquals(other, 0, length, 0));
+  ASSERT_TRUE(array->RangeEquals(other, 0, 200, 0));
+  ASSERT_TRUE(array->RangeEquals(other, 201, length, 201));
+  other_values[200] = values[200];
+
+  // A different value in a valid slot of an all-valid word
+  other_values[70] = -2;
+  ASSERT_FALSE(array->Equals(other));
+  ASSERT_FALSE(array->RangeEquals(other, 64, 128, 64));
+  ASSERT_TRUE(array->RangeEquals(other, 71, length, 71));
+}
+
 // ----------------------------------------------------------------------
 // FixedSizeBinary tests
 
@@ -2101,6 +2190,49 @@ TEST_F(TestAdaptiveIntBuilder, TestAppendNulls) {
   }
 }
 
+TEST_F(TestAdaptiveIntBuilder, TestWidenSegments) {
+  // Values of increasing widths, appended in bulk and one by one, with nulls
+  std::vector<int64_t> expected_values;
+  std::vector<bool> expected_valid;
+
+  std::vector<int64_t> values;
+  std::vector<bool> is_valid;
+  for (int64_t i = 0; i < 20000; ++i) {
+    values.push_back(i % 200 - 100);
+    is_valid.push_back(i % 7 != 0);
+  }
+  ASSERT_OK(builder_->AppendValues(values, is_valid));
+  expected_values.insert(expected_values.end(), values.begin(), values.end());
+  expected_valid.insert(expected_valid.end(), is_valid.begin(), is_valid.end());
+
+  ASSERT_OK(builder_->Append(-1000));
+  ASSERT_OK(builder_->AppendNulls(5));
+  expected_values.insert(expected_values.end(), {-1000, 0, 0, 0, 0, 0});
+  expected_valid.insert(expected_valid.end(), {true, false, false, false, false, false});
+  ASSERT_EQ(builder_->type()->id(), Type::INT16);
+
+  values = {1, -100000, 3};
+  ASSERT_OK(builder_->AppendValues(values));
+  expected_values.insert(expected_values.end(), values.begin(), values.end());
+  expected_valid.insert(expected_valid.end(), 3, true);
+  ASSERT_EQ(builder_->type()->id(), Type::INT32);
+
+  for (int64_t i = 0; i < 3000; ++i) {
+    const int64_t value = (i == 2500) ? std::numeric_limits<int64_t>::min() : i % 100;
+    ASSERT_OK(builder_->Append(value));
+    expected_values.push_back(value);
+    expected_valid.push_back(true);
+  }
+  ASSERT_OK(builder_->AppendNull());
+  expected_values.push_back(0);
+  expected_valid.push_back(false);
+  ASSERT_EQ(builder_->type()->id(), Type::INT64);
+  Done();
+
+  ArrayFromVector<Int64Type, int64_t>(expected_valid, expected_values, &expected_);
+  AssertArraysEqual(*expected_, *result_);
+}
+
 TEST(TestAdaptiveIntBuilderWithStartIntSize, TestReset) {
   auto builder = std::make_shared<AdaptiveIntBuilder>(
       static_cast<uint8_t>(sizeof(int16_t)), default_memory_pool());
@@ -2319,6 +2451,34 @@ TEST_F(TestAdaptiveUIntBuilder, TestAppendNulls) {
   }
 }
 
+TEST_F(TestAdaptiveUIntBuilder, TestWidenSegments) {
+  std::vector<uint64_t> expected_values;
+  std::vector<bool> expected_valid;
+
+  std::vector<uint64_t> values;
+  std::vector<bool> is_valid;
+  for (uint64_t i = 0; i < 10000; ++i) {
+    values.push_back(i % 200);
+    is_valid.push_back(i % 5 != 0);
+  }
+  ASSERT_OK(builder_->AppendValues(values, is_valid));
+  expected_values.insert(expected_values.end(), values.begin(), values.end());
+  expected_valid.insert(expected_valid.end(), is_valid.begin(), is_valid.end());
+
+  // Pending values are committed before a bulk append
+  ASSERT_OK(builder_->Append(70000));
+  values = {1, std::numeric_limits<uint64_t>::max(), 3};
+  ASSERT_OK(builder_->AppendValues(values));
+  expected_values.push_back(70000);
+  expected_values.insert(expected_values.end(), values.begin(), values.end());
+  expected_valid.insert(expected_valid.end(), 4, true);
+  ASSERT_EQ(builder_->type()->id(), Type::UINT64);
+  Done();
+
+  ArrayFromVector<UInt64Type, uint64_t>(expected_valid, expected_values, &expected_);
+  AssertArraysEqual(*expected_, *result_);
+}
+
 TEST(TestAdaptiveUIntBuilderWithStartIntSize, TestReset) {
   auto builder = std::make_shared<AdaptiveUIntBuilder>(
       static_cast<uint8_t>(sizeof(uint16_t)), default_memory_pool());
@@ -0,0 +1,147 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#include "arrow/buffer.h"
+#include "arrow/type.h"
+#include "arrow/util/string_view.h"
+
+namespace arrow {
+namespace internal {
+
+using BinaryView = BinaryViewType::c_type;
+
+/// \brief Make the view of a value, which is stored inline if it is short
+/// enough, or else at the given offset of the given data buffer
+inline BinaryView MakeBinaryView(util::string_view value, int32_t buffer_index,
+                                 int32_t offset) {
+  BinaryView view;
+  std::memset(&view, 0, sizeof(view));
+  view.size = static_cast<int32_t>(value.size());
+  if (view.is_inline()) {
+    if (view.size > 0) {
+      std::memcpy(view.prefix, value.data(), value.size());
+    }
+  } else {
+    std::memcpy(view.prefix, value.data(), BinaryViewType::kPrefixSize);
+    view.buffer_index = buffer_index;
+    view.offset = offset;
+  }
+  return view;
+}
+
+/// \brief Return a pointer to the bytes of a value
+///
+/// \param[in] view the view of the value, which must outlive the pointer
+/// if the value is inline
+/// \param[in] data_buffers the data buffers of the array (starting at
+/// buffers[2])
+inline const uint8_t* GetBinaryViewData(const BinaryView& view,
+                                        const std::shared_ptr<Buffer>* data_buffers) {
+  return view.is_inline() ? view.inline_data()
+                          : data_buffers[view.buffer_index]->data() + view.offset;
+}
+
+inline util::string_view GetBinaryView(const BinaryView& view,
+                                       const std::shared_ptr<Buffer>* data_buffers) {
+  return util::string_view(
+      reinterpret_cast<const char*>(GetBinaryViewData(view, data_buffers)), view.size);
+}
+
+/// \brief A binary view along with the location of its bytes, comparing on
+/// the size and inline prefix before touching the bytes themselves
+struct ComparableBinaryView {
+  BinaryView view;
+  const uint8_t* data;
+
+  ComparableBinaryView() = default;
+
+  ComparableBinaryView(const BinaryView& view,
+                       const std::shared_ptr<Buffer>* data_buffers)
+      : view(view), data(GetBinaryViewData(view, data_buffers)) {}
+
+  /// The value bytes must outlive this object
+  explicit ComparableBinaryView(util::string_view value)
+      : view(MakeBinaryView(value, 0, 0)),
+        data(reinterpret_cast<const uint8_t*>(value.data())) {}
+
+  util::string_view ToStringView() const {
+    return util::string_view(reinterpret_cast<const char*>(data), view.size);
+  }
+
+  friend bool operator==(const ComparableBinaryView& left,
+                         const ComparableBinaryView& right) {
+    // Unused prefix bytes are zeroed, so the first 8 bytes of the views are
+    // equal for any two equal values
+    if (std::memcmp(&left.view, &right.view, 8) != 0) {
+      return false;
+    }
+    const int32_t size = left.view.size;
+    return size <= BinaryViewType::kPrefixSize ||
+           std::memcmp(left.data + BinaryViewType::kPrefixSize,
+                       right.data + BinaryViewType::kPrefixSize,
+                       size - BinaryViewType::kPrefixSize) == 0;
+  }
+
+  friend bool operator!=(const ComparableBinaryView& left,
+                         const ComparableBinaryView& right) {
+    return !(left == right);
+  }
+
+  /// Three-way comparison in the lexicographic byte order
+  static int Compare(const ComparableBinaryView& left,
+                     const ComparableBinaryView& right) {
+    const int32_t min_size = std::min(left.view.size, right.view.size);
+    int cmp = std::memcmp(left.view.prefix, right.view.prefix,
+                          std::min(min_size, BinaryViewType::kPrefixSize));
+    if (cmp == 0 && min_size > BinaryViewType::kPrefixSize) {
+      cmp = std::memcmp(left.data + BinaryViewType::kPrefixSize,
+                        right.data + BinaryViewType::kPrefixSize,
+                        min_size - BinaryViewType::kPrefixSize);
+    }
+    if (cmp == 0) {
+      return left.view.size < right.view.size ? -1 : left.view.size > right.view.size;
+    }
+    return cmp;
+  }
+
+  friend bool operator<(const ComparableBinaryView& left,
+                        const ComparableBinaryView& right) {
+    return Compare(left, right) < 0;
+  }
+  friend bool operator<=(const ComparableBinaryView& left,
+                         const ComparableBinaryView& right) {
+    return Compare(left, right) <= 0;
+  }
+  friend bool operator>(const ComparableBinaryView& left,
+                        const ComparableBinaryView& right) {
+    return Compare(left, right) > 0;
+  }
+  friend bool operator>=(const ComparableBinaryView& left,
+                         const ComparableBinaryView& right) {
+    return Compare(left, right) >= 0;
+  }
+};
+
+}  // namespace internal
+}  // namespace arrow
@@ -19,6 +19,8 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include <vector>
 
 #include "arrow/array/data.h"
 #include "arrow/buffer.h"
@@ -43,13 +45,15 @@ void AdaptiveIntBuilderBase::Reset() {
   pending_pos_ = 0;
   pending_has_nulls_ = false;
   int_size_ = start_int_size_;
+  narrow_segments_.clear();
+  segment_start_ = segment_offset_ = 0;
 }
 
 Status AdaptiveIntBuilderBase::Resize(int64_t capacity) {
   RETURN_NOT_OK(CheckCapacity(capacity));
   capacity = std::max(capacity, kMinBuilderCapacity);
 
-  int64_t nbytes = capacity * int_size_;
+  int64_t nbytes = segment_offset_ + (capacity - segment_start_) * int_size_;
   if (capacity_ == 0) {
     ARROW_ASSIGN_OR_RAISE(data_, AllocateResizableBuffer(nbytes, pool_));
   } else {
@@ -60,24 +64,41 @@ Status AdaptiveIntBuilderBase::Resize(int64_t capacity) {
   return ArrayBuilder::Resize(capacity);
 }
 
-template <typename new_type, typename old_type>
-typename std::enable_if<sizeof(old_type) >= sizeof(new_type), Status>::type
-AdaptiveIntBuilderBase::ExpandIntSizeInternal() {
-  return Status::OK();
+Status AdaptiveIntBuilderBase::ExpandIntSize(uint8_t new_int_size) {
+  DCHECK_GT(new_int_size, int_size_);
+  // Rather than widening the values appended so far, which would copy them
+  // again on each increase, keep them in a narrow segment until Finish
+  if (length_ > segment_start_) {
+    narrow_segments_.push_back({segment_start_, segment_offset_, int_size_});
+    segment_offset_ += (length_ - segment_start_) * int_size_;
+    segment_start_ = length_;
+  }
+  int_size_ = new_int_size;
+  if (capacity_ == 0) {
+    return Status::OK();
+  }
+  return Resize(capacity_);
 }
 
-template <typename new_type, typename old_type>
-typename std::enable_if<(sizeof(old_type) < sizeof(new_type)), Status>::type
-AdaptiveIntBuilderBase::ExpandIntSizeInternal() {
-  int_size_ = sizeof(new_type);
-  RETURN_NOT_OK(Resize(data_->size() / sizeof(old_type)));
-
-  const old_type* src = reinterpret_cast<old_type*>(raw_data_);
-  new_type* dst = reinterpret_cast<new_type*>(raw_data_);
-  // By doing the backward copy, we ensure that no element is overridden during
-  // the copy process while the copy stays in-place.
-  std::copy_backward(src, src + length_, dst + length_);
-
+Status AdaptiveIntBuilderBase::WidenSegments() {
+  if (narrow_segments_.empty()) {
+    return Status::OK();
+  }
+  const int64_t final_size = length_ * int_size_;
+  if (data_->size() < final_size) {
+    RETURN_NOT_OK(data_->Resize(final_size));
+    raw_data_ = data_->mutable_data();
+  }
+  // Each segment only moves forward, so moving them from the last one is safe
+  memmove(raw_data_ + segment_start_ * int_size_, raw_data_ + segment_offset_,
+          (length_ - segment_start_) * int_size_);
+  int64_t end = segment_start_;
+  for (auto it = narrow_segments_.rbegin(); it != narrow_segments_.rend(); ++it) {
+    WidenSegment(*it, end - it->start);
+    end = it->start;
+  }
+  narrow_segments_.clear();
+  segment_start_ = segment_offset_ = 0;
   return Status::OK();
 }
 
@@ -130,6 +151,7 @@ AdaptiveIntBuilder::AdaptiveIntBuilder(uint8_t start_int_size, MemoryPool* pool)
 
 Status AdaptiveIntBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   RETURN_NOT_OK(CommitPendingData());
+  RETURN_NOT_OK(WidenSegments());
 
   std::shared_ptr<Buffer> null_bitmap;
   RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
@@ -182,19 +204,19 @@ Status AdaptiveIntBuilder::AppendValuesInternal(const int64_t* values, int64_t l
 
     switch (int_size_) {
       case 1:
-        internal::DowncastInts(values, reinterpret_cast<int8_t*>(raw_data_) + length_,
+        internal::DowncastInts(values, reinterpret_cast<int8_t*>(mutable_tail()),
                                chunk_size);
         break;
       case 2:
-        internal::DowncastInts(values, reinterpret_cast<int16_t*>(raw_data_) + length_,
+        internal::DowncastInts(values, reinterpret_cast<int16_t*>(mutable_tail()),
                                chunk_size);
         break;
       case 4:
-        internal::DowncastInts(values, reinterpret_cast<int32_t*>(raw_data_) + length_,
+        internal::DowncastInts(values, reinterpret_cast<int32_t*>(mutable_tail()),
                                chunk_size);
         break;
       case 8:
-        internal::DowncastInts(values, reinterpret_cast<int64_t*>(raw_data_) + length_,
+        internal::DowncastInts(values, reinterpret_cast<int64_t*>(mutable_tail()),
                                chunk_size);
         break;
       default:
@@ -233,37 +255,39 @@ Status AdaptiveIntBuilder::AppendValues(const int64_t* values, int64_t length,
   return AppendValuesInternal(values, length, valid_bytes);
 }
 
+Status AdaptiveIntBuilder::AppendValues(const std::vector<int64_t>& values,
+                                        const std::vector<bool>& is_valid) {
+  DCHECK_EQ(values.size(), is_valid.size());
+  const std::vector<uint8_t> valid_bytes(is_valid.begin(), is_valid.end());
+  return AppendValues(values.data(), static_cast<int64_t>(values.size()),
+                      valid_bytes.data());
+}
+
 template <typename new_type>
-Status AdaptiveIntBuilder::ExpandIntSizeN() {
-  switch (int_size_) {
+void AdaptiveIntBuilder::WidenSegmentN(const Segment& segment, int64_t length) {
+  switch (segment.int_size) {
     case 1:
-      return ExpandIntSizeInternal<new_type, int8_t>();
+      return WidenValues<new_type, int8_t>(segment, length);
     case 2:
-      return ExpandIntSizeInternal<new_type, int16_t>();
+      return WidenValues<new_type, int16_t>(segment, length);
     case 4:
-      return ExpandIntSizeInternal<new_type, int32_t>();
-    case 8:
-      return ExpandIntSizeInternal<new_type, int64_t>();
+      return WidenValues<new_type, int32_t>(segment, length);
     default:
       DCHECK(false);
   }
-  return Status::OK();
 }
 
-Status AdaptiveIntBuilder::ExpandIntSize(uint8_t new_int_size) {
-  switch (new_int_size) {
-    case 1:
-      return ExpandIntSizeN<int8_t>();
+void AdaptiveIntBuilder::WidenSegment(const Segment& segment, int64_t length) {
+  switch (int_size_) {
     case 2:
-      return ExpandIntSizeN<int16_t>();
+      return WidenSegmentN<int16_t>(segment, length);
     case 4:
-      return ExpandIntSizeN<int32_t>();
+      return WidenSegmentN<int32_t>(segment, length);
     case 8:
-      return ExpandIntSizeN<int64_t>();
+      return WidenSegmentN<int64_t>(segment, length);
     default:
       DCHECK(false);
   }
-  return Status::OK();
 }
 
 AdaptiveUIntBuilder::AdaptiveUIntBuilder(uint8_t start_int_size, MemoryPool* pool)
@@ -271,6 +295,7 @@ AdaptiveUIntBuilder::AdaptiveUIntBuilder(uint8_t start_int_size, MemoryPool* poo
 
 Status AdaptiveUIntBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   RETURN_NOT_OK(CommitPendingData());
+  RETURN_NOT_OK(WidenSegments());
 
   std::shared_ptr<Buffer> null_bitmap;
   RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
@@ -306,19 +331,19 @@ Status AdaptiveUIntBuilder::AppendValuesInternal(const uint64_t* values, int64_t
 
     switch (int_size_) {
       case 1:
-        internal::DowncastUInts(values, reinterpret_cast<uint8_t*>(raw_data_) + length_,
+        internal::DowncastUInts(values, reinterpret_cast<uint8_t*>(mutable_tail()),
                                 chunk_size);
         break;
       case 2:
-        internal::DowncastUInts(values, reinterpret_cast<uint16_t*>(raw_data_) + length_,
+        internal::DowncastUInts(values, reinterpret_cast<uint16_t*>(mutable_tail()),
                                 chunk_size);
         break;
       case 4:
-        internal::DowncastUInts(values, reinterpret_cast<uint32_t*>(raw_data_) + length_,
+        internal::DowncastUInts(values, reinterpret_cast<uint32_t*>(mutable_tail()),
                                 chunk_size);
         break;
       case 8:
-        internal::DowncastUInts(values, reinterpret_cast<uint64_t*>(raw_data_) + length_,
+        internal::DowncastUInts(values, reinterpret_cast<uint64_t*>(mutable_tail()),
                                 chunk_size);
         break;
       default:
@@ -339,42 +364,45 @@ Status AdaptiveUIntBuilder::AppendValuesInternal(const uint64_t* values, int64_t
 
 Status AdaptiveUIntBuilder::AppendValues(const uint64_t* values, int64_t length,
                                          const uint8_t* valid_bytes) {
+  RETURN_NOT_OK(CommitPendingData());
   RETURN_NOT_OK(Reserve(length));
 
   return AppendValuesInternal(values, length, valid_bytes);
 }
 
+Status AdaptiveUIntBuilder::AppendValues(const std::vector<uint64_t>& values,
+                                         const std::vector<bool>& is_valid) {
+  DCHECK_EQ(values.size(), is_valid.size());
+  const std::vector<uint8_t> valid_bytes(is_valid.begin(), is_valid.end());
+  return AppendValues(values.data(), static_cast<int64_t>(values.size()),
+                      valid_bytes.data());
+}
+
 template <typename new_type>
-Status AdaptiveUIntBuilder::ExpandIntSizeN() {
-  switch (int_size_) {
+void AdaptiveUIntBuilder::WidenSegmentN(const Segment& segment, int64_t length) {
+  switch (segment.int_size) {
     case 1:
-      return ExpandIntSizeInternal<new_type, uint8_t>();
+      return WidenValues<new_type, uint8_t>(segment, length);
     case 2:
-      return ExpandIntSizeInternal<new_type, uint16_t>();
+      return WidenValues<new_type, uint16_t>(segment, length);
     case 4:
-      return ExpandIntSizeInternal<new_type, uint32_t>();
-    case 8:
-      return ExpandIntSizeInternal<new_type, uint64_t>();
+      return WidenValues<new_type, uint32_t>(segment, length);
     default:
       DCHECK(false);
   }
-  return Status::OK();
 }
 
-Status AdaptiveUIntBuilder::ExpandIntSize(uint8_t new_int_size) {
-  switch (new_int_size) {
-    case 1:
-      return ExpandIntSizeN<uint8_t>();
+void AdaptiveUIntBuilder::WidenSegment(const Segment& segment, int64_t length) {
+  switch (int_size_) {
     case 2:
-      return ExpandIntSizeN<uint16_t>();
+      return WidenSegmentN<uint16_t>(segment, length);
     case 4:
-      return ExpandIntSizeN<uint32_t>();
+      return WidenSegmentN<uint32_t>(segment, length);
     case 8:
-      return ExpandIntSizeN<uint64_t>();
+      return WidenSegmentN<uint64_t>(segment, length);
     default:
       DCHECK(false);
   }
-  return Status::OK();
 }
 
 }  // namespace arrow
@@ -21,6 +21,7 @@
 #include <cstring>
 #include <memory>
 #include <type_traits>
+#include <vector>
 
 #include "arrow/array/builder_base.h"
 #include "arrow/buffer.h"
@@ -45,7 +46,7 @@ class ARROW_EXPORT AdaptiveIntBuilderBase : public ArrayBuilder {
   Status AppendNulls(int64_t length) final {
     ARROW_RETURN_NOT_OK(CommitPendingData());
     ARROW_RETURN_NOT_OK(Reserve(length));
-    memset(data_->mutable_data() + length_ * int_size_, 0, int_size_ * length);
+    memset(mutable_tail(), 0, int_size_ * length);
     UnsafeSetNull(length);
     return Status::OK();
   }
@@ -82,12 +83,41 @@ class ARROW_EXPORT AdaptiveIntBuilderBase : public ArrayBuilder {
 
   virtual Status CommitPendingData() = 0;
 
+  // Values appended before an increase of the int size keep their width in
+  // "narrow segments", so that they are widened only once by Finish.  The
+  // current segment starts at row `segment_start_` and byte `segment_offset_`
+  // of the data.
+  struct Segment {
+    int64_t start;
+    int64_t offset;
+    uint8_t int_size;
+  };
+
+  // The address of the next value
+  uint8_t* mutable_tail() {
+    return raw_data_ + segment_offset_ + (length_ - segment_start_) * int_size_;
+  }
+
+  // Start a new segment for values of `new_int_size` bytes
+  Status ExpandIntSize(uint8_t new_int_size);
+
+  // Move the current segment to its final position, then widen the narrow
+  // segments to int_size_, last first
+  Status WidenSegments();
+
+  // Widen the `length` values of a narrow segment to int_size_
+  virtual void WidenSegment(const Segment& segment, int64_t length) = 0;
+
+  // Widen in place, from the last value so that none is overwritten before
+  // being read
   template <typename new_type, typename old_type>
-  typename std::enable_if<sizeof(old_type) >= sizeof(new_type), Status>::type
-  ExpandIntSizeInternal();
-  template <typename new_type, typename old_type>
-  typename std::enable_if<(sizeof(old_type) < sizeof(new_type)), Status>::type
-  ExpandIntSizeInternal();
+  void WidenValues(const Segment& segment, int64_t length) {
+    const auto* src = reinterpret_cast<const old_type*>(raw_data_ + segment.offset);
+    auto* dest = reinterpret_cast<new_type*>(raw_data_) + segment.start;
+    for (int64_t i = length - 1; i >= 0; --i) {
+      dest[i] = static_cast<new_type>(src[i]);
+    }
+  }
 
   std::shared_ptr<ResizableBuffer> data_;
   uint8_t* raw_data_ = NULLPTR;
@@ -95,6 +125,10 @@ class ARROW_EXPORT AdaptiveIntBuilderBase : public ArrayBuilder {
   const uint8_t start_int_size_;
   uint8_t int_size_;
 
+  std::vector<Segment> narrow_segments_;
+  int64_t segment_start_ = 0;
+  int64_t segment_offset_ = 0;
+
   static constexpr int32_t pending_size_ = 1024;
   uint8_t pending_valid_[pending_size_];
   uint64_t pending_data_[pending_size_];
@@ -127,19 +161,34 @@ class ARROW_EXPORT AdaptiveUIntBuilder : public internal::AdaptiveIntBuilderBase
   Status AppendValues(const uint64_t* values, int64_t length,
                       const uint8_t* valid_bytes = NULLPTR);
 
+  /// \brief Append a sequence of elements in one shot
+  /// \param[in] values a std::vector of values
+  /// \param[in] is_valid a std::vector<bool> indicating valid (1) or null
+  /// (0). Equal in length to values
+  /// \return Status
+  Status AppendValues(const std::vector<uint64_t>& values,
+                      const std::vector<bool>& is_valid);
+
+  /// \brief Append a sequence of elements in one shot
+  /// \param[in] values a std::vector of values
+  /// \return Status
+  Status AppendValues(const std::vector<uint64_t>& values) {
+    return AppendValues(values.data(), static_cast<int64_t>(values.size()));
+  }
+
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
 
   std::shared_ptr<DataType> type() const override;
 
  protected:
   Status CommitPendingData() override;
-  Status ExpandIntSize(uint8_t new_int_size);
 
   Status AppendValuesInternal(const uint64_t* values, int64_t length,
                               const uint8_t* valid_bytes);
 
   template <typename new_type>
-  Status ExpandIntSizeN();
+  void WidenSegmentN(const Segment& segment, int64_t length);
+  void WidenSegment(const Segment& segment, int64_t length) override;
 };
 
 class ARROW_EXPORT AdaptiveIntBuilder : public internal::AdaptiveIntBuilderBase {
@@ -165,19 +214,34 @@ class ARROW_EXPORT AdaptiveIntBuilder : public internal::AdaptiveIntBuilderBase
   Status AppendValues(const int64_t* values, int64_t length,
                       const uint8_t* valid_bytes = NULLPTR);
 
+  /// \brief Append a sequence of elements in one shot
+  /// \param[in] values a std::vector of values
+  /// \param[in] is_valid a std::vector<bool> indicating valid (1) or null
+  /// (0). Equal in length to values
+  /// \return Status
+  Status AppendValues(const std::vector<int64_t>& values,
+                      const std::vector<bool>& is_valid);
+
+  /// \brief Append a sequence of elements in one shot
+  /// \param[in] values a std::vector of values
+  /// \return Status
+  Status AppendValues(const std::vector<int64_t>& values) {
+    return AppendValues(values.data(), static_cast<int64_t>(values.size()));
+  }
+
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
 
   std::shared_ptr<DataType> type() const override;
 
  protected:
   Status CommitPendingData() override;
-  Status ExpandIntSize(uint8_t new_int_size);
 
   Status AppendValuesInternal(const int64_t* values, int64_t length,
                               const uint8_t* valid_bytes);
 
   template <typename new_type>
-  Status ExpandIntSizeN();
+  void WidenSegmentN(const Segment& segment, int64_t length);
+  void WidenSegment(const Segment& segment, int64_t length) override;
 };
 
 }  // namespace arrow
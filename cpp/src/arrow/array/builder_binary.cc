@@ -27,6 +27,7 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/array/binary_view_internal.h"
 #include "arrow/buffer.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
@@ -107,6 +108,92 @@ util::string_view FixedSizeBinaryBuilder::GetView(int64_t i) const {
                            byte_width_);
 }
 
+// ----------------------------------------------------------------------
+// BinaryViewBuilder, StringViewBuilder
+
+BinaryViewBuilder::BinaryViewBuilder(const std::shared_ptr<DataType>& type,
+                                     MemoryPool* pool)
+    : ArrayBuilder(pool),
+      type_(type),
+      views_builder_(pool),
+      block_builder_(pool) {}
+
+Status BinaryViewBuilder::Append(const uint8_t* value, int64_t length) {
+  if (ARROW_PREDICT_FALSE(length > std::numeric_limits<int32_t>::max())) {
+    return Status::CapacityError("BinaryView value of size ", length,
+                                 " exceeds the maximum value size");
+  }
+  RETURN_NOT_OK(Reserve(1));
+  util::string_view view(reinterpret_cast<const char*>(value),
+                         static_cast<size_t>(length));
+  if (length <= BinaryViewType::kInlineSize) {
+    views_builder_.UnsafeAppend(internal::MakeBinaryView(view, 0, 0));
+  } else {
+    if (block_builder_.length() + length > block_builder_.capacity()) {
+      RETURN_NOT_OK(FinishBlock());
+      RETURN_NOT_OK(block_builder_.Reserve(std::max(kBlockSize, length)));
+    }
+    views_builder_.UnsafeAppend(internal::MakeBinaryView(
+        view, static_cast<int32_t>(blocks_.size()),
+        static_cast<int32_t>(block_builder_.length())));
+    block_builder_.UnsafeAppend(value, length);
+  }
+  UnsafeAppendToBitmap(true);
+  return Status::OK();
+}
+
+Status BinaryViewBuilder::AppendNull() {
+  RETURN_NOT_OK(Reserve(1));
+  views_builder_.UnsafeAppend(internal::MakeBinaryView(util::string_view(), 0, 0));
+  UnsafeAppendToBitmap(false);
+  return Status::OK();
+}
+
+Status BinaryViewBuilder::AppendNulls(int64_t length) {
+  RETURN_NOT_OK(Reserve(length));
+  views_builder_.UnsafeAppend(length,
+                              internal::MakeBinaryView(util::string_view(), 0, 0));
+  UnsafeAppendToBitmap(length, false);
+  return Status::OK();
+}
+
+Status BinaryViewBuilder::FinishBlock() {
+  if (block_builder_.length() > 0) {
+    std::shared_ptr<Buffer> block;
+    RETURN_NOT_OK(block_builder_.Finish(&block));
+    blocks_.push_back(std::move(block));
+  }
+  return Status::OK();
+}
+
+void BinaryViewBuilder::Reset() {
+  ArrayBuilder::Reset();
+  views_builder_.Reset();
+  block_builder_.Reset();
+  blocks_.clear();
+}
+
+Status BinaryViewBuilder::Resize(int64_t capacity) {
+  RETURN_NOT_OK(CheckCapacity(capacity));
+  RETURN_NOT_OK(views_builder_.Resize(capacity));
+  return ArrayBuilder::Resize(capacity);
+}
+
+Status BinaryViewBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
+  RETURN_NOT_OK(FinishBlock());
+  std::shared_ptr<Buffer> null_bitmap, views;
+  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+  RETURN_NOT_OK(views_builder_.Finish(&views));
+
+  BufferVector buffers = {std::move(null_bitmap), std::move(views)};
+  buffers.insert(buffers.end(), blocks_.begin(), blocks_.end());
+  *out = ArrayData::Make(type_, length_, std::move(buffers), null_count_);
+
+  blocks_.clear();
+  capacity_ = length_ = null_count_ = 0;
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // ChunkedArray builders
 
@@ -226,6 +226,35 @@ class BaseBinaryBuilder : public ArrayBuilder {
     return Status::OK();
   }
 
+  /// \brief Append a sequence of values laid out as in a binary array
+  ///
+  /// The bytes spanned by the values are copied at once and the offsets are
+  /// rebased onto the data appended so far, without per-value checks.
+  ///
+  /// \param[in] offsets the `length + 1` offsets delimiting the values in `data`
+  /// \param[in] data the value bytes
+  /// \param[in] length the number of values to append
+  /// \param[in] bitmap an optional validity bitmap
+  /// \param[in] bitmap_offset the bit offset of the first value in bitmap
+  /// \return Status
+  Status AppendValues(const offset_type* offsets, const uint8_t* data, int64_t length,
+                      const uint8_t* bitmap = NULLPTR, int64_t bitmap_offset = 0) {
+    if (length == 0) {
+      return Status::OK();
+    }
+    const int64_t data_length = static_cast<int64_t>(offsets[length]) - offsets[0];
+    ARROW_RETURN_NOT_OK(Reserve(length));
+    ARROW_RETURN_NOT_OK(ReserveData(data_length));
+
+    const int64_t delta = value_data_length() - offsets[0];
+    for (int64_t i = 0; i < length; ++i) {
+      offsets_builder_.UnsafeAppend(static_cast<offset_type>(offsets[i] + delta));
+    }
+    value_data_builder_.UnsafeAppend(data + offsets[0], data_length);
+    UnsafeAppendToBitmap(bitmap, bitmap_offset, length);
+    return Status::OK();
+  }
+
   void Reset() override {
     ArrayBuilder::Reset();
     offsets_builder_.Reset();
@@ -510,6 +539,79 @@ class ARROW_EXPORT FixedSizeBinaryBuilder : public ArrayBuilder {
   void CheckValueSize(int64_t size);
 };
 
+// ----------------------------------------------------------------------
+// Binary and String view builders
+
+/// \brief Builder class for variable-size binary data stored as views
+///
+/// Values too long to be stored inline are copied into data blocks of at
+/// least kBlockSize bytes, which become the data buffers of the array.
+class ARROW_EXPORT BinaryViewBuilder : public ArrayBuilder {
+ public:
+  using TypeClass = BinaryViewType;
+
+  static constexpr int64_t kBlockSize = 32 * 1024;
+
+  explicit BinaryViewBuilder(MemoryPool* pool = default_memory_pool())
+      : BinaryViewBuilder(binary_view(), pool) {}
+
+  BinaryViewBuilder(const std::shared_ptr<DataType>& type,
+                    MemoryPool* pool = default_memory_pool());
+
+  Status Append(const uint8_t* value, int64_t length);
+
+  Status Append(const char* value, int64_t length) {
+    return Append(reinterpret_cast<const uint8_t*>(value), length);
+  }
+
+  Status Append(util::string_view value) {
+    return Append(value.data(), static_cast<int64_t>(value.size()));
+  }
+
+  Status AppendNull() final;
+
+  Status AppendNulls(int64_t length) final;
+
+  void Reset() override;
+  Status Resize(int64_t capacity) override;
+  Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
+
+  /// \cond FALSE
+  using ArrayBuilder::Finish;
+  /// \endcond
+
+  Status Finish(std::shared_ptr<BinaryViewArray>* out) { return FinishTyped(out); }
+
+  std::shared_ptr<DataType> type() const override { return type_; }
+
+ protected:
+  Status FinishBlock();
+
+  std::shared_ptr<DataType> type_;
+  TypedBufferBuilder<BinaryViewType::c_type> views_builder_;
+  BufferBuilder block_builder_;
+  BufferVector blocks_;
+};
+
+/// \brief Builder class for variable-size string data stored as views
+class ARROW_EXPORT StringViewBuilder : public BinaryViewBuilder {
+ public:
+  using TypeClass = StringViewType;
+
+  explicit StringViewBuilder(MemoryPool* pool = default_memory_pool())
+      : BinaryViewBuilder(utf8_view(), pool) {}
+
+  StringViewBuilder(const std::shared_ptr<DataType>& type,
+                    MemoryPool* pool = default_memory_pool())
+      : BinaryViewBuilder(type, pool) {}
+
+  /// \cond FALSE
+  using BinaryViewBuilder::Finish;
+  /// \endcond
+
+  Status Finish(std::shared_ptr<StringViewArray>* out) { return FinishTyped(out); }
+};
+
 // ----------------------------------------------------------------------
 // Chunked builders: build a sequence of BinaryArray or StringArray that are
 // limited to a particular size (to the upper limit of 2GB)
@@ -98,6 +98,17 @@ class BaseListBuilder : public ArrayBuilder {
 
   Status AppendNull() final { return Append(false); }
 
+  /// \brief Start a new list slot without checking capacity
+  ///
+  /// Reserve() must have been called beforehand, and the number of child
+  /// values must stay below maximum_elements().
+  void UnsafeAppend(bool is_valid = true) {
+    UnsafeAppendToBitmap(is_valid);
+    offsets_builder_.UnsafeAppend(static_cast<offset_type>(value_builder_->length()));
+  }
+
+  void UnsafeAppendNull() { UnsafeAppend(false); }
+
   Status AppendNulls(int64_t length) final {
     ARROW_RETURN_NOT_OK(Reserve(length));
     ARROW_RETURN_NOT_OK(CheckNextOffset());
@@ -395,6 +406,24 @@ class ARROW_EXPORT StructBuilder : public ArrayBuilder {
     return Status::OK();
   }
 
+  /// \brief Append an element to the Struct without checking capacity
+  ///
+  /// Reserve() must have been called beforehand. As with Append, the child
+  /// builders must be appended to independently.
+  void UnsafeAppend(bool is_valid = true) { UnsafeAppendToBitmap(is_valid); }
+
+  /// \brief Append a validity bitmap to the Struct
+  ///
+  /// As with Append, the child builders must be appended to independently.
+  /// \param[in] length the number of elements to append
+  /// \param[in] bitmap an optional validity bitmap
+  /// \param[in] bitmap_offset the bit offset of the first element in bitmap
+  Status AppendValues(int64_t length, const uint8_t* bitmap, int64_t bitmap_offset) {
+    ARROW_RETURN_NOT_OK(Reserve(length));
+    UnsafeAppendToBitmap(bitmap, bitmap_offset, length);
+    return Status::OK();
+  }
+
   /// \brief Append a null value. Automatically appends a null to each child
   /// builder.
   Status AppendNull() final {
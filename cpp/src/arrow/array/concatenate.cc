@@ -20,13 +20,16 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "arrow/array/array_base.h"
+#include "arrow/array/binary_view_internal.h"
 #include "arrow/array/data.h"
+#include "arrow/array/run_end_internal.h"
 #include "arrow/array/util.h"
 #include "arrow/buffer.h"
 #include "arrow/result.h"
@@ -38,11 +41,13 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/int_util_internal.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
 
 using internal::SafeSignedAdd;
+using internal::SafeSignedSubtract;
 
 /// offset, length pair for representing a Range of a buffer or array
 struct Range {
@@ -93,11 +98,85 @@ static Status ConcatenateBitmaps(const std::vector<Bitmap>& bitmaps, MemoryPool*
   return Status::OK();
 }
 
-// Write offsets in src into dst, adjusting them such that first_offset
-// will be the first offset written.
+// Minimum number of bytes copied by each task when concatenating on the CPU
+// thread pool, so that small outputs are not slowed down by the task overhead
+constexpr int64_t kMinParallelCopyBytes = 1 << 22;
+
+// Split the output of concatenating pieces of the given lengths, in units of
+// `unit_size` bytes, into regions of about the same size, and call
+// func(piece, offset, length, out_offset) for the part of each piece falling
+// in each region.  The regions are processed on the CPU thread pool when the
+// output is large enough, so that a single large copy uses all the threads.
+template <typename Func>
+static Status ForEachRegion(const std::vector<int64_t>& lengths, int64_t unit_size,
+                            Func&& func) {
+  std::vector<int64_t> out_offsets(lengths.size() + 1, 0);
+  for (size_t i = 0; i < lengths.size(); ++i) {
+    out_offsets[i + 1] = out_offsets[i] + lengths[i];
+  }
+  const int64_t total_length = out_offsets.back();
+
+  const int64_t num_regions =
+      internal::NumParallelTasks(total_length * unit_size, kMinParallelCopyBytes);
+
+  auto process_region = [&](int region) {
+    const int64_t begin = total_length * region / num_regions;
+    const int64_t end = total_length * (region + 1) / num_regions;
+    // The first piece ending after the region's start
+    size_t piece = std::upper_bound(out_offsets.begin(), out_offsets.end(), begin) -
+                   out_offsets.begin() - 1;
+    for (; piece < lengths.size() && out_offsets[piece] < end; ++piece) {
+      const int64_t out_begin = std::max(begin, out_offsets[piece]);
+      const int64_t out_end = std::min(end, out_offsets[piece + 1]);
+      if (out_end > out_begin) {
+        func(piece, out_begin - out_offsets[piece], out_end - out_begin, out_begin);
+      }
+    }
+    return Status::OK();
+  };
+  if (num_regions == 1) {
+    return process_region(0);
+  }
+  return internal::ParallelFor(static_cast<int>(num_regions), process_region);
+}
+
+// Allocate a buffer and concatenate buffers into it.
+static Status ParallelConcatenateBuffers(const BufferVector& buffers, MemoryPool* pool,
+                                         std::shared_ptr<Buffer>* out) {
+  std::vector<int64_t> lengths(buffers.size());
+  int64_t out_length = 0;
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    lengths[i] = buffers[i]->size();
+    out_length += lengths[i];
+  }
+  ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateBuffer(out_length, pool));
+  uint8_t* dst = buffer->mutable_data();
+  RETURN_NOT_OK(ForEachRegion(
+      lengths, 1, [&](size_t i, int64_t offset, int64_t length, int64_t out_offset) {
+        std::memcpy(dst + out_offset, buffers[i]->data() + offset, length);
+      }));
+  *out = std::move(buffer);
+  return Status::OK();
+}
+
+// Compute the range of values spanned by the offsets in src, checking that
+// they can be rebased to start at first_offset.
+template <typename Offset>
+static Status GetValuesRange(const std::shared_ptr<Buffer>& src, Offset first_offset,
+                             Range* values_range);
+
+// Write `length` offsets from src into dst, adding `adjustment` to each.
+// NOTE: Concatenate can be called during IPC reads to append delta dictionaries.
+// Avoid UB on non-validated input by doing the addition in the unsigned domain.
+// (the result can later be validated using Array::ValidateFull)
+// The loop has no branches, so that the compiler vectorizes it.
 template <typename Offset>
-static Status PutOffsets(const std::shared_ptr<Buffer>& src, Offset first_offset,
-                         Offset* dst, Range* values_range);
+static void RebaseOffsets(const Offset* src, int64_t length, Offset adjustment,
+                          Offset* dst) {
+  for (int64_t i = 0; i < length; ++i) {
+    dst[i] = SafeSignedAdd(src[i], adjustment);
+  }
+}
 
 // Concatenate buffers holding offsets into a single buffer of offsets,
 // also computing the ranges of values spanned by each buffer of offsets.
@@ -107,24 +186,32 @@ static Status ConcatenateOffsets(const BufferVector& buffers, MemoryPool* pool,
                                  std::vector<Range>* values_ranges) {
   values_ranges->resize(buffers.size());
 
-  // allocate output buffer
+  // The first offset from buffers[i] will be adjusted to the cumulative length
+  // of values spanned by offsets in previous buffers
+  std::vector<int64_t> lengths(buffers.size());
+  std::vector<Offset> adjustments(buffers.size());
   int64_t out_length = 0;
-  for (const auto& buffer : buffers) {
-    out_length += buffer->size() / sizeof(Offset);
+  Offset values_length = 0;
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    auto values_range = &values_ranges->at(i);
+    RETURN_NOT_OK(GetValuesRange<Offset>(buffers[i], values_length, values_range));
+    lengths[i] = buffers[i]->size() / sizeof(Offset);
+    out_length += lengths[i];
+    adjustments[i] =
+        SafeSignedSubtract(values_length, static_cast<Offset>(values_range->offset));
+    values_length += static_cast<Offset>(values_range->length);
   }
+
+  // allocate output buffer
   ARROW_ASSIGN_OR_RAISE(*out, AllocateBuffer((out_length + 1) * sizeof(Offset), pool));
   auto dst = reinterpret_cast<Offset*>((*out)->mutable_data());
 
-  int64_t elements_length = 0;
-  Offset values_length = 0;
-  for (size_t i = 0; i < buffers.size(); ++i) {
-    // the first offset from buffers[i] will be adjusted to values_length
-    // (the cumulative length of values spanned by offsets in previous buffers)
-    RETURN_NOT_OK(PutOffsets<Offset>(buffers[i], values_length, &dst[elements_length],
-                                     &values_ranges->at(i)));
-    elements_length += buffers[i]->size() / sizeof(Offset);
-    values_length += static_cast<Offset>(values_ranges->at(i).length);
-  }
+  RETURN_NOT_OK(ForEachRegion(
+      lengths, sizeof(Offset),
+      [&](size_t i, int64_t offset, int64_t length, int64_t out_offset) {
+        auto src = reinterpret_cast<const Offset*>(buffers[i]->data());
+        RebaseOffsets(src + offset, length, adjustments[i], dst + out_offset);
+      }));
 
   // the final element in dst is the length of all values spanned by the offsets
   dst[out_length] = values_length;
@@ -132,8 +219,8 @@ static Status ConcatenateOffsets(const BufferVector& buffers, MemoryPool* pool,
 }
 
 template <typename Offset>
-static Status PutOffsets(const std::shared_ptr<Buffer>& src, Offset first_offset,
-                         Offset* dst, Range* values_range) {
+static Status GetValuesRange(const std::shared_ptr<Buffer>& src, Offset first_offset,
+                             Range* values_range) {
   if (src->size() == 0) {
     // It's allowed to have an empty offsets buffer for a 0-length array
     // (see Array::Validate)
@@ -152,16 +239,6 @@ static Status PutOffsets(const std::shared_ptr<Buffer>& src, Offset first_offset
   if (first_offset > std::numeric_limits<Offset>::max() - values_range->length) {
     return Status::Invalid("offset overflow while concatenating arrays");
   }
-
-  // Write offsets into dst, ensuring that the first offset written is
-  // first_offset
-  auto adjustment = first_offset - src_begin[0];
-  // NOTE: Concatenate can be called during IPC reads to append delta dictionaries.
-  // Avoid UB on non-validated input by doing the addition in the unsigned domain.
-  // (the result can later be validated using Array::ValidateFull)
-  std::transform(src_begin, src_end, dst, [adjustment](Offset offset) {
-    return SafeSignedAdd(offset, adjustment);
-  });
   return Status::OK();
 }
 
@@ -205,7 +282,7 @@ class ConcatenateImpl {
   Status Visit(const FixedWidthType& fixed) {
     // Handles numbers, decimal128, fixed_size_binary
     ARROW_ASSIGN_OR_RAISE(auto buffers, Buffers(1, fixed));
-    return ConcatenateBuffers(buffers, pool_).Value(&out_->buffers[1]);
+    return ParallelConcatenateBuffers(buffers, pool_, &out_->buffers[1]);
   }
 
   Status Visit(const BinaryType&) {
@@ -214,7 +291,7 @@ class ConcatenateImpl {
     RETURN_NOT_OK(ConcatenateOffsets<int32_t>(index_buffers, pool_, &out_->buffers[1],
                                               &value_ranges));
     ARROW_ASSIGN_OR_RAISE(auto value_buffers, Buffers(2, value_ranges));
-    return ConcatenateBuffers(value_buffers, pool_).Value(&out_->buffers[2]);
+    return ParallelConcatenateBuffers(value_buffers, pool_, &out_->buffers[2]);
   }
 
   Status Visit(const LargeBinaryType&) {
@@ -223,7 +300,33 @@ class ConcatenateImpl {
     RETURN_NOT_OK(ConcatenateOffsets<int64_t>(index_buffers, pool_, &out_->buffers[1],
                                               &value_ranges));
     ARROW_ASSIGN_OR_RAISE(auto value_buffers, Buffers(2, value_ranges));
-    return ConcatenateBuffers(value_buffers, pool_).Value(&out_->buffers[2]);
+    return ParallelConcatenateBuffers(value_buffers, pool_, &out_->buffers[2]);
+  }
+
+  Status Visit(const BinaryViewType&) {
+    using internal::BinaryView;
+    ARROW_ASSIGN_OR_RAISE(auto view_buffers, Buffers(1, sizeof(BinaryView)));
+    RETURN_NOT_OK(ParallelConcatenateBuffers(view_buffers, pool_, &out_->buffers[1]));
+
+    // The data buffers are shared rather than copied: the data buffers of each
+    // input are appended in turn, and the views referring to them rebased
+    out_->buffers.resize(2);
+    auto views = reinterpret_cast<BinaryView*>(out_->buffers[1]->mutable_data());
+    int32_t buffer_index_offset = 0;
+    for (const auto& in : in_) {
+      if (buffer_index_offset > 0) {
+        for (int64_t i = 0; i < in->length; ++i) {
+          if (!views[i].is_inline()) {
+            views[i].buffer_index += buffer_index_offset;
+          }
+        }
+      }
+      views += in->length;
+      buffer_index_offset += static_cast<int32_t>(in->buffers.size() - 2);
+      out_->buffers.insert(out_->buffers.end(), in->buffers.begin() + 2,
+                           in->buffers.end());
+    }
+    return Status::OK();
   }
 
   Status Visit(const ListType&) {
@@ -274,7 +377,7 @@ class ConcatenateImpl {
     if (dictionaries_same) {
       out_->dictionary = in_[0]->dictionary;
       ARROW_ASSIGN_OR_RAISE(auto index_buffers, Buffers(1, *fixed));
-      return ConcatenateBuffers(index_buffers, pool_).Value(&out_->buffers[1]);
+      return ParallelConcatenateBuffers(index_buffers, pool_, &out_->buffers[1]);
     } else {
       return Status::NotImplemented("Concat with dictionary unification NYI");
     }
@@ -284,6 +387,19 @@ class ConcatenateImpl {
     return Status::NotImplemented("concatenation of ", u);
   }
 
+  Status Visit(const RunEndEncodedType& ree) {
+    switch (ree.run_end_type()->id()) {
+      case Type::INT16:
+        return ConcatenateRunEndEncoded<int16_t>(ree);
+      case Type::INT32:
+        return ConcatenateRunEndEncoded<int32_t>(ree);
+      case Type::INT64:
+        return ConcatenateRunEndEncoded<int64_t>(ree);
+      default:
+        return Status::Invalid("Invalid run end type: ", *ree.run_end_type());
+    }
+  }
+
   Status Visit(const ExtensionType& e) {
     // XXX can we just concatenate their storage?
     return Status::NotImplemented("concatenation of ", e);
@@ -376,6 +492,51 @@ class ConcatenateImpl {
     return bitmaps;
   }
 
+  // Run-end encoded inputs are concatenated run by run: only the runs overlapping
+  // each input's logical range are kept, and their run ends are shifted by the
+  // logical length of the preceding inputs.
+  template <typename RunEndCType>
+  Status ConcatenateRunEndEncoded(const RunEndEncodedType& ree) {
+    std::vector<std::shared_ptr<const ArrayData>> values(in_.size());
+    int64_t num_runs = 0;
+    for (size_t i = 0; i < in_.size(); ++i) {
+      int64_t physical_offset = 0, physical_length = 0;
+      if (in_[i]->length > 0) {
+        physical_offset = internal::FindPhysicalIndex(*in_[i], 0);
+        physical_length =
+            internal::FindPhysicalIndex(*in_[i], in_[i]->length - 1) - physical_offset + 1;
+      }
+      ARROW_ASSIGN_OR_RAISE(
+          values[i], in_[i]->child_data[1]->SliceSafe(physical_offset, physical_length));
+      num_runs += physical_length;
+    }
+    if (out_->length > std::numeric_limits<RunEndCType>::max()) {
+      return Status::Invalid("Concatenated run end encoded array of length ",
+                             out_->length, " does not fit run end type ",
+                             *ree.run_end_type());
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto run_ends,
+                          AllocateBuffer(num_runs * sizeof(RunEndCType), pool_));
+    auto out_run_ends = reinterpret_cast<RunEndCType*>(run_ends->mutable_data());
+    int64_t logical_offset = 0;
+    for (const auto& data : in_) {
+      RETURN_NOT_OK(internal::VisitRuns(
+          *data, [&](int64_t, int64_t run_start, int64_t run_length) {
+            *out_run_ends++ =
+                static_cast<RunEndCType>(logical_offset + run_start + run_length);
+            return Status::OK();
+          }));
+      logical_offset += data->length;
+    }
+
+    out_->buffers = {nullptr};
+    out_->null_count = 0;
+    out_->child_data[0] = ArrayData::Make(ree.run_end_type(), num_runs,
+                                          {nullptr, std::move(run_ends)}, 0);
+    return ConcatenateImpl(values, pool_).Concatenate(&out_->child_data[1]);
+  }
+
   // Gather the index-th child_data of each input into a vector.
   // Elements are sliced with that input's offset and length.
   Result<std::vector<std::shared_ptr<const ArrayData>>> ChildData(size_t index) {
@@ -419,6 +580,10 @@ Result<std::shared_ptr<Array>> Concatenate(const ArrayVector& arrays, MemoryPool
                              " were encountered.");
     }
     data[i] = arrays[i]->data();
+    if (!internal::IsCpuData(*data[i])) {
+      return Status::NotImplemented(
+          "Concatenating arrays in non-CPU memory, copy them to the CPU first");
+    }
   }
 
   std::shared_ptr<ArrayData> out_data;
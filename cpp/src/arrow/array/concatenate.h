@@ -27,6 +27,9 @@ namespace arrow {
 
 /// \brief Concatenate arrays
 ///
+/// The copies making up large outputs are split among the threads of the CPU
+/// thread pool.
+///
 /// \param[in] arrays a vector of arrays to be concatenated
 /// \param[in] pool memory to store the result will be allocated from this memory pool
 /// \return the concatenated array
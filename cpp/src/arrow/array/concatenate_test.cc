@@ -236,6 +236,20 @@ TEST_F(ConcatenateTest, DISABLED_UnionType) {
   });
 }
 
+TEST_F(ConcatenateTest, LargeOutputs) {
+  // Large enough for the copies to be split among threads
+  const int32_t size = 1 << 21;
+  for (auto array : {rng_.Int64(size, -100, 100, 0.1),
+                     rng_.String(size / 4, 0, 64, 0.1),
+                     rng_.LargeString(size / 4, 0, 64, 0.1)}) {
+    auto offsets = this->Offsets<int32_t>(static_cast<int32_t>(array->length()), 50);
+    auto expected = array->Slice(offsets.front(), offsets.back() - offsets.front());
+    ASSERT_OK_AND_ASSIGN(auto actual, Concatenate(this->Slices(array, offsets)));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*expected, *actual);
+  }
+}
+
 TEST_F(ConcatenateTest, OffsetOverflow) {
   auto fake_long = ArrayFromJSON(utf8(), "[\"\"]");
   fake_long->data()->GetMutableValues<int32_t>(1)[1] =
@@ -111,6 +111,42 @@ Result<std::shared_ptr<ArrayData>> ArrayData::SliceSafe(int64_t off, int64_t len
   return Slice(off, len);
 }
 
+namespace {
+
+using CopyBufferFunc = Result<std::shared_ptr<Buffer>> (*)(
+    std::shared_ptr<Buffer>, const std::shared_ptr<MemoryManager>&);
+
+Result<std::shared_ptr<ArrayData>> CopyArrayDataTo(
+    const ArrayData& data, const std::shared_ptr<MemoryManager>& to,
+    CopyBufferFunc copy_buffer) {
+  auto out = data.Copy();
+  for (auto& buffer : out->buffers) {
+    if (buffer) {
+      ARROW_ASSIGN_OR_RAISE(buffer, copy_buffer(std::move(buffer), to));
+    }
+  }
+  for (auto& child : out->child_data) {
+    ARROW_ASSIGN_OR_RAISE(child, CopyArrayDataTo(*child, to, copy_buffer));
+  }
+  if (out->dictionary) {
+    ARROW_ASSIGN_OR_RAISE(out->dictionary,
+                          CopyArrayDataTo(*out->dictionary, to, copy_buffer));
+  }
+  return out;
+}
+
+}  // namespace
+
+Result<std::shared_ptr<ArrayData>> ArrayData::CopyTo(
+    const std::shared_ptr<MemoryManager>& to) const {
+  return CopyArrayDataTo(*this, to, &Buffer::Copy);
+}
+
+Result<std::shared_ptr<ArrayData>> ArrayData::ViewOrCopyTo(
+    const std::shared_ptr<MemoryManager>& to) const {
+  return CopyArrayDataTo(*this, to, &Buffer::ViewOrCopy);
+}
+
 int64_t ArrayData::GetNullCount() const {
   int64_t precomputed = this->null_count.load();
   if (ARROW_PREDICT_FALSE(precomputed == kUnknownNullCount)) {
@@ -125,6 +161,40 @@ int64_t ArrayData::GetNullCount() const {
   return precomputed;
 }
 
+// ----------------------------------------------------------------------
+// ArraySpan
+
+void ArraySpan::SetSlice(int64_t off, int64_t len) {
+  DCHECK_LE(off, length) << "Slice offset greater than array length";
+  len = std::min(length - off, len);
+  if (null_count == length) {
+    null_count = len;
+  } else {
+    null_count = null_count != 0 ? kUnknownNullCount : 0;
+  }
+  offset += off;
+  length = len;
+}
+
+int64_t ArraySpan::GetNullCount() const {
+  if (ARROW_PREDICT_FALSE(null_count == kUnknownNullCount)) {
+    if (data->buffers[0]) {
+      null_count = length - CountSetBits(data->buffers[0]->data(), offset, length);
+    } else {
+      null_count = 0;
+    }
+  }
+  return null_count;
+}
+
+std::shared_ptr<ArrayData> ArraySpan::ToArrayData() const {
+  auto out = data->Copy();
+  out->length = length;
+  out->offset = offset;
+  out->null_count = null_count;
+  return out;
+}
+
 // ----------------------------------------------------------------------
 // Implement ArrayData::View
 
@@ -303,6 +373,20 @@ struct ViewDataImpl {
 
 namespace internal {
 
+bool IsCpuData(const ArrayData& data) {
+  for (const auto& buffer : data.buffers) {
+    if (buffer && !buffer->is_cpu()) {
+      return false;
+    }
+  }
+  for (const auto& child : data.child_data) {
+    if (!IsCpuData(*child)) {
+      return false;
+    }
+  }
+  return data.dictionary == nullptr || IsCpuData(*data.dictionary);
+}
+
 Result<std::shared_ptr<ArrayData>> GetArrayView(
     const std::shared_ptr<ArrayData>& data, const std::shared_ptr<DataType>& out_type) {
   ViewDataImpl impl;
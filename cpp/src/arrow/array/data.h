@@ -220,6 +220,18 @@ struct ARROW_EXPORT ArrayData {
   /// Note that unlike Slice, `length` isn't clamped to the available buffer size.
   Result<std::shared_ptr<ArrayData>> SliceSafe(int64_t offset, int64_t length) const;
 
+  /// \brief Copy all buffers, including those of children and dictionary,
+  /// to the given MemoryManager
+  ///
+  /// This supports cross-device copies, e.g. from host to CUDA memory.
+  Result<std::shared_ptr<ArrayData>> CopyTo(
+      const std::shared_ptr<MemoryManager>& to) const;
+
+  /// \brief Like CopyTo, but view buffers on the destination device without
+  /// copying them when possible
+  Result<std::shared_ptr<ArrayData>> ViewOrCopyTo(
+      const std::shared_ptr<MemoryManager>& to) const;
+
   void SetNullCount(int64_t v) { null_count.store(v); }
 
   /// \brief Return null count, or compute and set it if it's not known
@@ -244,8 +256,75 @@ struct ARROW_EXPORT ArrayData {
   std::shared_ptr<ArrayData> dictionary;
 };
 
+/// \class ArraySpan
+/// \brief Non-owning view of a slice of an ArrayData
+///
+/// Slicing an ArrayData allocates a new ArrayData and copies the shared
+/// pointers to its buffers and children, which dominates the cost of
+/// processing many small slices. An ArraySpan only holds a pointer to the
+/// viewed ArrayData and the offset and length of the slice: it is copied and
+/// sliced in constant time without allocating nor touching reference counts.
+///
+/// The viewed ArrayData must outlive the span. As with ArrayData, the offset
+/// of the span applies to the children of nested types.
+///
+/// \since 2.0.0
+struct ARROW_EXPORT ArraySpan {
+  ArraySpan() = default;
+
+  explicit ArraySpan(const ArrayData& data)
+      : data(&data),
+        length(data.length),
+        null_count(data.null_count.load()),
+        offset(data.offset) {}
+
+  const DataType& type() const { return *data->type; }
+
+  // Access a buffer's data as a typed C pointer, or NULLPTR if the buffer
+  // is absent
+  template <typename T>
+  inline const T* GetValues(int i, int64_t absolute_offset) const {
+    return data->GetValues<T>(i, absolute_offset);
+  }
+
+  template <typename T>
+  inline const T* GetValues(int i) const {
+    return GetValues<T>(i, offset);
+  }
+
+  /// \brief Restrict the span to `length` values starting at `offset`,
+  /// relative to the current slice
+  void SetSlice(int64_t offset, int64_t length);
+
+  /// \brief Construct a span of the given slice of this one
+  ArraySpan Slice(int64_t offset, int64_t length) const {
+    ArraySpan out = *this;
+    out.SetSlice(offset, length);
+    return out;
+  }
+
+  /// \brief Return null count, or compute and set it if it's not known
+  int64_t GetNullCount() const;
+
+  bool MayHaveNulls() const { return null_count != 0 && data->buffers[0] != NULLPTR; }
+
+  /// \brief Construct an ArrayData owning the buffers of this slice
+  std::shared_ptr<ArrayData> ToArrayData() const;
+
+  const ArrayData* data = NULLPTR;
+  int64_t length = 0;
+  mutable int64_t null_count = 0;
+  // The logical start point into the physical buffers, as in ArrayData
+  int64_t offset = 0;
+};
+
 namespace internal {
 
+/// Return whether all buffers of this ArrayData, including those of children
+/// and dictionary, are CPU-addressable.
+ARROW_EXPORT
+bool IsCpuData(const ArrayData& data);
+
 /// Construct a zero-copy view of this ArrayData with the given type.
 ///
 /// This method checks if the types are layout-compatible.
@@ -118,6 +118,10 @@ struct ValueComparatorVisitor {
     return Status::NotImplemented("dictionary type");
   }
 
+  Status Visit(const RunEndEncodedType&) {
+    return Status::NotImplemented("run end encoded type");
+  }
+
   ValueComparator Create(const DataType& type) {
     DCHECK_OK(VisitTypeInline(type, this));
     return out;
@@ -480,6 +484,21 @@ class MakeFormatterImpl {
     return Status::OK();
   }
 
+  Status Visit(const BinaryViewType&) {
+    impl_ = [](const Array& array, int64_t index, std::ostream* os) {
+      *os << HexEncode(checked_cast<const BinaryViewArray&>(array).GetView(index));
+    };
+    return Status::OK();
+  }
+
+  Status Visit(const StringViewType&) {
+    impl_ = [](const Array& array, int64_t index, std::ostream* os) {
+      *os << "\"" << Escape(checked_cast<const StringViewArray&>(array).GetView(index))
+          << "\"";
+    };
+    return Status::OK();
+  }
+
   // format Decimals with Decimal128Array::FormatValue
   Status Visit(const Decimal128Type&) {
     impl_ = [](const Array& array, int64_t index, std::ostream* os) {
@@ -611,6 +630,10 @@ class MakeFormatterImpl {
     return Status::NotImplemented("formatting diffs between arrays of type ", t);
   }
 
+  Status Visit(const RunEndEncodedType& t) {
+    return Status::NotImplemented("formatting diffs between arrays of type ", t);
+  }
+
   Status Visit(const ExtensionType& t) {
     return Status::NotImplemented("formatting diffs between arrays of type ", t);
   }
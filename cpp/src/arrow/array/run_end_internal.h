@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+#include "arrow/array/data.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief Return the index of the run containing the given logical index
+///
+/// run_ends must be strictly increasing. Returns num_runs if logical_index is
+/// past the last run end.
+template <typename RunEndCType>
+int64_t FindPhysicalIndex(const RunEndCType* run_ends, int64_t num_runs,
+                          int64_t logical_index) {
+  auto it = std::upper_bound(run_ends, run_ends + num_runs, logical_index,
+                             [](int64_t index, RunEndCType run_end) {
+                               return index < static_cast<int64_t>(run_end);
+                             });
+  return static_cast<int64_t>(it - run_ends);
+}
+
+template <typename RunEndCType, typename Visitor>
+Status VisitRunsImpl(const ArrayData& data, Visitor&& visit) {
+  const ArrayData& run_ends_data = *data.child_data[0];
+  const RunEndCType* run_ends = run_ends_data.GetValues<RunEndCType>(1);
+  const int64_t num_runs = run_ends_data.length;
+  const int64_t end = data.offset + data.length;
+
+  int64_t logical_pos = data.offset;
+  int64_t physical_index = FindPhysicalIndex(run_ends, num_runs, data.offset);
+  while (logical_pos < end) {
+    DCHECK_LT(physical_index, num_runs);
+    const int64_t run_end = std::min<int64_t>(run_ends[physical_index], end);
+    RETURN_NOT_OK(visit(physical_index, logical_pos - data.offset, run_end - logical_pos));
+    logical_pos = run_end;
+    ++physical_index;
+  }
+  return Status::OK();
+}
+
+/// \brief Visit the runs of a run-end encoded array
+///
+/// Calls visit(physical_index, run_start, run_length) for each run overlapping
+/// the logical range of the array, in order. physical_index indexes into the
+/// values child, run_start is relative to the array offset, and the first and
+/// last runs are clipped to the array bounds.
+template <typename Visitor>
+Status VisitRuns(const ArrayData& data, Visitor&& visit) {
+  switch (data.child_data[0]->type->id()) {
+    case Type::INT16:
+      return VisitRunsImpl<int16_t>(data, std::forward<Visitor>(visit));
+    case Type::INT32:
+      return VisitRunsImpl<int32_t>(data, std::forward<Visitor>(visit));
+    case Type::INT64:
+      return VisitRunsImpl<int64_t>(data, std::forward<Visitor>(visit));
+    default:
+      break;
+  }
+  return Status::Invalid("Invalid run end type: ", *data.child_data[0]->type);
+}
+
+/// \brief Return the index of the run containing the given logical index,
+/// which is relative to the array offset
+ARROW_EXPORT
+int64_t FindPhysicalIndex(const ArrayData& data, int64_t i);
+
+}  // namespace internal
+}  // namespace arrow
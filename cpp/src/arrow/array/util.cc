@@ -30,6 +30,8 @@
 #include "arrow/array/array_base.h"
 #include "arrow/array/array_dict.h"
 #include "arrow/array/array_primitive.h"
+#include "arrow/array/array_run_end.h"
+#include "arrow/array/binary_view_internal.h"
 #include "arrow/array/concatenate.h"
 #include "arrow/buffer.h"
 #include "arrow/buffer_builder.h"
@@ -127,6 +129,11 @@ class NullArrayFactory {
       return MaxOf(type.byte_width() * length_);
     }
 
+    Status Visit(const BinaryViewType&) {
+      // zeroed views are empty inline values
+      return MaxOf(sizeof(BinaryViewType::c_type) * length_);
+    }
+
     Status Visit(const StructType& type) {
       for (const auto& child : type.fields()) {
         RETURN_NOT_OK(MaxOf(GetBufferLength(child->type(), length_)));
@@ -152,6 +159,11 @@ class NullArrayFactory {
       return MaxOf(GetBufferLength(type.index_type(), length_));
     }
 
+    Status Visit(const RunEndEncodedType& type) {
+      // a single null run
+      return MaxOf(GetBufferLength(type.value_type(), 1));
+    }
+
     Status Visit(const ExtensionType& type) {
       // XXX is an extension array's length always == storage length
       return MaxOf(GetBufferLength(type.storage_type(), length_));
@@ -216,6 +228,11 @@ class NullArrayFactory {
     return Status::OK();
   }
 
+  Status Visit(const BinaryViewType&) {
+    out_->buffers.resize(2, buffer_);
+    return Status::OK();
+  }
+
   template <typename T>
   enable_if_var_size_list<T, Status> Visit(const T& type) {
     out_->buffers.resize(2, buffer_);
@@ -270,6 +287,18 @@ class NullArrayFactory {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    // A single run of nulls, or no runs at all if the array is empty
+    const int64_t num_runs = length_ > 0 ? 1 : 0;
+    out_->buffers = {nullptr};
+    out_->null_count = 0;
+    ARROW_ASSIGN_OR_RAISE(auto run_end, MakeScalar(type.run_end_type(), length_));
+    ARROW_ASSIGN_OR_RAISE(auto run_ends, MakeArrayFromScalar(*run_end, num_runs, pool_));
+    out_->child_data[0] = run_ends->data();
+    ARROW_ASSIGN_OR_RAISE(out_->child_data[1], CreateChild(1, num_runs));
+    return Status::OK();
+  }
+
   Status Visit(const DataType& type) {
     return Status::NotImplemented("construction of all-null ", type);
   }
@@ -336,6 +365,24 @@ class RepeatedArrayFactory {
     return Status::OK();
   }
 
+  Status Visit(const BinaryViewType&) {
+    // All views refer to a single copy of the value
+    const auto& value = *checked_cast<const BinaryViewScalar&>(scalar_).value;
+    const auto view = internal::MakeBinaryView(
+        util::string_view(reinterpret_cast<const char*>(value.data()),
+                          static_cast<size_t>(value.size())),
+        /*buffer_index=*/0, /*offset=*/0);
+    BufferVector buffers = {nullptr, nullptr};
+    RETURN_NOT_OK(CreateBufferOf(&view, sizeof(view), &buffers[1]));
+    if (!view.is_inline()) {
+      ARROW_ASSIGN_OR_RAISE(auto data, AllocateBuffer(value.size(), pool_));
+      std::memcpy(data->mutable_data(), value.data(), value.size());
+      buffers.push_back(std::move(data));
+    }
+    out_ = MakeArray(ArrayData::Make(scalar_.type, length_, std::move(buffers), 0));
+    return Status::OK();
+  }
+
   template <typename T>
   enable_if_var_size_list<T, Status> Visit(const T& type) {
     using ScalarType = typename TypeTraits<T>::ScalarType;
@@ -393,6 +440,17 @@ class RepeatedArrayFactory {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    const auto& value = checked_cast<const RunEndEncodedScalar&>(scalar_).value;
+    const int64_t num_runs = length_ > 0 ? 1 : 0;
+    ARROW_ASSIGN_OR_RAISE(auto run_end, MakeScalar(type.run_end_type(), length_));
+    ARROW_ASSIGN_OR_RAISE(auto run_ends, MakeArrayFromScalar(*run_end, num_runs, pool_));
+    ARROW_ASSIGN_OR_RAISE(auto values, MakeArrayFromScalar(*value, num_runs, pool_));
+    out_ = std::make_shared<RunEndEncodedArray>(scalar_.type, length_, std::move(run_ends),
+                                                std::move(values));
+    return Status::OK();
+  }
+
   Status Visit(const StructType& type) {
     ArrayVector fields;
     for (const auto& value : checked_cast<const StructScalar&>(scalar_).value) {
@@ -17,15 +17,19 @@
 
 #include "arrow/array/validate.h"
 
+#include <cstring>
 #include <vector>
 
 #include "arrow/array.h"  // IWYU pragma: keep
+#include "arrow/array/binary_view_internal.h"
+#include "arrow/array/run_end_internal.h"
 #include "arrow/buffer.h"
 #include "arrow/extension_type.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/int_util.h"
 #include "arrow/util/int_util_internal.h"
 #include "arrow/util/logging.h"
 #include "arrow/visitor_inline.h"
@@ -72,6 +76,19 @@ struct ValidateArrayVisitor {
 
   Status Visit(const LargeBinaryArray& array) { return ValidateBinaryArray(array); }
 
+  Status Visit(const BinaryViewArray& array) {
+    if (array.length() > 0 && array.views() == nullptr) {
+      return Status::Invalid("views buffer is null");
+    }
+    const auto& buffers = array.data()->buffers;
+    for (size_t i = 2; i < buffers.size(); ++i) {
+      if (buffers[i] == nullptr) {
+        return Status::Invalid("data buffer ", i - 2, " is null");
+      }
+    }
+    return Status::OK();
+  }
+
   Status Visit(const ListArray& array) { return ValidateListArray(array); }
 
   Status Visit(const LargeListArray& array) { return ValidateListArray(array); }
@@ -192,6 +209,46 @@ struct ValidateArrayVisitor {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedArray& array) {
+    const auto& ree_type = checked_cast<const RunEndEncodedType&>(*array.type());
+    const auto& run_ends = array.run_ends();
+    const auto& values = array.values();
+    if (!RunEndEncodedType::RunEndTypeValid(*run_ends->type()) ||
+        !run_ends->type()->Equals(*ree_type.run_end_type())) {
+      return Status::Invalid("Run ends array of type ", run_ends->type()->ToString(),
+                             " does not match type ", ree_type.ToString());
+    }
+    if (!values->type()->Equals(*ree_type.value_type())) {
+      return Status::Invalid("Values array of type ", values->type()->ToString(),
+                             " does not match type ", ree_type.ToString());
+    }
+    if (run_ends->length() != values->length()) {
+      return Status::Invalid("Run end encoded array has ", run_ends->length(),
+                             " run ends but ", values->length(), " values");
+    }
+    if (run_ends->null_count() != 0) {
+      return Status::Invalid("Run ends array must not contain nulls");
+    }
+    const Status run_ends_valid = ValidateArray(*run_ends);
+    if (!run_ends_valid.ok()) {
+      return Status::Invalid("Run ends array invalid: ", run_ends_valid.ToString());
+    }
+    const Status values_valid = ValidateArray(*values);
+    if (!values_valid.ok()) {
+      return Status::Invalid("Values array invalid: ", values_valid.ToString());
+    }
+    if (array.length() > 0) {
+      if (run_ends->length() == 0) {
+        return Status::Invalid("Non-empty run end encoded array has no runs");
+      }
+      if (FindPhysicalIndex(*array.data(), array.length() - 1) >= run_ends->length()) {
+        return Status::Invalid("Run ends do not cover run end encoded array of offset ",
+                               array.offset(), " and length ", array.length());
+      }
+    }
+    return Status::OK();
+  }
+
   Status Visit(const ExtensionArray& array) {
     const auto& ext_type = checked_cast<const ExtensionType&>(*array.type());
 
@@ -314,7 +371,14 @@ Status ValidateArray(const Array& array) {
     return Status::Invalid("Array length is negative");
   }
 
-  if (data.buffers.size() != layout.buffers.size()) {
+  // Binary views may have any number of data buffers after the views
+  if (is_binary_view_like(type.id())) {
+    if (data.buffers.size() < layout.buffers.size()) {
+      return Status::Invalid("Expected at least ", layout.buffers.size(),
+                             " buffers in array of type ", type.ToString(), ", got ",
+                             data.buffers.size());
+    }
+  } else if (data.buffers.size() != layout.buffers.size()) {
     return Status::Invalid("Expected ", layout.buffers.size(),
                            " buffers in array "
                            "of type ",
@@ -326,7 +390,7 @@ Status ValidateArray(const Array& array) {
     return Status::Invalid("Array of type ", type.ToString(),
                            " has impossibly large length and offset");
   }
-  for (int i = 0; i < static_cast<int>(data.buffers.size()); ++i) {
+  for (int i = 0; i < static_cast<int>(layout.buffers.size()); ++i) {
     const auto& buffer = data.buffers[i];
     const auto& spec = layout.buffers[i];
 
@@ -394,30 +458,6 @@ Status ValidateArray(const Array& array) {
 
 namespace {
 
-struct BoundsCheckVisitor {
-  int64_t min_value_;
-  int64_t max_value_;
-
-  Status Visit(const Array& array) {
-    // Default, should be unreachable
-    return Status::NotImplemented("");
-  }
-
-  template <typename T>
-  Status Visit(const NumericArray<T>& array) {
-    for (int64_t i = 0; i < array.length(); ++i) {
-      if (!array.IsNull(i)) {
-        const auto v = static_cast<int64_t>(array.Value(i));
-        if (v < min_value_ || v > max_value_) {
-          return Status::Invalid("Value at position ", i, " out of bounds: ", v,
-                                 " (should be in [", min_value_, ", ", max_value_, "])");
-        }
-      }
-    }
-    return Status::OK();
-  }
-};
-
 struct ValidateArrayDataVisitor {
   // Fallback
   Status Visit(const Array& array) { return Status::OK(); }
@@ -436,6 +476,13 @@ struct ValidateArrayDataVisitor {
 
   Status Visit(const LargeBinaryArray& array) { return ValidateBinaryArray(array); }
 
+  Status Visit(const BinaryViewArray& array) { return ValidateBinaryViews(array); }
+
+  Status Visit(const StringViewArray& array) {
+    RETURN_NOT_OK(ValidateBinaryViews(array));
+    return array.ValidateUTF8();
+  }
+
   Status Visit(const ListArray& array) { return ValidateListArray(array); }
 
   Status Visit(const LargeListArray& array) { return ValidateListArray(array); }
@@ -494,13 +541,28 @@ struct ValidateArrayDataVisitor {
 
   Status Visit(const DictionaryArray& array) {
     const Status indices_status =
-        CheckBounds(*array.indices(), 0, array.dictionary()->length() - 1);
+        CheckIndexBounds(*array.indices()->data(), array.dictionary()->length());
     if (!indices_status.ok()) {
       return Status::Invalid("Dictionary indices invalid: ", indices_status.ToString());
     }
     return ValidateArrayData(*array.dictionary());
   }
 
+  Status Visit(const RunEndEncodedArray& array) {
+    switch (array.run_ends()->type_id()) {
+      case Type::INT16:
+        RETURN_NOT_OK(ValidateRunEnds<Int16Type>(array));
+        break;
+      case Type::INT32:
+        RETURN_NOT_OK(ValidateRunEnds<Int32Type>(array));
+        break;
+      default:
+        RETURN_NOT_OK(ValidateRunEnds<Int64Type>(array));
+        break;
+    }
+    return ValidateArrayData(*array.values());
+  }
+
   Status Visit(const ExtensionArray& array) {
     return ValidateArrayData(*array.storage());
   }
@@ -514,6 +576,40 @@ struct ValidateArrayDataVisitor {
     return ValidateOffsets(array, array.value_data()->size());
   }
 
+  Status ValidateBinaryViews(const BinaryViewArray& array) {
+    const auto& buffers = array.data()->buffers;
+    const int64_t num_data_buffers = array.num_data_buffers();
+    const internal::BinaryView* views = array.raw_views();
+    for (int64_t i = 0; i < array.length(); ++i) {
+      if (array.IsNull(i)) {
+        continue;
+      }
+      const auto& view = views[i];
+      if (view.size < 0) {
+        return Status::Invalid("View at slot ", i, " has negative size ", view.size);
+      }
+      if (view.is_inline()) {
+        continue;
+      }
+      if (view.buffer_index < 0 || view.buffer_index >= num_data_buffers) {
+        return Status::Invalid("View at slot ", i, " refers to data buffer ",
+                               view.buffer_index, " out of ", num_data_buffers);
+      }
+      const auto& data_buffer = buffers[view.buffer_index + 2];
+      if (view.offset < 0 || view.offset + static_cast<int64_t>(view.size) >
+                                  data_buffer->size()) {
+        return Status::Invalid("View at slot ", i, " out of bounds of data buffer ",
+                               view.buffer_index);
+      }
+      if (std::memcmp(view.prefix, data_buffer->data() + view.offset,
+                      BinaryViewType::kPrefixSize) != 0) {
+        return Status::Invalid("View at slot ", i,
+                               " has a prefix not matching its data");
+      }
+    }
+    return Status::OK();
+  }
+
   template <typename ListArrayType>
   Status ValidateListArray(const ListArrayType& array) {
     const auto& child_array = array.values();
@@ -540,6 +636,18 @@ struct ValidateArrayDataVisitor {
           "offset ",
           prev_offset);
     }
+
+    // Branch-free check which the compiler can vectorize; the failing slot is
+    // only looked for if there is one
+    const auto* offsets = array.raw_value_offsets();
+    bool invalid = false;
+    for (int64_t i = 1; i <= array.length(); ++i) {
+      invalid |= (offsets[i] < offsets[i - 1]) | (offsets[i] > offset_limit);
+    }
+    if (ARROW_PREDICT_TRUE(!invalid)) {
+      return Status::OK();
+    }
+
     for (int64_t i = 1; i <= array.length(); ++i) {
       auto current_offset = array.value_offset(i);
       if (current_offset < prev_offset) {
@@ -555,9 +663,21 @@ struct ValidateArrayDataVisitor {
     return Status::OK();
   }
 
-  Status CheckBounds(const Array& array, int64_t min_value, int64_t max_value) {
-    BoundsCheckVisitor visitor{min_value, max_value};
-    return VisitArrayInline(array, &visitor);
+  template <typename RunEndType>
+  Status ValidateRunEnds(const RunEndEncodedArray& array) {
+    const auto& run_ends = checked_cast<const NumericArray<RunEndType>&>(*array.run_ends());
+    int64_t prev_run_end = 0;
+    for (int64_t i = 0; i < run_ends.length(); ++i) {
+      const int64_t run_end = run_ends.Value(i);
+      if (run_end <= prev_run_end) {
+        return Status::Invalid(
+            "Run end invariant failure: run ends must be positive and strictly "
+            "increasing, got ",
+            run_end, " after ", prev_run_end, " at run ", i);
+      }
+      prev_run_end = run_end;
+    }
+    return Status::OK();
   }
 };
 
@@ -26,11 +26,14 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/buffer.h"
 #include "arrow/buffer_builder.h"
 #include "arrow/device.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/checked_cast.h"
@@ -318,6 +321,41 @@ TEST_F(TestDevice, View) {
   ASSERT_RAISES(NotImplemented, MemoryManager::CopyBuffer(my_other_src_, cpu_mm_));
 }
 
+TEST_F(TestDevice, CopyArrayData) {
+  auto values = ArrayFromJSON(int32(), "[1, null, 3]");
+  auto dict = DictArrayFromJSON(dictionary(int8(), utf8()), "[0, 1, 0]", R"(["a", "b"])");
+  auto batch = RecordBatch::Make(schema({field("values", values->type()),
+                                         field("dict", dict->type())}),
+                                 3, {values, dict});
+
+  // CPU-to-device
+  ASSERT_OK_AND_ASSIGN(auto device_batch, batch->CopyTo(my_copy_mm_));
+  ASSERT_EQ(device_batch->num_rows(), 3);
+  for (const auto& column : device_batch->column_data()) {
+    ASSERT_FALSE(internal::IsCpuData(*column));
+  }
+  const auto& device_dict = *device_batch->column_data(1)->dictionary;
+  ASSERT_EQ(device_dict.buffers[2]->device(), my_copy_device_);
+  ASSERT_RAISES(NotImplemented,
+                Concatenate({device_batch->column(0), device_batch->column(0)}));
+
+  // Device-to-CPU
+  ASSERT_OK_AND_ASSIGN(auto cpu_batch, device_batch->CopyTo(cpu_mm_));
+  for (const auto& column : cpu_batch->column_data()) {
+    ASSERT_TRUE(internal::IsCpuData(*column));
+  }
+  AssertBatchesEqual(*batch, *cpu_batch);
+  ASSERT_NE(cpu_batch->column_data(0)->buffers[1]->address(),
+            values->data()->buffers[1]->address());
+
+  // CPU-on-device, no copy
+  ASSERT_OK_AND_ASSIGN(auto view, values->ViewOrCopyTo(my_view_mm_));
+  ASSERT_FALSE(internal::IsCpuData(*view->data()));
+  ASSERT_EQ(view->data()->buffers[1]->address(), values->data()->buffers[1]->address());
+
+  ASSERT_RAISES(NotImplemented, values->CopyTo(my_other_mm_));
+}
+
 TEST(TestAllocate, Basics) {
   ASSERT_OK_AND_ASSIGN(auto new_buffer, AllocateBuffer(1024));
   auto mm = new_buffer->memory_manager();
@@ -766,6 +804,26 @@ TEST(TestBufferBuilder, BoolBufferBuilderAppendCopies) {
   ASSERT_EQ(built->size(), BitUtil::BytesForBits(13 + 17));
 }
 
+TEST(TestBufferBuilder, BoolBufferBuilderAppendBitmap) {
+  TypedBufferBuilder<bool> builder;
+  // 0b1011'0110 0b0000'0001
+  const uint8_t bitmap[] = {0xb6, 0x01};
+  const std::vector<bool> expected = {true, false, true, true, false, true, true};
+
+  ASSERT_OK(builder.Append(true));
+  ASSERT_OK(builder.Reserve(7));
+  builder.UnsafeAppend(bitmap, 2, 7);
+  ASSERT_EQ(builder.length(), 8);
+  ASSERT_EQ(builder.false_count(), 2);
+
+  std::shared_ptr<Buffer> built;
+  ASSERT_OK(builder.Finish(&built));
+  ASSERT_TRUE(BitUtil::GetBit(built->data(), 0));
+  for (int i = 0; i != 7; ++i) {
+    EXPECT_EQ(BitUtil::GetBit(built->data(), i + 1), expected[i]) << "index = " << i;
+  }
+}
+
 template <typename T>
 class TypedTestBuffer : public ::testing::Test {};
 
@@ -129,6 +129,8 @@ Status MakeBuilder(MemoryPool* pool, const std::shared_ptr<DataType>& type,
       BUILDER_CASE(Binary);
       BUILDER_CASE(LargeString);
       BUILDER_CASE(LargeBinary);
+      BUILDER_CASE(BinaryView);
+      BUILDER_CASE(StringView);
       BUILDER_CASE(FixedSizeBinary);
       BUILDER_CASE(Decimal128);
 
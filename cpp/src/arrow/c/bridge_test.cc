@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cerrno>
 #include <deque>
 #include <functional>
 #include <string>
@@ -22,6 +23,7 @@
 #include <utility>
 #include <vector>
 
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include "arrow/c/bridge.h"
@@ -2676,6 +2678,149 @@ TEST_F(TestArrayRoundtrip, RecordBatch) {
   }
 }
 
+////////////////////////////////////////////////////////////////////////////
+// Array stream export and import tests
+
+class FailingRecordBatchReader : public RecordBatchReader {
+ public:
+  explicit FailingRecordBatchReader(Status error) : error_(std::move(error)) {}
+
+  static std::shared_ptr<Schema> expected_schema() { return arrow::schema({}); }
+
+  std::shared_ptr<Schema> schema() const override { return expected_schema(); }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override { return error_; }
+
+ protected:
+  Status error_;
+};
+
+class TestArrayStream : public ::testing::Test {
+ public:
+  void SetUp() override { pool_ = default_memory_pool(); }
+
+  RecordBatchVector MakeBatches(const std::shared_ptr<Schema>& schema) {
+    return {RecordBatch::Make(schema, 3, {ArrayFromJSON(int16(), "[1, 2, null]")}),
+            RecordBatch::Make(schema, 2, {ArrayFromJSON(int16(), "[4, 5]")}),
+            RecordBatch::Make(schema, 0, {ArrayFromJSON(int16(), "[]")})};
+  }
+
+  std::shared_ptr<Schema> MakeSchema() { return schema({field("ints", int16())}); }
+
+ protected:
+  MemoryPool* pool_;
+};
+
+TEST_F(TestArrayStream, Export) {
+  auto schema = MakeSchema();
+  auto batches = MakeBatches(schema);
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchReader::Make(batches, schema));
+  auto orig_bytes = pool_->bytes_allocated();
+
+  struct ArrowArrayStream c_stream;
+  ASSERT_OK(ExportRecordBatchReader(reader, &c_stream));
+  reader.reset();
+  internal::ArrayStreamExportGuard guard(&c_stream);
+  ASSERT_FALSE(ArrowArrayStreamIsReleased(&c_stream));
+  ASSERT_GT(pool_->bytes_allocated(), orig_bytes);
+
+  struct ArrowSchema c_schema;
+  ASSERT_EQ(0, c_stream.get_schema(&c_stream, &c_schema));
+  ASSERT_OK_AND_ASSIGN(auto imported_schema, ImportSchema(&c_schema));
+  AssertSchemaEqual(*schema, *imported_schema);
+
+  for (const auto& batch : batches) {
+    struct ArrowArray c_array;
+    ASSERT_EQ(0, c_stream.get_next(&c_stream, &c_array));
+    ASSERT_FALSE(ArrowArrayIsReleased(&c_array));
+    ArrayExportGuard array_guard(&c_array);
+    // Exported batches share their buffers with the original ones
+    RecordBatchExportChecker checker{};
+    checker(&c_array, *batch);
+  }
+  // End of stream is signalled by a released array, repeatedly
+  for (int i = 0; i < 2; ++i) {
+    struct ArrowArray c_array;
+    ASSERT_EQ(0, c_stream.get_next(&c_stream, &c_array));
+    ASSERT_TRUE(ArrowArrayIsReleased(&c_array));
+  }
+
+  guard.Release();
+  ASSERT_TRUE(ArrowArrayStreamIsReleased(&c_stream));
+  ASSERT_EQ(pool_->bytes_allocated(), orig_bytes);
+}
+
+TEST_F(TestArrayStream, ExportError) {
+  auto reader = std::make_shared<FailingRecordBatchReader>(
+      Status::Invalid("Expected error in ReadNext"));
+
+  struct ArrowArrayStream c_stream;
+  ASSERT_OK(ExportRecordBatchReader(reader, &c_stream));
+  internal::ArrayStreamExportGuard guard(&c_stream);
+
+  struct ArrowArray c_array;
+  ASSERT_EQ(EINVAL, c_stream.get_next(&c_stream, &c_array));
+  ASSERT_NE(c_stream.get_last_error(&c_stream), nullptr);
+  ASSERT_THAT(std::string(c_stream.get_last_error(&c_stream)),
+              ::testing::HasSubstr("Expected error in ReadNext"));
+
+  // A successful call clears the last error
+  struct ArrowSchema c_schema;
+  ASSERT_EQ(0, c_stream.get_schema(&c_stream, &c_schema));
+  ArrowSchemaRelease(&c_schema);
+  ASSERT_EQ(c_stream.get_last_error(&c_stream), nullptr);
+}
+
+TEST_F(TestArrayStream, Roundtrip) {
+  auto schema = MakeSchema();
+  auto batches = MakeBatches(schema);
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchReader::Make(batches, schema));
+  auto orig_bytes = pool_->bytes_allocated();
+
+  struct ArrowArrayStream c_stream;
+  ASSERT_OK(ExportRecordBatchReader(reader, &c_stream));
+  reader.reset();
+
+  ASSERT_OK_AND_ASSIGN(auto imported, ImportRecordBatchReader(&c_stream));
+  ASSERT_TRUE(ArrowArrayStreamIsReleased(&c_stream));
+  AssertSchemaEqual(*schema, *imported->schema());
+
+  for (const auto& batch : batches) {
+    ASSERT_OK_AND_ASSIGN(auto imported_batch, imported->Next());
+    ASSERT_NE(imported_batch, nullptr);
+    AssertBatchesEqual(*batch, *imported_batch);
+    // No data was copied on the way
+    if (batch->num_rows() == 0) continue;
+    ASSERT_EQ(batch->column_data(0)->buffers[1]->data(),
+              imported_batch->column_data(0)->buffers[1]->data());
+  }
+  ASSERT_OK_AND_ASSIGN(auto end, imported->Next());
+  ASSERT_EQ(end, nullptr);
+
+  imported.reset();
+  ASSERT_EQ(pool_->bytes_allocated(), orig_bytes);
+}
+
+TEST_F(TestArrayStream, RoundtripError) {
+  auto reader = std::make_shared<FailingRecordBatchReader>(
+      Status::OutOfMemory("Expected error in ReadNext"));
+
+  struct ArrowArrayStream c_stream;
+  ASSERT_OK(ExportRecordBatchReader(reader, &c_stream));
+  ASSERT_OK_AND_ASSIGN(auto imported, ImportRecordBatchReader(&c_stream));
+  AssertSchemaEqual(*FailingRecordBatchReader::expected_schema(), *imported->schema());
+
+  EXPECT_RAISES_WITH_MESSAGE_THAT(OutOfMemory,
+                                  ::testing::HasSubstr("Expected error in ReadNext"),
+                                  imported->Next());
+}
+
+TEST_F(TestArrayStream, ImportReleased) {
+  struct ArrowArrayStream c_stream;
+  ArrowArrayStreamMarkReleased(&c_stream);
+  ASSERT_RAISES(Invalid, ImportRecordBatchReader(&c_stream));
+}
+
 // TODO C -> C++ -> C roundtripping tests?
 
 }  // namespace arrow
@@ -31,6 +31,7 @@
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 
@@ -215,16 +216,18 @@ Status ChunkedArray::Validate() const {
   return Status::OK();
 }
 
-Status ChunkedArray::ValidateFull() const {
+Status ChunkedArray::ValidateFull() const { return ValidateFull(/*use_threads=*/false); }
+
+Status ChunkedArray::ValidateFull(bool use_threads) const {
   RETURN_NOT_OK(Validate());
-  for (size_t i = 0; i < chunks_.size(); ++i) {
-    const Array& chunk = *chunks_[i];
-    const Status st = internal::ValidateArrayData(chunk);
-    if (!st.ok()) {
-      return Status::Invalid("In chunk ", i, ": ", st.ToString());
-    }
-  }
-  return Status::OK();
+  return internal::OptionalParallelFor(
+      use_threads, num_chunks(), [this](int i) -> Status {
+        const Status st = internal::ValidateArrayData(*chunks_[i]);
+        if (!st.ok()) {
+          return Status::Invalid("In chunk ", i, ": ", st.ToString());
+        }
+        return Status::OK();
+      });
 }
 
 namespace internal {
@@ -155,6 +155,12 @@ class ARROW_EXPORT ChunkedArray {
   /// \return Status
   Status ValidateFull() const;
 
+  /// \brief Perform extensive validation checks, validating the chunks in
+  /// parallel on the CPU thread pool if use_threads is true.
+  ///
+  /// \return Status
+  Status ValidateFull(bool use_threads) const;
+
  protected:
   ArrayVector chunks_;
   int64_t length_;
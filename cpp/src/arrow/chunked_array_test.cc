@@ -19,6 +19,7 @@
 #include <memory>
 #include <vector>
 
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include "arrow/chunked_array.h"
@@ -199,6 +200,24 @@ TEST_F(TestChunkedArray, Validate) {
   ASSERT_RAISES(Invalid, one_->ValidateFull());
 }
 
+TEST_F(TestChunkedArray, ValidateFullUseThreads) {
+  auto valid = ArrayFromJSON(utf8(), R"(["ab", "c", "def"])");
+  auto invalid = StringArrayWithInvalidOffsets();
+
+  ChunkedArray chunked({valid, valid, valid});
+  ASSERT_OK(chunked.ValidateFull(/*use_threads=*/true));
+
+  ChunkedArray chunked_invalid({valid, invalid, valid, invalid});
+  ASSERT_OK(chunked_invalid.Validate());
+  Status st = chunked_invalid.ValidateFull(/*use_threads=*/false);
+  ASSERT_RAISES(Invalid, st);
+  ASSERT_THAT(st.message(), ::testing::HasSubstr("In chunk 1"));
+  // The error of the first invalid chunk is reported, whatever the order in
+  // which the chunks were validated
+  ASSERT_EQ(chunked_invalid.ValidateFull(/*use_threads=*/true).ToString(),
+            st.ToString());
+}
+
 TEST_F(TestChunkedArray, View) {
   auto in_ty = int32();
   auto out_ty = fixed_size_binary(4);
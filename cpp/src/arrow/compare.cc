@@ -30,7 +30,9 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/array/binary_view_internal.h"
 #include "arrow/array/diff.h"
+#include "arrow/array/run_end_internal.h"
 #include "arrow/buffer.h"
 #include "arrow/scalar.h"
 #include "arrow/sparse_tensor.h"
@@ -38,6 +40,7 @@
 #include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_block_counter.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
@@ -48,8 +51,11 @@
 
 namespace arrow {
 
+using internal::BitBlockCount;
 using internal::BitmapEquals;
 using internal::checked_cast;
+using internal::CountSetBits;
+using internal::OptionalBitBlockCounter;
 
 // ----------------------------------------------------------------------
 // Public method implementations
@@ -119,6 +125,73 @@ inline bool FloatingApproxEquals(const NumericArray<ArrowType>& left,
   }
 }
 
+// Whether the validity bitmaps of two equal-sized array ranges are equal
+bool ValidityRangeEquals(const Array& left, int64_t left_start, const Array& right,
+                         int64_t right_start, int64_t length) {
+  const uint8_t* left_bitmap = left.null_bitmap_data();
+  const uint8_t* right_bitmap = right.null_bitmap_data();
+  if (left_bitmap != nullptr && right_bitmap != nullptr) {
+    return BitmapEquals(left_bitmap, left.offset() + left_start, right_bitmap,
+                        right.offset() + right_start, length);
+  }
+  if (left_bitmap != nullptr) {
+    return CountSetBits(left_bitmap, left.offset() + left_start, length) == length;
+  }
+  if (right_bitmap != nullptr) {
+    return CountSetBits(right_bitmap, right.offset() + right_start, length) == length;
+  }
+  return true;
+}
+
+// Call compare_run(position, length) on the runs of non-null slots of a range
+// (given by its validity bitmap, which may be null), stopping at the first
+// unequal run.  Runs are compared a word of slots at a time, or one slot at a
+// time in words mixing null and non-null slots.
+template <typename CompareRun>
+bool CompareValidRuns(const uint8_t* validity, int64_t validity_offset, int64_t length,
+                      CompareRun&& compare_run) {
+  OptionalBitBlockCounter bit_counter(validity, validity_offset, length);
+  int64_t position = 0;
+  while (position < length) {
+    const BitBlockCount block = bit_counter.NextBlock();
+    if (block.AllSet()) {
+      if (!compare_run(position, block.length)) {
+        return false;
+      }
+    } else if (!block.NoneSet()) {
+      for (int64_t i = position; i < position + block.length; ++i) {
+        if (BitUtil::GetBit(validity, validity_offset + i) && !compare_run(i, 1)) {
+          return false;
+        }
+      }
+    }
+    position += block.length;
+  }
+  return true;
+}
+
+// Compare `length` consecutive binary values.  The values have the same lengths
+// iff their offsets are equal once rebased to the first one, in which case the
+// data of all the values can be compared at once.
+template <typename offset_type>
+bool BinaryRunEquals(const offset_type* left_offsets, const uint8_t* left_data,
+                     const offset_type* right_offsets, const uint8_t* right_data,
+                     int64_t length) {
+  const offset_type left_base = left_offsets[0];
+  const offset_type right_base = right_offsets[0];
+  bool equal_offsets = true;
+  for (int64_t i = 1; i <= length; ++i) {
+    equal_offsets &= (left_offsets[i] - left_base == right_offsets[i] - right_base);
+  }
+  if (!equal_offsets) {
+    return false;
+  }
+  const int64_t nbytes = left_offsets[length] - left_base;
+  return nbytes == 0 ||
+         std::memcmp(left_data + left_base, right_data + right_base,
+                     static_cast<size_t>(nbytes)) == 0;
+}
+
 // RangeEqualsVisitor assumes the range sizes are equal
 
 class RangeEqualsVisitor {
@@ -131,6 +204,26 @@ class RangeEqualsVisitor {
         right_start_idx_(right_start_idx),
         result_(false) {}
 
+  // Compare fixed-width values with memcmp, skipping the null slots
+  bool CompareFixedWidthRange(const Array& left, const uint8_t* left_data,
+                              const uint8_t* right_data, int64_t byte_width) const {
+    const int64_t length = left_end_idx_ - left_start_idx_;
+    if (!ValidityRangeEquals(left, left_start_idx_, right_, right_start_idx_, length)) {
+      return false;
+    }
+    if (byte_width == 0) {
+      return true;
+    }
+    left_data += left_start_idx_ * byte_width;
+    right_data += right_start_idx_ * byte_width;
+    return CompareValidRuns(left.null_bitmap_data(), left.offset() + left_start_idx_,
+                            length, [&](int64_t position, int64_t run_length) {
+                              return std::memcmp(left_data + position * byte_width,
+                                                 right_data + position * byte_width,
+                                                 run_length * byte_width) == 0;
+                            });
+  }
+
   template <typename ArrayType>
   inline Status CompareValues(const ArrayType& left) {
     const auto& right = checked_cast<const ArrayType&>(right_);
@@ -179,19 +272,69 @@ class RangeEqualsVisitor {
 
   template <typename BinaryArrayType>
   bool CompareBinaryRange(const BinaryArrayType& left) const {
-    using offset_type = typename BinaryArrayType::offset_type;
+    const auto& right = checked_cast<const BinaryArrayType&>(right_);
+    const int64_t length = left_end_idx_ - left_start_idx_;
+    if (!ValidityRangeEquals(left, left_start_idx_, right, right_start_idx_, length)) {
+      return false;
+    }
+    const auto* left_offsets = left.raw_value_offsets() + left_start_idx_;
+    const auto* right_offsets = right.raw_value_offsets() + right_start_idx_;
+    const uint8_t* left_data = left.value_data() ? left.value_data()->data() : nullptr;
+    const uint8_t* right_data =
+        right.value_data() ? right.value_data()->data() : nullptr;
+    return CompareValidRuns(left.null_bitmap_data(), left.offset() + left_start_idx_,
+                            length, [&](int64_t position, int64_t run_length) {
+                              return BinaryRunEquals(left_offsets + position, left_data,
+                                                     right_offsets + position,
+                                                     right_data, run_length);
+                            });
+  }
+
+  // Compare the ranges run by run: each segment where neither side changes
+  // value only needs a single value comparison.
+  bool CompareRunEndEncoded(const RunEndEncodedArray& left) const {
+    const auto& right = checked_cast<const RunEndEncodedArray&>(right_);
+    const int64_t range_length = left_end_idx_ - left_start_idx_;
+    if (range_length == 0) {
+      return true;
+    }
+    const auto left_data = left.data()->Slice(left_start_idx_, range_length);
+    const auto right_data = right.data()->Slice(right_start_idx_, range_length);
 
-    auto compare_values = [](const BinaryArrayType& left, const BinaryArrayType& right,
-                             offset_type left_offset, offset_type right_offset,
-                             offset_type nvalues) {
-      if (nvalues == 0) {
-        return true;
-      }
-      return std::memcmp(left.value_data()->data() + left_offset,
-                         right.value_data()->data() + right_offset,
-                         static_cast<size_t>(nvalues)) == 0;
+    struct Run {
+      int64_t physical_index;
+      int64_t end;
     };
-    return CompareWithOffsets(left, compare_values);
+    std::vector<Run> left_runs;
+    DCHECK_OK(internal::VisitRuns(
+        *left_data, [&](int64_t physical_index, int64_t run_start, int64_t run_length) {
+          left_runs.push_back({physical_index, run_start + run_length});
+          return Status::OK();
+        }));
+
+    const auto& left_values = left.values();
+    const auto& right_values = right.values();
+    size_t left_run = 0;
+    const Status st = internal::VisitRuns(
+        *right_data, [&](int64_t physical_index, int64_t run_start, int64_t run_length) {
+          const int64_t run_end = run_start + run_length;
+          while (left_run < left_runs.size()) {
+            const Run& run = left_runs[left_run];
+            if (!left_values->RangeEquals(run.physical_index, run.physical_index + 1,
+                                          physical_index, right_values)) {
+              return Status::Invalid("unequal");
+            }
+            if (run.end > run_end) {
+              break;
+            }
+            ++left_run;
+            if (run.end == run_end) {
+              break;
+            }
+          }
+          return Status::OK();
+        });
+    return st.ok();
   }
 
   template <typename ListArrayType>
@@ -315,6 +458,28 @@ class RangeEqualsVisitor {
     return Status::OK();
   }
 
+  Status Visit(const BinaryViewArray& left) {
+    using internal::ComparableBinaryView;
+    const auto& right = checked_cast<const BinaryViewArray&>(right_);
+    const auto left_buffers = left.data()->buffers.data() + 2;
+    const auto right_buffers = right.data()->buffers.data() + 2;
+    const auto left_views = left.raw_views();
+    const auto right_views = right.raw_views();
+
+    for (int64_t i = left_start_idx_, o_i = right_start_idx_; i < left_end_idx_;
+         ++i, ++o_i) {
+      const bool is_null = left.IsNull(i);
+      if (is_null != right.IsNull(o_i) ||
+          (!is_null && ComparableBinaryView(left_views[i], left_buffers) !=
+                           ComparableBinaryView(right_views[o_i], right_buffers))) {
+        result_ = false;
+        return Status::OK();
+      }
+    }
+    result_ = true;
+    return Status::OK();
+  }
+
   Status Visit(const FixedSizeBinaryArray& left) {
     const auto& right = checked_cast<const FixedSizeBinaryArray&>(right_);
 
@@ -331,21 +496,7 @@ class RangeEqualsVisitor {
       right_data = right.raw_values();
     }
 
-    for (int64_t i = left_start_idx_, o_i = right_start_idx_; i < left_end_idx_;
-         ++i, ++o_i) {
-      const bool is_null = left.IsNull(i);
-      if (is_null != right.IsNull(o_i)) {
-        result_ = false;
-        return Status::OK();
-      }
-      if (is_null) continue;
-
-      if (std::memcmp(left_data + width * i, right_data + width * o_i, width)) {
-        result_ = false;
-        return Status::OK();
-      }
-    }
-    result_ = true;
+    result_ = CompareFixedWidthRange(left, left_data, right_data, width);
     return Status::OK();
   }
 
@@ -359,12 +510,44 @@ class RangeEqualsVisitor {
     return Status::OK();
   }
 
+  Status Visit(const BooleanArray& left) {
+    const auto& right = checked_cast<const BooleanArray&>(right_);
+    const int64_t length = left_end_idx_ - left_start_idx_;
+    if (left.null_count() == 0 && right.null_count() == 0) {
+      result_ = BitmapEquals(left.values()->data(), left.offset() + left_start_idx_,
+                             right.values()->data(), right.offset() + right_start_idx_,
+                             length);
+      return Status::OK();
+    }
+    return CompareValues(left);
+  }
+
+  // Floating-point values are compared by value, other primitive values
+  // bitwise
   template <typename T>
-  typename std::enable_if<std::is_base_of<PrimitiveArray, T>::value, Status>::type Visit(
-      const T& left) {
+  typename std::enable_if<std::is_base_of<PrimitiveArray, T>::value &&
+                              is_floating_type<typename T::TypeClass>::value,
+                          Status>::type
+  Visit(const T& left) {
     return CompareValues<T>(left);
   }
 
+  template <typename T>
+  typename std::enable_if<std::is_base_of<PrimitiveArray, T>::value &&
+                              !is_floating_type<typename T::TypeClass>::value &&
+                              !std::is_base_of<BooleanArray, T>::value,
+                          Status>::type
+  Visit(const T& left) {
+    const auto& right = checked_cast<const PrimitiveArray&>(right_);
+    const int64_t byte_width = internal::GetByteWidth(*left.type());
+    const uint8_t* left_data =
+        left.values() ? left.values()->data() + left.offset() * byte_width : nullptr;
+    const uint8_t* right_data =
+        right.values() ? right.values()->data() + right.offset() * byte_width : nullptr;
+    result_ = CompareFixedWidthRange(left, left_data, right_data, byte_width);
+    return Status::OK();
+  }
+
   Status Visit(const ListArray& left) {
     result_ = CompareLists(left);
     return Status::OK();
@@ -409,6 +592,11 @@ class RangeEqualsVisitor {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedArray& left) {
+    result_ = CompareRunEndEncoded(left);
+    return Status::OK();
+  }
+
   Status Visit(const ExtensionArray& left) {
     result_ = (right_.type()->Equals(*left.type()) &&
                ArrayRangeEquals(*left.storage(),
@@ -451,19 +639,13 @@ static bool IsEqualPrimitive(const PrimitiveArray& left, const PrimitiveArray& r
     }
     return true;
   } else if (left.null_count() > 0) {
-    for (int64_t i = 0; i < left.length(); ++i) {
-      const bool left_null = left.IsNull(i);
-      const bool right_null = right.IsNull(i);
-      if (left_null != right_null) {
-        return false;
-      }
-      if (!left_null && memcmp(left_data, right_data, byte_width) != 0) {
-        return false;
-      }
-      left_data += byte_width;
-      right_data += byte_width;
-    }
-    return true;
+    // The null bitmaps are known to be equal
+    return CompareValidRuns(left.null_bitmap_data(), left.offset(), left.length(),
+                            [&](int64_t position, int64_t run_length) {
+                              return memcmp(left_data + position * byte_width,
+                                            right_data + position * byte_width,
+                                            run_length * byte_width) == 0;
+                            });
   } else {
     auto number_of_bytes_to_compare = static_cast<size_t>(byte_width * left.length());
     return memcmp(left_data, right_data, number_of_bytes_to_compare) == 0;
@@ -596,16 +778,13 @@ class ArrayEqualsVisitor : public RangeEqualsVisitor {
       // ARROW-537: Only compare data in non-null slots
       auto left_offsets = left.raw_value_offsets();
       auto right_offsets = right.raw_value_offsets();
-      for (int64_t i = 0; i < left.length(); ++i) {
-        if (left.IsNull(i)) {
-          continue;
-        }
-        if (std::memcmp(left_data + left_offsets[i], right_data + right_offsets[i],
-                        left.value_length(i))) {
-          return false;
-        }
-      }
-      return true;
+      return CompareValidRuns(left.null_bitmap_data(), left.offset(), left.length(),
+                              [&](int64_t position, int64_t run_length) {
+                                return BinaryRunEquals(left_offsets + position,
+                                                       left_data,
+                                                       right_offsets + position,
+                                                       right_data, run_length);
+                              });
     }
   }
 
@@ -633,6 +812,8 @@ class ArrayEqualsVisitor : public RangeEqualsVisitor {
     return Status::OK();
   }
 
+  Status Visit(const BinaryViewArray& left) { return RangeEqualsVisitor::Visit(left); }
+
   Status Visit(const ListArray& left) {
     result_ = CompareList(left);
     return Status::OK();
@@ -764,7 +945,7 @@ class TypeEqualsVisitor {
 
   template <typename T>
   enable_if_t<is_null_type<T>::value || is_primitive_ctype<T>::value ||
-                  is_base_binary_type<T>::value,
+                  is_base_binary_type<T>::value || is_binary_view_type<T>::value,
               Status>
   Visit(const T&) {
     result_ = true;
@@ -847,6 +1028,8 @@ class TypeEqualsVisitor {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& left) { return VisitChildren(left); }
+
   Status Visit(const ExtensionType& left) {
     result_ = left.ExtensionEquals(static_cast<const ExtensionType&>(right_));
     return Status::OK();
@@ -978,6 +1161,12 @@ class ScalarEqualsVisitor {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedScalar& left) {
+    const auto& right = checked_cast<const RunEndEncodedScalar&>(right_);
+    result_ = left.value->Equals(*right.value, options_);
+    return Status::OK();
+  }
+
   Status Visit(const ExtensionScalar& left) {
     return Status::NotImplemented("extension");
   }
@@ -1023,6 +1212,32 @@ Status PrintDiff(const Array& left, const Array& right, std::ostream* os) {
     return Status::OK();
   }
 
+  if (left.type()->id() == Type::RUN_END_ENCODED) {
+    *os << "# Run end encoded arrays differed" << std::endl;
+
+    const auto& left_ree = checked_cast<const RunEndEncodedArray&>(left);
+    const auto& right_ree = checked_cast<const RunEndEncodedArray&>(right);
+    if (left_ree.offset() != right_ree.offset()) {
+      *os << "## offsets differed: " << left_ree.offset() << " vs "
+          << right_ree.offset() << std::endl;
+    }
+
+    *os << "## run ends diff";
+    auto pos = os->tellp();
+    RETURN_NOT_OK(PrintDiff(*left_ree.run_ends(), *right_ree.run_ends(), os));
+    if (os->tellp() == pos) {
+      *os << std::endl;
+    }
+
+    *os << "## values diff";
+    pos = os->tellp();
+    RETURN_NOT_OK(PrintDiff(*left_ree.values(), *right_ree.values(), os));
+    if (os->tellp() == pos) {
+      *os << std::endl;
+    }
+    return Status::OK();
+  }
+
   ARROW_ASSIGN_OR_RAISE(auto edits, Diff(left, right, default_memory_pool()));
   ARROW_ASSIGN_OR_RAISE(auto formatter, MakeUnifiedDiffFormatter(*left.type(), os));
   return formatter(*edits, left, right);
@@ -25,6 +25,7 @@
 /// @}
 
 #include "arrow/compute/api_aggregate.h"  // IWYU pragma: export
+#include "arrow/compute/api_join.h"       // IWYU pragma: export
 #include "arrow/compute/api_scalar.h"     // IWYU pragma: export
 #include "arrow/compute/api_vector.h"     // IWYU pragma: export
 #include "arrow/compute/cast.h"           // IWYU pragma: export
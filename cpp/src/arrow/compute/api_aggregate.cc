@@ -45,5 +45,26 @@ Result<Datum> Mode(const Datum& value, ExecContext* ctx) {
   return CallFunction("mode", {value}, ctx);
 }
 
+Result<Datum> Quantile(const Datum& value, const QuantileOptions& options,
+                       ExecContext* ctx) {
+  return CallFunction("quantile", {value}, &options, ctx);
+}
+
+Result<Datum> Median(const Datum& value, ExecContext* ctx) {
+  return CallFunction("median", {value}, ctx);
+}
+
+Result<Datum> ApproximateCountDistinct(const Datum& value,
+                                      const ApproximateCountDistinctOptions& options,
+                                      ExecContext* ctx) {
+  return CallFunction("approximate_count_distinct", {value}, &options, ctx);
+}
+
+Result<Datum> ApproximateQuantile(const Datum& value,
+                                 const ApproximateQuantileOptions& options,
+                                 ExecContext* ctx) {
+  return CallFunction("approximate_quantile", {value}, &options, ctx);
+}
+
 }  // namespace compute
 }  // namespace arrow
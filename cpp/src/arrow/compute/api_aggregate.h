@@ -20,6 +20,13 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/compute/exec.h"
 #include "arrow/compute/function.h"
 #include "arrow/datum.h"
 #include "arrow/result.h"
@@ -32,8 +39,6 @@ class Array;
 
 namespace compute {
 
-class ExecContext;
-
 // ----------------------------------------------------------------------
 // Aggregate functions
 
@@ -76,6 +81,65 @@ struct ARROW_EXPORT MinMaxOptions : public FunctionOptions {
   enum Mode null_handling = SKIP;
 };
 
+/// \brief Control ApproximateCountDistinct kernel behavior
+///
+/// The relative standard error of the estimate is about
+/// 1.04 / sqrt(2^precision), using 2^precision bytes of state.
+struct ARROW_EXPORT ApproximateCountDistinctOptions : public FunctionOptions {
+  explicit ApproximateCountDistinctOptions(int precision = 14) : precision(precision) {}
+
+  static ApproximateCountDistinctOptions Defaults() {
+    return ApproximateCountDistinctOptions{};
+  }
+
+  /// Precision of the HyperLogLog sketch, between 4 and 18
+  int precision;
+};
+
+/// \brief Control ApproximateQuantile kernel behavior
+///
+/// By default, the median is estimated.
+struct ARROW_EXPORT ApproximateQuantileOptions : public FunctionOptions {
+  explicit ApproximateQuantileOptions(std::vector<double> q = {0.5},
+                                      uint32_t delta = 100, uint32_t buffer_size = 500)
+      : q(std::move(q)), delta(delta), buffer_size(buffer_size) {}
+
+  static ApproximateQuantileOptions Defaults() { return ApproximateQuantileOptions{}; }
+
+  /// The quantiles to estimate, each in [0, 1]
+  std::vector<double> q;
+  /// Compression parameter of the t-digest, larger values are more accurate
+  /// but use more memory
+  uint32_t delta;
+  /// Number of values buffered before they are merged into the t-digest
+  uint32_t buffer_size;
+};
+
+/// \brief Control Quantile kernel behavior
+///
+/// By default, the median is computed, interpolating linearly between the
+/// two nearest values.
+struct ARROW_EXPORT QuantileOptions : public FunctionOptions {
+  /// Interpolation method to use when the quantile lies between two data points
+  enum Interpolation {
+    LINEAR = 0,
+    LOWER,
+    HIGHER,
+    NEAREST,
+    MIDPOINT,
+  };
+
+  explicit QuantileOptions(std::vector<double> q = {0.5},
+                           enum Interpolation interpolation = LINEAR)
+      : q(std::move(q)), interpolation(interpolation) {}
+
+  static QuantileOptions Defaults() { return QuantileOptions{}; }
+
+  /// The quantiles to compute, each in [0, 1]
+  std::vector<double> q;
+  enum Interpolation interpolation;
+};
+
 /// @}
 
 /// \brief Count non-null (or null) values in an array.
@@ -145,5 +209,155 @@ Result<Datum> MinMax(const Datum& value,
 ARROW_EXPORT
 Result<Datum> Mode(const Datum& value, ExecContext* ctx = NULLPTR);
 
+/// \brief Calculate the quantiles of a numeric array
+///
+/// The quantiles are exact, each selected in linear time rather than by
+/// sorting the input.  Nulls and NaNs are skipped.
+///
+/// \param[in] value input datum, expecting Array or ChunkedArray
+/// \param[in] options see QuantileOptions for more information
+/// \param[in] ctx the function execution context, optional
+/// \return resulting datum as a float64 Array with one value per requested
+/// quantile, which are null if there are no valid input values
+///
+/// \since 3.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> Quantile(const Datum& value,
+                       const QuantileOptions& options = QuantileOptions::Defaults(),
+                       ExecContext* ctx = NULLPTR);
+
+/// \brief Calculate the median of a numeric array
+///
+/// The median of an even number of values is the mean of the two middle
+/// values.  Nulls and NaNs are skipped.
+///
+/// \param[in] value input datum, expecting Array or ChunkedArray
+/// \param[in] ctx the function execution context, optional
+/// \return resulting datum as a DoubleScalar, which is null if there are no
+/// valid input values
+///
+/// \since 3.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> Median(const Datum& value, ExecContext* ctx = NULLPTR);
+
+/// \brief Estimate the number of distinct non-null values of an array
+///
+/// The estimate is computed from a HyperLogLog sketch, whose memory use does
+/// not depend on the input size.  NaN is counted as a distinct value.
+///
+/// \param[in] value input datum, expecting Array or ChunkedArray
+/// \param[in] options see ApproximateCountDistinctOptions for more information
+/// \param[in] ctx the function execution context, optional
+/// \return resulting datum as an Int64Scalar
+///
+/// \since 3.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> ApproximateCountDistinct(
+    const Datum& value,
+    const ApproximateCountDistinctOptions& options =
+        ApproximateCountDistinctOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
+/// \brief Estimate quantiles of a numeric array
+///
+/// The quantiles are computed from a t-digest, whose memory use does not
+/// depend on the input size.  Nulls and NaNs are skipped.
+///
+/// \param[in] value input datum, expecting Array or ChunkedArray
+/// \param[in] options see ApproximateQuantileOptions for more information
+/// \param[in] ctx the function execution context, optional
+/// \return resulting datum as a float64 Array with one value per requested
+/// quantile, which are null if there are no valid input values
+///
+/// \since 3.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> ApproximateQuantile(
+    const Datum& value,
+    const ApproximateQuantileOptions& options = ApproximateQuantileOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
+namespace internal {
+
+/// \brief Configure a grouped aggregation
+struct ARROW_EXPORT Aggregate {
+  /// the name of the aggregation function, for example "hash_sum"
+  std::string function;
+
+  /// options for the aggregation function, or null to use the function's
+  /// default options
+  const FunctionOptions* options;
+};
+
+/// \brief Compute grouped aggregates of the given arguments
+///
+/// Rows are grouped by the values of all keys; a single pass over each batch
+/// both assigns group ids and updates the aggregation states. If the execution
+/// context allows threads and there are several batches of input, partial
+/// aggregation states are computed in parallel and merged at the end.
+///
+/// The result is a StructArray with one field per aggregate (named after the
+/// aggregate function) followed by one field per key (named "key_<i>"),
+/// containing one row per distinct group. Groups are emitted in order of first
+/// appearance when executed serially.
+///
+/// \param[in] arguments the values to aggregate, one per aggregate
+/// \param[in] keys the grouping keys
+/// \param[in] aggregates the aggregate function and options for each argument
+/// \param[in] ctx the function execution context, optional
+/// \return a StructArray of aggregates and keys
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> GroupBy(const std::vector<Datum>& arguments, const std::vector<Datum>& keys,
+                      const std::vector<Aggregate>& aggregates,
+                      ExecContext* ctx = NULLPTR);
+
+/// \brief Assign dense uint32 group ids to distinct combinations of key values
+///
+/// A single key is hashed with the memo table matching its type, while several
+/// keys are encoded into a row-wise binary representation which is hashed as
+/// a whole. Group ids are assigned in order of first appearance.
+class ARROW_EXPORT Grouper {
+ public:
+  virtual ~Grouper() = default;
+
+  /// Construct a Grouper which receives the specified key types
+  static Result<std::unique_ptr<Grouper>> Make(const std::vector<ValueDescr>& descrs,
+                                               ExecContext* ctx = NULLPTR);
+
+  /// Consume a batch of keys, producing the corresponding group ids as an
+  /// UInt32Array. All values of the batch must be arrays.
+  virtual Result<Datum> Consume(const ExecBatch& batch) = 0;
+
+  /// Look up the group ids of a batch of keys without inserting new groups,
+  /// producing an UInt32Array which is null where the key hasn't been seen.
+  /// All values of the batch must be arrays.
+  virtual Result<Datum> Find(const ExecBatch& batch) = 0;
+
+  /// Get the current number of groups
+  virtual uint32_t num_groups() const = 0;
+
+  /// Get the unique keys observed so far, with the i-th row corresponding to
+  /// group id i
+  virtual Result<ExecBatch> GetUniques() = 0;
+
+  /// Get the row indices of each group as a list<int32> array, where the i-th
+  /// list contains the indices of the rows whose group id is i
+  static Result<std::shared_ptr<ListArray>> MakeGroupings(const UInt32Array& ids,
+                                                          uint32_t num_groups,
+                                                          ExecContext* ctx = NULLPTR);
+
+  /// Split an array into groups using the output of MakeGroupings
+  static Result<std::shared_ptr<ListArray>> ApplyGroupings(const ListArray& groupings,
+                                                           const Array& array,
+                                                           ExecContext* ctx = NULLPTR);
+};
+
+}  // namespace internal
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,158 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Hash joins of tables and record batches. This API is EXPERIMENTAL.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/compute/exec.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+/// \addtogroup compute-concrete-options
+/// @{
+
+enum class JoinType {
+  /// Emit each pair of matching probe and build rows
+  INNER,
+  /// Like INNER, but also emit probe rows without a match, paired with nulls
+  LEFT_OUTER,
+  /// Emit each probe row having at least one match, once
+  LEFT_SEMI,
+  /// Emit each probe row having no match
+  LEFT_ANTI,
+};
+
+struct ARROW_EXPORT HashJoinOptions {
+  explicit HashJoinOptions(JoinType join_type = JoinType::INNER,
+                           std::vector<std::string> left_keys = {},
+                           std::vector<std::string> right_keys = {},
+                           int num_partitions = 0)
+      : join_type(join_type),
+        left_keys(std::move(left_keys)),
+        right_keys(std::move(right_keys)),
+        num_partitions(num_partitions) {}
+
+  static HashJoinOptions Defaults() { return HashJoinOptions(); }
+
+  JoinType join_type;
+  /// The key columns of the left (probe) input
+  std::vector<std::string> left_keys;
+  /// The key columns of the right (build) input, matched positionally with
+  /// left_keys
+  std::vector<std::string> right_keys;
+  /// The number of partitions to radix-partition the build side hash table
+  /// into; must be a power of two, or 0 to choose from the size of the build
+  /// side. Partitioning keeps the hash table of each partition cache-resident
+  /// when the build side is very large, at the cost of hashing every row once
+  /// more to pick its partition.
+  int num_partitions;
+};
+
+/// @}
+
+/// \brief Matches of a batch of probe rows, as indices suitable for Take
+struct ARROW_EXPORT JoinIndices {
+  /// Indices of the probe rows, relative to the probed batch
+  std::shared_ptr<UInt64Array> probe_indices;
+  /// Indices of the matching build rows, null for LEFT_OUTER probe rows
+  /// without a match. Not computed for LEFT_SEMI and LEFT_ANTI joins.
+  std::shared_ptr<UInt64Array> build_indices;
+};
+
+/// \brief A hash table over the key columns of a build table
+///
+/// Rows whose key has a null never match, as in SQL.
+///
+/// \note API not yet finalized
+class ARROW_EXPORT HashJoinTable {
+ public:
+  ~HashJoinTable();
+
+  /// \brief Build a hash table over the given key columns of a table
+  ///
+  /// \param[in] build the build side table
+  /// \param[in] keys names of the key columns of the build side
+  /// \param[in] num_partitions as in HashJoinOptions::num_partitions
+  /// \param[in] ctx the function execution context, optional
+  static Result<std::unique_ptr<HashJoinTable>> Make(std::shared_ptr<Table> build,
+                                                     const std::vector<std::string>& keys,
+                                                     int num_partitions = 0,
+                                                     ExecContext* ctx = NULLPTR);
+
+  /// \brief Find the build rows matching each row of a batch of probe keys
+  ///
+  /// The keys must have the same types as the build keys. Probing mutates
+  /// internal scratch space, so a HashJoinTable must not be probed
+  /// concurrently.
+  Result<JoinIndices> Probe(const ExecBatch& keys, JoinType join_type);
+
+  /// The build table, with each column combined into a single chunk so that
+  /// build indices can be passed directly to Take
+  const std::shared_ptr<Table>& build_table() const { return build_; }
+
+  int num_partitions() const { return static_cast<int>(partitions_.size()); }
+
+ private:
+  struct Partition;
+
+  explicit HashJoinTable(ExecContext* ctx);
+
+  ExecContext* ctx_;
+  std::shared_ptr<Table> build_;
+  std::vector<std::shared_ptr<DataType>> key_types_;
+  std::vector<std::unique_ptr<Partition>> partitions_;
+
+  // Scratch space reused across probes
+  std::vector<uint64_t> hashes_;
+  std::vector<uint32_t> group_ids_;
+  std::vector<uint8_t> matched_;
+  std::vector<int32_t> row_partitions_;
+};
+
+/// \brief Join two tables on equality of key columns
+///
+/// A hash table is built over the right table, and probed with the record
+/// batches of the left one. The output has the columns of the left table
+/// followed (except for semi and anti joins) by the columns of the right
+/// table, and rows in the order of the left table.
+///
+/// \param[in] left the left (probe) table
+/// \param[in] right the right (build) table
+/// \param[in] options the join type and keys
+/// \param[in] ctx the function execution context, optional
+/// \return the joined table
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<std::shared_ptr<Table>> HashJoin(const std::shared_ptr<Table>& left,
+                                        const std::shared_ptr<Table>& right,
+                                        const HashJoinOptions& options,
+                                        ExecContext* ctx = NULLPTR);
+
+}  // namespace compute
+}  // namespace arrow
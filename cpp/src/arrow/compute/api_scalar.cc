@@ -131,5 +131,46 @@ Result<Datum> FillNull(const Datum& values, const Datum& fill_value, ExecContext
   return CallFunction("fill_null", {values, fill_value}, ctx);
 }
 
+// ----------------------------------------------------------------------
+// Conditional functions
+
+Result<Datum> IfElse(const Datum& cond, const Datum& left, const Datum& right,
+                     ExecContext* ctx) {
+  return CallFunction("if_else", {cond, left, right}, ctx);
+}
+
+Result<Datum> CaseWhen(const Datum& cond, const std::vector<Datum>& cases,
+                       ExecContext* ctx) {
+  std::vector<Datum> args = {cond};
+  args.insert(args.end(), cases.begin(), cases.end());
+  return CallFunction("case_when", args, ctx);
+}
+
+Result<Datum> Coalesce(const std::vector<Datum>& values, ExecContext* ctx) {
+  return CallFunction("coalesce", values, ctx);
+}
+
+// ----------------------------------------------------------------------
+// Hashing functions
+
+Result<Datum> Hash64(const std::vector<Datum>& values, ExecContext* ctx) {
+  return CallFunction("hash_64", values, ctx);
+}
+
+// ----------------------------------------------------------------------
+// Temporal functions
+
+SCALAR_EAGER_UNARY(Year, "year")
+SCALAR_EAGER_UNARY(Month, "month")
+SCALAR_EAGER_UNARY(Day, "day")
+SCALAR_EAGER_UNARY(DayOfWeek, "day_of_week")
+SCALAR_EAGER_UNARY(Hour, "hour")
+SCALAR_EAGER_UNARY(Minute, "minute")
+
+Result<Datum> TruncateToUnit(const Datum& values, const TruncateOptions& options,
+                             ExecContext* ctx) {
+  return CallFunction("truncate_to_unit", {values}, &options, ctx);
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -22,6 +22,7 @@
 
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/compute/exec.h"  // IWYU pragma: keep
 #include "arrow/compute/function.h"
@@ -45,7 +46,8 @@ struct ArithmeticOptions : public FunctionOptions {
 struct ARROW_EXPORT MatchSubstringOptions : public FunctionOptions {
   explicit MatchSubstringOptions(std::string pattern) : pattern(std::move(pattern)) {}
 
-  /// The exact substring to look for inside input values.
+  /// The exact substring to look for inside input values, or for match_like
+  /// and match_regex the LIKE pattern or regular expression to match them with.
   std::string pattern;
 };
 
@@ -73,6 +75,18 @@ struct ARROW_EXPORT StrptimeOptions : public FunctionOptions {
   TimeUnit::type unit;
 };
 
+/// \brief Options for truncate_to_unit
+struct ARROW_EXPORT TruncateOptions : public FunctionOptions {
+  /// The calendar or clock unit to truncate to
+  enum Unit : int8_t { YEAR, MONTH, DAY, HOUR, MINUTE, SECOND };
+
+  explicit TruncateOptions(Unit unit = DAY) : unit(unit) {}
+
+  static TruncateOptions Defaults() { return TruncateOptions(); }
+
+  Unit unit;
+};
+
 enum CompareOperator : int8_t {
   EQUAL,
   NOT_EQUAL,
@@ -314,5 +328,132 @@ ARROW_EXPORT
 Result<Datum> FillNull(const Datum& values, const Datum& fill_value,
                        ExecContext* ctx = NULLPTR);
 
+/// \brief IfElse takes each element from `left` where `cond` is true and
+/// from `right` where it is false
+///
+/// The output is null where `cond` is null. Any argument may be a scalar.
+///
+/// \param[in] cond boolean condition
+/// \param[in] left values selected where `cond` is true
+/// \param[in] right values selected where `cond` is false, of the same type
+/// \param[in] ctx the function execution context, optional
+///
+/// \return the resulting datum
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> IfElse(const Datum& cond, const Datum& left, const Datum& right,
+                     ExecContext* ctx = NULLPTR);
+
+/// \brief CaseWhen takes each element from the value of the first case whose
+/// condition is true
+///
+/// Null conditions, and rows where `cond` itself is null, count as false.
+/// Rows where no condition is true take the else value if there is one and
+/// are null otherwise.
+///
+/// \param[in] cond struct with a boolean field per case
+/// \param[in] cases a value per case, optionally followed by an else value,
+/// all of the same type
+/// \param[in] ctx the function execution context, optional
+///
+/// \return the resulting datum
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> CaseWhen(const Datum& cond, const std::vector<Datum>& cases,
+                       ExecContext* ctx = NULLPTR);
+
+/// \brief Coalesce takes each element from the first of `values` that is
+/// non-null there
+///
+/// \param[in] values arguments of the same type
+/// \param[in] ctx the function execution context, optional
+///
+/// \return the resulting datum
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> Coalesce(const std::vector<Datum>& values, ExecContext* ctx = NULLPTR);
+
+/// \brief Hash64 computes a 64-bit hash of each row of `values`, combining the
+/// hashes of all arguments in order
+///
+/// The hashes are suitable for hash partitioning: they only depend on the
+/// types and values of the arguments, nulls hashing to a constant, and
+/// dictionary arrays hash like the equivalent dense arrays.  They are not
+/// stable across Arrow versions.
+///
+/// \param[in] values the arguments to hash, of the same length
+/// \param[in] ctx the function execution context, optional
+/// \return the resulting datum, of type uint64
+///
+/// \since 2.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> Hash64(const std::vector<Datum>& values, ExecContext* ctx = NULLPTR);
+
+/// \brief Year of each temporal value
+///
+/// Accepts timestamp, date32 and date64 values.  Timestamps with a time zone
+/// are converted to the local time of that zone first.
+///
+/// \param[in] values input to extract the component from
+/// \param[in] ctx the function execution context, optional
+/// \return the resulting datum, of type int64
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> Year(const Datum& values, ExecContext* ctx = NULLPTR);
+
+/// \brief Month (1 to 12) of each temporal value, see Year()
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> Month(const Datum& values, ExecContext* ctx = NULLPTR);
+
+/// \brief Day of the month (1 to 31) of each temporal value, see Year()
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> Day(const Datum& values, ExecContext* ctx = NULLPTR);
+
+/// \brief Day of the week of each temporal value, from 0 (Monday) to 6
+/// (Sunday), see Year()
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> DayOfWeek(const Datum& values, ExecContext* ctx = NULLPTR);
+
+/// \brief Hour (0 to 23) of each timestamp, see Year()
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> Hour(const Datum& values, ExecContext* ctx = NULLPTR);
+
+/// \brief Minute (0 to 59) of each timestamp, see Year()
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> Minute(const Datum& values, ExecContext* ctx = NULLPTR);
+
+/// \brief Truncate each temporal value to the start of its year, month, day,
+/// hour, minute or second
+///
+/// The result has the type of the input.  Timestamps with a time zone are
+/// truncated in the local time of that zone.  Truncating dates to a unit
+/// shorter than a day leaves them unchanged.
+///
+/// \param[in] values input to truncate
+/// \param[in] options the unit to truncate to
+/// \param[in] ctx the function execution context, optional
+/// \return the resulting datum
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> TruncateToUnit(const Datum& values,
+                             const TruncateOptions& options = TruncateOptions::Defaults(),
+                             ExecContext* ctx = NULLPTR);
+
 }  // namespace compute
 }  // namespace arrow
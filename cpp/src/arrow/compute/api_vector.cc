@@ -47,7 +47,35 @@ Result<std::shared_ptr<Array>> NthToIndices(const Array& values, int64_t n,
 }
 
 Result<std::shared_ptr<Array>> SortToIndices(const Array& values, ExecContext* ctx) {
-  ARROW_ASSIGN_OR_RAISE(Datum result, CallFunction("sort_indices", {Datum(values)}, ctx));
+  return SortIndices(values, SortOrder::Ascending, ctx);
+}
+
+Result<std::shared_ptr<Array>> SortIndices(const Array& values, SortOrder order,
+                                           ExecContext* ctx) {
+  ArraySortOptions options(order);
+  ARROW_ASSIGN_OR_RAISE(
+      Datum result, CallFunction("array_sort_indices", {Datum(values)}, &options, ctx));
+  return result.make_array();
+}
+
+Result<std::shared_ptr<Array>> SortIndices(const ChunkedArray& chunked_array,
+                                           SortOrder order, ExecContext* ctx) {
+  SortOptions options({SortKey("not-used", order)});
+  return SortIndices(Datum(chunked_array), options, ctx);
+}
+
+Result<std::shared_ptr<Array>> SortIndices(const Datum& datum, const SortOptions& options,
+                                           ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(Datum result,
+                        CallFunction("sort_indices", {datum}, &options, ctx));
+  return result.make_array();
+}
+
+Result<std::shared_ptr<Array>> SelectKUnstable(const Datum& datum,
+                                               const SelectKOptions& options,
+                                               ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(Datum result,
+                        CallFunction("select_k_unstable", {datum}, &options, ctx));
   return result.make_array();
 }
 
@@ -56,10 +84,66 @@ Result<std::shared_ptr<Array>> Unique(const Datum& value, ExecContext* ctx) {
   return result.make_array();
 }
 
+Result<std::shared_ptr<Array>> Unique(const Datum& value, const HashOptions& options,
+                                      ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(Datum result, CallFunction("unique", {value}, &options, ctx));
+  return result.make_array();
+}
+
 Result<Datum> DictionaryEncode(const Datum& value, ExecContext* ctx) {
   return CallFunction("dictionary_encode", {value}, ctx);
 }
 
+Result<Datum> DictionaryEncode(const Datum& value, const HashOptions& options,
+                               ExecContext* ctx) {
+  return CallFunction("dictionary_encode", {value}, &options, ctx);
+}
+
+Result<Datum> RunEndEncode(const Datum& value, const RunEndEncodeOptions& options,
+                           ExecContext* ctx) {
+  return CallFunction("run_end_encode", {value}, &options, ctx);
+}
+
+Result<Datum> RunEndDecode(const Datum& value, ExecContext* ctx) {
+  return CallFunction("run_end_decode", {value}, ctx);
+}
+
+// ----------------------------------------------------------------------
+// Window functions
+
+Result<Datum> CumulativeSum(const Datum& values, const CumulativeOptions& options,
+                            ExecContext* ctx) {
+  return CallFunction("cumulative_sum", {values}, &options, ctx);
+}
+
+Result<Datum> CumulativeMin(const Datum& values, const CumulativeOptions& options,
+                            ExecContext* ctx) {
+  return CallFunction("cumulative_min", {values}, &options, ctx);
+}
+
+Result<Datum> CumulativeMax(const Datum& values, const CumulativeOptions& options,
+                            ExecContext* ctx) {
+  return CallFunction("cumulative_max", {values}, &options, ctx);
+}
+
+Result<Datum> RollingSum(const Datum& values, const RollingOptions& options,
+                         ExecContext* ctx) {
+  return CallFunction("rolling_sum", {values}, &options, ctx);
+}
+
+Result<Datum> RollingMean(const Datum& values, const RollingOptions& options,
+                          ExecContext* ctx) {
+  return CallFunction("rolling_mean", {values}, &options, ctx);
+}
+
+Result<Datum> Lag(const Datum& values, const ShiftOptions& options, ExecContext* ctx) {
+  return CallFunction("lag", {values}, &options, ctx);
+}
+
+Result<Datum> Lead(const Datum& values, const ShiftOptions& options, ExecContext* ctx) {
+  return CallFunction("lead", {values}, &options, ctx);
+}
+
 const char kValuesFieldName[] = "values";
 const char kCountsFieldName[] = "counts";
 const int32_t kValuesFieldIndex = 0;
@@ -70,6 +154,14 @@ Result<std::shared_ptr<StructArray>> ValueCounts(const Datum& value, ExecContext
   return checked_pointer_cast<StructArray>(result.make_array());
 }
 
+Result<std::shared_ptr<StructArray>> ValueCounts(const Datum& value,
+                                                 const HashOptions& options,
+                                                 ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(Datum result,
+                        CallFunction("value_counts", {value}, &options, ctx));
+  return checked_pointer_cast<StructArray>(result.make_array());
+}
+
 // ----------------------------------------------------------------------
 // Filter- and take-related selection functions
 
@@ -18,6 +18,9 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "arrow/compute/function.h"
 #include "arrow/datum.h"
@@ -66,6 +69,144 @@ struct PartitionNthOptions : public FunctionOptions {
   int64_t pivot;
 };
 
+enum class SortOrder {
+  Ascending,
+  Descending,
+};
+
+/// \brief One sort key for SortIndices
+struct ARROW_EXPORT SortKey {
+  explicit SortKey(std::string name, SortOrder order = SortOrder::Ascending)
+      : name(std::move(name)), order(order) {}
+
+  /// The name of the sort column.
+  std::string name;
+  /// How to order by this sort key.
+  SortOrder order;
+};
+
+/// \brief Sorting options for array_sort_indices
+struct ARROW_EXPORT ArraySortOptions : public FunctionOptions {
+  explicit ArraySortOptions(SortOrder order = SortOrder::Ascending) : order(order) {}
+
+  static ArraySortOptions Defaults() { return ArraySortOptions(); }
+
+  /// Sorting order
+  SortOrder order;
+};
+
+/// \brief Sorting options for sort_indices
+struct ARROW_EXPORT SortOptions : public FunctionOptions {
+  explicit SortOptions(std::vector<SortKey> sort_keys = {})
+      : sort_keys(std::move(sort_keys)) {}
+
+  static SortOptions Defaults() { return SortOptions(); }
+
+  /// Column key(s) to order by and how to order by these sort keys.
+  ///
+  /// Keys are compared in order: ties on a key are broken by the next one.
+  /// For Array and ChunkedArray inputs the names are ignored and only the
+  /// order of the first key (if any) is used.
+  std::vector<SortKey> sort_keys;
+};
+
+/// \brief Options for select_k_unstable
+struct ARROW_EXPORT SelectKOptions : public FunctionOptions {
+  explicit SelectKOptions(int64_t k = -1, std::vector<SortKey> sort_keys = {})
+      : k(k), sort_keys(std::move(sort_keys)) {}
+
+  static SelectKOptions Defaults() { return SelectKOptions(); }
+
+  /// Select the k largest values of the given columns
+  static SelectKOptions TopKDefault(int64_t k,
+                                    std::vector<std::string> key_names = {""}) {
+    return FromKeyNames(k, std::move(key_names), SortOrder::Descending);
+  }
+
+  /// Select the k smallest values of the given columns
+  static SelectKOptions BottomKDefault(int64_t k,
+                                       std::vector<std::string> key_names = {""}) {
+    return FromKeyNames(k, std::move(key_names), SortOrder::Ascending);
+  }
+
+  /// The number of rows to select; must be nonnegative.
+  int64_t k;
+  /// Column key(s) to order by and how to order by these sort keys, as in
+  /// SortOptions::sort_keys.  At least one key is required.
+  std::vector<SortKey> sort_keys;
+
+ private:
+  static SelectKOptions FromKeyNames(int64_t k, std::vector<std::string> key_names,
+                                     SortOrder order) {
+    std::vector<SortKey> sort_keys;
+    for (auto& name : key_names) {
+      sort_keys.emplace_back(std::move(name), order);
+    }
+    return SelectKOptions(k, std::move(sort_keys));
+  }
+};
+
+/// \brief Options for run_end_encode
+struct ARROW_EXPORT RunEndEncodeOptions : public FunctionOptions {
+  explicit RunEndEncodeOptions(std::shared_ptr<DataType> run_end_type = int32())
+      : run_end_type(std::move(run_end_type)) {}
+
+  static RunEndEncodeOptions Defaults() { return RunEndEncodeOptions(); }
+
+  /// The type of the run ends: int16, int32 or int64.
+  std::shared_ptr<DataType> run_end_type;
+};
+
+/// \brief Options for unique, value_counts and dictionary_encode
+struct ARROW_EXPORT HashOptions : public FunctionOptions {
+  explicit HashOptions(bool preserve_order = true) : preserve_order(preserve_order) {}
+
+  static HashOptions Defaults() { return HashOptions(); }
+
+  /// Whether the unique values are ordered by first occurrence in the input.
+  ///
+  /// Large inputs are hashed in parallel when the ExecContext allows threads.
+  /// If false, the unique values are then ordered by hash partition, which
+  /// saves a merge pass; the order depends on the size of the CPU thread pool.
+  bool preserve_order;
+};
+
+/// \brief Options for cumulative_sum, cumulative_min and cumulative_max
+struct ARROW_EXPORT CumulativeOptions : public FunctionOptions {
+  explicit CumulativeOptions(bool skip_nulls = false) : skip_nulls(skip_nulls) {}
+
+  static CumulativeOptions Defaults() { return CumulativeOptions(); }
+
+  /// If false, the output is null from the first null input on.  If true, a
+  /// null input only gives a null output and the accumulation goes on.
+  bool skip_nulls;
+};
+
+/// \brief Options for rolling_sum and rolling_mean
+struct ARROW_EXPORT RollingOptions : public FunctionOptions {
+  explicit RollingOptions(int64_t window_size = 1, int64_t min_periods = -1)
+      : window_size(window_size), min_periods(min_periods) {}
+
+  static RollingOptions Defaults() { return RollingOptions(); }
+
+  /// The number of values in each window, which ends at the current value.
+  /// Must be positive.
+  int64_t window_size;
+  /// The minimum number of non-null values in a window for its aggregate to
+  /// be non-null, between 1 and window_size.  If negative, window_size.
+  int64_t min_periods;
+};
+
+/// \brief Options for lag and lead
+struct ARROW_EXPORT ShiftOptions : public FunctionOptions {
+  explicit ShiftOptions(int64_t periods = 1) : periods(periods) {}
+
+  static ShiftOptions Defaults() { return ShiftOptions(); }
+
+  /// The number of positions to shift the values by; must be nonnegative.
+  int64_t periods;
+};
+
 /// @}
 
 /// \brief Filter with a boolean selection filter
@@ -168,6 +309,88 @@ ARROW_EXPORT
 Result<std::shared_ptr<Array>> SortToIndices(const Array& values,
                                              ExecContext* ctx = NULLPTR);
 
+/// \brief Returns the indices that would sort an array in the
+/// specified order.
+///
+/// Perform an indirect sort of array. The output array will contain
+/// indices that would sort an array, which would be the same length
+/// as input. Nulls will be stably partitioned to the end of the output
+/// regardless of order.
+///
+/// For example given values = [null, 1, 3.3, null, 2, 5.3] and order
+/// = SortOrder::Descending, the output will be [5, 2, 4, 1, 0, 3].
+///
+/// \param[in] values array to sort
+/// \param[in] order ascending or descending
+/// \param[in] ctx the function execution context, optional
+/// \return offsets indices that would sort an array
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> SortIndices(const Array& values,
+                                           SortOrder order = SortOrder::Ascending,
+                                           ExecContext* ctx = NULLPTR);
+
+/// \brief Returns the indices that would sort a chunked array in the
+/// specified order.
+///
+/// Perform an indirect sort of chunked array. The output array will
+/// contain logical indices into the chunked array, and will be the same
+/// length as input. Nulls will be stably partitioned to the end of the
+/// output regardless of order.
+///
+/// \param[in] chunked_array chunked array to sort
+/// \param[in] order ascending or descending
+/// \param[in] ctx the function execution context, optional
+/// \return offsets indices that would sort an array
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> SortIndices(const ChunkedArray& chunked_array,
+                                           SortOrder order = SortOrder::Ascending,
+                                           ExecContext* ctx = NULLPTR);
+
+/// \brief Returns the indices that would sort an input in the
+/// specified order. Input is one of array, chunked array, record batch
+/// or table.
+///
+/// Perform an indirect sort of input. The output array will contain
+/// indices that would sort an input, which would be the same length
+/// as input. Nulls will be stably partitioned to the end of the output
+/// regardless of order.
+///
+/// For example given a table with columns a = [1, 1, 2, null] and
+/// b = ["x", "y", "x", "x"], sorting on a ascending then b descending
+/// gives [1, 0, 2, 3].
+///
+/// \param[in] datum array, chunked array, record batch or table to sort
+/// \param[in] options options
+/// \param[in] ctx the function execution context, optional
+/// \return offsets indices that would sort a table
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> SortIndices(const Datum& datum, const SortOptions& options,
+                                           ExecContext* ctx = NULLPTR);
+
+/// \brief Returns the indices of the first k rows of an input in the
+/// specified order, without sorting the whole input. Input is one of
+/// array, chunked array, record batch or table.
+///
+/// The output holds min(k, length) indices, ordered as sort_indices
+/// would order them except that ties may come in any order. Nulls are
+/// ordered after all values, so they are only selected when there are
+/// fewer than k non-null values.
+///
+/// For example given values = [null, 1, 3.3, null, 2, 5.3] and
+/// options = SelectKOptions::TopKDefault(2), the output will be [5, 2].
+///
+/// This uses a bounded heap of k rows, so it takes O(n log k) time and
+/// O(k) memory.
+///
+/// \param[in] datum array, chunked array, record batch or table to select from
+/// \param[in] options the number of rows and the sort keys
+/// \param[in] ctx the function execution context, optional
+/// \return indices of the selected rows
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> SelectKUnstable(const Datum& datum,
+                                               const SelectKOptions& options,
+                                               ExecContext* ctx = NULLPTR);
+
 /// \brief Compute unique elements from an array-like object
 ///
 /// Note if a null occurs in the input it will NOT be included in the output.
@@ -181,6 +404,19 @@ Result<std::shared_ptr<Array>> SortToIndices(const Array& values,
 ARROW_EXPORT
 Result<std::shared_ptr<Array>> Unique(const Datum& datum, ExecContext* ctx = NULLPTR);
 
+/// \brief Compute unique elements from an array-like object
+///
+/// \param[in] datum array-like input
+/// \param[in] options whether to preserve the order of first occurrence
+/// \param[in] ctx the function execution context, optional
+/// \return result as Array
+///
+/// \since 2.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> Unique(const Datum& datum, const HashOptions& options,
+                                      ExecContext* ctx = NULLPTR);
+
 // Constants for accessing the output of ValueCounts
 ARROW_EXPORT extern const char kValuesFieldName[];
 ARROW_EXPORT extern const char kCountsFieldName[];
@@ -205,6 +441,20 @@ ARROW_EXPORT
 Result<std::shared_ptr<StructArray>> ValueCounts(const Datum& value,
                                                  ExecContext* ctx = NULLPTR);
 
+/// \brief Return counts of unique elements from an array-like object.
+///
+/// \param[in] value array-like input
+/// \param[in] options whether to preserve the order of first occurrence
+/// \param[in] ctx the function execution context, optional
+/// \return counts An array of  <input type "Values", int64_t "Counts"> structs.
+///
+/// \since 2.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<std::shared_ptr<StructArray>> ValueCounts(const Datum& value,
+                                                 const HashOptions& options,
+                                                 ExecContext* ctx = NULLPTR);
+
 /// \brief Dictionary-encode values in an array-like object
 /// \param[in] data array-like input
 /// \param[in] ctx the function execution context, optional
@@ -215,6 +465,130 @@ Result<std::shared_ptr<StructArray>> ValueCounts(const Datum& value,
 ARROW_EXPORT
 Result<Datum> DictionaryEncode(const Datum& data, ExecContext* ctx = NULLPTR);
 
+/// \brief Dictionary-encode values in an array-like object
+/// \param[in] data array-like input
+/// \param[in] options whether to preserve the order of first occurrence
+/// \param[in] ctx the function execution context, optional
+/// \return result with same shape and type as input
+///
+/// \since 2.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> DictionaryEncode(const Datum& data, const HashOptions& options,
+                               ExecContext* ctx = NULLPTR);
+
+/// \brief Run-end encode values in an array-like object
+///
+/// Consecutive equal values, including consecutive nulls, are stored once.
+///
+/// \param[in] data array-like input
+/// \param[in] options configures the run end type
+/// \param[in] ctx the function execution context, optional
+/// \return result with the same shape as the input and run_end_encoded type
+ARROW_EXPORT
+Result<Datum> RunEndEncode(const Datum& data,
+                           const RunEndEncodeOptions& options = RunEndEncodeOptions(),
+                           ExecContext* ctx = NULLPTR);
+
+/// \brief Decode run-end encoded values in an array-like object
+///
+/// \param[in] data array-like input of run_end_encoded type
+/// \param[in] ctx the function execution context, optional
+/// \return result with the same shape as the input and the value type
+ARROW_EXPORT
+Result<Datum> RunEndDecode(const Datum& data, ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the running sum of an array-like object
+///
+/// Integer overflow wraps around.  ChunkedArray inputs are accumulated
+/// across chunks.
+///
+/// \param[in] values numeric array-like input
+/// \param[in] options configures the handling of nulls
+/// \param[in] ctx the function execution context, optional
+/// \return result with the same shape and type as the input
+ARROW_EXPORT
+Result<Datum> CumulativeSum(const Datum& values,
+                            const CumulativeOptions& options = CumulativeOptions(),
+                            ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the running minimum of an array-like object
+///
+/// \param[in] values numeric array-like input
+/// \param[in] options configures the handling of nulls
+/// \param[in] ctx the function execution context, optional
+/// \return result with the same shape and type as the input
+ARROW_EXPORT
+Result<Datum> CumulativeMin(const Datum& values,
+                            const CumulativeOptions& options = CumulativeOptions(),
+                            ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the running maximum of an array-like object
+///
+/// \param[in] values numeric array-like input
+/// \param[in] options configures the handling of nulls
+/// \param[in] ctx the function execution context, optional
+/// \return result with the same shape and type as the input
+ARROW_EXPORT
+Result<Datum> CumulativeMax(const Datum& values,
+                            const CumulativeOptions& options = CumulativeOptions(),
+                            ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the sum of the non-null values of each window of an
+/// array-like object
+///
+/// Each window ends at the corresponding input value and spans up to
+/// options.window_size values.  Integers are summed in 64 bits, floating
+/// point numbers in double precision.
+///
+/// \param[in] values numeric array-like input
+/// \param[in] options configures the window
+/// \param[in] ctx the function execution context, optional
+/// \return result with the same shape as the input, of type int64, uint64
+/// or double
+ARROW_EXPORT
+Result<Datum> RollingSum(const Datum& values,
+                         const RollingOptions& options = RollingOptions(),
+                         ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the mean of the non-null values of each window of an
+/// array-like object
+///
+/// \param[in] values numeric array-like input
+/// \param[in] options configures the window
+/// \param[in] ctx the function execution context, optional
+/// \return result with the same shape as the input, of type double
+ARROW_EXPORT
+Result<Datum> RollingMean(const Datum& values,
+                          const RollingOptions& options = RollingOptions(),
+                          ExecContext* ctx = NULLPTR);
+
+/// \brief Shift the values of an array-like object forward
+///
+/// Each output value is the input value options.periods positions before,
+/// or null for the first options.periods values.
+///
+/// \param[in] values fixed-width array-like input
+/// \param[in] options configures the shift
+/// \param[in] ctx the function execution context, optional
+/// \return result with the same shape and type as the input
+ARROW_EXPORT
+Result<Datum> Lag(const Datum& values, const ShiftOptions& options = ShiftOptions(),
+                  ExecContext* ctx = NULLPTR);
+
+/// \brief Shift the values of an array-like object backward
+///
+/// Each output value is the input value options.periods positions after,
+/// or null for the last options.periods values.
+///
+/// \param[in] values fixed-width array-like input
+/// \param[in] options configures the shift
+/// \param[in] ctx the function execution context, optional
+/// \return result with the same shape and type as the input
+ARROW_EXPORT
+Result<Datum> Lead(const Datum& values, const ShiftOptions& options = ShiftOptions(),
+                   ExecContext* ctx = NULLPTR);
+
 // ----------------------------------------------------------------------
 // Deprecated functions
 
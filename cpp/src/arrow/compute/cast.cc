@@ -26,6 +26,7 @@
 
 #include "arrow/compute/cast_internal.h"
 #include "arrow/compute/exec.h"
+#include "arrow/compute/exec_internal.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/codegen_internal.h"
 #include "arrow/compute/registry.h"
@@ -200,6 +201,22 @@ Result<Datum> Cast(const Datum& value, const CastOptions& options, ExecContext*
   return CallFunction("cast", {value}, &options, ctx);
 }
 
+Result<Datum> CastInPlace(const Datum& value, const CastOptions& options,
+                          ExecContext* ctx) {
+  if (options.to_type == nullptr) {
+    return Status::Invalid("Cast requires that options be passed with the to_type "
+                           "populated");
+  }
+  if (value.type()->Equals(*options.to_type)) {
+    return value;
+  }
+  ARROW_ASSIGN_OR_RAISE(
+      std::shared_ptr<CastFunction> cast_func,
+      internal::GetCastFunctionInternal(options.to_type, value.type().get()));
+  return detail::ExecuteFunction(*cast_func, {value}, &options, ctx, /*out=*/nullptr,
+                                 /*donated_arg=*/0);
+}
+
 Result<Datum> Cast(const Datum& value, std::shared_ptr<DataType> to_type,
                    const CastOptions& options, ExecContext* ctx) {
   CastOptions options_with_to_type = options;
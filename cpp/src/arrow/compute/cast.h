@@ -157,5 +157,20 @@ Result<Datum> Cast(const Datum& value, std::shared_ptr<DataType> to_type,
                    const CastOptions& options = CastOptions::Safe(),
                    ExecContext* ctx = NULLPTR);
 
+/// \brief Cast from one value to another, reusing the data buffer of the value
+/// for the result if possible
+///
+/// This is possible for numeric casts between types of the same bit width,
+/// except from floating point to integer, when the data buffer of the value is
+/// mutable. The caller must not use the values of `value` afterwards, including
+/// when an error is returned. See CallFunctionInPlace.
+/// \param[in] value datum to cast, whose data buffer is donated
+/// \param[in] options casting options. The "to_type" field must be populated
+/// \param[in] ctx the function execution context, optional
+/// \return the resulting datum
+ARROW_EXPORT
+Result<Datum> CastInPlace(const Datum& value, const CastOptions& options,
+                          ExecContext* ctx = NULLPTR);
+
 }  // namespace compute
 }  // namespace arrow
@@ -18,6 +18,7 @@
 #include "arrow/compute/exec.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -40,15 +41,19 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_block_counter.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 
+using internal::BitBlockCount;
 using internal::BitmapAnd;
+using internal::OptionalBinaryBitBlockCounter;
 using internal::checked_cast;
 using internal::CopyBitmap;
 using internal::CpuInfo;
@@ -321,29 +326,25 @@ class NullPropagator {
   }
 
   Status PropagateMultiple() {
-    // More than one array. We use BitmapAnd to intersect their bitmaps
+    // More than one array. We use BitmapAnd to intersect their bitmaps in a
+    // single pass
 
     // Do not compute the intersection null count until it's needed
     RETURN_NOT_OK(EnsureAllocated());
 
-    auto Accumulate = [&](const ArrayData& left, const ArrayData& right) {
-      // This is a precondition of reaching this code path
-      DCHECK(left.buffers[0]);
-      DCHECK(right.buffers[0]);
-      BitmapAnd(left.buffers[0]->data(), left.offset, right.buffers[0]->data(),
-                right.offset, output_->length, output_->offset,
-                output_->buffers[0]->mutable_data());
-    };
-
     DCHECK_GT(values_with_nulls_.size(), 1);
 
-    // Seed the output bitmap with the & of the first two bitmaps
-    Accumulate(*values_with_nulls_[0]->array(), *values_with_nulls_[1]->array());
-
-    // Accumulate the rest
-    for (size_t i = 2; i < values_with_nulls_.size(); ++i) {
-      Accumulate(*output_, *values_with_nulls_[i]->array());
+    std::vector<const uint8_t*> bitmaps;
+    std::vector<int64_t> offsets;
+    for (const Datum* value : values_with_nulls_) {
+      const ArrayData& arr = *value->array();
+      // This is a precondition of reaching this code path
+      DCHECK(arr.buffers[0]);
+      bitmaps.push_back(arr.buffers[0]->data());
+      offsets.push_back(arr.offset);
     }
+    BitmapAnd(bitmaps, offsets, output_->length, output_->offset,
+              output_->buffers[0]->mutable_data());
     return Status::OK();
   }
 
@@ -448,6 +449,63 @@ Status CheckAllValues(const std::vector<Datum>& values) {
   return Status::OK();
 }
 
+Status CheckCpuArgs(const std::vector<Datum>& args) {
+  for (const auto& arg : args) {
+    bool is_cpu = true;
+    if (arg.is_array()) {
+      is_cpu = ::arrow::internal::IsCpuData(*arg.array());
+    } else if (arg.is_arraylike()) {
+      for (const auto& chunk : arg.chunks()) {
+        is_cpu = is_cpu && ::arrow::internal::IsCpuData(*chunk->data());
+      }
+    }
+    if (!is_cpu) {
+      return Status::NotImplemented(
+          "Kernel does not support arguments in non-CPU memory, "
+          "copy them to the CPU first");
+    }
+  }
+  return Status::OK();
+}
+
+// Minimum number of rows for each task when executing batches on the CPU
+// thread pool, so that small inputs are not slowed down by the task overhead
+constexpr int64_t kMinParallelTaskLength = 1 << 15;
+
+// Return the number of tasks to spread the execution of the batches over,
+// which is 1 when they should be executed serially
+int NumExecTasks(ExecContext* ctx, const std::vector<ExecBatch>& batches) {
+  if (!ctx->use_threads() || batches.size() < 2) {
+    return 1;
+  }
+  int64_t total_length = 0;
+  for (const auto& batch : batches) {
+    total_length += batch.length;
+  }
+  return std::min(static_cast<int>(batches.size()),
+                  ::arrow::internal::NumParallelTasks(total_length,
+                                                      kMinParallelTaskLength));
+}
+
+// Call func(task_index, batch_index) for each batch, handing each task a
+// contiguous range of the batches. The tasks run on the CPU thread pool if
+// there is more than one, and bail out between batches once `stop_token` is
+// stopped
+template <typename TaskFunc>
+Status ExecuteBatchTasks(int num_tasks, size_t num_batches, const StopToken& stop_token,
+                         TaskFunc&& func) {
+  return ::arrow::internal::OptionalParallelFor(
+      num_tasks > 1, num_tasks, [&](int task_index) {
+        const size_t begin = num_batches * task_index / num_tasks;
+        const size_t end = num_batches * (task_index + 1) / num_tasks;
+        for (size_t i = begin; i < end; ++i) {
+          RETURN_NOT_OK(stop_token.Poll());
+          RETURN_NOT_OK(func(task_index, i));
+        }
+        return Status::OK();
+      });
+}
+
 template <typename FunctionType>
 class FunctionExecutorImpl : public FunctionExecutor {
  public:
@@ -481,6 +539,9 @@ class FunctionExecutorImpl : public FunctionExecutor {
   Status BindArgs(const std::vector<Datum>& args) {
     RETURN_NOT_OK(GetValueDescriptors(args, &input_descrs_));
     ARROW_ASSIGN_OR_RAISE(kernel_, func_->DispatchExact(input_descrs_));
+    if (!kernel_->supports_device_memory) {
+      RETURN_NOT_OK(CheckCpuArgs(args));
+    }
 
     // Initialize kernel state, since type resolution may depend on this state
     RETURN_NOT_OK(this->InitState());
@@ -492,23 +553,34 @@ class FunctionExecutorImpl : public FunctionExecutor {
     return SetupArgIteration(args);
   }
 
-  Result<std::shared_ptr<ArrayData>> PrepareOutput(int64_t length) {
+  Result<std::shared_ptr<ArrayData>> PrepareOutput(KernelContext* ctx, int64_t length) {
     auto out = std::make_shared<ArrayData>(output_descr_.type, length);
     out->buffers.resize(output_num_buffers_);
 
     if (validity_preallocated_) {
-      ARROW_ASSIGN_OR_RAISE(out->buffers[0], kernel_ctx_.AllocateBitmap(length));
+      ARROW_ASSIGN_OR_RAISE(out->buffers[0], ctx->AllocateBitmap(length));
     }
     if (data_preallocated_) {
       const auto& fw_type = checked_cast<const FixedWidthType&>(*out->type);
-      ARROW_ASSIGN_OR_RAISE(
-          out->buffers[1], AllocateDataBuffer(&kernel_ctx_, length, fw_type.bit_width()));
+      ARROW_ASSIGN_OR_RAISE(out->buffers[1],
+                            AllocateDataBuffer(ctx, length, fw_type.bit_width()));
     }
     return out;
   }
 
+  // Kernels report errors through the KernelContext, so each batch executed
+  // on the thread pool gets its own context sharing the kernel state
+  template <typename ExecFunc>
+  Status ExecuteInBatchContext(ExecFunc&& func) {
+    KernelContext batch_ctx(exec_ctx_);
+    batch_ctx.SetState(state_.get());
+    return func(&batch_ctx);
+  }
+
   ValueDescr output_descr() const override { return output_descr_; }
 
+  const Kernel* kernel() const override { return kernel_; }
+
   // Not all of these members are used for every executor type
 
   ExecContext* exec_ctx_;
@@ -540,9 +612,30 @@ class ScalarExecutor : public FunctionExecutorImpl<ScalarFunction> {
 
   Status Execute(const std::vector<Datum>& args, ExecListener* listener) override {
     RETURN_NOT_OK(PrepareExecute(args));
-    ExecBatch batch;
-    while (batch_iterator_->Next(&batch)) {
-      RETURN_NOT_OK(ExecuteBatch(batch, listener));
+    if (num_tasks_ > 1) {
+      // Execute the batches on the thread pool, then emit the results in order
+      std::vector<Datum> outputs(batches_.size());
+      RETURN_NOT_OK(ExecuteBatchTasks(
+          num_tasks_, batches_.size(), exec_ctx_->stop_token(), [&](int, size_t i) {
+            return ExecuteInBatchContext(
+                [&](KernelContext* ctx) { return ExecuteBatch(ctx, i, &outputs[i]); });
+          }));
+      if (!preallocate_contiguous_) {
+        for (auto& out : outputs) {
+          RETURN_NOT_OK(listener->OnResult(std::move(out)));
+        }
+      }
+    } else {
+      for (size_t i = 0; i < batches_.size(); ++i) {
+        RETURN_NOT_OK(exec_ctx_->stop_token().Poll());
+        Datum out;
+        RETURN_NOT_OK(ExecuteBatch(&kernel_ctx_, i, &out));
+        if (!preallocate_contiguous_) {
+          // If we are producing chunked output rather than one big array, then
+          // emit each chunk as soon as it's available
+          RETURN_NOT_OK(listener->OnResult(std::move(out)));
+        }
+      }
     }
     if (preallocate_contiguous_) {
       // If we preallocated one big chunk, since the kernel execution is
@@ -580,14 +673,15 @@ class ScalarExecutor : public FunctionExecutorImpl<ScalarFunction> {
   }
 
  protected:
-  Status ExecuteBatch(const ExecBatch& batch, ExecListener* listener) {
-    Datum out;
-    RETURN_NOT_OK(PrepareNextOutput(batch, &out));
+  Status ExecuteBatch(KernelContext* ctx, size_t batch_index, Datum* out_datum) {
+    const ExecBatch& batch = batches_[batch_index];
+    Datum& out = *out_datum;
+    RETURN_NOT_OK(PrepareNextOutput(ctx, batch, batch_positions_[batch_index], &out));
 
     if (output_descr_.shape == ValueDescr::ARRAY) {
       ArrayData* out_arr = out.mutable_array();
       if (kernel_->null_handling == NullHandling::INTERSECTION) {
-        RETURN_NOT_OK(PropagateNulls(&kernel_ctx_, batch, out_arr));
+        RETURN_NOT_OK(PropagateNulls(ctx, batch, out_arr));
       } else if (kernel_->null_handling == NullHandling::OUTPUT_NOT_NULL) {
         out_arr->null_count = 0;
       }
@@ -602,13 +696,18 @@ class ScalarExecutor : public FunctionExecutorImpl<ScalarFunction> {
       }
     }
 
-    kernel_->exec(&kernel_ctx_, batch, &out);
-    ARROW_CTX_RETURN_IF_ERROR(&kernel_ctx_);
-    if (!preallocate_contiguous_) {
-      // If we are producing chunked output rather than one big array, then
-      // emit each chunk as soon as it's available
-      RETURN_NOT_OK(listener->OnResult(std::move(out)));
-    }
+    kernel_->exec(ctx, batch, &out);
+    ARROW_CTX_RETURN_IF_ERROR(ctx);
+    return Status::OK();
+  }
+
+  Status SetPreallocatedOutput(std::shared_ptr<ArrayData> out) override {
+    given_output_ = std::move(out);
+    return Status::OK();
+  }
+
+  Status SetDonatedArgument(int index) override {
+    donated_arg_ = index;
     return Status::OK();
   }
 
@@ -616,12 +715,22 @@ class ScalarExecutor : public FunctionExecutorImpl<ScalarFunction> {
     this->Reset();
     RETURN_NOT_OK(this->BindArgs(args));
 
+    ExecBatch batch;
+    while (batch_iterator_->Next(&batch)) {
+      batch_positions_.push_back(batch_iterator_->position() - batch.length);
+      batches_.push_back(std::move(batch));
+    }
+    num_tasks_ = NumExecTasks(exec_ctx_, batches_);
+
     if (output_descr_.shape == ValueDescr::ARRAY) {
       // If the executor is configured to produce a single large Array output for
       // kernels supporting preallocation, then we do so up front and then
       // iterate over slices of that large array. Otherwise, we preallocate prior
       // to processing each batch emitted from the ExecBatchIterator
-      RETURN_NOT_OK(SetupPreallocation(batch_iterator_->length()));
+      RETURN_NOT_OK(SetupPreallocation(batch_iterator_->length(), args));
+    } else if (given_output_ != nullptr) {
+      return Status::Invalid("Cannot write the scalar result of function '",
+                             func_->name(), "' into a preallocated array");
     }
     return Status::OK();
   }
@@ -640,12 +749,11 @@ class ScalarExecutor : public FunctionExecutorImpl<ScalarFunction> {
   // outputs), then contiguous results are only possible if the input is
   // contiguous.
 
-  Status PrepareNextOutput(const ExecBatch& batch, Datum* out) {
+  Status PrepareNextOutput(KernelContext* ctx, const ExecBatch& batch,
+                           int64_t batch_start_position, Datum* out) {
     if (output_descr_.shape == ValueDescr::ARRAY) {
       if (preallocate_contiguous_) {
         // The output is already fully preallocated
-        const int64_t batch_start_position = batch_iterator_->position() - batch.length;
-
         if (batch.length < batch_iterator_->length()) {
           // If this is a partial execution, then we write into a slice of
           // preallocated_
@@ -659,7 +767,7 @@ class ScalarExecutor : public FunctionExecutorImpl<ScalarFunction> {
       } else {
         // We preallocate (maybe) only for the output of processing the current
         // batch
-        ARROW_ASSIGN_OR_RAISE(out->value, PrepareOutput(batch.length));
+        ARROW_ASSIGN_OR_RAISE(out->value, PrepareOutput(ctx, batch.length));
       }
     } else {
       // For scalar outputs, we set a null scalar of the correct type to
@@ -671,7 +779,7 @@ class ScalarExecutor : public FunctionExecutorImpl<ScalarFunction> {
     return Status::OK();
   }
 
-  Status SetupPreallocation(int64_t total_length) {
+  Status SetupPreallocation(int64_t total_length, const std::vector<Datum>& args) {
     output_num_buffers_ = static_cast<int>(output_descr_.type->layout().buffers.size());
 
     // Decide if we need to preallocate memory for this kernel
@@ -691,10 +799,111 @@ class ScalarExecutor : public FunctionExecutorImpl<ScalarFunction> {
     preallocate_contiguous_ =
         (exec_ctx_->preallocate_contiguous() && kernel_->can_write_into_slices &&
          data_preallocated_ && validity_preallocated_);
-    if (preallocate_contiguous_) {
-      DCHECK_EQ(2, output_num_buffers_);
-      ARROW_ASSIGN_OR_RAISE(preallocated_, PrepareOutput(total_length));
+
+    if (given_output_ == nullptr && donated_arg_ >= 0) {
+      ARROW_ASSIGN_OR_RAISE(given_output_, MakeInPlaceOutput(total_length, args));
+    }
+    if (given_output_ != nullptr) {
+      // Write into the given output as into a contiguous preallocation
+      RETURN_NOT_OK(CheckGivenOutput(total_length));
+      preallocate_contiguous_ = true;
+      preallocated_ = given_output_;
+      if (!BatchesAreByteAligned(given_output_->offset)) {
+        num_tasks_ = 1;
+      }
+    } else if (preallocate_contiguous_) {
+      if (num_tasks_ > 1 && !BatchesAreByteAligned(/*output_offset=*/0)) {
+        // With chunked arguments the result is chunked anyway, so give each
+        // batch its own output rather than executing serially
+        if (HaveChunkedArray(args)) {
+          preallocate_contiguous_ = false;
+        } else {
+          num_tasks_ = 1;
+        }
+      }
+      if (preallocate_contiguous_) {
+        DCHECK_EQ(2, output_num_buffers_);
+        ARROW_ASSIGN_OR_RAISE(preallocated_, PrepareOutput(&kernel_ctx_, total_length));
+      }
+    }
+    return Status::OK();
+  }
+
+  // Batches executed concurrently into slices of one output must not share
+  // bytes of its bitmaps
+  bool BatchesAreByteAligned(int64_t output_offset) const {
+    for (int64_t position : batch_positions_) {
+      if ((output_offset + position) % 8 != 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool CanWriteIntoGivenOutput() const {
+    return kernel_->can_write_into_slices && data_preallocated_ && validity_preallocated_;
+  }
+
+  // Return an output reusing the data buffer of the donated argument, or null
+  // if that is not possible
+  Result<std::shared_ptr<ArrayData>> MakeInPlaceOutput(int64_t length,
+                                                       const std::vector<Datum>& args) {
+    if (!kernel_->can_write_in_place || !CanWriteIntoGivenOutput() ||
+        donated_arg_ >= static_cast<int>(args.size()) ||
+        args[donated_arg_].kind() != Datum::ARRAY) {
+      return nullptr;
+    }
+    const ArrayData& arg = *args[donated_arg_].array();
+    if (!CanPreallocate(*arg.type) || arg.type->id() == Type::DICTIONARY ||
+        arg.length != length || arg.buffers.size() != 2 || arg.buffers[1] == nullptr ||
+        !arg.buffers[1]->is_mutable()) {
+      return nullptr;
+    }
+    const auto& out_type = checked_cast<const FixedWidthType&>(*output_descr_.type);
+    const int bit_width = checked_cast<const FixedWidthType&>(*arg.type).bit_width();
+    if (bit_width % 8 != 0 || bit_width != out_type.bit_width()) {
+      return nullptr;
     }
+    // The validity bitmap is not shared, since the kernel reads the argument
+    // bitmaps while populating it
+    ARROW_ASSIGN_OR_RAISE(auto validity,
+                          kernel_ctx_.AllocateBitmap(arg.offset + arg.length));
+    return ArrayData::Make(output_descr_.type, arg.length, {validity, arg.buffers[1]},
+                           kUnknownNullCount, arg.offset);
+  }
+
+  Status CheckGivenOutput(int64_t length) {
+    ArrayData* out = given_output_.get();
+    if (!CanWriteIntoGivenOutput()) {
+      return Status::NotImplemented("Function '", func_->name(),
+                                    "' cannot write into a preallocated output of type ",
+                                    *output_descr_.type);
+    }
+    if (!out->type->Equals(*output_descr_.type)) {
+      return Status::TypeError("Preallocated output has type ", *out->type,
+                               " but function '", func_->name(), "' returns ",
+                               *output_descr_.type);
+    }
+    if (out->length != length) {
+      return Status::Invalid("Preallocated output has length ", out->length,
+                             " but the arguments have length ", length);
+    }
+    const int bit_width = checked_cast<const FixedWidthType&>(*out->type).bit_width();
+    if (out->buffers.size() != 2 || out->buffers[1] == nullptr ||
+        !out->buffers[1]->is_mutable() ||
+        out->buffers[1]->size() * 8 < (out->offset + length) * bit_width) {
+      return Status::Invalid("Preallocated output needs a mutable data buffer of ",
+                             BitUtil::BytesForBits((out->offset + length) * bit_width),
+                             " bytes");
+    }
+    if (out->buffers[0] == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(out->buffers[0],
+                            kernel_ctx_.AllocateBitmap(out->offset + length));
+    } else if (!out->buffers[0]->is_mutable() ||
+               out->buffers[0]->size() < BitUtil::BytesForBits(out->offset + length)) {
+      return Status::Invalid("Preallocated output has a read-only or short bitmap");
+    }
+    out->null_count = kUnknownNullCount;
     return Status::OK();
   }
 
@@ -705,6 +914,16 @@ class ScalarExecutor : public FunctionExecutorImpl<ScalarFunction> {
 
   // For storing a contiguous preallocation per above. Unused otherwise
   std::shared_ptr<ArrayData> preallocated_;
+
+  // An output given by the caller or reusing a donated argument, which is
+  // used like a contiguous preallocation
+  std::shared_ptr<ArrayData> given_output_;
+  int donated_arg_ = -1;
+
+  // The batches to execute along with their start positions in the arguments
+  std::vector<ExecBatch> batches_;
+  std::vector<int64_t> batch_positions_;
+  int num_tasks_ = 1;
 };
 
 Status PackBatchNoChunks(const std::vector<Datum>& args, ExecBatch* out) {
@@ -738,8 +957,20 @@ class VectorExecutor : public FunctionExecutorImpl<VectorFunction> {
     RETURN_NOT_OK(PrepareExecute(args));
     ExecBatch batch;
     if (kernel_->can_execute_chunkwise) {
+      std::vector<ExecBatch> batches;
       while (batch_iterator_->Next(&batch)) {
-        RETURN_NOT_OK(ExecuteBatch(batch, listener));
+        batches.push_back(std::move(batch));
+      }
+      // Kernels with a finalizer accumulate state across batches, so they are
+      // executed serially
+      const int num_tasks = kernel_->finalize ? 1 : NumExecTasks(exec_ctx_, batches);
+      if (num_tasks > 1) {
+        RETURN_NOT_OK(ExecuteParallel(batches, num_tasks, listener));
+      } else {
+        for (const auto& batch : batches) {
+          RETURN_NOT_OK(exec_ctx_->stop_token().Poll());
+          RETURN_NOT_OK(ExecuteBatch(batch, listener));
+        }
       }
     } else {
       RETURN_NOT_OK(PackBatchNoChunks(args, &batch));
@@ -776,24 +1007,50 @@ class VectorExecutor : public FunctionExecutorImpl<VectorFunction> {
       return Status::OK();
     }
     Datum out;
+    RETURN_NOT_OK(ComputeBatch(&kernel_ctx_, batch, &out));
+    if (!kernel_->finalize) {
+      // If there is no result finalizer (e.g. for hash-based functions, we can
+      // emit the processed batch right away rather than waiting
+      RETURN_NOT_OK(listener->OnResult(std::move(out)));
+    } else {
+      results_.emplace_back(std::move(out));
+    }
+    return Status::OK();
+  }
+
+  Status ComputeBatch(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
     if (output_descr_.shape == ValueDescr::ARRAY) {
       // We preallocate (maybe) only for the output of processing the current
       // batch
-      ARROW_ASSIGN_OR_RAISE(out.value, PrepareOutput(batch.length));
+      ARROW_ASSIGN_OR_RAISE(out->value, PrepareOutput(ctx, batch.length));
     }
 
     if (kernel_->null_handling == NullHandling::INTERSECTION &&
         output_descr_.shape == ValueDescr::ARRAY) {
-      RETURN_NOT_OK(PropagateNulls(&kernel_ctx_, batch, out.mutable_array()));
+      RETURN_NOT_OK(PropagateNulls(ctx, batch, out->mutable_array()));
     }
-    kernel_->exec(&kernel_ctx_, batch, &out);
-    ARROW_CTX_RETURN_IF_ERROR(&kernel_ctx_);
-    if (!kernel_->finalize) {
-      // If there is no result finalizer (e.g. for hash-based functions, we can
-      // emit the processed batch right away rather than waiting
-      RETURN_NOT_OK(listener->OnResult(std::move(out)));
-    } else {
-      results_.emplace_back(std::move(out));
+    kernel_->exec(ctx, batch, out);
+    ARROW_CTX_RETURN_IF_ERROR(ctx);
+    return Status::OK();
+  }
+
+  // Execute the batches on the thread pool, then emit the results in order
+  Status ExecuteParallel(const std::vector<ExecBatch>& batches, int num_tasks,
+                         ExecListener* listener) {
+    std::vector<Datum> outputs(batches.size());
+    RETURN_NOT_OK(ExecuteBatchTasks(
+        num_tasks, batches.size(), exec_ctx_->stop_token(), [&](int, size_t i) {
+          if (batches[i].length == 0) {
+            return Status::OK();
+          }
+          return ExecuteInBatchContext([&](KernelContext* ctx) {
+            return ComputeBatch(ctx, batches[i], &outputs[i]);
+          });
+        }));
+    for (size_t i = 0; i < batches.size(); ++i) {
+      if (batches[i].length > 0) {
+        RETURN_NOT_OK(listener->OnResult(std::move(outputs[i])));
+      }
     }
     return Status::OK();
   }
@@ -846,10 +1103,19 @@ class ScalarAggExecutor : public FunctionExecutorImpl<ScalarAggregateFunction> {
   Status Execute(const std::vector<Datum>& args, ExecListener* listener) override {
     RETURN_NOT_OK(BindArgs(args));
 
+    std::vector<ExecBatch> batches;
     ExecBatch batch;
     while (batch_iterator_->Next(&batch)) {
-      // TODO: implement parallelism
       if (batch.length > 0) {
+        batches.push_back(std::move(batch));
+      }
+    }
+    const int num_tasks = NumExecTasks(exec_ctx_, batches);
+    if (num_tasks > 1) {
+      RETURN_NOT_OK(ConsumeParallel(batches, num_tasks));
+    } else {
+      for (const auto& batch : batches) {
+        RETURN_NOT_OK(exec_ctx_->stop_token().Poll());
         RETURN_NOT_OK(Consume(batch));
       }
     }
@@ -868,7 +1134,7 @@ class ScalarAggExecutor : public FunctionExecutorImpl<ScalarAggregateFunction> {
   }
 
  private:
-  Status Consume(const ExecBatch& batch) {
+  Result<std::unique_ptr<KernelState>> InitBatchState() {
     KernelInitArgs init_args{kernel_, input_descrs_, options_};
     auto batch_state = kernel_->init(&kernel_ctx_, init_args);
     ARROW_CTX_RETURN_IF_ERROR(&kernel_ctx_);
@@ -878,6 +1144,11 @@ class ScalarAggExecutor : public FunctionExecutorImpl<ScalarAggregateFunction> {
           Status::Invalid("ScalarAggregation requires non-null kernel state"));
       return kernel_ctx_.status();
     }
+    return std::move(batch_state);
+  }
+
+  Status Consume(const ExecBatch& batch) {
+    ARROW_ASSIGN_OR_RAISE(auto batch_state, InitBatchState());
 
     KernelContext batch_ctx(exec_ctx_);
     batch_ctx.SetState(batch_state.get());
@@ -889,6 +1160,29 @@ class ScalarAggExecutor : public FunctionExecutorImpl<ScalarAggregateFunction> {
     ARROW_CTX_RETURN_IF_ERROR(&kernel_ctx_);
     return Status::OK();
   }
+
+  // Consume a contiguous range of the batches into a partial state for each
+  // task on the thread pool, then merge the partial states in order
+  Status ConsumeParallel(const std::vector<ExecBatch>& batches, int num_tasks) {
+    std::vector<std::unique_ptr<KernelState>> partial_states(num_tasks);
+    for (auto& partial_state : partial_states) {
+      ARROW_ASSIGN_OR_RAISE(partial_state, InitBatchState());
+    }
+    RETURN_NOT_OK(ExecuteBatchTasks(
+        num_tasks, batches.size(), exec_ctx_->stop_token(),
+        [&](int task_index, size_t i) {
+          KernelContext batch_ctx(exec_ctx_);
+          batch_ctx.SetState(partial_states[task_index].get());
+          kernel_->consume(&batch_ctx, batches[i]);
+          ARROW_CTX_RETURN_IF_ERROR(&batch_ctx);
+          return Status::OK();
+        }));
+    for (const auto& partial_state : partial_states) {
+      kernel_->merge(&kernel_ctx_, *partial_state, state_.get());
+      ARROW_CTX_RETURN_IF_ERROR(&kernel_ctx_);
+    }
+    return Status::OK();
+  }
 };
 
 template <typename ExecutorType,
@@ -901,6 +1195,184 @@ Result<std::unique_ptr<FunctionExecutor>> MakeExecutor(ExecContext* ctx,
   return std::unique_ptr<FunctionExecutor>(new ExecutorType(ctx, typed_func, options));
 }
 
+Status FunctionExecutor::SetPreallocatedOutput(std::shared_ptr<ArrayData>) {
+  return Status::NotImplemented("Preallocated outputs are only supported for scalar "
+                                "functions");
+}
+
+Status FunctionExecutor::SetDonatedArgument(int) {
+  return Status::NotImplemented("Donated arguments are only supported for scalar "
+                                "functions");
+}
+
+namespace {
+
+int64_t BufferBytes(const ArrayData& data) {
+  int64_t total = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) {
+      total += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    total += BufferBytes(*child);
+  }
+  if (data.dictionary != nullptr) {
+    total += BufferBytes(*data.dictionary);
+  }
+  return total;
+}
+
+// Measure the inputs of an execution for the registry's statistics.  Scalar
+// arguments count as one row and no bytes.
+void MeasureInputs(const std::vector<Datum>& args, int64_t* num_rows,
+                   int64_t* num_bytes) {
+  *num_rows = args.empty() ? 0 : 1;
+  *num_bytes = 0;
+  for (const auto& arg : args) {
+    if (arg.is_array()) {
+      *num_rows = std::max(*num_rows, arg.length());
+      *num_bytes += BufferBytes(*arg.array());
+    } else if (arg.kind() == Datum::CHUNKED_ARRAY) {
+      *num_rows = std::max(*num_rows, arg.length());
+      for (const auto& chunk : arg.chunked_array()->chunks()) {
+        *num_bytes += BufferBytes(*chunk->data());
+      }
+    }
+  }
+}
+
+int64_t NowNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+}  // namespace
+
+Result<Datum> ExecuteFunction(const Function& func, const std::vector<Datum>& args,
+                              const FunctionOptions* options, ExecContext* ctx,
+                              std::shared_ptr<ArrayData> out, int donated_arg) {
+  if (ctx == nullptr) {
+    ExecContext default_ctx;
+    return ExecuteFunction(func, args, options, &default_ctx, std::move(out),
+                           donated_arg);
+  }
+  // type-check Datum arguments here. Really we'd like to avoid this as much as
+  // possible
+  RETURN_NOT_OK(CheckAllValues(args));
+  ARROW_ASSIGN_OR_RAISE(auto executor, FunctionExecutor::Make(ctx, &func, options));
+  if (out != nullptr) {
+    RETURN_NOT_OK(executor->SetPreallocatedOutput(std::move(out)));
+  }
+  if (donated_arg >= 0) {
+    RETURN_NOT_OK(executor->SetDonatedArgument(donated_arg));
+  }
+  FunctionRegistry* registry = ctx->func_registry();
+  const bool record_statistics = registry->statistics_enabled();
+  const int64_t start_nanos =
+      record_statistics && registry->ShouldTimeExecution() ? NowNanos() : -1;
+
+  auto listener = std::make_shared<DatumAccumulator>();
+  RETURN_NOT_OK(executor->Execute(args, listener.get()));
+  auto result = executor->WrapResults(args, listener->values());
+
+  if (record_statistics && executor->kernel() != nullptr) {
+    const int64_t nanos = start_nanos >= 0 ? NowNanos() - start_nanos : -1;
+    int64_t num_rows, num_bytes;
+    MeasureInputs(args, &num_rows, &num_bytes);
+    registry->RecordExecution(func, *executor->kernel(), num_rows, num_bytes, nanos);
+  }
+  return result;
+}
+
+Result<BoundScalarKernel> BoundScalarKernel::Make(const ScalarFunction& func,
+                                                  const std::vector<ValueDescr>& descrs,
+                                                  const FunctionOptions* options,
+                                                  ExecContext* ctx) {
+  BoundScalarKernel bound;
+  bound.func_ = &func;
+  ARROW_ASSIGN_OR_RAISE(bound.kernel_, func.DispatchExact(descrs));
+  const ScalarKernel* kernel = bound.kernel_;
+
+  KernelContext kernel_ctx(ctx);
+  if (kernel->init) {
+    bound.state_ = kernel->init(&kernel_ctx, {kernel, descrs, options});
+    ARROW_CTX_RETURN_IF_ERROR(&kernel_ctx);
+    kernel_ctx.SetState(bound.state_.get());
+  }
+  ARROW_ASSIGN_OR_RAISE(bound.output_descr_,
+                        kernel->signature->out_type().Resolve(&kernel_ctx, descrs));
+  // The output is a scalar only if all arguments are
+  bound.output_descr_.shape = ValueDescr::SCALAR;
+  for (const auto& descr : descrs) {
+    if (descr.shape != ValueDescr::SCALAR) {
+      bound.output_descr_.shape = ValueDescr::ARRAY;
+    }
+  }
+
+  // Preallocate as the ScalarExecutor does
+  bound.data_preallocated_ = kernel->mem_allocation == MemAllocation::PREALLOCATE &&
+                             CanPreallocate(*bound.output_descr_.type);
+  bound.validity_preallocated_ =
+      kernel->null_handling != NullHandling::COMPUTED_NO_PREALLOCATE &&
+      kernel->null_handling != NullHandling::OUTPUT_NOT_NULL;
+  return bound;
+}
+
+Result<Datum> BoundScalarKernel::Execute(const ExecBatch& batch, ExecContext* ctx) const {
+  FunctionRegistry* registry = ctx->func_registry();
+  const bool record_statistics = registry->statistics_enabled();
+  const int64_t start_nanos =
+      record_statistics && registry->ShouldTimeExecution() ? NowNanos() : -1;
+
+  KernelContext kernel_ctx(ctx);
+  kernel_ctx.SetState(state_.get());
+
+  Datum out;
+  if (output_descr_.shape == ValueDescr::ARRAY) {
+    const DataType& type = *output_descr_.type;
+    auto out_data = std::make_shared<ArrayData>(output_descr_.type, batch.length);
+    out_data->buffers.resize(type.layout().buffers.size());
+    if (validity_preallocated_) {
+      ARROW_ASSIGN_OR_RAISE(out_data->buffers[0],
+                            kernel_ctx.AllocateBitmap(batch.length));
+    }
+    if (data_preallocated_) {
+      const auto& fw_type = checked_cast<const FixedWidthType&>(type);
+      ARROW_ASSIGN_OR_RAISE(
+          out_data->buffers[1],
+          AllocateDataBuffer(&kernel_ctx, batch.length, fw_type.bit_width()));
+    }
+    if (kernel_->null_handling == NullHandling::INTERSECTION) {
+      RETURN_NOT_OK(PropagateNulls(&kernel_ctx, batch, out_data.get()));
+    } else if (kernel_->null_handling == NullHandling::OUTPUT_NOT_NULL) {
+      out_data->null_count = 0;
+    }
+    out = Datum(std::move(out_data));
+  } else {
+    out = MakeNullScalar(output_descr_.type);
+    if (kernel_->null_handling == NullHandling::INTERSECTION) {
+      out.scalar()->is_valid =
+          std::all_of(batch.values.begin(), batch.values.end(),
+                      [](const Datum& input) { return input.scalar()->is_valid; });
+    } else if (kernel_->null_handling == NullHandling::OUTPUT_NOT_NULL) {
+      out.scalar()->is_valid = true;
+    }
+  }
+
+  kernel_->exec(&kernel_ctx, batch, &out);
+  ARROW_CTX_RETURN_IF_ERROR(&kernel_ctx);
+
+  if (record_statistics) {
+    const int64_t nanos = start_nanos >= 0 ? NowNanos() - start_nanos : -1;
+    int64_t num_rows, num_bytes;
+    MeasureInputs(batch.values, &num_rows, &num_bytes);
+    registry->RecordExecution(*func_, *kernel_, num_rows, num_bytes, nanos);
+  }
+  return out;
+}
+
 Result<std::unique_ptr<FunctionExecutor>> FunctionExecutor::Make(
     ExecContext* ctx, const Function* func, const FunctionOptions* options) {
   switch (func->kind()) {
@@ -940,8 +1412,42 @@ SelectionVector::SelectionVector(const Array& arr) : SelectionVector(arr.data())
 int32_t SelectionVector::length() const { return static_cast<int32_t>(data_->length); }
 
 Result<std::shared_ptr<SelectionVector>> SelectionVector::FromMask(
-    const BooleanArray& arr) {
-  return Status::NotImplemented("FromMask");
+    const BooleanArray& arr, MemoryPool* pool) {
+  if (arr.length() > std::numeric_limits<int32_t>::max()) {
+    return Status::CapacityError("Masks longer than 2^31 - 1 are not supported");
+  }
+  const int64_t num_selected = arr.true_count();
+  ARROW_ASSIGN_OR_RAISE(auto indices_buffer,
+                        AllocateBuffer(num_selected * sizeof(int32_t), pool));
+  auto indices = reinterpret_cast<int32_t*>(indices_buffer->mutable_data());
+
+  // Null slots are not selected
+  const uint8_t* values = arr.values()->data();
+  const uint8_t* validity = arr.null_bitmap_data();
+  const int64_t offset = arr.offset();
+  OptionalBinaryBitBlockCounter bit_counter(validity, offset, values, offset,
+                                            arr.length());
+  int32_t position = 0;
+  while (position < arr.length()) {
+    BitBlockCount block = bit_counter.NextAndBlock();
+    if (block.AllSet()) {
+      for (int16_t i = 0; i < block.length; ++i) {
+        *indices++ = position + i;
+      }
+    } else if (!block.NoneSet()) {
+      for (int16_t i = 0; i < block.length; ++i) {
+        if (BitUtil::GetBit(values, offset + position + i) &&
+            (validity == nullptr || BitUtil::GetBit(validity, offset + position + i))) {
+          *indices++ = position + i;
+        }
+      }
+    }
+    position += block.length;
+  }
+
+  return std::make_shared<SelectionVector>(
+      ArrayData::Make(int32(), num_selected, {nullptr, std::move(indices_buffer)},
+                      /*null_count=*/0));
 }
 
 Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum>& args,
@@ -963,5 +1469,51 @@ Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum
   return CallFunction(func_name, args, /*options=*/nullptr, ctx);
 }
 
+namespace {
+
+Result<std::shared_ptr<const Function>> GetScalarFunction(const std::string& func_name,
+                                                          ExecContext* ctx) {
+  FunctionRegistry* registry =
+      ctx == nullptr ? GetFunctionRegistry() : ctx->func_registry();
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<const Function> func,
+                        registry->GetFunction(func_name));
+  if (func->kind() != Function::SCALAR) {
+    return Status::NotImplemented("Function '", func_name,
+                                  "' is not a scalar function and cannot write into "
+                                  "preallocated or donated memory");
+  }
+  return func;
+}
+
+}  // namespace
+
+Status CallFunctionInto(const std::string& func_name, const std::vector<Datum>& args,
+                        const FunctionOptions* options,
+                        const std::shared_ptr<ArrayData>& out, ExecContext* ctx) {
+  if (out == nullptr) {
+    return Status::Invalid("No preallocated output given");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto func, GetScalarFunction(func_name, ctx));
+  if (options == nullptr) {
+    options = func->default_options();
+  }
+  return detail::ExecuteFunction(*func, args, options, ctx, out).status();
+}
+
+Result<Datum> CallFunctionInPlace(const std::string& func_name,
+                                  const std::vector<Datum>& args, int donated_arg,
+                                  const FunctionOptions* options, ExecContext* ctx) {
+  if (donated_arg < 0 || donated_arg >= static_cast<int>(args.size())) {
+    return Status::IndexError("Donated argument index ", donated_arg,
+                              " out of range for ", args.size(), " arguments");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto func, GetScalarFunction(func_name, ctx));
+  if (options == nullptr) {
+    options = func->default_options();
+  }
+  return detail::ExecuteFunction(*func, args, options, ctx, /*out=*/nullptr,
+                                 donated_arg);
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -32,6 +32,7 @@
 #include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/cancel.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
@@ -83,12 +84,14 @@ class ARROW_EXPORT ExecContext {
   // smaller chunks.
   int64_t exec_chunksize() const { return exec_chunksize_; }
 
-  /// \brief Set whether to use multiple threads for function execution. This
-  /// is not yet used.
+  /// \brief Set whether to use multiple threads for function execution. If
+  /// enabled, the chunks of ChunkedArray arguments and the splits of
+  /// contiguous arguments made according to exec_chunksize() are executed
+  /// concurrently on the CPU thread pool when the input is large enough.
   void set_use_threads(bool use_threads = true) { use_threads_ = use_threads; }
 
   /// \brief If true, then utilize multiple threads where relevant for function
-  /// execution. This is not yet used.
+  /// execution.
   bool use_threads() const { return use_threads_; }
 
   // Set the preallocation strategy for kernel execution as it relates to
@@ -111,12 +114,20 @@ class ARROW_EXPORT ExecContext {
   /// set_preallocate_contiguous() for more information.
   bool preallocate_contiguous() const { return preallocate_contiguous_; }
 
+  /// \brief Set a token to cancel function execution.  Execution checks it
+  /// between batches, and fails with the stop error once a stop is requested.
+  void set_stop_token(StopToken stop_token) { stop_token_ = std::move(stop_token); }
+
+  /// \brief The token to cancel function execution, unstoppable by default.
+  const StopToken& stop_token() const { return stop_token_; }
+
  private:
   MemoryPool* pool_;
   FunctionRegistry* func_registry_;
   int64_t exec_chunksize_ = std::numeric_limits<int64_t>::max();
   bool preallocate_contiguous_ = true;
   bool use_threads_ = true;
+  StopToken stop_token_;
 };
 
 // TODO: Consider standardizing on uint16 selection vectors and only use them
@@ -131,7 +142,8 @@ class ARROW_EXPORT ExecContext {
 /// implementations. This is especially relevant for aggregations but also
 /// applies to scalar operations.
 ///
-/// We are not yet using this so this is mostly a placeholder for now.
+/// Execution plans (see exec_plan.h) use selection vectors to defer copying
+/// filtered columns until an operator needs them contiguous.
 ///
 /// [1]: http://cidrdb.org/cidr2005/papers/P19.pdf
 class ARROW_EXPORT SelectionVector {
@@ -140,12 +152,17 @@ class ARROW_EXPORT SelectionVector {
 
   explicit SelectionVector(const Array& arr);
 
-  /// \brief Create SelectionVector from boolean mask
-  static Result<std::shared_ptr<SelectionVector>> FromMask(const BooleanArray& arr);
+  /// \brief Create SelectionVector from boolean mask, where null slots are not
+  /// selected
+  static Result<std::shared_ptr<SelectionVector>> FromMask(
+      const BooleanArray& arr, MemoryPool* pool = default_memory_pool());
 
   const int32_t* indices() const { return indices_; }
   int32_t length() const;
 
+  /// The indices as an Int32 array, suitable for Take
+  const std::shared_ptr<ArrayData>& data() const { return data_; }
+
  private:
   std::shared_ptr<ArrayData> data_;
   const int32_t* indices_;
@@ -230,6 +247,37 @@ ARROW_EXPORT
 Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum>& args,
                            ExecContext* ctx = NULLPTR);
 
+/// \brief Variant of CallFunction for scalar functions which writes the result
+/// into a preallocated array rather than allocating it.
+///
+/// The output must have the output type of the function and the length of the
+/// arguments, and a mutable data buffer of sufficient size. A validity bitmap
+/// is allocated if the output has none. The output must not share memory with
+/// the arguments; use CallFunctionInPlace for that.
+///
+/// Returns NotImplemented for kernels which do not write into preallocated
+/// memory, e.g. those with variable-width outputs.
+ARROW_EXPORT
+Status CallFunctionInto(const std::string& func_name, const std::vector<Datum>& args,
+                        const FunctionOptions* options,
+                        const std::shared_ptr<ArrayData>& out,
+                        ExecContext* ctx = NULLPTR);
+
+/// \brief Variant of CallFunction for scalar functions which may write the
+/// result into the data buffer of a donated argument, e.g. for `x = x * 2`.
+///
+/// The buffer is reused when the argument at index donated_arg is an array
+/// with a mutable data buffer of the same bit width as the output, and the
+/// kernel supports writing in place (see ScalarKernel::can_write_in_place).
+/// Otherwise the output is allocated as with CallFunction. The caller must not
+/// use the donated argument's values afterwards, including when an error is
+/// returned.
+ARROW_EXPORT
+Result<Datum> CallFunctionInPlace(const std::string& func_name,
+                                  const std::vector<Datum>& args, int donated_arg,
+                                  const FunctionOptions* options = NULLPTR,
+                                  ExecContext* ctx = NULLPTR);
+
 /// @}
 
 }  // namespace compute
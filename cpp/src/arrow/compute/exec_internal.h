@@ -34,6 +34,7 @@ namespace arrow {
 namespace compute {
 
 class Function;
+class ScalarFunction;
 
 static constexpr int64_t kDefaultMaxChunksize = std::numeric_limits<int64_t>::max();
 
@@ -112,14 +113,66 @@ class ARROW_EXPORT FunctionExecutor {
 
   virtual ValueDescr output_descr() const = 0;
 
+  /// \brief The kernel dispatched to, once Execute was called
+  virtual const Kernel* kernel() const = 0;
+
   virtual Datum WrapResults(const std::vector<Datum>& args,
                             const std::vector<Datum>& outputs) = 0;
 
+  /// \brief Write the array output into `out` rather than allocating it. Must
+  /// be called before Execute. Only supported by scalar functions
+  virtual Status SetPreallocatedOutput(std::shared_ptr<ArrayData> out);
+
+  /// \brief Let the array output reuse the data buffer of the argument at the
+  /// given index when the kernel can write in place. Must be called before
+  /// Execute. Only supported by scalar functions
+  virtual Status SetDonatedArgument(int index);
+
   static Result<std::unique_ptr<FunctionExecutor>> Make(ExecContext* ctx,
                                                         const Function* func,
                                                         const FunctionOptions* options);
 };
 
+/// \brief Execute a function like Function::Execute, but writing into `out`
+/// if it is non-null and letting the output reuse the argument at index
+/// `donated_arg` if it is non-negative
+ARROW_EXPORT
+Result<Datum> ExecuteFunction(const Function& func, const std::vector<Datum>& args,
+                              const FunctionOptions* options, ExecContext* ctx,
+                              std::shared_ptr<ArrayData> out, int donated_arg = -1);
+
+/// \brief A scalar function kernel dispatched and initialized ahead of execution
+///
+/// Executing it skips the argument checks, kernel dispatch, kernel state
+/// initialization and batch splitting of Function::Execute, for callers which
+/// evaluate the same call on many batches.
+class ARROW_EXPORT BoundScalarKernel {
+ public:
+  /// \brief Dispatch and initialize the kernel of `func` for arguments of the
+  /// given types and shapes
+  static Result<BoundScalarKernel> Make(const ScalarFunction& func,
+                                        const std::vector<ValueDescr>& descrs,
+                                        const FunctionOptions* options,
+                                        ExecContext* ctx);
+
+  const ValueDescr& output_descr() const { return output_descr_; }
+
+  /// \brief Execute the kernel on a batch of arrays and scalars
+  ///
+  /// The values must match the descriptors the kernel was bound to, and the
+  /// arrays must all have the batch's length. May be called concurrently.
+  Result<Datum> Execute(const ExecBatch& batch, ExecContext* ctx) const;
+
+ private:
+  const ScalarFunction* func_ = NULLPTR;
+  const ScalarKernel* kernel_ = NULLPTR;
+  // Shared by the copies, as the kernel state is not copyable
+  std::shared_ptr<KernelState> state_;
+  ValueDescr output_descr_;
+  bool data_preallocated_ = false;
+  bool validity_preallocated_ = false;
+};
+
 /// \brief Populate validity bitmap with the intersection of the nullity of the
 /// arguments. If a preallocated bitmap is not provided, then one will be
 /// allocated if needed (in some cases a bitmap can be zero-copied from the
@@ -0,0 +1,1422 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/exec_plan.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <queue>
+#include <sstream>
+#include <utility>
+
+#include "arrow/array/array_nested.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec_internal.h"
+#include "arrow/compute/function.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/scalar_hash_internal.h"
+#include "arrow/compute/registry.h"
+#include "arrow/io/file.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::CpuInfo;
+using internal::TaskGroup;
+
+namespace compute {
+
+namespace {
+
+// Copy the selected rows of the i-th value of a batch, if it has a selection
+// vector. This is deferred until an operator needs the value contiguous, so
+// that columns which are never used downstream of a filter are never copied.
+Result<Datum> MaterializeValue(const ExecBatch& batch, int i, ExecContext* ctx) {
+  const Datum& value = batch[i];
+  if (batch.selection_vector == nullptr || value.is_scalar()) {
+    return value;
+  }
+  return Take(value, Datum(batch.selection_vector->data()),
+              TakeOptions::NoBoundsCheck(), ctx);
+}
+
+// Materialize the values of a batch at the given indices into a record batch
+Result<std::shared_ptr<RecordBatch>> MaterializeBatch(const ExecBatch& batch,
+                                                      const std::vector<int>& indices,
+                                                      std::shared_ptr<Schema> schema,
+                                                      ExecContext* ctx) {
+  std::vector<std::shared_ptr<Array>> columns(indices.size());
+  for (size_t i = 0; i < indices.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(Datum value, MaterializeValue(batch, indices[i], ctx));
+    if (value.is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(columns[i], MakeArrayFromScalar(*value.scalar(),
+                                                            batch.length,
+                                                            ctx->memory_pool()));
+    } else {
+      columns[i] = value.make_array();
+    }
+  }
+  return RecordBatch::Make(std::move(schema), batch.length, std::move(columns));
+}
+
+ExecBatch ToExecBatch(const RecordBatch& batch) {
+  std::vector<Datum> values(batch.num_columns());
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    values[i] = batch.column_data(i);
+  }
+  return ExecBatch(std::move(values), batch.num_rows());
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// ExecExpression
+
+ExecExpression ExecExpression::Field(std::string name) {
+  ExecExpression expr(FIELD);
+  expr.name_ = std::move(name);
+  return expr;
+}
+
+ExecExpression ExecExpression::Literal(Datum value) {
+  ExecExpression expr(LITERAL);
+  expr.literal_ = std::move(value);
+  return expr;
+}
+
+ExecExpression ExecExpression::Call(std::string function,
+                                    std::vector<ExecExpression> arguments,
+                                    std::shared_ptr<FunctionOptions> options) {
+  ExecExpression expr(CALL);
+  expr.function_name_ = std::move(function);
+  expr.arguments_ = std::move(arguments);
+  expr.options_ = std::move(options);
+  return expr;
+}
+
+Status ExecExpression::Bind(const Schema& schema, ExecContext* ctx) {
+  switch (kind_) {
+    case FIELD: {
+      index_ = schema.GetFieldIndex(name_);
+      if (index_ == -1) {
+        return Status::Invalid("No single field named '", name_, "' in schema ",
+                               schema.ToString());
+      }
+      descr_ = ValueDescr::Array(schema.field(index_)->type());
+      break;
+    }
+    case LITERAL: {
+      if (!literal_.is_scalar()) {
+        return Status::Invalid("Literal expressions must be scalars");
+      }
+      descr_ = literal_.descr();
+      break;
+    }
+    case CALL: {
+      std::vector<ValueDescr> descrs;
+      for (auto& argument : arguments_) {
+        RETURN_NOT_OK(argument.Bind(schema, ctx));
+        descrs.push_back(argument.descr());
+      }
+
+      ARROW_ASSIGN_OR_RAISE(function_, ctx->func_registry()->GetFunction(function_name_));
+      if (function_->kind() != Function::SCALAR) {
+        return Status::Invalid("Function '", function_name_,
+                               "' is not a scalar function, so it can't be evaluated "
+                               "batch by batch");
+      }
+      const auto& scalar_function = checked_cast<const ScalarFunction&>(*function_);
+      const FunctionOptions* options =
+          options_ ? options_.get() : function_->default_options();
+      ARROW_ASSIGN_OR_RAISE(
+          auto kernel,
+          detail::BoundScalarKernel::Make(scalar_function, descrs, options, ctx));
+      descr_ = kernel.output_descr();
+      kernel_ = std::make_shared<detail::BoundScalarKernel>(std::move(kernel));
+      break;
+    }
+  }
+  bound_ = true;
+  return Status::OK();
+}
+
+Result<Datum> ExecExpression::Evaluate(const ExecBatch& batch, ExecContext* ctx) const {
+  if (!bound_) {
+    return Status::Invalid("Cannot evaluate unbound expression ", ToString());
+  }
+  switch (kind_) {
+    case FIELD:
+      return MaterializeValue(batch, index_, ctx);
+    case LITERAL:
+      return literal_;
+    case CALL:
+      break;
+  }
+  std::vector<Datum> args(arguments_.size());
+  for (size_t i = 0; i < arguments_.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(args[i], arguments_[i].Evaluate(batch, ctx));
+  }
+  const int64_t length = descr_.shape == ValueDescr::SCALAR ? 1 : batch.length;
+  return kernel_->Execute(ExecBatch(std::move(args), length), ctx);
+}
+
+std::string ExecExpression::ToString() const {
+  switch (kind_) {
+    case FIELD:
+      return name_;
+    case LITERAL:
+      return literal_.scalar()->ToString();
+    case CALL:
+      break;
+  }
+  std::stringstream ss;
+  ss << function_name_ << "(";
+  for (size_t i = 0; i < arguments_.size(); ++i) {
+    if (i > 0) {
+      ss << ", ";
+    }
+    ss << arguments_[i].ToString();
+  }
+  ss << ")";
+  return ss.str();
+}
+
+// ----------------------------------------------------------------------
+// ExecNode and ExecPlan
+
+ExecNode::ExecNode(ExecPlan* plan, ExecNode* input, std::shared_ptr<Schema> output_schema,
+                   bool is_sink)
+    : plan_(plan),
+      input_(input),
+      output_schema_(std::move(output_schema)),
+      is_sink_(is_sink) {}
+
+Status ExecNode::StartProducing(TaskGroup*) {
+  return Status::NotImplemented(kind_name(), " nodes are not source nodes");
+}
+
+ExecPlan::ExecPlan(ExecContext* ctx) : ctx_(ctx ? ctx : &default_ctx_) {}
+
+ExecPlan::~ExecPlan() = default;
+
+Result<ExecNode*> ExecPlan::AddNode(std::unique_ptr<ExecNode> node) {
+  if (node->plan() != this) {
+    return Status::Invalid("Node belongs to another plan");
+  }
+  if (started_) {
+    return Status::Invalid("Cannot add nodes to a plan which was run");
+  }
+  ExecNode* input = node->input();
+  if (input != nullptr) {
+    if (input->is_sink()) {
+      return Status::Invalid(input->kind_name(), " nodes have no output");
+    }
+    if (input->output_ != nullptr) {
+      return Status::Invalid(input->kind_name(), " node already has an output");
+    }
+    input->output_ = node.get();
+  }
+  nodes_.push_back(std::move(node));
+  return nodes_.back().get();
+}
+
+Status ExecPlan::Validate() const {
+  if (nodes_.empty()) {
+    return Status::Invalid("Plan has no nodes");
+  }
+  for (const auto& node : nodes_) {
+    if (node->output() == nullptr && !node->is_sink()) {
+      return Status::Invalid(node->kind_name(), " node has no output");
+    }
+  }
+  return Status::OK();
+}
+
+Status ExecPlan::Run() {
+  if (started_) {
+    return Status::Invalid("Plan was already run");
+  }
+  RETURN_NOT_OK(Validate());
+  started_ = true;
+
+  std::shared_ptr<TaskGroup> task_group =
+      ctx_->use_threads() ? TaskGroup::MakeThreaded(::arrow::internal::GetCpuThreadPool())
+                          : TaskGroup::MakeSerial();
+  for (const auto& node : nodes_) {
+    if (node->input() == nullptr) {
+      RETURN_NOT_OK(node->StartProducing(task_group.get()));
+    }
+  }
+  RETURN_NOT_OK(task_group->Finish());
+
+  // All batches have gone through; signal the end of input down each chain
+  for (const auto& node : nodes_) {
+    if (node->input() == nullptr) {
+      RETURN_NOT_OK(node->output()->InputFinished());
+    }
+  }
+  return Status::OK();
+}
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Source
+
+class TableSourceNode : public ExecNode {
+ public:
+  TableSourceNode(ExecPlan* plan, std::shared_ptr<Table> table, int64_t morsel_size)
+      : ExecNode(plan, nullptr, table->schema()),
+        table_(std::move(table)),
+        morsel_size_(morsel_size) {}
+
+  const char* kind_name() const override { return "TableSource"; }
+
+  Status StartProducing(TaskGroup* task_group) override {
+    // Slicing is zero-copy and cheap, so it's done up front; each morsel is
+    // then pushed down the plan by its own task
+    TableBatchReader reader(*table_);
+    reader.set_chunksize(morsel_size_);
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader.ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      if (batch->num_rows() == 0) {
+        continue;
+      }
+      task_group->Append(
+          [this, batch] { return output_->InputReceived(ToExecBatch(*batch)); });
+    }
+    return Status::OK();
+  }
+
+  Status InputReceived(ExecBatch) override {
+    return Status::Invalid("TableSource nodes have no input");
+  }
+
+  Status InputFinished() override {
+    return Status::Invalid("TableSource nodes have no input");
+  }
+
+ private:
+  std::shared_ptr<Table> table_;
+  int64_t morsel_size_;
+};
+
+// ----------------------------------------------------------------------
+// Filter
+
+class FilterNode : public ExecNode {
+ public:
+  FilterNode(ExecNode* input, ExecExpression predicate)
+      : ExecNode(input->plan(), input, input->output_schema()),
+        predicate_(std::move(predicate)) {}
+
+  const char* kind_name() const override { return "Filter"; }
+
+  Status InputReceived(ExecBatch batch) override {
+    ExecContext* ctx = plan_->exec_context();
+    ARROW_ASSIGN_OR_RAISE(Datum mask, predicate_.Evaluate(batch, ctx));
+
+    if (mask.is_scalar()) {
+      const auto& scalar = checked_cast<const BooleanScalar&>(*mask.scalar());
+      if (scalar.is_valid && scalar.value) {
+        return output_->InputReceived(std::move(batch));
+      }
+      return Status::OK();
+    }
+
+    BooleanArray mask_array(mask.array());
+    const int64_t length = mask_array.true_count();
+    if (length == 0) {
+      return Status::OK();
+    }
+    if (length == batch.length) {
+      return output_->InputReceived(std::move(batch));
+    }
+
+    if (batch.length > std::numeric_limits<int32_t>::max()) {
+      // Too long for a selection vector: filter eagerly
+      for (auto& value : batch.values) {
+        if (value.is_array()) {
+          ARROW_ASSIGN_OR_RAISE(value,
+                                Filter(value, mask, FilterOptions::Defaults(), ctx));
+        }
+      }
+      batch.length = length;
+      return output_->InputReceived(std::move(batch));
+    }
+
+    // Rather than copying each column, select rows and let downstream
+    // operators copy the columns they actually use
+    ARROW_ASSIGN_OR_RAISE(auto selection,
+                          SelectionVector::FromMask(mask_array, ctx->memory_pool()));
+    if (batch.selection_vector != nullptr) {
+      // Compose with the selection of a previous filter
+      ARROW_ASSIGN_OR_RAISE(Datum composed,
+                            Take(Datum(batch.selection_vector->data()),
+                                 Datum(selection->data()), TakeOptions::NoBoundsCheck(),
+                                 ctx));
+      selection = std::make_shared<SelectionVector>(composed.array());
+    }
+    batch.selection_vector = std::move(selection);
+    batch.length = length;
+    return output_->InputReceived(std::move(batch));
+  }
+
+  Status InputFinished() override { return output_->InputFinished(); }
+
+ private:
+  ExecExpression predicate_;
+};
+
+// ----------------------------------------------------------------------
+// Project
+
+class ProjectNode : public ExecNode {
+ public:
+  ProjectNode(ExecNode* input, std::shared_ptr<Schema> output_schema,
+              std::vector<ExecExpression> exprs)
+      : ExecNode(input->plan(), input, std::move(output_schema)),
+        exprs_(std::move(exprs)) {}
+
+  const char* kind_name() const override { return "Project"; }
+
+  Status InputReceived(ExecBatch batch) override {
+    std::vector<Datum> values(exprs_.size());
+    for (size_t i = 0; i < exprs_.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(values[i],
+                            exprs_[i].Evaluate(batch, plan_->exec_context()));
+    }
+    return output_->InputReceived(ExecBatch(std::move(values), batch.length));
+  }
+
+  Status InputFinished() override { return output_->InputFinished(); }
+
+ private:
+  std::vector<ExecExpression> exprs_;
+};
+
+// ----------------------------------------------------------------------
+// Scalar aggregation
+
+class ScalarAggregateNode : public ExecNode {
+ public:
+  ScalarAggregateNode(ExecNode* input, std::shared_ptr<Schema> output_schema,
+                      std::vector<const ScalarAggregateKernel*> kernels,
+                      std::vector<std::vector<ValueDescr>> kernel_descrs,
+                      std::vector<const FunctionOptions*> options,
+                      std::vector<int> argument_indices)
+      : ExecNode(input->plan(), input, std::move(output_schema)),
+        kernels_(std::move(kernels)),
+        kernel_descrs_(std::move(kernel_descrs)),
+        options_(std::move(options)),
+        argument_indices_(std::move(argument_indices)) {}
+
+  const char* kind_name() const override { return "ScalarAggregate"; }
+
+  Status InputReceived(ExecBatch batch) override {
+    Partial* partial;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (idle_partials_.empty()) {
+        ARROW_ASSIGN_OR_RAISE(partial, MakePartial());
+      } else {
+        partial = idle_partials_.back();
+        idle_partials_.pop_back();
+      }
+    }
+
+    Status st = Consume(batch, partial);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    idle_partials_.push_back(partial);
+    return st;
+  }
+
+  Status InputFinished() override {
+    // No task is running anymore, so the partials need no locking
+    if (partials_.empty()) {
+      RETURN_NOT_OK(MakePartial().status());
+    }
+    Partial* result = partials_[0].get();
+    for (size_t i = 1; i < partials_.size(); ++i) {
+      for (size_t j = 0; j < kernels_.size(); ++j) {
+        KernelContext* kernel_ctx = &result->kernel_ctxs[j];
+        kernels_[j]->merge(kernel_ctx, *partials_[i]->states[j], result->states[j].get());
+        ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+      }
+    }
+
+    std::vector<Datum> values(kernels_.size());
+    for (size_t j = 0; j < kernels_.size(); ++j) {
+      KernelContext* kernel_ctx = &result->kernel_ctxs[j];
+      kernels_[j]->finalize(kernel_ctx, &values[j]);
+      ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+    }
+    RETURN_NOT_OK(output_->InputReceived(ExecBatch(std::move(values), 1)));
+    return output_->InputFinished();
+  }
+
+ private:
+  // The aggregation states updated by one task at a time
+  struct Partial {
+    std::vector<std::unique_ptr<KernelState>> states;
+    std::vector<KernelContext> kernel_ctxs;
+  };
+
+  Result<Partial*> MakePartial() {
+    ExecContext* ctx = plan_->exec_context();
+    std::unique_ptr<Partial> partial(new Partial);
+    partial->states.resize(kernels_.size());
+    partial->kernel_ctxs.assign(kernels_.size(), KernelContext{ctx});
+    for (size_t i = 0; i < kernels_.size(); ++i) {
+      KernelContext* kernel_ctx = &partial->kernel_ctxs[i];
+      ARROW_ASSIGN_OR_RAISE(partial->states[i], InitState(kernel_ctx, i));
+      kernel_ctx->SetState(partial->states[i].get());
+    }
+    partials_.push_back(std::move(partial));
+    return partials_.back().get();
+  }
+
+  Result<std::unique_ptr<KernelState>> InitState(KernelContext* kernel_ctx, size_t i) {
+    auto state =
+        kernels_[i]->init(kernel_ctx, {kernels_[i], kernel_descrs_[i], options_[i]});
+    ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+    if (state == nullptr) {
+      return Status::Invalid("ScalarAggregation requires non-null kernel state");
+    }
+    return std::move(state);
+  }
+
+  Status Consume(const ExecBatch& batch, Partial* partial) {
+    ExecContext* ctx = plan_->exec_context();
+    for (size_t i = 0; i < kernels_.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(Datum argument,
+                            MaterializeValue(batch, argument_indices_[i], ctx));
+      if (argument.is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(argument, MakeArrayFromScalar(*argument.scalar(),
+                                                            batch.length,
+                                                            ctx->memory_pool()));
+      }
+
+      // As in ScalarAggExecutor, kernels consume a batch into a fresh state
+      // which is then merged into the task's state
+      KernelContext batch_ctx{ctx};
+      ARROW_ASSIGN_OR_RAISE(auto batch_state, InitState(&batch_ctx, i));
+      batch_ctx.SetState(batch_state.get());
+      kernels_[i]->consume(&batch_ctx, ExecBatch({std::move(argument)}, batch.length));
+      ARROW_CTX_RETURN_IF_ERROR(&batch_ctx);
+
+      KernelContext* kernel_ctx = &partial->kernel_ctxs[i];
+      kernels_[i]->merge(kernel_ctx, *batch_state, partial->states[i].get());
+      ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+    }
+    return Status::OK();
+  }
+
+  std::vector<const ScalarAggregateKernel*> kernels_;
+  std::vector<std::vector<ValueDescr>> kernel_descrs_;
+  std::vector<const FunctionOptions*> options_;
+  std::vector<int> argument_indices_;
+
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<Partial>> partials_;
+  std::vector<Partial*> idle_partials_;
+};
+
+// ----------------------------------------------------------------------
+// Spilling nodes
+
+// Estimate the memory held by the rows of an array. Slices reference the
+// buffers of the whole array, so they only count their share of them,
+// assuming evenly sized rows.
+int64_t EstimateSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += EstimateSize(*child);
+  }
+  if (data.dictionary != nullptr) {
+    size += EstimateSize(*data.dictionary);
+  }
+
+  int64_t capacity = data.length;
+  const Buffer* values = data.buffers.size() > 1 ? data.buffers[1].get() : nullptr;
+  if (values != nullptr) {
+    const auto* fixed_width = dynamic_cast<const FixedWidthType*>(data.type.get());
+    if (fixed_width != nullptr && fixed_width->bit_width() > 0) {
+      capacity = values->size() * 8 / fixed_width->bit_width();
+    } else if (is_base_binary_like(data.type->id())) {
+      const int64_t offset_width = is_large_binary_like(data.type->id()) ? 8 : 4;
+      capacity = values->size() / offset_width - 1;
+    }
+  }
+  if (capacity <= data.length) {
+    return size;
+  }
+  return static_cast<int64_t>(static_cast<double>(size) * data.length / capacity);
+}
+
+int64_t EstimateSize(const RecordBatch& batch) {
+  int64_t size = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    size += EstimateSize(*batch.column_data(i));
+  }
+  return size;
+}
+
+// An IPC file being written in the spill directory
+struct SpillFile {
+  std::string path;
+  std::shared_ptr<io::FileOutputStream> stream;
+  std::shared_ptr<ipc::RecordBatchWriter> writer;
+
+  Status Close() {
+    RETURN_NOT_OK(writer->Close());
+    return stream->Close();
+  }
+};
+
+// A node which buffers its whole input before producing its output, and may
+// spill the buffered input to IPC files.
+//
+// Spills are triggered either by the buffered size crossing the memory limit
+// or by the release callback registered with a LimitedMemoryPool, and run one
+// at a time. Tasks crossing the limit while a spill is running wait for it,
+// rather than keep buffering, while the release callback returns at once: it
+// may be called from the spilling task itself.
+class SpillingNode : public ExecNode {
+ public:
+  SpillingNode(ExecNode* input, std::shared_ptr<Schema> output_schema,
+               std::vector<int> buffered_columns, SpillOptions spill_options)
+      : ExecNode(input->plan(), input, std::move(output_schema)),
+        buffered_columns_(std::move(buffered_columns)),
+        spill_options_(std::move(spill_options)) {
+    std::vector<std::shared_ptr<Field>> fields;
+    for (int i : buffered_columns_) {
+      fields.push_back(input->output_schema()->field(i));
+    }
+    buffered_schema_ = schema(std::move(fields));
+
+    if (!util::Codec::IsAvailable(spill_options_.compression)) {
+      spill_options_.compression = Compression::UNCOMPRESSED;
+    }
+    MemoryPool* pool = plan_->exec_context()->memory_pool();
+    limited_pool_ = dynamic_cast<LimitedMemoryPool*>(pool);
+    if (limited_pool_ != nullptr) {
+      release_callback_id_ = limited_pool_->AddReleaseCallback([this](int64_t) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (spilling_) {
+          return static_cast<int64_t>(0);
+        }
+        // Errors are reported by the next call of InputReceived or InputFinished
+        return SpillBuffered(&lock).ValueOr(0);
+      });
+    }
+  }
+
+  ~SpillingNode() override { RemoveReleaseCallback(); }
+
+  Status InputReceived(ExecBatch batch) override {
+    ARROW_ASSIGN_OR_RAISE(auto record_batch,
+                          MaterializeBatch(batch, buffered_columns_, buffered_schema_,
+                                           plan_->exec_context()));
+    const int64_t size = EstimateSize(*record_batch);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    RETURN_NOT_OK(spill_status_);
+    buffered_.push_back(std::move(record_batch));
+    buffered_size_ += size;
+    const int64_t memory_limit = MemoryLimit();
+    while (memory_limit >= 0 && buffered_size_ > memory_limit) {
+      if (spilling_) {
+        spill_done_.wait(lock);
+        RETURN_NOT_OK(spill_status_);
+      } else {
+        RETURN_NOT_OK(SpillBuffered(&lock).status());
+      }
+    }
+    return Status::OK();
+  }
+
+  Status InputFinished() override {
+    // No task is running anymore, and no spill can be requested past this point
+    RemoveReleaseCallback();
+    RETURN_NOT_OK(spill_status_);
+    if (spilled_) {
+      // All of the input goes through the spill files
+      std::unique_lock<std::mutex> lock(mutex_);
+      RETURN_NOT_OK(SpillBuffered(&lock).status());
+    }
+    RecordBatchVector batches = std::move(buffered_);
+    buffered_.clear();
+    buffered_size_ = 0;
+    RETURN_NOT_OK(Finish(std::move(batches)));
+    spill_dir_.reset();
+    return output_->InputFinished();
+  }
+
+ protected:
+  // Write the buffered batches to spill files
+  virtual Status Spill(RecordBatchVector batches) = 0;
+
+  // Produce the output from the batches still buffered, and from the spill
+  // files if the node spilled
+  virtual Status Finish(RecordBatchVector batches) = 0;
+
+  Result<SpillFile> OpenSpillFile(const std::shared_ptr<Schema>& schema) {
+    if (spill_dir_ == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(spill_dir_,
+                            ::arrow::internal::TemporaryDir::Make("arrow-spill-"));
+    }
+    SpillFile file;
+    file.path = spill_dir_->path().ToString() + std::to_string(num_spill_files_++) +
+                ".arrow";
+    ARROW_ASSIGN_OR_RAISE(file.stream, io::FileOutputStream::Open(file.path));
+    auto options = ipc::IpcWriteOptions::Defaults();
+    options.memory_pool = plan_->exec_context()->memory_pool();
+    options.compression = spill_options_.compression;
+    ARROW_ASSIGN_OR_RAISE(file.writer, ipc::MakeFileWriter(file.stream, schema, options));
+    return std::move(file);
+  }
+
+  Result<std::shared_ptr<ipc::RecordBatchFileReader>> OpenSpilledFile(
+      const std::string& path) {
+    MemoryPool* pool = plan_->exec_context()->memory_pool();
+    ARROW_ASSIGN_OR_RAISE(auto file, io::ReadableFile::Open(path, pool));
+    auto options = ipc::IpcReadOptions::Defaults();
+    options.memory_pool = pool;
+    return ipc::RecordBatchFileReader::Open(std::move(file), options);
+  }
+
+  // Derived nodes call this from their destructor, as the callback spills
+  // through their virtual methods
+  void RemoveReleaseCallback() {
+    if (limited_pool_ != nullptr) {
+      limited_pool_->RemoveReleaseCallback(release_callback_id_);
+      limited_pool_ = nullptr;
+    }
+  }
+
+  std::shared_ptr<Schema> buffered_schema_;
+  // Whether the node spilled; only changed by the spilling task
+  bool spilled_ = false;
+
+ private:
+  int64_t MemoryLimit() const {
+    if (spill_options_.memory_limit >= 0 || limited_pool_ == nullptr) {
+      return spill_options_.memory_limit;
+    }
+    return limited_pool_->limit() / 4;
+  }
+
+  // Spill the buffered batches, return the estimated number of bytes
+  // released. No other spill may be running; the lock is released while
+  // spilling, and errors are kept in spill_status_.
+  Result<int64_t> SpillBuffered(std::unique_lock<std::mutex>* lock) {
+    RecordBatchVector batches;
+    batches.swap(buffered_);
+    const int64_t size = buffered_size_;
+    buffered_size_ = 0;
+    if (batches.empty()) {
+      return 0;
+    }
+    spilling_ = true;
+    spilled_ = true;
+    lock->unlock();
+    Status st = Spill(std::move(batches));
+    lock->lock();
+    spilling_ = false;
+    spill_done_.notify_all();
+    if (!st.ok()) {
+      spill_status_ = st;
+      return st;
+    }
+    return size;
+  }
+
+  std::vector<int> buffered_columns_;
+  SpillOptions spill_options_;
+  LimitedMemoryPool* limited_pool_ = nullptr;
+  int64_t release_callback_id_ = -1;
+
+  std::mutex mutex_;
+  RecordBatchVector buffered_;
+  int64_t buffered_size_ = 0;
+  Status spill_status_;
+
+  bool spilling_ = false;
+  std::condition_variable spill_done_;
+  std::unique_ptr<::arrow::internal::TemporaryDir> spill_dir_;
+  int64_t num_spill_files_ = 0;
+};
+
+// Compares the values of a sort key across the batches of different runs, in
+// the order of sort_indices: nulls are placed last regardless of the order
+class MergeKeyComparator {
+ public:
+  virtual ~MergeKeyComparator() = default;
+
+  virtual int Compare(const Array& left, int64_t left_index, const Array& right,
+                      int64_t right_index) const = 0;
+};
+
+template <typename ArrowType>
+class ConcreteMergeKeyComparator : public MergeKeyComparator {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+ public:
+  explicit ConcreteMergeKeyComparator(SortOrder order) : order_(order) {}
+
+  int Compare(const Array& left, int64_t left_index, const Array& right,
+              int64_t right_index) const override {
+    const bool left_null = left.IsNull(left_index);
+    const bool right_null = right.IsNull(right_index);
+    if (left_null || right_null) {
+      return static_cast<int>(left_null) - static_cast<int>(right_null);
+    }
+    auto left_value = checked_cast<const ArrayType&>(left).GetView(left_index);
+    auto right_value = checked_cast<const ArrayType&>(right).GetView(right_index);
+    if (left_value == right_value) {
+      return 0;
+    }
+    return (left_value < right_value) == (order_ == SortOrder::Ascending) ? -1 : 1;
+  }
+
+ private:
+  SortOrder order_;
+};
+
+struct MergeKeyComparatorFactory {
+  // The types supported by sort_indices for tables
+  template <typename T>
+  enable_if_t<is_integer_type<T>::value || is_physical_floating_type<T>::value ||
+                  is_base_binary_type<T>::value,
+              Status>
+  Visit(const T&) {
+    out.reset(new ConcreteMergeKeyComparator<T>(order));
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::TypeError("Sorting not supported for type ", type.ToString());
+  }
+
+  static Result<std::unique_ptr<MergeKeyComparator>> Make(const DataType& type,
+                                                          SortOrder order) {
+    MergeKeyComparatorFactory factory{order, nullptr};
+    RETURN_NOT_OK(VisitTypeInline(type, &factory));
+    return std::move(factory.out);
+  }
+
+  SortOrder order;
+  std::unique_ptr<MergeKeyComparator> out;
+};
+
+class OrderByNode : public SpillingNode {
+ public:
+  OrderByNode(ExecNode* input, SortOptions options, SpillOptions spill_options,
+              std::vector<int> key_indices,
+              std::vector<std::unique_ptr<MergeKeyComparator>> comparators)
+      : SpillingNode(input, input->output_schema(), AllColumns(*input->output_schema()),
+                     std::move(spill_options)),
+        options_(std::move(options)),
+        key_indices_(std::move(key_indices)),
+        comparators_(std::move(comparators)) {}
+
+  ~OrderByNode() override { RemoveReleaseCallback(); }
+
+  const char* kind_name() const override { return "OrderBy"; }
+
+ protected:
+  // Each spill writes a sorted run
+  Status Spill(RecordBatchVector batches) override {
+    ARROW_ASSIGN_OR_RAISE(auto file, OpenSpillFile(output_schema_));
+    RETURN_NOT_OK(VisitSorted(std::move(batches), kRunBatchSize,
+                              [&](const RecordBatch& sorted) {
+                                return file.writer->WriteRecordBatch(sorted);
+                              }));
+    RETURN_NOT_OK(file.Close());
+    runs_.push_back(std::move(file.path));
+    return Status::OK();
+  }
+
+  Status Finish(RecordBatchVector batches) override {
+    if (!spilled_) {
+      return VisitSorted(std::move(batches), DefaultMorselSize(*output_schema_),
+                         [&](const RecordBatch& sorted) {
+                           return output_->InputReceived(ToExecBatch(sorted));
+                         });
+    }
+    return MergeRuns();
+  }
+
+ private:
+  // The read position in a sorted run
+  struct RunCursor {
+    std::shared_ptr<ipc::RecordBatchFileReader> reader;
+    int next_batch = 0;
+    std::shared_ptr<RecordBatch> batch;
+    int64_t row = 0;
+  };
+
+  static std::vector<int> AllColumns(const Schema& schema) {
+    std::vector<int> columns(schema.num_fields());
+    std::iota(columns.begin(), columns.end(), 0);
+    return columns;
+  }
+
+  // Sort the batches and visit the sorted rows a chunk at a time, so that
+  // sorting only takes the memory of the indices on top of the input.
+  //
+  // The batches are concatenated first, as taking from chunked columns would
+  // concatenate them for each chunk of sorted rows.
+  template <typename Visitor>
+  Status VisitSorted(RecordBatchVector batches, int64_t chunk_size, Visitor&& visit) {
+    ExecContext* ctx = plan_->exec_context();
+    std::shared_ptr<RecordBatch> batch;
+    {
+      ARROW_ASSIGN_OR_RAISE(auto table,
+                            Table::FromRecordBatches(output_schema_, batches));
+      batches.clear();
+      if (table->num_rows() == 0) {
+        return Status::OK();
+      }
+      ARROW_ASSIGN_OR_RAISE(table, table->CombineChunks(ctx->memory_pool()));
+      ArrayVector columns;
+      for (const auto& column : table->columns()) {
+        columns.push_back(column->chunk(0));
+      }
+      batch = RecordBatch::Make(output_schema_, table->num_rows(), std::move(columns));
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto indices, SortIndices(Datum(batch), options_, ctx));
+    for (int64_t offset = 0; offset < indices->length(); offset += chunk_size) {
+      ARROW_ASSIGN_OR_RAISE(Datum sorted,
+                            Take(Datum(batch), Datum(indices->Slice(offset, chunk_size)),
+                                 TakeOptions::NoBoundsCheck(), ctx));
+      RETURN_NOT_OK(visit(*sorted.record_batch()));
+    }
+    return Status::OK();
+  }
+
+  // Load the next non-empty batch of a run, return false at the end of the run
+  Result<bool> NextBatch(RunCursor* cursor) {
+    while (cursor->next_batch < cursor->reader->num_record_batches()) {
+      ARROW_ASSIGN_OR_RAISE(cursor->batch,
+                            cursor->reader->ReadRecordBatch(cursor->next_batch++));
+      cursor->row = 0;
+      if (cursor->batch->num_rows() > 0) {
+        return true;
+      }
+    }
+    cursor->batch.reset();
+    return false;
+  }
+
+  int CompareRows(const RunCursor& left, const RunCursor& right) const {
+    for (size_t i = 0; i < key_indices_.size(); ++i) {
+      const int column = key_indices_[i];
+      int cmp = comparators_[i]->Compare(*left.batch->column(column), left.row,
+                                         *right.batch->column(column), right.row);
+      if (cmp != 0) {
+        return cmp;
+      }
+    }
+    return 0;
+  }
+
+  // Concatenate the slices of the runs making the next output batch
+  Status EmitSlices(RecordBatchVector* slices) {
+    if (slices->empty()) {
+      return Status::OK();
+    }
+    std::shared_ptr<RecordBatch> batch;
+    if (slices->size() == 1) {
+      batch = slices->front();
+    } else {
+      int64_t length = 0;
+      for (const auto& slice : *slices) {
+        length += slice->num_rows();
+      }
+      ArrayVector columns(output_schema_->num_fields());
+      for (int i = 0; i < output_schema_->num_fields(); ++i) {
+        ArrayVector chunks;
+        for (const auto& slice : *slices) {
+          chunks.push_back(slice->column(i));
+        }
+        ARROW_ASSIGN_OR_RAISE(columns[i],
+                              Concatenate(chunks, plan_->exec_context()->memory_pool()));
+      }
+      batch = RecordBatch::Make(output_schema_, length, std::move(columns));
+    }
+    slices->clear();
+    return output_->InputReceived(ToExecBatch(*batch));
+  }
+
+  // K-way merge of the sorted runs. Ties are broken by run, so that rows are
+  // output in the order they were spilled.
+  Status MergeRuns() {
+    std::vector<RunCursor> cursors(runs_.size());
+    auto after = [&](int left, int right) {
+      int cmp = CompareRows(cursors[left], cursors[right]);
+      return cmp > 0 || (cmp == 0 && left > right);
+    };
+    std::priority_queue<int, std::vector<int>, decltype(after)> heap(after);
+    for (size_t i = 0; i < runs_.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(cursors[i].reader, OpenSpilledFile(runs_[i]));
+      ARROW_ASSIGN_OR_RAISE(bool non_empty, NextBatch(&cursors[i]));
+      if (non_empty) {
+        heap.push(static_cast<int>(i));
+      }
+    }
+
+    // Consecutive rows of the same batch are output as a slice of it
+    const int64_t morsel_size = DefaultMorselSize(*output_schema_);
+    RecordBatchVector slices;
+    int64_t num_rows = 0;
+    int slice_run = -1;
+    int64_t slice_offset = 0, slice_length = 0;
+    auto flush_slice = [&] {
+      if (slice_length > 0) {
+        slices.push_back(cursors[slice_run].batch->Slice(slice_offset, slice_length));
+      }
+      slice_run = -1;
+      slice_length = 0;
+    };
+
+    while (!heap.empty()) {
+      const int run = heap.top();
+      heap.pop();
+      RunCursor* cursor = &cursors[run];
+      if (run != slice_run) {
+        flush_slice();
+        slice_run = run;
+        slice_offset = cursor->row;
+      }
+      ++slice_length;
+      ++num_rows;
+
+      bool has_rows = ++cursor->row < cursor->batch->num_rows();
+      if (!has_rows) {
+        flush_slice();
+        ARROW_ASSIGN_OR_RAISE(has_rows, NextBatch(cursor));
+      }
+      if (has_rows) {
+        heap.push(run);
+      }
+      if (num_rows >= morsel_size) {
+        flush_slice();
+        RETURN_NOT_OK(EmitSlices(&slices));
+        num_rows = 0;
+      }
+    }
+    flush_slice();
+    return EmitSlices(&slices);
+  }
+
+  // Runs are written in small batches, as merging holds a batch of each run
+  // in memory
+  static constexpr int64_t kRunBatchSize = 4096;
+
+  SortOptions options_;
+  std::vector<int> key_indices_;
+  std::vector<std::unique_ptr<MergeKeyComparator>> comparators_;
+  std::vector<std::string> runs_;
+};
+
+class GroupByNode : public SpillingNode {
+ public:
+  // The buffered columns are the arguments followed by the keys
+  GroupByNode(ExecNode* input, std::shared_ptr<Schema> output_schema,
+              std::vector<internal::Aggregate> aggregates,
+              std::vector<int> argument_indices,
+              const std::vector<int>& key_indices, SpillOptions spill_options)
+      : SpillingNode(input, std::move(output_schema),
+                     Concat(argument_indices, key_indices), std::move(spill_options)),
+        aggregates_(std::move(aggregates)),
+        num_keys_(static_cast<int>(key_indices.size())) {}
+
+  ~GroupByNode() override { RemoveReleaseCallback(); }
+
+  const char* kind_name() const override { return "GroupBy"; }
+
+ protected:
+  // Each spill appends the rows of each hash partition to its file
+  Status Spill(RecordBatchVector batches) override {
+    ExecContext* ctx = plan_->exec_context();
+    if (partitions_.empty()) {
+      for (int i = 0; i < kNumPartitions; ++i) {
+        ARROW_ASSIGN_OR_RAISE(auto file, OpenSpillFile(buffered_schema_));
+        partitions_.push_back(std::move(file));
+      }
+    }
+
+    const int num_arguments = buffered_schema_->num_fields() - num_keys_;
+    std::vector<uint64_t> hashes;
+    std::vector<std::vector<int32_t>> partition_rows(kNumPartitions);
+    for (const auto& batch : batches) {
+      std::vector<Datum> keys;
+      for (int i = num_arguments; i < batch->num_columns(); ++i) {
+        keys.emplace_back(batch->column_data(i));
+      }
+      hashes.resize(batch->num_rows());
+      RETURN_NOT_OK(internal::HashBatch(ExecBatch(std::move(keys), batch->num_rows()),
+                                        hashes.data()));
+      for (int32_t row = 0; row < batch->num_rows(); ++row) {
+        // Memo tables use the low bits of the hashes
+        partition_rows[hashes[row] >> (64 - kPartitionBits)].push_back(row);
+      }
+
+      for (int i = 0; i < kNumPartitions; ++i) {
+        if (partition_rows[i].empty()) {
+          continue;
+        }
+        Int32Builder builder(ctx->memory_pool());
+        RETURN_NOT_OK(builder.AppendValues(partition_rows[i]));
+        std::shared_ptr<Array> indices;
+        RETURN_NOT_OK(builder.Finish(&indices));
+        partition_rows[i].clear();
+
+        ARROW_ASSIGN_OR_RAISE(Datum rows, Take(Datum(batch), Datum(indices),
+                                               TakeOptions::NoBoundsCheck(), ctx));
+        RETURN_NOT_OK(partitions_[i].writer->WriteRecordBatch(*rows.record_batch()));
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Finish(RecordBatchVector batches) override {
+    if (!spilled_) {
+      ARROW_ASSIGN_OR_RAISE(auto table,
+                            Table::FromRecordBatches(buffered_schema_, batches));
+      return Aggregate(*table);
+    }
+    for (auto& partition : partitions_) {
+      RETURN_NOT_OK(partition.Close());
+    }
+    for (const auto& partition : partitions_) {
+      RecordBatchVector partition_batches;
+      {
+        ARROW_ASSIGN_OR_RAISE(auto reader, OpenSpilledFile(partition.path));
+        for (int i = 0; i < reader->num_record_batches(); ++i) {
+          ARROW_ASSIGN_OR_RAISE(auto batch, reader->ReadRecordBatch(i));
+          partition_batches.push_back(std::move(batch));
+        }
+      }
+      ARROW_ASSIGN_OR_RAISE(
+          auto table, Table::FromRecordBatches(buffered_schema_, partition_batches));
+      RETURN_NOT_OK(Aggregate(*table));
+    }
+    partitions_.clear();
+    return Status::OK();
+  }
+
+ private:
+  static constexpr int kPartitionBits = 4;
+  static constexpr int kNumPartitions = 1 << kPartitionBits;
+
+  static std::vector<int> Concat(std::vector<int> left, const std::vector<int>& right) {
+    left.insert(left.end(), right.begin(), right.end());
+    return left;
+  }
+
+  Status Aggregate(const Table& table) {
+    if (table.num_rows() == 0) {
+      return Status::OK();
+    }
+    const int num_arguments = table.num_columns() - num_keys_;
+    std::vector<Datum> arguments, keys;
+    for (int i = 0; i < table.num_columns(); ++i) {
+      (i < num_arguments ? arguments : keys).emplace_back(table.column(i));
+    }
+    ARROW_ASSIGN_OR_RAISE(Datum grouped, internal::GroupBy(arguments, keys, aggregates_,
+                                                           plan_->exec_context()));
+    StructArray groups(grouped.array());
+    std::vector<Datum> values(groups.num_fields());
+    for (int i = 0; i < groups.num_fields(); ++i) {
+      values[i] = groups.field(i)->data();
+    }
+    return output_->InputReceived(ExecBatch(std::move(values), groups.length()));
+  }
+
+  std::vector<internal::Aggregate> aggregates_;
+  int num_keys_;
+  std::vector<SpillFile> partitions_;
+};
+
+// ----------------------------------------------------------------------
+// Sink
+
+class TableSinkNode : public ExecNode {
+ public:
+  TableSinkNode(ExecNode* input, std::shared_ptr<Table>* out)
+      : ExecNode(input->plan(), input, input->output_schema(), /*is_sink=*/true),
+        out_(out),
+        column_indices_(output_schema_->num_fields()) {
+    std::iota(column_indices_.begin(), column_indices_.end(), 0);
+  }
+
+  const char* kind_name() const override { return "TableSink"; }
+
+  Status InputReceived(ExecBatch batch) override {
+    ARROW_ASSIGN_OR_RAISE(auto record_batch,
+                          MaterializeBatch(batch, column_indices_, output_schema_,
+                                           plan_->exec_context()));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    batches_.push_back(std::move(record_batch));
+    return Status::OK();
+  }
+
+  Status InputFinished() override {
+    ARROW_ASSIGN_OR_RAISE(*out_, Table::FromRecordBatches(output_schema_, batches_));
+    batches_.clear();
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Table>* out_;
+  std::vector<int> column_indices_;
+  std::mutex mutex_;
+  RecordBatchVector batches_;
+};
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Node factories
+
+int64_t DefaultMorselSize(const Schema& schema) {
+  // Aim for half of the L2 cache, leaving room for the intermediate results
+  // of filters and projections. Variable-width columns are assumed to take
+  // 16 bytes per row.
+  const int64_t l2_size = CpuInfo::GetInstance()->CacheSize(CpuInfo::L2_CACHE);
+  int64_t row_width = 0;
+  for (const auto& field : schema.fields()) {
+    const auto* fixed_width = dynamic_cast<const FixedWidthType*>(field->type().get());
+    row_width += fixed_width ? std::max(1, fixed_width->bit_width() / 8) : 16;
+  }
+  row_width = std::max<int64_t>(row_width, 1);
+  return std::min<int64_t>(std::max<int64_t>(l2_size / 2 / row_width, 1024), 1 << 20);
+}
+
+Result<ExecNode*> MakeTableSourceNode(ExecPlan* plan, std::shared_ptr<Table> table,
+                                      int64_t morsel_size) {
+  if (morsel_size < 0) {
+    return Status::Invalid("Morsel size must be positive, got ", morsel_size);
+  }
+  if (morsel_size == 0) {
+    morsel_size = DefaultMorselSize(*table->schema());
+  }
+  return plan->AddNode(std::unique_ptr<ExecNode>(
+      new TableSourceNode(plan, std::move(table), morsel_size)));
+}
+
+Result<ExecNode*> MakeFilterNode(ExecNode* input, ExecExpression predicate) {
+  RETURN_NOT_OK(predicate.Bind(*input->output_schema(), input->plan()->exec_context()));
+  if (predicate.descr().type->id() != Type::BOOL) {
+    return Status::TypeError("Filter predicate ", predicate.ToString(),
+                             " must be boolean, got ", *predicate.descr().type);
+  }
+  ExecPlan* plan = input->plan();
+  return plan->AddNode(
+      std::unique_ptr<ExecNode>(new FilterNode(input, std::move(predicate))));
+}
+
+Result<ExecNode*> MakeProjectNode(ExecNode* input, std::vector<ExecExpression> exprs,
+                                  std::vector<std::string> names) {
+  if (exprs.size() != names.size()) {
+    return Status::Invalid("Project got ", exprs.size(), " expressions for ",
+                           names.size(), " names");
+  }
+  std::vector<std::shared_ptr<Field>> fields(exprs.size());
+  for (size_t i = 0; i < exprs.size(); ++i) {
+    RETURN_NOT_OK(exprs[i].Bind(*input->output_schema(), input->plan()->exec_context()));
+    fields[i] = field(std::move(names[i]), exprs[i].descr().type);
+  }
+  ExecPlan* plan = input->plan();
+  return plan->AddNode(std::unique_ptr<ExecNode>(
+      new ProjectNode(input, schema(std::move(fields)), std::move(exprs))));
+}
+
+Result<ExecNode*> MakeScalarAggregateNode(ExecNode* input,
+                                          std::vector<internal::Aggregate> aggregates,
+                                          std::vector<std::string> arguments) {
+  if (aggregates.size() != arguments.size()) {
+    return Status::Invalid("ScalarAggregate got ", arguments.size(), " arguments for ",
+                           aggregates.size(), " aggregates");
+  }
+  ExecPlan* plan = input->plan();
+  ExecContext* ctx = plan->exec_context();
+  const Schema& input_schema = *input->output_schema();
+
+  std::vector<const ScalarAggregateKernel*> kernels(aggregates.size());
+  std::vector<std::vector<ValueDescr>> kernel_descrs(aggregates.size());
+  std::vector<const FunctionOptions*> options(aggregates.size());
+  std::vector<int> argument_indices(aggregates.size());
+  std::vector<std::shared_ptr<Field>> fields(aggregates.size());
+  for (size_t i = 0; i < aggregates.size(); ++i) {
+    argument_indices[i] = input_schema.GetFieldIndex(arguments[i]);
+    if (argument_indices[i] == -1) {
+      return Status::Invalid("No single field named '", arguments[i], "' in schema ",
+                             input_schema.ToString());
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto function,
+                          ctx->func_registry()->GetFunction(aggregates[i].function));
+    if (function->kind() != Function::SCALAR_AGGREGATE) {
+      return Status::Invalid("The provided function (", aggregates[i].function,
+                             ") is not a scalar aggregate function");
+    }
+    const auto& agg_function = checked_cast<const ScalarAggregateFunction&>(*function);
+    kernel_descrs[i] = {
+        ValueDescr::Array(input_schema.field(argument_indices[i])->type())};
+    ARROW_ASSIGN_OR_RAISE(kernels[i], agg_function.DispatchExact(kernel_descrs[i]));
+    options[i] =
+        aggregates[i].options ? aggregates[i].options : agg_function.default_options();
+
+    KernelContext kernel_ctx{ctx};
+    ARROW_ASSIGN_OR_RAISE(auto descr, kernels[i]->signature->out_type().Resolve(
+                                          &kernel_ctx, kernel_descrs[i]));
+    fields[i] = field(aggregates[i].function, std::move(descr.type));
+  }
+
+  return plan->AddNode(std::unique_ptr<ExecNode>(new ScalarAggregateNode(
+      input, schema(std::move(fields)), std::move(kernels), std::move(kernel_descrs),
+      std::move(options), std::move(argument_indices))));
+}
+
+Result<ExecNode*> MakeOrderByNode(ExecNode* input, SortOptions options,
+                                  SpillOptions spill_options) {
+  if (options.sort_keys.empty()) {
+    return Status::Invalid("Must specify one or more sort keys");
+  }
+  const Schema& input_schema = *input->output_schema();
+  std::vector<int> key_indices;
+  std::vector<std::unique_ptr<MergeKeyComparator>> comparators;
+  for (const auto& sort_key : options.sort_keys) {
+    const int i = input_schema.GetFieldIndex(sort_key.name);
+    if (i == -1) {
+      return Status::Invalid("Nonexistent sort key column: ", sort_key.name);
+    }
+    key_indices.push_back(i);
+    ARROW_ASSIGN_OR_RAISE(auto comparator, MergeKeyComparatorFactory::Make(
+                                               *input_schema.field(i)->type(),
+                                               sort_key.order));
+    comparators.push_back(std::move(comparator));
+  }
+  ExecPlan* plan = input->plan();
+  return plan->AddNode(std::unique_ptr<ExecNode>(
+      new OrderByNode(input, std::move(options), std::move(spill_options),
+                      std::move(key_indices), std::move(comparators))));
+}
+
+Result<ExecNode*> MakeGroupByNode(ExecNode* input,
+                                  std::vector<internal::Aggregate> aggregates,
+                                  std::vector<std::string> arguments,
+                                  std::vector<std::string> keys,
+                                  SpillOptions spill_options) {
+  if (aggregates.size() != arguments.size()) {
+    return Status::Invalid("GroupBy got ", arguments.size(), " arguments for ",
+                           aggregates.size(), " aggregates");
+  }
+  if (keys.empty()) {
+    return Status::Invalid("GroupBy requires at least one key");
+  }
+  ExecPlan* plan = input->plan();
+  ExecContext* ctx = plan->exec_context();
+  const Schema& input_schema = *input->output_schema();
+
+  auto resolve_field = [&](const std::string& name) -> Result<int> {
+    const int i = input_schema.GetFieldIndex(name);
+    if (i == -1) {
+      return Status::Invalid("No single field named '", name, "' in schema ",
+                             input_schema.ToString());
+    }
+    return i;
+  };
+
+  // Resolve the output types as GroupBy will
+  std::vector<int> argument_indices(aggregates.size());
+  std::vector<std::shared_ptr<Field>> fields;
+  for (size_t i = 0; i < aggregates.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(argument_indices[i], resolve_field(arguments[i]));
+
+    ARROW_ASSIGN_OR_RAISE(auto function,
+                          ctx->func_registry()->GetFunction(aggregates[i].function));
+    if (function->kind() != Function::HASH_AGGREGATE) {
+      return Status::Invalid("The provided function (", aggregates[i].function,
+                             ") is not a hash aggregate function");
+    }
+    const auto& hash_function = checked_cast<const HashAggregateFunction&>(*function);
+    std::vector<ValueDescr> kernel_descrs = {
+        ValueDescr::Array(input_schema.field(argument_indices[i])->type()),
+        ValueDescr::Array(uint32())};
+    ARROW_ASSIGN_OR_RAISE(auto kernel, hash_function.DispatchExact(kernel_descrs));
+
+    KernelContext kernel_ctx{ctx};
+    ARROW_ASSIGN_OR_RAISE(auto descr, kernel->signature->out_type().Resolve(
+                                          &kernel_ctx, kernel_descrs));
+    fields.push_back(field(aggregates[i].function, std::move(descr.type)));
+  }
+
+  std::vector<int> key_indices(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(key_indices[i], resolve_field(keys[i]));
+    fields.push_back(input_schema.field(key_indices[i]));
+  }
+
+  return plan->AddNode(std::unique_ptr<ExecNode>(new GroupByNode(
+      input, schema(std::move(fields)), std::move(aggregates),
+      std::move(argument_indices), key_indices, std::move(spill_options))));
+}
+
+Result<ExecNode*> MakeTableSinkNode(ExecNode* input, std::shared_ptr<Table>* out) {
+  ExecPlan* plan = input->plan();
+  return plan->AddNode(std::unique_ptr<ExecNode>(new TableSinkNode(input, out)));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,308 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Push-based execution plans. This API is EXPERIMENTAL.
+//
+// A plan is a graph of ExecNodes. Source nodes split their input into
+// morsels: small ExecBatches which are pushed through the downstream nodes
+// one at a time, by a single task, so that a batch is still cache-resident
+// when the next operator receives it. When the ExecContext allows threads,
+// the tasks run concurrently on the CPU thread pool.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/datum.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class Function;
+
+namespace detail {
+
+class BoundScalarKernel;
+
+}  // namespace detail
+
+/// \brief A scalar expression over the columns of an ExecBatch
+///
+/// An expression is a field reference, a literal or a call to a scalar
+/// function of other expressions. It must be bound to the schema of its
+/// input before it can be evaluated.
+class ARROW_EXPORT ExecExpression {
+ public:
+  /// Reference the column of the input named `name`
+  static ExecExpression Field(std::string name);
+
+  /// A constant value
+  static ExecExpression Literal(Datum value);
+
+  /// Call a scalar function; null options stand for the function's defaults
+  static ExecExpression Call(std::string function, std::vector<ExecExpression> arguments,
+                             std::shared_ptr<FunctionOptions> options = NULLPTR);
+
+  /// \brief Resolve field references and function kernels against the schema
+  /// of the input batches
+  Status Bind(const Schema& schema, ExecContext* ctx);
+
+  bool is_bound() const { return bound_; }
+
+  /// The type and shape of the expression's value; valid once bound
+  const ValueDescr& descr() const { return descr_; }
+
+  /// \brief Evaluate a bound expression against a batch
+  ///
+  /// If the batch has a selection vector, field references evaluate to the
+  /// selected rows only. May be called concurrently.
+  Result<Datum> Evaluate(const ExecBatch& batch, ExecContext* ctx) const;
+
+  std::string ToString() const;
+
+ private:
+  enum Kind { FIELD, LITERAL, CALL };
+
+  explicit ExecExpression(Kind kind) : kind_(kind) {}
+
+  Kind kind_;
+  bool bound_ = false;
+  ValueDescr descr_;
+
+  // FIELD
+  std::string name_;
+  int index_ = -1;
+
+  // LITERAL
+  Datum literal_;
+
+  // CALL
+  std::string function_name_;
+  std::vector<ExecExpression> arguments_;
+  std::shared_ptr<FunctionOptions> options_;
+  std::shared_ptr<const Function> function_;
+  // Dispatched and initialized by Bind, so that Evaluate only runs the kernel
+  std::shared_ptr<const detail::BoundScalarKernel> kernel_;
+};
+
+class ExecPlan;
+
+/// \brief A node of an execution plan
+///
+/// Nodes receive batches from their input and push batches to their output.
+/// InputReceived may be called concurrently from several tasks, and is
+/// followed by a single call to InputFinished once all tasks are done.
+class ARROW_EXPORT ExecNode {
+ public:
+  virtual ~ExecNode() = default;
+
+  virtual const char* kind_name() const = 0;
+
+  ExecPlan* plan() const { return plan_; }
+
+  /// The node producing this node's input, or null for a source node
+  ExecNode* input() const { return input_; }
+
+  /// The node receiving this node's output, or null for a sink node
+  ExecNode* output() const { return output_; }
+
+  const std::shared_ptr<Schema>& output_schema() const { return output_schema_; }
+
+  /// Whether the node consumes its input without producing an output
+  bool is_sink() const { return is_sink_; }
+
+  /// \brief Start producing batches
+  ///
+  /// Only implemented by source nodes, which push their output from tasks
+  /// appended to task_group.
+  virtual Status StartProducing(::arrow::internal::TaskGroup* task_group);
+
+  /// \brief Process a batch received from the input
+  virtual Status InputReceived(ExecBatch batch) = 0;
+
+  /// \brief Process the end of the input
+  virtual Status InputFinished() = 0;
+
+ protected:
+  ExecNode(ExecPlan* plan, ExecNode* input, std::shared_ptr<Schema> output_schema,
+           bool is_sink = false);
+
+  ExecPlan* plan_;
+  ExecNode* input_;
+  ExecNode* output_ = NULLPTR;
+  std::shared_ptr<Schema> output_schema_;
+  bool is_sink_;
+
+ private:
+  friend class ExecPlan;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ExecNode);
+};
+
+/// \brief A graph of ExecNodes, which owns its nodes
+class ARROW_EXPORT ExecPlan {
+ public:
+  /// \param[in] ctx the function execution context, optional. It must outlive
+  /// the plan.
+  explicit ExecPlan(ExecContext* ctx = NULLPTR);
+  ~ExecPlan();
+
+  ExecContext* exec_context() const { return ctx_; }
+
+  /// \brief Add a node to the plan, connecting it to the output of its input
+  Result<ExecNode*> AddNode(std::unique_ptr<ExecNode> node);
+
+  const std::vector<std::unique_ptr<ExecNode>>& nodes() const { return nodes_; }
+
+  /// \brief Check that the plan is complete: every node except sinks must
+  /// have an output
+  Status Validate() const;
+
+  /// \brief Run the plan to completion
+  ///
+  /// A plan can only be run once.
+  Status Run();
+
+ private:
+  ExecContext default_ctx_;
+  ExecContext* ctx_;
+  std::vector<std::unique_ptr<ExecNode>> nodes_;
+  bool started_ = false;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ExecPlan);
+};
+
+/// \brief Choose a number of rows per morsel such that a batch of the given
+/// schema should fit in the L2 cache
+ARROW_EXPORT
+int64_t DefaultMorselSize(const Schema& schema);
+
+/// \brief Make a source node which pushes the rows of a table
+///
+/// \param[in] plan the plan to add the node to
+/// \param[in] table the input; it must outlive the run of the plan
+/// \param[in] morsel_size the maximum number of rows per batch, or 0 to use
+/// DefaultMorselSize
+ARROW_EXPORT
+Result<ExecNode*> MakeTableSourceNode(ExecPlan* plan, std::shared_ptr<Table> table,
+                                      int64_t morsel_size = 0);
+
+/// \brief Make a node which only forwards the rows for which a boolean
+/// predicate is true
+///
+/// The node doesn't copy the input columns: it attaches a selection vector to
+/// the batches, and downstream nodes only copy the selected rows of
+/// the columns they use.
+ARROW_EXPORT
+Result<ExecNode*> MakeFilterNode(ExecNode* input, ExecExpression predicate);
+
+/// \brief Make a node which outputs one column per expression
+ARROW_EXPORT
+Result<ExecNode*> MakeProjectNode(ExecNode* input, std::vector<ExecExpression> exprs,
+                                  std::vector<std::string> names);
+
+/// \brief Make a node which reduces its whole input to a single row, using
+/// scalar aggregate functions such as "sum" or "min_max"
+///
+/// Each concurrently running task updates its own set of aggregation states,
+/// which are merged once the input is finished. The output fields are named
+/// after the aggregate functions.
+///
+/// \param[in] input the input node
+/// \param[in] aggregates the aggregate function and options for each output
+/// \param[in] arguments the name of the input column of each aggregate
+ARROW_EXPORT
+Result<ExecNode*> MakeScalarAggregateNode(ExecNode* input,
+                                          std::vector<internal::Aggregate> aggregates,
+                                          std::vector<std::string> arguments);
+
+/// \brief Options for the nodes which buffer their whole input, and spill it to
+/// disk to bound their memory use
+///
+/// Spilled data is written to Arrow IPC files in a temporary directory, which
+/// is removed once the node has produced its output.
+struct ARROW_EXPORT SpillOptions {
+  /// \brief Spill once the node buffers more than this many bytes of input
+  ///
+  /// If negative, the limit is a quarter of the limit of the memory pool of the
+  /// plan's ExecContext if it is a LimitedMemoryPool, leaving room to sort or
+  /// partition the buffered input, and there is no limit otherwise. A
+  /// LimitedMemoryPool also asks the node to spill when an allocation would
+  /// exceed its limit.
+  int64_t memory_limit = -1;
+  /// The compression of the spill files' bodies. The files are written
+  /// uncompressed if the codec wasn't built.
+  Compression::type compression = Compression::LZ4_FRAME;
+
+  static SpillOptions Defaults() { return SpillOptions(); }
+};
+
+/// \brief Make a node which sorts its whole input, as sort_indices would
+///
+/// Once the node spilled, the input is written as sorted runs which are merged
+/// when the input is finished, holding a single batch of each run in memory.
+/// The output is pushed from a single task, in order.
+///
+/// \param[in] input the input node
+/// \param[in] options the sort keys
+/// \param[in] spill_options when and how to spill the buffered input
+ARROW_EXPORT
+Result<ExecNode*> MakeOrderByNode(ExecNode* input, SortOptions options,
+                                  SpillOptions spill_options = SpillOptions::Defaults());
+
+/// \brief Make a node which computes grouped aggregates, using hash aggregate
+/// functions such as "hash_sum"
+///
+/// The output has one field per aggregate, named after the aggregate function,
+/// followed by the keys, and one row per group. Once the node spilled, the
+/// input is hash partitioned on the keys into files which are aggregated one
+/// at a time, so each partition's input must fit in memory.
+///
+/// \param[in] input the input node
+/// \param[in] aggregates the aggregate function and options for each output
+/// \param[in] arguments the name of the input column of each aggregate
+/// \param[in] keys the names of the input columns to group by
+/// \param[in] spill_options when and how to spill the buffered input
+ARROW_EXPORT
+Result<ExecNode*> MakeGroupByNode(ExecNode* input,
+                                  std::vector<internal::Aggregate> aggregates,
+                                  std::vector<std::string> arguments,
+                                  std::vector<std::string> keys,
+                                  SpillOptions spill_options = SpillOptions::Defaults());
+
+/// \brief Make a node which collects its input into a table
+///
+/// The table is assigned to *out when the input is finished. When the plan
+/// runs concurrently, the order of the rows is unspecified.
+ARROW_EXPORT
+Result<ExecNode*> MakeTableSinkNode(ExecNode* input, std::shared_ptr<Table>* out);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,418 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+#include "arrow/array/array_nested.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/exec_plan.h"
+#include "arrow/memory_pool.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+using E = ExecExpression;
+
+class TestExecPlan : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUp() override { ctx_.set_use_threads(GetParam()); }
+
+  std::shared_ptr<Table> MakeInput() {
+    return TableFromJSON(schema({field("i", int32()), field("s", utf8())}),
+                         {R"([[1, "a"], [2, "b"], [null, "c"]])",
+                          R"([[4, "d"], [5, null], [6, "f"], [7, "g"]])"});
+  }
+
+  // The output row order is unspecified with threads, so sort it
+  std::shared_ptr<Table> Sorted(const std::shared_ptr<Table>& table) {
+    std::vector<SortKey> keys;
+    for (const auto& field : table->schema()->fields()) {
+      keys.emplace_back(field->name());
+    }
+    EXPECT_OK_AND_ASSIGN(auto indices, SortIndices(Datum(table), SortOptions(keys)));
+    EXPECT_OK_AND_ASSIGN(Datum sorted, Take(Datum(table), Datum(indices)));
+    return sorted.table();
+  }
+
+ protected:
+  ExecContext ctx_;
+};
+
+TEST_P(TestExecPlan, SourceSink) {
+  auto input = MakeInput();
+  ExecPlan plan(&ctx_);
+  ASSERT_OK_AND_ASSIGN(auto source, MakeTableSourceNode(&plan, input, /*morsel_size=*/2));
+  std::shared_ptr<Table> out;
+  ASSERT_OK(MakeTableSinkNode(source, &out).status());
+  ASSERT_OK(plan.Run());
+
+  ASSERT_OK(out->ValidateFull());
+  AssertTablesEqual(*Sorted(input), *Sorted(out), /*same_chunk_layout=*/false);
+}
+
+TEST_P(TestExecPlan, FilterProject) {
+  ExecPlan plan(&ctx_);
+  ASSERT_OK_AND_ASSIGN(auto source, MakeTableSourceNode(&plan, MakeInput(), 2));
+  ASSERT_OK_AND_ASSIGN(
+      auto filter,
+      MakeFilterNode(source, E::Call("greater", {E::Field("i"), E::Literal(Datum(1))})));
+  ASSERT_OK_AND_ASSIGN(
+      auto project,
+      MakeProjectNode(filter,
+                      {E::Field("s"), E::Call("multiply", {E::Field("i"), E::Field("i")}),
+                       E::Literal(Datum(true))},
+                      {"s", "i_squared", "flag"}));
+  std::shared_ptr<Table> out;
+  ASSERT_OK(MakeTableSinkNode(project, &out).status());
+  ASSERT_OK(plan.Run());
+
+  ASSERT_OK(out->ValidateFull());
+  auto expected = TableFromJSON(
+      schema({field("s", utf8()), field("i_squared", int32()), field("flag", boolean())}),
+      {R"([["b", 4, true], ["d", 16, true], ["f", 36, true],
+           ["g", 49, true], [null, 25, true]])"});
+  AssertTablesEqual(*expected, *Sorted(out), /*same_chunk_layout=*/false);
+}
+
+TEST_P(TestExecPlan, ChainedFilters) {
+  ExecPlan plan(&ctx_);
+  ASSERT_OK_AND_ASSIGN(auto source, MakeTableSourceNode(&plan, MakeInput(), 4));
+  ASSERT_OK_AND_ASSIGN(
+      auto filter1,
+      MakeFilterNode(source, E::Call("greater", {E::Field("i"), E::Literal(Datum(1))})));
+  ASSERT_OK_AND_ASSIGN(
+      auto filter2,
+      MakeFilterNode(filter1, E::Call("less", {E::Field("i"), E::Literal(Datum(7))})));
+  ASSERT_OK_AND_ASSIGN(auto aggregate,
+                       MakeScalarAggregateNode(filter2, {{"sum", nullptr}}, {"i"}));
+  std::shared_ptr<Table> out;
+  ASSERT_OK(MakeTableSinkNode(aggregate, &out).status());
+  ASSERT_OK(plan.Run());
+
+  AssertTablesEqual(*TableFromJSON(schema({field("sum", int64())}), {"[[17]]"}), *out);
+}
+
+TEST_P(TestExecPlan, ScalarFilter) {
+  for (bool keep : {true, false}) {
+    ExecPlan plan(&ctx_);
+    auto input = MakeInput();
+    ASSERT_OK_AND_ASSIGN(auto source, MakeTableSourceNode(&plan, input, 2));
+    ASSERT_OK_AND_ASSIGN(auto filter, MakeFilterNode(source, E::Literal(Datum(keep))));
+    std::shared_ptr<Table> out;
+    ASSERT_OK(MakeTableSinkNode(filter, &out).status());
+    ASSERT_OK(plan.Run());
+    ASSERT_EQ(keep ? input->num_rows() : 0, out->num_rows());
+  }
+}
+
+TEST_P(TestExecPlan, ScalarAggregate) {
+  auto rand = random::RandomArrayGenerator(0x5487655);
+  auto values = rand.Int64(10000, -1000, 1000, /*null_probability=*/0.1);
+  auto input = Table::Make(schema({field("x", int64())}), ArrayVector{values});
+
+  ExecPlan plan(&ctx_);
+  ASSERT_OK_AND_ASSIGN(auto source, MakeTableSourceNode(&plan, input, 256));
+  ASSERT_OK_AND_ASSIGN(auto aggregate,
+                       MakeScalarAggregateNode(
+                           source, {{"sum", nullptr}, {"count", nullptr},
+                                    {"min_max", nullptr}},
+                           {"x", "x", "x"}));
+  std::shared_ptr<Table> out;
+  ASSERT_OK(MakeTableSinkNode(aggregate, &out).status());
+  ASSERT_OK(plan.Run());
+
+  ASSERT_OK(out->ValidateFull());
+  ASSERT_EQ(1, out->num_rows());
+  ASSERT_EQ(3, out->num_columns());
+  ASSERT_OK_AND_ASSIGN(Datum sum, Sum(values));
+  ASSERT_OK_AND_ASSIGN(Datum count, Count(values));
+  ASSERT_OK_AND_ASSIGN(Datum min_max, MinMax(values));
+  for (int i = 0; i < 3; ++i) {
+    const Datum& expected = i == 0 ? sum : i == 1 ? count : min_max;
+    ASSERT_OK_AND_ASSIGN(auto actual, out->column(i)->chunk(0)->GetScalar(0));
+    AssertScalarsEqual(*expected.scalar(), *actual, /*verbose=*/true);
+  }
+}
+
+TEST_P(TestExecPlan, ScalarAggregateEmptyInput) {
+  ExecPlan plan(&ctx_);
+  ASSERT_OK_AND_ASSIGN(auto source, MakeTableSourceNode(&plan, MakeInput()));
+  ASSERT_OK_AND_ASSIGN(auto filter, MakeFilterNode(source, E::Literal(Datum(false))));
+  ASSERT_OK_AND_ASSIGN(auto aggregate,
+                       MakeScalarAggregateNode(filter, {{"count", nullptr}}, {"i"}));
+  std::shared_ptr<Table> out;
+  ASSERT_OK(MakeTableSinkNode(aggregate, &out).status());
+  ASSERT_OK(plan.Run());
+
+  AssertTablesEqual(*TableFromJSON(schema({field("count", int64())}), {"[[0]]"}), *out);
+}
+
+class TestSpillingNodes : public TestExecPlan {
+ public:
+  // Random int32 and string columns, and a unique int64 column
+  std::shared_ptr<Table> MakeRandomInput(int64_t length) {
+    auto rand = random::RandomArrayGenerator(0x2a81b3c);
+    std::vector<int64_t> n(length);
+    std::iota(n.begin(), n.end(), 0);
+    std::shared_ptr<Array> n_array;
+    ArrayFromVector<Int64Type>(n, &n_array);
+    return Table::Make(
+        schema({field("i", int32()), field("s", utf8()), field("n", int64())}),
+        {rand.Int32(length, -100, 100, /*null_probability=*/0.1),
+         rand.String(length, 0, 4, /*null_probability=*/0.1), n_array});
+  }
+
+  // The memory limits making the nodes never spill, spill every batch, and spill
+  // every few batches
+  std::vector<int64_t> MemoryLimits() { return {-1, 0, 1 << 14}; }
+};
+
+TEST_P(TestSpillingNodes, OrderBy) {
+  auto input = MakeRandomInput(10000);
+  // The unique last key makes the order total
+  SortOptions options({SortKey("i", SortOrder::Descending), SortKey("s"), SortKey("n")});
+  ASSERT_OK_AND_ASSIGN(auto indices, SortIndices(Datum(input), options));
+  ASSERT_OK_AND_ASSIGN(Datum expected, Take(Datum(input), Datum(indices)));
+
+  for (int64_t memory_limit : MemoryLimits()) {
+    SCOPED_TRACE("memory_limit = " + std::to_string(memory_limit));
+    SpillOptions spill_options;
+    spill_options.memory_limit = memory_limit;
+
+    ExecPlan plan(&ctx_);
+    ASSERT_OK_AND_ASSIGN(auto source, MakeTableSourceNode(&plan, input, 256));
+    ASSERT_OK_AND_ASSIGN(auto order_by, MakeOrderByNode(source, options, spill_options));
+    std::shared_ptr<Table> out;
+    ASSERT_OK(MakeTableSinkNode(order_by, &out).status());
+    ASSERT_OK(plan.Run());
+
+    ASSERT_OK(out->ValidateFull());
+    AssertTablesEqual(*expected.table(), *out, /*same_chunk_layout=*/false);
+  }
+}
+
+TEST_P(TestSpillingNodes, OrderByFilteredInput) {
+  auto input = MakeRandomInput(10000);
+  SortOptions options({SortKey("s"), SortKey("n", SortOrder::Descending)});
+  SpillOptions spill_options;
+  spill_options.memory_limit = 1 << 12;
+
+  ExecPlan plan(&ctx_);
+  ASSERT_OK_AND_ASSIGN(auto source, MakeTableSourceNode(&plan, input, 256));
+  ASSERT_OK_AND_ASSIGN(
+      auto filter,
+      MakeFilterNode(source, E::Call("greater", {E::Field("i"), E::Literal(Datum(0))})));
+  ASSERT_OK_AND_ASSIGN(auto order_by, MakeOrderByNode(filter, options, spill_options));
+  std::shared_ptr<Table> out;
+  ASSERT_OK(MakeTableSinkNode(order_by, &out).status());
+  ASSERT_OK(plan.Run());
+
+  ASSERT_OK_AND_ASSIGN(
+      Datum mask, CallFunction("greater", {input->GetColumnByName("i"),
+                                           Datum(std::make_shared<Int32Scalar>(0))}));
+  ASSERT_OK_AND_ASSIGN(Datum filtered, Filter(Datum(input), mask));
+  ASSERT_OK_AND_ASSIGN(auto indices, SortIndices(filtered, options));
+  ASSERT_OK_AND_ASSIGN(Datum expected, Take(filtered, Datum(indices)));
+  ASSERT_OK(out->ValidateFull());
+  AssertTablesEqual(*expected.table(), *out, /*same_chunk_layout=*/false);
+}
+
+TEST_P(TestSpillingNodes, OrderBySpillsUnderPoolLimit) {
+  auto input = MakeRandomInput(400000);
+  SortOptions options({SortKey("m", SortOrder::Descending)});
+
+  // The projection allocates the buffered column from the limited pool, which
+  // can't hold all of it
+  LimitedMemoryPool pool(default_memory_pool(), /*limit=*/3 << 20);
+  ExecContext ctx(&pool);
+  ctx.set_use_threads(GetParam());
+  ExecPlan plan(&ctx);
+  ASSERT_OK_AND_ASSIGN(auto source, MakeTableSourceNode(&plan, input, 4096));
+  ASSERT_OK_AND_ASSIGN(
+      auto project,
+      MakeProjectNode(
+          source, {E::Call("multiply", {E::Field("n"), E::Literal(Datum(int64_t(2)))})},
+          {"m"}));
+  ASSERT_OK_AND_ASSIGN(auto order_by, MakeOrderByNode(project, options));
+  ASSERT_OK_AND_ASSIGN(auto aggregate,
+                       MakeScalarAggregateNode(order_by, {{"count", nullptr}}, {"m"}));
+  std::shared_ptr<Table> out;
+  ASSERT_OK(MakeTableSinkNode(aggregate, &out).status());
+  ASSERT_OK(plan.Run());
+
+  ASSERT_OK_AND_ASSIGN(auto count, out->column(0)->chunk(0)->GetScalar(0));
+  AssertScalarsEqual(Int64Scalar(400000), *count);
+  ASSERT_LE(pool.max_memory(), pool.limit());
+}
+
+TEST_P(TestSpillingNodes, GroupBy) {
+  auto input = MakeRandomInput(10000);
+  ASSERT_OK_AND_ASSIGN(
+      Datum grouped,
+      internal::GroupBy({input->GetColumnByName("n"), input->GetColumnByName("i")},
+                        {input->GetColumnByName("s")},
+                        {{"hash_sum", nullptr}, {"hash_count", nullptr}}));
+  StructArray groups(grouped.array());
+  auto expected = Table::Make(
+      schema({field("hash_sum", int64()), field("hash_count", int64()),
+              field("s", utf8())}),
+      ArrayVector{groups.field(0), groups.field(1), groups.field(2)});
+
+  for (int64_t memory_limit : MemoryLimits()) {
+    SCOPED_TRACE("memory_limit = " + std::to_string(memory_limit));
+    SpillOptions spill_options;
+    spill_options.memory_limit = memory_limit;
+
+    ExecPlan plan(&ctx_);
+    ASSERT_OK_AND_ASSIGN(auto source, MakeTableSourceNode(&plan, input, 256));
+    ASSERT_OK_AND_ASSIGN(
+        auto group_by,
+        MakeGroupByNode(source, {{"hash_sum", nullptr}, {"hash_count", nullptr}},
+                        {"n", "i"}, {"s"}, spill_options));
+    std::shared_ptr<Table> out;
+    ASSERT_OK(MakeTableSinkNode(group_by, &out).status());
+    ASSERT_OK(plan.Run());
+
+    ASSERT_OK(out->ValidateFull());
+    AssertTablesEqual(*Sorted(expected), *Sorted(out), /*same_chunk_layout=*/false);
+  }
+}
+
+TEST_P(TestSpillingNodes, EmptyInput) {
+  auto input = MakeRandomInput(100);
+  for (int64_t memory_limit : MemoryLimits()) {
+    SpillOptions spill_options;
+    spill_options.memory_limit = memory_limit;
+
+    ExecPlan plan(&ctx_);
+    ASSERT_OK_AND_ASSIGN(auto source, MakeTableSourceNode(&plan, input));
+    ASSERT_OK_AND_ASSIGN(auto filter, MakeFilterNode(source, E::Literal(Datum(false))));
+    ASSERT_OK_AND_ASSIGN(
+        auto order_by,
+        MakeOrderByNode(filter, SortOptions({SortKey("i")}), spill_options));
+    ASSERT_OK_AND_ASSIGN(
+        auto group_by,
+        MakeGroupByNode(order_by, {{"hash_count", nullptr}}, {"n"}, {"i"},
+                        spill_options));
+    std::shared_ptr<Table> out;
+    ASSERT_OK(MakeTableSinkNode(group_by, &out).status());
+    ASSERT_OK(plan.Run());
+    ASSERT_EQ(0, out->num_rows());
+    ASSERT_EQ(2, out->num_columns());
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(SerialAndThreaded, TestExecPlan, ::testing::Values(false, true));
+INSTANTIATE_TEST_SUITE_P(SerialAndThreaded, TestSpillingNodes,
+                         ::testing::Values(false, true));
+
+TEST(ExecPlan, Errors) {
+  auto input = TableFromJSON(schema({field("i", int32())}), {"[[1]]"});
+
+  ExecPlan plan;
+  ASSERT_RAISES(Invalid, plan.Run());
+  ASSERT_OK_AND_ASSIGN(auto source, MakeTableSourceNode(&plan, input));
+  // Incomplete plan
+  ASSERT_RAISES(Invalid, plan.Run());
+
+  ASSERT_RAISES(Invalid, MakeFilterNode(source, E::Field("nonexistent")));
+  ASSERT_RAISES(TypeError, MakeFilterNode(source, E::Field("i")));
+  ASSERT_RAISES(Invalid, MakeProjectNode(source, {E::Field("i")}, {}));
+  ASSERT_RAISES(Invalid,
+                MakeProjectNode(source, {E::Call("sum", {E::Field("i")})}, {"sum"}));
+  ASSERT_RAISES(Invalid, MakeScalarAggregateNode(source, {{"add", nullptr}}, {"i"}));
+  ASSERT_RAISES(Invalid, MakeTableSourceNode(&plan, input, /*morsel_size=*/-1));
+  ASSERT_RAISES(Invalid, MakeOrderByNode(source, SortOptions()));
+  ASSERT_RAISES(Invalid, MakeOrderByNode(source, SortOptions({SortKey("j")})));
+  ASSERT_RAISES(Invalid, MakeGroupByNode(source, {{"hash_count", nullptr}}, {"i"}, {}));
+  ASSERT_RAISES(Invalid,
+                MakeGroupByNode(source, {{"count", nullptr}}, {"i"}, {"i"}));
+
+  std::shared_ptr<Table> out;
+  ASSERT_OK_AND_ASSIGN(auto sink, MakeTableSinkNode(source, &out));
+  // The source already has an output
+  ASSERT_RAISES(Invalid, MakeTableSinkNode(source, &out));
+  ASSERT_RAISES(Invalid, MakeFilterNode(sink, E::Literal(Datum(true))));
+
+  ASSERT_OK(plan.Run());
+  ASSERT_RAISES(Invalid, plan.Run());
+}
+
+TEST(ExecExpression, ToString) {
+  auto expr = E::Call("add", {E::Field("a"), E::Literal(Datum(3))});
+  ASSERT_EQ("add(a, 3)", expr.ToString());
+  ASSERT_FALSE(expr.is_bound());
+
+  ExecContext ctx;
+  ASSERT_OK(expr.Bind(*schema({field("a", int32())}), &ctx));
+  ASSERT_TRUE(expr.is_bound());
+  ASSERT_EQ(ValueDescr::Array(int32()), expr.descr());
+
+  ASSERT_RAISES(NotImplemented, expr.Bind(*schema({field("a", utf8())}), &ctx));
+}
+
+TEST(ExecExpression, Evaluate) {
+  ExecContext ctx;
+  auto schema_a = schema({field("a", int32())});
+  ExecBatch batch({ArrayFromJSON(int32(), "[1, null, 3]")}, 3);
+
+  auto expr = E::Call("add", {E::Field("a"), E::Literal(Datum(3))});
+  ASSERT_OK(expr.Bind(*schema_a, &ctx));
+  ASSERT_OK_AND_ASSIGN(Datum out, expr.Evaluate(batch, &ctx));
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[4, null, 6]"), out);
+  // Bound kernels are reused across batches
+  ASSERT_OK_AND_ASSIGN(out, expr.Evaluate(batch, &ctx));
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[4, null, 6]"), out);
+
+  auto scalar_expr = E::Call("add", {E::Literal(Datum(1)), E::Literal(Datum(2))});
+  ASSERT_OK(scalar_expr.Bind(*schema_a, &ctx));
+  ASSERT_EQ(ValueDescr::Scalar(int32()), scalar_expr.descr());
+  ASSERT_OK_AND_ASSIGN(out, scalar_expr.Evaluate(batch, &ctx));
+  AssertDatumsEqual(Datum(3), out);
+
+  // A kernel with state, the hash table of the value set
+  auto is_in_options = std::make_shared<SetLookupOptions>(
+      ArrayFromJSON(int32(), "[3, 1]"), /*skip_nulls=*/false);
+  auto is_in_expr = E::Call("is_in", {E::Field("a")}, is_in_options);
+  ASSERT_OK(is_in_expr.Bind(*schema_a, &ctx));
+  ASSERT_OK_AND_ASSIGN(out, is_in_expr.Evaluate(batch, &ctx));
+  AssertDatumsEqual(ArrayFromJSON(boolean(), "[true, null, true]"), out);
+}
+
+TEST(DefaultMorselSize, Basics) {
+  const int64_t narrow = DefaultMorselSize(*schema({field("a", int8())}));
+  const int64_t wide =
+      DefaultMorselSize(*schema({field("a", int64()), field("b", utf8())}));
+  ASSERT_GE(narrow, wide);
+  ASSERT_GE(wide, 1024);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -16,6 +16,7 @@
 // under the License.
 
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -39,6 +40,7 @@
 #include "arrow/type.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
+#include "arrow/util/cancel.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/logging.h"
@@ -46,6 +48,7 @@
 namespace arrow {
 
 using internal::checked_cast;
+using internal::checked_pointer_cast;
 
 namespace compute {
 namespace detail {
@@ -84,6 +87,29 @@ TEST(SelectionVector, Basics) {
   ASSERT_EQ(3, sel_vector->indices()[1]);
 }
 
+TEST(SelectionVector, FromMask) {
+  auto mask = checked_pointer_cast<BooleanArray>(
+      ArrayFromJSON(boolean(), "[true, false, null, true, true, false]"));
+  ASSERT_OK_AND_ASSIGN(auto sel_vector, SelectionVector::FromMask(*mask));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[0, 3, 4]"), *MakeArray(sel_vector->data()));
+
+  // Sliced mask
+  auto sliced = checked_pointer_cast<BooleanArray>(mask->Slice(1, 4));
+  ASSERT_OK_AND_ASSIGN(sel_vector, SelectionVector::FromMask(*sliced));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[2, 3]"), *MakeArray(sel_vector->data()));
+
+  // Long enough to have blocks which are entirely selected
+  auto rand = random::RandomArrayGenerator(/*seed=*/0);
+  auto random_mask = checked_pointer_cast<BooleanArray>(
+      rand.Boolean(1000, /*true_probability=*/0.9, /*null_probability=*/0.05));
+  ASSERT_OK_AND_ASSIGN(sel_vector, SelectionVector::FromMask(*random_mask));
+  ASSERT_EQ(random_mask->true_count(), sel_vector->length());
+  for (int32_t i = 0; i < sel_vector->length(); ++i) {
+    ASSERT_TRUE(random_mask->IsValid(sel_vector->indices()[i]));
+    ASSERT_TRUE(random_mask->Value(sel_vector->indices()[i]));
+  }
+}
+
 void AssertValidityZeroExtraBits(const ArrayData& arr) {
   const Buffer& buf = *arr.buffers[0];
 
@@ -791,6 +817,154 @@ TEST_F(TestCallScalarFunction, PreallocationCases) {
   CheckFunction("test_copy_computed_bitmap");
 }
 
+TEST_F(TestCallScalarFunction, ParallelExecution) {
+  // Large enough for the batches to be executed on the thread pool
+  auto arr = GetUInt8Array(1 << 18, /*null_probability=*/0.2);
+
+  auto CheckFunction = [&](std::string func_name) {
+    ResetContexts();
+    ASSERT_TRUE(exec_ctx_->use_threads());
+
+    // Byte-aligned splits of an array are written into one output
+    {
+      std::vector<Datum> args = {Datum(arr)};
+      exec_ctx_->set_exec_chunksize(1 << 15);
+      ASSERT_OK_AND_ASSIGN(Datum result, CallFunction(func_name, args, exec_ctx_.get()));
+      ASSERT_EQ(Datum::ARRAY, result.kind());
+      AssertArraysEqual(*arr, *result.make_array());
+    }
+
+    // Unaligned splits of an array are executed serially into one output
+    {
+      std::vector<Datum> args = {Datum(arr)};
+      exec_ctx_->set_exec_chunksize(50001);
+      ASSERT_OK_AND_ASSIGN(Datum result, CallFunction(func_name, args, exec_ctx_.get()));
+      ASSERT_EQ(Datum::ARRAY, result.kind());
+      AssertArraysEqual(*arr, *result.make_array());
+    }
+
+    // Unaligned chunks get their own outputs when executed on several threads
+    {
+      auto carr = std::make_shared<ChunkedArray>(ArrayVector{
+          arr->Slice(0, 50001), arr->Slice(50001, 100003), arr->Slice(150004)});
+      std::vector<Datum> args = {Datum(carr)};
+      exec_ctx_->set_exec_chunksize(std::numeric_limits<int64_t>::max());
+      ASSERT_OK_AND_ASSIGN(Datum result, CallFunction(func_name, args, exec_ctx_.get()));
+      AssertChunkedEquivalent(*carr, *result.chunked_array());
+    }
+  };
+
+  CheckFunction("test_copy");
+  CheckFunction("test_copy_computed_bitmap");
+}
+
+TEST_F(TestCallScalarFunction, StopToken) {
+  auto arr = GetUInt8Array(1 << 18, /*null_probability=*/0.2);
+  std::vector<Datum> args = {Datum(arr)};
+  StopSource stop_source;
+
+  for (bool use_threads : {false, true}) {
+    ResetContexts();
+    exec_ctx_->set_use_threads(use_threads);
+    exec_ctx_->set_exec_chunksize(1 << 15);
+    exec_ctx_->set_stop_token(stop_source.token());
+    ASSERT_OK(CallFunction("test_copy", args, exec_ctx_.get()));
+
+    stop_source.RequestStop();
+    ASSERT_RAISES(Cancelled, CallFunction("test_copy", args, exec_ctx_.get()));
+    stop_source.Reset();
+  }
+}
+
+TEST_F(TestCallScalarFunction, Statistics) {
+  auto registry = GetFunctionRegistry();
+  auto arr = GetUInt8Array(1000);
+  std::vector<Datum> args = {Datum(arr)};
+
+  // Not collected by default
+  ASSERT_OK(CallFunction("test_copy", args));
+  ASSERT_FALSE(registry->statistics_enabled());
+  ASSERT_EQ(registry->GetStatistics().size(), 0u);
+
+  registry->EnableStatistics(/*timing_interval=*/2);
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_OK(CallFunction("test_copy", args));
+  }
+  // Failed executions aren't counted
+  ASSERT_RAISES(NotImplemented,
+                CallFunction("test_copy", {ArrayFromJSON(int64(), "[1]")}));
+  registry->DisableStatistics();
+  ASSERT_OK(CallFunction("test_copy", args));
+
+  auto stats = registry->GetStatistics();
+  ASSERT_EQ(stats.size(), 1u);
+  ASSERT_EQ(stats[0].function_name, "test_copy");
+  ASSERT_EQ(stats[0].kernel_signature, "(array[uint8]) -> uint8");
+  ASSERT_EQ(stats[0].num_calls, 4);
+  ASSERT_EQ(stats[0].num_rows, 4000);
+  const auto& buffers = arr->data()->buffers;
+  ASSERT_EQ(stats[0].num_bytes, 4 * (buffers[0]->size() + buffers[1]->size()));
+  ASSERT_EQ(stats[0].num_timed_calls, 2);
+  ASSERT_GE(stats[0].timed_nanos, 0);
+
+  registry->ResetStatistics();
+  ASSERT_EQ(registry->GetStatistics().size(), 0u);
+}
+
+TEST_F(TestCallScalarFunction, PreallocatedOutput) {
+  auto arr = GetUInt8Array(1000, /*null_probability=*/0.2);
+  std::vector<Datum> args = {Datum(arr)};
+
+  auto CheckFunction = [&](std::string func_name) {
+    ResetContexts();
+
+    for (int64_t chunksize : {int64_t(1000), int64_t(111)}) {
+      exec_ctx_->set_exec_chunksize(chunksize);
+      ASSERT_OK_AND_ASSIGN(auto data, AllocateBuffer(1010));
+      // Write into a slice of a larger array, without a validity bitmap
+      auto out = ArrayData::Make(uint8(), 1000, {nullptr, std::move(data)},
+                                 /*null_count=*/0, /*offset=*/10);
+      ASSERT_OK(CallFunctionInto(func_name, args, /*options=*/nullptr, out,
+                                 exec_ctx_.get()));
+      ASSERT_NE(nullptr, out->buffers[0]);
+      AssertArraysEqual(*arr, *MakeArray(out));
+    }
+  };
+  CheckFunction("test_copy");
+  CheckFunction("test_copy_computed_bitmap");
+
+  ASSERT_OK_AND_ASSIGN(auto data, AllocateBuffer(1000));
+  auto out = ArrayData::Make(uint8(), 1000, {nullptr, std::move(data)});
+  ASSERT_RAISES(NotImplemented,
+                CallFunctionInto("test_nopre_data", args, /*options=*/nullptr, out));
+
+  auto wrong_type = ArrayData::Make(int8(), 1000, out->buffers);
+  ASSERT_RAISES(TypeError,
+                CallFunctionInto("test_copy", args, /*options=*/nullptr, wrong_type));
+  auto wrong_length = ArrayData::Make(uint8(), 999, out->buffers);
+  ASSERT_RAISES(Invalid,
+                CallFunctionInto("test_copy", args, /*options=*/nullptr, wrong_length));
+  auto short_data =
+      ArrayData::Make(uint8(), 1000, {nullptr, SliceBuffer(out->buffers[1], 0, 999)});
+  ASSERT_RAISES(Invalid,
+                CallFunctionInto("test_copy", args, /*options=*/nullptr, short_data));
+}
+
+TEST_F(TestCallScalarFunction, DonatedArgument) {
+  auto arr = GetInt32Array(1000, /*null_probability=*/0.2);
+  ASSERT_OK_AND_ASSIGN(auto copy, CallFunction("test_copy", {Datum(arr)}));
+  ExampleOptions options(std::make_shared<Int32Scalar>(1));
+
+  // The kernel does not declare that it can write in place, so the output is
+  // allocated
+  ASSERT_OK_AND_ASSIGN(Datum result,
+                       CallFunctionInPlace("test_stateful", {copy}, 0, &options));
+  ASSERT_NE(copy.array()->buffers[1], result.array()->buffers[1]);
+  AssertArraysEqual(*arr, *result.make_array());
+
+  ASSERT_RAISES(IndexError, CallFunctionInPlace("test_stateful", {copy}, 1, &options));
+}
+
 TEST_F(TestCallScalarFunction, BasicNonStandardCases) {
   // Test a handful of cases
   //
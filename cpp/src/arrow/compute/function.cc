@@ -24,7 +24,7 @@
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec_internal.h"
 #include "arrow/datum.h"
-#include "arrow/util/cpu_info.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace compute {
@@ -76,25 +76,13 @@ Result<const KernelType*> DispatchExactImpl(const Function& func,
     }
   }
 
-  // Dispatch as the CPU feature
-  auto cpu_info = arrow::internal::CpuInfo::GetInstance();
-#if defined(ARROW_HAVE_RUNTIME_AVX512)
-  if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX512)) {
-    if (kernel_matches[SimdLevel::AVX512]) {
-      return kernel_matches[SimdLevel::AVX512];
+  // The function only holds kernels which the CPU supports: use the most
+  // optimized one
+  for (int level = SimdLevel::MAX - 1; level >= SimdLevel::NONE; --level) {
+    if (kernel_matches[level]) {
+      return kernel_matches[level];
     }
   }
-#endif
-#if defined(ARROW_HAVE_RUNTIME_AVX2)
-  if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX2)) {
-    if (kernel_matches[SimdLevel::AVX2]) {
-      return kernel_matches[SimdLevel::AVX2];
-    }
-  }
-#endif
-  if (kernel_matches[SimdLevel::NONE]) {
-    return kernel_matches[SimdLevel::NONE];
-  }
 
   return Status::NotImplemented("Function ", func.name(),
                                 " has no kernel matching input types ",
@@ -103,26 +91,16 @@ Result<const KernelType*> DispatchExactImpl(const Function& func,
 
 Result<Datum> Function::Execute(const std::vector<Datum>& args,
                                 const FunctionOptions* options, ExecContext* ctx) const {
-  if (ctx == nullptr) {
-    ExecContext default_ctx;
-    return Execute(args, options, &default_ctx);
-  }
-  // type-check Datum arguments here. Really we'd like to avoid this as much as
-  // possible
-  RETURN_NOT_OK(detail::CheckAllValues(args));
-  ARROW_ASSIGN_OR_RAISE(auto executor,
-                        detail::FunctionExecutor::Make(ctx, this, options));
-  auto listener = std::make_shared<detail::DatumAccumulator>();
-  RETURN_NOT_OK(executor->Execute(args, listener.get()));
-  return executor->WrapResults(args, listener->values());
+  util::TraceSpan span("compute", name_.c_str());
+  return detail::ExecuteFunction(*this, args, options, ctx, /*out=*/nullptr);
 }
 
 Status ScalarFunction::AddKernel(std::vector<InputType> in_types, OutputType out_type,
                                  ArrayKernelExec exec, KernelInit init) {
   RETURN_NOT_OK(CheckArity(static_cast<int>(in_types.size())));
 
-  if (arity_.is_varargs && in_types.size() != 1) {
-    return Status::Invalid("VarArgs signatures must have exactly one input type");
+  if (arity_.is_varargs && in_types.empty()) {
+    return Status::Invalid("VarArgs signatures must have at least one input type");
   }
   auto sig =
       KernelSignature::Make(std::move(in_types), std::move(out_type), arity_.is_varargs);
@@ -135,6 +113,9 @@ Status ScalarFunction::AddKernel(ScalarKernel kernel) {
   if (arity_.is_varargs && !kernel.signature->is_varargs()) {
     return Status::Invalid("Function accepts varargs but kernel signature does not");
   }
+  if (!IsSimdLevelSupported(kernel.simd_level)) {
+    return Status::OK();
+  }
   kernels_.emplace_back(std::move(kernel));
   return Status::OK();
 }
@@ -148,8 +129,8 @@ Status VectorFunction::AddKernel(std::vector<InputType> in_types, OutputType out
                                  ArrayKernelExec exec, KernelInit init) {
   RETURN_NOT_OK(CheckArity(static_cast<int>(in_types.size())));
 
-  if (arity_.is_varargs && in_types.size() != 1) {
-    return Status::Invalid("VarArgs signatures must have exactly one input type");
+  if (arity_.is_varargs && in_types.empty()) {
+    return Status::Invalid("VarArgs signatures must have at least one input type");
   }
   auto sig =
       KernelSignature::Make(std::move(in_types), std::move(out_type), arity_.is_varargs);
@@ -162,6 +143,9 @@ Status VectorFunction::AddKernel(VectorKernel kernel) {
   if (arity_.is_varargs && !kernel.signature->is_varargs()) {
     return Status::Invalid("Function accepts varargs but kernel signature does not");
   }
+  if (!IsSimdLevelSupported(kernel.simd_level)) {
+    return Status::OK();
+  }
   kernels_.emplace_back(std::move(kernel));
   return Status::OK();
 }
@@ -176,6 +160,9 @@ Status ScalarAggregateFunction::AddKernel(ScalarAggregateKernel kernel) {
   if (arity_.is_varargs && !kernel.signature->is_varargs()) {
     return Status::Invalid("Function accepts varargs but kernel signature does not");
   }
+  if (!IsSimdLevelSupported(kernel.simd_level)) {
+    return Status::OK();
+  }
   kernels_.emplace_back(std::move(kernel));
   return Status::OK();
 }
@@ -185,6 +172,29 @@ Result<const ScalarAggregateKernel*> ScalarAggregateFunction::DispatchExact(
   return DispatchExactImpl(*this, kernels_, values);
 }
 
+Status HashAggregateFunction::AddKernel(HashAggregateKernel kernel) {
+  RETURN_NOT_OK(CheckArity(static_cast<int>(kernel.signature->in_types().size())));
+  if (arity_.is_varargs && !kernel.signature->is_varargs()) {
+    return Status::Invalid("Function accepts varargs but kernel signature does not");
+  }
+  if (!IsSimdLevelSupported(kernel.simd_level)) {
+    return Status::OK();
+  }
+  kernels_.emplace_back(std::move(kernel));
+  return Status::OK();
+}
+
+Result<const HashAggregateKernel*> HashAggregateFunction::DispatchExact(
+    const std::vector<ValueDescr>& values) const {
+  return DispatchExactImpl(*this, kernels_, values);
+}
+
+Result<Datum> HashAggregateFunction::Execute(const std::vector<Datum>& args,
+                                             const FunctionOptions* options,
+                                             ExecContext* ctx) const {
+  return Status::NotImplemented("Direct execution of HASH_AGGREGATE functions");
+}
+
 Result<Datum> MetaFunction::Execute(const std::vector<Datum>& args,
                                     const FunctionOptions* options,
                                     ExecContext* ctx) const {
@@ -99,6 +99,10 @@ class ARROW_EXPORT Function {
     /// A function that computes scalar summary statistics from array input.
     SCALAR_AGGREGATE,
 
+    /// A function that computes grouped summary statistics from array input
+    /// and an array of group identifiers.
+    HASH_AGGREGATE,
+
     /// A function that dispatches to other functions and does not contain its
     /// own kernels.
     META
@@ -200,7 +204,8 @@ class ARROW_EXPORT ScalarFunction : public detail::FunctionImpl<ScalarKernel> {
                    ArrayKernelExec exec, KernelInit init = NULLPTR);
 
   /// \brief Add a kernel (function implementation). Returns error if the
-  /// kernel's signature does not match the function's arity.
+  /// kernel's signature does not match the function's arity. The kernel is
+  /// ignored if the host CPU doesn't support its SIMD level.
   Status AddKernel(ScalarKernel kernel);
 
   /// \brief Return a kernel that can execute the function given the exact
@@ -231,7 +236,8 @@ class ARROW_EXPORT VectorFunction : public detail::FunctionImpl<VectorKernel> {
                    ArrayKernelExec exec, KernelInit init = NULLPTR);
 
   /// \brief Add a kernel (function implementation). Returns error if the
-  /// kernel's signature does not match the function's arity.
+  /// kernel's signature does not match the function's arity. The kernel is
+  /// ignored if the host CPU doesn't support its SIMD level.
   Status AddKernel(VectorKernel kernel);
 
   /// \brief Return a kernel that can execute the function given the exact
@@ -250,7 +256,8 @@ class ARROW_EXPORT ScalarAggregateFunction
             std::move(name), Function::SCALAR_AGGREGATE, arity, default_options) {}
 
   /// \brief Add a kernel (function implementation). Returns error if the
-  /// kernel's signature does not match the function's arity.
+  /// kernel's signature does not match the function's arity. The kernel is
+  /// ignored if the host CPU doesn't support its SIMD level.
   Status AddKernel(ScalarAggregateKernel kernel);
 
   /// \brief Return a kernel that can execute the function given the exact
@@ -259,6 +266,33 @@ class ARROW_EXPORT ScalarAggregateFunction
       const std::vector<ValueDescr>& values) const;
 };
 
+/// \brief A function that computes grouped summary statistics from array
+/// input and an array of uint32 group identifiers. These functions cannot be
+/// executed directly through Execute; use GroupBy (see api_aggregate.h).
+class ARROW_EXPORT HashAggregateFunction
+    : public detail::FunctionImpl<HashAggregateKernel> {
+ public:
+  using KernelType = HashAggregateKernel;
+
+  HashAggregateFunction(std::string name, const Arity& arity,
+                        const FunctionOptions* default_options = NULLPTR)
+      : detail::FunctionImpl<HashAggregateKernel>(
+            std::move(name), Function::HASH_AGGREGATE, arity, default_options) {}
+
+  /// \brief Add a kernel (function implementation). Returns error if the
+  /// kernel's signature does not match the function's arity. The kernel is
+  /// ignored if the host CPU doesn't support its SIMD level.
+  Status AddKernel(HashAggregateKernel kernel);
+
+  /// \brief Return a kernel that can execute the function given the exact
+  /// argument types (without implicit type casts or scalar->array promotions)
+  Result<const HashAggregateKernel*> DispatchExact(
+      const std::vector<ValueDescr>& values) const;
+
+  Result<Datum> Execute(const std::vector<Datum>& args, const FunctionOptions* options,
+                        ExecContext* ctx) const override;
+};
+
 /// \brief A function that dispatches to other functions. Must implement
 /// MetaFunction::ExecuteImpl.
 ///
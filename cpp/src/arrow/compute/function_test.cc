@@ -146,6 +146,30 @@ TEST(ScalarVectorFunction, DispatchExact) {
   CheckAddDispatch(&func2);
 }
 
+TEST(ScalarFunction, DispatchSimdLevel) {
+  ScalarFunction func("scalar_test", Arity::Unary());
+
+  ASSERT_OK(func.AddKernel({int32()}, int32(), ExecNYI));
+  int expected_num_kernels = 1;
+  SimdLevel::type expected_level = SimdLevel::NONE;
+  for (auto level : {SimdLevel::SSE4_2, SimdLevel::AVX2, SimdLevel::AVX512,
+                     SimdLevel::NEON}) {
+    ScalarKernel kernel({int32()}, int32(), ExecNYI);
+    kernel.simd_level = level;
+    ASSERT_OK(func.AddKernel(kernel));
+    // Kernels which the CPU can't run are dropped
+    if (IsSimdLevelSupported(level)) {
+      ++expected_num_kernels;
+      expected_level = level;
+    }
+  }
+  ASSERT_EQ(expected_num_kernels, func.num_kernels());
+
+  // The most optimized kernel is chosen
+  ASSERT_OK_AND_ASSIGN(const ScalarKernel* kernel, func.DispatchExact({int32()}));
+  ASSERT_EQ(expected_level, kernel->simd_level);
+}
+
 TEST(ArrayFunction, VarArgs) {
   ScalarFunction va_func("va_test", Arity::VarArgs(1));
 
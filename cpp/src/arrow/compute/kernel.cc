@@ -16,6 +16,7 @@
 // under the License.
 
 #include "arrow/compute/kernel.h"
+#include <algorithm>
 
 #include <cstddef>
 #include <memory>
@@ -29,6 +30,7 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/hash_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
@@ -415,8 +417,12 @@ bool KernelSignature::Equals(const KernelSignature& other) const {
 
 bool KernelSignature::MatchesInputs(const std::vector<ValueDescr>& args) const {
   if (is_varargs_) {
-    for (const auto& arg : args) {
-      if (!in_types_[0].Matches(arg)) {
+    // The last input type matches all the trailing arguments
+    if (args.size() + 1 < in_types_.size()) {
+      return false;
+    }
+    for (size_t i = 0; i < args.size(); ++i) {
+      if (!in_types_[std::min(i, in_types_.size() - 1)].Matches(args[i])) {
         return false;
       }
     }
@@ -449,7 +455,14 @@ std::string KernelSignature::ToString() const {
   std::stringstream ss;
 
   if (is_varargs_) {
-    ss << "varargs[" << in_types_[0].ToString() << "]";
+    ss << "varargs[";
+    for (size_t i = 0; i < in_types_.size(); ++i) {
+      if (i > 0) {
+        ss << ", ";
+      }
+      ss << in_types_[i].ToString();
+    }
+    ss << "]";
   } else {
     ss << "(";
     for (size_t i = 0; i < in_types_.size(); ++i) {
@@ -464,5 +477,29 @@ std::string KernelSignature::ToString() const {
   return ss.str();
 }
 
+// ----------------------------------------------------------------------
+// SimdLevel
+
+bool IsSimdLevelSupported(SimdLevel::type level) {
+  using arrow::internal::CpuInfo;
+  static const auto cpu_info = CpuInfo::GetInstance();
+  switch (level) {
+    case SimdLevel::NONE:
+      return true;
+    case SimdLevel::SSE4_2:
+      return cpu_info->IsSupported(CpuInfo::SSE4_2);
+    case SimdLevel::AVX:
+      return cpu_info->IsSupported(CpuInfo::AVX);
+    case SimdLevel::AVX2:
+      return cpu_info->IsSupported(CpuInfo::AVX2);
+    case SimdLevel::AVX512:
+      return cpu_info->IsSupported(CpuInfo::AVX512);
+    case SimdLevel::NEON:
+      return cpu_info->IsSupported(CpuInfo::ASIMD);
+    default:
+      return false;
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -392,7 +392,9 @@ class ARROW_EXPORT OutputType {
 /// \brief Holds the input types and output type of the kernel.
 ///
 /// VarArgs functions should pass a single input type to be used to validate
-/// the input types of a function invocation.
+/// the input types of a function invocation, optionally preceded by the input
+/// types of leading arguments. The last input type validates all the
+/// remaining arguments.
 class ARROW_EXPORT KernelSignature {
  public:
   KernelSignature(std::vector<InputType> in_types, OutputType out_type,
@@ -422,7 +424,8 @@ class ARROW_EXPORT KernelSignature {
 
   /// \brief The input types for the kernel. For VarArgs functions, this should
   /// generally contain a single validator to use for validating all of the
-  /// function arguments.
+  /// function arguments, or validators for leading arguments followed by one
+  /// for all the remaining arguments.
   const std::vector<InputType>& in_types() const { return in_types_; }
 
   /// \brief The output type for the kernel. Use Resolve to return the exact
@@ -451,6 +454,9 @@ struct SimdLevel {
   enum type { NONE = 0, SSE4_2, AVX, AVX2, AVX512, NEON, MAX };
 };
 
+/// \brief Whether the host CPU can run kernels of the given SIMD level
+ARROW_EXPORT bool IsSimdLevelSupported(SimdLevel::type level);
+
 /// \brief The strategy to use for propagating or otherwise populating the
 /// validity bitmap of a kernel output.
 struct NullHandling {
@@ -558,7 +564,18 @@ struct Kernel {
   /// required to use the function. The intention is for functions to be able to
   /// contain multiple kernels with the same signature but different levels of SIMD,
   /// so that the most optimized kernel supported on a host's processor can be chosen.
+  ///
+  /// Functions drop the kernels which the host CPU can't run when they are
+  /// added, so kernels of any level may be added unconditionally (provided
+  /// they were compiled in), and dispatch picks the highest level among the
+  /// kernels matching the arguments.
   SimdLevel::type simd_level = SimdLevel::NONE;
+
+  /// \brief Indicates whether the kernel can handle arguments whose buffers
+  /// are not CPU-addressable, e.g. CUDA device memory. Kernels which read
+  /// buffer contents on the host must leave this false, in which case the
+  /// executor rejects such arguments before dispatching to the kernel.
+  bool supports_device_memory = false;
 };
 
 /// \brief Common kernel base data structure for ScalarKernel and
@@ -600,6 +617,12 @@ struct ScalarKernel : public ArrayKernel {
   // bitmaps is a reasonable default
   NullHandling::type null_handling = NullHandling::INTERSECTION;
   MemAllocation::type mem_allocation = MemAllocation::PREALLOCATE;
+
+  /// Whether the kernel may write its preallocated output into the data
+  /// buffer of an argument of the same bit width, which requires that it reads
+  /// the argument values at each position before writing the output value
+  /// there. See CallFunctionInPlace.
+  bool can_write_in_place = false;
 };
 
 // ----------------------------------------------------------------------
@@ -701,5 +724,58 @@ struct ScalarAggregateKernel : public Kernel {
   ScalarAggregateFinalize finalize;
 };
 
+// ----------------------------------------------------------------------
+// HashAggregateKernel (for HashAggregateFunction)
+
+using HashAggregateResize = std::function<void(KernelContext*, int64_t)>;
+
+using HashAggregateConsume = std::function<void(KernelContext*, const ExecBatch&)>;
+
+using HashAggregateMerge =
+    std::function<void(KernelContext*, KernelState&&, const ArrayData&)>;
+
+using HashAggregateFinalize = std::function<void(KernelContext*, Datum*)>;
+
+/// \brief Kernel data structure for implementations of
+/// HashAggregateFunction. The five necessary components of a grouped
+/// aggregation kernel are the init, resize, consume, merge, and finalize
+/// functions.
+///
+/// * init: creates a new KernelState for a kernel.
+/// * resize: ensure that the KernelState can accommodate the specified number
+///   of groups.
+/// * consume: processes an ExecBatch (which includes the argument as well as
+///   an array of uint32 group ids) and updates the KernelState found in the
+///   KernelContext.
+/// * merge: combines one KernelState with another. The group ids of the other
+///   state are transposed into the group ids of the KernelState found in the
+///   KernelContext by the passed uint32 mapping array.
+/// * finalize: produces the end result of the aggregation (one value per
+///   group) using the KernelState in the KernelContext.
+struct HashAggregateKernel : public Kernel {
+  HashAggregateKernel() {}
+
+  HashAggregateKernel(std::shared_ptr<KernelSignature> sig, KernelInit init,
+                      HashAggregateResize resize, HashAggregateConsume consume,
+                      HashAggregateMerge merge, HashAggregateFinalize finalize)
+      : Kernel(std::move(sig), std::move(init)),
+        resize(std::move(resize)),
+        consume(std::move(consume)),
+        merge(std::move(merge)),
+        finalize(std::move(finalize)) {}
+
+  HashAggregateKernel(std::vector<InputType> in_types, OutputType out_type,
+                      KernelInit init, HashAggregateResize resize,
+                      HashAggregateConsume consume, HashAggregateMerge merge,
+                      HashAggregateFinalize finalize)
+      : HashAggregateKernel(KernelSignature::Make(std::move(in_types), out_type), init,
+                            resize, consume, merge, finalize) {}
+
+  HashAggregateResize resize;
+  HashAggregateConsume consume;
+  HashAggregateMerge merge;
+  HashAggregateFinalize finalize;
+};
+
 }  // namespace compute
 }  // namespace arrow
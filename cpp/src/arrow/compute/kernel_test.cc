@@ -470,6 +470,17 @@ TEST(KernelSignature, VarArgsMatchesInputs) {
   ASSERT_FALSE(sig.MatchesInputs(args));
 }
 
+TEST(KernelSignature, VarArgsWithLeadingTypes) {
+  KernelSignature sig({InputType(Type::STRUCT), int8()}, utf8(), /*is_varargs=*/true);
+
+  ASSERT_FALSE(sig.MatchesInputs({}));
+  ASSERT_TRUE(sig.MatchesInputs({struct_({})}));
+  ASSERT_TRUE(sig.MatchesInputs({struct_({}), int8(), ValueDescr::Scalar(int8())}));
+  ASSERT_FALSE(sig.MatchesInputs({int8(), int8()}));
+  ASSERT_FALSE(sig.MatchesInputs({struct_({}), int8(), struct_({})}));
+  ASSERT_EQ("varargs[any[Type::STRUCT], any[int8]] -> string", sig.ToString());
+}
+
 TEST(KernelSignature, ToString) {
   std::vector<InputType> in_types = {InputType(int8(), ValueDescr::SCALAR),
                                      InputType(Type::DECIMAL, ValueDescr::ARRAY),
@@ -0,0 +1,264 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Approximate aggregates whose state has a bounded size, whatever the
+// input size: approximate_count_distinct (HyperLogLog) and
+// approximate_quantile (t-digest)
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "arrow/builder.h"
+#include "arrow/compute/kernels/aggregate_basic_internal.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/hyperloglog.h"
+#include "arrow/util/tdigest.h"
+
+namespace arrow {
+namespace compute {
+namespace aggregate {
+
+namespace {
+
+using arrow::internal::HyperLogLog;
+using arrow::internal::MixHash64;
+using arrow::internal::TDigest;
+
+// ----------------------------------------------------------------------
+// Approximate count distinct
+
+// Hash fixed-width values by their bit pattern, after making equal
+// floating-point values (all NaNs, -0.0 and 0.0) bitwise identical
+template <typename CType>
+enable_if_t<std::is_floating_point<CType>::value, uint64_t> HashValue(CType value) {
+  if (std::isnan(value)) {
+    value = std::numeric_limits<CType>::quiet_NaN();
+  } else if (value == 0) {
+    value = 0;
+  }
+  uint64_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(value));
+  return MixHash64(bits);
+}
+
+template <typename CType>
+enable_if_t<std::is_integral<CType>::value, uint64_t> HashValue(CType value) {
+  return MixHash64(static_cast<uint64_t>(value));
+}
+
+inline uint64_t HashValue(util::string_view value) {
+  return MixHash64(arrow::internal::ComputeStringHash<0>(
+      value.data(), static_cast<int64_t>(value.size())));
+}
+
+template <typename ArrowType>
+struct CountDistinctImpl : public ScalarAggregator {
+  using ThisType = CountDistinctImpl<ArrowType>;
+
+  explicit CountDistinctImpl(HyperLogLog sketch) : sketch(std::move(sketch)) {}
+
+  void Consume(KernelContext*, const ExecBatch& batch) override {
+    VisitArrayDataInline<ArrowType>(
+        *batch[0].array(),
+        [&](typename internal::GetViewType<ArrowType>::T value) {
+          sketch.Add(HashValue(value));
+        },
+        [] {});
+  }
+
+  void MergeFrom(KernelContext* ctx, const KernelState& src) override {
+    const auto& other = checked_cast<const ThisType&>(src);
+    ctx->SetStatus(sketch.Merge(other.sketch));
+  }
+
+  void Finalize(KernelContext*, Datum* out) override {
+    out->value = std::make_shared<Int64Scalar>(std::llround(sketch.Estimate()));
+  }
+
+  HyperLogLog sketch;
+};
+
+struct CountDistinctInitState {
+  std::unique_ptr<KernelState> state;
+  KernelContext* ctx;
+  const DataType& in_type;
+  const ApproximateCountDistinctOptions& options;
+
+  CountDistinctInitState(KernelContext* ctx, const DataType& in_type,
+                         const ApproximateCountDistinctOptions& options)
+      : ctx(ctx), in_type(in_type), options(options) {}
+
+  Status Visit(const DataType&) {
+    return Status::NotImplemented("No approximate count distinct implemented");
+  }
+
+  Status Visit(const HalfFloatType&) {
+    return Status::NotImplemented("No approximate count distinct implemented");
+  }
+
+  template <typename Type>
+  enable_if_t<is_number_type<Type>::value || is_boolean_type<Type>::value ||
+                  is_base_binary_type<Type>::value,
+              Status>
+  Visit(const Type&) {
+    ARROW_ASSIGN_OR_RAISE(auto sketch, HyperLogLog::Make(options.precision));
+    state.reset(new CountDistinctImpl<Type>(std::move(sketch)));
+    return Status::OK();
+  }
+
+  std::unique_ptr<KernelState> Create() {
+    ctx->SetStatus(VisitTypeInline(in_type, this));
+    return std::move(state);
+  }
+};
+
+std::unique_ptr<KernelState> CountDistinctInit(KernelContext* ctx,
+                                               const KernelInitArgs& args) {
+  CountDistinctInitState visitor(
+      ctx, *args.inputs[0].type,
+      static_cast<const ApproximateCountDistinctOptions&>(*args.options));
+  return visitor.Create();
+}
+
+// ----------------------------------------------------------------------
+// Approximate quantile
+
+template <typename ArrowType>
+struct QuantileImpl : public ScalarAggregator {
+  using ThisType = QuantileImpl<ArrowType>;
+  using CType = typename ArrowType::c_type;
+
+  explicit QuantileImpl(const ApproximateQuantileOptions& options)
+      : options(options), digest(options.delta, options.buffer_size) {}
+
+  void Consume(KernelContext*, const ExecBatch& batch) override {
+    VisitArrayDataInline<ArrowType>(
+        *batch[0].array(),
+        [&](CType value) {
+          const auto v = static_cast<double>(value);
+          if (!std::isnan(v)) {
+            digest.Add(v);
+          }
+        },
+        [] {});
+  }
+
+  void MergeFrom(KernelContext*, const KernelState& src) override {
+    const auto& other = checked_cast<const ThisType&>(src);
+    digest.Merge(other.digest);
+  }
+
+  void Finalize(KernelContext* ctx, Datum* out) override {
+    DoubleBuilder builder(ctx->memory_pool());
+    KERNEL_RETURN_IF_ERROR(ctx,
+                           builder.Reserve(static_cast<int64_t>(options.q.size())));
+    for (double q : options.q) {
+      if (digest.is_empty()) {
+        builder.UnsafeAppendNull();
+      } else {
+        builder.UnsafeAppend(digest.Quantile(q));
+      }
+    }
+    std::shared_ptr<ArrayData> result;
+    KERNEL_RETURN_IF_ERROR(ctx, builder.FinishInternal(&result));
+    out->value = std::move(result);
+  }
+
+  ApproximateQuantileOptions options;
+  TDigest digest;
+};
+
+struct QuantileInitState {
+  std::unique_ptr<KernelState> state;
+  KernelContext* ctx;
+  const DataType& in_type;
+  const ApproximateQuantileOptions& options;
+
+  QuantileInitState(KernelContext* ctx, const DataType& in_type,
+                    const ApproximateQuantileOptions& options)
+      : ctx(ctx), in_type(in_type), options(options) {}
+
+  Status Visit(const DataType&) {
+    return Status::NotImplemented("No approximate quantile implemented");
+  }
+
+  Status Visit(const HalfFloatType&) {
+    return Status::NotImplemented("No approximate quantile implemented");
+  }
+
+  template <typename Type>
+  enable_if_t<is_number_type<Type>::value, Status> Visit(const Type&) {
+    for (double q : options.q) {
+      if (!(q >= 0 && q <= 1)) {
+        return Status::Invalid("Quantile must be between 0 and 1, got ", q);
+      }
+    }
+    state.reset(new QuantileImpl<Type>(options));
+    return Status::OK();
+  }
+
+  std::unique_ptr<KernelState> Create() {
+    ctx->SetStatus(VisitTypeInline(in_type, this));
+    return std::move(state);
+  }
+};
+
+std::unique_ptr<KernelState> QuantileInit(KernelContext* ctx,
+                                          const KernelInitArgs& args) {
+  QuantileInitState visitor(
+      ctx, *args.inputs[0].type,
+      static_cast<const ApproximateQuantileOptions&>(*args.options));
+  return visitor.Create();
+}
+
+}  // namespace
+
+std::shared_ptr<ScalarAggregateFunction> AddApproximateCountDistinctAggKernels() {
+  static auto default_options = ApproximateCountDistinctOptions::Defaults();
+  auto func = std::make_shared<ScalarAggregateFunction>(
+      "approximate_count_distinct", Arity::Unary(), &default_options);
+  auto add_kernels = [&](const std::vector<std::shared_ptr<DataType>>& types) {
+    for (const auto& ty : types) {
+      // array[T] -> scalar[int64]
+      auto sig =
+          KernelSignature::Make({InputType::Array(ty)}, ValueDescr::Scalar(int64()));
+      AddAggKernel(std::move(sig), CountDistinctInit, func.get());
+    }
+  };
+  add_kernels({boolean()});
+  add_kernels(internal::NumericTypes());
+  add_kernels(internal::BaseBinaryTypes());
+  return func;
+}
+
+std::shared_ptr<ScalarAggregateFunction> AddApproximateQuantileAggKernels() {
+  static auto default_options = ApproximateQuantileOptions::Defaults();
+  auto func = std::make_shared<ScalarAggregateFunction>(
+      "approximate_quantile", Arity::Unary(), &default_options);
+  for (const auto& ty : internal::NumericTypes()) {
+    // array[T] -> array[float64], one value per requested quantile
+    auto sig =
+        KernelSignature::Make({InputType::Array(ty)}, ValueDescr::Array(float64()));
+    AddAggKernel(std::move(sig), QuantileInit, func.get());
+  }
+  return func;
+}
+
+}  // namespace aggregate
+}  // namespace compute
+}  // namespace arrow
@@ -15,11 +15,13 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+
+#include "arrow/array/run_end_internal.h"
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/kernels/aggregate_basic_internal.h"
 #include "arrow/compute/kernels/aggregate_internal.h"
 #include "arrow/compute/kernels/common.h"
-#include "arrow/util/cpu_info.h"
 #include "arrow/util/make_unique.h"
 
 namespace arrow {
@@ -127,6 +129,160 @@ std::unique_ptr<KernelState> MeanInit(KernelContext* ctx, const KernelInitArgs&
   return visitor.Create();
 }
 
+// ----------------------------------------------------------------------
+// Run-end encoded sum implementation
+
+// Each run contributes its value times its length, so the values are only read
+// once per run
+template <typename ArrowType>
+struct RunEndEncodedSumImpl : public ScalarAggregator {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using SumType = typename FindAccumulatorType<ArrowType>::Type;
+  using SumCType = typename SumType::c_type;
+  using OutputType = typename TypeTraits<SumType>::ScalarType;
+  using ThisType = RunEndEncodedSumImpl<ArrowType>;
+
+  void Consume(KernelContext* ctx, const ExecBatch& batch) override {
+    const ArrayData& data = *batch[0].array();
+    const ArrayType values(data.child_data[1]);
+    KERNEL_RETURN_IF_ERROR(
+        ctx, ::arrow::internal::VisitRuns(
+                 data, [&](int64_t physical_index, int64_t, int64_t run_length) {
+                   if (values.IsValid(physical_index)) {
+                     sum.Add(static_cast<SumCType>(values.Value(physical_index)) *
+                             static_cast<SumCType>(run_length));
+                     count += run_length;
+                   }
+                   return Status::OK();
+                 }));
+  }
+
+  void MergeFrom(KernelContext*, const KernelState& src) override {
+    const auto& other = checked_cast<const ThisType&>(src);
+    count += other.count;
+    sum.Add(other.sum);
+  }
+
+  void Finalize(KernelContext*, Datum* out) override {
+    if (count == 0) {
+      out->value = std::make_shared<OutputType>();
+    } else {
+      out->value = MakeScalar(sum.value());
+    }
+  }
+
+  int64_t count = 0;
+  CompensatedSum<SumCType> sum;
+};
+
+std::unique_ptr<KernelState> RunEndEncodedSumInit(KernelContext* ctx,
+                                                  const KernelInitArgs& args) {
+  const auto& ree_type = checked_cast<const RunEndEncodedType&>(*args.inputs[0].type);
+  SumLikeInit<RunEndEncodedSumImpl> visitor(ctx, *ree_type.value_type());
+  return visitor.Create();
+}
+
+Result<ValueDescr> RunEndEncodedSumType(KernelContext*,
+                                        const std::vector<ValueDescr>& args) {
+  const auto& ree_type = checked_cast<const RunEndEncodedType&>(*args[0].type);
+  switch (ree_type.value_type()->id()) {
+    case Type::UINT8:
+    case Type::UINT16:
+    case Type::UINT32:
+    case Type::UINT64:
+      return ValueDescr::Scalar(uint64());
+    case Type::HALF_FLOAT:
+    case Type::FLOAT:
+    case Type::DOUBLE:
+      return ValueDescr::Scalar(float64());
+    default:
+      return ValueDescr::Scalar(int64());
+  }
+}
+
+// ----------------------------------------------------------------------
+// Decimal sum implementation
+
+// Decimals are summed to the maximum precision at the input's scale. Values of
+// precision 17 or less are first added in 64-bit integers, per run of 64 values,
+// which cannot overflow, and only the run sums are added to the Decimal128 total.
+struct DecimalSumImpl : public ScalarAggregator {
+  static constexpr int32_t kMaxRunSumPrecision = 17;
+  static constexpr int64_t kRunLength = 64;
+
+  explicit DecimalSumImpl(std::shared_ptr<DataType> out_type)
+      : out_type(std::move(out_type)) {}
+
+  void Consume(KernelContext*, const ExecBatch& batch) override {
+    const ArrayData& input = *batch[0].array();
+    const auto& type = checked_cast<const Decimal128Type&>(*input.type);
+    const internal::DecimalValues values(batch[0]);
+    count += input.length - input.GetNullCount();
+
+    if (type.precision() > kMaxRunSumPrecision) {
+      VisitBitBlocksVoid(
+          input.buffers[0], input.offset, input.length,
+          [&](int64_t i) { sum += values.Read(i); }, [] {});
+      return;
+    }
+
+    const uint8_t* bitmap = input.buffers[0] ? input.buffers[0]->data() : NULLPTR;
+    OptionalBitBlockCounter bit_counter(bitmap, input.offset, input.length);
+    int64_t position = 0;
+    while (position < input.length) {
+      const BitBlockCount block = bit_counter.NextBlock();
+      if (block.AllSet()) {
+        for (int64_t run = 0; run < block.length; run += kRunLength) {
+          const int64_t run_end = std::min<int64_t>(block.length, run + kRunLength);
+          int64_t run_sum = 0;
+          for (int64_t i = position + run; i < position + run_end; ++i) {
+            run_sum += values.ReadInt64(i);
+          }
+          sum += Decimal128(run_sum);
+        }
+      } else if (!block.NoneSet()) {
+        // Mixed blocks are at most 64 values long
+        int64_t run_sum = 0;
+        for (int64_t i = position; i < position + block.length; ++i) {
+          if (BitUtil::GetBit(bitmap, input.offset + i)) {
+            run_sum += values.ReadInt64(i);
+          }
+        }
+        sum += Decimal128(run_sum);
+      }
+      position += block.length;
+    }
+  }
+
+  void MergeFrom(KernelContext*, const KernelState& src) override {
+    const auto& other = checked_cast<const DecimalSumImpl&>(src);
+    count += other.count;
+    sum += other.sum;
+  }
+
+  void Finalize(KernelContext*, Datum* out) override {
+    if (count == 0) {
+      out->value = MakeNullScalar(out_type);
+    } else {
+      out->value = std::make_shared<Decimal128Scalar>(sum, out_type);
+    }
+  }
+
+  std::shared_ptr<DataType> out_type;
+  int64_t count = 0;
+  Decimal128 sum;
+};
+
+Result<ValueDescr> DecimalSumType(KernelContext*, const std::vector<ValueDescr>& args) {
+  const auto& type = checked_cast<const Decimal128Type&>(*args[0].type);
+  return ValueDescr::Scalar(decimal(38, type.scale()));
+}
+
+std::unique_ptr<KernelState> DecimalSumInit(KernelContext*, const KernelInitArgs& args) {
+  const auto& type = checked_cast<const Decimal128Type&>(*args.inputs[0].type);
+  return ::arrow::internal::make_unique<DecimalSumImpl>(decimal(38, type.scale()));
+}
+
 // ----------------------------------------------------------------------
 // MinMax implementation
 
@@ -190,17 +346,19 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
                                 func.get());
   aggregate::AddBasicAggKernels(aggregate::SumInit, FloatingPointTypes(), float64(),
                                 func.get());
+  aggregate::AddAggKernel(KernelSignature::Make({InputType::Array(Type::DECIMAL)},
+                                                OutputType(aggregate::DecimalSumType)),
+                          aggregate::DecimalSumInit, func.get());
+  aggregate::AddAggKernel(
+      KernelSignature::Make({InputType::Array(Type::RUN_END_ENCODED)},
+                            OutputType(aggregate::RunEndEncodedSumType)),
+      aggregate::RunEndEncodedSumInit, func.get());
   // Add the SIMD variants for sum
-  auto cpu_info = arrow::internal::CpuInfo::GetInstance();
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
-  if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX2)) {
-    aggregate::AddSumAvx2AggKernels(func.get());
-  }
+  aggregate::AddSumAvx2AggKernels(func.get());
 #endif
 #if defined(ARROW_HAVE_RUNTIME_AVX512)
-  if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX512)) {
-    aggregate::AddSumAvx512AggKernels(func.get());
-  }
+  aggregate::AddSumAvx512AggKernels(func.get());
 #endif
   DCHECK_OK(registry->AddFunction(std::move(func)));
 
@@ -210,14 +368,10 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
                                 func.get());
   // Add the SIMD variants for mean
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
-  if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX2)) {
-    aggregate::AddMeanAvx2AggKernels(func.get());
-  }
+  aggregate::AddMeanAvx2AggKernels(func.get());
 #endif
 #if defined(ARROW_HAVE_RUNTIME_AVX512)
-  if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX512)) {
-    aggregate::AddMeanAvx512AggKernels(func.get());
-  }
+  aggregate::AddMeanAvx512AggKernels(func.get());
 #endif
   DCHECK_OK(registry->AddFunction(std::move(func)));
 
@@ -228,19 +382,19 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   aggregate::AddMinMaxKernels(aggregate::MinMaxInit, NumericTypes(), func.get());
   // Add the SIMD variants for min max
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
-  if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX2)) {
-    aggregate::AddMinMaxAvx2AggKernels(func.get());
-  }
+  aggregate::AddMinMaxAvx2AggKernels(func.get());
 #endif
 #if defined(ARROW_HAVE_RUNTIME_AVX512)
-  if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX512)) {
-    aggregate::AddMinMaxAvx512AggKernels(func.get());
-  }
+  aggregate::AddMinMaxAvx512AggKernels(func.get());
 #endif
 
   DCHECK_OK(registry->AddFunction(std::move(func)));
 
   DCHECK_OK(registry->AddFunction(aggregate::AddModeAggKernels()));
+  DCHECK_OK(registry->AddFunction(aggregate::AddQuantileAggKernels()));
+  DCHECK_OK(registry->AddFunction(aggregate::AddMedianAggKernels()));
+  DCHECK_OK(registry->AddFunction(aggregate::AddApproximateCountDistinctAggKernels()));
+  DCHECK_OK(registry->AddFunction(aggregate::AddApproximateQuantileAggKernels()));
 }
 
 }  // namespace internal
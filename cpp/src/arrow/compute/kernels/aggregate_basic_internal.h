@@ -17,7 +17,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <type_traits>
 
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/kernels/aggregate_internal.h"
@@ -59,47 +62,131 @@ void AddMeanAvx512AggKernels(ScalarAggregateFunction* func);
 void AddMinMaxAvx512AggKernels(ScalarAggregateFunction* func);
 
 std::shared_ptr<ScalarAggregateFunction> AddModeAggKernels();
+std::shared_ptr<ScalarAggregateFunction> AddQuantileAggKernels();
+std::shared_ptr<ScalarAggregateFunction> AddMedianAggKernels();
+std::shared_ptr<ScalarAggregateFunction> AddApproximateCountDistinctAggKernels();
+std::shared_ptr<ScalarAggregateFunction> AddApproximateQuantileAggKernels();
 
 // ----------------------------------------------------------------------
 // Sum implementation
 
+// Combines the sums of blocks of values in a binary tree (pairwise
+// summation), so that the rounding error of a floating point sum grows with
+// the logarithm of the number of blocks rather than linearly
+template <typename SumCType>
+class PairwiseSum {
+ public:
+  void Add(SumCType block_sum) {
+    // levels_[i] holds a pending sum of 2^i blocks if bit i of mask_ is set,
+    // so adding a block carries like incrementing a binary counter
+    int level = 0;
+    uint64_t level_mask = 1;
+    levels_[0] += block_sum;
+    mask_ ^= level_mask;
+    while ((mask_ & level_mask) == 0) {
+      block_sum = levels_[level];
+      levels_[level] = 0;
+      ++level;
+      level_mask <<= 1;
+      levels_[level] += block_sum;
+      mask_ ^= level_mask;
+    }
+    root_level_ = std::max(root_level_, level);
+  }
+
+  SumCType Finish() const {
+    SumCType sum = 0;
+    for (int level = 0; level <= root_level_; ++level) {
+      sum += levels_[level];
+    }
+    return sum;
+  }
+
+ private:
+  SumCType levels_[64] = {};
+  uint64_t mask_ = 0;
+  int root_level_ = 0;
+};
+
+// A running sum of partial sums, i.e. of the sums of arrays and of merged
+// states. Floating point partial sums are added with Neumaier's variant of
+// Kahan summation, which keeps the rounding error in a compensation term
+template <typename SumCType, typename Enable = void>
+struct CompensatedSum {
+  void Add(SumCType value) { sum += value; }
+  void Add(const CompensatedSum& other) { sum += other.sum; }
+  SumCType value() const { return sum; }
+
+  SumCType sum = 0;
+};
+
+template <typename SumCType>
+struct CompensatedSum<SumCType, enable_if_t<std::is_floating_point<SumCType>::value>> {
+  void Add(SumCType value) {
+    const SumCType t = sum + value;
+    if (std::abs(sum) >= std::abs(value)) {
+      compensation += (sum - t) + value;
+    } else {
+      compensation += (value - t) + sum;
+    }
+    sum = t;
+  }
+
+  void Add(const CompensatedSum& other) {
+    Add(other.sum);
+    compensation += other.compensation;
+  }
+
+  // The compensation is meaningless once the sum is infinite or NaN
+  SumCType value() const { return std::isfinite(sum) ? sum + compensation : sum; }
+
+  SumCType sum = 0;
+  SumCType compensation = 0;
+};
+
 template <int64_t kRoundSize, typename ArrowType, SimdLevel::type SimdLevel>
 struct SumState {
   using SumType = typename FindAccumulatorType<ArrowType>::Type;
+  using SumCType = typename SumType::c_type;
   using ThisType = SumState<kRoundSize, ArrowType, SimdLevel>;
   using T = typename TypeTraits<ArrowType>::CType;
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
 
-  ThisType operator+(const ThisType& rhs) const {
-    return ThisType(this->count + rhs.count, this->sum + rhs.sum);
-  }
-
   ThisType& operator+=(const ThisType& rhs) {
     this->count += rhs.count;
-    this->sum += rhs.sum;
-
+    this->sum.Add(rhs.sum);
     return *this;
   }
 
  public:
   void Consume(const Array& input) {
     const ArrayType& array = static_cast<const ArrayType&>(input);
+    PairwiseSum<SumCType> blocks;
     if (input.null_count() == 0) {
-      (*this) += ConsumeNoNulls(array);
+      SumNoNulls<kRoundSize>(array.raw_values(), array.length(), &blocks);
+      count += array.length();
     } else {
-      (*this) += ConsumeWithNulls(array);
+      count += SumWithNulls(array, &blocks);
     }
+    sum.Add(blocks.Finish());
   }
 
+  SumCType total() const { return sum.value(); }
+
   size_t count = 0;
-  typename SumType::c_type sum = 0;
+  CompensatedSum<SumCType> sum;
 
  private:
+  // Number of values added to each of the independent accumulators before
+  // the block sum is passed to the pairwise tree
+  static constexpr int64_t kValuesPerAccumulator = 16;
+
+  // Sum a block of values with independent accumulators, which the compiler
+  // maps to SIMD lanes, then reduce the accumulators pairwise
   template <int64_t kNoNullsRoundSize>
-  ThisType ConsumeNoNulls(const T* values, const int64_t length) const {
-    ThisType local;
+  static SumCType SumBlock(const T* values, const int64_t length) {
     const int64_t length_rounded = BitUtil::RoundDown(length, kNoNullsRoundSize);
-    typename SumType::c_type sum_rounded[kNoNullsRoundSize] = {0};
+    SumCType sum_rounded[kNoNullsRoundSize] = {0};
 
     // Unroll the loop to add the results in parallel
     for (int64_t i = 0; i < length_rounded; i += kNoNullsRoundSize) {
@@ -107,53 +194,57 @@ struct SumState {
         sum_rounded[k] += values[i + k];
       }
     }
-    for (int64_t k = 0; k < kNoNullsRoundSize; k++) {
-      local.sum += sum_rounded[k];
-    }
-
     // The trailing part
     for (int64_t i = length_rounded; i < length; ++i) {
-      local.sum += values[i];
+      sum_rounded[i - length_rounded] += values[i];
     }
 
-    local.count = length;
-    return local;
+    for (int64_t width = kNoNullsRoundSize / 2; width > 0; width /= 2) {
+      for (int64_t k = 0; k < width; k++) {
+        sum_rounded[k] += sum_rounded[k + width];
+      }
+    }
+    return sum_rounded[0];
   }
 
-  ThisType ConsumeNoNulls(const ArrayType& array) const {
-    const auto values = array.raw_values();
-    const int64_t length = array.length();
-
-    return ConsumeNoNulls<kRoundSize>(values, length);
+  template <int64_t kNoNullsRoundSize>
+  static void SumNoNulls(const T* values, int64_t length,
+                         PairwiseSum<SumCType>* blocks) {
+    constexpr int64_t kBlockSize = kNoNullsRoundSize * kValuesPerAccumulator;
+    for (; length >= kBlockSize; values += kBlockSize, length -= kBlockSize) {
+      blocks->Add(SumBlock<kNoNullsRoundSize>(values, kBlockSize));
+    }
+    if (length > 0) {
+      blocks->Add(SumBlock<kNoNullsRoundSize>(values, length));
+    }
   }
 
   // While this is not branchless, gcc needs this to be in a different function
   // for it to generate cmov which tends to be slightly faster than
   // multiplication but safe for handling NaN with doubles.
-  inline T MaskedValue(bool valid, T value) const { return valid ? value : 0; }
+  static inline T MaskedValue(bool valid, T value) { return valid ? value : 0; }
 
-  inline ThisType UnrolledSum(uint8_t bits, const T* values) const {
-    ThisType local;
+  static inline SumCType UnrolledSum(uint8_t bits, const T* values) {
+    SumCType local = 0;
 
     if (bits < 0xFF) {
       // Some nulls
       for (size_t i = 0; i < 8; i++) {
-        local.sum += MaskedValue(bits & (1U << i), values[i]);
+        local += MaskedValue(bits & (1U << i), values[i]);
       }
-      local.count += BitUtil::kBytePopcount[bits];
     } else {
       // No nulls
       for (size_t i = 0; i < 8; i++) {
-        local.sum += values[i];
+        local += values[i];
       }
-      local.count += 8;
     }
 
     return local;
   }
 
-  ThisType ConsumeWithNulls(const ArrayType& array) const {
-    ThisType local;
+  // Sum the valid values into the pairwise tree and return their count
+  static int64_t SumWithNulls(const ArrayType& array, PairwiseSum<SumCType>* blocks) {
+    int64_t valid_count = 0;
     const T* values = array.raw_values();
     const int64_t length = array.length();
     int64_t offset = array.offset();
@@ -163,13 +254,17 @@ struct SumState {
     const auto p = arrow::internal::BitmapWordAlign<1>(bitmap, offset, length);
     // First handle the leading bits
     const int64_t leading_bits = p.leading_bits;
-    while (idx < leading_bits) {
-      if (BitUtil::GetBit(bitmap, offset)) {
-        local.sum += values[idx];
-        local.count++;
+    if (leading_bits > 0) {
+      SumCType leading_sum = 0;
+      while (idx < leading_bits) {
+        if (BitUtil::GetBit(bitmap, offset)) {
+          leading_sum += values[idx];
+          valid_count++;
+        }
+        idx++;
+        offset++;
       }
-      idx++;
-      offset++;
+      blocks->Add(leading_sum);
     }
 
     // The aligned parts scanned with BitBlockCounter
@@ -178,7 +273,7 @@ struct SumState {
     auto current_block = data_counter.NextWord();
     while (idx < length) {
       if (current_block.AllSet()) {  // All true values
-        int run_length = 0;
+        int64_t run_length = 0;
         // Scan forward until a block that has some false values (or the end)
         while (current_block.length > 0 && current_block.AllSet()) {
           run_length += current_block.length;
@@ -186,44 +281,39 @@ struct SumState {
         }
         // Aggregate the no nulls parts
         if (run_length >= kRoundSize * 8) {
-          local += ConsumeNoNulls<kRoundSize>(&values[idx], run_length);
+          SumNoNulls<kRoundSize>(&values[idx], run_length, blocks);
         } else {
-          local += ConsumeNoNulls<8>(&values[idx], run_length);
+          SumNoNulls<8>(&values[idx], run_length, blocks);
         }
+        valid_count += run_length;
         idx += run_length;
         offset += run_length;
         // The current_block already computed, advance to next loop
         continue;
       } else if (!current_block.NoneSet()) {  // Some values are null
-        const int64_t idx_byte = BitUtil::BytesForBits(offset);
-        const uint8_t* aligned_bitmap = &bitmap[idx_byte];
-        const T* aligned_values = &values[idx];
-
+        SumCType block_sum = 0;
         if (kBatchSize == current_block.length) {
+          const uint8_t* aligned_bitmap = &bitmap[BitUtil::BytesForBits(offset)];
+          const T* aligned_values = &values[idx];
           for (int64_t i = 0; i < kBatchSize / 8; i++) {
-            local += UnrolledSum(aligned_bitmap[i], &aligned_values[i * 8]);
+            block_sum += UnrolledSum(aligned_bitmap[i], &aligned_values[i * 8]);
           }
         } else {  // The end part
           for (int64_t i = 0; i < current_block.length; i++) {
-            if (BitUtil::GetBit(bitmap, offset)) {
-              local.sum += values[idx];
-              local.count++;
+            if (BitUtil::GetBit(bitmap, offset + i)) {
+              block_sum += values[idx + i];
             }
-            idx++;
-            offset++;
           }
         }
-
-        idx += current_block.length;
-        offset += current_block.length;
-      } else {  // All null values
-        idx += current_block.length;
-        offset += current_block.length;
+        blocks->Add(block_sum);
+        valid_count += current_block.popcount;
       }
+      idx += current_block.length;
+      offset += current_block.length;
       current_block = data_counter.NextWord();
     }
 
-    return local;
+    return valid_count;
   }
 };
 
@@ -245,6 +335,8 @@ struct SumState<kRoundSize, BooleanType, SimdLevel> {
     sum += array.true_count();
   }
 
+  typename SumType::c_type total() const { return sum; }
+
   size_t count = 0;
   typename SumType::c_type sum = 0;
 };
@@ -269,7 +361,7 @@ struct SumImpl : public ScalarAggregator {
     if (state.count == 0) {
       out->value = std::make_shared<OutputType>();
     } else {
-      out->value = MakeScalar(state.sum);
+      out->value = MakeScalar(state.total());
     }
   }
 
@@ -281,7 +373,7 @@ struct MeanImpl : public SumImpl<kRoundSize, ArrowType, SimdLevel> {
   void Finalize(KernelContext*, Datum* out) override {
     const bool is_valid = this->state.count > 0;
     const double divisor = static_cast<double>(is_valid ? this->state.count : 1UL);
-    const double mean = static_cast<double>(this->state.sum) / divisor;
+    const double mean = static_cast<double>(this->state.total()) / divisor;
 
     if (!is_valid) {
       out->value = std::make_shared<DoubleScalar>();
@@ -330,6 +330,57 @@ SUM_KERNEL_BENCHMARK(SumKernelInt16, Int16Type);
 SUM_KERNEL_BENCHMARK(SumKernelInt32, Int32Type);
 SUM_KERNEL_BENCHMARK(SumKernelInt64, Int64Type);
 
+// Decimals of precision 8 are summed in 64-bit integers, decimals of precision
+// 20 in Decimal128
+template <int32_t kPrecision>
+static void SumKernelDecimal(benchmark::State& state) {
+  RegressionArgs args(state);
+  const int64_t array_size = args.size / 16;
+  auto rand = random::RandomArrayGenerator(1923);
+  auto array = Cast(*rand.Float64(array_size, -1000, 1000, args.null_proportion),
+                    decimal(kPrecision, 2), CastOptions::Unsafe())
+                   .ValueOrDie();
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(Sum(array).status());
+  }
+}
+
+BENCHMARK_TEMPLATE(SumKernelDecimal, 8)->Apply(SumKernelArgs);
+BENCHMARK_TEMPLATE(SumKernelDecimal, 20)->Apply(SumKernelArgs);
+
+// Compare the accuracy of the kernel with a naive running sum, next to its
+// throughput
+static void SumKernelDoubleAccuracy(benchmark::State& state) {
+  RegressionArgs args(state);
+  const int64_t array_size = args.size / sizeof(double);
+  auto rand = random::RandomArrayGenerator(1923);
+  auto array = rand.Float64(array_size, 0, 1e6, args.null_proportion);
+
+  const auto& values = static_cast<const DoubleArray&>(*array);
+  long double reference = 0;
+  double naive = 0;
+  for (int64_t i = 0; i < values.length(); ++i) {
+    if (values.IsValid(i)) {
+      reference += values.Value(i);
+      naive += values.Value(i);
+    }
+  }
+
+  double result = 0;
+  for (auto _ : state) {
+    ASSIGN_OR_ABORT(Datum sum, Sum(array));
+    result = sum.scalar_as<DoubleScalar>().value;
+  }
+  auto RelativeError = [&](double sum) {
+    return static_cast<double>(std::abs((sum - reference) / reference));
+  };
+  state.counters["kernel_error"] = RelativeError(result);
+  state.counters["naive_error"] = RelativeError(naive);
+}
+
+BENCHMARK(SumKernelDoubleAccuracy)->Apply(SumKernelArgs);
+
 template <typename ArrowType>
 void ModeKernelBench(benchmark::State& state) {
   using CType = typename TypeTraits<ArrowType>::CType;
@@ -0,0 +1,219 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+#include "arrow/builder.h"
+#include "arrow/compute/kernels/aggregate_basic_internal.h"
+
+namespace arrow {
+namespace compute {
+namespace aggregate {
+
+namespace {
+
+template <typename ArrowType>
+struct QuantileImpl : public ScalarAggregator {
+  using ThisType = QuantileImpl<ArrowType>;
+  using CType = typename ArrowType::c_type;
+
+  QuantileImpl(const QuantileOptions& options, bool scalar_output)
+      : options(options), scalar_output(scalar_output) {}
+
+  // Chunks are only copied into the selection buffer, never concatenated
+  void Consume(KernelContext*, const ExecBatch& batch) override {
+    const ArrayData& data = *batch[0].array();
+    values.reserve(values.size() + data.length - data.GetNullCount());
+    VisitArrayDataInline<ArrowType>(
+        data,
+        [&](CType value) {
+          if (!std::isnan(static_cast<double>(value))) {
+            values.push_back(value);
+          }
+        },
+        [] {});
+  }
+
+  void MergeFrom(KernelContext*, const KernelState& src) override {
+    const auto& other = checked_cast<const ThisType&>(src);
+    values.insert(values.end(), other.values.begin(), other.values.end());
+  }
+
+  void Finalize(KernelContext* ctx, Datum* out) override {
+    std::vector<double> quantiles;
+    if (!values.empty()) {
+      quantiles = ComputeQuantiles();
+    }
+    if (scalar_output) {
+      out->value = values.empty() ? std::make_shared<DoubleScalar>()
+                                  : std::make_shared<DoubleScalar>(quantiles[0]);
+      return;
+    }
+    DoubleBuilder builder(ctx->memory_pool());
+    if (values.empty()) {
+      KERNEL_RETURN_IF_ERROR(ctx,
+                             builder.AppendNulls(static_cast<int64_t>(options.q.size())));
+    } else {
+      KERNEL_RETURN_IF_ERROR(ctx, builder.AppendValues(quantiles));
+    }
+    std::shared_ptr<ArrayData> result;
+    KERNEL_RETURN_IF_ERROR(ctx, builder.FinishInternal(&result));
+    out->value = std::move(result);
+  }
+
+  // Select the values around each quantile in ascending order of position,
+  // so that each selection only partitions the values not below the
+  // previous one
+  std::vector<double> ComputeQuantiles() {
+    const auto n = static_cast<int64_t>(values.size());
+    std::vector<size_t> order(options.q.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+              [&](size_t l, size_t r) { return options.q[l] < options.q[r]; });
+
+    std::vector<double> quantiles(options.q.size());
+    auto begin = values.begin();
+    for (size_t i : order) {
+      const double position = options.q[i] * static_cast<double>(n - 1);
+      const auto lower_index = static_cast<int64_t>(std::floor(position));
+      const double fraction = position - static_cast<double>(lower_index);
+
+      auto lower = values.begin() + lower_index;
+      std::nth_element(begin, lower, values.end());
+      begin = lower;
+      const auto lower_value = static_cast<double>(*lower);
+      if (fraction == 0) {
+        quantiles[i] = lower_value;
+        continue;
+      }
+      // The next value in sorted order is the smallest one after the lower
+      const auto upper_value =
+          static_cast<double>(*std::min_element(lower + 1, values.end()));
+      quantiles[i] = Interpolate(lower_value, upper_value, lower_index, fraction);
+    }
+    return quantiles;
+  }
+
+  double Interpolate(double lower_value, double upper_value, int64_t lower_index,
+                     double fraction) const {
+    switch (options.interpolation) {
+      case QuantileOptions::LOWER:
+        return lower_value;
+      case QuantileOptions::HIGHER:
+        return upper_value;
+      case QuantileOptions::NEAREST:
+        // Round half to even, like NumPy
+        if (fraction == 0.5) {
+          return lower_index % 2 == 0 ? lower_value : upper_value;
+        }
+        return fraction < 0.5 ? lower_value : upper_value;
+      case QuantileOptions::MIDPOINT:
+        return lower_value / 2 + upper_value / 2;
+      case QuantileOptions::LINEAR:
+      default:
+        return lower_value + (upper_value - lower_value) * fraction;
+    }
+  }
+
+  QuantileOptions options;
+  bool scalar_output;
+  std::vector<CType> values;
+};
+
+struct QuantileInitState {
+  std::unique_ptr<KernelState> state;
+  KernelContext* ctx;
+  const DataType& in_type;
+  const QuantileOptions& options;
+  bool scalar_output;
+
+  QuantileInitState(KernelContext* ctx, const DataType& in_type,
+                    const QuantileOptions& options, bool scalar_output)
+      : ctx(ctx), in_type(in_type), options(options), scalar_output(scalar_output) {}
+
+  Status Visit(const DataType&) {
+    return Status::NotImplemented("No quantile implemented");
+  }
+
+  Status Visit(const HalfFloatType&) {
+    return Status::NotImplemented("No quantile implemented");
+  }
+
+  template <typename Type>
+  enable_if_t<is_number_type<Type>::value, Status> Visit(const Type&) {
+    for (double q : options.q) {
+      if (!(q >= 0 && q <= 1)) {
+        return Status::Invalid("Quantile must be between 0 and 1, got ", q);
+      }
+    }
+    state.reset(new QuantileImpl<Type>(options, scalar_output));
+    return Status::OK();
+  }
+
+  std::unique_ptr<KernelState> Create() {
+    ctx->SetStatus(VisitTypeInline(in_type, this));
+    return std::move(state);
+  }
+};
+
+std::unique_ptr<KernelState> QuantileInit(KernelContext* ctx,
+                                          const KernelInitArgs& args) {
+  QuantileInitState visitor(ctx, *args.inputs[0].type,
+                            static_cast<const QuantileOptions&>(*args.options),
+                            /*scalar_output=*/false);
+  return visitor.Create();
+}
+
+std::unique_ptr<KernelState> MedianInit(KernelContext* ctx, const KernelInitArgs& args) {
+  static const auto median_options = QuantileOptions::Defaults();
+  QuantileInitState visitor(ctx, *args.inputs[0].type, median_options,
+                            /*scalar_output=*/true);
+  return visitor.Create();
+}
+
+}  // namespace
+
+std::shared_ptr<ScalarAggregateFunction> AddQuantileAggKernels() {
+  static auto default_options = QuantileOptions::Defaults();
+  auto func = std::make_shared<ScalarAggregateFunction>("quantile", Arity::Unary(),
+                                                        &default_options);
+  for (const auto& ty : internal::NumericTypes()) {
+    // array[T] -> array[float64], one value per requested quantile
+    auto sig =
+        KernelSignature::Make({InputType::Array(ty)}, ValueDescr::Array(float64()));
+    AddAggKernel(std::move(sig), QuantileInit, func.get());
+  }
+  return func;
+}
+
+std::shared_ptr<ScalarAggregateFunction> AddMedianAggKernels() {
+  auto func = std::make_shared<ScalarAggregateFunction>("median", Arity::Unary());
+  for (const auto& ty : internal::NumericTypes()) {
+    // array[T] -> scalar[float64]
+    auto sig =
+        KernelSignature::Make({InputType::Array(ty)}, ValueDescr::Scalar(float64()));
+    AddAggKernel(std::move(sig), MedianInit, func.get());
+  }
+  return func;
+}
+
+}  // namespace aggregate
+}  // namespace compute
+}  // namespace arrow
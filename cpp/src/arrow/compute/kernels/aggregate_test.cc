@@ -16,10 +16,12 @@
 // under the License.
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 #include <gtest/gtest.h>
@@ -263,6 +265,86 @@ TYPED_TEST(TestRandomNumericSumKernel, RandomSliceArraySum) {
   }
 }
 
+TEST(TestSumKernel, ParallelChunks) {
+  // Large enough for the chunks to be consumed on the thread pool
+  auto rand = random::RandomArrayGenerator(0x5487655);
+  auto array = rand.Int64(1 << 18, -1000, 1000, /*null_probability=*/0.1);
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{array->Slice(0, 70001), array->Slice(70001, 100000),
+                  array->Slice(170001)});
+  const Datum expected = NaiveSum<Int64Type>(*array);
+
+  ExecContext ctx;
+  ASSERT_TRUE(ctx.use_threads());
+  ASSERT_OK_AND_ASSIGN(Datum result, Sum(chunked, &ctx));
+  AssertDatumsEqual(expected, result);
+
+  ctx.set_exec_chunksize(1 << 14);
+  ASSERT_OK_AND_ASSIGN(result, Sum(chunked, &ctx));
+  AssertDatumsEqual(expected, result);
+
+  ctx.set_use_threads(false);
+  ASSERT_OK_AND_ASSIGN(result, Sum(chunked, &ctx));
+  AssertDatumsEqual(expected, result);
+}
+
+TEST(TestSumKernel, Decimal) {
+  // Precision 17 or less is summed in 64-bit integers
+  auto array = ArrayFromJSON(decimal(5, 2), R"(["1.23", "-4.50", null, "999.99"])");
+  AssertDatumsEqual(Datum(std::make_shared<Decimal128Scalar>(Decimal128(99672),
+                                                             decimal(38, 2))),
+                    Sum(array).ValueOrDie());
+
+  auto rand = random::RandomArrayGenerator(0x5ec1a1);
+  auto values = rand.Int64(1000, -999999999999999999LL, 999999999999999999LL,
+                           /*null_probability=*/0.1);
+  const auto& int_values = checked_cast<const Int64Array&>(*values);
+  for (int32_t precision : {17, 18}) {
+    Decimal128Builder builder(decimal(precision, 3));
+    Decimal128 expected;
+    for (int64_t i = 0; i < int_values.length(); ++i) {
+      if (int_values.IsNull(i)) {
+        ASSERT_OK(builder.AppendNull());
+      } else {
+        // Keep the values within the precision
+        const int64_t value = int_values.Value(i) / (precision == 17 ? 10 : 1);
+        ASSERT_OK(builder.Append(Decimal128(value)));
+        expected += Decimal128(value);
+      }
+    }
+    std::shared_ptr<Array> decimals;
+    ASSERT_OK(builder.Finish(&decimals));
+    AssertDatumsEqual(
+        Datum(std::make_shared<Decimal128Scalar>(expected, decimal(38, 3))),
+        Sum(decimals).ValueOrDie());
+  }
+
+  AssertDatumsEqual(Datum(MakeNullScalar(decimal(38, 2))),
+                    Sum(ArrayFromJSON(decimal(5, 2), "[null, null]")).ValueOrDie());
+}
+
+TEST(TestSumKernel, FloatingPointAccuracy) {
+  // A naive running sum is off by about 1e-6 here
+  ASSERT_OK_AND_ASSIGN(auto values, MakeArrayFromScalar(DoubleScalar(0.1), 1 << 20));
+  ASSERT_OK_AND_ASSIGN(Datum result, Sum(values));
+  ASSERT_NEAR(0.1 * (1 << 20), checked_cast<const DoubleScalar&>(*result.scalar()).value,
+              1e-8);
+
+  // The sums of chunks are added with error compensation
+  auto chunked = ChunkedArrayFromJSON(float64(), {"[1e16]", "[1]", "[1]", "[-1e16]"});
+  ASSERT_OK_AND_ASSIGN(result, Sum(chunked));
+  AssertDatumsEqual(Datum(2.0), result);
+  ASSERT_OK_AND_ASSIGN(result, Mean(chunked));
+  AssertDatumsEqual(Datum(0.5), result);
+
+  ASSERT_OK_AND_ASSIGN(auto infinity,
+                       MakeArrayFromScalar(DoubleScalar(INFINITY), /*length=*/1));
+  chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{infinity, ArrayFromJSON(float64(), "[1, 2]")});
+  ASSERT_OK_AND_ASSIGN(result, Sum(chunked));
+  AssertDatumsEqual(Datum(INFINITY), result);
+}
+
 //
 // Count
 //
@@ -914,5 +996,202 @@ TEST_F(TestInt32ModeKernel, LargeValueRange) {
   CheckModeWithRange<ArrowType>(-10000000, 10000000);
 }
 
+//
+// Quantile
+//
+
+class TestQuantileKernel : public ::testing::Test {
+ public:
+  void AssertQuantilesAre(const Datum& input, QuantileOptions options,
+                          const std::string& expected) {
+    ASSERT_OK_AND_ASSIGN(Datum out, Quantile(input, options));
+    AssertArraysEqual(*ArrayFromJSON(float64(), expected), *out.make_array(),
+                      /*verbose=*/true);
+  }
+
+  void AssertMedianIs(const Datum& input, const std::shared_ptr<Scalar>& expected) {
+    ASSERT_OK_AND_ASSIGN(Datum out, Median(input));
+    AssertScalarsEqual(*expected, *out.scalar(), /*verbose=*/true);
+  }
+};
+
+TEST_F(TestQuantileKernel, Interpolation) {
+  auto input = ArrayFromJSON(int64(), "[4, null, 1, 2, 3, 5]");
+  const std::vector<double> q = {0.375, 0, 0.5, 0.625, 1};
+  AssertQuantilesAre(input, QuantileOptions(q, QuantileOptions::LINEAR),
+                     "[2.5, 1, 3, 3.5, 5]");
+  AssertQuantilesAre(input, QuantileOptions(q, QuantileOptions::LOWER),
+                     "[2, 1, 3, 3, 5]");
+  AssertQuantilesAre(input, QuantileOptions(q, QuantileOptions::HIGHER),
+                     "[3, 1, 3, 4, 5]");
+  // Ties go to the value at the even position
+  AssertQuantilesAre(input, QuantileOptions(q, QuantileOptions::NEAREST),
+                     "[3, 1, 3, 3, 5]");
+  AssertQuantilesAre(input, QuantileOptions(q, QuantileOptions::MIDPOINT),
+                     "[2.5, 1, 3, 3.5, 5]");
+}
+
+TEST_F(TestQuantileKernel, ChunkedAndNaN) {
+  auto input = ChunkedArrayFromJSON(float64(), {"[3.5, NaN]", "[]", "[null, 0.5, 1.5]"});
+  AssertQuantilesAre(input, QuantileOptions({0.25, 0.75}), "[1, 2.5]");
+  AssertMedianIs(input, std::make_shared<DoubleScalar>(1.5));
+
+  input = ChunkedArrayFromJSON(uint8(), {"[200, 100]", "[255, 0]"});
+  AssertMedianIs(input, std::make_shared<DoubleScalar>(150));
+}
+
+TEST_F(TestQuantileKernel, Empty) {
+  AssertQuantilesAre(ArrayFromJSON(int32(), "[]"), QuantileOptions({0.5, 1}),
+                     "[null, null]");
+  AssertQuantilesAre(ArrayFromJSON(float32(), "[null, NaN]"), QuantileOptions(),
+                     "[null]");
+  AssertMedianIs(ArrayFromJSON(int8(), "[null]"), std::make_shared<DoubleScalar>());
+}
+
+TEST_F(TestQuantileKernel, InvalidOptions) {
+  auto input = ArrayFromJSON(int32(), "[1, 2]");
+  ASSERT_RAISES(Invalid, Quantile(input, QuantileOptions({-0.1})));
+  ASSERT_RAISES(Invalid, Quantile(input, QuantileOptions({0.5, 1.1})));
+  ASSERT_RAISES(NotImplemented, Quantile(ArrayFromJSON(utf8(), R"(["a"])")));
+}
+
+TEST_F(TestQuantileKernel, Random) {
+  auto rand = random::RandomArrayGenerator(0x5487657);
+  auto array = rand.Int32(10000, -100, 100, /*null_probability=*/0.1);
+  std::vector<double> sorted;
+  const auto& values = checked_cast<const Int32Array&>(*array);
+  for (int64_t i = 0; i < values.length(); ++i) {
+    if (values.IsValid(i)) {
+      sorted.push_back(values.Value(i));
+    }
+  }
+  std::sort(sorted.begin(), sorted.end());
+
+  const std::vector<double> q = {0.9, 0.1, 0.5, 0.001, 0.999};
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{array->Slice(0, 3333), array->Slice(3333, 1), array->Slice(3334)});
+  for (auto interpolation : {QuantileOptions::LOWER, QuantileOptions::LINEAR}) {
+    ASSERT_OK_AND_ASSIGN(Datum out, Quantile(chunked, QuantileOptions(q, interpolation)));
+    const auto& quantiles = checked_cast<const DoubleArray&>(*out.make_array());
+    for (size_t i = 0; i < q.size(); ++i) {
+      const double position = q[i] * (sorted.size() - 1);
+      const auto lower = static_cast<size_t>(position);
+      double expected = sorted[lower];
+      if (interpolation == QuantileOptions::LINEAR && lower + 1 < sorted.size()) {
+        expected += (sorted[lower + 1] - sorted[lower]) * (position - lower);
+      }
+      ASSERT_EQ(expected, quantiles.Value(i)) << "quantile " << q[i];
+    }
+  }
+}
+
+//
+// Approximate count distinct
+//
+
+TEST(TestApproximateCountDistinctKernel, Basics) {
+  auto check = [](const Datum& input, int64_t expected) {
+    ASSERT_OK_AND_ASSIGN(Datum out, ApproximateCountDistinct(input));
+    AssertScalarsEqual(Int64Scalar(expected), *out.scalar(), /*verbose=*/true);
+  };
+  check(ArrayFromJSON(int32(), "[1, 2, 2, null, 3, 1]"), 3);
+  check(ArrayFromJSON(int32(), "[]"), 0);
+  check(ArrayFromJSON(int32(), "[null, null]"), 0);
+  check(ArrayFromJSON(boolean(), "[true, false, true, null]"), 2);
+  check(ArrayFromJSON(uint8(), "[255, 0, 255]"), 2);
+  check(ChunkedArrayFromJSON(utf8(), {R"(["a", "b"])", R"(["b", null, ""])"}), 3);
+  check(ArrayFromJSON(large_binary(), R"(["a", "aa", "a"])"), 2);
+
+  // All NaNs are one value, and so are 0.0 and -0.0
+  std::shared_ptr<Array> floats;
+  ArrayFromVector<DoubleType>({0.0, -0.0, std::nan(""), -std::nan(""), 1.5}, &floats);
+  check(floats, 3);
+
+  ApproximateCountDistinctOptions options(/*precision=*/2);
+  ASSERT_RAISES(Invalid,
+                ApproximateCountDistinct(ArrayFromJSON(int32(), "[1]"), options));
+}
+
+TEST(TestApproximateCountDistinctKernel, Random) {
+  auto rand = random::RandomArrayGenerator(0x5487655);
+  auto array = rand.Int64(200000, 0, 60000, /*null_probability=*/0.1);
+  std::unordered_set<int64_t> distinct;
+  const auto& values = checked_cast<const Int64Array&>(*array);
+  for (int64_t i = 0; i < values.length(); ++i) {
+    if (values.IsValid(i)) {
+      distinct.insert(values.Value(i));
+    }
+  }
+  const auto expected = static_cast<double>(distinct.size());
+
+  for (int precision : {10, 14}) {
+    // Allow four standard errors
+    const double tolerance = 4 * 1.04 / std::sqrt(double(1 << precision));
+    ApproximateCountDistinctOptions options(precision);
+    ASSERT_OK_AND_ASSIGN(Datum out, ApproximateCountDistinct(array, options));
+    auto estimate = checked_cast<const Int64Scalar&>(*out.scalar()).value;
+    ASSERT_NEAR(1.0, estimate / expected, tolerance);
+
+    // Partial sketches of the chunks merge to the sketch of the whole
+    auto chunked = std::make_shared<ChunkedArray>(ArrayVector{
+        array->Slice(0, 70001), array->Slice(70001, 30000), array->Slice(100001)});
+    ASSERT_OK_AND_ASSIGN(out, ApproximateCountDistinct(chunked, options));
+    ASSERT_EQ(estimate, checked_cast<const Int64Scalar&>(*out.scalar()).value);
+  }
+}
+
+//
+// Approximate quantile
+//
+
+TEST(TestApproximateQuantileKernel, Basics) {
+  auto check = [](const Datum& input, std::vector<double> q,
+                  const std::string& expected) {
+    ASSERT_OK_AND_ASSIGN(Datum out,
+                         ApproximateQuantile(input, ApproximateQuantileOptions(q)));
+    AssertArraysEqual(*ArrayFromJSON(float64(), expected), *out.make_array(),
+                      /*verbose=*/true);
+  };
+  check(ArrayFromJSON(int32(), "[5, 1, null, 4, 2, 3]"), {0, 0.5, 1}, "[1, 3, 5]");
+  check(ChunkedArrayFromJSON(float32(), {"[2.5, NaN]", "[0.5, null]"}), {0.5, 1},
+        "[1.5, 2.5]");
+  check(ArrayFromJSON(uint64(), "[]"), {0.5}, "[null]");
+  check(ArrayFromJSON(float64(), "[null, NaN]"), {0.1, 0.9}, "[null, null]");
+
+  ASSERT_RAISES(Invalid, ApproximateQuantile(ArrayFromJSON(int32(), "[1]"),
+                                             ApproximateQuantileOptions({1.5})));
+  ASSERT_RAISES(NotImplemented, ApproximateQuantile(ArrayFromJSON(utf8(), R"(["a"])")));
+}
+
+TEST(TestApproximateQuantileKernel, Random) {
+  auto rand = random::RandomArrayGenerator(0x5487656);
+  auto array = rand.Float64(100000, -1000, 1000, /*null_probability=*/0.1);
+  std::vector<double> sorted;
+  const auto& values = checked_cast<const DoubleArray&>(*array);
+  for (int64_t i = 0; i < values.length(); ++i) {
+    if (values.IsValid(i)) {
+      sorted.push_back(values.Value(i));
+    }
+  }
+  std::sort(sorted.begin(), sorted.end());
+
+  const std::vector<double> q = {0, 0.01, 0.1, 0.5, 0.9, 0.99, 1};
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{array->Slice(0, 30000), array->Slice(30000, 1), array->Slice(30001)});
+  for (const Datum& input : {Datum(array), Datum(chunked)}) {
+    ASSERT_OK_AND_ASSIGN(Datum out,
+                         ApproximateQuantile(input, ApproximateQuantileOptions(q)));
+    const auto& estimates = checked_cast<const DoubleArray&>(*out.make_array());
+    ASSERT_EQ(static_cast<int64_t>(q.size()), estimates.length());
+    for (size_t i = 0; i < q.size(); ++i) {
+      // Check the rank error of the estimate
+      const auto rank = std::lower_bound(sorted.begin(), sorted.end(),
+                                         estimates.Value(i)) -
+                        sorted.begin();
+      ASSERT_NEAR(q[i], static_cast<double>(rank) / sorted.size(), 0.005);
+    }
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,60 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/array_base.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+// Map a logical row index to the chunk holding it and the index within that
+// chunk.  Lookups tend to hit the same chunk repeatedly (sorted or clustered
+// indices), so the last chunk found is checked before falling back to a
+// binary search over the chunk boundaries.
+class ChunkResolver {
+ public:
+  explicit ChunkResolver(const ArrayVector& chunks) : offsets_(chunks.size() + 1, 0) {
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      offsets_[i + 1] = offsets_[i] + chunks[i]->length();
+    }
+  }
+
+  std::pair<int64_t, int64_t> Resolve(int64_t index) const {
+    if (index < offsets_[cached_chunk_] || index >= offsets_[cached_chunk_ + 1]) {
+      cached_chunk_ = static_cast<int64_t>(std::upper_bound(offsets_.begin(),
+                                                            offsets_.end(), index) -
+                                           offsets_.begin()) -
+                      1;
+    }
+    return {cached_chunk_, index - offsets_[cached_chunk_]};
+  }
+
+ private:
+  std::vector<int64_t> offsets_;
+  mutable int64_t cached_chunk_ = 0;
+};
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -17,12 +17,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/binary_view_internal.h"
 #include "arrow/array/builder_binary.h"
 #include "arrow/array/data.h"
 #include "arrow/buffer.h"
@@ -57,6 +59,8 @@ using internal::BitmapReader;
 using internal::checked_cast;
 using internal::FirstTimeBitmapWriter;
 using internal::GenerateBitsUnrolled;
+using internal::OptionalBinaryBitBlockCounter;
+using internal::OptionalBitBlockCounter;
 using internal::VisitBitBlocksVoid;
 using internal::VisitTwoBitBlocksVoid;
 
@@ -149,6 +153,15 @@ struct GetViewType<Type, enable_if_t<is_base_binary_type<Type>::value ||
   static T LogicalValue(PhysicalType value) { return value; }
 };
 
+// Binary views are compared on their inline prefix before their bytes
+template <typename Type>
+struct GetViewType<Type, enable_if_binary_view<Type>> {
+  using T = ::arrow::internal::ComparableBinaryView;
+  using PhysicalType = util::string_view;
+
+  static T LogicalValue(PhysicalType value) { return T(value); }
+};
+
 template <>
 struct GetViewType<Decimal128Type> {
   using T = Decimal128;
@@ -196,6 +209,7 @@ struct ArrayIterator<Type, enable_if_has_c_type_not_boolean<Type>> {
 
   explicit ArrayIterator(const ArrayData& data) : values(data.GetValues<T>(1)) {}
   T operator()() { return *values++; }
+  void Skip(int64_t length) { values += length; }
 };
 
 template <typename Type>
@@ -209,6 +223,11 @@ struct ArrayIterator<Type, enable_if_boolean<Type>> {
     reader.Next();
     return out;
   }
+  void Skip(int64_t length) {
+    for (int64_t i = 0; i < length; ++i) {
+      reader.Next();
+    }
+  }
 };
 
 template <typename Type>
@@ -234,6 +253,53 @@ struct ArrayIterator<Type, enable_if_base_binary<Type>> {
     cur_offset = next_offset;
     return result;
   }
+  void Skip(int64_t length) {
+    position += length;
+    cur_offset = offsets[position];
+  }
+};
+
+template <typename Type>
+struct ArrayIterator<Type, enable_if_binary_view<Type>> {
+  using View = ::arrow::internal::BinaryView;
+  const View* views;
+  const std::shared_ptr<Buffer>* data_buffers;
+  int32_t num_data_buffers;
+
+  explicit ArrayIterator(const ArrayData& arr)
+      : views(arr.GetValues<View>(1)),
+        data_buffers(arr.buffers.data() + 2),
+        num_data_buffers(static_cast<int32_t>(arr.buffers.size() - 2)) {}
+
+  ::arrow::internal::ComparableBinaryView operator()() {
+    const View& view = *views++;
+    // Null slots may hold arbitrary views which must not be dereferenced
+    if (ARROW_PREDICT_FALSE(!view.is_inline() &&
+                            (view.buffer_index < 0 ||
+                             view.buffer_index >= num_data_buffers))) {
+      return ::arrow::internal::ComparableBinaryView(util::string_view());
+    }
+    return ::arrow::internal::ComparableBinaryView(view, data_buffers);
+  }
+  void Skip(int64_t length) { views += length; }
+};
+
+template <typename Type>
+struct ArrayIterator<Type, enable_if_fixed_size_binary<Type>> {
+  const int32_t byte_width;
+  const uint8_t* data;
+
+  explicit ArrayIterator(const ArrayData& arr)
+      : byte_width(checked_cast<const FixedSizeBinaryType&>(*arr.type).byte_width()),
+        data(arr.GetValues<uint8_t>(1, arr.offset * byte_width)) {}
+
+  typename GetViewType<Type>::T operator()() {
+    auto result = GetViewType<Type>::LogicalValue(
+        util::string_view(reinterpret_cast<const char*>(data), byte_width));
+    data += byte_width;
+    return result;
+  }
+  void Skip(int64_t length) { data += length * byte_width; }
 };
 
 // Iterator over various output array types, taking a GetOutputType<Type>
@@ -253,6 +319,10 @@ struct OutputArrayWriter<Type, enable_if_has_c_type_not_boolean<Type>> {
   // Note that this doesn't write the null bitmap, which should be consistent
   // with Write / WriteNull calls
   void WriteNull() { *values++ = T{}; }
+  void WriteNulls(int64_t length) {
+    std::fill(values, values + length, T{});
+    values += length;
+  }
 };
 
 // (Un)box Scalar to / from C++ value
@@ -276,6 +346,14 @@ struct UnboxScalar<Type, enable_if_base_binary<Type>> {
   }
 };
 
+template <typename Type>
+struct UnboxScalar<Type, enable_if_binary_view<Type>> {
+  static ::arrow::internal::ComparableBinaryView Unbox(const Scalar& val) {
+    return ::arrow::internal::ComparableBinaryView(
+        util::string_view(*checked_cast<const BaseBinaryScalar&>(val).value));
+  }
+};
+
 template <>
 struct UnboxScalar<Decimal128Type> {
   static Decimal128 Unbox(const Scalar& val) {
@@ -309,6 +387,43 @@ struct BoxScalar<Decimal128Type> {
   static void Box(T val, Scalar* out) { checked_cast<ScalarType*>(out)->value = val; }
 };
 
+// Random access to the values of a Decimal128 array, or to the value of a
+// Decimal128 scalar at every index (through a zero stride), so that kernels can
+// use one loop for any combination of array and scalar arguments.
+//
+// Decimals of precision 18 or less fit in the low word of their two's
+// complement representation, which ReadInt64 returns without building a
+// Decimal128.
+class DecimalValues {
+ public:
+  explicit DecimalValues(const Datum& datum) {
+    if (datum.is_scalar()) {
+      checked_cast<const Decimal128Scalar&>(*datum.scalar()).value.ToBytes(scalar_);
+      values_ = scalar_;
+      stride_ = 0;
+    } else {
+      const ArrayData& arr = *datum.array();
+      values_ = arr.GetValues<uint8_t>(1, arr.offset * 16);
+      stride_ = 16;
+    }
+  }
+
+  Decimal128 Read(int64_t i) const { return Decimal128(values_ + i * stride_); }
+
+  int64_t ReadInt64(int64_t i) const {
+    return reinterpret_cast<const int64_t*>(values_ + i * stride_)[kLowWord];
+  }
+
+  static constexpr int kLowWord = ARROW_LITTLE_ENDIAN ? 0 : 1;
+
+ private:
+  ARROW_DISALLOW_COPY_AND_ASSIGN(DecimalValues);
+
+  const uint8_t* values_;
+  int64_t stride_;
+  alignas(16) uint8_t scalar_[16];
+};
+
 // A VisitArrayDataInline variant that calls its visitor function with logical
 // values, such as Decimal128 rather than util::string_view.
 
@@ -323,25 +438,93 @@ static void VisitArrayValuesInline(const ArrayData& arr, VisitFunc&& valid_func,
       std::forward<NullFunc>(null_func));
 }
 
+// Like VisitArrayValuesInline, but visiting the validity bitmap in blocks of
+// 64 slots: all-valid blocks run valid_func in a loop without any validity
+// checks, and all-null blocks are skipped with a single null_run_func(length)
+// call, as are single null slots in the other blocks.
+
+template <typename T, typename VisitFunc, typename NullRunFunc>
+static void VisitArrayValueBlocksInline(const ArrayData& arr, VisitFunc&& valid_func,
+                                        NullRunFunc&& null_run_func) {
+  ArrayIterator<T> arr_it(arr);
+  const uint8_t* bitmap = arr.buffers[0] ? arr.buffers[0]->data() : NULLPTR;
+  OptionalBitBlockCounter bit_counter(bitmap, arr.offset, arr.length);
+  int64_t position = 0;
+  while (position < arr.length) {
+    BitBlockCount block = bit_counter.NextBlock();
+    if (block.AllSet()) {
+      for (int64_t i = 0; i < block.length; ++i) {
+        valid_func(arr_it());
+      }
+    } else if (block.NoneSet()) {
+      arr_it.Skip(block.length);
+      null_run_func(block.length);
+    } else {
+      for (int64_t i = 0; i < block.length; ++i) {
+        if (BitUtil::GetBit(bitmap, arr.offset + position + i)) {
+          valid_func(arr_it());
+        } else {
+          arr_it.Skip(1);
+          null_run_func(1);
+        }
+      }
+    }
+    position += block.length;
+  }
+}
+
+// Like VisitArrayValueBlocksInline, but for binary functions.
+
+template <typename Arg0Type, typename Arg1Type, typename VisitFunc, typename NullRunFunc>
+static void VisitTwoArrayValueBlocksInline(const ArrayData& arr0, const ArrayData& arr1,
+                                           VisitFunc&& valid_func,
+                                           NullRunFunc&& null_run_func) {
+  ArrayIterator<Arg0Type> arr0_it(arr0);
+  ArrayIterator<Arg1Type> arr1_it(arr1);
+  const uint8_t* bitmap0 = arr0.buffers[0] ? arr0.buffers[0]->data() : NULLPTR;
+  const uint8_t* bitmap1 = arr1.buffers[0] ? arr1.buffers[0]->data() : NULLPTR;
+  OptionalBinaryBitBlockCounter bit_counter(bitmap0, arr0.offset, bitmap1, arr1.offset,
+                                            arr0.length);
+  int64_t position = 0;
+  while (position < arr0.length) {
+    BitBlockCount block = bit_counter.NextAndBlock();
+    if (block.AllSet()) {
+      for (int64_t i = 0; i < block.length; ++i) {
+        valid_func(arr0_it(), arr1_it());
+      }
+    } else if (block.NoneSet()) {
+      arr0_it.Skip(block.length);
+      arr1_it.Skip(block.length);
+      null_run_func(block.length);
+    } else {
+      for (int64_t i = 0; i < block.length; ++i) {
+        if ((bitmap0 == NULLPTR ||
+             BitUtil::GetBit(bitmap0, arr0.offset + position + i)) &&
+            (bitmap1 == NULLPTR ||
+             BitUtil::GetBit(bitmap1, arr1.offset + position + i))) {
+          valid_func(arr0_it(), arr1_it());
+        } else {
+          arr0_it.Skip(1);
+          arr1_it.Skip(1);
+          null_run_func(1);
+        }
+      }
+    }
+    position += block.length;
+  }
+}
+
 // Like VisitArrayValuesInline, but for binary functions.
 
 template <typename Arg0Type, typename Arg1Type, typename VisitFunc, typename NullFunc>
 static void VisitTwoArrayValuesInline(const ArrayData& arr0, const ArrayData& arr1,
                                       VisitFunc&& valid_func, NullFunc&& null_func) {
-  ArrayIterator<Arg0Type> arr0_it(arr0);
-  ArrayIterator<Arg1Type> arr1_it(arr1);
-
-  auto visit_valid = [&](int64_t i) {
-    valid_func(GetViewType<Arg0Type>::LogicalValue(arr0_it()),
-               GetViewType<Arg1Type>::LogicalValue(arr1_it()));
-  };
-  auto visit_null = [&]() {
-    arr0_it();
-    arr1_it();
-    null_func();
-  };
-  VisitTwoBitBlocksVoid(arr0.buffers[0], arr0.offset, arr1.buffers[0], arr1.offset,
-                        arr0.length, std::move(visit_valid), std::move(visit_null));
+  VisitTwoArrayValueBlocksInline<Arg0Type, Arg1Type>(
+      arr0, arr1, std::forward<VisitFunc>(valid_func), [&](int64_t length) {
+        for (int64_t i = 0; i < length; ++i) {
+          null_func();
+        }
+      });
 }
 
 // ----------------------------------------------------------------------
@@ -551,14 +734,14 @@ struct ScalarUnaryNotNullStateful {
                      Datum* out) {
       ArrayData* out_arr = out->mutable_array();
       auto out_data = out_arr->GetMutableValues<OutValue>(1);
-      VisitArrayValuesInline<Arg0Type>(
+      VisitArrayValueBlocksInline<Arg0Type>(
           arg0,
           [&](Arg0Value v) {
             *out_data++ = functor.op.template Call<OutValue, Arg0Value>(ctx, v);
           },
-          [&]() {
-            // null
-            ++out_data;
+          [&](int64_t length) {
+            // nulls
+            out_data += length;
           });
     }
   };
@@ -616,13 +799,13 @@ struct ScalarUnaryNotNullStateful {
                      Datum* out) {
       ArrayData* out_arr = out->mutable_array();
       auto out_data = out_arr->GetMutableValues<uint8_t>(1);
-      VisitArrayValuesInline<Arg0Type>(
+      VisitArrayValueBlocksInline<Arg0Type>(
           arg0,
           [&](Arg0Value v) {
             functor.op.template Call<OutValue, Arg0Value>(ctx, v).ToBytes(out_data);
             out_data += 16;
           },
-          [&]() { out_data += 16; });
+          [&](int64_t length) { out_data += 16 * length; });
     }
   };
 
@@ -753,12 +936,12 @@ struct ScalarBinaryNotNullStateful {
   void ArrayArray(KernelContext* ctx, const ArrayData& arg0, const ArrayData& arg1,
                   Datum* out) {
     OutputArrayWriter<OutType> writer(out->mutable_array());
-    VisitTwoArrayValuesInline<Arg0Type, Arg1Type>(
+    VisitTwoArrayValueBlocksInline<Arg0Type, Arg1Type>(
         arg0, arg1,
         [&](Arg0Value u, Arg1Value v) {
           writer.Write(op.template Call<OutValue, Arg0Value, Arg1Value>(ctx, u, v));
         },
-        [&]() { writer.WriteNull(); });
+        [&](int64_t length) { writer.WriteNulls(length); });
   }
 
   void ArrayScalar(KernelContext* ctx, const ArrayData& arg0, const Scalar& arg1,
@@ -766,13 +949,13 @@ struct ScalarBinaryNotNullStateful {
     OutputArrayWriter<OutType> writer(out->mutable_array());
     if (arg1.is_valid) {
       const auto arg1_val = UnboxScalar<Arg1Type>::Unbox(arg1);
-      VisitArrayValuesInline<Arg0Type>(
+      VisitArrayValueBlocksInline<Arg0Type>(
           arg0,
           [&](Arg0Value u) {
             writer.Write(
                 op.template Call<OutValue, Arg0Value, Arg1Value>(ctx, u, arg1_val));
           },
-          [&]() { writer.WriteNull(); });
+          [&](int64_t length) { writer.WriteNulls(length); });
     }
   }
 
@@ -781,13 +964,13 @@ struct ScalarBinaryNotNullStateful {
     OutputArrayWriter<OutType> writer(out->mutable_array());
     if (arg0.is_valid) {
       const auto arg0_val = UnboxScalar<Arg0Type>::Unbox(arg0);
-      VisitArrayValuesInline<Arg1Type>(
+      VisitArrayValueBlocksInline<Arg1Type>(
           arg1,
           [&](Arg1Value v) {
             writer.Write(
                 op.template Call<OutValue, Arg0Value, Arg1Value>(ctx, arg0_val, v));
           },
-          [&]() { writer.WriteNull(); });
+          [&](int64_t length) { writer.WriteNulls(length); });
     }
   }
 
@@ -0,0 +1,1200 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/array_nested.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/dict_internal.h"
+#include "arrow/array/util.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec_internal.h"
+#include "arrow/compute/kernels/aggregate_internal.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::DictionaryTraits;
+using internal::HashTraits;
+
+namespace compute {
+namespace internal {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Row-wise key encoding for multi-key grouping
+//
+// Each key value is encoded as a validity byte followed by its payload; the
+// concatenation of all key values of a row is hashed as a single binary
+// value.
+
+constexpr uint8_t kNullByte = 0;
+constexpr uint8_t kValidByte = 1;
+
+inline bool IsValidAt(const ArrayData& data, int64_t i) {
+  return data.GetNullCount() == 0 ||
+         BitUtil::GetBit(data.buffers[0]->data(), data.offset + i);
+}
+
+struct KeyEncoder {
+  virtual ~KeyEncoder() = default;
+
+  // Add the encoded length of each value of `data` to the respective entry
+  // of `lengths`.
+  virtual void AddLength(const ArrayData& data, int32_t* lengths) = 0;
+
+  // Encode each value of `data` at the respective position of
+  // `encoded_bytes`, advancing each position past the encoded value.
+  virtual void Encode(const ArrayData& data, uint8_t** encoded_bytes) = 0;
+
+  // Decode `length` values, advancing each position of `encoded_bytes` past
+  // the decoded value.
+  virtual Result<std::shared_ptr<ArrayData>> Decode(const uint8_t** encoded_bytes,
+                                                    int32_t length,
+                                                    MemoryPool* pool) = 0;
+};
+
+struct BooleanKeyEncoder : KeyEncoder {
+  static constexpr int kByteWidth = 1;
+
+  void AddLength(const ArrayData& data, int32_t* lengths) override {
+    for (int64_t i = 0; i < data.length; ++i) {
+      lengths[i] += kByteWidth + 1;
+    }
+  }
+
+  void Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
+    const uint8_t* values = data.buffers[1]->data();
+    for (int64_t i = 0; i < data.length; ++i) {
+      auto& encoded_ptr = encoded_bytes[i];
+      if (IsValidAt(data, i)) {
+        *encoded_ptr++ = kValidByte;
+        *encoded_ptr++ = BitUtil::GetBit(values, data.offset + i);
+      } else {
+        *encoded_ptr++ = kNullByte;
+        *encoded_ptr++ = 0;
+      }
+    }
+  }
+
+  Result<std::shared_ptr<ArrayData>> Decode(const uint8_t** encoded_bytes,
+                                            int32_t length, MemoryPool* pool) override {
+    ARROW_ASSIGN_OR_RAISE(auto null_buf, AllocateBitmap(length, pool));
+    ARROW_ASSIGN_OR_RAISE(auto key_buf, AllocateBitmap(length, pool));
+    uint8_t* validity = null_buf->mutable_data();
+    uint8_t* values = key_buf->mutable_data();
+    int64_t null_count = 0;
+    for (int32_t i = 0; i < length; ++i) {
+      auto& encoded_ptr = encoded_bytes[i];
+      const bool is_valid = *encoded_ptr++ == kValidByte;
+      BitUtil::SetBitTo(validity, i, is_valid);
+      BitUtil::SetBitTo(values, i, *encoded_ptr++ != 0);
+      null_count += !is_valid;
+    }
+    if (null_count == 0) {
+      null_buf = nullptr;
+    }
+    return ArrayData::Make(boolean(), length, {std::move(null_buf), std::move(key_buf)},
+                           null_count);
+  }
+};
+
+struct FixedWidthKeyEncoder : KeyEncoder {
+  explicit FixedWidthKeyEncoder(std::shared_ptr<DataType> type)
+      : type_(std::move(type)),
+        byte_width_(checked_cast<const FixedWidthType&>(*type_).bit_width() / 8) {}
+
+  void AddLength(const ArrayData& data, int32_t* lengths) override {
+    for (int64_t i = 0; i < data.length; ++i) {
+      lengths[i] += byte_width_ + 1;
+    }
+  }
+
+  void Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
+    const uint8_t* values = data.buffers[1]->data() + data.offset * byte_width_;
+    for (int64_t i = 0; i < data.length; ++i) {
+      auto& encoded_ptr = encoded_bytes[i];
+      if (IsValidAt(data, i)) {
+        *encoded_ptr++ = kValidByte;
+        memcpy(encoded_ptr, values + i * byte_width_, byte_width_);
+      } else {
+        *encoded_ptr++ = kNullByte;
+        memset(encoded_ptr, 0, byte_width_);
+      }
+      encoded_ptr += byte_width_;
+    }
+  }
+
+  Result<std::shared_ptr<ArrayData>> Decode(const uint8_t** encoded_bytes,
+                                            int32_t length, MemoryPool* pool) override {
+    ARROW_ASSIGN_OR_RAISE(auto null_buf, AllocateBitmap(length, pool));
+    ARROW_ASSIGN_OR_RAISE(auto key_buf, AllocateBuffer(length * byte_width_, pool));
+    uint8_t* validity = null_buf->mutable_data();
+    uint8_t* values = key_buf->mutable_data();
+    int64_t null_count = 0;
+    for (int32_t i = 0; i < length; ++i) {
+      auto& encoded_ptr = encoded_bytes[i];
+      const bool is_valid = *encoded_ptr++ == kValidByte;
+      BitUtil::SetBitTo(validity, i, is_valid);
+      null_count += !is_valid;
+      memcpy(values + i * byte_width_, encoded_ptr, byte_width_);
+      encoded_ptr += byte_width_;
+    }
+    if (null_count == 0) {
+      null_buf = nullptr;
+    }
+    return ArrayData::Make(type_, length, {std::move(null_buf), std::move(key_buf)},
+                           null_count);
+  }
+
+  std::shared_ptr<DataType> type_;
+  int byte_width_;
+};
+
+template <typename T>
+struct VarLengthKeyEncoder : KeyEncoder {
+  using Offset = typename T::offset_type;
+
+  explicit VarLengthKeyEncoder(std::shared_ptr<DataType> type) : type_(std::move(type)) {}
+
+  void AddLength(const ArrayData& data, int32_t* lengths) override {
+    const Offset* offsets = data.GetValues<Offset>(1);
+    for (int64_t i = 0; i < data.length; ++i) {
+      // Null values are encoded with an empty payload
+      const Offset value_length = IsValidAt(data, i) ? offsets[i + 1] - offsets[i] : 0;
+      lengths[i] += static_cast<int32_t>(value_length) +
+                    static_cast<int32_t>(sizeof(Offset)) + 1;
+    }
+  }
+
+  void Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
+    const Offset* offsets = data.GetValues<Offset>(1);
+    const uint8_t* values = data.buffers[2]->data();
+    for (int64_t i = 0; i < data.length; ++i) {
+      auto& encoded_ptr = encoded_bytes[i];
+      const bool is_valid = IsValidAt(data, i);
+      const Offset value_length = is_valid ? offsets[i + 1] - offsets[i] : 0;
+      *encoded_ptr++ = is_valid ? kValidByte : kNullByte;
+      memcpy(encoded_ptr, &value_length, sizeof(Offset));
+      encoded_ptr += sizeof(Offset);
+      memcpy(encoded_ptr, values + offsets[i], value_length);
+      encoded_ptr += value_length;
+    }
+  }
+
+  Result<std::shared_ptr<ArrayData>> Decode(const uint8_t** encoded_bytes,
+                                            int32_t length, MemoryPool* pool) override {
+    ARROW_ASSIGN_OR_RAISE(auto null_buf, AllocateBitmap(length, pool));
+    ARROW_ASSIGN_OR_RAISE(auto offset_buf,
+                          AllocateBuffer(sizeof(Offset) * (length + 1), pool));
+    uint8_t* validity = null_buf->mutable_data();
+    auto offsets = reinterpret_cast<Offset*>(offset_buf->mutable_data());
+
+    // First pass: validity and offsets; remember where each value starts
+    std::vector<const uint8_t*> value_ptrs(length);
+    int64_t null_count = 0;
+    Offset current_offset = 0;
+    for (int32_t i = 0; i < length; ++i) {
+      auto& encoded_ptr = encoded_bytes[i];
+      const bool is_valid = *encoded_ptr++ == kValidByte;
+      BitUtil::SetBitTo(validity, i, is_valid);
+      null_count += !is_valid;
+      Offset value_length;
+      memcpy(&value_length, encoded_ptr, sizeof(Offset));
+      encoded_ptr += sizeof(Offset);
+      value_ptrs[i] = encoded_ptr;
+      encoded_ptr += value_length;
+      offsets[i] = current_offset;
+      current_offset += value_length;
+    }
+    offsets[length] = current_offset;
+
+    // Second pass: copy the value bytes
+    ARROW_ASSIGN_OR_RAISE(auto key_buf, AllocateBuffer(current_offset, pool));
+    uint8_t* values = key_buf->mutable_data();
+    for (int32_t i = 0; i < length; ++i) {
+      memcpy(values + offsets[i], value_ptrs[i], offsets[i + 1] - offsets[i]);
+    }
+    if (null_count == 0) {
+      null_buf = nullptr;
+    }
+    return ArrayData::Make(
+        type_, length, {std::move(null_buf), std::move(offset_buf), std::move(key_buf)},
+        null_count);
+  }
+
+  std::shared_ptr<DataType> type_;
+};
+
+Result<std::unique_ptr<KeyEncoder>> MakeKeyEncoder(
+    const std::shared_ptr<DataType>& type) {
+  switch (type->id()) {
+    case Type::BOOL:
+      return ::arrow::internal::make_unique<BooleanKeyEncoder>();
+    case Type::STRING:
+    case Type::BINARY:
+      return ::arrow::internal::make_unique<VarLengthKeyEncoder<BinaryType>>(type);
+    case Type::LARGE_STRING:
+    case Type::LARGE_BINARY:
+      return ::arrow::internal::make_unique<VarLengthKeyEncoder<LargeBinaryType>>(type);
+    default:
+      break;
+  }
+  if (is_fixed_width(type->id()) && type->id() != Type::DICTIONARY &&
+      checked_cast<const FixedWidthType&>(*type).bit_width() % 8 == 0 &&
+      checked_cast<const FixedWidthType&>(*type).bit_width() > 0) {
+    return ::arrow::internal::make_unique<FixedWidthKeyEncoder>(type);
+  }
+  return Status::NotImplemented("Keys of type ", *type);
+}
+
+// Finish the output of Grouper::Find, with nulls where the key wasn't found
+Result<Datum> FinishFoundIds(int64_t length, TypedBufferBuilder<uint32_t>* group_ids,
+                             TypedBufferBuilder<bool>* found) {
+  const int64_t null_count = found->false_count();
+  std::shared_ptr<Buffer> ids_buffer, found_buffer;
+  RETURN_NOT_OK(group_ids->Finish(&ids_buffer));
+  RETURN_NOT_OK(found->Finish(&found_buffer));
+  if (null_count == 0) {
+    found_buffer = nullptr;
+  }
+  return Datum(UInt32Array(length, std::move(ids_buffer), std::move(found_buffer),
+                           null_count));
+}
+
+// Grouper for any number of keys, hashing row-encoded keys
+class RowGrouperImpl : public Grouper {
+ public:
+  static Result<std::unique_ptr<RowGrouperImpl>> Make(
+      const std::vector<ValueDescr>& descrs, ExecContext* ctx) {
+    auto impl = ::arrow::internal::make_unique<RowGrouperImpl>(ctx);
+    for (const auto& descr : descrs) {
+      ARROW_ASSIGN_OR_RAISE(auto encoder, MakeKeyEncoder(descr.type));
+      impl->encoders_.push_back(std::move(encoder));
+    }
+    return std::move(impl);
+  }
+
+  explicit RowGrouperImpl(ExecContext* ctx)
+      : ctx_(ctx),
+        map_(ctx->memory_pool()),
+        group_ids_(ctx->memory_pool()),
+        found_(ctx->memory_pool()) {}
+
+  Result<Datum> Consume(const ExecBatch& batch) override {
+    RETURN_NOT_OK(EncodeRows(batch));
+    const int64_t length = batch.length;
+
+    // Memoize the rows
+    RETURN_NOT_OK(group_ids_.Reserve(length));
+    for (int64_t i = 0; i < length; ++i) {
+      int32_t group_id;
+      RETURN_NOT_OK(map_.GetOrInsert(key_bytes_.data() + offsets_[i],
+                                     offsets_[i + 1] - offsets_[i], &group_id));
+      group_ids_.UnsafeAppend(static_cast<uint32_t>(group_id));
+    }
+
+    std::shared_ptr<Buffer> group_ids;
+    RETURN_NOT_OK(group_ids_.Finish(&group_ids));
+    return Datum(UInt32Array(length, std::move(group_ids)));
+  }
+
+  Result<Datum> Find(const ExecBatch& batch) override {
+    RETURN_NOT_OK(EncodeRows(batch));
+    const int64_t length = batch.length;
+
+    RETURN_NOT_OK(group_ids_.Reserve(length));
+    RETURN_NOT_OK(found_.Reserve(length));
+    for (int64_t i = 0; i < length; ++i) {
+      const int32_t group_id =
+          map_.Get(key_bytes_.data() + offsets_[i], offsets_[i + 1] - offsets_[i]);
+      const bool found = group_id != ::arrow::internal::kKeyNotFound;
+      group_ids_.UnsafeAppend(found ? static_cast<uint32_t>(group_id) : 0);
+      found_.UnsafeAppend(found);
+    }
+    return FinishFoundIds(length, &group_ids_, &found_);
+  }
+
+  uint32_t num_groups() const override { return static_cast<uint32_t>(map_.size()); }
+
+  Result<ExecBatch> GetUniques() override {
+    const int32_t length = map_.size();
+    std::vector<const uint8_t*> key_ptrs;
+    key_ptrs.reserve(length);
+    map_.VisitValues(0, [&](const util::string_view& key) {
+      key_ptrs.push_back(reinterpret_cast<const uint8_t*>(key.data()));
+    });
+
+    ExecBatch out({}, length);
+    out.values.resize(encoders_.size());
+    for (size_t i = 0; i < encoders_.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(out.values[i], encoders_[i]->Decode(key_ptrs.data(), length,
+                                                                ctx_->memory_pool()));
+    }
+    return out;
+  }
+
+ private:
+  // Encode the key rows of a batch into key_bytes_, delimited by offsets_
+  Status EncodeRows(const ExecBatch& batch) {
+    if (batch.num_values() != static_cast<int>(encoders_.size())) {
+      return Status::Invalid("Grouper expected ", encoders_.size(), " keys but got ",
+                             batch.num_values());
+    }
+    const int64_t length = batch.length;
+
+    // Compute the encoded row offsets
+    offsets_.assign(length + 1, 0);
+    for (size_t i = 0; i < encoders_.size(); ++i) {
+      encoders_[i]->AddLength(*batch[i].array(), offsets_.data());
+    }
+    int32_t total_length = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      const int32_t row_length = offsets_[i];
+      offsets_[i] = total_length;
+      total_length += row_length;
+    }
+    offsets_[length] = total_length;
+
+    // Encode the rows
+    key_bytes_.resize(total_length);
+    key_ptrs_.resize(length);
+    for (int64_t i = 0; i < length; ++i) {
+      key_ptrs_[i] = key_bytes_.data() + offsets_[i];
+    }
+    for (size_t i = 0; i < encoders_.size(); ++i) {
+      encoders_[i]->Encode(*batch[i].array(), key_ptrs_.data());
+    }
+    return Status::OK();
+  }
+
+  ExecContext* ctx_;
+  std::vector<std::unique_ptr<KeyEncoder>> encoders_;
+  ::arrow::internal::BinaryMemoTable<BinaryBuilder, ::arrow::internal::SwissHashTable>
+      map_;
+  TypedBufferBuilder<uint32_t> group_ids_;
+  TypedBufferBuilder<bool> found_;
+
+  // Scratch space reused across batches
+  std::vector<int32_t> offsets_;
+  std::vector<uint8_t> key_bytes_;
+  std::vector<uint8_t*> key_ptrs_;
+};
+
+// Grouper for a single key, hashing key values directly with the memo table
+// used for the key type by the hash kernels
+template <typename Type>
+class MemoGrouperImpl : public Grouper {
+ public:
+  using MemoTable = typename HashTraits<Type>::MemoTableType;
+
+  MemoGrouperImpl(std::shared_ptr<DataType> type, ExecContext* ctx)
+      : type_(std::move(type)),
+        ctx_(ctx),
+        memo_table_(ctx->memory_pool(), 0),
+        group_ids_(ctx->memory_pool()),
+        found_(ctx->memory_pool()) {}
+
+  Result<Datum> Consume(const ExecBatch& batch) override {
+    if (batch.num_values() != 1) {
+      return Status::Invalid("Grouper expected 1 key but got ", batch.num_values());
+    }
+    const ArrayData& keys = *batch[0].array();
+    RETURN_NOT_OK(group_ids_.Reserve(keys.length));
+    RETURN_NOT_OK(VisitArrayDataInline<Type>(
+        keys,
+        [&](typename ArrayDataInlineVisitor::c_type v) {
+          int32_t group_id;
+          RETURN_NOT_OK(memo_table_.GetOrInsert(v, &group_id));
+          group_ids_.UnsafeAppend(static_cast<uint32_t>(group_id));
+          return Status::OK();
+        },
+        [&]() {
+          group_ids_.UnsafeAppend(static_cast<uint32_t>(memo_table_.GetOrInsertNull()));
+          return Status::OK();
+        }));
+
+    std::shared_ptr<Buffer> group_ids;
+    RETURN_NOT_OK(group_ids_.Finish(&group_ids));
+    return Datum(UInt32Array(keys.length, std::move(group_ids)));
+  }
+
+  Result<Datum> Find(const ExecBatch& batch) override {
+    if (batch.num_values() != 1) {
+      return Status::Invalid("Grouper expected 1 key but got ", batch.num_values());
+    }
+    const ArrayData& keys = *batch[0].array();
+    RETURN_NOT_OK(group_ids_.Reserve(keys.length));
+    RETURN_NOT_OK(found_.Reserve(keys.length));
+    auto AppendGroupId = [&](int32_t group_id) {
+      const bool found = group_id != ::arrow::internal::kKeyNotFound;
+      group_ids_.UnsafeAppend(found ? static_cast<uint32_t>(group_id) : 0);
+      found_.UnsafeAppend(found);
+    };
+    VisitArrayDataInline<Type>(
+        keys,
+        [&](typename ArrayDataInlineVisitor::c_type v) {
+          AppendGroupId(memo_table_.Get(v));
+        },
+        [&]() { AppendGroupId(memo_table_.GetNull()); });
+    return FinishFoundIds(keys.length, &group_ids_, &found_);
+  }
+
+  uint32_t num_groups() const override {
+    return static_cast<uint32_t>(memo_table_.size());
+  }
+
+  Result<ExecBatch> GetUniques() override {
+    std::shared_ptr<ArrayData> uniques;
+    RETURN_NOT_OK(DictionaryTraits<Type>::GetDictionaryArrayData(
+        ctx_->memory_pool(), type_, memo_table_, /*start_offset=*/0, &uniques));
+    return ExecBatch({Datum(uniques)}, uniques->length);
+  }
+
+ private:
+  using ArrayDataInlineVisitor = ::arrow::internal::ArrayDataInlineVisitor<Type>;
+
+  std::shared_ptr<DataType> type_;
+  ExecContext* ctx_;
+  MemoTable memo_table_;
+  TypedBufferBuilder<uint32_t> group_ids_;
+  TypedBufferBuilder<bool> found_;
+};
+
+struct MemoGrouperFactory {
+  template <typename T>
+  enable_if_t<is_boolean_type<T>::value || has_c_type<T>::value ||
+                  is_base_binary_type<T>::value,
+              Status>
+  Visit(const T&) {
+    out.reset(new MemoGrouperImpl<T>(type, ctx));
+    return Status::OK();
+  }
+
+  Status Visit(const DataType&) {
+    // Fall back to the row-wise encoding
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> type;
+  ExecContext* ctx;
+  std::unique_ptr<Grouper> out;
+};
+
+}  // namespace
+
+Result<std::unique_ptr<Grouper>> Grouper::Make(const std::vector<ValueDescr>& descrs,
+                                               ExecContext* ctx) {
+  if (ctx == nullptr) {
+    static ExecContext default_ctx;
+    ctx = &default_ctx;
+  }
+  if (descrs.empty()) {
+    return Status::Invalid("Grouper requires at least one key");
+  }
+  for (const auto& descr : descrs) {
+    if (descr.shape != ValueDescr::ARRAY) {
+      return Status::NotImplemented("Grouping by scalar keys");
+    }
+  }
+  if (descrs.size() == 1) {
+    MemoGrouperFactory factory{descrs[0].type, ctx, nullptr};
+    RETURN_NOT_OK(VisitTypeInline(*descrs[0].type, &factory));
+    if (factory.out != nullptr) {
+      return std::move(factory.out);
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(auto impl, RowGrouperImpl::Make(descrs, ctx));
+  return std::unique_ptr<Grouper>(std::move(impl));
+}
+
+Result<std::shared_ptr<ListArray>> Grouper::MakeGroupings(const UInt32Array& ids,
+                                                          uint32_t num_groups,
+                                                          ExecContext* ctx) {
+  if (ctx == nullptr) {
+    ExecContext default_ctx;
+    return MakeGroupings(ids, num_groups, &default_ctx);
+  }
+  if (ids.null_count() != 0) {
+    return Status::Invalid("MakeGroupings with null ids");
+  }
+
+  // Counting sort of the row indices by group id
+  ARROW_ASSIGN_OR_RAISE(auto offsets_buf,
+                        AllocateBuffer(sizeof(int32_t) * (num_groups + 1),
+                                       ctx->memory_pool()));
+  auto offsets = reinterpret_cast<int32_t*>(offsets_buf->mutable_data());
+  std::fill(offsets, offsets + num_groups + 1, 0);
+  for (int64_t i = 0; i < ids.length(); ++i) {
+    const uint32_t id = ids.Value(i);
+    if (id >= num_groups) {
+      return Status::Invalid("Group id ", id, " out of bounds for ", num_groups,
+                             " groups");
+    }
+    ++offsets[id + 1];
+  }
+  for (uint32_t i = 0; i < num_groups; ++i) {
+    offsets[i + 1] += offsets[i];
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto sort_indices_buf,
+                        AllocateBuffer(sizeof(int32_t) * ids.length(),
+                                       ctx->memory_pool()));
+  auto sort_indices = reinterpret_cast<int32_t*>(sort_indices_buf->mutable_data());
+  std::vector<int32_t> cursors(offsets, offsets + num_groups);
+  for (int64_t i = 0; i < ids.length(); ++i) {
+    sort_indices[cursors[ids.Value(i)]++] = static_cast<int32_t>(i);
+  }
+
+  auto sort_indices_array =
+      std::make_shared<Int32Array>(ids.length(), std::move(sort_indices_buf));
+  return std::make_shared<ListArray>(list(int32()), num_groups, std::move(offsets_buf),
+                                     std::move(sort_indices_array));
+}
+
+Result<std::shared_ptr<ListArray>> Grouper::ApplyGroupings(const ListArray& groupings,
+                                                           const Array& array,
+                                                           ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(
+      Datum sorted,
+      Take(array, *groupings.values(), TakeOptions::NoBoundsCheck(), ctx));
+  return std::make_shared<ListArray>(list(array.type()), groupings.length(),
+                                     groupings.value_offsets(), sorted.make_array());
+}
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Grouped aggregation states
+
+struct GroupedAggregator : public KernelState {
+  virtual Status Resize(int64_t new_num_groups) = 0;
+
+  virtual Status Consume(const ExecBatch& batch) = 0;
+
+  virtual Status Merge(GroupedAggregator&& other, const ArrayData& group_id_mapping) = 0;
+
+  virtual Result<Datum> Finalize() = 0;
+};
+
+void HashAggregateResize(KernelContext* ctx, int64_t num_groups) {
+  KERNEL_RETURN_IF_ERROR(
+      ctx, checked_cast<GroupedAggregator*>(ctx->state())->Resize(num_groups));
+}
+
+void HashAggregateConsume(KernelContext* ctx, const ExecBatch& batch) {
+  KERNEL_RETURN_IF_ERROR(ctx,
+                         checked_cast<GroupedAggregator*>(ctx->state())->Consume(batch));
+}
+
+void HashAggregateMerge(KernelContext* ctx, KernelState&& other,
+                        const ArrayData& group_id_mapping) {
+  KERNEL_RETURN_IF_ERROR(
+      ctx, checked_cast<GroupedAggregator*>(ctx->state())
+               ->Merge(checked_cast<GroupedAggregator&&>(other), group_id_mapping));
+}
+
+void HashAggregateFinalize(KernelContext* ctx, Datum* out) {
+  KERNEL_ASSIGN_OR_RAISE(*out, ctx,
+                         checked_cast<GroupedAggregator*>(ctx->state())->Finalize());
+}
+
+// Build a validity bitmap from per-group flags, or null if all are set
+Result<std::shared_ptr<Buffer>> FlagsToBitmap(const std::vector<bool>& flags,
+                                              MemoryPool* pool, int64_t* null_count) {
+  const int64_t length = static_cast<int64_t>(flags.size());
+  *null_count = length - std::count(flags.begin(), flags.end(), true);
+  if (*null_count == 0) {
+    return nullptr;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto bitmap, AllocateBitmap(length, pool));
+  uint8_t* bits = bitmap->mutable_data();
+  for (int64_t i = 0; i < length; ++i) {
+    BitUtil::SetBitTo(bits, i, flags[i]);
+  }
+  return std::move(bitmap);
+}
+
+// ----------------------------------------------------------------------
+// Count implementation
+
+struct GroupedCountImpl : public GroupedAggregator {
+  GroupedCountImpl(CountOptions options, MemoryPool* pool)
+      : options(std::move(options)), counts(pool) {}
+
+  Status Resize(int64_t new_num_groups) override {
+    const int64_t added_groups = new_num_groups - counts.length();
+    return counts.Append(added_groups, 0);
+  }
+
+  Status Consume(const ExecBatch& batch) override {
+    const ArrayData& input = *batch[0].array();
+    const uint32_t* g = batch[1].array()->GetValues<uint32_t>(1);
+    int64_t* raw_counts = counts.mutable_data();
+
+    const bool count_nulls = options.count_mode == CountOptions::COUNT_NULL;
+    if (input.GetNullCount() == 0) {
+      if (!count_nulls) {
+        for (int64_t i = 0; i < input.length; ++i) {
+          ++raw_counts[g[i]];
+        }
+      }
+      return Status::OK();
+    }
+    if (count_nulls) {
+      // Count all rows, then discount the valid ones below
+      for (int64_t i = 0; i < input.length; ++i) {
+        ++raw_counts[g[i]];
+      }
+    }
+    const int64_t valid_increment = count_nulls ? -1 : 1;
+    ::arrow::internal::VisitBitBlocksVoid(
+        input.buffers[0], input.offset, input.length,
+        [&](int64_t i) { raw_counts[g[i]] += valid_increment; }, [] {});
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedCountImpl*>(&raw_other);
+    const int64_t* other_counts = other->counts.data();
+    const uint32_t* g = group_id_mapping.GetValues<uint32_t>(1);
+    int64_t* raw_counts = counts.mutable_data();
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      raw_counts[g[other_g]] += other_counts[other_g];
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    const int64_t length = counts.length();
+    std::shared_ptr<Buffer> data;
+    RETURN_NOT_OK(counts.Finish(&data));
+    return ArrayData::Make(int64(), length, {nullptr, std::move(data)}, /*null_count=*/0);
+  }
+
+  CountOptions options;
+  TypedBufferBuilder<int64_t> counts;
+};
+
+std::unique_ptr<KernelState> GroupedCountInit(KernelContext* ctx,
+                                              const KernelInitArgs& args) {
+  return ::arrow::internal::make_unique<GroupedCountImpl>(
+      static_cast<const CountOptions&>(*args.options), ctx->memory_pool());
+}
+
+// ----------------------------------------------------------------------
+// Sum / Mean implementation
+
+template <typename ArrowType>
+struct GroupedSumImpl : public GroupedAggregator {
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using SumType = typename FindAccumulatorType<ArrowType>::Type;
+  using SumCType = typename SumType::c_type;
+
+  GroupedSumImpl(std::shared_ptr<DataType> out_type, bool is_mean, MemoryPool* pool)
+      : out_type(std::move(out_type)), is_mean(is_mean), pool(pool) {}
+
+  Status Resize(int64_t new_num_groups) override {
+    sums.resize(new_num_groups, 0);
+    counts.resize(new_num_groups, 0);
+    return Status::OK();
+  }
+
+  Status Consume(const ExecBatch& batch) override {
+    const ArrayData& input = *batch[0].array();
+    const uint32_t* g = batch[1].array()->GetValues<uint32_t>(1);
+    SumCType* raw_sums = sums.data();
+    int64_t* raw_counts = counts.data();
+
+    VisitArrayDataInline<ArrowType>(
+        input,
+        [&](CType value) {
+          raw_sums[*g] += static_cast<SumCType>(value);
+          ++raw_counts[*g++];
+        },
+        [&] { ++g; });
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedSumImpl*>(&raw_other);
+    const uint32_t* g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      sums[g[other_g]] += other->sums[other_g];
+      counts[g[other_g]] += other->counts[other_g];
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    const int64_t length = static_cast<int64_t>(sums.size());
+    std::vector<bool> has_values(length);
+    for (int64_t i = 0; i < length; ++i) {
+      has_values[i] = counts[i] > 0;
+    }
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto null_bitmap, FlagsToBitmap(has_values, pool, &null_count));
+
+    std::shared_ptr<Buffer> data;
+    if (is_mean) {
+      ARROW_ASSIGN_OR_RAISE(data, AllocateBuffer(length * sizeof(double), pool));
+      auto means = reinterpret_cast<double*>(data->mutable_data());
+      for (int64_t i = 0; i < length; ++i) {
+        means[i] = counts[i] > 0 ? static_cast<double>(sums[i]) / counts[i] : 0;
+      }
+    } else {
+      ARROW_ASSIGN_OR_RAISE(data, AllocateBuffer(length * sizeof(SumCType), pool));
+      memcpy(data->mutable_data(), sums.data(), length * sizeof(SumCType));
+    }
+    return ArrayData::Make(out_type, length, {std::move(null_bitmap), std::move(data)},
+                           null_count);
+  }
+
+  std::shared_ptr<DataType> out_type;
+  bool is_mean;
+  MemoryPool* pool;
+  std::vector<SumCType> sums;
+  std::vector<int64_t> counts;
+};
+
+template <bool IsMean>
+struct GroupedSumInitState {
+  template <typename T>
+  enable_if_t<is_integer_type<T>::value || is_physical_floating_type<T>::value, Status>
+  Visit(const T&) {
+    state.reset(new GroupedSumImpl<T>(out_type, IsMean, ctx->memory_pool()));
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Grouped sum/mean of type ", type);
+  }
+
+  std::unique_ptr<KernelState> Create(const DataType& type) {
+    ctx->SetStatus(VisitTypeInline(type, this));
+    return std::move(state);
+  }
+
+  KernelContext* ctx;
+  std::shared_ptr<DataType> out_type;
+  std::unique_ptr<KernelState> state;
+};
+
+template <bool IsMean>
+std::unique_ptr<KernelState> GroupedSumInit(KernelContext* ctx,
+                                            const KernelInitArgs& args) {
+  GroupedSumInitState<IsMean> visitor{ctx, args.kernel->signature->out_type().type(),
+                                      nullptr};
+  return visitor.Create(*args.inputs[0].type);
+}
+
+// ----------------------------------------------------------------------
+// MinMax implementation
+
+template <typename CType, typename Enable = void>
+struct MinMaxOp {
+  static CType min(CType a, CType b) { return std::min(a, b); }
+  static CType max(CType a, CType b) { return std::max(a, b); }
+  static constexpr CType min_initial() { return std::numeric_limits<CType>::max(); }
+  static constexpr CType max_initial() { return std::numeric_limits<CType>::lowest(); }
+};
+
+template <typename CType>
+struct MinMaxOp<CType, enable_if_t<std::is_floating_point<CType>::value>> {
+  // NaN values are skipped
+  static CType min(CType a, CType b) { return std::fmin(a, b); }
+  static CType max(CType a, CType b) { return std::fmax(a, b); }
+  static constexpr CType min_initial() { return std::numeric_limits<CType>::infinity(); }
+  static constexpr CType max_initial() { return -std::numeric_limits<CType>::infinity(); }
+};
+
+template <typename ArrowType>
+struct GroupedMinMaxImpl : public GroupedAggregator {
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using Op = MinMaxOp<CType>;
+
+  GroupedMinMaxImpl(std::shared_ptr<DataType> out_type, MinMaxOptions options,
+                    MemoryPool* pool)
+      : out_type(std::move(out_type)), options(std::move(options)), pool(pool) {}
+
+  Status Resize(int64_t new_num_groups) override {
+    mins.resize(new_num_groups, Op::min_initial());
+    maxes.resize(new_num_groups, Op::max_initial());
+    has_values.resize(new_num_groups, false);
+    has_nulls.resize(new_num_groups, false);
+    return Status::OK();
+  }
+
+  Status Consume(const ExecBatch& batch) override {
+    const ArrayData& input = *batch[0].array();
+    const uint32_t* g = batch[1].array()->GetValues<uint32_t>(1);
+
+    VisitArrayDataInline<ArrowType>(
+        input,
+        [&](CType value) {
+          mins[*g] = Op::min(mins[*g], value);
+          maxes[*g] = Op::max(maxes[*g], value);
+          has_values[*g++] = true;
+        },
+        [&] { has_nulls[*g++] = true; });
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedMinMaxImpl*>(&raw_other);
+    const uint32_t* g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      mins[g[other_g]] = Op::min(mins[g[other_g]], other->mins[other_g]);
+      maxes[g[other_g]] = Op::max(maxes[g[other_g]], other->maxes[other_g]);
+      if (other->has_values[other_g]) has_values[g[other_g]] = true;
+      if (other->has_nulls[other_g]) has_nulls[g[other_g]] = true;
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    const int64_t length = static_cast<int64_t>(mins.size());
+    std::vector<bool> valid = has_values;
+    if (options.null_handling == MinMaxOptions::OUTPUT_NULL) {
+      for (int64_t i = 0; i < length; ++i) {
+        valid[i] = valid[i] && !has_nulls[i];
+      }
+    }
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto null_bitmap, FlagsToBitmap(valid, pool, &null_count));
+
+    const auto& value_type = out_type->field(0)->type();
+    ARROW_ASSIGN_OR_RAISE(auto min_data, AllocateBuffer(length * sizeof(CType), pool));
+    ARROW_ASSIGN_OR_RAISE(auto max_data, AllocateBuffer(length * sizeof(CType), pool));
+    memcpy(min_data->mutable_data(), mins.data(), length * sizeof(CType));
+    memcpy(max_data->mutable_data(), maxes.data(), length * sizeof(CType));
+
+    auto min_array = ArrayData::Make(value_type, length,
+                                     {null_bitmap, std::move(min_data)}, null_count);
+    auto max_array = ArrayData::Make(value_type, length,
+                                     {null_bitmap, std::move(max_data)}, null_count);
+    return ArrayData::Make(out_type, length, {nullptr}, {min_array, max_array},
+                           /*null_count=*/0);
+  }
+
+  std::shared_ptr<DataType> out_type;
+  MinMaxOptions options;
+  MemoryPool* pool;
+  std::vector<CType> mins, maxes;
+  std::vector<bool> has_values, has_nulls;
+};
+
+struct GroupedMinMaxInitState {
+  template <typename T>
+  enable_if_t<is_integer_type<T>::value || is_physical_floating_type<T>::value, Status>
+  Visit(const T&) {
+    state.reset(new GroupedMinMaxImpl<T>(out_type, options, ctx->memory_pool()));
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Grouped min_max of type ", type);
+  }
+
+  std::unique_ptr<KernelState> Create(const DataType& type) {
+    ctx->SetStatus(VisitTypeInline(type, this));
+    return std::move(state);
+  }
+
+  KernelContext* ctx;
+  std::shared_ptr<DataType> out_type;
+  const MinMaxOptions& options;
+  std::unique_ptr<KernelState> state;
+};
+
+std::unique_ptr<KernelState> GroupedMinMaxInit(KernelContext* ctx,
+                                               const KernelInitArgs& args) {
+  GroupedMinMaxInitState visitor{ctx, args.kernel->signature->out_type().type(),
+                                 static_cast<const MinMaxOptions&>(*args.options),
+                                 nullptr};
+  return visitor.Create(*args.inputs[0].type);
+}
+
+// ----------------------------------------------------------------------
+// Kernel registration helpers
+
+HashAggregateKernel MakeKernel(InputType argument_type, OutputType out_type,
+                               KernelInit init) {
+  HashAggregateKernel kernel(
+      KernelSignature::Make({std::move(argument_type), InputType::Array(Type::UINT32)},
+                            std::move(out_type)),
+      std::move(init), HashAggregateResize, HashAggregateConsume, HashAggregateMerge,
+      HashAggregateFinalize);
+  return kernel;
+}
+
+void AddHashAggKernels(KernelInit init,
+                       const std::vector<std::shared_ptr<DataType>>& types,
+                       std::shared_ptr<DataType> out_ty, HashAggregateFunction* func) {
+  for (const auto& ty : types) {
+    // array[InT], array[uint32] -> array[OutT]
+    DCHECK_OK(func->AddKernel(
+        MakeKernel(InputType::Array(ty), ValueDescr::Array(out_ty), init)));
+  }
+}
+
+// ----------------------------------------------------------------------
+// GroupBy driver
+
+// The grouper and aggregation states for a disjoint part of the input
+struct GroupByPartial {
+  std::unique_ptr<Grouper> grouper;
+  std::vector<std::unique_ptr<KernelState>> states;
+  std::vector<KernelContext> kernel_ctxs;
+};
+
+Status InitPartial(const std::vector<const HashAggregateKernel*>& kernels,
+                   const std::vector<std::vector<ValueDescr>>& kernel_descrs,
+                   const std::vector<const FunctionOptions*>& options,
+                   const std::vector<ValueDescr>& key_descrs, ExecContext* ctx,
+                   GroupByPartial* partial) {
+  ARROW_ASSIGN_OR_RAISE(partial->grouper, Grouper::Make(key_descrs, ctx));
+  partial->states.resize(kernels.size());
+  partial->kernel_ctxs.assign(kernels.size(), KernelContext{ctx});
+  for (size_t i = 0; i < kernels.size(); ++i) {
+    KernelContext* kernel_ctx = &partial->kernel_ctxs[i];
+    KernelInitArgs init_args{kernels[i], kernel_descrs[i], options[i]};
+    partial->states[i] = kernels[i]->init(kernel_ctx, init_args);
+    ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+    kernel_ctx->SetState(partial->states[i].get());
+  }
+  return Status::OK();
+}
+
+Status ResizePartial(const std::vector<const HashAggregateKernel*>& kernels,
+                     GroupByPartial* partial) {
+  const int64_t num_groups = partial->grouper->num_groups();
+  for (size_t i = 0; i < kernels.size(); ++i) {
+    KernelContext* kernel_ctx = &partial->kernel_ctxs[i];
+    kernels[i]->resize(kernel_ctx, num_groups);
+    ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+  }
+  return Status::OK();
+}
+
+Status ConsumePartial(const std::vector<const HashAggregateKernel*>& kernels,
+                      const ExecBatch& batch, ExecContext* ctx,
+                      GroupByPartial* partial) {
+  const size_t num_arguments = kernels.size();
+
+  // Broadcast any scalar values to the length of the batch
+  std::vector<Datum> values(batch.values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (batch[i].is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(
+          values[i], MakeArrayFromScalar(*batch[i].scalar(), batch.length,
+                                         ctx->memory_pool()));
+    } else {
+      values[i] = batch[i];
+    }
+  }
+
+  ExecBatch key_batch(
+      std::vector<Datum>(values.begin() + num_arguments, values.end()), batch.length);
+  ARROW_ASSIGN_OR_RAISE(Datum group_ids, partial->grouper->Consume(key_batch));
+  RETURN_NOT_OK(ResizePartial(kernels, partial));
+
+  for (size_t i = 0; i < num_arguments; ++i) {
+    KernelContext* kernel_ctx = &partial->kernel_ctxs[i];
+    kernels[i]->consume(kernel_ctx, ExecBatch({values[i], group_ids}, batch.length));
+    ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+  }
+  return Status::OK();
+}
+
+Status MergePartial(const std::vector<const HashAggregateKernel*>& kernels,
+                    GroupByPartial&& other, GroupByPartial* partial) {
+  ARROW_ASSIGN_OR_RAISE(ExecBatch other_keys, other.grouper->GetUniques());
+  ARROW_ASSIGN_OR_RAISE(Datum transposition, partial->grouper->Consume(other_keys));
+  RETURN_NOT_OK(ResizePartial(kernels, partial));
+
+  for (size_t i = 0; i < kernels.size(); ++i) {
+    KernelContext* kernel_ctx = &partial->kernel_ctxs[i];
+    kernels[i]->merge(kernel_ctx, std::move(*other.states[i]), *transposition.array());
+    ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Result<Datum> GroupBy(const std::vector<Datum>& arguments, const std::vector<Datum>& keys,
+                      const std::vector<Aggregate>& aggregates, ExecContext* ctx) {
+  if (ctx == nullptr) {
+    ExecContext default_ctx;
+    return GroupBy(arguments, keys, aggregates, &default_ctx);
+  }
+  if (arguments.size() != aggregates.size()) {
+    return Status::Invalid("GroupBy got ", arguments.size(), " arguments for ",
+                           aggregates.size(), " aggregates");
+  }
+  if (keys.empty()) {
+    return Status::Invalid("GroupBy requires at least one key");
+  }
+
+  // Resolve the aggregate kernels
+  std::vector<const HashAggregateKernel*> kernels(aggregates.size());
+  std::vector<std::vector<ValueDescr>> kernel_descrs(aggregates.size());
+  std::vector<const FunctionOptions*> options(aggregates.size());
+  std::vector<std::shared_ptr<Field>> out_fields;
+  for (size_t i = 0; i < aggregates.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto function,
+                          ctx->func_registry()->GetFunction(aggregates[i].function));
+    if (function->kind() != Function::HASH_AGGREGATE) {
+      return Status::Invalid("The provided function (", aggregates[i].function,
+                             ") is not an aggregate function");
+    }
+    const auto& hash_function = checked_cast<const HashAggregateFunction&>(*function);
+    kernel_descrs[i] = {ValueDescr::Array(arguments[i].type()),
+                        ValueDescr::Array(uint32())};
+    ARROW_ASSIGN_OR_RAISE(kernels[i], hash_function.DispatchExact(kernel_descrs[i]));
+    options[i] = aggregates[i].options ? aggregates[i].options
+                                       : hash_function.default_options();
+
+    KernelContext kernel_ctx{ctx};
+    ARROW_ASSIGN_OR_RAISE(auto descr, kernels[i]->signature->out_type().Resolve(
+                                          &kernel_ctx, kernel_descrs[i]));
+    out_fields.push_back(field(aggregates[i].function, std::move(descr.type)));
+  }
+
+  std::vector<ValueDescr> key_descrs(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    key_descrs[i] = ValueDescr::Array(keys[i].type());
+  }
+
+  // Split the input into batches
+  std::vector<Datum> args(arguments);
+  args.insert(args.end(), keys.begin(), keys.end());
+  ARROW_ASSIGN_OR_RAISE(auto batch_iterator,
+                        ::arrow::compute::detail::ExecBatchIterator::Make(
+                            args, ctx->exec_chunksize()));
+  std::vector<ExecBatch> batches;
+  ExecBatch batch;
+  while (batch_iterator->Next(&batch)) {
+    if (batch.length > 0) {
+      batches.push_back(std::move(batch));
+    }
+  }
+
+  // Accumulate partial results, in parallel if permitted
+  int num_partials = 1;
+  if (ctx->use_threads()) {
+    num_partials = std::max(
+        1, std::min(::arrow::internal::GetCpuThreadPool()->GetCapacity(),
+                    static_cast<int>(batches.size())));
+  }
+  std::vector<GroupByPartial> partials(num_partials);
+  for (auto& partial : partials) {
+    RETURN_NOT_OK(
+        InitPartial(kernels, kernel_descrs, options, key_descrs, ctx, &partial));
+  }
+  RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+      num_partials > 1, num_partials, [&](int partial_index) {
+        GroupByPartial* partial = &partials[partial_index];
+        for (size_t i = partial_index; i < batches.size(); i += num_partials) {
+          RETURN_NOT_OK(ConsumePartial(kernels, batches[i], ctx, partial));
+        }
+        return Status::OK();
+      }));
+
+  GroupByPartial* result = &partials[0];
+  RETURN_NOT_OK(ResizePartial(kernels, result));
+  for (int i = 1; i < num_partials; ++i) {
+    RETURN_NOT_OK(MergePartial(kernels, std::move(partials[i]), result));
+  }
+
+  // Finalize the aggregates and append the keys
+  ArrayVector out_columns;
+  for (size_t i = 0; i < kernels.size(); ++i) {
+    KernelContext* kernel_ctx = &result->kernel_ctxs[i];
+    Datum out;
+    kernels[i]->finalize(kernel_ctx, &out);
+    ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+    out_columns.push_back(out.make_array());
+  }
+
+  ARROW_ASSIGN_OR_RAISE(ExecBatch uniques, result->grouper->GetUniques());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    out_columns.push_back(uniques[i].make_array());
+    out_fields.push_back(field("key_" + std::to_string(i), keys[i].type()));
+  }
+
+  const int64_t num_groups = result->grouper->num_groups();
+  return Datum(std::make_shared<StructArray>(struct_(std::move(out_fields)), num_groups,
+                                             std::move(out_columns)));
+}
+
+void RegisterHashAggregateBasic(FunctionRegistry* registry) {
+  static auto default_count_options = CountOptions::Defaults();
+  auto func = std::make_shared<HashAggregateFunction>("hash_count", Arity::Binary(),
+                                                      &default_count_options);
+  // Takes any array input, outputs int64 array
+  InputType any_array(ValueDescr::ARRAY);
+  DCHECK_OK(func->AddKernel(
+      MakeKernel(std::move(any_array), ValueDescr::Array(int64()), GroupedCountInit)));
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+
+  func = std::make_shared<HashAggregateFunction>("hash_sum", Arity::Binary());
+  AddHashAggKernels(GroupedSumInit<false>, SignedIntTypes(), int64(), func.get());
+  AddHashAggKernels(GroupedSumInit<false>, UnsignedIntTypes(), uint64(), func.get());
+  AddHashAggKernels(GroupedSumInit<false>, FloatingPointTypes(), float64(), func.get());
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+
+  func = std::make_shared<HashAggregateFunction>("hash_mean", Arity::Binary());
+  AddHashAggKernels(GroupedSumInit<true>, NumericTypes(), float64(), func.get());
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+
+  static auto default_minmax_options = MinMaxOptions::Defaults();
+  func = std::make_shared<HashAggregateFunction>("hash_min_max", Arity::Binary(),
+                                                 &default_minmax_options);
+  for (const auto& ty : NumericTypes()) {
+    // array[T], array[uint32] -> array[struct<min: T, max: T>]
+    auto out_ty = struct_({field("min", ty), field("max", ty)});
+    DCHECK_OK(func->AddKernel(MakeKernel(InputType::Array(ty), ValueDescr::Array(out_ty),
+                                         GroupedMinMaxInit)));
+  }
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
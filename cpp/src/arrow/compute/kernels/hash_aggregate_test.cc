@@ -0,0 +1,258 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::checked_pointer_cast;
+
+namespace compute {
+
+using internal::Aggregate;
+using internal::GroupBy;
+using internal::Grouper;
+
+Result<Datum> SerialGroupBy(const std::vector<Datum>& arguments,
+                            const std::vector<Datum>& keys,
+                            const std::vector<Aggregate>& aggregates) {
+  ExecContext ctx;
+  ctx.set_use_threads(false);
+  return GroupBy(arguments, keys, aggregates, &ctx);
+}
+
+TEST(Grouper, SingleKey) {
+  ASSERT_OK_AND_ASSIGN(auto grouper, Grouper::Make({ValueDescr::Array(int32())}));
+
+  auto keys = ArrayFromJSON(int32(), "[3, 1, null, 3, 1, 7, null]");
+  ASSERT_OK_AND_ASSIGN(Datum ids, grouper->Consume(ExecBatch({keys}, keys->length())));
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[0, 1, 2, 0, 1, 3, 2]"), *ids.make_array());
+  ASSERT_EQ(4, grouper->num_groups());
+
+  keys = ArrayFromJSON(int32(), "[7, 8]");
+  ASSERT_OK_AND_ASSIGN(ids, grouper->Consume(ExecBatch({keys}, keys->length())));
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[3, 4]"), *ids.make_array());
+
+  ASSERT_OK_AND_ASSIGN(ExecBatch uniques, grouper->GetUniques());
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[3, 1, null, 7, 8]"),
+                    *uniques[0].make_array());
+}
+
+TEST(Grouper, StringKey) {
+  ASSERT_OK_AND_ASSIGN(auto grouper, Grouper::Make({ValueDescr::Array(utf8())}));
+
+  auto keys = ArrayFromJSON(utf8(), R"(["eh", "bee", null, "eh", ""])");
+  ASSERT_OK_AND_ASSIGN(Datum ids, grouper->Consume(ExecBatch({keys}, keys->length())));
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[0, 1, 2, 0, 3]"), *ids.make_array());
+
+  ASSERT_OK_AND_ASSIGN(ExecBatch uniques, grouper->GetUniques());
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["eh", "bee", null, ""])"),
+                    *uniques[0].make_array());
+}
+
+TEST(Grouper, MultipleKeys) {
+  ASSERT_OK_AND_ASSIGN(auto grouper,
+                       Grouper::Make({ValueDescr::Array(int64()),
+                                      ValueDescr::Array(utf8()),
+                                      ValueDescr::Array(boolean())}));
+
+  auto ints = ArrayFromJSON(int64(), "[1, 1, null, 1, null, 2]");
+  auto strings = ArrayFromJSON(utf8(), R"(["a", "b", "a", "a", "a", null])");
+  auto bools = ArrayFromJSON(boolean(), "[true, true, false, true, false, null]");
+  ASSERT_OK_AND_ASSIGN(Datum ids,
+                       grouper->Consume(ExecBatch({ints, strings, bools}, 6)));
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[0, 1, 2, 0, 2, 3]"), *ids.make_array());
+
+  ASSERT_OK_AND_ASSIGN(ExecBatch uniques, grouper->GetUniques());
+  ASSERT_EQ(3, uniques.num_values());
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 1, null, 2]"), *uniques[0].make_array());
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["a", "b", "a", null])"),
+                    *uniques[1].make_array());
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, true, false, null]"),
+                    *uniques[2].make_array());
+}
+
+TEST(Grouper, Find) {
+  ASSERT_OK_AND_ASSIGN(auto grouper, Grouper::Make({ValueDescr::Array(utf8())}));
+  auto keys = ArrayFromJSON(utf8(), R"(["eh", "bee", "eh"])");
+  ASSERT_OK(grouper->Consume(ExecBatch({keys}, keys->length())));
+
+  keys = ArrayFromJSON(utf8(), R"(["bee", "sea", null, "eh"])");
+  ASSERT_OK_AND_ASSIGN(Datum ids, grouper->Find(ExecBatch({keys}, keys->length())));
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[1, null, null, 0]"), *ids.make_array());
+  ASSERT_EQ(2, grouper->num_groups());
+
+  ASSERT_OK_AND_ASSIGN(grouper, Grouper::Make({ValueDescr::Array(int32()),
+                                               ValueDescr::Array(boolean())}));
+  auto ints = ArrayFromJSON(int32(), "[1, 2, null]");
+  auto bools = ArrayFromJSON(boolean(), "[true, false, true]");
+  ASSERT_OK(grouper->Consume(ExecBatch({ints, bools}, 3)));
+
+  ints = ArrayFromJSON(int32(), "[null, 1, 2, 1]");
+  bools = ArrayFromJSON(boolean(), "[true, true, true, false]");
+  ASSERT_OK_AND_ASSIGN(ids, grouper->Find(ExecBatch({ints, bools}, 4)));
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[2, 0, null, null]"), *ids.make_array());
+  ASSERT_EQ(3, grouper->num_groups());
+}
+
+TEST(Grouper, MakeGroupings) {
+  auto ids = checked_pointer_cast<UInt32Array>(
+      ArrayFromJSON(uint32(), "[0, 2, 1, 0, 2, 2]"));
+  ASSERT_OK_AND_ASSIGN(auto groupings, Grouper::MakeGroupings(*ids, 4));
+  AssertArraysEqual(*ArrayFromJSON(list(int32()), "[[0, 3], [2], [1, 4, 5], []]"),
+                    *groupings);
+
+  auto values = ArrayFromJSON(utf8(), R"(["a", "b", "c", "d", "e", "f"])");
+  ASSERT_OK_AND_ASSIGN(auto grouped, Grouper::ApplyGroupings(*groupings, *values));
+  AssertArraysEqual(
+      *ArrayFromJSON(list(utf8()), R"([["a", "d"], ["c"], ["b", "e", "f"], []])"),
+      *grouped);
+
+  ids = checked_pointer_cast<UInt32Array>(ArrayFromJSON(uint32(), "[0, 4]"));
+  ASSERT_RAISES(Invalid, Grouper::MakeGroupings(*ids, 4));
+}
+
+TEST(GroupBy, SumCountMean) {
+  auto argument = ArrayFromJSON(float64(), "[1.0, 0.0, null, 4.0, 3.25, 0.125, -0.25]");
+  auto key = ArrayFromJSON(int64(), "[1, 2, 3, 1, 2, 2, null]");
+
+  CountOptions count_nulls(CountOptions::COUNT_NULL);
+  ASSERT_OK_AND_ASSIGN(Datum aggregated,
+                       SerialGroupBy({argument, argument, argument, argument}, {key},
+                                     {{"hash_sum", nullptr},
+                                      {"hash_count", nullptr},
+                                      {"hash_count", &count_nulls},
+                                      {"hash_mean", nullptr}}));
+
+  auto expected_type =
+      struct_({field("hash_sum", float64()), field("hash_count", int64()),
+               field("hash_count", int64()), field("hash_mean", float64()),
+               field("key_0", int64())});
+  AssertArraysEqual(*ArrayFromJSON(expected_type, R"([
+    [5.0,    2, 0, 2.5,    1],
+    [3.375,  3, 0, 1.125,  2],
+    [null,   0, 1, null,   3],
+    [-0.25,  1, 0, -0.25,  null]
+  ])"),
+                    *aggregated.make_array(), /*verbose=*/true);
+}
+
+TEST(GroupBy, MinMax) {
+  auto argument = ArrayFromJSON(int32(), "[5, null, -3, 8, 2, null]");
+  auto key = ArrayFromJSON(utf8(), R"(["x", "y", "x", "z", "z", "w"])");
+
+  MinMaxOptions output_null(MinMaxOptions::OUTPUT_NULL);
+  ASSERT_OK_AND_ASSIGN(Datum aggregated,
+                       SerialGroupBy({argument, argument}, {key},
+                                     {{"hash_min_max", nullptr},
+                                      {"hash_min_max", &output_null}}));
+
+  auto min_max_type = struct_({field("min", int32()), field("max", int32())});
+  auto expected_type =
+      struct_({field("hash_min_max", min_max_type), field("hash_min_max", min_max_type),
+               field("key_0", utf8())});
+  AssertArraysEqual(*ArrayFromJSON(expected_type, R"([
+    [{"min": -3, "max": 5},      {"min": -3, "max": 5},      "x"],
+    [{"min": null, "max": null}, {"min": null, "max": null}, "y"],
+    [{"min": 2, "max": 8},       {"min": 2, "max": 8},       "z"],
+    [{"min": null, "max": null}, {"min": null, "max": null}, "w"]
+  ])"),
+                    *aggregated.make_array(), /*verbose=*/true);
+}
+
+TEST(GroupBy, MultipleKeysChunked) {
+  auto argument = ChunkedArrayFromJSON(int64(), {"[1, 2, 3]", "[4, 5]", "[6]"});
+  auto key0 = ChunkedArrayFromJSON(int8(), {"[1, 1, 2]", "[1, 2]", "[2]"});
+  auto key1 = ChunkedArrayFromJSON(utf8(), {R"(["a", "b", "a"])", R"(["a", "a"])",
+                                            R"(["b"])"});
+
+  ASSERT_OK_AND_ASSIGN(Datum aggregated,
+                       SerialGroupBy({argument}, {key0, key1}, {{"hash_sum", nullptr}}));
+  auto expected_type = struct_(
+      {field("hash_sum", int64()), field("key_0", int8()), field("key_1", utf8())});
+  AssertArraysEqual(*ArrayFromJSON(expected_type, R"([
+    [5, 1, "a"],
+    [2, 1, "b"],
+    [8, 2, "a"],
+    [6, 2, "b"]
+  ])"),
+                    *aggregated.make_array(), /*verbose=*/true);
+}
+
+TEST(GroupBy, ParallelMergeMatchesSerial) {
+  auto rand = random::RandomArrayGenerator(kRandomSeed);
+  const int64_t length = 1 << 14;
+  auto argument = rand.Int64(length, -100, 100, /*null_probability=*/0.1);
+  auto key = rand.Int32(length, 0, 256, /*null_probability=*/0.05);
+
+  ExecContext threaded_ctx;
+  threaded_ctx.set_use_threads(true);
+  threaded_ctx.set_exec_chunksize(512);
+  ASSERT_OK_AND_ASSIGN(
+      Datum threaded,
+      GroupBy({argument}, {key}, {{"hash_sum", nullptr}}, &threaded_ctx));
+  ASSERT_OK_AND_ASSIGN(Datum serial,
+                       SerialGroupBy({argument}, {key}, {{"hash_sum", nullptr}}));
+
+  auto ToMap = [](const Datum& datum) {
+    const auto& result = checked_cast<const StructArray&>(*datum.make_array());
+    const auto& sums = checked_cast<const Int64Array&>(*result.field(0));
+    const auto& keys = checked_cast<const Int32Array&>(*result.field(1));
+    std::unordered_map<std::string, std::string> out;
+    for (int64_t i = 0; i < result.length(); ++i) {
+      out[keys.IsValid(i) ? std::to_string(keys.Value(i)) : "null"] =
+          sums.IsValid(i) ? std::to_string(sums.Value(i)) : "null";
+    }
+    return out;
+  };
+  ASSERT_EQ(threaded.length(), serial.length());
+  ASSERT_EQ(ToMap(serial), ToMap(threaded));
+}
+
+TEST(GroupBy, Errors) {
+  auto argument = ArrayFromJSON(int32(), "[1, 2]");
+  auto key = ArrayFromJSON(int32(), "[1, 2]");
+
+  ASSERT_RAISES(Invalid, SerialGroupBy({argument}, {}, {{"hash_sum", nullptr}}));
+  ASSERT_RAISES(Invalid, SerialGroupBy({argument}, {key}, {}));
+  ASSERT_RAISES(Invalid, SerialGroupBy({argument}, {key}, {{"sum", nullptr}}));
+  ASSERT_RAISES(NotImplemented,
+                SerialGroupBy({ArrayFromJSON(utf8(), R"(["a", "b"])")}, {key},
+                              {{"hash_sum", nullptr}}));
+  ASSERT_RAISES(NotImplemented,
+                CallFunction("hash_sum", {argument, ArrayFromJSON(uint32(), "[0, 0]")}));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,402 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/util.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_join.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/scalar_hash_internal.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/make_unique.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::checked_pointer_cast;
+
+namespace compute {
+
+using internal::Grouper;
+using internal::HashBatch;
+
+namespace {
+
+// Build sides larger than this are radix-partitioned by default, into
+// partitions of about kRowsPerPartition rows whose hash tables fit in cache
+constexpr int64_t kMaxUnpartitionedRows = 1 << 20;
+constexpr int64_t kRowsPerPartition = 1 << 16;
+
+// Mark the rows having a null in any key as unmatchable
+void ClearNullKeys(const ExecBatch& keys, uint8_t* matchable) {
+  for (const auto& key : keys.values) {
+    const ArrayData& data = *key.array();
+    if (data.GetNullCount() == 0) {
+      continue;
+    }
+    const uint8_t* validity = data.buffers[0]->data();
+    for (int64_t i = 0; i < data.length; ++i) {
+      matchable[i] &= BitUtil::GetBit(validity, data.offset + i);
+    }
+  }
+}
+
+// Split the row indices [0, length) by partition, as a list of indices for each
+// partition
+std::vector<std::vector<uint64_t>> SplitByPartition(const uint64_t* hashes,
+                                                    int64_t length, uint64_t mask,
+                                                    int32_t* row_partitions) {
+  std::vector<std::vector<uint64_t>> rows(mask + 1);
+  for (int64_t i = 0; i < length; ++i) {
+    const auto partition = static_cast<int32_t>(hashes[i] & mask);
+    row_partitions[i] = partition;
+    rows[partition].push_back(static_cast<uint64_t>(i));
+  }
+  return rows;
+}
+
+Result<std::shared_ptr<Array>> MakeIndices(const std::vector<uint64_t>& indices,
+                                           ExecContext* ctx) {
+  const auto length = static_cast<int64_t>(indices.size());
+  ARROW_ASSIGN_OR_RAISE(auto buffer,
+                        AllocateBuffer(length * sizeof(uint64_t), ctx->memory_pool()));
+  std::copy(indices.begin(), indices.end(),
+            reinterpret_cast<uint64_t*>(buffer->mutable_data()));
+  return std::make_shared<UInt64Array>(length, std::move(buffer));
+}
+
+Result<ExecBatch> TakeKeys(const ExecBatch& keys, const std::vector<uint64_t>& rows,
+                           ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(auto indices, MakeIndices(rows, ctx));
+  ExecBatch out({}, static_cast<int64_t>(rows.size()));
+  for (const auto& key : keys.values) {
+    ARROW_ASSIGN_OR_RAISE(Datum taken, Take(key, indices, TakeOptions::NoBoundsCheck(),
+                                            ctx));
+    out.values.push_back(std::move(taken));
+  }
+  return out;
+}
+
+// Get a column of a table with combined chunks as a single Array
+Result<std::shared_ptr<Array>> GetColumnArray(const Table& table, int i,
+                                              MemoryPool* pool) {
+  const auto& column = table.column(i);
+  if (column->num_chunks() == 0) {
+    return MakeArrayOfNull(column->type(), 0, pool);
+  }
+  DCHECK_EQ(column->num_chunks(), 1);
+  return column->chunk(0);
+}
+
+Result<std::vector<int>> FindKeyColumns(const Schema& schema,
+                                        const std::vector<std::string>& keys) {
+  if (keys.empty()) {
+    return Status::Invalid("Hash join requires at least one key");
+  }
+  std::vector<int> indices;
+  for (const auto& key : keys) {
+    const int i = schema.GetFieldIndex(key);
+    if (i < 0) {
+      return Status::Invalid("No key column named '", key, "' in ", schema.ToString());
+    }
+    indices.push_back(i);
+  }
+  return indices;
+}
+
+}  // namespace
+
+// The hash table of one partition of the build side.  The build rows of group
+// id g are rows[offsets[g]:offsets[g + 1]].
+struct HashJoinTable::Partition {
+  std::unique_ptr<Grouper> grouper;
+  std::vector<int64_t> offsets;
+  std::vector<uint64_t> rows;
+
+  // Group the build rows of this partition, given their keys and their
+  // indices in the build table
+  Status Build(const ExecBatch& keys, const std::vector<uint64_t>* build_rows) {
+    ARROW_ASSIGN_OR_RAISE(Datum ids_datum, grouper->Consume(keys));
+    const uint32_t* ids = ids_datum.array()->GetValues<uint32_t>(1);
+    const int64_t length = keys.length;
+
+    offsets.assign(grouper->num_groups() + 1, 0);
+    for (int64_t i = 0; i < length; ++i) {
+      ++offsets[ids[i] + 1];
+    }
+    for (uint32_t g = 0; g < grouper->num_groups(); ++g) {
+      offsets[g + 1] += offsets[g];
+    }
+    std::vector<int64_t> cursors(offsets.begin(), offsets.end() - 1);
+    rows.resize(length);
+    for (int64_t i = 0; i < length; ++i) {
+      rows[cursors[ids[i]]++] =
+          build_rows != nullptr ? (*build_rows)[i] : static_cast<uint64_t>(i);
+    }
+    return Status::OK();
+  }
+};
+
+HashJoinTable::HashJoinTable(ExecContext* ctx) : ctx_(ctx) {}
+
+HashJoinTable::~HashJoinTable() = default;
+
+Result<std::unique_ptr<HashJoinTable>> HashJoinTable::Make(
+    std::shared_ptr<Table> build, const std::vector<std::string>& keys,
+    int num_partitions, ExecContext* ctx) {
+  if (ctx == nullptr) {
+    static ExecContext default_ctx;
+    ctx = &default_ctx;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto key_indices, FindKeyColumns(*build->schema(), keys));
+
+  if (num_partitions == 0) {
+    num_partitions = 1;
+    if (build->num_rows() > kMaxUnpartitionedRows) {
+      num_partitions = static_cast<int>(
+          BitUtil::NextPower2(BitUtil::CeilDiv(build->num_rows(), kRowsPerPartition)));
+    }
+  }
+  if (num_partitions < 0 || !BitUtil::IsPowerOf2(static_cast<int64_t>(num_partitions))) {
+    return Status::Invalid("Hash join partition count must be a power of two, got ",
+                           num_partitions);
+  }
+
+  std::unique_ptr<HashJoinTable> table(new HashJoinTable(ctx));
+  ARROW_ASSIGN_OR_RAISE(table->build_, build->CombineChunks(ctx->memory_pool()));
+
+  ExecBatch build_keys({}, table->build_->num_rows());
+  std::vector<ValueDescr> descrs;
+  for (int i : key_indices) {
+    ARROW_ASSIGN_OR_RAISE(auto column,
+                          GetColumnArray(*table->build_, i, ctx->memory_pool()));
+    table->key_types_.push_back(column->type());
+    descrs.push_back(ValueDescr::Array(column->type()));
+    build_keys.values.emplace_back(std::move(column));
+  }
+
+  for (int p = 0; p < num_partitions; ++p) {
+    auto partition = ::arrow::internal::make_unique<Partition>();
+    ARROW_ASSIGN_OR_RAISE(partition->grouper, Grouper::Make(descrs, ctx));
+    table->partitions_.push_back(std::move(partition));
+  }
+
+  if (num_partitions == 1) {
+    RETURN_NOT_OK(table->partitions_[0]->Build(build_keys, /*build_rows=*/nullptr));
+    return std::move(table);
+  }
+
+  // Scatter the build rows into partitions, then build each partition's hash
+  // table in turn so that only one of them needs to be cache-resident
+  const int64_t length = build_keys.length;
+  table->hashes_.resize(length);
+  table->row_partitions_.resize(length);
+  RETURN_NOT_OK(HashBatch(build_keys, table->hashes_.data()));
+  auto partition_rows =
+      SplitByPartition(table->hashes_.data(), length, num_partitions - 1,
+                       table->row_partitions_.data());
+  for (int p = 0; p < num_partitions; ++p) {
+    ARROW_ASSIGN_OR_RAISE(ExecBatch keys, TakeKeys(build_keys, partition_rows[p], ctx));
+    RETURN_NOT_OK(table->partitions_[p]->Build(keys, &partition_rows[p]));
+  }
+  return std::move(table);
+}
+
+Result<JoinIndices> HashJoinTable::Probe(const ExecBatch& keys, JoinType join_type) {
+  if (keys.num_values() != static_cast<int>(key_types_.size())) {
+    return Status::Invalid("Hash join expected ", key_types_.size(),
+                           " probe keys but got ", keys.num_values());
+  }
+  for (int i = 0; i < keys.num_values(); ++i) {
+    if (!keys[i].is_array()) {
+      return Status::NotImplemented("Probing with scalar keys");
+    }
+    if (!keys[i].type()->Equals(*key_types_[i])) {
+      return Status::TypeError("Probe key ", i, " has type ", *keys[i].type(),
+                               " but build key has type ", *key_types_[i]);
+    }
+  }
+  const int64_t length = keys.length;
+
+  // Find the group of each probe row in its partition
+  group_ids_.resize(length);
+  matched_.assign(length, 1);
+  row_partitions_.assign(length, 0);
+  ClearNullKeys(keys, matched_.data());
+
+  auto FindGroups = [&](Partition* partition, const ExecBatch& partition_keys,
+                        const std::vector<uint64_t>* probe_rows) -> Status {
+    ARROW_ASSIGN_OR_RAISE(Datum found_datum, partition->grouper->Find(partition_keys));
+    const UInt32Array found(found_datum.array());
+    for (int64_t i = 0; i < found.length(); ++i) {
+      const uint64_t row = probe_rows != nullptr ? (*probe_rows)[i] : i;
+      group_ids_[row] = found.Value(i);
+      matched_[row] &= found.IsValid(i);
+    }
+    return Status::OK();
+  };
+
+  if (partitions_.size() == 1) {
+    RETURN_NOT_OK(FindGroups(partitions_[0].get(), keys, /*probe_rows=*/nullptr));
+  } else {
+    hashes_.resize(length);
+    RETURN_NOT_OK(HashBatch(keys, hashes_.data()));
+    auto partition_rows = SplitByPartition(
+        hashes_.data(), length, partitions_.size() - 1, row_partitions_.data());
+    for (size_t p = 0; p < partitions_.size(); ++p) {
+      if (partition_rows[p].empty()) {
+        continue;
+      }
+      ARROW_ASSIGN_OR_RAISE(ExecBatch partition_keys,
+                            TakeKeys(keys, partition_rows[p], ctx_));
+      RETURN_NOT_OK(FindGroups(partitions_[p].get(), partition_keys, &partition_rows[p]));
+    }
+  }
+
+  // Emit the matches in probe row order
+  std::vector<uint64_t> probe_indices, build_indices;
+  TypedBufferBuilder<bool> build_validity(ctx_->memory_pool());
+  const bool emit_build_indices =
+      join_type == JoinType::INNER || join_type == JoinType::LEFT_OUTER;
+  for (int64_t i = 0; i < length; ++i) {
+    switch (join_type) {
+      case JoinType::LEFT_SEMI:
+        if (matched_[i]) probe_indices.push_back(i);
+        break;
+      case JoinType::LEFT_ANTI:
+        if (!matched_[i]) probe_indices.push_back(i);
+        break;
+      case JoinType::INNER:
+      case JoinType::LEFT_OUTER:
+        if (matched_[i]) {
+          const Partition& partition = *partitions_[row_partitions_[i]];
+          const int64_t begin = partition.offsets[group_ids_[i]];
+          const int64_t end = partition.offsets[group_ids_[i] + 1];
+          for (int64_t j = begin; j < end; ++j) {
+            probe_indices.push_back(i);
+            build_indices.push_back(partition.rows[j]);
+          }
+          if (join_type == JoinType::LEFT_OUTER) {
+            RETURN_NOT_OK(build_validity.Append(end - begin, true));
+          }
+        } else if (join_type == JoinType::LEFT_OUTER) {
+          probe_indices.push_back(i);
+          build_indices.push_back(0);
+          RETURN_NOT_OK(build_validity.Append(false));
+        }
+        break;
+    }
+  }
+
+  JoinIndices out;
+  ARROW_ASSIGN_OR_RAISE(auto probe_array, MakeIndices(probe_indices, ctx_));
+  out.probe_indices = checked_pointer_cast<UInt64Array>(std::move(probe_array));
+  if (emit_build_indices) {
+    ARROW_ASSIGN_OR_RAISE(auto build_array, MakeIndices(build_indices, ctx_));
+    const int64_t null_count = build_validity.false_count();
+    if (null_count > 0) {
+      std::shared_ptr<Buffer> validity;
+      RETURN_NOT_OK(build_validity.Finish(&validity));
+      out.build_indices = std::make_shared<UInt64Array>(
+          build_array->length(), build_array->data()->buffers[1], std::move(validity),
+          null_count);
+    } else {
+      out.build_indices = checked_pointer_cast<UInt64Array>(std::move(build_array));
+    }
+  }
+  return out;
+}
+
+Result<std::shared_ptr<Table>> HashJoin(const std::shared_ptr<Table>& left,
+                                        const std::shared_ptr<Table>& right,
+                                        const HashJoinOptions& options,
+                                        ExecContext* ctx) {
+  if (ctx == nullptr) {
+    static ExecContext default_ctx;
+    ctx = &default_ctx;
+  }
+  if (options.left_keys.size() != options.right_keys.size()) {
+    return Status::Invalid("Hash join got ", options.left_keys.size(),
+                           " left keys but ", options.right_keys.size(), " right keys");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto left_key_indices,
+                        FindKeyColumns(*left->schema(), options.left_keys));
+  ARROW_ASSIGN_OR_RAISE(auto hash_table,
+                        HashJoinTable::Make(right, options.right_keys,
+                                            options.num_partitions, ctx));
+  const auto& build = hash_table->build_table();
+
+  const bool emit_build_columns = options.join_type == JoinType::INNER ||
+                                  options.join_type == JoinType::LEFT_OUTER;
+  std::vector<std::shared_ptr<Field>> fields = left->schema()->fields();
+  ArrayVector build_columns;
+  if (emit_build_columns) {
+    for (int i = 0; i < build->num_columns(); ++i) {
+      fields.push_back(build->schema()->field(i));
+      ARROW_ASSIGN_OR_RAISE(auto column, GetColumnArray(*build, i, ctx->memory_pool()));
+      build_columns.push_back(std::move(column));
+    }
+  }
+  auto out_schema = schema(std::move(fields), left->schema()->metadata());
+
+  std::vector<std::shared_ptr<RecordBatch>> out_batches;
+  TableBatchReader reader(*left);
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(reader.ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    ExecBatch probe_keys({}, batch->num_rows());
+    for (int i : left_key_indices) {
+      probe_keys.values.emplace_back(batch->column(i));
+    }
+    ARROW_ASSIGN_OR_RAISE(JoinIndices indices,
+                          hash_table->Probe(probe_keys, options.join_type));
+
+    ArrayVector columns;
+    for (const auto& column : batch->columns()) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto taken,
+          Take(*column, *indices.probe_indices, TakeOptions::NoBoundsCheck(), ctx));
+      columns.push_back(std::move(taken));
+    }
+    for (const auto& column : build_columns) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto taken,
+          Take(*column, *indices.build_indices, TakeOptions::NoBoundsCheck(), ctx));
+      columns.push_back(std::move(taken));
+    }
+    out_batches.push_back(RecordBatch::Make(out_schema, indices.probe_indices->length(),
+                                            std::move(columns)));
+  }
+  return Table::FromRecordBatches(out_schema, std::move(out_batches));
+}
+
+}  // namespace compute
+}  // namespace arrow
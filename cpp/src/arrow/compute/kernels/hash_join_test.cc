@@ -0,0 +1,181 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/compute/api_join.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+class TestHashJoin : public ::testing::Test {
+ public:
+  void SetUp() override {
+    left_ = TableFromJSON(schema({field("k", int32()), field("lv", utf8())}),
+                          {R"([[1, "a"], [2, "b"]])", R"([[3, "c"], [null, "d"]])",
+                           R"([[2, "e"]])"});
+    right_ = TableFromJSON(schema({field("k", int32()), field("rv", float64())}),
+                           {R"([[2, 20], [2, 21], [1, 10]])", R"([[null, 0], [4, 40]])"});
+  }
+
+  void AssertJoin(JoinType join_type, const std::string& expected_json) {
+    for (int num_partitions : {1, 4}) {
+      HashJoinOptions options(join_type, {"k"}, {"k"}, num_partitions);
+      ASSERT_OK_AND_ASSIGN(auto joined, HashJoin(left_, right_, options));
+      ASSERT_OK(joined->ValidateFull());
+      auto expected = TableFromJSON(joined->schema(), {expected_json});
+      AssertTablesEqual(*expected, *joined, /*same_chunk_layout=*/false);
+    }
+  }
+
+ protected:
+  std::shared_ptr<Table> left_, right_;
+};
+
+TEST_F(TestHashJoin, Inner) {
+  AssertJoin(JoinType::INNER, R"([
+    [1, "a", 1, 10],
+    [2, "b", 2, 20],
+    [2, "b", 2, 21],
+    [2, "e", 2, 20],
+    [2, "e", 2, 21]
+  ])");
+}
+
+TEST_F(TestHashJoin, LeftOuter) {
+  AssertJoin(JoinType::LEFT_OUTER, R"([
+    [1,    "a", 1,    10],
+    [2,    "b", 2,    20],
+    [2,    "b", 2,    21],
+    [3,    "c", null, null],
+    [null, "d", null, null],
+    [2,    "e", 2,    20],
+    [2,    "e", 2,    21]
+  ])");
+}
+
+TEST_F(TestHashJoin, LeftSemi) {
+  AssertJoin(JoinType::LEFT_SEMI, R"([[1, "a"], [2, "b"], [2, "e"]])");
+}
+
+TEST_F(TestHashJoin, LeftAnti) {
+  AssertJoin(JoinType::LEFT_ANTI, R"([[3, "c"], [null, "d"]])");
+}
+
+TEST(HashJoin, MultipleKeys) {
+  auto left = TableFromJSON(schema({field("a", int64()), field("b", utf8())}),
+                            {R"([[1, "x"], [1, "y"], [2, "x"], [2, null]])"});
+  auto right = TableFromJSON(schema({field("c", utf8()), field("d", int64())}),
+                             {R"([["x", 2], ["y", 1], [null, 2], ["x", 1]])"});
+  HashJoinOptions options(JoinType::INNER, {"a", "b"}, {"d", "c"});
+  ASSERT_OK_AND_ASSIGN(auto joined, HashJoin(left, right, options));
+  auto expected = TableFromJSON(joined->schema(), {R"([
+    [1, "x", "x", 1],
+    [1, "y", "y", 1],
+    [2, "x", "x", 2]
+  ])"});
+  AssertTablesEqual(*expected, *joined, /*same_chunk_layout=*/false);
+}
+
+TEST(HashJoin, ProbeIndices) {
+  auto build = TableFromJSON(schema({field("k", utf8())}),
+                             {R"([["a"], ["b"], ["a"]])", R"([["c"]])"});
+  ASSERT_OK_AND_ASSIGN(auto table, HashJoinTable::Make(build, {"k"}));
+  ASSERT_EQ(1, table->num_partitions());
+
+  auto keys = ArrayFromJSON(utf8(), R"(["c", "z", "a", null])");
+  ASSERT_OK_AND_ASSIGN(auto indices,
+                       table->Probe(ExecBatch({keys}, keys->length()), JoinType::INNER));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[0, 2, 2]"), *indices.probe_indices);
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[3, 0, 2]"), *indices.build_indices);
+
+  ASSERT_OK_AND_ASSIGN(indices, table->Probe(ExecBatch({keys}, keys->length()),
+                                             JoinType::LEFT_OUTER));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[0, 1, 2, 2, 3]"), *indices.probe_indices);
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[3, null, 0, 2, null]"),
+                    *indices.build_indices);
+
+  ASSERT_OK_AND_ASSIGN(indices, table->Probe(ExecBatch({keys}, keys->length()),
+                                             JoinType::LEFT_ANTI));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[1, 3]"), *indices.probe_indices);
+  ASSERT_EQ(nullptr, indices.build_indices);
+
+  auto wrong_type = ArrayFromJSON(int32(), "[1]");
+  ASSERT_RAISES(TypeError, table->Probe(ExecBatch({wrong_type}, 1), JoinType::INNER));
+}
+
+// With many partitions, the join should produce the same rows as without
+TEST(HashJoin, PartitionedMatchesUnpartitioned) {
+  auto rand = random::RandomArrayGenerator(kRandomSeed);
+  const int64_t left_length = 5000, right_length = 3000;
+  auto left_schema = schema({field("k", int64()), field("lv", int32())});
+  auto right_schema = schema({field("k", int64()), field("rv", int32())});
+  auto left = Table::Make(
+      left_schema, {rand.Int64(left_length, 0, 2000, /*null_probability=*/0.05),
+                    rand.Int32(left_length, 0, 100, /*null_probability=*/0)});
+  auto right = Table::Make(
+      right_schema, {rand.Int64(right_length, 0, 2000, /*null_probability=*/0.05),
+                     rand.Int32(right_length, 0, 100, /*null_probability=*/0)});
+
+  for (auto join_type : {JoinType::INNER, JoinType::LEFT_OUTER, JoinType::LEFT_SEMI,
+                         JoinType::LEFT_ANTI}) {
+    ASSERT_OK_AND_ASSIGN(
+        auto expected,
+        HashJoin(left, right, HashJoinOptions(join_type, {"k"}, {"k"}, 1)));
+    ASSERT_OK_AND_ASSIGN(
+        auto actual,
+        HashJoin(left, right, HashJoinOptions(join_type, {"k"}, {"k"}, 64)));
+    ASSERT_OK(actual->ValidateFull());
+
+    // Matches of a given probe row may come in a different order, so compare
+    // after sorting on all columns
+    std::vector<SortKey> sort_keys;
+    for (const auto& field : expected->schema()->fields()) {
+      sort_keys.emplace_back(field->name());
+    }
+    auto Sorted = [&](const std::shared_ptr<Table>& table) {
+      auto indices = SortIndices(Datum(table), SortOptions(sort_keys)).ValueOrDie();
+      return Take(Datum(table), Datum(indices)).ValueOrDie().table();
+    };
+    AssertTablesEqual(*Sorted(expected), *Sorted(actual), /*same_chunk_layout=*/false);
+  }
+}
+
+TEST(HashJoin, Errors) {
+  auto left = TableFromJSON(schema({field("k", int32())}), {"[[1]]"});
+  auto right = TableFromJSON(schema({field("k", int32())}), {"[[1]]"});
+  ASSERT_RAISES(Invalid, HashJoin(left, right, HashJoinOptions()));
+  ASSERT_RAISES(Invalid,
+                HashJoin(left, right, HashJoinOptions(JoinType::INNER, {"k"}, {})));
+  ASSERT_RAISES(Invalid,
+                HashJoin(left, right, HashJoinOptions(JoinType::INNER, {"k"}, {"x"})));
+  ASSERT_RAISES(Invalid, HashJoin(left, right,
+                                  HashJoinOptions(JoinType::INNER, {"k"}, {"k"}, 3)));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,213 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Sweep of every registered scalar, vector and scalar aggregate kernel whose
+// inputs are of exact types, across array sizes (cache-resident and DRAM),
+// null densities and slicing offsets.
+//
+// Each benchmark is named "KernelMatrix/<function>(<input types>)" and
+// reports its parameters as counters, so that runs with
+// --benchmark_format=json can be diffed (e.g. with archery or
+// compare.py) to validate SIMD dispatch and bit-block optimizations.
+// Kernels which can't run on random inputs with the default options
+// (e.g. "take" with out of bounds indices) are reported as skipped.
+
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/function.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/registry.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/benchmark_util.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+namespace compute {
+
+using internal::checked_cast;
+
+constexpr auto kSeed = 0x3b9a1f27;
+
+// The array sizes, in bytes of values per input
+static const std::vector<int64_t> kMatrixSizes = {kL2Size, kCantFitInL3Size};
+static const std::vector<int64_t> kNullPercents = {0, 1, 10, 50, 100};
+// A non-zero offset isn't byte-aligned in the validity bitmaps
+static const std::vector<int64_t> kOffsets = {0, 3};
+
+// Whether random arrays of this type can be generated
+static bool CanGenerate(const DataType& type) {
+  const auto id = type.id();
+  return id == Type::BOOL || is_integer(id) || is_floating(id) ||
+         is_base_binary_like(id) || is_fixed_size_binary(id) || id == Type::DATE32 ||
+         id == Type::DATE64 || id == Type::TIMESTAMP || id == Type::TIME32 ||
+         id == Type::TIME64;
+}
+
+// The number of values of `type` in `nbytes`
+static int64_t LengthForBytes(const DataType& type, int64_t nbytes) {
+  if (is_base_binary_like(type.id())) {
+    // Offsets and a few bytes of data per value
+    return std::max<int64_t>(1, nbytes / 16);
+  }
+  const int bit_width = checked_cast<const FixedWidthType&>(type).bit_width();
+  return std::max<int64_t>(1, nbytes * 8 / bit_width);
+}
+
+static int64_t DataBytes(const ArrayData& data) {
+  int64_t nbytes = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) {
+      nbytes += buffer->size();
+    }
+  }
+  return nbytes;
+}
+
+struct KernelMatrixCase {
+  std::string function_name;
+  std::vector<std::shared_ptr<DataType>> arg_types;
+};
+
+static void KernelMatrix(benchmark::State& state,  // NOLINT non-const reference
+                         const KernelMatrixCase& matrix_case) {
+  const int64_t size = state.range(0);
+  const int64_t null_percent = state.range(1);
+  const int64_t offset = state.range(2);
+
+  random::RandomArrayGenerator rand(kSeed);
+  std::vector<Datum> args;
+  int64_t num_items = 0;
+  int64_t num_bytes = 0;
+  for (const auto& type : matrix_case.arg_types) {
+    const int64_t length = LengthForBytes(*type, size);
+    auto array = rand.ArrayOf(type, length + offset, null_percent / 100.0)
+                     ->Slice(offset, length);
+    num_items = std::max(num_items, length);
+    num_bytes += DataBytes(*array->data());
+    args.emplace_back(std::move(array));
+  }
+
+  // Check the kernel runs on these inputs before timing it
+  auto maybe_result = CallFunction(matrix_case.function_name, args);
+  if (!maybe_result.ok()) {
+    state.SkipWithError(maybe_result.status().ToString().c_str());
+    return;
+  }
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(CallFunction(matrix_case.function_name, args).status());
+  }
+
+  state.counters["size"] = static_cast<double>(size);
+  state.counters["null_percent"] = static_cast<double>(null_percent);
+  state.counters["offset"] = static_cast<double>(offset);
+  state.SetItemsProcessed(state.iterations() * num_items);
+  state.SetBytesProcessed(state.iterations() * num_bytes);
+}
+
+static void KernelMatrixArgs(benchmark::internal::Benchmark* bench) {
+  bench->Unit(benchmark::kMicrosecond);
+  bench->ArgNames({"size", "null_percent", "offset"});
+  for (const auto size : kMatrixSizes) {
+    for (const auto null_percent : kNullPercents) {
+      for (const auto offset : kOffsets) {
+        bench->Args({static_cast<ArgsType>(size), static_cast<ArgsType>(null_percent),
+                     static_cast<ArgsType>(offset)});
+      }
+    }
+  }
+}
+
+template <typename FunctionType>
+static void AddKernelCases(const FunctionType& func,
+                           std::vector<KernelMatrixCase>* cases) {
+  for (const auto* kernel : func.kernels()) {
+    const auto& in_types = kernel->signature->in_types();
+    if (in_types.empty()) {
+      continue;
+    }
+    KernelMatrixCase matrix_case{func.name(), {}};
+    // Varargs kernels repeat their last input type
+    const size_t num_args =
+        std::max(in_types.size(), static_cast<size_t>(func.arity().num_args));
+    bool supported = true;
+    for (size_t i = 0; i < num_args && supported; ++i) {
+      const auto& in_type = in_types[std::min(i, in_types.size() - 1)];
+      supported = in_type.kind() == InputType::EXACT_TYPE &&
+                  in_type.shape() != ValueDescr::SCALAR && CanGenerate(*in_type.type());
+      if (supported) {
+        matrix_case.arg_types.push_back(in_type.type());
+      }
+    }
+    if (supported) {
+      cases->push_back(std::move(matrix_case));
+    }
+  }
+}
+
+static std::string CaseName(const KernelMatrixCase& matrix_case) {
+  std::string name = "KernelMatrix/" + matrix_case.function_name + "(";
+  for (size_t i = 0; i < matrix_case.arg_types.size(); ++i) {
+    if (i > 0) {
+      name += ",";
+    }
+    name += matrix_case.arg_types[i]->ToString();
+  }
+  return name + ")";
+}
+
+// Register a benchmark per kernel, before the benchmark library parses its flags
+static int RegisterKernelMatrix() {
+  FunctionRegistry* registry = GetFunctionRegistry();
+  std::vector<KernelMatrixCase> cases;
+  for (const auto& name : registry->GetFunctionNames()) {
+    auto func = registry->GetFunction(name).ValueOrDie();
+    switch (func->kind()) {
+      case Function::SCALAR:
+        AddKernelCases(checked_cast<const ScalarFunction&>(*func), &cases);
+        break;
+      case Function::VECTOR:
+        AddKernelCases(checked_cast<const VectorFunction&>(*func), &cases);
+        break;
+      case Function::SCALAR_AGGREGATE:
+        AddKernelCases(checked_cast<const ScalarAggregateFunction&>(*func), &cases);
+        break;
+      default:
+        break;
+    }
+  }
+  for (const auto& matrix_case : cases) {
+    benchmark::RegisterBenchmark(CaseName(matrix_case).c_str(), KernelMatrix,
+                                 matrix_case)
+        ->Apply(KernelMatrixArgs);
+  }
+  return static_cast<int>(cases.size());
+}
+
+static const int kNumKernelMatrixCases = RegisterKernelMatrix();
+
+}  // namespace compute
+}  // namespace arrow
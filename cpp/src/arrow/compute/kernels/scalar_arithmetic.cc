@@ -15,6 +15,9 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <cstring>
+
 #include "arrow/compute/kernels/common.h"
 #include "arrow/util/int_util_internal.h"
 #include "arrow/util/macros.h"
@@ -269,7 +272,9 @@ std::shared_ptr<ScalarFunction> MakeArithmeticFunction(std::string name) {
   auto func = std::make_shared<ScalarFunction>(name, Arity::Binary());
   for (const auto& ty : NumericTypes()) {
     auto exec = NumericEqualTypesBinary<ScalarBinaryEqualTypes, Op>(ty);
-    DCHECK_OK(func->AddKernel({ty, ty}, ty, exec));
+    ScalarKernel kernel({ty, ty}, ty, exec);
+    kernel.can_write_in_place = true;
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
   }
   return func;
 }
@@ -281,16 +286,221 @@ std::shared_ptr<ScalarFunction> MakeArithmeticFunctionNotNull(std::string name)
   auto func = std::make_shared<ScalarFunction>(name, Arity::Binary());
   for (const auto& ty : NumericTypes()) {
     auto exec = NumericEqualTypesBinary<ScalarBinaryNotNullEqualTypes, Op>(ty);
-    DCHECK_OK(func->AddKernel({ty, ty}, ty, exec));
+    ScalarKernel kernel({ty, ty}, ty, exec);
+    kernel.can_write_in_place = true;
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
   }
   return func;
 }
 
+// ----------------------------------------------------------------------
+// Decimal arithmetic
+//
+// The operands are first scaled up to the scale the operation needs (a common
+// scale for add and subtract, the quotient's scale for divide), then combined
+// as unscaled integers. Results of precision 18 or less are computed in 64-bit
+// integers, which then also hold every intermediate value.
+
+constexpr int32_t kMaxDecimalPrecision = 38;
+constexpr int32_t kMaxInt64DecimalPrecision = 18;
+
+// A result type that would need more than 38 digits gives up fractional digits,
+// down to a minimum scale of 6, to keep as many of its integral digits as possible
+Result<ValueDescr> MakeDecimalResultType(int32_t precision, int32_t scale) {
+  if (precision > kMaxDecimalPrecision) {
+    const int32_t integral_digits = precision - scale;
+    scale = std::max(kMaxDecimalPrecision - integral_digits, std::min(scale, 6));
+    precision = kMaxDecimalPrecision;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto type, Decimal128Type::Make(precision, scale));
+  return ValueDescr(std::move(type));
+}
+
+// Powers of ten to apply to the operands before the operation and to the
+// result after it
+struct DecimalRescale {
+  int32_t left_up;
+  int32_t right_up;
+  int32_t result_down;
+};
+
+struct DecimalAdditive {
+  static Result<ValueDescr> ResolveType(const Decimal128Type& left,
+                                        const Decimal128Type& right) {
+    const int32_t scale = std::max(left.scale(), right.scale());
+    const int32_t integral_digits = std::max(left.precision() - left.scale(),
+                                             right.precision() - right.scale());
+    return MakeDecimalResultType(integral_digits + scale + 1, scale);
+  }
+
+  static DecimalRescale GetRescale(const Decimal128Type& left,
+                                   const Decimal128Type& right,
+                                   const Decimal128Type& out) {
+    const int32_t scale = std::max(left.scale(), right.scale());
+    return {scale - left.scale(), scale - right.scale(), scale - out.scale()};
+  }
+};
+
+struct DecimalAdd : public DecimalAdditive {
+  template <typename T>
+  static T Call(KernelContext*, T left, T right) {
+    return T(left + right);
+  }
+};
+
+struct DecimalSubtract : public DecimalAdditive {
+  template <typename T>
+  static T Call(KernelContext*, T left, T right) {
+    return T(left - right);
+  }
+};
+
+struct DecimalMultiply {
+  static Result<ValueDescr> ResolveType(const Decimal128Type& left,
+                                        const Decimal128Type& right) {
+    return MakeDecimalResultType(left.precision() + right.precision() + 1,
+                                 left.scale() + right.scale());
+  }
+
+  static DecimalRescale GetRescale(const Decimal128Type& left,
+                                   const Decimal128Type& right,
+                                   const Decimal128Type& out) {
+    return {0, 0, left.scale() + right.scale() - out.scale()};
+  }
+
+  template <typename T>
+  static T Call(KernelContext*, T left, T right) {
+    return T(left * right);
+  }
+};
+
+struct DecimalDivide {
+  static Result<ValueDescr> ResolveType(const Decimal128Type& left,
+                                        const Decimal128Type& right) {
+    const int32_t scale =
+        std::max(4, left.scale() + right.precision() - right.scale() + 1);
+    return MakeDecimalResultType(left.precision() - left.scale() + right.scale() + scale,
+                                 scale);
+  }
+
+  // left * 10^shift / right has the output scale
+  static DecimalRescale GetRescale(const Decimal128Type& left,
+                                   const Decimal128Type& right,
+                                   const Decimal128Type& out) {
+    const int32_t shift = out.scale() - left.scale() + right.scale();
+    return {std::max(shift, 0), std::max(-shift, 0), 0};
+  }
+
+  template <typename T>
+  static T Call(KernelContext* ctx, T left, T right) {
+    if (ARROW_PREDICT_FALSE(right == T(0))) {
+      ctx->SetStatus(Status::Invalid("divide by zero"));
+      return T(0);
+    }
+    return T(left / right);
+  }
+};
+
+template <typename Op>
+Result<ValueDescr> ResolveDecimalBinaryType(KernelContext*,
+                                            const std::vector<ValueDescr>& args) {
+  return Op::ResolveType(checked_cast<const Decimal128Type&>(*args[0].type),
+                         checked_cast<const Decimal128Type&>(*args[1].type));
+}
+
+template <typename Op>
+Decimal128 CallDecimal(KernelContext* ctx, const DecimalRescale& rescale,
+                       Decimal128 left, Decimal128 right) {
+  if (rescale.left_up > 0) left = left.IncreaseScaleBy(rescale.left_up);
+  if (rescale.right_up > 0) right = right.IncreaseScaleBy(rescale.right_up);
+  Decimal128 result = Op::Call(ctx, left, right);
+  if (rescale.result_down > 0) result = result.ReduceScaleBy(rescale.result_down);
+  return result;
+}
+
+// Call visit_func(i) for every slot of the output that is not null, and write
+// zeros to the null slots
+template <typename VisitFunc>
+void VisitDecimalOutput(ArrayData* out, uint8_t* out_values, VisitFunc&& visit_func) {
+  const uint8_t* bitmap = out->buffers[0] ? out->buffers[0]->data() : NULLPTR;
+  OptionalBitBlockCounter bit_counter(bitmap, out->offset, out->length);
+  int64_t position = 0;
+  while (position < out->length) {
+    BitBlockCount block = bit_counter.NextBlock();
+    if (block.AllSet()) {
+      for (int64_t i = position; i < position + block.length; ++i) {
+        visit_func(i);
+      }
+    } else if (block.NoneSet()) {
+      std::memset(out_values + position * 16, 0, block.length * 16);
+    } else {
+      for (int64_t i = position; i < position + block.length; ++i) {
+        if (BitUtil::GetBit(bitmap, out->offset + i)) {
+          visit_func(i);
+        } else {
+          std::memset(out_values + i * 16, 0, 16);
+        }
+      }
+    }
+    position += block.length;
+  }
+}
+
+template <typename Op>
+void ExecDecimalBinary(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  const auto& left_type = checked_cast<const Decimal128Type&>(*batch[0].type());
+  const auto& right_type = checked_cast<const Decimal128Type&>(*batch[1].type());
+  const auto& out_type = checked_cast<const Decimal128Type&>(*out->type());
+  const DecimalRescale rescale = Op::GetRescale(left_type, right_type, out_type);
+  DecimalValues left(batch[0]);
+  DecimalValues right(batch[1]);
+
+  if (out->is_scalar()) {
+    auto out_scalar = checked_cast<Decimal128Scalar*>(out->scalar().get());
+    if (out_scalar->is_valid) {
+      out_scalar->value = CallDecimal<Op>(ctx, rescale, left.Read(0), right.Read(0));
+    }
+    return;
+  }
+
+  ArrayData* out_arr = out->mutable_array();
+  uint8_t* out_values = out_arr->buffers[1]->mutable_data() + out_arr->offset * 16;
+  if (out_type.precision() <= kMaxInt64DecimalPrecision) {
+    // No rounding is needed below 38 digits, and every multiplier fits in 64 bits
+    DCHECK_EQ(rescale.result_down, 0);
+    const auto left_multiplier = static_cast<int64_t>(
+        Decimal128::GetScaleMultiplier(rescale.left_up).low_bits());
+    const auto right_multiplier = static_cast<int64_t>(
+        Decimal128::GetScaleMultiplier(rescale.right_up).low_bits());
+    auto out_words = reinterpret_cast<int64_t*>(out_values);
+    VisitDecimalOutput(out_arr, out_values, [&](int64_t i) {
+      const int64_t result = Op::Call(ctx, left.ReadInt64(i) * left_multiplier,
+                                      right.ReadInt64(i) * right_multiplier);
+      out_words[2 * i + DecimalValues::kLowWord] = result;
+      out_words[2 * i + 1 - DecimalValues::kLowWord] = result >> 63;
+    });
+  } else {
+    VisitDecimalOutput(out_arr, out_values, [&](int64_t i) {
+      CallDecimal<Op>(ctx, rescale, left.Read(i), right.Read(i))
+          .ToBytes(out_values + i * 16);
+    });
+  }
+}
+
+template <typename Op>
+void AddDecimalBinaryKernel(ScalarFunction* func) {
+  InputType in_type(Type::DECIMAL);
+  DCHECK_OK(func->AddKernel({in_type, in_type},
+                            OutputType(ResolveDecimalBinaryType<Op>),
+                            ExecDecimalBinary<Op>));
+}
+
 }  // namespace
 
 void RegisterScalarArithmetic(FunctionRegistry* registry) {
   // ----------------------------------------------------------------------
   auto add = MakeArithmeticFunction<Add>("add");
+  AddDecimalBinaryKernel<DecimalAdd>(add.get());
   DCHECK_OK(registry->AddFunction(std::move(add)));
 
   // ----------------------------------------------------------------------
@@ -308,6 +518,7 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
         NumericEqualTypesBinary<ScalarBinaryEqualTypes, Subtract>(Type::TIMESTAMP);
     DCHECK_OK(subtract->AddKernel({in_type, in_type}, duration(unit), std::move(exec)));
   }
+  AddDecimalBinaryKernel<DecimalSubtract>(subtract.get());
 
   DCHECK_OK(registry->AddFunction(std::move(subtract)));
 
@@ -318,6 +529,7 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
 
   // ----------------------------------------------------------------------
   auto multiply = MakeArithmeticFunction<Multiply>("multiply");
+  AddDecimalBinaryKernel<DecimalMultiply>(multiply.get());
   DCHECK_OK(registry->AddFunction(std::move(multiply)));
 
   // ----------------------------------------------------------------------
@@ -327,6 +539,7 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
 
   // ----------------------------------------------------------------------
   auto divide = MakeArithmeticFunctionNotNull<Divide>("divide");
+  AddDecimalBinaryKernel<DecimalDivide>(divide.get());
   DCHECK_OK(registry->AddFunction(std::move(divide)));
 
   // ----------------------------------------------------------------------
@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "arrow/compute/api_scalar.h"
+#include "arrow/compute/cast.h"
 #include "arrow/compute/kernels/test_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -97,9 +98,34 @@ static void ArrayArrayKernel(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * array_size);
 }
 
+// Decimals of precision 8 are computed in 64-bit integers, decimals of
+// precision 20 in Decimal128
+template <BinaryOp& Op, int32_t kPrecision>
+static void DecimalArrayArrayKernel(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  // Positive values, so that nothing is divided by zero
+  const int64_t array_size = args.size / 16;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto lhs = Cast(*rand.Float64(array_size, 1, 1000, args.null_proportion),
+                  decimal(kPrecision, 2), CastOptions::Unsafe())
+                 .ValueOrDie();
+  auto rhs = Cast(*rand.Float64(array_size, 1, 1000, args.null_proportion),
+                  decimal(kPrecision, 4), CastOptions::Unsafe())
+                 .ValueOrDie();
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(Op(lhs, rhs, ArithmeticOptions(), nullptr).status());
+  }
+  state.SetItemsProcessed(state.iterations() * array_size);
+}
+
 void SetArgs(benchmark::internal::Benchmark* bench) {
+  // From no nulls over sparse and dense nulls to all nulls, which exercises
+  // both the all-valid and the all-null fast paths of the null handling
   for (const auto size : {kL1Size, kL2Size}) {
-    for (const auto inverse_null_proportion : std::vector<ArgsType>({100, 0})) {
+    for (const auto inverse_null_proportion :
+         std::vector<ArgsType>({0, 10000, 100, 10, 2, 1})) {
       bench->Args({static_cast<ArgsType>(size), inverse_null_proportion});
     }
   }
@@ -146,5 +172,14 @@ DECLARE_ARITHMETIC_CHECKED_BENCHMARKS(ArrayScalarKernel, SubtractChecked);
 DECLARE_ARITHMETIC_CHECKED_BENCHMARKS(ArrayArrayKernel, MultiplyChecked);
 DECLARE_ARITHMETIC_CHECKED_BENCHMARKS(ArrayScalarKernel, MultiplyChecked);
 
+#define DECLARE_DECIMAL_ARITHMETIC_BENCHMARKS(OP)                     \
+  BENCHMARK_TEMPLATE(DecimalArrayArrayKernel, OP, 8)->Apply(SetArgs); \
+  BENCHMARK_TEMPLATE(DecimalArrayArrayKernel, OP, 20)->Apply(SetArgs)
+
+DECLARE_DECIMAL_ARITHMETIC_BENCHMARKS(Add);
+DECLARE_DECIMAL_ARITHMETIC_BENCHMARKS(Subtract);
+DECLARE_DECIMAL_ARITHMETIC_BENCHMARKS(Multiply);
+DECLARE_DECIMAL_ARITHMETIC_BENCHMARKS(Divide);
+
 }  // namespace compute
 }  // namespace arrow
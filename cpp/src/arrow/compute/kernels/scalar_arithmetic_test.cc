@@ -613,6 +613,35 @@ TYPED_TEST(TestBinaryArithmeticFloating, Sub) {
   this->AssertBinop(Subtract, "[null, 2.0]", this->MakeNullScalar(), "[null, null]");
 }
 
+TEST(TestBinaryArithmetic, InPlace) {
+  auto values = ArrayFromJSON(int32(), "[1, 2, null, 4]");
+  ASSERT_OK_AND_ASSIGN(Datum result,
+                       CallFunctionInPlace("multiply", {values, Datum(int32_t(2))}, 0));
+  ASSERT_OK(result.make_array()->ValidateFull());
+  ASSERT_EQ(values->data()->buffers[1], result.array()->buffers[1]);
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[2, 4, null, 8]"), *result.make_array());
+
+  // Both arguments may be the donated array
+  values = ArrayFromJSON(int32(), "[1, 2, null, 4]");
+  ASSERT_OK_AND_ASSIGN(result, CallFunctionInPlace("add_checked", {values, values}, 1));
+  ASSERT_EQ(values->data()->buffers[1], result.array()->buffers[1]);
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[2, 4, null, 8]"), *result.make_array());
+
+  // Sliced and chunkwise execution
+  values = ArrayFromJSON(float64(), "[1, 2, 3, null, 5, 6]")->Slice(1);
+  ExecContext ctx;
+  ctx.set_exec_chunksize(2);
+  ASSERT_OK_AND_ASSIGN(result, CallFunctionInPlace("subtract", {values, Datum(1.0)}, 0,
+                                                   /*options=*/nullptr, &ctx));
+  ASSERT_EQ(values->data()->buffers[1], result.array()->buffers[1]);
+  AssertArraysEqual(*ArrayFromJSON(float64(), "[1, 2, null, 4, 5]"),
+                    *result.make_array());
+
+  // Scalar arguments cannot be donated
+  ASSERT_OK_AND_ASSIGN(result, CallFunctionInPlace("add", {Datum(2.0), values}, 0));
+  ASSERT_NE(values->data()->buffers[1], result.array()->buffers[1]);
+}
+
 TYPED_TEST(TestBinaryArithmeticFloating, Mul) {
   this->AssertBinop(Multiply, "[]", "[]", "[]");
 
@@ -637,5 +666,58 @@ TYPED_TEST(TestBinaryArithmeticFloating, Mul) {
   this->AssertBinop(Multiply, "[null, 2.0]", this->MakeNullScalar(), "[null, null]");
 }
 
+TEST(TestBinaryArithmeticDecimal, AddSubtract) {
+  // Computed in 64-bit integers after scaling the left side up to scale 3
+  auto left = ArrayFromJSON(decimal(5, 2), R"(["1.23", "-4.50", null, "999.99"])");
+  auto right =
+      ArrayFromJSON(decimal(6, 3), R"(["0.001", "2.000", "1.000", "999.999"])");
+  CheckScalarBinary("add", left, right,
+                    ArrayFromJSON(decimal(7, 3),
+                                  R"(["1.231", "-2.500", null, "1999.989"])"));
+  CheckScalarBinary("subtract", left, right,
+                    ArrayFromJSON(decimal(7, 3),
+                                  R"(["1.229", "-6.500", null, "-0.009"])"));
+
+  // Computed in Decimal128
+  left = ArrayFromJSON(decimal(30, 10),
+                       R"(["12345678901234567890.1234567890", "-1.0000000001", null])");
+  right = ArrayFromJSON(decimal(20, 5), R"(["1.00001", "2.50000", "3.00000"])");
+  CheckScalarBinary(
+      "add", left, right,
+      ArrayFromJSON(decimal(31, 10),
+                    R"(["12345678901234567891.1234667890", "1.4999999999", null])"));
+}
+
+TEST(TestBinaryArithmeticDecimal, Multiply) {
+  CheckScalarBinary("multiply",
+                    ArrayFromJSON(decimal(5, 2), R"(["1.23", "-4.50", null])"),
+                    ArrayFromJSON(decimal(3, 1), R"(["2.0", "1.5", "3.0"])"),
+                    ArrayFromJSON(decimal(9, 3), R"(["2.460", "-6.750", null])"));
+
+  // 41 digits do not fit, so the result gives up 3 fractional digits
+  CheckScalarBinary(
+      "multiply", ArrayFromJSON(decimal(20, 10), R"(["1.5000000000", null])"),
+      ArrayFromJSON(decimal(20, 10), R"(["2.2500000000", "1.0000000000"])"),
+      ArrayFromJSON(decimal(38, 17), R"(["3.37500000000000000", null])"));
+}
+
+TEST(TestBinaryArithmeticDecimal, Divide) {
+  // The null slot is not divided by zero
+  CheckScalarBinary(
+      "divide", ArrayFromJSON(decimal(5, 2), R"(["1.23", "-4.50", null, "1.00"])"),
+      ArrayFromJSON(decimal(3, 1), R"(["2.0", "1.5", "0.0", "3.0"])"),
+      ArrayFromJSON(decimal(9, 5), R"(["0.61500", "-3.00000", null, "0.33333"])"));
+
+  CheckScalarBinary(
+      "divide", ArrayFromJSON(decimal(20, 2), R"(["10000000000000000.00", null])"),
+      ArrayFromJSON(decimal(10, 4), R"(["3.0000", "1.0000"])"),
+      ArrayFromJSON(decimal(31, 9), R"(["3333333333333333.333333333", null])"));
+
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("divide by zero"),
+      CallFunction("divide", {ArrayFromJSON(decimal(5, 2), R"(["1.00"])"),
+                              ArrayFromJSON(decimal(3, 1), R"(["0.0"])")}));
+}
+
 }  // namespace compute
 }  // namespace arrow
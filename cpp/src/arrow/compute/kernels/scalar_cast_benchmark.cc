@@ -59,6 +59,36 @@ static void BenchmarkFloatingToIntegerCast(benchmark::State& state,
   }
 }
 
+static void BenchmarkTimestampUnitCast(benchmark::State& state, TimeUnit::type from,
+                                       TimeUnit::type to, const CastOptions& options) {
+  GenericItemsArgs args(state);
+  random::RandomArrayGenerator rand(kSeed);
+  auto array = rand.Numeric<Int64Type>(args.size, -1000000000, 1000000000,
+                                       args.null_proportion);
+  auto timestamps = *Cast(*array, timestamp(from));
+  for (auto _ : state) {
+    ABORT_NOT_OK(Cast(*timestamps, timestamp(to), options).status());
+  }
+}
+
+// Round trips random decimals through strings
+static void BenchmarkDecimalStringCast(benchmark::State& state, bool to_string,
+                                       int32_t precision, int32_t scale) {
+  GenericItemsArgs args(state);
+  random::RandomArrayGenerator rand(kSeed);
+  auto type = decimal(precision, scale);
+  auto decimals = *Cast(*rand.Float64(args.size, -1e6, 1e6, args.null_proportion), type,
+                        CastOptions::Unsafe());
+  auto strings = *Cast(*decimals, utf8());
+  for (auto _ : state) {
+    if (to_string) {
+      ABORT_NOT_OK(Cast(*decimals, utf8()).status());
+    } else {
+      ABORT_NOT_OK(Cast(*strings, type).status());
+    }
+  }
+}
+
 std::vector<int64_t> g_data_sizes = {kL2Size};
 
 void CastSetArgs(benchmark::internal::Benchmark* bench) {
@@ -104,6 +134,32 @@ static void CastDoubleToInt32Unsafe(benchmark::State& state) {
                                             CastOptions::Unsafe(), -1000, 1000);
 }
 
+static void CastTimestampSecondToNanoSafe(benchmark::State& state) {
+  BenchmarkTimestampUnitCast(state, TimeUnit::SECOND, TimeUnit::NANO,
+                             CastOptions::Safe());
+}
+
+static void CastTimestampNanoToMicroUnsafe(benchmark::State& state) {
+  BenchmarkTimestampUnitCast(state, TimeUnit::NANO, TimeUnit::MICRO,
+                             CastOptions::Unsafe());
+}
+
+static void CastDecimalToString(benchmark::State& state) {
+  BenchmarkDecimalStringCast(state, /*to_string=*/true, 12, 4);
+}
+
+static void CastDecimalWideToString(benchmark::State& state) {
+  BenchmarkDecimalStringCast(state, /*to_string=*/true, 30, 20);
+}
+
+static void CastStringToDecimal(benchmark::State& state) {
+  BenchmarkDecimalStringCast(state, /*to_string=*/false, 12, 4);
+}
+
+static void CastStringToDecimalWide(benchmark::State& state) {
+  BenchmarkDecimalStringCast(state, /*to_string=*/false, 30, 20);
+}
+
 BENCHMARK(CastInt64ToInt32Safe)->Apply(CastSetArgs);
 BENCHMARK(CastInt64ToInt32Unsafe)->Apply(CastSetArgs);
 BENCHMARK(CastUInt32ToInt32Safe)->Apply(CastSetArgs);
@@ -113,5 +169,13 @@ BENCHMARK(CastInt64ToDoubleUnsafe)->Apply(CastSetArgs);
 BENCHMARK(CastDoubleToInt32Safe)->Apply(CastSetArgs);
 BENCHMARK(CastDoubleToInt32Unsafe)->Apply(CastSetArgs);
 
+BENCHMARK(CastTimestampSecondToNanoSafe)->Apply(CastSetArgs);
+BENCHMARK(CastTimestampNanoToMicroUnsafe)->Apply(CastSetArgs);
+
+BENCHMARK(CastDecimalToString)->Apply(CastSetArgs);
+BENCHMARK(CastDecimalWideToString)->Apply(CastSetArgs);
+BENCHMARK(CastStringToDecimal)->Apply(CastSetArgs);
+BENCHMARK(CastStringToDecimalWide)->Apply(CastSetArgs);
+
 }  // namespace compute
 }  // namespace arrow
@@ -17,6 +17,10 @@
 
 // Implementation of casting to integer, floating point, or decimal types
 
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
 #include "arrow/compute/kernels/common.h"
 #include "arrow/compute/kernels/scalar_cast_internal.h"
 #include "arrow/util/bit_block_counter.h"
@@ -34,14 +38,188 @@ using internal::ParseValue;
 namespace compute {
 namespace internal {
 
+// ----------------------------------------------------------------------
+// Fused range check and conversion of integers
+
+// Number of values converted right after being range checked, so that they are
+// still in cache
+constexpr int64_t kCastChunkSize = 1024;
+
+template <typename InT>
+Status IntegerNotInRange(InT val, InT bound_lower, InT bound_upper) {
+  using Wide = typename std::conditional<std::is_signed<InT>::value, int64_t,
+                                         uint64_t>::type;
+  return Status::Invalid("Integer value ", static_cast<Wide>(val),
+                         " not in range: ", static_cast<Wide>(bound_lower), " to ",
+                         static_cast<Wide>(bound_upper));
+}
+
+// Cast integers chunk by chunk: the minimum and maximum of each chunk are
+// computed with a reduction the compiler can vectorize and compared with the
+// bounds once, then the chunk is converted with a branchless loop. Null slots
+// may hold arbitrary values, so they are replaced with zero (which is always in
+// range) where the chunk has nulls.
+template <typename InT, typename OutT>
+Status CastIntegersInRange(const ArrayData& input, InT bound_lower, InT bound_upper,
+                           ArrayData* output) {
+  const InT* in_data = input.GetValues<InT>(1);
+  OutT* out_data = output->GetMutableValues<OutT>(1);
+  const uint8_t* bitmap = input.buffers[0] ? input.buffers[0]->data() : nullptr;
+  const bool needs_check = std::numeric_limits<InT>::lowest() < bound_lower ||
+                           std::numeric_limits<InT>::max() > bound_upper;
+
+  OptionalBitBlockCounter bit_counter(bitmap, input.offset, input.length);
+  int64_t position = 0;
+  while (position < input.length) {
+    const BitBlockCount block = bit_counter.NextBlock();
+    for (int64_t chunk_start = 0; chunk_start < block.length;
+         chunk_start += kCastChunkSize) {
+      const int64_t chunk_length = std::min(kCastChunkSize, block.length - chunk_start);
+      const InT* in_chunk = in_data + position + chunk_start;
+      if (needs_check && block.popcount > 0) {
+        InT chunk_min = 0, chunk_max = 0;
+        if (block.popcount == block.length) {
+          for (int64_t i = 0; i < chunk_length; ++i) {
+            chunk_min = std::min(chunk_min, in_chunk[i]);
+            chunk_max = std::max(chunk_max, in_chunk[i]);
+          }
+        } else {
+          const int64_t bit_offset = input.offset + position + chunk_start;
+          for (int64_t i = 0; i < chunk_length; ++i) {
+            const InT value =
+                BitUtil::GetBit(bitmap, bit_offset + i) ? in_chunk[i] : InT(0);
+            chunk_min = std::min(chunk_min, value);
+            chunk_max = std::max(chunk_max, value);
+          }
+        }
+        if (ARROW_PREDICT_FALSE(chunk_min < bound_lower || chunk_max > bound_upper)) {
+          // Find the first offending value to report it
+          const int64_t bit_offset = input.offset + position + chunk_start;
+          for (int64_t i = 0; i < chunk_length; ++i) {
+            if ((bitmap == nullptr || BitUtil::GetBit(bitmap, bit_offset + i)) &&
+                (in_chunk[i] < bound_lower || in_chunk[i] > bound_upper)) {
+              return IntegerNotInRange(in_chunk[i], bound_lower, bound_upper);
+            }
+          }
+        }
+      }
+      OutT* out_chunk = out_data + position + chunk_start;
+      for (int64_t i = 0; i < chunk_length; ++i) {
+        out_chunk[i] = static_cast<OutT>(in_chunk[i]);
+      }
+    }
+    position += block.length;
+  }
+  return Status::OK();
+}
+
+// The range of OutType expressed in InType, clamped to the range of InType
+template <typename InType, typename OutType>
+Status CastIntegersChecked(const ArrayData& input, ArrayData* output) {
+  using InT = typename InType::c_type;
+  using OutT = typename OutType::c_type;
+  const InT bound_lower =
+      std::is_signed<InT>::value && std::is_signed<OutT>::value
+          ? static_cast<InT>(
+                std::max<int64_t>(static_cast<int64_t>(std::numeric_limits<InT>::min()),
+                                  static_cast<int64_t>(std::numeric_limits<OutT>::min())))
+          : InT(0);
+  const InT bound_upper = static_cast<InT>(
+      std::min<uint64_t>(static_cast<uint64_t>(std::numeric_limits<InT>::max()),
+                         static_cast<uint64_t>(std::numeric_limits<OutT>::max())));
+  return CastIntegersInRange<InT, OutT>(input, bound_lower, bound_upper, output);
+}
+
+template <typename InType>
+Status CastIntegersCheckedImpl(const ArrayData& input, ArrayData* output) {
+  switch (output->type->id()) {
+    case Type::INT8:
+      return CastIntegersChecked<InType, Int8Type>(input, output);
+    case Type::INT16:
+      return CastIntegersChecked<InType, Int16Type>(input, output);
+    case Type::INT32:
+      return CastIntegersChecked<InType, Int32Type>(input, output);
+    case Type::INT64:
+      return CastIntegersChecked<InType, Int64Type>(input, output);
+    case Type::UINT8:
+      return CastIntegersChecked<InType, UInt8Type>(input, output);
+    case Type::UINT16:
+      return CastIntegersChecked<InType, UInt16Type>(input, output);
+    case Type::UINT32:
+      return CastIntegersChecked<InType, UInt32Type>(input, output);
+    case Type::UINT64:
+      return CastIntegersChecked<InType, UInt64Type>(input, output);
+    default:
+      break;
+  }
+  DCHECK(false);
+  return Status::OK();
+}
+
+Status CastIntegersChecked(const ArrayData& input, ArrayData* output) {
+  switch (input.type->id()) {
+    case Type::INT8:
+      return CastIntegersCheckedImpl<Int8Type>(input, output);
+    case Type::INT16:
+      return CastIntegersCheckedImpl<Int16Type>(input, output);
+    case Type::INT32:
+      return CastIntegersCheckedImpl<Int32Type>(input, output);
+    case Type::INT64:
+      return CastIntegersCheckedImpl<Int64Type>(input, output);
+    case Type::UINT8:
+      return CastIntegersCheckedImpl<UInt8Type>(input, output);
+    case Type::UINT16:
+      return CastIntegersCheckedImpl<UInt16Type>(input, output);
+    case Type::UINT32:
+      return CastIntegersCheckedImpl<UInt32Type>(input, output);
+    case Type::UINT64:
+      return CastIntegersCheckedImpl<UInt64Type>(input, output);
+    default:
+      break;
+  }
+  DCHECK(false);
+  return Status::OK();
+}
+
 void CastIntegerToInteger(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
   const auto& options = checked_cast<const CastState*>(ctx->state())->options;
   if (!options.allow_int_overflow) {
+    if (batch[0].kind() == Datum::ARRAY) {
+      KERNEL_RETURN_IF_ERROR(
+          ctx, CastIntegersChecked(*batch[0].array(), out->mutable_array()));
+      return;
+    }
     KERNEL_RETURN_IF_ERROR(ctx, IntegersCanFit(batch[0], *out->type()));
   }
   CastNumberToNumberUnsafe(batch[0].type()->id(), out->type()->id(), batch[0], out);
 }
 
+// Integers of the same width have the same two's complement representation, so
+// once the range check passes (or is disabled) the values buffer can be shared
+void CastIntegerToIntegerZeroCopy(KernelContext* ctx, const ExecBatch& batch,
+                                  Datum* out) {
+  const auto& options = checked_cast<const CastState*>(ctx->state())->options;
+  if (!options.allow_int_overflow) {
+    KERNEL_RETURN_IF_ERROR(ctx, IntegersCanFit(batch[0], *out->type()));
+  }
+  if (batch[0].kind() == Datum::SCALAR) {
+    CastNumberToNumberUnsafe(batch[0].type()->id(), out->type()->id(), batch[0], out);
+    return;
+  }
+  const ArrayData& input = *batch[0].array();
+  ArrayData* output = out->mutable_array();
+  // The validity bitmap was computed by the executor for an output offset of zero
+  DCHECK_EQ(output->offset, 0);
+  if (input.offset == 0) {
+    output->buffers[1] = input.buffers[1];
+  } else {
+    const int64_t byte_width =
+        checked_cast<const FixedWidthType&>(*input.type).bit_width() / 8;
+    output->buffers[1] = SliceBuffer(input.buffers[1], input.offset * byte_width,
+                                     input.length * byte_width);
+  }
+}
+
 void CastFloatingToFloating(KernelContext*, const ExecBatch& batch, Datum* out) {
   CastNumberToNumberUnsafe(batch[0].type()->id(), out->type()->id(), batch[0], out);
 }
@@ -49,11 +227,12 @@ void CastFloatingToFloating(KernelContext*, const ExecBatch& batch, Datum* out)
 // ----------------------------------------------------------------------
 // Implement fast safe floating point to integer cast
 
-// InType is a floating point type we are planning to cast to integer
+// InType is a floating point type we are planning to cast to integer. Each
+// chunk is converted, then checked for truncation while it is still in cache.
 template <typename InType, typename OutType, typename InT = typename InType::c_type,
           typename OutT = typename OutType::c_type>
 ARROW_DISABLE_UBSAN("float-cast-overflow")
-Status CheckFloatTruncation(const Datum& input, const Datum& output) {
+Status CastFloatTruncationChecked(const Datum& input, Datum* output) {
   auto WasTruncated = [&](OutT out_val, InT in_val) -> bool {
     return static_cast<InT>(out_val) != in_val;
   };
@@ -62,13 +241,15 @@ Status CheckFloatTruncation(const Datum& input, const Datum& output) {
   };
   auto GetErrorMessage = [&](InT val) {
     return Status::Invalid("Float value ", val, " was truncated converting to",
-                           *output.type());
+                           *output->type());
   };
 
   if (input.kind() == Datum::SCALAR) {
-    DCHECK_EQ(output.kind(), Datum::SCALAR);
+    DCHECK_EQ(output->kind(), Datum::SCALAR);
+    CastNumberToNumberUnsafe(InType::type_id, OutType::type_id, input, output);
     const auto& in_scalar = input.scalar_as<typename TypeTraits<InType>::ScalarType>();
-    const auto& out_scalar = output.scalar_as<typename TypeTraits<OutType>::ScalarType>();
+    const auto& out_scalar =
+        output->scalar_as<typename TypeTraits<OutType>::ScalarType>();
     if (WasTruncatedMaybeNull(out_scalar.value, in_scalar.value, out_scalar.is_valid)) {
       return GetErrorMessage(in_scalar.value);
     }
@@ -76,10 +257,10 @@ Status CheckFloatTruncation(const Datum& input, const Datum& output) {
   }
 
   const ArrayData& in_array = *input.array();
-  const ArrayData& out_array = *output.array();
+  ArrayData* out_array = output->mutable_array();
 
   const InT* in_data = in_array.GetValues<InT>(1);
-  const OutT* out_data = out_array.GetValues<OutT>(1);
+  OutT* out_data = out_array->GetMutableValues<OutT>(1);
 
   const uint8_t* bitmap = nullptr;
   if (in_array.buffers[0]) {
@@ -90,62 +271,62 @@ Status CheckFloatTruncation(const Datum& input, const Datum& output) {
   int64_t offset_position = in_array.offset;
   while (position < in_array.length) {
     BitBlockCount block = bit_counter.NextBlock();
-    bool block_out_of_bounds = false;
-    if (block.popcount == block.length) {
-      // Fast path: branchless
-      for (int64_t i = 0; i < block.length; ++i) {
-        block_out_of_bounds |= WasTruncated(out_data[i], in_data[i]);
+    for (int64_t chunk_start = 0; chunk_start < block.length;
+         chunk_start += kCastChunkSize) {
+      const int64_t length = std::min(kCastChunkSize, block.length - chunk_start);
+      for (int64_t i = 0; i < length; ++i) {
+        out_data[i] = static_cast<OutT>(in_data[i]);
       }
-    } else if (block.popcount > 0) {
-      // Indices have nulls, must only boundscheck non-null values
-      for (int64_t i = 0; i < block.length; ++i) {
-        block_out_of_bounds |= WasTruncatedMaybeNull(
-            out_data[i], in_data[i], BitUtil::GetBit(bitmap, offset_position + i));
+      bool chunk_out_of_bounds = false;
+      if (block.popcount == block.length) {
+        // Fast path: branchless
+        for (int64_t i = 0; i < length; ++i) {
+          chunk_out_of_bounds |= WasTruncated(out_data[i], in_data[i]);
+        }
+      } else if (block.popcount > 0) {
+        // Indices have nulls, must only boundscheck non-null values
+        for (int64_t i = 0; i < length; ++i) {
+          chunk_out_of_bounds |= WasTruncatedMaybeNull(
+              out_data[i], in_data[i], BitUtil::GetBit(bitmap, offset_position + i));
+        }
       }
-    }
-    if (ARROW_PREDICT_FALSE(block_out_of_bounds)) {
-      if (in_array.GetNullCount() > 0) {
-        for (int64_t i = 0; i < block.length; ++i) {
+      if (ARROW_PREDICT_FALSE(chunk_out_of_bounds)) {
+        for (int64_t i = 0; i < length; ++i) {
           if (WasTruncatedMaybeNull(out_data[i], in_data[i],
-                                    BitUtil::GetBit(bitmap, offset_position + i))) {
-            return GetErrorMessage(in_data[i]);
-          }
-        }
-      } else {
-        for (int64_t i = 0; i < block.length; ++i) {
-          if (WasTruncated(out_data[i], in_data[i])) {
+                                    bitmap == nullptr ||
+                                        BitUtil::GetBit(bitmap, offset_position + i))) {
             return GetErrorMessage(in_data[i]);
           }
         }
       }
+      in_data += length;
+      out_data += length;
+      offset_position += length;
     }
-    in_data += block.length;
-    out_data += block.length;
     position += block.length;
-    offset_position += block.length;
   }
   return Status::OK();
 }
 
 template <typename InType>
-Status CheckFloatToIntTruncationImpl(const Datum& input, const Datum& output) {
-  switch (output.type()->id()) {
+Status CastFloatToIntCheckedImpl(const Datum& input, Datum* output) {
+  switch (output->type()->id()) {
     case Type::INT8:
-      return CheckFloatTruncation<InType, Int8Type>(input, output);
+      return CastFloatTruncationChecked<InType, Int8Type>(input, output);
     case Type::INT16:
-      return CheckFloatTruncation<InType, Int16Type>(input, output);
+      return CastFloatTruncationChecked<InType, Int16Type>(input, output);
     case Type::INT32:
-      return CheckFloatTruncation<InType, Int32Type>(input, output);
+      return CastFloatTruncationChecked<InType, Int32Type>(input, output);
     case Type::INT64:
-      return CheckFloatTruncation<InType, Int64Type>(input, output);
+      return CastFloatTruncationChecked<InType, Int64Type>(input, output);
     case Type::UINT8:
-      return CheckFloatTruncation<InType, UInt8Type>(input, output);
+      return CastFloatTruncationChecked<InType, UInt8Type>(input, output);
     case Type::UINT16:
-      return CheckFloatTruncation<InType, UInt16Type>(input, output);
+      return CastFloatTruncationChecked<InType, UInt16Type>(input, output);
     case Type::UINT32:
-      return CheckFloatTruncation<InType, UInt32Type>(input, output);
+      return CastFloatTruncationChecked<InType, UInt32Type>(input, output);
     case Type::UINT64:
-      return CheckFloatTruncation<InType, UInt64Type>(input, output);
+      return CastFloatTruncationChecked<InType, UInt64Type>(input, output);
     default:
       break;
   }
@@ -153,12 +334,12 @@ Status CheckFloatToIntTruncationImpl(const Datum& input, const Datum& output) {
   return Status::OK();
 }
 
-Status CheckFloatToIntTruncation(const Datum& input, const Datum& output) {
+Status CastFloatToIntChecked(const Datum& input, Datum* output) {
   switch (input.type()->id()) {
     case Type::FLOAT:
-      return CheckFloatToIntTruncationImpl<FloatType>(input, output);
+      return CastFloatToIntCheckedImpl<FloatType>(input, output);
     case Type::DOUBLE:
-      return CheckFloatToIntTruncationImpl<DoubleType>(input, output);
+      return CastFloatToIntCheckedImpl<DoubleType>(input, output);
     default:
       break;
   }
@@ -168,10 +349,11 @@ Status CheckFloatToIntTruncation(const Datum& input, const Datum& output) {
 
 void CastFloatingToInteger(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
   const auto& options = checked_cast<const CastState*>(ctx->state())->options;
-  CastNumberToNumberUnsafe(batch[0].type()->id(), out->type()->id(), batch[0], out);
   if (!options.allow_float_truncate) {
-    KERNEL_RETURN_IF_ERROR(ctx, CheckFloatToIntTruncation(batch[0], *out));
+    KERNEL_RETURN_IF_ERROR(ctx, CastFloatToIntChecked(batch[0], out));
+    return;
   }
+  CastNumberToNumberUnsafe(batch[0].type()->id(), out->type()->id(), batch[0], out);
 }
 
 // ----------------------------------------------------------------------
@@ -195,62 +377,66 @@ struct FloatingIntegerBound<double> {
 template <typename InType, typename OutType, typename InT = typename InType::c_type,
           typename OutT = typename OutType::c_type,
           bool IsSigned = is_signed_integer_type<InType>::value>
-Status CheckIntegerFloatTruncateImpl(const Datum& input) {
-  using InScalarType = typename TypeTraits<InType>::ScalarType;
+Status CastIntegerFloatTruncateImpl(const Datum& input, Datum* output) {
   const int64_t limit = FloatingIntegerBound<OutT>::value;
-  InScalarType bound_lower(IsSigned ? -limit : 0);
-  InScalarType bound_upper(limit);
-  return CheckIntegersInRange(input, bound_lower, bound_upper);
+  const auto bound_lower = static_cast<InT>(IsSigned ? -limit : 0);
+  const auto bound_upper = static_cast<InT>(limit);
+  if (input.kind() == Datum::ARRAY) {
+    return CastIntegersInRange<InT, OutT>(*input.array(), bound_lower, bound_upper,
+                                          output->mutable_array());
+  }
+  using InScalarType = typename TypeTraits<InType>::ScalarType;
+  RETURN_NOT_OK(CheckIntegersInRange(input, InScalarType(bound_lower),
+                                     InScalarType(bound_upper)));
+  CastNumberToNumberUnsafe(InType::type_id, OutType::type_id, input, output);
+  return Status::OK();
 }
 
-Status CheckForIntegerToFloatingTruncation(const Datum& input, Type::type out_type) {
+// Check that the integers are exactly representable while converting them
+Status CastIntegerToFloatingChecked(const Datum& input, Datum* output) {
+  const Type::type out_type = output->type()->id();
   switch (input.type()->id()) {
-    // Small integers are all exactly representable as whole numbers
-    case Type::INT8:
-    case Type::INT16:
-    case Type::UINT8:
-    case Type::UINT16:
-      return Status::OK();
     case Type::INT32: {
-      if (out_type == Type::DOUBLE) {
-        return Status::OK();
+      if (out_type == Type::FLOAT) {
+        return CastIntegerFloatTruncateImpl<Int32Type, FloatType>(input, output);
       }
-      return CheckIntegerFloatTruncateImpl<Int32Type, FloatType>(input);
+      break;
     }
     case Type::UINT32: {
-      if (out_type == Type::DOUBLE) {
-        return Status::OK();
+      if (out_type == Type::FLOAT) {
+        return CastIntegerFloatTruncateImpl<UInt32Type, FloatType>(input, output);
       }
-      return CheckIntegerFloatTruncateImpl<UInt32Type, FloatType>(input);
+      break;
     }
     case Type::INT64: {
       if (out_type == Type::FLOAT) {
-        return CheckIntegerFloatTruncateImpl<Int64Type, FloatType>(input);
+        return CastIntegerFloatTruncateImpl<Int64Type, FloatType>(input, output);
       } else {
-        return CheckIntegerFloatTruncateImpl<Int64Type, DoubleType>(input);
+        return CastIntegerFloatTruncateImpl<Int64Type, DoubleType>(input, output);
       }
     }
     case Type::UINT64: {
       if (out_type == Type::FLOAT) {
-        return CheckIntegerFloatTruncateImpl<UInt64Type, FloatType>(input);
+        return CastIntegerFloatTruncateImpl<UInt64Type, FloatType>(input, output);
       } else {
-        return CheckIntegerFloatTruncateImpl<UInt64Type, DoubleType>(input);
+        return CastIntegerFloatTruncateImpl<UInt64Type, DoubleType>(input, output);
       }
     }
     default:
       break;
   }
-  DCHECK(false);
+  // Small integers are all exactly representable as whole numbers
+  CastNumberToNumberUnsafe(input.type()->id(), out_type, input, output);
   return Status::OK();
 }
 
 void CastIntegerToFloating(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
   const auto& options = checked_cast<const CastState*>(ctx->state())->options;
-  Type::type out_type = out->type()->id();
   if (!options.allow_float_truncate) {
-    KERNEL_RETURN_IF_ERROR(ctx, CheckForIntegerToFloatingTruncation(batch[0], out_type));
+    KERNEL_RETURN_IF_ERROR(ctx, CastIntegerToFloatingChecked(batch[0], out));
+    return;
   }
-  CastNumberToNumberUnsafe(batch[0].type()->id(), out_type, batch[0], out);
+  CastNumberToNumberUnsafe(batch[0].type()->id(), out->type()->id(), batch[0], out);
 }
 
 // ----------------------------------------------------------------------
@@ -289,7 +475,28 @@ struct ParseString {
 
 template <typename O, typename I>
 struct CastFunctor<O, I, enable_if_base_binary<I>> {
+  using offset_type = typename I::offset_type;
+  using OutValue = typename GetOutputType<O>::T;
+
   static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    if (batch[0].kind() == Datum::ARRAY && batch[0].array()->GetNullCount() == 0) {
+      // Without nulls, parse all values in one tight loop
+      const ArrayData& arr = *batch[0].array();
+      const offset_type* offsets = arr.GetValues<offset_type>(1);
+      const char* data = arr.buffers[2] != nullptr
+                             ? reinterpret_cast<const char*>(arr.buffers[2]->data())
+                             : "";
+      OutValue* out_values = out->mutable_array()->GetMutableValues<OutValue>(1);
+      const int64_t num_parsed =
+          ::arrow::internal::ParseValues<O>(data, offsets, arr.length, out_values);
+      if (ARROW_PREDICT_FALSE(num_parsed < arr.length)) {
+        const util::string_view value(
+            data + offsets[num_parsed],
+            static_cast<size_t>(offsets[num_parsed + 1] - offsets[num_parsed]));
+        ctx->SetStatus(Status::Invalid("Failed to parse string: ", value));
+      }
+      return;
+    }
     applicator::ScalarUnaryNotNull<O, I, ParseString<O>>::Exec(ctx, batch, out);
   }
 };
@@ -498,6 +705,34 @@ struct CastFunctor<Decimal128Type, I, enable_if_t<is_floating_type<I>::value>> {
   }
 };
 
+// ----------------------------------------------------------------------
+// String to decimal
+
+struct StringToDecimal {
+  template <typename OutValue, typename Arg0Value>
+  Decimal128 Call(KernelContext* ctx, Arg0Value val) const {
+    Decimal128 result;
+    Status st = Decimal128::FromStringAtScale(val, out_precision_, out_scale_, &result);
+    if (ARROW_PREDICT_FALSE(!st.ok())) {
+      ctx->SetStatus(st);
+      return Decimal128();  // Zero
+    }
+    return result;
+  }
+
+  int32_t out_precision_, out_scale_;
+};
+
+template <typename I>
+struct CastFunctor<Decimal128Type, I, enable_if_base_binary<I>> {
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const auto& out_type_inst = checked_cast<const Decimal128Type&>(*out->type());
+    applicator::ScalarUnaryNotNullStateful<Decimal128Type, I, StringToDecimal> kernel(
+        StringToDecimal{out_type_inst.precision(), out_type_inst.scale()});
+    return kernel.Exec(ctx, batch, out);
+  }
+};
+
 // ----------------------------------------------------------------------
 // Decimal to real
 
@@ -528,6 +763,16 @@ struct CastFunctor<O, Decimal128Type, enable_if_t<is_floating_type<O>::value>> {
 
 namespace {
 
+// For casts which read every input value before writing the output, so that
+// they can write into a donated input of the same width
+void AddInPlaceCast(const std::shared_ptr<DataType>& in_ty,
+                    const std::shared_ptr<DataType>& out_ty, ArrayKernelExec exec,
+                    CastFunction* func) {
+  ScalarKernel kernel({in_ty}, out_ty, exec);
+  kernel.can_write_in_place = true;
+  DCHECK_OK(func->AddKernel(in_ty->id(), std::move(kernel)));
+}
+
 template <typename OutType>
 void AddCommonNumberCasts(const std::shared_ptr<DataType>& out_ty, CastFunction* func) {
   AddCommonCasts(out_ty->id(), out_ty, func);
@@ -549,10 +794,19 @@ std::shared_ptr<CastFunction> GetCastToInteger(std::string name) {
   auto out_ty = TypeTraits<OutType>::type_singleton();
 
   for (const std::shared_ptr<DataType>& in_ty : IntTypes()) {
-    DCHECK_OK(func->AddKernel(in_ty->id(), {in_ty}, out_ty, CastIntegerToInteger));
+    if (checked_cast<const FixedWidthType&>(*in_ty).bit_width() ==
+        checked_cast<const FixedWidthType&>(*out_ty).bit_width()) {
+      // Same width: the output shares the input's values buffer
+      ScalarKernel kernel({in_ty}, out_ty, CastIntegerToIntegerZeroCopy);
+      kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+      DCHECK_OK(func->AddKernel(in_ty->id(), std::move(kernel)));
+    } else {
+      AddInPlaceCast(in_ty, out_ty, CastIntegerToInteger, func.get());
+    }
   }
 
-  // Cast from floating point
+  // Cast from floating point, not in place since the truncation check compares
+  // the output with the input
   for (const std::shared_ptr<DataType>& in_ty : FloatingPointTypes()) {
     DCHECK_OK(func->AddKernel(in_ty->id(), {in_ty}, out_ty, CastFloatingToInteger));
   }
@@ -573,12 +827,12 @@ std::shared_ptr<CastFunction> GetCastToFloating(std::string name) {
 
   // Casts from integer to floating point
   for (const std::shared_ptr<DataType>& in_ty : IntTypes()) {
-    DCHECK_OK(func->AddKernel(in_ty->id(), {in_ty}, out_ty, CastIntegerToFloating));
+    AddInPlaceCast(in_ty, out_ty, CastIntegerToFloating, func.get());
   }
 
   // Cast from floating point
   for (const std::shared_ptr<DataType>& in_ty : FloatingPointTypes()) {
-    DCHECK_OK(func->AddKernel(in_ty->id(), {in_ty}, out_ty, CastFloatingToFloating));
+    AddInPlaceCast(in_ty, out_ty, CastFloatingToFloating, func.get());
   }
 
   // From other numbers to floating point
@@ -602,6 +856,12 @@ std::shared_ptr<CastFunction> GetCastToDecimal() {
   DCHECK_OK(func->AddKernel(Type::DOUBLE, {float64()}, sig_out_ty,
                             CastFunctor<Decimal128Type, DoubleType>::Exec));
 
+  // Cast from strings, parsing directly at the output scale
+  for (const std::shared_ptr<DataType>& in_ty : BaseBinaryTypes()) {
+    auto exec = GenerateVarBinaryBase<CastFunctor, Decimal128Type>(*in_ty);
+    DCHECK_OK(func->AddKernel(in_ty->id(), {in_ty}, sig_out_ty, exec));
+  }
+
   // Cast from other decimal
   auto exec = CastFunctor<Decimal128Type, Decimal128Type>::Exec;
   // We resolve the output type of this kernel from the CastOptions
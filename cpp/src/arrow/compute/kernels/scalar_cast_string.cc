@@ -17,10 +17,15 @@
 
 // Implementation of casting to integer or floating point types
 
+#include <algorithm>
+#include <limits>
+
 #include "arrow/array/array_base.h"
+#include "arrow/buffer_builder.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/compute/kernels/scalar_cast_internal.h"
 #include "arrow/result.h"
+#include "arrow/util/decimal.h"
 #include "arrow/util/formatting.h"
 #include "arrow/util/optional.h"
 #include "arrow/util/utf8.h"
@@ -69,6 +74,63 @@ struct CastFunctor<O, I,
   }
 };
 
+// ----------------------------------------------------------------------
+// Decimal to String
+
+// Formats each value straight into the output data buffer, so that no
+// intermediate strings are allocated
+template <typename O>
+struct CastFunctor<O, Decimal128Type, enable_if_t<is_string_like_type<O>::value>> {
+  using offset_type = typename O::offset_type;
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const ArrayData& input = *batch[0].array();
+    ArrayData* output = out->mutable_array();
+    ctx->SetStatus(Convert(ctx, input, output));
+  }
+
+  static Status Convert(KernelContext* ctx, const ArrayData& input, ArrayData* output) {
+    const auto& in_type = checked_cast<const Decimal128Type&>(*input.type);
+    const int32_t scale = in_type.scale();
+    constexpr int64_t kMaxLength = Decimal128::kMaxStringLength;
+
+    TypedBufferBuilder<offset_type> offsets_builder(ctx->memory_pool());
+    BufferBuilder data_builder(ctx->memory_pool());
+    RETURN_NOT_OK(offsets_builder.Reserve(input.length + 1));
+    // Sign, leading zero and decimal point aside, values in plain notation take
+    // at most `precision` characters
+    const int64_t null_count = input.GetNullCount();
+    RETURN_NOT_OK(data_builder.Reserve((input.length - null_count) *
+                                       (std::max(in_type.precision(), 0) + 3)));
+    offsets_builder.UnsafeAppend(0);
+
+    RETURN_NOT_OK(VisitArrayDataInline<Decimal128Type>(
+        input,
+        [&](util::string_view bytes) {
+          if (data_builder.capacity() - data_builder.length() < kMaxLength) {
+            RETURN_NOT_OK(data_builder.Reserve(kMaxLength));
+          }
+          if (ARROW_PREDICT_FALSE(data_builder.length() + kMaxLength >
+                                  std::numeric_limits<offset_type>::max())) {
+            return Status::CapacityError("Cast result too large for ", *output->type);
+          }
+          const Decimal128 value(reinterpret_cast<const uint8_t*>(bytes.data()));
+          auto dest = reinterpret_cast<char*>(data_builder.mutable_data());
+          data_builder.UnsafeAdvance(
+              value.ToString(scale, dest + data_builder.length()));
+          offsets_builder.UnsafeAppend(static_cast<offset_type>(data_builder.length()));
+          return Status::OK();
+        },
+        [&]() {
+          offsets_builder.UnsafeAppend(static_cast<offset_type>(data_builder.length()));
+          return Status::OK();
+        }));
+
+    RETURN_NOT_OK(offsets_builder.Finish(&output->buffers[1]));
+    return data_builder.Finish(&output->buffers[2]);
+  }
+};
+
 // ----------------------------------------------------------------------
 // Binary to String
 //
@@ -127,6 +189,7 @@ struct CastFunctor<LargeStringType, LargeBinaryType>
 // String casts available
 //
 // * Numbers and boolean to String / LargeString
+// * Decimal to String / LargeString
 // * Binary / LargeBinary to String / LargeString with UTF8 validation
 
 template <typename OutType>
@@ -142,6 +205,15 @@ void AddNumberToStringCasts(std::shared_ptr<DataType> out_ty, CastFunction* func
   }
 }
 
+template <typename OutType>
+void AddDecimalToStringCasts(std::shared_ptr<DataType> out_ty, CastFunction* func) {
+  // The executor computes the validity bitmap, the kernel allocates the offsets
+  // and character data itself
+  DCHECK_OK(func->AddKernel(Type::DECIMAL, {InputType::Array(Type::DECIMAL)}, out_ty,
+                            CastFunctor<OutType, Decimal128Type>::Exec,
+                            NullHandling::INTERSECTION, MemAllocation::NO_PREALLOCATE));
+}
+
 std::vector<std::shared_ptr<CastFunction>> GetBinaryLikeCasts() {
   auto cast_binary = std::make_shared<CastFunction>("cast_binary", Type::BINARY);
   AddCommonCasts(Type::BINARY, binary(), cast_binary.get());
@@ -161,6 +233,7 @@ std::vector<std::shared_ptr<CastFunction>> GetBinaryLikeCasts() {
   auto cast_string = std::make_shared<CastFunction>("cast_string", Type::STRING);
   AddCommonCasts(Type::STRING, utf8(), cast_string.get());
   AddNumberToStringCasts<StringType>(utf8(), cast_string.get());
+  AddDecimalToStringCasts<StringType>(utf8(), cast_string.get());
   DCHECK_OK(cast_string->AddKernel(Type::BINARY, {binary()}, utf8(),
                                    CastFunctor<StringType, BinaryType>::Exec,
                                    NullHandling::COMPUTED_NO_PREALLOCATE));
@@ -169,6 +242,7 @@ std::vector<std::shared_ptr<CastFunction>> GetBinaryLikeCasts() {
       std::make_shared<CastFunction>("cast_large_string", Type::LARGE_STRING);
   AddCommonCasts(Type::LARGE_STRING, large_utf8(), cast_large_string.get());
   AddNumberToStringCasts<LargeStringType>(large_utf8(), cast_large_string.get());
+  AddDecimalToStringCasts<LargeStringType>(large_utf8(), cast_large_string.get());
   DCHECK_OK(
       cast_large_string->AddKernel(Type::LARGE_BINARY, {large_binary()}, large_utf8(),
                                    CastFunctor<LargeStringType, LargeBinaryType>::Exec,
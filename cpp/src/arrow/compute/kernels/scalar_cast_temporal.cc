@@ -17,16 +17,20 @@
 
 // Implementation of casting to (or between) temporal types
 
+#include <algorithm>
 #include <limits>
 
 #include "arrow/compute/kernels/common.h"
 #include "arrow/compute/kernels/scalar_cast_internal.h"
+#include "arrow/util/bit_block_counter.h"
 #include "arrow/util/bitmap_reader.h"
 #include "arrow/util/time.h"
 #include "arrow/util/value_parsing.h"
 
 namespace arrow {
 
+using internal::BitBlockCount;
+using internal::OptionalBitBlockCounter;
 using internal::ParseValue;
 
 namespace compute {
@@ -37,6 +41,115 @@ constexpr int64_t kMillisecondsInDay = 86400000;
 // ----------------------------------------------------------------------
 // From one timestamp to another
 
+// Number of values converted right after being checked, so that they are still
+// in cache
+constexpr int64_t kShiftChunkSize = 1024;
+
+// Call visit_chunk(position, length, bitmap, all_valid, all_null) on successive
+// cache-sized chunks of the input
+template <typename VisitChunk>
+Status VisitShiftChunks(const ArrayData& input, VisitChunk&& visit_chunk) {
+  const uint8_t* bitmap = input.buffers[0] ? input.buffers[0]->data() : nullptr;
+  OptionalBitBlockCounter bit_counter(bitmap, input.offset, input.length);
+  int64_t position = 0;
+  while (position < input.length) {
+    const BitBlockCount block = bit_counter.NextBlock();
+    for (int64_t chunk_start = 0; chunk_start < block.length;
+         chunk_start += kShiftChunkSize) {
+      const int64_t length = std::min(kShiftChunkSize, block.length - chunk_start);
+      RETURN_NOT_OK(visit_chunk(position + chunk_start, length, bitmap,
+                                block.popcount == block.length, block.popcount == 0));
+    }
+    position += block.length;
+  }
+  return Status::OK();
+}
+
+template <typename in_type, typename out_type>
+Status ShiftTimeChecked(const util::DivideOrMultiply factor_op, const int64_t factor,
+                        const ArrayData& input, ArrayData* output) {
+  const in_type* in_data = input.GetValues<in_type>(1);
+  auto out_data = output->GetMutableValues<out_type>(1);
+
+  if (factor_op == util::MULTIPLY) {
+    // The minimum and maximum of each chunk are checked once against the range
+    // that does not overflow, then the chunk is multiplied without branches.
+    // Null slots are replaced with zero, which never overflows.
+    const in_type max_val = std::numeric_limits<int64_t>::max() / factor;
+    const in_type min_val = std::numeric_limits<int64_t>::min() / factor;
+    return VisitShiftChunks(input, [&](int64_t position, int64_t length,
+                                       const uint8_t* bitmap, bool all_valid,
+                                       bool all_null) -> Status {
+      const in_type* in_chunk = in_data + position;
+      if (!all_null) {
+        in_type chunk_min = 0, chunk_max = 0;
+        if (all_valid) {
+          for (int64_t i = 0; i < length; ++i) {
+            chunk_min = std::min(chunk_min, in_chunk[i]);
+            chunk_max = std::max(chunk_max, in_chunk[i]);
+          }
+        } else {
+          for (int64_t i = 0; i < length; ++i) {
+            const in_type value =
+                BitUtil::GetBit(bitmap, input.offset + position + i) ? in_chunk[i] : 0;
+            chunk_min = std::min(chunk_min, value);
+            chunk_max = std::max(chunk_max, value);
+          }
+        }
+        if (ARROW_PREDICT_FALSE(chunk_min < min_val || chunk_max > max_val)) {
+          for (int64_t i = 0; i < length; ++i) {
+            if ((bitmap == nullptr ||
+                 BitUtil::GetBit(bitmap, input.offset + position + i)) &&
+                (in_chunk[i] < min_val || in_chunk[i] > max_val)) {
+              return Status::Invalid("Casting from ", input.type->ToString(), " to ",
+                                     output->type->ToString(), " would result in ",
+                                     "out of bounds timestamp: ", in_chunk[i]);
+            }
+          }
+        }
+      }
+      out_type* out_chunk = out_data + position;
+      for (int64_t i = 0; i < length; ++i) {
+        out_chunk[i] = static_cast<out_type>(in_chunk[i] * factor);
+      }
+      return Status::OK();
+    });
+  }
+
+  // Divide each chunk, then check that multiplying back gives the input
+  return VisitShiftChunks(input, [&](int64_t position, int64_t length,
+                                     const uint8_t* bitmap, bool all_valid,
+                                     bool all_null) -> Status {
+    const in_type* in_chunk = in_data + position;
+    out_type* out_chunk = out_data + position;
+    for (int64_t i = 0; i < length; ++i) {
+      out_chunk[i] = static_cast<out_type>(in_chunk[i] / factor);
+    }
+    bool lost_data = false;
+    if (all_valid) {
+      for (int64_t i = 0; i < length; ++i) {
+        lost_data |= out_chunk[i] * factor != in_chunk[i];
+      }
+    } else if (!all_null) {
+      for (int64_t i = 0; i < length; ++i) {
+        lost_data |= BitUtil::GetBit(bitmap, input.offset + position + i) &&
+                     out_chunk[i] * factor != in_chunk[i];
+      }
+    }
+    if (ARROW_PREDICT_FALSE(lost_data)) {
+      for (int64_t i = 0; i < length; ++i) {
+        if ((bitmap == nullptr || BitUtil::GetBit(bitmap, input.offset + position + i)) &&
+            out_chunk[i] * factor != in_chunk[i]) {
+          return Status::Invalid("Casting from ", input.type->ToString(), " to ",
+                                 output->type->ToString(),
+                                 " would lose data: ", in_chunk[i]);
+        }
+      }
+    }
+    return Status::OK();
+  });
+}
+
 template <typename in_type, typename out_type>
 void ShiftTime(KernelContext* ctx, const util::DivideOrMultiply factor_op,
                const int64_t factor, const ArrayData& input, ArrayData* output) {
@@ -54,34 +167,8 @@ void ShiftTime(KernelContext* ctx, const util::DivideOrMultiply factor_op,
         out_data[i] = static_cast<out_type>(in_data[i] * factor);
       }
     } else {
-#define RAISE_OVERFLOW_CAST(VAL)                                                  \
-  ctx->SetStatus(Status::Invalid("Casting from ", input.type->ToString(), " to ", \
-                                 output->type->ToString(), " would result in ",   \
-                                 "out of bounds timestamp: ", VAL));
-
-      int64_t max_val = std::numeric_limits<int64_t>::max() / factor;
-      int64_t min_val = std::numeric_limits<int64_t>::min() / factor;
-      if (input.null_count != 0) {
-        BitmapReader bit_reader(input.buffers[0]->data(), input.offset, input.length);
-        for (int64_t i = 0; i < input.length; i++) {
-          if (bit_reader.IsSet() && (in_data[i] < min_val || in_data[i] > max_val)) {
-            RAISE_OVERFLOW_CAST(in_data[i]);
-            break;
-          }
-          out_data[i] = static_cast<out_type>(in_data[i] * factor);
-          bit_reader.Next();
-        }
-      } else {
-        for (int64_t i = 0; i < input.length; i++) {
-          if (in_data[i] < min_val || in_data[i] > max_val) {
-            RAISE_OVERFLOW_CAST(in_data[i]);
-            break;
-          }
-          out_data[i] = static_cast<out_type>(in_data[i] * factor);
-        }
-      }
-
-#undef RAISE_OVERFLOW_CAST
+      ctx->SetStatus(
+          ShiftTimeChecked<in_type, out_type>(factor_op, factor, input, output));
     }
   } else {
     if (options.allow_time_truncate) {
@@ -89,31 +176,8 @@ void ShiftTime(KernelContext* ctx, const util::DivideOrMultiply factor_op,
         out_data[i] = static_cast<out_type>(in_data[i] / factor);
       }
     } else {
-#define RAISE_INVALID_CAST(VAL)                                                   \
-  ctx->SetStatus(Status::Invalid("Casting from ", input.type->ToString(), " to ", \
-                                 output->type->ToString(), " would lose data: ", VAL));
-
-      if (input.null_count != 0) {
-        BitmapReader bit_reader(input.buffers[0]->data(), input.offset, input.length);
-        for (int64_t i = 0; i < input.length; i++) {
-          out_data[i] = static_cast<out_type>(in_data[i] / factor);
-          if (bit_reader.IsSet() && (out_data[i] * factor != in_data[i])) {
-            RAISE_INVALID_CAST(in_data[i]);
-            break;
-          }
-          bit_reader.Next();
-        }
-      } else {
-        for (int64_t i = 0; i < input.length; i++) {
-          out_data[i] = static_cast<out_type>(in_data[i] / factor);
-          if (out_data[i] * factor != in_data[i]) {
-            RAISE_INVALID_CAST(in_data[i]);
-            break;
-          }
-        }
-      }
-
-#undef RAISE_INVALID_CAST
+      ctx->SetStatus(
+          ShiftTimeChecked<in_type, out_type>(factor_op, factor, input, output));
     }
   }
 }
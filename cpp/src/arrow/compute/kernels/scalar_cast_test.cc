@@ -270,6 +270,50 @@ class TestCast : public TestBase {
                                     /*check_scalar=*/false);
   }
 
+  template <typename DestType>
+  void TestCastDecimalToString() {
+    auto dest_type = TypeTraits<DestType>::type_singleton();
+
+    CheckCaseJSON(decimal(5, 2), dest_type,
+                  R"(["0.00", "1.50", "-0.05", "999.99", "-999.99", null])",
+                  R"(["0.00", "1.50", "-0.05", "999.99", "-999.99", null])",
+                  /*check_scalar=*/false);
+    CheckCaseJSON(decimal(38, 0), dest_type,
+                  R"(["99999999999999999999999999999999999999", "-1234567890123456789012",
+                      null])",
+                  R"(["99999999999999999999999999999999999999", "-1234567890123456789012",
+                      null])",
+                  /*check_scalar=*/false);
+    CheckCaseJSON(decimal(38, 37), dest_type,
+                  R"(["1.2345678901234567890123456789012345678",
+                      "0.0000000000000000000000000000000000001"])",
+                  R"(["1.2345678901234567890123456789012345678", "1.E-37"])",
+                  /*check_scalar=*/false);
+  }
+
+  template <typename SourceType>
+  void TestCastStringToDecimal() {
+    auto src_type = TypeTraits<SourceType>::type_singleton();
+
+    CheckCaseJSON(src_type, decimal(5, 2),
+                  R"(["0", "1.5", "-.05", "999.99", "+12.300", "-1.2e2", "0.00e5",
+                      null])",
+                  R"(["0.00", "1.50", "-0.05", "999.99", "12.30", "-120.00", "0.00",
+                      null])");
+    CheckCaseJSON(src_type, decimal(38, 9),
+                  R"(["12345678901234567890.123456789", "-1E20", null])",
+                  R"(["12345678901234567890.123456789",
+                      "-100000000000000000000.000000000", null])");
+
+    CheckFailsJSON(src_type, decimal(5, 2), R"(["x"])");
+    CheckFailsJSON(src_type, decimal(5, 2), R"(["1.2.3"])");
+    // Too many digits after rescaling
+    CheckFailsJSON(src_type, decimal(5, 2), R"(["1000"])");
+    CheckFailsJSON(src_type, decimal(5, 2), R"(["1e3"])");
+    // Rescaling would drop non-zero digits
+    CheckFailsJSON(src_type, decimal(5, 2), R"(["1.234"])");
+  }
+
   template <typename DestType>
   void TestCastNumberToString() {
     auto dest_type = TypeTraits<DestType>::type_singleton();
@@ -334,6 +378,11 @@ class TestCast : public TestBase {
     v_int = {"9223372036854775807", "0", "-9223372036854775808", "0", "0"};
     e_int64 = {9223372036854775807LL, 0, (-9223372036854775807LL - 1), 0, 0};
     CheckCase<SourceType, Int64Type>(v_int, is_valid, e_int64, options);
+    // Without nulls
+    v_int = {"12345678", "-1234567890123", "0", "99", "-9223372036854775808"};
+    e_int64 = {12345678, -1234567890123LL, 0, 99, (-9223372036854775807LL - 1)};
+    CheckCase<SourceType, Int64Type>(v_int, {true, true, true, true, true}, e_int64,
+                                     options);
 
     // string to uint
     std::vector<std::string> v_uint = {"0", "1", "127", "255", "0"};
@@ -611,6 +660,53 @@ TEST_F(TestCast, IntegerUnsignedToSigned) {
                                    options);
 }
 
+TEST_F(TestCast, IntegerSameWidthZeroCopy) {
+  auto arr = ArrayFromJSON(int32(), "[0, null, 7, 2147483647]");
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Array> result, Cast(*arr, uint32()));
+  ASSERT_OK(result->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[0, null, 7, 2147483647]"), *result);
+  AssertBufferSame(*arr, *result, 1);
+
+  // Sliced input
+  ASSERT_OK_AND_ASSIGN(result, Cast(*arr->Slice(1), uint32()));
+  ASSERT_OK(result->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[null, 7, 2147483647]"), *result);
+
+  ASSERT_RAISES(Invalid, Cast(*ArrayFromJSON(int32(), "[0, -1]"), uint32()));
+  ASSERT_RAISES(Invalid, Cast(*ArrayFromJSON(int32(), "[0, -1]")->Slice(1), uint32()));
+  // Out of range values behind nulls are ignored
+  ASSERT_OK_AND_ASSIGN(result, Cast(*ArrayFromJSON(int32(), "[0, -1]")->Slice(0, 1),
+                                    uint32()));
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[0]"), *result);
+}
+
+TEST_F(TestCast, IntegerDowncastLongArrays) {
+  // Exercise the chunked range checks over several blocks
+  CastOptions options;
+  const int64_t length = 5000;
+  std::vector<bool> is_valid(length, true);
+  std::vector<int64_t> values(length);
+  for (int64_t i = 0; i < length; ++i) {
+    values[i] = i % 200 - 100;
+  }
+  std::vector<int8_t> expected(values.begin(), values.end());
+  CheckCase<Int64Type, Int8Type>(values, is_valid, expected, options);
+
+  // A single out of range value, anywhere, makes the cast fail...
+  for (int64_t index : {int64_t(0), int64_t(1023), int64_t(1024), length - 1}) {
+    std::vector<int64_t> bad_values = values;
+    bad_values[index] = 1000;
+    CheckFails<Int64Type>(bad_values, is_valid, int8(), options);
+
+    // ...unless it is null
+    std::vector<bool> bad_is_valid = is_valid;
+    bad_is_valid[index] = false;
+    std::vector<int8_t> bad_expected = expected;
+    bad_expected[index] = 0;
+    CheckCase<Int64Type, Int8Type>(bad_values, bad_is_valid, bad_expected, options);
+  }
+}
+
 TEST_F(TestCast, ToIntDowncastUnsafe) {
   CastOptions options;
   options.allow_int_overflow = true;
@@ -729,6 +825,34 @@ TEST_F(TestCast, IntToFloatingPoint) {
   CheckFails<UInt64Type>({1LL << 53, (1LL << 53) + 1}, {true, true}, float64(), options);
 }
 
+TEST_F(TestCast, InPlace) {
+  auto SafeTo = [](std::shared_ptr<DataType> to_type) {
+    auto options = CastOptions::Safe();
+    options.to_type = std::move(to_type);
+    return options;
+  };
+  auto options = SafeTo(float32());
+
+  auto values = ArrayFromJSON(int32(), "[1, -2, null, 4]");
+  ASSERT_OK_AND_ASSIGN(Datum expected, Cast(values, options));
+  ASSERT_OK_AND_ASSIGN(Datum result, CastInPlace(values, options));
+  ASSERT_OK(result.make_array()->ValidateFull());
+  ASSERT_EQ(values->data()->buffers[1], result.array()->buffers[1]);
+  AssertArraysEqual(*expected.make_array(), *result.make_array());
+
+  // Widening casts allocate
+  values = ArrayFromJSON(int32(), "[1, -2, null, 4]");
+  ASSERT_OK_AND_ASSIGN(result, CastInPlace(values, SafeTo(int64())));
+  ASSERT_NE(values->data()->buffers[1], result.array()->buffers[1]);
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[1, -2, null, 4]"), *result.make_array());
+
+  // As do casts from floating point to integer, whose truncation check needs
+  // the input
+  values = ArrayFromJSON(float32(), "[1.5, 2]");
+  ASSERT_RAISES(Invalid, CastInPlace(values, SafeTo(int32())));
+  AssertArraysEqual(*ArrayFromJSON(float32(), "[1.5, 2]"), *values);
+}
+
 TEST_F(TestCast, DecimalToInt) {
   CastOptions options;
   std::vector<bool> is_valid2 = {true, true};
@@ -1087,6 +1211,16 @@ TEST_F(TestCast, TimestampToTimestamp) {
   CheckFails<TimestampType>(timestamp(TimeUnit::SECOND), v11, is_valid,
                             timestamp(TimeUnit::NANO), options,
                             /*check_scalar=*/false);
+
+  // Overflowing or truncated values are ignored when null
+  std::vector<bool> v11_is_valid = {false, true, true, false, false};
+  std::vector<int64_t> e11 = {0, -5364662400000000000, 946684800000000000, 0, 0};
+  CheckTimestampCast(options, TimeUnit::SECOND, TimeUnit::NANO, v11, e11, v11_is_valid);
+
+  std::vector<bool> v8_is_valid = {true, false, false, false, false};
+  std::vector<int64_t> e8_nulls = {0, 0, 0, 0, 0};
+  CheckTimestampCast(options, TimeUnit::MILLI, TimeUnit::SECOND, v8, e8_nulls,
+                     v8_is_valid);
 }
 
 TEST_F(TestCast, TimestampToDate32_Date64) {
@@ -1559,6 +1693,10 @@ TEST_F(TestCast, StringToNumberErrors) {
   CheckFails<StringType>({"-1"}, is_valid, uint8(), options);
 
   CheckFails<StringType>({"z"}, is_valid, float32(), options);
+
+  CheckFails<StringType>({"1", "12345678901", "3"}, {true, true, true}, int32(),
+                         options);
+  CheckFails<StringType>({"1.5", "2.5e", "3"}, {true, true, true}, float64(), options);
 }
 
 TEST_F(TestCast, StringToTimestamp) { TestCastStringToTimestamp<StringType>(); }
@@ -1593,6 +1731,14 @@ TEST_F(TestCast, NumberToString) { TestCastNumberToString<StringType>(); }
 
 TEST_F(TestCast, NumberToLargeString) { TestCastNumberToString<LargeStringType>(); }
 
+TEST_F(TestCast, DecimalToString) { TestCastDecimalToString<StringType>(); }
+
+TEST_F(TestCast, DecimalToLargeString) { TestCastDecimalToString<LargeStringType>(); }
+
+TEST_F(TestCast, StringToDecimal) { TestCastStringToDecimal<StringType>(); }
+
+TEST_F(TestCast, LargeStringToDecimal) { TestCastStringToDecimal<LargeStringType>(); }
+
 TEST_F(TestCast, BooleanToString) { TestCastBooleanToString<StringType>(); }
 
 TEST_F(TestCast, BooleanToLargeString) { TestCastBooleanToString<LargeStringType>(); }
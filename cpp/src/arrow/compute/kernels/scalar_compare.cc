@@ -15,7 +15,12 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+
+#include "arrow/array/run_end_internal.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/common.h"
+#include "arrow/compute/kernels/scalar_compare_internal.h"
 
 namespace arrow {
 
@@ -28,43 +33,6 @@ namespace internal {
 
 namespace {
 
-struct Equal {
-  template <typename T>
-  static constexpr bool Call(KernelContext*, const T& left, const T& right) {
-    return left == right;
-  }
-};
-
-struct NotEqual {
-  template <typename T>
-  static constexpr bool Call(KernelContext*, const T& left, const T& right) {
-    return left != right;
-  }
-};
-
-struct Greater {
-  template <typename T>
-  static constexpr bool Call(KernelContext*, const T& left, const T& right) {
-    return left > right;
-  }
-};
-
-struct GreaterEqual {
-  template <typename T>
-  static constexpr bool Call(KernelContext*, const T& left, const T& right) {
-    return left >= right;
-  }
-};
-
-// Implement Less, LessEqual by flipping arguments to Greater, GreaterEqual
-
-template <typename Op>
-void AddIntegerCompare(const std::shared_ptr<DataType>& ty, ScalarFunction* func) {
-  auto exec =
-      GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(*ty);
-  DCHECK_OK(func->AddKernel({ty, ty}, boolean(), std::move(exec)));
-}
-
 template <typename InType, typename Op>
 void AddGenericCompare(const std::shared_ptr<DataType>& ty, ScalarFunction* func) {
   DCHECK_OK(
@@ -72,56 +40,98 @@ void AddGenericCompare(const std::shared_ptr<DataType>& ty, ScalarFunction* func
                       applicator::ScalarBinaryEqualTypes<BooleanType, InType, Op>::Exec));
 }
 
+// Write the comparison of each slot to the output bitmap, or to the output
+// scalar if all arguments are scalars
+template <typename CompareFunc>
+void WriteCompareOutput(Datum* out, CompareFunc&& compare) {
+  if (out->is_scalar()) {
+    auto out_scalar = checked_cast<BooleanScalar*>(out->scalar().get());
+    if (out_scalar->is_valid) {
+      out_scalar->value = compare(0);
+    }
+    return;
+  }
+  ArrayData* out_arr = out->mutable_array();
+  int64_t i = 0;
+  GenerateBitsUnrolled(out_arr->buffers[1]->mutable_data(), out_arr->offset,
+                       out_arr->length, [&]() -> bool { return compare(i++); });
+}
+
+// Decimals of different scales are compared at the larger scale, in 64-bit
+// integers when that needs 18 digits or less. When scaling up the other operand
+// could need more than 38 digits, the operand with the larger scale is divided
+// down instead, and a tie on the quotient is broken by the sign of the remainder.
 template <typename Op>
-std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name) {
+void ExecDecimalCompare(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  const auto& left_type = checked_cast<const Decimal128Type&>(*batch[0].type());
+  const auto& right_type = checked_cast<const Decimal128Type&>(*batch[1].type());
+  const int32_t scale = std::max(left_type.scale(), right_type.scale());
+  const int32_t left_up = scale - left_type.scale();
+  const int32_t right_up = scale - right_type.scale();
+  const int32_t precision =
+      std::max(left_type.precision() + left_up, right_type.precision() + right_up);
+  DecimalValues left(batch[0]);
+  DecimalValues right(batch[1]);
+
+  if (precision <= 18) {
+    const auto left_multiplier =
+        static_cast<int64_t>(Decimal128::GetScaleMultiplier(left_up).low_bits());
+    const auto right_multiplier =
+        static_cast<int64_t>(Decimal128::GetScaleMultiplier(right_up).low_bits());
+    WriteCompareOutput(out, [&](int64_t i) {
+      return Op::Call(ctx, left.ReadInt64(i) * left_multiplier,
+                      right.ReadInt64(i) * right_multiplier);
+    });
+  } else if (left_up == 0 && right_up == 0) {
+    WriteCompareOutput(out, [&](int64_t i) {
+      return Op::Call(ctx, left.Read(i), right.Read(i));
+    });
+  } else if (precision <= 38) {
+    WriteCompareOutput(out, [&](int64_t i) {
+      return Op::Call(ctx, left.Read(i).IncreaseScaleBy(left_up),
+                      right.Read(i).IncreaseScaleBy(right_up));
+    });
+  } else if (left_up > 0) {
+    const Decimal128 divisor = Decimal128::GetScaleMultiplier(left_up);
+    WriteCompareOutput(out, [&](int64_t i) {
+      const Decimal128 left_value = left.Read(i);
+      const BasicDecimal128 dividend = right.Read(i);
+      BasicDecimal128 quotient, remainder;
+      dividend.Divide(divisor, &quotient, &remainder);
+      return left_value != quotient
+                 ? Op::Call(ctx, left_value, Decimal128(quotient))
+                 : Op::Call(ctx, Decimal128(0), Decimal128(remainder));
+    });
+  } else {
+    const Decimal128 divisor = Decimal128::GetScaleMultiplier(right_up);
+    WriteCompareOutput(out, [&](int64_t i) {
+      const Decimal128 right_value = right.Read(i);
+      const BasicDecimal128 dividend = left.Read(i);
+      BasicDecimal128 quotient, remainder;
+      dividend.Divide(divisor, &quotient, &remainder);
+      return quotient != right_value
+                 ? Op::Call(ctx, Decimal128(quotient), right_value)
+                 : Op::Call(ctx, Decimal128(remainder), Decimal128(0));
+    });
+  }
+}
+
+template <typename Op>
+std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name,
+                                                    CompareOperator op) {
   auto func = std::make_shared<ScalarFunction>(name, Arity::Binary());
 
   DCHECK_OK(func->AddKernel(
       {boolean(), boolean()}, boolean(),
       applicator::ScalarBinary<BooleanType, BooleanType, BooleanType, Op>::Exec));
 
-  for (const std::shared_ptr<DataType>& ty : IntTypes()) {
-    AddIntegerCompare<Op>(ty, func.get());
-  }
-  AddIntegerCompare<Op>(date32(), func.get());
-  AddIntegerCompare<Op>(date64(), func.get());
-
-  AddGenericCompare<FloatType, Op>(float32(), func.get());
-  AddGenericCompare<DoubleType, Op>(float64(), func.get());
-
-  // Add timestamp kernels
-  for (auto unit : AllTimeUnits()) {
-    InputType in_type(match::TimestampTypeUnit(unit));
-    auto exec =
-        GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(
-            int64());
-    DCHECK_OK(func->AddKernel({in_type, in_type}, boolean(), std::move(exec)));
-  }
-
-  // Duration
-  for (auto unit : AllTimeUnits()) {
-    InputType in_type(match::DurationTypeUnit(unit));
-    auto exec =
-        GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(
-            int64());
-    DCHECK_OK(func->AddKernel({in_type, in_type}, boolean(), std::move(exec)));
-  }
-
-  // Time32 and Time64
-  for (auto unit : {TimeUnit::SECOND, TimeUnit::MILLI}) {
-    InputType in_type(match::Time32TypeUnit(unit));
-    auto exec =
-        GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(
-            int32());
-    DCHECK_OK(func->AddKernel({in_type, in_type}, boolean(), std::move(exec)));
-  }
-  for (auto unit : {TimeUnit::MICRO, TimeUnit::NANO}) {
-    InputType in_type(match::Time64TypeUnit(unit));
-    auto exec =
-        GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(
-            int64());
-    DCHECK_OK(func->AddKernel({in_type, in_type}, boolean(), std::move(exec)));
-  }
+  AddPrimitiveCompareKernels<Op, CompareLanePacker>(func.get(), SimdLevel::NONE);
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  AddPrimitiveCompareAvx2Kernels(op, func.get());
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  AddPrimitiveCompareAvx512Kernels(op, func.get());
+#endif
 
   for (const std::shared_ptr<DataType>& ty : BaseBinaryTypes()) {
     auto exec =
@@ -129,6 +139,14 @@ std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name) {
     DCHECK_OK(func->AddKernel({ty, ty}, boolean(), std::move(exec)));
   }
 
+  AddGenericCompare<BinaryViewType, Op>(binary_view(), func.get());
+  AddGenericCompare<BinaryViewType, Op>(utf8_view(), func.get());
+
+  // Decimals of any precision and scale
+  InputType decimal_type(Type::DECIMAL);
+  DCHECK_OK(
+      func->AddKernel({decimal_type, decimal_type}, boolean(), ExecDecimalCompare<Op>));
+
   return func;
 }
 
@@ -143,17 +161,87 @@ std::shared_ptr<ScalarFunction> MakeFlippedFunction(std::string name,
   return flipped_func;
 }
 
+Result<ValueDescr> RunEndEncodedCompareType(KernelContext*,
+                                            const std::vector<ValueDescr>& args) {
+  const auto& ree_type = checked_cast<const RunEndEncodedType&>(*args[0].type);
+  return ValueDescr::Array(run_end_encoded(ree_type.run_end_type(), boolean()));
+}
+
+// Comparing a run-end encoded array with a scalar compares the value of each
+// run once, and the output shares the run ends of the input. This is added to
+// each function after flipping, since the flipped kernels keep the signature.
+void AddRunEndEncodedCompare(const std::string& name, ScalarFunction* func) {
+  auto exec = [name](KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const ArrayData& input = *batch[0].array();
+    int64_t physical_offset = 0, physical_length = 0;
+    if (input.length > 0) {
+      physical_offset = ::arrow::internal::FindPhysicalIndex(input, 0);
+      physical_length = ::arrow::internal::FindPhysicalIndex(input, input.length - 1) -
+                        physical_offset + 1;
+    }
+    Datum values(input.child_data[1]->Slice(physical_offset, physical_length));
+    Datum result;
+    KERNEL_RETURN_IF_ERROR(
+        ctx, CallFunction(name, {values, batch[1]}, ctx->exec_context()).Value(&result));
+
+    const auto& ree_type = checked_cast<const RunEndEncodedType&>(*input.type);
+    out->value = ArrayData::Make(
+        run_end_encoded(ree_type.run_end_type(), boolean()), input.length, {nullptr},
+        {input.child_data[0]->Slice(physical_offset, physical_length), result.array()},
+        /*null_count=*/0, input.offset);
+  };
+  ScalarKernel kernel(
+      {InputType::Array(Type::RUN_END_ENCODED), InputType(ValueDescr::SCALAR)},
+      OutputType(RunEndEncodedCompareType), std::move(exec));
+  kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+  kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+  DCHECK_OK(func->AddKernel(std::move(kernel)));
+}
+
+// Comparing a dictionary array with a scalar compares each dictionary value
+// once, and the per-value results are then gathered through the indices. Null
+// indices give null outputs.
+void AddDictionaryCompare(const std::string& name, ScalarFunction* func) {
+  auto exec = [name](KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    DictionaryArray input(batch[0].array());
+    Datum dictionary_result;
+    KERNEL_RETURN_IF_ERROR(ctx, CallFunction(name, {input.dictionary(), batch[1]},
+                                             ctx->exec_context())
+                                    .Value(&dictionary_result));
+    Datum result;
+    KERNEL_RETURN_IF_ERROR(
+        ctx, Take(dictionary_result, input.indices(), TakeOptions::Defaults(),
+                  ctx->exec_context())
+                 .Value(&result));
+    out->value = result.array();
+  };
+  ScalarKernel kernel({InputType::Array(Type::DICTIONARY), InputType(ValueDescr::SCALAR)},
+                      boolean(), std::move(exec));
+  kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+  kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+  DCHECK_OK(func->AddKernel(std::move(kernel)));
+}
+
 }  // namespace
 
 void RegisterScalarComparison(FunctionRegistry* registry) {
-  DCHECK_OK(registry->AddFunction(MakeCompareFunction<Equal>("equal")));
-  DCHECK_OK(registry->AddFunction(MakeCompareFunction<NotEqual>("not_equal")));
+  auto equal = MakeCompareFunction<Equal>("equal", EQUAL);
+  auto not_equal = MakeCompareFunction<NotEqual>("not_equal", NOT_EQUAL);
 
-  auto greater = MakeCompareFunction<Greater>("greater");
-  auto greater_equal = MakeCompareFunction<GreaterEqual>("greater_equal");
+  auto greater = MakeCompareFunction<Greater>("greater", GREATER);
+  auto greater_equal = MakeCompareFunction<GreaterEqual>("greater_equal", GREATER_EQUAL);
 
   auto less = MakeFlippedFunction("less", *greater);
   auto less_equal = MakeFlippedFunction("less_equal", *greater_equal);
+
+  for (ScalarFunction* func : {equal.get(), not_equal.get(), greater.get(),
+                               greater_equal.get(), less.get(), less_equal.get()}) {
+    AddRunEndEncodedCompare(func->name(), func);
+    AddDictionaryCompare(func->name(), func);
+  }
+
+  DCHECK_OK(registry->AddFunction(std::move(equal)));
+  DCHECK_OK(registry->AddFunction(std::move(not_equal)));
   DCHECK_OK(registry->AddFunction(std::move(less)));
   DCHECK_OK(registry->AddFunction(std::move(less_equal)));
   DCHECK_OK(registry->AddFunction(std::move(greater)));
@@ -0,0 +1,62 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <immintrin.h>
+
+#include "arrow/compute/kernels/scalar_compare_internal.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+namespace {
+
+// Gather the high bit of the 64 lanes with two movemasks
+struct CompareLanePackerAvx2 {
+  static uint64_t Pack(const uint8_t* lanes) {
+    const __m256i low = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes));
+    const __m256i high =
+        _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes + 32));
+    return static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(low))) |
+           (static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(high)))
+            << 32);
+  }
+};
+
+}  // namespace
+
+void AddPrimitiveCompareAvx2Kernels(CompareOperator op, ScalarFunction* func) {
+  switch (op) {
+    case EQUAL:
+      return AddPrimitiveCompareKernels<Equal, CompareLanePackerAvx2>(func,
+                                                                       SimdLevel::AVX2);
+    case NOT_EQUAL:
+      return AddPrimitiveCompareKernels<NotEqual, CompareLanePackerAvx2>(
+          func, SimdLevel::AVX2);
+    case GREATER:
+      return AddPrimitiveCompareKernels<Greater, CompareLanePackerAvx2>(func,
+                                                                         SimdLevel::AVX2);
+    case GREATER_EQUAL:
+      return AddPrimitiveCompareKernels<GreaterEqual, CompareLanePackerAvx2>(
+          func, SimdLevel::AVX2);
+    default:
+      DCHECK(false) << "less and less_equal are flipped from greater kernels";
+  }
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,57 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <immintrin.h>
+
+#include "arrow/compute/kernels/scalar_compare_internal.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+namespace {
+
+// Gather the high bit of the 64 lanes into a mask register
+struct CompareLanePackerAvx512 {
+  static uint64_t Pack(const uint8_t* lanes) {
+    return static_cast<uint64_t>(_mm512_movepi8_mask(_mm512_load_si512(lanes)));
+  }
+};
+
+}  // namespace
+
+void AddPrimitiveCompareAvx512Kernels(CompareOperator op, ScalarFunction* func) {
+  switch (op) {
+    case EQUAL:
+      return AddPrimitiveCompareKernels<Equal, CompareLanePackerAvx512>(
+          func, SimdLevel::AVX512);
+    case NOT_EQUAL:
+      return AddPrimitiveCompareKernels<NotEqual, CompareLanePackerAvx512>(
+          func, SimdLevel::AVX512);
+    case GREATER:
+      return AddPrimitiveCompareKernels<Greater, CompareLanePackerAvx512>(
+          func, SimdLevel::AVX512);
+    case GREATER_EQUAL:
+      return AddPrimitiveCompareKernels<GreaterEqual, CompareLanePackerAvx512>(
+          func, SimdLevel::AVX512);
+    default:
+      DCHECK(false) << "less and less_equal are flipped from greater kernels";
+  }
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
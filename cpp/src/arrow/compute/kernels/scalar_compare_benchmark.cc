@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "arrow/compute/api_scalar.h"
+#include "arrow/compute/cast.h"
 #include "arrow/compute/kernels/test_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -30,12 +31,16 @@ namespace compute {
 
 constexpr auto kSeed = 0x94378165;
 
+// Primitive arrays report bytes of input processed, so results are in GB/s
 template <CompareOperator op, typename Type>
 static void CompareArrayScalar(benchmark::State& state) {
-  RegressionArgs args(state, /*size_is_bytes=*/false);
+  constexpr bool kIsPrimitive = is_number_type<Type>::value;
+  RegressionArgs args(state, /*size_is_bytes=*/kIsPrimitive);
   auto ty = TypeTraits<Type>::type_singleton();
+  const int64_t length =
+      kIsPrimitive ? args.size / ::arrow::internal::GetByteWidth(*ty) : args.size;
   auto rand = random::RandomArrayGenerator(kSeed);
-  auto array = rand.ArrayOf(ty, args.size, args.null_proportion);
+  auto array = rand.ArrayOf(ty, length, args.null_proportion);
   auto scalar = *rand.ArrayOf(ty, 1, 0)->GetScalar(0);
   for (auto _ : state) {
     ABORT_NOT_OK(Compare(array, Datum(scalar), CompareOptions(op)).status());
@@ -44,11 +49,15 @@ static void CompareArrayScalar(benchmark::State& state) {
 
 template <CompareOperator op, typename Type>
 static void CompareArrayArray(benchmark::State& state) {
-  RegressionArgs args(state, /*size_is_bytes=*/false);
+  constexpr bool kIsPrimitive = is_number_type<Type>::value;
+  RegressionArgs args(state, /*size_is_bytes=*/kIsPrimitive);
   auto ty = TypeTraits<Type>::type_singleton();
+  // Both inputs together take args.size bytes
+  const int64_t length =
+      kIsPrimitive ? args.size / (2 * ::arrow::internal::GetByteWidth(*ty)) : args.size;
   auto rand = random::RandomArrayGenerator(kSeed);
-  auto lhs = rand.ArrayOf(ty, args.size, args.null_proportion);
-  auto rhs = rand.ArrayOf(ty, args.size, args.null_proportion);
+  auto lhs = rand.ArrayOf(ty, length, args.null_proportion);
+  auto rhs = rand.ArrayOf(ty, length, args.null_proportion);
   for (auto _ : state) {
     ABORT_NOT_OK(Compare(lhs, rhs, CompareOptions(op)).status());
   }
@@ -62,6 +71,22 @@ static void GreaterArrayScalarInt64(benchmark::State& state) {
   CompareArrayScalar<GREATER, Int64Type>(state);
 }
 
+static void EqualArrayScalarInt8(benchmark::State& state) {
+  CompareArrayScalar<EQUAL, Int8Type>(state);
+}
+
+static void LessArrayScalarInt32(benchmark::State& state) {
+  CompareArrayScalar<LESS, Int32Type>(state);
+}
+
+static void GreaterArrayArrayDouble(benchmark::State& state) {
+  CompareArrayArray<GREATER, DoubleType>(state);
+}
+
+static void GreaterEqualArrayScalarFloat(benchmark::State& state) {
+  CompareArrayScalar<GREATER_EQUAL, FloatType>(state);
+}
+
 static void GreaterArrayArrayString(benchmark::State& state) {
   CompareArrayArray<GREATER, StringType>(state);
 }
@@ -70,11 +95,35 @@ static void GreaterArrayScalarString(benchmark::State& state) {
   CompareArrayScalar<GREATER, StringType>(state);
 }
 
+// Decimals of different scales are rescaled to compare them, in 64-bit integers
+// for precision 8 and in Decimal128 for precision 30
+template <int32_t kPrecision>
+static void GreaterArrayArrayDecimal(benchmark::State& state) {
+  RegressionArgs args(state, /*size_is_bytes=*/false);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto lhs = Cast(*rand.Float64(args.size, -1000, 1000, args.null_proportion),
+                  decimal(kPrecision, 2), CastOptions::Unsafe())
+                 .ValueOrDie();
+  auto rhs = Cast(*rand.Float64(args.size, -1000, 1000, args.null_proportion),
+                  decimal(kPrecision, 3), CastOptions::Unsafe())
+                 .ValueOrDie();
+  for (auto _ : state) {
+    ABORT_NOT_OK(Compare(lhs, rhs, CompareOptions(GREATER)).status());
+  }
+}
+
 BENCHMARK(GreaterArrayArrayInt64)->Apply(RegressionSetArgs);
 BENCHMARK(GreaterArrayScalarInt64)->Apply(RegressionSetArgs);
+BENCHMARK(EqualArrayScalarInt8)->Apply(RegressionSetArgs);
+BENCHMARK(LessArrayScalarInt32)->Apply(RegressionSetArgs);
+BENCHMARK(GreaterArrayArrayDouble)->Apply(RegressionSetArgs);
+BENCHMARK(GreaterEqualArrayScalarFloat)->Apply(RegressionSetArgs);
 
 BENCHMARK(GreaterArrayArrayString)->Apply(RegressionSetArgs);
 BENCHMARK(GreaterArrayScalarString)->Apply(RegressionSetArgs);
 
+BENCHMARK_TEMPLATE(GreaterArrayArrayDecimal, 8)->Apply(RegressionSetArgs);
+BENCHMARK_TEMPLATE(GreaterArrayArrayDecimal, 30)->Apply(RegressionSetArgs);
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,195 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_generate.h"
+#include "arrow/util/ubsan.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+struct Equal {
+  template <typename T>
+  static constexpr bool Call(KernelContext*, const T& left, const T& right) {
+    return left == right;
+  }
+};
+
+struct NotEqual {
+  template <typename T>
+  static constexpr bool Call(KernelContext*, const T& left, const T& right) {
+    return left != right;
+  }
+};
+
+struct Greater {
+  template <typename T>
+  static constexpr bool Call(KernelContext*, const T& left, const T& right) {
+    return left > right;
+  }
+};
+
+struct GreaterEqual {
+  template <typename T>
+  static constexpr bool Call(KernelContext*, const T& left, const T& right) {
+    return left >= right;
+  }
+};
+
+// Implement Less, LessEqual by flipping arguments to Greater, GreaterEqual
+
+// Primitive values are compared a block at a time into byte lanes holding
+// 0x00 or 0xFF, a loop compilers turn into packed compares of 8 to 64 values
+// per instruction.  A packer then gathers the lanes of a block into the 64
+// bits of an output word.
+constexpr int64_t kCompareBlockSize = 64;
+
+// Portable packer gathering the high bit of every lane with multiplications
+struct CompareLanePacker {
+  static uint64_t Pack(const uint8_t* lanes) {
+    uint64_t bits = 0;
+    for (int i = 0; i < 8; ++i) {
+      const uint64_t word =
+          BitUtil::FromLittleEndian(util::SafeLoadAs<uint64_t>(lanes + 8 * i));
+      const uint64_t low_bits = (word >> 7) & 0x0101010101010101ULL;
+      bits |= ((low_bits * 0x0102040810204080ULL) >> 56) << (8 * i);
+    }
+    return bits;
+  }
+};
+
+// Write `length` comparison results to `out` starting at bit `out_offset`.
+// Bits up to the first byte boundary and after the last full block are
+// written one at a time, the others a 64-bit word at a time.
+template <typename Packer, typename CompareLanes, typename CompareOne>
+void WriteCompareBitmap(uint8_t* out, int64_t out_offset, int64_t length,
+                        CompareLanes&& compare_lanes, CompareOne&& compare_one) {
+  int64_t i = 0;
+  const int64_t head = std::min(length, BitUtil::RoundUp(out_offset, 8) - out_offset);
+  GenerateBitsUnrolled(out, out_offset, head, [&]() -> bool { return compare_one(i++); });
+  uint8_t* out_bytes = out + BitUtil::CeilDiv(out_offset, 8);
+  alignas(64) uint8_t lanes[kCompareBlockSize];
+  for (; i + kCompareBlockSize <= length; i += kCompareBlockSize) {
+    compare_lanes(i, lanes);
+    util::SafeStore(out_bytes, BitUtil::ToLittleEndian(Packer::Pack(lanes)));
+    out_bytes += kCompareBlockSize / 8;
+  }
+  GenerateBitsUnrolled(out, out_offset + i, length - i,
+                       [&]() -> bool { return compare_one(i++); });
+}
+
+// Compare kernel for primitive types.  Array-scalar and scalar-array compares
+// read the scalar once and never broadcast it.
+template <typename OutType, typename ArgType, typename Op, typename Packer>
+struct ComparePrimitive {
+  using T = typename ArgType::c_type;
+
+  template <typename GetLeft, typename GetRight>
+  static void Write(KernelContext* ctx, ArrayData* out, GetLeft&& left,
+                    GetRight&& right) {
+    WriteCompareBitmap<Packer>(
+        out->buffers[1]->mutable_data(), out->offset, out->length,
+        [&](int64_t i, uint8_t* lanes) {
+          for (int64_t j = 0; j < kCompareBlockSize; ++j) {
+            lanes[j] = Op::Call(ctx, left(i + j), right(i + j)) ? 0xFF : 0;
+          }
+        },
+        [&](int64_t i) { return Op::Call(ctx, left(i), right(i)); });
+  }
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    if (batch[0].is_scalar() && batch[1].is_scalar()) {
+      return applicator::ScalarBinaryEqualTypes<BooleanType, ArgType, Op>::Exec(
+          ctx, batch, out);
+    }
+    ArrayData* out_arr = out->mutable_array();
+    if (batch[0].is_scalar()) {
+      const T left = UnboxScalar<ArgType>::Unbox(*batch[0].scalar());
+      const T* right = batch[1].array()->GetValues<T>(1);
+      Write(
+          ctx, out_arr, [&](int64_t) { return left; },
+          [&](int64_t i) { return right[i]; });
+    } else if (batch[1].is_scalar()) {
+      const T* left = batch[0].array()->GetValues<T>(1);
+      const T right = UnboxScalar<ArgType>::Unbox(*batch[1].scalar());
+      Write(
+          ctx, out_arr, [&](int64_t i) { return left[i]; },
+          [&](int64_t) { return right; });
+    } else {
+      const T* left = batch[0].array()->GetValues<T>(1);
+      const T* right = batch[1].array()->GetValues<T>(1);
+      Write(
+          ctx, out_arr, [&](int64_t i) { return left[i]; },
+          [&](int64_t i) { return right[i]; });
+    }
+  }
+};
+
+// Add the compare kernels of all numeric and temporal types to `func`
+template <typename Op, typename Packer>
+void AddPrimitiveCompareKernels(ScalarFunction* func, SimdLevel::type simd_level) {
+  auto add_kernel = [&](InputType in_type, ArrayKernelExec exec) {
+    ScalarKernel kernel({in_type, in_type}, boolean(), std::move(exec));
+    kernel.simd_level = simd_level;
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
+  };
+
+  std::vector<std::shared_ptr<DataType>> integer_types = IntTypes();
+  integer_types.push_back(date32());
+  integer_types.push_back(date64());
+  for (const std::shared_ptr<DataType>& ty : integer_types) {
+    add_kernel(ty,
+               GeneratePhysicalInteger<ComparePrimitive, BooleanType, Op, Packer>(*ty));
+  }
+
+  add_kernel(float32(), ComparePrimitive<BooleanType, FloatType, Op, Packer>::Exec);
+  add_kernel(float64(), ComparePrimitive<BooleanType, DoubleType, Op, Packer>::Exec);
+
+  for (auto unit : AllTimeUnits()) {
+    add_kernel(match::TimestampTypeUnit(unit),
+               ComparePrimitive<BooleanType, Int64Type, Op, Packer>::Exec);
+    add_kernel(match::DurationTypeUnit(unit),
+               ComparePrimitive<BooleanType, Int64Type, Op, Packer>::Exec);
+  }
+  for (auto unit : {TimeUnit::SECOND, TimeUnit::MILLI}) {
+    add_kernel(match::Time32TypeUnit(unit),
+               ComparePrimitive<BooleanType, Int32Type, Op, Packer>::Exec);
+  }
+  for (auto unit : {TimeUnit::MICRO, TimeUnit::NANO}) {
+    add_kernel(match::Time64TypeUnit(unit),
+               ComparePrimitive<BooleanType, Int64Type, Op, Packer>::Exec);
+  }
+}
+
+// SIMD variants of the primitive compare kernels, for the unflipped
+// operators EQUAL, NOT_EQUAL, GREATER and GREATER_EQUAL
+void AddPrimitiveCompareAvx2Kernels(CompareOperator op, ScalarFunction* func);
+void AddPrimitiveCompareAvx512Kernels(CompareOperator op, ScalarFunction* func);
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
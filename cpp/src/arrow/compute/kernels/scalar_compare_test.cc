@@ -398,6 +398,14 @@ struct CompareRandomNumeric {
         ValidateCompare<Type>(options, array1, fifty);
         ValidateCompare<Type>(options, fifty, array1);
         ValidateCompare<Type>(options, array1, array2);
+
+        // Offsets that are not multiples of 8 and lengths that are not
+        // multiples of the 64-value compare blocks
+        auto sliced1 = Datum(array1.make_array()->Slice(3, length - 10));
+        auto sliced2 = Datum(array2.make_array()->Slice(9, length - 10));
+        ValidateCompare<Type>(options, sliced1, fifty);
+        ValidateCompare<Type>(options, fifty, sliced2);
+        ValidateCompare<Type>(options, sliced1, sliced2);
       }
     }
   }
@@ -451,6 +459,48 @@ TEST(TestCompareTimestamps, Basics) {
   CheckArrayCase(seconds_utc, CompareOperator::EQUAL, "[false, false, true]");
 }
 
+TEST(TestCompareDecimal, Basics) {
+  auto CheckArrayCase = [&](const std::shared_ptr<Array>& lhs,
+                            const std::shared_ptr<Array>& rhs, CompareOperator op,
+                            const char* expected_json) {
+    auto expected = ArrayFromJSON(boolean(), expected_json);
+    ASSERT_OK_AND_ASSIGN(Datum result, Compare(lhs, rhs, CompareOptions(op)));
+    AssertArraysEqual(*expected, *result.make_array(), /*verbose=*/true);
+  };
+
+  // Same scale, and different scales compared in 64-bit integers
+  auto lhs = ArrayFromJSON(decimal(5, 2), R"(["1.23", "-4.50", "0.10", null])");
+  auto rhs = ArrayFromJSON(decimal(5, 2), R"(["1.23", "-4.49", "0.01", "1.00"])");
+  CheckArrayCase(lhs, rhs, CompareOperator::EQUAL, "[true, false, false, null]");
+  CheckArrayCase(lhs, rhs, CompareOperator::LESS, "[false, true, false, null]");
+  rhs = ArrayFromJSON(decimal(6, 3), R"(["1.230", "-4.501", "0.100", "1.000"])");
+  CheckArrayCase(lhs, rhs, CompareOperator::EQUAL, "[true, false, true, null]");
+  CheckArrayCase(lhs, rhs, CompareOperator::GREATER, "[false, true, false, null]");
+  CheckArrayCase(lhs, rhs, CompareOperator::LESS_EQUAL, "[true, false, true, null]");
+
+  // Scaling up the left side to scale 20 could need 40 digits
+  lhs = ArrayFromJSON(decimal(20, 0),
+                      R"(["12345678901234567890", "-1", "2", "3"])");
+  rhs = ArrayFromJSON(decimal(38, 20), R"([
+      "1.00000000000000000000",
+      "-1.00000000000000000001",
+      "2.00000000000000000000",
+      "2.99999999999999999999"])");
+  CheckArrayCase(lhs, rhs, CompareOperator::EQUAL, "[false, false, true, false]");
+  CheckArrayCase(lhs, rhs, CompareOperator::GREATER, "[true, true, false, true]");
+  CheckArrayCase(rhs, lhs, CompareOperator::GREATER, "[false, false, false, false]");
+  CheckArrayCase(rhs, lhs, CompareOperator::LESS, "[true, true, false, true]");
+
+  // Scalar against array
+  ASSERT_OK_AND_ASSIGN(
+      Datum result,
+      Compare(Datum(std::make_shared<Decimal128Scalar>(Decimal128(150), decimal(3, 2))),
+              ArrayFromJSON(decimal(5, 1), R"(["1.4", "1.5", "1.6"])"),
+              CompareOptions(CompareOperator::LESS)));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[false, false, true]"),
+                    *result.make_array(), /*verbose=*/true);
+}
+
 class TestStringCompareKernel : public ::testing::Test {};
 
 TEST_F(TestStringCompareKernel, SimpleCompareArrayScalar) {
@@ -567,5 +617,65 @@ TEST_F(TestStringCompareKernel, RandomCompareArrayArray) {
   }
 }
 
+std::shared_ptr<Array> ToStringView(const Array& array) {
+  const auto& strings = ::arrow::internal::checked_cast<const StringArray&>(array);
+  StringViewBuilder builder;
+  for (int64_t i = 0; i < strings.length(); ++i) {
+    if (strings.IsNull(i)) {
+      ARROW_EXPECT_OK(builder.AppendNull());
+    } else {
+      ARROW_EXPECT_OK(builder.Append(strings.GetView(i)));
+    }
+  }
+  std::shared_ptr<Array> out;
+  ARROW_EXPECT_OK(builder.Finish(&out));
+  return out;
+}
+
+TEST_F(TestStringCompareKernel, StringViewMatchesString) {
+  // Values sharing their prefix, and long enough to be stored out of line
+  auto strings = ArrayFromJSON(utf8(), R"(["abcd", "abc", "abcdefghijklmn", null,
+                                          "abcdefghijklmo", "abce", "", "abcdefghijklm"])");
+  auto rand = random::RandomArrayGenerator(0x5416447);
+  for (auto lhs : {strings, rand.String(64, 0, 16, 0.1)}) {
+    auto rhs = lhs->Slice(1);
+    lhs = lhs->Slice(0, rhs->length());
+    auto scalar = Datum(std::make_shared<StringScalar>("abcdefghijklmn"));
+    auto view_scalar = Datum(std::make_shared<StringViewScalar>("abcdefghijklmn"));
+    for (std::string name :
+         {"equal", "not_equal", "greater", "greater_equal", "less", "less_equal"}) {
+      ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(name, {lhs, rhs}));
+      ASSERT_OK_AND_ASSIGN(Datum actual,
+                           CallFunction(name, {ToStringView(*lhs), ToStringView(*rhs)}));
+      AssertDatumsEqual(expected, actual, /*verbose=*/true);
+
+      ASSERT_OK_AND_ASSIGN(expected, CallFunction(name, {lhs, scalar}));
+      ASSERT_OK_AND_ASSIGN(actual, CallFunction(name, {ToStringView(*lhs), view_scalar}));
+      AssertDatumsEqual(expected, actual, /*verbose=*/true);
+    }
+  }
+}
+
+TEST_F(TestStringCompareKernel, DictionaryMatchesDense) {
+  // The dictionary has a null value and values that no index refers to
+  auto dict_type = dictionary(int8(), utf8());
+  auto dict_array = DictArrayFromJSON(dict_type, "[0, 2, null, 1, 3, 0, 2]",
+                                      R"(["b", "a", "c", null, "unused"])");
+  ASSERT_OK_AND_ASSIGN(Datum decoded, Cast(dict_array, utf8()));
+  auto scalar = Datum(std::make_shared<StringScalar>("b"));
+  for (std::string name :
+       {"equal", "not_equal", "greater", "greater_equal", "less", "less_equal"}) {
+    ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(name, {decoded, scalar}));
+    ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction(name, {dict_array, scalar}));
+    ASSERT_OK(actual.make_array()->ValidateFull());
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+
+    ASSERT_OK_AND_ASSIGN(expected,
+                         CallFunction(name, {decoded.make_array()->Slice(2), scalar}));
+    ASSERT_OK_AND_ASSIGN(actual, CallFunction(name, {dict_array->Slice(2), scalar}));
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
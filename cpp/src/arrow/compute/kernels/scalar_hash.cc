@@ -0,0 +1,264 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <vector>
+
+#include "arrow/array/util.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/compute/kernels/scalar_hash_internal.h"
+#include "arrow/util/bit_block_counter.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/hashing.h"
+
+namespace arrow {
+
+using internal::BitBlockCount;
+using internal::BitBlockCounter;
+
+namespace compute {
+namespace internal {
+
+namespace {
+
+constexpr uint64_t kNullHash = 0x5f2a1b3c4d6e7f80ULL;
+
+inline uint64_t HashBits(uint64_t bits) {
+  return ::arrow::internal::ScalarHelper<uint64_t, 1>::ComputeHash(bits);
+}
+
+inline uint64_t HashBytes(const uint8_t* data, int64_t length) {
+  return ::arrow::internal::ComputeStringHash<1>(data, length);
+}
+
+inline uint64_t CombineHashes(uint64_t hash, uint64_t value_hash) {
+  return hash ^ (value_hash + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2));
+}
+
+// The loops below have no branches nor calls, so that the compiler vectorizes
+// them (multiplying and byte-swapping several values at once)
+
+template <typename UInt>
+void HashFixedWidth(const UInt* values, int64_t length, uint64_t* out) {
+  for (int64_t i = 0; i < length; ++i) {
+    out[i] = HashBits(values[i]);
+  }
+}
+
+void CombineAll(const uint64_t* hashes, int64_t length, uint64_t* out) {
+  for (int64_t i = 0; i < length; ++i) {
+    out[i] = CombineHashes(out[i], hashes[i]);
+  }
+}
+
+template <typename IndexType>
+void GatherHashes(const ArraySpan& indices, const uint64_t* dictionary_hashes,
+                  uint64_t* out) {
+  const IndexType* values = indices.GetValues<IndexType>(1);
+  if (indices.GetNullCount() == 0) {
+    for (int64_t i = 0; i < indices.length; ++i) {
+      out[i] = dictionary_hashes[values[i]];
+    }
+    return;
+  }
+  // The indices of null slots may be out of bounds
+  const uint8_t* validity = indices.GetValues<uint8_t>(0, 0);
+  for (int64_t i = 0; i < indices.length; ++i) {
+    out[i] = BitUtil::GetBit(validity, indices.offset + i) ? dictionary_hashes[values[i]]
+                                                           : kNullHash;
+  }
+}
+
+// Write the hashes of the values of an array, whatever the validity of each
+// slot (null slots are overwritten afterwards)
+struct ValueHasher {
+  Status Visit(const NullType&) {
+    std::fill(out, out + data.length, kNullHash);
+    return Status::OK();
+  }
+
+  Status Visit(const BooleanType&) {
+    const uint8_t* bitmap = data.GetValues<uint8_t>(1, 0);
+    for (int64_t i = 0; i < data.length; ++i) {
+      out[i] = HashBits(BitUtil::GetBit(bitmap, data.offset + i));
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const FixedWidthType& type) {
+    switch (type.bit_width()) {
+      case 8:
+        HashFixedWidth(data.GetValues<uint8_t>(1), data.length, out);
+        break;
+      case 16:
+        HashFixedWidth(data.GetValues<uint16_t>(1), data.length, out);
+        break;
+      case 32:
+        HashFixedWidth(data.GetValues<uint32_t>(1), data.length, out);
+        break;
+      case 64:
+        HashFixedWidth(data.GetValues<uint64_t>(1), data.length, out);
+        break;
+      default: {
+        // Fixed size binary, decimals and other wide values
+        const int64_t width = type.bit_width() / 8;
+        const uint8_t* values = data.GetValues<uint8_t>(1, data.offset * width);
+        for (int64_t i = 0; i < data.length; ++i) {
+          out[i] = HashBytes(values + i * width, width);
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_base_binary<T, Status> Visit(const T&) {
+    using offset_type = typename T::offset_type;
+    static const uint8_t kEmpty = 0;
+    const offset_type* offsets = data.GetValues<offset_type>(1);
+    const uint8_t* values = data.GetValues<uint8_t>(2, 0);
+    if (values == nullptr) {
+      values = &kEmpty;
+    }
+    for (int64_t i = 0; i < data.length; ++i) {
+      out[i] = HashBytes(values + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const DictionaryType& type) {
+    // Hash each dictionary value once, then gather the hashes
+    const ArrayData& dictionary = *data.data->dictionary;
+    std::vector<uint64_t> dictionary_hashes(dictionary.length);
+    RETURN_NOT_OK(HashArray(ArraySpan(dictionary), dictionary_hashes.data()));
+    switch (type.index_type()->id()) {
+      case Type::INT8:
+        GatherHashes<int8_t>(data, dictionary_hashes.data(), out);
+        break;
+      case Type::INT16:
+        GatherHashes<int16_t>(data, dictionary_hashes.data(), out);
+        break;
+      case Type::INT32:
+        GatherHashes<int32_t>(data, dictionary_hashes.data(), out);
+        break;
+      case Type::INT64:
+        GatherHashes<int64_t>(data, dictionary_hashes.data(), out);
+        break;
+      default:
+        return Status::TypeError("Invalid dictionary index type: ", *type.index_type());
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const ExtensionType& type) {
+    return VisitTypeInline(*type.storage_type(), this);
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Hashing arrays of type ", type);
+  }
+
+  const ArraySpan& data;
+  uint64_t* out;
+};
+
+void SetNullHashes(const ArraySpan& data, uint64_t* out) {
+  if (data.type().id() == Type::NA || data.GetNullCount() == 0) {
+    return;
+  }
+  const uint8_t* validity = data.GetValues<uint8_t>(0, 0);
+  BitBlockCounter counter(validity, data.offset, data.length);
+  int64_t position = 0;
+  while (position < data.length) {
+    const BitBlockCount block = counter.NextWord();
+    if (block.NoneSet()) {
+      std::fill(out + position, out + position + block.length, kNullHash);
+    } else if (!block.AllSet()) {
+      for (int64_t i = position; i < position + block.length; ++i) {
+        if (!BitUtil::GetBit(validity, data.offset + i)) {
+          out[i] = kNullHash;
+        }
+      }
+    }
+    position += block.length;
+  }
+}
+
+void Hash64Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  if (out->is_scalar()) {
+    // All arguments are scalars
+    uint64_t hash;
+    KERNEL_RETURN_IF_ERROR(ctx, HashBatch(batch, &hash));
+    out->value = std::make_shared<UInt64Scalar>(hash);
+    return;
+  }
+  ArrayData* output = out->mutable_array();
+  KERNEL_RETURN_IF_ERROR(ctx, HashBatch(batch, output->GetMutableValues<uint64_t>(1)));
+}
+
+}  // namespace
+
+Status HashArray(const ArraySpan& data, uint64_t* out) {
+  ValueHasher hasher{data, out};
+  RETURN_NOT_OK(VisitTypeInline(data.type(), &hasher));
+  SetNullHashes(data, out);
+  return Status::OK();
+}
+
+Status HashBatch(const ExecBatch& batch, uint64_t* out) {
+  if (batch.values.empty()) {
+    std::fill(out, out + batch.length, 0);
+    return Status::OK();
+  }
+  // Hash the first column into `out`, and the others into `column_hashes`
+  std::vector<uint64_t> column_hashes;
+  for (size_t i = 0; i < batch.values.size(); ++i) {
+    const Datum& value = batch.values[i];
+    uint64_t* hashes = out;
+    if (i > 0) {
+      column_hashes.resize(batch.length);
+      hashes = column_hashes.data();
+    }
+    if (value.is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(auto array, MakeArrayFromScalar(*value.scalar(), 1));
+      uint64_t hash;
+      RETURN_NOT_OK(HashArray(ArraySpan(*array->data()), &hash));
+      std::fill(hashes, hashes + batch.length, hash);
+    } else {
+      DCHECK_EQ(value.length(), batch.length);
+      RETURN_NOT_OK(HashArray(ArraySpan(*value.array()), hashes));
+    }
+    if (i > 0) {
+      CombineAll(hashes, batch.length, out);
+    }
+  }
+  return Status::OK();
+}
+
+void RegisterScalarHash(FunctionRegistry* registry) {
+  ScalarKernel kernel(KernelSignature::Make({InputType()}, uint64(), /*is_varargs=*/true),
+                      Hash64Exec);
+  kernel.null_handling = NullHandling::OUTPUT_NOT_NULL;
+
+  auto hash_64 = std::make_shared<ScalarFunction>("hash_64", Arity::VarArgs(1));
+  DCHECK_OK(hash_64->AddKernel(std::move(kernel)));
+  DCHECK_OK(registry->AddFunction(std::move(hash_64)));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
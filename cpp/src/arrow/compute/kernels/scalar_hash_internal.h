@@ -0,0 +1,48 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "arrow/compute/exec.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+// Batch hashing of arrays, for hash partitioning and hash joins.
+//
+// Values are hashed with the second hash algorithm of util/hashing.h, so that
+// the hashes are independent of the slots used by the memo tables.  The hash of
+// a value only depends on its type and bytes: fixed-width values are hashed by
+// multiply-mixing their bits a whole buffer at a time, binary values with xxh3.
+// Nulls hash to a constant, and dictionary arrays hash like the equivalent
+// dense arrays.
+
+// Hash the `data.length` values of `data` into `out`
+Status HashArray(const ArraySpan& data, uint64_t* out);
+
+// Hash the `batch.length` rows of `batch` into `out`, combining the hashes of
+// all columns in order.  Scalar columns are broadcast.
+Status HashBatch(const ExecBatch& batch, uint64_t* out);
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,135 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array/array_primitive.h"
+#include "arrow/compute/api.h"
+#include "arrow/result.h"
+#include "arrow/scalar.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+std::vector<uint64_t> HashRows(const std::vector<Datum>& values) {
+  std::vector<uint64_t> hashes;
+  EXPECT_OK_AND_ASSIGN(Datum out, Hash64(values));
+  EXPECT_TRUE(out.is_array());
+  const auto& array = checked_cast<const UInt64Array&>(*out.make_array());
+  EXPECT_EQ(array.null_count(), 0);
+  for (int64_t i = 0; i < array.length(); ++i) {
+    hashes.push_back(array.Value(i));
+  }
+  return hashes;
+}
+
+// `values` is a JSON array of the pattern [a, b, a, null, b, null]
+void CheckHashPattern(const std::shared_ptr<DataType>& type, const std::string& values) {
+  SCOPED_TRACE(type->ToString());
+  auto array = ArrayFromJSON(type, values);
+  auto hashes = HashRows({array});
+  ASSERT_EQ(hashes.size(), 6u);
+  ASSERT_EQ(hashes[0], hashes[2]);
+  ASSERT_EQ(hashes[1], hashes[4]);
+  ASSERT_EQ(hashes[3], hashes[5]);
+  ASSERT_NE(hashes[0], hashes[1]);
+  ASSERT_NE(hashes[0], hashes[3]);
+  ASSERT_NE(hashes[1], hashes[3]);
+
+  // Hashes don't depend on the array offset
+  auto sliced_hashes = HashRows({array->Slice(1)});
+  ASSERT_EQ(sliced_hashes, std::vector<uint64_t>(hashes.begin() + 1, hashes.end()));
+}
+
+TEST(Hash64, Types) {
+  for (const auto& type : {int8(), uint8(), int16(), uint16(), int32(), uint32(), int64(),
+                           uint64(), date32(), timestamp(TimeUnit::MILLI)}) {
+    CheckHashPattern(type, "[1, 2, 1, null, 2, null]");
+  }
+  CheckHashPattern(float32(), "[1.5, -0.5, 1.5, null, -0.5, null]");
+  CheckHashPattern(float64(), "[1.5, -0.5, 1.5, null, -0.5, null]");
+  CheckHashPattern(boolean(), "[true, false, true, null, false, null]");
+  for (const auto& type : {utf8(), large_utf8(), binary()}) {
+    CheckHashPattern(type, R"(["foo", "", "foo", null, "", null])");
+  }
+  // Longer than 16 bytes
+  CheckHashPattern(utf8(), R"(["a long string value", "another string value",
+                               "a long string value", null,
+                               "another string value", null])");
+  CheckHashPattern(fixed_size_binary(3), R"(["abc", "abd", "abc", null, "abd", null])");
+  CheckHashPattern(decimal(5, 2), R"(["1.23", "-1.23", "1.23", null, "-1.23", null])");
+}
+
+TEST(Hash64, DictionaryMatchesDense) {
+  auto dense = ArrayFromJSON(utf8(), R"(["b", "a", null, "b", "c", null])");
+  auto dict_type = dictionary(int16(), utf8());
+  // The dictionary has a null value too
+  auto dict = DictArrayFromJSON(dict_type, "[1, 0, 3, 1, 2, null]",
+                                R"(["a", "b", "c", null])");
+  ASSERT_EQ(HashRows({dict}), HashRows({dense}));
+  ASSERT_EQ(HashRows({dict->Slice(2)}), HashRows({dense->Slice(2)}));
+}
+
+TEST(Hash64, MultipleColumns) {
+  auto ints = ArrayFromJSON(int32(), "[1, 1, 2, null, 1]");
+  auto strings = ArrayFromJSON(utf8(), R"(["x", "y", "x", "x", "x"])");
+  auto hashes = HashRows({ints, strings});
+  ASSERT_EQ(hashes.size(), 5u);
+  ASSERT_EQ(hashes[0], hashes[4]);
+  ASSERT_NE(hashes[0], hashes[1]);
+  ASSERT_NE(hashes[0], hashes[2]);
+  ASSERT_NE(hashes[0], hashes[3]);
+
+  // The order of the columns matters
+  ASSERT_NE(HashRows({strings, ints}), hashes);
+
+  // Scalars are broadcast
+  auto repeated = ArrayFromJSON(utf8(), R"(["x", "x", "x", "x", "x"])");
+  ASSERT_EQ(HashRows({ints, Datum(std::make_shared<StringScalar>("x"))}),
+            HashRows({ints, repeated}));
+}
+
+TEST(Hash64, Scalars) {
+  auto array = ArrayFromJSON(int64(), "[42, null]");
+  auto hashes = HashRows({array});
+
+  ASSERT_OK_AND_ASSIGN(Datum out, Hash64({Datum(int64_t(42))}));
+  ASSERT_TRUE(out.is_scalar());
+  ASSERT_EQ(checked_cast<const UInt64Scalar&>(*out.scalar()).value, hashes[0]);
+
+  ASSERT_OK_AND_ASSIGN(out, Hash64({Datum(MakeNullScalar(int64()))}));
+  ASSERT_EQ(checked_cast<const UInt64Scalar&>(*out.scalar()).value, hashes[1]);
+}
+
+TEST(Hash64, Errors) {
+  ASSERT_RAISES(Invalid, Hash64({}));
+  ASSERT_RAISES(NotImplemented, Hash64({ArrayFromJSON(list(int32()), "[[1], null]")}));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,509 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Conditional selection kernels: if_else, case_when and coalesce.
+//
+// The kernels process their inputs 64 rows at a time. The conditions and
+// validities of a block are loaded as 64-bit words, so that null propagation
+// is done with bitwise operations, and the values of the block are blended
+// with those words as masks. Fixed-width values are blended through their
+// unsigned bit patterns without branching, which compilers turn into vector
+// selects, and blocks where a mask is all set or all unset are copied
+// instead. Scalar arguments are read as constants rather than broadcast.
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "arrow/compute/kernels/common.h"
+#include "arrow/scalar.h"
+#include "arrow/util/bit_util.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+namespace internal {
+
+namespace {
+
+constexpr int64_t kWordBits = 64;
+
+// The mask of the first `length` bits of a word
+uint64_t LowBits(int64_t length) {
+  return length >= kWordBits ? ~uint64_t(0) : (uint64_t(1) << length) - 1;
+}
+
+// Load `length` <= 64 bits of `bitmap` starting at bit `offset`
+uint64_t LoadWord(const uint8_t* bitmap, int64_t offset, int64_t length) {
+  const uint8_t* bytes = bitmap + offset / 8;
+  const int shift = static_cast<int>(offset % 8);
+  const int64_t num_bytes = BitUtil::BytesForBits(shift + length);
+  uint64_t word = 0;
+  std::memcpy(&word, bytes, static_cast<size_t>(std::min<int64_t>(num_bytes, 8)));
+  word = BitUtil::FromLittleEndian(word) >> shift;
+  if (num_bytes > 8) {
+    word |= static_cast<uint64_t>(bytes[8]) << (kWordBits - shift);
+  }
+  return word & LowBits(length);
+}
+
+// Store the first `length` <= 64 bits of `word` to `bitmap` at bit `offset`,
+// leaving the surrounding bits untouched
+void StoreWord(uint64_t word, int64_t length, uint8_t* bitmap, int64_t offset) {
+  if (length == kWordBits && offset % 8 == 0) {
+    word = BitUtil::ToLittleEndian(word);
+    std::memcpy(bitmap + offset / 8, &word, sizeof(word));
+    return;
+  }
+  for (int64_t i = 0; i < length; ++i) {
+    BitUtil::SetBitTo(bitmap, offset + i, (word >> i) & 1);
+  }
+}
+
+// The bits of a boolean or validity argument: an array bitmap or a constant
+struct Bits {
+  const uint8_t* bitmap;
+  int64_t offset;
+  uint64_t constant;
+
+  static Bits Constant(bool value) { return {nullptr, 0, value ? ~uint64_t(0) : 0}; }
+
+  static Bits Validity(const Datum& datum) {
+    if (datum.is_scalar()) {
+      return Constant(datum.scalar()->is_valid);
+    }
+    const ArrayData& arr = *datum.array();
+    return FromBuffer(arr.buffers[0], arr.offset, /*missing=*/true);
+  }
+
+  static Bits Values(const Datum& datum) {
+    if (datum.is_scalar()) {
+      const auto& scalar = checked_cast<const BooleanScalar&>(*datum.scalar());
+      return Constant(scalar.is_valid && scalar.value);
+    }
+    const ArrayData& arr = *datum.array();
+    return FromBuffer(arr.buffers[1], arr.offset, /*missing=*/false);
+  }
+
+  static Bits FromBuffer(const std::shared_ptr<Buffer>& buffer, int64_t offset,
+                         bool missing) {
+    if (buffer == nullptr) {
+      return Constant(missing);
+    }
+    return {buffer->data(), offset, 0};
+  }
+
+  uint64_t Word(int64_t position, int64_t length) const {
+    if (bitmap == nullptr) {
+      return constant & LowBits(length);
+    }
+    return LoadWord(bitmap, offset + position, length);
+  }
+};
+
+template <typename Type, typename Enable = void>
+struct SelectValues {};
+
+// Fixed-width values, by their unsigned physical type
+template <typename Type>
+struct SelectValues<Type, enable_if_t<is_unsigned_integer_type<Type>::value>> {
+  using T = typename Type::c_type;
+
+  struct Source {
+    // nullptr for a scalar
+    const T* values;
+    T scalar;
+  };
+
+  using Output = T*;
+
+  static Source Of(const Datum& datum) {
+    if (datum.is_scalar()) {
+      const Scalar& scalar = *datum.scalar();
+      return {nullptr, scalar.is_valid ? UnboxScalar<Type>::Unbox(scalar) : T(0)};
+    }
+    return {datum.array()->GetValues<T>(1), T(0)};
+  }
+
+  static Output OutputOf(ArrayData* out) { return out->GetMutableValues<T>(1); }
+
+  static void Copy(int64_t position, int64_t length, const Source& source,
+                   Output out) {
+    if (source.values != nullptr) {
+      std::memcpy(out + position, source.values + position, length * sizeof(T));
+    } else {
+      std::fill(out + position, out + position + length, source.scalar);
+    }
+  }
+
+  // out[i] = bit i of mask ? left[i] : right[i], for the `length` values
+  // starting at `position`
+  static void Select(uint64_t mask, int64_t position, int64_t length,
+                     const Source& left, const Source& right, Output out) {
+    if (mask == LowBits(length)) {
+      return Copy(position, length, left, out);
+    }
+    if (mask == 0) {
+      return Copy(position, length, right, out);
+    }
+    T* out_values = out + position;
+    if (left.values != nullptr) {
+      const T* l = left.values + position;
+      auto left_at = [l](int64_t i) { return l[i]; };
+      if (right.values != nullptr) {
+        const T* r = right.values + position;
+        Blend(mask, length, left_at, [r](int64_t i) { return r[i]; }, out_values);
+      } else {
+        const T r = right.scalar;
+        Blend(mask, length, left_at, [r](int64_t) { return r; }, out_values);
+      }
+    } else {
+      const T l = left.scalar;
+      auto left_at = [l](int64_t) { return l; };
+      if (right.values != nullptr) {
+        const T* r = right.values + position;
+        Blend(mask, length, left_at, [r](int64_t i) { return r[i]; }, out_values);
+      } else {
+        const T r = right.scalar;
+        Blend(mask, length, left_at, [r](int64_t) { return r; }, out_values);
+      }
+    }
+  }
+
+  // out[i] = source[i] where bit i of mask is set
+  static void Update(uint64_t mask, int64_t position, int64_t length,
+                     const Source& source, Output out) {
+    if (mask != 0) {
+      Select(mask, position, length, source, Source{out, T(0)}, out);
+    }
+  }
+
+  template <typename Left, typename Right>
+  static void Blend(uint64_t mask, int64_t length, Left&& left, Right&& right, T* out) {
+    for (int64_t i = 0; i < length; ++i) {
+      const T select = static_cast<T>(T(0) - static_cast<T>((mask >> i) & 1));
+      out[i] = static_cast<T>((left(i) & select) | (right(i) & ~select));
+    }
+  }
+};
+
+// Boolean values, blended a word at a time
+template <typename Type>
+struct SelectValues<Type, enable_if_t<is_boolean_type<Type>::value>> {
+  using Source = Bits;
+
+  struct Output {
+    uint8_t* bitmap;
+    int64_t offset;
+  };
+
+  static Source Of(const Datum& datum) { return Bits::Values(datum); }
+
+  static Output OutputOf(ArrayData* out) {
+    return {out->buffers[1]->mutable_data(), out->offset};
+  }
+
+  static void Copy(int64_t position, int64_t length, const Source& source,
+                   Output out) {
+    StoreWord(source.Word(position, length), length, out.bitmap, out.offset + position);
+  }
+
+  static void Select(uint64_t mask, int64_t position, int64_t length,
+                     const Source& left, const Source& right, Output out) {
+    const uint64_t word =
+        (left.Word(position, length) & mask) | (right.Word(position, length) & ~mask);
+    StoreWord(word, length, out.bitmap, out.offset + position);
+  }
+
+  static void Update(uint64_t mask, int64_t position, int64_t length,
+                     const Source& source, Output out) {
+    if (mask != 0) {
+      Select(mask, position, length, source, Bits{out.bitmap, out.offset, 0}, out);
+    }
+  }
+};
+
+// Null outputs need neither values nor a validity bitmap
+void ExecNullOutput(Datum* out) {
+  if (out->is_array()) {
+    ArrayData* output = out->mutable_array();
+    output->buffers = {nullptr};
+    output->null_count = output->length;
+  }
+}
+
+template <typename Type>
+struct IfElseFunctor {
+  using Values = SelectValues<Type>;
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    if (out->is_scalar()) {
+      const auto& cond = checked_cast<const BooleanScalar&>(*batch[0].scalar());
+      if (cond.is_valid) {
+        *out = cond.value ? batch[1] : batch[2];
+      }
+      return;
+    }
+    ArrayData* output = out->mutable_array();
+    const Bits cond = Bits::Values(batch[0]);
+    const Bits cond_valid = Bits::Validity(batch[0]);
+    const Bits left_valid = Bits::Validity(batch[1]);
+    const Bits right_valid = Bits::Validity(batch[2]);
+    const auto left = Values::Of(batch[1]);
+    const auto right = Values::Of(batch[2]);
+    const auto out_values = Values::OutputOf(output);
+    uint8_t* out_valid = output->buffers[0]->mutable_data();
+
+    int64_t null_count = 0;
+    for (int64_t position = 0; position < batch.length; position += kWordBits) {
+      const int64_t length = std::min(kWordBits, batch.length - position);
+      const uint64_t mask = cond.Word(position, length);
+      Values::Select(mask, position, length, left, right, out_values);
+      const uint64_t valid = cond_valid.Word(position, length) &
+                             ((left_valid.Word(position, length) & mask) |
+                              (right_valid.Word(position, length) & ~mask));
+      StoreWord(valid, length, out_valid, output->offset + position);
+      null_count += length - BitUtil::PopCount(valid);
+    }
+    output->null_count = null_count;
+  }
+};
+
+template <>
+struct IfElseFunctor<NullType> {
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    ExecNullOutput(out);
+  }
+};
+
+template <typename Type>
+struct CoalesceFunctor {
+  using Values = SelectValues<Type>;
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    if (out->is_scalar()) {
+      for (const Datum& value : batch.values) {
+        if (value.scalar()->is_valid) {
+          *out = value;
+          return;
+        }
+      }
+      return;
+    }
+    ArrayData* output = out->mutable_array();
+    std::vector<Bits> valid;
+    std::vector<typename Values::Source> values;
+    for (const Datum& value : batch.values) {
+      valid.push_back(Bits::Validity(value));
+      values.push_back(Values::Of(value));
+    }
+    const auto out_values = Values::OutputOf(output);
+    uint8_t* out_valid = output->buffers[0]->mutable_data();
+
+    int64_t null_count = 0;
+    for (int64_t position = 0; position < batch.length; position += kWordBits) {
+      const int64_t length = std::min(kWordBits, batch.length - position);
+      const uint64_t all = LowBits(length);
+      // Fill the block from the first argument, then replace its nulls with
+      // the values of the next arguments until none are left
+      Values::Copy(position, length, values[0], out_values);
+      uint64_t filled = valid[0].Word(position, length);
+      for (size_t i = 1; i < values.size() && filled != all; ++i) {
+        const uint64_t take = valid[i].Word(position, length) & ~filled;
+        Values::Update(take, position, length, values[i], out_values);
+        filled |= take;
+      }
+      StoreWord(filled, length, out_valid, output->offset + position);
+      null_count += length - BitUtil::PopCount(filled);
+    }
+    output->null_count = null_count;
+  }
+};
+
+template <>
+struct CoalesceFunctor<NullType> {
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    ExecNullOutput(out);
+  }
+};
+
+Status CheckCaseWhenConditions(const DataType& type, size_t num_values) {
+  for (const auto& field : type.fields()) {
+    if (field->type()->id() != Type::BOOL) {
+      return Status::TypeError("case_when conditions must be boolean, got ",
+                               *field->type());
+    }
+  }
+  const size_t num_conds = static_cast<size_t>(type.num_fields());
+  if (num_values != num_conds && num_values != num_conds + 1) {
+    return Status::Invalid("case_when requires one value per condition and ",
+                           "optionally an else value, got ", num_conds,
+                           " conditions and ", num_values, " values");
+  }
+  return Status::OK();
+}
+
+template <typename Type>
+struct CaseWhenFunctor {
+  using Values = SelectValues<Type>;
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const size_t num_values = batch.values.size() - 1;
+    KERNEL_RETURN_IF_ERROR(ctx, CheckCaseWhenConditions(*batch[0].type(), num_values));
+    const size_t num_conds = static_cast<size_t>(batch[0].type()->num_fields());
+    const bool has_else = num_values > num_conds;
+
+    if (out->is_scalar()) {
+      const auto& conds = checked_cast<const StructScalar&>(*batch[0].scalar());
+      for (size_t i = 0; conds.is_valid && i < num_conds; ++i) {
+        const auto& cond = checked_cast<const BooleanScalar&>(*conds.value[i]);
+        if (cond.is_valid && cond.value) {
+          *out = batch[i + 1];
+          return;
+        }
+      }
+      if (has_else) {
+        *out = batch[num_conds + 1];
+      }
+      return;
+    }
+
+    // A condition is taken where it is true and valid, and where the struct
+    // of conditions is valid
+    const Bits conds_valid = Bits::Validity(batch[0]);
+    std::vector<Bits> cond;
+    std::vector<Bits> cond_valid;
+    if (batch[0].is_scalar()) {
+      const auto& conds = checked_cast<const StructScalar&>(*batch[0].scalar());
+      for (size_t i = 0; i < num_conds; ++i) {
+        cond.push_back(conds.is_valid ? Bits::Values(conds.value[i])
+                                      : Bits::Constant(false));
+        cond_valid.push_back(conds.is_valid ? Bits::Validity(conds.value[i])
+                                            : Bits::Constant(false));
+      }
+    } else {
+      const ArrayData& conds = *batch[0].array();
+      for (size_t i = 0; i < num_conds; ++i) {
+        const ArrayData& child = *conds.child_data[i];
+        const int64_t offset = conds.offset + child.offset;
+        cond.push_back(Bits::FromBuffer(child.buffers[1], offset, /*missing=*/false));
+        cond_valid.push_back(Bits::FromBuffer(child.buffers[0], offset,
+                                              /*missing=*/true));
+      }
+    }
+    std::vector<Bits> valid;
+    std::vector<typename Values::Source> values;
+    for (size_t i = 1; i < batch.values.size(); ++i) {
+      valid.push_back(Bits::Validity(batch[i]));
+      values.push_back(Values::Of(batch[i]));
+    }
+
+    ArrayData* output = out->mutable_array();
+    const auto out_values = Values::OutputOf(output);
+    uint8_t* out_valid = output->buffers[0]->mutable_data();
+
+    int64_t null_count = 0;
+    for (int64_t position = 0; position < batch.length; position += kWordBits) {
+      const int64_t length = std::min(kWordBits, batch.length - position);
+      const uint64_t all = LowBits(length);
+      const uint64_t any_cond = conds_valid.Word(position, length);
+      // Start from the last value, which is the else value if there is one
+      uint64_t out_word = 0;
+      uint64_t taken = 0;
+      if (num_values > 0) {
+        Values::Copy(position, length, values.back(), out_values);
+      }
+      for (size_t i = 0; i < num_conds && taken != all; ++i) {
+        const uint64_t take = cond[i].Word(position, length) &
+                              cond_valid[i].Word(position, length) & any_cond & ~taken;
+        Values::Update(take, position, length, values[i], out_values);
+        out_word |= take & valid[i].Word(position, length);
+        taken |= take;
+      }
+      if (has_else) {
+        out_word |= ~taken & valid.back().Word(position, length);
+      }
+      StoreWord(out_word, length, out_valid, output->offset + position);
+      null_count += length - BitUtil::PopCount(out_word);
+    }
+    output->null_count = null_count;
+  }
+};
+
+template <>
+struct CaseWhenFunctor<NullType> {
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    KERNEL_RETURN_IF_ERROR(ctx, CheckCaseWhenConditions(*batch[0].type(),
+                                                        batch.values.size() - 1));
+    ExecNullOutput(out);
+  }
+};
+
+const std::vector<std::shared_ptr<DataType>>& SelectTypes() {
+  static DataTypeVector types = [] {
+    DataTypeVector types = NumericTypes();
+    types.insert(types.end(), TemporalTypes().begin(), TemporalTypes().end());
+    types.push_back(boolean());
+    types.push_back(null());
+    return types;
+  }();
+  return types;
+}
+
+// Make a kernel whose output is preallocated, except for null outputs
+ScalarKernel MakeSelectKernel(std::vector<InputType> in_types,
+                              const std::shared_ptr<DataType>& type, ArrayKernelExec exec,
+                              bool is_varargs = false) {
+  ScalarKernel kernel(KernelSignature::Make(std::move(in_types), type, is_varargs), exec);
+  if (type->id() == Type::NA) {
+    kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+    kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+  } else {
+    kernel.null_handling = NullHandling::COMPUTED_PREALLOCATE;
+    kernel.mem_allocation = MemAllocation::PREALLOCATE;
+  }
+  return kernel;
+}
+
+}  // namespace
+
+void RegisterScalarIfElse(FunctionRegistry* registry) {
+  auto if_else = std::make_shared<ScalarFunction>("if_else", Arity::Ternary());
+  auto case_when = std::make_shared<ScalarFunction>("case_when", Arity::VarArgs(2));
+  auto coalesce = std::make_shared<ScalarFunction>("coalesce", Arity::VarArgs(1));
+  for (const auto& ty : SelectTypes()) {
+    DCHECK_OK(if_else->AddKernel(
+        MakeSelectKernel({boolean(), ty, ty}, ty,
+                         GenerateTypeAgnosticPrimitive<IfElseFunctor>(*ty))));
+    DCHECK_OK(case_when->AddKernel(
+        MakeSelectKernel({InputType(Type::STRUCT), ty}, ty,
+                         GenerateTypeAgnosticPrimitive<CaseWhenFunctor>(*ty),
+                         /*is_varargs=*/true)));
+    DCHECK_OK(coalesce->AddKernel(
+        MakeSelectKernel({ty}, ty, GenerateTypeAgnosticPrimitive<CoalesceFunctor>(*ty),
+                         /*is_varargs=*/true)));
+  }
+  DCHECK_OK(registry->AddFunction(std::move(if_else)));
+  DCHECK_OK(registry->AddFunction(std::move(case_when)));
+  DCHECK_OK(registry->AddFunction(std::move(coalesce)));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
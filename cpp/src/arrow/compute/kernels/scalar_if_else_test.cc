@@ -0,0 +1,284 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array/array_nested.h"
+#include "arrow/compute/api.h"
+#include "arrow/scalar.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+// Check the function against its results on the scalars of each row, and on
+// slices of its array arguments
+void CheckRowwise(const std::string& func_name, const std::vector<Datum>& args) {
+  ASSERT_OK_AND_ASSIGN(Datum result, CallFunction(func_name, args));
+  std::shared_ptr<Array> actual = result.make_array();
+  ASSERT_OK(actual->ValidateFull());
+
+  for (int64_t i = 0; i < actual->length(); ++i) {
+    std::vector<Datum> row;
+    for (const Datum& arg : args) {
+      if (arg.is_scalar()) {
+        row.push_back(arg);
+      } else {
+        ASSERT_OK_AND_ASSIGN(auto scalar, arg.make_array()->GetScalar(i));
+        row.push_back(scalar);
+      }
+    }
+    ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(func_name, row));
+    ASSERT_OK_AND_ASSIGN(auto actual_scalar, actual->GetScalar(i));
+    AssertScalarsEqual(*expected.scalar(), *actual_scalar, /*verbose=*/true);
+  }
+
+  for (int64_t offset : {1, 13, 64, 67}) {
+    if (offset > actual->length()) {
+      continue;
+    }
+    std::vector<Datum> sliced;
+    for (const Datum& arg : args) {
+      if (arg.is_scalar()) {
+        sliced.push_back(arg);
+      } else {
+        sliced.push_back(arg.make_array()->Slice(offset));
+      }
+    }
+    ASSERT_OK_AND_ASSIGN(Datum sliced_result, CallFunction(func_name, sliced));
+    ASSERT_OK(sliced_result.make_array()->ValidateFull());
+    AssertArraysEqual(*actual->Slice(offset), *sliced_result.make_array(),
+                      /*verbose=*/true);
+  }
+}
+
+class TestIfElseKernel : public ::testing::Test {};
+
+TEST_F(TestIfElseKernel, Numeric) {
+  auto cond = ArrayFromJSON(boolean(), "[true, false, null, true, false]");
+  auto left = ArrayFromJSON(int32(), "[1, 2, 3, null, 5]");
+  auto right = ArrayFromJSON(int32(), "[10, null, 30, 40, 50]");
+
+  ASSERT_OK_AND_ASSIGN(Datum out, IfElse(cond, left, right));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, null, null, null, 50]"),
+                    *out.make_array(), /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(out, IfElse(cond, left, MakeScalar(int32(), 7).ValueOrDie()));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 7, null, null, 7]"), *out.make_array(),
+                    /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(out, IfElse(MakeScalar(true), left, right));
+  AssertArraysEqual(*left, *out.make_array(), /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(out, IfElse(MakeNullScalar(boolean()), left, right));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[null, null, null, null, null]"),
+                    *out.make_array(), /*verbose=*/true);
+}
+
+TEST_F(TestIfElseKernel, Boolean) {
+  auto cond = ArrayFromJSON(boolean(), "[true, false, null, true, false]");
+  auto left = ArrayFromJSON(boolean(), "[true, true, true, null, false]");
+  auto right = ArrayFromJSON(boolean(), "[false, null, false, false, true]");
+
+  ASSERT_OK_AND_ASSIGN(Datum out, IfElse(cond, left, right));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, null, null, null, true]"),
+                    *out.make_array(), /*verbose=*/true);
+}
+
+TEST_F(TestIfElseKernel, Null) {
+  auto cond = ArrayFromJSON(boolean(), "[true, false, null]");
+  auto values = ArrayFromJSON(null(), "[null, null, null]");
+
+  ASSERT_OK_AND_ASSIGN(Datum out, IfElse(cond, values, values));
+  AssertArraysEqual(*values, *out.make_array(), /*verbose=*/true);
+}
+
+TEST_F(TestIfElseKernel, Scalars) {
+  auto left = MakeScalar(int64_t(1));
+  auto right = MakeScalar(int64_t(2));
+
+  ASSERT_OK_AND_ASSIGN(Datum out, IfElse(MakeScalar(false), left, right));
+  AssertScalarsEqual(*right, *out.scalar(), /*verbose=*/true);
+  ASSERT_OK_AND_ASSIGN(out, IfElse(MakeNullScalar(boolean()), left, right));
+  AssertScalarsEqual(*MakeNullScalar(int64()), *out.scalar(), /*verbose=*/true);
+}
+
+TEST_F(TestIfElseKernel, Random) {
+  random::RandomArrayGenerator rand(/*seed=*/0);
+  const int64_t length = 1000;
+  for (const auto& type : {int8(), uint16(), int32(), float32(), float64(), date64(),
+                           timestamp(TimeUnit::MILLI), boolean()}) {
+    SCOPED_TRACE(type->ToString());
+    // Mostly true conditions, so that some blocks are entirely selected
+    auto cond = rand.Boolean(length, /*true_probability=*/0.99,
+                             /*null_probability=*/0.01);
+    auto left = rand.ArrayOf(type, length, /*null_probability=*/0.1);
+    auto right = rand.ArrayOf(type, length, /*null_probability=*/0.1);
+    ASSERT_OK_AND_ASSIGN(auto scalar, right->GetScalar(0));
+
+    CheckRowwise("if_else", {cond, left, right});
+    CheckRowwise("if_else", {cond, left, scalar});
+    CheckRowwise("if_else", {cond, scalar, right});
+    CheckRowwise("if_else", {rand.Boolean(length, 0.5, 0.0), right, left});
+  }
+}
+
+TEST_F(TestIfElseKernel, Errors) {
+  ASSERT_RAISES(NotImplemented, IfElse(ArrayFromJSON(boolean(), "[true]"),
+                                       ArrayFromJSON(int32(), "[1]"),
+                                       ArrayFromJSON(int64(), "[1]")));
+  ASSERT_RAISES(NotImplemented,
+                IfElse(ArrayFromJSON(int8(), "[1]"), ArrayFromJSON(int32(), "[1]"),
+                       ArrayFromJSON(int32(), "[1]")));
+}
+
+class TestCaseWhenKernel : public ::testing::Test {};
+
+TEST_F(TestCaseWhenKernel, Basics) {
+  auto type = struct_({field("a", boolean()), field("b", boolean())});
+  auto cond = ArrayFromJSON(type, R"([
+    {"a": true, "b": true},
+    {"a": false, "b": true},
+    {"a": null, "b": true},
+    {"a": false, "b": false},
+    null,
+    {"a": true, "b": false}
+  ])");
+  auto first = ArrayFromJSON(int16(), "[1, 2, 3, 4, 5, null]");
+  auto second = ArrayFromJSON(int16(), "[10, 20, 30, 40, 50, 60]");
+  auto otherwise = ArrayFromJSON(int16(), "[100, 200, 300, 400, 500, 600]");
+
+  ASSERT_OK_AND_ASSIGN(Datum out, CaseWhen(cond, {first, second}));
+  AssertArraysEqual(*ArrayFromJSON(int16(), "[1, 20, 30, null, null, null]"),
+                    *out.make_array(), /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(out, CaseWhen(cond, {first, second, otherwise}));
+  AssertArraysEqual(*ArrayFromJSON(int16(), "[1, 20, 30, 400, 500, null]"),
+                    *out.make_array(), /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(
+      out, CaseWhen(cond, {first, MakeScalar(int16_t(-1)), MakeNullScalar(int16())}));
+  AssertArraysEqual(*ArrayFromJSON(int16(), "[1, -1, -1, null, null, null]"),
+                    *out.make_array(), /*verbose=*/true);
+}
+
+TEST_F(TestCaseWhenKernel, ScalarConditions) {
+  auto type = struct_({field("a", boolean()), field("b", boolean())});
+  auto first = ArrayFromJSON(float64(), "[1, 2, null]");
+  auto second = ArrayFromJSON(float64(), "[10, 20, 30]");
+  auto otherwise = MakeScalar(0.5);
+
+  std::shared_ptr<Scalar> cond = std::make_shared<StructScalar>(
+      ScalarVector{MakeNullScalar(boolean()), MakeScalar(true)}, type);
+  ASSERT_OK_AND_ASSIGN(Datum out, CaseWhen(cond, {first, second, otherwise}));
+  AssertArraysEqual(*second, *out.make_array(), /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(out, CaseWhen(MakeNullScalar(type), {first, second, otherwise}));
+  AssertArraysEqual(*ArrayFromJSON(float64(), "[0.5, 0.5, 0.5]"), *out.make_array(),
+                    /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(out, CaseWhen(cond, {MakeScalar(1.0), MakeScalar(2.0)}));
+  AssertScalarsEqual(*MakeScalar(2.0), *out.scalar(), /*verbose=*/true);
+}
+
+TEST_F(TestCaseWhenKernel, Random) {
+  random::RandomArrayGenerator rand(/*seed=*/0);
+  const int64_t length = 1000;
+  std::vector<std::shared_ptr<Array>> conds;
+  FieldVector fields;
+  for (int i = 0; i < 3; ++i) {
+    conds.push_back(rand.Boolean(length, /*true_probability=*/0.3,
+                                 /*null_probability=*/0.05));
+    fields.push_back(field(std::to_string(i), boolean()));
+  }
+  ASSERT_OK_AND_ASSIGN(auto cond, StructArray::Make(conds, fields));
+  for (const auto& type : {uint8(), int64(), float32(), time32(TimeUnit::SECOND),
+                           boolean()}) {
+    SCOPED_TRACE(type->ToString());
+    std::vector<Datum> args = {cond};
+    for (int i = 0; i < 4; ++i) {
+      args.push_back(rand.ArrayOf(type, length, /*null_probability=*/0.1));
+    }
+    CheckRowwise("case_when", args);
+    args.pop_back();
+    CheckRowwise("case_when", args);
+    ASSERT_OK_AND_ASSIGN(args[2], args[2].make_array()->GetScalar(0));
+    CheckRowwise("case_when", args);
+  }
+}
+
+TEST_F(TestCaseWhenKernel, Errors) {
+  auto type = struct_({field("a", boolean())});
+  auto cond = ArrayFromJSON(type, R"([{"a": true}])");
+  auto values = ArrayFromJSON(int32(), "[1]");
+
+  ASSERT_RAISES(Invalid, CaseWhen(cond, {values, values, values}));
+  ASSERT_RAISES(TypeError,
+                CaseWhen(ArrayFromJSON(struct_({field("a", int32())}), R"([{"a": 1}])"),
+                         {values}));
+  ASSERT_RAISES(NotImplemented, CaseWhen(ArrayFromJSON(boolean(), "[true]"), {values}));
+  ASSERT_RAISES(Invalid, CallFunction("case_when", {cond}));
+}
+
+class TestCoalesceKernel : public ::testing::Test {};
+
+TEST_F(TestCoalesceKernel, Basics) {
+  auto first = ArrayFromJSON(uint32(), "[1, null, null, null]");
+  auto second = ArrayFromJSON(uint32(), "[10, 20, null, null]");
+  auto third = ArrayFromJSON(uint32(), "[100, 200, 300, null]");
+
+  ASSERT_OK_AND_ASSIGN(Datum out, Coalesce({first, second, third}));
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[1, 20, 300, null]"), *out.make_array(),
+                    /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(out, Coalesce({first, MakeScalar(uint32_t(7)), third}));
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[1, 7, 7, 7]"), *out.make_array(),
+                    /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(out, Coalesce({first}));
+  AssertArraysEqual(*first, *out.make_array(), /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(
+      out, Coalesce({MakeNullScalar(boolean()), MakeScalar(false), MakeScalar(true)}));
+  AssertScalarsEqual(*MakeScalar(false), *out.scalar(), /*verbose=*/true);
+}
+
+TEST_F(TestCoalesceKernel, Random) {
+  random::RandomArrayGenerator rand(/*seed=*/0);
+  const int64_t length = 1000;
+  for (const auto& type : {int8(), uint64(), float64(), date32(), boolean()}) {
+    SCOPED_TRACE(type->ToString());
+    std::vector<Datum> args;
+    for (double null_probability : {0.9, 0.5, 0.0}) {
+      args.push_back(rand.ArrayOf(type, length, null_probability));
+    }
+    CheckRowwise("coalesce", args);
+    args.pop_back();
+    CheckRowwise("coalesce", args);
+    ASSERT_OK_AND_ASSIGN(args[1], args[1].make_array()->GetScalar(0));
+    CheckRowwise("coalesce", args);
+  }
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -15,11 +15,20 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
 #include "arrow/array/array_base.h"
+#include "arrow/array/array_dict.h"
 #include "arrow/array/builder_primitive.h"
+#include "arrow/array/util.h"
 #include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_generate.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/bitmap_writer.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/optional.h"
@@ -34,6 +43,211 @@ namespace compute {
 namespace internal {
 namespace {
 
+// Number of values looked up at once by IntegerSetLookup
+constexpr int64_t kLookupBatchSize = 256;
+
+// Lookup of the memo indices of integer values, using whichever structure
+// suits the value set best:
+//
+// * a few values are compared against each input value in turn, a loop
+//   which the compiler turns into SIMD broadcast compares
+// * values in a compact range are looked up in a direct-indexed table, or
+//   for membership only, in a bitmap over the range
+// * other values are looked up in a sparsely loaded, flat open-addressing
+//   hash table, where most misses end at the first probe
+template <typename CType>
+class IntegerSetLookup {
+ public:
+  static constexpr int32_t kMaxLinearSize = 8;
+  // A direct-indexed table may have this many entries whatever the number
+  // of values, or this many entries per value
+  static constexpr uint64_t kMinDenseRange = 1 << 14;
+  static constexpr uint64_t kDenseRangePerValue = 32;
+
+  enum Strategy { LINEAR, DENSE, HASH };
+
+  // values[i] has memo index indices[i]
+  void Init(std::vector<CType> values, std::vector<int32_t> indices) {
+    const auto num_values = static_cast<int64_t>(values.size());
+    if (num_values <= kMaxLinearSize) {
+      strategy_ = LINEAR;
+      values_ = std::move(values);
+      indices_ = std::move(indices);
+      return;
+    }
+    CType span;
+    FindSmallestRange(values, &base_, &span);
+    const uint64_t max_range =
+        std::max(kMinDenseRange, kDenseRangePerValue * static_cast<uint64_t>(num_values));
+    if (static_cast<uint64_t>(span) < max_range) {
+      strategy_ = DENSE;
+      dense_range_ = static_cast<uint64_t>(span) + 1;
+      table_.assign(static_cast<size_t>(dense_range_), -1);
+      bitmap_.assign(static_cast<size_t>(BitUtil::BytesForBits(dense_range_)), 0);
+      for (int64_t i = 0; i < num_values; ++i) {
+        const auto offset = static_cast<CType>(values[i] - base_);
+        table_[offset] = indices[i];
+        BitUtil::SetBit(bitmap_.data(), offset);
+      }
+      return;
+    }
+    strategy_ = HASH;
+    // Keep the load factor at most 1/4
+    hash_bits_ = 1;
+    while ((int64_t(1) << hash_bits_) < 4 * num_values) {
+      ++hash_bits_;
+    }
+    hash_mask_ = (uint64_t(1) << hash_bits_) - 1;
+    hash_entries_.assign(static_cast<size_t>(hash_mask_ + 1), HashEntry{0, -1});
+    for (int64_t i = 0; i < num_values; ++i) {
+      uint64_t slot = HashSlot(values[i]);
+      while (hash_entries_[slot].index != -1) {
+        slot = (slot + 1) & hash_mask_;
+      }
+      hash_entries_[slot] = {values[i], indices[i]};
+    }
+  }
+
+  Strategy strategy() const { return strategy_; }
+
+  // Write the memo index of each value into out, or -1 if it is not in the set
+  void Find(const CType* values, int64_t length, int32_t* out) const {
+    switch (strategy_) {
+      case LINEAR:
+        std::fill(out, out + length, -1);
+        for (size_t j = 0; j < values_.size(); ++j) {
+          const CType needle = values_[j];
+          const int32_t index = indices_[j];
+          for (int64_t i = 0; i < length; ++i) {
+            out[i] = values[i] == needle ? index : out[i];
+          }
+        }
+        break;
+      case DENSE:
+        for (int64_t i = 0; i < length; ++i) {
+          const auto offset = static_cast<CType>(values[i] - base_);
+          out[i] = static_cast<uint64_t>(offset) < dense_range_ ? table_[offset] : -1;
+        }
+        break;
+      case HASH:
+        for (int64_t i = 0; i < length; ++i) {
+          out[i] = Probe(values[i]);
+        }
+        break;
+    }
+  }
+
+  // Write 1 into out for each value in the set, 0 otherwise
+  void Contains(const CType* values, int64_t length, uint8_t* out) const {
+    switch (strategy_) {
+      case LINEAR:
+        std::fill(out, out + length, 0);
+        for (const CType needle : values_) {
+          for (int64_t i = 0; i < length; ++i) {
+            out[i] |= static_cast<uint8_t>(values[i] == needle);
+          }
+        }
+        break;
+      case DENSE:
+        for (int64_t i = 0; i < length; ++i) {
+          const auto offset = static_cast<CType>(values[i] - base_);
+          out[i] = static_cast<uint64_t>(offset) < dense_range_ &&
+                   BitUtil::GetBit(bitmap_.data(), offset);
+        }
+        break;
+      case HASH:
+        for (int64_t i = 0; i < length; ++i) {
+          out[i] = Probe(values[i]) != -1;
+        }
+        break;
+    }
+  }
+
+ private:
+  struct HashEntry {
+    CType key;
+    int32_t index;
+  };
+
+  // Find the shortest range [base, base + span] which contains all values,
+  // in wrapping arithmetic, so that sets of signed integers (which are
+  // looked up as their unsigned bit patterns) spanning zero are compact
+  static void FindSmallestRange(std::vector<CType> values, CType* base, CType* span) {
+    std::sort(values.begin(), values.end());
+    // The range starts after the largest gap between consecutive values,
+    // including the gap from the last value around to the first
+    size_t start = 0;
+    CType largest_gap = static_cast<CType>(values.front() - values.back());
+    for (size_t i = 1; i < values.size(); ++i) {
+      const auto gap = static_cast<CType>(values[i] - values[i - 1]);
+      if (gap > largest_gap) {
+        largest_gap = gap;
+        start = i;
+      }
+    }
+    *base = values[start];
+    *span = static_cast<CType>(values[start == 0 ? values.size() - 1 : start - 1] -
+                               values[start]);
+  }
+
+  int32_t Probe(CType value) const {
+    uint64_t slot = HashSlot(value);
+    while (hash_entries_[slot].index != -1 && hash_entries_[slot].key != value) {
+      slot = (slot + 1) & hash_mask_;
+    }
+    return hash_entries_[slot].index;
+  }
+
+  uint64_t HashSlot(CType value) const {
+    // Fibonacci hashing: the high bits of the product are well mixed
+    return (static_cast<uint64_t>(value) * 0x9E3779B97F4A7C15ULL) >> (64 - hash_bits_);
+  }
+
+  Strategy strategy_ = LINEAR;
+  // LINEAR
+  std::vector<CType> values_;
+  std::vector<int32_t> indices_;
+  // DENSE
+  CType base_ = 0;
+  uint64_t dense_range_ = 0;
+  std::vector<int32_t> table_;
+  std::vector<uint8_t> bitmap_;
+  // HASH
+  int hash_bits_ = 1;
+  uint64_t hash_mask_ = 0;
+  std::vector<HashEntry> hash_entries_;
+};
+
+template <typename CType>
+constexpr int32_t IntegerSetLookup<CType>::kMaxLinearSize;
+template <typename CType>
+constexpr uint64_t IntegerSetLookup<CType>::kMinDenseRange;
+template <typename CType>
+constexpr uint64_t IntegerSetLookup<CType>::kDenseRangePerValue;
+
+// Integers wider than 8 bits are looked up with an IntegerSetLookup, other
+// types (including 8-bit integers, whose memo table is direct-indexed) with
+// their memo table
+template <typename Type, typename Enable = void>
+struct has_integer_set_lookup : std::false_type {};
+
+template <typename Type>
+struct has_integer_set_lookup<
+    Type, enable_if_t<is_unsigned_integer_type<Type>::value &&
+                      (sizeof(typename Type::c_type) > 1)>> : std::true_type {};
+
+struct NoIntegerSetLookup {};
+
+template <typename Type, typename Enable = void>
+struct IntegerSetLookupFor {
+  using type = NoIntegerSetLookup;
+};
+
+template <typename Type>
+struct IntegerSetLookupFor<Type, enable_if_t<has_integer_set_lookup<Type>::value>> {
+  using type = IntegerSetLookup<typename Type::c_type>;
+};
+
 template <typename Type>
 struct SetLookupState : public KernelState {
   explicit SetLookupState(MemoryPool* pool)
@@ -54,8 +268,8 @@ struct SetLookupState : public KernelState {
     if (options.value_set.kind() == Datum::ARRAY) {
       const std::shared_ptr<ArrayData>& value_set = options.value_set.array();
       this->lookup_null_count += value_set->GetNullCount();
-      return VisitArrayDataInline<Type>(*value_set, std::move(visit_valid),
-                                        std::move(visit_null));
+      RETURN_NOT_OK(VisitArrayDataInline<Type>(*value_set, std::move(visit_valid),
+                                               std::move(visit_null)));
     } else {
       const ChunkedArray& value_set = *options.value_set.chunked_array();
       for (const std::shared_ptr<Array>& chunk : value_set.chunks()) {
@@ -63,12 +277,34 @@ struct SetLookupState : public KernelState {
         RETURN_NOT_OK(VisitArrayDataInline<Type>(*chunk->data(), std::move(visit_valid),
                                                  std::move(visit_null)));
       }
-      return Status::OK();
     }
+    InitIntegerLookup(&integer_lookup);
+    return Status::OK();
   }
 
   using MemoTable = typename HashTraits<Type>::MemoTableType;
+  using IntegerLookup = typename IntegerSetLookupFor<Type>::type;
+
+  void InitIntegerLookup(NoIntegerSetLookup*) {}
+
+  template <typename CType>
+  void InitIntegerLookup(IntegerSetLookup<CType>* lookup) {
+    std::vector<CType> memo_values(lookup_table.size());
+    lookup_table.CopyValues(memo_values.data());
+    const int32_t null_memo_index = lookup_table.GetNull();
+    std::vector<CType> values;
+    std::vector<int32_t> indices;
+    for (int32_t i = 0; i < lookup_table.size(); ++i) {
+      if (i != null_memo_index) {
+        values.push_back(memo_values[i]);
+        indices.push_back(i);
+      }
+    }
+    lookup->Init(std::move(values), std::move(indices));
+  }
+
   MemoTable lookup_table;
+  IntegerLookup integer_lookup;
   int64_t lookup_null_count;
   int64_t null_index = -1;
 };
@@ -190,7 +426,7 @@ struct IndexInVisitor {
   }
 
   template <typename Type>
-  Status ProcessIndexIn() {
+  enable_if_t<!has_integer_set_lookup<Type>::value, Status> ProcessIndexIn() {
     using T = typename GetViewType<Type>::T;
 
     const auto& state = checked_cast<const SetLookupState<Type>&>(*ctx->state());
@@ -221,6 +457,36 @@ struct IndexInVisitor {
     return Status::OK();
   }
 
+  template <typename Type>
+  enable_if_t<has_integer_set_lookup<Type>::value, Status> ProcessIndexIn() {
+    using CType = typename Type::c_type;
+    const auto& state = checked_cast<const SetLookupState<Type>&>(*ctx->state());
+
+    int32_t null_index = state.lookup_table.GetNull();
+    RETURN_NOT_OK(this->builder.Reserve(data.length));
+    const CType* values = data.GetValues<CType>(1);
+    const uint8_t* validity = data.GetNullCount() > 0 ? data.buffers[0]->data() : nullptr;
+    int32_t indices[kLookupBatchSize];
+    uint8_t found[kLookupBatchSize];
+    for (int64_t start = 0; start < data.length; start += kLookupBatchSize) {
+      const int64_t length = std::min(kLookupBatchSize, data.length - start);
+      state.integer_lookup.Find(values + start, length, indices);
+      if (validity) {
+        for (int64_t i = 0; i < length; ++i) {
+          if (!BitUtil::GetBit(validity, data.offset + start + i)) {
+            indices[i] = null_index;
+          }
+        }
+      }
+      // Values not in the set have null output
+      for (int64_t i = 0; i < length; ++i) {
+        found[i] = indices[i] != -1;
+      }
+      RETURN_NOT_OK(this->builder.AppendValues(indices, length, found));
+    }
+    return Status::OK();
+  }
+
   template <typename Type>
   enable_if_boolean<Type, Status> Visit(const Type&) {
     return ProcessIndexIn<BooleanType>();
@@ -302,19 +568,52 @@ struct IsInVisitor {
     return Status::OK();
   }
 
-  template <typename Type>
-  Status ProcessIsIn() {
-    using T = typename GetViewType<Type>::T;
-    const auto& state = checked_cast<const SetLookupState<Type>&>(*ctx->state());
+  void SetValidityIfValueSetHasNulls(int64_t lookup_null_count) {
     ArrayData* output = out->mutable_array();
-
-    if (this->data.GetNullCount() > 0 && state.lookup_null_count > 0) {
+    if (this->data.GetNullCount() > 0 && lookup_null_count > 0) {
       // If there were nulls in the value set, set the whole validity bitmap to
       // true
       output->null_count = 0;
       BitUtil::SetBitsTo(output->buffers[0]->mutable_data(), output->offset,
                          output->length, true);
     }
+  }
+
+  template <typename Type>
+  enable_if_t<has_integer_set_lookup<Type>::value, Status> ProcessIsIn() {
+    using CType = typename Type::c_type;
+    const auto& state = checked_cast<const SetLookupState<Type>&>(*ctx->state());
+    SetValidityIfValueSetHasNulls(state.lookup_null_count);
+
+    ArrayData* output = out->mutable_array();
+    uint8_t* out_bitmap = output->buffers[1]->mutable_data();
+    const CType* values = data.GetValues<CType>(1);
+    const uint8_t* validity = data.GetNullCount() > 0 ? data.buffers[0]->data() : nullptr;
+    uint8_t found[kLookupBatchSize];
+    for (int64_t start = 0; start < data.length; start += kLookupBatchSize) {
+      const int64_t length = std::min(kLookupBatchSize, data.length - start);
+      state.integer_lookup.Contains(values + start, length, found);
+      // Like the generic path, output true at null slots
+      int64_t i = 0;
+      ::arrow::internal::GenerateBitsUnrolled(
+          out_bitmap, output->offset + start, length, [&]() -> bool {
+            const bool is_in =
+                found[i] ||
+                (validity && !BitUtil::GetBit(validity, data.offset + start + i));
+            ++i;
+            return is_in;
+          });
+    }
+    return Status::OK();
+  }
+
+  template <typename Type>
+  enable_if_t<!has_integer_set_lookup<Type>::value, Status> ProcessIsIn() {
+    using T = typename GetViewType<Type>::T;
+    const auto& state = checked_cast<const SetLookupState<Type>&>(*ctx->state());
+    SetValidityIfValueSetHasNulls(state.lookup_null_count);
+
+    ArrayData* output = out->mutable_array();
     FirstTimeBitmapWriter writer(output->buffers[1]->mutable_data(), output->offset,
                                  output->length);
     VisitArrayDataInline<Type>(
@@ -365,6 +664,82 @@ void ExecIsIn(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
   });
 }
 
+// ----------------------------------------------------------------------
+// Dictionary inputs
+//
+// The dictionary values are looked up once and the results are gathered
+// through the indices, so the value set is never compared with decoded values.
+
+// Run IsInVisitor on data that was not prepared by the executor: the output
+// bitmaps are allocated here, and the validity is that of the input
+Result<Datum> IsInUnprepared(KernelContext* ctx, const ArrayData& data) {
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> out_bitmap,
+                        ctx->AllocateBitmap(data.length));
+  std::shared_ptr<Buffer> out_validity;
+  const int64_t null_count = data.GetNullCount();
+  if (null_count > 0) {
+    if (data.buffers[0]) {
+      ARROW_ASSIGN_OR_RAISE(
+          out_validity, ::arrow::internal::CopyBitmap(ctx->memory_pool(),
+                                                      data.buffers[0]->data(),
+                                                      data.offset, data.length));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(out_validity, ctx->AllocateBitmap(data.length));
+      BitUtil::SetBitsTo(out_validity->mutable_data(), 0, data.length, false);
+    }
+  }
+  Datum out(ArrayData::Make(boolean(), data.length, {out_validity, out_bitmap},
+                            null_count));
+  RETURN_NOT_OK(IsInVisitor(ctx, data, &out).Execute());
+  return out;
+}
+
+Result<Datum> IndexInUnprepared(KernelContext* ctx, const ArrayData& data) {
+  Datum out;
+  RETURN_NOT_OK(IndexInVisitor(ctx, data, &out).Execute());
+  return out;
+}
+
+// Look up the dictionary values with `lookup`, then take the results through
+// the indices. Null indices get the result of looking up a null value.
+template <typename LookupFunc>
+void ExecDictionarySetLookup(KernelContext* ctx, const ExecBatch& batch, Datum* out,
+                             LookupFunc&& lookup) {
+  DictionaryArray input(batch[0].array());
+  Datum dictionary_result;
+  KERNEL_RETURN_IF_ERROR(
+      ctx, lookup(ctx, *input.dictionary()->data()).Value(&dictionary_result));
+  Datum result;
+  KERNEL_RETURN_IF_ERROR(ctx, Take(dictionary_result, input.indices(),
+                                   TakeOptions::Defaults(), ctx->exec_context())
+                                  .Value(&result));
+  if (input.indices()->null_count() > 0) {
+    std::shared_ptr<Array> null_value;
+    Datum null_result;
+    std::shared_ptr<Scalar> null_scalar;
+    KERNEL_RETURN_IF_ERROR(ctx, MakeArrayOfNull(input.dictionary()->type(), 1,
+                                                ctx->memory_pool())
+                                    .Value(&null_value));
+    KERNEL_RETURN_IF_ERROR(ctx, lookup(ctx, *null_value->data()).Value(&null_result));
+    KERNEL_RETURN_IF_ERROR(
+        ctx, null_result.make_array()->GetScalar(0).Value(&null_scalar));
+    if (null_scalar->is_valid) {
+      KERNEL_RETURN_IF_ERROR(
+          ctx, CallFunction("fill_null", {result, null_scalar}, ctx->exec_context())
+                   .Value(&result));
+    }
+  }
+  out->value = result.array();
+}
+
+void ExecIsInDictionary(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  ExecDictionarySetLookup(ctx, batch, out, IsInUnprepared);
+}
+
+void ExecIndexInDictionary(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  ExecDictionarySetLookup(ctx, batch, out, IndexInUnprepared);
+}
+
 // Unary set lookup kernels available for the following input types
 //
 // * Null type
@@ -373,6 +748,7 @@ void ExecIsIn(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
 // * Simple temporal types (date, time, timestamp)
 // * Base binary types
 // * Decimal
+// * Dictionary of any of the above, see ExecDictionarySetLookup
 
 void AddBasicSetLookupKernels(ScalarKernel kernel,
                               const std::shared_ptr<DataType>& out_ty,
@@ -437,6 +813,13 @@ void RegisterScalarSetLookup(FunctionRegistry* registry) {
     isin_base.signature = KernelSignature::Make({null()}, boolean());
     isin_base.null_handling = NullHandling::COMPUTED_PREALLOCATE;
     DCHECK_OK(is_in->AddKernel(isin_base));
+
+    isin_base.exec = ExecIsInDictionary;
+    isin_base.signature =
+        KernelSignature::Make({InputType::Array(Type::DICTIONARY)}, boolean());
+    isin_base.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+    isin_base.mem_allocation = MemAllocation::NO_PREALLOCATE;
+    DCHECK_OK(is_in->AddKernel(isin_base));
     DCHECK_OK(registry->AddFunction(is_in));
 
     DCHECK_OK(registry->AddFunction(std::make_shared<IsInMetaBinary>()));
@@ -454,6 +837,11 @@ void RegisterScalarSetLookup(FunctionRegistry* registry) {
 
     match_base.signature = KernelSignature::Make({null()}, int32());
     DCHECK_OK(match->AddKernel(match_base));
+
+    match_base.exec = ExecIndexInDictionary;
+    match_base.signature =
+        KernelSignature::Make({InputType::Array(Type::DICTIONARY)}, int32());
+    DCHECK_OK(match->AddKernel(match_base));
     DCHECK_OK(registry->AddFunction(match));
 
     DCHECK_OK(registry->AddFunction(std::make_shared<IndexInMetaBinary>()));
@@ -0,0 +1,84 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+
+#include "arrow/compute/api_scalar.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/benchmark_util.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x94378165;
+
+// Look up int32 values in a value set of the given size, drawn from
+// [0, value_range); the input is drawn from the same range, so that the
+// value set size and range select the lookup strategy
+template <bool kIndexIn>
+static void SetLookupInt32(benchmark::State& state, int64_t value_set_size,
+                           int32_t value_range) {
+  RegressionArgs args(state, /*size_is_bytes=*/false);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Int32(args.size, 0, value_range - 1, args.null_proportion);
+  auto value_set = rand.Int32(value_set_size, 0, value_range - 1, /*null_probability=*/0);
+  for (auto _ : state) {
+    if (kIndexIn) {
+      ABORT_NOT_OK(IndexIn(values, value_set).status());
+    } else {
+      ABORT_NOT_OK(IsIn(values, value_set).status());
+    }
+  }
+}
+
+static void IsInInt32SmallSet(benchmark::State& state) {
+  SetLookupInt32</*kIndexIn=*/false>(state, 5, 10);
+}
+
+static void IsInInt32DenseSet(benchmark::State& state) {
+  SetLookupInt32</*kIndexIn=*/false>(state, 1000, 4000);
+}
+
+static void IsInInt32SparseSet(benchmark::State& state) {
+  SetLookupInt32</*kIndexIn=*/false>(state, 1000, 1 << 30);
+}
+
+static void IndexInInt32SmallSet(benchmark::State& state) {
+  SetLookupInt32</*kIndexIn=*/true>(state, 5, 10);
+}
+
+static void IndexInInt32DenseSet(benchmark::State& state) {
+  SetLookupInt32</*kIndexIn=*/true>(state, 1000, 4000);
+}
+
+static void IndexInInt32SparseSet(benchmark::State& state) {
+  SetLookupInt32</*kIndexIn=*/true>(state, 1000, 1 << 30);
+}
+
+BENCHMARK(IsInInt32SmallSet)->Apply(RegressionSetArgs);
+BENCHMARK(IsInInt32DenseSet)->Apply(RegressionSetArgs);
+BENCHMARK(IsInInt32SparseSet)->Apply(RegressionSetArgs);
+
+BENCHMARK(IndexInInt32SmallSet)->Apply(RegressionSetArgs);
+BENCHMARK(IndexInInt32DenseSet)->Apply(RegressionSetArgs);
+BENCHMARK(IndexInInt32SparseSet)->Apply(RegressionSetArgs);
+
+}  // namespace compute
+}  // namespace arrow
@@ -410,6 +410,26 @@ TEST_F(TestIsInKernel, IsInChunkedArrayInvoke) {
 
   AssertChunkedEquivalent(*expected_carr, *encoded_out.chunked_array());
 }
+TEST_F(TestIsInKernel, IsInDictionary) {
+  auto dict_type = dictionary(int32(), utf8());
+  auto input = DictArrayFromJSON(dict_type, "[0, 1, null, 2, 3, 0]",
+                                 R"(["a", "b", null, "c", "unused"])");
+  ASSERT_OK_AND_ASSIGN(Datum decoded, Cast(input, utf8()));
+  for (auto value_set : {R"(["a", "d"])", R"(["c", null])", "[]"}) {
+    auto member_set = ArrayFromJSON(utf8(), value_set);
+    ASSERT_OK_AND_ASSIGN(Datum expected, IsIn(decoded, member_set));
+    ASSERT_OK_AND_ASSIGN(Datum actual, IsIn(input, member_set));
+    ASSERT_OK(actual.make_array()->ValidateFull());
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+
+    ASSERT_OK_AND_ASSIGN(expected, IsIn(decoded.make_array()->Slice(2), member_set));
+    ASSERT_OK_AND_ASSIGN(actual, IsIn(input->Slice(2), member_set));
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  }
+  AssertDatumsEqual(ArrayFromJSON(boolean(), "[true, false, null, null, false, true]"),
+                    *IsIn(input, ArrayFromJSON(utf8(), R"(["a"])")));
+}
+
 // ----------------------------------------------------------------------
 // IndexIn tests
 
@@ -755,5 +775,128 @@ TEST_F(TestMatchKernel, MatchChunkedArrayInvoke) {
   AssertChunkedEquivalent(*expected_carr, *encoded_out.chunked_array());
 }
 
+// ----------------------------------------------------------------------
+// Integer lookup strategies
+
+// Integer value sets are looked up by linear scan, direct indexing or a flat
+// hash table depending on their size and range; check each against a
+// brute-force lookup
+template <typename Type>
+class TestSetLookupInteger : public ::testing::Test {
+ protected:
+  using T = typename Type::c_type;
+
+  void CheckStrategy(const std::vector<T>& member_values) {
+    std::vector<T> input_values;
+    for (size_t i = 0; i < member_values.size(); ++i) {
+      const T value = member_values[i];
+      input_values.push_back(value);
+      input_values.push_back(static_cast<T>(value + 1));
+      input_values.push_back(static_cast<T>(value - 1));
+      input_values.push_back(static_cast<T>(i * 2654435761U));
+    }
+    std::vector<bool> input_is_valid;
+    for (size_t i = 0; i < input_values.size(); ++i) {
+      input_is_valid.push_back(i % 7 != 3);
+    }
+
+    auto type = TypeTraits<Type>::type_singleton();
+    // Slice the input so that its validity bitmap has an offset
+    auto input = _MakeArray<Type, T>(type, input_values, input_is_valid)->Slice(5);
+    input_values.erase(input_values.begin(), input_values.begin() + 5);
+    input_is_valid.erase(input_is_valid.begin(), input_is_valid.begin() + 5);
+
+    for (bool set_has_null : {false, true}) {
+      std::vector<T> set_values = member_values;
+      std::vector<bool> set_is_valid(set_values.size(), true);
+      if (set_has_null) {
+        set_values.push_back(0);
+        set_is_valid.push_back(false);
+      }
+      auto member_set = _MakeArray<Type, T>(type, set_values, set_is_valid);
+
+      BooleanBuilder is_in_builder;
+      Int32Builder index_in_builder;
+      for (size_t i = 0; i < input_values.size(); ++i) {
+        if (!input_is_valid[i]) {
+          if (set_has_null) {
+            ASSERT_OK(is_in_builder.Append(true));
+            ASSERT_OK(index_in_builder.Append(
+                static_cast<int32_t>(member_values.size())));
+          } else {
+            ASSERT_OK(is_in_builder.AppendNull());
+            ASSERT_OK(index_in_builder.AppendNull());
+          }
+          continue;
+        }
+        auto it = std::find(member_values.begin(), member_values.end(), input_values[i]);
+        ASSERT_OK(is_in_builder.Append(it != member_values.end()));
+        if (it != member_values.end()) {
+          ASSERT_OK(index_in_builder.Append(
+              static_cast<int32_t>(it - member_values.begin())));
+        } else {
+          ASSERT_OK(index_in_builder.AppendNull());
+        }
+      }
+      std::shared_ptr<Array> expected_is_in, expected_index_in;
+      ASSERT_OK(is_in_builder.Finish(&expected_is_in));
+      ASSERT_OK(index_in_builder.Finish(&expected_index_in));
+
+      ASSERT_OK_AND_ASSIGN(Datum is_in, IsIn(input, member_set));
+      ASSERT_OK(is_in.make_array()->ValidateFull());
+      AssertArraysEqual(*expected_is_in, *is_in.make_array(), /*verbose=*/true);
+
+      ASSERT_OK_AND_ASSIGN(Datum index_in, IndexIn(input, member_set));
+      ASSERT_OK(index_in.make_array()->ValidateFull());
+      AssertArraysEqual(*expected_index_in, *index_in.make_array(), /*verbose=*/true);
+    }
+  }
+};
+
+using IntegerLookupTypes = ::testing::Types<Int16Type, UInt16Type, Int32Type,
+                                            UInt32Type, Int64Type, UInt64Type>;
+
+TYPED_TEST_SUITE(TestSetLookupInteger, IntegerLookupTypes);
+
+TYPED_TEST(TestSetLookupInteger, SmallSet) {
+  using T = typename TypeParam::c_type;
+  this->CheckStrategy({3, 1, 4, 15, 9});
+  this->CheckStrategy({static_cast<T>(-2), 0, 7});
+}
+
+TYPED_TEST(TestSetLookupInteger, DenseSet) {
+  using T = typename TypeParam::c_type;
+  // Spanning zero: unsigned values wrap around, but still form a compact range
+  std::vector<T> values;
+  for (int i = -3000; i <= 3000; i += 3) {
+    values.push_back(static_cast<T>(i));
+  }
+  this->CheckStrategy(values);
+}
+
+TYPED_TEST(TestSetLookupInteger, SparseSet) {
+  using T = typename TypeParam::c_type;
+  std::vector<T> values;
+  for (uint64_t i = 0; i < 2000; ++i) {
+    values.push_back(static_cast<T>(i * 0x9E3779B97F4A7C15ULL + 17));
+  }
+  this->CheckStrategy(values);
+}
+
+TEST_F(TestMatchKernel, MatchDictionary) {
+  auto dict_type = dictionary(int16(), int64());
+  auto input = DictArrayFromJSON(dict_type, "[3, 0, null, 1, 2, 0]", "[5, 7, null, 9]");
+  ASSERT_OK_AND_ASSIGN(Datum decoded, Cast(input, int64()));
+  for (auto value_set : {"[9, 5]", "[null, 7, 5]", "[]"}) {
+    auto member_set = ArrayFromJSON(int64(), value_set);
+    ASSERT_OK_AND_ASSIGN(Datum expected, IndexIn(decoded, member_set));
+    ASSERT_OK_AND_ASSIGN(Datum actual, IndexIn(input, member_set));
+    ASSERT_OK(actual.make_array()->ValidateFull());
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  }
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[null, 2, 0, 1, 0, 2]"),
+                    *IndexIn(input, ArrayFromJSON(int64(), "[null, 7, 5]")));
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -17,12 +17,17 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstring>
 #include <string>
 
 #ifdef ARROW_WITH_UTF8PROC
 #include <utf8proc.h>
 #endif
 
+#ifdef ARROW_WITH_RE2
+#include <re2/re2.h>
+#endif
+
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/compute/kernels/scalar_string_internal.h"
@@ -40,16 +45,6 @@ namespace {
 // codepoint. This guaranteed by non-overlap design of the unicode standard. (see
 // section 2.5 of Unicode Standard Core Specification v13.0)
 
-static inline uint8_t ascii_tolower(uint8_t utf8_code_unit) {
-  return ((utf8_code_unit >= 'A') && (utf8_code_unit <= 'Z')) ? (utf8_code_unit + 32)
-                                                              : utf8_code_unit;
-}
-
-static inline uint8_t ascii_toupper(uint8_t utf8_code_unit) {
-  return ((utf8_code_unit >= 'a') && (utf8_code_unit <= 'z')) ? (utf8_code_unit - 32)
-                                                              : utf8_code_unit;
-}
-
 template <typename T>
 static inline bool IsAsciiCharacter(T character) {
   return character < 128;
@@ -62,6 +57,42 @@ struct BinaryLength {
   }
 };
 
+// Flip the case of the ASCII letters between kFirst and kLast, eight bytes at
+// a time: adding (0x80 - kFirst) to a 7-bit byte sets its high bit if it is
+// >= kFirst, and adding (0x7f - kLast) if it is > kLast, without carrying over
+// to the next byte. Bytes with the high bit set (non-ASCII) are left as is.
+template <uint8_t kFirst, uint8_t kLast>
+void TransformAsciiCase(const uint8_t* input, int64_t length, uint8_t* output) {
+  constexpr uint64_t kOnes = 0x0101010101010101ULL;
+  constexpr uint64_t kHighBits = kOnes * 0x80;
+  constexpr uint64_t kAddFirst = kOnes * (0x80 - kFirst);
+  constexpr uint64_t kAddLast = kOnes * (0x7f - kLast);
+
+  int64_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    uint64_t word;
+    std::memcpy(&word, input + i, 8);
+    const uint64_t low_bits = word & ~kHighBits;
+    const uint64_t in_range =
+        ((low_bits + kAddFirst) ^ (low_bits + kAddLast)) & ~word & kHighBits;
+    // The high bit of each letter moved to the case bit (0x20)
+    word ^= in_range >> 2;
+    std::memcpy(output + i, &word, 8);
+  }
+  for (; i < length; ++i) {
+    const uint8_t c = input[i];
+    output[i] = (c >= kFirst && c <= kLast) ? (c ^ 0x20) : c;
+  }
+}
+
+void TransformAsciiUpper(const uint8_t* input, int64_t length, uint8_t* output) {
+  TransformAsciiCase<'a', 'z'>(input, length, output);
+}
+
+void TransformAsciiLower(const uint8_t* input, int64_t length, uint8_t* output) {
+  TransformAsciiCase<'A', 'Z'>(input, length, output);
+}
+
 #ifdef ARROW_WITH_UTF8PROC
 
 // Direct lookup tables for unicode properties
@@ -91,6 +122,13 @@ struct UTF8Transform {
 
   static bool Transform(const uint8_t* input, offset_type input_string_ncodeunits,
                         uint8_t* output, offset_type* output_written) {
+    // ASCII strings are transformed without decoding them, and all ASCII
+    // codepoints map to ASCII codepoints
+    if (arrow::util::ValidateAscii(input, input_string_ncodeunits)) {
+      Derived::TransformAscii(input, input_string_ncodeunits, output);
+      *output_written = input_string_ncodeunits;
+      return true;
+    }
     uint8_t* output_start = output;
     if (ARROW_PREDICT_FALSE(
             !arrow::util::UTF8Transform(input, input + input_string_ncodeunits, &output,
@@ -190,6 +228,10 @@ struct UTF8Transform {
 
 template <typename Type>
 struct UTF8Upper : UTF8Transform<Type, UTF8Upper<Type>> {
+  static void TransformAscii(const uint8_t* input, int64_t length, uint8_t* output) {
+    TransformAsciiUpper(input, length, output);
+  }
+
   inline static uint32_t TransformCodepoint(uint32_t codepoint) {
     return codepoint <= kMaxCodepointLookup ? lut_upper_codepoint[codepoint]
                                             : utf8proc_toupper(codepoint);
@@ -198,6 +240,10 @@ struct UTF8Upper : UTF8Transform<Type, UTF8Upper<Type>> {
 
 template <typename Type>
 struct UTF8Lower : UTF8Transform<Type, UTF8Lower<Type>> {
+  static void TransformAscii(const uint8_t* input, int64_t length, uint8_t* output) {
+    TransformAsciiLower(input, length, output);
+  }
+
   static uint32_t TransformCodepoint(uint32_t codepoint) {
     return codepoint <= kMaxCodepointLookup ? lut_lower_codepoint[codepoint]
                                             : utf8proc_tolower(codepoint);
@@ -273,10 +319,6 @@ void StringDataTransform(KernelContext* ctx, const ExecBatch& batch,
   }
 }
 
-void TransformAsciiUpper(const uint8_t* input, int64_t length, uint8_t* output) {
-  std::transform(input, input + length, output, ascii_toupper);
-}
-
 template <typename Type>
 struct AsciiUpper {
   static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
@@ -284,10 +326,6 @@ struct AsciiUpper {
   }
 };
 
-void TransformAsciiLower(const uint8_t* input, int64_t length, uint8_t* output) {
-  std::transform(input, input + length, output, ascii_tolower);
-}
-
 template <typename Type>
 struct AsciiLower {
   static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
@@ -330,11 +368,57 @@ void StringBoolTransform(KernelContext* ctx, const ExecBatch& batch,
   }
 }
 
+// Patterns up to this length are searched using memchr() on their first byte,
+// which the C library vectorizes, each candidate being checked with memcmp()
+constexpr int64_t kMaxShortSubstringPattern = 16;
+
+bool ContainsShortSubstring(const uint8_t* pattern, int64_t pattern_length,
+                            const uint8_t* data, int64_t length) {
+  if (length < pattern_length) {
+    return false;
+  }
+  const uint8_t* end = data + length - pattern_length + 1;
+  while (data < end) {
+    data = static_cast<const uint8_t*>(std::memchr(data, pattern[0], end - data));
+    if (data == nullptr) {
+      return false;
+    }
+    if (std::memcmp(data + 1, pattern + 1, pattern_length - 1) == 0) {
+      return true;
+    }
+    ++data;
+  }
+  return false;
+}
+
+template <typename offset_type>
+void TransformMatchShortSubstring(const uint8_t* pattern, int64_t pattern_length,
+                                  const offset_type* offsets, const uint8_t* data,
+                                  int64_t length, int64_t output_offset,
+                                  uint8_t* output) {
+  FirstTimeBitmapWriter bitmap_writer(output, output_offset, length);
+  for (int64_t i = 0; i < length; ++i) {
+    if (ContainsShortSubstring(pattern, pattern_length, data + offsets[i],
+                               offsets[i + 1] - offsets[i])) {
+      bitmap_writer.Set();
+    }
+    bitmap_writer.Next();
+  }
+  bitmap_writer.Finish();
+}
+
 template <typename offset_type>
 void TransformMatchSubstring(const uint8_t* pattern, int64_t pattern_length,
                              const offset_type* offsets, const uint8_t* data,
                              int64_t length, int64_t output_offset, uint8_t* output) {
-  // This is an implementation of the Knuth-Morris-Pratt algorithm
+  if (pattern_length > 0 && pattern_length <= kMaxShortSubstringPattern) {
+    TransformMatchShortSubstring(pattern, pattern_length, offsets, data, length,
+                                 output_offset, output);
+    return;
+  }
+
+  // Longer patterns use the Knuth-Morris-Pratt algorithm, which doesn't
+  // backtrack in the data
 
   // Phase 1: Build the prefix table
   std::vector<offset_type> prefix_table(pattern_length + 1);
@@ -402,6 +486,196 @@ void AddMatchSubstring(FunctionRegistry* registry) {
   DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
+#ifdef ARROW_WITH_RE2
+
+// Kernel state holding a pattern compiled when the kernel is initialized: it is
+// then used for all the batches of the call. A compiled RE2 is safe to use
+// concurrently from several threads.
+class MatchPatternState : public KernelState {
+ public:
+  static std::unique_ptr<KernelState> InitRegex(KernelContext* ctx,
+                                                const KernelInitArgs& args) {
+    const auto options = GetOptions(ctx, args);
+    if (options == nullptr) {
+      return nullptr;
+    }
+    return MakeRegex(ctx, kRegex, options->pattern, RE2::Options());
+  }
+
+  static std::unique_ptr<KernelState> InitLike(KernelContext* ctx,
+                                               const KernelInitArgs& args) {
+    const auto options = GetOptions(ctx, args);
+    if (options == nullptr) {
+      return nullptr;
+    }
+    const std::string& pattern = options->pattern;
+
+    // Parse the LIKE pattern into literal bytes and wildcards: '%' matches any
+    // sequence of characters, '_' a single one and '\' escapes the next byte
+    static constexpr int kAnyChars = -1;
+    static constexpr int kOneChar = -2;
+    std::vector<int> tokens;
+    for (size_t i = 0; i < pattern.size(); ++i) {
+      if (pattern[i] == '\\' && i + 1 < pattern.size()) {
+        tokens.push_back(static_cast<uint8_t>(pattern[++i]));
+      } else if (pattern[i] == '%') {
+        tokens.push_back(kAnyChars);
+      } else if (pattern[i] == '_') {
+        tokens.push_back(kOneChar);
+      } else {
+        tokens.push_back(static_cast<uint8_t>(pattern[i]));
+      }
+    }
+
+    // Patterns of the form 'literal', 'literal%', '%literal' and '%literal%'
+    // don't need a regex
+    auto begin = tokens.begin(), end = tokens.end();
+    bool leading_any = false, trailing_any = false;
+    while (begin != end && *begin == kAnyChars) {
+      leading_any = true;
+      ++begin;
+    }
+    while (begin != end && *(end - 1) == kAnyChars) {
+      trailing_any = true;
+      --end;
+    }
+    if (std::all_of(begin, end, [](int token) { return token >= 0; })) {
+      std::string literal(begin, end);
+      Kind kind = leading_any ? (trailing_any ? kSubstring : kSuffix)
+                              : (trailing_any ? kPrefix : kExact);
+      if (kind == kSubstring && literal.empty()) {
+        kind = kPrefix;
+      }
+      return std::unique_ptr<KernelState>(new MatchPatternState(kind, literal));
+    }
+
+    std::string regex;
+    std::string literal;
+    for (int token : tokens) {
+      if (token >= 0) {
+        literal.push_back(static_cast<char>(token));
+        continue;
+      }
+      regex += RE2::QuoteMeta(literal);
+      literal.clear();
+      regex += token == kAnyChars ? ".*" : ".";
+    }
+    regex += RE2::QuoteMeta(literal);
+
+    RE2::Options re2_options;
+    re2_options.set_dot_nl(true);
+    return MakeRegex(ctx, kLike, regex, re2_options);
+  }
+
+  template <typename offset_type>
+  void Transform(const offset_type* offsets, const uint8_t* data, int64_t length,
+                 int64_t output_offset, uint8_t* output) const {
+    if (kind_ == kSubstring) {
+      TransformMatchSubstring<offset_type>(
+          reinterpret_cast<const uint8_t*>(literal_.data()),
+          static_cast<int64_t>(literal_.size()), offsets, data, length, output_offset,
+          output);
+      return;
+    }
+    FirstTimeBitmapWriter bitmap_writer(output, output_offset, length);
+    for (int64_t i = 0; i < length; ++i) {
+      if (Matches(data + offsets[i], offsets[i + 1] - offsets[i])) {
+        bitmap_writer.Set();
+      }
+      bitmap_writer.Next();
+    }
+    bitmap_writer.Finish();
+  }
+
+ private:
+  enum Kind { kExact, kPrefix, kSuffix, kSubstring, kLike, kRegex };
+
+  MatchPatternState(Kind kind, std::string literal)
+      : kind_(kind), literal_(std::move(literal)) {}
+
+  static const MatchSubstringOptions* GetOptions(KernelContext* ctx,
+                                                 const KernelInitArgs& args) {
+    if (args.options == nullptr) {
+      ctx->SetStatus(Status::Invalid(
+          "Attempted to initialize KernelState from null FunctionOptions"));
+    }
+    return static_cast<const MatchSubstringOptions*>(args.options);
+  }
+
+  static std::unique_ptr<KernelState> MakeRegex(KernelContext* ctx, Kind kind,
+                                                const std::string& regex,
+                                                RE2::Options options) {
+    options.set_log_errors(false);
+    std::unique_ptr<MatchPatternState> state(new MatchPatternState(kind, ""));
+    state->regex_.reset(new RE2(regex, options));
+    if (!state->regex_->ok()) {
+      ctx->SetStatus(
+          Status::Invalid("Invalid regular expression: ", state->regex_->error()));
+      return nullptr;
+    }
+    return std::move(state);
+  }
+
+  bool Matches(const uint8_t* value, int64_t value_length) const {
+    const auto literal_length = static_cast<int64_t>(literal_.size());
+    switch (kind_) {
+      case kExact:
+        return value_length == literal_length &&
+               std::memcmp(value, literal_.data(), literal_length) == 0;
+      case kPrefix:
+        return value_length >= literal_length &&
+               std::memcmp(value, literal_.data(), literal_length) == 0;
+      case kSuffix:
+        return value_length >= literal_length &&
+               std::memcmp(value + value_length - literal_length, literal_.data(),
+                           literal_length) == 0;
+      case kLike:
+        return RE2::FullMatch(ToStringPiece(value, value_length), *regex_);
+      case kRegex:
+        return RE2::PartialMatch(ToStringPiece(value, value_length), *regex_);
+      default:
+        // kSubstring is handled a batch at a time in Transform()
+        DCHECK(false);
+        return false;
+    }
+  }
+
+  static re2::StringPiece ToStringPiece(const uint8_t* value, int64_t value_length) {
+    return re2::StringPiece(reinterpret_cast<const char*>(value),
+                            static_cast<size_t>(value_length));
+  }
+
+  Kind kind_;
+  std::string literal_;
+  std::unique_ptr<RE2> regex_;
+};
+
+template <typename Type>
+struct MatchPattern {
+  using offset_type = typename Type::offset_type;
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const auto& state = checked_cast<const MatchPatternState&>(*ctx->state());
+    StringBoolTransform<Type>(
+        ctx, batch,
+        [&state](const void* offsets, const uint8_t* data, int64_t length,
+                 int64_t output_offset, uint8_t* output) {
+          state.Transform(reinterpret_cast<const offset_type*>(offsets), data, length,
+                          output_offset, output);
+        },
+        out);
+  }
+};
+
+void AddMatchPattern(FunctionRegistry* registry, std::string name, KernelInit init) {
+  auto func = std::make_shared<ScalarFunction>(std::move(name), Arity::Unary());
+  DCHECK_OK(func->AddKernel({utf8()}, boolean(), MatchPattern<StringType>::Exec, init));
+  DCHECK_OK(func->AddKernel({large_utf8()}, boolean(),
+                            MatchPattern<LargeStringType>::Exec, init));
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+}
+
+#endif  // ARROW_WITH_RE2
+
 // IsAlpha/Digit etc
 
 #ifdef ARROW_WITH_UTF8PROC
@@ -975,6 +1249,10 @@ void RegisterScalarStringAscii(FunctionRegistry* registry) {
 
   AddBinaryLength(registry);
   AddMatchSubstring(registry);
+#ifdef ARROW_WITH_RE2
+  AddMatchPattern(registry, "match_like", MatchPatternState::InitLike);
+  AddMatchPattern(registry, "match_regex", MatchPatternState::InitRegex);
+#endif
   AddStrptime(registry);
 }
 
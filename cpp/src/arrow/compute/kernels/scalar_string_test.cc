@@ -74,12 +74,17 @@ TYPED_TEST(TestStringKernels, AsciiUpper) {
   this->CheckUnary("ascii_upper", "[]", this->type(), "[]");
   this->CheckUnary("ascii_upper", "[\"aAazZæÆ&\", null, \"\", \"bbb\"]", this->type(),
                    "[\"AAAZZæÆ&\", null, \"\", \"BBB\"]");
+  // Longer strings are converted a word at a time
+  this->CheckUnary("ascii_upper", R"(["@az[`{AZ azertyuiopqsdfghjklm", "a-zæ-Æa-z"])",
+                   this->type(), R"(["@AZ[`{AZ AZERTYUIOPQSDFGHJKLM", "A-Zæ-ÆA-Z"])");
 }
 
 TYPED_TEST(TestStringKernels, AsciiLower) {
   this->CheckUnary("ascii_lower", "[]", this->type(), "[]");
   this->CheckUnary("ascii_lower", "[\"aAazZæÆ&\", null, \"\", \"BBB\"]", this->type(),
                    "[\"aaazzæÆ&\", null, \"\", \"bbb\"]");
+  this->CheckUnary("ascii_lower", R"(["@AZ[`{az AZERTYUIOPQSDFGHJKLM", "A-ZÆ-æA-Z"])",
+                   this->type(), R"(["@az[`{az azertyuiopqsdfghjklm", "a-zÆ-æa-z"])");
 }
 
 TEST(TestStringKernels, LARGE_MEMORY_TEST(Utf8Upper32bitGrowth)) {
@@ -118,6 +123,10 @@ TYPED_TEST(TestStringKernels, Utf8Upper) {
   // test maximum buffer growth
   this->CheckUnary("utf8_upper", "[\"ɑɑɑɑ\"]", this->type(), "[\"ⱭⱭⱭⱭ\"]");
 
+  // ASCII-only strings take a shortcut
+  this->CheckUnary("utf8_upper", R"(["hello @ World[]{}", "ascii", "not ascii: æ"])",
+                   this->type(), R"(["HELLO @ WORLD[]{}", "ASCII", "NOT ASCII: Æ"])");
+
   // Test invalid data
   auto invalid_input = ArrayFromJSON(this->type(), "[\"ɑa\xFFɑ\", \"ɽ\xe1\xbdɽaa\"]");
   EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, testing::HasSubstr("Invalid UTF8 sequence"),
@@ -140,6 +149,9 @@ TYPED_TEST(TestStringKernels, Utf8Lower) {
   // test maximum buffer growth
   this->CheckUnary("utf8_lower", "[\"ȺȺȺȺ\"]", this->type(), "[\"ⱥⱥⱥⱥ\"]");
 
+  this->CheckUnary("utf8_lower", R"(["HELLO @ World[]{}", "ASCII", "NOT ASCII: Æ"])",
+                   this->type(), R"(["hello @ world[]{}", "ascii", "not ascii: æ"])");
+
   // Test invalid data
   auto invalid_input = ArrayFromJSON(this->type(), "[\"Ⱥa\xFFⱭ\", \"Ɽ\xe1\xbdⱤaA\"]");
   EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, testing::HasSubstr("Invalid UTF8 sequence"),
@@ -332,8 +344,82 @@ TYPED_TEST(TestStringKernels, MatchSubstring) {
   MatchSubstringOptions options_double_char_2{"bbcaa"};
   this->CheckUnary("match_substring", R"(["abcbaabbbcaabccabaab"])", boolean(), "[true]",
                    &options_double_char_2);
+
+  // Candidates at the end of the string, and overlapping ones
+  MatchSubstringOptions options_end{"abc"};
+  this->CheckUnary("match_substring", R"(["ab", "xxab", "xxabc", "aababcx", "abac"])",
+                   boolean(), "[false, false, true, true, false]", &options_end);
+
+  // Longer patterns
+  MatchSubstringOptions options_long{"abcdefghijklmnopq"};
+  this->CheckUnary(
+      "match_substring",
+      R"(["abcdefghijklmnop", "xabcdefghijklmnopq", "abcdefghijklmnopabcdefghijklmnopqr"])",
+      boolean(), "[false, true, true]", &options_long);
+}
+
+#ifdef ARROW_WITH_RE2
+TYPED_TEST(TestStringKernels, MatchLike) {
+  auto inputs = R"(["foo", "bar", "foobar", "barfoo", "o", "\nfoo", "foo%", null])";
+
+  MatchSubstringOptions prefix{"foo%"};
+  this->CheckUnary("match_like", inputs, boolean(),
+                   "[true, false, true, false, false, false, true, null]", &prefix);
+  MatchSubstringOptions suffix{"%foo"};
+  this->CheckUnary("match_like", inputs, boolean(),
+                   "[true, false, false, true, false, true, false, null]", &suffix);
+  MatchSubstringOptions substring{"%oo%"};
+  this->CheckUnary("match_like", inputs, boolean(),
+                   "[true, false, true, true, false, true, true, null]", &substring);
+  MatchSubstringOptions exact{"foo"};
+  this->CheckUnary("match_like", inputs, boolean(),
+                   "[true, false, false, false, false, false, false, null]", &exact);
+  MatchSubstringOptions any{"%"};
+  this->CheckUnary("match_like", inputs, boolean(),
+                   "[true, true, true, true, true, true, true, null]", &any);
+
+  // Patterns compiled to a regex
+  MatchSubstringOptions single_char{"_oo%"};
+  this->CheckUnary("match_like", inputs, boolean(),
+                   "[true, false, true, false, false, false, true, null]", &single_char);
+  MatchSubstringOptions inner{"%f%r"};
+  this->CheckUnary("match_like", inputs, boolean(),
+                   "[false, false, true, false, false, false, false, null]", &inner);
+  MatchSubstringOptions newline{"%_foo"};
+  this->CheckUnary("match_like", inputs, boolean(),
+                   "[false, false, false, true, false, true, false, null]", &newline);
+  MatchSubstringOptions escaped{"foo\\%"};
+  this->CheckUnary("match_like", inputs, boolean(),
+                   "[false, false, false, false, false, false, true, null]", &escaped);
+  // A wildcard matches a character, not a byte
+  MatchSubstringOptions unicode{"_b"};
+  this->CheckUnary("match_like", R"(["ab", "æb", "aab"])", boolean(),
+                   "[true, true, false]", &unicode);
+  // Regex syntax has no special meaning
+  MatchSubstringOptions metachars{"a.c|d%"};
+  this->CheckUnary("match_like", R"(["abc", "d", "a.c|d"])", boolean(),
+                   "[false, false, true]", &metachars);
 }
 
+TYPED_TEST(TestStringKernels, MatchRegex) {
+  MatchSubstringOptions options{"ab+c"};
+  this->CheckUnary("match_regex", "[]", boolean(), "[]", &options);
+  this->CheckUnary("match_regex", R"(["abc", "ac", "xabbbcx", null, "ABC"])",
+                   boolean(), "[true, false, true, null, false]", &options);
+
+  MatchSubstringOptions anchored{"^a.c$"};
+  this->CheckUnary("match_regex", R"(["abc", "aæc", "xabc", "abcd"])", boolean(),
+                   "[true, true, false, false]", &anchored);
+}
+
+TYPED_TEST(TestStringKernels, MatchRegexInvalid) {
+  auto input = ArrayFromJSON(this->type(), R"(["abc"])");
+  MatchSubstringOptions options{"(ab"};
+  ASSERT_RAISES(Invalid, CallFunction("match_regex", {input}, &options));
+  ASSERT_RAISES(Invalid, CallFunction("match_like", {input}));
+}
+#endif
+
 TYPED_TEST(TestStringKernels, Strptime) {
   std::string input1 = R"(["5/1/2020", null, "12/11/1900"])";
   std::string output1 = R"(["2020-05-01", null, "1900-12-11"])";
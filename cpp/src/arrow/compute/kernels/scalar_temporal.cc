@@ -0,0 +1,574 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Temporal component extraction (year, month, day, ...) and truncation.
+//
+// The per-value arithmetic is written without data-dependent branches (the
+// conditional expressions below compile to selects) so that the inner loops
+// can be auto-vectorized.  Values that cannot be handled, which may only come
+// from null slots or from timestamps thousands of years away, are clamped
+// inside the loop and reported afterwards.
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "arrow/array/util.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/util/bitmap_reader.h"
+#include "arrow/util/int_util_internal.h"
+#include "arrow/util/optional.h"
+#include "arrow/vendored/datetime.h"
+
+namespace arrow {
+
+using internal::AddWithOverflow;
+using internal::MultiplyWithOverflow;
+using internal::OptionalBitIndexer;
+
+namespace compute {
+namespace internal {
+namespace {
+
+namespace date = arrow_vendored::date;
+
+using TruncateState = OptionsWrapper<TruncateOptions>;
+
+constexpr int64_t kSecondsPerMinute = 60;
+constexpr int64_t kSecondsPerHour = 3600;
+constexpr int64_t kSecondsPerDay = 86400;
+
+// Days since the epoch are restricted to about +/- 2.9 million years, which
+// keeps all the civil calendar arithmetic below within 32 bits.
+constexpr int64_t kMaxDays = int64_t(1) << 30;
+
+// ----------------------------------------------------------------------
+// Branchless calendar arithmetic
+//
+// See http://howardhinnant.github.io/date_algorithms.html
+
+// Division rounding towards negative infinity, for a positive divisor
+template <typename T>
+inline T FloorDiv(T value, T divisor) {
+  return value / divisor - static_cast<T>((value % divisor) < 0);
+}
+
+struct CivilDate {
+  int32_t year;
+  uint32_t month;  // 1 to 12
+  uint32_t day;    // 1 to 31
+};
+
+inline CivilDate CivilFromDays(int32_t days) {
+  const int32_t z = days + 719468;
+  const int32_t era = (z >= 0 ? z : z - 146096) / 146097;
+  const uint32_t doe = static_cast<uint32_t>(z - era * 146097);
+  const uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  const uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  const uint32_t mp = (5 * doy + 2) / 153;
+  const uint32_t day = doy - (153 * mp + 2) / 5 + 1;
+  const uint32_t month = mp < 10 ? mp + 3 : mp - 9;
+  const int32_t year = static_cast<int32_t>(yoe) + era * 400 + (month <= 2);
+  return {year, month, day};
+}
+
+inline int32_t DaysFromCivil(int32_t year, uint32_t month, uint32_t day) {
+  year -= (month <= 2);
+  const int32_t era = (year >= 0 ? year : year - 399) / 400;
+  const uint32_t yoe = static_cast<uint32_t>(year - era * 400);
+  const uint32_t doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  const uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + static_cast<int32_t>(doe) - 719468;
+}
+
+// ----------------------------------------------------------------------
+// Input resolutions
+//
+// For dates, kUnitsPerSecond is only meaningful through
+// SubDayUnitLength(), where it makes sub-day truncation a no-op for date32.
+
+template <typename CTypeT, int64_t UnitsPerSecond, int64_t UnitsPerDay>
+struct Resolution {
+  using CType = CTypeT;
+  static constexpr int64_t kUnitsPerSecond = UnitsPerSecond;
+  static constexpr int64_t kUnitsPerDay = UnitsPerDay;
+  // The earliest day whose start is representable
+  static constexpr int64_t kMinDays =
+      std::numeric_limits<int64_t>::min() / UnitsPerDay + 1;
+};
+
+using Date32Resolution = Resolution<int32_t, 1, 1>;
+using Date64Resolution = Resolution<int64_t, 1000, 1000 * kSecondsPerDay>;
+template <int64_t UnitsPerSecond>
+using TimestampResolution =
+    Resolution<int64_t, UnitsPerSecond, UnitsPerSecond * kSecondsPerDay>;
+
+// Splits a value into whole days since the epoch and the remainder, clamping
+// the days to +/- kMaxDays
+template <typename Res>
+inline int32_t SplitDays(int64_t value, int64_t* time_of_day, bool* out_of_range) {
+  int64_t days = FloorDiv<int64_t>(value, Res::kUnitsPerDay);
+  *time_of_day = value - days * Res::kUnitsPerDay;
+  *out_of_range |= (days > kMaxDays) | (days < -kMaxDays);
+  days = days > kMaxDays ? kMaxDays : days;
+  days = days < -kMaxDays ? -kMaxDays : days;
+  return static_cast<int32_t>(days);
+}
+
+template <typename Res>
+inline int64_t SubDayUnitLength(int64_t seconds) {
+  return seconds * Res::kUnitsPerSecond < Res::kUnitsPerDay
+             ? seconds * Res::kUnitsPerSecond
+             : Res::kUnitsPerDay;
+}
+
+// Calls visitor.Visit<Resolution>() for the resolution of a temporal type
+template <typename Visitor>
+Status VisitResolution(const DataType& type, Visitor* visitor) {
+  switch (type.id()) {
+    case Type::DATE32:
+      return visitor->template Visit<Date32Resolution>();
+    case Type::DATE64:
+      return visitor->template Visit<Date64Resolution>();
+    case Type::TIMESTAMP:
+      switch (checked_cast<const TimestampType&>(type).unit()) {
+        case TimeUnit::SECOND:
+          return visitor->template Visit<TimestampResolution<1>>();
+        case TimeUnit::MILLI:
+          return visitor->template Visit<TimestampResolution<1000>>();
+        case TimeUnit::MICRO:
+          return visitor->template Visit<TimestampResolution<1000000>>();
+        case TimeUnit::NANO:
+          return visitor->template Visit<TimestampResolution<1000000000>>();
+      }
+      break;
+    default:
+      break;
+  }
+  return Status::TypeError("Unsupported temporal type: ", type);
+}
+
+// ----------------------------------------------------------------------
+// Time zone handling
+
+// Offsets of a time zone from UTC.
+//
+// Consecutive values mostly fall within the same period between two offset
+// transitions, so the last period looked up is cached and the time zone
+// database is only consulted when a value falls outside of it.
+class ZoneOffsets {
+ public:
+  static Result<ZoneOffsets> Make(const std::string& timezone) {
+    ZoneOffsets offsets;
+    if (ParseFixedOffset(timezone, &offsets.offset_)) {
+      return offsets;
+    }
+    try {
+      offsets.zone_ = date::locate_zone(timezone);
+    } catch (const std::runtime_error& e) {
+      return Status::Invalid("Cannot locate timezone '", timezone, "': ", e.what());
+    }
+    return offsets;
+  }
+
+  /// The offset in seconds to add to a UTC time to obtain the local time
+  int64_t OffsetAt(int64_t utc_seconds) {
+    if (zone_ != NULLPTR && (utc_seconds < begin_ || utc_seconds >= end_)) {
+      const auto info =
+          zone_->get_info(date::sys_seconds(std::chrono::seconds(utc_seconds)));
+      begin_ = info.begin.time_since_epoch().count();
+      end_ = info.end.time_since_epoch().count();
+      offset_ = info.offset.count();
+    }
+    return offset_;
+  }
+
+  /// The UTC time of a local time.  Nonexistent local times map to the
+  /// transition that skips them and ambiguous ones to their earliest
+  /// instant.
+  int64_t ToUtc(int64_t local_seconds) {
+    const int64_t utc_seconds = local_seconds - offset_;
+    // A local time may be ambiguous only within a day after a transition
+    if (zone_ == NULLPTR ||
+        (utc_seconds >= begin_ + kSecondsPerDay && utc_seconds < end_)) {
+      return utc_seconds;
+    }
+    const auto sys =
+        zone_->to_sys(date::local_seconds(std::chrono::seconds(local_seconds)),
+                      date::choose::earliest);
+    const int64_t result = sys.time_since_epoch().count();
+    OffsetAt(result);
+    return result;
+  }
+
+ private:
+  ZoneOffsets() = default;
+
+  // Parses "+HH:MM", "-HH:MM", "+HHMM" or "-HHMM"
+  static bool ParseFixedOffset(const std::string& timezone, int64_t* offset) {
+    const size_t size = timezone.size();
+    if ((size != 5 && size != 6) || (timezone[0] != '+' && timezone[0] != '-') ||
+        (size == 6 && timezone[3] != ':')) {
+      return false;
+    }
+    const char* digits[] = {&timezone[1], &timezone[2], &timezone[size - 2],
+                            &timezone[size - 1]};
+    int values[4];
+    for (int i = 0; i < 4; ++i) {
+      if (*digits[i] < '0' || *digits[i] > '9') return false;
+      values[i] = *digits[i] - '0';
+    }
+    const int64_t hours = values[0] * 10 + values[1];
+    const int64_t minutes = values[2] * 10 + values[3];
+    if (hours > 23 || minutes > 59) return false;
+    *offset = (timezone[0] == '-' ? -1 : 1) * (hours * kSecondsPerHour + minutes * 60);
+    return true;
+  }
+
+  const date::time_zone* zone_ = NULLPTR;
+  // The period [begin_, end_) in UTC seconds during which offset_ applies
+  int64_t begin_ = 0;
+  int64_t end_ = 0;
+  int64_t offset_ = 0;
+};
+
+const std::string* GetTimezone(const DataType& type) {
+  if (type.id() == Type::TIMESTAMP) {
+    const auto& timezone = checked_cast<const TimestampType&>(type).timezone();
+    if (!timezone.empty()) {
+      return &timezone;
+    }
+  }
+  return NULLPTR;
+}
+
+// Writes the local times of the valid values into `out`
+template <typename Res>
+Status ToLocal(const ArrayData& in, ZoneOffsets* zone, typename Res::CType* out) {
+  using CType = typename Res::CType;
+  const CType* values = in.GetValues<CType>(1);
+  OptionalBitIndexer is_valid(in.buffers[0], in.offset);
+  for (int64_t i = 0; i < in.length; ++i) {
+    out[i] = 0;
+    if (!is_valid[i]) continue;
+    const int64_t offset =
+        zone->OffsetAt(FloorDiv<int64_t>(values[i], Res::kUnitsPerSecond));
+    if (ARROW_PREDICT_FALSE(
+            AddWithOverflow(values[i], static_cast<CType>(offset * Res::kUnitsPerSecond),
+                            &out[i]))) {
+      return Status::Invalid("Timestamp value ", values[i],
+                             " overflows when converted to local time");
+    }
+  }
+  return Status::OK();
+}
+
+// Converts the valid local times in `values` back to UTC
+template <typename Res>
+Status FromLocal(const ArrayData& in, ZoneOffsets* zone, typename Res::CType* values) {
+  using CType = typename Res::CType;
+  OptionalBitIndexer is_valid(in.buffers[0], in.offset);
+  for (int64_t i = 0; i < in.length; ++i) {
+    if (!is_valid[i]) continue;
+    const int64_t seconds = FloorDiv<int64_t>(values[i], Res::kUnitsPerSecond);
+    const int64_t subseconds = values[i] - seconds * Res::kUnitsPerSecond;
+    const int64_t utc_seconds = zone->ToUtc(seconds);
+    int64_t utc;
+    if (ARROW_PREDICT_FALSE(
+            MultiplyWithOverflow(utc_seconds, Res::kUnitsPerSecond, &utc) ||
+            AddWithOverflow(utc, subseconds, &utc))) {
+      return Status::Invalid("Local time ", values[i],
+                             " overflows when converted to UTC");
+    }
+    values[i] = static_cast<CType>(utc);
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Component extraction
+
+struct YearOp {
+  template <typename Res>
+  static int64_t Call(int32_t days, int64_t) {
+    return CivilFromDays(days).year;
+  }
+};
+
+struct MonthOp {
+  template <typename Res>
+  static int64_t Call(int32_t days, int64_t) {
+    return CivilFromDays(days).month;
+  }
+};
+
+struct DayOp {
+  template <typename Res>
+  static int64_t Call(int32_t days, int64_t) {
+    return CivilFromDays(days).day;
+  }
+};
+
+struct DayOfWeekOp {
+  // 1970-01-01 was a Thursday
+  template <typename Res>
+  static int64_t Call(int32_t days, int64_t) {
+    return (days % 7 + 10) % 7;
+  }
+};
+
+struct HourOp {
+  template <typename Res>
+  static int64_t Call(int32_t, int64_t time_of_day) {
+    return time_of_day / (kSecondsPerHour * Res::kUnitsPerSecond);
+  }
+};
+
+struct MinuteOp {
+  template <typename Res>
+  static int64_t Call(int32_t, int64_t time_of_day) {
+    return time_of_day / (kSecondsPerMinute * Res::kUnitsPerSecond) % 60;
+  }
+};
+
+template <typename Op, typename Res>
+bool ExtractLoop(const typename Res::CType* values, int64_t length, int64_t* out) {
+  bool out_of_range = false;
+  for (int64_t i = 0; i < length; ++i) {
+    int64_t time_of_day;
+    const int32_t days = SplitDays<Res>(values[i], &time_of_day, &out_of_range);
+    out[i] = Op::template Call<Res>(days, time_of_day);
+  }
+  return out_of_range;
+}
+
+// ----------------------------------------------------------------------
+// Truncation
+
+template <typename Res>
+bool TruncateLoop(const typename Res::CType* values, int64_t length,
+                  TruncateOptions::Unit unit, typename Res::CType* out) {
+  using CType = typename Res::CType;
+  bool out_of_range = false;
+  switch (unit) {
+    case TruncateOptions::YEAR:
+    case TruncateOptions::MONTH: {
+      const uint32_t year_mask = unit == TruncateOptions::YEAR ? 0 : 0xffffffff;
+      for (int64_t i = 0; i < length; ++i) {
+        int64_t time_of_day;
+        const CivilDate ymd =
+            CivilFromDays(SplitDays<Res>(values[i], &time_of_day, &out_of_range));
+        // January when truncating to the year, the same month otherwise
+        const uint32_t month = (ymd.month & year_mask) | (1 & ~year_mask);
+        const int64_t days = DaysFromCivil(ymd.year, month, 1);
+        out_of_range |= days < Res::kMinDays;
+        // Multiply unsigned to wrap rather than overflow the discarded results
+        out[i] = static_cast<CType>(static_cast<uint64_t>(days) *
+                                    static_cast<uint64_t>(Res::kUnitsPerDay));
+      }
+      break;
+    }
+    case TruncateOptions::DAY:
+    case TruncateOptions::HOUR:
+    case TruncateOptions::MINUTE:
+    case TruncateOptions::SECOND: {
+      static const int64_t kUnitSeconds[] = {kSecondsPerDay, kSecondsPerHour,
+                                             kSecondsPerMinute, 1};
+      const CType unit_length = static_cast<CType>(
+          SubDayUnitLength<Res>(kUnitSeconds[unit - TruncateOptions::DAY]));
+      const CType min_value = std::numeric_limits<CType>::min();
+      for (int64_t i = 0; i < length; ++i) {
+        const CType floor = FloorDiv<CType>(values[i], unit_length);
+        out_of_range |= floor < min_value / unit_length;
+        out[i] = static_cast<CType>(static_cast<typename std::make_unsigned<CType>::type>(
+                                        floor) *
+                                    static_cast<typename std::make_unsigned<CType>::type>(
+                                        unit_length));
+      }
+      break;
+    }
+  }
+  return out_of_range;
+}
+
+// ----------------------------------------------------------------------
+// Kernel implementations
+
+// Reruns a vectorized loop value by value over the valid slots of a batch for
+// which it reported an out of range value, to see whether any valid value
+// actually is
+template <typename CType, typename Loop>
+Status CheckValidInRange(const ArrayData& in, const CType* values, Loop&& loop) {
+  OptionalBitIndexer is_valid(in.buffers[0], in.offset);
+  for (int64_t i = 0; i < in.length; ++i) {
+    if (is_valid[i] && loop(values + i)) {
+      return Status::Invalid("Temporal value ", values[i],
+                             " is out of the supported range");
+    }
+  }
+  return Status::OK();
+}
+
+template <typename Op>
+struct ExtractVisitor {
+  KernelContext* ctx;
+  const ArrayData& in;
+  ArrayData* out;
+
+  template <typename Res>
+  Status Visit() {
+    using CType = typename Res::CType;
+    const CType* values = in.GetValues<CType>(1);
+    int64_t* out_values = out->GetMutableValues<int64_t>(1);
+
+    std::shared_ptr<Buffer> local;
+    if (const std::string* timezone = GetTimezone(*in.type)) {
+      ARROW_ASSIGN_OR_RAISE(auto zone, ZoneOffsets::Make(*timezone));
+      ARROW_ASSIGN_OR_RAISE(local, ctx->Allocate(in.length * sizeof(CType)));
+      CType* local_values = reinterpret_cast<CType*>(local->mutable_data());
+      RETURN_NOT_OK(ToLocal<Res>(in, &zone, local_values));
+      values = local_values;
+    }
+
+    if (ARROW_PREDICT_FALSE((ExtractLoop<Op, Res>(values, in.length, out_values)))) {
+      int64_t unused;
+      return CheckValidInRange(in, values, [&](const CType* value) {
+        return ExtractLoop<Op, Res>(value, 1, &unused);
+      });
+    }
+    return Status::OK();
+  }
+};
+
+struct TruncateVisitor {
+  KernelContext* ctx;
+  const ArrayData& in;
+  ArrayData* out;
+  TruncateOptions::Unit unit;
+
+  template <typename Res>
+  Status Visit() {
+    using CType = typename Res::CType;
+    const CType* values = in.GetValues<CType>(1);
+    CType* out_values = out->GetMutableValues<CType>(1);
+
+    // Zoned timestamps are truncated in local time
+    std::shared_ptr<Buffer> local;
+    util::optional<ZoneOffsets> zone;
+    if (const std::string* timezone = GetTimezone(*in.type)) {
+      ARROW_ASSIGN_OR_RAISE(zone, ZoneOffsets::Make(*timezone));
+      ARROW_ASSIGN_OR_RAISE(local, ctx->Allocate(in.length * sizeof(CType)));
+      CType* local_values = reinterpret_cast<CType*>(local->mutable_data());
+      RETURN_NOT_OK(ToLocal<Res>(in, &*zone, local_values));
+      values = local_values;
+    }
+
+    if (ARROW_PREDICT_FALSE(TruncateLoop<Res>(values, in.length, unit, out_values))) {
+      CType unused;
+      RETURN_NOT_OK(CheckValidInRange(in, values, [&](const CType* value) {
+        return TruncateLoop<Res>(value, 1, unit, &unused);
+      }));
+    }
+
+    if (zone.has_value()) {
+      RETURN_NOT_OK(FromLocal<Res>(in, &*zone, out_values));
+    }
+    return Status::OK();
+  }
+};
+
+// Runs `visitor_factory(input, output)` over the array or scalar input
+template <typename MakeVisitor>
+void TemporalExec(KernelContext* ctx, const ExecBatch& batch, Datum* out,
+                  MakeVisitor&& make_visitor) {
+  if (batch[0].kind() == Datum::ARRAY) {
+    const ArrayData& in = *batch[0].array();
+    auto visitor = make_visitor(in, out->mutable_array());
+    KERNEL_RETURN_IF_ERROR(ctx, VisitResolution(*in.type, &visitor));
+    return;
+  }
+
+  const Scalar& in_scalar = *batch[0].scalar();
+  if (!in_scalar.is_valid) {
+    return;
+  }
+  KERNEL_ASSIGN_OR_RAISE(auto in_array, ctx, MakeArrayFromScalar(in_scalar, 1));
+  const auto& out_type = out->scalar()->type;
+  ArrayData out_data(out_type, 1, {nullptr, nullptr}, /*null_count=*/0);
+  KERNEL_ASSIGN_OR_RAISE(
+      out_data.buffers[1], ctx,
+      ctx->Allocate(checked_cast<const FixedWidthType&>(*out_type).bit_width() / 8));
+  auto visitor = make_visitor(*in_array->data(), &out_data);
+  KERNEL_RETURN_IF_ERROR(ctx, VisitResolution(*in_array->type(), &visitor));
+  KERNEL_ASSIGN_OR_RAISE(*out, ctx, MakeArray(std::make_shared<ArrayData>(out_data))
+                                        ->GetScalar(0));
+}
+
+template <typename Op>
+void ExtractExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  TemporalExec(ctx, batch, out, [&](const ArrayData& in, ArrayData* out_data) {
+    return ExtractVisitor<Op>{ctx, in, out_data};
+  });
+}
+
+void TruncateExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  const auto unit = TruncateState::Get(ctx).unit;
+  TemporalExec(ctx, batch, out, [&](const ArrayData& in, ArrayData* out_data) {
+    return TruncateVisitor{ctx, in, out_data, unit};
+  });
+}
+
+template <typename Op>
+void AddExtractFunction(std::string name, bool dates, FunctionRegistry* registry) {
+  auto func = std::make_shared<ScalarFunction>(std::move(name), Arity::Unary());
+  DCHECK_OK(func->AddKernel({InputType(Type::TIMESTAMP)}, int64(), ExtractExec<Op>));
+  if (dates) {
+    DCHECK_OK(func->AddKernel({InputType(Type::DATE32)}, int64(), ExtractExec<Op>));
+    DCHECK_OK(func->AddKernel({InputType(Type::DATE64)}, int64(), ExtractExec<Op>));
+  }
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+}
+
+void AddTruncate(FunctionRegistry* registry) {
+  static auto default_options = TruncateOptions::Defaults();
+  auto func = std::make_shared<ScalarFunction>("truncate_to_unit", Arity::Unary(),
+                                               &default_options);
+  for (auto id : {Type::TIMESTAMP, Type::DATE32, Type::DATE64}) {
+    DCHECK_OK(func->AddKernel({InputType(id)}, OutputType(FirstType), TruncateExec,
+                              TruncateState::Init));
+  }
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+}
+
+}  // namespace
+
+void RegisterScalarTemporal(FunctionRegistry* registry) {
+  AddExtractFunction<YearOp>("year", /*dates=*/true, registry);
+  AddExtractFunction<MonthOp>("month", /*dates=*/true, registry);
+  AddExtractFunction<DayOp>("day", /*dates=*/true, registry);
+  AddExtractFunction<DayOfWeekOp>("day_of_week", /*dates=*/true, registry);
+  AddExtractFunction<HourOp>("hour", /*dates=*/false, registry);
+  AddExtractFunction<MinuteOp>("minute", /*dates=*/false, registry);
+  AddTruncate(registry);
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,130 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+class TestTemporalKernels : public ::testing::Test {
+ protected:
+  const char* times_ =
+      R"(["1970-01-01T00:00:59", "2000-02-29T23:23:23", "1899-01-01T00:59:20",
+          "2033-05-18T03:33:20", null])";
+};
+
+TEST_F(TestTemporalKernels, ExtractTimestamp) {
+  for (auto unit : {TimeUnit::SECOND, TimeUnit::MILLI, TimeUnit::MICRO, TimeUnit::NANO}) {
+    auto type = timestamp(unit);
+    CheckScalarUnary("year", type, times_, int64(), "[1970, 2000, 1899, 2033, null]");
+    CheckScalarUnary("month", type, times_, int64(), "[1, 2, 1, 5, null]");
+    CheckScalarUnary("day", type, times_, int64(), "[1, 29, 1, 18, null]");
+    CheckScalarUnary("day_of_week", type, times_, int64(), "[3, 1, 6, 2, null]");
+    CheckScalarUnary("hour", type, times_, int64(), "[0, 23, 0, 3, null]");
+    CheckScalarUnary("minute", type, times_, int64(), "[0, 23, 59, 33, null]");
+  }
+}
+
+TEST_F(TestTemporalKernels, ExtractDate) {
+  const char* days = "[0, -1, 11016, null]";
+  const char* millis = "[0, -86400000, 951782400000, null]";
+  for (const auto& input : {ArrayFromJSON(date32(), days),
+                             ArrayFromJSON(date64(), millis)}) {
+    CheckScalarUnary("year", input, ArrayFromJSON(int64(), "[1970, 1969, 2000, null]"));
+    CheckScalarUnary("month", input, ArrayFromJSON(int64(), "[1, 12, 2, null]"));
+    CheckScalarUnary("day", input, ArrayFromJSON(int64(), "[1, 31, 29, null]"));
+    CheckScalarUnary("day_of_week", input, ArrayFromJSON(int64(), "[3, 2, 1, null]"));
+  }
+  ASSERT_RAISES(NotImplemented, Hour(ArrayFromJSON(date32(), days)));
+}
+
+TEST_F(TestTemporalKernels, ExtractZoned) {
+  auto type = timestamp(TimeUnit::SECOND, "+05:30");
+  CheckScalarUnary("day", type, times_, int64(), "[1, 1, 1, 18, null]");
+  CheckScalarUnary("month", type, times_, int64(), "[1, 3, 1, 5, null]");
+  CheckScalarUnary("hour", type, times_, int64(), "[5, 4, 6, 9, null]");
+  CheckScalarUnary("minute", type, times_, int64(), "[30, 53, 29, 3, null]");
+
+  // Either side of the 2021 switch to daylight saving time
+  type = timestamp(TimeUnit::MILLI, "America/New_York");
+  const char* dst = R"(["2021-03-14T06:59:59", "2021-03-14T07:00:00", null])";
+  CheckScalarUnary("hour", type, dst, int64(), "[1, 3, null]");
+  CheckScalarUnary("day", type, dst, int64(), "[14, 14, null]");
+
+  ASSERT_RAISES(Invalid, Year(ArrayFromJSON(timestamp(TimeUnit::SECOND, "Mars/Olympus"),
+                                            "[0]")));
+}
+
+TEST_F(TestTemporalKernels, Truncate) {
+  auto type = timestamp(TimeUnit::MICRO);
+  TruncateOptions options(TruncateOptions::YEAR);
+  CheckScalarUnary("truncate_to_unit", type, times_, type,
+                   R"(["1970-01-01", "2000-01-01", "1899-01-01", "2033-01-01", null])",
+                   &options);
+  options.unit = TruncateOptions::MONTH;
+  CheckScalarUnary("truncate_to_unit", type, times_, type,
+                   R"(["1970-01-01", "2000-02-01", "1899-01-01", "2033-05-01", null])",
+                   &options);
+  options.unit = TruncateOptions::DAY;
+  CheckScalarUnary("truncate_to_unit", type, times_, type,
+                   R"(["1970-01-01", "2000-02-29", "1899-01-01", "2033-05-18", null])",
+                   &options);
+  options.unit = TruncateOptions::HOUR;
+  CheckScalarUnary("truncate_to_unit", type, times_, type,
+                   R"(["1970-01-01T00:00:00", "2000-02-29T23:00:00",
+                       "1899-01-01T00:00:00", "2033-05-18T03:00:00", null])",
+                   &options);
+  options.unit = TruncateOptions::MINUTE;
+  CheckScalarUnary("truncate_to_unit", type, times_, type,
+                   R"(["1970-01-01T00:00:00", "2000-02-29T23:23:00",
+                       "1899-01-01T00:59:00", "2033-05-18T03:33:00", null])",
+                   &options);
+
+  options.unit = TruncateOptions::MONTH;
+  CheckScalarUnary("truncate_to_unit", date32(), "[0, -1, 11016, null]", date32(),
+                   "[0, -31, 10988, null]", &options);
+  // Dates have no time of day to truncate
+  options.unit = TruncateOptions::HOUR;
+  CheckScalarUnary("truncate_to_unit", date32(), "[0, -1, 11016, null]", date32(),
+                   "[0, -1, 11016, null]", &options);
+}
+
+TEST_F(TestTemporalKernels, TruncateZoned) {
+  // Truncation happens in local time, the result is the matching UTC instant
+  auto type = timestamp(TimeUnit::SECOND, "+05:30");
+  TruncateOptions options(TruncateOptions::DAY);
+  CheckScalarUnary("truncate_to_unit", type, times_, type,
+                   R"(["1969-12-31T18:30:00", "2000-02-29T18:30:00",
+                       "1898-12-31T18:30:00", "2033-05-17T18:30:00", null])",
+                   &options);
+
+  type = timestamp(TimeUnit::SECOND, "America/New_York");
+  const char* dst = R"(["2021-03-14T06:59:59", "2021-03-14T07:00:00", null])";
+  CheckScalarUnary("truncate_to_unit", type, dst, type,
+                   R"(["2021-03-14T05:00:00", "2021-03-14T05:00:00", null])", &options);
+  options.unit = TruncateOptions::HOUR;
+  CheckScalarUnary("truncate_to_unit", type, dst, type,
+                   R"(["2021-03-14T06:00:00", "2021-03-14T07:00:00", null])", &options);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -15,20 +15,33 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstring>
+#include <functional>
+#include <limits>
 #include <mutex>
+#include <numeric>
+#include <queue>
+#include <utility>
+#include <vector>
 
 #include "arrow/array/array_base.h"
 #include "arrow/array/array_dict.h"
 #include "arrow/array/array_nested.h"
 #include "arrow/array/builder_primitive.h"
 #include "arrow/array/dict_internal.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/array/util.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/common.h"
+#include "arrow/compute/kernels/scalar_hash_internal.h"
 #include "arrow/result.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -228,8 +241,29 @@ class HashKernel : public KernelState {
   // data structures) and visit the given input with Action.
   virtual Status Append(const ArrayData& arr) = 0;
 
+  // Large inputs may be hashed in parallel by the finalizer, in which case
+  // HashExec only buffers them (see HashDeferred)
+  void EnableDeferral(bool preserve_order) {
+    can_defer_ = true;
+    preserve_order_ = preserve_order;
+  }
+
+  bool can_defer() const { return can_defer_; }
+
+  bool preserve_order() const { return preserve_order_; }
+
+  void Defer(std::shared_ptr<ArrayData> arr) {
+    std::lock_guard<std::mutex> guard(lock_);
+    deferred_.push_back(std::move(arr));
+  }
+
+  const ArrayDataVector& deferred() const { return deferred_; }
+
  protected:
   std::mutex lock_;
+  bool can_defer_ = false;
+  bool preserve_order_ = true;
+  ArrayDataVector deferred_;
 };
 
 // ----------------------------------------------------------------------
@@ -459,7 +493,14 @@ std::unique_ptr<HashKernel> HashInitImpl(KernelContext* ctx, const KernelInitArg
 
 template <typename Type, typename Action>
 std::unique_ptr<KernelState> HashInit(KernelContext* ctx, const KernelInitArgs& args) {
-  return std::move(HashInitImpl<Type, Action>(ctx, args));
+  auto result = HashInitImpl<Type, Action>(ctx, args);
+  if (!is_null_type<Type>::value) {
+    const bool preserve_order =
+        args.options == nullptr ||
+        checked_cast<const HashOptions&>(*args.options).preserve_order;
+    result->EnableDeferral(preserve_order);
+  }
+  return std::move(result);
 }
 
 template <typename Action>
@@ -531,23 +572,405 @@ std::unique_ptr<KernelState> DictionaryHashInit(KernelContext* ctx,
   return ::arrow::internal::make_unique<DictionaryHashKernel>(std::move(indices_hasher));
 }
 
+// ----------------------------------------------------------------------
+// Parallel hashing of large inputs
+//
+// When threads are allowed, HashExec only buffers the input of "regular"
+// kernels, which the finalizer hashes in one go.  Inputs of at least
+// kMinParallelHashLength values are hashed by partitions: each morsel of the
+// input is radix-partitioned on its hashes, so that equal values fall in the
+// same partition, then each partition is dictionary-encoded on its own thread
+// and the partition dictionaries are concatenated.  With preserve_order, the
+// unique values are then sorted by first occurrence, which gives the same
+// output as serial hashing.  Smaller inputs are appended to the kernel serially.
+
+constexpr int64_t kMinParallelHashLength = 1 << 20;
+constexpr int64_t kHashMorselLength = 1 << 18;
+constexpr int kMaxHashPartitions = 256;
+
+struct PartitionedHashResult {
+  // The unique values, including null if requested and found
+  std::shared_ptr<ArrayData> uniques;
+  // The number of occurrences of each unique value
+  std::shared_ptr<ArrayData> counts;
+  // The index in `uniques` of each value of each input
+  ArrayDataVector indices;
+};
+
+class PartitionedHasher {
+ public:
+  PartitionedHasher(KernelContext* ctx, const std::shared_ptr<DataType>& type,
+                    const ArrayDataVector& inputs, bool preserve_order, bool with_null,
+                    bool with_indices)
+      : pool_(ctx->memory_pool()),
+        serial_ctx_(ctx->memory_pool(), ctx->exec_context()->func_registry()),
+        type_(type),
+        inputs_(inputs),
+        preserve_order_(preserve_order),
+        with_null_(with_null),
+        with_indices_(with_indices) {
+    serial_ctx_.set_use_threads(false);
+    // A few partitions per thread, for load balancing
+    num_partitions_ = static_cast<int>(std::min<int64_t>(
+        BitUtil::NextPower2(4 * GetCpuThreadPoolCapacity()), kMaxHashPartitions));
+    num_partitions_ = std::max(num_partitions_, 2);
+  }
+
+  Status Run(PartitionedHashResult* out) {
+    RETURN_NOT_OK(MakeMorsels());
+    const int num_morsels = static_cast<int>(morsels_.size());
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(
+        num_morsels, [this](int i) { return PartitionMorsel(i); }));
+    partitions_.resize(num_partitions_);
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(
+        num_partitions_, [this](int p) { return EncodePartition(p); }));
+    RETURN_NOT_OK(Merge(out));
+    if (with_indices_) {
+      RETURN_NOT_OK(::arrow::internal::ParallelFor(
+          num_morsels, [this](int i) { return RemapMorsel(i); }));
+      for (size_t i = 0; i < inputs_.size(); ++i) {
+        const ArrayData& input = *inputs_[i];
+        std::shared_ptr<Buffer> validity;
+        if (input.GetNullCount() > 0) {
+          ARROW_ASSIGN_OR_RAISE(
+              validity, ::arrow::internal::CopyBitmap(pool_, input.buffers[0]->data(),
+                                                      input.offset, input.length));
+        }
+        out->indices.push_back(ArrayData::Make(
+            int32(), input.length, {std::move(validity), indices_[i]}, input.null_count));
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  struct Morsel {
+    size_t input;
+    // The offset of the morsel in its input, and in the concatenated inputs
+    int64_t offset;
+    int64_t position;
+    std::shared_ptr<Array> values;
+    // The rows of the morsel in each partition
+    std::vector<std::vector<int32_t>> rows;
+  };
+
+  struct Partition {
+    std::shared_ptr<ArrayData> dictionary;
+    // The count and first position of each dictionary value, which are in order
+    // of first occurrence
+    std::vector<int64_t> counts;
+    std::vector<int64_t> first_positions;
+    int64_t null_count = 0;
+    int64_t first_null_position = 0;
+  };
+
+  Status MakeMorsels() {
+    int64_t position = 0;
+    for (size_t i = 0; i < inputs_.size(); ++i) {
+      const ArrayData& input = *inputs_[i];
+      for (int64_t offset = 0; offset < input.length; offset += kHashMorselLength) {
+        const int64_t length = std::min(kHashMorselLength, input.length - offset);
+        Morsel morsel;
+        morsel.input = i;
+        morsel.offset = offset;
+        morsel.position = position + offset;
+        morsel.values = MakeArray(input.Slice(offset, length));
+        morsels_.push_back(std::move(morsel));
+      }
+      position += input.length;
+      if (with_indices_) {
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> indices,
+                              AllocateBuffer(input.length * sizeof(int32_t), pool_));
+        indices_.push_back(std::move(indices));
+        partition_ids_.emplace_back(input.length);
+      }
+    }
+    return Status::OK();
+  }
+
+  Status PartitionMorsel(int i) {
+    Morsel& morsel = morsels_[i];
+    const ArrayData& data = *morsel.values->data();
+    std::vector<uint64_t> hashes(data.length);
+    RETURN_NOT_OK(HashArray(ArraySpan(data), hashes.data()));
+    // The low bits of the hashes are the best mixed ones
+    const uint64_t mask = num_partitions_ - 1;
+    uint8_t* partition_ids =
+        with_indices_ ? partition_ids_[morsel.input].data() + morsel.offset : nullptr;
+    morsel.rows.resize(num_partitions_);
+    for (int32_t j = 0; j < static_cast<int32_t>(data.length); ++j) {
+      const auto partition = static_cast<uint8_t>(hashes[j] & mask);
+      morsel.rows[partition].push_back(j);
+      if (partition_ids) {
+        partition_ids[j] = partition;
+      }
+    }
+    return Status::OK();
+  }
+
+  Status EncodePartition(int p) {
+    ArrayVector values;
+    std::vector<const Morsel*> value_morsels;
+    for (const auto& morsel : morsels_) {
+      const auto& rows = morsel.rows[p];
+      if (rows.empty()) {
+        continue;
+      }
+      auto indices = std::make_shared<Int32Array>(static_cast<int64_t>(rows.size()),
+                                                  Buffer::Wrap(rows));
+      ARROW_ASSIGN_OR_RAISE(
+          Datum taken,
+          Take(morsel.values, indices, TakeOptions::NoBoundsCheck(), &serial_ctx_));
+      values.push_back(taken.make_array());
+      value_morsels.push_back(&morsel);
+    }
+    if (values.empty()) {
+      return Status::OK();
+    }
+
+    ARROW_ASSIGN_OR_RAISE(
+        Datum encoded,
+        DictionaryEncode(std::make_shared<ChunkedArray>(values, type_), &serial_ctx_));
+    const ChunkedArray& chunks = *encoded.chunked_array();
+    Partition& partition = partitions_[p];
+    partition.dictionary =
+        checked_cast<const DictionaryArray&>(*chunks.chunk(0)).dictionary()->data();
+    partition.counts.resize(partition.dictionary->length, 0);
+    partition.first_positions.resize(partition.dictionary->length);
+
+    for (int k = 0; k < chunks.num_chunks(); ++k) {
+      const auto& indices = checked_cast<const Int32Array&>(
+          *checked_cast<const DictionaryArray&>(*chunks.chunk(k)).indices());
+      const Morsel& morsel = *value_morsels[k];
+      const auto& rows = morsel.rows[p];
+      int32_t* local_indices = with_indices_ ? MutableIndices(morsel) : nullptr;
+      for (int64_t j = 0; j < indices.length(); ++j) {
+        const int64_t position = morsel.position + rows[j];
+        int32_t index = -1;
+        if (indices.IsNull(j)) {
+          if (partition.null_count++ == 0) {
+            partition.first_null_position = position;
+          }
+        } else {
+          index = indices.Value(j);
+          if (partition.counts[index]++ == 0) {
+            partition.first_positions[index] = position;
+          }
+        }
+        if (local_indices) {
+          local_indices[rows[j]] = index;
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Merge(PartitionedHashResult* out) {
+    // The dictionaries are concatenated in partition order, followed by null
+    ArrayVector dictionaries;
+    dictionary_offsets_.resize(num_partitions_);
+    int64_t num_values = 0;
+    int64_t null_count = 0;
+    int64_t first_null_position = std::numeric_limits<int64_t>::max();
+    for (int p = 0; p < num_partitions_; ++p) {
+      const Partition& partition = partitions_[p];
+      dictionary_offsets_[p] = num_values;
+      if (partition.dictionary) {
+        dictionaries.push_back(MakeArray(partition.dictionary));
+        num_values += partition.dictionary->length;
+      }
+      if (partition.null_count > 0) {
+        null_count += partition.null_count;
+        first_null_position =
+            std::min(first_null_position, partition.first_null_position);
+      }
+    }
+    if (num_values > std::numeric_limits<int32_t>::max()) {
+      return Status::CapacityError("Too many unique values to hash: ", num_values);
+    }
+    const bool emit_null = with_null_ && null_count > 0;
+    const int64_t num_uniques = num_values + (emit_null ? 1 : 0);
+    if (emit_null) {
+      ARROW_ASSIGN_OR_RAISE(auto nulls, MakeArrayOfNull(type_, 1, pool_));
+      dictionaries.push_back(std::move(nulls));
+    }
+
+    // The output index of each value of the concatenated dictionaries
+    remap_.resize(num_uniques);
+    if (preserve_order_) {
+      // Merge the partitions by first position, with `num_partitions_` standing
+      // for null
+      using Entry = std::pair<int64_t, int>;
+      std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+      std::vector<int64_t> cursors(num_partitions_, 0);
+      for (int p = 0; p < num_partitions_; ++p) {
+        if (!partitions_[p].counts.empty()) {
+          heap.emplace(partitions_[p].first_positions[0], p);
+        }
+      }
+      if (emit_null) {
+        heap.emplace(first_null_position, num_partitions_);
+      }
+      int32_t next_index = 0;
+      while (!heap.empty()) {
+        const int p = heap.top().second;
+        heap.pop();
+        if (p == num_partitions_) {
+          remap_[num_values] = next_index++;
+          continue;
+        }
+        const Partition& partition = partitions_[p];
+        const int64_t j = cursors[p]++;
+        remap_[dictionary_offsets_[p] + j] = next_index++;
+        if (j + 1 < static_cast<int64_t>(partition.counts.size())) {
+          heap.emplace(partition.first_positions[j + 1], p);
+        }
+      }
+    } else {
+      std::iota(remap_.begin(), remap_.end(), 0);
+    }
+
+    std::shared_ptr<Array> uniques;
+    if (dictionaries.empty()) {
+      // All values are null
+      ARROW_ASSIGN_OR_RAISE(uniques, MakeArrayOfNull(type_, 0, pool_));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(uniques, Concatenate(dictionaries, pool_));
+    }
+    if (preserve_order_) {
+      std::vector<int32_t> permutation(num_uniques);
+      for (int64_t k = 0; k < num_uniques; ++k) {
+        permutation[remap_[k]] = static_cast<int32_t>(k);
+      }
+      auto indices = std::make_shared<Int32Array>(num_uniques, Buffer::Wrap(permutation));
+      ARROW_ASSIGN_OR_RAISE(
+          Datum sorted,
+          Take(uniques, indices, TakeOptions::NoBoundsCheck(), &serial_ctx_));
+      uniques = sorted.make_array();
+    }
+    out->uniques = uniques->data();
+
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> counts_buffer,
+                          AllocateBuffer(num_uniques * sizeof(int64_t), pool_));
+    auto counts = reinterpret_cast<int64_t*>(counts_buffer->mutable_data());
+    for (int p = 0; p < num_partitions_; ++p) {
+      const Partition& partition = partitions_[p];
+      for (size_t j = 0; j < partition.counts.size(); ++j) {
+        counts[remap_[dictionary_offsets_[p] + j]] = partition.counts[j];
+      }
+    }
+    if (emit_null) {
+      counts[remap_[num_values]] = null_count;
+    }
+    out->counts = ArrayData::Make(int64(), num_uniques,
+                                  {nullptr, std::move(counts_buffer)}, /*null_count=*/0);
+    return Status::OK();
+  }
+
+  int32_t* MutableIndices(const Morsel& morsel) {
+    return reinterpret_cast<int32_t*>(indices_[morsel.input]->mutable_data()) +
+           morsel.offset;
+  }
+
+  Status RemapMorsel(int i) {
+    const Morsel& morsel = morsels_[i];
+    int32_t* indices = MutableIndices(morsel);
+    const uint8_t* partition_ids = partition_ids_[morsel.input].data() + morsel.offset;
+    for (int64_t j = 0; j < morsel.values->length(); ++j) {
+      // Null slots have a negative local index
+      indices[j] = indices[j] < 0
+                       ? 0
+                       : remap_[dictionary_offsets_[partition_ids[j]] + indices[j]];
+    }
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  // For the kernels run within a thread
+  ExecContext serial_ctx_;
+  std::shared_ptr<DataType> type_;
+  const ArrayDataVector& inputs_;
+  const bool preserve_order_;
+  const bool with_null_;
+  const bool with_indices_;
+  int num_partitions_;
+
+  std::vector<Morsel> morsels_;
+  std::vector<Partition> partitions_;
+  std::vector<int64_t> dictionary_offsets_;
+  std::vector<int32_t> remap_;
+  // The local, then final, indices of each input, and their partitions
+  std::vector<std::shared_ptr<Buffer>> indices_;
+  std::vector<std::vector<uint8_t>> partition_ids_;
+};
+
+// Hash the inputs buffered by HashExec, setting each element of `out` to the
+// result for the corresponding input.  If the inputs are large enough to be
+// hashed by partitions, `*partitioned` is set to the result and the kernel
+// state is left untouched.
+Status HashDeferred(KernelContext* ctx, HashKernel* hash_impl, bool with_null,
+                    bool with_indices, std::vector<Datum>* out,
+                    std::unique_ptr<PartitionedHashResult>* partitioned) {
+  const ArrayDataVector& inputs = hash_impl->deferred();
+  DCHECK_EQ(inputs.size(), out->size());
+  int64_t total_length = 0;
+  for (const auto& input : inputs) {
+    total_length += input->length;
+  }
+  if (total_length < kMinParallelHashLength || GetCpuThreadPoolCapacity() < 2) {
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      RETURN_NOT_OK(hash_impl->Append(*inputs[i]));
+      RETURN_NOT_OK(hash_impl->Flush(&(*out)[i]));
+    }
+    return Status::OK();
+  }
+  auto result = ::arrow::internal::make_unique<PartitionedHashResult>();
+  PartitionedHasher hasher(ctx, hash_impl->value_type(), inputs,
+                           hash_impl->preserve_order(), with_null, with_indices);
+  RETURN_NOT_OK(hasher.Run(result.get()));
+  for (size_t i = 0; i < result->indices.size(); ++i) {
+    (*out)[i] = result->indices[i];
+  }
+  *partitioned = std::move(result);
+  return Status::OK();
+}
+
 void HashExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
   auto hash_impl = checked_cast<HashKernel*>(ctx->state());
+  if (hash_impl->can_defer() && ctx->exec_context()->use_threads()) {
+    // Hashed by the finalizer, possibly in parallel
+    hash_impl->Defer(batch[0].array());
+    return;
+  }
   KERNEL_RETURN_IF_ERROR(ctx, hash_impl->Append(ctx, *batch[0].array()));
   KERNEL_RETURN_IF_ERROR(ctx, hash_impl->Flush(out));
 }
 
 void UniqueFinalize(KernelContext* ctx, std::vector<Datum>* out) {
   auto hash_impl = checked_cast<HashKernel*>(ctx->state());
+  std::unique_ptr<PartitionedHashResult> partitioned;
+  KERNEL_RETURN_IF_ERROR(ctx, HashDeferred(ctx, hash_impl, /*with_null=*/true,
+                                           /*with_indices=*/false, out, &partitioned));
   std::shared_ptr<ArrayData> uniques;
-  KERNEL_RETURN_IF_ERROR(ctx, hash_impl->GetDictionary(&uniques));
+  if (partitioned) {
+    uniques = partitioned->uniques;
+  } else {
+    KERNEL_RETURN_IF_ERROR(ctx, hash_impl->GetDictionary(&uniques));
+  }
   *out = {Datum(uniques)};
 }
 
 void DictEncodeFinalize(KernelContext* ctx, std::vector<Datum>* out) {
   auto hash_impl = checked_cast<HashKernel*>(ctx->state());
+  std::unique_ptr<PartitionedHashResult> partitioned;
+  KERNEL_RETURN_IF_ERROR(ctx, HashDeferred(ctx, hash_impl, /*with_null=*/false,
+                                           /*with_indices=*/true, out, &partitioned));
   std::shared_ptr<ArrayData> uniques;
-  KERNEL_RETURN_IF_ERROR(ctx, hash_impl->GetDictionary(&uniques));
+  if (partitioned) {
+    uniques = partitioned->uniques;
+  } else {
+    KERNEL_RETURN_IF_ERROR(ctx, hash_impl->GetDictionary(&uniques));
+  }
   auto dict_type = dictionary(int32(), uniques->type);
   auto dict = MakeArray(uniques);
   for (size_t i = 0; i < out->size(); ++i) {
@@ -566,11 +989,19 @@ std::shared_ptr<ArrayData> BoxValueCounts(const std::shared_ptr<ArrayData>& uniq
 
 void ValueCountsFinalize(KernelContext* ctx, std::vector<Datum>* out) {
   auto hash_impl = checked_cast<HashKernel*>(ctx->state());
+  std::unique_ptr<PartitionedHashResult> partitioned;
+  KERNEL_RETURN_IF_ERROR(ctx, HashDeferred(ctx, hash_impl, /*with_null=*/true,
+                                           /*with_indices=*/false, out, &partitioned));
   std::shared_ptr<ArrayData> uniques;
   Datum value_counts;
 
-  KERNEL_RETURN_IF_ERROR(ctx, hash_impl->GetDictionary(&uniques));
-  KERNEL_RETURN_IF_ERROR(ctx, hash_impl->FlushFinal(&value_counts));
+  if (partitioned) {
+    uniques = partitioned->uniques;
+    value_counts = partitioned->counts;
+  } else {
+    KERNEL_RETURN_IF_ERROR(ctx, hash_impl->GetDictionary(&uniques));
+    KERNEL_RETURN_IF_ERROR(ctx, hash_impl->FlushFinal(&value_counts));
+  }
   *out = {Datum(BoxValueCounts(uniques, value_counts.array()))};
 }
 
@@ -624,6 +1055,8 @@ void AddHashKernels(VectorFunction* func, VectorKernel base, OutputType out_ty)
   DCHECK_OK(func->AddKernel(base));
 }
 
+const auto kDefaultHashOptions = HashOptions::Defaults();
+
 }  // namespace
 
 void RegisterVectorHash(FunctionRegistry* registry) {
@@ -635,7 +1068,8 @@ void RegisterVectorHash(FunctionRegistry* registry) {
 
   base.finalize = UniqueFinalize;
   base.output_chunked = false;
-  auto unique = std::make_shared<VectorFunction>("unique", Arity::Unary());
+  auto unique = std::make_shared<VectorFunction>("unique", Arity::Unary(),
+                                                 &kDefaultHashOptions);
   AddHashKernels<UniqueAction>(unique.get(), base, OutputType(FirstType));
 
   // Dictionary unique
@@ -651,7 +1085,8 @@ void RegisterVectorHash(FunctionRegistry* registry) {
   // value_counts
 
   base.finalize = ValueCountsFinalize;
-  auto value_counts = std::make_shared<VectorFunction>("value_counts", Arity::Unary());
+  auto value_counts = std::make_shared<VectorFunction>("value_counts", Arity::Unary(),
+                                                       &kDefaultHashOptions);
   AddHashKernels<ValueCountsAction>(value_counts.get(), base,
                                     OutputType(ValueCountsOutput));
 
@@ -670,8 +1105,8 @@ void RegisterVectorHash(FunctionRegistry* registry) {
   base.finalize = DictEncodeFinalize;
   // Unique and ValueCounts output unchunked arrays
   base.output_chunked = true;
-  auto dict_encode =
-      std::make_shared<VectorFunction>("dictionary_encode", Arity::Unary());
+  auto dict_encode = std::make_shared<VectorFunction>("dictionary_encode", Arity::Unary(),
+                                                       &kDefaultHashOptions);
   AddHashKernels<DictEncodeAction>(dict_encode.get(), base, OutputType(DictEncodeOutput));
 
   // Calling dictionary_encode on dictionary input not supported, but if it
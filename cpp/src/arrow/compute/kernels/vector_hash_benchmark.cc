@@ -208,6 +208,8 @@ std::vector<HashBenchCase> general_bench_cases = {
   {kHashBenchmarkLength, 100000, 0.5},
   {kHashBenchmarkLength, 100000, 0.99},
   {kHashBenchmarkLength, 100000, 1},
+  {kHashBenchmarkLength, 1 << 20, 0},
+  {kHashBenchmarkLength, 1 << 20, 0.1},
 };
 // clang-format on
 
@@ -34,6 +34,7 @@
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_common.h"
+#include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
@@ -677,5 +678,74 @@ TEST_F(TestHashKernel, ChunkedArrayZeroChunk) {
                      *result_datum.chunked_array());
 }
 
+// Large enough inputs are hashed by partitions when threads are allowed
+void CheckPartitionedHashing(const std::shared_ptr<ChunkedArray>& values) {
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+  ExecContext threaded_ctx;
+  const HashOptions preserve_order(/*preserve_order=*/true);
+  const HashOptions partition_order(/*preserve_order=*/false);
+
+  // With preserve_order, the output is the same as for serial hashing
+  ASSERT_OK_AND_ASSIGN(auto expected_uniques, Unique(values, &serial_ctx));
+  ASSERT_OK_AND_ASSIGN(auto uniques, Unique(values, preserve_order, &threaded_ctx));
+  ASSERT_OK(uniques->ValidateFull());
+  AssertArraysEqual(*expected_uniques, *uniques);
+
+  ASSERT_OK_AND_ASSIGN(auto expected_counts, ValueCounts(values, &serial_ctx));
+  ASSERT_OK_AND_ASSIGN(auto counts, ValueCounts(values, preserve_order, &threaded_ctx));
+  ASSERT_OK(counts->ValidateFull());
+  AssertArraysEqual(*expected_counts, *counts);
+
+  ASSERT_OK_AND_ASSIGN(Datum expected_encoded, DictionaryEncode(values, &serial_ctx));
+  ASSERT_OK_AND_ASSIGN(Datum encoded,
+                       DictionaryEncode(values, preserve_order, &threaded_ctx));
+  ASSERT_OK(encoded.chunked_array()->ValidateFull());
+  AssertChunkedEqual(*expected_encoded.chunked_array(), *encoded.chunked_array());
+
+  // Otherwise the unique values are the same, in another order
+  ASSERT_OK_AND_ASSIGN(uniques, Unique(values, partition_order, &threaded_ctx));
+  ASSERT_OK(uniques->ValidateFull());
+  ASSERT_EQ(uniques->length(), expected_uniques->length());
+  ASSERT_OK_AND_ASSIGN(auto positions, IndexIn(uniques, expected_uniques));
+  ASSERT_EQ(positions.make_array()->null_count(), 0);
+
+  ASSERT_OK_AND_ASSIGN(counts, ValueCounts(values, partition_order, &threaded_ctx));
+  ASSERT_OK(counts->ValidateFull());
+  ASSERT_OK_AND_ASSIGN(Datum total, Sum(counts->field(kCountsFieldIndex)));
+  ASSERT_EQ(total.scalar_as<Int64Scalar>().value, values->length());
+
+  ASSERT_OK_AND_ASSIGN(encoded, DictionaryEncode(values, partition_order, &threaded_ctx));
+  const ChunkedArray& encoded_chunks = *encoded.chunked_array();
+  ASSERT_EQ(encoded_chunks.num_chunks(), values->num_chunks());
+  for (int i = 0; i < values->num_chunks(); ++i) {
+    const auto& chunk = checked_cast<const DictionaryArray&>(*encoded_chunks.chunk(i));
+    ASSERT_OK(chunk.ValidateFull());
+    ASSERT_OK_AND_ASSIGN(auto decoded, Take(*chunk.dictionary(), *chunk.indices()));
+    AssertArraysEqual(*values->chunk(i), *decoded);
+  }
+}
+
+TEST_F(TestHashKernel, PartitionedHashing) {
+  random::RandomArrayGenerator rng(42);
+  const int64_t chunk_length = 300000;
+
+  ArrayVector integers;
+  ArrayVector strings;
+  for (int i = 0; i < 4; ++i) {
+    integers.push_back(rng.Int64(chunk_length, 0, 200000, /*null_probability=*/0.1));
+    strings.push_back(
+        rng.StringWithRepeats(chunk_length, /*unique=*/1000, /*min_length=*/0,
+                              /*max_length=*/20, /*null_probability=*/0.05));
+  }
+  // Offsets and an all-null chunk
+  integers.push_back(integers[0]->Slice(12345));
+  ASSERT_OK_AND_ASSIGN(auto nulls, MakeArrayOfNull(int64(), 1000));
+  integers.push_back(nulls);
+
+  CheckPartitionedHashing(std::make_shared<ChunkedArray>(integers));
+  CheckPartitionedHashing(std::make_shared<ChunkedArray>(strings));
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,227 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Vector kernels converting to and from run-end encoded arrays
+
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "arrow/array/array_base.h"
+#include "arrow/array/array_binary.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/run_end_internal.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/result.h"
+#include "arrow/util/bitmap_reader.h"
+
+namespace arrow {
+
+using internal::OptionalBitIndexer;
+
+namespace compute {
+namespace internal {
+namespace {
+
+using RunEndEncodeState = OptionsWrapper<RunEndEncodeOptions>;
+
+// Computes the logical end of each run of equal values, nulls being equal to
+// each other
+struct RunEndsFinder {
+  const ArrayData& input;
+  std::vector<int64_t> run_ends;
+
+  template <typename IsEqual>
+  Status FindRuns(IsEqual&& is_equal) {
+    OptionalBitIndexer is_valid(input.buffers[0], input.offset);
+    for (int64_t i = 1; i < input.length; ++i) {
+      const bool valid = is_valid[i];
+      if (valid != is_valid[i - 1] || (valid && !is_equal(i - 1, i))) {
+        run_ends.push_back(i);
+      }
+    }
+    if (input.length > 0) {
+      run_ends.push_back(input.length);
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const NullType&) {
+    if (input.length > 0) {
+      run_ends.push_back(input.length);
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const BooleanType&) {
+    const uint8_t* data = input.buffers[1]->data();
+    return FindRuns([&](int64_t i, int64_t j) {
+      return BitUtil::GetBit(data, input.offset + i) ==
+             BitUtil::GetBit(data, input.offset + j);
+    });
+  }
+
+  Status Visit(const FixedWidthType& type) {
+    const int byte_width = type.bit_width() / 8;
+    const uint8_t* data = input.buffers[1]->data() + input.offset * byte_width;
+    return FindRuns([&](int64_t i, int64_t j) {
+      return std::memcmp(data + i * byte_width, data + j * byte_width, byte_width) == 0;
+    });
+  }
+
+  template <typename Type>
+  enable_if_base_binary<Type, Status> Visit(const Type&) {
+    typename TypeTraits<Type>::ArrayType array(input.Copy());
+    return FindRuns(
+        [&](int64_t i, int64_t j) { return array.GetView(i) == array.GetView(j); });
+  }
+
+  Status Visit(const DictionaryType& type) {
+    return Status::NotImplemented("run_end_encode of ", type);
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("run_end_encode of ", type);
+  }
+};
+
+template <typename RunEndCType>
+Result<std::shared_ptr<ArrayData>> MakeRunEndsTyped(
+    KernelContext* ctx, const std::shared_ptr<DataType>& type,
+    const std::vector<int64_t>& run_ends) {
+  const int64_t num_runs = static_cast<int64_t>(run_ends.size());
+  if (num_runs > 0 && run_ends.back() > std::numeric_limits<RunEndCType>::max()) {
+    return Status::Invalid("Array of length ", run_ends.back(),
+                           " cannot be run-end encoded with run end type ", *type);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto buffer, ctx->Allocate(num_runs * sizeof(RunEndCType)));
+  auto out = reinterpret_cast<RunEndCType*>(buffer->mutable_data());
+  for (int64_t run_end : run_ends) {
+    *out++ = static_cast<RunEndCType>(run_end);
+  }
+  return ArrayData::Make(type, num_runs, {nullptr, std::move(buffer)}, 0);
+}
+
+Result<std::shared_ptr<ArrayData>> MakeRunEnds(KernelContext* ctx,
+                                               const std::shared_ptr<DataType>& type,
+                                               const std::vector<int64_t>& run_ends) {
+  switch (type->id()) {
+    case Type::INT16:
+      return MakeRunEndsTyped<int16_t>(ctx, type, run_ends);
+    case Type::INT32:
+      return MakeRunEndsTyped<int32_t>(ctx, type, run_ends);
+    case Type::INT64:
+      return MakeRunEndsTyped<int64_t>(ctx, type, run_ends);
+    default:
+      return Status::Invalid("Invalid run end type: ", *type);
+  }
+}
+
+Status RunEndEncodeImpl(KernelContext* ctx, const std::shared_ptr<ArrayData>& input,
+                        Datum* out) {
+  const auto& run_end_type = RunEndEncodeState::Get(ctx).run_end_type;
+  RunEndsFinder finder{*input, {}};
+  RETURN_NOT_OK(VisitTypeInline(*input->type, &finder));
+
+  ARROW_ASSIGN_OR_RAISE(auto run_ends, MakeRunEnds(ctx, run_end_type, finder.run_ends));
+
+  // The value of each run is taken from its first slot
+  Int64Builder run_starts(ctx->memory_pool());
+  RETURN_NOT_OK(run_starts.Reserve(finder.run_ends.size()));
+  int64_t run_start = 0;
+  for (int64_t run_end : finder.run_ends) {
+    run_starts.UnsafeAppend(run_start);
+    run_start = run_end;
+  }
+  std::shared_ptr<Array> run_start_indices;
+  RETURN_NOT_OK(run_starts.Finish(&run_start_indices));
+  ARROW_ASSIGN_OR_RAISE(Datum values,
+                        Take(Datum(input), Datum(run_start_indices),
+                             TakeOptions::NoBoundsCheck(), ctx->exec_context()));
+
+  out->value = ArrayData::Make(run_end_encoded(run_end_type, input->type), input->length,
+                               {nullptr}, {std::move(run_ends), values.array()},
+                               /*null_count=*/0);
+  return Status::OK();
+}
+
+void RunEndEncodeExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  KERNEL_RETURN_IF_ERROR(ctx, RunEndEncodeImpl(ctx, batch[0].array(), out));
+}
+
+Status RunEndDecodeImpl(KernelContext* ctx, const ArrayData& input, Datum* out) {
+  // Expand each run into as many references to its value
+  ARROW_ASSIGN_OR_RAISE(auto indices_buffer,
+                        ctx->Allocate(input.length * sizeof(int64_t)));
+  auto indices = reinterpret_cast<int64_t*>(indices_buffer->mutable_data());
+  RETURN_NOT_OK(::arrow::internal::VisitRuns(
+      input, [&](int64_t physical_index, int64_t, int64_t run_length) {
+        std::fill(indices, indices + run_length, physical_index);
+        indices += run_length;
+        return Status::OK();
+      }));
+  auto indices_data =
+      ArrayData::Make(int64(), input.length, {nullptr, std::move(indices_buffer)}, 0);
+  ARROW_ASSIGN_OR_RAISE(Datum values,
+                        Take(Datum(input.child_data[1]), Datum(indices_data),
+                             TakeOptions::NoBoundsCheck(), ctx->exec_context()));
+  out->value = values.array();
+  return Status::OK();
+}
+
+void RunEndDecodeExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  KERNEL_RETURN_IF_ERROR(ctx, RunEndDecodeImpl(ctx, *batch[0].array(), out));
+}
+
+Result<ValueDescr> ResolveEncodedType(KernelContext* ctx,
+                                      const std::vector<ValueDescr>& args) {
+  const auto& run_end_type = RunEndEncodeState::Get(ctx).run_end_type;
+  ARROW_ASSIGN_OR_RAISE(auto type, RunEndEncodedType::Make(run_end_type, args[0].type));
+  return ValueDescr::Array(std::move(type));
+}
+
+Result<ValueDescr> ResolveDecodedType(KernelContext*,
+                                      const std::vector<ValueDescr>& args) {
+  const auto& ree_type = checked_cast<const RunEndEncodedType&>(*args[0].type);
+  return ValueDescr::Array(ree_type.value_type());
+}
+
+const auto kDefaultRunEndEncodeOptions = RunEndEncodeOptions::Defaults();
+
+}  // namespace
+
+void RegisterVectorRunEnd(FunctionRegistry* registry) {
+  VectorKernel encode_base;
+  encode_base.init = RunEndEncodeState::Init;
+  encode_base.signature = KernelSignature::Make({InputType(ValueDescr::ARRAY)},
+                                                OutputType(ResolveEncodedType));
+  encode_base.exec = RunEndEncodeExec;
+  auto encode = std::make_shared<VectorFunction>("run_end_encode", Arity::Unary(),
+                                                 &kDefaultRunEndEncodeOptions);
+  DCHECK_OK(encode->AddKernel(encode_base));
+  DCHECK_OK(registry->AddFunction(std::move(encode)));
+
+  auto decode = std::make_shared<VectorFunction>("run_end_decode", Arity::Unary());
+  DCHECK_OK(decode->AddKernel({InputType::Array(Type::RUN_END_ENCODED)},
+                              OutputType(ResolveDecodedType), RunEndDecodeExec));
+  DCHECK_OK(registry->AddFunction(std::move(decode)));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,137 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/api.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/result.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace compute {
+
+class TestRunEndEncodedKernels
+    : public ::testing::TestWithParam<std::shared_ptr<DataType>> {
+ protected:
+  std::shared_ptr<Array> MakeInput(int64_t length, const std::string& run_ends_json,
+                                   const std::string& values_json,
+                                   const std::shared_ptr<DataType>& type = int64()) {
+    auto run_ends = ArrayFromJSON(GetParam(), run_ends_json);
+    auto values = ArrayFromJSON(type, values_json);
+    return RunEndEncodedArray::Make(length, run_ends, values).ValueOrDie();
+  }
+};
+
+TEST_P(TestRunEndEncodedKernels, EncodeDecode) {
+  auto decoded = ArrayFromJSON(int64(), "[1, 1, 1, null, null, 2, 1]");
+  auto encoded = MakeInput(7, "[3, 5, 6, 7]", "[1, null, 2, 1]");
+
+  ASSERT_OK_AND_ASSIGN(Datum result,
+                       RunEndEncode(decoded, RunEndEncodeOptions(GetParam())));
+  ASSERT_OK(result.make_array()->ValidateFull());
+  AssertArraysEqual(*encoded, *result.make_array(), /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(result, RunEndDecode(encoded));
+  AssertArraysEqual(*decoded, *result.make_array(), /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(result, RunEndDecode(encoded->Slice(2, 4)));
+  AssertArraysEqual(*decoded->Slice(2, 4), *result.make_array(), /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(result, RunEndEncode(ArrayFromJSON(int64(), "[]"),
+                                            RunEndEncodeOptions(GetParam())));
+  ASSERT_EQ(0, result.length());
+}
+
+TEST_P(TestRunEndEncodedKernels, EncodeStrings) {
+  auto decoded = ArrayFromJSON(utf8(), R"(["a", "a", "bc", null, "bc", "bc"])");
+  auto encoded = MakeInput(6, "[2, 3, 4, 6]", R"(["a", "bc", null, "bc"])", utf8());
+  ASSERT_OK_AND_ASSIGN(Datum result,
+                       RunEndEncode(decoded, RunEndEncodeOptions(GetParam())));
+  AssertArraysEqual(*encoded, *result.make_array(), /*verbose=*/true);
+}
+
+TEST_P(TestRunEndEncodedKernels, Take) {
+  auto input = MakeInput(6, "[3, 5, 6]", "[1, null, 2]");
+  ASSERT_OK_AND_ASSIGN(Datum result,
+                       Take(input, ArrayFromJSON(int32(), "[0, 2, null, null, 5, 3]")));
+  ASSERT_OK(result.make_array()->ValidateFull());
+  AssertArraysEqual(*MakeInput(6, "[2, 4, 5, 6]", "[1, null, 2, null]"),
+                    *result.make_array(), /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(result, Take(input->Slice(3), ArrayFromJSON(int8(), "[2, 0]")));
+  AssertArraysEqual(*MakeInput(2, "[1, 2]", "[2, null]"), *result.make_array(),
+                    /*verbose=*/true);
+
+  ASSERT_RAISES(IndexError, Take(input, ArrayFromJSON(int32(), "[6]")));
+}
+
+TEST_P(TestRunEndEncodedKernels, Filter) {
+  auto input = MakeInput(6, "[3, 5, 6]", "[1, null, 2]");
+  auto filter = ArrayFromJSON(boolean(), "[true, false, true, false, false, true]");
+  ASSERT_OK_AND_ASSIGN(Datum result, Filter(input, filter));
+  ASSERT_OK(result.make_array()->ValidateFull());
+  AssertArraysEqual(*MakeInput(3, "[2, 3]", "[1, 2]"), *result.make_array(),
+                    /*verbose=*/true);
+
+  filter = ArrayFromJSON(boolean(), "[true, null, true, true, false, null]");
+  ASSERT_OK_AND_ASSIGN(result, Filter(input, filter));
+  AssertArraysEqual(*MakeInput(3, "[2, 3]", "[1, null]"), *result.make_array(),
+                    /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(result,
+                       Filter(input, filter, FilterOptions(FilterOptions::EMIT_NULL)));
+  AssertArraysEqual(*MakeInput(4, "[1, 2, 3, 4]", "[1, null, 1, null]"),
+                    *result.make_array(), /*verbose=*/true);
+}
+
+TEST_P(TestRunEndEncodedKernels, Sum) {
+  auto input = MakeInput(6, "[3, 5, 6]", "[1, null, 2]");
+  ASSERT_OK_AND_ASSIGN(Datum result, Sum(input));
+  AssertScalarsEqual(Int64Scalar(5), *result.scalar(), /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(result, Sum(input->Slice(2, 2)));
+  AssertScalarsEqual(Int64Scalar(1), *result.scalar(), /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(result, Sum(input->Slice(3, 2)));
+  ASSERT_FALSE(result.scalar()->is_valid);
+}
+
+TEST_P(TestRunEndEncodedKernels, CompareScalar) {
+  auto input = MakeInput(6, "[3, 5, 6]", "[1, null, 2]");
+  ASSERT_OK_AND_ASSIGN(Datum result,
+                       CallFunction("greater", {input, MakeScalar(int64_t(1))}));
+  ASSERT_OK(result.make_array()->ValidateFull());
+  AssertArraysEqual(*MakeInput(6, "[3, 5, 6]", "[false, null, true]", boolean()),
+                    *result.make_array(), /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(result, CallFunction("less_equal", {input->Slice(4),
+                                                           MakeScalar(int64_t(1))}));
+  ASSERT_OK(result.make_array()->ValidateFull());
+  AssertArraysEqual(*MakeInput(2, "[1, 2]", "[null, false]", boolean()),
+                    *result.make_array(), /*verbose=*/true);
+}
+
+INSTANTIATE_TEST_SUITE_P(RunEndTypes, TestRunEndEncodedKernels,
+                         ::testing::Values(int16(), int32(), int64()));
+
+}  // namespace compute
+}  // namespace arrow
@@ -25,9 +25,13 @@
 #include "arrow/array/array_nested.h"
 #include "arrow/array/builder_primitive.h"
 #include "arrow/array/concatenate.h"
+#include "arrow/array/run_end_internal.h"
+#include "arrow/array/util.h"
 #include "arrow/buffer_builder.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/cast.h"
+#include "arrow/compute/kernels/chunked_internal.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/extension_type.h"
@@ -40,6 +44,7 @@
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/bitmap_reader.h"
 #include "arrow/util/int_util.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 
@@ -1114,6 +1119,29 @@ Status BinaryFilterImpl(KernelContext* ctx, const ArrayData& values,
 #undef APPEND_RAW_DATA
 #undef APPEND_SINGLE_VALUE
 
+// Find whether the selected slots of a filter without nulls form a single run,
+// in which case the output is a slice of the values that shares their buffers
+bool GetContiguousFilterRun(const ArrayData& filter, int64_t output_length,
+                            int64_t* start) {
+  const uint8_t* filter_data = filter.buffers[1]->data();
+  int64_t position = 0;
+  if (output_length > 0) {
+    BitBlockCounter filter_counter(filter_data, filter.offset, filter.length);
+    BitBlockCount block = filter_counter.NextWord();
+    while (block.NoneSet()) {
+      position += block.length;
+      block = filter_counter.NextWord();
+    }
+    while (!BitUtil::GetBit(filter_data, filter.offset + position)) {
+      ++position;
+    }
+  }
+  *start = position;
+  return position + output_length <= filter.length &&
+         CountSetBits(filter_data, filter.offset + position, output_length) ==
+             output_length;
+}
+
 void BinaryFilter(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
   FilterOptions::NullSelectionBehavior null_selection =
       FilterState::Get(ctx).null_selection_behavior;
@@ -1121,6 +1149,15 @@ void BinaryFilter(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
   const ArrayData& values = *batch[0].array();
   const ArrayData& filter = *batch[1].array();
   int64_t output_length = GetFilterOutputSize(filter, null_selection);
+
+  // Rather than copying the value data, select a contiguous run as a slice
+  int64_t run_start;
+  if (filter.GetNullCount() == 0 &&
+      GetContiguousFilterRun(filter, output_length, &run_start)) {
+    out->value = batch[0].array()->Slice(run_start, output_length);
+    return;
+  }
+
   ArrayData* out_arr = out->mutable_array();
 
   // The output precomputed null count is unknown except in the narrow
@@ -1204,6 +1241,47 @@ void DictionaryFilter(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
   out->value = filtered_values.data();
 }
 
+// ----------------------------------------------------------------------
+// Binary view take and filter
+//
+// The views are fixed-width, so they are selected as fixed_size_binary values
+// and the output shares all the data buffers of the input.
+
+std::shared_ptr<ArrayData> GetBinaryViewsAsFixedSizeBinary(const ArrayData& values) {
+  auto views = std::make_shared<ArrayData>(values);
+  views->type = fixed_size_binary(static_cast<int32_t>(sizeof(BinaryViewType::c_type)));
+  views->buffers.resize(2);
+  return views;
+}
+
+std::shared_ptr<ArrayData> WithBinaryViewData(const ArrayData& values,
+                                              const ArrayData& selected_views) {
+  auto out = std::make_shared<ArrayData>(selected_views);
+  out->type = values.type;
+  out->buffers.insert(out->buffers.end(), values.buffers.begin() + 2,
+                      values.buffers.end());
+  return out;
+}
+
+void BinaryViewTake(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  const ArrayData& values = *batch[0].array();
+  Datum result;
+  KERNEL_RETURN_IF_ERROR(ctx, Take(Datum(GetBinaryViewsAsFixedSizeBinary(values)),
+                                   batch[1], TakeState::Get(ctx), ctx->exec_context())
+                                  .Value(&result));
+  out->value = WithBinaryViewData(values, *result.array());
+}
+
+void BinaryViewFilter(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  const ArrayData& values = *batch[0].array();
+  Datum result;
+  KERNEL_RETURN_IF_ERROR(ctx, Filter(Datum(GetBinaryViewsAsFixedSizeBinary(values)),
+                                     batch[1].array(), FilterState::Get(ctx),
+                                     ctx->exec_context())
+                                  .Value(&result));
+  out->value = WithBinaryViewData(values, *result.array());
+}
+
 // ----------------------------------------------------------------------
 // Extension take and filter
 
@@ -1227,6 +1305,196 @@ void ExtensionFilter(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
   out->value = filtered_values.data();
 }
 
+// ----------------------------------------------------------------------
+// Run-end encoded take and filter
+
+// Both select whole runs: consecutive output slots coming from the same input
+// run are emitted as a single output run, so the values child is only taken
+// once per output run rather than once per slot.
+
+template <typename RunEndCType>
+Status CheckRunEndCapacity(int64_t length) {
+  if (length > std::numeric_limits<RunEndCType>::max()) {
+    return Status::Invalid("Selection output of length ", length,
+                           " does not fit the run end type");
+  }
+  return Status::OK();
+}
+
+Result<std::shared_ptr<ArrayData>> MakeSelectedRunEndEncoded(
+    KernelContext* ctx, const ArrayData& values, int64_t length,
+    std::shared_ptr<Buffer> run_ends, int64_t num_runs,
+    const std::shared_ptr<ArrayData>& physical_indices) {
+  const auto& ree_type = checked_cast<const RunEndEncodedType&>(*values.type);
+  ARROW_ASSIGN_OR_RAISE(Datum taken_values,
+                        Take(Datum(values.child_data[1]), Datum(physical_indices),
+                             TakeOptions::NoBoundsCheck(), ctx->exec_context()));
+  auto run_ends_data = ArrayData::Make(ree_type.run_end_type(), num_runs,
+                                       {nullptr, std::move(run_ends)}, 0);
+  return ArrayData::Make(values.type, length, {nullptr},
+                         {std::move(run_ends_data), taken_values.array()},
+                         /*null_count=*/0);
+}
+
+template <typename RunEndCType>
+Status RunEndEncodedTakeImpl(KernelContext* ctx, const ArrayData& values,
+                             const ArrayData& indices, std::shared_ptr<ArrayData>* out) {
+  RETURN_NOT_OK(CheckRunEndCapacity<RunEndCType>(indices.length));
+  const ArrayData& run_ends_data = *values.child_data[0];
+  const RunEndCType* run_ends = run_ends_data.GetValues<RunEndCType>(1);
+
+  ARROW_ASSIGN_OR_RAISE(Datum indices64, Cast(Datum(indices.Copy()), int64(),
+                                              CastOptions::Safe(), ctx->exec_context()));
+  const ArrayData& index_data = *indices64.array();
+  const int64_t* index_values = index_data.GetValues<int64_t>(1);
+
+  TypedBufferBuilder<RunEndCType> out_run_ends(ctx->memory_pool());
+  Int64Builder physical_indices(ctx->memory_pool());
+  // -1 stands for a null index, which becomes a run of nulls
+  int64_t prev_physical_index = -2;
+  OptionalBitIndexer index_is_valid(index_data.buffers[0], index_data.offset);
+  for (int64_t i = 0; i < index_data.length; ++i) {
+    int64_t physical_index = -1;
+    if (index_is_valid[i]) {
+      physical_index = ::arrow::internal::FindPhysicalIndex(
+          run_ends, run_ends_data.length, values.offset + index_values[i]);
+    }
+    if (physical_index == prev_physical_index) {
+      out_run_ends.mutable_data()[out_run_ends.length() - 1] =
+          static_cast<RunEndCType>(i + 1);
+      continue;
+    }
+    RETURN_NOT_OK(out_run_ends.Append(static_cast<RunEndCType>(i + 1)));
+    if (physical_index < 0) {
+      RETURN_NOT_OK(physical_indices.AppendNull());
+    } else {
+      RETURN_NOT_OK(physical_indices.Append(physical_index));
+    }
+    prev_physical_index = physical_index;
+  }
+
+  const int64_t num_runs = out_run_ends.length();
+  std::shared_ptr<Buffer> run_ends_buffer;
+  RETURN_NOT_OK(out_run_ends.Finish(&run_ends_buffer));
+  std::shared_ptr<ArrayData> physical_indices_data;
+  RETURN_NOT_OK(physical_indices.FinishInternal(&physical_indices_data));
+  return MakeSelectedRunEndEncoded(ctx, values, index_data.length,
+                                   std::move(run_ends_buffer), num_runs,
+                                   physical_indices_data)
+      .Value(out);
+}
+
+// Number of slots selected by a filter without nulls, or with nulls dropped
+int64_t CountSelected(const ArrayData& filter, int64_t start, int64_t length) {
+  const uint8_t* filter_data = filter.buffers[1]->data();
+  if (!filter.MayHaveNulls()) {
+    return CountSetBits(filter_data, filter.offset + start, length);
+  }
+  BinaryBitBlockCounter bit_counter(filter_data, filter.offset + start,
+                                    filter.buffers[0]->data(), filter.offset + start,
+                                    length);
+  int64_t selected = 0, position = 0;
+  while (position < length) {
+    BitBlockCount block = bit_counter.NextAndWord();
+    selected += block.popcount;
+    position += block.length;
+  }
+  return selected;
+}
+
+template <typename RunEndCType>
+Status RunEndEncodedFilterImpl(KernelContext* ctx, const ArrayData& values,
+                               const ArrayData& filter,
+                               std::shared_ptr<ArrayData>* out) {
+  if (values.length != filter.length) {
+    return Status::Invalid("Filter inputs must all be the same length");
+  }
+  TypedBufferBuilder<RunEndCType> out_run_ends(ctx->memory_pool());
+  Int64Builder physical_indices(ctx->memory_pool());
+  int64_t output_length = 0;
+  RETURN_NOT_OK(::arrow::internal::VisitRuns(
+      values, [&](int64_t physical_index, int64_t run_start, int64_t run_length) {
+        const int64_t selected = CountSelected(filter, run_start, run_length);
+        if (selected == 0) {
+          return Status::OK();
+        }
+        output_length += selected;
+        RETURN_NOT_OK(out_run_ends.Append(static_cast<RunEndCType>(output_length)));
+        return physical_indices.Append(physical_index);
+      }));
+  RETURN_NOT_OK(CheckRunEndCapacity<RunEndCType>(output_length));
+
+  const int64_t num_runs = out_run_ends.length();
+  std::shared_ptr<Buffer> run_ends_buffer;
+  RETURN_NOT_OK(out_run_ends.Finish(&run_ends_buffer));
+  std::shared_ptr<ArrayData> physical_indices_data;
+  RETURN_NOT_OK(physical_indices.FinishInternal(&physical_indices_data));
+  return MakeSelectedRunEndEncoded(ctx, values, output_length,
+                                   std::move(run_ends_buffer), num_runs,
+                                   physical_indices_data)
+      .Value(out);
+}
+
+template <template <typename> class Impl, typename... Args>
+Status DispatchRunEndType(const ArrayData& values, Args&&... args) {
+  switch (values.child_data[0]->type->id()) {
+    case Type::INT16:
+      return Impl<int16_t>::Exec(std::forward<Args>(args)...);
+    case Type::INT32:
+      return Impl<int32_t>::Exec(std::forward<Args>(args)...);
+    case Type::INT64:
+      return Impl<int64_t>::Exec(std::forward<Args>(args)...);
+    default:
+      return Status::Invalid("Invalid run end type: ", *values.child_data[0]->type);
+  }
+}
+
+template <typename RunEndCType>
+struct RunEndEncodedTakeExec {
+  template <typename... Args>
+  static Status Exec(Args&&... args) {
+    return RunEndEncodedTakeImpl<RunEndCType>(std::forward<Args>(args)...);
+  }
+};
+
+template <typename RunEndCType>
+struct RunEndEncodedFilterExec {
+  template <typename... Args>
+  static Status Exec(Args&&... args) {
+    return RunEndEncodedFilterImpl<RunEndCType>(std::forward<Args>(args)...);
+  }
+};
+
+void RunEndEncodedTake(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  const ArrayData& values = *batch[0].array();
+  const ArrayData& indices = *batch[1].array();
+  if (TakeState::Get(ctx).boundscheck) {
+    KERNEL_RETURN_IF_ERROR(ctx, CheckIndexBounds(indices, values.length));
+  }
+  std::shared_ptr<ArrayData> result;
+  KERNEL_RETURN_IF_ERROR(ctx, DispatchRunEndType<RunEndEncodedTakeExec>(
+                                  values, ctx, values, indices, &result));
+  out->value = std::move(result);
+}
+
+void RunEndEncodedFilter(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  const ArrayData& values = *batch[0].array();
+  const ArrayData& filter = *batch[1].array();
+  const auto null_selection = FilterState::Get(ctx).null_selection_behavior;
+  std::shared_ptr<ArrayData> result;
+  if (null_selection == FilterOptions::EMIT_NULL && filter.GetNullCount() > 0) {
+    // Null filter slots split runs, go through selection indices instead
+    std::shared_ptr<ArrayData> indices;
+    KERNEL_RETURN_IF_ERROR(ctx, GetTakeIndices(filter, null_selection).Value(&indices));
+    KERNEL_RETURN_IF_ERROR(ctx, DispatchRunEndType<RunEndEncodedTakeExec>(
+                                    values, ctx, values, *indices, &result));
+  } else {
+    KERNEL_RETURN_IF_ERROR(ctx, DispatchRunEndType<RunEndEncodedFilterExec>(
+                                    values, ctx, values, filter, &result));
+  }
+  out->value = std::move(result);
+}
+
 // ----------------------------------------------------------------------
 // Implement take for other data types where there is less performance
 // sensitivity by visiting the selected indices.
@@ -1634,6 +1902,10 @@ struct FSBImpl : public Selection<FSBImpl, FixedSizeBinaryType> {
   Status Finish() override { return data_builder.Finish(&out->buffers[1]); }
 };
 
+// Child indices are generated in bulk once the output offsets are known: each
+// selected list becomes a run of consecutive indices starting at its offset in
+// the child values.  If the selected lists are adjacent in the child values,
+// the child is sliced instead of taken.
 template <typename Type>
 struct ListImpl : public Selection<ListImpl<Type>, Type> {
   using offset_type = typename Type::offset_type;
@@ -1642,35 +1914,47 @@ struct ListImpl : public Selection<ListImpl<Type>, Type> {
   LIFT_BASE_MEMBERS();
 
   TypedBufferBuilder<offset_type> offset_builder;
-  typename TypeTraits<Type>::OffsetBuilderType child_index_builder;
+  // For each output slot, the offset of the selected list in the child values
+  // (0 for nulls, which select no child values)
+  TypedBufferBuilder<offset_type> value_start_builder;
+  // Whether the selected child values form a single run starting at
+  // child_run_start
+  bool child_contiguous = true;
+  offset_type child_run_start = -1;
 
   ListImpl(KernelContext* ctx, const ExecBatch& batch, int64_t output_length, Datum* out)
       : Base(ctx, batch, output_length, out),
         offset_builder(ctx->memory_pool()),
-        child_index_builder(ctx->memory_pool()) {}
+        value_start_builder(ctx->memory_pool()) {}
 
   template <typename Adapter>
   Status GenerateOutput() {
     ValuesArrayType typed_values(this->values);
-
-    // TODO presize child_index_builder with a similar heuristic as VarBinaryImpl
+    const offset_type* raw_offsets = typed_values.raw_value_offsets();
 
     offset_type offset = 0;
+    offset_type child_run_end = -1;
     Adapter adapter(this);
     RETURN_NOT_OK(adapter.Generate(
         [&](int64_t index) {
+          const offset_type value_start = raw_offsets[index];
+          const offset_type value_length = raw_offsets[index + 1] - value_start;
           offset_builder.UnsafeAppend(offset);
-          offset_type value_offset = typed_values.value_offset(index);
-          offset_type value_length = typed_values.value_length(index);
-          offset += value_length;
-          RETURN_NOT_OK(child_index_builder.Reserve(value_length));
-          for (offset_type j = value_offset; j < value_offset + value_length; ++j) {
-            child_index_builder.UnsafeAppend(j);
+          value_start_builder.UnsafeAppend(value_start);
+          if (value_length > 0) {
+            if (child_run_start < 0) {
+              child_run_start = value_start;
+            } else if (value_start != child_run_end) {
+              child_contiguous = false;
+            }
+            child_run_end = value_start + value_length;
           }
+          offset += value_length;
           return Status::OK();
         },
         [&]() {
           offset_builder.UnsafeAppend(offset);
+          value_start_builder.UnsafeAppend(0);
           return Status::OK();
         }));
     offset_builder.UnsafeAppend(offset);
@@ -1679,21 +1963,50 @@ struct ListImpl : public Selection<ListImpl<Type>, Type> {
 
   Status Init() override {
     RETURN_NOT_OK(offset_builder.Reserve(output_length + 1));
-    return Status::OK();
+    return value_start_builder.Reserve(output_length);
   }
 
-  Status Finish() override {
-    std::shared_ptr<Array> child_indices;
-    RETURN_NOT_OK(child_index_builder.Finish(&child_indices));
+  Result<std::shared_ptr<ArrayData>> MakeChildIndices(offset_type child_length) {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> index_buffer,
+                          ctx->Allocate(child_length * sizeof(offset_type)));
+    auto child_indices = reinterpret_cast<offset_type*>(index_buffer->mutable_data());
+    const offset_type* out_offsets = offset_builder.data();
+    const offset_type* value_starts = value_start_builder.data();
+    const int64_t num_slots = value_start_builder.length();
+    for (int64_t i = 0; i < num_slots; ++i) {
+      offset_type* run = child_indices + out_offsets[i];
+      const offset_type run_length = out_offsets[i + 1] - out_offsets[i];
+      const offset_type value_start = value_starts[i];
+      // Written as a plain counted loop so that it gets vectorized
+      for (offset_type j = 0; j < run_length; ++j) {
+        run[j] = value_start + j;
+      }
+    }
+    using IndexType = typename TypeTraits<Type>::OffsetType;
+    return ArrayData::Make(TypeTraits<IndexType>::type_singleton(), child_length,
+                           {nullptr, std::move(index_buffer)}, /*null_count=*/0);
+  }
 
+  Status Finish() override {
     ValuesArrayType typed_values(this->values);
+    const offset_type child_length = offset_builder.data()[offset_builder.length() - 1];
 
-    // No need to boundscheck the child values indices
-    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> taken_child,
-                          Take(*typed_values.values(), *child_indices,
-                               TakeOptions::NoBoundsCheck(), ctx->exec_context()));
+    std::shared_ptr<ArrayData> child_data;
+    if (child_length == 0) {
+      child_data = typed_values.values()->data()->Slice(0, 0);
+    } else if (child_contiguous) {
+      child_data = typed_values.values()->data()->Slice(child_run_start, child_length);
+    } else {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ArrayData> child_indices,
+                            MakeChildIndices(child_length));
+      // No need to boundscheck the child values indices
+      ARROW_ASSIGN_OR_RAISE(Datum taken_child,
+                            Take(Datum(typed_values.values()), Datum(child_indices),
+                                 TakeOptions::NoBoundsCheck(), ctx->exec_context()));
+      child_data = taken_child.array();
+    }
     RETURN_NOT_OK(offset_builder.Finish(&out->buffers[1]));
-    out->child_data = {taken_child->data()};
+    out->child_data = {std::move(child_data)};
     return Status::OK();
   }
 };
@@ -1769,26 +2082,49 @@ struct StructImpl : public Selection<StructImpl, StructType> {
 
   Status Finish() override {
     StructArray typed_values(values);
-
-    // Select from children without boundschecking
-    out->child_data.resize(values->type->num_fields());
-    for (int field_index = 0; field_index < values->type->num_fields(); ++field_index) {
-      ARROW_ASSIGN_OR_RAISE(Datum taken_field,
-                            Take(Datum(typed_values.field(field_index)), Datum(selection),
-                                 TakeOptions::NoBoundsCheck(), ctx->exec_context()));
-      out->child_data[field_index] = taken_field.array();
-    }
-    return Status::OK();
+    const int num_fields = values->type->num_fields();
+
+    // Select from children without boundschecking, taking several children at
+    // once for large selections.  The children themselves are taken serially,
+    // so that nested structs don't wait on the thread pool from inside it.
+    const bool parallel = ctx->exec_context()->use_threads() && num_fields > 1 &&
+                          output_length >= kMinParallelStructTakeLength;
+    ExecContext child_ctx = *ctx->exec_context();
+    child_ctx.set_use_threads(!parallel && child_ctx.use_threads());
+    out->child_data.resize(num_fields);
+    return ::arrow::internal::OptionalParallelFor(
+        parallel, num_fields, [&](int field_index) -> Status {
+          ARROW_ASSIGN_OR_RAISE(Datum taken_field,
+                                Take(Datum(typed_values.field(field_index)),
+                                     Datum(selection), TakeOptions::NoBoundsCheck(),
+                                     &child_ctx));
+          out->child_data[field_index] = taken_field.array();
+          return Status::OK();
+        });
   }
+
+  static constexpr int64_t kMinParallelStructTakeLength = 1 << 16;
 };
 
+constexpr int64_t StructImpl::kMinParallelStructTakeLength;
+
 void StructFilter(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  const ArrayData& filter = *batch[1].array();
+  const auto null_selection = FilterState::Get(ctx).null_selection_behavior;
+
+  // Select a contiguous run as a slice, keeping the children as they are
+  int64_t run_start;
+  if (filter.GetNullCount() == 0) {
+    const int64_t output_length = GetFilterOutputSize(filter, null_selection);
+    if (GetContiguousFilterRun(filter, output_length, &run_start)) {
+      out->value = batch[0].array()->Slice(run_start, output_length);
+      return;
+    }
+  }
+
   // Transform filter to selection indices and then use Take.
   std::shared_ptr<ArrayData> indices;
-  KERNEL_RETURN_IF_ERROR(
-      ctx,
-      GetTakeIndices(*batch[1].array(), FilterState::Get(ctx).null_selection_behavior)
-          .Value(&indices));
+  KERNEL_RETURN_IF_ERROR(ctx, GetTakeIndices(filter, null_selection).Value(&indices));
 
   Datum result;
   KERNEL_RETURN_IF_ERROR(ctx, Take(batch[0], Datum(indices), TakeOptions::NoBoundsCheck(),
@@ -1891,30 +2227,242 @@ Result<std::shared_ptr<Array>> TakeAA(const Array& values, const Array& indices,
   return result.make_array();
 }
 
+// Gather fixed-width values straight from the chunks of `values` into a
+// single output array.  `indices` must be int64 and in bounds.
+template <int kByteWidth>
+void GatherFixedWidth(const std::vector<const uint8_t*>& chunk_data, int byte_width,
+                      int64_t chunk, int64_t chunk_index, int64_t out_index,
+                      uint8_t* out_data) {
+  const int width = kByteWidth > 0 ? kByteWidth : byte_width;
+  std::memcpy(out_data + out_index * width, chunk_data[chunk] + chunk_index * width,
+              width);
+}
+
+template <int kByteWidth>
+void TakeChunkedFixedWidthImpl(const ChunkedArray& values, const ArrayData& indices,
+                               int bit_width, uint8_t* out_is_valid,
+                               uint8_t* out_data) {
+  const int num_chunks = values.num_chunks();
+  const int byte_width = bit_width / 8;
+  ChunkResolver resolver(values.chunks());
+
+  // Unbox the chunks once rather than on every lookup
+  std::vector<const uint8_t*> chunk_data(num_chunks);
+  std::vector<const uint8_t*> chunk_is_valid(num_chunks);
+  std::vector<int64_t> chunk_offset(num_chunks);
+  for (int i = 0; i < num_chunks; ++i) {
+    const ArrayData& chunk = *values.chunk(i)->data();
+    chunk_is_valid[i] = chunk.null_count != 0 ? GetValidityBitmap(chunk) : nullptr;
+    chunk_offset[i] = chunk.offset;
+    chunk_data[i] = chunk.buffers[1]->data();
+    if (bit_width > 1) {
+      chunk_data[i] += chunk.offset * byte_width;
+    }
+  }
+
+  const int64_t* raw_indices = indices.GetValues<int64_t>(1);
+  const uint8_t* indices_is_valid =
+      indices.null_count != 0 ? GetValidityBitmap(indices) : nullptr;
+  for (int64_t i = 0; i < indices.length; ++i) {
+    if (indices_is_valid != nullptr &&
+        !BitUtil::GetBit(indices_is_valid, indices.offset + i)) {
+      continue;
+    }
+    const auto loc = resolver.Resolve(raw_indices[i]);
+    const int64_t chunk = loc.first;
+    if (out_is_valid != nullptr) {
+      if (chunk_is_valid[chunk] != nullptr &&
+          !BitUtil::GetBit(chunk_is_valid[chunk], chunk_offset[chunk] + loc.second)) {
+        continue;
+      }
+      BitUtil::SetBit(out_is_valid, i);
+    }
+    if (bit_width == 1) {
+      const int64_t position = chunk_offset[chunk] + loc.second;
+      BitUtil::SetBitTo(out_data, i, BitUtil::GetBit(chunk_data[chunk], position));
+    } else {
+      GatherFixedWidth<kByteWidth>(chunk_data, byte_width, chunk, loc.second, i,
+                                   out_data);
+    }
+  }
+}
+
+Result<std::shared_ptr<Array>> TakeChunkedFixedWidth(const ChunkedArray& values,
+                                                     const ArrayData& indices,
+                                                     ExecContext* ctx) {
+  const int64_t length = indices.length;
+  const int bit_width = GetBitWidth(*values.type());
+  MemoryPool* pool = ctx->memory_pool();
+
+  std::shared_ptr<Buffer> out_is_valid;
+  if (indices.GetNullCount() > 0 || values.null_count() > 0) {
+    ARROW_ASSIGN_OR_RAISE(out_is_valid, AllocateEmptyBitmap(length, pool));
+  }
+  std::shared_ptr<Buffer> out_data;
+  if (bit_width == 1) {
+    ARROW_ASSIGN_OR_RAISE(out_data, AllocateEmptyBitmap(length, pool));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(out_data, AllocateBuffer(length * bit_width / 8, pool));
+    if (out_is_valid) {
+      // Null slots are skipped below, so zero them up front
+      std::memset(out_data->mutable_data(), 0, out_data->size());
+    }
+  }
+
+  uint8_t* is_valid = out_is_valid ? out_is_valid->mutable_data() : nullptr;
+  uint8_t* data = out_data->mutable_data();
+  switch (bit_width) {
+    case 8:
+      TakeChunkedFixedWidthImpl<1>(values, indices, bit_width, is_valid, data);
+      break;
+    case 16:
+      TakeChunkedFixedWidthImpl<2>(values, indices, bit_width, is_valid, data);
+      break;
+    case 32:
+      TakeChunkedFixedWidthImpl<4>(values, indices, bit_width, is_valid, data);
+      break;
+    case 64:
+      TakeChunkedFixedWidthImpl<8>(values, indices, bit_width, is_valid, data);
+      break;
+    case 128:
+      TakeChunkedFixedWidthImpl<16>(values, indices, bit_width, is_valid, data);
+      break;
+    default:
+      TakeChunkedFixedWidthImpl<0>(values, indices, bit_width, is_valid, data);
+      break;
+  }
+  return MakeArray(ArrayData::Make(values.type(), length,
+                                   {std::move(out_is_valid), std::move(out_data)}));
+}
+
+// Take values of any type from the chunks of `values`.  Indices are bucketed by
+// the chunk they fall in so that each chunk is taken from once, then the pieces
+// are put back in index order with a second take over their concatenation.
+// Only output-sized data is ever concatenated.  `indices` must be int64 and in
+// bounds.
+Result<std::shared_ptr<Array>> TakeChunkedGeneric(const ChunkedArray& values,
+                                                  const ArrayData& indices,
+                                                  ExecContext* ctx) {
+  const int num_chunks = values.num_chunks();
+  const int64_t length = indices.length;
+  MemoryPool* pool = ctx->memory_pool();
+  const auto no_boundscheck = TakeOptions::NoBoundsCheck();
+  ChunkResolver resolver(values.chunks());
+
+  const int64_t* raw_indices = indices.GetValues<int64_t>(1);
+  const uint8_t* indices_is_valid =
+      indices.null_count != 0 ? GetValidityBitmap(indices) : nullptr;
+  auto IsValid = [&](int64_t i) {
+    return indices_is_valid == nullptr ||
+           BitUtil::GetBit(indices_is_valid, indices.offset + i);
+  };
+
+  // If the indices are ascending and non-null, the pieces are already in order
+  bool in_order = indices.GetNullCount() == 0;
+  std::vector<int64_t> chunk_counts(num_chunks, 0);
+  for (int64_t i = 0; i < length; ++i) {
+    if (!IsValid(i)) continue;
+    ++chunk_counts[resolver.Resolve(raw_indices[i]).first];
+    in_order = in_order && (i == 0 || raw_indices[i] >= raw_indices[i - 1]);
+  }
+
+  std::vector<std::shared_ptr<Buffer>> chunk_indices(num_chunks);
+  std::vector<int64_t*> raw_chunk_indices(num_chunks, nullptr);
+  std::vector<int64_t> piece_start(num_chunks, 0);
+  int64_t num_selected = 0;
+  for (int i = 0; i < num_chunks; ++i) {
+    piece_start[i] = num_selected;
+    num_selected += chunk_counts[i];
+    if (chunk_counts[i] > 0) {
+      ARROW_ASSIGN_OR_RAISE(chunk_indices[i],
+                            AllocateBuffer(chunk_counts[i] * sizeof(int64_t), pool));
+      raw_chunk_indices[i] =
+          reinterpret_cast<int64_t*>(chunk_indices[i]->mutable_data());
+    }
+  }
+  if (num_selected == 0) {
+    return MakeArrayOfNull(values.type(), length, pool);
+  }
+
+  // Positions of each output value in the concatenated pieces
+  std::shared_ptr<Buffer> positions;
+  int64_t* raw_positions = nullptr;
+  if (!in_order) {
+    ARROW_ASSIGN_OR_RAISE(positions, AllocateBuffer(length * sizeof(int64_t), pool));
+    raw_positions = reinterpret_cast<int64_t*>(positions->mutable_data());
+  }
+  std::fill(chunk_counts.begin(), chunk_counts.end(), 0);
+  for (int64_t i = 0; i < length; ++i) {
+    if (!IsValid(i)) {
+      if (raw_positions != nullptr) raw_positions[i] = 0;
+      continue;
+    }
+    const auto loc = resolver.Resolve(raw_indices[i]);
+    const int64_t j = chunk_counts[loc.first]++;
+    raw_chunk_indices[loc.first][j] = loc.second;
+    if (raw_positions != nullptr) raw_positions[i] = piece_start[loc.first] + j;
+  }
+
+  ArrayVector pieces;
+  for (int i = 0; i < num_chunks; ++i) {
+    if (chunk_counts[i] == 0) continue;
+    Int64Array piece_indices(chunk_counts[i], chunk_indices[i]);
+    ARROW_ASSIGN_OR_RAISE(auto piece,
+                          TakeAA(*values.chunk(i), piece_indices, no_boundscheck, ctx));
+    pieces.push_back(std::move(piece));
+  }
+  std::shared_ptr<Array> taken;
+  if (pieces.size() == 1) {
+    taken = std::move(pieces[0]);
+  } else {
+    ARROW_ASSIGN_OR_RAISE(taken, Concatenate(pieces, pool));
+  }
+  if (in_order) {
+    return taken;
+  }
+
+  std::shared_ptr<Buffer> positions_is_valid;
+  if (indices.GetNullCount() > 0) {
+    ARROW_ASSIGN_OR_RAISE(positions_is_valid,
+                          CopyBitmap(pool, indices_is_valid, indices.offset, length));
+  }
+  Int64Array take_positions(length, std::move(positions), std::move(positions_is_valid));
+  return TakeAA(*taken, take_positions, no_boundscheck, ctx);
+}
+
 Result<std::shared_ptr<ChunkedArray>> TakeCA(const ChunkedArray& values,
                                              const Array& indices,
                                              const TakeOptions& options,
                                              ExecContext* ctx) {
   auto num_chunks = values.num_chunks();
   std::vector<std::shared_ptr<Array>> new_chunks(1);  // Hard-coded 1 for now
-  std::shared_ptr<Array> current_chunk;
 
   // Case 1: `values` has a single chunk, so just use it
   if (num_chunks == 1) {
-    current_chunk = values.chunk(0);
-  } else {
-    // TODO Case 2: See if all `indices` fall in the same chunk and call Array Take on it
-    // See
-    // https://github.com/apache/arrow/blob/6f2c9041137001f7a9212f244b51bc004efc29af/r/src/compute.cpp#L123-L151
-    // TODO Case 3: If indices are sorted, can slice them and call Array Take
+    ARROW_ASSIGN_OR_RAISE(new_chunks[0],
+                          TakeAA(*values.chunk(0), indices, options, ctx));
+    return std::make_shared<ChunkedArray>(std::move(new_chunks), values.type());
+  }
 
-    // Case 4: Else, concatenate chunks and call Array Take
-    ARROW_ASSIGN_OR_RAISE(current_chunk,
-                          Concatenate(values.chunks(), ctx->memory_pool()));
+  // Case 2: resolve each index to a (chunk, index in chunk) pair and gather
+  // from the chunks directly, without concatenating `values`
+  if (options.boundscheck) {
+    RETURN_NOT_OK(CheckIndexBounds(*indices.data(), values.length()));
   }
-  // Call Array Take on our single chunk
-  ARROW_ASSIGN_OR_RAISE(new_chunks[0], TakeAA(*current_chunk, indices, options, ctx));
-  return std::make_shared<ChunkedArray>(std::move(new_chunks));
+  std::shared_ptr<ArrayData> int64_indices = indices.data();
+  if (indices.type_id() != Type::INT64) {
+    ARROW_ASSIGN_OR_RAISE(auto casted, Cast(indices, int64(), CastOptions::Safe(), ctx));
+    int64_indices = casted->data();
+  }
+
+  const Type::type type_id = values.type()->id();
+  if (is_fixed_width(type_id) && !is_dictionary(type_id)) {
+    ARROW_ASSIGN_OR_RAISE(new_chunks[0],
+                          TakeChunkedFixedWidth(values, *int64_indices, ctx));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(new_chunks[0], TakeChunkedGeneric(values, *int64_indices, ctx));
+  }
+  return std::make_shared<ChunkedArray>(std::move(new_chunks), values.type());
 }
 
 Result<std::shared_ptr<ChunkedArray>> TakeCC(const ChunkedArray& values,
@@ -1925,8 +2473,6 @@ Result<std::shared_ptr<ChunkedArray>> TakeCC(const ChunkedArray& values,
   std::vector<std::shared_ptr<Array>> new_chunks(num_chunks);
   for (int i = 0; i < num_chunks; i++) {
     // Take with that indices chunk
-    // Note that as currently implemented, this is inefficient because `values`
-    // will get concatenated on every iteration of this loop
     ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ChunkedArray> current_chunk,
                           TakeCA(values, *indices.chunk(i), options, ctx));
     // Concatenate the result to make a single array for this chunk
@@ -2057,6 +2603,83 @@ void TakeExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
   KERNEL_RETURN_IF_ERROR(ctx, kernel.ExecTake());
 }
 
+// Find whether indices without nulls are consecutive and ascending
+template <typename IndexCType>
+bool IsConsecutiveIndexRange(const ArrayData& indices, int64_t* start) {
+  const IndexCType* raw_indices = indices.GetValues<IndexCType>(1);
+  const int64_t first = static_cast<int64_t>(raw_indices[0]);
+  for (int64_t i = 1; i < indices.length; ++i) {
+    if (static_cast<int64_t>(raw_indices[i]) != first + i) {
+      return false;
+    }
+  }
+  *start = first;
+  return true;
+}
+
+bool GetConsecutiveIndexRange(const ArrayData& indices, int64_t* start) {
+  if (indices.GetNullCount() != 0) {
+    return false;
+  }
+  if (indices.length == 0) {
+    *start = 0;
+    return true;
+  }
+  switch (indices.type->id()) {
+    case Type::INT8:
+      return IsConsecutiveIndexRange<int8_t>(indices, start);
+    case Type::INT16:
+      return IsConsecutiveIndexRange<int16_t>(indices, start);
+    case Type::INT32:
+      return IsConsecutiveIndexRange<int32_t>(indices, start);
+    case Type::INT64:
+      return IsConsecutiveIndexRange<int64_t>(indices, start);
+    case Type::UINT8:
+      return IsConsecutiveIndexRange<uint8_t>(indices, start);
+    case Type::UINT16:
+      return IsConsecutiveIndexRange<uint16_t>(indices, start);
+    case Type::UINT32:
+      return IsConsecutiveIndexRange<uint32_t>(indices, start);
+    case Type::UINT64:
+      return IsConsecutiveIndexRange<uint64_t>(indices, start);
+    default:
+      return false;
+  }
+}
+
+// Like FilterExec, but selecting a contiguous run of the values as a slice that
+// shares their buffers and child data
+template <typename Impl>
+void FilterExecOrSlice(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  const ArrayData& filter = *batch[1].array();
+  int64_t output_length =
+      GetFilterOutputSize(filter, FilterState::Get(ctx).null_selection_behavior);
+  int64_t run_start;
+  if (filter.GetNullCount() == 0 &&
+      GetContiguousFilterRun(filter, output_length, &run_start)) {
+    out->value = batch[0].array()->Slice(run_start, output_length);
+    return;
+  }
+  Impl kernel(ctx, batch, output_length, out);
+  KERNEL_RETURN_IF_ERROR(ctx, kernel.ExecFilter());
+}
+
+// Like TakeExec, but taking a range of consecutive indices as a slice of the
+// values so that the value data is not copied
+template <typename Impl>
+void TakeExecOrSlice(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  if (TakeState::Get(ctx).boundscheck) {
+    KERNEL_RETURN_IF_ERROR(ctx, CheckIndexBounds(*batch[1].array(), batch[0].length()));
+  }
+  int64_t range_start;
+  if (GetConsecutiveIndexRange(*batch[1].array(), &range_start)) {
+    out->value = batch[0].array()->Slice(range_start, batch[1].length());
+    return;
+  }
+  Impl kernel(ctx, batch, /*output_length=*/batch[1].length(), out);
+  KERNEL_RETURN_IF_ERROR(ctx, kernel.ExecTake());
+}
+
 struct SelectionKernelDescr {
   InputType input;
   ArrayKernelExec exec;
@@ -2090,12 +2713,15 @@ void RegisterVectorSelection(FunctionRegistry* registry) {
       {InputType::Array(Type::DECIMAL), FilterExec<FSBImpl>},
       {InputType::Array(Type::DICTIONARY), DictionaryFilter},
       {InputType::Array(Type::EXTENSION), ExtensionFilter},
-      {InputType::Array(Type::LIST), FilterExec<ListImpl<ListType>>},
-      {InputType::Array(Type::LARGE_LIST), FilterExec<ListImpl<LargeListType>>},
-      {InputType::Array(Type::FIXED_SIZE_LIST), FilterExec<FSLImpl>},
+      {InputType::Array(Type::LIST), FilterExecOrSlice<ListImpl<ListType>>},
+      {InputType::Array(Type::LARGE_LIST), FilterExecOrSlice<ListImpl<LargeListType>>},
+      {InputType::Array(Type::FIXED_SIZE_LIST), FilterExecOrSlice<FSLImpl>},
       {InputType::Array(Type::STRUCT), StructFilter},
+      {InputType::Array(Type::RUN_END_ENCODED), RunEndEncodedFilter},
+      {InputType::Array(Type::BINARY_VIEW), BinaryViewFilter},
+      {InputType::Array(Type::STRING_VIEW), BinaryViewFilter},
       // TODO: Reuse ListType kernel for MAP
-      {InputType::Array(Type::MAP), FilterExec<ListImpl<MapType>>},
+      {InputType::Array(Type::MAP), FilterExecOrSlice<ListImpl<MapType>>},
   };
 
   VectorKernel filter_base;
@@ -2110,20 +2736,23 @@ void RegisterVectorSelection(FunctionRegistry* registry) {
   std::vector<SelectionKernelDescr> take_kernel_descrs = {
       {InputType(match::Primitive(), ValueDescr::ARRAY), PrimitiveTake},
       {InputType(match::BinaryLike(), ValueDescr::ARRAY),
-       TakeExec<VarBinaryImpl<BinaryType>>},
+       TakeExecOrSlice<VarBinaryImpl<BinaryType>>},
       {InputType(match::LargeBinaryLike(), ValueDescr::ARRAY),
-       TakeExec<VarBinaryImpl<LargeBinaryType>>},
+       TakeExecOrSlice<VarBinaryImpl<LargeBinaryType>>},
       {InputType::Array(Type::FIXED_SIZE_BINARY), TakeExec<FSBImpl>},
       {InputType::Array(null()), NullTake},
       {InputType::Array(Type::DECIMAL), TakeExec<FSBImpl>},
       {InputType::Array(Type::DICTIONARY), DictionaryTake},
       {InputType::Array(Type::EXTENSION), ExtensionTake},
-      {InputType::Array(Type::LIST), TakeExec<ListImpl<ListType>>},
-      {InputType::Array(Type::LARGE_LIST), TakeExec<ListImpl<LargeListType>>},
-      {InputType::Array(Type::FIXED_SIZE_LIST), TakeExec<FSLImpl>},
-      {InputType::Array(Type::STRUCT), TakeExec<StructImpl>},
+      {InputType::Array(Type::LIST), TakeExecOrSlice<ListImpl<ListType>>},
+      {InputType::Array(Type::LARGE_LIST), TakeExecOrSlice<ListImpl<LargeListType>>},
+      {InputType::Array(Type::FIXED_SIZE_LIST), TakeExecOrSlice<FSLImpl>},
+      {InputType::Array(Type::STRUCT), TakeExecOrSlice<StructImpl>},
+      {InputType::Array(Type::RUN_END_ENCODED), RunEndEncodedTake},
+      {InputType::Array(Type::BINARY_VIEW), BinaryViewTake},
+      {InputType::Array(Type::STRING_VIEW), BinaryViewTake},
       // TODO: Reuse ListType kernel for MAP
-      {InputType::Array(Type::MAP), TakeExec<ListImpl<MapType>>},
+      {InputType::Array(Type::MAP), TakeExecOrSlice<ListImpl<MapType>>},
   };
 
   VectorKernel take_base;
@@ -23,6 +23,7 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api.h"
 #include "arrow/compute/kernels/test_util.h"
@@ -469,6 +470,24 @@ TYPED_TEST(TestFilterKernelWithString, FilterString) {
   this->AssertFilter(R"(["a", "b", "c"])", "[null, 1, 0]", R"([null, "b"])");
 }
 
+TYPED_TEST(TestFilterKernelWithString, FilterContiguousRunSharesData) {
+  this->AssertFilter(R"(["a", "b", null, "d", "e"])", "[0, 1, 1, 1, 0]",
+                     R"(["b", null, "d"])");
+  this->AssertFilter(R"(["a", "b", "c"])", "[0, 0, 0]", "[]");
+
+  auto values = ArrayFromJSON(this->value_type(), R"(["a", "bb", "ccc", "dddd"])");
+  ASSERT_OK_AND_ASSIGN(
+      Datum out, Filter(values, ArrayFromJSON(boolean(), "[false, true, true, false]")));
+  ASSERT_OK(out.make_array()->ValidateFull());
+  ASSERT_EQ(values->data()->buffers[1], out.array()->buffers[1]);
+  ASSERT_EQ(values->data()->buffers[2], out.array()->buffers[2]);
+
+  // Non-contiguous selections still copy
+  ASSERT_OK_AND_ASSIGN(
+      out, Filter(values, ArrayFromJSON(boolean(), "[true, false, true, false]")));
+  ASSERT_NE(values->data()->buffers[2], out.array()->buffers[2]);
+}
+
 TYPED_TEST(TestFilterKernelWithString, FilterDictionary) {
   auto dict = R"(["a", "b", "c", "d", "e"])";
   this->AssertFilterDictionary(dict, "[3, 4, 2]", "[0, 1, 0]", "[4]");
@@ -476,6 +495,24 @@ TYPED_TEST(TestFilterKernelWithString, FilterDictionary) {
   this->AssertFilterDictionary(dict, "[3, 4, 2]", "[null, 1, 0]", "[null, 4]");
 }
 
+class TestFilterKernelWithBinaryView : public TestFilterKernel<BinaryViewType> {};
+
+TEST_F(TestFilterKernelWithBinaryView, FilterBinaryView) {
+  for (auto type : {binary_view(), utf8_view()}) {
+    this->AssertFilter(type, R"(["a", "a value stored out of line", "c"])", "[0, 1, 0]",
+                       R"(["a value stored out of line"])");
+    this->AssertFilter(type, R"([null, "b", "c"])", "[0, 1, 0]", R"(["b"])");
+    this->AssertFilter(type, R"(["a", "a value stored out of line", "c"])",
+                       "[null, 1, 1]", R"([null, "a value stored out of line", "c"])");
+  }
+
+  // The data buffers are shared with the input
+  auto values = ArrayFromJSON(utf8_view(), R"(["a value stored out of line", "b"])");
+  ASSERT_OK_AND_ASSIGN(
+      Datum filtered, Filter(values->Slice(1), ArrayFromJSON(boolean(), "[true]")));
+  ASSERT_EQ(values->data()->buffers[2], filtered.array()->buffers[2]);
+}
+
 class TestFilterKernelWithList : public TestFilterKernel<ListType> {
  public:
 };
@@ -516,6 +553,32 @@ TEST_F(TestFilterKernelWithList, FilterListListInt32) {
   ])");
 }
 
+TEST_F(TestFilterKernelWithList, FilterContiguousSharesChildData) {
+  auto values = ArrayFromJSON(list(int32()), "[[1, 2], [3], [], [4, 5], [6]]");
+
+  // A contiguous run is a slice of the values
+  ASSERT_OK_AND_ASSIGN(
+      Datum out, Filter(values, ArrayFromJSON(boolean(), "[0, 1, 1, 1, 0]")));
+  ASSERT_OK(out.make_array()->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(list(int32()), "[[3], [], [4, 5]]"),
+                    *out.make_array());
+  ASSERT_EQ(values->data()->child_data[0], out.array()->child_data[0]);
+
+  // Selected lists adjacent in the child values slice the child
+  this->AssertFilter(list(int32()), "[[1, 2], [3], [], [4, 5], [6]]", "[1, 1, 0, 1, 0]",
+                     "[[1, 2], [3], [4, 5]]");
+  ASSERT_OK_AND_ASSIGN(out, Filter(values, ArrayFromJSON(boolean(), "[1, 1, 0, 1, 0]")));
+  ASSERT_EQ(values->data()->child_data[0]->buffers[1],
+            out.array()->child_data[0]->buffers[1]);
+
+  // Other selections take the child values
+  ASSERT_OK_AND_ASSIGN(out, Filter(values, ArrayFromJSON(boolean(), "[1, 0, 0, 1, 0]")));
+  ASSERT_OK(out.make_array()->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(list(int32()), "[[1, 2], [4, 5]]"), *out.make_array());
+  ASSERT_NE(values->data()->child_data[0]->buffers[1],
+            out.array()->child_data[0]->buffers[1]);
+}
+
 class TestFilterKernelWithLargeList : public TestFilterKernel<LargeListType> {};
 
 TEST_F(TestFilterKernelWithLargeList, FilterListInt32) {
@@ -1040,6 +1103,25 @@ TYPED_TEST(TestTakeKernelWithString, TakeString) {
                                      "[2, 5]", &arr));
 }
 
+TYPED_TEST(TestTakeKernelWithString, TakeConsecutiveSharesData) {
+  this->AssertTake(R"(["a", "b", null, "d", "e"])", "[1, 2, 3]", R"(["b", null, "d"])");
+  this->AssertTake(R"(["a", "b", "c"])", "[]", "[]");
+
+  auto values = ArrayFromJSON(this->value_type(), R"(["a", "bb", "ccc", "dddd"])");
+  for (auto index_type : {int8(), uint64()}) {
+    ASSERT_OK_AND_ASSIGN(Datum out, Take(values, ArrayFromJSON(index_type, "[1, 2, 3]")));
+    ASSERT_OK(out.make_array()->ValidateFull());
+    ASSERT_EQ(values->data()->buffers[1], out.array()->buffers[1]);
+    ASSERT_EQ(values->data()->buffers[2], out.array()->buffers[2]);
+  }
+
+  // Indices with nulls or gaps still copy
+  ASSERT_OK_AND_ASSIGN(Datum out, Take(values, ArrayFromJSON(int32(), "[1, null, 3]")));
+  ASSERT_NE(values->data()->buffers[2], out.array()->buffers[2]);
+  ASSERT_OK_AND_ASSIGN(out, Take(values, ArrayFromJSON(int32(), "[2, 1]")));
+  ASSERT_NE(values->data()->buffers[2], out.array()->buffers[2]);
+}
+
 TYPED_TEST(TestTakeKernelWithString, TakeDictionary) {
   auto dict = R"(["a", "b", "c", "d", "e"])";
   this->AssertTakeDictionary(dict, "[3, 4, 2]", "[0, 1, 0]", "[3, 4, 3]");
@@ -1070,6 +1152,29 @@ TEST_F(TestTakeKernelFSB, TakeFixedSizeBinary) {
                                      int64(), "[2, 5]", &arr));
 }
 
+class TestTakeKernelWithBinaryView : public TestTakeKernel<BinaryViewType> {};
+
+TEST_F(TestTakeKernelWithBinaryView, TakeBinaryView) {
+  for (auto type : {binary_view(), utf8_view()}) {
+    CheckTake(type, R"(["a", "a value stored out of line", "c"])", "[1, 1, 0]",
+              R"(["a value stored out of line", "a value stored out of line", "a"])");
+    CheckTake(type, R"([null, "b", "c"])", "[0, 1, 0]", R"([null, "b", null])");
+    CheckTake(type, R"(["a", "b", "c"])", "[null, 2, 0]", R"([null, "c", "a"])");
+
+    std::shared_ptr<Array> arr;
+    ASSERT_RAISES(IndexError,
+                  TakeJSON(type, R"(["a", "b", "c"])", int8(), "[0, 9, 0]", &arr));
+  }
+
+  // Sliced input with values spread over several data buffers
+  auto values = ArrayFromJSON(utf8_view(), R"(["x", "another long out of line value"])");
+  ASSERT_OK_AND_ASSIGN(auto concatenated, Concatenate({values, values->Slice(1)}));
+  AssertTakeArrays(
+      concatenated->Slice(1), ArrayFromJSON(int32(), "[1, null, 0]"),
+      ArrayFromJSON(utf8_view(), R"(["another long out of line value", null,
+                                     "another long out of line value"])"));
+}
+
 class TestTakeKernelWithList : public TestTakeKernel<ListType> {};
 
 TEST_F(TestTakeKernelWithList, TakeListInt32) {
@@ -1111,6 +1216,23 @@ TEST_F(TestTakeKernelWithList, TakeListListInt32) {
             "[[], [], [], [], [], [], [[1], [2, null, 2], []]]");
 }
 
+TEST_F(TestTakeKernelWithList, TakeConsecutiveSharesChildData) {
+  auto values = ArrayFromJSON(list(int32()), "[[1, 2], [3], null, [4, 5]]");
+  ASSERT_OK_AND_ASSIGN(Datum out, Take(values, ArrayFromJSON(int32(), "[1, 2, 3]")));
+  ASSERT_OK(out.make_array()->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(list(int32()), "[[3], null, [4, 5]]"),
+                    *out.make_array());
+  ASSERT_EQ(values->data()->child_data[0], out.array()->child_data[0]);
+
+  // Adjacent child values are sliced even with null indices
+  ASSERT_OK_AND_ASSIGN(out, Take(values, ArrayFromJSON(int32(), "[0, null, 1]")));
+  ASSERT_OK(out.make_array()->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(list(int32()), "[[1, 2], null, [3]]"),
+                    *out.make_array());
+  ASSERT_EQ(values->data()->child_data[0]->buffers[1],
+            out.array()->child_data[0]->buffers[1]);
+}
+
 class TestTakeKernelWithLargeList : public TestTakeKernel<LargeListType> {};
 
 TEST_F(TestTakeKernelWithLargeList, TakeLargeListInt32) {
@@ -1206,6 +1328,25 @@ TEST_F(TestTakeKernelWithStruct, TakeStruct) {
   ])");
 }
 
+TEST_F(TestTakeKernelWithStruct, TakeLargeStruct) {
+  // Large enough for the fields to be taken in parallel
+  const int64_t length = 1 << 17;
+  auto rand = random::RandomArrayGenerator(kRandomSeed);
+  std::vector<std::shared_ptr<Array>> fields = {
+      rand.Int32(length, -100, 100, 0.1), rand.String(length, 0, 10, 0.1),
+      rand.Float64(length, -1, 1, 0.1)};
+  ASSERT_OK_AND_ASSIGN(auto values, StructArray::Make(fields, {"a", "b", "c"}));
+  auto indices = rand.Int32(length, 0, static_cast<int32_t>(length - 1), 0.05);
+
+  ASSERT_OK_AND_ASSIGN(Datum out, Take(values, indices));
+  auto taken = checked_pointer_cast<StructArray>(out.make_array());
+  ASSERT_OK(taken->ValidateFull());
+  for (int i = 0; i < values->num_fields(); ++i) {
+    ASSERT_OK_AND_ASSIGN(Datum expected, Take(fields[i], indices));
+    AssertArraysEqual(*expected.make_array(), *taken->field(i));
+  }
+}
+
 class TestTakeKernelWithUnion : public TestTakeKernel<UnionType> {};
 
 // TODO: Restore Union take functionality
@@ -1476,6 +1617,30 @@ TEST_F(TestTakeKernelWithChunkedArray, TakeChunkedArray) {
                                                        {"[0, 1, 0]", "[5, 1]"}, &arr));
 }
 
+TEST_F(TestTakeKernelWithChunkedArray, TakeChunkedArrayWithoutConcatenation) {
+  // Indices spanning several value chunks are gathered from the chunks directly
+  this->AssertTake(int32(), {"[1, null]", "[]", "[3, 4, 5]", "[6]"},
+                   "[5, null, 0, 1, 4, 2, 5]", {"[6, null, 1, null, 5, 3, 6]"});
+  this->AssertTake(boolean(), {"[true, null]", "[false]", "[true, false]"},
+                   "[4, 0, null, 1, 2, 3]", {"[false, true, null, null, false, true]"});
+  this->AssertTake(fixed_size_binary(2), {R"(["aa"])", R"(["bb", null])"}, "[2, 0, 1]",
+                   {R"([null, "aa", "bb"])"});
+  this->AssertTake(utf8(), {R"(["a", null])", "[]", R"(["bb", "ccc"])"},
+                   "[3, 1, null, 0, 2, 3]", {R"(["ccc", null, null, "a", "bb", "ccc"])"});
+  // Ascending indices
+  this->AssertTake(utf8(), {R"(["a", null])", R"(["bb", "ccc"])"}, "[0, 1, 3, 3]",
+                   {R"(["a", null, "ccc", "ccc"])"});
+  this->AssertTake(utf8(), {R"(["a"])", R"(["bb"])"}, "[null, null]", {"[null, null]"});
+  this->AssertTake(list(int8()), {"[[1], null]", "[[2, 3], []]"}, "[2, 3, 1, 0]",
+                   {"[[2, 3], [], null, [1]]"});
+  this->AssertChunkedTake(utf8(), {R"(["a", "b"])", R"(["c"])"}, {"[2, 0]", "[1, 2]"},
+                          {R"(["c", "a"])", R"(["b", "c"])"});
+
+  std::shared_ptr<ChunkedArray> arr;
+  ASSERT_RAISES(IndexError, this->TakeWithArray(utf8(), {R"(["a"])", R"(["b"])"},
+                                                "[0, 2]", &arr));
+}
+
 class TestTakeKernelWithTable : public TestTakeKernel<Table> {
  public:
   void AssertTake(const std::shared_ptr<Schema>& schm,
@@ -16,13 +16,25 @@
 // under the License.
 
 #include <algorithm>
+#include <cstring>
+#include <functional>
 #include <limits>
 #include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
+#include "arrow/array/binary_view_internal.h"
 #include "arrow/array/data.h"
+#include "arrow/chunked_array.h"
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/chunked_internal.h"
 #include "arrow/compute/kernels/common.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/optional.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 namespace compute {
@@ -34,6 +46,7 @@ namespace {
 
 // We need to preserve the options
 using PartitionNthToIndicesState = internal::OptionsWrapper<PartitionNthOptions>;
+using ArraySortIndicesState = internal::OptionsWrapper<ArraySortOptions>;
 
 Status GetPhysicalView(const std::shared_ptr<ArrayData>& arr,
                        const std::shared_ptr<DataType>& type,
@@ -110,14 +123,321 @@ inline void VisitRawValuesInline(const ArrayType& values,
   }
 }
 
+
+// ----------------------------------------------------------------------
+// Radix and parallel sorting of array indices
+
+// Map values to unsigned keys in the same order, so that they can be sorted
+// a byte at a time
+template <typename CType, typename Enable = void>
+struct RadixKey {};
+
+template <typename CType>
+struct RadixKey<CType, enable_if_t<std::is_integral<CType>::value>> {
+  using type = typename std::make_unsigned<CType>::type;
+
+  static type Get(CType value) {
+    // Flip the sign bit of signed values, so that negative values come first
+    const type sign_bit = std::is_signed<CType>::value
+                              ? static_cast<type>(type(1) << (8 * sizeof(type) - 1))
+                              : type(0);
+    return static_cast<type>(static_cast<type>(value) ^ sign_bit);
+  }
+};
+
+template <typename CType>
+struct RadixKey<CType, enable_if_t<std::is_floating_point<CType>::value>> {
+  using type = typename std::conditional<sizeof(CType) == 4, uint32_t, uint64_t>::type;
+
+  static type Get(CType value) {
+    // -0.0 and 0.0 compare equal
+    if (value == 0) {
+      value = 0;
+    }
+    type bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    // Flip all the bits of negative values, which reverses their order, and
+    // the sign bit of positive values, so that they come after the negative ones
+    const type sign_bit = type(1) << (8 * sizeof(type) - 1);
+    return bits ^ ((bits & sign_bit) ? ~type(0) : sign_bit);
+  }
+};
+
+// Arrays shorter than this are sorted with std::stable_sort rather than a
+// radix sort, whose passes have a fixed cost
+constexpr int64_t kRadixSortMinLength = 1024;
+
+// Stably sort the indices by their keys, with a LSD radix sort.  The keys are
+// permuted along with the indices, and the passes over the bytes all keys
+// share are skipped.
+template <typename Key>
+void RadixSort(uint64_t* indices, Key* keys, int64_t length) {
+  constexpr int kNumBytes = sizeof(Key);
+  int64_t counts[kNumBytes][256] = {};
+  for (int64_t i = 0; i < length; ++i) {
+    for (int b = 0; b < kNumBytes; ++b) {
+      ++counts[b][(keys[i] >> (8 * b)) & 0xff];
+    }
+  }
+
+  std::vector<uint64_t> scratch_indices(length);
+  std::vector<Key> scratch_keys(length);
+  uint64_t* src_indices = indices;
+  Key* src_keys = keys;
+  uint64_t* dest_indices = scratch_indices.data();
+  Key* dest_keys = scratch_keys.data();
+  for (int b = 0; b < kNumBytes; ++b) {
+    const int shift = 8 * b;
+    int64_t* positions = counts[b];
+    if (positions[(src_keys[0] >> shift) & 0xff] == length) {
+      continue;
+    }
+    int64_t position = 0;
+    for (int digit = 0; digit < 256; ++digit) {
+      const int64_t count = positions[digit];
+      positions[digit] = position;
+      position += count;
+    }
+    for (int64_t i = 0; i < length; ++i) {
+      const int64_t dest = positions[(src_keys[i] >> shift) & 0xff]++;
+      dest_indices[dest] = src_indices[i];
+      dest_keys[dest] = src_keys[i];
+    }
+    std::swap(src_indices, dest_indices);
+    std::swap(src_keys, dest_keys);
+  }
+  if (src_indices != indices) {
+    std::copy(src_indices, src_indices + length, indices);
+    std::copy(src_keys, src_keys + length, keys);
+  }
+}
+
+// Stably sort the indices in [begin, end) by the keys given by key(index)
+template <typename KeyFunc>
+void RadixSortIndices(uint64_t* begin, uint64_t* end, KeyFunc&& key) {
+  const int64_t length = end - begin;
+  if (length < kRadixSortMinLength) {
+    std::stable_sort(begin, end, [&](uint64_t left, uint64_t right) {
+      return key(left) < key(right);
+    });
+    return;
+  }
+  using Key = decltype(key(0));
+  std::vector<Key> keys(length);
+  for (int64_t i = 0; i < length; ++i) {
+    keys[i] = key(begin[i]);
+  }
+  RadixSort(begin, keys.data(), length);
+}
+
+// Minimum number of values for each task of a parallel sort, so that small
+// arrays are not slowed down by the task overhead and the merges
+constexpr int64_t kMinParallelSortLength = 1 << 16;
+
+// Return the number of tasks to spread the sorting of `length` values over,
+// which is 1 when they should be sorted serially
+int NumSortTasks(ExecContext* ctx, int64_t length) {
+  if (ctx == nullptr || !ctx->use_threads()) {
+    return 1;
+  }
+  return ::arrow::internal::NumParallelTasks(length, kMinParallelSortLength);
+}
+
+// Return how many of the first k values of the stable merge of the sorted
+// ranges `left` and `right` come from `left` (left values come first on ties)
+template <typename Less>
+int64_t MergeSplit(const uint64_t* left, int64_t left_length, const uint64_t* right,
+                   int64_t right_length, int64_t k, Less&& less) {
+  int64_t lo = std::max<int64_t>(0, k - right_length);
+  int64_t hi = std::min(k, left_length);
+  while (lo < hi) {
+    const int64_t i = lo + (hi - lo) / 2;
+    const int64_t j = k - i;
+    if (j > 0 && !less(right[j - 1], left[i])) {
+      // left[i] is merged before right[j - 1]
+      lo = i + 1;
+    } else {
+      hi = i;
+    }
+  }
+  return lo;
+}
+
+// Stably sort the indices in [begin, end).  With several tasks, contiguous
+// chunks are sorted by sort_chunk on the CPU thread pool, then merged pairwise
+// until one remains.  Each merge is split into several tasks as well, so that
+// the last rounds, which have few merges, still use all the threads.
+template <typename SortChunk, typename Less>
+Status ParallelSort(int num_tasks, uint64_t* begin, uint64_t* end,
+                    SortChunk&& sort_chunk, Less&& less) {
+  if (num_tasks <= 1) {
+    sort_chunk(begin, end);
+    return Status::OK();
+  }
+  const int64_t length = end - begin;
+  std::vector<int64_t> bounds(num_tasks + 1);
+  for (int i = 0; i <= num_tasks; ++i) {
+    bounds[i] = length * i / num_tasks;
+  }
+  RETURN_NOT_OK(::arrow::internal::ParallelFor(num_tasks, [&](int i) {
+    sort_chunk(begin + bounds[i], begin + bounds[i + 1]);
+    return Status::OK();
+  }));
+
+  std::vector<uint64_t> scratch(length);
+  uint64_t* src = begin;
+  uint64_t* dest = scratch.data();
+  while (bounds.size() > 2) {
+    const int num_chunks = static_cast<int>(bounds.size()) - 1;
+    const int num_merges = (num_chunks + 1) / 2;
+    const int parts_per_merge = std::max(1, num_tasks / num_merges);
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(
+        num_merges * parts_per_merge, [&](int task) {
+          const int merge = task / parts_per_merge;
+          const int part = task % parts_per_merge;
+          const int64_t merge_begin = bounds[2 * merge];
+          const int64_t middle = bounds[std::min(2 * merge + 1, num_chunks)];
+          const int64_t merge_end = bounds[std::min(2 * merge + 2, num_chunks)];
+          const uint64_t* left = src + merge_begin;
+          const uint64_t* right = src + middle;
+          const int64_t left_length = middle - merge_begin;
+          const int64_t right_length = merge_end - middle;
+          // This part produces the output values [k_begin, k_end) of the merge
+          const int64_t merge_length = merge_end - merge_begin;
+          const int64_t k_begin = merge_length * part / parts_per_merge;
+          const int64_t k_end = merge_length * (part + 1) / parts_per_merge;
+          const int64_t i_begin =
+              MergeSplit(left, left_length, right, right_length, k_begin, less);
+          const int64_t i_end =
+              MergeSplit(left, left_length, right, right_length, k_end, less);
+          std::merge(left + i_begin, left + i_end, right + (k_begin - i_begin),
+                     right + (k_end - i_end), dest + merge_begin + k_begin,
+                     [&](uint64_t l, uint64_t r) { return less(l, r); });
+          return Status::OK();
+        }));
+    std::vector<int64_t> merged_bounds;
+    for (int i = 0; i <= num_chunks; i += 2) {
+      merged_bounds.push_back(bounds[i]);
+    }
+    if (merged_bounds.back() != length) {
+      merged_bounds.push_back(length);
+    }
+    bounds = std::move(merged_bounds);
+    std::swap(src, dest);
+  }
+  if (src != begin) {
+    std::copy(src, src + length, begin);
+  }
+  return Status::OK();
+}
+
+// Stably sort strings with a MSD radix sort over 8-byte chunks: the values
+// are radix sorted by their first 8 bytes, then each run of values sharing
+// them by the next 8 bytes, and so on.  Short runs are sorted with
+// std::stable_sort.
+template <typename ArrayType>
+class StringRadixSort {
+ public:
+  StringRadixSort(const ArrayType& values, SortOrder order)
+      : values_(values), descending_(order == SortOrder::Descending) {}
+
+  void Sort(uint64_t* begin, uint64_t* end) { SortFrom(begin, end, 0); }
+
+  bool Less(uint64_t left, uint64_t right) const {
+    return descending_ ? values_.GetView(right) < values_.GetView(left)
+                       : values_.GetView(left) < values_.GetView(right);
+  }
+
+ private:
+  // The 8 bytes of the value starting at `depth`, zero-padded, as an integer
+  // in the same order
+  uint64_t ChunkKey(uint64_t index, int64_t depth) const {
+    const auto view = values_.GetView(index);
+    const int64_t length = static_cast<int64_t>(view.size()) - depth;
+    uint64_t chunk = 0;
+    if (length > 0) {
+      std::memcpy(&chunk, view.data() + depth, std::min<int64_t>(length, 8));
+    }
+    chunk = BitUtil::FromBigEndian(chunk);
+    return descending_ ? ~chunk : chunk;
+  }
+
+  // Sort values whose first `depth` bytes are all equal
+  void SortFrom(uint64_t* begin, uint64_t* end, int64_t depth) {
+    const int64_t length = end - begin;
+    if (length < kRadixSortMinLength) {
+      std::stable_sort(begin, end, [this](uint64_t left, uint64_t right) {
+        return Less(left, right);
+      });
+      return;
+    }
+    std::vector<uint64_t> keys(length);
+    for (int64_t i = 0; i < length; ++i) {
+      keys[i] = ChunkKey(begin[i], depth);
+    }
+    RadixSort(begin, keys.data(), length);
+
+    int64_t run_begin = 0;
+    for (int64_t i = 1; i <= length; ++i) {
+      if (i == length || keys[i] != keys[run_begin]) {
+        if (i - run_begin > 1) {
+          SortRun(begin + run_begin, begin + i, depth);
+        }
+        run_begin = i;
+      }
+    }
+  }
+
+  // Sort values whose first `depth` + 8 bytes are equal, once zero-padded
+  void SortRun(uint64_t* begin, uint64_t* end, int64_t depth) {
+    // The values ending within these 8 bytes sort by their length, before
+    // the values going on (after them if descending), which are sorted by
+    // their next bytes
+    auto remaining = [&](uint64_t index) {
+      return static_cast<int64_t>(values_.GetView(index).size()) - depth;
+    };
+    auto ends = [&](uint64_t index) { return remaining(index) <= 8; };
+    uint64_t* going_on_begin;
+    uint64_t* going_on_end;
+    uint64_t* ending_begin;
+    uint64_t* ending_end;
+    if (descending_) {
+      going_on_begin = begin;
+      going_on_end = ending_begin = std::stable_partition(
+          begin, end, [&](uint64_t index) { return !ends(index); });
+      ending_end = end;
+    } else {
+      ending_begin = begin;
+      ending_end = going_on_begin = std::stable_partition(begin, end, ends);
+      going_on_end = end;
+    }
+    if (ending_end - ending_begin > 1) {
+      std::stable_sort(ending_begin, ending_end, [&](uint64_t left, uint64_t right) {
+        return descending_ ? remaining(right) < remaining(left)
+                           : remaining(left) < remaining(right);
+      });
+    }
+    if (going_on_end - going_on_begin > 1) {
+      SortFrom(going_on_begin, going_on_end, depth + 8);
+    }
+  }
+
+  const ArrayType& values_;
+  const bool descending_;
+};
+
 }  // namespace
 
+// Sort fixed-width numbers with a radix sort over their keys
 template <typename ArrowType>
-class CompareSorter {
+class RadixSorter {
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using c_type = typename ArrowType::c_type;
+  using Key = typename RadixKey<c_type>::type;
 
  public:
-  void Sort(uint64_t* indices_begin, uint64_t* indices_end, const ArrayType& values) {
+  Status Sort(uint64_t* indices_begin, uint64_t* indices_end, const ArrayType& values,
+              SortOrder order, ExecContext* ctx) {
     std::iota(indices_begin, indices_end, 0);
 
     auto nulls_begin = indices_end;
@@ -126,10 +446,73 @@ class CompareSorter {
           std::stable_partition(indices_begin, indices_end,
                                 [&values](uint64_t ind) { return !values.IsNull(ind); });
     }
-    std::stable_sort(indices_begin, nulls_begin,
-                     [&values](uint64_t left, uint64_t right) {
-                       return values.GetView(left) < values.GetView(right);
-                     });
+    const c_type* data = values.raw_values();
+    // Complementing the keys reverses their order and keeps ties stable
+    const Key flip = order == SortOrder::Ascending ? Key(0) : static_cast<Key>(~Key(0));
+    auto key = [data, flip](uint64_t ind) {
+      return static_cast<Key>(RadixKey<c_type>::Get(data[ind]) ^ flip);
+    };
+    return ParallelSort(
+        NumSortTasks(ctx, nulls_begin - indices_begin), indices_begin, nulls_begin,
+        [&](uint64_t* begin, uint64_t* end) { RadixSortIndices(begin, end, key); },
+        [&](uint64_t left, uint64_t right) { return key(left) < key(right); });
+  }
+};
+
+// Sort strings with a MSD radix sort over their bytes
+template <typename ArrowType>
+class StringSorter {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+ public:
+  Status Sort(uint64_t* indices_begin, uint64_t* indices_end, const ArrayType& values,
+              SortOrder order, ExecContext* ctx) {
+    std::iota(indices_begin, indices_end, 0);
+
+    auto nulls_begin = indices_end;
+    if (values.null_count()) {
+      nulls_begin =
+          std::stable_partition(indices_begin, indices_end,
+                                [&values](uint64_t ind) { return !values.IsNull(ind); });
+    }
+    StringRadixSort<ArrayType> radix_sort(values, order);
+    return ParallelSort(
+        NumSortTasks(ctx, nulls_begin - indices_begin), indices_begin, nulls_begin,
+        [&](uint64_t* begin, uint64_t* end) { radix_sort.Sort(begin, end); },
+        [&](uint64_t left, uint64_t right) { return radix_sort.Less(left, right); });
+  }
+};
+
+// Sort binary views, comparing the inline prefixes before the bytes
+template <typename ArrowType>
+class BinaryViewSorter {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using ComparableBinaryView = ::arrow::internal::ComparableBinaryView;
+
+ public:
+  Status Sort(uint64_t* indices_begin, uint64_t* indices_end, const ArrayType& values,
+              SortOrder order, ExecContext* ctx) {
+    std::iota(indices_begin, indices_end, 0);
+
+    auto nulls_begin = indices_end;
+    if (values.null_count()) {
+      nulls_begin =
+          std::stable_partition(indices_begin, indices_end,
+                                [&values](uint64_t ind) { return !values.IsNull(ind); });
+    }
+    const auto views = values.raw_views();
+    const auto data_buffers = values.data()->buffers.data() + 2;
+    auto get_view = [&](uint64_t ind) {
+      return ComparableBinaryView(views[ind], data_buffers);
+    };
+    auto less = [&](uint64_t left, uint64_t right) {
+      return order == SortOrder::Ascending ? get_view(left) < get_view(right)
+                                           : get_view(right) < get_view(left);
+    };
+    return ParallelSort(
+        NumSortTasks(ctx, nulls_begin - indices_begin), indices_begin, nulls_begin,
+        [&](uint64_t* begin, uint64_t* end) { std::stable_sort(begin, end, less); },
+        less);
   }
 };
 
@@ -149,13 +532,15 @@ class CountSorter {
     value_range_ = static_cast<uint32_t>(max - min) + 1;
   }
 
-  void Sort(uint64_t* indices_begin, uint64_t* indices_end, const ArrayType& values) {
+  Status Sort(uint64_t* indices_begin, uint64_t* indices_end, const ArrayType& values,
+              SortOrder order, ExecContext* = NULLPTR) {
     // 32bit counter performs much better than 64bit one
     if (values.length() < (1LL << 32)) {
-      SortInternal<uint32_t>(indices_begin, indices_end, values);
+      SortInternal<uint32_t>(indices_begin, indices_end, values, order);
     } else {
-      SortInternal<uint64_t>(indices_begin, indices_end, values);
+      SortInternal<uint64_t>(indices_begin, indices_end, values, order);
     }
+    return Status::OK();
   }
 
  private:
@@ -164,18 +549,31 @@ class CountSorter {
 
   template <typename CounterType>
   void SortInternal(uint64_t* indices_begin, uint64_t* indices_end,
-                    const ArrayType& values) {
+                    const ArrayType& values, SortOrder order) {
     const uint32_t value_range = value_range_;
 
-    // first slot reserved for prefix sum
+    // last slot reserved for the start of the nulls
     std::vector<CounterType> counts(1 + value_range);
 
     VisitRawValuesInline(
-        values, [&](c_type v) { ++counts[v - min_ + 1]; }, []() {});
+        values, [&](c_type v) { ++counts[v - min_]; }, []() {});
 
-    for (uint32_t i = 1; i <= value_range; ++i) {
-      counts[i] += counts[i - 1];
+    // Turn the counts into output positions, walking the values in output order
+    CounterType position = 0;
+    if (order == SortOrder::Ascending) {
+      for (uint32_t i = 0; i < value_range; ++i) {
+        const CounterType count = counts[i];
+        counts[i] = position;
+        position += count;
+      }
+    } else {
+      for (uint32_t i = value_range; i > 0; --i) {
+        const CounterType count = counts[i - 1];
+        counts[i - 1] = position;
+        position += count;
+      }
     }
+    counts[value_range] = position;
 
     int64_t index = 0;
     VisitRawValuesInline(
@@ -184,16 +582,17 @@ class CountSorter {
   }
 };
 
-// Sort integers with counting sort or comparison based sorting algorithm
+// Sort integers with counting sort or radix sort
 // - Use O(n) counting sort if values are in a small range
-// - Use O(nlogn) std::stable_sort otherwise
+// - Use radix sort, in O(n) passes over the bytes of the values, otherwise
 template <typename ArrowType>
-class CountOrCompareSorter {
+class CountOrRadixSorter {
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
   using c_type = typename ArrowType::c_type;
 
  public:
-  void Sort(uint64_t* indices_begin, uint64_t* indices_end, const ArrayType& values) {
+  Status Sort(uint64_t* indices_begin, uint64_t* indices_end, const ArrayType& values,
+              SortOrder order, ExecContext* ctx) {
     if (values.length() >= countsort_min_len_ && values.length() > values.null_count()) {
       c_type min{std::numeric_limits<c_type>::max()};
       c_type max{std::numeric_limits<c_type>::min()};
@@ -211,19 +610,18 @@ class CountOrCompareSorter {
       if (static_cast<uint64_t>(max) - static_cast<uint64_t>(min) <=
           countsort_max_range_) {
         count_sorter_.SetMinMax(min, max);
-        count_sorter_.Sort(indices_begin, indices_end, values);
-        return;
+        return count_sorter_.Sort(indices_begin, indices_end, values, order);
       }
     }
 
-    compare_sorter_.Sort(indices_begin, indices_end, values);
+    return radix_sorter_.Sort(indices_begin, indices_end, values, order, ctx);
   }
 
  private:
-  CompareSorter<ArrowType> compare_sorter_;
+  RadixSorter<ArrowType> radix_sorter_;
   CountSorter<ArrowType> count_sorter_;
 
-  // Cross point to prefer counting sort than stl::stable_sort(merge sort)
+  // Cross point to prefer counting sort than radix sort
   // - array to be sorted is longer than "count_min_len_"
   // - value range (max-min) is within "count_max_range_"
   //
@@ -254,17 +652,26 @@ struct Sorter<Int8Type> {
 template <typename Type>
 struct Sorter<Type, enable_if_t<is_integer_type<Type>::value &&
                                 (sizeof(typename Type::c_type) > 1)>> {
-  CountOrCompareSorter<Type> impl;
+  CountOrRadixSorter<Type> impl;
 };
 
 template <typename Type>
-struct Sorter<Type, enable_if_t<is_floating_type<Type>::value ||
-                                is_base_binary_type<Type>::value>> {
-  CompareSorter<Type> impl;
+struct Sorter<Type, enable_if_t<is_floating_type<Type>::value>> {
+  RadixSorter<Type> impl;
+};
+
+template <typename Type>
+struct Sorter<Type, enable_if_t<is_base_binary_type<Type>::value>> {
+  StringSorter<Type> impl;
+};
+
+template <typename Type>
+struct Sorter<Type, enable_if_binary_view<Type>> {
+  BinaryViewSorter<Type> impl;
 };
 
 template <typename OutType, typename InType>
-struct SortIndices {
+struct ArraySortIndices {
   using ArrayType = typename TypeTraits<InType>::ArrayType;
   static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
     std::shared_ptr<ArrayData> arg0;
@@ -276,17 +683,584 @@ struct SortIndices {
     uint64_t* out_begin = out_arr->GetMutableValues<uint64_t>(1);
     uint64_t* out_end = out_begin + arr.length();
 
+    const auto& options = ArraySortIndicesState::Get(ctx);
     Sorter<InType> sorter;
-    sorter.impl.Sort(out_begin, out_end, arr);
+    KERNEL_RETURN_IF_ERROR(ctx, sorter.impl.Sort(out_begin, out_end, arr, options.order,
+                                                 ctx->exec_context()));
   }
 };
 
+// ----------------------------------------------------------------------
+// sort_indices implementation for ChunkedArray, RecordBatch and Table
+
+namespace {
+
+using internal::ChunkResolver;
+
+// Sorts a range of row indices by the values of a single (possibly chunked)
+// column
+class ColumnSorter {
+ public:
+  using RunVisitor = std::function<void(uint64_t*, uint64_t*)>;
+
+  virtual ~ColumnSorter() = default;
+
+  // Stably sort the row indices in [begin, end) by the column values, with
+  // nulls placed at the end regardless of order.  Return the start of the
+  // nulls.
+  virtual uint64_t* Sort(uint64_t* begin, uint64_t* end) = 0;
+
+  // Visit each run of equal values in sorted [begin, end).  The nulls in
+  // [nulls_begin, end) form a single run and are not compared.
+  virtual void VisitEqualRuns(uint64_t* begin, uint64_t* nulls_begin, uint64_t* end,
+                              const RunVisitor& visit) const = 0;
+
+  // Compare two rows in sort order, with nulls after all values.  Return a
+  // negative number, zero or a positive number.
+  virtual int Compare(uint64_t left, uint64_t right) const = 0;
+};
+
+template <typename ArrowType>
+class ConcreteColumnSorter : public ColumnSorter {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using ValueType = decltype(std::declval<ArrayType>().GetView(0));
+
+ public:
+  ConcreteColumnSorter(const ArrayVector& chunks, SortOrder order)
+      : resolver_(chunks), order_(order) {
+    for (const auto& chunk : chunks) {
+      chunks_.push_back(checked_cast<const ArrayType*>(chunk.get()));
+      null_count_ += chunk->null_count();
+    }
+  }
+
+  uint64_t* Sort(uint64_t* begin, uint64_t* end) override {
+    uint64_t* nulls_begin = end;
+    if (null_count_ > 0) {
+      nulls_begin = std::stable_partition(
+          begin, end, [this](uint64_t index) { return !IsNull(index); });
+    }
+    SortNonNulls(begin, nulls_begin);
+    return nulls_begin;
+  }
+
+  void VisitEqualRuns(uint64_t* begin, uint64_t* nulls_begin, uint64_t* end,
+                      const RunVisitor& visit) const override {
+    if (begin != nulls_begin) {
+      uint64_t* run_begin = begin;
+      ValueType run_value = GetView(*begin);
+      for (uint64_t* it = begin + 1; it != nulls_begin; ++it) {
+        ValueType value = GetView(*it);
+        if (!(value == run_value)) {
+          visit(run_begin, it);
+          run_begin = it;
+          run_value = value;
+        }
+      }
+      visit(run_begin, nulls_begin);
+    }
+    if (nulls_begin != end) {
+      visit(nulls_begin, end);
+    }
+  }
+
+  int Compare(uint64_t left, uint64_t right) const override {
+    if (null_count_ > 0) {
+      const bool left_null = IsNull(left), right_null = IsNull(right);
+      if (left_null || right_null) {
+        return static_cast<int>(left_null) - static_cast<int>(right_null);
+      }
+    }
+    ValueType left_value = GetView(left), right_value = GetView(right);
+    if (left_value == right_value) {
+      return 0;
+    }
+    return (left_value < right_value) == (order_ == SortOrder::Ascending) ? -1 : 1;
+  }
+
+ private:
+  bool IsNull(uint64_t index) const {
+    auto loc = resolver_.Resolve(index);
+    return chunks_[loc.first]->IsNull(loc.second);
+  }
+
+  ValueType GetView(uint64_t index) const {
+    auto loc = resolver_.Resolve(index);
+    return chunks_[loc.first]->GetView(loc.second);
+  }
+
+  // Integers in a small range are sorted with a counting sort, which is
+  // worthwhile for long runs of ties on a preceding sort key as well.
+  template <typename T = ArrowType>
+  enable_if_t<is_integer_type<T>::value> SortNonNulls(uint64_t* begin, uint64_t* end) {
+    if (end - begin >= kCountSortMinLength) {
+      ValueType min = GetView(*begin), max = min;
+      for (uint64_t* it = begin + 1; it != end; ++it) {
+        ValueType value = GetView(*it);
+        min = std::min(min, value);
+        max = std::max(max, value);
+      }
+      // Cast to uint64_t before subtraction so that the range can't overflow
+      if (static_cast<uint64_t>(max) - static_cast<uint64_t>(min) <=
+          kCountSortMaxRange) {
+        CountSort(begin, end, min, max);
+        return;
+      }
+    }
+    CompareSort(begin, end);
+  }
+
+  template <typename T = ArrowType>
+  enable_if_t<!is_integer_type<T>::value> SortNonNulls(uint64_t* begin, uint64_t* end) {
+    CompareSort(begin, end);
+  }
+
+  void CompareSort(uint64_t* begin, uint64_t* end) {
+    if (order_ == SortOrder::Ascending) {
+      std::stable_sort(begin, end, [this](uint64_t left, uint64_t right) {
+        return GetView(left) < GetView(right);
+      });
+    } else {
+      std::stable_sort(begin, end, [this](uint64_t left, uint64_t right) {
+        return GetView(right) < GetView(left);
+      });
+    }
+  }
+
+  void CountSort(uint64_t* begin, uint64_t* end, ValueType min, ValueType max) {
+    auto Key = [min](ValueType value) {
+      return static_cast<uint64_t>(value) - static_cast<uint64_t>(min);
+    };
+    const uint64_t value_range = Key(max) + 1;
+
+    std::vector<int64_t> positions(value_range, 0);
+    for (uint64_t* it = begin; it != end; ++it) {
+      ++positions[Key(GetView(*it))];
+    }
+    int64_t position = 0;
+    if (order_ == SortOrder::Ascending) {
+      for (uint64_t i = 0; i < value_range; ++i) {
+        const int64_t count = positions[i];
+        positions[i] = position;
+        position += count;
+      }
+    } else {
+      for (uint64_t i = value_range; i > 0; --i) {
+        const int64_t count = positions[i - 1];
+        positions[i - 1] = position;
+        position += count;
+      }
+    }
+
+    // Scatter in input order, which keeps the sort stable
+    std::vector<uint64_t> sorted(end - begin);
+    for (uint64_t* it = begin; it != end; ++it) {
+      sorted[positions[Key(GetView(*it))]++] = *it;
+    }
+    std::copy(sorted.begin(), sorted.end(), begin);
+  }
+
+  // Same cross points as CountOrRadixSorter
+  static constexpr int64_t kCountSortMinLength = 1024;
+  static constexpr uint64_t kCountSortMaxRange = 4096;
+
+  ChunkResolver resolver_;
+  std::vector<const ArrayType*> chunks_;
+  int64_t null_count_ = 0;
+  SortOrder order_;
+};
+
+template <typename ArrowType>
+constexpr int64_t ConcreteColumnSorter<ArrowType>::kCountSortMinLength;
+
+template <typename ArrowType>
+constexpr uint64_t ConcreteColumnSorter<ArrowType>::kCountSortMaxRange;
+
+// Types supported by sort_indices and select_k_unstable beyond plain arrays
+template <typename T, typename R = void>
+using enable_if_sortable =
+    enable_if_t<is_integer_type<T>::value || is_physical_floating_type<T>::value ||
+                    is_base_binary_type<T>::value,
+                R>;
+
+struct ColumnSorterFactory {
+  template <typename T>
+  enable_if_sortable<T, Status> Visit(const T&) {
+    out.reset(new ConcreteColumnSorter<T>(*chunks, order));
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::TypeError("Sorting not supported for type ", type.ToString());
+  }
+
+  static Result<std::unique_ptr<ColumnSorter>> Make(const DataType& type,
+                                                    const ArrayVector& chunks,
+                                                    SortOrder order) {
+    ColumnSorterFactory factory{&chunks, order, nullptr};
+    RETURN_NOT_OK(VisitTypeInline(type, &factory));
+    return std::move(factory.out);
+  }
+
+  const ArrayVector* chunks;
+  SortOrder order;
+  std::unique_ptr<ColumnSorter> out;
+};
+
+// Sorts row indices by several columns.  The rows are sorted by the first
+// key, then each run of ties is sorted by the next key, and so on: every pass
+// only ever compares values of a single column.
+class MultipleKeySorter {
+ public:
+  explicit MultipleKeySorter(std::vector<std::unique_ptr<ColumnSorter>> sorters)
+      : sorters_(std::move(sorters)) {}
+
+  void Sort(uint64_t* begin, uint64_t* end) { SortLevel(0, begin, end); }
+
+ private:
+  void SortLevel(size_t level, uint64_t* begin, uint64_t* end) {
+    if (end - begin <= 1) {
+      return;
+    }
+    ColumnSorter* sorter = sorters_[level].get();
+    uint64_t* nulls_begin = sorter->Sort(begin, end);
+    if (level + 1 == sorters_.size()) {
+      return;
+    }
+    sorter->VisitEqualRuns(begin, nulls_begin, end,
+                           [&](uint64_t* run_begin, uint64_t* run_end) {
+                             SortLevel(level + 1, run_begin, run_end);
+                           });
+  }
+
+  std::vector<std::unique_ptr<ColumnSorter>> sorters_;
+};
+
+struct ResolvedSortKey {
+  std::shared_ptr<DataType> type;
+  ArrayVector chunks;
+  SortOrder order;
+};
+
+Result<std::shared_ptr<Array>> SortIndicesByKeys(int64_t length,
+                                                 const std::vector<ResolvedSortKey>& keys,
+                                                 ExecContext* ctx) {
+  std::vector<std::unique_ptr<ColumnSorter>> sorters;
+  for (const auto& key : keys) {
+    ARROW_ASSIGN_OR_RAISE(auto sorter,
+                          ColumnSorterFactory::Make(*key.type, key.chunks, key.order));
+    sorters.push_back(std::move(sorter));
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto indices,
+                        AllocateBuffer(length * sizeof(uint64_t), ctx->memory_pool()));
+  auto indices_begin = reinterpret_cast<uint64_t*>(indices->mutable_data());
+  auto indices_end = indices_begin + length;
+  std::iota(indices_begin, indices_end, 0);
+
+  MultipleKeySorter sorter(std::move(sorters));
+  sorter.Sort(indices_begin, indices_end);
+  return std::make_shared<UInt64Array>(length, std::move(indices));
+}
+
+Result<std::vector<ResolvedSortKey>> ResolveSortKeys(
+    const Schema& schema, const std::vector<SortKey>& sort_keys,
+    std::function<ArrayVector(int)> get_chunks) {
+  if (sort_keys.empty()) {
+    return Status::Invalid("Must specify one or more sort keys");
+  }
+  std::vector<ResolvedSortKey> resolved;
+  for (const auto& sort_key : sort_keys) {
+    const int i = schema.GetFieldIndex(sort_key.name);
+    if (i < 0) {
+      return Status::Invalid("Nonexistent sort key column: ", sort_key.name);
+    }
+    resolved.push_back({schema.field(i)->type(), get_chunks(i), sort_key.order});
+  }
+  return resolved;
+}
+
+Result<std::shared_ptr<Array>> SortChunkedArray(const ChunkedArray& chunked_array,
+                                                SortOrder order, ExecContext* ctx) {
+  return SortIndicesByKeys(chunked_array.length(),
+                           {{chunked_array.type(), chunked_array.chunks(), order}}, ctx);
+}
+
+Result<std::shared_ptr<Array>> SortRecordBatch(const RecordBatch& batch,
+                                               const SortOptions& options,
+                                               ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(auto keys, ResolveSortKeys(*batch.schema(), options.sort_keys,
+                                                   [&batch](int i) -> ArrayVector {
+                                                     return {batch.column(i)};
+                                                   }));
+  return SortIndicesByKeys(batch.num_rows(), keys, ctx);
+}
+
+Result<std::shared_ptr<Array>> SortTable(const Table& table, const SortOptions& options,
+                                         ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(auto keys, ResolveSortKeys(*table.schema(), options.sort_keys,
+                                                   [&table](int i) -> ArrayVector {
+                                                     return table.column(i)->chunks();
+                                                   }));
+  return SortIndicesByKeys(table.num_rows(), keys, ctx);
+}
+
+const auto kDefaultArraySortOptions = ArraySortOptions::Defaults();
+const auto kDefaultSortOptions = SortOptions::Defaults();
+
+class SortIndicesMetaFunction : public MetaFunction {
+ public:
+  SortIndicesMetaFunction()
+      : MetaFunction("sort_indices", Arity::Unary(), &kDefaultSortOptions) {}
+
+  Result<Datum> ExecuteImpl(const std::vector<Datum>& args,
+                            const FunctionOptions* options,
+                            ExecContext* ctx) const override {
+    const auto& sort_options = static_cast<const SortOptions&>(*options);
+    // Array-like inputs only look at the order of the first key
+    SortOrder order = SortOrder::Ascending;
+    if (!sort_options.sort_keys.empty()) {
+      order = sort_options.sort_keys[0].order;
+    }
+    switch (args[0].kind()) {
+      case Datum::ARRAY: {
+        ArraySortOptions array_options(order);
+        return CallFunction("array_sort_indices", args, &array_options, ctx);
+      }
+      case Datum::CHUNKED_ARRAY:
+        return SortChunkedArray(*args[0].chunked_array(), order, ctx);
+      case Datum::RECORD_BATCH:
+        return SortRecordBatch(*args[0].record_batch(), sort_options, ctx);
+      case Datum::TABLE:
+        return SortTable(*args[0].table(), sort_options, ctx);
+      default:
+        break;
+    }
+    return Status::NotImplemented("Unsupported types for sort_indices operation: ",
+                                  args[0].ToString());
+  }
+};
+
+// ----------------------------------------------------------------------
+// select_k_unstable implementation
+
+// Push `entry` into a bounded max-heap of at most `k` entries ordered by
+// `less`, so that the heap always holds the `k` first entries in `less` order
+// seen so far, with the last of them at the front.
+template <typename Entry, typename Less>
+void PushBounded(std::vector<Entry>* heap, size_t k, Entry entry, Less&& less) {
+  if (heap->size() < k) {
+    heap->push_back(std::move(entry));
+    std::push_heap(heap->begin(), heap->end(), less);
+  } else if (k > 0 && less(entry, heap->front())) {
+    std::pop_heap(heap->begin(), heap->end(), less);
+    heap->back() = std::move(entry);
+    std::push_heap(heap->begin(), heap->end(), less);
+  }
+}
+
+Result<std::shared_ptr<Array>> MakeIndicesArray(const std::vector<uint64_t>& indices,
+                                                ExecContext* ctx) {
+  const auto length = static_cast<int64_t>(indices.size());
+  ARROW_ASSIGN_OR_RAISE(auto buffer,
+                        AllocateBuffer(length * sizeof(uint64_t), ctx->memory_pool()));
+  std::copy(indices.begin(), indices.end(),
+            reinterpret_cast<uint64_t*>(buffer->mutable_data()));
+  return std::make_shared<UInt64Array>(length, std::move(buffer));
+}
+
+// Select on a single key.  The heap holds (value, row index) pairs so that
+// comparisons against the current k-th value don't need to look up rows in
+// other chunks.  Nulls are only selected if there are fewer than k values.
+template <typename ArrowType>
+class SingleKeySelector {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using ValueType = decltype(std::declval<ArrayType>().GetView(0));
+  using Entry = std::pair<ValueType, uint64_t>;
+
+ public:
+  static Result<std::shared_ptr<Array>> Select(const ArrayVector& chunks, int64_t k,
+                                               SortOrder order, ExecContext* ctx) {
+    std::vector<Entry> heap;
+    if (order == SortOrder::Ascending) {
+      heap = SelectValues(chunks, k, [](const Entry& left, const Entry& right) {
+        return left.first < right.first;
+      });
+    } else {
+      heap = SelectValues(chunks, k, [](const Entry& left, const Entry& right) {
+        return right.first < left.first;
+      });
+    }
+
+    std::vector<uint64_t> indices;
+    indices.reserve(heap.size());
+    for (const auto& entry : heap) {
+      indices.push_back(entry.second);
+    }
+    uint64_t offset = 0;
+    for (const auto& chunk : chunks) {
+      for (int64_t i = 0;
+           i < chunk->length() && static_cast<int64_t>(indices.size()) < k; ++i) {
+        if (chunk->IsNull(i)) {
+          indices.push_back(offset + i);
+        }
+      }
+      offset += chunk->length();
+    }
+    return MakeIndicesArray(indices, ctx);
+  }
+
+ private:
+  // Return the selected entries, sorted
+  template <typename Less>
+  static std::vector<Entry> SelectValues(const ArrayVector& chunks, int64_t k,
+                                         Less&& less) {
+    int64_t length = 0;
+    for (const auto& chunk : chunks) {
+      length += chunk->length();
+    }
+    std::vector<Entry> heap;
+    heap.reserve(static_cast<size_t>(std::min(k, length)));
+    uint64_t offset = 0;
+    for (const auto& chunk : chunks) {
+      const auto& values = checked_cast<const ArrayType&>(*chunk);
+      if (values.null_count() == 0) {
+        for (int64_t i = 0; i < values.length(); ++i) {
+          PushBounded(&heap, k, Entry(values.GetView(i), offset + i), less);
+        }
+      } else {
+        for (int64_t i = 0; i < values.length(); ++i) {
+          if (values.IsValid(i)) {
+            PushBounded(&heap, k, Entry(values.GetView(i), offset + i), less);
+          }
+        }
+      }
+      offset += values.length();
+    }
+    std::sort_heap(heap.begin(), heap.end(), less);
+    return heap;
+  }
+};
+
+struct SingleKeySelectorVisitor {
+  template <typename T>
+  enable_if_sortable<T, Status> Visit(const T&) {
+    return SingleKeySelector<T>::Select(*chunks, k, order, ctx).Value(&out);
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::TypeError("select_k_unstable not supported for type ",
+                             type.ToString());
+  }
+
+  const ArrayVector* chunks;
+  int64_t k;
+  SortOrder order;
+  ExecContext* ctx;
+  std::shared_ptr<Array> out;
+};
+
+Result<std::shared_ptr<Array>> SelectKByKeys(int64_t length, int64_t k,
+                                             const std::vector<ResolvedSortKey>& keys,
+                                             ExecContext* ctx) {
+  if (keys.size() == 1) {
+    SingleKeySelectorVisitor visitor{&keys[0].chunks, k, keys[0].order, ctx, nullptr};
+    RETURN_NOT_OK(VisitTypeInline(*keys[0].type, &visitor));
+    return std::move(visitor.out);
+  }
+
+  std::vector<std::unique_ptr<ColumnSorter>> comparators;
+  for (const auto& key : keys) {
+    ARROW_ASSIGN_OR_RAISE(auto comparator,
+                          ColumnSorterFactory::Make(*key.type, key.chunks, key.order));
+    comparators.push_back(std::move(comparator));
+  }
+  auto less = [&comparators](uint64_t left, uint64_t right) {
+    for (const auto& comparator : comparators) {
+      const int cmp = comparator->Compare(left, right);
+      if (cmp != 0) {
+        return cmp < 0;
+      }
+    }
+    return false;
+  };
+
+  std::vector<uint64_t> heap;
+  heap.reserve(static_cast<size_t>(std::min(k, length)));
+  for (int64_t i = 0; i < length; ++i) {
+    PushBounded(&heap, k, static_cast<uint64_t>(i), less);
+  }
+  std::sort_heap(heap.begin(), heap.end(), less);
+  return MakeIndicesArray(heap, ctx);
+}
+
+const auto kDefaultSelectKOptions = SelectKOptions::Defaults();
+
+class SelectKUnstableMetaFunction : public MetaFunction {
+ public:
+  SelectKUnstableMetaFunction()
+      : MetaFunction("select_k_unstable", Arity::Unary(), &kDefaultSelectKOptions) {}
+
+  Result<Datum> ExecuteImpl(const std::vector<Datum>& args,
+                            const FunctionOptions* options,
+                            ExecContext* ctx) const override {
+    const auto& select_options = static_cast<const SelectKOptions&>(*options);
+    if (select_options.k < 0) {
+      return Status::Invalid("select_k_unstable requires a nonnegative `k`, got ",
+                             select_options.k);
+    }
+    if (select_options.sort_keys.empty()) {
+      return Status::Invalid("select_k_unstable requires one or more sort keys");
+    }
+    const int64_t k = select_options.k;
+    // Array-like inputs only look at the order of the first key
+    const SortOrder order = select_options.sort_keys[0].order;
+    switch (args[0].kind()) {
+      case Datum::ARRAY: {
+        auto array = args[0].make_array();
+        return SelectKByKeys(array->length(), k, {{array->type(), {array}, order}}, ctx);
+      }
+      case Datum::CHUNKED_ARRAY: {
+        const auto& chunked_array = *args[0].chunked_array();
+        return SelectKByKeys(chunked_array.length(), k,
+                             {{chunked_array.type(), chunked_array.chunks(), order}},
+                             ctx);
+      }
+      case Datum::RECORD_BATCH: {
+        const auto& batch = *args[0].record_batch();
+        ARROW_ASSIGN_OR_RAISE(auto keys,
+                              ResolveSortKeys(*batch.schema(), select_options.sort_keys,
+                                              [&batch](int i) -> ArrayVector {
+                                                return {batch.column(i)};
+                                              }));
+        return SelectKByKeys(batch.num_rows(), k, keys, ctx);
+      }
+      case Datum::TABLE: {
+        const auto& table = *args[0].table();
+        ARROW_ASSIGN_OR_RAISE(
+            auto keys, ResolveSortKeys(*table.schema(), select_options.sort_keys,
+                                       [&table](int i) -> ArrayVector {
+                                         return table.column(i)->chunks();
+                                       }));
+        return SelectKByKeys(table.num_rows(), k, keys, ctx);
+      }
+      default:
+        break;
+    }
+    return Status::NotImplemented("Unsupported types for select_k_unstable operation: ",
+                                  args[0].ToString());
+  }
+};
+
+}  // namespace
+
 namespace internal {
 
 // Sort indices kernels implemented for
 //
 // * Number types
 // * Base binary types
+// * Binary view types
 
 template <template <typename...> class ExecTemplate>
 void AddSortingKernels(VectorKernel base, VectorFunction* func) {
@@ -300,6 +1274,12 @@ void AddSortingKernels(VectorKernel base, VectorFunction* func) {
     base.exec = GenerateVarBinaryBase<ExecTemplate, UInt64Type>(*ty);
     DCHECK_OK(func->AddKernel(base));
   }
+  base.signature = KernelSignature::Make({InputType::Array(binary_view())}, uint64());
+  base.exec = ExecTemplate<UInt64Type, BinaryViewType>::Exec;
+  DCHECK_OK(func->AddKernel(base));
+  base.signature = KernelSignature::Make({InputType::Array(utf8_view())}, uint64());
+  base.exec = ExecTemplate<UInt64Type, StringViewType>::Exec;
+  DCHECK_OK(func->AddKernel(base));
 }
 
 void RegisterVectorSort(FunctionRegistry* registry) {
@@ -308,9 +1288,17 @@ void RegisterVectorSort(FunctionRegistry* registry) {
   base.mem_allocation = MemAllocation::PREALLOCATE;
   base.null_handling = NullHandling::OUTPUT_NOT_NULL;
 
-  auto sort_indices = std::make_shared<VectorFunction>("sort_indices", Arity::Unary());
-  AddSortingKernels<SortIndices>(base, sort_indices.get());
-  DCHECK_OK(registry->AddFunction(std::move(sort_indices)));
+  // array_sort_indices has a parameter so needs its init function
+  auto array_sort_indices = std::make_shared<VectorFunction>(
+      "array_sort_indices", Arity::Unary(), &kDefaultArraySortOptions);
+  base.init = ArraySortIndicesState::Init;
+  AddSortingKernels<ArraySortIndices>(base, array_sort_indices.get());
+  DCHECK_OK(registry->AddFunction(std::move(array_sort_indices)));
+
+  // sort_indices dispatches on the kind of input and handles multiple sort keys
+  DCHECK_OK(registry->AddFunction(std::make_shared<SortIndicesMetaFunction>()));
+
+  DCHECK_OK(registry->AddFunction(std::make_shared<SelectKUnstableMetaFunction>()));
 
   // partition_nth_indices has a parameter so needs its init function
   auto part_indices =
@@ -22,6 +22,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/util/benchmark_util.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace compute {
@@ -59,6 +60,74 @@ static void SortToIndicesInt64Compare(benchmark::State& state) {
   SortToIndicesBenchmark(state, values);
 }
 
+static void SortToIndicesFloat64(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(double);
+  auto rand = random::RandomArrayGenerator(kSeed);
+
+  auto values = rand.Float64(array_size, -1e9, 1e9, args.null_proportion);
+
+  SortToIndicesBenchmark(state, values);
+}
+
+static void SortToIndicesString(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  // Strings of 16 bytes on average
+  const int64_t array_size = args.size / 16;
+  auto rand = random::RandomArrayGenerator(kSeed);
+
+  auto values = rand.String(array_size, 0, 32, args.null_proportion);
+
+  SortToIndicesBenchmark(state, values);
+}
+
+// Sort a large array on a CPU thread pool of the given capacity, to show
+// how the parallel sort scales with the number of cores
+static void SortToIndicesThreadsBenchmark(benchmark::State& state,
+                                          const std::shared_ptr<Array>& values) {
+  const int threads = static_cast<int>(state.range(0));
+  const int previous_capacity = GetCpuThreadPoolCapacity();
+  ABORT_NOT_OK(SetCpuThreadPoolCapacity(threads));
+
+  ExecContext ctx;
+  ctx.set_use_threads(true);
+  for (auto _ : state) {
+    ABORT_NOT_OK(SortIndices(*values, SortOrder::Ascending, &ctx).status());
+  }
+  state.SetItemsProcessed(state.iterations() * values->length());
+
+  ABORT_NOT_OK(SetCpuThreadPoolCapacity(previous_capacity));
+}
+
+static void SortToIndicesInt64Threads(benchmark::State& state) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+
+  auto min = std::numeric_limits<int64_t>::min();
+  auto max = std::numeric_limits<int64_t>::max();
+  auto values = rand.Int64(1 << 24, min, max, /*null_probability=*/0.01);
+
+  SortToIndicesThreadsBenchmark(state, values);
+}
+
+static void SortToIndicesStringThreads(benchmark::State& state) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+
+  auto values = rand.String(1 << 22, 0, 32, /*null_probability=*/0.01);
+
+  SortToIndicesThreadsBenchmark(state, values);
+}
+
+static void ThreadsArgs(benchmark::internal::Benchmark* b) {
+  for (const int threads : {1, 2, 4, 8, 16}) {
+    b->Args({threads});
+  }
+  b->ArgNames({"threads"});
+  b->UseRealTime();
+  b->Unit(benchmark::TimeUnit::kMillisecond);
+}
+
 BENCHMARK(SortToIndicesInt64Count)
     ->Apply(RegressionSetArgs)
     ->Args({1 << 20, 1})
@@ -73,5 +142,22 @@ BENCHMARK(SortToIndicesInt64Compare)
     ->MinTime(1.0)
     ->Unit(benchmark::TimeUnit::kNanosecond);
 
+BENCHMARK(SortToIndicesFloat64)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->Args({1 << 23, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(SortToIndicesString)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->Args({1 << 23, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(SortToIndicesInt64Threads)->Apply(ThreadsArgs);
+BENCHMARK(SortToIndicesStringThreads)->Apply(ThreadsArgs);
+
 }  // namespace compute
 }  // namespace arrow
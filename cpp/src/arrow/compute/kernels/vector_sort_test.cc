@@ -17,11 +17,13 @@
 
 #include <limits>
 #include <memory>
+#include <random>
 #include <string>
 #include <vector>
 
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/test_util.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -30,6 +32,7 @@
 
 namespace arrow {
 
+using internal::checked_cast;
 using internal::checked_pointer_cast;
 
 namespace compute {
@@ -237,7 +240,8 @@ TYPED_TEST_SUITE(TestSortToIndicesKernelForIntegral, IntegralArrowTypes);
 
 template <typename ArrowType>
 class TestSortToIndicesKernelForStrings : public TestSortToIndicesKernel<ArrowType> {};
-TYPED_TEST_SUITE(TestSortToIndicesKernelForStrings, testing::Types<StringType>);
+using SortableStringTypes = testing::Types<StringType, StringViewType, BinaryViewType>;
+TYPED_TEST_SUITE(TestSortToIndicesKernelForStrings, SortableStringTypes);
 
 TYPED_TEST(TestSortToIndicesKernelForReal, SortReal) {
   this->AssertSortToIndices("[]", "[]");
@@ -275,6 +279,11 @@ TYPED_TEST(TestSortToIndicesKernelForStrings, SortStrings) {
   this->AssertSortToIndices(R"(["foo", "bar", "baz"])", "[1,2,0]");
 
   this->AssertSortToIndices(R"(["testing", "sort", "for", "strings"])", "[2, 1, 3, 0]");
+
+  // Values sharing their prefix, some long enough to be stored out of line
+  this->AssertSortToIndices(
+      R"(["abcdefghijklmo", null, "abcd", "abcdefghijklmn", "abc", "abcdefghijklm", ""])",
+      "[6, 4, 2, 5, 3, 0, 1]");
 }
 
 template <typename ArrowType>
@@ -336,8 +345,8 @@ TYPED_TEST(TestSortToIndicesKernelRandom, SortRandomValues) {
 }
 
 // Long array with small value range: counting sort
-// - length >= 1024(CountCompareSorter::countsort_min_len_)
-// - range  <= 4096(CountCompareSorter::countsort_max_range_)
+// - length >= 1024(CountOrRadixSorter::countsort_min_len_)
+// - range  <= 4096(CountOrRadixSorter::countsort_max_range_)
 TYPED_TEST_SUITE(TestSortToIndicesKernelRandomCount, IntegralArrowTypes);
 
 TYPED_TEST(TestSortToIndicesKernelRandomCount, SortRandomValuesCount) {
@@ -357,7 +366,7 @@ TYPED_TEST(TestSortToIndicesKernelRandomCount, SortRandomValuesCount) {
   }
 }
 
-// Long array with big value range: std::stable_sort
+// Long array with big value range: radix sort
 TYPED_TEST_SUITE(TestSortToIndicesKernelRandomCompare, IntegralArrowTypes);
 
 TYPED_TEST(TestSortToIndicesKernelRandomCompare, SortRandomValuesCompare) {
@@ -376,5 +385,305 @@ TYPED_TEST(TestSortToIndicesKernelRandomCompare, SortRandomValuesCompare) {
   }
 }
 
+
+TEST(TestSortIndices, ArrayDescending) {
+  auto values = ArrayFromJSON(float64(), "[null, 1, 3.3, null, 2, 5.3]");
+  ASSERT_OK_AND_ASSIGN(auto offsets, SortIndices(*values, SortOrder::Descending));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[5, 2, 4, 1, 0, 3]"), *offsets);
+
+  values = ArrayFromJSON(uint8(), "[255, null, 0, 255, 10, null, 128, 0]");
+  ASSERT_OK_AND_ASSIGN(offsets, SortIndices(*values, SortOrder::Descending));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[0, 3, 6, 4, 2, 7, 1, 5]"), *offsets);
+
+  SortOptions options({SortKey("ignored", SortOrder::Descending)});
+  ASSERT_OK_AND_ASSIGN(offsets, SortIndices(Datum(values), options));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[0, 3, 6, 4, 2, 7, 1, 5]"), *offsets);
+}
+
+TEST(TestSortIndices, ChunkedArray) {
+  auto chunked = ChunkedArrayFromJSON(
+      utf8(), {R"(["b", null])", "[]", R"(["a", "c", "b"])", R"([null, "a"])"});
+  ASSERT_OK_AND_ASSIGN(auto offsets, SortIndices(*chunked));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[2, 6, 0, 4, 3, 1, 5]"), *offsets);
+
+  ASSERT_OK_AND_ASSIGN(offsets, SortIndices(*chunked, SortOrder::Descending));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[3, 0, 4, 2, 6, 1, 5]"), *offsets);
+}
+
+TEST(TestSortIndices, RecordBatchMultipleKeys) {
+  auto schema = ::arrow::schema({field("a", int32()), field("b", utf8())});
+  auto batch = RecordBatchFromJSON(schema, R"([
+    {"a": 1,    "b": "x"},
+    {"a": 1,    "b": "y"},
+    {"a": 2,    "b": "x"},
+    {"a": null, "b": "x"},
+    {"a": null, "b": "z"},
+    {"a": 1,    "b": null}
+  ])");
+
+  SortOptions options({SortKey("a"), SortKey("b", SortOrder::Descending)});
+  ASSERT_OK_AND_ASSIGN(auto offsets, SortIndices(Datum(batch), options));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[1, 0, 5, 2, 4, 3]"), *offsets);
+
+  options = SortOptions({SortKey("b"), SortKey("a", SortOrder::Descending)});
+  ASSERT_OK_AND_ASSIGN(offsets, SortIndices(Datum(batch), options));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[2, 0, 3, 1, 4, 5]"), *offsets);
+
+  ASSERT_RAISES(Invalid, SortIndices(Datum(batch), SortOptions()));
+  ASSERT_RAISES(Invalid, SortIndices(Datum(batch), SortOptions({SortKey("c")})));
+}
+
+TEST(TestSortIndices, TableMultipleKeys) {
+  auto schema = ::arrow::schema({field("a", uint8()), field("b", float64())});
+  auto table = TableFromJSON(schema, {R"([{"a": 3, "b": 1.5},
+                                          {"a": 1, "b": null}])",
+                                      R"([{"a": 3, "b": 0.5},
+                                          {"a": null, "b": 2.0},
+                                          {"a": 1, "b": 4.0}])",
+                                      R"([{"a": 3, "b": 1.5}])"});
+
+  SortOptions options(
+      {SortKey("a", SortOrder::Descending), SortKey("b", SortOrder::Ascending)});
+  ASSERT_OK_AND_ASSIGN(auto offsets, SortIndices(Datum(table), options));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[2, 0, 5, 4, 1, 3]"), *offsets);
+}
+
+// Compare two rows on one column, with nulls after all values
+template <typename ArrayType>
+int CompareRows(const ArrayType& array, uint64_t left, uint64_t right,
+                SortOrder order) {
+  const bool left_null = array.IsNull(left), right_null = array.IsNull(right);
+  if (left_null || right_null) {
+    return static_cast<int>(left_null) - static_cast<int>(right_null);
+  }
+  if (array.GetView(left) == array.GetView(right)) {
+    return 0;
+  }
+  const bool less = array.GetView(left) < array.GetView(right);
+  return less == (order == SortOrder::Ascending) ? -1 : 1;
+}
+
+// Check multiple key sorting against a straightforward comparison of all keys,
+// with enough ties on narrow integer keys to exercise the counting sort path.
+TEST(TestSortIndices, TableRandom) {
+  auto rand = random::RandomArrayGenerator(0x5487658);
+  const int64_t length = 5000;
+  auto schema = ::arrow::schema(
+      {field("a", int16()), field("b", float64()), field("c", utf8())});
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int64_t chunk_length : {2000, 0, 3000}) {
+    batches.push_back(RecordBatch::Make(
+        schema, chunk_length,
+        {rand.Int16(chunk_length, -5, 5, /*null_probability=*/0.1),
+         rand.Float64(chunk_length, -2, 2, /*null_probability=*/0.1),
+         rand.String(chunk_length, 0, 2, /*null_probability=*/0.1)}));
+  }
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(batches));
+  ASSERT_OK_AND_ASSIGN(auto combined, table->CombineChunks());
+  auto batch = RecordBatch::Make(schema, length,
+                                 {combined->column(0)->chunk(0),
+                                  combined->column(1)->chunk(0),
+                                  combined->column(2)->chunk(0)});
+
+  const auto& a = checked_cast<const Int16Array&>(*batch->column(0));
+  const auto& b = checked_cast<const DoubleArray&>(*batch->column(1));
+  const auto& c = checked_cast<const StringArray&>(*batch->column(2));
+
+  SortOptions options({SortKey("a", SortOrder::Descending), SortKey("c"),
+                       SortKey("b", SortOrder::Descending)});
+  for (const auto& datum : {Datum(table), Datum(batch)}) {
+    ASSERT_OK_AND_ASSIGN(auto offsets, SortIndices(datum, options));
+    ASSERT_OK(offsets->ValidateFull());
+    ASSERT_EQ(length, offsets->length());
+    const auto& indices = checked_cast<const UInt64Array&>(*offsets);
+    for (int64_t i = 1; i < length; ++i) {
+      const uint64_t left = indices.Value(i - 1), right = indices.Value(i);
+      int cmp = CompareRows(a, left, right, SortOrder::Descending);
+      if (cmp == 0) cmp = CompareRows(c, left, right, SortOrder::Ascending);
+      if (cmp == 0) cmp = CompareRows(b, left, right, SortOrder::Descending);
+      // Ties must keep their input order
+      ASSERT_TRUE(cmp < 0 || (cmp == 0 && left < right)) << "at " << i;
+    }
+  }
+}
+
+// Arrays long enough to be sorted in parallel, with enough ties and shared
+// string prefixes to exercise all the paths of the radix sorts
+TEST(TestSortIndices, LargeArrays) {
+  auto rand = random::RandomArrayGenerator(0x5487659);
+  const int64_t length = 300000;
+  std::default_random_engine engine(0x5487659);
+
+  DoubleBuilder double_builder;
+  const double double_values[] = {-0.0, 0.0, -1.5, 1.5, -1e300, 1e300, 0.25};
+  std::uniform_int_distribution<int> double_choice(0, 6);
+  StringBuilder string_builder;
+  const char string_bytes[] = {'\0', 'a', '\xff'};
+  std::uniform_int_distribution<int> string_length(0, 20), string_byte(0, 2);
+  for (int64_t i = 0; i < length; ++i) {
+    ASSERT_OK(double_builder.Append(double_values[double_choice(engine)]));
+    std::string value(string_length(engine), '\0');
+    for (char& c : value) {
+      c = string_bytes[string_byte(engine)];
+    }
+    ASSERT_OK(string_builder.Append(value));
+  }
+  std::shared_ptr<Array> doubles, strings;
+  ASSERT_OK(double_builder.Finish(&doubles));
+  ASSERT_OK(string_builder.Finish(&strings));
+
+  const std::vector<std::shared_ptr<Array>> arrays = {
+      rand.Int64(length, std::numeric_limits<int64_t>::min(),
+                 std::numeric_limits<int64_t>::max(), /*null_probability=*/0.1),
+      rand.Int16(length, -10000, 10000, /*null_probability=*/0.1),
+      rand.Float32(length, -1000, 1000, /*null_probability=*/0.1), doubles,
+      rand.String(length, 0, 30, /*null_probability=*/0.1), strings};
+
+  for (const auto& values : arrays) {
+    for (auto order : {SortOrder::Ascending, SortOrder::Descending}) {
+      for (bool use_threads : {false, true}) {
+        SCOPED_TRACE(values->type()->ToString() + ", order " +
+                     std::to_string(static_cast<int>(order)) + ", use_threads " +
+                     std::to_string(use_threads));
+        ExecContext ctx;
+        ctx.set_use_threads(use_threads);
+        ASSERT_OK_AND_ASSIGN(auto offsets, SortIndices(*values, order, &ctx));
+        ASSERT_OK(offsets->ValidateFull());
+        ASSERT_EQ(length, offsets->length());
+        const auto& indices = checked_cast<const UInt64Array&>(*offsets);
+        for (int64_t i = 1; i < length; ++i) {
+          const uint64_t left = indices.Value(i - 1), right = indices.Value(i);
+          int cmp;
+          switch (values->type_id()) {
+            case Type::INT64:
+              cmp = CompareRows(checked_cast<const Int64Array&>(*values), left, right,
+                                order);
+              break;
+            case Type::INT16:
+              cmp = CompareRows(checked_cast<const Int16Array&>(*values), left, right,
+                                order);
+              break;
+            case Type::FLOAT:
+              cmp = CompareRows(checked_cast<const FloatArray&>(*values), left, right,
+                                order);
+              break;
+            case Type::DOUBLE:
+              cmp = CompareRows(checked_cast<const DoubleArray&>(*values), left, right,
+                                order);
+              break;
+            default:
+              cmp = CompareRows(checked_cast<const StringArray&>(*values), left, right,
+                                order);
+              break;
+          }
+          // Ties must keep their input order
+          ASSERT_TRUE(cmp < 0 || (cmp == 0 && left < right)) << "at " << i;
+        }
+      }
+    }
+  }
+}
+
+TEST(TestSelectKUnstable, Array) {
+  auto values = ArrayFromJSON(float64(), "[null, 1, 3.3, null, 2, 5.3]");
+  ASSERT_OK_AND_ASSIGN(auto offsets,
+                       SelectKUnstable(values, SelectKOptions::TopKDefault(2)));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[5, 2]"), *offsets);
+
+  ASSERT_OK_AND_ASSIGN(offsets,
+                       SelectKUnstable(values, SelectKOptions::BottomKDefault(3)));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[1, 4, 2]"), *offsets);
+
+  // Nulls are only selected once the values run out
+  ASSERT_OK_AND_ASSIGN(offsets, SelectKUnstable(values, SelectKOptions::TopKDefault(5)));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[5, 2, 4, 1, 0]"), *offsets);
+
+  ASSERT_OK_AND_ASSIGN(offsets, SelectKUnstable(values, SelectKOptions::TopKDefault(10)));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[5, 2, 4, 1, 0, 3]"), *offsets);
+
+  ASSERT_OK_AND_ASSIGN(offsets, SelectKUnstable(values, SelectKOptions::TopKDefault(0)));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[]"), *offsets);
+
+  ASSERT_RAISES(Invalid, SelectKUnstable(values, SelectKOptions()));
+  ASSERT_RAISES(Invalid, SelectKUnstable(values, SelectKOptions(2)));
+}
+
+TEST(TestSelectKUnstable, ChunkedArray) {
+  auto chunked = ChunkedArrayFromJSON(
+      utf8(), {R"(["b", null])", "[]", R"(["a", "d", "c"])", R"([null, "e"])"});
+  ASSERT_OK_AND_ASSIGN(
+      auto offsets, SelectKUnstable(Datum(chunked), SelectKOptions::TopKDefault(3)));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[6, 3, 4]"), *offsets);
+
+  ASSERT_OK_AND_ASSIGN(
+      offsets, SelectKUnstable(Datum(chunked), SelectKOptions::BottomKDefault(2)));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[2, 0]"), *offsets);
+}
+
+TEST(TestSelectKUnstable, RecordBatchMultipleKeys) {
+  auto schema = ::arrow::schema({field("a", int32()), field("b", utf8())});
+  auto batch = RecordBatchFromJSON(schema, R"([
+    {"a": 1,    "b": "x"},
+    {"a": 3,    "b": "y"},
+    {"a": 2,    "b": "x"},
+    {"a": null, "b": "x"},
+    {"a": 3,    "b": "z"},
+    {"a": 1,    "b": null}
+  ])");
+
+  SelectKOptions options(3, {SortKey("a", SortOrder::Descending), SortKey("b")});
+  ASSERT_OK_AND_ASSIGN(auto offsets, SelectKUnstable(Datum(batch), options));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[1, 4, 2]"), *offsets);
+
+  ASSERT_OK_AND_ASSIGN(
+      offsets, SelectKUnstable(Datum(batch), SelectKOptions::BottomKDefault(2, {"a"})));
+  std::shared_ptr<Array> expected = ArrayFromJSON(uint64(), "[0, 5]");
+  if (!offsets->Equals(*expected)) {
+    // Ties can come in any order
+    AssertArraysEqual(*ArrayFromJSON(uint64(), "[5, 0]"), *offsets);
+  }
+
+  ASSERT_RAISES(Invalid,
+                SelectKUnstable(Datum(batch), SelectKOptions::TopKDefault(1, {"c"})));
+}
+
+// The selected rows should be the first k rows of a full sort, up to ties
+TEST(TestSelectKUnstable, TableRandom) {
+  auto rand = random::RandomArrayGenerator(0x5487659);
+  auto schema = ::arrow::schema({field("a", int64()), field("b", utf8())});
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int64_t chunk_length : {700, 0, 1300}) {
+    batches.push_back(RecordBatch::Make(
+        schema, chunk_length,
+        {rand.Int64(chunk_length, -50, 50, /*null_probability=*/0.1),
+         rand.String(chunk_length, 0, 3, /*null_probability=*/0.1)}));
+  }
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(batches));
+
+  for (const auto& keys : std::vector<std::vector<SortKey>>{
+           {SortKey("a", SortOrder::Descending)},
+           {SortKey("b"), SortKey("a", SortOrder::Descending)}}) {
+    ASSERT_OK_AND_ASSIGN(auto sorted, SortIndices(Datum(table), SortOptions(keys)));
+    ASSERT_OK_AND_ASSIGN(auto sorted_rows, Take(Datum(table), Datum(sorted)));
+    for (int64_t k : {1, 10, 100, 2000, 3000}) {
+      ASSERT_OK_AND_ASSIGN(auto selected,
+                           SelectKUnstable(Datum(table), SelectKOptions(k, keys)));
+      ASSERT_OK(selected->ValidateFull());
+      ASSERT_EQ(std::min<int64_t>(k, table->num_rows()), selected->length());
+      ASSERT_OK_AND_ASSIGN(auto selected_rows, Take(Datum(table), Datum(selected)));
+
+      // Compare the key values, since ties may have been selected differently
+      for (const auto& key : keys) {
+        auto expected = sorted_rows.table()->GetColumnByName(key.name)->Slice(
+            0, selected->length());
+        auto actual = selected_rows.table()->GetColumnByName(key.name);
+        ASSERT_TRUE(expected->Equals(*actual)) << "k = " << k;
+      }
+    }
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,548 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Vector kernels whose outputs depend on the preceding or following values:
+// cumulative aggregates, rolling window aggregates and lag / lead shifts.
+//
+// The kernels have finalizers, so that the executor runs them serially over
+// the chunks of a ChunkedArray, in order. Each kernel carries the state it
+// needs from one chunk to the next (the running aggregate, the values of the
+// current window, or the chunks that shifted values are read from) instead of
+// concatenating the chunks.
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
+#include "arrow/util/int_util_internal.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::CopyBitmap;
+
+namespace compute {
+namespace internal {
+
+namespace {
+
+// The finalizer of the kernels whose outputs are complete after each chunk
+void NoFinalize(KernelContext*, std::vector<Datum>*) {}
+
+void SetOutputBit(ArrayData* output, int64_t i, bool valid, int64_t* null_count) {
+  BitUtil::SetBitTo(output->buffers[0]->mutable_data(), output->offset + i, valid);
+  *null_count += !valid;
+}
+
+// Integer overflow wraps around, as in the "add" function
+template <typename T>
+enable_if_t<std::is_integral<T>::value, T> AddValue(T a, T b) {
+  return arrow::internal::SafeSignedAdd(a, b);
+}
+
+template <typename T>
+enable_if_t<std::is_floating_point<T>::value, T> AddValue(T a, T b) {
+  return a + b;
+}
+
+template <typename T>
+enable_if_t<std::is_integral<T>::value, T> SubtractValue(T a, T b) {
+  return arrow::internal::SafeSignedSubtract(a, b);
+}
+
+template <typename T>
+enable_if_t<std::is_floating_point<T>::value, T> SubtractValue(T a, T b) {
+  return a - b;
+}
+
+// ----------------------------------------------------------------------
+// Cumulative aggregates
+
+struct CumulativeSum {
+  template <typename T>
+  static T Call(T acc, T value) {
+    return AddValue(acc, value);
+  }
+};
+
+struct CumulativeMin {
+  template <typename T>
+  static T Call(T acc, T value) {
+    return std::min(acc, value);
+  }
+};
+
+struct CumulativeMax {
+  template <typename T>
+  static T Call(T acc, T value) {
+    return std::max(acc, value);
+  }
+};
+
+template <typename Type, typename Op>
+struct CumulativeKernel {
+  using T = typename Type::c_type;
+
+  struct State : public KernelState {
+    explicit State(CumulativeOptions options) : options(options) {}
+
+    CumulativeOptions options;
+    T acc = T(0);
+    bool has_acc = false;
+    bool null_seen = false;
+  };
+
+  static std::unique_ptr<KernelState> Init(KernelContext* ctx,
+                                           const KernelInitArgs& args) {
+    return ::arrow::internal::make_unique<State>(
+        *static_cast<const CumulativeOptions*>(args.options));
+  }
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    auto state = checked_cast<State*>(ctx->state());
+    ArrayData* output = out->mutable_array();
+    T* out_values = output->GetMutableValues<T>(1);
+    int64_t null_count = 0;
+    int64_t i = 0;
+    VisitArrayValuesInline<Type>(
+        *batch[0].array(),
+        [&](T value) {
+          if (state->null_seen) {
+            out_values[i] = T(0);
+            SetOutputBit(output, i++, false, &null_count);
+            return;
+          }
+          state->acc = state->has_acc ? Op::Call(state->acc, value) : value;
+          state->has_acc = true;
+          out_values[i] = state->acc;
+          SetOutputBit(output, i++, true, &null_count);
+        },
+        [&]() {
+          state->null_seen = !state->options.skip_nulls;
+          out_values[i] = T(0);
+          SetOutputBit(output, i++, false, &null_count);
+        });
+    output->null_count = null_count;
+  }
+};
+
+// ----------------------------------------------------------------------
+// Rolling window aggregates
+
+template <typename T>
+enable_if_t<std::is_floating_point<T>::value, bool> IsFinite(T value) {
+  return std::isfinite(value);
+}
+
+template <typename T>
+enable_if_t<!std::is_floating_point<T>::value, bool> IsFinite(T) {
+  return true;
+}
+
+// The sum of a window is updated in O(1) as values enter and leave it. Sums
+// are accumulated in int64, uint64 or double as in the "sum" aggregate.
+// Non-finite floating-point values are kept out of the running sum, so that
+// an infinity leaving the window does not turn the sum into NaN; while the
+// window holds any, its sum is recomputed from its values.
+template <typename ArgType, typename AccType, bool kMean>
+struct RollingKernel {
+  using ArgValue = typename ArgType::c_type;
+  using Acc = typename AccType::c_type;
+  using OutValue = typename std::conditional<kMean, double, Acc>::type;
+
+  struct State : public KernelState {
+    explicit State(RollingOptions options)
+        : options(options),
+          values(static_cast<size_t>(options.window_size)),
+          valid(static_cast<size_t>(options.window_size)) {}
+
+    void Push(Acc value, bool is_valid) {
+      const size_t slot = static_cast<size_t>(num_seen % options.window_size);
+      if (num_seen >= options.window_size && valid[slot]) {
+        Remove(values[slot]);
+      }
+      values[slot] = value;
+      valid[slot] = is_valid;
+      if (is_valid) {
+        Add(value);
+      }
+      ++num_seen;
+    }
+
+    void Add(Acc value) {
+      ++count;
+      if (IsFinite(value)) {
+        sum = AddValue(sum, value);
+      } else {
+        ++num_non_finite;
+      }
+    }
+
+    void Remove(Acc value) {
+      --count;
+      if (IsFinite(value)) {
+        sum = SubtractValue(sum, value);
+      } else {
+        --num_non_finite;
+      }
+    }
+
+    Acc Sum() const {
+      if (num_non_finite == 0) {
+        return sum;
+      }
+      const size_t window = static_cast<size_t>(std::min(num_seen, options.window_size));
+      Acc total = Acc(0);
+      for (size_t slot = 0; slot < window; ++slot) {
+        if (valid[slot]) {
+          total = AddValue(total, values[slot]);
+        }
+      }
+      return total;
+    }
+
+    RollingOptions options;
+    // The values of the window, as a ring buffer
+    std::vector<Acc> values;
+    std::vector<bool> valid;
+    int64_t num_seen = 0;
+    // The number of valid values in the window, and their sum
+    int64_t count = 0;
+    Acc sum = Acc(0);
+    int64_t num_non_finite = 0;
+  };
+
+  static std::unique_ptr<KernelState> Init(KernelContext* ctx,
+                                           const KernelInitArgs& args) {
+    RollingOptions options = *static_cast<const RollingOptions*>(args.options);
+    if (options.min_periods < 0) {
+      options.min_periods = options.window_size;
+    }
+    if (options.window_size <= 0 || options.min_periods == 0 ||
+        options.min_periods > options.window_size) {
+      ctx->SetStatus(Status::Invalid(
+          "Rolling windows need 0 < min_periods <= window_size, got window_size ",
+          options.window_size, " and min_periods ", options.min_periods));
+      return nullptr;
+    }
+    return ::arrow::internal::make_unique<State>(options);
+  }
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    auto state = checked_cast<State*>(ctx->state());
+    ArrayData* output = out->mutable_array();
+    OutValue* out_values = output->GetMutableValues<OutValue>(1);
+    int64_t null_count = 0;
+    int64_t i = 0;
+    auto emit = [&]() {
+      if (state->count < state->options.min_periods) {
+        out_values[i] = OutValue(0);
+        SetOutputBit(output, i++, false, &null_count);
+        return;
+      }
+      const Acc sum = state->Sum();
+      out_values[i] = kMean ? static_cast<OutValue>(static_cast<double>(sum) /
+                                                    static_cast<double>(state->count))
+                            : static_cast<OutValue>(sum);
+      SetOutputBit(output, i++, true, &null_count);
+    };
+    VisitArrayValuesInline<ArgType>(
+        *batch[0].array(),
+        [&](ArgValue value) {
+          state->Push(static_cast<Acc>(value), true);
+          emit();
+        },
+        [&]() {
+          state->Push(Acc(0), false);
+          emit();
+        });
+    output->null_count = null_count;
+  }
+};
+
+// ----------------------------------------------------------------------
+// lag / lead
+
+// Copy `length` fixed-width values and their validity from `input`, starting
+// at `in_pos`, to `output` at `out_pos`
+void CopyValues(const ArrayData& input, int64_t in_pos, int64_t length,
+                ArrayData* output, int64_t out_pos) {
+  uint8_t* out_valid = output->buffers[0]->mutable_data();
+  if (input.MayHaveNulls()) {
+    CopyBitmap(input.buffers[0]->data(), input.offset + in_pos, length, out_valid,
+               output->offset + out_pos);
+  } else {
+    BitUtil::SetBitsTo(out_valid, output->offset + out_pos, length, true);
+  }
+  const int bit_width = checked_cast<const FixedWidthType&>(*output->type).bit_width();
+  uint8_t* out_values = output->buffers[1]->mutable_data();
+  if (bit_width == 1) {
+    CopyBitmap(input.buffers[1]->data(), input.offset + in_pos, length, out_values,
+               output->offset + out_pos);
+  } else {
+    const int64_t width = bit_width / 8;
+    std::memcpy(out_values + (output->offset + out_pos) * width,
+                input.buffers[1]->data() + (input.offset + in_pos) * width,
+                static_cast<size_t>(length * width));
+  }
+}
+
+void SetNulls(ArrayData* output, int64_t out_pos, int64_t length) {
+  BitUtil::SetBitsTo(output->buffers[0]->mutable_data(), output->offset + out_pos,
+                     length, false);
+  const int bit_width = checked_cast<const FixedWidthType&>(*output->type).bit_width();
+  uint8_t* out_values = output->buffers[1]->mutable_data();
+  if (bit_width == 1) {
+    BitUtil::SetBitsTo(out_values, output->offset + out_pos, length, false);
+  } else {
+    const int64_t width = bit_width / 8;
+    std::memset(out_values + (output->offset + out_pos) * width, 0,
+                static_cast<size_t>(length * width));
+  }
+}
+
+struct ShiftState : public KernelState {
+  struct Chunk {
+    int64_t start;
+    std::shared_ptr<ArrayData> data;
+  };
+
+  ShiftState(int64_t periods, bool lead) : periods(periods), lead(lead) {}
+
+  // Fill the `length` values of `output`, which starts at position `start` of
+  // the input, from the input `periods` positions before (lag) or after (lead)
+  void Fill(int64_t start, int64_t length, ArrayData* output) const {
+    auto chunk = chunks.begin();
+    int64_t pos = 0;
+    while (pos < length) {
+      const int64_t source = start + pos + (lead ? periods : -periods);
+      if (source < 0 || source >= num_seen) {
+        const int64_t run =
+            source < 0 ? std::min(length - pos, -source) : length - pos;
+        SetNulls(output, pos, run);
+        pos += run;
+        continue;
+      }
+      while (chunk->start + chunk->data->length <= source) {
+        ++chunk;
+      }
+      const int64_t run =
+          std::min(length - pos, chunk->start + chunk->data->length - source);
+      CopyValues(*chunk->data, source - chunk->start, run, output, pos);
+      pos += run;
+    }
+    output->null_count = kUnknownNullCount;
+  }
+
+  const int64_t periods;
+  const bool lead;
+  // The input chunks that values may still be shifted from
+  std::deque<Chunk> chunks;
+  int64_t num_seen = 0;
+};
+
+std::unique_ptr<KernelState> ShiftInit(KernelContext* ctx, const KernelInitArgs& args,
+                                       bool lead) {
+  const auto& options = *static_cast<const ShiftOptions*>(args.options);
+  if (options.periods < 0) {
+    ctx->SetStatus(
+        Status::Invalid("Shift periods must be nonnegative, got ", options.periods));
+    return nullptr;
+  }
+  return ::arrow::internal::make_unique<ShiftState>(options.periods, lead);
+}
+
+std::unique_ptr<KernelState> LagInit(KernelContext* ctx, const KernelInitArgs& args) {
+  return ShiftInit(ctx, args, /*lead=*/false);
+}
+
+std::unique_ptr<KernelState> LeadInit(KernelContext* ctx, const KernelInitArgs& args) {
+  return ShiftInit(ctx, args, /*lead=*/true);
+}
+
+// lag outputs only read the current and preceding chunks, so they are filled
+// right away and the chunks that no later output reads are released
+void LagExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  auto state = checked_cast<ShiftState*>(ctx->state());
+  const int64_t start = state->num_seen;
+  state->chunks.push_back({start, batch[0].array()});
+  state->num_seen += batch.length;
+  state->Fill(start, batch.length, out->mutable_array());
+  while (!state->chunks.empty() &&
+         state->chunks.front().start + state->chunks.front().data->length <=
+             state->num_seen - state->periods) {
+    state->chunks.pop_front();
+  }
+}
+
+// lead outputs read the following chunks, so they are filled by the finalizer
+void LeadExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  auto state = checked_cast<ShiftState*>(ctx->state());
+  state->chunks.push_back({state->num_seen, batch[0].array()});
+  state->num_seen += batch.length;
+}
+
+void LeadFinalize(KernelContext* ctx, std::vector<Datum>* out) {
+  auto state = checked_cast<ShiftState*>(ctx->state());
+  int64_t start = 0;
+  for (Datum& datum : *out) {
+    ArrayData* output = datum.mutable_array();
+    state->Fill(start, output->length, output);
+    start += output->length;
+  }
+}
+
+// ----------------------------------------------------------------------
+// Registration
+
+// Integers are summed in 64 bits, floating point numbers in double
+template <typename Type, typename Enable = void>
+struct RollingAccType {
+  using type = DoubleType;
+};
+
+template <typename Type>
+struct RollingAccType<Type, enable_if_signed_integer<Type>> {
+  using type = Int64Type;
+};
+
+template <typename Type>
+struct RollingAccType<Type, enable_if_unsigned_integer<Type>> {
+  using type = UInt64Type;
+};
+
+template <typename Visitor>
+void VisitNumericTypes(Visitor&& visitor) {
+  visitor.template Visit<Int8Type>();
+  visitor.template Visit<Int16Type>();
+  visitor.template Visit<Int32Type>();
+  visitor.template Visit<Int64Type>();
+  visitor.template Visit<UInt8Type>();
+  visitor.template Visit<UInt16Type>();
+  visitor.template Visit<UInt32Type>();
+  visitor.template Visit<UInt64Type>();
+  visitor.template Visit<FloatType>();
+  visitor.template Visit<DoubleType>();
+}
+
+VectorKernel MakeWindowKernel(InputType in_type, OutputType out_type, KernelInit init,
+                              ArrayKernelExec exec,
+                              VectorFinalize finalize = NoFinalize) {
+  VectorKernel kernel({std::move(in_type)}, std::move(out_type), std::move(exec),
+                      std::move(init), std::move(finalize));
+  kernel.null_handling = NullHandling::COMPUTED_PREALLOCATE;
+  kernel.mem_allocation = MemAllocation::PREALLOCATE;
+  kernel.can_execute_chunkwise = true;
+  kernel.output_chunked = true;
+  return kernel;
+}
+
+template <typename Op>
+struct AddCumulativeKernels {
+  template <typename Type>
+  void Visit() {
+    using Kernel = CumulativeKernel<Type, Op>;
+    auto ty = TypeTraits<Type>::type_singleton();
+    DCHECK_OK(func->AddKernel(
+        MakeWindowKernel(InputType::Array(ty), ty, Kernel::Init, Kernel::Exec)));
+  }
+
+  VectorFunction* func;
+};
+
+template <bool kMean>
+struct AddRollingKernels {
+  template <typename Type>
+  void Visit() {
+    using AccType = typename RollingAccType<Type>::type;
+    using Kernel = RollingKernel<Type, AccType, kMean>;
+    auto out_type = kMean ? float64() : TypeTraits<AccType>::type_singleton();
+    DCHECK_OK(func->AddKernel(MakeWindowKernel(InputType::Array(Type::type_id),
+                                               out_type, Kernel::Init, Kernel::Exec)));
+  }
+
+  VectorFunction* func;
+};
+
+void AddShiftKernels(VectorFunction* func, KernelInit init, ArrayKernelExec exec,
+                     VectorFinalize finalize) {
+  for (Type::type id :
+       {Type::BOOL, Type::INT8, Type::INT16, Type::INT32, Type::INT64, Type::UINT8,
+        Type::UINT16, Type::UINT32, Type::UINT64, Type::HALF_FLOAT, Type::FLOAT,
+        Type::DOUBLE, Type::DATE32, Type::DATE64, Type::TIMESTAMP, Type::TIME32,
+        Type::TIME64, Type::DURATION, Type::INTERVAL_MONTHS, Type::INTERVAL_DAY_TIME,
+        Type::DECIMAL, Type::FIXED_SIZE_BINARY}) {
+    DCHECK_OK(func->AddKernel(
+        MakeWindowKernel(InputType::Array(id), OutputType(FirstType), init, exec,
+                         finalize)));
+  }
+}
+
+const auto kDefaultCumulativeOptions = CumulativeOptions::Defaults();
+const auto kDefaultRollingOptions = RollingOptions::Defaults();
+const auto kDefaultShiftOptions = ShiftOptions::Defaults();
+
+}  // namespace
+
+void RegisterVectorWindow(FunctionRegistry* registry) {
+  auto cumulative_sum = std::make_shared<VectorFunction>(
+      "cumulative_sum", Arity::Unary(), &kDefaultCumulativeOptions);
+  VisitNumericTypes(AddCumulativeKernels<CumulativeSum>{cumulative_sum.get()});
+  DCHECK_OK(registry->AddFunction(std::move(cumulative_sum)));
+
+  auto cumulative_min = std::make_shared<VectorFunction>(
+      "cumulative_min", Arity::Unary(), &kDefaultCumulativeOptions);
+  VisitNumericTypes(AddCumulativeKernels<CumulativeMin>{cumulative_min.get()});
+  DCHECK_OK(registry->AddFunction(std::move(cumulative_min)));
+
+  auto cumulative_max = std::make_shared<VectorFunction>(
+      "cumulative_max", Arity::Unary(), &kDefaultCumulativeOptions);
+  VisitNumericTypes(AddCumulativeKernels<CumulativeMax>{cumulative_max.get()});
+  DCHECK_OK(registry->AddFunction(std::move(cumulative_max)));
+
+  auto rolling_sum = std::make_shared<VectorFunction>("rolling_sum", Arity::Unary(),
+                                                      &kDefaultRollingOptions);
+  VisitNumericTypes(AddRollingKernels</*kMean=*/false>{rolling_sum.get()});
+  DCHECK_OK(registry->AddFunction(std::move(rolling_sum)));
+
+  auto rolling_mean = std::make_shared<VectorFunction>("rolling_mean", Arity::Unary(),
+                                                       &kDefaultRollingOptions);
+  VisitNumericTypes(AddRollingKernels</*kMean=*/true>{rolling_mean.get()});
+  DCHECK_OK(registry->AddFunction(std::move(rolling_mean)));
+
+  auto lag =
+      std::make_shared<VectorFunction>("lag", Arity::Unary(), &kDefaultShiftOptions);
+  AddShiftKernels(lag.get(), LagInit, LagExec, NoFinalize);
+  DCHECK_OK(registry->AddFunction(std::move(lag)));
+
+  auto lead =
+      std::make_shared<VectorFunction>("lead", Arity::Unary(), &kDefaultShiftOptions);
+  AddShiftKernels(lead.get(), LeadInit, LeadExec, LeadFinalize);
+  DCHECK_OK(registry->AddFunction(std::move(lead)));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
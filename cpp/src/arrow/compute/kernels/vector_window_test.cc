@@ -0,0 +1,203 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+// Split an array into chunks of the given lengths, the last chunk taking the
+// remaining values
+std::shared_ptr<ChunkedArray> SplitArray(const std::shared_ptr<Array>& array,
+                                         const std::vector<int64_t>& lengths) {
+  ArrayVector chunks;
+  int64_t offset = 0;
+  for (int64_t length : lengths) {
+    chunks.push_back(array->Slice(offset, length));
+    offset += length;
+  }
+  chunks.push_back(array->Slice(offset));
+  return std::make_shared<ChunkedArray>(std::move(chunks), array->type());
+}
+
+// Check a window function on an array, and on the array split into chunks
+void CheckWindow(const std::string& func_name, const FunctionOptions& options,
+                 const std::shared_ptr<Array>& input,
+                 const std::shared_ptr<Array>& expected) {
+  ASSERT_OK_AND_ASSIGN(Datum result, CallFunction(func_name, {input}, &options));
+  ASSERT_OK(result.make_array()->ValidateFull());
+  AssertArraysEqual(*expected, *result.make_array(), /*verbose=*/true);
+
+  for (const std::vector<int64_t>& lengths : std::vector<std::vector<int64_t>>{
+           {1}, {0, 2, 0}, {1, 1, 1, 1}, {input->length() / 2}}) {
+    if (std::accumulate(lengths.begin(), lengths.end(), int64_t(0)) > input->length()) {
+      continue;
+    }
+    auto chunked = SplitArray(input, lengths);
+    ASSERT_OK_AND_ASSIGN(result, CallFunction(func_name, {chunked}, &options));
+    ASSERT_EQ(Datum::CHUNKED_ARRAY, result.kind());
+    ASSERT_OK(result.chunked_array()->ValidateFull());
+    AssertChunkedEquivalent(ChunkedArray(expected), *result.chunked_array());
+  }
+}
+
+void CheckWindow(const std::string& func_name, const FunctionOptions& options,
+                 const std::shared_ptr<DataType>& type, const std::string& input,
+                 const std::shared_ptr<DataType>& out_type, const std::string& expected) {
+  CheckWindow(func_name, options, ArrayFromJSON(type, input),
+              ArrayFromJSON(out_type, expected));
+}
+
+TEST(TestCumulative, Basics) {
+  const std::string input = "[1, 3, null, -2, 5]";
+  for (const auto& type : {int8(), int64(), float64()}) {
+    CheckWindow("cumulative_sum", CumulativeOptions(), type, input, type,
+                "[1, 4, null, null, null]");
+    CheckWindow("cumulative_sum", CumulativeOptions(/*skip_nulls=*/true), type, input,
+                type, "[1, 4, null, 2, 7]");
+    CheckWindow("cumulative_min", CumulativeOptions(/*skip_nulls=*/true), type, input,
+                type, "[1, 1, null, -2, -2]");
+    CheckWindow("cumulative_max", CumulativeOptions(/*skip_nulls=*/true), type, input,
+                type, "[1, 3, null, 3, 5]");
+    CheckWindow("cumulative_max", CumulativeOptions(), type, input, type,
+                "[1, 3, null, null, null]");
+  }
+  CheckWindow("cumulative_sum", CumulativeOptions(), uint8(), "[200, 100, 1]", uint8(),
+              "[200, 44, 45]");
+  CheckWindow("cumulative_sum", CumulativeOptions(), int32(), "[]", int32(), "[]");
+}
+
+TEST(TestRolling, Basics) {
+  const std::string input = "[1, 2, 3, null, 5, 6, 7]";
+  CheckWindow("rolling_sum", RollingOptions(3), int32(), input, int64(),
+              "[null, null, 6, null, null, null, 18]");
+  CheckWindow("rolling_sum", RollingOptions(3, /*min_periods=*/2), int32(), input,
+              int64(), "[null, 3, 6, 5, 8, 11, 18]");
+  CheckWindow("rolling_sum", RollingOptions(3, /*min_periods=*/1), uint16(), input,
+              uint64(), "[1, 3, 6, 5, 8, 11, 18]");
+  CheckWindow("rolling_mean", RollingOptions(3, /*min_periods=*/2), int8(), input,
+              float64(), "[null, 1.5, 2, 2.5, 4, 5.5, 6]");
+  CheckWindow("rolling_mean", RollingOptions(1), float32(), input, float64(),
+              "[1, 2, 3, null, 5, 6, 7]");
+  CheckWindow("rolling_sum", RollingOptions(10, 1), float64(), input, float64(),
+              "[1, 3, 6, 6, 11, 17, 24]");
+}
+
+TEST(TestRolling, NonFinite) {
+  const double inf = std::numeric_limits<double>::infinity();
+  std::shared_ptr<Array> input, expected;
+  ArrayFromVector<DoubleType, double>({1, inf, 3, 4, 5}, &input);
+  ArrayFromVector<DoubleType, double>({false, true, true, true, true},
+                                      {0, inf, inf, 7, 9}, &expected);
+  // The infinity leaves the window without poisoning the running sum
+  CheckWindow("rolling_sum", RollingOptions(2), input, expected);
+
+  ArrayFromVector<DoubleType, double>({1, inf, -inf, 4, 5, 6}, &input);
+  ArrayFromVector<DoubleType, double>({true, true, true, true, true, true},
+                                      {1, inf, NAN, -inf, 9, 11}, &expected);
+  ASSERT_OK_AND_ASSIGN(Datum result, RollingSum(input, RollingOptions(2, 1)));
+  AssertArraysApproxEqual(*expected, *result.make_array(), /*verbose=*/true,
+                          EqualOptions().nans_equal(true));
+}
+
+TEST(TestRolling, Errors) {
+  auto input = ArrayFromJSON(int32(), "[1, 2, 3]");
+  ASSERT_RAISES(Invalid, RollingSum(input, RollingOptions(0)));
+  ASSERT_RAISES(Invalid, RollingSum(input, RollingOptions(2, 3)));
+  ASSERT_RAISES(Invalid, RollingMean(input, RollingOptions(2, 0)));
+}
+
+TEST(TestShift, Basics) {
+  const std::string input = "[1, null, 3, 4, 5]";
+  for (const auto& type : {int16(), float64(), date32(), timestamp(TimeUnit::NANO)}) {
+    CheckWindow("lag", ShiftOptions(), type, input, type, "[null, 1, null, 3, 4]");
+    CheckWindow("lag", ShiftOptions(3), type, input, type,
+                "[null, null, null, 1, null]");
+    CheckWindow("lead", ShiftOptions(), type, input, type, "[null, 3, 4, 5, null]");
+    CheckWindow("lead", ShiftOptions(2), type, input, type, "[3, 4, 5, null, null]");
+    CheckWindow("lead", ShiftOptions(0), type, input, type, input);
+    CheckWindow("lag", ShiftOptions(7), type, input, type,
+                "[null, null, null, null, null]");
+  }
+  CheckWindow("lag", ShiftOptions(2), boolean(), "[true, false, null, true, true]",
+              boolean(), "[null, null, true, false, null]");
+  CheckWindow("lead", ShiftOptions(1), decimal(10, 2), R"(["1.00", "2.50", null])",
+              decimal(10, 2), R"(["2.50", null, null])");
+  ASSERT_RAISES(Invalid, Lag(ArrayFromJSON(int8(), "[1]"), ShiftOptions(-1)));
+}
+
+TEST(TestWindowFunctions, RandomChunks) {
+  random::RandomArrayGenerator rand(/*seed=*/0);
+  const int64_t length = 500;
+  auto input = std::static_pointer_cast<Int32Array>(
+      rand.Int32(length, /*min=*/-1000, /*max=*/1000, /*null_probability=*/0.1));
+  const int64_t window_size = 7;
+
+  // Naive reference computations
+  Int64Builder rolling_sum;
+  Int32Builder lag, lead;
+  for (int64_t i = 0; i < length; ++i) {
+    int64_t sum = 0, count = 0;
+    for (int64_t j = std::max<int64_t>(0, i - window_size + 1); j <= i; ++j) {
+      if (input->IsValid(j)) {
+        sum += input->Value(j);
+        ++count;
+      }
+    }
+    ASSERT_OK(count >= 3 ? rolling_sum.Append(sum) : rolling_sum.AppendNull());
+    ASSERT_OK(i >= window_size && input->IsValid(i - window_size)
+                  ? lag.Append(input->Value(i - window_size))
+                  : lag.AppendNull());
+    ASSERT_OK(i + window_size < length && input->IsValid(i + window_size)
+                  ? lead.Append(input->Value(i + window_size))
+                  : lead.AppendNull());
+  }
+  std::shared_ptr<Array> expected_sum, expected_lag, expected_lead;
+  ASSERT_OK(rolling_sum.Finish(&expected_sum));
+  ASSERT_OK(lag.Finish(&expected_lag));
+  ASSERT_OK(lead.Finish(&expected_lead));
+
+  for (const std::vector<int64_t>& lengths : std::vector<std::vector<int64_t>>{
+           {}, {3, 3, 0, 3, 100}, {1, 1, 1, 1, 1, 1, 1, 1, 1}, {250}, {6, 8, 7}}) {
+    auto chunked = SplitArray(input, lengths);
+    ASSERT_OK_AND_ASSIGN(Datum result,
+                         RollingSum(chunked, RollingOptions(window_size, 3)));
+    AssertChunkedEquivalent(ChunkedArray(expected_sum), *result.chunked_array());
+    ASSERT_OK_AND_ASSIGN(result, Lag(chunked, ShiftOptions(window_size)));
+    AssertChunkedEquivalent(ChunkedArray(expected_lag), *result.chunked_array());
+    ASSERT_OK_AND_ASSIGN(result, Lead(chunked, ShiftOptions(window_size)));
+    AssertChunkedEquivalent(ChunkedArray(expected_lead), *result.chunked_array());
+  }
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -18,12 +18,14 @@
 #include "arrow/compute/registry.h"
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
 #include <utility>
 
 #include "arrow/compute/function.h"
+#include "arrow/compute/kernel.h"
 #include "arrow/compute/registry_internal.h"
 #include "arrow/status.h"
 
@@ -74,9 +76,106 @@ class FunctionRegistry::FunctionRegistryImpl {
 
   int num_functions() const { return static_cast<int>(name_to_function_.size()); }
 
+  void EnableStatistics(int timing_interval) {
+    timing_interval_.store(std::max(timing_interval, 0));
+    statistics_enabled_.store(true);
+  }
+
+  void DisableStatistics() { statistics_enabled_.store(false); }
+
+  bool statistics_enabled() const { return statistics_enabled_.load(); }
+
+  std::vector<FunctionStatistics> GetStatistics() const {
+    std::vector<FunctionStatistics> results;
+    {
+      std::lock_guard<std::mutex> guard(stats_lock_);
+      for (const auto& entry : kernel_stats_) {
+        const KernelCounters& counters = *entry.second;
+        if (counters.num_calls.load() == 0) {
+          continue;
+        }
+        FunctionStatistics stats;
+        stats.function_name = counters.function_name;
+        stats.kernel_signature = counters.kernel_signature;
+        stats.num_calls = counters.num_calls.load();
+        stats.num_rows = counters.num_rows.load();
+        stats.num_bytes = counters.num_bytes.load();
+        stats.num_timed_calls = counters.num_timed_calls.load();
+        stats.timed_nanos = counters.timed_nanos.load();
+        results.push_back(std::move(stats));
+      }
+    }
+    std::sort(results.begin(), results.end(),
+              [](const FunctionStatistics& left, const FunctionStatistics& right) {
+                if (left.function_name != right.function_name) {
+                  return left.function_name < right.function_name;
+                }
+                return left.kernel_signature < right.kernel_signature;
+              });
+    return results;
+  }
+
+  void ResetStatistics() {
+    // Concurrent executions may be updating the counters, so they are zeroed
+    // rather than destroyed
+    std::lock_guard<std::mutex> guard(stats_lock_);
+    for (const auto& entry : kernel_stats_) {
+      KernelCounters* counters = entry.second.get();
+      counters->num_calls.store(0);
+      counters->num_rows.store(0);
+      counters->num_bytes.store(0);
+      counters->num_timed_calls.store(0);
+      counters->timed_nanos.store(0);
+    }
+  }
+
+  bool ShouldTimeExecution() {
+    const int interval = timing_interval_.load();
+    return interval > 0 && num_executions_.fetch_add(1) % interval == 0;
+  }
+
+  void RecordExecution(const Function& func, const Kernel& kernel, int64_t num_rows,
+                       int64_t num_bytes, int64_t nanos) {
+    KernelCounters* counters;
+    {
+      std::lock_guard<std::mutex> guard(stats_lock_);
+      auto& slot = kernel_stats_[&kernel];
+      if (slot == nullptr) {
+        slot.reset(new KernelCounters);
+        slot->function_name = func.name();
+        slot->kernel_signature = kernel.signature->ToString();
+      }
+      counters = slot.get();
+    }
+    ++counters->num_calls;
+    counters->num_rows += num_rows;
+    counters->num_bytes += num_bytes;
+    if (nanos >= 0) {
+      ++counters->num_timed_calls;
+      counters->timed_nanos += nanos;
+    }
+  }
+
  private:
+  struct KernelCounters {
+    std::string function_name;
+    std::string kernel_signature;
+    std::atomic<int64_t> num_calls{0};
+    std::atomic<int64_t> num_rows{0};
+    std::atomic<int64_t> num_bytes{0};
+    std::atomic<int64_t> num_timed_calls{0};
+    std::atomic<int64_t> timed_nanos{0};
+  };
+
   std::mutex lock_;
   std::unordered_map<std::string, std::shared_ptr<Function>> name_to_function_;
+
+  std::atomic<bool> statistics_enabled_{false};
+  std::atomic<int> timing_interval_{0};
+  std::atomic<uint64_t> num_executions_{0};
+  // The counters are only created under the lock, and updated atomically
+  mutable std::mutex stats_lock_;
+  std::unordered_map<const Kernel*, std::unique_ptr<KernelCounters>> kernel_stats_;
 };
 
 std::unique_ptr<FunctionRegistry> FunctionRegistry::Make() {
@@ -87,6 +186,28 @@ FunctionRegistry::FunctionRegistry() { impl_.reset(new FunctionRegistryImpl());
 
 FunctionRegistry::~FunctionRegistry() {}
 
+void FunctionRegistry::EnableStatistics(int timing_interval) {
+  impl_->EnableStatistics(timing_interval);
+}
+
+void FunctionRegistry::DisableStatistics() { impl_->DisableStatistics(); }
+
+bool FunctionRegistry::statistics_enabled() const { return impl_->statistics_enabled(); }
+
+std::vector<FunctionStatistics> FunctionRegistry::GetStatistics() const {
+  return impl_->GetStatistics();
+}
+
+void FunctionRegistry::ResetStatistics() { impl_->ResetStatistics(); }
+
+bool FunctionRegistry::ShouldTimeExecution() { return impl_->ShouldTimeExecution(); }
+
+void FunctionRegistry::RecordExecution(const Function& func, const Kernel& kernel,
+                                       int64_t num_rows, int64_t num_bytes,
+                                       int64_t nanos) {
+  impl_->RecordExecution(func, kernel, num_rows, num_bytes, nanos);
+}
+
 Status FunctionRegistry::AddFunction(std::shared_ptr<Function> function,
                                      bool allow_overwrite) {
   return impl_->AddFunction(std::move(function), allow_overwrite);
@@ -123,15 +244,21 @@ static std::unique_ptr<FunctionRegistry> CreateBuiltInRegistry() {
   RegisterScalarStringAscii(registry.get());
   RegisterScalarValidity(registry.get());
   RegisterScalarFillNull(registry.get());
+  RegisterScalarIfElse(registry.get());
+  RegisterScalarHash(registry.get());
+  RegisterScalarTemporal(registry.get());
 
   // Aggregate functions
   RegisterScalarAggregateBasic(registry.get());
+  RegisterHashAggregateBasic(registry.get());
 
   // Vector functions
   RegisterVectorHash(registry.get());
   RegisterVectorSelection(registry.get());
   RegisterVectorNested(registry.get());
+  RegisterVectorRunEnd(registry.get());
   RegisterVectorSort(registry.get());
+  RegisterVectorWindow(registry.get());
 
   return registry;
 }
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -32,6 +33,24 @@ namespace arrow {
 namespace compute {
 
 class Function;
+struct Kernel;
+
+/// \brief Execution statistics of a function kernel, as collected by a
+/// FunctionRegistry
+struct ARROW_EXPORT FunctionStatistics {
+  /// The name of the function (not of the alias it was called by)
+  std::string function_name;
+  /// The signature of the kernel the execution was dispatched to
+  std::string kernel_signature;
+  /// The number of successful executions
+  int64_t num_calls = 0;
+  /// The total length of the inputs, and the total size of their buffers
+  int64_t num_rows = 0;
+  int64_t num_bytes = 0;
+  /// The number of timed executions, and their total duration
+  int64_t num_timed_calls = 0;
+  int64_t timed_nanos = 0;
+};
 
 /// \brief A mutable central function registry for built-in functions as well
 /// as user-defined functions. Functions are implementations of
@@ -68,6 +87,37 @@ class ARROW_EXPORT FunctionRegistry {
   /// \brief The number of currently registered functions
   int num_functions() const;
 
+  /// \brief Start collecting execution statistics of the functions executed
+  /// with an ExecContext using this registry
+  ///
+  /// Statistics are disabled by default.  Once enabled, each execution updates
+  /// atomic counters of the kernel it was dispatched to, and one execution out
+  /// of `timing_interval` is also timed (none if 0).
+  void EnableStatistics(int timing_interval = 16);
+
+  /// \brief Stop collecting execution statistics.  The statistics collected so
+  /// far are kept.
+  void DisableStatistics();
+
+  /// \brief Whether execution statistics are being collected
+  bool statistics_enabled() const;
+
+  /// \brief Return a snapshot of the execution statistics, by function name
+  /// and kernel signature
+  std::vector<FunctionStatistics> GetStatistics() const;
+
+  /// \brief Discard the execution statistics collected so far
+  void ResetStatistics();
+
+  /// \brief Return whether the next execution should be timed.  For use by
+  /// the function executors.
+  bool ShouldTimeExecution();
+
+  /// \brief Account for an execution of `kernel`, `nanos` being negative if it
+  /// wasn't timed.  For use by the function executors.
+  void RecordExecution(const Function& func, const Kernel& kernel, int64_t num_rows,
+                       int64_t num_bytes, int64_t nanos);
+
  private:
   FunctionRegistry();
 
@@ -21,6 +21,7 @@
 #include <memory>
 #include <utility>
 
+#include "arrow/csv/lexing_internal.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
@@ -45,7 +46,7 @@ class Lexer {
     AT_QUOTED_ESCAPE
   };
 
-  explicit Lexer(const ParseOptions& options) : options_(options) {
+  explicit Lexer(const ParseOptions& options) : options_(options), scanner_(options) {
     DCHECK_EQ(quoting, options_.quoting);
     DCHECK_EQ(escaping, options_.escaping);
   }
@@ -81,8 +82,10 @@ class Lexer {
     // Quoting is only recognized at start of field
     if (quoting && *data == options_.quote_char) {
       data++;
+      data = scanner_.Next(data, data_end);
       goto InQuotedField;
     } else {
+      data = scanner_.Next(data, data_end);
       goto InField;
     }
 
@@ -180,6 +183,7 @@ class Lexer {
 
  protected:
   const ParseOptions& options_;
+  SpecialCharScanner<quoting, escaping> scanner_;
   State state_ = FIELD_START;
 };
 
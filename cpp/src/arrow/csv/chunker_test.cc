@@ -261,5 +261,22 @@ TEST_P(BaseChunkerTest, EscapingNewline) {
   }
 }
 
+TEST_P(BaseChunkerTest, LongFields) {
+  // Fields spanning several SIMD-scanned windows
+  const std::string long_a(100, 'a');
+  const std::string long_b(70, 'b');
+  auto csv = MakeCSVData({long_a + "," + long_b + "\n", "\"" + long_b + "\n" + long_a +
+                                                             "\"," + long_b + "\n"});
+  if (options_.newlines_in_values) {
+    auto lengths = {172, 245};
+    MakeChunker();
+    AssertChunking(*chunker_, csv, lengths);
+  } else {
+    auto lengths = {172, 72, 173};
+    MakeChunker();
+    AssertChunking(*chunker_, csv, lengths);
+  }
+}
+
 }  // namespace csv
 }  // namespace arrow
@@ -17,6 +17,7 @@
 
 #include "arrow/csv/converter.h"
 
+#include <algorithm>
 #include <cstring>
 #include <limits>
 #include <sstream>
@@ -30,6 +31,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/trie.h"
@@ -81,33 +83,132 @@ inline void TrimWhiteSpace(const uint8_t** data_inout, uint32_t* size_inout) {
   }
 }
 
-Status InitializeTrie(const std::vector<std::string>& inputs, Trie* trie) {
-  TrieBuilder builder;
-  for (const auto& s : inputs) {
-    RETURN_NOT_OK(builder.Append(s, true /* allow_duplicates */));
+// Matches values against a set of spellings (such as the null or boolean
+// spellings of ConvertOptions).
+//
+// Values are first filtered on their length and first byte.  Spellings of up
+// to kMaxPackedLength bytes are then compared as packed words, all spellings
+// of a given length at once; longer ones are looked up in a Trie.  Values
+// must be followed by at least BlockParser::kParsedPadding readable bytes.
+class ValueMatcher {
+ public:
+  static constexpr uint32_t kMaxPackedLength = 8;
+
+  Status Initialize(const std::vector<std::string>& spellings) {
+    TrieBuilder builder;
+    for (const auto& s : spellings) {
+      const auto size = static_cast<uint32_t>(s.size());
+      if (size == 0) {
+        matches_empty_ = true;
+        continue;
+      }
+      const auto data = reinterpret_cast<const uint8_t*>(s.data());
+      BitUtil::SetBit(first_bytes_[FilterSlot(size)], data[0]);
+      if (size <= kMaxPackedLength) {
+        uint64_t word = 0;
+        std::memcpy(&word, data, size);
+        auto& words = packed_[size];
+        if (std::find(words.begin(), words.end(), word) == words.end()) {
+          words.push_back(word);
+        }
+      } else {
+        RETURN_NOT_OK(builder.Append(s, true /* allow_duplicates */));
+        has_long_ = true;
+      }
+    }
+    long_trie_ = builder.Finish();
+    return Status::OK();
   }
-  *trie = builder.Finish();
-  return Status::OK();
-}
 
-class ConcreteConverterMixin {
- protected:
-  Status InitializeNullTrie(const ConvertOptions& options);
+  // Whether the value may match a spelling, judging by its length and first byte
+  bool MayMatch(const uint8_t* data, uint32_t size) const {
+    if (size == 0) {
+      return matches_empty_;
+    }
+    return BitUtil::GetBit(first_bytes_[FilterSlot(size)], data[0]);
+  }
 
-  bool IsNull(const uint8_t* data, uint32_t size, bool quoted) {
-    if (quoted) {
+  bool Matches(const uint8_t* data, uint32_t size) const {
+    if (!MayMatch(data, size)) {
       return false;
     }
-    return null_trie_.Find(
-               util::string_view(reinterpret_cast<const char*>(data), size)) >= 0;
+    if (size == 0) {
+      return true;
+    }
+    if (ARROW_PREDICT_FALSE(size > kMaxPackedLength)) {
+      return has_long_ &&
+             long_trie_.Find(util::string_view(reinterpret_cast<const char*>(data),
+                                               size)) >= 0;
+    }
+    const uint64_t word = LoadPacked(data, size);
+    bool found = false;
+    for (const uint64_t candidate : packed_[size]) {
+      found |= (candidate == word);
+    }
+    return found;
+  }
+
+ protected:
+  static uint32_t FilterSlot(uint32_t size) {
+    return std::min(size, kMaxPackedLength + 1) - 1;
   }
 
-  Trie null_trie_;
+  // Load the `size` first bytes of a value into a word laid out like the
+  // packed spellings, relying on the padding after the parsed values
+  static uint64_t LoadPacked(const uint8_t* data, uint32_t size) {
+    uint64_t word;
+    std::memcpy(&word, data, sizeof(word));
+    const uint64_t all_ones = ~static_cast<uint64_t>(0);
+#if ARROW_LITTLE_ENDIAN
+    return word & (all_ones >> (64 - 8 * size));
+#else
+    return word & (all_ones << (64 - 8 * size));
+#endif
+  }
+
+  bool matches_empty_ = false;
+  bool has_long_ = false;
+  // For each length 1..kMaxPackedLength (and one slot for all longer lengths),
+  // a bitmap of the first bytes of the spellings with that length
+  uint8_t first_bytes_[kMaxPackedLength + 1][32] = {};
+  // For each length 1..kMaxPackedLength, the spellings with that length
+  std::vector<uint64_t> packed_[kMaxPackedLength + 1];
+  Trie long_trie_;
 };
 
-Status ConcreteConverterMixin::InitializeNullTrie(const ConvertOptions& options) {
-  // TODO no need to build a separate Trie for each Converter instance
-  return InitializeTrie(options.null_values, &null_trie_);
+constexpr uint32_t ValueMatcher::kMaxPackedLength;
+
+static_assert(ValueMatcher::kMaxPackedLength <= BlockParser::kParsedPadding,
+              "packed loads may overrun the parsed data");
+
+// Tells whether values of a column in a given block are null.  If no value
+// of the column can match a null spelling, no matching is done at all.
+struct NullChecker {
+  const ValueMatcher* matcher;
+
+  bool operator()(const uint8_t* data, uint32_t size, bool quoted) const {
+    return matcher != nullptr && !quoted && matcher->Matches(data, size);
+  }
+};
+
+class ConcreteConverterMixin {
+ protected:
+  Status InitializeNullMatcher(const ConvertOptions& options);
+
+  NullChecker MakeNullChecker(const BlockParser& parser, int32_t col_index) const {
+    const bool may_have_nulls = parser.AnyInColumn(
+        col_index, [this](const uint8_t* data, uint32_t size, bool /*quoted*/) {
+          return null_matcher_.MayMatch(data, size);
+        });
+    return NullChecker{may_have_nulls ? &null_matcher_ : nullptr};
+  }
+
+  ValueMatcher null_matcher_;
+};
+
+Status ConcreteConverterMixin::InitializeNullMatcher(const ConvertOptions& options) {
+  // TODO no need to build a separate matcher for each Converter instance
+  return null_matcher_.Initialize(options.null_values);
 }
 
 class ConcreteConverter : public Converter, public ConcreteConverterMixin {
@@ -115,7 +216,7 @@ class ConcreteConverter : public Converter, public ConcreteConverterMixin {
   using Converter::Converter;
 
  protected:
-  Status Initialize() override { return InitializeNullTrie(options_); }
+  Status Initialize() override { return InitializeNullMatcher(options_); }
 };
 
 class ConcreteDictionaryConverter : public DictionaryConverter,
@@ -124,7 +225,7 @@ class ConcreteDictionaryConverter : public DictionaryConverter,
   using DictionaryConverter::DictionaryConverter;
 
  protected:
-  Status Initialize() override { return InitializeNullTrie(options_); }
+  Status Initialize() override { return InitializeNullMatcher(options_); }
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -137,9 +238,10 @@ class NullConverter : public ConcreteConverter {
   Result<std::shared_ptr<Array>> Convert(const BlockParser& parser,
                                          int32_t col_index) override {
     NullBuilder builder(pool_);
+    const auto is_null = MakeNullChecker(parser, col_index);
 
     auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
-      if (ARROW_PREDICT_TRUE(IsNull(data, size, quoted))) {
+      if (ARROW_PREDICT_TRUE(is_null(data, size, quoted))) {
         return builder.AppendNull();
       } else {
         return GenericConversionError(type_, data, size);
@@ -178,8 +280,9 @@ class BinaryConverter : public ConcreteConverter {
     RETURN_NOT_OK(builder.ReserveData(parser.num_bytes()));
 
     if (options_.strings_can_be_null) {
+      const auto is_null = MakeNullChecker(parser, col_index);
       auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
-        if (IsNull(data, size, false /* quoted */)) {
+        if (is_null(data, size, false /* quoted */)) {
           builder.UnsafeAppendNull();
           return Status::OK();
         } else {
@@ -230,8 +333,9 @@ class DictionaryBinaryConverter : public ConcreteDictionaryConverter {
     RETURN_NOT_OK(builder.Resize(parser.num_rows()));
 
     if (options_.strings_can_be_null) {
+      const auto is_null = MakeNullChecker(parser, col_index);
       auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
-        if (IsNull(data, size, false /* quoted */)) {
+        if (is_null(data, size, false /* quoted */)) {
           return builder.AppendNull();
         } else {
           return visit_non_null(data, size, quoted);
@@ -298,20 +402,19 @@ class BooleanConverter : public ConcreteConverter {
   Result<std::shared_ptr<Array>> Convert(const BlockParser& parser,
                                          int32_t col_index) override {
     BooleanBuilder builder(type_, pool_);
+    const auto is_null = MakeNullChecker(parser, col_index);
 
     auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
       // XXX should quoted values be allowed at all?
-      if (IsNull(data, size, quoted)) {
+      if (is_null(data, size, quoted)) {
         builder.UnsafeAppendNull();
         return Status::OK();
       }
-      if (false_trie_.Find(
-              util::string_view(reinterpret_cast<const char*>(data), size)) >= 0) {
+      if (false_matcher_.Matches(data, size)) {
         builder.UnsafeAppend(false);
         return Status::OK();
       }
-      if (true_trie_.Find(util::string_view(reinterpret_cast<const char*>(data), size)) >=
-          0) {
+      if (true_matcher_.Matches(data, size)) {
         builder.UnsafeAppend(true);
         return Status::OK();
       }
@@ -327,14 +430,14 @@ class BooleanConverter : public ConcreteConverter {
 
  protected:
   Status Initialize() override {
-    // TODO no need to build separate Tries for each BooleanConverter instance
-    RETURN_NOT_OK(InitializeTrie(options_.true_values, &true_trie_));
-    RETURN_NOT_OK(InitializeTrie(options_.false_values, &false_trie_));
+    // TODO no need to build separate matchers for each BooleanConverter instance
+    RETURN_NOT_OK(true_matcher_.Initialize(options_.true_values));
+    RETURN_NOT_OK(false_matcher_.Initialize(options_.false_values));
     return ConcreteConverter::Initialize();
   }
 
-  Trie true_trie_;
-  Trie false_trie_;
+  ValueMatcher true_matcher_;
+  ValueMatcher false_matcher_;
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -351,11 +454,12 @@ class NumericConverter : public ConcreteConverter {
     using value_type = typename T::c_type;
 
     BuilderType builder(type_, pool_);
+    const auto is_null = MakeNullChecker(parser, col_index);
 
     auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
       // XXX should quoted values be allowed at all?
       value_type value = 0;
-      if (IsNull(data, size, quoted)) {
+      if (is_null(data, size, quoted)) {
         builder.UnsafeAppendNull();
         return Status::OK();
       }
@@ -437,9 +541,10 @@ class TimestampConverter : public ConcreteConverter {
   Status ConvertValuesWith(const BlockParser& parser, int32_t col_index,
                            const ConvertValue& converter, TimestampBuilder* builder) {
     using value_type = TimestampType::c_type;
+    const auto is_null = MakeNullChecker(parser, col_index);
     auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
       value_type value = 0;
-      if (IsNull(data, size, quoted)) {
+      if (is_null(data, size, quoted)) {
         builder->UnsafeAppendNull();
         return Status::OK();
       }
@@ -490,29 +595,22 @@ class DecimalConverter : public ConcreteConverter {
   Result<std::shared_ptr<Array>> Convert(const BlockParser& parser,
                                          int32_t col_index) override {
     Decimal128Builder builder(type_, pool_);
+    const auto& type = internal::checked_cast<const DecimalType&>(*type_);
+    const int32_t precision = type.precision();
+    const int32_t scale = type.scale();
+    const auto is_null = MakeNullChecker(parser, col_index);
 
     auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
-      if (IsNull(data, size, quoted)) {
+      if (is_null(data, size, quoted)) {
         builder.UnsafeAppendNull();
         return Status::OK();
       }
       TrimWhiteSpace(&data, &size);
+      // Parse straight at the column's scale, avoiding a separate Rescale() step
       Decimal128 decimal;
-      int32_t precision, scale;
       util::string_view view(reinterpret_cast<const char*>(data), size);
-      RETURN_NOT_OK(Decimal128::FromString(view, &decimal, &precision, &scale));
-      DecimalType& type = *internal::checked_cast<DecimalType*>(type_.get());
-      if (precision > type.precision()) {
-        return Status::Invalid("Error converting ", view, " to ", type_->ToString(),
-                               " precision not supported by type.");
-      }
-      if (scale != type.scale()) {
-        Decimal128 scaled;
-        ARROW_ASSIGN_OR_RAISE(scaled, decimal.Rescale(scale, type.scale()));
-        builder.UnsafeAppend(scaled);
-      } else {
-        builder.UnsafeAppend(decimal);
-      }
+      RETURN_NOT_OK(Decimal128::FromStringAtScale(view, precision, scale, &decimal));
+      builder.UnsafeAppend(decimal);
       return Status::OK();
     };
     RETURN_NOT_OK(builder.Resize(parser.num_rows()));
@@ -51,12 +51,26 @@ static std::shared_ptr<BlockParser> BuildInt64Data(int32_t num_rows) {
   return BuildFromExamples(base_rows, num_rows);
 }
 
+static std::shared_ptr<BlockParser> BuildWideInt64Data(int32_t num_rows) {
+  const std::vector<std::string> base_rows = {"1234567890123\n", "-98765432101\n",
+                                              "9223372036854775807\n", "31700555712\n",
+                                              "-4000000000000000\n"};
+  return BuildFromExamples(base_rows, num_rows);
+}
+
 static std::shared_ptr<BlockParser> BuildFloatData(int32_t num_rows) {
   const std::vector<std::string> base_rows = {"0\n", "123.456\n", "-3170.55766\n", "\n",
                                               "N/A\n"};
   return BuildFromExamples(base_rows, num_rows);
 }
 
+static std::shared_ptr<BlockParser> BuildPreciseFloatData(int32_t num_rows) {
+  const std::vector<std::string> base_rows = {
+      "0.123456789012\n", "-3170.5576612\n", "1.7976931348623157e308\n",
+      "6.02214076e23\n", "-2.5e-7\n"};
+  return BuildFromExamples(base_rows, num_rows);
+}
+
 static std::shared_ptr<BlockParser> BuildDecimal128Data(int32_t num_rows) {
   const std::vector<std::string> base_rows = {"0\n", "123.456\n", "-3170.55766\n",
                                               "\n",  "N/A\n",     "1233456789.123456789"};
@@ -73,6 +87,13 @@ static std::shared_ptr<BlockParser> BuildISO8601Data(int32_t num_rows) {
   return BuildFromExamples(base_rows, num_rows);
 }
 
+static std::shared_ptr<BlockParser> BuildFullISO8601Data(int32_t num_rows) {
+  const std::vector<std::string> base_rows = {
+      "1917-10-17T14:30:00Z\n", "2018-09-13 12:34:56\n", "1941-06-22T04:00:00\n",
+      "1945-05-09 09:45:38Z\n"};
+  return BuildFromExamples(base_rows, num_rows);
+}
+
 static std::shared_ptr<BlockParser> BuildStrptimeData(int32_t num_rows) {
   const std::vector<std::string> base_rows = {"10/17/1917\n", "9/13/2018\n",
                                               "9/5/1945\n"};
@@ -105,6 +126,13 @@ static void Int64Conversion(benchmark::State& state) {  // NOLINT non-const refe
   BenchmarkConversion(state, *parser, int64(), options);
 }
 
+static void WideInt64Conversion(benchmark::State& state) {  // NOLINT non-const reference
+  auto parser = BuildWideInt64Data(num_rows);
+  auto options = ConvertOptions::Defaults();
+
+  BenchmarkConversion(state, *parser, int64(), options);
+}
+
 static void FloatConversion(benchmark::State& state) {  // NOLINT non-const reference
   auto parser = BuildFloatData(num_rows);
   auto options = ConvertOptions::Defaults();
@@ -112,6 +140,14 @@ static void FloatConversion(benchmark::State& state) {  // NOLINT non-const refe
   BenchmarkConversion(state, *parser, float64(), options);
 }
 
+static void PreciseFloatConversion(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto parser = BuildPreciseFloatData(num_rows);
+  auto options = ConvertOptions::Defaults();
+
+  BenchmarkConversion(state, *parser, float64(), options);
+}
+
 static void Decimal128Conversion(benchmark::State& state) {  // NOLINT non-const reference
   auto parser = BuildDecimal128Data(num_rows);
   auto options = ConvertOptions::Defaults();
@@ -133,6 +169,13 @@ static void TimestampConversionDefault(
   BenchmarkConversion(state, *parser, timestamp(TimeUnit::MILLI), options);
 }
 
+static void TimestampConversionFullISO8601(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto parser = BuildFullISO8601Data(num_rows);
+  auto options = ConvertOptions::Defaults();
+  BenchmarkConversion(state, *parser, timestamp(TimeUnit::SECOND), options);
+}
+
 static void TimestampConversionStrptime(
     benchmark::State& state) {  // NOLINT non-const reference
   auto parser = BuildStrptimeData(num_rows);
@@ -142,10 +185,13 @@ static void TimestampConversionStrptime(
 }
 
 BENCHMARK(Int64Conversion);
+BENCHMARK(WideInt64Conversion);
 BENCHMARK(FloatConversion);
+BENCHMARK(PreciseFloatConversion);
 BENCHMARK(Decimal128Conversion);
 BENCHMARK(StringConversion);
 BENCHMARK(TimestampConversionDefault);
+BENCHMARK(TimestampConversionFullISO8601);
 BENCHMARK(TimestampConversionStrptime);
 
 }  // namespace csv
@@ -298,6 +298,27 @@ TEST(IntegerConversion, CustomNulls) {
                                      options);
 }
 
+TEST(IntegerConversion, NullSpellingLengths) {
+  auto options = ConvertOptions::Defaults();
+  // Spellings shorter than, as long as and longer than a packed word
+  options.null_values = {"-", "12345678", "missing_value"};
+
+  AssertConversion<Int32Type, int32_t>(
+      int32(), {"-,1234567\n", "12345678,123456789\n", "missing_value,-1\n"},
+      {{0, 0, 0}, {1234567, 123456789, -1}},
+      {{false, false, false}, {true, true, true}}, options);
+
+  // Values sharing a prefix with a spelling are not null
+  AssertConversionError(int32(), {"missing\n"}, {0}, options);
+  AssertConversionError(int32(), {"missing_values\n"}, {0}, options);
+
+  // The empty string is only null if listed
+  AssertConversionError(int32(), {"1,\n"}, {1}, options);
+  options.null_values.push_back("");
+  AssertConversion<Int32Type, int32_t>(int32(), {"1,\n"}, {{1}, {0}},
+                                       {{true}, {false}}, options);
+}
+
 TEST(IntegerConversion, Whitespace) {
   AssertConversion<Int32Type, int32_t>(int32(), {" 12,34 \n", " 56 ,78\n"},
                                        {{12, 56}, {34, 78}});
@@ -353,6 +374,18 @@ TEST(BooleanConversion, CustomNulls) {
                                       {{true, false}, {false, true}}, options);
 }
 
+TEST(BooleanConversion, CustomValues) {
+  auto options = ConvertOptions::Defaults();
+  options.true_values = {"T", "yes", "affirmative"};
+  options.false_values = {"F", "no", "negative_answer"};
+
+  AssertConversion<BooleanType, bool>(
+      boolean(), {"T,no\n", "affirmative,negative_answer\n", "yes,F\n"},
+      {{true, true, true}, {false, false, false}}, options);
+  AssertConversionError(boolean(), {"affirm\n"}, {0}, options);
+  AssertConversionError(boolean(), {"true\n"}, {0}, options);
+}
+
 TEST(TimestampConversion, Basics) {
   auto type = timestamp(TimeUnit::SECOND);
 
@@ -0,0 +1,119 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "arrow/csv/options.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/simd.h"
+
+namespace arrow {
+namespace csv {
+
+// A helper skipping over runs of bytes which have no special meaning for the
+// CSV state machines.
+//
+// The scanner classifies the input 64 bytes at a time, computing a bitmask of
+// the positions holding a delimiter, a line separator, a quote or an escape
+// character.  The state machines ask for the next such position when they
+// start a field, which then mostly costs a bit scan on the cached mask.
+//
+// Stopping at a byte which turns out to be ordinary in context (for example
+// a delimiter inside a quoted field) is harmless: the caller processes it
+// one byte at a time, as it would without the scanner.  Special bytes,
+// however, are never skipped.
+#if defined(ARROW_HAVE_SSE4_2)
+template <bool Quoting, bool Escaping>
+class SpecialCharScanner {
+ public:
+  explicit SpecialCharScanner(const ParseOptions& options)
+      : delimiter_(_mm_set1_epi8(options.delimiter)),
+        quote_(_mm_set1_epi8(options.quote_char)),
+        escape_(_mm_set1_epi8(options.escape_char)),
+        cr_(_mm_set1_epi8('\r')),
+        lf_(_mm_set1_epi8('\n')) {}
+
+  // Return the first byte in [data, data_end) which may be special.
+  // Near the end of the input, `data` itself may be returned.
+  const char* Next(const char* data, const char* data_end) {
+    while (true) {
+      const auto offset =
+          reinterpret_cast<uintptr_t>(data) - reinterpret_cast<uintptr_t>(window_);
+      if (offset >= static_cast<uintptr_t>(kWindowSize)) {
+        if (data_end - data < kWindowSize) {
+          return data;
+        }
+        window_ = data;
+        mask_ = ClassifyWindow(data);
+        continue;
+      }
+      const uint64_t mask = mask_ >> offset;
+      if (mask != 0) {
+        return data + BitUtil::CountTrailingZeros(mask);
+      }
+      data = window_ + kWindowSize;
+    }
+  }
+
+ private:
+  static constexpr int64_t kWindowSize = 64;
+
+  uint64_t ClassifyWindow(const char* data) const {
+    uint64_t mask = 0;
+    for (int64_t i = 0; i < kWindowSize; i += sizeof(__m128i)) {
+      const __m128i word = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+      __m128i matches = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi8(word, delimiter_), _mm_cmpeq_epi8(word, cr_)),
+          _mm_cmpeq_epi8(word, lf_));
+      if (Quoting) {
+        matches = _mm_or_si128(matches, _mm_cmpeq_epi8(word, quote_));
+      }
+      if (Escaping) {
+        matches = _mm_or_si128(matches, _mm_cmpeq_epi8(word, escape_));
+      }
+      mask |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(matches)))
+              << i;
+    }
+    return mask;
+  }
+
+  const __m128i delimiter_;
+  const __m128i quote_;
+  const __m128i escape_;
+  const __m128i cr_;
+  const __m128i lf_;
+
+  const char* window_ = NULLPTR;
+  uint64_t mask_ = 0;
+};
+#else
+// Without SIMD, the state machines' byte-at-a-time loops are already the
+// fastest option.
+template <bool Quoting, bool Escaping>
+class SpecialCharScanner {
+ public:
+  explicit SpecialCharScanner(const ParseOptions&) {}
+
+  const char* Next(const char* data, const char*) { return data; }
+};
+#endif
+
+}  // namespace csv
+}  // namespace arrow
@@ -23,6 +23,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "arrow/util/cancel.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -121,6 +122,9 @@ struct ARROW_EXPORT ReadOptions {
   /// Block size we request from the IO layer; also determines the size of
   /// chunks when use_threads is true
   int32_t block_size = 1 << 20;  // 1 MB
+  /// A token to cancel the read.  It is checked for each block, and the read
+  /// then fails with the stop error.
+  StopToken stop_token;
 
   /// Number of header rows to skip (not including the row of column names, if any)
   int32_t skip_rows = 0;
@@ -136,5 +140,29 @@ struct ARROW_EXPORT ReadOptions {
   static ReadOptions Defaults();
 };
 
+struct ARROW_EXPORT WriteOptions {
+  // Writer options
+
+  /// Whether to write a header line with the column names
+  bool include_header = true;
+  /// Field delimiter
+  char delimiter = ',';
+  /// Quoting character, written around the values which contain the delimiter,
+  /// the quoting character or a line break (a quote inside a value is doubled)
+  char quote_char = '"';
+  /// Spelling of null values.  If empty, empty strings are written quoted to
+  /// tell them apart from nulls.
+  std::string null_string;
+  /// Maximum number of rows formatted at once
+  int32_t batch_size = 1 << 14;
+  /// Size of the blocks written to the output stream
+  int64_t block_size = 1 << 20;  // 1 MB
+  /// Whether to format the columns in parallel on the global CPU thread pool
+  bool use_threads = true;
+
+  /// Create write options with default values
+  static WriteOptions Defaults();
+};
+
 }  // namespace csv
 }  // namespace arrow
@@ -19,9 +19,11 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <limits>
 #include <utility>
 
+#include "arrow/csv/lexing_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -73,6 +75,7 @@ class SpecializedOptions {
  public:
   static constexpr bool quoting = Quoting;
   static constexpr bool escaping = Escaping;
+  using Scanner = SpecialCharScanner<Quoting, Escaping>;
 };
 
 // A helper class allocating the buffer for parsed values and writing into it
@@ -81,13 +84,18 @@ class BlockParser::PresizedParsedWriter {
  public:
   PresizedParsedWriter(MemoryPool* pool, uint32_t size)
       : parsed_size_(0), parsed_capacity_(size) {
-    parsed_buffer_ = *AllocateResizableBuffer(parsed_capacity_, pool);
+    parsed_buffer_ =
+        *AllocateResizableBuffer(parsed_capacity_ + BlockParser::kParsedPadding, pool);
     parsed_ = parsed_buffer_->mutable_data();
   }
 
   void Finish(std::shared_ptr<Buffer>* out_parsed) {
-    ARROW_CHECK_OK(parsed_buffer_->Resize(parsed_size_));
-    *out_parsed = parsed_buffer_;
+    // Keep zeroed padding after the parsed data, so that converters can
+    // load whole words at the start of short values
+    ARROW_CHECK_OK(parsed_buffer_->Resize(parsed_size_ + BlockParser::kParsedPadding));
+    std::memset(parsed_buffer_->mutable_data() + parsed_size_, 0,
+                BlockParser::kParsedPadding);
+    *out_parsed = SliceBuffer(parsed_buffer_, 0, parsed_size_);
   }
 
   void BeginLine() { saved_parsed_size_ = parsed_size_; }
@@ -97,6 +105,12 @@ class BlockParser::PresizedParsedWriter {
     parsed_[parsed_size_++] = static_cast<uint8_t>(c);
   }
 
+  void PushFieldChars(const char* data, int64_t size) {
+    DCHECK_LE(parsed_size_ + size, parsed_capacity_);
+    std::memcpy(parsed_ + parsed_size_, data, static_cast<size_t>(size));
+    parsed_size_ += size;
+  }
+
   // Rollback the state that was saved in BeginLine()
   void RollbackLine() { parsed_size_ = saved_parsed_size_; }
 
@@ -214,14 +228,22 @@ class BlockParser::PresizedValuesWriter {
 
 template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
 Status BlockParser::ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
+                              typename SpecializedOptions::Scanner* scanner,
                               const char* data, const char* data_end, bool is_final,
                               const char** out_data) {
   int32_t num_cols = 0;
   char c;
+  const bool skipping_columns = !column_slots_.empty();
 
   DCHECK_GT(data_end, data);
 
   auto FinishField = [&]() { values_writer->FinishField(parsed_writer); };
+  // Copy the run of plain field contents starting at `data`
+  auto SkipPlainChars = [&]() {
+    const char* run_end = scanner->Next(data, data_end);
+    parsed_writer->PushFieldChars(data, run_end - data);
+    data = run_end;
+  };
 
   values_writer->BeginLine();
   parsed_writer->BeginLine();
@@ -246,13 +268,18 @@ Status BlockParser::ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_
 
 FieldStart:
   // At the start of a field
+  if (skipping_columns && !IsColumnRetained(num_cols)) {
+    goto SkipFieldStart;
+  }
   // Quoting is only recognized at start of field
   if (SpecializedOptions::quoting && ARROW_PREDICT_FALSE(*data == options_.quote_char)) {
     ++data;
     values_writer->StartField(true /* quoted */);
+    SkipPlainChars();
     goto InQuotedField;
   } else {
     values_writer->StartField(false /* quoted */);
+    SkipPlainChars();
     goto InField;
   }
 
@@ -324,9 +351,75 @@ FieldEnd:
   }
   goto FieldStart;
 
+SkipFieldStart:
+  // At the start of a field whose value is not retained: delimit it the same
+  // way as above, without storing anything
+  if (SpecializedOptions::quoting && ARROW_PREDICT_FALSE(*data == options_.quote_char)) {
+    ++data;
+    goto SkipQuotedField;
+  }
+
+SkipField:
+  data = scanner->Next(data, data_end);
+  if (ARROW_PREDICT_FALSE(data == data_end)) {
+    goto AbortLine;
+  }
+  c = *data++;
+  if (SpecializedOptions::escaping && ARROW_PREDICT_FALSE(c == options_.escape_char)) {
+    if (ARROW_PREDICT_FALSE(data == data_end)) {
+      goto AbortLine;
+    }
+    ++data;
+    goto SkipField;
+  }
+  if (c == options_.delimiter) {
+    ++num_cols;
+    if (ARROW_PREDICT_FALSE(data == data_end)) {
+      goto AbortLine;
+    }
+    goto FieldStart;
+  }
+  if (IsControlChar(c)) {
+    if (c == '\r') {
+      if (ARROW_PREDICT_TRUE(data < data_end) && *data == '\n') {
+        data++;
+      }
+      goto SkippedLineEnd;
+    }
+    if (c == '\n') {
+      goto SkippedLineEnd;
+    }
+  }
+  goto SkipField;
+
+SkipQuotedField:
+  data = scanner->Next(data, data_end);
+  if (ARROW_PREDICT_FALSE(data == data_end)) {
+    goto AbortLine;
+  }
+  c = *data++;
+  if (SpecializedOptions::escaping && ARROW_PREDICT_FALSE(c == options_.escape_char)) {
+    if (ARROW_PREDICT_FALSE(data == data_end)) {
+      goto AbortLine;
+    }
+    ++data;
+    goto SkipQuotedField;
+  }
+  if (c == options_.quote_char) {
+    if (options_.double_quote && ARROW_PREDICT_TRUE(data < data_end) &&
+        *data == options_.quote_char) {
+      ++data;
+    } else {
+      goto SkipField;
+    }
+  }
+  goto SkipQuotedField;
+
 LineEnd:
   // At the end of line
   FinishField();
+
+SkippedLineEnd:
   ++num_cols;
   if (ARROW_PREDICT_FALSE(num_cols != num_cols_)) {
     if (num_cols_ == -1) {
@@ -342,7 +435,9 @@ LineEnd:
 AbortLine:
   // Not a full line except perhaps if in final block
   if (is_final) {
-    FinishField();
+    if (!skipping_columns || IsColumnRetained(num_cols)) {
+      FinishField();
+    }
     ++num_cols;
     if (num_cols_ == -1) {
       num_cols_ = num_cols;
@@ -365,9 +460,11 @@ EmptyLine:
       num_cols_ = 1;
     }
     // Record as row of empty (null?) values
-    while (num_cols++ < num_cols_) {
-      values_writer->StartField(false /* quoted */);
-      FinishField();
+    for (; num_cols < num_cols_; ++num_cols) {
+      if (!skipping_columns || IsColumnRetained(num_cols)) {
+        values_writer->StartField(false /* quoted */);
+        FinishField();
+      }
     }
     ++num_rows_;
   }
@@ -381,11 +478,12 @@ Status BlockParser::ParseChunk(ValuesWriter* values_writer, ParsedWriter* parsed
                                int32_t rows_in_chunk, const char** out_data,
                                bool* finished_parsing) {
   int32_t num_rows_deadline = num_rows_ + rows_in_chunk;
+  typename SpecializedOptions::Scanner scanner(options_);
 
   while (data < data_end && num_rows_ < num_rows_deadline) {
     const char* line_end = data;
-    RETURN_NOT_OK(ParseLine<SpecializedOptions>(values_writer, parsed_writer, data,
-                                                data_end, is_final, &line_end));
+    RETURN_NOT_OK(ParseLine<SpecializedOptions>(values_writer, parsed_writer, &scanner,
+                                                data, data_end, is_final, &line_end));
     if (line_end == data) {
       // Cannot parse any further
       *finished_parsing = true;
@@ -452,14 +550,15 @@ Status BlockParser::DoParseSpecialized(const std::vector<util::string_view>& vie
 
       int32_t rows_in_chunk;
       constexpr int32_t kTargetChunkSize = 32768;
-      if (num_cols_ > 0) {
-        rows_in_chunk = std::min(std::max(kTargetChunkSize / num_cols_, 512),
+      const int32_t num_value_cols = this->num_value_cols();
+      if (num_value_cols > 0) {
+        rows_in_chunk = std::min(std::max(kTargetChunkSize / num_value_cols, 512),
                                  max_num_rows_ - num_rows_);
       } else {
         rows_in_chunk = std::min(kTargetChunkSize, max_num_rows_ - num_rows_);
       }
 
-      PresizedValuesWriter values_writer(pool_, rows_in_chunk, num_cols_);
+      PresizedValuesWriter values_writer(pool_, rows_in_chunk, num_value_cols);
       values_writer.Start(parsed_writer);
 
       RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&values_writer, &parsed_writer, data,
@@ -480,7 +579,7 @@ Status BlockParser::DoParseSpecialized(const std::vector<util::string_view>& vie
   parsed_size_ = static_cast<int32_t>(parsed_buffer_->size());
   parsed_ = parsed_buffer_->data();
 
-  DCHECK_EQ(values_size_, num_rows_ * num_cols_);
+  DCHECK_EQ(values_size_, num_rows_ * num_value_cols());
   if (num_cols_ == -1) {
     DCHECK_EQ(num_rows_, 0);
   }
@@ -539,6 +638,8 @@ Status BlockParser::ParseFinal(util::string_view data, uint32_t* out_size) {
   return DoParse({data}, true /* is_final */, out_size);
 }
 
+constexpr int64_t BlockParser::kParsedPadding;
+
 BlockParser::BlockParser(MemoryPool* pool, ParseOptions options, int32_t num_cols,
                          int32_t max_num_rows)
     : pool_(pool),
@@ -547,6 +648,16 @@ BlockParser::BlockParser(MemoryPool* pool, ParseOptions options, int32_t num_col
       num_cols_(num_cols),
       max_num_rows_(max_num_rows) {}
 
+BlockParser::BlockParser(MemoryPool* pool, ParseOptions options,
+                         std::vector<bool> column_mask, int32_t max_num_rows)
+    : BlockParser(pool, options, static_cast<int32_t>(column_mask.size()),
+                  max_num_rows) {
+  column_slots_.reserve(column_mask.size());
+  for (const bool retained : column_mask) {
+    column_slots_.push_back(retained ? num_retained_cols_++ : -1);
+  }
+}
+
 BlockParser::BlockParser(ParseOptions options, int32_t num_cols, int32_t max_num_rows)
     : BlockParser(default_memory_pool(), options, num_cols, max_num_rows) {}
 
@@ -51,6 +51,9 @@ int32_t SkipRows(const uint8_t* data, uint32_t size, int32_t num_rows,
 /// unquoting and unescaping them on the fly.  Parsed data is own by the
 /// parser, so the original buffer can be discarded after Parse() returns.
 ///
+/// Parsed values are followed by at least kParsedPadding zero bytes, so
+/// visitors may load a few bytes past the end of a value.
+///
 /// If the block is truncated (i.e. not all data can be parsed), it is up
 /// to the caller to arrange the next block to start with the trailing data.
 /// Also, if the previous block ends with CR (0x0d) and a new block starts
@@ -58,10 +61,20 @@ int32_t SkipRows(const uint8_t* data, uint32_t size, int32_t num_rows,
 /// line; the caller should therefore strip it.
 class ARROW_EXPORT BlockParser {
  public:
+  /// The number of readable zero bytes following the parsed data
+  static constexpr int64_t kParsedPadding = 8;
+
   explicit BlockParser(ParseOptions options, int32_t num_cols = -1,
                        int32_t max_num_rows = kMaxParserNumRows);
   explicit BlockParser(MemoryPool* pool, ParseOptions options, int32_t num_cols = -1,
                        int32_t max_num_rows = kMaxParserNumRows);
+  /// \brief Create a parser only retaining the values of some columns
+  ///
+  /// `column_mask` has one entry per CSV column, true for the columns whose
+  /// values should be retained.  The other fields are delimited but not
+  /// unquoted or stored, and must not be visited.
+  BlockParser(MemoryPool* pool, ParseOptions options, std::vector<bool> column_mask,
+              int32_t max_num_rows = kMaxParserNumRows);
 
   /// \brief Parse a block of data
   ///
@@ -98,12 +111,14 @@ class ARROW_EXPORT BlockParser {
   /// Status(const uint8_t* data, uint32_t size, bool quoted)
   template <typename Visitor>
   Status VisitColumn(int32_t col_index, Visitor&& visit) const {
+    const int32_t first_pos = value_slot(col_index);
+    const int32_t stride = num_value_cols();
     for (size_t buf_index = 0; buf_index < values_buffers_.size(); ++buf_index) {
       const auto& values_buffer = values_buffers_[buf_index];
       const auto values = reinterpret_cast<const ValueDesc*>(values_buffer->data());
       const auto max_pos =
           static_cast<int32_t>(values_buffer->size() / sizeof(ValueDesc)) - 1;
-      for (int32_t pos = col_index; pos < max_pos; pos += num_cols_) {
+      for (int32_t pos = first_pos; pos < max_pos; pos += stride) {
         auto start = values[pos].offset;
         auto stop = values[pos + 1].offset;
         auto quoted = values[pos + 1].quoted;
@@ -113,13 +128,42 @@ class ARROW_EXPORT BlockParser {
     return Status::OK();
   }
 
+  /// \brief Return whether any parsed value in a column satisfies a predicate
+  ///
+  /// The signature of the predicate is
+  /// bool(const uint8_t* data, uint32_t size, bool quoted)
+  /// Visiting stops at the first value for which it returns true.
+  template <typename Predicate>
+  bool AnyInColumn(int32_t col_index, Predicate&& pred) const {
+    const int32_t first_pos = value_slot(col_index);
+    const int32_t stride = num_value_cols();
+    for (size_t buf_index = 0; buf_index < values_buffers_.size(); ++buf_index) {
+      const auto& values_buffer = values_buffers_[buf_index];
+      const auto values = reinterpret_cast<const ValueDesc*>(values_buffer->data());
+      const auto max_pos =
+          static_cast<int32_t>(values_buffer->size() / sizeof(ValueDesc)) - 1;
+      for (int32_t pos = first_pos; pos < max_pos; pos += stride) {
+        auto start = values[pos].offset;
+        auto stop = values[pos + 1].offset;
+        if (pred(parsed_ + start, stop - start, values[pos + 1].quoted)) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  /// \brief Visit the parsed values in the last row
+  ///
+  /// If a column mask was given, only the retained columns are visited.
   template <typename Visitor>
   Status VisitLastRow(Visitor&& visit) const {
+    const int32_t num_values = num_value_cols();
     const auto& values_buffer = values_buffers_.back();
     const auto values = reinterpret_cast<const ValueDesc*>(values_buffer->data());
     const auto start_pos =
-        static_cast<int32_t>(values_buffer->size() / sizeof(ValueDesc)) - num_cols_ - 1;
-    for (int32_t col_index = 0; col_index < num_cols_; ++col_index) {
+        static_cast<int32_t>(values_buffer->size() / sizeof(ValueDesc)) - num_values - 1;
+    for (int32_t col_index = 0; col_index < num_values; ++col_index) {
       auto start = values[start_pos + col_index].offset;
       auto stop = values[start_pos + col_index + 1].offset;
       auto quoted = values[start_pos + col_index + 1].quoted;
@@ -145,8 +189,23 @@ class ARROW_EXPORT BlockParser {
   // Parse a single line from the data pointer
   template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
   Status ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                   const char* data, const char* data_end, bool is_final,
-                   const char** out_data);
+                   typename SpecializedOptions::Scanner* scanner, const char* data,
+                   const char* data_end, bool is_final, const char** out_data);
+
+  // Whether the values of the given column are stored
+  bool IsColumnRetained(int32_t col_index) const {
+    return column_slots_.empty() ||
+           (col_index < static_cast<int32_t>(column_slots_.size()) &&
+            column_slots_[col_index] >= 0);
+  }
+  // The position of a column's values in a stored row
+  int32_t value_slot(int32_t col_index) const {
+    return column_slots_.empty() ? col_index : column_slots_[col_index];
+  }
+  // The number of values stored per row
+  int32_t num_value_cols() const {
+    return column_slots_.empty() ? num_cols_ : num_retained_cols_;
+  }
 
   MemoryPool* pool_;
   const ParseOptions options_;
@@ -156,6 +215,10 @@ class ARROW_EXPORT BlockParser {
   int32_t num_cols_;
   // The maximum number of rows to parse from this block
   int32_t max_num_rows_;
+  // For each column, its position in a stored row or -1 if the column is
+  // skipped (empty if all columns are retained)
+  std::vector<int32_t> column_slots_;
+  int32_t num_retained_cols_ = 0;
 
   // Linear scratchpad for parsed values
   struct ValueDesc {
@@ -163,8 +226,8 @@ class ARROW_EXPORT BlockParser {
     bool quoted : 1;
   };
 
-  // XXX should we ensure the parsed buffer is padded with 8 or 16 excess zero bytes?
-  // It may help with null parsing...
+  // The parsed buffer is followed by kParsedPadding zero bytes (see
+  // PresizedParsedWriter::Finish)
   std::vector<std::shared_ptr<Buffer>> values_buffers_;
   std::shared_ptr<Buffer> parsed_buffer_;
   const uint8_t* parsed_;
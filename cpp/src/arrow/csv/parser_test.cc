@@ -623,5 +623,81 @@ TEST(BlockParser, QuotedEscape) {
   }
 }
 
+TEST(BlockParser, LongFields) {
+  // Fields spanning several SIMD-scanned windows, with special characters
+  // at varying offsets
+  const std::string long_a(100, 'a');
+  const std::string long_b(70, 'b');
+  auto options = ParseOptions::Defaults();
+  options.escaping = true;
+
+  {
+    auto csv = MakeCSVData({long_a + "," + long_b + "\n", long_b + ",x\r\n",
+                            "y," + long_a + "\n"});
+    BlockParser parser(options);
+    AssertParseOk(parser, csv);
+    AssertColumnsEq(parser, {{long_a, long_b, "y"}, {long_b, "x", long_a}});
+  }
+  {
+    auto csv =
+        MakeCSVData({"\"" + long_a + ",\"\"" + long_b + "\\\"\"," + long_b + "\\,z\n",
+                     "\"" + long_b + "\n" + long_a + "\",\n"});
+    BlockParser parser(options);
+    AssertParseOk(parser, csv);
+    AssertColumnsEq(parser,
+                    {{long_a + ",\"" + long_b + "\"", long_b + "\n" + long_a},
+                     {long_b + ",z", ""}},
+                    {{true, true}, {false, false}} /* quoted */);
+  }
+}
+
+TEST(BlockParser, ColumnMask) {
+  auto options = ParseOptions::Defaults();
+  options.escaping = true;
+  const std::string long_field(100, 'x');
+
+  auto csv = MakeCSVData({"a,\"b,\"\"c\",y,d\n", "e,f\\,g,x,\"h\"\n", "\n",
+                          long_field + "," + long_field + ",i," + long_field + "\n",
+                          ",j,\"\\\"k\",l\n"});
+  {
+    BlockParser parser(default_memory_pool(), options, {false, true, false, true});
+    AssertParseOk(parser, csv);
+    ASSERT_EQ(parser.num_cols(), 4);
+    ASSERT_EQ(parser.num_rows(), 4);
+    AssertColumnEq(parser, 1, {"b,\"c", "f,g", long_field, "j"},
+                   {true, false, false, false});
+    AssertColumnEq(parser, 3, {"d", "h", long_field, "l"}, {false, true, false, false});
+    std::vector<std::string> last_row;
+    GetLastRow(parser, &last_row);
+    ASSERT_EQ(last_row, std::vector<std::string>({"j", "l"}));
+  }
+  {
+    // Trailing field in final block
+    BlockParser parser(default_memory_pool(), options, {true, false, true});
+    AssertParseFinal(parser, "a,b,c\nd,e,f");
+    AssertColumnEq(parser, 0, {"a", "d"});
+    AssertColumnEq(parser, 2, {"c", "f"});
+    ASSERT_EQ(parser.num_bytes(), 4);
+  }
+  {
+    BlockParser parser(default_memory_pool(), options, {true, false, true});
+    AssertParseFinal(parser, "a,b,c\nd,e,\"f");
+    AssertColumnEq(parser, 2, {"c", "f"});
+  }
+  {
+    // No retained columns
+    BlockParser parser(default_memory_pool(), options, {false, false});
+    AssertParseOk(parser, "a,b\nc,d\n");
+    ASSERT_EQ(parser.num_rows(), 2);
+    ASSERT_EQ(parser.num_bytes(), 0);
+  }
+  {
+    // Mismatching number of columns is still detected
+    BlockParser parser(default_memory_pool(), options, {true, false});
+    uint32_t out_size;
+    ASSERT_RAISES(Invalid, Parse(parser, "a,b\nc,d,e\n", &out_size));
+  }
+}
+
 }  // namespace csv
 }  // namespace arrow
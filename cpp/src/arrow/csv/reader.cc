@@ -17,8 +17,10 @@
 
 #include "arrow/csv/reader.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -36,10 +38,12 @@
 #include "arrow/csv/options.h"
 #include "arrow/csv/parser.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
@@ -264,7 +268,7 @@ class ReaderMixin {
   ReaderMixin(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
               const ReadOptions& read_options, const ParseOptions& parse_options,
               const ConvertOptions& convert_options)
-      : pool_(pool),
+      : pool_(GetTaggedMemoryPool(pool, "csv")),
         read_options_(read_options),
         parse_options_(parse_options),
         convert_options_(convert_options),
@@ -384,10 +388,13 @@ class ReaderMixin {
         col_indices.emplace(column_names_[i], i);
       }
 
+      // Only the values of included columns need to be kept by the parser
+      column_mask_.assign(column_names_.size(), false);
       for (const auto& col_name : convert_options_.include_columns) {
         auto it = col_indices.find(col_name);
         if (it != col_indices.end()) {
           append_csv_column(col_name, it->second);
+          column_mask_[it->second] = true;
         } else if (convert_options_.include_missing_columns) {
           append_null_column(col_name);
         } else {
@@ -409,9 +416,18 @@ class ReaderMixin {
                             const std::shared_ptr<Buffer>& completion,
                             const std::shared_ptr<Buffer>& block, int64_t block_index,
                             bool is_final) {
+    // Checked for each block, including by the parse tasks dequeued after
+    // cancellation, which then don't do any work
+    RETURN_NOT_OK(read_options_.stop_token.Poll());
     static constexpr int32_t max_num_rows = std::numeric_limits<int32_t>::max();
-    auto parser =
-        std::make_shared<BlockParser>(pool_, parse_options_, num_csv_cols_, max_num_rows);
+    std::shared_ptr<BlockParser> parser;
+    if (column_mask_.empty()) {
+      parser = std::make_shared<BlockParser>(pool_, parse_options_, num_csv_cols_,
+                                             max_num_rows);
+    } else {
+      parser = std::make_shared<BlockParser>(pool_, parse_options_, column_mask_,
+                                             max_num_rows);
+    }
 
     std::shared_ptr<Buffer> straddling;
     std::vector<util::string_view> views;
@@ -447,6 +463,8 @@ class ReaderMixin {
   // Column names in the CSV file
   std::vector<std::string> column_names_;
   ConversionSchema conversion_schema_;
+  // Which CSV columns are converted, if not all of them
+  std::vector<bool> column_mask_;
 
   std::shared_ptr<io::InputStream> input_;
   Iterator<std::shared_ptr<Buffer>> buffer_iterator_;
@@ -716,6 +734,149 @@ class SerialStreamingReader : public BaseStreamingReader {
   std::shared_ptr<SerialBlockReader> block_reader_;
 };
 
+/////////////////////////////////////////////////////////////////////////
+// Parallel StreamingReader implementation
+
+class ThreadedStreamingReader : public BaseStreamingReader {
+ public:
+  ThreadedStreamingReader(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                          const ReadOptions& read_options,
+                          const ParseOptions& parse_options,
+                          const ConvertOptions& convert_options, ThreadPool* thread_pool)
+      : BaseStreamingReader(pool, input, read_options, parse_options, convert_options),
+        thread_pool_(thread_pool),
+        max_blocks_ahead_(std::max(thread_pool->GetCapacity(), 1)) {}
+
+  ~ThreadedStreamingReader() override {
+    // Make sure all pending tasks are finished before we start destroying
+    // BaseStreamingReader members
+    for (const auto& parse : pending_parses_) {
+      parse.future.Wait();
+    }
+    if (task_group_) {
+      ARROW_UNUSED(task_group_->Finish());
+    }
+  }
+
+  Status Init() override {
+    ARROW_ASSIGN_OR_RAISE(auto istream_it,
+                          io::MakeInputStreamIterator(input_, read_options_.block_size));
+
+    ARROW_ASSIGN_OR_RAISE(auto rh_it, MakeReadaheadIterator(std::move(istream_it),
+                                                            max_blocks_ahead_));
+    buffer_iterator_ = CSVBufferIterator::Make(std::move(rh_it));
+    task_group_ = internal::TaskGroup::MakeThreaded(thread_pool_);
+
+    // Read schema from first batch
+    ARROW_ASSIGN_OR_RAISE(pending_batch_, ReadNext());
+    DCHECK_NE(schema_, nullptr);
+    return Status::OK();
+  }
+
+ protected:
+  struct PendingParse {
+    int64_t block_index;
+    Future<ParseResult> future;
+  };
+
+  Result<std::shared_ptr<RecordBatch>> ReadNext() override {
+    if (eof_) {
+      return nullptr;
+    }
+    if (block_reader_ == nullptr) {
+      Status st = SetupReader();
+      if (!st.ok()) {
+        // Can't setup reader => bail out
+        eof_ = true;
+        return st;
+      }
+    }
+    auto batch = std::move(pending_batch_);
+    if (batch != nullptr) {
+      return batch;
+    }
+
+    Status st = ScheduleBlocks();
+    if (!st.ok()) {
+      // Read or parse error => bail out
+      eof_ = true;
+      return st;
+    }
+    ++num_decoded_;
+    return DecodeNextBatch();
+  }
+
+  // Keep up to max_blocks_ahead_ blocks being parsed or converted ahead of
+  // the consumer, and make sure the next block to decode was handed to the
+  // column decoders.
+  Status ScheduleBlocks() {
+    while (!source_eof_ && static_cast<int64_t>(pending_parses_.size()) +
+                                   num_inserted_ - num_decoded_ <
+                               max_blocks_ahead_) {
+      ARROW_ASSIGN_OR_RAISE(auto maybe_block, block_reader_->Next());
+      if (!maybe_block.has_value()) {
+        source_eof_ = true;
+        break;
+      }
+      DCHECK(!maybe_block->consume_bytes);
+      RETURN_NOT_OK(read_options_.stop_token.Poll());
+      auto block = *std::move(maybe_block);
+      ARROW_ASSIGN_OR_RAISE(auto future, thread_pool_->Submit([this, block] {
+        return Parse(block.partial, block.completion, block.buffer, block.block_index,
+                     block.is_final);
+      }));
+      pending_parses_.push_back({block.block_index, std::move(future)});
+    }
+
+    // Blocks must be inserted in order, as the column decoders infer types
+    // on the first one.  Only wait for the block which is decoded next.
+    while (!pending_parses_.empty()) {
+      const auto& parse = pending_parses_.front();
+      if (num_inserted_ > num_decoded_ && !IsFutureFinished(parse.future.state())) {
+        break;
+      }
+      ARROW_ASSIGN_OR_RAISE(auto result, parse.future.result());
+      RETURN_NOT_OK(ProcessData(result.parser, parse.block_index));
+      pending_parses_.pop_front();
+      ++num_inserted_;
+    }
+
+    if (source_eof_ && pending_parses_.empty() && !decoders_eof_) {
+      for (auto& decoder : column_decoders_) {
+        decoder->SetEOF(num_inserted_);
+      }
+      decoders_eof_ = true;
+    }
+    return Status::OK();
+  }
+
+  Status SetupReader() {
+    ARROW_ASSIGN_OR_RAISE(auto first_buffer, buffer_iterator_.Next());
+    if (first_buffer == nullptr) {
+      return Status::Invalid("Empty CSV file");
+    }
+    RETURN_NOT_OK(ProcessHeader(first_buffer, &first_buffer));
+    RETURN_NOT_OK(MakeColumnDecoders());
+
+    block_reader_ = std::make_shared<ThreadedBlockReader>(MakeChunker(parse_options_),
+                                                          std::move(buffer_iterator_),
+                                                          std::move(first_buffer));
+    return Status::OK();
+  }
+
+  ThreadPool* thread_pool_;
+  // Maximum number of blocks read ahead of the consumer
+  const int32_t max_blocks_ahead_;
+  std::shared_ptr<ThreadedBlockReader> block_reader_;
+  // Blocks being parsed, in order
+  std::deque<PendingParse> pending_parses_;
+  // Number of blocks handed to the column decoders, and decoded by them
+  int64_t num_inserted_ = 0;
+  int64_t num_decoded_ = 0;
+  bool source_eof_ = false;
+  bool decoders_eof_ = false;
+};
+
 /////////////////////////////////////////////////////////////////////////
 // Serial TableReader implementation
 
@@ -821,6 +982,7 @@ class ThreadedTableReader : public BaseTableReader {
         break;
       }
       DCHECK(!maybe_block->consume_bytes);
+      RETURN_NOT_OK(read_options_.stop_token.Poll());
 
       // Launch parse task
       task_group_->Append([this, maybe_block] {
@@ -864,8 +1026,13 @@ Result<std::shared_ptr<StreamingReader>> StreamingReader::Make(
     const ReadOptions& read_options, const ParseOptions& parse_options,
     const ConvertOptions& convert_options) {
   std::shared_ptr<BaseStreamingReader> reader;
-  reader = std::make_shared<SerialStreamingReader>(pool, input, read_options,
-                                                   parse_options, convert_options);
+  if (read_options.use_threads) {
+    reader = std::make_shared<ThreadedStreamingReader>(
+        pool, input, read_options, parse_options, convert_options, GetCpuThreadPool());
+  } else {
+    reader = std::make_shared<SerialStreamingReader>(pool, input, read_options,
+                                                     parse_options, convert_options);
+  }
   RETURN_NOT_OK(reader->Init());
   return reader;
 }
@@ -56,8 +56,10 @@ class ARROW_EXPORT StreamingReader : public RecordBatchReader {
 
   /// Create a StreamingReader instance
   ///
-  /// Currently, the StreamingReader is always single-threaded (parallel
-  /// readahead is not supported).
+  /// If ReadOptions::use_threads is true, blocks are parsed and converted
+  /// in parallel on the global CPU thread pool, with at most as many blocks
+  /// read ahead of the consumer as the pool's capacity.  Type inference
+  /// still happens on the first block, and batches are yielded in order.
   static Result<std::shared_ptr<StreamingReader>> Make(
       MemoryPool* pool, std::shared_ptr<io::InputStream> input, const ReadOptions&,
       const ParseOptions&, const ConvertOptions&);
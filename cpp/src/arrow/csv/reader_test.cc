@@ -0,0 +1,180 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace csv {
+
+// Set the capacity of the CPU thread pool, which bounds the number of blocks
+// the threaded reader works on ahead of the consumer, for the scope
+class CpuThreadPoolCapacityGuard {
+ public:
+  explicit CpuThreadPoolCapacityGuard(int capacity)
+      : old_capacity_(GetCpuThreadPoolCapacity()) {
+    ARROW_EXPECT_OK(SetCpuThreadPoolCapacity(capacity));
+  }
+  ~CpuThreadPoolCapacityGuard() {
+    ARROW_EXPECT_OK(SetCpuThreadPoolCapacity(old_capacity_));
+  }
+
+ private:
+  const int old_capacity_;
+};
+
+class StreamingReaderTest : public ::testing::TestWithParam<bool> {
+ protected:
+  void SetUp() override {
+    read_options_.use_threads = GetParam();
+    // Small blocks, so as to get several batches
+    read_options_.block_size = 256;
+  }
+
+  Status MakeReader(const std::string& csv) {
+    auto stream = std::make_shared<io::BufferReader>(Buffer::FromString(csv));
+    return StreamingReader::Make(default_memory_pool(), stream, read_options_,
+                                 parse_options_, convert_options_)
+        .Value(&reader_);
+  }
+
+  // Read the whole CSV data serially, for comparison
+  Result<std::shared_ptr<Table>> ReadAsTable(const std::string& csv) {
+    auto stream = std::make_shared<io::BufferReader>(Buffer::FromString(csv));
+    auto read_options = read_options_;
+    read_options.use_threads = false;
+    ARROW_ASSIGN_OR_RAISE(auto reader,
+                          TableReader::Make(default_memory_pool(), stream, read_options,
+                                            parse_options_, convert_options_));
+    return reader->Read();
+  }
+
+  static std::string MakeLines(int64_t num_lines, int64_t first_line = 0) {
+    std::stringstream ss;
+    for (int64_t i = first_line; i < first_line + num_lines; ++i) {
+      ss << i << ",line " << i << "," << i * 0.5 << "\n";
+    }
+    return ss.str();
+  }
+
+  // Read all the batches and check them against the serial table reader
+  void AssertReadsAsTable(const std::string& csv) {
+    ASSERT_OK(MakeReader(csv));
+    ASSERT_OK_AND_ASSIGN(auto expected, ReadAsTable(csv));
+    AssertSchemaEqual(*expected->schema(), *reader_->schema());
+
+    RecordBatchVector batches;
+    ASSERT_OK(reader_->ReadAll(&batches));
+    ASSERT_GT(batches.size(), 1U);
+    ASSERT_OK_AND_ASSIGN(auto actual, Table::FromRecordBatches(batches));
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+
+    // The end of stream is sticky
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(reader_->ReadNext(&batch));
+    ASSERT_EQ(batch, nullptr);
+  }
+
+  ReadOptions read_options_ = ReadOptions::Defaults();
+  ParseOptions parse_options_ = ParseOptions::Defaults();
+  ConvertOptions convert_options_ = ConvertOptions::Defaults();
+  std::shared_ptr<StreamingReader> reader_;
+};
+
+INSTANTIATE_TEST_SUITE_P(StreamingReaderTest, StreamingReaderTest,
+                         ::testing::Values(false, true));
+
+TEST_P(StreamingReaderTest, Basics) {
+  ASSERT_NO_FATAL_FAILURE(AssertReadsAsTable("a,b,c\n" + MakeLines(200)));
+}
+
+TEST_P(StreamingReaderTest, BlocksAhead) {
+  // Batches come out in order whatever the number of blocks read ahead
+  for (int capacity : {1, 2, 8}) {
+    SCOPED_TRACE("capacity = " + std::to_string(capacity));
+    CpuThreadPoolCapacityGuard guard(capacity);
+    ASSERT_NO_FATAL_FAILURE(AssertReadsAsTable("a,b,c\n" + MakeLines(500)));
+  }
+}
+
+TEST_P(StreamingReaderTest, InferenceOnFirstBlock) {
+  // "a" is promoted from int64 to double within the first block
+  auto csv = "a,b,c\n1,x,1\n2.5,y,2\n" + MakeLines(200, 3);
+  ASSERT_OK(MakeReader(csv));
+  auto expected_schema =
+      schema({field("a", float64()), field("b", utf8()), field("c", float64())});
+  AssertSchemaEqual(*expected_schema, *reader_->schema());
+
+  std::shared_ptr<Table> table;
+  ASSERT_OK(reader_->ReadAll(&table));
+  AssertSchemaEqual(*expected_schema, *table->schema());
+  ASSERT_EQ(table->num_rows(), 202);
+}
+
+TEST_P(StreamingReaderTest, ErrorInLaterBlock) {
+  // Blocks far from the start don't take part in inference, so a value which
+  // doesn't fit the inferred type is a conversion error
+  {
+    ASSERT_OK(MakeReader("a,b,c\n" + MakeLines(500) + "not a number,x,1\n"));
+    AssertTypeEqual(*int64(), *reader_->schema()->field(0)->type());
+    int64_t num_rows = 0;
+    std::shared_ptr<RecordBatch> batch;
+    Status st;
+    while ((st = reader_->ReadNext(&batch)).ok() && batch != nullptr) {
+      num_rows += batch->num_rows();
+    }
+    ASSERT_RAISES(Invalid, st);
+    ASSERT_GT(num_rows, 0);
+    ASSERT_LT(num_rows, 500);
+  }
+  // Parse error
+  {
+    ASSERT_OK(MakeReader("a,b,c\n" + MakeLines(500) + "1,2\n"));
+    RecordBatchVector batches;
+    ASSERT_RAISES(Invalid, reader_->ReadAll(&batches));
+  }
+}
+
+TEST_P(StreamingReaderTest, DestroyWhilePending) {
+  CpuThreadPoolCapacityGuard guard(4);
+  auto csv = "a,b,c\n" + MakeLines(2000);
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_OK(MakeReader(csv));
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(reader_->ReadNext(&batch));
+    ASSERT_NE(batch, nullptr);
+    // Blocks are still being parsed and converted
+    reader_.reset();
+  }
+}
+
+TEST_P(StreamingReaderTest, Empty) { ASSERT_RAISES(Invalid, MakeReader("")); }
+
+}  // namespace csv
+}  // namespace arrow
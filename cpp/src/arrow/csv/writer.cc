@@ -0,0 +1,350 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/writer.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/array/builder_binary.h"
+#include "arrow/csv/options.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/formatting.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::is_formattable;
+using internal::StringFormatter;
+
+namespace csv {
+
+namespace {
+
+// The characters the formatters of non-string values may emit
+constexpr char kFormattedChars[] = "0123456789+-.:eEinfatrulsINFNA ";
+
+// The cells of a column, formatted and quoted, concatenated
+struct FormattedColumn {
+  std::string data;
+  // The end offset of each cell in `data`
+  std::vector<int64_t> ends;
+
+  util::string_view cell(int64_t i) const {
+    const int64_t start = i == 0 ? 0 : ends[i - 1];
+    return util::string_view(data.data() + start, ends[i] - start);
+  }
+};
+
+class ColumnFormatter {
+ public:
+  ColumnFormatter(const WriteOptions& options, FormattedColumn* out)
+      : options_(options), out_(out) {}
+
+  Status Format(const Array& array) {
+    array_ = &array;
+    out_->data.clear();
+    out_->ends.clear();
+    out_->ends.reserve(array.length());
+    return VisitTypeInline(*array.type(), this);
+  }
+
+  // Whether the data holds a character which must be quoted.  The scan
+  // doesn't exit early inside a run of bytes, so that it vectorizes.
+  bool NeedsQuoting(const uint8_t* data, int64_t size) const {
+    constexpr int64_t kRunSize = 4096;
+    const uint8_t delimiter = static_cast<uint8_t>(options_.delimiter);
+    const uint8_t quote_char = static_cast<uint8_t>(options_.quote_char);
+    for (int64_t start = 0; start < size; start += kRunSize) {
+      const int64_t end = std::min(size, start + kRunSize);
+      uint8_t found = 0;
+      for (int64_t i = start; i < end; ++i) {
+        const uint8_t c = data[i];
+        found |= (c == delimiter) | (c == quote_char) | (c == '\n') | (c == '\r');
+      }
+      if (found) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool NeedsQuoting(util::string_view value) const {
+    return NeedsQuoting(reinterpret_cast<const uint8_t*>(value.data()),
+                        static_cast<int64_t>(value.size()));
+  }
+
+  template <typename T>
+  enable_if_t<is_formattable<T>::value && !is_base_binary_type<T>::value, Status>
+  Visit(const T& type) {
+    using ArrayType = typename TypeTraits<T>::ArrayType;
+    const auto& array = checked_cast<const ArrayType&>(*array_);
+    StringFormatter<T> formatter(array.type());
+    // Formatted values only need quoting with unusual delimiters
+    const bool may_need_quoting =
+        std::strchr(kFormattedChars, options_.delimiter) != nullptr ||
+        std::strchr(kFormattedChars, options_.quote_char) != nullptr;
+    auto append = [&](util::string_view value) {
+      AppendCell(value, may_need_quoting && NeedsQuoting(value));
+    };
+    for (int64_t i = 0; i < array.length(); ++i) {
+      if (array.IsNull(i)) {
+        AppendNull();
+      } else {
+        formatter(array.Value(i), append);
+      }
+    }
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_base_binary<T, Status> Visit(const T& type) {
+    using ArrayType = typename TypeTraits<T>::ArrayType;
+    const auto& array = checked_cast<const ArrayType&>(*array_);
+    const int64_t length = array.length();
+    if (length == 0) {
+      return Status::OK();
+    }
+    // Scan the values of the whole chunk at once, most chunks need no quoting
+    const int64_t data_start = array.value_offset(0);
+    const int64_t data_size = array.value_offset(length) - data_start;
+    const bool may_need_quoting = NeedsQuoting(array.raw_data() + data_start, data_size);
+    out_->data.reserve(data_size + length);
+    for (int64_t i = 0; i < length; ++i) {
+      if (array.IsNull(i)) {
+        AppendNull();
+        continue;
+      }
+      const auto value = array.GetView(i);
+      if (value.empty() && options_.null_string.empty()) {
+        // Tell empty strings apart from nulls
+        AppendCell(value, /*quote=*/true);
+      } else {
+        AppendCell(value, may_need_quoting && NeedsQuoting(value));
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const NullType& type) {
+    for (int64_t i = 0; i < array_->length(); ++i) {
+      AppendNull();
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const DictionaryType& type) {
+    // Format the dictionary once, then copy the cells of the indices
+    const auto& array = checked_cast<const DictionaryArray&>(*array_);
+    FormattedColumn dictionary;
+    RETURN_NOT_OK(ColumnFormatter(options_, &dictionary).Format(*array.dictionary()));
+    for (int64_t i = 0; i < array.length(); ++i) {
+      if (array.IsNull(i)) {
+        AppendNull();
+      } else {
+        AppendFormattedCell(dictionary.cell(array.GetValueIndex(i)));
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Cannot write a column of type ", type.ToString(),
+                                  " as CSV");
+  }
+
+ private:
+  void AppendFormattedCell(util::string_view cell) {
+    out_->data.append(cell.data(), cell.size());
+    out_->ends.push_back(static_cast<int64_t>(out_->data.size()));
+  }
+
+  void AppendNull() { AppendFormattedCell(options_.null_string); }
+
+  void AppendCell(util::string_view value, bool quote) {
+    if (!quote) {
+      AppendFormattedCell(value);
+      return;
+    }
+    std::string& data = out_->data;
+    data.push_back(options_.quote_char);
+    for (const char c : value) {
+      if (c == options_.quote_char) {
+        data.push_back(c);
+      }
+      data.push_back(c);
+    }
+    data.push_back(options_.quote_char);
+    out_->ends.push_back(static_cast<int64_t>(data.size()));
+  }
+
+  const WriteOptions& options_;
+  FormattedColumn* out_;
+  const Array* array_ = NULLPTR;
+};
+
+class CSVWriter {
+ public:
+  CSVWriter(const WriteOptions& options, io::OutputStream* output)
+      : options_(options), output_(output) {}
+
+  Status Init(const Schema& schema) {
+    if (options_.batch_size <= 0) {
+      return Status::Invalid("WriteOptions: batch_size must be at least 1");
+    }
+    if (options_.delimiter == options_.quote_char || options_.delimiter == '\n' ||
+        options_.delimiter == '\r') {
+      return Status::Invalid("WriteOptions: invalid delimiter");
+    }
+    if (!options_.include_header || schema.num_fields() == 0) {
+      return Status::OK();
+    }
+    StringBuilder names;
+    for (const auto& field : schema.fields()) {
+      RETURN_NOT_OK(names.Append(field->name()));
+    }
+    std::shared_ptr<Array> names_array;
+    RETURN_NOT_OK(names.Finish(&names_array));
+    FormattedColumn header;
+    RETURN_NOT_OK(ColumnFormatter(options_, &header).Format(*names_array));
+    for (int i = 0; i < schema.num_fields(); ++i) {
+      const auto cell = header.cell(i);
+      block_.append(cell.data(), cell.size());
+      block_.push_back(i + 1 < schema.num_fields() ? options_.delimiter : '\n');
+    }
+    return Status::OK();
+  }
+
+  Status Write(const RecordBatch& batch) {
+    for (int64_t offset = 0; offset < batch.num_rows(); offset += options_.batch_size) {
+      RETURN_NOT_OK(WriteRows(*batch.Slice(offset, options_.batch_size)));
+    }
+    return Status::OK();
+  }
+
+  Status Finish() { return Flush(); }
+
+ private:
+  Status WriteRows(const RecordBatch& batch) {
+    const int ncolumns = batch.num_columns();
+    if (ncolumns == 0) {
+      return Status::OK();
+    }
+    columns_.resize(ncolumns);
+    auto format_column = [&](int i) {
+      return ColumnFormatter(options_, &columns_[i]).Format(*batch.column(i));
+    };
+    auto thread_pool = internal::GetCpuThreadPool();
+    const bool use_threads =
+        options_.use_threads && ncolumns > 1 && !thread_pool->OwnsThisThread();
+    RETURN_NOT_OK(internal::OptionalParallelFor(use_threads, ncolumns, format_column));
+
+    // Assemble the rows
+    int64_t size = batch.num_rows() * ncolumns;
+    for (const auto& column : columns_) {
+      size += static_cast<int64_t>(column.data.size());
+    }
+    block_.reserve(block_.size() + size);
+    for (int64_t row = 0; row < batch.num_rows(); ++row) {
+      for (int i = 0; i < ncolumns; ++i) {
+        const auto cell = columns_[i].cell(row);
+        block_.append(cell.data(), cell.size());
+        block_.push_back(i + 1 < ncolumns ? options_.delimiter : '\n');
+      }
+    }
+    if (static_cast<int64_t>(block_.size()) >= options_.block_size) {
+      return Flush();
+    }
+    return Status::OK();
+  }
+
+  Status Flush() {
+    if (block_.empty()) {
+      return Status::OK();
+    }
+    RETURN_NOT_OK(output_->Write(block_.data(), static_cast<int64_t>(block_.size())));
+    block_.clear();
+    return Status::OK();
+  }
+
+  const WriteOptions& options_;
+  io::OutputStream* output_;
+  // The formatted cells of each column of the rows being written
+  std::vector<FormattedColumn> columns_;
+  // The rows formatted but not written yet
+  std::string block_;
+};
+
+}  // namespace
+
+Status WriteCSV(const Table& table, const WriteOptions& options,
+                io::OutputStream* output) {
+  CSVWriter writer(options, output);
+  RETURN_NOT_OK(writer.Init(*table.schema()));
+  TableBatchReader reader(table);
+  reader.set_chunksize(options.batch_size);
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(reader.ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    RETURN_NOT_OK(writer.Write(*batch));
+  }
+  return writer.Finish();
+}
+
+Status WriteCSV(const RecordBatch& batch, const WriteOptions& options,
+                io::OutputStream* output) {
+  CSVWriter writer(options, output);
+  RETURN_NOT_OK(writer.Init(*batch.schema()));
+  RETURN_NOT_OK(writer.Write(batch));
+  return writer.Finish();
+}
+
+Status WriteCSV(RecordBatchReader* reader, const WriteOptions& options,
+                io::OutputStream* output) {
+  CSVWriter writer(options, output);
+  RETURN_NOT_OK(writer.Init(*reader->schema()));
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(reader->ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    RETURN_NOT_OK(writer.Write(*batch));
+  }
+  return writer.Finish();
+}
+
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,58 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "arrow/csv/options.h"  // IWYU pragma: keep
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+class OutputStream;
+}  // namespace io
+
+namespace csv {
+
+/// \brief Write a table as CSV
+///
+/// Up to WriteOptions::batch_size rows are formatted at once, each column
+/// into its own buffer (in parallel if WriteOptions::use_threads is true),
+/// then the rows are assembled into blocks of WriteOptions::block_size bytes
+/// written to the output.  Values are formatted so that the CSV reader parses
+/// them back, e.g. timestamps as "YYYY-MM-DD hh:mm:ss".
+///
+/// Boolean, numeric, temporal, string, binary and null columns are supported,
+/// as well as dictionary columns of these types.
+ARROW_EXPORT
+Status WriteCSV(const Table& table, const WriteOptions& options,
+                io::OutputStream* output);
+
+/// \brief Write a record batch as CSV
+ARROW_EXPORT
+Status WriteCSV(const RecordBatch& batch, const WriteOptions& options,
+                io::OutputStream* output);
+
+/// \brief Write the record batches of a reader as CSV, as they are read
+ARROW_EXPORT
+Status WriteCSV(RecordBatchReader* reader, const WriteOptions& options,
+                io::OutputStream* output);
+
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,77 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <memory>
+
+#include "arrow/csv/options.h"
+#include "arrow/csv/writer.h"
+#include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace csv {
+
+constexpr int64_t kNumRows = 100000;
+
+static void BenchmarkWrite(benchmark::State& state,  // NOLINT non-const reference
+                           const std::shared_ptr<Array>& column) {
+  constexpr int kNumColumns = 4;
+  FieldVector fields;
+  ArrayVector columns;
+  for (int i = 0; i < kNumColumns; ++i) {
+    fields.push_back(field("f" + std::to_string(i), column->type()));
+    columns.push_back(column);
+  }
+  auto batch = RecordBatch::Make(schema(fields), column->length(), columns);
+  auto options = WriteOptions::Defaults();
+
+  int64_t total_bytes = 0;
+  for (auto _ : state) {
+    auto out = *io::BufferOutputStream::Create();
+    ABORT_NOT_OK(WriteCSV(*batch, options, out.get()));
+    total_bytes += *out->Tell();
+  }
+  state.SetBytesProcessed(total_bytes);
+  state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+static void WriteInt64(benchmark::State& state) {  // NOLINT non-const reference
+  random::RandomArrayGenerator rng(42);
+  BenchmarkWrite(state, rng.Int64(kNumRows, -1000000, 1000000, /*null_probability=*/0.1));
+}
+
+static void WriteFloat64(benchmark::State& state) {  // NOLINT non-const reference
+  random::RandomArrayGenerator rng(42);
+  BenchmarkWrite(state, rng.Float64(kNumRows, -1e6, 1e6, /*null_probability=*/0.1));
+}
+
+static void WriteString(benchmark::State& state) {  // NOLINT non-const reference
+  random::RandomArrayGenerator rng(42);
+  BenchmarkWrite(state, rng.String(kNumRows, 0, 20, /*null_probability=*/0.1));
+}
+
+BENCHMARK(WriteInt64);
+BENCHMARK(WriteFloat64);
+BENCHMARK(WriteString);
+
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,200 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/csv/writer.h"
+#include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace csv {
+
+class TestCSVWriter : public ::testing::Test {
+ public:
+  void SetUp() override {
+    options_ = WriteOptions::Defaults();
+    schema_ = schema({field("i", int32()), field("s", utf8()), field("b", boolean())});
+  }
+
+  std::shared_ptr<RecordBatch> MakeBatch(const std::vector<int32_t>& ints,
+                                         const std::vector<std::string>& strings,
+                                         const std::vector<bool>& is_valid) {
+    std::vector<bool> bools;
+    for (size_t i = 0; i < ints.size(); ++i) {
+      bools.push_back(ints[i] % 2 == 0);
+    }
+    std::shared_ptr<Array> i, s, b;
+    ArrayFromVector<Int32Type, int32_t>(int32(), is_valid, ints, &i);
+    ArrayFromVector<StringType, std::string>(utf8(), is_valid, strings, &s);
+    ArrayFromVector<BooleanType, bool>(boolean(), bools, &b);
+    return RecordBatch::Make(schema_, static_cast<int64_t>(ints.size()), {i, s, b});
+  }
+
+  template <typename Input>
+  void AssertWrite(const Input& input, const std::string& expected) {
+    ASSERT_OK_AND_ASSIGN(auto out, io::BufferOutputStream::Create());
+    ASSERT_OK(WriteCSV(input, options_, out.get()));
+    ASSERT_OK_AND_ASSIGN(auto buffer, out->Finish());
+    ASSERT_EQ(buffer->ToString(), expected);
+  }
+
+ protected:
+  WriteOptions options_;
+  std::shared_ptr<Schema> schema_;
+};
+
+TEST_F(TestCSVWriter, Basics) {
+  auto batch = MakeBatch({1, -2, 3}, {"a", "bc", ""}, {true, true, true});
+  AssertWrite(*batch, "i,s,b\n1,a,false\n-2,bc,true\n3,\"\",false\n");
+
+  options_.include_header = false;
+  options_.delimiter = ';';
+  AssertWrite(*batch, "1;a;false\n-2;bc;true\n3;\"\";false\n");
+
+  batch = MakeBatch({}, {}, {});
+  options_.include_header = true;
+  AssertWrite(*batch, "i;s;b\n");
+}
+
+TEST_F(TestCSVWriter, Quoting) {
+  auto batch = MakeBatch({1, 2, 3, 4}, {"a,b", "say \"hi\"", "two\nlines", "plain"},
+                         {true, true, true, true});
+  AssertWrite(*batch,
+              "i,s,b\n1,\"a,b\",false\n2,\"say \"\"hi\"\"\",true\n"
+              "3,\"two\nlines\",false\n4,plain,true\n");
+
+  // Numbers need quoting with a delimiter they may contain
+  options_.include_header = false;
+  options_.delimiter = '-';
+  batch = MakeBatch({-1}, {"x"}, {true});
+  AssertWrite(*batch, "\"-1\"-x-false\n");
+
+  options_.delimiter = ',';
+  schema_ = schema({field("a,b", int32()), field("s", utf8()), field("b", boolean())});
+  options_.include_header = true;
+  batch = MakeBatch({}, {}, {});
+  AssertWrite(*batch, "\"a,b\",s,b\n");
+}
+
+TEST_F(TestCSVWriter, Nulls) {
+  auto batch = MakeBatch({1, 2, 3}, {"a", "", ""}, {true, false, true});
+  AssertWrite(*batch, "i,s,b\n1,a,false\n,,true\n3,\"\",false\n");
+
+  options_.null_string = "NA";
+  AssertWrite(*batch, "i,s,b\n1,a,false\nNA,NA,true\n3,,false\n");
+
+  auto null_schema = schema({field("n", null())});
+  batch = RecordBatch::Make(null_schema, 2, {std::make_shared<NullArray>(2)});
+  AssertWrite(*batch, "n\nNA\nNA\n");
+}
+
+TEST_F(TestCSVWriter, Temporal) {
+  std::shared_ptr<Array> dates, timestamps;
+  ArrayFromVector<Date32Type, int32_t>(date32(), {0, 18000}, &dates);
+  ArrayFromVector<TimestampType, int64_t>(timestamp(TimeUnit::SECOND), {0, 86461},
+                                          &timestamps);
+  auto temporal_schema = schema({field("d", date32()), field("t", timestamps->type())});
+  auto batch = RecordBatch::Make(temporal_schema, 2, {dates, timestamps});
+  AssertWrite(*batch,
+              "d,t\n1970-01-01,1970-01-01 00:00:00\n2019-04-14,1970-01-02 00:01:01\n");
+}
+
+TEST_F(TestCSVWriter, Dictionary) {
+  std::shared_ptr<Array> indices, dictionary;
+  ArrayFromVector<Int8Type, int8_t>(int8(), {true, true, false, true}, {1, 0, 0, 1},
+                                    &indices);
+  ArrayFromVector<StringType, std::string>(utf8(), {"x,y", "z"}, &dictionary);
+  auto type = ::arrow::dictionary(int8(), utf8());
+  auto column = std::make_shared<DictionaryArray>(type, indices, dictionary);
+  auto batch = RecordBatch::Make(schema({field("d", type)}), 4, {column});
+  AssertWrite(*batch, "d\nz\n\"x,y\"\n\nz\n");
+}
+
+TEST_F(TestCSVWriter, Unsupported) {
+  std::shared_ptr<Array> values;
+  ArrayFromVector<Int32Type, int32_t>(int32(), {1}, &values);
+  ASSERT_OK_AND_ASSIGN(auto column, StructArray::Make({values}, {"x"}));
+  auto batch = RecordBatch::Make(schema({field("st", column->type())}), 1, {column});
+  ASSERT_OK_AND_ASSIGN(auto out, io::BufferOutputStream::Create());
+  ASSERT_RAISES(NotImplemented, WriteCSV(*batch, options_, out.get()));
+
+  options_.delimiter = options_.quote_char;
+  ASSERT_RAISES(Invalid, WriteCSV(*MakeBatch({}, {}, {}), options_, out.get()));
+}
+
+TEST_F(TestCSVWriter, MultipleBatches) {
+  auto batch1 = MakeBatch({1, 2}, {"a", "b"}, {true, true});
+  auto batch2 = MakeBatch({3}, {"c"}, {true});
+  const std::string expected = "i,s,b\n1,a,false\n2,b,true\n3,c,false\n";
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches({batch1, batch2}));
+
+  for (const int32_t batch_size : {1, 2, 1000}) {
+    for (const int64_t block_size : {1, 1 << 20}) {
+      SCOPED_TRACE("batch_size = " + std::to_string(batch_size) +
+                   ", block_size = " + std::to_string(block_size));
+      options_.batch_size = batch_size;
+      options_.block_size = block_size;
+      AssertWrite(*table, expected);
+      TableBatchReader reader(*table);
+      AssertWrite(&reader, expected);
+    }
+  }
+}
+
+TEST_F(TestCSVWriter, RoundTrip) {
+  std::vector<int32_t> ints;
+  std::vector<std::string> strings;
+  std::vector<bool> is_valid;
+  for (int32_t i = 0; i < 1000; ++i) {
+    ints.push_back(i * 7 - 3000);
+    strings.push_back(i % 3 == 0 ? "some \"quoted\", text" : std::to_string(i) + "s");
+    is_valid.push_back(i % 11 != 0);
+  }
+  auto batch = MakeBatch(ints, strings, is_valid);
+  options_.batch_size = 100;
+  options_.null_string = "N/A";
+
+  ASSERT_OK_AND_ASSIGN(auto out, io::BufferOutputStream::Create());
+  ASSERT_OK(WriteCSV(*batch, options_, out.get()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, out->Finish());
+
+  auto convert_options = ConvertOptions::Defaults();
+  convert_options.column_types = {{"i", int32()}, {"s", utf8()}, {"b", boolean()}};
+  convert_options.strings_can_be_null = true;
+  ASSERT_OK_AND_ASSIGN(
+      auto reader,
+      TableReader::Make(default_memory_pool(), std::make_shared<io::BufferReader>(buffer),
+                        ReadOptions::Defaults(), ParseOptions::Defaults(),
+                        convert_options));
+  ASSERT_OK_AND_ASSIGN(auto table, reader->Read());
+  ASSERT_OK_AND_ASSIGN(auto expected, Table::FromRecordBatches({batch}));
+  AssertTablesEqual(*expected, *table, /*same_chunk_layout=*/false);
+}
+
+}  // namespace csv
+}  // namespace arrow
@@ -23,6 +23,7 @@
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/dataset/scanner_internal.h"
 #include "arrow/table.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/iterator.h"
@@ -55,6 +56,43 @@ Result<std::shared_ptr<Schema>> Fragment::ReadPhysicalSchema() {
   return physical_schema_;
 }
 
+Result<int64_t> Fragment::CountRows(std::shared_ptr<Expression> predicate,
+                                   std::shared_ptr<ScanOptions> options,
+                                   std::shared_ptr<ScanContext> context) {
+  if (!predicate->IsSatisfiable()) {
+    return 0;
+  }
+  if (predicate->Equals(true)) {
+    const int64_t num_rows = CountRowsFromMetadata();
+    if (num_rows >= 0) {
+      return num_rows;
+    }
+  }
+  return ScanCountRows(predicate, std::move(options), std::move(context));
+}
+
+Result<int64_t> Fragment::ScanCountRows(const std::shared_ptr<Expression>& predicate,
+                                        std::shared_ptr<ScanOptions> options,
+                                        std::shared_ptr<ScanContext> context) {
+  const ExpressionEvaluator& evaluator = *options->evaluator;
+  MemoryPool* pool = context->pool;
+  const StopToken stop_token = context->stop_token;
+  ARROW_ASSIGN_OR_RAISE(auto scan_tasks, Scan(std::move(options), std::move(context)));
+  int64_t num_rows = 0;
+  for (auto maybe_scan_task : scan_tasks) {
+    ARROW_ASSIGN_OR_RAISE(auto scan_task, std::move(maybe_scan_task));
+    ARROW_ASSIGN_OR_RAISE(auto batches, scan_task->Execute());
+    for (auto maybe_batch : batches) {
+      ARROW_ASSIGN_OR_RAISE(auto batch, std::move(maybe_batch));
+      RETURN_NOT_OK(stop_token.Poll());
+      ARROW_ASSIGN_OR_RAISE(auto batch_rows,
+                            CountRowsSatisfying(*predicate, evaluator, batch, pool));
+      num_rows += batch_rows;
+    }
+  }
+  return num_rows;
+}
+
 Result<std::shared_ptr<Schema>> InMemoryFragment::ReadPhysicalSchemaImpl() {
   return physical_schema_;
 }
@@ -95,6 +133,14 @@ Result<ScanTaskIterator> InMemoryFragment::Scan(std::shared_ptr<ScanOptions> opt
   return MakeMapIterator(fn, std::move(batches_it));
 }
 
+int64_t InMemoryFragment::CountRowsFromMetadata() {
+  int64_t num_rows = 0;
+  for (const auto& batch : record_batches_) {
+    num_rows += batch->num_rows();
+  }
+  return num_rows;
+}
+
 Dataset::Dataset(std::shared_ptr<Schema> schema,
                  std::shared_ptr<Expression> partition_expression)
     : schema_(std::move(schema)), partition_expression_(std::move(partition_expression)) {
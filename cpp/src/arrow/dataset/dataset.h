@@ -67,6 +67,24 @@ class ARROW_DS_EXPORT Fragment {
   /// \brief Return true if the fragment can benefit from parallel scanning.
   virtual bool splittable() const = 0;
 
+  /// \brief Return the number of rows of the Fragment if it's known without
+  /// reading any data, e.g. from metadata already loaded, or -1.
+  virtual int64_t CountRowsFromMetadata() { return -1; }
+
+  /// \brief Count the rows of the Fragment satisfying a predicate.
+  ///
+  /// The predicate must already be simplified with the partition expression.
+  /// Rows are counted from metadata where it's conclusive, e.g. where
+  /// statistics show that all or none of the rows of a row group satisfy the
+  /// predicate, and the other rows are scanned.  The scanned columns are those
+  /// materialized by `options`, which should only reference the predicate.
+  ///
+  /// The default implementation scans the whole Fragment unless the predicate
+  /// is trivial.
+  virtual Result<int64_t> CountRows(std::shared_ptr<Expression> predicate,
+                                    std::shared_ptr<ScanOptions> options,
+                                    std::shared_ptr<ScanContext> context);
+
   virtual std::string type_name() const = 0;
 
   /// \brief An expression which evaluates to true for all data viewed by this
@@ -84,6 +102,11 @@ class ARROW_DS_EXPORT Fragment {
 
   virtual Result<std::shared_ptr<Schema>> ReadPhysicalSchemaImpl() = 0;
 
+  /// \brief Count the rows satisfying a predicate by scanning the Fragment.
+  Result<int64_t> ScanCountRows(const std::shared_ptr<Expression>& predicate,
+                                std::shared_ptr<ScanOptions> options,
+                                std::shared_ptr<ScanContext> context);
+
   util::Mutex physical_schema_mutex_;
   std::shared_ptr<Expression> partition_expression_ = scalar(true);
   std::shared_ptr<Schema> physical_schema_;
@@ -103,6 +126,8 @@ class ARROW_DS_EXPORT InMemoryFragment : public Fragment {
 
   bool splittable() const override { return false; }
 
+  int64_t CountRowsFromMetadata() override;
+
   std::string type_name() const override { return "in-memory"; }
 
  protected:
@@ -26,6 +26,7 @@
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/record_batch.h"
+#include "arrow/result.h"
 #include "arrow/scalar.h"
 #include "arrow/type.h"
 #include "arrow/util/iterator.h"
@@ -70,5 +71,21 @@ inline std::shared_ptr<Schema> SchemaFromColumnNames(
   return schema(std::move(columns))->WithMetadata(input->metadata());
 }
 
+/// \brief Return the indices of the top-level fields of a file's schema which
+/// must be read to materialize the given fields. Missing fields are skipped.
+inline Result<std::vector<int>> GetIncludedFields(
+    const Schema& schema, const std::vector<std::string>& materialized_fields) {
+  std::vector<int> included_fields;
+
+  for (FieldRef ref : materialized_fields) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(schema));
+    if (match.indices().empty()) continue;
+
+    included_fields.push_back(match.indices()[0]);
+  }
+
+  return included_fields;
+}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -341,6 +341,73 @@ TEST(TestProjector, NonTrivial) {
   AssertBatchesEqual(*expected_batch, *reconciled_batch);
 }
 
+TEST(TestProjector, SharesConstantColumns) {
+  static constexpr int64_t kBatchSize = 1024;
+  static constexpr int32_t kScalarValue = 3;
+
+  auto from_schema = schema({field("f64", float64())});
+  auto to_schema = schema(
+      {field("i32", int32()), field("f64", float64()), field("null_i32", int32())});
+
+  RecordBatchProjector projector(to_schema);
+  ASSERT_OK(projector.SetDefaultValue(to_schema->GetFieldIndex("i32"),
+                                      std::make_shared<Int32Scalar>(kScalarValue)));
+  // A null default value yields a column of nulls
+  ASSERT_OK(projector.SetDefaultValue(to_schema->GetFieldIndex("null_i32"),
+                                      std::make_shared<Int32Scalar>()));
+
+  // Nothing is materialized while no field is missing
+  ProxyMemoryPool pool(default_memory_pool());
+  auto complete_batch = ConstantArrayGenerator::Zeroes(kBatchSize, to_schema);
+  ASSERT_OK_AND_ASSIGN(auto projected, projector.Project(*complete_batch, &pool));
+  AssertBatchesEqual(*complete_batch, *projected);
+  ASSERT_EQ(pool.bytes_allocated(), 0);
+
+  auto AssertProjected = [&](RecordBatchProjector* projector, int64_t length,
+                             std::shared_ptr<RecordBatch>* out) {
+    auto batch = ConstantArrayGenerator::Zeroes(length, from_schema);
+    ASSERT_OK_AND_ASSIGN(
+        auto array_i32, ArrayFromBuilderVisitor(int32(), length, [](Int32Builder* b) {
+          b->UnsafeAppend(kScalarValue);
+        }));
+    ASSERT_OK_AND_ASSIGN(auto null_i32, MakeArrayOfNull(int32(), length));
+    auto expected_batch =
+        RecordBatch::Make(to_schema, length, {array_i32, batch->column(0), null_i32});
+
+    ASSERT_OK_AND_ASSIGN(auto projected, projector->Project(*batch, &pool));
+    AssertBatchesEqual(*expected_batch, *projected);
+    if (out != nullptr) {
+      *out = std::move(projected);
+    }
+  };
+
+  std::shared_ptr<RecordBatch> first, shorter, longer;
+  ASSERT_NO_FATAL_FAILURE(AssertProjected(&projector, kBatchSize, &first));
+  auto bytes_allocated = pool.bytes_allocated();
+  ASSERT_GT(bytes_allocated, 0);
+
+  // A copy of the projector reuses the columns for shorter batches
+  auto copy = projector;
+  ASSERT_NO_FATAL_FAILURE(AssertProjected(&copy, kBatchSize / 2, &shorter));
+  ASSERT_EQ(pool.bytes_allocated(), bytes_allocated);
+  ASSERT_EQ(shorter->column(0)->data()->buffers[1]->data(),
+            first->column(0)->data()->buffers[1]->data());
+
+  // and grows them for longer batches
+  ASSERT_NO_FATAL_FAILURE(AssertProjected(&copy, kBatchSize * 2, &longer));
+  ASSERT_NO_FATAL_FAILURE(AssertProjected(&projector, kBatchSize / 2, &shorter));
+  ASSERT_EQ(shorter->column(0)->data()->buffers[1]->data(),
+            longer->column(0)->data()->buffers[1]->data());
+
+  // Changing a default value discards the columns materialized for the previous one
+  ASSERT_OK(projector.SetDefaultValue(to_schema->GetFieldIndex("i32"),
+                                      std::make_shared<Int32Scalar>()));
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, from_schema);
+  ASSERT_OK_AND_ASSIGN(projected, projector.Project(*batch, &pool));
+  ASSERT_EQ(projected->column(0)->null_count(), kBatchSize);
+  ASSERT_NO_FATAL_FAILURE(AssertProjected(&copy, kBatchSize, &projected));
+}
+
 class TestEndToEnd : public TestUnionDataset {
   void SetUp() override {
     bool nullable = false;
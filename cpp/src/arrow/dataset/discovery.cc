@@ -31,6 +31,7 @@
 #include "arrow/filesystem/path_forest.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 namespace dataset {
@@ -111,22 +112,48 @@ FileSystemDatasetFactory::FileSystemDatasetFactory(
       format_(std::move(format)),
       options_(std::move(options)) {}
 
+namespace {
+
+// Keep the files supported by `format` if the options ask to exclude invalid ones
+Result<std::vector<fs::FileInfo>> FilterSupportedFiles(
+    const std::shared_ptr<fs::FileSystem>& filesystem, std::vector<fs::FileInfo> files,
+    const FileFormat& format, const FileSystemFactoryOptions& options) {
+  if (!options.exclude_invalid_files) {
+    return files;
+  }
+
+  std::vector<char> supported(files.size(), false);
+  RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+      options.use_threads, static_cast<int>(files.size()), [&](int i) -> Status {
+        ARROW_ASSIGN_OR_RAISE(bool is_supported,
+                              format.IsSupported(FileSource(files[i], filesystem)));
+        supported[i] = is_supported;
+        return Status::OK();
+      }));
+
+  std::vector<fs::FileInfo> filtered_files;
+  for (size_t i = 0; i < files.size(); ++i) {
+    if (supported[i]) {
+      filtered_files.push_back(std::move(files[i]));
+    }
+  }
+  return filtered_files;
+}
+
+}  // namespace
+
 Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
     std::shared_ptr<fs::FileSystem> filesystem, const std::vector<std::string>& paths,
     std::shared_ptr<FileFormat> format, FileSystemFactoryOptions options) {
-  std::vector<fs::FileInfo> filtered_files;
+  std::vector<fs::FileInfo> files;
   for (const auto& path : paths) {
-    if (options.exclude_invalid_files) {
-      ARROW_ASSIGN_OR_RAISE(auto supported,
-                            format->IsSupported(FileSource(path, filesystem)));
-      if (!supported) {
-        continue;
-      }
-    }
-
-    filtered_files.emplace_back(path);
+    files.emplace_back(path);
   }
 
+  ARROW_ASSIGN_OR_RAISE(
+      auto filtered_files,
+      FilterSupportedFiles(filesystem, std::move(files), *format, options));
+
   return std::shared_ptr<DatasetFactory>(
       new FileSystemDatasetFactory(std::move(filtered_files), std::move(filesystem),
                                    std::move(format), std::move(options)));
@@ -135,18 +162,8 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
 Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
     std::shared_ptr<fs::FileSystem> filesystem, const std::vector<fs::FileInfo>& files,
     std::shared_ptr<FileFormat> format, FileSystemFactoryOptions options) {
-  std::vector<fs::FileInfo> filtered_files;
-  for (const auto& info : files) {
-    if (options.exclude_invalid_files) {
-      ARROW_ASSIGN_OR_RAISE(auto supported,
-                            format->IsSupported(FileSource(info, filesystem)));
-      if (!supported) {
-        continue;
-      }
-    }
-
-    filtered_files.emplace_back(info);
-  }
+  ARROW_ASSIGN_OR_RAISE(auto filtered_files,
+                        FilterSupportedFiles(filesystem, files, *format, options));
 
   return std::shared_ptr<DatasetFactory>(
       new FileSystemDatasetFactory(std::move(filtered_files), std::move(filesystem),
@@ -166,6 +183,66 @@ bool StartsWithAnyOf(const std::string& path, const std::vector<std::string>& pr
   });
 }
 
+namespace {
+
+// List the files under selector.base_dir, only descending into the directories
+// whose partition expression may satisfy `filter`. The directories of a level
+// are listed concurrently if use_threads is set.
+Result<std::vector<fs::FileInfo>> ListPartitionPrunedFiles(
+    fs::FileSystem* filesystem, const fs::FileSelector& selector,
+    const Partitioning& partitioning, const Expression& filter,
+    const FileSystemFactoryOptions& options) {
+  std::vector<fs::FileInfo> files;
+  std::vector<std::string> level{selector.base_dir};
+
+  for (int32_t depth = 0; !level.empty(); ++depth) {
+    std::vector<std::vector<fs::FileInfo>> listings(level.size());
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        options.use_threads, static_cast<int>(level.size()), [&](int i) -> Status {
+          fs::FileSelector dir_selector;
+          dir_selector.base_dir = level[i];
+          // A subdirectory may have been removed since its parent was listed
+          dir_selector.allow_not_found = depth > 0 || selector.allow_not_found;
+          return filesystem->GetFileInfo(dir_selector).Value(&listings[i]);
+        }));
+
+    std::vector<std::string> next_level;
+    for (auto& listing : listings) {
+      for (auto& info : listing) {
+        if (info.IsFile()) {
+          files.push_back(std::move(info));
+          continue;
+        }
+        if (!info.IsDirectory() || depth >= selector.max_recursion) continue;
+
+        auto relative = fs::internal::RemoveAncestor(selector.base_dir, info.path());
+        if (relative.has_value() &&
+            StartsWithAnyOf(relative->to_string(), options.selector_ignore_prefixes)) {
+          continue;
+        }
+
+        // Directories outside of partition_base_dir, or which can't be parsed,
+        // aren't pruned; an unparseable path is reported when the dataset is
+        // finished.
+        auto partition_relative =
+            fs::internal::RemoveAncestor(options.partition_base_dir, info.path());
+        if (partition_relative.has_value()) {
+          auto maybe_partition = partitioning.Parse(partition_relative->to_string());
+          if (maybe_partition.ok() &&
+              !filter.Assume(**maybe_partition)->IsSatisfiable()) {
+            continue;
+          }
+        }
+        next_level.push_back(info.path());
+      }
+    }
+    level = std::move(next_level);
+  }
+  return files;
+}
+
+}  // namespace
+
 Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
     std::shared_ptr<fs::FileSystem> filesystem, fs::FileSelector selector,
     std::shared_ptr<FileFormat> format, FileSystemFactoryOptions options) {
@@ -177,24 +254,43 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
   }
 
   ARROW_ASSIGN_OR_RAISE(selector.base_dir, filesystem->NormalizePath(selector.base_dir));
-  ARROW_ASSIGN_OR_RAISE(auto files, filesystem->GetFileInfo(selector));
 
-  // Filter out anything that's not a file or that's explicitly ignored
-  auto files_end =
-      std::remove_if(files.begin(), files.end(), [&](const fs::FileInfo& info) {
-        if (!info.IsFile()) return true;
+  auto partitioning = options.partitioning.partitioning();
+  fs::FileInfoIterator batches;
+  if (selector.recursive && partitioning != nullptr &&
+      !options.partition_filter->Equals(true)) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto pruned_files,
+        ListPartitionPrunedFiles(filesystem.get(), selector, *partitioning,
+                                 *options.partition_filter, options));
+    batches = MakeVectorIterator(
+        std::vector<std::vector<fs::FileInfo>>{std::move(pruned_files)});
+  } else {
+    ARROW_ASSIGN_OR_RAISE(batches, filesystem->GetFileInfoIterator(selector));
+  }
 
-        auto relative = fs::internal::RemoveAncestor(selector.base_dir, info.path());
-        DCHECK(relative.has_value())
-            << "GetFileInfo() yielded path outside selector.base_dir";
+  // Filter out anything that's not a file or that's explicitly ignored, as the
+  // listing batches come in
+  std::vector<fs::FileInfo> files;
+  while (true) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, batches.Next());
+    if (batch.empty()) {
+      break;
+    }
+    for (auto& info : batch) {
+      if (!info.IsFile()) continue;
 
-        if (StartsWithAnyOf(relative->to_string(), options.selector_ignore_prefixes)) {
-          return true;
-        }
+      auto relative = fs::internal::RemoveAncestor(selector.base_dir, info.path());
+      DCHECK(relative.has_value())
+          << "GetFileInfo() yielded path outside selector.base_dir";
 
-        return false;
-      });
-  files.erase(files_end, files.end());
+      if (StartsWithAnyOf(relative->to_string(), options.selector_ignore_prefixes)) {
+        continue;
+      }
+
+      files.push_back(std::move(info));
+    }
+  }
 
   // Sorting by path guarantees a stability sometimes needed by unit tests.
   std::sort(files.begin(), files.end(), fs::FileInfo::ByPath());
@@ -205,15 +301,20 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
 
 Result<std::vector<std::shared_ptr<Schema>>> FileSystemDatasetFactory::InspectSchemas(
     InspectOptions options) {
-  std::vector<std::shared_ptr<Schema>> schemas;
-
   const bool has_fragments_limit = options.fragments >= 0;
-  int fragments = options.fragments;
-  for (const auto& info : files_) {
-    if (has_fragments_limit && fragments-- == 0) break;
-    ARROW_ASSIGN_OR_RAISE(auto schema, format_->Inspect({info, fs_}));
-    schemas.push_back(schema);
-  }
+  const size_t num_fragments =
+      has_fragments_limit
+          ? std::min(files_.size(), static_cast<size_t>(options.fragments))
+          : files_.size();
+
+  // One slot per sampled fragment, so that the order of the schemas does not
+  // depend on the order the inspections complete in
+  std::vector<std::shared_ptr<Schema>> schemas(num_fragments);
+  RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+      options_.use_threads, static_cast<int>(num_fragments), [&](int i) -> Status {
+        ARROW_ASSIGN_OR_RAISE(schemas[i], format_->Inspect({files_[i], fs_}));
+        return Status::OK();
+      }));
 
   ARROW_ASSIGN_OR_RAISE(auto partition_schema,
                         options_.partitioning.GetOrInferSchema(
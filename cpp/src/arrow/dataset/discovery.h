@@ -27,6 +27,7 @@
 #include <string>
 #include <vector>
 
+#include "arrow/dataset/filter.h"
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
@@ -162,11 +163,15 @@ struct FileSystemFactoryOptions {
 
   // Invalid files (via selector or explicitly) will be excluded by checking
   // with the FileFormat::IsSupported method.  This will incur IO for each files
-  // in a serial and single threaded fashion. Disabling this feature will skip the
+  // (concurrently if use_threads is set). Disabling this feature will skip the
   // IO, but unsupported files may be present in the Dataset
   // (resulting in an error at scan time).
   bool exclude_invalid_files = false;
 
+  // If true, the IsSupported checks of exclude_invalid_files and the fragments
+  // sampled by InspectOptions are processed concurrently on the thread pool.
+  bool use_threads = true;
+
   // When discovering from a Selector (and not from an explicit file list), ignore
   // files and directories matching any of these prefixes.
   //
@@ -182,6 +187,21 @@ struct FileSystemFactoryOptions {
       ".",
       "_",
   };
+
+  // When discovering from a recursive Selector with an explicit Partitioning,
+  // only descend into the directories whose partition expression may satisfy
+  // this filter. Each such directory is then listed separately, instead of
+  // listing the whole tree at once.
+  //
+  // Example (with HivePartitioning on "date" and "hour"):
+  // partition_filter = "date"_ == "2020-07-01";
+  //
+  // - "/dataset/date=2020-07-01/hour=0/dat" -> listed
+  // - "/dataset/date=2020-07-02/..." -> never listed
+  //
+  // Ignored with a PartitioningFactory, since the partition field types are
+  // only known once all the paths were listed.
+  std::shared_ptr<Expression> partition_filter = scalar(true);
 };
 
 /// \brief FileSystemDatasetFactory creates a Dataset from a vector of
@@ -21,11 +21,14 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/test_util.h"
+#include "arrow/filesystem/mockfs.h"
 #include "arrow/filesystem/test_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type_fwd.h"
@@ -340,17 +343,24 @@ TEST_F(FileSystemDatasetFactoryTest, FinishWithIncompatibleSchemaShouldFail) {
 }
 
 TEST_F(FileSystemDatasetFactoryTest, InspectFragmentsLimit) {
-  MakeFactory({fs::File("a"), fs::File("b"), fs::File("c")});
+  for (bool use_threads : {false, true}) {
+    factory_options_.use_threads = use_threads;
+    MakeFactory({fs::File("a"), fs::File("b"), fs::File("c")});
 
-  InspectOptions options;
-  // By default, inspect one fragment and the partitioning.
-  ASSERT_OK_AND_ASSIGN(auto schemas, factory_->InspectSchemas(options));
-  EXPECT_THAT(schemas, SizeIs(2));
-
-  for (int fragments = 0; fragments < 3; fragments++) {
-    options.fragments = fragments;
+    InspectOptions options;
+    // By default, inspect one fragment and the partitioning.
     ASSERT_OK_AND_ASSIGN(auto schemas, factory_->InspectSchemas(options));
-    EXPECT_THAT(schemas, SizeIs(fragments + 1));
+    EXPECT_THAT(schemas, SizeIs(2));
+
+    for (int fragments = 0; fragments < 3; fragments++) {
+      options.fragments = fragments;
+      ASSERT_OK_AND_ASSIGN(auto schemas, factory_->InspectSchemas(options));
+      EXPECT_THAT(schemas, SizeIs(fragments + 1));
+    }
+
+    options.fragments = InspectOptions::kInspectAllFragments;
+    ASSERT_OK_AND_ASSIGN(schemas, factory_->InspectSchemas(options));
+    EXPECT_THAT(schemas, SizeIs(4));
   }
 }
 
@@ -400,6 +410,52 @@ TEST_F(FileSystemDatasetFactoryTest, UnparseablePartitionExpression) {
   }
 }
 
+// A MockFileSystem recording the directories it lists
+class ListingRecordingFileSystem : public fs::internal::MockFileSystem {
+ public:
+  ListingRecordingFileSystem() : MockFileSystem(fs::kNoTime) {}
+
+  using MockFileSystem::GetFileInfo;
+  Result<std::vector<fs::FileInfo>> GetFileInfo(const fs::FileSelector& select) override {
+    listed_dirs.push_back(select.base_dir + (select.recursive ? "/**" : ""));
+    return MockFileSystem::GetFileInfo(select);
+  }
+
+  std::vector<std::string> listed_dirs;
+};
+
+TEST_F(FileSystemDatasetFactoryTest, PartitionFilterPrunesListing) {
+  auto recording_fs = std::make_shared<ListingRecordingFileSystem>();
+  for (auto path : {"base/year=2019/month=1/dat", "base/year=2020/month=1/dat",
+                    "base/year=2020/month=2/dat", "base/year=2020/_hidden/dat",
+                    "base/dat"}) {
+    ASSERT_OK(recording_fs->CreateFile(path, ""));
+  }
+  fs_ = recording_fs;
+
+  selector_.base_dir = "base";
+  selector_.recursive = true;
+  factory_options_.use_threads = false;
+  factory_options_.partitioning = std::make_shared<HivePartitioning>(
+      schema({field("year", int32()), field("month", int32())}));
+  factory_options_.partition_filter = ("year"_ == 2020 && "month"_ == 2).Copy();
+
+  ASSERT_OK_AND_ASSIGN(factory_, FileSystemDatasetFactory::Make(fs_, selector_, format_,
+                                                                factory_options_));
+  AssertFinishWithPaths({"base/year=2020/month=2/dat", "base/dat"});
+  EXPECT_THAT(recording_fs->listed_dirs,
+              testing::ElementsAre("base", "base/year=2020", "base/year=2020/month=2"));
+
+  // Without a filter, the tree is listed at once
+  recording_fs->listed_dirs.clear();
+  factory_options_.partition_filter = scalar(true);
+  ASSERT_OK_AND_ASSIGN(factory_, FileSystemDatasetFactory::Make(fs_, selector_, format_,
+                                                                factory_options_));
+  AssertFinishWithPaths({"base/year=2019/month=1/dat", "base/year=2020/month=1/dat",
+                         "base/year=2020/month=2/dat", "base/dat"});
+  EXPECT_THAT(recording_fs->listed_dirs, testing::ElementsAre("base/**"));
+}
+
 std::shared_ptr<DatasetFactory> DatasetFactoryFromSchemas(
     std::vector<std::shared_ptr<Schema>> schemas) {
   return std::make_shared<MockDatasetFactory>(schemas);
@@ -18,6 +18,10 @@
 #include "arrow/dataset/file_base.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include "arrow/dataset/dataset_internal.h"
@@ -48,6 +52,206 @@ Result<std::shared_ptr<io::RandomAccessFile>> FileSource::Open() const {
   return custom_open_();
 }
 
+namespace {
+
+// A map evicting its least recently used entries beyond a given capacity
+template <typename Value>
+class LruMap {
+ public:
+  explicit LruMap(int64_t capacity) : capacity_(capacity) {}
+
+  bool Get(const std::string& key, Value* out) {
+    auto it = map_.find(key);
+    if (it == map_.end()) {
+      return false;
+    }
+    items_.splice(items_.begin(), items_, it->second);
+    *out = it->second->second;
+    return true;
+  }
+
+  void Put(const std::string& key, Value value) {
+    auto it = map_.find(key);
+    if (it != map_.end()) {
+      it->second->second = std::move(value);
+      items_.splice(items_.begin(), items_, it->second);
+      return;
+    }
+    if (capacity_ <= 0) {
+      return;
+    }
+    items_.emplace_front(key, std::move(value));
+    map_.emplace(key, items_.begin());
+    if (static_cast<int64_t>(map_.size()) > capacity_) {
+      map_.erase(items_.back().first);
+      items_.pop_back();
+    }
+  }
+
+  void Clear() {
+    map_.clear();
+    items_.clear();
+  }
+
+  int64_t size() const { return static_cast<int64_t>(map_.size()); }
+
+ private:
+  using Item = std::pair<std::string, Value>;
+
+  const int64_t capacity_;
+  std::list<Item> items_;
+  std::unordered_map<std::string, typename std::list<Item>::iterator> map_;
+};
+
+bool IsCompleteFileInfo(const fs::FileInfo& info) {
+  return info.IsFile() && info.size() != fs::kNoSize && info.mtime() != fs::kNoTime;
+}
+
+std::string FileInfoKey(const fs::FileSystem& filesystem, const std::string& path) {
+  return filesystem.type_name() + '\n' + path;
+}
+
+std::string MetadataKey(const FileFormat& format, const fs::FileSystem& filesystem,
+                        const fs::FileInfo& info) {
+  return format.type_name() + '\n' + std::to_string(info.size()) + '\n' +
+         std::to_string(info.mtime().time_since_epoch().count()) + '\n' +
+         FileInfoKey(filesystem, info.path());
+}
+
+}  // namespace
+
+class FileMetadataCache::Impl {
+ public:
+  explicit Impl(int64_t capacity) : metadata(capacity), infos(capacity) {}
+
+  std::mutex mutex;
+  LruMap<std::shared_ptr<Entry>> metadata;
+  LruMap<fs::FileInfo> infos;
+};
+
+FileMetadataCache::FileMetadataCache(int64_t capacity)
+    : capacity_(capacity), impl_(new Impl(capacity)) {}
+
+FileMetadataCache::~FileMetadataCache() = default;
+
+std::shared_ptr<FileMetadataCache::Entry> FileMetadataCache::GetMetadata(
+    const FileFormat& format, const fs::FileSystem& filesystem,
+    const fs::FileInfo& info) {
+  std::shared_ptr<Entry> entry;
+  if (IsCompleteFileInfo(info)) {
+    const auto key = MetadataKey(format, filesystem, info);
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    impl_->metadata.Get(key, &entry);
+  }
+  return entry;
+}
+
+void FileMetadataCache::PutMetadata(const FileFormat& format,
+                                    const fs::FileSystem& filesystem,
+                                    const fs::FileInfo& info,
+                                    std::shared_ptr<Entry> entry) {
+  if (IsCompleteFileInfo(info)) {
+    const auto key = MetadataKey(format, filesystem, info);
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    impl_->metadata.Put(key, std::move(entry));
+  }
+}
+
+Result<fs::FileInfo> FileMetadataCache::GetFileInfo(const FileSource& source) {
+  const auto& filesystem = source.filesystem();
+  if (filesystem == nullptr) {
+    return Status::Invalid("FileSource is not backed by a filesystem");
+  }
+  if (IsCompleteFileInfo(source.file_info())) {
+    return source.file_info();
+  }
+  const auto key = FileInfoKey(*filesystem, source.path());
+  {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    fs::FileInfo info;
+    if (impl_->infos.Get(key, &info)) {
+      return info;
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(auto info, filesystem->GetFileInfo(source.path()));
+  if (info.IsFile()) {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    impl_->infos.Put(key, info);
+  }
+  return info;
+}
+
+void FileMetadataCache::Clear() {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  impl_->metadata.Clear();
+  impl_->infos.Clear();
+}
+
+int64_t FileMetadataCache::num_entries() const {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  return impl_->metadata.size();
+}
+
+std::shared_ptr<FileMetadataCache> FileFormat::GetMetadataCache(
+    const ScanContext* context) const {
+  if (context != nullptr && context->metadata_cache != nullptr) {
+    return context->metadata_cache;
+  }
+  return metadata_cache;
+}
+
+namespace {
+
+// Buffer the batches of a file until it is finished, for formats which can
+// only write a complete fragment at once
+class BufferingFileWriter : public FileWriter {
+ public:
+  BufferingFileWriter(std::shared_ptr<const FileFormat> format,
+                      std::shared_ptr<io::OutputStream> destination,
+                      std::shared_ptr<Schema> schema)
+      : FileWriter(std::move(schema)),
+        format_(std::move(format)),
+        destination_(std::move(destination)) {}
+
+  Status Write(const std::shared_ptr<RecordBatch>& batch) override {
+    batches_.push_back(batch);
+    return Status::OK();
+  }
+
+  Status Finish() override {
+    ARROW_ASSIGN_OR_RAISE(auto reader,
+                          RecordBatchReader::Make(std::move(batches_), schema_));
+    RETURN_NOT_OK(format_->WriteFragment(reader.get(), destination_.get()));
+    return destination_->Close();
+  }
+
+ private:
+  std::shared_ptr<const FileFormat> format_;
+  std::shared_ptr<io::OutputStream> destination_;
+  RecordBatchVector batches_;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<FileWriter>> FileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination,
+    std::shared_ptr<Schema> schema) const {
+  return std::make_shared<BufferingFileWriter>(shared_from_this(), std::move(destination),
+                                               std::move(schema));
+}
+
+Status FileFormat::WriteMetadata(const std::vector<WrittenFile>& files,
+                                 fs::FileSystem* filesystem,
+                                 const std::string& base_dir) const {
+  return Status::OK();
+}
+
+Result<int64_t> FileFormat::CountRows(FileFragment*, std::shared_ptr<Expression>,
+                                     std::shared_ptr<ScanOptions>,
+                                     std::shared_ptr<ScanContext>) const {
+  return -1;
+}
+
 Result<std::shared_ptr<FileFragment>> FileFormat::MakeFragment(
     FileSource source, std::shared_ptr<Schema> physical_schema) {
   return MakeFragment(std::move(source), scalar(true), std::move(physical_schema));
@@ -70,6 +274,20 @@ Result<std::shared_ptr<Schema>> FileFragment::ReadPhysicalSchemaImpl() {
   return format_->Inspect(source_);
 }
 
+Result<int64_t> FileFragment::CountRows(std::shared_ptr<Expression> predicate,
+                                       std::shared_ptr<ScanOptions> options,
+                                       std::shared_ptr<ScanContext> context) {
+  if (!predicate->IsSatisfiable()) {
+    return 0;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto num_rows,
+                        format_->CountRows(this, predicate, options, context));
+  if (num_rows >= 0) {
+    return num_rows;
+  }
+  return ScanCountRows(predicate, std::move(options), std::move(context));
+}
+
 Result<ScanTaskIterator> FileFragment::Scan(std::shared_ptr<ScanOptions> options,
                                             std::shared_ptr<ScanContext> context) {
   return format_->ScanFile(std::move(options), std::move(context), this);
@@ -237,5 +455,337 @@ Status FileSystemDataset::Write(std::shared_ptr<Schema> schema,
   return task_group->Finish();
 }
 
+namespace {
+
+void AddBufferSizes(const ArrayData& data, int64_t* size) {
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) {
+      *size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    AddBufferSizes(*child, size);
+  }
+  if (data.dictionary != nullptr) {
+    AddBufferSizes(*data.dictionary, size);
+  }
+}
+
+// Estimate the encoded size of a batch from the size of its buffers (an
+// overestimate for slices, whose buffers are shared with the parent)
+int64_t EstimateBatchSize(const RecordBatch& batch) {
+  int64_t size = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    AddBufferSizes(*batch.column_data(i), &size);
+  }
+  return size;
+}
+
+// Writes batches to files in partition directories.  Each directory has at
+// most one file open, and the least recently used files are finished when
+// max_open_files is reached.
+class DatasetWriter {
+ public:
+  DatasetWriter(const FileSystemDatasetWriteOptions& options, std::string base_dir)
+      : options_(options), base_dir_(std::move(base_dir)) {}
+
+  Status Write(const std::string& dir, const std::shared_ptr<RecordBatch>& batch) {
+    Partition* partition;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto& slot = partitions_[dir];
+      if (slot == nullptr) {
+        slot.reset(new Partition);
+        slot->dir = dir;
+      }
+      partition = slot.get();
+      if (partition->in_use++ == 0 && partition->idle) {
+        idle_open_.erase(partition->idle_position);
+        partition->idle = false;
+      }
+    }
+
+    Status st;
+    {
+      std::lock_guard<std::mutex> lock(partition->mutex);
+      st = WriteLocked(partition, batch);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--partition->in_use == 0 && partition->writer != nullptr) {
+      partition->idle_position = idle_open_.insert(idle_open_.end(), partition);
+      partition->idle = true;
+    }
+    return st;
+  }
+
+  /// Finish all open files.  No Write() may be in progress.
+  Status Finish() {
+    Status st;
+    for (auto&& dir_partition : partitions_) {
+      Partition* partition = dir_partition.second.get();
+      if (partition->writer != nullptr) {
+        st &= CloseFile(partition);
+      }
+    }
+    idle_open_.clear();
+    return st;
+  }
+
+  /// The files finished so far, when the options ask for summary metadata
+  const std::vector<WrittenFile>& written_files() const { return written_files_; }
+
+ private:
+  struct Partition {
+    std::mutex mutex;
+    std::string dir;
+    bool dir_created = false;
+    int next_file_index = 0;
+
+    // The open file if any, its path and the amount of data written to it
+    std::shared_ptr<FileWriter> writer;
+    std::string path;
+    int64_t rows_written = 0;
+    int64_t bytes_written = 0;
+
+    // Protected by DatasetWriter::mutex_
+    int in_use = 0;
+    bool idle = false;
+    std::list<Partition*>::iterator idle_position;
+  };
+
+  Status WriteLocked(Partition* partition, const std::shared_ptr<RecordBatch>& batch) {
+    const int64_t num_rows = batch->num_rows();
+    const int64_t max_rows = options_.max_rows_per_file;
+    const int64_t max_bytes = options_.max_bytes_per_file;
+    const int64_t batch_bytes = max_bytes > 0 ? EstimateBatchSize(*batch) : 0;
+
+    int64_t offset = 0;
+    while (offset < num_rows) {
+      if (partition->writer == nullptr) {
+        RETURN_NOT_OK(OpenFile(partition, batch->schema()));
+      }
+
+      int64_t length = num_rows - offset;
+      if (max_rows > 0) {
+        length = std::min(length, max_rows - partition->rows_written);
+      }
+      if (max_bytes > 0 && batch_bytes > 0) {
+        // Write at least one row to each file
+        const int64_t fitting_rows = std::max<int64_t>(
+            (max_bytes - partition->bytes_written) * num_rows / batch_bytes,
+            partition->rows_written == 0 ? 1 : 0);
+        length = std::min(length, fitting_rows);
+      }
+      if (length <= 0) {
+        RETURN_NOT_OK(CloseFile(partition));
+        continue;
+      }
+
+      auto slice = length == num_rows ? batch : batch->Slice(offset, length);
+      RETURN_NOT_OK(partition->writer->Write(slice));
+      offset += length;
+      partition->rows_written += length;
+      partition->bytes_written += batch_bytes * length / num_rows;
+
+      if ((max_rows > 0 && partition->rows_written >= max_rows) ||
+          (max_bytes > 0 && partition->bytes_written >= max_bytes)) {
+        RETURN_NOT_OK(CloseFile(partition));
+      }
+    }
+    return Status::OK();
+  }
+
+  Status OpenFile(Partition* partition, const std::shared_ptr<Schema>& schema) {
+    // Make room for the new file.  Files of partitions being written to by
+    // other threads can't be finished, so there may temporarily be more open
+    // files than max_open_files.
+    std::vector<WrittenFile> evicted;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      while (num_open_ >= options_.max_open_files && !idle_open_.empty()) {
+        Partition* victim = idle_open_.front();
+        idle_open_.pop_front();
+        victim->idle = false;
+        evicted.push_back({std::move(victim->path), std::move(victim->writer)});
+        victim->writer = nullptr;
+        victim->rows_written = victim->bytes_written = 0;
+        --num_open_;
+      }
+      ++num_open_;
+    }
+
+    Status st;
+    for (auto& file : evicted) {
+      st &= FinishFile(std::move(file));
+    }
+    if (st.ok()) {
+      st = DoOpenFile(partition, schema);
+    }
+    if (!st.ok()) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --num_open_;
+    }
+    return st;
+  }
+
+  Status DoOpenFile(Partition* partition, const std::shared_ptr<Schema>& schema) {
+    const auto& filesystem = options_.filesystem;
+    if (!partition->dir_created) {
+      RETURN_NOT_OK(filesystem->CreateDir(partition->dir, /*recursive=*/true));
+      partition->dir_created = true;
+    }
+
+    std::string basename = options_.basename_template;
+    basename.replace(basename.find(kIndexPlaceholder), kIndexPlaceholder.size(),
+                     std::to_string(partition->next_file_index++));
+    basename += "." + options_.format->type_name();
+
+    auto path = fs::internal::ConcatAbstractPath(partition->dir, basename);
+    ARROW_ASSIGN_OR_RAISE(auto destination, filesystem->OpenOutputStream(path));
+    ARROW_ASSIGN_OR_RAISE(partition->writer,
+                          options_.format->MakeWriter(std::move(destination), schema));
+    partition->path = std::move(path);
+    return Status::OK();
+  }
+
+  Status CloseFile(Partition* partition) {
+    WrittenFile file{std::move(partition->path), std::move(partition->writer)};
+    partition->writer = nullptr;
+    partition->rows_written = partition->bytes_written = 0;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --num_open_;
+    }
+    return FinishFile(std::move(file));
+  }
+
+  // Finish a file, keeping its writer around if summary metadata is written
+  Status FinishFile(WrittenFile file) {
+    RETURN_NOT_OK(file.writer->Finish());
+    if (options_.write_metadata) {
+      auto relative_path = fs::internal::RemoveAncestor(base_dir_, file.path);
+      if (relative_path) {
+        file.path = relative_path->to_string();
+      }
+      std::lock_guard<std::mutex> lock(mutex_);
+      written_files_.push_back(std::move(file));
+    }
+    return Status::OK();
+  }
+
+  static const std::string kIndexPlaceholder;
+
+  const FileSystemDatasetWriteOptions& options_;
+  const std::string base_dir_;
+
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::unique_ptr<Partition>> partitions_;
+  // Partitions with an open file and no Write() in progress, least recently
+  // used first
+  std::list<Partition*> idle_open_;
+  int num_open_ = 0;
+  std::vector<WrittenFile> written_files_;
+};
+
+const std::string DatasetWriter::kIndexPlaceholder = "{i}";
+
+// Limit the number of batches scanned ahead of the writers
+class TaskThrottle {
+ public:
+  explicit TaskThrottle(int capacity) : available_(capacity) {}
+
+  void Acquire() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return available_ > 0; });
+    --available_;
+  }
+
+  void Release() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ++available_;
+    }
+    cv_.notify_one();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  int available_;
+};
+
+}  // namespace
+
+Status FileSystemDataset::Write(const FileSystemDatasetWriteOptions& write_options,
+                                std::shared_ptr<Scanner> scanner) {
+  if (write_options.format == nullptr || write_options.filesystem == nullptr ||
+      write_options.partitioning == nullptr) {
+    return Status::Invalid("a format, filesystem and partitioning are required");
+  }
+  if (write_options.basename_template.find("{i}") == std::string::npos) {
+    return Status::Invalid("basename_template '", write_options.basename_template,
+                           "' contains no {i} placeholder");
+  }
+  if (write_options.max_open_files <= 0) {
+    return Status::Invalid("max_open_files must be positive");
+  }
+  const auto& partitioning = write_options.partitioning;
+  for (const auto& f : partitioning->schema()->fields()) {
+    if (f->type()->id() == Type::DICTIONARY) {
+      return Status::NotImplemented("writing with dictionary partitions");
+    }
+  }
+
+  const std::string base_dir =
+      fs::internal::RemoveTrailingSlash(write_options.base_dir).to_string();
+  DatasetWriter writer(write_options, base_dir);
+
+  auto WriteBatch = [&](const std::shared_ptr<RecordBatch>& batch) -> Status {
+    ARROW_ASSIGN_OR_RAISE(auto partitioned_batches, partitioning->Partition(batch));
+    for (auto&& partitioned_batch : partitioned_batches) {
+      std::string dir = base_dir;
+      // A batch which isn't split is written to the base directory
+      if (!partitioned_batch.partition_expression->Equals(true)) {
+        const auto& expr = *partitioned_batch.partition_expression;
+        ARROW_ASSIGN_OR_RAISE(auto path, partitioning->Format(expr));
+        dir += fs::internal::EnsureLeadingSlash(path);
+      }
+      RETURN_NOT_OK(writer.Write(dir, partitioned_batch.batch));
+    }
+    return Status::OK();
+  };
+
+  auto task_group = scanner->context()->TaskGroup();
+  TaskThrottle throttle(2 * task_group->parallelism());
+
+  Status st;
+  ARROW_ASSIGN_OR_RAISE(auto batches, scanner->ScanBatchesUnordered());
+  for (auto maybe_batch : batches) {
+    if (!maybe_batch.ok()) {
+      st = maybe_batch.status();
+      break;
+    }
+    if (!task_group->ok()) {
+      break;
+    }
+    auto batch = maybe_batch.MoveValueUnsafe();
+    throttle.Acquire();
+    task_group->Append([&, batch] {
+      auto st = WriteBatch(batch);
+      throttle.Release();
+      return st;
+    });
+  }
+
+  st &= task_group->Finish();
+  st &= writer.Finish();
+  if (st.ok() && write_options.write_metadata) {
+    st = write_options.format->WriteMetadata(writer.written_files(),
+                                             write_options.filesystem.get(), base_dir);
+  }
+  return st;
+}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -96,6 +96,9 @@ class ARROW_DS_EXPORT FileSource {
     return filesystem_ ? file_info_.path() : buffer_ ? buffer_path : custom_open_path;
   }
 
+  /// \brief Return the file info. Only valid when file source wraps a path.
+  const fs::FileInfo& file_info() const { return file_info_; }
+
   /// \brief Return the filesystem, if any. Otherwise returns nullptr
   const std::shared_ptr<fs::FileSystem>& filesystem() const { return filesystem_; }
 
@@ -117,11 +120,100 @@ class ARROW_DS_EXPORT FileSource {
   Compression::type compression_ = Compression::UNCOMPRESSED;
 };
 
+/// \brief A size-bounded LRU cache of file metadata, which can be shared across scans
+///
+/// File formats store the metadata they decode from a file (for example a Parquet
+/// footer and the schema derived from it) keyed by the format, the filesystem, and
+/// the path, size and modification time of the file, so that later scans of an
+/// unchanged file skip reading and decoding it again.
+///
+/// File infos are also cached by path, sparing a filesystem lookup when a FileSource
+/// was created from a bare path.  A cached file info is trusted until it is evicted
+/// or the cache is cleared; call Clear() when files may have been overwritten.
+///
+/// This class is thread-safe.
+class ARROW_DS_EXPORT FileMetadataCache {
+ public:
+  /// \brief Base class for the format-specific metadata of a file
+  class ARROW_DS_EXPORT Entry {
+   public:
+    virtual ~Entry() = default;
+  };
+
+  /// \brief Make a cache holding the metadata of at most `capacity` files,
+  /// and the file infos of as many paths.
+  explicit FileMetadataCache(int64_t capacity);
+  ~FileMetadataCache();
+
+  /// \brief Return the cached metadata of a file, or null if there is none.
+  ///
+  /// Metadata is only cached for files with a known size and modification time.
+  std::shared_ptr<Entry> GetMetadata(const FileFormat& format,
+                                     const fs::FileSystem& filesystem,
+                                     const fs::FileInfo& info);
+
+  /// \brief Insert or replace the metadata of a file.
+  void PutMetadata(const FileFormat& format, const fs::FileSystem& filesystem,
+                   const fs::FileInfo& info, std::shared_ptr<Entry> entry);
+
+  /// \brief Return the info of the file a path-based FileSource wraps.
+  ///
+  /// The source's own file info is returned if it is complete; otherwise the cached
+  /// info is used, or the filesystem is queried and the result cached.
+  Result<fs::FileInfo> GetFileInfo(const FileSource& source);
+
+  /// \brief Remove all entries.
+  void Clear();
+
+  /// \brief The number of files whose metadata is cached.
+  int64_t num_entries() const;
+
+  int64_t capacity() const { return capacity_; }
+
+ private:
+  class Impl;
+
+  const int64_t capacity_;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief A writer producing a single file of a FileFormat, batch by batch
+class ARROW_DS_EXPORT FileWriter {
+ public:
+  virtual ~FileWriter() = default;
+
+  /// \brief Write a batch, whose schema must be the writer's
+  virtual Status Write(const std::shared_ptr<RecordBatch>& batch) = 0;
+
+  /// \brief Complete the file and close the destination
+  virtual Status Finish() = 0;
+
+  const std::shared_ptr<Schema>& schema() const { return schema_; }
+
+ protected:
+  explicit FileWriter(std::shared_ptr<Schema> schema) : schema_(std::move(schema)) {}
+
+  std::shared_ptr<Schema> schema_;
+};
+
+/// \brief A file written by FileSystemDataset::Write
+struct ARROW_DS_EXPORT WrittenFile {
+  /// The path of the file, relative to the base directory of the dataset
+  std::string path;
+
+  /// The writer of the file, already finished
+  std::shared_ptr<FileWriter> writer;
+};
+
 /// \brief Base class for file format implementation
 class ARROW_DS_EXPORT FileFormat : public std::enable_shared_from_this<FileFormat> {
  public:
   virtual ~FileFormat() = default;
 
+  /// \brief An optional cache of decoded file metadata, used when scanning with a
+  /// ScanContext without a cache of its own and when inspecting files.
+  std::shared_ptr<FileMetadataCache> metadata_cache;
+
   /// \brief The name identifying the kind of file format
   virtual std::string type_name() const = 0;
 
@@ -140,6 +232,16 @@ class ARROW_DS_EXPORT FileFormat : public std::enable_shared_from_this<FileForma
                                             std::shared_ptr<ScanContext> context,
                                             FileFragment* file) const = 0;
 
+  /// \brief Count the rows of a FileFragment satisfying a predicate, see
+  /// Fragment::CountRows.
+  ///
+  /// Return -1 if the format can't do better than scanning the whole file,
+  /// which the default implementation does.
+  virtual Result<int64_t> CountRows(FileFragment* file,
+                                    std::shared_ptr<Expression> predicate,
+                                    std::shared_ptr<ScanOptions> options,
+                                    std::shared_ptr<ScanContext> context) const;
+
   /// \brief Open a fragment
   virtual Result<std::shared_ptr<FileFragment>> MakeFragment(
       FileSource source, std::shared_ptr<Expression> partition_expression,
@@ -155,6 +257,29 @@ class ARROW_DS_EXPORT FileFormat : public std::enable_shared_from_this<FileForma
   /// FIXME(bkietz) make this pure virtual
   virtual Status WriteFragment(RecordBatchReader* batches,
                                io::OutputStream* destination) const = 0;
+
+  /// \brief Create a writer for a file of this format
+  ///
+  /// The default implementation buffers the batches until the writer is
+  /// finished, then writes them with WriteFragment().
+  virtual Result<std::shared_ptr<FileWriter>> MakeWriter(
+      std::shared_ptr<io::OutputStream> destination,
+      std::shared_ptr<Schema> schema) const;
+
+  /// \brief Write summary metadata for the files of a dataset written by
+  /// FileSystemDataset::Write, when FileSystemDatasetWriteOptions::write_metadata
+  /// is set.
+  ///
+  /// The files were written by this format's writers, in no particular order.
+  /// The default implementation writes nothing.
+  virtual Status WriteMetadata(const std::vector<WrittenFile>& files,
+                               fs::FileSystem* filesystem,
+                               const std::string& base_dir) const;
+
+ protected:
+  /// \brief Return the metadata cache to use with a scan context (may be null).
+  std::shared_ptr<FileMetadataCache> GetMetadataCache(
+      const ScanContext* context = NULLPTR) const;
 };
 
 /// \brief A Fragment that is stored in a file with a known format
@@ -166,6 +291,10 @@ class ARROW_DS_EXPORT FileFragment : public Fragment {
   std::string type_name() const override { return format_->type_name(); }
   bool splittable() const override { return format_->splittable(); }
 
+  Result<int64_t> CountRows(std::shared_ptr<Expression> predicate,
+                            std::shared_ptr<ScanOptions> options,
+                            std::shared_ptr<ScanContext> context) override;
+
   const FileSource& source() const { return source_; }
   const std::shared_ptr<FileFormat>& format() const { return format_; }
 
@@ -185,6 +314,38 @@ class ARROW_DS_EXPORT FileFragment : public Fragment {
   friend class FileFormat;
 };
 
+/// \brief Options for writing the output of a Scanner to a FileSystemDataset
+struct ARROW_DS_EXPORT FileSystemDatasetWriteOptions {
+  /// The format in which the files are written
+  std::shared_ptr<FileFormat> format;
+
+  /// The FileSystem and root directory into which the dataset is written
+  std::shared_ptr<fs::FileSystem> filesystem;
+  std::string base_dir;
+
+  /// The partitioning used to split the batches and generate the directories
+  std::shared_ptr<Partitioning> partitioning = Partitioning::Default();
+
+  /// The basename of the written files, where "{i}" is replaced by a counter
+  /// unique in each directory.  The format's extension is appended.
+  std::string basename_template = "part-{i}";
+
+  /// The maximum number of files open at the same time.  When a new file
+  /// needs to be opened, the least recently written one is finished.
+  int max_open_files = 1024;
+
+  /// Roll over to a new file once a file has this many rows (0 for no limit)
+  int64_t max_rows_per_file = 0;
+
+  /// Roll over to a new file once a file has approximately this many bytes,
+  /// as estimated from the in-memory size of the batches (0 for no limit)
+  int64_t max_bytes_per_file = 0;
+
+  /// Once all files are written, write summary metadata files in base_dir if
+  /// the format supports them, see FileFormat::WriteMetadata
+  bool write_metadata = false;
+};
+
 /// \brief A Dataset of FileFragments.
 ///
 /// A FileSystemDataset is composed of one or more FileFragment. The fragments
@@ -224,6 +385,14 @@ class ARROW_DS_EXPORT FileSystemDataset : public Dataset {
                       std::shared_ptr<ScanContext> scan_context,
                       FragmentIterator fragments);
 
+  /// \brief Write the output of a scan as a partitioned dataset.
+  ///
+  /// The batches are streamed from the scanner, and partitioned and written
+  /// in parallel when the scanner's context allows threads.  Each partition
+  /// directory has at most one file open at a time.
+  static Status Write(const FileSystemDatasetWriteOptions& write_options,
+                      std::shared_ptr<Scanner> scanner);
+
   /// \brief Return the type name of the dataset.
   std::string type_name() const override { return "filesystem"; }
 
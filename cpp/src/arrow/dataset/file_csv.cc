@@ -23,6 +23,7 @@
 #include <unordered_set>
 #include <utility>
 
+#include "arrow/csv/chunker.h"
 #include "arrow/csv/options.h"
 #include "arrow/csv/parser.h"
 #include "arrow/csv/reader.h"
@@ -31,9 +32,12 @@
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
+#include "arrow/io/interfaces.h"
 #include "arrow/result.h"
 #include "arrow/type.h"
+#include "arrow/util/delimiting.h"
 #include "arrow/util/iterator.h"
+#include "arrow/util/logging.h"
 
 namespace arrow {
 namespace dataset {
@@ -41,7 +45,7 @@ namespace dataset {
 using internal::checked_cast;
 using internal::checked_pointer_cast;
 
-Result<std::unordered_set<std::string>> GetColumnNames(
+Result<std::vector<std::string>> GetColumnNames(
     const csv::ParseOptions& parse_options, util::string_view first_block,
     MemoryPool* pool) {
   uint32_t parsed_size = 0;
@@ -60,12 +64,14 @@ Result<std::unordered_set<std::string>> GetColumnNames(
     return Status::Invalid("No columns in CSV file");
   }
 
-  std::unordered_set<std::string> column_names;
+  std::unordered_set<std::string> seen;
+  std::vector<std::string> column_names;
 
   RETURN_NOT_OK(
       parser.VisitLastRow([&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
         util::string_view view{reinterpret_cast<const char*>(data), size};
-        if (column_names.emplace(view.to_string()).second) {
+        if (seen.emplace(view.to_string()).second) {
+          column_names.push_back(view.to_string());
           return Status::OK();
         }
         return Status::Invalid("CSV file contained multiple columns named ", view);
@@ -75,11 +81,10 @@ Result<std::unordered_set<std::string>> GetColumnNames(
 }
 
 static inline Result<csv::ConvertOptions> GetConvertOptions(
-    const CsvFileFormat& format, const std::shared_ptr<ScanOptions>& scan_options,
-    const Buffer& first_block, MemoryPool* pool) {
-  ARROW_ASSIGN_OR_RAISE(
-      auto column_names,
-      GetColumnNames(format.parse_options, util::string_view{first_block}, pool));
+    const std::vector<std::string>& file_column_names,
+    const std::shared_ptr<ScanOptions>& scan_options) {
+  std::unordered_set<std::string> column_names(file_column_names.begin(),
+                                               file_column_names.end());
 
   auto convert_options = csv::ConvertOptions::Defaults();
 
@@ -109,10 +114,47 @@ static inline csv::ReadOptions GetReadOptions(const CsvFileFormat& format) {
   return read_options;
 }
 
+/// \brief Find the offset of the first row starting at or after `offset`.
+///
+/// Only valid if values can't contain newlines, otherwise telling a row boundary
+/// from a quoted newline would require parsing from the start of the file.
+static Result<int64_t> FindRowStart(io::RandomAccessFile* input,
+                                    const csv::ParseOptions& parse_options,
+                                    int64_t offset, int64_t file_size,
+                                    int64_t block_size) {
+  DCHECK(!parse_options.newlines_in_values);
+  if (offset <= 0 || offset >= file_size) {
+    return std::min(std::max<int64_t>(offset, 0), file_size);
+  }
+
+  auto chunker = csv::MakeChunker(parse_options);
+  // Read from the byte preceding `offset`, so that a row starting right at `offset`
+  // is found.  The chunker then completes the partial row straddling `offset`.
+  for (int64_t window = block_size;; window *= 2) {
+    ARROW_ASSIGN_OR_RAISE(auto block, input->ReadAt(offset - 1, window));
+    auto partial = SliceBuffer(block, 0, 1);
+    std::shared_ptr<Buffer> completion, rest;
+    if (offset - 1 + block->size() >= file_size) {
+      RETURN_NOT_OK(chunker->ProcessFinal(partial, block, &completion, &rest));
+      return offset - 1 + completion->size();
+    }
+    if (chunker->ProcessWithPartial(partial, block, &completion, &rest).ok()) {
+      return offset - 1 + completion->size();
+    }
+    // The straddling row is larger than the window, read more
+  }
+}
+
+/// \brief Open a reader over the rows starting in [range_start, range_end) of a file.
+///
+/// A negative range_end reads the whole file.  Ranges after the first don't contain
+/// the header row, so their column names are read from the start of the file.
+/// Returns null if no row starts in the range.
 static inline Result<std::shared_ptr<csv::StreamingReader>> OpenReader(
     const FileSource& source, const CsvFileFormat& format,
     const std::shared_ptr<ScanOptions>& scan_options = nullptr,
-    MemoryPool* pool = default_memory_pool()) {
+    MemoryPool* pool = default_memory_pool(), int64_t range_start = 0,
+    int64_t range_end = -1) {
   ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
 
   auto reader_options = GetReadOptions(format);
@@ -121,13 +163,36 @@ static inline Result<std::shared_ptr<csv::StreamingReader>> OpenReader(
 
   const auto& parse_options = format.parse_options;
 
-  ARROW_ASSIGN_OR_RAISE(
-      auto convert_options,
-      scan_options == nullptr
-          ? ToResult(csv::ConvertOptions::Defaults())
-          : GetConvertOptions(format, scan_options, *first_block, pool));
+  auto convert_options = csv::ConvertOptions::Defaults();
+  std::shared_ptr<io::InputStream> stream = input;
+  if (scan_options != nullptr || range_end >= 0) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto column_names,
+        GetColumnNames(parse_options, util::string_view{*first_block}, pool));
+    if (scan_options != nullptr) {
+      ARROW_ASSIGN_OR_RAISE(convert_options,
+                            GetConvertOptions(column_names, scan_options));
+    }
+
+    if (range_end >= 0) {
+      ARROW_ASSIGN_OR_RAISE(auto file_size, input->GetSize());
+      ARROW_ASSIGN_OR_RAISE(auto start,
+                            FindRowStart(input.get(), parse_options, range_start,
+                                         file_size, reader_options.block_size));
+      ARROW_ASSIGN_OR_RAISE(auto end,
+                            FindRowStart(input.get(), parse_options, range_end,
+                                         file_size, reader_options.block_size));
+      if (end <= start) {
+        return nullptr;
+      }
+      if (start > 0) {
+        reader_options.column_names = std::move(column_names);
+      }
+      stream = io::RandomAccessFile::GetStream(input, start, end - start);
+    }
+  }
 
-  auto maybe_reader = csv::StreamingReader::Make(pool, std::move(input), reader_options,
+  auto maybe_reader = csv::StreamingReader::Make(pool, std::move(stream), reader_options,
                                                  parse_options, convert_options);
   if (!maybe_reader.ok()) {
     return maybe_reader.status().WithMessage("Could not open CSV input source '",
@@ -137,24 +202,32 @@ static inline Result<std::shared_ptr<csv::StreamingReader>> OpenReader(
   return std::move(maybe_reader).ValueOrDie();
 }
 
-/// \brief A ScanTask backed by an Csv file.
+/// \brief A ScanTask backed by an Csv file, or by a byte range of it.
 class CsvScanTask : public ScanTask {
  public:
   CsvScanTask(std::shared_ptr<const CsvFileFormat> format, FileSource source,
-              std::shared_ptr<ScanOptions> options, std::shared_ptr<ScanContext> context)
+              std::shared_ptr<ScanOptions> options, std::shared_ptr<ScanContext> context,
+              int64_t range_start = 0, int64_t range_end = -1)
       : ScanTask(std::move(options), std::move(context)),
         format_(std::move(format)),
-        source_(std::move(source)) {}
+        source_(std::move(source)),
+        range_start_(range_start),
+        range_end_(range_end) {}
 
   Result<RecordBatchIterator> Execute() override {
     ARROW_ASSIGN_OR_RAISE(auto reader,
-                          OpenReader(source_, *format_, options(), context()->pool));
+                          OpenReader(source_, *format_, options(), context()->pool,
+                                     range_start_, range_end_));
+    if (reader == nullptr) {
+      return MakeEmptyIterator<std::shared_ptr<RecordBatch>>();
+    }
     return IteratorFromReader(std::move(reader));
   }
 
  private:
   std::shared_ptr<const CsvFileFormat> format_;
   FileSource source_;
+  int64_t range_start_, range_end_;
 };
 
 Result<bool> CsvFileFormat::IsSupported(const FileSource& source) const {
@@ -171,10 +244,28 @@ Result<ScanTaskIterator> CsvFileFormat::ScanFile(std::shared_ptr<ScanOptions> op
                                                  std::shared_ptr<ScanContext> context,
                                                  FileFragment* fragment) const {
   auto this_ = checked_pointer_cast<const CsvFileFormat>(shared_from_this());
-  auto task = std::make_shared<CsvScanTask>(std::move(this_), fragment->source(),
-                                            std::move(options), std::move(context));
 
-  return MakeVectorIterator<std::shared_ptr<ScanTask>>({std::move(task)});
+  int64_t file_size = -1;
+  if (split_size > 0 && !parse_options.newlines_in_values) {
+    ARROW_ASSIGN_OR_RAISE(auto input, fragment->source().Open());
+    ARROW_ASSIGN_OR_RAISE(file_size, input->GetSize());
+  }
+
+  if (file_size <= split_size) {
+    auto task = std::make_shared<CsvScanTask>(std::move(this_), fragment->source(),
+                                              std::move(options), std::move(context));
+    return MakeVectorIterator<std::shared_ptr<ScanTask>>({std::move(task)});
+  }
+
+  // Each task reads the rows starting in its byte range; the boundaries are
+  // resynchronized on row starts when the task is executed.
+  ScanTaskVector tasks;
+  for (int64_t start = 0; start < file_size; start += split_size) {
+    tasks.push_back(std::make_shared<CsvScanTask>(
+        this_, fragment->source(), options, context, start,
+        std::min(start + split_size, file_size)));
+  }
+  return MakeVectorIterator(std::move(tasks));
 }
 
 }  // namespace dataset
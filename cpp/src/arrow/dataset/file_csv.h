@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -34,6 +35,12 @@ class ARROW_DS_EXPORT CsvFileFormat : public FileFormat {
  public:
   /// Options affecting the parsing of CSV files
   csv::ParseOptions parse_options = csv::ParseOptions::Defaults();
+  /// If positive, files larger than this many bytes are scanned by several scan
+  /// tasks, each reading the rows starting in a byte range of this size.
+  ///
+  /// Ignored if parse_options.newlines_in_values is true, since row boundaries
+  /// can't be found without parsing from the start of the file.
+  int64_t split_size = 0;
 
   std::string type_name() const override { return "csv"; }
 
@@ -18,6 +18,7 @@
 #include "arrow/dataset/file_csv.h"
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -31,10 +32,13 @@
 #include "arrow/record_batch.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
 namespace dataset {
 
+using internal::checked_cast;
+
 class TestCsvFileFormat : public testing::Test {
  public:
   std::unique_ptr<FileSource> GetFileSource() {
@@ -100,6 +104,44 @@ TEST_F(TestCsvFileFormat, ScanRecordBatchReaderWithVirtualColumn) {
   ASSERT_EQ(row_count, 3);
 }
 
+TEST_F(TestCsvFileFormat, SplitIntoByteRanges) {
+  std::string csv = "f64\n";
+  for (int i = 0; i < 100; ++i) {
+    csv += std::to_string(i) + (i % 3 == 0 ? "\r\n" : "\n");
+  }
+  auto source = GetFileSource(csv);
+  opts_ = ScanOptions::Make(schema_);
+
+  for (int64_t split_size : {1, 2, 7, 50, 1000}) {
+    SCOPED_TRACE("split_size = " + std::to_string(split_size));
+    format_->split_size = split_size;
+    ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+    ASSERT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(opts_, ctx_));
+    ASSERT_OK_AND_ASSIGN(auto scan_tasks, scan_task_it.ToVector());
+    int64_t num_ranges = (static_cast<int64_t>(csv.size()) - 1) / split_size + 1;
+    ASSERT_EQ(static_cast<int64_t>(scan_tasks.size()), num_ranges);
+
+    // Every row is read exactly once, in order
+    double expected = 0;
+    for (auto maybe_batch : Batches(MakeVectorIterator(std::move(scan_tasks)))) {
+      ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+      AssertSchemaEqual(*batch->schema(), *schema_);
+      const auto& values = checked_cast<const DoubleArray&>(*batch->column(0));
+      for (int64_t i = 0; i < values.length(); ++i) {
+        ASSERT_EQ(values.Value(i), expected++);
+      }
+    }
+    ASSERT_EQ(expected, 100);
+  }
+
+  // Row boundaries can't be found from the middle of the file
+  format_->parse_options.newlines_in_values = true;
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+  ASSERT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(opts_, ctx_));
+  ASSERT_OK_AND_ASSIGN(auto scan_tasks, scan_task_it.ToVector());
+  ASSERT_EQ(scan_tasks.size(), 1u);
+}
+
 TEST_F(TestCsvFileFormat, OpenFailureWithRelevantError) {
   auto source = GetFileSource("");
   EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, testing::HasSubstr("<Buffer>"),
@@ -19,17 +19,28 @@
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/array_nested.h"
+#include "arrow/array/array_primitive.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/file_base.h"
+#include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/dataset/scanner_internal.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
+#include "arrow/scalar.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace dataset {
 
 static inline ipc::IpcReadOptions default_read_options() {
@@ -54,18 +65,84 @@ static inline Result<std::shared_ptr<ipc::RecordBatchFileReader>> OpenReader(
   return reader;
 }
 
-static inline Result<std::vector<int>> GetIncludedFields(
-    const Schema& schema, const std::vector<std::string>& materialized_fields) {
-  std::vector<int> included_fields;
+// An expression which the values of a field of a record batch are guaranteed to
+// satisfy according to its statistics, or null if they're unknown
+static Result<std::shared_ptr<Expression>> FieldStatisticsAsExpression(
+    const Field& field, const StructArray& statistics, int64_t num_rows, int64_t i) {
+  auto field_expr = field_ref(field.name());
+  auto null_expr = equal(field_expr, scalar(MakeNullScalar(field.type())));
+  const int64_t null_count =
+      checked_cast<const Int64Array&>(*statistics.field(0)).Value(i);
+  if (null_count == num_rows) {
+    return null_expr;
+  }
+  if (statistics.num_fields() < 3 || statistics.field(1)->IsNull(i)) {
+    return nullptr;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto min, statistics.field(1)->GetScalar(i));
+  ARROW_ASSIGN_OR_RAISE(auto max, statistics.field(2)->GetScalar(i));
+  auto expr = and_(greater_equal(field_expr, scalar(std::move(min))),
+                   less_equal(field_expr, scalar(std::move(max))));
+  if (null_count > 0) {
+    expr = or_(std::move(expr), std::move(null_expr));
+  }
+  return expr;
+}
 
-  for (FieldRef ref : materialized_fields) {
-    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(schema));
-    if (match.indices().empty()) continue;
+// An expression which the rows of the i-th record batch of a file are guaranteed
+// to satisfy according to the statistics of the fields referenced by a filter,
+// or null if they're unknown
+static Result<std::shared_ptr<Expression>> RecordBatchGuarantee(
+    const Schema& schema, const RecordBatch& statistics,
+    const std::vector<std::string>& field_names, int64_t i) {
+  const auto& num_rows = checked_cast<const Int64Array&>(*statistics.column(0));
+  ExpressionVector guarantees;
+  for (int j = 0; j < schema.num_fields(); ++j) {
+    const auto& field = *schema.field(j);
+    if (std::find(field_names.begin(), field_names.end(), field.name()) ==
+        field_names.end()) {
+      continue;
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        auto guarantee,
+        FieldStatisticsAsExpression(
+            field, checked_cast<const StructArray&>(*statistics.column(j + 1)),
+            num_rows.Value(i), i));
+    if (guarantee != nullptr) {
+      guarantees.push_back(std::move(guarantee));
+    }
+  }
+  if (guarantees.empty()) {
+    return nullptr;
+  }
+  return and_(std::move(guarantees));
+}
 
-    included_fields.push_back(match.indices()[0]);
+// The indices of the record batches of the file which may satisfy the filter,
+// according to the record batch statistics of the file if it has any
+static Result<std::vector<int>> FilterRecordBatches(
+    const Expression& filter, const ipc::RecordBatchFileReader& reader) {
+  std::vector<int> indices(reader.num_record_batches());
+  std::iota(indices.begin(), indices.end(), 0);
+  const auto field_names = FieldsInExpression(filter);
+  if (field_names.empty()) {
+    return indices;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto statistics, ipc::ReadRecordBatchStatistics(reader));
+  if (statistics == nullptr) {
+    return indices;
   }
 
-  return included_fields;
+  std::vector<int> remaining;
+  for (int i : indices) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto guarantee,
+        RecordBatchGuarantee(*reader.schema(), *statistics, field_names, i));
+    if (guarantee == nullptr || filter.IsSatisfiableWith(guarantee)) {
+      remaining.push_back(i);
+    }
+  }
+  return remaining;
 }
 
 /// \brief A ScanTask backed by an Ipc file.
@@ -79,8 +156,9 @@ class IpcScanTask : public ScanTask {
     struct Impl {
       static Result<RecordBatchIterator> Make(
           const FileSource& source, std::vector<std::string> materialized_fields,
-          MemoryPool* pool) {
+          const Expression& filter, MemoryPool* pool) {
         ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source));
+        ARROW_ASSIGN_OR_RAISE(auto indices, FilterRecordBatches(filter, *reader));
 
         auto options = default_read_options();
         options.memory_pool = pool;
@@ -88,22 +166,25 @@ class IpcScanTask : public ScanTask {
                               GetIncludedFields(*reader->schema(), materialized_fields));
 
         ARROW_ASSIGN_OR_RAISE(reader, OpenReader(source, options));
-        return RecordBatchIterator(Impl{std::move(reader), 0});
+        return RecordBatchIterator(Impl{std::move(reader), std::move(indices), 0});
       }
 
       Result<std::shared_ptr<RecordBatch>> Next() {
-        if (i_ == reader_->num_record_batches()) {
+        if (i_ == indices_.size()) {
           return nullptr;
         }
 
-        return reader_->ReadRecordBatch(i_++);
+        return reader_->ReadRecordBatch(indices_[i_++]);
       }
 
       std::shared_ptr<ipc::RecordBatchFileReader> reader_;
-      int i_;
+      // The record batches which may satisfy the filter
+      std::vector<int> indices_;
+      size_t i_;
     };
 
-    return Impl::Make(source_, options_->MaterializedFields(), context_->pool);
+    return Impl::Make(source_, options_->MaterializedFields(), *options_->filter,
+                      context_->pool);
   }
 
  private:
@@ -159,9 +240,64 @@ Result<ScanTaskIterator> IpcFileFormat::ScanFile(std::shared_ptr<ScanOptions> op
                                    fragment->source());
 }
 
+Result<int64_t> IpcFileFormat::CountRows(FileFragment* fragment,
+                                        std::shared_ptr<Expression> predicate,
+                                        std::shared_ptr<ScanOptions> options,
+                                        std::shared_ptr<ScanContext> context) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(fragment->source()));
+  ARROW_ASSIGN_OR_RAISE(auto statistics, ipc::ReadRecordBatchStatistics(*reader));
+  const auto field_names = FieldsInExpression(*predicate);
+
+  // Count the rows of the record batches whose statistics are conclusive
+  int64_t count = 0;
+  std::vector<int> to_scan;
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    if (statistics == nullptr) {
+      to_scan.push_back(i);
+      continue;
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        auto guarantee,
+        RecordBatchGuarantee(*reader->schema(), *statistics, field_names, i));
+    auto simplified = guarantee == nullptr ? predicate : predicate->Assume(guarantee);
+    if (!simplified->IsSatisfiable()) {
+      continue;
+    }
+    if (simplified->Equals(true)) {
+      count += checked_cast<const Int64Array&>(*statistics->column(0)).Value(i);
+      continue;
+    }
+    to_scan.push_back(i);
+  }
+  if (to_scan.empty()) {
+    return count;
+  }
+
+  // Read the others, only the columns referenced by the predicate
+  auto read_options = default_read_options();
+  read_options.memory_pool = context->pool;
+  ARROW_ASSIGN_OR_RAISE(read_options.included_fields,
+                        GetIncludedFields(*reader->schema(), field_names));
+  if (read_options.included_fields.empty() && reader->schema()->num_fields() > 0) {
+    // No fields means all fields to the reader, a single one is enough to count
+    read_options.included_fields.push_back(0);
+  }
+  ARROW_ASSIGN_OR_RAISE(reader, OpenReader(fragment->source(), read_options));
+  for (int i : to_scan) {
+    RETURN_NOT_OK(context->stop_token.Poll());
+    ARROW_ASSIGN_OR_RAISE(auto batch, reader->ReadRecordBatch(i));
+    ARROW_ASSIGN_OR_RAISE(auto batch_rows,
+                          CountRowsSatisfying(*predicate, *options->evaluator, batch,
+                                              context->pool));
+    count += batch_rows;
+  }
+  return count;
+}
+
 Status IpcFileFormat::WriteFragment(RecordBatchReader* batches,
                                     io::OutputStream* destination) const {
-  ARROW_ASSIGN_OR_RAISE(auto writer, ipc::MakeFileWriter(destination, batches->schema()));
+  ARROW_ASSIGN_OR_RAISE(
+      auto writer, ipc::MakeFileWriter(destination, batches->schema(), write_options));
 
   for (;;) {
     ARROW_ASSIGN_OR_RAISE(auto batch, batches->Next());
@@ -172,5 +308,41 @@ Status IpcFileFormat::WriteFragment(RecordBatchReader* batches,
   return writer->Close();
 }
 
+namespace {
+
+class IpcFileWriter : public FileWriter {
+ public:
+  IpcFileWriter(std::shared_ptr<io::OutputStream> destination,
+                std::shared_ptr<ipc::RecordBatchWriter> writer,
+                std::shared_ptr<Schema> schema)
+      : FileWriter(std::move(schema)),
+        destination_(std::move(destination)),
+        writer_(std::move(writer)) {}
+
+  Status Write(const std::shared_ptr<RecordBatch>& batch) override {
+    return writer_->WriteRecordBatch(*batch);
+  }
+
+  Status Finish() override {
+    RETURN_NOT_OK(writer_->Close());
+    return destination_->Close();
+  }
+
+ private:
+  std::shared_ptr<io::OutputStream> destination_;
+  std::shared_ptr<ipc::RecordBatchWriter> writer_;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<FileWriter>> IpcFileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination,
+    std::shared_ptr<Schema> schema) const {
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        ipc::MakeFileWriter(destination, schema, write_options));
+  return std::make_shared<IpcFileWriter>(std::move(destination), std::move(writer),
+                                         std::move(schema));
+}
+
 }  // namespace dataset
 }  // namespace arrow
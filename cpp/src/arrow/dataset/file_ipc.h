@@ -25,6 +25,7 @@
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
+#include "arrow/ipc/options.h"
 #include "arrow/result.h"
 
 namespace arrow {
@@ -37,6 +38,13 @@ class ARROW_DS_EXPORT IpcFileFormat : public FileFormat {
 
   bool splittable() const override { return true; }
 
+  /// \brief Options for writing IPC files
+  ///
+  /// If write_options.write_statistics is true, the statistics written to the
+  /// files are used to skip the record batches which can't satisfy the filter
+  /// when scanning them.
+  ipc::IpcWriteOptions write_options = ipc::IpcWriteOptions::Defaults();
+
   Result<bool> IsSupported(const FileSource& source) const override;
 
   /// \brief Return the schema of the file if possible.
@@ -47,8 +55,20 @@ class ARROW_DS_EXPORT IpcFileFormat : public FileFormat {
                                     std::shared_ptr<ScanContext> context,
                                     FileFragment* fragment) const override;
 
+  /// \brief Count the rows of a file satisfying a predicate
+  ///
+  /// The rows of the record batches whose statistics show that all or none of
+  /// them satisfy the predicate are counted without reading the batches.
+  Result<int64_t> CountRows(FileFragment* fragment, std::shared_ptr<Expression> predicate,
+                            std::shared_ptr<ScanOptions> options,
+                            std::shared_ptr<ScanContext> context) const override;
+
   Status WriteFragment(RecordBatchReader* batches,
                        io::OutputStream* destination) const override;
+
+  Result<std::shared_ptr<FileWriter>> MakeWriter(
+      std::shared_ptr<io::OutputStream> destination,
+      std::shared_ptr<Schema> schema) const override;
 };
 
 }  // namespace dataset
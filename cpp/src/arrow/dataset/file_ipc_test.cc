@@ -188,6 +188,16 @@ TEST_F(TestIpcFileSystemDataset, WriteWithEmptyPartitioningSchema) {
   TestWriteWithEmptyPartitioningSchema();
 }
 
+TEST_F(TestIpcFileSystemDataset, WriteFromScanner) { TestWriteFromScanner(); }
+
+TEST_F(TestIpcFileSystemDataset, WriteFromScannerRollsFiles) {
+  TestWriteFromScannerRollsFiles();
+}
+
+TEST_F(TestIpcFileSystemDataset, WriteFromScannerInvalidOptions) {
+  TestWriteFromScannerInvalidOptions();
+}
+
 TEST_F(TestIpcFileFormat, OpenFailureWithRelevantError) {
   std::shared_ptr<Buffer> buf = std::make_shared<Buffer>(util::string_view(""));
   auto result = format_->Inspect(FileSource(buf));
@@ -278,6 +288,85 @@ TEST_F(TestIpcFileFormat, ScanRecordBatchReaderProjectedMissingCols) {
   }
 }
 
+TEST_F(TestIpcFileFormat, ScanWithStatistics) {
+  // Record batches of increasing values, with statistics
+  schema_ = schema({field("i32", int32())});
+  auto write_options = ipc::IpcWriteOptions::Defaults();
+  write_options.write_statistics = true;
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, ipc::MakeFileWriter(sink, schema_, write_options));
+  for (int32_t i = 0; i < 4; ++i) {
+    std::shared_ptr<Array> values;
+    ArrayFromVector<Int32Type, int32_t>({i * 10, i * 10 + 5}, &values);
+    ASSERT_OK(writer->WriteRecordBatch(*RecordBatch::Make(schema_, 2, {values})));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(buffer)));
+
+  auto CountRows = [&](std::shared_ptr<Expression> filter) -> int64_t {
+    opts_ = ScanOptions::Make(schema_);
+    opts_->filter = std::move(filter);
+    int64_t row_count = 0;
+    for (auto maybe_batch : Batches(fragment.get())) {
+      EXPECT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+      row_count += batch->num_rows();
+    }
+    return row_count;
+  };
+  // The record batches which can't satisfy the filter are skipped
+  ASSERT_EQ(CountRows(scalar(true)), 8);
+  ASSERT_EQ(CountRows(equal(field_ref("i32"), scalar(15))), 2);
+  ASSERT_EQ(CountRows(equal(field_ref("i32"), scalar(17))), 0);
+  ASSERT_EQ(CountRows(greater(field_ref("i32"), scalar(12))), 6);
+  ASSERT_EQ(CountRows(less(field_ref("i32"), scalar(0))), 0);
+}
+
+TEST_F(TestIpcFileFormat, CountRows) {
+  schema_ = schema({field("i32", int32())});
+  auto write_options = ipc::IpcWriteOptions::Defaults();
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto plain_sink, io::BufferOutputStream::Create());
+  write_options.write_statistics = true;
+  ASSERT_OK_AND_ASSIGN(auto writer, ipc::MakeFileWriter(sink, schema_, write_options));
+  write_options.write_statistics = false;
+  ASSERT_OK_AND_ASSIGN(auto plain_writer,
+                       ipc::MakeFileWriter(plain_sink, schema_, write_options));
+  for (int32_t i = 0; i < 4; ++i) {
+    std::shared_ptr<Array> values;
+    ArrayFromVector<Int32Type, int32_t>({i * 10, i * 10 + 5}, &values);
+    auto batch = RecordBatch::Make(schema_, 2, {values});
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+    ASSERT_OK(plain_writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(plain_writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(buffer)));
+  ASSERT_OK_AND_ASSIGN(buffer, plain_sink->Finish());
+  ASSERT_OK_AND_ASSIGN(auto plain_fragment, format_->MakeFragment(FileSource(buffer)));
+
+  opts_ = ScanOptions::Make(schema_);
+  auto evaluator = std::make_shared<CountingEvaluator>();
+  opts_->evaluator = evaluator;
+  auto greater_than_12 = greater(field_ref("i32"), scalar(12));
+
+  // With statistics, only the record batch straddling 12 is read
+  ASSERT_OK_AND_EQ(8, fragment->CountRows(scalar(true), opts_, ctx_));
+  ASSERT_OK_AND_EQ(0,
+                   fragment->CountRows(less(field_ref("i32"), scalar(0)), opts_, ctx_));
+  ASSERT_OK_AND_EQ(4, fragment->CountRows(greater_equal(field_ref("i32"), scalar(20)),
+                                          opts_, ctx_));
+  ASSERT_EQ(0, evaluator->num_evaluations);
+  ASSERT_OK_AND_EQ(5, fragment->CountRows(greater_than_12, opts_, ctx_));
+  ASSERT_EQ(1, evaluator->num_evaluations);
+
+  evaluator->num_evaluations = 0;
+  ASSERT_OK_AND_EQ(8, plain_fragment->CountRows(scalar(true), opts_, ctx_));
+  ASSERT_OK_AND_EQ(5, plain_fragment->CountRows(greater_than_12, opts_, ctx_));
+  ASSERT_EQ(4, evaluator->num_evaluations);
+}
+
 TEST_F(TestIpcFileFormat, Inspect) {
   auto reader = GetRecordBatchReader();
   auto source = GetFileSource(reader.get());
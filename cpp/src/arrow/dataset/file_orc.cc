@@ -0,0 +1,211 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_orc.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/adapters/orc/adapter.h"
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/util/iterator.h"
+
+namespace arrow {
+namespace dataset {
+
+using adapters::orc::ORCFileReader;
+using adapters::orc::ORCFileWriter;
+using adapters::orc::StripeColumnStatistics;
+
+static inline Result<std::shared_ptr<ORCFileReader>> OpenReader(
+    const FileSource& source, MemoryPool* pool = default_memory_pool()) {
+  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+
+  std::unique_ptr<ORCFileReader> reader;
+  auto status = ORCFileReader::Open(std::move(input), pool, &reader);
+  if (!status.ok()) {
+    return status.WithMessage("Could not open ORC input source '", source.path(),
+                              "': ", status.message());
+  }
+  return std::shared_ptr<ORCFileReader>(std::move(reader));
+}
+
+// An expression which holds for every row of a stripe, derived from the stripe
+// statistics of the given fields.  Fields without usable statistics are
+// left unconstrained.
+static Result<std::shared_ptr<Expression>> StripeStatisticsAsExpression(
+    ORCFileReader* reader, const Schema& schema, const std::vector<int>& field_indices,
+    int stripe) {
+  ExpressionVector conjunction;
+  for (int i : field_indices) {
+    StripeColumnStatistics statistics;
+    RETURN_NOT_OK(reader->ReadStripeColumnStatistics(stripe, i, &statistics));
+
+    const auto& field = schema.field(i);
+    auto field_expr = field_ref(field->name());
+    auto null_expr = equal(field_expr, scalar(MakeNullScalar(field->type())));
+    if (statistics.num_values == 0) {
+      conjunction.push_back(std::move(null_expr));
+    } else if (statistics.min != nullptr && statistics.max != nullptr) {
+      std::shared_ptr<Expression> expr =
+          and_(greater_equal(field_expr, scalar(statistics.min)),
+               less_equal(field_expr, scalar(statistics.max)));
+      if (statistics.has_null) {
+        expr = or_(std::move(expr), std::move(null_expr));
+      }
+      conjunction.push_back(std::move(expr));
+    }
+  }
+  return and_(conjunction);
+}
+
+/// \brief A ScanTask backed by a single stripe of an ORC file.
+class OrcScanTask : public ScanTask {
+ public:
+  OrcScanTask(std::shared_ptr<ORCFileReader> reader, std::vector<int> included_fields,
+              int stripe, std::shared_ptr<ScanOptions> options,
+              std::shared_ptr<ScanContext> context)
+      : ScanTask(std::move(options), std::move(context)),
+        reader_(std::move(reader)),
+        included_fields_(std::move(included_fields)),
+        stripe_(stripe) {}
+
+  Result<RecordBatchIterator> Execute() override {
+    std::shared_ptr<RecordBatchReader> batch_reader;
+    RETURN_NOT_OK(reader_->GetRecordBatchReader(options_->batch_size, included_fields_,
+                                                {stripe_}, &batch_reader));
+
+    // The batch reader must not outlive the ORC file reader
+    auto reader = reader_;
+    return MakeFunctionIterator(
+        [reader, batch_reader] { return batch_reader->Next(); });
+  }
+
+ private:
+  std::shared_ptr<ORCFileReader> reader_;
+  std::vector<int> included_fields_;
+  int stripe_;
+};
+
+Result<bool> OrcFileFormat::IsSupported(const FileSource& source) const {
+  RETURN_NOT_OK(source.Open().status());
+  return OpenReader(source).ok();
+}
+
+Result<std::shared_ptr<Schema>> OrcFileFormat::Inspect(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source));
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(reader->ReadSchema(&schema));
+  return schema;
+}
+
+Result<ScanTaskIterator> OrcFileFormat::ScanFile(std::shared_ptr<ScanOptions> options,
+                                                 std::shared_ptr<ScanContext> context,
+                                                 FileFragment* fragment) const {
+  auto predicate = options->filter->Assume(*fragment->partition_expression());
+  if (!predicate->IsSatisfiable()) {
+    return MakeEmptyIterator<std::shared_ptr<ScanTask>>();
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(fragment->source(), context->pool));
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(reader->ReadSchema(&schema));
+  ARROW_ASSIGN_OR_RAISE(auto included_fields,
+                        GetIncludedFields(*schema, options->MaterializedFields()));
+
+  std::vector<int> filter_fields;
+  for (const auto& name : FieldsInExpression(*predicate)) {
+    int i = schema->GetFieldIndex(name);
+    if (i != -1) {
+      filter_fields.push_back(i);
+    }
+  }
+
+  // Stripes are independent, let the scanner decode them in parallel.
+  ScanTaskVector tasks;
+  for (int stripe = 0; stripe < reader->NumberOfStripes(); ++stripe) {
+    if (!filter_fields.empty()) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto stripe_expr,
+          StripeStatisticsAsExpression(reader.get(), *schema, filter_fields, stripe));
+      if (!predicate->IsSatisfiableWith(stripe_expr)) {
+        continue;
+      }
+    }
+    tasks.push_back(std::make_shared<OrcScanTask>(reader, included_fields, stripe,
+                                                  options, context));
+  }
+  return MakeVectorIterator(std::move(tasks));
+}
+
+Status OrcFileFormat::WriteFragment(RecordBatchReader* batches,
+                                    io::OutputStream* destination) const {
+  std::unique_ptr<ORCFileWriter> writer;
+  RETURN_NOT_OK(
+      ORCFileWriter::Open(batches->schema(), destination, write_options, &writer));
+
+  for (;;) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, batches->Next());
+    if (batch == nullptr) break;
+    RETURN_NOT_OK(writer->Write(*batch));
+  }
+
+  return writer->Close();
+}
+
+namespace {
+
+class OrcFileWriter : public FileWriter {
+ public:
+  OrcFileWriter(std::shared_ptr<io::OutputStream> destination,
+                std::unique_ptr<ORCFileWriter> writer, std::shared_ptr<Schema> schema)
+      : FileWriter(std::move(schema)),
+        destination_(std::move(destination)),
+        writer_(std::move(writer)) {}
+
+  Status Write(const std::shared_ptr<RecordBatch>& batch) override {
+    return writer_->Write(*batch);
+  }
+
+  Status Finish() override {
+    RETURN_NOT_OK(writer_->Close());
+    return destination_->Close();
+  }
+
+ private:
+  std::shared_ptr<io::OutputStream> destination_;
+  std::unique_ptr<ORCFileWriter> writer_;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<FileWriter>> OrcFileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination,
+    std::shared_ptr<Schema> schema) const {
+  std::unique_ptr<ORCFileWriter> writer;
+  RETURN_NOT_OK(ORCFileWriter::Open(schema, destination.get(), write_options, &writer));
+  return std::make_shared<OrcFileWriter>(std::move(destination), std::move(writer),
+                                         std::move(schema));
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,245 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_orc.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <orc/OrcFile.hh>
+
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/make_unique.h"
+
+namespace liborc = orc;
+
+namespace arrow {
+namespace dataset {
+
+constexpr uint64_t kStripeCount = 4;
+constexpr uint64_t kStripeRowCount = 10000;
+
+class MemoryOutputStream : public liborc::OutputStream {
+ public:
+  uint64_t getLength() const override { return data_.size(); }
+
+  uint64_t getNaturalWriteSize() const override { return 128 * 1024; }
+
+  void write(const void* buf, size_t size) override {
+    data_.append(reinterpret_cast<const char*>(buf), size);
+  }
+
+  const std::string& getName() const override { return name_; }
+
+  void close() override {}
+
+  const std::string& data() const { return data_; }
+
+ private:
+  std::string data_;
+  std::string name_ = "MemoryOutputStream";
+};
+
+class TestOrcFileFormat : public ::testing::Test {
+ public:
+  // Write kStripeCount stripes, the i-th of which holds the values
+  // [i * kStripeRowCount, (i + 1) * kStripeRowCount) in both columns
+  std::unique_ptr<FileSource> GetFileSource() {
+    MemoryOutputStream stream;
+    std::unique_ptr<liborc::Type> type(
+        liborc::Type::buildTypeFromString("struct<i64:bigint,str:string>"));
+    liborc::WriterOptions options;
+    // Flush a stripe on every write
+    options.setStripeSize(1024);
+    options.setMemoryPool(liborc::getDefaultPool());
+    auto writer = liborc::createWriter(*type, &stream, options);
+
+    auto batch = writer->createRowBatch(kStripeRowCount);
+    auto struct_batch = dynamic_cast<liborc::StructVectorBatch*>(batch.get());
+    auto long_batch = dynamic_cast<liborc::LongVectorBatch*>(struct_batch->fields[0]);
+    auto str_batch = dynamic_cast<liborc::StringVectorBatch*>(struct_batch->fields[1]);
+    std::vector<std::string> strings(kStripeRowCount);
+    for (uint64_t stripe = 0; stripe < kStripeCount; ++stripe) {
+      for (uint64_t i = 0; i < kStripeRowCount; ++i) {
+        auto value = static_cast<int64_t>(stripe * kStripeRowCount + i);
+        strings[i] = std::to_string(value);
+        long_batch->data[i] = value;
+        str_batch->data[i] = &strings[i][0];
+        str_batch->length[i] = static_cast<int64_t>(strings[i].size());
+      }
+      struct_batch->numElements = long_batch->numElements = str_batch->numElements =
+          kStripeRowCount;
+      writer->add(*batch);
+    }
+    writer->close();
+
+    return internal::make_unique<FileSource>(Buffer::FromString(stream.data()));
+  }
+
+  RecordBatchIterator Batches(ScanTaskIterator scan_task_it) {
+    return MakeFlattenIterator(MakeMaybeMapIterator(
+        [](std::shared_ptr<ScanTask> scan_task) { return scan_task->Execute(); },
+        std::move(scan_task_it)));
+  }
+
+  void CountStripesAndRows(Fragment* fragment, int64_t expected_stripes,
+                           int64_t expected_rows) {
+    ASSERT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(opts_, ctx_));
+    ASSERT_OK_AND_ASSIGN(auto scan_tasks, scan_task_it.ToVector());
+    ASSERT_EQ(static_cast<int64_t>(scan_tasks.size()), expected_stripes);
+
+    int64_t row_count = 0;
+    for (auto maybe_batch : Batches(MakeVectorIterator(std::move(scan_tasks)))) {
+      ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+      row_count += batch->num_rows();
+    }
+    ASSERT_EQ(row_count, expected_rows);
+  }
+
+ protected:
+  std::shared_ptr<OrcFileFormat> format_ = std::make_shared<OrcFileFormat>();
+  std::shared_ptr<ScanOptions> opts_;
+  std::shared_ptr<ScanContext> ctx_ = std::make_shared<ScanContext>();
+  std::shared_ptr<Schema> schema_ = schema({field("i64", int64()), field("str", utf8())});
+};
+
+TEST_F(TestOrcFileFormat, Inspect) {
+  auto source = GetFileSource();
+  ASSERT_OK_AND_ASSIGN(auto actual, format_->Inspect(*source));
+  AssertSchemaEqual(*actual, *schema_, /*check_metadata=*/false);
+}
+
+TEST_F(TestOrcFileFormat, IsSupported) {
+  auto source = GetFileSource();
+  ASSERT_OK_AND_ASSIGN(auto supported, format_->IsSupported(*source));
+  ASSERT_TRUE(supported);
+
+  FileSource not_orc(Buffer::FromString("definitely not an orc file"));
+  ASSERT_OK_AND_ASSIGN(supported, format_->IsSupported(not_orc));
+  ASSERT_FALSE(supported);
+}
+
+TEST_F(TestOrcFileFormat, ScanStripes) {
+  auto source = GetFileSource();
+  opts_ = ScanOptions::Make(schema_);
+  opts_->batch_size = 1000;
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  CountStripesAndRows(fragment.get(), kStripeCount, kStripeCount * kStripeRowCount);
+}
+
+TEST_F(TestOrcFileFormat, ScanProjected) {
+  auto source = GetFileSource();
+  opts_ = ScanOptions::Make(schema_);
+  opts_->projector = RecordBatchProjector(SchemaFromColumnNames(schema_, {"str"}));
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  ASSERT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(opts_, ctx_));
+  for (auto maybe_batch : Batches(std::move(scan_task_it))) {
+    ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+    AssertSchemaEqual(*batch->schema(), *schema({field("str", utf8())}),
+                      /*check_metadata=*/false);
+  }
+}
+
+TEST_F(TestOrcFileFormat, PredicatePushdownStripes) {
+  auto source = GetFileSource();
+  opts_ = ScanOptions::Make(schema_);
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  for (uint64_t stripe = 0; stripe < kStripeCount; ++stripe) {
+    auto value = static_cast<int64_t>(stripe * kStripeRowCount + 1);
+    opts_->filter = ("i64"_ == value).Copy();
+    CountStripesAndRows(fragment.get(), 1, kStripeRowCount);
+  }
+
+  // Strings are compared lexicographically: "1" only falls within ["0", "9999"]
+  opts_->filter = ("str"_ == std::string("1")).Copy();
+  CountStripesAndRows(fragment.get(), 1, kStripeRowCount);
+
+  opts_->filter = ("str"_ == std::string("a")).Copy();
+  CountStripesAndRows(fragment.get(), 0, 0);
+
+  opts_->filter = ("i64"_ >= static_cast<int64_t>(2 * kStripeRowCount)).Copy();
+  CountStripesAndRows(fragment.get(), 2, 2 * kStripeRowCount);
+
+  opts_->filter = ("i64"_ < int64_t(0)).Copy();
+  CountStripesAndRows(fragment.get(), 0, 0);
+
+  opts_->filter = scalar(false);
+  CountStripesAndRows(fragment.get(), 0, 0);
+}
+
+TEST_F(TestOrcFileFormat, WriteRecordBatchReader) {
+  auto reader = MakeGeneratedRecordBatch(schema_, 1000, 8);
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK(format_->WriteFragment(reader.get(), sink.get()));
+  ASSERT_OK_AND_ASSIGN(auto written, sink->Finish());
+
+  FileSource source(written);
+  ASSERT_OK_AND_ASSIGN(auto actual, format_->Inspect(source));
+  AssertSchemaEqual(*actual, *schema_, /*check_metadata=*/false);
+
+  opts_ = ScanOptions::Make(schema_);
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source));
+  ASSERT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(opts_, ctx_));
+  int64_t row_count = 0;
+  for (auto maybe_batch : Batches(std::move(scan_task_it))) {
+    ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+    row_count += batch->num_rows();
+  }
+  ASSERT_EQ(row_count, 8000);
+}
+
+class TestOrcFileSystemDataset : public testing::Test,
+                                 public WriteFileSystemDatasetMixin {
+ public:
+  void SetUp() override {
+    MakeSourceDataset();
+    format_ = std::make_shared<OrcFileFormat>();
+  }
+};
+
+TEST_F(TestOrcFileSystemDataset, WriteWithIdenticalPartitioningSchema) {
+  TestWriteWithIdenticalPartitioningSchema();
+}
+
+TEST_F(TestOrcFileSystemDataset, WriteWithUnrelatedPartitioningSchema) {
+  TestWriteWithUnrelatedPartitioningSchema();
+}
+
+TEST_F(TestOrcFileSystemDataset, WriteWithSupersetPartitioningSchema) {
+  TestWriteWithSupersetPartitioningSchema();
+}
+
+TEST_F(TestOrcFileSystemDataset, WriteWithEmptyPartitioningSchema) {
+  TestWriteWithEmptyPartitioningSchema();
+}
+
+TEST_F(TestOrcFileSystemDataset, WriteFromScanner) { TestWriteFromScanner(); }
+
+}  // namespace dataset
+}  // namespace arrow
@@ -17,12 +17,16 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <algorithm>
+#include <functional>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "arrow/array.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner.h"
@@ -31,11 +35,21 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/range.h"
+#include "arrow/util/tracing.h"
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
+#include "parquet/bloom_filter_reader.h"
+#include "parquet/column_page.h"
+#include "parquet/column_reader.h"
+#include "parquet/encoding.h"
 #include "parquet/file_reader.h"
+#include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
 #include "parquet/statistics.h"
 
@@ -61,33 +75,115 @@ class ParquetScanTask : public ScanTask {
         column_projection_(std::move(column_projection)),
         reader_(std::move(reader)) {}
 
+  /// \brief A ScanTask which reads the columns the filter references first,
+  /// then only the rows of the other columns which satisfy it.
+  ParquetScanTask(RowGroupInfo row_group, std::vector<int> column_projection,
+                  std::shared_ptr<Expression> filter, std::vector<int> predicate_columns,
+                  std::vector<int> other_columns,
+                  std::shared_ptr<parquet::arrow::FileReader> reader,
+                  std::shared_ptr<ScanOptions> options,
+                  std::shared_ptr<ScanContext> context)
+      : ParquetScanTask(std::move(row_group), std::move(column_projection),
+                        std::move(reader), std::move(options), std::move(context)) {
+    filter_ = std::move(filter);
+    predicate_columns_ = std::move(predicate_columns);
+    other_columns_ = std::move(other_columns);
+  }
+
   Result<RecordBatchIterator> Execute() override {
+    util::TraceSpan span("dataset", "ParquetScanTask");
     // The construction of parquet's RecordBatchReader is deferred here to
     // control the memory usage of consumers who materialize all ScanTasks
     // before dispatching them, e.g. for scheduling purposes.
     //
     // Thus the memory incurred by the RecordBatchReader is allocated when
     // Scan is called.
+    if (filter_ != nullptr) {
+      return ExecuteLateMaterialization();
+    }
+    return ReadAllRows();
+  }
+
+ private:
+  Result<RecordBatchIterator> ReadAllRows() {
     std::unique_ptr<RecordBatchReader> record_batch_reader;
     RETURN_NOT_OK(reader_->GetRecordBatchReader({row_group_.id()}, column_projection_,
                                                 &record_batch_reader));
     return IteratorFromReader(std::move(record_batch_reader));
   }
 
- private:
+  Result<RecordBatchIterator> ExecuteLateMaterialization() {
+    std::shared_ptr<Table> predicate_table;
+    RETURN_NOT_OK(
+        reader_->ReadRowGroup(row_group_.id(), predicate_columns_, &predicate_table));
+    if (predicate_table->num_rows() == 0) {
+      return MakeEmptyIterator<std::shared_ptr<RecordBatch>>();
+    }
+    ARROW_ASSIGN_OR_RAISE(predicate_table,
+                          predicate_table->CombineChunks(context_->pool));
+    ArrayVector predicate_columns;
+    for (const auto& column : predicate_table->columns()) {
+      predicate_columns.push_back(column->chunk(0));
+    }
+    auto predicate_batch = RecordBatch::Make(predicate_table->schema(),
+                                             predicate_table->num_rows(),
+                                             std::move(predicate_columns));
+
+    ARROW_ASSIGN_OR_RAISE(
+        Datum selection,
+        options_->evaluator->Evaluate(*filter_, *predicate_batch, context_->pool));
+    if (selection.is_scalar()) {
+      // Either all rows or none are selected
+      ARROW_ASSIGN_OR_RAISE(
+          auto filtered_batch,
+          options_->evaluator->Filter(selection, predicate_batch, context_->pool));
+      if (filtered_batch->num_rows() == 0) {
+        return MakeEmptyIterator<std::shared_ptr<RecordBatch>>();
+      }
+      return ReadAllRows();
+    }
+
+    std::shared_ptr<Table> other_table;
+    RETURN_NOT_OK(reader_->ReadRowGroup(
+        row_group_.id(), other_columns_,
+        checked_cast<const BooleanArray&>(*selection.make_array()), &other_table));
+    ARROW_ASSIGN_OR_RAISE(
+        auto filtered_batch,
+        options_->evaluator->Filter(selection, predicate_batch, context_->pool));
+
+    // The columns the filter references come first
+    ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches({filtered_batch}));
+    for (int i = 0; i < other_table->num_columns(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(table, table->AddColumn(table->num_columns(),
+                                                    other_table->field(i),
+                                                    other_table->column(i)));
+    }
+    auto table_reader = std::make_shared<TableBatchReader>(*table);
+    table_reader->set_chunksize(options_->batch_size);
+    // NB: explicitly preserve table so that table_reader doesn't outlive it
+    return MakeFunctionIterator([table, table_reader] { return table_reader->Next(); });
+  }
+
   RowGroupInfo row_group_;
   std::vector<int> column_projection_;
   // The ScanTask _must_ hold a reference to reader_ because there's no
   // guarantee the producing ParquetScanTaskIterator is still alive. This is a
   // contract required by record_batch_reader_
   std::shared_ptr<parquet::arrow::FileReader> reader_;
+
+  // Only set for late materialization
+  std::shared_ptr<Expression> filter_;
+  std::vector<int> predicate_columns_;
+  std::vector<int> other_columns_;
 };
 
 static Result<std::unique_ptr<parquet::ParquetFileReader>> OpenReader(
-    const FileSource& source, parquet::ReaderProperties properties) {
+    const FileSource& source, parquet::ReaderProperties properties,
+    std::shared_ptr<parquet::FileMetaData> metadata = NULLPTR) {
   ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
   try {
-    return parquet::ParquetFileReader::Open(std::move(input), std::move(properties));
+    return parquet::ParquetFileReader::Open(std::move(input), std::move(properties),
+                                            std::move(metadata));
   } catch (const ::parquet::ParquetException& e) {
     return Status::IOError("Could not open parquet input source '", source.path(),
                            "': ", e.what());
@@ -189,17 +285,564 @@ static std::shared_ptr<StructScalar> RowGroupStatisticsAsStructScalar(
                                         struct_(std::move(fields)));
 }
 
+// Whether the statistics of a row group show that the fields have no nulls
+static bool HasNoNulls(const parquet::RowGroupMetaData& metadata,
+                       const SchemaManifest& manifest,
+                       const std::vector<std::string>& field_names) {
+  for (const auto& name : field_names) {
+    auto it = std::find_if(manifest.schema_fields.begin(), manifest.schema_fields.end(),
+                           [&](const SchemaField& schema_field) {
+                             return schema_field.field->name() == name;
+                           });
+    // A field absent from the file is all null
+    if (it == manifest.schema_fields.end() || !it->is_leaf()) {
+      return false;
+    }
+    auto column_metadata = metadata.ColumnChunk(it->column_index);
+    if (!column_metadata->is_stats_set()) {
+      return false;
+    }
+    auto statistics = column_metadata->statistics();
+    if (statistics == nullptr || statistics->null_count() > 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Whether some page of the column chunk may satisfy the predicate
+static bool AnyPageSatisfies(const Expression& predicate, const Field& field,
+                             const parquet::ColumnIndex& column_index) {
+  auto field_expr = field_ref(field.name());
+  auto null_expr = equal(field_expr, scalar(MakeNullScalar(field.type())));
+  for (int i = 0; i < column_index.num_pages(); ++i) {
+    std::shared_ptr<Expression> page_expr;
+    if (column_index.null_pages()[i]) {
+      page_expr = null_expr;
+    } else {
+      std::shared_ptr<Scalar> min, max;
+      if (!StatisticsAsScalars(*column_index.page_statistics(i), &min, &max).ok()) {
+        return true;
+      }
+      page_expr = and_(greater_equal(field_expr, scalar(min)),
+                       less_equal(field_expr, scalar(max)));
+      if (!column_index.has_null_counts() || column_index.null_counts()[i] > 0) {
+        page_expr = or_(std::move(page_expr), null_expr);
+      }
+    }
+    if (predicate.IsSatisfiableWith(page_expr)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Remove the row groups in which no page of some column chunk referenced by the
+// predicate may satisfy it. Column chunks without a page index are assumed to.
+static Result<std::vector<RowGroupInfo>> FilterRowGroupsByPageIndex(
+    const Expression& predicate, parquet::arrow::FileReader* reader,
+    std::vector<RowGroupInfo> row_groups) {
+  const auto field_names = FieldsInExpression(predicate);
+  std::vector<const SchemaField*> fields;
+  for (const auto& schema_field : reader->manifest().schema_fields) {
+    // As with the column chunk statistics, only leaf (primitive) types are supported.
+    if (schema_field.is_leaf() &&
+        std::find(field_names.begin(), field_names.end(),
+                  schema_field.field->name()) != field_names.end()) {
+      fields.push_back(&schema_field);
+    }
+  }
+  if (fields.empty()) {
+    return row_groups;
+  }
+
+  try {
+    auto page_index = reader->parquet_reader()->GetPageIndexReader();
+    if (page_index == nullptr) {
+      return row_groups;
+    }
+    auto end = std::remove_if(
+        row_groups.begin(), row_groups.end(), [&](const RowGroupInfo& info) {
+          auto row_group_index = page_index->RowGroup(info.id());
+          if (row_group_index == nullptr) {
+            return false;
+          }
+          for (const SchemaField* schema_field : fields) {
+            auto column_index =
+                row_group_index->GetColumnIndex(schema_field->column_index);
+            if (column_index != nullptr &&
+                !AnyPageSatisfies(predicate, *schema_field->field, *column_index)) {
+              return true;
+            }
+          }
+          return false;
+        });
+    row_groups.erase(end, row_groups.end());
+  } catch (const ::parquet::ParquetException& e) {
+    return Status::IOError("Could not read the parquet page index: ", e.what());
+  }
+  return row_groups;
+}
+
+template <typename ScalarType>
+static int64_t IntegerValue(const Scalar& value) {
+  return static_cast<int64_t>(checked_cast<const ScalarType&>(value).value);
+}
+
+// Hash a value as the writer hashed the values of the column chunk, or return
+// false if the values of its type may have been converted on write
+static bool BloomFilterHash(const Scalar& value, const parquet::ColumnDescriptor& descr,
+                            const parquet::BloomFilter& bloom_filter, uint64_t* hash) {
+  int64_t integer;
+  switch (value.type->id()) {
+    case Type::INT8:
+      integer = IntegerValue<Int8Scalar>(value);
+      break;
+    case Type::INT16:
+      integer = IntegerValue<Int16Scalar>(value);
+      break;
+    case Type::INT32:
+      integer = IntegerValue<Int32Scalar>(value);
+      break;
+    case Type::INT64:
+      integer = IntegerValue<Int64Scalar>(value);
+      break;
+    case Type::UINT8:
+      integer = IntegerValue<UInt8Scalar>(value);
+      break;
+    case Type::UINT16:
+      integer = IntegerValue<UInt16Scalar>(value);
+      break;
+    case Type::UINT32:
+      integer = IntegerValue<UInt32Scalar>(value);
+      break;
+    case Type::UINT64:
+      integer = IntegerValue<UInt64Scalar>(value);
+      break;
+    case Type::DATE32:
+      integer = IntegerValue<Date32Scalar>(value);
+      break;
+    case Type::STRING:
+    case Type::BINARY: {
+      if (descr.physical_type() != parquet::Type::BYTE_ARRAY) {
+        return false;
+      }
+      const auto& buffer = *checked_cast<const BaseBinaryScalar&>(value).value;
+      const parquet::ByteArray byte_array(static_cast<uint32_t>(buffer.size()),
+                                          buffer.data());
+      *hash = bloom_filter.Hash(&byte_array);
+      return true;
+    }
+    case Type::FIXED_SIZE_BINARY: {
+      const auto& buffer = *checked_cast<const BaseBinaryScalar&>(value).value;
+      if (descr.physical_type() != parquet::Type::FIXED_LEN_BYTE_ARRAY ||
+          descr.type_length() != buffer.size()) {
+        return false;
+      }
+      const parquet::FLBA flba(buffer.data());
+      *hash = bloom_filter.Hash(&flba, static_cast<uint32_t>(buffer.size()));
+      return true;
+    }
+    default:
+      return false;
+  }
+  switch (descr.physical_type()) {
+    case parquet::Type::INT32:
+      *hash = bloom_filter.Hash(static_cast<int32_t>(integer));
+      return true;
+    case parquet::Type::INT64:
+      *hash = bloom_filter.Hash(integer);
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Whether some row of a column chunk may hold a value: returns false only if
+// its Bloom filter or dictionary shows it can't.
+using MayContainValue = std::function<bool(const std::string& field, const Scalar&)>;
+
+// Replace with false the equality and IN comparisons of a field to values
+// which no row can hold. Under Kleene logic, this doesn't change the value of
+// the predicate for any row, except for null rows under a NOT, where it may
+// turn null into true, so no satisfiable predicate becomes unsatisfiable.
+static std::shared_ptr<Expression> ApplyValueFilters(
+    const Expression& expr, const MayContainValue& may_contain) {
+  switch (expr.type()) {
+    case ExpressionType::AND: {
+      const auto& and_expr = checked_cast<const AndExpression&>(expr);
+      return and_(ApplyValueFilters(*and_expr.left_operand(), may_contain),
+                  ApplyValueFilters(*and_expr.right_operand(), may_contain));
+    }
+    case ExpressionType::OR: {
+      const auto& or_expr = checked_cast<const OrExpression&>(expr);
+      return or_(ApplyValueFilters(*or_expr.left_operand(), may_contain),
+                 ApplyValueFilters(*or_expr.right_operand(), may_contain));
+    }
+    case ExpressionType::NOT: {
+      const auto& not_expr = checked_cast<const NotExpression&>(expr);
+      return not_(ApplyValueFilters(*not_expr.operand(), may_contain));
+    }
+    case ExpressionType::COMPARISON: {
+      const auto& comparison = checked_cast<const ComparisonExpression&>(expr);
+      const Expression* field = comparison.left_operand().get();
+      const Expression* value = comparison.right_operand().get();
+      if (field->type() != ExpressionType::FIELD) {
+        std::swap(field, value);
+      }
+      if (comparison.op() == CompareOperator::EQUAL &&
+          field->type() == ExpressionType::FIELD &&
+          value->type() == ExpressionType::SCALAR) {
+        const auto& name = checked_cast<const FieldExpression&>(*field).name();
+        const auto& scalar_value = checked_cast<const ScalarExpression&>(*value).value();
+        if (scalar_value->is_valid && !may_contain(name, *scalar_value)) {
+          return scalar(false);
+        }
+      }
+      return expr.Copy();
+    }
+    case ExpressionType::IN: {
+      const auto& in_expr = checked_cast<const InExpression&>(expr);
+      const auto& set = *in_expr.set();
+      // Null rows are in a set holding a null
+      if (in_expr.operand()->type() != ExpressionType::FIELD || set.null_count() > 0 ||
+          set.type_id() == Type::DICTIONARY) {
+        return expr.Copy();
+      }
+      const auto& name = checked_cast<const FieldExpression&>(*in_expr.operand()).name();
+      for (int64_t i = 0; i < set.length(); ++i) {
+        auto maybe_value = set.GetScalar(i);
+        if (!maybe_value.ok() || may_contain(name, **maybe_value)) {
+          return expr.Copy();
+        }
+      }
+      return scalar(false);
+    }
+    default:
+      return expr.Copy();
+  }
+}
+
+// Remove the row groups which the Bloom filters of their column chunks show
+// to hold no row satisfying the predicate. The filters are only read for the
+// columns compared for equality or membership with values of the column type.
+static Result<std::vector<RowGroupInfo>> FilterRowGroupsByBloomFilter(
+    const Expression& predicate, parquet::arrow::FileReader* reader,
+    std::vector<RowGroupInfo> row_groups) {
+  const auto field_names = FieldsInExpression(predicate);
+  std::unordered_map<std::string, const SchemaField*> fields;
+  for (const auto& schema_field : reader->manifest().schema_fields) {
+    // As with the column chunk statistics, only leaf (primitive) types are supported.
+    if (schema_field.is_leaf() &&
+        std::find(field_names.begin(), field_names.end(),
+                  schema_field.field->name()) != field_names.end()) {
+      fields.emplace(schema_field.field->name(), &schema_field);
+    }
+  }
+  if (fields.empty()) {
+    return row_groups;
+  }
+
+  try {
+    auto bloom_filter_reader = reader->parquet_reader()->GetBloomFilterReader();
+    if (bloom_filter_reader == nullptr) {
+      return row_groups;
+    }
+    const auto& schema = *reader->parquet_reader()->metadata()->schema();
+    auto end = std::remove_if(
+        row_groups.begin(), row_groups.end(), [&](const RowGroupInfo& info) {
+          auto row_group_reader = bloom_filter_reader->RowGroup(info.id());
+          // The Bloom filters read for this row group, null for none
+          std::unordered_map<int, std::unique_ptr<parquet::BloomFilter>> bloom_filters;
+          auto may_contain = [&](const std::string& name, const Scalar& value) {
+            auto it = fields.find(name);
+            if (it == fields.end() || !value.type->Equals(*it->second->field->type())) {
+              return true;
+            }
+            const int column_index = it->second->column_index;
+            auto bloom_filter_it = bloom_filters.find(column_index);
+            if (bloom_filter_it == bloom_filters.end()) {
+              bloom_filter_it =
+                  bloom_filters
+                      .emplace(column_index,
+                               row_group_reader->GetColumnBloomFilter(column_index))
+                      .first;
+            }
+            const auto& bloom_filter = bloom_filter_it->second;
+            uint64_t hash;
+            return bloom_filter == nullptr ||
+                   !BloomFilterHash(value, *schema.Column(column_index), *bloom_filter,
+                                    &hash) ||
+                   bloom_filter->FindHash(hash);
+          };
+          return !ApplyValueFilters(predicate, may_contain)
+                      ->IsSatisfiableWith(*scalar(true));
+        });
+    row_groups.erase(end, row_groups.end());
+  } catch (const ::parquet::ParquetException& e) {
+    return Status::IOError("Could not read the parquet Bloom filters: ", e.what());
+  }
+  return row_groups;
+}
+
+// The PLAIN encoding of a value as it was written to a column chunk of the
+// type of |descr|, without the length prefix of byte arrays, or false if the
+// values of its type may have been converted on write
+static bool PlainEncodedValue(const Scalar& value, const parquet::ColumnDescriptor& descr,
+                              std::string* out) {
+  int64_t integer;
+  switch (value.type->id()) {
+    case Type::INT8:
+      integer = IntegerValue<Int8Scalar>(value);
+      break;
+    case Type::INT16:
+      integer = IntegerValue<Int16Scalar>(value);
+      break;
+    case Type::INT32:
+      integer = IntegerValue<Int32Scalar>(value);
+      break;
+    case Type::INT64:
+      integer = IntegerValue<Int64Scalar>(value);
+      break;
+    case Type::UINT8:
+      integer = IntegerValue<UInt8Scalar>(value);
+      break;
+    case Type::UINT16:
+      integer = IntegerValue<UInt16Scalar>(value);
+      break;
+    case Type::UINT32:
+      integer = IntegerValue<UInt32Scalar>(value);
+      break;
+    case Type::UINT64:
+      integer = IntegerValue<UInt64Scalar>(value);
+      break;
+    case Type::DATE32:
+      integer = IntegerValue<Date32Scalar>(value);
+      break;
+    case Type::STRING:
+    case Type::BINARY:
+    case Type::FIXED_SIZE_BINARY: {
+      const auto& buffer = *checked_cast<const BaseBinaryScalar&>(value).value;
+      if (descr.physical_type() != (value.type->id() == Type::FIXED_SIZE_BINARY
+                                        ? parquet::Type::FIXED_LEN_BYTE_ARRAY
+                                        : parquet::Type::BYTE_ARRAY)) {
+        return false;
+      }
+      *out = buffer.ToString();
+      return true;
+    }
+    default:
+      return false;
+  }
+  switch (descr.physical_type()) {
+    case parquet::Type::INT32: {
+      const auto value32 = static_cast<int32_t>(integer);
+      out->assign(reinterpret_cast<const char*>(&value32), sizeof(value32));
+      return true;
+    }
+    case parquet::Type::INT64:
+      out->assign(reinterpret_cast<const char*>(&integer), sizeof(integer));
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Whether all the data pages of a column chunk are dictionary encoded, so
+// that its dictionary holds every value of the column chunk
+static bool IsFullyDictionaryEncoded(const parquet::ColumnChunkMetaData& metadata) {
+  if (!metadata.has_dictionary_page()) {
+    return false;
+  }
+  auto is_dictionary_encoding = [](parquet::Encoding::type encoding) {
+    return encoding == parquet::Encoding::PLAIN_DICTIONARY ||
+           encoding == parquet::Encoding::RLE_DICTIONARY;
+  };
+  const auto& encoding_stats = metadata.encoding_stats();
+  if (!encoding_stats.empty()) {
+    for (const auto& stats : encoding_stats) {
+      if ((stats.page_type == parquet::PageType::DATA_PAGE ||
+           stats.page_type == parquet::PageType::DATA_PAGE_V2) &&
+          stats.count > 0 && !is_dictionary_encoding(stats.encoding)) {
+        return false;
+      }
+    }
+    return true;
+  }
+  // Without the encoding statistics, a PLAIN encoding may be that of the
+  // dictionary page or of data pages written after a fallback, so only
+  // trust the dictionary when there is none.
+  for (auto encoding : metadata.encodings()) {
+    if (!is_dictionary_encoding(encoding) && encoding != parquet::Encoding::RLE &&
+        encoding != parquet::Encoding::BIT_PACKED) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename T>
+static std::string DictionaryValue(const T& value, const parquet::ColumnDescriptor&) {
+  return std::string(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+static std::string DictionaryValue(const parquet::ByteArray& value,
+                                   const parquet::ColumnDescriptor&) {
+  return std::string(reinterpret_cast<const char*>(value.ptr), value.len);
+}
+
+static std::string DictionaryValue(const parquet::FLBA& value,
+                                   const parquet::ColumnDescriptor& descr) {
+  return std::string(reinterpret_cast<const char*>(value.ptr), descr.type_length());
+}
+
+template <typename DType>
+static void DecodeDictionaryPage(const parquet::DictionaryPage& page,
+                                 const parquet::ColumnDescriptor& descr,
+                                 std::unordered_set<std::string>* out) {
+  auto decoder = parquet::MakeTypedDecoder<DType>(parquet::Encoding::PLAIN, &descr);
+  decoder->SetData(page.num_values(), page.data(), static_cast<int>(page.size()));
+  std::vector<typename DType::c_type> values(page.num_values());
+  const int num_values = decoder->Decode(values.data(), page.num_values());
+  for (int i = 0; i < num_values; ++i) {
+    out->insert(DictionaryValue(values[i], descr));
+  }
+}
+
+// The PLAIN encoded values of the dictionary of a column chunk, or null if it
+// may hold values which aren't in its dictionary
+static std::unique_ptr<std::unordered_set<std::string>> ReadDictionaryValues(
+    const parquet::ColumnChunkMetaData& metadata, const parquet::ColumnDescriptor& descr,
+    parquet::PageReader* pages) {
+  if (!IsFullyDictionaryEncoded(metadata)) {
+    return nullptr;
+  }
+  auto page = pages->NextPage();
+  if (page == nullptr || page->type() != parquet::PageType::DICTIONARY_PAGE) {
+    return nullptr;
+  }
+  const auto& dictionary_page = checked_cast<const parquet::DictionaryPage&>(*page);
+  auto values = internal::make_unique<std::unordered_set<std::string>>();
+  switch (descr.physical_type()) {
+    case parquet::Type::INT32:
+      DecodeDictionaryPage<parquet::Int32Type>(dictionary_page, descr, values.get());
+      break;
+    case parquet::Type::INT64:
+      DecodeDictionaryPage<parquet::Int64Type>(dictionary_page, descr, values.get());
+      break;
+    case parquet::Type::BYTE_ARRAY:
+      DecodeDictionaryPage<parquet::ByteArrayType>(dictionary_page, descr, values.get());
+      break;
+    case parquet::Type::FIXED_LEN_BYTE_ARRAY:
+      DecodeDictionaryPage<parquet::FLBAType>(dictionary_page, descr, values.get());
+      break;
+    default:
+      return nullptr;
+  }
+  return values;
+}
+
+// Remove the row groups whose dictionary encoded column chunks hold no value
+// that the predicate compares them to for equality or membership, so that no
+// row satisfies it. Only the dictionary pages of such columns are read.
+static Result<std::vector<RowGroupInfo>> FilterRowGroupsByDictionary(
+    const Expression& predicate, parquet::arrow::FileReader* reader,
+    std::vector<RowGroupInfo> row_groups) {
+  const auto field_names = FieldsInExpression(predicate);
+  std::unordered_map<std::string, const SchemaField*> fields;
+  for (const auto& schema_field : reader->manifest().schema_fields) {
+    // As with the column chunk statistics, only leaf (primitive) types are supported.
+    if (schema_field.is_leaf() &&
+        std::find(field_names.begin(), field_names.end(),
+                  schema_field.field->name()) != field_names.end()) {
+      fields.emplace(schema_field.field->name(), &schema_field);
+    }
+  }
+  if (fields.empty()) {
+    return row_groups;
+  }
+
+  try {
+    auto parquet_reader = reader->parquet_reader();
+    auto metadata = parquet_reader->metadata();
+    const auto& schema = *metadata->schema();
+    auto end = std::remove_if(
+        row_groups.begin(), row_groups.end(), [&](const RowGroupInfo& info) {
+          auto row_group_metadata = metadata->RowGroup(info.id());
+          auto row_group_reader = parquet_reader->RowGroup(info.id());
+          // The dictionary values read for this row group, null for none
+          std::unordered_map<int, std::unique_ptr<std::unordered_set<std::string>>>
+              dictionaries;
+          auto may_contain = [&](const std::string& name, const Scalar& value) {
+            auto it = fields.find(name);
+            if (it == fields.end() || !value.type->Equals(*it->second->field->type())) {
+              return true;
+            }
+            const int column_index = it->second->column_index;
+            const auto& descr = *schema.Column(column_index);
+            auto dictionary_it = dictionaries.find(column_index);
+            if (dictionary_it == dictionaries.end()) {
+              auto pages = row_group_reader->GetColumnPageReader(column_index);
+              dictionary_it =
+                  dictionaries
+                      .emplace(column_index,
+                               ReadDictionaryValues(
+                                   *row_group_metadata->ColumnChunk(column_index), descr,
+                                   pages.get()))
+                      .first;
+            }
+            const auto& dictionary = dictionary_it->second;
+            std::string encoded;
+            return dictionary == nullptr || !PlainEncodedValue(value, descr, &encoded) ||
+                   dictionary->count(encoded) > 0;
+          };
+          return !ApplyValueFilters(predicate, may_contain)
+                      ->IsSatisfiableWith(*scalar(true));
+        });
+    row_groups.erase(end, row_groups.end());
+  } catch (const ::parquet::ParquetException& e) {
+    return Status::IOError("Could not read the parquet dictionary pages: ", e.what());
+  }
+  return row_groups;
+}
+
 class ParquetScanTaskIterator {
  public:
-  static Result<ScanTaskIterator> Make(std::shared_ptr<ScanOptions> options,
-                                       std::shared_ptr<ScanContext> context,
-                                       FileSource source,
-                                       std::unique_ptr<parquet::arrow::FileReader> reader,
-                                       std::vector<RowGroupInfo> row_groups) {
+  static Result<ScanTaskIterator> Make(
+      std::shared_ptr<ScanOptions> options, std::shared_ptr<ScanContext> context,
+      FileSource source, std::unique_ptr<parquet::arrow::FileReader> reader,
+      std::vector<RowGroupInfo> row_groups,
+      const ParquetFileFormat::ReaderOptions& reader_options,
+      std::shared_ptr<Expression> filter) {
     auto column_projection = InferColumnProjection(*reader, *options);
+    std::vector<int> predicate_columns, other_columns;
+    if (filter != nullptr) {
+      SplitColumnProjection(*reader, *options, *filter, &predicate_columns,
+                            &other_columns);
+      if (predicate_columns.empty() || other_columns.empty()) {
+        filter = nullptr;
+      }
+    }
+
+    if (reader_options.pre_buffer) {
+      // Start fetching the column chunks of all the row groups to scan
+      std::vector<int> row_group_ids;
+      for (const auto& row_group : row_groups) {
+        row_group_ids.push_back(row_group.id());
+      }
+      try {
+        reader->parquet_reader()->PreBuffer(row_group_ids, column_projection,
+                                            context->io_context,
+                                            reader_options.cache_options);
+      } catch (const ::parquet::ParquetException& e) {
+        return Status::IOError("Could not pre-buffer parquet input source '",
+                               source.path(), "': ", e.what());
+      }
+    }
     return static_cast<ScanTaskIterator>(ParquetScanTaskIterator(
         std::move(options), std::move(context), std::move(source), std::move(reader),
-        std::move(column_projection), std::move(row_groups)));
+        std::move(column_projection), std::move(row_groups), std::move(filter),
+        std::move(predicate_columns), std::move(other_columns)));
   }
 
   Result<std::shared_ptr<ScanTask>> Next() {
@@ -208,11 +851,38 @@ class ParquetScanTaskIterator {
     }
 
     auto row_group = row_groups_[idx_++];
+    if (filter_ != nullptr) {
+      return std::shared_ptr<ScanTask>(
+          new ParquetScanTask(row_group, column_projection_, filter_, predicate_columns_,
+                              other_columns_, reader_, options_, context_));
+    }
     return std::shared_ptr<ScanTask>(
         new ParquetScanTask(row_group, column_projection_, reader_, options_, context_));
   }
 
  private:
+  // Split the column projection between the columns the filter references and
+  // the others
+  static void SplitColumnProjection(const parquet::arrow::FileReader& reader,
+                                    const ScanOptions& options, const Expression& filter,
+                                    std::vector<int>* predicate_columns,
+                                    std::vector<int>* other_columns) {
+    auto field_names = options.MaterializedFields();
+    std::unordered_set<std::string> materialized_fields{field_names.cbegin(),
+                                                        field_names.cend()};
+    auto filter_field_names = FieldsInExpression(filter);
+    std::unordered_set<std::string> filter_fields{filter_field_names.cbegin(),
+                                                  filter_field_names.cend()};
+    for (const auto& schema_field : reader.manifest().schema_fields) {
+      const auto& name = schema_field.field->name();
+      if (filter_fields.find(name) != filter_fields.end()) {
+        AddColumnIndices(schema_field, predicate_columns);
+      } else if (materialized_fields.find(name) != materialized_fields.end()) {
+        AddColumnIndices(schema_field, other_columns);
+      }
+    }
+  }
+
   // Compute the column projection out of an optional arrow::Schema
   static std::vector<int> InferColumnProjection(const parquet::arrow::FileReader& reader,
                                                 const ScanOptions& options) {
@@ -256,13 +926,19 @@ class ParquetScanTaskIterator {
                           std::shared_ptr<ScanContext> context, FileSource source,
                           std::unique_ptr<parquet::arrow::FileReader> reader,
                           std::vector<int> column_projection,
-                          std::vector<RowGroupInfo> row_groups)
+                          std::vector<RowGroupInfo> row_groups,
+                          std::shared_ptr<Expression> filter,
+                          std::vector<int> predicate_columns,
+                          std::vector<int> other_columns)
       : options_(std::move(options)),
         context_(std::move(context)),
         source_(std::move(source)),
         reader_(std::move(reader)),
         column_projection_(std::move(column_projection)),
-        row_groups_(std::move(row_groups)) {}
+        row_groups_(std::move(row_groups)),
+        filter_(std::move(filter)),
+        predicate_columns_(std::move(predicate_columns)),
+        other_columns_(std::move(other_columns)) {}
 
   std::shared_ptr<ScanOptions> options_;
   std::shared_ptr<ScanContext> context_;
@@ -273,6 +949,11 @@ class ParquetScanTaskIterator {
   std::vector<int> column_projection_;
   std::vector<RowGroupInfo> row_groups_;
 
+  // Only set for late materialization
+  std::shared_ptr<Expression> filter_;
+  std::vector<int> predicate_columns_;
+  std::vector<int> other_columns_;
+
   // row group index.
   size_t idx_ = 0;
 };
@@ -307,11 +988,72 @@ Result<bool> ParquetFileFormat::IsSupported(const FileSource& source) const {
   return true;
 }
 
+namespace {
+
+// The footer of a Parquet file, and the schema decoded from it if the file was
+// inspected
+class ParquetMetadataEntry : public FileMetadataCache::Entry {
+ public:
+  explicit ParquetMetadataEntry(std::shared_ptr<parquet::FileMetaData> metadata,
+                                std::shared_ptr<Schema> schema = NULLPTR,
+                                std::unordered_set<std::string> dict_columns = {})
+      : metadata_(std::move(metadata)),
+        schema_(std::move(schema)),
+        dict_columns_(std::move(dict_columns)) {}
+
+  const std::shared_ptr<parquet::FileMetaData>& metadata() const { return metadata_; }
+
+  // The decoded schema depends on which columns are read as dictionaries
+  std::shared_ptr<Schema> schema(
+      const std::unordered_set<std::string>& dict_columns) const {
+    return dict_columns == dict_columns_ ? schema_ : NULLPTR;
+  }
+
+ private:
+  std::shared_ptr<parquet::FileMetaData> metadata_;
+  std::shared_ptr<Schema> schema_;
+  std::unordered_set<std::string> dict_columns_;
+};
+
+// Metadata can only be cached for files identified by a filesystem and path.
+// When the file is encrypted, the footer must be decrypted again on opening.
+bool CanCacheMetadata(const ParquetFileFormat& format,
+                      const std::shared_ptr<FileMetadataCache>& cache,
+                      const FileSource& source) {
+  return cache != nullptr && source.filesystem() != nullptr &&
+         format.reader_options.file_decryption_properties == nullptr;
+}
+
+}  // namespace
+
 Result<std::shared_ptr<Schema>> ParquetFileFormat::Inspect(
     const FileSource& source) const {
-  ARROW_ASSIGN_OR_RAISE(auto reader, GetReader(source));
+  auto cache = GetMetadataCache();
+  if (!CanCacheMetadata(*this, cache, source)) {
+    ARROW_ASSIGN_OR_RAISE(auto reader, GetReader(source));
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(reader->GetSchema(&schema));
+    return schema;
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto info, cache->GetFileInfo(source));
+  auto entry = std::static_pointer_cast<ParquetMetadataEntry>(
+      cache->GetMetadata(*this, *source.filesystem(), info));
+  if (entry != nullptr) {
+    auto schema = entry->schema(reader_options.dict_columns);
+    if (schema != nullptr) {
+      return schema;
+    }
+  }
+
+  FileSource info_source(info, source.filesystem(), source.compression());
+  ARROW_ASSIGN_OR_RAISE(auto reader, GetReader(info_source));
   std::shared_ptr<Schema> schema;
   RETURN_NOT_OK(reader->GetSchema(&schema));
+  cache->PutMetadata(*this, *source.filesystem(), info,
+                     std::make_shared<ParquetMetadataEntry>(
+                         reader->parquet_reader()->metadata(), schema,
+                         reader_options.dict_columns));
   return schema;
 }
 
@@ -319,7 +1061,24 @@ Result<std::unique_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
     const FileSource& source, ScanOptions* options, ScanContext* context) const {
   MemoryPool* pool = context ? context->pool : default_memory_pool();
   auto properties = MakeReaderProperties(*this, pool);
-  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, std::move(properties)));
+
+  std::unique_ptr<parquet::ParquetFileReader> reader;
+  auto cache = GetMetadataCache(context);
+  if (CanCacheMetadata(*this, cache, source)) {
+    // Reuse the file info and footer of previous reads of the same file
+    ARROW_ASSIGN_OR_RAISE(auto info, cache->GetFileInfo(source));
+    auto entry = std::static_pointer_cast<ParquetMetadataEntry>(
+        cache->GetMetadata(*this, *source.filesystem(), info));
+    FileSource info_source(info, source.filesystem(), source.compression());
+    ARROW_ASSIGN_OR_RAISE(reader, OpenReader(info_source, std::move(properties),
+                                             entry ? entry->metadata() : NULLPTR));
+    if (entry == nullptr) {
+      cache->PutMetadata(*this, *source.filesystem(), info,
+                         std::make_shared<ParquetMetadataEntry>(reader->metadata()));
+    }
+  } else {
+    ARROW_ASSIGN_OR_RAISE(reader, OpenReader(source, std::move(properties)));
+  }
 
   std::shared_ptr<parquet::FileMetaData> metadata = reader->metadata();
   auto arrow_properties = MakeArrowReaderProperties(*this, *metadata);
@@ -362,6 +1121,100 @@ Status ParquetFileFormat::WriteFragment(RecordBatchReader* batches,
   return writer->Close();
 }
 
+namespace {
+
+class ParquetFragmentWriter : public FileWriter {
+ public:
+  ParquetFragmentWriter(std::shared_ptr<io::OutputStream> destination,
+                        std::unique_ptr<parquet::arrow::FileWriter> writer,
+                        std::shared_ptr<Schema> schema)
+      : FileWriter(std::move(schema)),
+        destination_(std::move(destination)),
+        writer_(std::move(writer)) {}
+
+  Status Write(const std::shared_ptr<RecordBatch>& batch) override {
+    ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches(batch->schema(), {batch}));
+    return writer_->WriteTable(*table, batch->num_rows());
+  }
+
+  Status Finish() override {
+    RETURN_NOT_OK(writer_->Close());
+    return destination_->Close();
+  }
+
+  // Only available once the writer is finished
+  std::shared_ptr<parquet::FileMetaData> metadata() const { return writer_->metadata(); }
+
+ private:
+  std::shared_ptr<io::OutputStream> destination_;
+  std::unique_ptr<parquet::arrow::FileWriter> writer_;
+};
+
+Status WriteSummaryFile(const parquet::FileMetaData& metadata,
+                        fs::FileSystem* filesystem, const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto destination, filesystem->OpenOutputStream(path));
+  RETURN_NOT_OK(parquet::arrow::WriteMetaDataFile(metadata, destination.get()));
+  return destination->Close();
+}
+
+}  // namespace
+
+Result<std::shared_ptr<FileWriter>> ParquetFileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination,
+    std::shared_ptr<Schema> schema) const {
+  std::unique_ptr<parquet::arrow::FileWriter> writer;
+  RETURN_NOT_OK(parquet::arrow::FileWriter::Open(*schema, default_memory_pool(),
+                                                 destination, writer_properties,
+                                                 arrow_writer_properties, &writer));
+  return std::make_shared<ParquetFragmentWriter>(std::move(destination),
+                                                 std::move(writer), std::move(schema));
+}
+
+Status ParquetFileFormat::WriteMetadata(const std::vector<WrittenFile>& files,
+                                        fs::FileSystem* filesystem,
+                                        const std::string& base_dir) const {
+  if (files.empty()) {
+    return Status::OK();
+  }
+
+  // Files are finished in no particular order, sort them to make the summary
+  // deterministic
+  std::vector<const WrittenFile*> sorted_files;
+  for (const auto& file : files) {
+    sorted_files.push_back(&file);
+  }
+  std::sort(sorted_files.begin(), sorted_files.end(),
+            [](const WrittenFile* l, const WrittenFile* r) { return l->path < r->path; });
+
+  std::shared_ptr<parquet::FileMetaData> metadata;
+  std::shared_ptr<parquet::FileMetaData> common_metadata;
+  try {
+    for (const WrittenFile* file : sorted_files) {
+      auto file_metadata =
+          checked_cast<const ParquetFragmentWriter&>(*file->writer).metadata();
+      file_metadata->set_file_path(file->path);
+      if (metadata == nullptr) {
+        metadata = std::move(file_metadata);
+      } else {
+        metadata->AppendRowGroups(*file_metadata);
+      }
+    }
+
+    common_metadata =
+        parquet::FileMetaDataBuilder::Make(metadata->schema(), writer_properties,
+                                           metadata->key_value_metadata())
+            ->Finish();
+  } catch (const ::parquet::ParquetException& e) {
+    return Status::Invalid("Could not gather the metadata of written files: ", e.what());
+  }
+
+  RETURN_NOT_OK(WriteSummaryFile(*common_metadata, filesystem,
+                                 fs::internal::ConcatAbstractPath(base_dir,
+                                                                  "_common_metadata")));
+  return WriteSummaryFile(*metadata, filesystem,
+                          fs::internal::ConcatAbstractPath(base_dir, "_metadata"));
+}
+
 Result<ScanTaskIterator> ParquetFileFormat::ScanFile(std::shared_ptr<ScanOptions> options,
                                                      std::shared_ptr<ScanContext> context,
                                                      FileFragment* fragment) const {
@@ -394,9 +1247,43 @@ Result<ScanTaskIterator> ParquetFileFormat::ScanFile(std::shared_ptr<ScanOptions
     }
   }
 
+  if (reader_options.use_bloom_filter) {
+    ARROW_ASSIGN_OR_RAISE(row_groups,
+                          FilterRowGroupsByBloomFilter(*options->filter, reader.get(),
+                                                       std::move(row_groups)));
+    if (row_groups.empty()) {
+      return MakeEmptyIterator<std::shared_ptr<ScanTask>>();
+    }
+  }
+
+  if (reader_options.use_dictionary_filter) {
+    ARROW_ASSIGN_OR_RAISE(row_groups,
+                          FilterRowGroupsByDictionary(*options->filter, reader.get(),
+                                                      std::move(row_groups)));
+    if (row_groups.empty()) {
+      return MakeEmptyIterator<std::shared_ptr<ScanTask>>();
+    }
+  }
+
+  if (reader_options.use_page_index) {
+    ARROW_ASSIGN_OR_RAISE(row_groups,
+                          FilterRowGroupsByPageIndex(*options->filter, reader.get(),
+                                                     std::move(row_groups)));
+    if (row_groups.empty()) {
+      return MakeEmptyIterator<std::shared_ptr<ScanTask>>();
+    }
+  }
+
+  std::shared_ptr<Expression> late_materialization_filter;
+  if (reader_options.use_late_materialization) {
+    late_materialization_filter =
+        options->filter->Assume(*fragment->partition_expression());
+  }
+
   return ParquetScanTaskIterator::Make(std::move(options), std::move(context),
                                        fragment->source(), std::move(reader),
-                                       std::move(row_groups));
+                                       std::move(row_groups), reader_options,
+                                       std::move(late_materialization_filter));
 }
 
 Result<std::shared_ptr<FileFragment>> ParquetFileFormat::MakeFragment(
@@ -542,6 +1429,64 @@ Status ParquetFileFragment::EnsureCompleteMetadata(parquet::arrow::FileReader* r
   return Status::OK();
 }
 
+int64_t ParquetFileFragment::CountRowsFromMetadata() {
+  auto lock = physical_schema_mutex_.Lock();
+  if (!HasCompleteMetadata()) {
+    return -1;
+  }
+  int64_t num_rows = 0;
+  for (const RowGroupInfo& info : row_groups_) {
+    if (info.num_rows() < 0) {
+      return -1;
+    }
+    num_rows += info.num_rows();
+  }
+  return num_rows;
+}
+
+Result<int64_t> ParquetFileFragment::CountRows(std::shared_ptr<Expression> predicate,
+                                              std::shared_ptr<ScanOptions> options,
+                                              std::shared_ptr<ScanContext> context) {
+  if (!predicate->IsSatisfiable()) {
+    return 0;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto reader, parquet_format_.GetReader(source_));
+  RETURN_NOT_OK(EnsureCompleteMetadata(reader.get()));
+  auto metadata = reader->parquet_reader()->metadata();
+  const auto field_names = FieldsInExpression(*predicate);
+
+  int64_t num_rows = 0;
+  std::vector<RowGroupInfo> to_scan;
+  for (const RowGroupInfo& info : row_groups_) {
+    auto simplified = predicate;
+    if (info.HasStatistics()) {
+      simplified = predicate->Assume(info.statistics_expression());
+    }
+    if (!simplified->IsSatisfiable()) {
+      continue;
+    }
+    // The statistics expression says nothing of nulls, which don't satisfy
+    // a comparison
+    if (simplified->Equals(true) &&
+        HasNoNulls(*metadata->RowGroup(info.id()), reader->manifest(), field_names)) {
+      num_rows += info.num_rows();
+      continue;
+    }
+    to_scan.push_back(info);
+  }
+  if (to_scan.empty()) {
+    return num_rows;
+  }
+
+  ARROW_ASSIGN_OR_RAISE(
+      auto fragment, parquet_format_.MakeFragment(source_, partition_expression(),
+                                                  std::move(to_scan), physical_schema_));
+  ARROW_ASSIGN_OR_RAISE(auto scanned_rows,
+                        checked_cast<ParquetFileFragment&>(*fragment).ScanCountRows(
+                            predicate, std::move(options), std::move(context)));
+  return num_rows + scanned_rows;
+}
+
 Result<FragmentVector> ParquetFileFragment::SplitByRowGroup(
     const std::shared_ptr<Expression>& predicate) {
   RETURN_NOT_OK(EnsureCompleteMetadata());
@@ -697,6 +1642,27 @@ Result<std::shared_ptr<Schema>> GetSchema(
   return schema;
 }
 
+// Call func(i) for i in [0, num_tasks), in parallel blocks of indices when
+// use_threads is set.
+template <typename Func>
+static Status ParallelForBlocks(bool use_threads, int num_tasks, Func&& func) {
+  constexpr int kBlockSize = 256;
+  const int num_blocks = (num_tasks + kBlockSize - 1) / kBlockSize;
+  return ::arrow::internal::OptionalParallelFor(
+      use_threads && num_blocks > 1, num_blocks, [&](int block) -> Status {
+        const int end = std::min(num_tasks, (block + 1) * kBlockSize);
+        try {
+          for (int i = block * kBlockSize; i < end; ++i) {
+            RETURN_NOT_OK(func(i));
+          }
+        } catch (const ::parquet::ParquetException& e) {
+          return Status::Invalid("Could not infer file paths from FileMetaData:",
+                                 e.what());
+        }
+        return Status::OK();
+      });
+}
+
 Result<std::vector<std::shared_ptr<FileFragment>>>
 ParquetDatasetFactory::CollectParquetFragments(
     const parquet::FileMetaData& metadata,
@@ -708,41 +1674,60 @@ ParquetDatasetFactory::CollectParquetFragments(
           "ParquetDatasetFactory must contain a schema with at least one column");
     }
 
-    std::unordered_map<std::string, std::vector<RowGroupInfo>> path_to_row_group_infos;
     ARROW_ASSIGN_OR_RAISE(auto manifest, GetSchemaManifest(metadata, properties));
 
-    for (int i = 0; i < metadata.num_row_groups(); i++) {
-      std::shared_ptr<parquet::RowGroupMetaData> row_group = metadata.RowGroup(i);
-      ARROW_ASSIGN_OR_RAISE(auto path,
-                            FileFromRowGroup(filesystem_.get(), base_path_, *row_group));
-      std::shared_ptr<StructScalar> stats =
-          RowGroupStatisticsAsStructScalar(*row_group, manifest);
-
-      int64_t num_rows = row_group->num_rows();
-      int64_t total_byte_size = row_group->total_byte_size();
-
+    // Decode the paths and statistics of the row groups in parallel, this is
+    // where the bulk of the metadata is deserialized.
+    struct RowGroupEntry {
+      std::string path;
+      int64_t num_rows;
+      int64_t total_byte_size;
+      std::shared_ptr<StructScalar> stats;
+    };
+    const int num_row_groups = metadata.num_row_groups();
+    std::vector<RowGroupEntry> entries(num_row_groups);
+    RETURN_NOT_OK(ParallelForBlocks(
+        options_.use_threads, num_row_groups, [&](int i) -> Status {
+          std::shared_ptr<parquet::RowGroupMetaData> row_group = metadata.RowGroup(i);
+          ARROW_ASSIGN_OR_RAISE(
+              entries[i].path,
+              FileFromRowGroup(filesystem_.get(), base_path_, *row_group));
+          entries[i].num_rows = row_group->num_rows();
+          entries[i].total_byte_size = row_group->total_byte_size();
+          entries[i].stats = RowGroupStatisticsAsStructScalar(*row_group, manifest);
+          return Status::OK();
+        }));
+
+    using PathAndRowGroupInfos = std::pair<const std::string, std::vector<RowGroupInfo>>;
+    std::unordered_map<std::string, std::vector<RowGroupInfo>> path_to_row_group_infos;
+    std::vector<PathAndRowGroupInfos*> files;
+    for (auto& entry : entries) {
       // Insert the path, or increase the count of row groups. It will be assumed that the
       // RowGroup of a file are ordered exactly as in the metadata file.
-      auto path_and_row_groups =
-          path_to_row_group_infos.emplace(path, std::vector<RowGroupInfo>{}).first;
-      auto row_group_id = static_cast<int>(path_and_row_groups->second.size());
-      path_and_row_groups->second.emplace_back(row_group_id, num_rows, total_byte_size,
-                                               stats);
+      auto inserted =
+          path_to_row_group_infos.emplace(entry.path, std::vector<RowGroupInfo>{});
+      if (inserted.second) {
+        files.push_back(&*inserted.first);
+      }
+      auto& row_group_infos = inserted.first->second;
+      auto row_group_id = static_cast<int>(row_group_infos.size());
+      row_group_infos.emplace_back(row_group_id, entry.num_rows, entry.total_byte_size,
+                                   std::move(entry.stats));
     }
 
     ARROW_ASSIGN_OR_RAISE(auto physical_schema, GetSchema(metadata, properties));
-    std::vector<std::shared_ptr<FileFragment>> fragments;
-    fragments.reserve(path_to_row_group_infos.size());
-    for (auto&& elem : path_to_row_group_infos) {
-      const auto& path = elem.first;
-      auto partition =
-          partitioning.Parse(StripPrefixAndFilename(path, options_.partition_base_dir))
-              .ValueOr(scalar(true));
-      ARROW_ASSIGN_OR_RAISE(
-          auto fragment, format_->MakeFragment({path, filesystem_}, std::move(partition),
-                                               std::move(elem.second), physical_schema));
-      fragments.push_back(std::move(fragment));
-    }
+    std::vector<std::shared_ptr<FileFragment>> fragments(files.size());
+    RETURN_NOT_OK(ParallelForBlocks(
+        options_.use_threads, static_cast<int>(files.size()), [&](int i) -> Status {
+          const auto& path = files[i]->first;
+          auto stripped_path = StripPrefixAndFilename(path, options_.partition_base_dir);
+          auto partition = partitioning.Parse(stripped_path).ValueOr(scalar(true));
+          ARROW_ASSIGN_OR_RAISE(
+              fragments[i],
+              format_->MakeFragment({path, filesystem_}, std::move(partition),
+                                    std::move(files[i]->second), physical_schema));
+          return Status::OK();
+        }));
 
     return fragments;
   } catch (const ::parquet::ParquetException& e) {
@@ -30,6 +30,7 @@
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
+#include "arrow/io/caching.h"
 #include "arrow/util/optional.h"
 
 namespace parquet {
@@ -91,6 +92,55 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
     /// @{
     std::unordered_set<std::string> dict_columns;
     /// @}
+
+    /// Whether to read the page index (per-page statistics) of the files, when
+    /// they have one, to skip the row groups in which no page can satisfy the
+    /// filter although the statistics of their column chunks do.
+    ///
+    /// This costs a read of the page index of each scanned file.
+    bool use_page_index = false;
+
+    /// Whether to read the Bloom filters of the column chunks, when they have
+    /// one, to skip the row groups which can't hold a value that the filter
+    /// compares a column to for equality or membership.
+    ///
+    /// The Bloom filters are only read for such columns, one read per column
+    /// chunk of the row groups left by the statistics.
+    bool use_bloom_filter = false;
+
+    /// Whether to read the dictionary pages of the column chunks which are
+    /// entirely dictionary encoded, to skip the row groups which don't hold
+    /// a value that the filter compares a column to for equality or
+    /// membership.
+    ///
+    /// The dictionary pages are only read for such columns, one read per
+    /// column chunk of the row groups left by the statistics and the Bloom
+    /// filters.
+    bool use_dictionary_filter = false;
+
+    /// Whether to read the columns which the filter references first, then
+    /// only the rows of the other columns which satisfy it, skipping the
+    /// others without decoding them ("late materialization").
+    ///
+    /// Only applies to the scans whose filter references some but not all of
+    /// the columns to read; it pays off when the filter is selective.
+    bool use_late_materialization = false;
+
+    /// Whether to pre-buffer the column chunks of the row groups to scan when
+    /// the scan of a file starts. The column chunks are coalesced into larger
+    /// reads which are issued in the background on ScanContext::io_context,
+    /// so that the latency of high-latency file systems such as object
+    /// stores overlaps with decoding.
+    ///
+    /// Unless cache_options.buffer_limit is set, the pre-buffered column
+    /// chunks are kept in memory until the scan of the file ends.
+    bool pre_buffer = false;
+
+    /// How the column chunks are coalesced when pre_buffer is set. For object
+    /// stores, io::CacheOptions::MakeFromNetworkMetrics derives these limits
+    /// from the latency and bandwidth of the requests. A buffer_limit bounds
+    /// the memory held by the column chunks read ahead.
+    io::CacheOptions cache_options = io::CacheOptions::Defaults();
   } reader_options;
 
   std::shared_ptr<parquet::WriterProperties> writer_properties;
@@ -126,6 +176,18 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
 
   Status WriteFragment(RecordBatchReader* batches,
                        io::OutputStream* destination) const override;
+
+  Result<std::shared_ptr<FileWriter>> MakeWriter(
+      std::shared_ptr<io::OutputStream> destination,
+      std::shared_ptr<Schema> schema) const override;
+
+  /// \brief Write the `_metadata` and `_common_metadata` summary files.
+  ///
+  /// `_metadata` holds the schema and the row groups of every written file, with
+  /// column chunk paths relative to base_dir, and can be read back with
+  /// ParquetDatasetFactory.  `_common_metadata` only holds the schema.
+  Status WriteMetadata(const std::vector<WrittenFile>& files, fs::FileSystem* filesystem,
+                       const std::string& base_dir) const override;
 };
 
 /// \brief Represents a parquet's RowGroup with extra information.
@@ -171,6 +233,12 @@ class ARROW_DS_EXPORT RowGroupInfo : public util::EqualityComparable<RowGroupInf
   /// \brief Indicate if statistics are set.
   bool HasStatistics() const { return statistics_ != NULLPTR; }
 
+  /// \brief Return an expression which the rows of the RowGroup are guaranteed
+  /// to satisfy if they're not null, or null if statistics are not set.
+  const std::shared_ptr<Expression>& statistics_expression() const {
+    return statistics_expression_;
+  }
+
   /// \brief Indicate if the RowGroup's statistics satisfy the predicate.
   ///
   /// This will return true if the RowGroup was not initialized with statistics
@@ -217,6 +285,18 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
   /// is not empty / and all RowGroup return true on `RowGroup::HasStatistics()`.
   bool HasCompleteMetadata() const { return has_complete_metadata_; }
 
+  /// \brief Return the number of rows of the selected RowGroups, or -1 if the
+  /// metadata isn't complete yet.
+  int64_t CountRowsFromMetadata() override;
+
+  /// \brief Count the rows satisfying a predicate, from the RowGroups' metadata
+  /// where their statistics are conclusive.
+  ///
+  /// The RowGroups whose statistics are inconclusive are scanned.
+  Result<int64_t> CountRows(std::shared_ptr<Expression> predicate,
+                            std::shared_ptr<ScanOptions> options,
+                            std::shared_ptr<ScanContext> context) override;
+
   /// \brief Ensure attached statistics are complete and the physical schema is cached.
   Status EnsureCompleteMetadata(parquet::arrow::FileReader* reader = NULLPTR);
 
@@ -268,6 +348,9 @@ struct ParquetFactoryOptions {
   // This is useful for partitioning which parses directory when ordering
   // is important, e.g. DirectoryPartitioning.
   std::string partition_base_dir;
+
+  // Build the fragments from the row groups of the metadata file in parallel.
+  bool use_threads = true;
 };
 
 /// \brief Create FileSystemDataset from custom `_metadata` cache file.
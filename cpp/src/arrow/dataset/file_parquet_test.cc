@@ -24,6 +24,7 @@
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/test_util.h"
+#include "arrow/io/memory.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
@@ -31,6 +32,7 @@
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/range.h"
+#include "arrow/util/thread_pool.h"
 #include "parquet/arrow/writer.h"
 #include "parquet/metadata.h"
 
@@ -48,7 +50,7 @@ using parquet::default_writer_properties;
 using parquet::WriterProperties;
 
 using parquet::CreateOutputStream;
-using parquet::arrow::FileWriter;
+using ParquetFileWriter = parquet::arrow::FileWriter;
 using parquet::arrow::WriteTable;
 
 using testing::Pointee;
@@ -57,7 +59,7 @@ using internal::checked_pointer_cast;
 
 class ArrowParquetWriterMixin : public ::testing::Test {
  public:
-  Status WriteRecordBatch(const RecordBatch& batch, FileWriter* writer) {
+  Status WriteRecordBatch(const RecordBatch& batch, ParquetFileWriter* writer) {
     auto schema = batch.schema();
     auto size = batch.num_rows();
 
@@ -75,7 +77,7 @@ class ArrowParquetWriterMixin : public ::testing::Test {
     return Status::OK();
   }
 
-  Status WriteRecordBatchReader(RecordBatchReader* reader, FileWriter* writer) {
+  Status WriteRecordBatchReader(RecordBatchReader* reader, ParquetFileWriter* writer) {
     auto schema = reader->schema();
 
     if (!schema->Equals(*writer->schema(), false)) {
@@ -96,9 +98,9 @@ class ArrowParquetWriterMixin : public ::testing::Test {
       const std::shared_ptr<WriterProperties>& properties = default_writer_properties(),
       const std::shared_ptr<ArrowWriterProperties>& arrow_properties =
           default_arrow_writer_properties()) {
-    std::unique_ptr<FileWriter> writer;
-    RETURN_NOT_OK(FileWriter::Open(*reader->schema(), pool, sink, properties,
-                                   arrow_properties, &writer));
+    std::unique_ptr<ParquetFileWriter> writer;
+    RETURN_NOT_OK(ParquetFileWriter::Open(*reader->schema(), pool, sink, properties,
+                                          arrow_properties, &writer));
     RETURN_NOT_OK(WriteRecordBatchReader(reader, writer.get()));
     return writer->Close();
   }
@@ -130,6 +132,36 @@ class ArrowParquetWriterMixin : public ::testing::Test {
   }
 };
 
+// A file in memory whose asynchronous reads are queued on the I/O executor, as
+// with most filesystems, unlike those of a BufferReader
+class ExecutorReadFile : public io::RandomAccessFile {
+ public:
+  explicit ExecutorReadFile(std::shared_ptr<Buffer> buffer)
+      : reader_(std::make_shared<io::BufferReader>(std::move(buffer))) {}
+
+  Status Close() override { return reader_->Close(); }
+  bool closed() const override { return reader_->closed(); }
+  Result<int64_t> Tell() const override { return reader_->Tell(); }
+  Status Seek(int64_t position) override { return reader_->Seek(position); }
+  Result<int64_t> GetSize() override { return reader_->GetSize(); }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    return reader_->Read(nbytes, out);
+  }
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    return reader_->Read(nbytes);
+  }
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    return reader_->ReadAt(position, nbytes, out);
+  }
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    return reader_->ReadAt(position, nbytes);
+  }
+
+ private:
+  std::shared_ptr<io::BufferReader> reader_;
+};
+
 class TestParquetFileFormat : public ArrowParquetWriterMixin {
  public:
   std::unique_ptr<FileSource> GetFileSource(RecordBatchReader* reader) {
@@ -367,6 +399,60 @@ TEST_F(TestParquetFileFormat, InspectDictEncoded) {
   AssertSchemaEqual(*actual, expected_schema, /* check_metadata = */ false);
 }
 
+TEST_F(TestParquetFileFormat, MetadataCache) {
+  auto reader = GetRecordBatchReader();
+  auto buffer = Write(reader.get());
+  // Metadata is only cached for files with a known modification time
+  const fs::TimePoint mtime(std::chrono::hours(1));
+  auto mock_fs = std::make_shared<fs::internal::MockFileSystem>(mtime);
+  ASSERT_OK(mock_fs->CreateFile("data.parquet", buffer->ToString()));
+  FileSource source("data.parquet", mock_fs);
+
+  auto CountRows = [this](Fragment* fragment) {
+    int64_t row_count = 0;
+    for (auto maybe_batch : Batches(fragment)) {
+      EXPECT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+      row_count += batch->num_rows();
+    }
+    return row_count;
+  };
+
+  // Caching through the format
+  auto format_cache = std::make_shared<FileMetadataCache>(16);
+  format_->metadata_cache = format_cache;
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto actual, format_->Inspect(source));
+    AssertSchemaEqual(*actual, *schema_, /*check_metadata=*/false);
+    ASSERT_EQ(format_cache->num_entries(), 1);
+  }
+
+  opts_ = ScanOptions::Make(reader->schema());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source));
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_EQ(CountRows(fragment.get()), kNumRows);
+  }
+  ASSERT_EQ(format_cache->num_entries(), 1);
+
+  // The scan context's cache takes precedence
+  auto context_cache = std::make_shared<FileMetadataCache>(16);
+  ctx_->metadata_cache = context_cache;
+  ASSERT_OK_AND_ASSIGN(fragment, format_->MakeFragment(source));
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_EQ(CountRows(fragment.get()), kNumRows);
+  }
+  ASSERT_EQ(context_cache->num_entries(), 1);
+
+  // File infos are cached by path: a rewritten file is only read again after
+  // clearing the cache
+  schema_ = schema({field("i32", int32())});
+  reader = GetRecordBatchReader();
+  buffer = Write(reader.get());
+  ASSERT_OK(mock_fs->CreateFile("data.parquet", buffer->ToString()));
+  format_cache->Clear();
+  ASSERT_OK_AND_ASSIGN(auto actual, format_->Inspect(source));
+  AssertSchemaEqual(*actual, *schema_, /*check_metadata=*/false);
+}
+
 TEST_F(TestParquetFileFormat, IsSupported) {
   auto reader = GetRecordBatchReader();
   auto source = GetFileSource(reader.get());
@@ -437,6 +523,227 @@ TEST_F(TestParquetFileFormat, PredicatePushdown) {
                             kNumRowGroups - 5);
 }
 
+TEST_F(TestParquetFileFormat, CountRows) {
+  constexpr int64_t kNumRowGroups = 16;
+  constexpr int64_t kTotalNumRows = kNumRowGroups * (kNumRowGroups + 1) / 2;
+
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups);
+  auto source = GetFileSource(reader.get());
+  opts_ = ScanOptions::Make(reader->schema());
+  auto evaluator = std::make_shared<CountingEvaluator>();
+  opts_->evaluator = evaluator;
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  // Conclusive statistics, nothing is scanned
+  ASSERT_OK_AND_EQ(kTotalNumRows, fragment->CountRows(scalar(true), opts_, ctx_));
+  ASSERT_OK_AND_EQ(5 * (5 + 1) / 2,
+                   fragment->CountRows(("i64"_ < int64_t(6)).Copy(), opts_, ctx_));
+  ASSERT_OK_AND_EQ(kTotalNumRows - 1,
+                   fragment->CountRows(("u8"_ > uint8_t(1)).Copy(), opts_, ctx_));
+  ASSERT_OK_AND_EQ(0, fragment->CountRows(("i64"_ > int64_t(100)).Copy(), opts_, ctx_));
+  ASSERT_EQ(0, evaluator->num_evaluations);
+
+  // Inconclusive statistics, the row groups are scanned
+  ASSERT_OK_AND_EQ(kTotalNumRows,
+                   fragment->CountRows("i64"_.IsValid().Copy(), opts_, ctx_));
+  ASSERT_EQ(kNumRowGroups, evaluator->num_evaluations);
+}
+
+TEST_F(TestParquetFileFormat, PredicatePushdownBloomFilter) {
+  // The statistics of both row groups admit all the values below
+  auto schema = arrow::schema({field("id", int64()), field("s", utf8())});
+  RecordBatchVector batches = {
+      RecordBatchFromJSON(schema, R"([[0, "a"], [10, "c"], [20, "e"]])"),
+      RecordBatchFromJSON(schema, R"([[5, "b"], [15, "d"], [25, "f"]])")};
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchReader::Make(batches, schema));
+  auto properties = WriterProperties::Builder()
+                        .enable_bloom_filter("id")
+                        ->enable_bloom_filter("s")
+                        ->build();
+  auto pool = default_memory_pool();
+  auto sink = CreateOutputStream(pool);
+  ASSERT_OK(WriteRecordBatchReader(reader.get(), pool, sink, properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  FileSource source(buffer);
+
+  opts_ = ScanOptions::Make(schema);
+  format_->reader_options.use_bloom_filter = true;
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source));
+
+  opts_->filter = ("id"_ == int64_t(10)).Copy();
+  CountRowsAndBatchesInScan(fragment, 3, 1);
+  opts_->filter = ("id"_ == int64_t(11)).Copy();
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+  opts_->filter = ("s"_ == "d").Copy();
+  CountRowsAndBatchesInScan(fragment, 3, 1);
+  opts_->filter = ("id"_ == int64_t(10) or "s"_ == "d").Copy();
+  CountRowsAndBatchesInScan(fragment, 6, 2);
+  opts_->filter = ("id"_ == int64_t(10) and "s"_ == "d").Copy();
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+  opts_->filter = ("id"_ == int64_t(11) or "id"_ > int64_t(0)).Copy();
+  CountRowsAndBatchesInScan(fragment, 6, 2);
+
+  opts_->filter = ("id"_.In(ArrayFromJSON(int64(), "[5, 11]"))).Copy();
+  CountRowsAndBatchesInScan(fragment, 3, 1);
+  opts_->filter = ("id"_.In(ArrayFromJSON(int64(), "[7, 11]"))).Copy();
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+  // Null rows are in a set holding a null
+  opts_->filter = ("id"_.In(ArrayFromJSON(int64(), "[7, null]"))).Copy();
+  CountRowsAndBatchesInScan(fragment, 6, 2);
+
+  // Under a NOT, the Bloom filters can't exclude anything
+  opts_->filter = (not("id"_ == int64_t(10))).Copy();
+  CountRowsAndBatchesInScan(fragment, 6, 2);
+
+  format_->reader_options.use_bloom_filter = false;
+  opts_->filter = ("id"_ == int64_t(11)).Copy();
+  CountRowsAndBatchesInScan(fragment, 6, 2);
+}
+
+TEST_F(TestParquetFileFormat, PredicatePushdownDictionary) {
+  // The statistics of both row groups admit all the values below
+  auto schema = arrow::schema({field("id", int64()), field("s", utf8())});
+  RecordBatchVector batches = {
+      RecordBatchFromJSON(schema, R"([[0, "a"], [10, "c"], [20, "e"]])"),
+      RecordBatchFromJSON(schema, R"([[5, "b"], [15, "d"], [25, "f"]])")};
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchReader::Make(batches, schema));
+  auto pool = default_memory_pool();
+  auto sink = CreateOutputStream(pool);
+  ASSERT_OK(WriteRecordBatchReader(reader.get(), pool, sink));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  FileSource source(buffer);
+
+  opts_ = ScanOptions::Make(schema);
+  format_->reader_options.use_dictionary_filter = true;
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source));
+
+  opts_->filter = ("id"_ == int64_t(10)).Copy();
+  CountRowsAndBatchesInScan(fragment, 3, 1);
+  opts_->filter = ("id"_ == int64_t(11)).Copy();
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+  opts_->filter = ("s"_ == "d").Copy();
+  CountRowsAndBatchesInScan(fragment, 3, 1);
+  opts_->filter = ("id"_ == int64_t(10) or "s"_ == "d").Copy();
+  CountRowsAndBatchesInScan(fragment, 6, 2);
+  opts_->filter = ("id"_ == int64_t(10) and "s"_ == "d").Copy();
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+
+  opts_->filter = ("s"_.In(ArrayFromJSON(utf8(), R"(["b", "z"])"))).Copy();
+  CountRowsAndBatchesInScan(fragment, 3, 1);
+  opts_->filter = ("s"_.In(ArrayFromJSON(utf8(), R"(["x", "z"])"))).Copy();
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+
+  // Under a NOT, the dictionaries can't exclude anything
+  opts_->filter = (not("id"_ == int64_t(10))).Copy();
+  CountRowsAndBatchesInScan(fragment, 6, 2);
+
+  format_->reader_options.use_dictionary_filter = false;
+  opts_->filter = ("id"_ == int64_t(11)).Copy();
+  CountRowsAndBatchesInScan(fragment, 6, 2);
+
+  // Without a dictionary, nothing is excluded
+  sink = CreateOutputStream(pool);
+  ASSERT_OK_AND_ASSIGN(reader, RecordBatchReader::Make(batches, schema));
+  auto properties = WriterProperties::Builder().disable_dictionary()->build();
+  ASSERT_OK(WriteRecordBatchReader(reader.get(), pool, sink, properties));
+  ASSERT_OK_AND_ASSIGN(buffer, sink->Finish());
+  format_->reader_options.use_dictionary_filter = true;
+  ASSERT_OK_AND_ASSIGN(fragment, format_->MakeFragment(FileSource(buffer)));
+  opts_->filter = ("id"_ == int64_t(11)).Copy();
+  CountRowsAndBatchesInScan(fragment, 6, 2);
+}
+
+TEST_F(TestParquetFileFormat, ScanLateMaterialization) {
+  auto schema = arrow::schema({field("id", int64()), field("s", utf8())});
+  RecordBatchVector batches = {
+      RecordBatchFromJSON(schema, R"([[0, "a"], [10, "c"], [null, "e"]])"),
+      RecordBatchFromJSON(schema, R"([[5, "b"], [15, null], [25, "f"]])")};
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchReader::Make(batches, schema));
+  auto pool = default_memory_pool();
+  auto sink = CreateOutputStream(pool);
+  ASSERT_OK(WriteRecordBatchReader(reader.get(), pool, sink));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  FileSource source(buffer);
+
+  opts_ = ScanOptions::Make(schema);
+  opts_->evaluator = std::make_shared<TreeEvaluator>();
+  format_->reader_options.use_late_materialization = true;
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source));
+
+  opts_->filter = ("id"_ >= int64_t(10)).Copy();
+  auto result = IteratorToVector(Batches(fragment.get()));
+  ASSERT_EQ(2, result.size());
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(result));
+  ASSERT_OK_AND_ASSIGN(auto expected,
+                       Table::FromRecordBatches({RecordBatchFromJSON(
+                           schema, R"([[10, "c"], [15, null], [25, "f"]])")}));
+  AssertTablesEqual(*expected, *table, /*same_chunk_layout=*/false);
+
+  opts_->filter = ("id"_ > int64_t(100)).Copy();
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+  // The row with a null id is dropped
+  opts_->filter = ("id"_ >= int64_t(0) or "id"_ < int64_t(0)).Copy();
+  CountRowsAndBatchesInScan(fragment, 5, 2);
+
+  // A filter on all the columns to read is evaluated by the scanner only
+  opts_->filter = ("id"_ >= int64_t(10) and "s"_ == "f").Copy();
+  CountRowsAndBatchesInScan(fragment, 6, 2);
+}
+
+TEST_F(TestParquetFileFormat, ScanPreBuffered) {
+  constexpr int64_t kNumRowGroups = 16;
+  constexpr int64_t kTotalNumRows = kNumRowGroups * (kNumRowGroups + 1) / 2;
+
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups);
+  auto source = GetFileSource(reader.get());
+
+  opts_ = ScanOptions::Make(reader->schema());
+  format_->reader_options.pre_buffer = true;
+  format_->reader_options.cache_options = io::CacheOptions::MakeFromNetworkMetrics(
+      /*time_to_first_byte_millis=*/5, /*transfer_bandwidth_mib_per_sec=*/50);
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  CountRowsAndBatchesInScan(fragment, kTotalNumRows, kNumRowGroups);
+
+  // Only the row groups left by the statistics are pre-buffered
+  opts_->filter = ("i64"_ == int64_t(3)).Copy();
+  CountRowsAndBatchesInScan(fragment, 3, 1);
+
+  // Along with late materialization
+  format_->reader_options.use_late_materialization = true;
+  opts_->evaluator = std::make_shared<TreeEvaluator>();
+  CountRowsAndBatchesInScan(fragment, 3, 1);
+}
+
+TEST_F(TestParquetFileFormat, ScanBatchesUnorderedPreBufferedSmallIOPool) {
+  constexpr int64_t kNumRowGroups = 16;
+  constexpr int64_t kTotalNumRows = kNumRowGroups * (kNumRowGroups + 1) / 2;
+
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups);
+  FileSource source(std::make_shared<ExecutorReadFile>(Write(reader.get())));
+  format_->reader_options.pre_buffer = true;
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source));
+
+  // Fewer I/O threads than background scan workers, which must not take up the
+  // threads the pre-buffered reads are queued for
+  ASSERT_OK_AND_ASSIGN(auto io_pool, internal::ThreadPool::Make(1));
+  ctx_->io_context = io::AsyncContext(io_pool.get());
+
+  for (bool use_threads : {false, true}) {
+    ctx_->use_threads = use_threads;
+    ScannerBuilder builder(reader->schema(), fragment, ctx_);
+    ASSERT_OK(builder.FragmentReadahead(4));
+    ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+    ASSERT_OK_AND_ASSIGN(auto batch_it, scanner->ScanBatchesUnordered());
+    int64_t num_rows = 0;
+    for (auto maybe_batch : batch_it) {
+      ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      num_rows += batch->num_rows();
+    }
+    ASSERT_EQ(kTotalNumRows, num_rows);
+  }
+}
+
 TEST_F(TestParquetFileFormat, PredicatePushdownRowGroupFragments) {
   constexpr int64_t kNumRowGroups = 16;
 
@@ -617,5 +924,50 @@ TEST_F(TestParquetFileSystemDataset, WriteWithEmptyPartitioningSchema) {
   TestWriteWithEmptyPartitioningSchema();
 }
 
+TEST_F(TestParquetFileSystemDataset, WriteFromScanner) { TestWriteFromScanner(); }
+
+TEST_F(TestParquetFileSystemDataset, WriteFromScannerRollsFiles) {
+  TestWriteFromScannerRollsFiles();
+}
+
+TEST_F(TestParquetFileSystemDataset, WriteFromScannerInvalidOptions) {
+  TestWriteFromScannerInvalidOptions();
+}
+
+TEST_F(TestParquetFileSystemDataset, WriteFromScannerWithMetadata) {
+  auto write_options = MakeWriteOptions();
+  write_options.max_rows_per_file = 3;
+  write_options.write_metadata = true;
+  ASSERT_OK(FileSystemDataset::Write(write_options, MakeSourceScanner(true)));
+
+  ASSERT_OK_AND_ASSIGN(auto info, fs_->GetFileInfo("new_root/_common_metadata"));
+  ASSERT_EQ(info.type(), fs::FileType::File);
+
+  // The summary describes every written file, with statistics for each row group
+  ParquetFactoryOptions options;
+  options.partitioning = write_options.partitioning;
+  ASSERT_OK_AND_ASSIGN(
+      auto factory,
+      ParquetDatasetFactory::Make("new_root/_metadata", fs_,
+                                  checked_pointer_cast<ParquetFileFormat>(format_),
+                                  options));
+  ASSERT_OK_AND_ASSIGN(auto dataset, factory->Finish());
+
+  int num_fragments = 0;
+  int64_t num_rows = 0;
+  for (auto maybe_fragment : dataset->GetFragments()) {
+    ASSERT_OK_AND_ASSIGN(auto fragment, std::move(maybe_fragment));
+    auto parquet_fragment = checked_pointer_cast<ParquetFileFragment>(fragment);
+    ASSERT_TRUE(parquet_fragment->HasCompleteMetadata());
+    for (const auto& row_group : parquet_fragment->row_groups()) {
+      num_rows += row_group.num_rows();
+    }
+    ++num_fragments;
+  }
+  ASSERT_EQ(num_fragments, 6);
+  ASSERT_EQ(num_rows, 16);
+  ASSERT_EQ(checked_pointer_cast<FileSystemDataset>(dataset)->files().size(), 6);
+}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -80,6 +80,88 @@ TEST(FileSource, BufferBased) {
   ASSERT_EQ(source1.buffer(), source3.buffer());
 }
 
+TEST(FileMetadataCache, Basics) {
+  DummyFileFormat format;
+  fs::internal::MockFileSystem filesystem(fs::kNoTime);
+  FileMetadataCache cache(2);
+
+  auto make_info = [](const std::string& path, int64_t size, int64_t mtime) {
+    fs::FileInfo info(path, fs::FileType::File);
+    info.set_size(size);
+    info.set_mtime(fs::TimePoint(std::chrono::seconds(mtime)));
+    return info;
+  };
+  auto a = make_info("a", 10, 1);
+  auto b = make_info("b", 10, 1);
+  auto c = make_info("c", 10, 1);
+  auto entry_a = std::make_shared<FileMetadataCache::Entry>();
+  auto entry_b = std::make_shared<FileMetadataCache::Entry>();
+  auto entry_c = std::make_shared<FileMetadataCache::Entry>();
+
+  ASSERT_EQ(cache.GetMetadata(format, filesystem, a), nullptr);
+  cache.PutMetadata(format, filesystem, a, entry_a);
+  ASSERT_EQ(cache.GetMetadata(format, filesystem, a), entry_a);
+  ASSERT_EQ(cache.num_entries(), 1);
+
+  // A file with a different size or modification time is a different file
+  ASSERT_EQ(cache.GetMetadata(format, filesystem, make_info("a", 11, 1)), nullptr);
+  ASSERT_EQ(cache.GetMetadata(format, filesystem, make_info("a", 10, 2)), nullptr);
+  // Files with unknown size or modification time aren't cached
+  fs::FileInfo incomplete("d", fs::FileType::File);
+  cache.PutMetadata(format, filesystem, incomplete, entry_b);
+  ASSERT_EQ(cache.GetMetadata(format, filesystem, incomplete), nullptr);
+  ASSERT_EQ(cache.num_entries(), 1);
+
+  // Least recently used entries are evicted
+  cache.PutMetadata(format, filesystem, b, entry_b);
+  ASSERT_EQ(cache.GetMetadata(format, filesystem, a), entry_a);
+  cache.PutMetadata(format, filesystem, c, entry_c);
+  ASSERT_EQ(cache.num_entries(), 2);
+  ASSERT_EQ(cache.GetMetadata(format, filesystem, a), entry_a);
+  ASSERT_EQ(cache.GetMetadata(format, filesystem, b), nullptr);
+  ASSERT_EQ(cache.GetMetadata(format, filesystem, c), entry_c);
+
+  // Replacing an entry
+  cache.PutMetadata(format, filesystem, a, entry_b);
+  ASSERT_EQ(cache.GetMetadata(format, filesystem, a), entry_b);
+  ASSERT_EQ(cache.num_entries(), 2);
+
+  cache.Clear();
+  ASSERT_EQ(cache.num_entries(), 0);
+  ASSERT_EQ(cache.GetMetadata(format, filesystem, a), nullptr);
+}
+
+TEST(FileMetadataCache, GetFileInfo) {
+  const fs::TimePoint mtime(std::chrono::seconds(42));
+  auto filesystem = std::make_shared<fs::internal::MockFileSystem>(mtime);
+  ASSERT_OK(filesystem->CreateFile("dir/file", "data"));
+  FileMetadataCache cache(16);
+
+  FileSource source("dir/file", filesystem);
+  ASSERT_OK_AND_ASSIGN(auto info, cache.GetFileInfo(source));
+  ASSERT_EQ(info.type(), fs::FileType::File);
+  ASSERT_EQ(info.size(), 4);
+  ASSERT_EQ(info.mtime(), mtime);
+
+  // The cached info is used, even though the file changed
+  ASSERT_OK(filesystem->DeleteFile("dir/file"));
+  ASSERT_OK_AND_ASSIGN(info, cache.GetFileInfo(source));
+  ASSERT_EQ(info.type(), fs::FileType::File);
+
+  cache.Clear();
+  ASSERT_OK_AND_ASSIGN(info, cache.GetFileInfo(source));
+  ASSERT_EQ(info.type(), fs::FileType::NotFound);
+
+  // A complete file info is returned as is
+  fs::FileInfo complete("other", fs::FileType::File);
+  complete.set_size(5);
+  complete.set_mtime(mtime);
+  ASSERT_OK_AND_ASSIGN(info, cache.GetFileInfo(FileSource(complete, filesystem)));
+  ASSERT_EQ(info, complete);
+
+  ASSERT_RAISES(Invalid, cache.GetFileInfo(FileSource(std::make_shared<Buffer>(""))));
+}
+
 TEST_F(TestFileSystemDataset, Basic) {
   MakeDataset({});
   AssertFragmentsAreFromPath(dataset_->GetFragments(), {});
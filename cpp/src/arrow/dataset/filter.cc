@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <string>
 #include <unordered_map>
@@ -38,6 +39,9 @@
 #include "arrow/result.h"
 #include "arrow/scalar.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/bit_block_counter.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/int_util_internal.h"
 #include "arrow/util/iterator.h"
@@ -135,6 +139,17 @@ struct CompareVisitor {
     return CompareValues(cmp, 0);
   }
 
+  // Also visits StringViewType
+  Status Visit(const BinaryViewType&) {
+    auto lhs = checked_cast<const BaseBinaryScalar&>(lhs_).value;
+    auto rhs = checked_cast<const BaseBinaryScalar&>(rhs_).value;
+    auto cmp = std::memcmp(lhs->data(), rhs->data(), std::min(lhs->size(), rhs->size()));
+    if (cmp == 0) {
+      return CompareValues(lhs->size(), rhs->size());
+    }
+    return CompareValues(cmp, 0);
+  }
+
   Status Visit(const Decimal128Type&) { return CompareValues<Decimal128Type>(); }
 
   // Explicit because it falls under `physical_unsigned_integer`.
@@ -220,6 +235,28 @@ CompareOperator InvertCompareOperator(CompareOperator op) {
   return CompareOperator::EQUAL;
 }
 
+// The operator giving the same result with the operands swapped
+CompareOperator FlipCompareOperator(CompareOperator op) {
+  switch (op) {
+    case CompareOperator::GREATER:
+      return CompareOperator::LESS;
+
+    case CompareOperator::GREATER_EQUAL:
+      return CompareOperator::LESS_EQUAL;
+
+    case CompareOperator::LESS:
+      return CompareOperator::GREATER;
+
+    case CompareOperator::LESS_EQUAL:
+      return CompareOperator::GREATER_EQUAL;
+
+    default:
+      break;
+  }
+
+  return op;
+}
+
 template <typename Boolean>
 std::shared_ptr<Expression> InvertBoolean(const Boolean& expr) {
   auto lhs = Invert(*expr.left_operand());
@@ -1168,34 +1205,55 @@ struct TreeEvaluator::Impl {
   }
 
   Result<Datum> operator()(const AndExpression& expr) const {
-    return EvaluateBoolean(expr, compute::KleeneAnd);
+    return EvaluateBoolean(expr, /*absorbing=*/false, compute::KleeneAnd);
   }
 
   Result<Datum> operator()(const OrExpression& expr) const {
-    return EvaluateBoolean(expr, compute::KleeneOr);
+    return EvaluateBoolean(expr, /*absorbing=*/true, compute::KleeneOr);
   }
 
-  Result<Datum> EvaluateBoolean(const BinaryExpression& expr,
+  // Valid scalar operands are never broadcast: `absorbing` (false for and, true
+  // for or) is the result whatever the other operand, and the other value
+  // yields the other operand. Null scalars are broadcast only when the other
+  // operand is an array.
+  Result<Datum> EvaluateBoolean(const BinaryExpression& expr, bool absorbing,
                                 Result<Datum> kernel(const Datum& left,
                                                      const Datum& right,
                                                      ExecContext* ctx)) const {
     ARROW_ASSIGN_OR_RAISE(auto lhs, Evaluate(*expr.left_operand()));
     ARROW_ASSIGN_OR_RAISE(auto rhs, Evaluate(*expr.right_operand()));
 
-    if (lhs.is_scalar()) {
-      ARROW_ASSIGN_OR_RAISE(
-          auto lhs_array,
-          MakeArrayFromScalar(*lhs.scalar(), batch_.num_rows(), ctx_.memory_pool()));
-      lhs = Datum(std::move(lhs_array));
-    }
+    auto is_valid_scalar = [](const Datum& datum) {
+      return datum.is_scalar() && datum.scalar()->is_valid;
+    };
+    auto scalar_value = [](const Datum& datum) {
+      return checked_cast<const BooleanScalar&>(*datum.scalar()).value;
+    };
 
-    if (rhs.is_scalar()) {
-      ARROW_ASSIGN_OR_RAISE(
-          auto rhs_array,
-          MakeArrayFromScalar(*rhs.scalar(), batch_.num_rows(), ctx_.memory_pool()));
-      rhs = Datum(std::move(rhs_array));
+    for (const Datum* operand : {&lhs, &rhs}) {
+      if (is_valid_scalar(*operand) && scalar_value(*operand) == absorbing) {
+        return Datum(absorbing);
+      }
+    }
+    if (is_valid_scalar(lhs)) {
+      return rhs;
+    }
+    if (is_valid_scalar(rhs)) {
+      return lhs;
+    }
+    if (lhs.is_scalar() && rhs.is_scalar()) {
+      // Both operands are null
+      return Datum(std::make_shared<BooleanScalar>());
     }
 
+    for (Datum* operand : {&lhs, &rhs}) {
+      if (operand->is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(
+            auto nulls,
+            MakeArrayOfNull(boolean(), batch_.num_rows(), ctx_.memory_pool()));
+        *operand = Datum(std::move(nulls));
+      }
+    }
     return kernel(lhs, rhs, &ctx_);
   }
 
@@ -1219,7 +1277,17 @@ struct TreeEvaluator::Impl {
       return Datum(expr.set()->null_count() != 0);
     }
 
-    DCHECK(operand_values.is_array());
+    if (operand_values.is_scalar()) {
+      // Look up the single value rather than broadcasting it
+      ARROW_ASSIGN_OR_RAISE(
+          auto operand_array,
+          MakeArrayFromScalar(*operand_values.scalar(), 1, ctx_.memory_pool()));
+      ARROW_ASSIGN_OR_RAISE(auto is_in,
+                            compute::IsIn(operand_array, expr.set(), &ctx_));
+      ARROW_ASSIGN_OR_RAISE(auto is_in_scalar, is_in.make_array()->GetScalar(0));
+      return Datum(std::move(is_in_scalar));
+    }
+
     return compute::IsIn(operand_values, expr.set(), &ctx_);
   }
 
@@ -1238,8 +1306,10 @@ struct TreeEvaluator::Impl {
       return Datum(true);
     }
 
-    return Datum(std::make_shared<BooleanArray>(operand_values.array()->length,
-                                                operand_values.array()->buffers[0]));
+    const ArrayData& operand_data = *operand_values.array();
+    return Datum(std::make_shared<BooleanArray>(operand_data.length,
+                                                operand_data.buffers[0], nullptr,
+                                                /*null_count=*/0, operand_data.offset));
   }
 
   Result<Datum> operator()(const CastExpression& expr) const {
@@ -1262,8 +1332,13 @@ struct TreeEvaluator::Impl {
       return Datum(std::make_shared<BooleanScalar>());
     }
 
-    DCHECK(lhs.is_array());
-
+    // Scalar operands, such as partition keys, are compared without being
+    // broadcast. Some kernels (dictionary, run-end encoded) only take the array
+    // on the left.
+    if (lhs.is_scalar() && rhs.is_array()) {
+      return compute::Compare(
+          rhs, lhs, compute::CompareOptions(FlipCompareOperator(expr.op())), &ctx_);
+    }
     return compute::Compare(lhs, rhs, compute::CompareOptions(expr.op()), &ctx_);
   }
 
@@ -1290,6 +1365,17 @@ Result<std::shared_ptr<RecordBatch>> TreeEvaluator::Filter(
     MemoryPool* pool) const {
   if (selection.is_array()) {
     auto selection_array = selection.make_array();
+    if (selection_array->type_id() == Type::BOOL) {
+      // Avoid copying the columns when the selection is trivial
+      const int64_t num_selected =
+          checked_cast<const BooleanArray&>(*selection_array).true_count();
+      if (num_selected == batch->num_rows()) {
+        return batch;
+      }
+      if (num_selected == 0) {
+        return batch->Slice(0, 0);
+      }
+    }
     compute::ExecContext ctx(pool);
     ARROW_ASSIGN_OR_RAISE(Datum filtered,
                           compute::Filter(batch, selection_array,
@@ -1309,6 +1395,708 @@ Result<std::shared_ptr<RecordBatch>> TreeEvaluator::Filter(
   return batch->Slice(0, 0);
 }
 
+// ----------------------------------------------------------------------
+// FusedEvaluator
+
+namespace {
+
+constexpr int64_t kFusedChunkLength = 4096;
+constexpr int64_t kFusedChunkWords = kFusedChunkLength / 64;
+
+inline int64_t NumWords(int64_t length) { return BitUtil::CeilDiv(length, 64); }
+
+// Set the first `length` bits of a chunk and clear the rest of the last word
+void SetChunkBits(int64_t length, uint64_t* words) {
+  const int64_t num_words = NumWords(length);
+  std::fill(words, words + num_words, ~uint64_t(0));
+  if (length % 64 != 0) {
+    words[num_words - 1] = BitUtil::LeastSignficantBitMask(length % 64);
+  }
+}
+
+void ClearChunkBits(int64_t length, uint64_t* words) {
+  std::fill(words, words + NumWords(length), uint64_t(0));
+}
+
+// Copy `length` bits of a bitmap starting at `offset`
+void CopyChunkBits(const uint8_t* bitmap, int64_t offset, int64_t length,
+                   uint64_t* words) {
+  ClearChunkBits(length, words);
+  arrow::internal::CopyBitmap(bitmap, offset, length, reinterpret_cast<uint8_t*>(words),
+                              0);
+}
+
+// Copy the validity of `length` slots of an array starting at `offset`
+void CopyChunkValidity(const ArrayData& data, int64_t offset, int64_t length,
+                       uint64_t* words) {
+  if (data.GetNullCount() == 0) {
+    SetChunkBits(length, words);
+  } else {
+    CopyChunkBits(data.buffers[0]->data(), data.offset + offset, length, words);
+  }
+}
+
+void AndChunkBits(int64_t length, const uint64_t* mask, uint64_t* words) {
+  for (int64_t i = 0; i < NumWords(length); ++i) {
+    words[i] &= mask[i];
+  }
+}
+
+// Pack the boolean results of `predicate(i)` for each row of a chunk
+template <typename Predicate>
+void PackChunkBits(int64_t length, Predicate&& predicate, uint64_t* words) {
+  for (int64_t base = 0; base < length; base += 64) {
+    const int64_t n = std::min<int64_t>(64, length - base);
+    uint64_t word = 0;
+    for (int64_t i = 0; i < n; ++i) {
+      word |= static_cast<uint64_t>(predicate(base + i)) << i;
+    }
+    words[base / 64] = word;
+  }
+}
+
+bool AnyChunkBitSet(int64_t length, const uint64_t* words) {
+  arrow::internal::BitBlockCounter counter(reinterpret_cast<const uint8_t*>(words), 0,
+                                           length);
+  for (int64_t position = 0; position < length;) {
+    const auto block = counter.NextFourWords();
+    if (!block.NoneSet()) {
+      return true;
+    }
+    position += block.length;
+  }
+  return false;
+}
+
+// Scratch bitmaps of a program, reused across the chunks of a batch.  Each
+// node of the program writes its result to its own slot.
+class FusedScratch {
+ public:
+  FusedScratch(int num_slots, MemoryPool* pool)
+      : words_(static_cast<size_t>(2 * kFusedChunkWords * num_slots)), pool_(pool) {}
+
+  uint64_t* values(int slot) { return words_.data() + 2 * kFusedChunkWords * slot; }
+  uint64_t* validity(int slot) { return values(slot) + kFusedChunkWords; }
+  MemoryPool* pool() const { return pool_; }
+
+ private:
+  std::vector<uint64_t> words_;
+  MemoryPool* pool_;
+};
+
+// A node of a compiled boolean expression.  Its result for a chunk is a pair of
+// values and validity bitmaps following Kleene logic, whose value bits are
+// cleared where the result is null.
+class FusedNode {
+ public:
+  explicit FusedNode(int slot) : slot_(slot) {}
+  virtual ~FusedNode() = default;
+
+  /// Evaluate rows [offset, offset + length) of a batch into the node's slot
+  virtual Status Evaluate(const RecordBatch& batch, int64_t offset, int64_t length,
+                          FusedScratch* scratch) const = 0;
+
+  int slot() const { return slot_; }
+
+ protected:
+  const int slot_;
+};
+
+class ConstantNode : public FusedNode {
+ public:
+  ConstantNode(int slot, const Scalar& value)
+      : FusedNode(slot),
+        is_valid_(value.is_valid),
+        value_(value.is_valid && checked_cast<const BooleanScalar&>(value).value) {}
+
+  Status Evaluate(const RecordBatch&, int64_t, int64_t length,
+                  FusedScratch* scratch) const override {
+    if (value_) {
+      SetChunkBits(length, scratch->values(slot_));
+    } else {
+      ClearChunkBits(length, scratch->values(slot_));
+    }
+    if (is_valid_) {
+      SetChunkBits(length, scratch->validity(slot_));
+    } else {
+      ClearChunkBits(length, scratch->validity(slot_));
+    }
+    return Status::OK();
+  }
+
+ private:
+  bool is_valid_, value_;
+};
+
+class BooleanFieldNode : public FusedNode {
+ public:
+  BooleanFieldNode(int slot, int index) : FusedNode(slot), index_(index) {}
+
+  Status Evaluate(const RecordBatch& batch, int64_t offset, int64_t length,
+                  FusedScratch* scratch) const override {
+    const ArrayData& data = *batch.column_data(index_);
+    CopyChunkBits(data.buffers[1]->data(), data.offset + offset, length,
+                  scratch->values(slot_));
+    CopyChunkValidity(data, offset, length, scratch->validity(slot_));
+    AndChunkBits(length, scratch->validity(slot_), scratch->values(slot_));
+    return Status::OK();
+  }
+
+ private:
+  int index_;
+};
+
+class IsValidFieldNode : public FusedNode {
+ public:
+  IsValidFieldNode(int slot, int index) : FusedNode(slot), index_(index) {}
+
+  Status Evaluate(const RecordBatch& batch, int64_t offset, int64_t length,
+                  FusedScratch* scratch) const override {
+    CopyChunkValidity(*batch.column_data(index_), offset, length, scratch->values(slot_));
+    SetChunkBits(length, scratch->validity(slot_));
+    return Status::OK();
+  }
+
+ private:
+  int index_;
+};
+
+struct FusedEqual {
+  template <typename T>
+  static bool Call(const T& l, const T& r) {
+    return l == r;
+  }
+};
+struct FusedNotEqual {
+  template <typename T>
+  static bool Call(const T& l, const T& r) {
+    return l != r;
+  }
+};
+struct FusedGreater {
+  template <typename T>
+  static bool Call(const T& l, const T& r) {
+    return l > r;
+  }
+};
+struct FusedGreaterEqual {
+  template <typename T>
+  static bool Call(const T& l, const T& r) {
+    return l >= r;
+  }
+};
+struct FusedLess {
+  template <typename T>
+  static bool Call(const T& l, const T& r) {
+    return l < r;
+  }
+};
+struct FusedLessEqual {
+  template <typename T>
+  static bool Call(const T& l, const T& r) {
+    return l <= r;
+  }
+};
+
+// Compare a column of a fixed width type with a scalar, or with another column
+// of the same type if rhs_index >= 0
+template <typename CType, typename Op>
+class PrimitiveCompareNode : public FusedNode {
+ public:
+  PrimitiveCompareNode(int slot, int lhs_index, int rhs_index, CType rhs_value)
+      : FusedNode(slot),
+        lhs_index_(lhs_index),
+        rhs_index_(rhs_index),
+        rhs_value_(rhs_value) {}
+
+  Status Evaluate(const RecordBatch& batch, int64_t offset, int64_t length,
+                  FusedScratch* scratch) const override {
+    const ArrayData& lhs_data = *batch.column_data(lhs_index_);
+    const CType* lhs = lhs_data.GetValues<CType>(1) + offset;
+    uint64_t* values = scratch->values(slot_);
+    uint64_t* validity = scratch->validity(slot_);
+    CopyChunkValidity(lhs_data, offset, length, validity);
+
+    if (rhs_index_ < 0) {
+      const CType rhs = rhs_value_;
+      PackChunkBits(
+          length, [&](int64_t i) { return Op::Call(lhs[i], rhs); }, values);
+    } else {
+      const ArrayData& rhs_data = *batch.column_data(rhs_index_);
+      const CType* rhs = rhs_data.GetValues<CType>(1) + offset;
+      PackChunkBits(
+          length, [&](int64_t i) { return Op::Call(lhs[i], rhs[i]); }, values);
+      if (rhs_data.GetNullCount() != 0) {
+        uint64_t rhs_validity[kFusedChunkWords];
+        CopyChunkValidity(rhs_data, offset, length, rhs_validity);
+        AndChunkBits(length, rhs_validity, validity);
+      }
+    }
+    AndChunkBits(length, validity, values);
+    return Status::OK();
+  }
+
+ private:
+  int lhs_index_, rhs_index_;
+  CType rhs_value_;
+};
+
+// Compare a column of binary or string type with a scalar
+template <typename Op>
+class BinaryCompareNode : public FusedNode {
+ public:
+  BinaryCompareNode(int slot, int index, std::shared_ptr<Buffer> value)
+      : FusedNode(slot), index_(index), value_(std::move(value)) {}
+
+  Status Evaluate(const RecordBatch& batch, int64_t offset, int64_t length,
+                  FusedScratch* scratch) const override {
+    const ArrayData& data = *batch.column_data(index_);
+    const int32_t* offsets = data.GetValues<int32_t>(1) + offset;
+    const char* chars = data.GetValues<char>(2, /*absolute_offset=*/0);
+    const util::string_view rhs(reinterpret_cast<const char*>(value_->data()),
+                                static_cast<size_t>(value_->size()));
+    uint64_t* values = scratch->values(slot_);
+    uint64_t* validity = scratch->validity(slot_);
+
+    CopyChunkValidity(data, offset, length, validity);
+    PackChunkBits(
+        length,
+        [&](int64_t i) {
+          const util::string_view lhs(chars + offsets[i],
+                                      static_cast<size_t>(offsets[i + 1] - offsets[i]));
+          return Op::Call(lhs, rhs);
+        },
+        values);
+    AndChunkBits(length, validity, values);
+    return Status::OK();
+  }
+
+ private:
+  int index_;
+  std::shared_ptr<Buffer> value_;
+};
+
+class NotNode : public FusedNode {
+ public:
+  NotNode(int slot, std::unique_ptr<FusedNode> operand)
+      : FusedNode(slot), operand_(std::move(operand)) {}
+
+  Status Evaluate(const RecordBatch& batch, int64_t offset, int64_t length,
+                  FusedScratch* scratch) const override {
+    RETURN_NOT_OK(operand_->Evaluate(batch, offset, length, scratch));
+    const uint64_t* operand_values = scratch->values(operand_->slot());
+    const uint64_t* operand_validity = scratch->validity(operand_->slot());
+    uint64_t* values = scratch->values(slot_);
+    uint64_t* validity = scratch->validity(slot_);
+    for (int64_t i = 0; i < NumWords(length); ++i) {
+      values[i] = ~operand_values[i] & operand_validity[i];
+      validity[i] = operand_validity[i];
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::unique_ptr<FusedNode> operand_;
+};
+
+// A conjunction or disjunction.  The right operand is only evaluated on chunks
+// where the left operand doesn't decide the result of every row.
+template <bool kIsAnd>
+class KleeneNode : public FusedNode {
+ public:
+  KleeneNode(int slot, std::unique_ptr<FusedNode> left, std::unique_ptr<FusedNode> right)
+      : FusedNode(slot), left_(std::move(left)), right_(std::move(right)) {}
+
+  Status Evaluate(const RecordBatch& batch, int64_t offset, int64_t length,
+                  FusedScratch* scratch) const override {
+    RETURN_NOT_OK(left_->Evaluate(batch, offset, length, scratch));
+    const uint64_t* lv = scratch->values(left_->slot());
+    const uint64_t* lm = scratch->validity(left_->slot());
+    uint64_t* values = scratch->values(slot_);
+    uint64_t* validity = scratch->validity(slot_);
+    const int64_t num_words = NumWords(length);
+
+    // A false (resp. true) left operand decides the conjunction (resp. disjunction)
+    for (int64_t i = 0; i < num_words; ++i) {
+      validity[i] = kIsAnd ? ~(lm[i] & ~lv[i]) : ~lv[i];
+    }
+    if (!AnyChunkBitSet(length, validity)) {
+      std::copy(lv, lv + num_words, values);
+      std::copy(lm, lm + num_words, validity);
+      return Status::OK();
+    }
+
+    RETURN_NOT_OK(right_->Evaluate(batch, offset, length, scratch));
+    const uint64_t* rv = scratch->values(right_->slot());
+    const uint64_t* rm = scratch->validity(right_->slot());
+    for (int64_t i = 0; i < num_words; ++i) {
+      if (kIsAnd) {
+        values[i] = lv[i] & rv[i];
+        validity[i] = (lm[i] & rm[i]) | (lm[i] & ~lv[i]) | (rm[i] & ~rv[i]);
+      } else {
+        values[i] = lv[i] | rv[i];
+        validity[i] = (lm[i] & rm[i]) | lv[i] | rv[i];
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::unique_ptr<FusedNode> left_, right_;
+};
+
+// Evaluate a subexpression without fused kernel on a slice of the batch
+class FallbackNode : public FusedNode {
+ public:
+  FallbackNode(int slot, std::shared_ptr<Expression> expr)
+      : FusedNode(slot), expr_(std::move(expr)) {}
+
+  Status Evaluate(const RecordBatch& batch, int64_t offset, int64_t length,
+                  FusedScratch* scratch) const override {
+    auto slice = batch.Slice(offset, length);
+    ARROW_ASSIGN_OR_RAISE(Datum result,
+                          evaluator_.Evaluate(*expr_, *slice, scratch->pool()));
+    uint64_t* values = scratch->values(slot_);
+    uint64_t* validity = scratch->validity(slot_);
+
+    if (result.type()->id() == Type::NA) {
+      ClearChunkBits(length, values);
+      ClearChunkBits(length, validity);
+      return Status::OK();
+    }
+    if (result.type()->id() != Type::BOOL) {
+      return Status::TypeError("expected a boolean result for ", expr_->ToString(),
+                               ", got ", *result.type());
+    }
+    if (result.is_scalar()) {
+      const ConstantNode constant(slot_, *result.scalar());
+      return constant.Evaluate(batch, offset, length, scratch);
+    }
+    const ArrayData& data = *result.array();
+    CopyChunkBits(data.buffers[1]->data(), data.offset, length, values);
+    CopyChunkValidity(data, 0, length, validity);
+    AndChunkBits(length, validity, values);
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Expression> expr_;
+  TreeEvaluator evaluator_;
+};
+
+template <template <typename...> class NodeType, typename... Args>
+std::unique_ptr<FusedNode> MakeCompareNode(CompareOperator op, Args&&... args) {
+  switch (op) {
+    case CompareOperator::EQUAL:
+      return std::unique_ptr<FusedNode>(
+          new NodeType<FusedEqual>(std::forward<Args>(args)...));
+    case CompareOperator::NOT_EQUAL:
+      return std::unique_ptr<FusedNode>(
+          new NodeType<FusedNotEqual>(std::forward<Args>(args)...));
+    case CompareOperator::GREATER:
+      return std::unique_ptr<FusedNode>(
+          new NodeType<FusedGreater>(std::forward<Args>(args)...));
+    case CompareOperator::GREATER_EQUAL:
+      return std::unique_ptr<FusedNode>(
+          new NodeType<FusedGreaterEqual>(std::forward<Args>(args)...));
+    case CompareOperator::LESS:
+      return std::unique_ptr<FusedNode>(
+          new NodeType<FusedLess>(std::forward<Args>(args)...));
+    case CompareOperator::LESS_EQUAL:
+      return std::unique_ptr<FusedNode>(
+          new NodeType<FusedLessEqual>(std::forward<Args>(args)...));
+  }
+  return nullptr;
+}
+
+template <typename CType>
+struct PrimitiveCompareNodeOf {
+  template <typename Op>
+  using type = PrimitiveCompareNode<CType, Op>;
+};
+
+template <typename CType>
+std::unique_ptr<FusedNode> MakePrimitiveCompareNode(CompareOperator op, int slot,
+                                                    int lhs_index, int rhs_index,
+                                                    const Scalar* rhs) {
+  CType rhs_value{};
+  if (rhs != nullptr) {
+    rhs_value = *reinterpret_cast<const CType*>(
+        checked_cast<const internal::PrimitiveScalarBase&>(*rhs).data());
+  }
+  return MakeCompareNode<PrimitiveCompareNodeOf<CType>::template type>(
+      op, slot, lhs_index, rhs_index, rhs_value);
+}
+
+// Lower an expression to fused nodes, against the schema of the batches it
+// will be evaluated on
+class FusedCompiler {
+ public:
+  explicit FusedCompiler(const Schema& schema) : schema_(schema) {}
+
+  std::unique_ptr<FusedNode> Compile(const std::shared_ptr<Expression>& expr) {
+    const int slot = num_slots_++;
+    std::unique_ptr<FusedNode> node;
+    switch (expr->type()) {
+      case ExpressionType::SCALAR: {
+        const auto& value = *checked_cast<const ScalarExpression&>(*expr).value();
+        if (value.type->id() == Type::BOOL) {
+          node.reset(new ConstantNode(slot, value));
+        }
+        break;
+      }
+      case ExpressionType::FIELD: {
+        const int index = FieldIndex(*expr, Type::BOOL);
+        if (index >= 0) {
+          node.reset(new BooleanFieldNode(slot, index));
+          ++num_fused_;
+        }
+        break;
+      }
+      case ExpressionType::IS_VALID: {
+        const auto& operand = *checked_cast<const IsValidExpression&>(*expr).operand();
+        const int index = FieldIndex(operand);
+        if (index >= 0) {
+          node.reset(new IsValidFieldNode(slot, index));
+          ++num_fused_;
+        }
+        break;
+      }
+      case ExpressionType::NOT: {
+        const auto& not_expr = checked_cast<const NotExpression&>(*expr);
+        node.reset(new NotNode(slot, Compile(not_expr.operand())));
+        break;
+      }
+      case ExpressionType::AND: {
+        const auto& and_expr = checked_cast<const AndExpression&>(*expr);
+        auto left = Compile(and_expr.left_operand());
+        auto right = Compile(and_expr.right_operand());
+        node.reset(new KleeneNode<true>(slot, std::move(left), std::move(right)));
+        break;
+      }
+      case ExpressionType::OR: {
+        const auto& or_expr = checked_cast<const OrExpression&>(*expr);
+        auto left = Compile(or_expr.left_operand());
+        auto right = Compile(or_expr.right_operand());
+        node.reset(new KleeneNode<false>(slot, std::move(left), std::move(right)));
+        break;
+      }
+      case ExpressionType::COMPARISON:
+        node = CompileComparison(slot, checked_cast<const ComparisonExpression&>(*expr));
+        if (node != nullptr) {
+          ++num_fused_;
+        }
+        break;
+      default:
+        break;
+    }
+    if (node == nullptr) {
+      node.reset(new FallbackNode(slot, expr));
+    }
+    return node;
+  }
+
+  int num_slots() const { return num_slots_; }
+
+  // The number of nodes evaluated by a fused kernel rather than the TreeEvaluator
+  int num_fused() const { return num_fused_; }
+
+ private:
+  // Return the index of the field referenced by `expr`, or -1
+  int FieldIndex(const Expression& expr, Type::type id = Type::NA) const {
+    if (expr.type() != ExpressionType::FIELD) {
+      return -1;
+    }
+    const int index =
+        schema_.GetFieldIndex(checked_cast<const FieldExpression&>(expr).name());
+    if (index < 0 || (id != Type::NA && schema_.field(index)->type()->id() != id)) {
+      return -1;
+    }
+    return index;
+  }
+
+  std::unique_ptr<FusedNode> CompileComparison(int slot,
+                                               const ComparisonExpression& expr) {
+    const int lhs_index = FieldIndex(*expr.left_operand());
+    if (lhs_index < 0) {
+      return nullptr;
+    }
+    const auto& type = schema_.field(lhs_index)->type();
+
+    int rhs_index = -1;
+    const Scalar* rhs = nullptr;
+    const auto& right = *expr.right_operand();
+    if (right.type() == ExpressionType::SCALAR) {
+      rhs = checked_cast<const ScalarExpression&>(right).value().get();
+      if (!rhs->is_valid || !rhs->type->Equals(*type)) {
+        return nullptr;
+      }
+    } else {
+      rhs_index = FieldIndex(right);
+      if (rhs_index < 0 || !schema_.field(rhs_index)->type()->Equals(*type)) {
+        return nullptr;
+      }
+    }
+
+    switch (type->id()) {
+      case Type::INT8:
+        return MakePrimitiveCompareNode<int8_t>(expr.op(), slot, lhs_index, rhs_index,
+                                                rhs);
+      case Type::INT16:
+        return MakePrimitiveCompareNode<int16_t>(expr.op(), slot, lhs_index, rhs_index,
+                                                 rhs);
+      case Type::INT32:
+      case Type::DATE32:
+      case Type::TIME32:
+        return MakePrimitiveCompareNode<int32_t>(expr.op(), slot, lhs_index, rhs_index,
+                                                 rhs);
+      case Type::INT64:
+      case Type::DATE64:
+      case Type::TIME64:
+      case Type::TIMESTAMP:
+        return MakePrimitiveCompareNode<int64_t>(expr.op(), slot, lhs_index, rhs_index,
+                                                 rhs);
+      case Type::UINT8:
+        return MakePrimitiveCompareNode<uint8_t>(expr.op(), slot, lhs_index, rhs_index,
+                                                 rhs);
+      case Type::UINT16:
+        return MakePrimitiveCompareNode<uint16_t>(expr.op(), slot, lhs_index,
+                                                  rhs_index, rhs);
+      case Type::UINT32:
+        return MakePrimitiveCompareNode<uint32_t>(expr.op(), slot, lhs_index,
+                                                  rhs_index, rhs);
+      case Type::UINT64:
+        return MakePrimitiveCompareNode<uint64_t>(expr.op(), slot, lhs_index,
+                                                  rhs_index, rhs);
+      case Type::FLOAT:
+        return MakePrimitiveCompareNode<float>(expr.op(), slot, lhs_index, rhs_index,
+                                               rhs);
+      case Type::DOUBLE:
+        return MakePrimitiveCompareNode<double>(expr.op(), slot, lhs_index, rhs_index,
+                                                rhs);
+      case Type::STRING:
+      case Type::BINARY:
+        if (rhs == nullptr) {
+          return nullptr;
+        }
+        return MakeCompareNode<BinaryCompareNode>(
+            expr.op(), slot, lhs_index,
+            checked_cast<const BaseBinaryScalar&>(*rhs).value);
+      default:
+        return nullptr;
+    }
+  }
+
+  const Schema& schema_;
+  int num_slots_ = 0;
+  int num_fused_ = 0;
+};
+
+}  // namespace
+
+// A boolean expression lowered against a schema
+class FusedEvaluator::Program {
+ public:
+  static std::shared_ptr<Program> Compile(const Expression& expr,
+                                          std::shared_ptr<Schema> schema) {
+    auto program = std::make_shared<Program>();
+    program->expr_ = expr.Copy();
+    program->schema_ = std::move(schema);
+#if ARROW_LITTLE_ENDIAN
+    auto type = expr.Validate(*program->schema_);
+    if (type.ok() && type.ValueOrDie()->id() == Type::BOOL) {
+      FusedCompiler compiler(*program->schema_);
+      auto root = compiler.Compile(program->expr_);
+      // Evaluate the whole batch at once if nothing would be fused
+      if (compiler.num_fused() > 0) {
+        program->root_ = std::move(root);
+        program->num_slots_ = compiler.num_slots();
+      }
+    }
+#endif
+    return program;
+  }
+
+  bool Matches(const Expression& expr, const Schema& schema) const {
+    return (schema_.get() == &schema || schema_->Equals(schema, false)) &&
+           expr_->Equals(expr);
+  }
+
+  Result<Datum> Execute(const TreeEvaluator& fallback, const RecordBatch& batch,
+                        MemoryPool* pool) const {
+    if (root_ == nullptr) {
+      return fallback.Evaluate(*expr_, batch, pool);
+    }
+
+    const int64_t length = batch.num_rows();
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> values, AllocateBitmap(length, pool));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> validity,
+                          AllocateBitmap(length, pool));
+    FusedScratch scratch(num_slots_, pool);
+    for (int64_t offset = 0; offset < length; offset += kFusedChunkLength) {
+      const int64_t chunk_length = std::min(kFusedChunkLength, length - offset);
+      RETURN_NOT_OK(root_->Evaluate(batch, offset, chunk_length, &scratch));
+      const auto num_bytes = static_cast<size_t>(BitUtil::BytesForBits(chunk_length));
+      std::memcpy(values->mutable_data() + offset / 8, scratch.values(root_->slot()),
+                  num_bytes);
+      std::memcpy(validity->mutable_data() + offset / 8,
+                  scratch.validity(root_->slot()), num_bytes);
+    }
+
+    const int64_t null_count =
+        length - arrow::internal::CountSetBits(validity->data(), 0, length);
+    if (null_count == 0) {
+      validity = nullptr;
+    }
+    return Datum(ArrayData::Make(boolean(), length,
+                                 {std::move(validity), std::move(values)}, null_count));
+  }
+
+ private:
+  std::shared_ptr<Expression> expr_;
+  std::shared_ptr<Schema> schema_;
+  std::unique_ptr<FusedNode> root_;
+  int num_slots_ = 0;
+};
+
+FusedEvaluator::FusedEvaluator() = default;
+
+FusedEvaluator::~FusedEvaluator() = default;
+
+std::shared_ptr<FusedEvaluator::Program> FusedEvaluator::GetProgram(
+    const Expression& expr, const std::shared_ptr<Schema>& schema) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto& program : programs_) {
+    if (program->Matches(expr, *schema)) {
+      return program;
+    }
+  }
+  if (programs_.size() >= kMaxPrograms) {
+    programs_.erase(programs_.begin());
+  }
+  programs_.push_back(Program::Compile(expr, schema));
+  return programs_.back();
+}
+
+Result<Datum> FusedEvaluator::Evaluate(const Expression& expr, const RecordBatch& batch,
+                                       MemoryPool* pool) const {
+  return GetProgram(expr, batch.schema())->Execute(fallback_, batch, pool);
+}
+
+Result<std::shared_ptr<RecordBatch>> FusedEvaluator::Filter(
+    const Datum& selection, const std::shared_ptr<RecordBatch>& batch,
+    MemoryPool* pool) const {
+  return fallback_.Filter(selection, batch, pool);
+}
+
+#ifndef ARROW_DATASET_WITH_GANDIVA
+// Defined in filter_gandiva.cc otherwise
+Result<std::shared_ptr<ExpressionEvaluator>> MakeGandivaEvaluator(
+    std::shared_ptr<ExpressionEvaluator> fallback) {
+  return Status::NotImplemented("Gandiva evaluator: Arrow was built without Gandiva");
+}
+#endif
+
 std::shared_ptr<Expression> scalar(bool value) { return scalar(MakeScalar(value)); }
 
 // Serialization is accomplished by converting expressions to single element StructArrays
@@ -1664,11 +2452,59 @@ class StructDictionary {
   ArrayVector dictionaries_;
 };
 
+namespace {
+
+// Group rows with a single hashing pass assigning group ids, followed by a
+// counting sort of the row indices by group id.  Groups appear in order of
+// first appearance, and rows keep their order within each group.
+Result<std::shared_ptr<StructArray>> MakeGroupingsWithGrouper(
+    const StructArray& by, compute::internal::Grouper* grouper,
+    std::vector<Datum> keys) {
+  using compute::internal::Grouper;
+
+  compute::ExecBatch batch(std::move(keys), by.length());
+  ARROW_ASSIGN_OR_RAISE(Datum ids, grouper->Consume(batch));
+  ARROW_ASSIGN_OR_RAISE(
+      auto groupings,
+      Grouper::MakeGroupings(UInt32Array(ids.array()), grouper->num_groups()));
+
+  ARROW_ASSIGN_OR_RAISE(auto uniques, grouper->GetUniques());
+  ArrayVector unique_columns;
+  for (const auto& unique : uniques.values) {
+    unique_columns.push_back(unique.make_array());
+  }
+  ARROW_ASSIGN_OR_RAISE(auto unique_rows, StructArray::Make(std::move(unique_columns),
+                                                           by.type()->fields()));
+
+  return StructArray::Make(
+      ArrayVector{std::move(unique_rows), std::shared_ptr<Array>(std::move(groupings))},
+      std::vector<std::string>{"values", "groupings"});
+}
+
+}  // namespace
+
 Result<std::shared_ptr<StructArray>> MakeGroupings(const StructArray& by) {
   if (by.num_fields() == 0) {
     return Status::NotImplemented("Grouping with no criteria");
   }
 
+  std::vector<ValueDescr> descrs;
+  std::vector<Datum> keys;
+  for (const auto& column : by.fields()) {
+    descrs.push_back(ValueDescr::Array(column->type()));
+    keys.emplace_back(column);
+  }
+  auto maybe_grouper = compute::internal::Grouper::Make(descrs);
+  if (maybe_grouper.ok()) {
+    return MakeGroupingsWithGrouper(by, maybe_grouper.ValueOrDie().get(),
+                                    std::move(keys));
+  }
+  if (!maybe_grouper.status().IsNotImplemented()) {
+    return maybe_grouper.status();
+  }
+
+  // Key types which can't be hashed directly (such as dictionaries) are
+  // dictionary encoded and sorted instead
   ARROW_ASSIGN_OR_RAISE(auto fused, StructDictionary::Encode(by.fields()));
 
   ARROW_ASSIGN_OR_RAISE(auto sort_indices, compute::SortToIndices(*fused.indices));
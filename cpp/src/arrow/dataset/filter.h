@@ -21,6 +21,7 @@
 
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -651,6 +652,55 @@ class ARROW_DS_EXPORT TreeEvaluator : public ExpressionEvaluator {
   struct Impl;
 };
 
+/// construct an Evaluator which lowers boolean expressions once per schema into
+/// a program of fused kernels, evaluated in cache-sized chunks of each batch
+///
+/// Comparisons of columns with scalars or columns of the same type, boolean and
+/// validity columns, and their conjunctions, disjunctions and negations are
+/// computed on bitmaps reused across chunks, without intermediate arrays.  The
+/// right operand of a conjunction (resp. disjunction) is skipped on chunks where
+/// the left operand is false (resp. true) for every row.  Other subexpressions
+/// are evaluated by a TreeEvaluator.
+class ARROW_DS_EXPORT FusedEvaluator : public ExpressionEvaluator {
+ public:
+  FusedEvaluator();
+  ~FusedEvaluator() override;
+
+  Result<Datum> Evaluate(const Expression& expr, const RecordBatch& batch,
+                         MemoryPool* pool) const override;
+
+  Result<std::shared_ptr<RecordBatch>> Filter(const Datum& selection,
+                                              const std::shared_ptr<RecordBatch>& batch,
+                                              MemoryPool* pool) const override;
+
+ private:
+  class Program;
+
+  std::shared_ptr<Program> GetProgram(const Expression& expr,
+                                      const std::shared_ptr<Schema>& schema) const;
+
+  static constexpr size_t kMaxPrograms = 16;
+
+  TreeEvaluator fallback_;
+  mutable std::mutex mutex_;
+  // Programs of the most recently evaluated expressions
+  mutable std::vector<std::shared_ptr<Program>> programs_;
+};
+
+/// \brief Construct an Evaluator which compiles boolean expressions with Gandiva
+///
+/// Each expression is translated once per schema into a gandiva::Filter, whose
+/// compiled code is shared through Gandiva's cache.  Rows satisfying the expression
+/// evaluate to true and all other rows, including those where the expression is null,
+/// evaluate to false; filtering drops both alike.  Expressions which Gandiva can't
+/// compile, and filtering by the resulting selections, are delegated to `fallback`
+/// (a FusedEvaluator if null).
+///
+/// \return NotImplemented if Arrow was built without Gandiva
+ARROW_DS_EXPORT
+Result<std::shared_ptr<ExpressionEvaluator>> MakeGandivaEvaluator(
+    std::shared_ptr<ExpressionEvaluator> fallback = NULLPTR);
+
 /// \brief Assemble lists of indices of identical rows.
 ///
 /// \param[in] by A StructArray whose columns will be used as grouping criteria.
@@ -0,0 +1,347 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Evaluation of dataset filters through Gandiva, compiled only with ARROW_GANDIVA
+
+#include "arrow/dataset/filter.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+
+#include "gandiva/filter.h"
+#include "gandiva/selection_vector.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace dataset {
+
+namespace {
+
+using gandiva::TreeExprBuilder;
+
+// Translate an Expression into a Gandiva expression tree, or return null if some
+// subexpression has no Gandiva equivalent.
+class GandivaTranslator {
+ public:
+  explicit GandivaTranslator(const Schema& schema) : schema_(schema) {}
+
+  gandiva::NodePtr Translate(const Expression& expr) const {
+    switch (expr.type()) {
+      case ExpressionType::FIELD: {
+        auto field =
+            schema_.GetFieldByName(checked_cast<const FieldExpression&>(expr).name());
+        if (field == nullptr) {
+          return nullptr;
+        }
+        return TreeExprBuilder::MakeField(std::move(field));
+      }
+
+      case ExpressionType::SCALAR:
+        return TranslateScalar(*checked_cast<const ScalarExpression&>(expr).value());
+
+      case ExpressionType::CAST: {
+        // Only casts of literals, which are folded here
+        const auto& cast = checked_cast<const CastExpression&>(expr);
+        if (cast.operand()->type() != ExpressionType::SCALAR ||
+            cast.to_type() == nullptr) {
+          return nullptr;
+        }
+        const auto& value =
+            checked_cast<const ScalarExpression&>(*cast.operand()).value();
+        auto cast_value = value->CastTo(cast.to_type());
+        if (!cast_value.ok()) {
+          return nullptr;
+        }
+        return TranslateScalar(*cast_value.ValueOrDie());
+      }
+
+      case ExpressionType::NOT: {
+        auto operand = Translate(*checked_cast<const NotExpression&>(expr).operand());
+        if (operand == nullptr) {
+          return nullptr;
+        }
+        return TreeExprBuilder::MakeFunction("not", {std::move(operand)}, boolean());
+      }
+
+      case ExpressionType::IS_VALID: {
+        auto operand =
+            Translate(*checked_cast<const IsValidExpression&>(expr).operand());
+        if (operand == nullptr) {
+          return nullptr;
+        }
+        return TreeExprBuilder::MakeFunction("isnotnull", {std::move(operand)},
+                                             boolean());
+      }
+
+      case ExpressionType::AND:
+      case ExpressionType::OR: {
+        const auto& binary = checked_cast<const BinaryExpression&>(expr);
+        auto left = Translate(*binary.left_operand());
+        auto right = Translate(*binary.right_operand());
+        if (left == nullptr || right == nullptr) {
+          return nullptr;
+        }
+        gandiva::NodeVector children{std::move(left), std::move(right)};
+        return expr.type() == ExpressionType::AND ? TreeExprBuilder::MakeAnd(children)
+                                                  : TreeExprBuilder::MakeOr(children);
+      }
+
+      case ExpressionType::COMPARISON: {
+        const auto& comparison = checked_cast<const ComparisonExpression&>(expr);
+        auto left = Translate(*comparison.left_operand());
+        auto right = Translate(*comparison.right_operand());
+        if (left == nullptr || right == nullptr) {
+          return nullptr;
+        }
+        return TreeExprBuilder::MakeFunction(ComparisonFunction(comparison.op()),
+                                             {std::move(left), std::move(right)},
+                                             boolean());
+      }
+
+      case ExpressionType::IN:
+        return TranslateIn(checked_cast<const InExpression&>(expr));
+
+      default:
+        return nullptr;
+    }
+  }
+
+ private:
+  static std::string ComparisonFunction(CompareOperator op) {
+    switch (op) {
+      case CompareOperator::EQUAL:
+        return "equal";
+      case CompareOperator::NOT_EQUAL:
+        return "not_equal";
+      case CompareOperator::GREATER:
+        return "greater_than";
+      case CompareOperator::GREATER_EQUAL:
+        return "greater_than_or_equal_to";
+      case CompareOperator::LESS:
+        return "less_than";
+      case CompareOperator::LESS_EQUAL:
+        return "less_than_or_equal_to";
+    }
+    return "";
+  }
+
+  template <typename ScalarType>
+  static gandiva::NodePtr MakeNumericLiteral(const Scalar& value) {
+    return TreeExprBuilder::MakeLiteral(checked_cast<const ScalarType&>(value).value);
+  }
+
+  static gandiva::NodePtr TranslateScalar(const Scalar& value) {
+    if (!value.is_valid) {
+      return TreeExprBuilder::MakeNull(value.type);
+    }
+    switch (value.type->id()) {
+      case Type::BOOL:
+        return MakeNumericLiteral<BooleanScalar>(value);
+      case Type::INT8:
+        return MakeNumericLiteral<Int8Scalar>(value);
+      case Type::INT16:
+        return MakeNumericLiteral<Int16Scalar>(value);
+      case Type::INT32:
+        return MakeNumericLiteral<Int32Scalar>(value);
+      case Type::INT64:
+        return MakeNumericLiteral<Int64Scalar>(value);
+      case Type::UINT8:
+        return MakeNumericLiteral<UInt8Scalar>(value);
+      case Type::UINT16:
+        return MakeNumericLiteral<UInt16Scalar>(value);
+      case Type::UINT32:
+        return MakeNumericLiteral<UInt32Scalar>(value);
+      case Type::UINT64:
+        return MakeNumericLiteral<UInt64Scalar>(value);
+      case Type::FLOAT:
+        return MakeNumericLiteral<FloatScalar>(value);
+      case Type::DOUBLE:
+        return MakeNumericLiteral<DoubleScalar>(value);
+      case Type::STRING:
+        return TreeExprBuilder::MakeStringLiteral(
+            checked_cast<const StringScalar&>(value).value->ToString());
+      case Type::BINARY:
+        return TreeExprBuilder::MakeBinaryLiteral(
+            checked_cast<const BinaryScalar&>(value).value->ToString());
+      default:
+        return nullptr;
+    }
+  }
+
+  template <typename ArrayType, typename T>
+  static std::unordered_set<T> SetValues(const Array& set) {
+    std::unordered_set<T> values;
+    const auto& typed_set = checked_cast<const ArrayType&>(set);
+    for (int64_t i = 0; i < typed_set.length(); ++i) {
+      values.insert(static_cast<T>(typed_set.GetView(i)));
+    }
+    return values;
+  }
+
+  gandiva::NodePtr TranslateIn(const InExpression& expr) const {
+    const auto& set = *expr.set();
+    // Gandiva never matches nulls, unlike InExpression
+    if (set.null_count() != 0) {
+      return nullptr;
+    }
+    auto operand = Translate(*expr.operand());
+    if (operand == nullptr) {
+      return nullptr;
+    }
+    switch (set.type_id()) {
+      case Type::INT32:
+        return TreeExprBuilder::MakeInExpressionInt32(
+            std::move(operand), SetValues<Int32Array, int32_t>(set));
+      case Type::INT64:
+        return TreeExprBuilder::MakeInExpressionInt64(
+            std::move(operand), SetValues<Int64Array, int64_t>(set));
+      case Type::STRING:
+        return TreeExprBuilder::MakeInExpressionString(
+            std::move(operand), SetValues<StringArray, std::string>(set));
+      case Type::BINARY:
+        return TreeExprBuilder::MakeInExpressionBinary(
+            std::move(operand), SetValues<BinaryArray, std::string>(set));
+      default:
+        return nullptr;
+    }
+  }
+
+  const Schema& schema_;
+};
+
+// An expression compiled against a schema, or a null filter if Gandiva can't
+// compile it
+struct GandivaProgram {
+  GandivaProgram(const Expression& expr, std::shared_ptr<Schema> schema)
+      : expr(expr.Copy()), schema(std::move(schema)) {
+    auto type = expr.Validate(*this->schema);
+    if (!type.ok() || type.ValueOrDie()->id() != Type::BOOL) {
+      return;
+    }
+    auto root = GandivaTranslator(*this->schema).Translate(expr);
+    if (root == nullptr) {
+      return;
+    }
+    std::shared_ptr<gandiva::Filter> compiled;
+    if (gandiva::Filter::Make(this->schema, TreeExprBuilder::MakeCondition(root),
+                              &compiled)
+            .ok()) {
+      filter = std::move(compiled);
+    }
+  }
+
+  bool Matches(const Expression& other_expr, const Schema& other_schema) const {
+    return (schema.get() == &other_schema || schema->Equals(other_schema, false)) &&
+           expr->Equals(other_expr);
+  }
+
+  std::shared_ptr<Expression> expr;
+  std::shared_ptr<Schema> schema;
+  std::shared_ptr<gandiva::Filter> filter;
+};
+
+class GandivaEvaluator : public ExpressionEvaluator {
+ public:
+  explicit GandivaEvaluator(std::shared_ptr<ExpressionEvaluator> fallback)
+      : fallback_(std::move(fallback)) {}
+
+  Result<Datum> Evaluate(const Expression& expr, const RecordBatch& batch,
+                         MemoryPool* pool) const override {
+    // Gandiva rejects empty batches
+    const int64_t length = batch.num_rows();
+    if (length == 0) {
+      return fallback_->Evaluate(expr, batch, pool);
+    }
+    auto program = GetProgram(expr, batch.schema());
+    if (program->filter == nullptr) {
+      return fallback_->Evaluate(expr, batch, pool);
+    }
+
+    std::shared_ptr<gandiva::SelectionVector> selected;
+    RETURN_NOT_OK(gandiva::SelectionVector::MakeInt32(length, pool, &selected));
+    RETURN_NOT_OK(program->filter->Evaluate(batch, selected));
+
+    ARROW_ASSIGN_OR_RAISE(auto values, AllocateEmptyBitmap(length, pool));
+    uint8_t* bitmap = values->mutable_data();
+    const int64_t num_selected = selected->GetNumSlots();
+    for (int64_t i = 0; i < num_selected; ++i) {
+      BitUtil::SetBit(bitmap, static_cast<int64_t>(selected->GetIndex(i)));
+    }
+    return Datum(ArrayData::Make(boolean(), length, {nullptr, std::move(values)},
+                                 /*null_count=*/0));
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Filter(const Datum& selection,
+                                              const std::shared_ptr<RecordBatch>& batch,
+                                              MemoryPool* pool) const override {
+    return fallback_->Filter(selection, batch, pool);
+  }
+
+ private:
+  static constexpr size_t kMaxPrograms = 16;
+
+  std::shared_ptr<GandivaProgram> GetProgram(
+      const Expression& expr, const std::shared_ptr<Schema>& schema) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& program : programs_) {
+      if (program->Matches(expr, *schema)) {
+        return program;
+      }
+    }
+    if (programs_.size() >= kMaxPrograms) {
+      programs_.erase(programs_.begin());
+    }
+    programs_.push_back(std::make_shared<GandivaProgram>(expr, schema));
+    return programs_.back();
+  }
+
+  std::shared_ptr<ExpressionEvaluator> fallback_;
+  mutable std::mutex mutex_;
+  // Programs of the most recently evaluated expressions
+  mutable std::vector<std::shared_ptr<GandivaProgram>> programs_;
+};
+
+constexpr size_t GandivaEvaluator::kMaxPrograms;
+
+}  // namespace
+
+Result<std::shared_ptr<ExpressionEvaluator>> MakeGandivaEvaluator(
+    std::shared_ptr<ExpressionEvaluator> fallback) {
+  if (fallback == nullptr) {
+    fallback = std::make_shared<FusedEvaluator>();
+  }
+  return std::make_shared<GandivaEvaluator>(std::move(fallback));
+}
+
+}  // namespace dataset
+}  // namespace arrow
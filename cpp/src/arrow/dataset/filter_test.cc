@@ -30,6 +30,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/checked_cast.h"
@@ -444,6 +445,264 @@ TEST_F(FilterTest, KleeneTruthTables) {
   ])");
 }
 
+TEST_F(FilterTest, ScalarOperandsOfBoolean) {
+  auto null_boolean = scalar(std::make_shared<BooleanScalar>());
+  std::vector<std::shared_ptr<Field>> fields = {field("b", boolean())};
+
+  // A scalar which determines the result is not broadcast
+  for (auto expr :
+       {and_(scalar(false), field_ref("b")), and_(field_ref("b"), scalar(false)),
+        and_(null_boolean, scalar(false))}) {
+    ASSERT_OK_AND_ASSIGN(auto mask, DoFilter(*expr, fields, R"([{"b": true, "in": 0}])"));
+    ASSERT_TRUE(mask.is_scalar()) << expr->ToString();
+    AssertFilter(expr, fields, R"([
+      {"b": true,  "in": 0},
+      {"b": false, "in": 0},
+      {"b": null,  "in": 0}
+    ])");
+  }
+
+  for (auto expr : {or_(scalar(true), field_ref("b")), or_(field_ref("b"), scalar(true)),
+                    or_(null_boolean, scalar(true))}) {
+    ASSERT_OK_AND_ASSIGN(auto mask, DoFilter(*expr, fields, R"([{"b": true, "in": 1}])"));
+    ASSERT_TRUE(mask.is_scalar()) << expr->ToString();
+    AssertFilter(expr, fields, R"([
+      {"b": true,  "in": 1},
+      {"b": false, "in": 1},
+      {"b": null,  "in": 1}
+    ])");
+  }
+
+  // Otherwise the result is the other operand
+  for (auto expr :
+       {and_(scalar(true), field_ref("b")), or_(field_ref("b"), scalar(false))}) {
+    AssertFilter(expr, fields, R"([
+      {"b": true,  "in": 1},
+      {"b": false, "in": 0},
+      {"b": null,  "in": null}
+    ])");
+  }
+
+  // Null scalars follow Kleene logic
+  AssertFilter(and_(null_boolean, field_ref("b")), fields, R"([
+      {"b": true,  "in": null},
+      {"b": false, "in": 0},
+      {"b": null,  "in": null}
+  ])");
+  AssertFilter(or_(field_ref("b"), null_boolean), fields, R"([
+      {"b": true,  "in": 1},
+      {"b": false, "in": null},
+      {"b": null,  "in": null}
+  ])");
+  for (auto expr : {and_(scalar(true), null_boolean), or_(null_boolean, scalar(false)),
+                    and_(null_boolean, null_boolean), or_(null_boolean, null_boolean)}) {
+    ASSERT_OK_AND_ASSIGN(auto mask, DoFilter(*expr, fields, R"([{"b": true, "in": 1}])"));
+    ASSERT_TRUE(mask.is_scalar()) << expr->ToString();
+    AssertFilter(expr, fields, R"([
+      {"b": true,  "in": null},
+      {"b": false, "in": null}
+    ])");
+  }
+}
+
+TEST_F(FilterTest, ScalarOnTheLeftOfComparison) {
+  std::vector<std::shared_ptr<Field>> fields = {field("a", int32())};
+
+  AssertFilter(less(scalar(1), field_ref("a")), fields, R"([
+      {"a": 0,    "in": 0},
+      {"a": 1,    "in": 0},
+      {"a": 2,    "in": 1},
+      {"a": null, "in": null}
+  ])");
+
+  AssertFilter(greater_equal(scalar(1), field_ref("a")), fields, R"([
+      {"a": 0,    "in": 1},
+      {"a": 1,    "in": 1},
+      {"a": 2,    "in": 0},
+      {"a": null, "in": null}
+  ])");
+
+  AssertFilter(not_equal(scalar(1), field_ref("a")), fields, R"([
+      {"a": 0,    "in": 1},
+      {"a": 1,    "in": 0},
+      {"a": 2,    "in": 1},
+      {"a": null, "in": null}
+  ])");
+
+  AssertFilter(greater(scalar(std::make_shared<Int32Scalar>()), field_ref("a")), fields,
+               R"([
+      {"a": 0,    "in": null},
+      {"a": 1,    "in": null},
+      {"a": null, "in": null}
+  ])");
+}
+
+TEST_F(FilterTest, InExpressionOfScalar) {
+  auto hello_world = ArrayFromJSON(utf8(), R"(["hello", "world"])");
+  auto hello_null = ArrayFromJSON(utf8(), R"(["hello", null])");
+  std::vector<std::shared_ptr<Field>> fields = {field("a", int32())};
+
+  auto AssertScalarFilter = [&](const InExpression& expr, bool expected) {
+    ASSERT_OK_AND_ASSIGN(auto mask, DoFilter(expr, fields, R"([{"a": 0, "in": 0}])"));
+    ASSERT_TRUE(mask.is_scalar()) << expr.ToString();
+    ASSERT_TRUE(mask.scalar()->Equals(BooleanScalar(expected))) << expr.ToString();
+  };
+
+  AssertScalarFilter(scalar("hello")->In(hello_world), true);
+  AssertScalarFilter(scalar("foo")->In(hello_world), false);
+  AssertScalarFilter(scalar("foo")->In(hello_null), false);
+
+  // A null scalar is in a set containing null
+  auto null_string = scalar(std::make_shared<StringScalar>());
+  AssertScalarFilter(null_string->In(hello_world), false);
+  AssertScalarFilter(null_string->In(hello_null), true);
+}
+
+class FusedFilterTest : public FilterTest {
+ public:
+  FusedFilterTest() { evaluator_ = std::make_shared<FusedEvaluator>(); }
+};
+
+TEST_F(FusedFilterTest, Basics) {
+  AssertFilter("a"_ == 0 and "b"_ > 0.0 and "b"_ < 1.0,
+               {field("a", int32()), field("b", float64())}, R"([
+      {"a": 0, "b": -0.1, "in": 0},
+      {"a": 0, "b":  0.3, "in": 1},
+      {"a": 1, "b":  0.2, "in": 0},
+      {"a": 2, "b": -0.1, "in": 0},
+      {"a": 0, "b":  0.1, "in": 1},
+      {"a": 0, "b": null, "in": null},
+      {"a": 0, "b":  1.0, "in": 0}
+  ])");
+
+  AssertFilter(not("s"_ == std::string("x")) or "a"_ >= "c"_,
+               {field("a", int32()), field("c", int32()), field("s", utf8())}, R"([
+      {"a": 0, "c": 1,    "s": "x",  "in": 0},
+      {"a": 1, "c": 1,    "s": "x",  "in": 1},
+      {"a": 0, "c": 1,    "s": "y",  "in": 1},
+      {"a": 0, "c": null, "s": "x",  "in": null},
+      {"a": 0, "c": null, "s": "",   "in": 1},
+      {"a": 0, "c": 0,    "s": null, "in": 1}
+  ])");
+}
+
+TEST_F(FusedFilterTest, KleeneTruthTables) {
+  AssertFilter("a"_ and "b"_, {field("a", boolean()), field("b", boolean())}, R"([
+    {"a":null,  "b":null,  "in":null},
+    {"a":null,  "b":true,  "in":null},
+    {"a":null,  "b":false, "in":false},
+    {"a":true,  "b":null,  "in":null},
+    {"a":true,  "b":true,  "in":true},
+    {"a":true,  "b":false, "in":false},
+    {"a":false, "b":null,  "in":false},
+    {"a":false, "b":false, "in":false}
+  ])");
+
+  AssertFilter("a"_ or "b"_, {field("a", boolean()), field("b", boolean())}, R"([
+    {"a":null,  "b":null,  "in":null},
+    {"a":null,  "b":true,  "in":true},
+    {"a":null,  "b":false, "in":null},
+    {"a":true,  "b":null,  "in":true},
+    {"a":true,  "b":true,  "in":true},
+    {"a":true,  "b":false, "in":true},
+    {"a":false, "b":null,  "in":null},
+    {"a":false, "b":false, "in":false}
+  ])");
+}
+
+TEST_F(FusedFilterTest, ConditionOnAbsentColumn) {
+  AssertFilter("a"_ == 0 and "b"_ > 3, {field("a", int32())}, R"([
+      {"a": 0, "in": null},
+      {"a": 1, "in": 0}
+  ])");
+}
+
+TEST(FusedEvaluator, MatchesTreeEvaluator) {
+  // Several chunks, and a slice so that the columns have offsets
+  const int64_t length = 10000;
+  random::RandomArrayGenerator rng(42);
+  auto batch = RecordBatch::Make(
+      schema({field("i", int32()), field("j", int32()), field("d", float64()),
+              field("b", boolean()), field("s", utf8())}),
+      length,
+      {rng.Int32(length, 0, 100, 0.1), rng.Int32(length, 0, 100, 0.0),
+       rng.Float64(length, 0, 1, 0.2), rng.Boolean(length, 0.5, 0.1),
+       rng.String(length, 0, 2, 0.1)});
+
+  auto hello_world = ArrayFromJSON(utf8(), R"(["a", "b"])");
+  std::vector<std::shared_ptr<Expression>> exprs = {
+      ("i"_ > 10 and "d"_ < 0.5).Copy(),
+      ("i"_ == 3 or "b"_).Copy(),
+      (not("s"_ == std::string("ab")) and "i"_.IsValid()).Copy(),
+      ("i"_ >= "j"_ or "d"_ <= 0.1).Copy(),
+      (("i"_ < 5 and "d"_ > 0.9) or "s"_.In(hello_world)).Copy(),
+      // The right operand is never evaluated
+      ("i"_ > 1000 and "s"_ < std::string("b")).Copy(),
+      ("b"_ or "j"_ >= 0).Copy(),
+  };
+
+  TreeEvaluator tree;
+  FusedEvaluator fused;
+  for (auto sliced : {batch, batch->Slice(3, length - 10)}) {
+    for (const auto& expr : exprs) {
+      SCOPED_TRACE(expr->ToString());
+      ASSERT_OK_AND_ASSIGN(auto expected,
+                           tree.Evaluate(*expr, *sliced, default_memory_pool()));
+      // Evaluate twice to use the cached program
+      for (int i = 0; i < 2; ++i) {
+        ASSERT_OK_AND_ASSIGN(auto actual,
+                             fused.Evaluate(*expr, *sliced, default_memory_pool()));
+        AssertArraysEqual(*expected.make_array(), *actual.make_array(),
+                          /*verbose=*/true);
+      }
+    }
+  }
+}
+
+TEST(GandivaEvaluator, MatchesTreeEvaluator) {
+  auto maybe_gandiva = MakeGandivaEvaluator();
+  if (maybe_gandiva.status().IsNotImplemented()) {
+    ARROW_LOG(INFO) << "Gandiva not available, skipping";
+    return;
+  }
+  ASSERT_OK_AND_ASSIGN(auto gandiva, maybe_gandiva);
+
+  const int64_t length = 1000;
+  random::RandomArrayGenerator rng(42);
+  auto batch = RecordBatch::Make(
+      schema({field("i", int32()), field("d", float64()), field("b", boolean()),
+              field("s", utf8())}),
+      length,
+      {rng.Int32(length, 0, 100, 0.1), rng.Float64(length, 0, 1, 0.2),
+       rng.Boolean(length, 0.5, 0.1), rng.String(length, 0, 2, 0.1)});
+
+  std::vector<std::shared_ptr<Expression>> exprs = {
+      ("i"_ > 10 and "d"_ < 0.5).Copy(),
+      ("i"_ == 3 or "b"_).Copy(),
+      (not("s"_ == std::string("ab")) and "i"_.IsValid()).Copy(),
+      "s"_.In(ArrayFromJSON(utf8(), R"(["a", "b"])")).Copy(),
+      // Not compiled, since Gandiva doesn't match nulls
+      "i"_.In(ArrayFromJSON(int32(), "[1, null]")).Copy(),
+  };
+
+  TreeEvaluator tree;
+  for (auto sliced : {batch, batch->Slice(3, length - 10)}) {
+    for (const auto& expr : exprs) {
+      SCOPED_TRACE(expr->ToString());
+      // Null and false rows are only equivalent once filtered
+      ASSERT_OK_AND_ASSIGN(auto expected,
+                           tree.Evaluate(*expr, *sliced, default_memory_pool()));
+      ASSERT_OK_AND_ASSIGN(auto expected_batch,
+                           tree.Filter(expected, sliced, default_memory_pool()));
+      ASSERT_OK_AND_ASSIGN(auto actual,
+                           gandiva->Evaluate(*expr, *sliced, default_memory_pool()));
+      ASSERT_OK_AND_ASSIGN(auto actual_batch,
+                           gandiva->Filter(actual, sliced, default_memory_pool()));
+      AssertBatchesEqual(*expected_batch, *actual_batch);
+    }
+  }
+}
+
 class TakeExpression : public CustomExpression {
  public:
   TakeExpression(std::shared_ptr<Expression> operand, std::shared_ptr<Array> dictionary)
@@ -555,6 +814,26 @@ TEST_F(FilterTest, EvaluateTakeExpression) {
   ])");
 }
 
+TEST_F(FilterTest, FilterTrivialSelection) {
+  auto batch = RecordBatchFromJSON(schema({field("a", int32())}), "[[1], [2], [3]]");
+
+  // When all or no rows are selected, nothing needs to be copied
+  ASSERT_OK_AND_ASSIGN(auto filtered,
+                       evaluator_->Filter(ArrayFromJSON(boolean(), "[true, true, true]"),
+                                          batch));
+  ASSERT_EQ(batch, filtered);
+
+  ASSERT_OK_AND_ASSIGN(filtered, evaluator_->Filter(
+                                     ArrayFromJSON(boolean(), "[false, null, false]"),
+                                     batch));
+  ASSERT_EQ(0, filtered->num_rows());
+
+  ASSERT_OK_AND_ASSIGN(filtered, evaluator_->Filter(
+                                     ArrayFromJSON(boolean(), "[true, null, true]"),
+                                     batch));
+  AssertBatchesEqual(*RecordBatchFromJSON(batch->schema(), "[[1], [3]]"), *filtered);
+}
+
 void AssertFieldsInExpression(std::shared_ptr<Expression> expr,
                               std::vector<std::string> expected) {
   EXPECT_THAT(FieldsInExpression(expr), testing::ContainerEq(expected));
@@ -655,5 +934,21 @@ TEST(GroupTest, Basics) {
   ])");
 }
 
+TEST(GroupTest, SingleKey) {
+  AssertGrouping({field("a", int64())}, R"([
+    {"a": 7,    "id": 0},
+    {"a": 3,    "id": 1},
+    {"a": 7,    "id": 2},
+    {"a": null, "id": 3},
+    {"a": 3,    "id": 4},
+    {"a": null, "id": 5}
+  ])",
+                 R"([
+    {"a": 7,    "ids": [0, 2]},
+    {"a": 3,    "ids": [1, 4]},
+    {"a": null, "ids": [3, 5]}
+  ])");
+}
+
 }  // namespace dataset
 }  // namespace arrow
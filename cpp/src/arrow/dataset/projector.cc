@@ -18,6 +18,7 @@
 #include "arrow/dataset/projector.h"
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -61,11 +62,38 @@ Status CheckProjectable(const Schema& from, const Schema& to) {
   return Status::OK();
 }
 
+// The columns of a projector's missing fields, all slots null or equal to the
+// field's default value. A column is materialized on first use and grown when a
+// longer batch needs it; shorter batches get slices of it.
+class RecordBatchProjector::ConstantColumns {
+ public:
+  explicit ConstantColumns(int num_fields) : columns_(num_fields) {}
+
+  Result<std::shared_ptr<Array>> Get(int i, const std::shared_ptr<DataType>& type,
+                                     const std::shared_ptr<Scalar>& scalar,
+                                     int64_t length, MemoryPool* pool) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& column = columns_[i];
+    if (column == nullptr || column->length() < length) {
+      if (scalar == nullptr) {
+        ARROW_ASSIGN_OR_RAISE(column, MakeArrayOfNull(type, length, pool));
+      } else {
+        ARROW_ASSIGN_OR_RAISE(column, MakeArrayFromScalar(*scalar, length, pool));
+      }
+    }
+    return column->Slice(0, length);
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<std::shared_ptr<Array>> columns_;
+};
+
 RecordBatchProjector::RecordBatchProjector(std::shared_ptr<Schema> to)
     : to_(std::move(to)),
-      missing_columns_(to_->num_fields(), nullptr),
       column_indices_(to_->num_fields(), kNoMatch),
-      scalars_(to_->num_fields(), nullptr) {}
+      scalars_(to_->num_fields(), nullptr),
+      constant_columns_(std::make_shared<ConstantColumns>(to_->num_fields())) {}
 
 Status RecordBatchProjector::SetDefaultValue(FieldRef ref,
                                              std::shared_ptr<Scalar> scalar) {
@@ -85,6 +113,9 @@ Status RecordBatchProjector::SetDefaultValue(FieldRef ref,
   }
 
   scalars_[index] = std::move(scalar);
+  // Columns materialized for the previous default values are stale, and copies of
+  // this projector may still be using them
+  constant_columns_ = std::make_shared<ConstantColumns>(to_->num_fields());
   return Status::OK();
 }
 
@@ -94,17 +125,15 @@ Result<std::shared_ptr<RecordBatch>> RecordBatchProjector::Project(
     RETURN_NOT_OK(SetInputSchema(batch.schema(), pool));
   }
 
-  if (missing_columns_length_ < batch.num_rows()) {
-    RETURN_NOT_OK(ResizeMissingColumns(batch.num_rows(), pool));
-  }
-
   std::vector<std::shared_ptr<Array>> columns(to_->num_fields());
 
   for (int i = 0; i < to_->num_fields(); ++i) {
     if (column_indices_[i] != kNoMatch) {
       columns[i] = batch.column(column_indices_[i]);
     } else {
-      columns[i] = missing_columns_[i]->Slice(0, batch.num_rows());
+      ARROW_ASSIGN_OR_RAISE(columns[i],
+                            constant_columns_->Get(i, to_->field(i)->type(), scalars_[i],
+                                                   batch.num_rows(), pool));
     }
   }
 
@@ -119,39 +148,8 @@ Status RecordBatchProjector::SetInputSchema(std::shared_ptr<Schema> from,
   for (int i = 0; i < to_->num_fields(); ++i) {
     ARROW_ASSIGN_OR_RAISE(auto match,
                           FieldRef(to_->field(i)->name()).FindOneOrNone(*from_));
-
-    if (match.indices().empty()) {
-      // Mark column i as missing by setting missing_columns_[i]
-      // to a non-null placeholder.
-      ARROW_ASSIGN_OR_RAISE(missing_columns_[i],
-                            MakeArrayOfNull(to_->field(i)->type(), 0, pool));
-      column_indices_[i] = kNoMatch;
-    } else {
-      // Mark column i as not missing by setting missing_columns_[i] to nullptr
-      missing_columns_[i] = nullptr;
-      column_indices_[i] = match.indices()[0];
-    }
-  }
-  return Status::OK();
-}
-
-Status RecordBatchProjector::ResizeMissingColumns(int64_t new_length, MemoryPool* pool) {
-  // TODO(bkietz) MakeArrayOfNull could use fewer buffers by reusing a single zeroed
-  // buffer for every buffer in every column which is null
-  for (int i = 0; i < to_->num_fields(); ++i) {
-    if (missing_columns_[i] == nullptr) {
-      continue;
-    }
-    if (scalars_[i] == nullptr) {
-      ARROW_ASSIGN_OR_RAISE(
-          missing_columns_[i],
-          MakeArrayOfNull(missing_columns_[i]->type(), new_length, pool));
-      continue;
-    }
-    ARROW_ASSIGN_OR_RAISE(missing_columns_[i],
-                          MakeArrayFromScalar(*scalars_[i], new_length, pool));
+    column_indices_[i] = match.indices().empty() ? kNoMatch : match.indices()[0];
   }
-  missing_columns_length_ = new_length;
   return Status::OK();
 }
 
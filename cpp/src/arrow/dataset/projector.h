@@ -40,6 +40,10 @@ ARROW_DS_EXPORT Status CheckProjectable(const Schema& from, const Schema& to);
 /// RecordBatchProjector is most efficient when projecting record batches with a
 /// consistent schema (for example batches from a table), but it can project record
 /// batches having any schema.
+///
+/// Copies of a projector share the null and constant columns materialized for
+/// missing fields, so copying it per thread or per batch is cheap and Project() can
+/// then be called concurrently on the copies.
 class ARROW_DS_EXPORT RecordBatchProjector {
  public:
   static constexpr int kNoMatch = -1;
@@ -61,14 +65,16 @@ class ARROW_DS_EXPORT RecordBatchProjector {
                         MemoryPool* pool = default_memory_pool());
 
  private:
-  Status ResizeMissingColumns(int64_t new_length, MemoryPool* pool);
+  class ConstantColumns;
 
   std::shared_ptr<Schema> from_, to_;
-  int64_t missing_columns_length_ = 0;
   // these vectors are indexed parallel to to_->fields()
-  std::vector<std::shared_ptr<Array>> missing_columns_;
   std::vector<int> column_indices_;
   std::vector<std::shared_ptr<Scalar>> scalars_;
+  // The null or scalar-valued columns added for missing fields. They are only
+  // materialized when a projected batch lacks the field, and are shared (and
+  // reused) by all copies of the projector.
+  std::shared_ptr<ConstantColumns> constant_columns_;
 };
 
 }  // namespace dataset
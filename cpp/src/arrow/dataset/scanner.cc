@@ -18,8 +18,15 @@
 #include "arrow/dataset/scanner.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/dataset_internal.h"
@@ -29,6 +36,7 @@
 #include "arrow/util/iterator.h"
 #include "arrow/util/task_group.h"
 #include "arrow/util/thread_pool.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace dataset {
@@ -43,20 +51,45 @@ std::shared_ptr<ScanOptions> ScanOptions::ReplaceSchema(
   copy->filter = filter;
   copy->evaluator = evaluator;
   copy->batch_size = batch_size;
+  copy->batch_size_bytes = batch_size_bytes;
+  copy->normalize_batches = normalize_batches;
+  copy->fragment_readahead = fragment_readahead;
+  copy->batch_readahead = batch_readahead;
+  copy->readahead_bytes = readahead_bytes;
+  copy->limit = limit;
+  copy->use_gandiva = use_gandiva;
+  for (const auto& computed : computed_columns) {
+    if (copy->schema()->GetFieldIndex(computed.first) != -1) {
+      copy->computed_columns.push_back(computed);
+    }
+  }
   return copy;
 }
 
 std::vector<std::string> ScanOptions::MaterializedFields() const {
   std::vector<std::string> fields;
 
+  std::unordered_set<std::string> computed_names;
+  for (const auto& computed : computed_columns) {
+    computed_names.insert(computed.first);
+  }
+
   for (const auto& f : schema()->fields()) {
-    fields.push_back(f->name());
+    if (computed_names.count(f->name()) == 0) {
+      fields.push_back(f->name());
+    }
   }
 
   for (auto&& name : FieldsInExpression(filter)) {
     fields.push_back(std::move(name));
   }
 
+  for (const auto& computed : computed_columns) {
+    for (auto&& name : FieldsInExpression(computed.second)) {
+      fields.push_back(std::move(name));
+    }
+  }
+
   return fields;
 }
 
@@ -79,7 +112,15 @@ Result<ScanTaskIterator> Scanner::Scan() {
   // Transforms Iterator<Fragment> into a unified
   // Iterator<ScanTask>. The first Iterator::Next invocation is going to do
   // all the work of unwinding the chained iterators.
-  return GetScanTaskIterator(GetFragments(), scan_options_, scan_context_);
+  if (scan_options_->limit < 0) {
+    return GetScanTaskIterator(GetFragments(), scan_options_, scan_context_);
+  }
+  auto row_limit = std::make_shared<RowLimit>(scan_options_->limit);
+  auto fragments = LimitFragments(GetFragments(), scan_options_->limit,
+                                  !scan_options_->filter->Equals(true), row_limit);
+  return LimitScanTasks(
+      GetScanTaskIterator(std::move(fragments), scan_options_, scan_context_),
+      std::move(row_limit));
 }
 
 Result<ScanTaskIterator> ScanTaskIteratorFromRecordBatch(
@@ -112,6 +153,20 @@ Status ScannerBuilder::Project(std::vector<std::string> columns) {
   return Status::OK();
 }
 
+Status ScannerBuilder::AddComputedColumn(std::string name,
+                                         std::shared_ptr<Expression> expression) {
+  if (schema()->GetFieldIndex(name) != -1 ||
+      std::any_of(computed_fields_.begin(), computed_fields_.end(),
+                  [&](const std::shared_ptr<Field>& f) { return f->name() == name; })) {
+    return Status::Invalid("Computed column '", name, "' would duplicate a column");
+  }
+  RETURN_NOT_OK(schema()->CanReferenceFieldsByNames(FieldsInExpression(*expression)));
+  ARROW_ASSIGN_OR_RAISE(auto type, expression->Validate(*schema()));
+  computed_fields_.push_back(field(name, std::move(type)));
+  scan_options_->computed_columns.emplace_back(std::move(name), std::move(expression));
+  return Status::OK();
+}
+
 Status ScannerBuilder::Filter(std::shared_ptr<Expression> filter) {
   RETURN_NOT_OK(schema()->CanReferenceFieldsByNames(FieldsInExpression(*filter)));
   RETURN_NOT_OK(filter->Validate(*schema()).status());
@@ -134,17 +189,85 @@ Status ScannerBuilder::BatchSize(int64_t batch_size) {
   return Status::OK();
 }
 
+Status ScannerBuilder::BatchSizeBytes(int64_t batch_size_bytes) {
+  if (batch_size_bytes < 0) {
+    return Status::Invalid("BatchSizeBytes must not be negative, got ",
+                           batch_size_bytes);
+  }
+  scan_options_->batch_size_bytes = batch_size_bytes;
+  return Status::OK();
+}
+
+Status ScannerBuilder::NormalizeBatches(bool normalize_batches) {
+  scan_options_->normalize_batches = normalize_batches;
+  return Status::OK();
+}
+
+Status ScannerBuilder::FragmentReadahead(int32_t fragment_readahead) {
+  if (fragment_readahead <= 0) {
+    return Status::Invalid("FragmentReadahead must be greater than 0, got ",
+                           fragment_readahead);
+  }
+  scan_options_->fragment_readahead = fragment_readahead;
+  return Status::OK();
+}
+
+Status ScannerBuilder::BatchReadahead(int32_t batch_readahead) {
+  if (batch_readahead <= 0) {
+    return Status::Invalid("BatchReadahead must be greater than 0, got ",
+                           batch_readahead);
+  }
+  scan_options_->batch_readahead = batch_readahead;
+  return Status::OK();
+}
+
+Status ScannerBuilder::ReadaheadBytes(int64_t readahead_bytes) {
+  if (readahead_bytes < 0) {
+    return Status::Invalid("ReadaheadBytes must not be negative, got ",
+                           readahead_bytes);
+  }
+  scan_options_->readahead_bytes = readahead_bytes;
+  return Status::OK();
+}
+
+Status ScannerBuilder::Limit(int64_t limit) {
+  if (limit < 0) {
+    return Status::Invalid("Limit must not be negative, got ", limit);
+  }
+  scan_options_->limit = limit;
+  return Status::OK();
+}
+
+Status ScannerBuilder::UseGandiva(bool use_gandiva) {
+  if (use_gandiva) {
+    RETURN_NOT_OK(MakeGandivaEvaluator().status());
+  }
+  scan_options_->use_gandiva = use_gandiva;
+  return Status::OK();
+}
+
 Result<std::shared_ptr<Scanner>> ScannerBuilder::Finish() const {
   std::shared_ptr<ScanOptions> scan_options;
-  if (has_projection_ && !project_columns_.empty()) {
-    scan_options =
-        scan_options_->ReplaceSchema(SchemaFromColumnNames(schema(), project_columns_));
+  if ((has_projection_ && !project_columns_.empty()) || !computed_fields_.empty()) {
+    auto projected = has_projection_ && !project_columns_.empty()
+                         ? SchemaFromColumnNames(schema(), project_columns_)
+                         : schema();
+    auto fields = projected->fields();
+    fields.insert(fields.end(), computed_fields_.begin(), computed_fields_.end());
+    scan_options = scan_options_->ReplaceSchema(
+        ::arrow::schema(std::move(fields), projected->metadata()));
+    // The computed fields are only known to the projected schema
+    scan_options->computed_columns = scan_options_->computed_columns;
   } else {
     scan_options = std::make_shared<ScanOptions>(*scan_options_);
   }
 
-  if (!scan_options->filter->Equals(true)) {
-    scan_options->evaluator = std::make_shared<TreeEvaluator>();
+  if (!scan_options->filter->Equals(true) || !scan_options->computed_columns.empty()) {
+    if (scan_options->use_gandiva) {
+      ARROW_ASSIGN_OR_RAISE(scan_options->evaluator, MakeGandivaEvaluator());
+    } else {
+      scan_options->evaluator = std::make_shared<FusedEvaluator>();
+    }
   }
 
   if (dataset_ == nullptr) {
@@ -200,14 +323,24 @@ Result<std::shared_ptr<Table>> Scanner::ToTable() {
   /// and the mutex/batches fail out of scope.
   auto state = std::make_shared<TableAssemblyState>();
 
+  const StopToken stop_token = scan_context_->stop_token;
   size_t scan_task_id = 0;
   for (auto maybe_scan_task : scan_task_it) {
     ARROW_ASSIGN_OR_RAISE(auto scan_task, std::move(maybe_scan_task));
+    RETURN_NOT_OK(stop_token.Poll());
 
     auto id = scan_task_id++;
-    task_group->Append([state, id, scan_task] {
+    task_group->Append([state, id, scan_task, stop_token] {
+      // A task dequeued after cancellation is dropped
+      RETURN_NOT_OK(stop_token.Poll());
+      util::TraceSpan span("dataset", "ScanTask");
       ARROW_ASSIGN_OR_RAISE(auto batch_it, scan_task->Execute());
-      ARROW_ASSIGN_OR_RAISE(auto local, batch_it.ToVector());
+      RecordBatchVector local;
+      for (auto maybe_batch : batch_it) {
+        ARROW_ASSIGN_OR_RAISE(auto batch, std::move(maybe_batch));
+        local.push_back(std::move(batch));
+        RETURN_NOT_OK(stop_token.Poll());
+      }
       state->Emplace(std::move(local), id);
       return Status::OK();
     });
@@ -220,5 +353,355 @@ Result<std::shared_ptr<Table>> Scanner::ToTable() {
                                   FlattenRecordBatchVector(std::move(state->batches)));
 }
 
+Result<int64_t> Scanner::CountRows() {
+  // Only the columns referenced by the filter are materialized
+  auto options = scan_options_->ReplaceSchema(::arrow::schema({}));
+  options->limit = -1;
+  auto task_group = scan_context_->TaskGroup();
+  auto num_rows = std::make_shared<std::atomic<int64_t>>(0);
+  const StopToken stop_token = scan_context_->stop_token;
+
+  for (auto maybe_fragment : GetFragments()) {
+    ARROW_ASSIGN_OR_RAISE(auto fragment, std::move(maybe_fragment));
+    RETURN_NOT_OK(stop_token.Poll());
+    auto predicate = scan_options_->filter->Assume(fragment->partition_expression());
+    if (!predicate->IsSatisfiable()) {
+      continue;
+    }
+    auto context = scan_context_;
+    task_group->Append([fragment, predicate, options, context, num_rows] {
+      RETURN_NOT_OK(context->stop_token.Poll());
+      util::TraceSpan span("dataset", "CountRows");
+      ARROW_ASSIGN_OR_RAISE(auto fragment_rows,
+                            fragment->CountRows(predicate, options, context));
+      *num_rows += fragment_rows;
+      return Status::OK();
+    });
+  }
+
+  RETURN_NOT_OK(task_group->Finish());
+  return num_rows->load();
+}
+
+namespace {
+
+// Filters and projects the batches of one fragment, as FilterAndProjectScanTask
+// does. Process() may be called concurrently.
+class FragmentBatchProcessor {
+ public:
+  static Result<std::shared_ptr<FragmentBatchProcessor>> Make(
+      const Fragment& fragment, std::shared_ptr<ScanOptions> options,
+      MemoryPool* pool) {
+    const auto& partition = fragment.partition_expression();
+    std::shared_ptr<FragmentBatchProcessor> processor(new FragmentBatchProcessor(
+        options->filter->Assume(partition), options->projector, options, pool));
+    if (partition) {
+      RETURN_NOT_OK(KeyValuePartitioning::SetDefaultValuesFromKeys(
+          *partition, &processor->projector_));
+    }
+    return processor;
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Process(
+      const std::shared_ptr<RecordBatch>& batch) const {
+    const ExpressionEvaluator& evaluator = *options_->evaluator;
+    ARROW_ASSIGN_OR_RAISE(Datum selection, evaluator.Evaluate(*filter_, *batch, pool_));
+    ARROW_ASSIGN_OR_RAISE(
+        auto filtered,
+        evaluator.Filter(
+            selection,
+            SelectProjectedColumns(batch, *projector_.schema(), computed_inputs_),
+            pool_));
+    if (!options_->computed_columns.empty()) {
+      ARROW_ASSIGN_OR_RAISE(filtered,
+                            AddComputedColumns(*options_, std::move(filtered), pool_));
+    }
+    // Projecting may update the projector's input schema, which isn't thread
+    // safe, so use a copy. Copies share the materialized constant columns.
+    RecordBatchProjector local_projector{projector_};
+    return local_projector.Project(*filtered, pool_);
+  }
+
+ private:
+  FragmentBatchProcessor(std::shared_ptr<Expression> filter,
+                         RecordBatchProjector projector,
+                         std::shared_ptr<ScanOptions> options, MemoryPool* pool)
+      : filter_(std::move(filter)),
+        projector_(std::move(projector)),
+        computed_inputs_(ComputedColumnInputs(*options)),
+        options_(std::move(options)),
+        pool_(pool) {}
+
+  std::shared_ptr<Expression> filter_;
+  RecordBatchProjector projector_;
+  std::unordered_set<std::string> computed_inputs_;
+  std::shared_ptr<ScanOptions> options_;
+  MemoryPool* pool_;
+};
+
+// The state shared by the iterator of ScanBatchesUnordered and its background
+// workers. Each worker repeatedly takes a fragment and reads its batches,
+// queueing them as long as the readahead limits allow. Filtering and
+// projection of each batch are submitted to the CPU thread pool when threads
+// are allowed, and are otherwise done by the consumer.
+//
+// The workers block on scan tasks, which may themselves wait for reads queued
+// on the I/O executor (e.g. when pre-buffering Parquet column chunks), so they
+// run on a pool of their own: taking up the I/O threads would deadlock the scan
+// once there are no more of those than workers.
+class BackgroundScan : public std::enable_shared_from_this<BackgroundScan> {
+ public:
+  BackgroundScan(FragmentIterator fragments, std::shared_ptr<ScanOptions> options,
+                 std::shared_ptr<ScanContext> context)
+      : options_(std::move(options)), context_(std::move(context)) {
+    if (options_->limit >= 0) {
+      row_limit_ = std::make_shared<RowLimit>(options_->limit);
+      fragments = LimitFragments(std::move(fragments), options_->limit,
+                                 !options_->filter->Equals(true), row_limit_);
+    }
+    fragments_ = std::move(fragments);
+  }
+
+  Status Start() {
+    auto self = shared_from_this();
+    const int num_workers = std::max(1, options_->fragment_readahead);
+    ARROW_ASSIGN_OR_RAISE(workers_pool_, internal::ThreadPool::Make(num_workers));
+    running_workers_ = num_workers;
+    for (int i = 0; i < num_workers; ++i) {
+      auto maybe_worker = workers_pool_->Submit([self] { return self->Work(); });
+      if (!maybe_worker.ok()) {
+        {
+          // Don't wait for workers which were never started
+          std::lock_guard<std::mutex> lock(mutex_);
+          running_workers_ -= num_workers - i;
+        }
+        Stop();
+        return maybe_worker.status();
+      }
+      workers_.push_back(maybe_worker.MoveValueUnsafe());
+    }
+    return Status::OK();
+  }
+
+  // Stop the workers and wait for them to exit. Must not be called from a worker,
+  // as it shuts down their pool.
+  void Stop() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopped_ = true;
+    }
+    cv_.notify_all();
+    for (const auto& worker : workers_) {
+      worker.Wait();
+    }
+    workers_.clear();
+    workers_pool_.reset();
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Next() {
+    while (true) {
+      RETURN_NOT_OK(context_->stop_token.Poll());
+      if (row_limit_ != nullptr && row_limit_->reached()) {
+        return nullptr;
+      }
+      QueuedBatch queued;
+      {
+        util::TraceSpan span("dataset", "WaitForBatch");
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this] {
+          return !queue_.empty() || running_workers_ == 0 || !status_.ok();
+        });
+        RETURN_NOT_OK(status_);
+        if (queue_.empty()) {
+          return nullptr;
+        }
+        queued = std::move(queue_.front());
+        queue_.pop_front();
+        queued_bytes_ -= queued.size;
+      }
+      cv_.notify_all();
+
+      std::shared_ptr<RecordBatch> batch;
+      if (queued.processed.is_valid()) {
+        ARROW_ASSIGN_OR_RAISE(batch, queued.processed.result());
+      } else {
+        ARROW_ASSIGN_OR_RAISE(batch, queued.processor->Process(queued.batch));
+      }
+      if (batch->num_rows() == 0) {
+        continue;
+      }
+      if (row_limit_ != nullptr) {
+        const int64_t claimed = row_limit_->Claim(batch->num_rows());
+        if (row_limit_->reached()) {
+          // Let the workers stop reading
+          {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopped_ = true;
+          }
+          cv_.notify_all();
+        }
+        if (claimed < batch->num_rows()) {
+          batch = batch->Slice(0, claimed);
+        }
+      }
+      return batch;
+    }
+  }
+
+ private:
+  struct QueuedBatch {
+    std::shared_ptr<FragmentBatchProcessor> processor;
+    // The batch as read, if it's processed by the consumer
+    std::shared_ptr<RecordBatch> batch;
+    // The processed batch, if processing was submitted to the CPU thread pool
+    Future<std::shared_ptr<RecordBatch>> processed;
+    int64_t size;
+  };
+
+  Status Work() {
+    Status st = ScanFragments();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!st.ok() && status_.ok()) {
+        status_ = st;
+        stopped_ = true;
+      }
+      --running_workers_;
+    }
+    cv_.notify_all();
+    return st;
+  }
+
+  Status ScanFragments() {
+    while (!stopped()) {
+      std::shared_ptr<Fragment> fragment;
+      {
+        std::lock_guard<std::mutex> lock(fragments_mutex_);
+        ARROW_ASSIGN_OR_RAISE(fragment, fragments_.Next());
+      }
+      if (fragment == nullptr) {
+        break;
+      }
+      ARROW_ASSIGN_OR_RAISE(auto processor, FragmentBatchProcessor::Make(
+                                                *fragment, options_, context_->pool));
+      ARROW_ASSIGN_OR_RAISE(auto scan_tasks, fragment->Scan(options_, context_));
+      util::TraceSpan span("dataset", "ScanFragment");
+      for (auto maybe_scan_task : scan_tasks) {
+        ARROW_ASSIGN_OR_RAISE(auto scan_task, std::move(maybe_scan_task));
+        RETURN_NOT_OK(context_->stop_token.Poll());
+        ARROW_ASSIGN_OR_RAISE(auto batches, scan_task->Execute());
+        if (options_->normalize_batches) {
+          batches = RebatchRecordBatches(std::move(batches), options_->batch_size,
+                                         options_->batch_size_bytes, context_->pool);
+        }
+        for (auto maybe_batch : batches) {
+          ARROW_ASSIGN_OR_RAISE(auto batch, std::move(maybe_batch));
+          RETURN_NOT_OK(context_->stop_token.Poll());
+          RETURN_NOT_OK(Enqueue(processor, std::move(batch)));
+          if (stopped()) {
+            return Status::OK();
+          }
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Enqueue(std::shared_ptr<FragmentBatchProcessor> processor,
+                 std::shared_ptr<RecordBatch> batch) {
+    QueuedBatch queued;
+    queued.size = BufferSize(*batch);
+    {
+      // Wait for room in the readahead buffer
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [&] { return stopped_ || !QueueFull(queued.size); });
+      if (stopped_) {
+        return Status::OK();
+      }
+      queued_bytes_ += queued.size;
+    }
+
+    if (context_->use_threads) {
+      auto process = [processor, batch] { return processor->Process(batch); };
+      ARROW_ASSIGN_OR_RAISE(queued.processed,
+                            internal::GetCpuThreadPool()->Submit(
+                                internal::TaskHints{}, context_->stop_token,
+                                std::move(process)));
+    } else {
+      queued.batch = std::move(batch);
+    }
+    queued.processor = std::move(processor);
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      queue_.push_back(std::move(queued));
+    }
+    cv_.notify_all();
+    return Status::OK();
+  }
+
+  bool QueueFull(int64_t size) const {
+    if (queue_.empty()) {
+      return false;
+    }
+    if (static_cast<int64_t>(queue_.size()) >= options_->batch_readahead) {
+      return true;
+    }
+    return options_->readahead_bytes > 0 &&
+           queued_bytes_ + size > options_->readahead_bytes;
+  }
+
+  bool stopped() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stopped_;
+  }
+
+  std::mutex fragments_mutex_;
+  FragmentIterator fragments_;
+  std::shared_ptr<ScanOptions> options_;
+  std::shared_ptr<ScanContext> context_;
+  // The rows left to yield, if the scan has a limit
+  std::shared_ptr<RowLimit> row_limit_;
+  std::shared_ptr<internal::ThreadPool> workers_pool_;
+  std::vector<Future<Status>> workers_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<QueuedBatch> queue_;
+  int64_t queued_bytes_ = 0;
+  int running_workers_ = 0;
+  bool stopped_ = false;
+  Status status_;
+};
+
+class BackgroundScanIterator {
+ public:
+  explicit BackgroundScanIterator(std::shared_ptr<BackgroundScan> scan)
+      : scan_(std::move(scan)) {}
+
+  BackgroundScanIterator(BackgroundScanIterator&&) = default;
+  BackgroundScanIterator& operator=(BackgroundScanIterator&&) = default;
+
+  ~BackgroundScanIterator() {
+    if (scan_ != nullptr) {
+      scan_->Stop();
+    }
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Next() { return scan_->Next(); }
+
+ private:
+  std::shared_ptr<BackgroundScan> scan_;
+};
+
+}  // namespace
+
+Result<RecordBatchIterator> Scanner::ScanBatchesUnordered() {
+  auto scan = std::make_shared<BackgroundScan>(GetFragments(), scan_options_,
+                                               scan_context_);
+  RETURN_NOT_OK(scan->Start());
+  return RecordBatchIterator(BackgroundScanIterator(std::move(scan)));
+}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -29,8 +29,10 @@
 #include "arrow/dataset/projector.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
+#include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/cancel.h"
 #include "arrow/util/type_fwd.h"
 
 namespace arrow {
@@ -44,6 +46,19 @@ struct ARROW_DS_EXPORT ScanContext {
   /// Indicate if the Scanner should make use of a ThreadPool.
   bool use_threads = false;
 
+  /// The executor on which Scanner::ScanBatchesUnordered reads fragments,
+  /// by default the global I/O thread pool.
+  io::AsyncContext io_context;
+
+  /// An optional cache of decoded file metadata, shared across scans.  If null,
+  /// the file format's cache (if any) is used.
+  std::shared_ptr<FileMetadataCache> metadata_cache;
+
+  /// A token to cancel the scan.  It is checked between scan tasks and
+  /// between batches, and the scan then fails with the stop error.  Queued
+  /// tasks of a cancelled scan are dropped rather than run.
+  StopToken stop_token;
+
   /// Return a threaded or serial TaskGroup according to use_threads.
   std::shared_ptr<internal::TaskGroup> TaskGroup() const;
 };
@@ -66,15 +81,56 @@ class ARROW_DS_EXPORT ScanOptions {
   // Evaluator for Filter
   std::shared_ptr<ExpressionEvaluator> evaluator;
 
+  // Compile the filter with Gandiva if available, see MakeGandivaEvaluator().
+  bool use_gandiva = false;
+
   // Schema to which record batches will be reconciled
   const std::shared_ptr<Schema>& schema() const { return projector.schema(); }
 
   // Projector for reconciling the final RecordBatch to the requested schema.
   RecordBatchProjector projector;
 
+  // Columns of the projected schema which are computed from each batch by an
+  // expression instead of being read, as (name, expression) pairs. They are
+  // evaluated with `evaluator` inside the scan task, after filtering, while
+  // the batch is still in cache. Only the fields they reference are read.
+  std::vector<std::pair<std::string, std::shared_ptr<Expression>>> computed_columns;
+
   // Maximum row count for scanned batches.
   int64_t batch_size = 1 << 15;
 
+  // Maximum size in bytes of scanned batches, estimated from their buffers, or
+  // 0 for no limit. Only enforced if normalize_batches is set.
+  int64_t batch_size_bytes = 0;
+
+  // Whether the scanner normalizes the batches of each scan task towards
+  // batch_size rows and batch_size_bytes: larger batches are sliced (without
+  // copying) and runs of batches smaller than half of that are concatenated.
+  // Scan tasks normalize their batches after filtering and projecting them,
+  // Scanner::ScanBatchesUnordered before, so that they are filtered in
+  // parallel.
+  bool normalize_batches = false;
+
+  // Maximum number of fragments which Scanner::ScanBatchesUnordered reads
+  // concurrently.
+  int32_t fragment_readahead = 8;
+
+  // Maximum number of record batches which Scanner::ScanBatchesUnordered
+  // buffers ahead of the consumer.
+  int32_t batch_readahead = 32;
+
+  // Maximum number of bytes which Scanner::ScanBatchesUnordered buffers ahead
+  // of the consumer, or 0 for no limit. At least one batch is always let
+  // through, however large.
+  int64_t readahead_bytes = 256 << 20;
+
+  // Maximum number of rows yielded by the scan, or -1 for no limit. Which
+  // rows are kept is unspecified unless the scan is serial. Once the limit
+  // is reached, no more scan tasks are started and running ones stop before
+  // reading their next batch. Without a filter, fragments whose row count
+  // is known from their metadata are enough to stop opening more fragments.
+  int64_t limit = -1;
+
   // Return a vector of fields that requires materialization.
   //
   // This is usually the union of the fields referenced in the projection and the
@@ -164,12 +220,36 @@ class ARROW_DS_EXPORT Scanner {
   /// in a concurrent fashion and outlive the iterator.
   Result<ScanTaskIterator> Scan();
 
+  /// \brief Scan in the background, yielding the filtered and projected
+  /// record batches as they become available, in no particular order.
+  ///
+  /// Up to ScanOptions::fragment_readahead fragments are read at a time by
+  /// dedicated threads, so that blocking reads hold up neither CPU threads nor
+  /// the asynchronous reads they may wait for on the ScanContext's I/O
+  /// executor. Filtering and projection then run on the CPU thread pool if
+  /// ScanContext::use_threads is set, or in the consumer's thread otherwise.
+  /// Reading pauses while ScanOptions::batch_readahead batches or
+  /// ScanOptions::readahead_bytes bytes wait for the consumer, which bounds
+  /// memory use. Batches left with no rows after filtering are skipped.
+  ///
+  /// Destroying the iterator stops the background reads and waits for them.
+  Result<RecordBatchIterator> ScanBatchesUnordered();
+
   /// \brief Convert a Scanner into a Table.
   ///
   /// Use this convenience utility with care. This will serially materialize the
   /// Scan result in memory before creating the Table.
   Result<std::shared_ptr<Table>> ToTable();
 
+  /// \brief Count the rows satisfying the filter.
+  ///
+  /// Rows are counted from metadata where possible: fragments whose partition
+  /// expression decides the filter, and parquet row groups or IPC record
+  /// batches whose statistics do, aren't read.  The others are scanned, reading
+  /// only the columns referenced by the filter.  Fragments are counted in
+  /// parallel if ScanContext::use_threads is set.  The limit is ignored.
+  Result<int64_t> CountRows();
+
   /// \brief GetFragments returns an iterator over all Fragments in this scan.
   FragmentIterator GetFragments();
 
@@ -211,6 +291,20 @@ class ARROW_DS_EXPORT ScannerBuilder {
   ///         Schema.
   Status Project(std::vector<std::string> columns);
 
+  /// \brief Append a column computed from each scanned batch to the projection.
+  ///
+  /// The expression is evaluated inside the scan tasks, see
+  /// ScanOptions::computed_columns. The fields it references are read even if
+  /// they aren't projected.
+  ///
+  /// \param[in] name the name of the computed column.
+  /// \param[in] expression the expression computing it.
+  ///
+  /// \return Failure if the name is already used, or if the expression
+  ///         references fields absent from the dataset's Schema or can't be
+  ///         evaluated against it.
+  Status AddComputedColumn(std::string name, std::shared_ptr<Expression> expression);
+
   /// \brief Set the filter expression to return only rows matching the filter.
   ///
   /// The predicate will be passed down to Sources and corresponding
@@ -236,6 +330,48 @@ class ARROW_DS_EXPORT ScannerBuilder {
   /// This option provides a control limiting the memory owned by any RecordBatch.
   Status BatchSize(int64_t batch_size);
 
+  /// \brief Set the maximum size in bytes of a RecordBatch, or 0 for no limit.
+  ///
+  /// Only enforced if batches are normalized, see NormalizeBatches().
+  /// \returns An error if the number is negative.
+  Status BatchSizeBytes(int64_t batch_size_bytes);
+
+  /// \brief Indicate if the Scanner should slice large batches and coalesce
+  /// small ones towards the batch size, see ScanOptions::normalize_batches.
+  Status NormalizeBatches(bool normalize_batches = true);
+
+  /// \brief Set the maximum number of fragments read concurrently by
+  /// Scanner::ScanBatchesUnordered.
+  ///
+  /// \returns An error if the number is not greater than 0.
+  Status FragmentReadahead(int32_t fragment_readahead);
+
+  /// \brief Set the maximum number of record batches buffered by
+  /// Scanner::ScanBatchesUnordered.
+  ///
+  /// \returns An error if the number is not greater than 0.
+  Status BatchReadahead(int32_t batch_readahead);
+
+  /// \brief Set the maximum number of bytes buffered by
+  /// Scanner::ScanBatchesUnordered, or 0 for no limit.
+  ///
+  /// \returns An error if the number is negative.
+  Status ReadaheadBytes(int64_t readahead_bytes);
+
+  /// \brief Set the maximum number of rows yielded by the scan.
+  ///
+  /// Scanning stops as soon as enough rows were produced, see
+  /// ScanOptions::limit.
+  /// \returns An error if the number is negative.
+  Status Limit(int64_t limit);
+
+  /// \brief Indicate if the Scanner should evaluate its filter with code compiled
+  /// by Gandiva.
+  ///
+  /// Subexpressions Gandiva can't compile are evaluated as without this option.
+  /// \returns An error if Arrow was built without Gandiva.
+  Status UseGandiva(bool use_gandiva = true);
+
   /// \brief Return the constructed now-immutable Scanner object
   Result<std::shared_ptr<Scanner>> Finish() const;
 
@@ -248,6 +384,7 @@ class ARROW_DS_EXPORT ScannerBuilder {
   std::shared_ptr<ScanContext> scan_context_;
   bool has_projection_ = false;
   std::vector<std::string> project_columns_;
+  FieldVector computed_fields_;
 };
 
 }  // namespace dataset
@@ -0,0 +1,265 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// End-to-end scans of synthetic hive-partitioned datasets.
+//
+// The datasets are written to a local temporary directory, or below the
+// filesystem URI given in the ARROW_DATASET_BENCHMARK_URI environment
+// variable, e.g. "s3://bucket/prefix?endpoint_override=localhost:9000&scheme=http"
+// to scan from a minio server.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/discovery.h"
+#include "arrow/dataset/file_csv.h"
+#include "arrow/dataset/file_ipc.h"
+#include "arrow/dataset/file_parquet.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/partition.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/io_util.h"
+#include "parquet/arrow/writer.h"
+
+namespace arrow {
+namespace dataset {
+
+using internal::checked_cast;
+
+enum class BenchmarkFormat { kParquet, kIpc, kCsv };
+
+// The total number of rows of a dataset, split evenly across its files
+constexpr int64_t kTotalRows = 1 << 20;
+// The number of "part=..." directories the files are spread over
+constexpr int kNumPartitions = 4;
+
+static std::shared_ptr<Schema> DataSchema() {
+  return schema({field("id", int64()), field("value", float64())});
+}
+
+static std::string FormatExtension(BenchmarkFormat format) {
+  switch (format) {
+    case BenchmarkFormat::kParquet:
+      return "parquet";
+    case BenchmarkFormat::kIpc:
+      return "arrow";
+    case BenchmarkFormat::kCsv:
+      return "csv";
+  }
+  return "";
+}
+
+static std::shared_ptr<FileFormat> MakeFormat(BenchmarkFormat format) {
+  switch (format) {
+    case BenchmarkFormat::kParquet:
+      return std::make_shared<ParquetFileFormat>();
+    case BenchmarkFormat::kIpc:
+      return std::make_shared<IpcFileFormat>();
+    case BenchmarkFormat::kCsv:
+      return std::make_shared<CsvFileFormat>();
+  }
+  return nullptr;
+}
+
+// "value" is uniformly distributed in [0, 1), so that the filter
+// "value < selectivity" keeps about that fraction of the rows.
+static std::shared_ptr<Table> MakeFileData(int64_t num_rows, int64_t first_id,
+                                           random::RandomArrayGenerator* rand) {
+  Int64Builder ids;
+  ABORT_NOT_OK(ids.Reserve(num_rows));
+  for (int64_t i = 0; i < num_rows; ++i) {
+    ids.UnsafeAppend(first_id + i);
+  }
+  std::shared_ptr<Array> id_array;
+  ABORT_NOT_OK(ids.Finish(&id_array));
+  auto value_array = rand->Float64(num_rows, 0.0, 1.0, /*null_probability=*/0.0);
+  return Table::Make(DataSchema(), {id_array, value_array}, num_rows);
+}
+
+static Status WriteCsv(const Table& table, io::OutputStream* out) {
+  const auto& ids = checked_cast<const Int64Array&>(*table.column(0)->chunk(0));
+  const auto& values = checked_cast<const DoubleArray&>(*table.column(1)->chunk(0));
+  std::stringstream ss;
+  ss.precision(17);
+  ss << "id,value\n";
+  for (int64_t i = 0; i < table.num_rows(); ++i) {
+    ss << ids.Value(i) << "," << values.Value(i) << "\n";
+  }
+  return out->Write(ss.str());
+}
+
+static Status WriteFile(BenchmarkFormat format, const Table& table,
+                        std::shared_ptr<io::OutputStream> out) {
+  switch (format) {
+    case BenchmarkFormat::kParquet:
+      // Several row groups per file, as written by most producers
+      RETURN_NOT_OK(parquet::arrow::WriteTable(table, default_memory_pool(), out,
+                                               /*chunk_size=*/1 << 16));
+      break;
+    case BenchmarkFormat::kIpc: {
+      ARROW_ASSIGN_OR_RAISE(auto writer, ipc::MakeFileWriter(out, table.schema()));
+      RETURN_NOT_OK(writer->WriteTable(table, /*max_chunksize=*/1 << 16));
+      RETURN_NOT_OK(writer->Close());
+      break;
+    }
+    case BenchmarkFormat::kCsv:
+      RETURN_NOT_OK(WriteCsv(table, out.get()));
+      break;
+  }
+  return out->Close();
+}
+
+// A dataset written once and scanned by all the benchmarks using it
+struct BenchmarkDataset {
+  std::shared_ptr<Dataset> dataset;
+  int64_t num_rows;
+  int64_t num_bytes;
+};
+
+class BenchmarkDatasets {
+ public:
+  static BenchmarkDatasets* Instance() {
+    static BenchmarkDatasets instance;
+    return &instance;
+  }
+
+  const BenchmarkDataset& Get(BenchmarkFormat format, int num_files) {
+    auto key = std::make_tuple(format, num_files);
+    auto it = datasets_.find(key);
+    if (it == datasets_.end()) {
+      it = datasets_.emplace(key, Make(format, num_files).ValueOrDie()).first;
+    }
+    return it->second;
+  }
+
+ private:
+  BenchmarkDatasets() {
+    const char* uri = std::getenv("ARROW_DATASET_BENCHMARK_URI");
+    if (uri != nullptr && uri[0] != '\0') {
+      fs_ = fs::FileSystemFromUri(uri, &base_dir_).ValueOrDie();
+      base_dir_ += "/arrow-dataset-benchmark";
+    } else {
+      temp_dir_ = internal::TemporaryDir::Make("dataset-benchmark-").ValueOrDie();
+      fs_ = std::make_shared<fs::LocalFileSystem>();
+      base_dir_ = temp_dir_->path().ToString() + "data";
+    }
+  }
+
+  Result<BenchmarkDataset> Make(BenchmarkFormat format, int num_files) {
+    std::stringstream ss;
+    ss << base_dir_ << "/" << FormatExtension(format) << "-" << num_files;
+    const std::string dir = ss.str();
+
+    random::RandomArrayGenerator rand(0x5EED + num_files);
+    const int64_t rows_per_file = kTotalRows / num_files;
+    int64_t num_bytes = 0;
+    for (int i = 0; i < num_files; ++i) {
+      std::stringstream part_dir;
+      part_dir << dir << "/part=" << i % kNumPartitions;
+      RETURN_NOT_OK(fs_->CreateDir(part_dir.str()));
+      const std::string path =
+          part_dir.str() + "/data" + std::to_string(i) + "." + FormatExtension(format);
+
+      auto table = MakeFileData(rows_per_file, i * rows_per_file, &rand);
+      ARROW_ASSIGN_OR_RAISE(auto out, fs_->OpenOutputStream(path));
+      RETURN_NOT_OK(WriteFile(format, *table, std::move(out)));
+      ARROW_ASSIGN_OR_RAISE(auto info, fs_->GetFileInfo(path));
+      num_bytes += info.size();
+    }
+
+    fs::FileSelector selector;
+    selector.base_dir = dir;
+    selector.recursive = true;
+    FileSystemFactoryOptions options;
+    options.partitioning = std::make_shared<HivePartitioning>(
+        schema({field("part", int32())}));
+    ARROW_ASSIGN_OR_RAISE(auto factory, FileSystemDatasetFactory::Make(
+                                            fs_, selector, MakeFormat(format), options));
+    ARROW_ASSIGN_OR_RAISE(auto dataset, factory->Finish());
+    return BenchmarkDataset{std::move(dataset), rows_per_file * num_files, num_bytes};
+  }
+
+  std::unique_ptr<internal::TemporaryDir> temp_dir_;
+  std::shared_ptr<fs::FileSystem> fs_;
+  std::string base_dir_;
+  std::map<std::tuple<BenchmarkFormat, int>, BenchmarkDataset> datasets_;
+};
+
+// Arguments: number of files, selectivity (in percent), use_threads
+template <BenchmarkFormat Format>
+static void ScanDataset(benchmark::State& state) {  // NOLINT non-const reference
+  const int num_files = static_cast<int>(state.range(0));
+  const double selectivity = static_cast<double>(state.range(1)) / 100;
+  const bool use_threads = state.range(2) != 0;
+
+  const auto& data = BenchmarkDatasets::Instance()->Get(Format, num_files);
+
+  int64_t num_selected = 0;
+  for (auto _ : state) {
+    auto context = std::make_shared<ScanContext>();
+    ScannerBuilder builder(data.dataset, context);
+    if (selectivity < 1.0) {
+      ABORT_NOT_OK(builder.Filter("value"_ < selectivity));
+    }
+    ABORT_NOT_OK(builder.UseThreads(use_threads));
+    auto scanner = builder.Finish().ValueOrDie();
+    auto table = scanner->ToTable().ValueOrDie();
+    num_selected = table->num_rows();
+  }
+
+  // Rows and bytes scanned, rather than selected
+  state.SetItemsProcessed(state.iterations() * data.num_rows);
+  state.SetBytesProcessed(state.iterations() * data.num_bytes);
+  state.counters["selected_rows"] = static_cast<double>(num_selected);
+}
+
+static void ScanArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"files", "selectivity", "threads"});
+  for (const int64_t num_files : {1, 16, 128}) {
+    for (const int64_t selectivity : {1, 10, 100}) {
+      for (const int64_t use_threads : {0, 1}) {
+        bench->Args({num_files, selectivity, use_threads});
+      }
+    }
+  }
+  bench->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+BENCHMARK_TEMPLATE(ScanDataset, BenchmarkFormat::kParquet)->Apply(ScanArgs);
+BENCHMARK_TEMPLATE(ScanDataset, BenchmarkFormat::kIpc)->Apply(ScanArgs);
+BENCHMARK_TEMPLATE(ScanDataset, BenchmarkFormat::kCsv)->Apply(ScanArgs);
+
+}  // namespace dataset
+}  // namespace arrow
@@ -17,25 +17,113 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <string>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
+#include "arrow/array/array_base.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/util/bit_util.h"
 
 namespace arrow {
 namespace dataset {
 
+// Drop the columns of a batch which are absent from the projected schema, except
+// those in `also_kept`
+inline std::shared_ptr<RecordBatch> SelectProjectedColumns(
+    std::shared_ptr<RecordBatch> batch, const Schema& projected,
+    const std::unordered_set<std::string>& also_kept = {}) {
+  std::vector<std::shared_ptr<Field>> fields;
+  ArrayVector columns;
+  for (int i = 0; i < batch->num_columns(); ++i) {
+    const auto& field = batch->schema()->field(i);
+    if (!projected.GetAllFieldIndices(field->name()).empty() ||
+        also_kept.count(field->name()) != 0) {
+      fields.push_back(field);
+      columns.push_back(batch->column(i));
+    }
+  }
+  if (static_cast<int>(columns.size()) == batch->num_columns()) {
+    return batch;
+  }
+  return RecordBatch::Make(schema(std::move(fields), batch->schema()->metadata()),
+                           batch->num_rows(), std::move(columns));
+}
+
+// The names of the fields referenced by the computed columns of a scan
+inline std::unordered_set<std::string> ComputedColumnInputs(const ScanOptions& options) {
+  std::unordered_set<std::string> inputs;
+  for (const auto& computed : options.computed_columns) {
+    for (auto&& name : FieldsInExpression(computed.second)) {
+      inputs.insert(std::move(name));
+    }
+  }
+  return inputs;
+}
+
+// Evaluate the computed columns of a scan against a filtered batch, and append
+// them to it. Columns of the batch with the same names are replaced.
+inline Result<std::shared_ptr<RecordBatch>> AddComputedColumns(
+    const ScanOptions& options, std::shared_ptr<RecordBatch> batch, MemoryPool* pool) {
+  ArrayVector computed_arrays;
+  for (const auto& computed : options.computed_columns) {
+    ARROW_ASSIGN_OR_RAISE(Datum value,
+                          options.evaluator->Evaluate(*computed.second, *batch, pool));
+    if (value.is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto array, MakeArrayFromScalar(*value.scalar(), batch->num_rows(), pool));
+      computed_arrays.push_back(std::move(array));
+    } else {
+      computed_arrays.push_back(value.make_array());
+    }
+  }
+
+  for (size_t i = 0; i < computed_arrays.size(); ++i) {
+    const auto& name = options.computed_columns[i].first;
+    const int existing = batch->schema()->GetFieldIndex(name);
+    if (existing != -1) {
+      ARROW_ASSIGN_OR_RAISE(batch, batch->RemoveColumn(existing));
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        batch, batch->AddColumn(batch->num_columns(),
+                                field(name, computed_arrays[i]->type()),
+                                std::move(computed_arrays[i])));
+  }
+  return batch;
+}
+
+// The filter is evaluated against the whole batch, but only the columns which
+// the projection keeps or the computed columns reference are filtered, so that
+// the others are never copied. The computed columns are then appended.
 inline RecordBatchIterator FilterRecordBatch(RecordBatchIterator it,
-                                             const ExpressionEvaluator& evaluator,
-                                             const Expression& filter, MemoryPool* pool) {
+                                             std::shared_ptr<ScanOptions> options,
+                                             const Expression& filter,
+                                             std::shared_ptr<Schema> projected,
+                                             MemoryPool* pool) {
+  auto computed_inputs = ComputedColumnInputs(*options);
   return MakeMaybeMapIterator(
-      [&filter, &evaluator, pool](std::shared_ptr<RecordBatch> in) {
-        return evaluator.Evaluate(filter, *in, pool).Map([&](Datum selection) {
-          return evaluator.Filter(selection, in);
-        });
+      [&filter, options, computed_inputs, projected,
+       pool](std::shared_ptr<RecordBatch> in) -> Result<std::shared_ptr<RecordBatch>> {
+        const ExpressionEvaluator& evaluator = *options->evaluator;
+        ARROW_ASSIGN_OR_RAISE(Datum selection, evaluator.Evaluate(filter, *in, pool));
+        ARROW_ASSIGN_OR_RAISE(
+            auto filtered,
+            evaluator.Filter(selection,
+                             SelectProjectedColumns(in, *projected, computed_inputs),
+                             pool));
+        if (options->computed_columns.empty()) {
+          return filtered;
+        }
+        return AddComputedColumns(*options, std::move(filtered), pool);
       },
       std::move(it));
 }
@@ -46,14 +134,158 @@ inline RecordBatchIterator ProjectRecordBatch(RecordBatchIterator it,
   return MakeMaybeMapIterator(
       [=](std::shared_ptr<RecordBatch> in) {
         // The RecordBatchProjector is shared across ScanTasks of the same
-        // Fragment. The resize operation of missing columns is not thread safe.
-        // Ensure that each ScanTask gets his own projector.
+        // Fragment. Updating its input schema is not thread safe, so each batch
+        // gets its own copy; copies share the materialized constant columns.
         RecordBatchProjector local_projector{*projector};
         return local_projector.Project(*in, pool);
       },
       std::move(it));
 }
 
+// Count the rows of a batch satisfying a predicate
+inline Result<int64_t> CountRowsSatisfying(const Expression& predicate,
+                                           const ExpressionEvaluator& evaluator,
+                                           const std::shared_ptr<RecordBatch>& batch,
+                                           MemoryPool* pool) {
+  if (predicate.Equals(true)) {
+    return batch->num_rows();
+  }
+  ARROW_ASSIGN_OR_RAISE(Datum selection, evaluator.Evaluate(predicate, *batch, pool));
+  ARROW_ASSIGN_OR_RAISE(auto filtered, evaluator.Filter(selection, batch, pool));
+  return filtered->num_rows();
+}
+
+// Estimate the memory held by an array from the sizes of its buffers
+inline int64_t BufferSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += BufferSize(*child);
+  }
+  if (data.dictionary != nullptr) {
+    size += BufferSize(*data.dictionary);
+  }
+  return size;
+}
+
+inline int64_t BufferSize(const RecordBatch& batch) {
+  int64_t size = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    size += BufferSize(*batch.column_data(i));
+  }
+  return size;
+}
+
+// Normalize the sizes of a stream of batches. Batches with more than max_rows rows,
+// or larger than max_bytes (if positive), are sliced into even parts. Consecutive
+// batches of the same schema smaller than half of that are concatenated.
+inline RecordBatchIterator RebatchRecordBatches(RecordBatchIterator it,
+                                                int64_t max_rows, int64_t max_bytes,
+                                                MemoryPool* pool) {
+  struct Impl {
+    Result<std::shared_ptr<RecordBatch>> Next() {
+      while (true) {
+        if (splitting != nullptr) {
+          auto out = splitting->Slice(0, split_rows);
+          splitting = out->num_rows() < splitting->num_rows()
+                          ? splitting->Slice(out->num_rows())
+                          : nullptr;
+          return out;
+        }
+        if (exhausted) {
+          return Flush();
+        }
+
+        ARROW_ASSIGN_OR_RAISE(auto batch, it.Next());
+        if (batch == nullptr) {
+          exhausted = true;
+          continue;
+        }
+        if (batch->num_rows() == 0) {
+          continue;
+        }
+
+        const int64_t target_rows = TargetRows(*batch);
+        if (batch->num_rows() * 2 >= target_rows) {
+          // Large enough on its own, yield it in even parts
+          const int64_t num_parts = BitUtil::CeilDiv(batch->num_rows(), target_rows);
+          split_rows = BitUtil::CeilDiv(batch->num_rows(), num_parts);
+          splitting = std::move(batch);
+          if (!pending.empty()) {
+            return Flush();
+          }
+          continue;
+        }
+
+        std::shared_ptr<RecordBatch> out;
+        if (!pending.empty() &&
+            (pending_rows + batch->num_rows() > target_rows ||
+             !batch->schema()->Equals(*pending[0]->schema(), false))) {
+          ARROW_ASSIGN_OR_RAISE(out, Flush());
+        }
+        pending_rows += batch->num_rows();
+        pending.push_back(std::move(batch));
+        if (out != nullptr) {
+          return out;
+        }
+        if (pending_rows * 2 >= target_rows) {
+          return Flush();
+        }
+      }
+    }
+
+    int64_t TargetRows(const RecordBatch& batch) const {
+      int64_t rows = max_rows;
+      const int64_t size = max_bytes > 0 ? BufferSize(batch) : 0;
+      if (size > 0) {
+        const int64_t row_size = BitUtil::CeilDiv(size, batch.num_rows());
+        rows = std::min(rows, std::max<int64_t>(max_bytes / row_size, 1));
+      }
+      return rows;
+    }
+
+    // Concatenate the pending batches, or return null if there are none
+    Result<std::shared_ptr<RecordBatch>> Flush() {
+      std::vector<std::shared_ptr<RecordBatch>> batches;
+      batches.swap(pending);
+      const int64_t num_rows = pending_rows;
+      pending_rows = 0;
+      if (batches.size() <= 1) {
+        return batches.empty() ? nullptr : std::move(batches[0]);
+      }
+
+      ArrayVector columns(batches[0]->num_columns());
+      for (int i = 0; i < batches[0]->num_columns(); ++i) {
+        ArrayVector chunks;
+        for (const auto& batch : batches) {
+          chunks.push_back(batch->column(i));
+        }
+        ARROW_ASSIGN_OR_RAISE(columns[i], Concatenate(chunks, pool));
+      }
+      return RecordBatch::Make(batches[0]->schema(), num_rows, std::move(columns));
+    }
+
+    RecordBatchIterator it;
+    int64_t max_rows;
+    int64_t max_bytes;
+    MemoryPool* pool;
+    // A large batch being sliced, and the rows of its slices
+    std::shared_ptr<RecordBatch> splitting;
+    int64_t split_rows;
+    // Small batches waiting to be concatenated
+    std::vector<std::shared_ptr<RecordBatch>> pending;
+    int64_t pending_rows;
+    bool exhausted;
+  };
+
+  return RecordBatchIterator(
+      Impl{std::move(it), max_rows, max_bytes, pool, nullptr, 0, {}, 0, false});
+}
+
 class FilterAndProjectScanTask : public ScanTask {
  public:
   explicit FilterAndProjectScanTask(std::shared_ptr<ScanTask> task,
@@ -67,14 +299,20 @@ class FilterAndProjectScanTask : public ScanTask {
   Result<RecordBatchIterator> Execute() override {
     ARROW_ASSIGN_OR_RAISE(auto it, task_->Execute());
 
-    auto filter_it =
-        FilterRecordBatch(std::move(it), *options_->evaluator, *filter_, context_->pool);
+    auto filter_it = FilterRecordBatch(std::move(it), options_, *filter_,
+                                       projector_.schema(), context_->pool);
 
     if (partition_) {
       RETURN_NOT_OK(
           KeyValuePartitioning::SetDefaultValuesFromKeys(*partition_, &projector_));
     }
-    return ProjectRecordBatch(std::move(filter_it), &projector_, context_->pool);
+    auto project_it =
+        ProjectRecordBatch(std::move(filter_it), &projector_, context_->pool);
+    if (!options_->normalize_batches) {
+      return project_it;
+    }
+    return RebatchRecordBatches(std::move(project_it), options_->batch_size,
+                                options_->batch_size_bytes, context_->pool);
   }
 
  private:
@@ -112,6 +350,140 @@ inline ScanTaskIterator GetScanTaskIterator(FragmentIterator fragments,
   return MakeFlattenIterator(std::move(maybe_scantask_it));
 }
 
+// The rows left to yield by a scan with a limit, shared by its scan tasks.
+class RowLimit {
+ public:
+  explicit RowLimit(int64_t limit) : remaining_(limit) {}
+
+  // Claim up to `num_rows` rows, return the number of rows claimed
+  int64_t Claim(int64_t num_rows) {
+    int64_t remaining = remaining_.load();
+    int64_t claimed;
+    do {
+      claimed = std::min(remaining, num_rows);
+    } while (claimed > 0 &&
+             !remaining_.compare_exchange_weak(remaining, remaining - claimed));
+    return std::max<int64_t>(claimed, 0);
+  }
+
+  bool reached() const { return remaining_.load() <= 0; }
+
+ private:
+  std::atomic<int64_t> remaining_;
+};
+
+// Truncate the batches of a ScanTask to the rows left under a RowLimit. No
+// batch is read anymore once the limit is reached.
+class LimitScanTask : public ScanTask {
+ public:
+  LimitScanTask(std::shared_ptr<ScanTask> task, std::shared_ptr<RowLimit> limit)
+      : ScanTask(task->options(), task->context()),
+        task_(std::move(task)),
+        limit_(std::move(limit)) {}
+
+  Result<RecordBatchIterator> Execute() override {
+    if (limit_->reached()) {
+      return MakeEmptyIterator<std::shared_ptr<RecordBatch>>();
+    }
+    ARROW_ASSIGN_OR_RAISE(auto it, task_->Execute());
+    return RecordBatchIterator(LimitIterator{std::move(it), limit_});
+  }
+
+ private:
+  struct LimitIterator {
+    Result<std::shared_ptr<RecordBatch>> Next() {
+      if (limit->reached()) {
+        return nullptr;
+      }
+      ARROW_ASSIGN_OR_RAISE(auto batch, it.Next());
+      if (batch == nullptr || batch->num_rows() == 0) {
+        return batch;
+      }
+      const int64_t claimed = limit->Claim(batch->num_rows());
+      if (claimed == 0) {
+        return nullptr;
+      }
+      return claimed < batch->num_rows() ? batch->Slice(0, claimed) : batch;
+    }
+
+    RecordBatchIterator it;
+    std::shared_ptr<RowLimit> limit;
+  };
+
+  std::shared_ptr<ScanTask> task_;
+  std::shared_ptr<RowLimit> limit_;
+};
+
+// Stop yielding fragments once a RowLimit is reached or, when the scan has no
+// filter, once the fragments yielded so far hold enough rows according to
+// their metadata. A fragment is counted when the next one is requested, so
+// that metadata loaded by scanning it is taken into account.
+inline FragmentIterator LimitFragments(FragmentIterator fragments, int64_t limit,
+                                       bool has_filter,
+                                       std::shared_ptr<RowLimit> row_limit) {
+  struct Impl {
+    Result<std::shared_ptr<Fragment>> Next() {
+      if (row_limit->reached()) {
+        return nullptr;
+      }
+      if (!has_filter) {
+        auto it = std::remove_if(uncounted.begin(), uncounted.end(),
+                                 [this](const std::shared_ptr<Fragment>& fragment) {
+                                   const int64_t num_rows =
+                                       fragment->CountRowsFromMetadata();
+                                   if (num_rows < 0) {
+                                     return false;
+                                   }
+                                   counted_rows += num_rows;
+                                   return true;
+                                 });
+        uncounted.erase(it, uncounted.end());
+        if (counted_rows >= limit) {
+          return nullptr;
+        }
+      }
+      ARROW_ASSIGN_OR_RAISE(auto fragment, fragments.Next());
+      if (fragment != nullptr && !has_filter) {
+        uncounted.push_back(fragment);
+      }
+      return fragment;
+    }
+
+    FragmentIterator fragments;
+    int64_t limit;
+    bool has_filter;
+    std::shared_ptr<RowLimit> row_limit;
+    std::vector<std::shared_ptr<Fragment>> uncounted;
+    int64_t counted_rows;
+  };
+
+  return FragmentIterator(
+      Impl{std::move(fragments), limit, has_filter, std::move(row_limit), {}, 0});
+}
+
+// Wrap the ScanTasks so that they stop once a RowLimit is reached, and stop
+// yielding ScanTasks then.
+inline ScanTaskIterator LimitScanTasks(ScanTaskIterator scan_tasks,
+                                       std::shared_ptr<RowLimit> row_limit) {
+  struct Impl {
+    Result<std::shared_ptr<ScanTask>> Next() {
+      if (row_limit->reached()) {
+        return nullptr;
+      }
+      ARROW_ASSIGN_OR_RAISE(auto scan_task, scan_tasks.Next());
+      if (scan_task == nullptr) {
+        return scan_task;
+      }
+      return std::make_shared<LimitScanTask>(std::move(scan_task), row_limit);
+    }
+
+    ScanTaskIterator scan_tasks;
+    std::shared_ptr<RowLimit> row_limit;
+  };
+
+  return ScanTaskIterator(Impl{std::move(scan_tasks), std::move(row_limit)});
+}
+
 struct FragmentRecordBatchReader : RecordBatchReader {
  public:
   std::shared_ptr<Schema> schema() const override { return options_->schema(); }
@@ -17,13 +17,19 @@
 
 #include "arrow/dataset/scanner.h"
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
 
+#include "arrow/dataset/scanner_internal.h"
 #include "arrow/dataset/test_util.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/testing/generator.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/bit_util.h"
 
 namespace arrow {
 namespace dataset {
@@ -76,6 +82,101 @@ TEST_F(TestScanner, ScanWithCappedBatchSize) {
                                    kNumberChildDatasets * kNumberBatches * 2);
 }
 
+TEST_F(TestScanner, NormalizeBatches) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, schema_);
+  const int64_t total_rows = kBatchSize * kNumberBatches * kNumberChildDatasets;
+  const int64_t row_size = BitUtil::CeilDiv(BufferSize(*batch), kBatchSize);
+  options_->batch_size_bytes = row_size * kBatchSize / 4;
+  options_->normalize_batches = true;
+  auto scanner = MakeScanner(batch);
+
+  for (bool use_threads : {false, true}) {
+    ctx_->use_threads = use_threads;
+    ASSERT_OK_AND_ASSIGN(auto batch_it, scanner.ScanBatchesUnordered());
+    int64_t num_rows = 0;
+    for (auto maybe_batch : batch_it) {
+      ASSERT_OK_AND_ASSIGN(auto actual, maybe_batch);
+      ASSERT_EQ(kBatchSize / 4, actual->num_rows());
+      num_rows += actual->num_rows();
+    }
+    ASSERT_EQ(total_rows, num_rows);
+  }
+
+  AssertScannerEqualsRepetitionsOf(scanner, batch->Slice(0, kBatchSize / 4),
+                                   kNumberChildDatasets * kNumberBatches * 4);
+}
+
+TEST_F(TestScanner, ComputedColumns) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = RecordBatchFromJSON(schema_, R"([
+    {"i32": -1, "f64": 0.5},
+    {"i32": 2, "f64": 1.5},
+    {"i32": null, "f64": 2.5},
+    {"i32": 4, "f64": 3.5}
+  ])");
+  auto dataset = std::make_shared<InMemoryDataset>(schema_, RecordBatchVector{batch});
+
+  ScannerBuilder builder(dataset, ctx_);
+  ASSERT_OK(builder.Project({"f64"}));
+  ASSERT_OK(builder.Filter("f64"_ < 3.0));
+  ASSERT_OK(builder.AddComputedColumn("positive", ("i32"_ > 0).Copy()));
+  ASSERT_OK(builder.AddComputedColumn("i32_f64", "i32"_.CastTo(float64()).Copy()));
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+
+  auto expected_schema = schema({field("f64", float64()), field("positive", boolean()),
+                                 field("i32_f64", float64())});
+  AssertSchemaEqual(*expected_schema, *scanner->schema());
+  // The computed columns aren't read, but their inputs are
+  EXPECT_THAT(scanner->options()->MaterializedFields(),
+              testing::ElementsAre("f64", "f64", "i32", "i32"));
+
+  auto expected = TableFromJSON(expected_schema, {R"([
+    {"f64": 0.5, "positive": false, "i32_f64": -1.0},
+    {"f64": 1.5, "positive": true, "i32_f64": 2.0},
+    {"f64": 2.5, "positive": null, "i32_f64": null}
+  ])"});
+  for (bool use_threads : {false, true}) {
+    ctx_->use_threads = use_threads;
+    ASSERT_OK_AND_ASSIGN(auto actual, scanner->ToTable());
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+
+    ASSERT_OK_AND_ASSIGN(auto batch_it, scanner->ScanBatchesUnordered());
+    ASSERT_OK_AND_ASSIGN(auto batches, batch_it.ToVector());
+    ASSERT_OK_AND_ASSIGN(actual, Table::FromRecordBatches(expected_schema, batches));
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+}
+
+TEST(RebatchRecordBatches, SplitsAndCoalesces) {
+  std::vector<int32_t> values(386);
+  std::iota(values.begin(), values.end(), 0);
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int32Type>(values, &array);
+  auto batch = RecordBatch::Make(schema({field("i32", int32())}), 386, {array});
+
+  RecordBatchVector batches;
+  int64_t offset = 0;
+  for (int64_t length : {10, 10, 10, 0, 100, 3, 3, 250}) {
+    batches.push_back(batch->Slice(offset, length));
+    offset += length;
+  }
+
+  auto it = RebatchRecordBatches(MakeVectorIterator(batches), /*max_rows=*/40,
+                                 /*max_bytes=*/0, default_memory_pool());
+  ASSERT_OK_AND_ASSIGN(auto rebatched, it.ToVector());
+  std::vector<int64_t> lengths;
+  for (const auto& out : rebatched) {
+    lengths.push_back(out->num_rows());
+  }
+  ASSERT_EQ(lengths, std::vector<int64_t>({20, 10, 34, 34, 32, 6, 36, 36, 36, 36, 36,
+                                           36, 34}));
+
+  ASSERT_OK_AND_ASSIGN(auto actual, Table::FromRecordBatches(rebatched));
+  ASSERT_OK_AND_ASSIGN(auto expected, Table::FromRecordBatches({batch}));
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
 TEST_F(TestScanner, FilteredScan) {
   SetSchema({field("f64", float64())});
 
@@ -147,6 +248,162 @@ TEST_F(TestScanner, ToTable) {
   AssertTablesEqual(*expected, *actual);
 }
 
+TEST_F(TestScanner, ScanBatchesUnordered) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, schema_);
+  std::vector<std::shared_ptr<RecordBatch>> batches{kNumberBatches * kNumberChildDatasets,
+                                                    batch};
+  ASSERT_OK_AND_ASSIGN(auto expected, Table::FromRecordBatches(batches));
+
+  auto scanner = MakeScanner(batch);
+  // As with ToTable, the batches are all the same so their order doesn't matter
+  for (bool use_threads : {false, true}) {
+    for (int32_t readahead : {1, 4, 64}) {
+      ctx_->use_threads = use_threads;
+      options_->fragment_readahead = readahead;
+      options_->batch_readahead = readahead;
+      // Smaller than a batch, which must still be let through
+      options_->readahead_bytes = kBatchSize;
+
+      ASSERT_OK_AND_ASSIGN(auto batch_it, scanner.ScanBatchesUnordered());
+      ASSERT_OK_AND_ASSIGN(auto actual_batches, batch_it.ToVector());
+      ASSERT_OK_AND_ASSIGN(auto actual,
+                           Table::FromRecordBatches(schema_, actual_batches));
+      AssertTablesEqual(*expected, *actual);
+    }
+  }
+}
+
+TEST_F(TestScanner, ScanBatchesUnorderedFiltered) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = RecordBatchFromJSON(schema_, R"([[1, 0.5], [2, 1.5], [3, 2.5]])");
+  options_->filter = ("i32"_ > 1).Copy();
+  options_->evaluator = std::make_shared<TreeEvaluator>();
+  options_ = options_->ReplaceSchema(schema({field("f64", float64())}));
+
+  auto scanner = MakeScanner(batch);
+  ASSERT_OK_AND_ASSIGN(auto batch_it, scanner.ScanBatchesUnordered());
+  int64_t num_batches = 0;
+  for (auto maybe_batch : batch_it) {
+    ASSERT_OK_AND_ASSIGN(auto actual, maybe_batch);
+    AssertBatchesEqual(*RecordBatchFromJSON(options_->schema(), "[[1.5], [2.5]]"),
+                       *actual);
+    ++num_batches;
+  }
+  ASSERT_EQ(kNumberBatches * kNumberChildDatasets, num_batches);
+}
+
+TEST_F(TestScanner, ScanBatchesUnorderedEarlyDestruction) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, schema_);
+  options_->batch_readahead = 1;
+  ctx_->use_threads = true;
+
+  auto scanner = MakeScanner(batch);
+  ASSERT_OK_AND_ASSIGN(auto batch_it, scanner.ScanBatchesUnordered());
+  ASSERT_OK_AND_ASSIGN(auto first, batch_it.Next());
+  ASSERT_NE(first, nullptr);
+  // Destroying the iterator stops and joins the background reads
+}
+
+TEST_F(TestScanner, StopToken) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, schema_);
+  StopSource stop_source;
+  stop_source.RequestStop();
+  ctx_->stop_token = stop_source.token();
+
+  auto scanner = MakeScanner(batch);
+  for (bool use_threads : {false, true}) {
+    ctx_->use_threads = use_threads;
+    ASSERT_RAISES(Cancelled, scanner.ToTable());
+
+    ASSERT_OK_AND_ASSIGN(auto batch_it, scanner.ScanBatchesUnordered());
+    ASSERT_RAISES(Cancelled, batch_it.Next());
+  }
+}
+
+TEST_F(TestScanner, Limit) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, schema_);
+  const int64_t total_rows = kBatchSize * kNumberBatches * kNumberChildDatasets;
+
+  for (int64_t limit : {int64_t(0), int64_t(1), kBatchSize + 10, total_rows + 1}) {
+    SCOPED_TRACE("limit = " + std::to_string(limit));
+    options_->limit = limit;
+    auto scanner = MakeScanner(batch);
+    const int64_t expected_rows = std::min(limit, total_rows);
+    for (bool use_threads : {false, true}) {
+      ctx_->use_threads = use_threads;
+      ASSERT_OK_AND_ASSIGN(auto table, scanner.ToTable());
+      ASSERT_EQ(expected_rows, table->num_rows());
+
+      ASSERT_OK_AND_ASSIGN(auto batch_it, scanner.ScanBatchesUnordered());
+      int64_t num_rows = 0;
+      for (auto maybe_batch : batch_it) {
+        ASSERT_OK_AND_ASSIGN(auto actual, maybe_batch);
+        num_rows += actual->num_rows();
+      }
+      ASSERT_EQ(expected_rows, num_rows);
+    }
+
+    // Scan tasks stop being yielded once the limit is reached
+    ASSERT_OK_AND_ASSIGN(auto scan_task_it, scanner.Scan());
+    int64_t num_tasks = 0;
+    for (auto maybe_scan_task : scan_task_it) {
+      ASSERT_OK_AND_ASSIGN(auto scan_task, maybe_scan_task);
+      ASSERT_OK_AND_ASSIGN(auto batch_it, scan_task->Execute());
+      ASSERT_OK(batch_it.ToVector().status());
+      ++num_tasks;
+    }
+    ASSERT_EQ(BitUtil::CeilDiv(expected_rows, kBatchSize), num_tasks);
+  }
+}
+
+TEST_F(TestScanner, LimitFromMetadata) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, schema_);
+  options_->limit = kBatchSize + 1;
+
+  // Without a filter, fragments are only opened until they hold enough rows
+  // according to their metadata, even though no scan task ran yet
+  auto scanner = MakeScanner(batch);
+  ASSERT_OK_AND_ASSIGN(auto scan_task_it, scanner.Scan());
+  ASSERT_OK_AND_ASSIGN(auto scan_tasks, scan_task_it.ToVector());
+  ASSERT_EQ(2, static_cast<int64_t>(scan_tasks.size()));
+
+  options_->filter = ("i32"_ == 0).Copy();
+  options_->evaluator = std::make_shared<TreeEvaluator>();
+  scanner = MakeScanner(batch);
+  ASSERT_OK_AND_ASSIGN(scan_task_it, scanner.Scan());
+  ASSERT_OK_AND_ASSIGN(scan_tasks, scan_task_it.ToVector());
+  ASSERT_EQ(kNumberBatches * kNumberChildDatasets,
+            static_cast<int64_t>(scan_tasks.size()));
+}
+
+TEST_F(TestScanner, CountRows) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, schema_);
+  const int64_t total_rows = kBatchSize * kNumberBatches * kNumberChildDatasets;
+  auto evaluator = std::make_shared<CountingEvaluator>();
+  // The limit doesn't apply
+  options_->limit = 1;
+
+  for (bool use_threads : {false, true}) {
+    ctx_->use_threads = use_threads;
+    options_->filter = scalar(true);
+    options_->evaluator = evaluator;
+    ASSERT_OK_AND_EQ(total_rows, MakeScanner(batch).CountRows());
+    // The in-memory fragments know their row count
+    ASSERT_EQ(0, evaluator->num_evaluations);
+
+    options_->filter = ("i32"_ == 0).Copy();
+    ASSERT_OK_AND_EQ(total_rows, MakeScanner(batch).CountRows());
+    options_->filter = ("i32"_ > 0).Copy();
+    ASSERT_OK_AND_EQ(0, MakeScanner(batch).CountRows());
+  }
+}
+
 class TestScannerBuilder : public ::testing::Test {
   void SetUp() {
     DatasetVector sources;
@@ -181,6 +438,22 @@ TEST_F(TestScannerBuilder, TestProject) {
   ASSERT_RAISES(Invalid, builder.Project({"i8", "not_found_column"}));
 }
 
+TEST_F(TestScannerBuilder, TestComputedColumns) {
+  ScannerBuilder builder(dataset_, ctx_);
+
+  ASSERT_OK(builder.AddComputedColumn("i8_positive", ("i8"_ > 0).Copy()));
+  ASSERT_OK(builder.AddComputedColumn("i16_i64", "i16"_.CastTo(int64()).Copy()));
+
+  ASSERT_RAISES(Invalid, builder.AddComputedColumn("i32", ("i8"_ > 0).Copy()));
+  ASSERT_RAISES(Invalid, builder.AddComputedColumn("i8_positive", ("i8"_ < 0).Copy()));
+  ASSERT_RAISES(Invalid,
+                builder.AddComputedColumn("other", ("not_found_column"_ > 0).Copy()));
+
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+  ASSERT_EQ(scanner->schema()->num_fields(), schema_->num_fields() + 2);
+  ASSERT_EQ(scanner->options()->computed_columns.size(), 2u);
+}
+
 TEST_F(TestScannerBuilder, TestFilter) {
   ScannerBuilder builder(dataset_, ctx_);
 
@@ -194,6 +467,50 @@ TEST_F(TestScannerBuilder, TestFilter) {
                 builder.Filter("i64"_ == int64_t(10) || "not_a_column"_ == true));
 }
 
+TEST_F(TestScannerBuilder, TestReadahead) {
+  ScannerBuilder builder(dataset_, ctx_);
+
+  ASSERT_OK(builder.FragmentReadahead(1));
+  ASSERT_OK(builder.BatchReadahead(16));
+  ASSERT_OK(builder.ReadaheadBytes(0));
+  ASSERT_OK(builder.ReadaheadBytes(1 << 20));
+
+  ASSERT_RAISES(Invalid, builder.FragmentReadahead(0));
+  ASSERT_RAISES(Invalid, builder.BatchReadahead(-1));
+  ASSERT_RAISES(Invalid, builder.ReadaheadBytes(-1));
+
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+  ASSERT_EQ(1, scanner->options()->fragment_readahead);
+  ASSERT_EQ(16, scanner->options()->batch_readahead);
+  ASSERT_EQ(1 << 20, scanner->options()->readahead_bytes);
+}
+
+TEST_F(TestScannerBuilder, TestNormalizeBatches) {
+  ScannerBuilder builder(dataset_, ctx_);
+
+  ASSERT_OK(builder.NormalizeBatches());
+  ASSERT_OK(builder.BatchSizeBytes(1 << 20));
+  ASSERT_RAISES(Invalid, builder.BatchSizeBytes(-1));
+
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+  ASSERT_TRUE(scanner->options()->normalize_batches);
+  ASSERT_EQ(1 << 20, scanner->options()->batch_size_bytes);
+}
+
+TEST_F(TestScannerBuilder, TestLimit) {
+  ScannerBuilder builder(dataset_, ctx_);
+
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+  ASSERT_EQ(-1, scanner->options()->limit);
+
+  ASSERT_OK(builder.Limit(0));
+  ASSERT_OK(builder.Limit(100));
+  ASSERT_RAISES(Invalid, builder.Limit(-1));
+
+  ASSERT_OK_AND_ASSIGN(scanner, builder.Finish());
+  ASSERT_EQ(100, scanner->options()->limit);
+}
+
 using testing::ElementsAre;
 using testing::IsEmpty;
 
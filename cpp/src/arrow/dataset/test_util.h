@@ -18,6 +18,7 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <ciso646>
 #include <functional>
 #include <memory>
@@ -97,6 +98,19 @@ void EnsureRecordBatchReaderDrained(RecordBatchReader* reader) {
   EXPECT_EQ(batch, nullptr);
 }
 
+// A TreeEvaluator counting the expressions it evaluates, to tell whether rows
+// were scanned
+class CountingEvaluator : public TreeEvaluator {
+ public:
+  Result<Datum> Evaluate(const Expression& expr, const RecordBatch& batch,
+                         MemoryPool* pool) const override {
+    ++num_evaluations;
+    return TreeEvaluator::Evaluate(expr, batch, pool);
+  }
+
+  mutable std::atomic<int> num_evaluations{0};
+};
+
 class DatasetFixtureMixin : public ::testing::Test {
  public:
   DatasetFixtureMixin() : ctx_(std::make_shared<ScanContext>()) {}
@@ -763,6 +777,98 @@ class WriteFileSystemDatasetMixin : public MakeFileSystemDatasetMixin {
     AssertWrittenAsExpected();
   }
 
+  std::shared_ptr<Scanner> MakeSourceScanner(bool use_threads) {
+    auto context = std::make_shared<ScanContext>();
+    context->use_threads = use_threads;
+    EXPECT_OK_AND_ASSIGN(auto builder, dataset_->NewScan(std::move(context)));
+    EXPECT_OK_AND_ASSIGN(auto scanner, builder->Finish());
+    return scanner;
+  }
+
+  FileSystemDatasetWriteOptions MakeWriteOptions() {
+    FileSystemDatasetWriteOptions write_options;
+    write_options.format = format_;
+    write_options.filesystem = fs_;
+    write_options.base_dir = "new_root/";
+    write_options.partitioning = std::make_shared<DirectoryPartitioning>(
+        SchemaFromColumnNames(source_schema_, {"year", "month"}));
+    return write_options;
+  }
+
+  // Return the number of rows of each written file
+  std::unordered_map<std::string, int64_t> ReadWrittenRowCounts(
+      const FileSystemDatasetWriteOptions& write_options) {
+    fs::FileSelector s;
+    s.recursive = true;
+    s.base_dir = "/new_root";
+
+    FileSystemFactoryOptions options;
+    options.partitioning = write_options.partitioning;
+    std::unordered_map<std::string, int64_t> row_counts;
+    EXPECT_OK_AND_ASSIGN(auto factory,
+                         FileSystemDatasetFactory::Make(fs_, s, format_, options));
+    EXPECT_OK_AND_ASSIGN(written_, factory->Finish());
+    for (auto maybe_fragment : written_->GetFragments()) {
+      EXPECT_OK_AND_ASSIGN(auto fragment, std::move(maybe_fragment));
+      EXPECT_OK_AND_ASSIGN(auto physical_schema, fragment->ReadPhysicalSchema());
+      AssertSchemaEqual(*expected_physical_schema_, *physical_schema);
+      EXPECT_OK_AND_ASSIGN(auto scanner, ScannerBuilder(physical_schema, fragment,
+                                                        std::make_shared<ScanContext>())
+                                             .Finish());
+      EXPECT_OK_AND_ASSIGN(auto table, scanner->ToTable());
+      const auto& path = checked_pointer_cast<FileFragment>(fragment)->source().path();
+      row_counts[path] = table->num_rows();
+    }
+    return row_counts;
+  }
+
+  void TestWriteFromScanner() {
+    auto write_options = MakeWriteOptions();
+    ASSERT_OK(FileSystemDataset::Write(write_options, MakeSourceScanner(true)));
+
+    expected_physical_schema_ =
+        SchemaFromColumnNames(source_schema_, {"region", "model", "sales", "country"});
+    std::unordered_map<std::string, int64_t> expected_row_counts = {
+        {"/new_root/2018/1/part-0." + format_->type_name(), 8},
+        {"/new_root/2019/1/part-0." + format_->type_name(), 8},
+    };
+    EXPECT_EQ(ReadWrittenRowCounts(write_options), expected_row_counts);
+  }
+
+  void TestWriteFromScannerRollsFiles() {
+    auto write_options = MakeWriteOptions();
+    write_options.max_rows_per_file = 3;
+    write_options.max_open_files = 1;
+    write_options.basename_template = "chunk_{i}";
+    ASSERT_OK(FileSystemDataset::Write(write_options, MakeSourceScanner(true)));
+
+    expected_physical_schema_ =
+        SchemaFromColumnNames(source_schema_, {"region", "model", "sales", "country"});
+    std::unordered_map<std::string, int64_t> rows_per_dir;
+    for (const auto& path_rows : ReadWrittenRowCounts(write_options)) {
+      auto parent_basename = fs::internal::GetAbstractPathParent(path_rows.first);
+      EXPECT_THAT(parent_basename.second, testing::StartsWith("chunk_"));
+      EXPECT_GT(path_rows.second, 0);
+      EXPECT_LE(path_rows.second, 3);
+      rows_per_dir[parent_basename.first] += path_rows.second;
+    }
+    std::unordered_map<std::string, int64_t> expected_rows_per_dir = {
+        {"/new_root/2018/1", 8}, {"/new_root/2019/1", 8}};
+    EXPECT_EQ(rows_per_dir, expected_rows_per_dir);
+  }
+
+  void TestWriteFromScannerInvalidOptions() {
+    auto write_options = MakeWriteOptions();
+    write_options.basename_template = "part";
+    ASSERT_RAISES(Invalid,
+                  FileSystemDataset::Write(write_options, MakeSourceScanner(false)));
+
+    write_options = MakeWriteOptions();
+    write_options.max_open_files = 0;
+    ASSERT_RAISES(Invalid,
+                  FileSystemDataset::Write(write_options, MakeSourceScanner(false)));
+  }
+
   void AssertWrittenAsExpected() {
     std::vector<std::string> files;
     for (const auto& file_contents : expected_files_) {
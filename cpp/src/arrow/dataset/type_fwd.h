@@ -47,6 +47,7 @@ using FragmentVector = std::vector<std::shared_ptr<Fragment>>;
 
 class FileSource;
 class FileFormat;
+class FileMetadataCache;
 class FileFragment;
 class FileSystemDataset;
 
@@ -22,12 +22,15 @@
 #include <string>
 #include <vector>
 
+#include "arrow/type_fwd.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
 namespace hiveserver2 {
 
+class ColumnDesc;
+
 // The Column class is used to access data that was fetched in columnar format.
 // The contents of the data can be accessed through the data() fn, which returns
 // a ptr to a vector containing the contents of this column in the fetched
@@ -137,6 +140,17 @@ class ARROW_EXPORT ColumnarRowSet {
   template <typename T>
   std::unique_ptr<T> GetCol(int i) const;
 
+  // Converts the fetched columns to an Arrow RecordBatch, naming the fields after
+  // 'column_descs' (as returned by Operation::GetResultSetMetadata). The Arrow type of
+  // each field follows the Thrift column type: BOOLEAN, TINYINT, SMALLINT, INT and
+  // BIGINT map to the matching Arrow types, FLOAT and DOUBLE to float64, BINARY to
+  // binary and all remaining types, which HiveServer2 sends as strings, to utf8.
+  //
+  // Values are copied out of the Thrift buffers in bulk, so the batch stays valid
+  // after this ColumnarRowSet is destroyed.
+  Status ToRecordBatch(const std::vector<ColumnDesc>& column_descs, MemoryPool* pool,
+                       std::shared_ptr<RecordBatch>* out) const;
+
  private:
   // Hides Thrift objects from the header.
   struct ColumnarRowSetImpl;
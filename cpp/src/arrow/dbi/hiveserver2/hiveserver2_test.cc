@@ -28,8 +28,12 @@
 #include "arrow/dbi/hiveserver2/session.h"
 #include "arrow/dbi/hiveserver2/thrift_internal.h"
 
+#include "arrow/array.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
 
 namespace arrow {
 namespace hiveserver2 {
@@ -279,6 +283,39 @@ TEST_F(OperationTest, TestIsNull) {
   ASSERT_OK(select_nulls_op->Close());
 }
 
+TEST_F(OperationTest, TestFetchRecordBatch) {
+  CreateTestTable();
+  InsertIntoTestTable(std::vector<int>({1, 2, 3, 4, 5, NULL_INT_VALUE}),
+                      std::vector<std::string>({"a", "b", "NULL", "d", "e", "f"}));
+
+  std::unique_ptr<Operation> select_op;
+  ASSERT_OK(session_->ExecuteStatement("select * from " + TEST_TBL + " order by int_col",
+                                       &select_op));
+  ASSERT_OK(Wait(select_op));
+
+  // Batches of at most 4 rows, the second fetched while the first is consumed.
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(select_op->GetRecordBatchReader(4, default_memory_pool(), &reader));
+  auto expected_schema = schema({field(TEST_COL1, int32()), field(TEST_COL2, utf8())});
+  AssertSchemaEqual(*expected_schema, *reader->schema());
+
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_NE(batch, nullptr);
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 2, 3, 4]"), *batch->column(0));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["a", "b", null, "d"])"),
+                    *batch->column(1));
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_NE(batch, nullptr);
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[5, null]"), *batch->column(0));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["e", "f"])"), *batch->column(1));
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+  reader.reset();
+
+  ASSERT_OK(select_op->Close());
+}
+
 TEST_F(OperationTest, TestCancel) {
   CreateTestTable();
   InsertIntoTestTable(std::vector<int>({1, 2, 3, 4}),
@@ -17,14 +17,21 @@
 
 #include "arrow/dbi/hiveserver2/operation.h"
 
+#include <utility>
+
 #include "arrow/dbi/hiveserver2/thrift_internal.h"
 
 #include "arrow/dbi/hiveserver2/ImpalaService_types.h"
 #include "arrow/dbi/hiveserver2/TCLIService.h"
 
+#include "arrow/io/util_internal.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/thread_pool.h"
 
 namespace hs2 = apache::hive::service::cli::thrift;
 using std::unique_ptr;
@@ -113,6 +120,114 @@ Status Operation::Fetch(int max_rows, FetchOrientation orientation,
   return status;
 }
 
+Status Operation::Fetch(int max_rows, MemoryPool* pool, std::shared_ptr<RecordBatch>* out,
+                        bool* has_more_rows) const {
+  std::vector<ColumnDesc> column_descs;
+  RETURN_NOT_OK(GetResultSetMetadata(&column_descs));
+  unique_ptr<ColumnarRowSet> results;
+  RETURN_NOT_OK(Fetch(max_rows, FetchOrientation::NEXT, &results, has_more_rows));
+  return results->ToRecordBatch(column_descs, pool, out);
+}
+
+namespace {
+
+struct FetchedRowSet {
+  std::shared_ptr<ColumnarRowSet> results;
+  bool has_more_rows;
+};
+
+// Keeps one FetchResults rpc in flight while the caller consumes the previous batch,
+// so that the Thrift round trip overlaps the conversion to Arrow. At most one rpc is
+// outstanding at a time, as the Thrift client is not thread-safe.
+class PrefetchingRecordBatchReader : public RecordBatchReader {
+ public:
+  PrefetchingRecordBatchReader(const Operation* op, int max_rows, MemoryPool* pool,
+                               std::vector<ColumnDesc> column_descs)
+      : op_(op),
+        max_rows_(max_rows),
+        pool_(pool),
+        column_descs_(std::move(column_descs)) {}
+
+  ~PrefetchingRecordBatchReader() override {
+    if (pending_.is_valid()) pending_.Wait();
+  }
+
+  Status Init() {
+    RETURN_NOT_OK(StartFetch());
+    RETURN_NOT_OK(FetchNext(&first_batch_));
+    schema_ = first_batch_->schema();
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    if (first_batch_ != nullptr) {
+      *batch = std::move(first_batch_);
+      first_batch_.reset();
+      if ((*batch)->num_rows() > 0) return Status::OK();
+    }
+    // Impala may report more rows with an empty batch, skip those
+    do {
+      RETURN_NOT_OK(FetchNext(batch));
+    } while (*batch != nullptr && (*batch)->num_rows() == 0);
+    return Status::OK();
+  }
+
+ private:
+  Status StartFetch() {
+    const Operation* op = op_;
+    const int max_rows = max_rows_;
+    ARROW_ASSIGN_OR_RAISE(
+        pending_, io::internal::GetIOThreadPool()->Submit(
+                      [op, max_rows]() -> Result<FetchedRowSet> {
+                        unique_ptr<ColumnarRowSet> results;
+                        FetchedRowSet fetched;
+                        RETURN_NOT_OK(op->Fetch(max_rows, FetchOrientation::NEXT,
+                                                &results, &fetched.has_more_rows));
+                        fetched.results = std::move(results);
+                        return fetched;
+                      }));
+    return Status::OK();
+  }
+
+  // Sets 'batch' to null once all results have been fetched.
+  Status FetchNext(std::shared_ptr<RecordBatch>* batch) {
+    if (!pending_.is_valid()) {
+      batch->reset();
+      return Status::OK();
+    }
+    Future<FetchedRowSet> pending = std::move(pending_);
+    pending_ = Future<FetchedRowSet>();
+    ARROW_ASSIGN_OR_RAISE(FetchedRowSet fetched, std::move(pending).result());
+    if (fetched.has_more_rows) {
+      RETURN_NOT_OK(StartFetch());
+    }
+    return fetched.results->ToRecordBatch(column_descs_, pool_, batch);
+  }
+
+  const Operation* op_;
+  const int max_rows_;
+  MemoryPool* pool_;
+  const std::vector<ColumnDesc> column_descs_;
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<RecordBatch> first_batch_;
+  Future<FetchedRowSet> pending_;
+};
+
+}  // namespace
+
+Status Operation::GetRecordBatchReader(int max_rows, MemoryPool* pool,
+                                       std::shared_ptr<RecordBatchReader>* out) const {
+  std::vector<ColumnDesc> column_descs;
+  RETURN_NOT_OK(GetResultSetMetadata(&column_descs));
+  auto reader = std::make_shared<PrefetchingRecordBatchReader>(this, max_rows, pool,
+                                                               std::move(column_descs));
+  RETURN_NOT_OK(reader->Init());
+  *out = std::move(reader);
+  return Status::OK();
+}
+
 Status Operation::Cancel() const {
   hs2::TCancelOperationReq req;
   req.__set_operationHandle(impl_->handle);
@@ -24,13 +24,12 @@
 #include "arrow/dbi/hiveserver2/columnar_row_set.h"
 #include "arrow/dbi/hiveserver2/types.h"
 
+#include "arrow/type_fwd.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
 
-class Status;
-
 namespace hiveserver2 {
 
 struct ThriftRPC;
@@ -91,6 +90,19 @@ class ARROW_EXPORT Operation {
   Status Fetch(int max_rows, FetchOrientation orientation,
                std::unique_ptr<ColumnarRowSet>* results, bool* has_more_rows) const;
 
+  // Fetches the next batch of at most max_rows results and converts it to an Arrow
+  // RecordBatch with one field per column in GetResultSetMetadata.
+  Status Fetch(int max_rows, MemoryPool* pool, std::shared_ptr<RecordBatch>* out,
+               bool* has_more_rows) const;
+
+  // Returns a reader over the remaining results in batches of at most max_rows. While
+  // the reader converts one batch to Arrow, the next one is already being fetched on
+  // the IO thread pool. No other calls may be made on this operation or its session
+  // until the reader is exhausted or destroyed, and the operation must outlive the
+  // reader. Fetches the first batch before returning, to determine the schema.
+  Status GetRecordBatchReader(int max_rows, MemoryPool* pool,
+                              std::shared_ptr<RecordBatchReader>* out) const;
+
   // May be called after successfully creating the operation and before calling Close.
   Status Cancel() const;
 
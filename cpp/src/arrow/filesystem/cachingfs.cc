@@ -0,0 +1,450 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/filesystem/cachingfs.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <iomanip>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/io/concurrency.h"
+#include "arrow/io/file.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/hashing.h"
+
+namespace arrow {
+namespace fs {
+
+using internal::ConcatAbstractPath;
+
+namespace {
+
+// The file holding the key of a cache entry, next to its blocks
+constexpr char kKeyFileName[] = "key";
+
+std::string RandomSuffix() {
+  static thread_local std::mt19937_64 rng(std::random_device{}());
+  std::stringstream ss;
+  ss << ".tmp-" << std::hex << rng();
+  return ss.str();
+}
+
+}  // namespace
+
+// The local cache directory.
+//
+// Each cached file version has an entry directory named after the hash of its
+// key, holding the key and the cached blocks, one file per block.  Files are
+// written under a temporary name and then renamed, so that concurrent readers
+// (possibly in other processes) see either a complete file or none.
+class CachingFileSystem::BlockCache {
+ public:
+  explicit BlockCache(const CachingFileSystemOptions& options) : options_(options) {}
+
+  Status Init() {
+    if (options_.cache_dir.empty()) {
+      return Status::Invalid("CachingFileSystem needs a cache directory");
+    }
+    if (options_.block_size <= 0) {
+      return Status::Invalid("Invalid CachingFileSystem block size: ",
+                             options_.block_size);
+    }
+    RETURN_NOT_OK(local_fs_.CreateDir(options_.cache_dir));
+    std::vector<FileInfo> blocks;
+    ARROW_ASSIGN_OR_RAISE(int64_t cache_size, ScanBlocks(&blocks));
+    cache_size_.store(cache_size);
+    return Status::OK();
+  }
+
+  const CachingFileSystemOptions& options() const { return options_; }
+
+  // Return the entry directory for the given key, or an empty string if the
+  // cache can't be used
+  std::string EntryDir(const std::string& key) {
+    const auto hash = ::arrow::internal::ComputeStringHash<0>(
+        key.data(), static_cast<int64_t>(key.size()));
+    std::stringstream ss;
+    ss << std::hex << std::setw(16) << std::setfill('0') << hash;
+    const std::string entry_dir = ConcatAbstractPath(options_.cache_dir, ss.str());
+    const std::string key_path = ConcatAbstractPath(entry_dir, kKeyFileName);
+
+    auto maybe_key_file = io::ReadableFile::Open(key_path);
+    if (maybe_key_file.ok()) {
+      auto maybe_key = (*maybe_key_file)->Read(key.size() + 1);
+      if (maybe_key.ok() && (*maybe_key)->ToString() == key) {
+        return entry_dir;
+      }
+      // Hash collision (or unreadable key), don't cache
+      return "";
+    }
+    if (!local_fs_.CreateDir(entry_dir).ok() ||
+        !WriteFileAtomically(key_path, Buffer(key)).ok()) {
+      return "";
+    }
+    return entry_dir;
+  }
+
+  // Read from a cached block, returning false if it isn't cached
+  bool ReadBlock(const std::string& entry_dir, int64_t block, int64_t block_length,
+                 int64_t offset, int64_t nbytes, void* out) {
+    auto maybe_file = io::ReadableFile::Open(BlockPath(entry_dir, block));
+    if (!maybe_file.ok()) {
+      return false;
+    }
+    auto file = *std::move(maybe_file);
+    auto maybe_size = file->GetSize();
+    if (!maybe_size.ok() || *maybe_size != block_length) {
+      return false;
+    }
+    // Even if the block is evicted meanwhile, the opened file remains readable
+    // (except on Windows, where eviction fails instead)
+    auto maybe_bytes_read = file->ReadAt(offset, nbytes, out);
+    return maybe_bytes_read.ok() && *maybe_bytes_read == nbytes;
+  }
+
+  // Cache a block.  Caching is best effort, errors are ignored.
+  void WriteBlock(const std::string& entry_dir, int64_t block, const Buffer& data) {
+    if (!WriteFileAtomically(BlockPath(entry_dir, block), data).ok()) {
+      return;
+    }
+    if (cache_size_.fetch_add(data.size()) + data.size() > options_.max_cache_size) {
+      Evict();
+    }
+  }
+
+ private:
+  static std::string BlockPath(const std::string& entry_dir, int64_t block) {
+    return ConcatAbstractPath(entry_dir, std::to_string(block));
+  }
+
+  Status WriteFileAtomically(const std::string& path, const Buffer& data) {
+    const std::string temp_path = path + RandomSuffix();
+    Status st = WriteFile(temp_path, data);
+    if (st.ok()) {
+      st = local_fs_.Move(temp_path, path);
+    }
+    if (!st.ok()) {
+      ARROW_UNUSED(local_fs_.DeleteFile(temp_path));
+    }
+    return st;
+  }
+
+  static Status WriteFile(const std::string& path, const Buffer& data) {
+    ARROW_ASSIGN_OR_RAISE(auto out, io::FileOutputStream::Open(path));
+    RETURN_NOT_OK(out->Write(data.data(), data.size()));
+    return out->Close();
+  }
+
+  // List the cached blocks (including the ones written by other processes)
+  // and return their total size
+  Result<int64_t> ScanBlocks(std::vector<FileInfo>* blocks) {
+    FileSelector select;
+    select.base_dir = options_.cache_dir;
+    select.recursive = true;
+    ARROW_ASSIGN_OR_RAISE(auto infos, local_fs_.GetFileInfo(select));
+    int64_t total_size = 0;
+    for (auto& info : infos) {
+      if (info.IsFile() && info.base_name() != kKeyFileName) {
+        total_size += info.size();
+        blocks->push_back(std::move(info));
+      }
+    }
+    return total_size;
+  }
+
+  // Evict the oldest blocks, down to a low watermark so as not to rescan the
+  // cache directory on every write
+  void Evict() {
+    std::lock_guard<std::mutex> lock(evict_mutex_);
+    if (cache_size_.load() <= options_.max_cache_size) {
+      // Already evicted by another thread
+      return;
+    }
+    std::vector<FileInfo> blocks;
+    auto maybe_cache_size = ScanBlocks(&blocks);
+    if (!maybe_cache_size.ok()) {
+      return;
+    }
+    int64_t cache_size = *maybe_cache_size;
+    if (cache_size > options_.max_cache_size) {
+      const int64_t target_size = options_.max_cache_size - options_.max_cache_size / 10;
+      std::sort(blocks.begin(), blocks.end(), [](const FileInfo& a, const FileInfo& b) {
+        return a.mtime() < b.mtime();
+      });
+      for (const auto& info : blocks) {
+        if (cache_size <= target_size) {
+          break;
+        }
+        if (local_fs_.DeleteFile(info.path()).ok()) {
+          cache_size -= info.size();
+        }
+      }
+    }
+    cache_size_.store(cache_size);
+  }
+
+  const CachingFileSystemOptions options_;
+  LocalFileSystem local_fs_;
+  // An estimate of the size of the cached data
+  std::atomic<int64_t> cache_size_{0};
+  std::mutex evict_mutex_;
+};
+
+namespace {
+
+// A file reading its blocks from the cache, or from the base filesystem
+// (caching them) on misses
+class CachedFile : public io::internal::RandomAccessFileConcurrencyWrapper<CachedFile> {
+ public:
+  CachedFile(std::shared_ptr<FileSystem> base_fs, FileInfo info,
+             std::shared_ptr<CachingFileSystem::BlockCache> cache, std::string entry_dir)
+      : base_fs_(std::move(base_fs)),
+        info_(std::move(info)),
+        cache_(std::move(cache)),
+        entry_dir_(std::move(entry_dir)) {}
+
+  bool closed() const override { return closed_; }
+
+ protected:
+  friend RandomAccessFileConcurrencyWrapper<CachedFile>;
+
+  Status CheckClosed() const {
+    if (closed_) {
+      return Status::Invalid("Operation on closed file");
+    }
+    return Status::OK();
+  }
+
+  Status DoClose() {
+    closed_ = true;
+    std::lock_guard<std::mutex> lock(base_file_mutex_);
+    if (base_file_ != nullptr) {
+      RETURN_NOT_OK(base_file_->Close());
+      base_file_.reset();
+    }
+    return Status::OK();
+  }
+
+  Result<int64_t> DoTell() const {
+    RETURN_NOT_OK(CheckClosed());
+    return pos_;
+  }
+
+  Status DoSeek(int64_t position) {
+    RETURN_NOT_OK(CheckClosed());
+    if (position < 0 || position > info_.size()) {
+      return Status::IOError("Seek out of bounds");
+    }
+    pos_ = position;
+    return Status::OK();
+  }
+
+  Result<int64_t> DoGetSize() {
+    RETURN_NOT_OK(CheckClosed());
+    return info_.size();
+  }
+
+  Result<int64_t> DoRead(int64_t nbytes, void* out) {
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, DoReadAt(pos_, nbytes, out));
+    pos_ += bytes_read;
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> DoRead(int64_t nbytes) {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, DoReadAt(pos_, nbytes));
+    pos_ += buffer->size();
+    return buffer;
+  }
+
+  Result<int64_t> DoReadAt(int64_t position, int64_t nbytes, void* out) {
+    RETURN_NOT_OK(CheckClosed());
+    if (position < 0 || nbytes < 0) {
+      return Status::Invalid("Invalid read (offset = ", position, ", size = ", nbytes,
+                             ")");
+    }
+    nbytes = std::max<int64_t>(0, std::min(nbytes, info_.size() - position));
+
+    const int64_t block_size = cache_->options().block_size;
+    auto out_data = reinterpret_cast<uint8_t*>(out);
+    int64_t bytes_read = 0;
+    while (bytes_read < nbytes) {
+      const int64_t block = (position + bytes_read) / block_size;
+      const int64_t block_start = block * block_size;
+      const int64_t block_length = std::min(block_size, info_.size() - block_start);
+      const int64_t offset = position + bytes_read - block_start;
+      const int64_t chunk_length = std::min(nbytes - bytes_read, block_length - offset);
+      if (!cache_->ReadBlock(entry_dir_, block, block_length, offset, chunk_length,
+                             out_data + bytes_read)) {
+        ARROW_ASSIGN_OR_RAISE(auto data, FetchBlock(block_start, block_length));
+        std::memcpy(out_data + bytes_read, data->data() + offset, chunk_length);
+        cache_->WriteBlock(entry_dir_, block, *data);
+      }
+      bytes_read += chunk_length;
+    }
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> DoReadAt(int64_t position, int64_t nbytes) {
+    RETURN_NOT_OK(CheckClosed());
+    nbytes = std::max<int64_t>(0, std::min(nbytes, info_.size() - position));
+    ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes));
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                          DoReadAt(position, nbytes, buffer->mutable_data()));
+    RETURN_NOT_OK(buffer->Resize(bytes_read));
+    return std::shared_ptr<Buffer>(std::move(buffer));
+  }
+
+  // Read a whole block from the base filesystem, opening the file on the first miss
+  Result<std::shared_ptr<Buffer>> FetchBlock(int64_t block_start, int64_t block_length) {
+    std::shared_ptr<io::RandomAccessFile> base_file;
+    {
+      std::lock_guard<std::mutex> lock(base_file_mutex_);
+      if (base_file_ == nullptr) {
+        ARROW_ASSIGN_OR_RAISE(base_file_, base_fs_->OpenInputFile(info_));
+      }
+      base_file = base_file_;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto data, base_file->ReadAt(block_start, block_length));
+    if (data->size() != block_length) {
+      return Status::IOError("File '", info_.path(), "' changed while being read");
+    }
+    return data;
+  }
+
+  const std::shared_ptr<FileSystem> base_fs_;
+  const FileInfo info_;
+  const std::shared_ptr<CachingFileSystem::BlockCache> cache_;
+  const std::string entry_dir_;
+
+  bool closed_ = false;
+  int64_t pos_ = 0;
+  std::mutex base_file_mutex_;
+  std::shared_ptr<io::RandomAccessFile> base_file_;
+};
+
+}  // namespace
+
+CachingFileSystem::CachingFileSystem(std::shared_ptr<FileSystem> base_fs,
+                                     std::shared_ptr<BlockCache> cache)
+    : base_fs_(std::move(base_fs)), cache_(std::move(cache)) {}
+
+CachingFileSystem::~CachingFileSystem() {}
+
+Result<std::shared_ptr<CachingFileSystem>> CachingFileSystem::Make(
+    std::shared_ptr<FileSystem> base_fs, const CachingFileSystemOptions& options) {
+  auto cache = std::make_shared<BlockCache>(options);
+  RETURN_NOT_OK(cache->Init());
+  return std::shared_ptr<CachingFileSystem>(
+      new CachingFileSystem(std::move(base_fs), std::move(cache)));
+}
+
+CachingFileSystemOptions CachingFileSystem::options() const { return cache_->options(); }
+
+bool CachingFileSystem::Equals(const FileSystem& other) const { return this == &other; }
+
+Result<FileInfo> CachingFileSystem::GetFileInfo(const std::string& path) {
+  return base_fs_->GetFileInfo(path);
+}
+
+Result<std::vector<FileInfo>> CachingFileSystem::GetFileInfo(
+    const FileSelector& selector) {
+  return base_fs_->GetFileInfo(selector);
+}
+
+Status CachingFileSystem::CreateDir(const std::string& path, bool recursive) {
+  return base_fs_->CreateDir(path, recursive);
+}
+
+Status CachingFileSystem::DeleteDir(const std::string& path) {
+  return base_fs_->DeleteDir(path);
+}
+
+Status CachingFileSystem::DeleteDirContents(const std::string& path) {
+  return base_fs_->DeleteDirContents(path);
+}
+
+Status CachingFileSystem::DeleteRootDirContents() {
+  return base_fs_->DeleteRootDirContents();
+}
+
+Status CachingFileSystem::DeleteFile(const std::string& path) {
+  return base_fs_->DeleteFile(path);
+}
+
+Status CachingFileSystem::Move(const std::string& src, const std::string& dest) {
+  return base_fs_->Move(src, dest);
+}
+
+Status CachingFileSystem::CopyFile(const std::string& src, const std::string& dest) {
+  return base_fs_->CopyFile(src, dest);
+}
+
+Result<std::shared_ptr<io::InputStream>> CachingFileSystem::OpenInputStream(
+    const std::string& path) {
+  return OpenInputFile(path);
+}
+
+Result<std::shared_ptr<io::InputStream>> CachingFileSystem::OpenInputStream(
+    const FileInfo& info) {
+  return OpenInputFile(info);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> CachingFileSystem::OpenInputFile(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto info, base_fs_->GetFileInfo(path));
+  return OpenInputFile(info);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> CachingFileSystem::OpenInputFile(
+    const FileInfo& info) {
+  if (info.type() != FileType::File || info.size() == kNoSize ||
+      info.mtime() == kNoTime) {
+    return base_fs_->OpenInputFile(info);
+  }
+  std::stringstream key;
+  key << base_fs_->type_name() << "\n"
+      << info.path() << "\n"
+      << info.mtime().time_since_epoch().count() << "\n"
+      << info.size();
+  std::string entry_dir = cache_->EntryDir(key.str());
+  if (entry_dir.empty()) {
+    return base_fs_->OpenInputFile(info);
+  }
+  return std::make_shared<CachedFile>(base_fs_, info, cache_, std::move(entry_dir));
+}
+
+Result<std::shared_ptr<io::OutputStream>> CachingFileSystem::OpenOutputStream(
+    const std::string& path) {
+  return base_fs_->OpenOutputStream(path);
+}
+
+Result<std::shared_ptr<io::OutputStream>> CachingFileSystem::OpenAppendStream(
+    const std::string& path) {
+  return base_fs_->OpenAppendStream(path);
+}
+
+}  // namespace fs
+}  // namespace arrow
@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/filesystem/filesystem.h"
+
+namespace arrow {
+namespace fs {
+
+/// Options for the read-through caching filesystem.
+struct ARROW_EXPORT CachingFileSystemOptions {
+  /// Local directory holding the cached data.
+  ///
+  /// The directory may be shared by several processes caching the same
+  /// filesystem, e.g. all the jobs of a node.
+  std::string cache_dir;
+  /// Maximum size in bytes of the cached data.
+  ///
+  /// The oldest cached blocks are evicted when the limit is exceeded.
+  int64_t max_cache_size = static_cast<int64_t>(10) << 30;
+  /// Size in bytes of the blocks files are cached in
+  int64_t block_size = 4 << 20;
+};
+
+/// \brief A FileSystem implementation that delegates to another
+/// implementation but caches the contents of the files read in a local
+/// directory.
+///
+/// Files are cached in blocks, as they are read through OpenInputFile or
+/// OpenInputStream.  Cached data is keyed by the file path, size and
+/// modification time, so that a modified file isn't served from the cache.
+/// Files without a known size or modification time aren't cached.
+///
+/// Blocks are written atomically, so that processes sharing the cache
+/// directory don't see partial blocks.
+class ARROW_EXPORT CachingFileSystem : public FileSystem {
+ public:
+  ~CachingFileSystem() override;
+
+  /// Create a CachingFileSystem, and the cache directory if it doesn't exist.
+  static Result<std::shared_ptr<CachingFileSystem>> Make(
+      std::shared_ptr<FileSystem> base_fs, const CachingFileSystemOptions& options);
+
+  std::string type_name() const override { return "caching"; }
+  std::shared_ptr<FileSystem> base_fs() const { return base_fs_; }
+  CachingFileSystemOptions options() const;
+
+  bool Equals(const FileSystem& other) const override;
+
+  using FileSystem::GetFileInfo;
+  Result<FileInfo> GetFileInfo(const std::string& path) override;
+  Result<std::vector<FileInfo>> GetFileInfo(const FileSelector& select) override;
+
+  Status CreateDir(const std::string& path, bool recursive = true) override;
+
+  Status DeleteDir(const std::string& path) override;
+  Status DeleteDirContents(const std::string& path) override;
+  Status DeleteRootDirContents() override;
+
+  Status DeleteFile(const std::string& path) override;
+
+  Status Move(const std::string& src, const std::string& dest) override;
+
+  Status CopyFile(const std::string& src, const std::string& dest) override;
+
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(const FileInfo& info) override;
+  /// Open a file reading through the cache.
+  ///
+  /// A file opened from a FileInfo holding its size and modification time
+  /// is only opened on the base filesystem if data is missing from the cache.
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const FileInfo& info) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenAppendStream(
+      const std::string& path) override;
+
+  class BlockCache;
+
+ protected:
+  CachingFileSystem(std::shared_ptr<FileSystem> base_fs,
+                    std::shared_ptr<BlockCache> cache);
+
+  std::shared_ptr<FileSystem> base_fs_;
+  std::shared_ptr<BlockCache> cache_;
+};
+
+}  // namespace fs
+}  // namespace arrow
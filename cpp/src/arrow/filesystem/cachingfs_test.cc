@@ -0,0 +1,158 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/cachingfs.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/filesystem/test_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+namespace fs {
+
+using ::arrow::internal::TemporaryDir;
+
+class TestCachingFileSystem : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(temp_dir_, TemporaryDir::Make("test-cachingfs-"));
+    base_fs_ =
+        std::make_shared<internal::MockFileSystem>(TimePoint(TimePoint::duration(42)));
+    options_.cache_dir = temp_dir_->path().ToString() + "cache";
+    options_.block_size = 4;
+    MakeFileSystem();
+  }
+
+  void MakeFileSystem() {
+    ASSERT_OK_AND_ASSIGN(fs_, CachingFileSystem::Make(base_fs_, options_));
+  }
+
+  void AssertReadAt(io::RandomAccessFile* file, int64_t position, int64_t nbytes,
+                    const std::string& expected) {
+    ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(position, nbytes));
+    AssertBufferEqual(*buf, expected);
+  }
+
+  // The total size of the cached blocks
+  int64_t CachedSize() {
+    LocalFileSystem local_fs;
+    FileSelector select;
+    select.base_dir = options_.cache_dir;
+    select.recursive = true;
+    EXPECT_OK_AND_ASSIGN(auto infos, local_fs.GetFileInfo(select));
+    int64_t size = 0;
+    for (const auto& info : infos) {
+      if (info.IsFile() && info.base_name() != "key") {
+        size += info.size();
+      }
+    }
+    return size;
+  }
+
+ protected:
+  std::unique_ptr<TemporaryDir> temp_dir_;
+  std::shared_ptr<internal::MockFileSystem> base_fs_;
+  CachingFileSystemOptions options_;
+  std::shared_ptr<CachingFileSystem> fs_;
+};
+
+TEST_F(TestCachingFileSystem, ReadThrough) {
+  ASSERT_OK(base_fs_->CreateFile("AB/somefile", "some data"));
+
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("AB/somefile"));
+  ASSERT_OK_AND_EQ(9, file->GetSize());
+  AssertReadAt(file.get(), 2, 5, "me da");
+  AssertReadAt(file.get(), 0, 20, "some data");
+  AssertReadAt(file.get(), 9, 1, "");
+  ASSERT_OK_AND_ASSIGN(auto buf, file->Read(6));
+  AssertBufferEqual(*buf, "some d");
+  ASSERT_OK_AND_ASSIGN(buf, file->Read(6));
+  AssertBufferEqual(*buf, "ata");
+  ASSERT_OK(file->Close());
+  ASSERT_EQ(CachedSize(), 9);
+
+  ASSERT_OK_AND_ASSIGN(auto stream, fs_->OpenInputStream("AB/somefile"));
+  ASSERT_OK_AND_ASSIGN(buf, stream->Read(20));
+  AssertBufferEqual(*buf, "some data");
+
+  ASSERT_RAISES(IOError, fs_->OpenInputFile("AB/otherfile"));
+}
+
+TEST_F(TestCachingFileSystem, ServedFromCache) {
+  ASSERT_OK(base_fs_->CreateFile("AB/somefile", "some data"));
+  ASSERT_OK_AND_ASSIGN(auto info, fs_->GetFileInfo("AB/somefile"));
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile(info));
+  AssertReadAt(file.get(), 0, 6, "some d");
+
+  // Cached blocks don't need the base file anymore, a new filesystem
+  // instance shares the cache directory
+  ASSERT_OK(base_fs_->DeleteFile("AB/somefile"));
+  MakeFileSystem();
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile(info));
+  AssertReadAt(file.get(), 1, 7, "ome dat");
+  // Missing block
+  ASSERT_RAISES(IOError, file->ReadAt(8, 1));
+}
+
+TEST_F(TestCachingFileSystem, ModifiedFile) {
+  ASSERT_OK(base_fs_->CreateFile("AB/somefile", "some data"));
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("AB/somefile"));
+  AssertReadAt(file.get(), 0, 20, "some data");
+
+  ASSERT_OK(base_fs_->CreateFile("AB/somefile", "other data"));
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("AB/somefile"));
+  AssertReadAt(file.get(), 0, 20, "other data");
+}
+
+TEST_F(TestCachingFileSystem, Eviction) {
+  options_.max_cache_size = 20;
+  MakeFileSystem();
+  ASSERT_OK(base_fs_->CreateFile("AB/somefile", std::string(100, 'x')));
+
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("AB/somefile"));
+  for (int64_t position = 0; position < 100; position += 10) {
+    AssertReadAt(file.get(), position, 10, std::string(10, 'x'));
+    ASSERT_LE(CachedSize(), options_.max_cache_size);
+  }
+}
+
+TEST_F(TestCachingFileSystem, Delegates) {
+  ASSERT_OK(fs_->CreateDir("AB/CD"));
+  ASSERT_OK_AND_ASSIGN(auto stream, fs_->OpenOutputStream("AB/CD/somefile"));
+  ASSERT_OK(stream->Write("data"));
+  ASSERT_OK(stream->Close());
+  ASSERT_OK(fs_->CopyFile("AB/CD/somefile", "AB/otherfile"));
+  ASSERT_OK(fs_->DeleteDir("AB/CD"));
+
+  AssertFileInfo(fs_.get(), "AB/otherfile", FileType::File, 4);
+  AssertFileInfo(fs_.get(), "AB/CD", FileType::NotFound);
+  ASSERT_EQ(fs_->type_name(), "caching");
+  ASSERT_TRUE(fs_->Equals(*fs_));
+  ASSERT_FALSE(fs_->Equals(*base_fs_));
+}
+
+}  // namespace fs
+}  // namespace arrow
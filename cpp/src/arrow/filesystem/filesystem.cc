@@ -129,6 +129,15 @@ Result<std::vector<FileInfo>> FileSystem::GetFileInfo(
   return res;
 }
 
+Result<FileInfoIterator> FileSystem::GetFileInfoIterator(const FileSelector& select) {
+  ARROW_ASSIGN_OR_RAISE(auto infos, GetFileInfo(select));
+  std::vector<std::vector<FileInfo>> batches;
+  if (!infos.empty()) {
+    batches.push_back(std::move(infos));
+  }
+  return MakeVectorIterator(std::move(batches));
+}
+
 Status FileSystem::DeleteFiles(const std::vector<std::string>& paths) {
   Status st = Status::OK();
   for (const auto& path : paths) {
@@ -240,6 +249,21 @@ Result<std::vector<FileInfo>> SubTreeFileSystem::GetFileInfo(const FileSelector&
   return infos;
 }
 
+Result<FileInfoIterator> SubTreeFileSystem::GetFileInfoIterator(
+    const FileSelector& select) {
+  auto selector = select;
+  selector.base_dir = PrependBase(selector.base_dir);
+  ARROW_ASSIGN_OR_RAISE(auto batches, base_fs_->GetFileInfoIterator(selector));
+  return MakeMaybeMapIterator(
+      [this](std::vector<FileInfo> infos) -> Result<std::vector<FileInfo>> {
+        for (auto& info : infos) {
+          RETURN_NOT_OK(FixInfo(&info));
+        }
+        return infos;
+      },
+      std::move(batches));
+}
+
 Status SubTreeFileSystem::CreateDir(const std::string& path, bool recursive) {
   auto s = path;
   RETURN_NOT_OK(PrependBaseNonEmpty(&s));
@@ -29,6 +29,7 @@
 #include "arrow/io/type_fwd.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/compare.h"
+#include "arrow/util/iterator.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 #include "arrow/util/windows_fixup.h"
@@ -134,6 +135,20 @@ struct ARROW_EXPORT FileSelector {
   FileSelector() {}
 };
 
+/// \brief A sequence of FileInfo batches
+///
+/// Batches are never empty: an empty batch marks the end of the sequence.
+using FileInfoIterator = Iterator<std::vector<FileInfo>>;
+
+}  // namespace fs
+
+template <>
+struct IterationTraits<std::vector<fs::FileInfo>> {
+  static std::vector<fs::FileInfo> End() { return {}; }
+};
+
+namespace fs {
+
 /// \brief Abstract file system API
 class ARROW_EXPORT FileSystem : public std::enable_shared_from_this<FileSystem> {
  public:
@@ -169,6 +184,12 @@ class ARROW_EXPORT FileSystem : public std::enable_shared_from_this<FileSystem>
   /// it exists.
   /// If it doesn't exist, see `FileSelector::allow_not_found`.
   virtual Result<std::vector<FileInfo>> GetFileInfo(const FileSelector& select) = 0;
+  /// Same, yielding the results in batches as they are discovered.
+  ///
+  /// This allows processing entries before the whole selection is listed.
+  /// Entries are yielded in no particular order.  The default implementation
+  /// yields the result of GetFileInfo(select) as a single batch.
+  virtual Result<FileInfoIterator> GetFileInfoIterator(const FileSelector& select);
 
   /// Create a directory and subdirectories.
   ///
@@ -275,6 +296,7 @@ class ARROW_EXPORT SubTreeFileSystem : public FileSystem {
   /// \endcond
   Result<FileInfo> GetFileInfo(const std::string& path) override;
   Result<std::vector<FileInfo>> GetFileInfo(const FileSelector& select) override;
+  Result<FileInfoIterator> GetFileInfoIterator(const FileSelector& select) override;
 
   Status CreateDir(const std::string& path, bool recursive = true) override;
 
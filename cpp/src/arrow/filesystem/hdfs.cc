@@ -283,6 +283,16 @@ void HdfsOptions::ConfigureExtraConf(std::string key, std::string val) {
   connection_config.extra_conf.emplace(std::move(key), std::move(val));
 }
 
+void HdfsOptions::ConfigureShortCircuitReads(std::string domain_socket_path) {
+  connection_config.short_circuit_reads = true;
+  connection_config.domain_socket_path = std::move(domain_socket_path);
+}
+
+void HdfsOptions::ConfigureZeroCopyReads(bool skip_checksums) {
+  connection_config.zero_copy_reads = true;
+  connection_config.zero_copy_skip_checksums = skip_checksums;
+}
+
 bool HdfsOptions::Equals(const HdfsOptions& other) const {
   return (buffer_size == other.buffer_size && replication == other.replication &&
           default_block_size == other.default_block_size &&
@@ -290,9 +300,30 @@ bool HdfsOptions::Equals(const HdfsOptions& other) const {
           connection_config.port == other.connection_config.port &&
           connection_config.user == other.connection_config.user &&
           connection_config.kerb_ticket == other.connection_config.kerb_ticket &&
+          connection_config.short_circuit_reads ==
+              other.connection_config.short_circuit_reads &&
+          connection_config.domain_socket_path ==
+              other.connection_config.domain_socket_path &&
+          connection_config.zero_copy_reads == other.connection_config.zero_copy_reads &&
+          connection_config.zero_copy_skip_checksums ==
+              other.connection_config.zero_copy_skip_checksums &&
           connection_config.extra_conf == other.connection_config.extra_conf);
 }
 
+namespace {
+
+Result<bool> ParseBoolOption(const std::string& name, const std::string& v) {
+  if (v == "true" || v == "1") {
+    return true;
+  }
+  if (v == "false" || v == "0") {
+    return false;
+  }
+  return Status::Invalid("Invalid value for option '", name, "': '", v, "'");
+}
+
+}  // namespace
+
 Result<HdfsOptions> HdfsOptions::FromUri(const Uri& uri) {
   HdfsOptions options;
 
@@ -366,6 +397,39 @@ Result<HdfsOptions> HdfsOptions::FromUri(const Uri& uri) {
     options_map.erase(it);
   }
 
+  // configure short-circuit local reads
+  it = options_map.find("short_circuit_reads");
+  if (it != options_map.end()) {
+    ARROW_ASSIGN_OR_RAISE(bool short_circuit_reads,
+                          ParseBoolOption(it->first, it->second));
+    options_map.erase(it);
+    std::string domain_socket_path;
+    it = options_map.find("domain_socket_path");
+    if (it != options_map.end()) {
+      domain_socket_path = it->second;
+      options_map.erase(it);
+    }
+    if (short_circuit_reads) {
+      options.ConfigureShortCircuitReads(std::move(domain_socket_path));
+    }
+  }
+
+  // configure zero-copy reads
+  it = options_map.find("zero_copy_reads");
+  if (it != options_map.end()) {
+    ARROW_ASSIGN_OR_RAISE(bool zero_copy_reads, ParseBoolOption(it->first, it->second));
+    options_map.erase(it);
+    bool skip_checksums = false;
+    it = options_map.find("zero_copy_skip_checksums");
+    if (it != options_map.end()) {
+      ARROW_ASSIGN_OR_RAISE(skip_checksums, ParseBoolOption(it->first, it->second));
+      options_map.erase(it);
+    }
+    if (zero_copy_reads) {
+      options.ConfigureZeroCopyReads(skip_checksums);
+    }
+  }
+
   // configure other options
   for (const auto& it : options_map) {
     options.ConfigureExtraConf(it.first, it.second);
@@ -48,6 +48,12 @@ struct ARROW_EXPORT HdfsOptions {
   void ConfigureBlockSize(int64_t default_block_size);
   void ConfigureKerberosTicketCachePath(std::string path);
   void ConfigureExtraConf(std::string key, std::string val);
+  /// Read local blocks directly from the DataNode's disks, given the path of the
+  /// UNIX domain socket shared with the DataNode (may be empty if configured
+  /// in hdfs-site.xml)
+  void ConfigureShortCircuitReads(std::string domain_socket_path);
+  /// Memory-map local blocks in ReadAt() rather than copying them
+  void ConfigureZeroCopyReads(bool skip_checksums);
 
   bool Equals(const HdfsOptions& other) const;
 
@@ -33,6 +33,7 @@
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/util_internal.h"
 #include "arrow/io/file.h"
+#include "arrow/io/uring_internal.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/uri.h"
@@ -236,7 +237,11 @@ LocalFileSystemOptions LocalFileSystemOptions::Defaults() {
 }
 
 bool LocalFileSystemOptions::Equals(const LocalFileSystemOptions& other) const {
-  return use_mmap == other.use_mmap;
+  return use_mmap == other.use_mmap && use_io_uring == other.use_io_uring &&
+         io_uring_queue_depth == other.io_uring_queue_depth &&
+         io_uring_num_registered_buffers == other.io_uring_num_registered_buffers &&
+         io_uring_registered_buffer_size == other.io_uring_registered_buffer_size &&
+         use_direct_io == other.use_direct_io;
 }
 
 Result<LocalFileSystemOptions> LocalFileSystemOptions::FromUri(
@@ -267,7 +272,21 @@ Result<LocalFileSystemOptions> LocalFileSystemOptions::FromUri(
 LocalFileSystem::LocalFileSystem() : options_(LocalFileSystemOptions::Defaults()) {}
 
 LocalFileSystem::LocalFileSystem(const LocalFileSystemOptions& options)
-    : options_(options) {}
+    : options_(options) {
+  if (options_.use_io_uring && !options_.use_mmap && io::internal::Uring::IsSupported()) {
+    io::internal::UringOptions uring_options;
+    uring_options.queue_depth = options_.io_uring_queue_depth;
+    uring_options.num_registered_buffers = options_.io_uring_num_registered_buffers;
+    uring_options.registered_buffer_size = options_.io_uring_registered_buffer_size;
+    auto maybe_uring = io::internal::Uring::Make(uring_options);
+    if (maybe_uring.ok()) {
+      uring_ = *std::move(maybe_uring);
+    } else {
+      ARROW_LOG(WARNING) << "Failed to set up io_uring, falling back to regular reads: "
+                         << maybe_uring.status().ToString();
+    }
+  }
+}
 
 LocalFileSystem::~LocalFileSystem() {}
 
@@ -388,11 +407,14 @@ namespace {
 
 template <typename InputStreamType>
 Result<std::shared_ptr<InputStreamType>> OpenInputStreamGeneric(
-    const std::string& path, const LocalFileSystemOptions& options) {
+    const std::string& path, const LocalFileSystemOptions& options, bool sequential) {
   if (options.use_mmap) {
     return io::MemoryMappedFile::Open(path, io::FileMode::READ);
   } else {
-    return io::ReadableFile::Open(path);
+    io::ReadableFileOptions file_options;
+    file_options.direct_io = options.use_direct_io;
+    file_options.sequential = sequential;
+    return io::ReadableFile::Open(path, file_options);
   }
 }
 
@@ -400,12 +422,16 @@ Result<std::shared_ptr<InputStreamType>> OpenInputStreamGeneric(
 
 Result<std::shared_ptr<io::InputStream>> LocalFileSystem::OpenInputStream(
     const std::string& path) {
-  return OpenInputStreamGeneric<io::InputStream>(path, options_);
+  return OpenInputStreamGeneric<io::InputStream>(path, options_, /*sequential=*/true);
 }
 
 Result<std::shared_ptr<io::RandomAccessFile>> LocalFileSystem::OpenInputFile(
     const std::string& path) {
-  return OpenInputStreamGeneric<io::RandomAccessFile>(path, options_);
+  if (uring_ != nullptr) {
+    return io::internal::UringReadableFile::Open(path, uring_);
+  }
+  return OpenInputStreamGeneric<io::RandomAccessFile>(path, options_,
+                                                      /*sequential=*/false);
 }
 
 namespace {
@@ -30,6 +30,14 @@ class Uri;
 
 }
 
+namespace io {
+namespace internal {
+
+class Uring;
+
+}
+}  // namespace io
+
 namespace fs {
 
 /// Options for the LocalFileSystem implementation.
@@ -38,6 +46,30 @@ struct ARROW_EXPORT LocalFileSystemOptions {
   /// or a regular one.
   bool use_mmap = false;
 
+  /// Whether OpenInputFile returns a file reading through io_uring, so that
+  /// ReadAsync() doesn't block a thread during the read.
+  ///
+  /// Only available on Linux.  Files are opened regularly if io_uring is not
+  /// supported at build time or by the running kernel.  use_mmap has priority.
+  bool use_io_uring = false;
+  /// Maximum number of io_uring reads in flight, for all files of a filesystem
+  int32_t io_uring_queue_depth = 128;
+  /// Number of buffers registered with io_uring, and their size
+  ///
+  /// Reads up to that size returning a Buffer are done into a registered
+  /// buffer while one is available, which is cheaper for the kernel.
+  int32_t io_uring_num_registered_buffers = 0;
+  int64_t io_uring_registered_buffer_size = 1 << 20;
+
+  /// Whether OpenInputStream and OpenInputFile return files reading around the
+  /// page cache, so that scanning large datasets doesn't evict it.
+  ///
+  /// Direct I/O is used where the platform and filesystem support it, and the
+  /// pages read are evicted after each read otherwise (see
+  /// io::ReadableFileOptions::direct_io).  use_mmap and use_io_uring have
+  /// priority.
+  bool use_direct_io = false;
+
   /// \brief Initialize with defaults
   static LocalFileSystemOptions Defaults();
 
@@ -96,6 +128,8 @@ class ARROW_EXPORT LocalFileSystem : public FileSystem {
 
  protected:
   LocalFileSystemOptions options_;
+  // Shared by the files opened through io_uring, if enabled
+  std::shared_ptr<io::internal::Uring> uring_;
 };
 
 namespace internal {
@@ -19,11 +19,18 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <cmath>
 #include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <iterator>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #ifdef _WIN32
 // Undefine preprocessor macros that interfere with AWS function / method names
@@ -71,8 +78,11 @@
 #include "arrow/io/util_internal.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/util/tracing.h"
 #include "arrow/util/windows_fixup.h"
 
 namespace arrow {
@@ -297,11 +307,42 @@ Result<S3Options> S3Options::FromUri(const std::string& uri_string,
 bool S3Options::Equals(const S3Options& other) const {
   return (region == other.region && endpoint_override == other.endpoint_override &&
           scheme == other.scheme && background_writes == other.background_writes &&
+          write_part_size == other.write_part_size &&
+          max_concurrent_uploads == other.max_concurrent_uploads &&
+          upload_memory_budget == other.upload_memory_budget &&
+          read_part_size == other.read_part_size &&
+          read_parallelism == other.read_parallelism &&
+          hedged_reads == other.hedged_reads &&
+          hedged_read_quantile == other.hedged_read_quantile &&
+          hedged_read_max_duplicates == other.hedged_read_max_duplicates &&
+          hedged_read_budget == other.hedged_read_budget &&
+          list_parallelism == other.list_parallelism &&
           GetAccessKey() == other.GetAccessKey() &&
           GetSecretKey() == other.GetSecretKey() &&
           GetSessionToken() == other.GetSessionToken());
 }
 
+int64_t S3ReadLatencyHistogram::Quantile(double q) const {
+  int64_t total = 0;
+  for (const auto count : counts) {
+    total += count;
+  }
+  if (total == 0) {
+    return -1;
+  }
+  // The number of samples at or below the quantile
+  const auto rank = std::max<int64_t>(
+      1, static_cast<int64_t>(std::ceil(std::min(std::max(q, 0.0), 1.0) * total)));
+  int64_t cumulative = 0;
+  for (size_t i = 0; i < counts.size(); ++i) {
+    cumulative += counts[i];
+    if (cumulative >= rank) {
+      return bucket_upper_bounds_us[i];
+    }
+  }
+  return bucket_upper_bounds_us.back();
+}
+
 namespace {
 
 Status CheckS3Initialized() {
@@ -435,14 +476,230 @@ Result<S3Model::GetObjectResult> GetObjectRange(Aws::S3::S3Client* client,
   return OutcomeToResult(client->GetObject(req));
 }
 
+// Latencies of the ranged GET requests of a S3FileSystem, in buckets growing
+// by a factor of sqrt(2).  Bucket i holds latencies in [2^(i/2), 2^((i+1)/2))
+// microseconds.
+class ReadLatencyTracker {
+ public:
+  static constexpr int kNumBuckets = 64;
+  // Don't hedge before this many latencies are known
+  static constexpr int64_t kMinSamples = 20;
+
+  void RecordLatency(int64_t latency_us) {
+    int bucket = 0;
+    if (latency_us > 1) {
+      bucket = std::min(kNumBuckets - 1,
+                        static_cast<int>(2 * std::log2(static_cast<double>(latency_us))));
+    }
+    buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+    num_samples_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void RecordRead() { num_reads_.fetch_add(1, std::memory_order_relaxed); }
+
+  void RecordDuplicateWin() {
+    num_duplicate_wins_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // Reserve a duplicate request, unless over the budget
+  bool AcquireDuplicate(double budget) {
+    int64_t num_duplicates = num_duplicates_.load();
+    while (num_duplicates + 1 <= budget * num_reads_.load()) {
+      if (num_duplicates_.compare_exchange_weak(num_duplicates, num_duplicates + 1)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // The delay after which a request should be hedged, or -1 if unknown yet
+  int64_t HedgeDelayMicros(double quantile) const {
+    if (num_samples_.load(std::memory_order_relaxed) < kMinSamples) {
+      return -1;
+    }
+    return Snapshot().Quantile(quantile);
+  }
+
+  S3ReadLatencyHistogram Snapshot() const {
+    S3ReadLatencyHistogram histogram;
+    histogram.bucket_upper_bounds_us.resize(kNumBuckets);
+    histogram.counts.resize(kNumBuckets);
+    for (int i = 0; i < kNumBuckets; ++i) {
+      histogram.bucket_upper_bounds_us[i] =
+          static_cast<int64_t>(std::ceil(std::exp2((i + 1) / 2.0)));
+      histogram.counts[i] = buckets_[i].load(std::memory_order_relaxed);
+    }
+    histogram.num_reads = num_reads_.load();
+    histogram.num_duplicates = num_duplicates_.load();
+    histogram.num_duplicate_wins = num_duplicate_wins_.load();
+    return histogram;
+  }
+
+ private:
+  std::atomic<int64_t> buckets_[kNumBuckets] = {};
+  std::atomic<int64_t> num_samples_{0};
+  std::atomic<int64_t> num_reads_{0};
+  std::atomic<int64_t> num_duplicates_{0};
+  std::atomic<int64_t> num_duplicate_wins_{0};
+};
+
+// Issues the ranged GET requests of an ObjectInputFile, hedging them if enabled
+class RangeReader {
+ public:
+  RangeReader(Aws::S3::S3Client* client, S3Path path, const S3Options& options,
+              std::shared_ptr<ReadLatencyTracker> latency_tracker)
+      : client_(client),
+        path_(std::move(path)),
+        hedged_reads_(options.hedged_reads),
+        hedged_read_quantile_(options.hedged_read_quantile),
+        hedged_read_max_duplicates_(options.hedged_read_max_duplicates),
+        hedged_read_budget_(options.hedged_read_budget),
+        latency_tracker_(std::move(latency_tracker)) {}
+
+  Result<int64_t> Read(int64_t position, int64_t nbytes, void* out) const {
+    latency_tracker_->RecordRead();
+    if (hedged_reads_ && hedged_read_max_duplicates_ > 0) {
+      const int64_t delay_us = latency_tracker_->HedgeDelayMicros(hedged_read_quantile_);
+      if (delay_us >= 0) {
+        return HedgedRead(position, nbytes, out, delay_us);
+      }
+    }
+    return TimedRead(position, nbytes, out);
+  }
+
+ protected:
+  Result<int64_t> TimedRead(int64_t position, int64_t nbytes, void* out) const {
+    util::TraceSpan span("io", "S3ReadRange");
+    span.AddBytes(nbytes);
+    const auto start = std::chrono::steady_clock::now();
+    // Read the desired range of bytes
+    ARROW_ASSIGN_OR_RAISE(S3Model::GetObjectResult result,
+                          GetObjectRange(client_, path_, position, nbytes, out));
+    latency_tracker_->RecordLatency(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start)
+            .count());
+
+    auto& stream = result.GetBody();
+    stream.ignore(nbytes);
+    // NOTE: the stream is a stringstream by default, there is no actual error
+    // to check for.  However, stream.fail() may return true if EOF is reached.
+    return stream.gcount();
+  }
+
+  struct HedgedReadState {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<bool> started;
+    int num_finished = 0;
+    bool done = false;
+    int64_t bytes_read = 0;
+    Status status;
+  };
+
+  // Issue duplicate requests for a range while it isn't read after `delay_us`
+  // (or if a request failed), the first response being copied to `out`.
+  //
+  // Requests run on the I/O thread pool, each into its own buffer since the
+  // losing ones can't be cancelled.  As in ReadAtParallel, the caller runs a
+  // request itself if the pool didn't start it, so as not to deadlock.
+  Result<int64_t> HedgedRead(int64_t position, int64_t nbytes, void* out,
+                             int64_t delay_us) const {
+    const int num_requests = 1 + hedged_read_max_duplicates_;
+    auto state = std::make_shared<HedgedReadState>();
+    state->started.resize(num_requests, false);
+
+    const RangeReader reader = *this;
+    auto out_data = reinterpret_cast<uint8_t*>(out);
+    auto run_request = [=](int request) {
+      {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (state->done || state->started[request]) {
+          return;
+        }
+        state->started[request] = true;
+      }
+      std::shared_ptr<Buffer> buffer;
+      Result<int64_t> result = AllocateBuffer(nbytes).Value(&buffer);
+      if (result.ok()) {
+        result = reader.TimedRead(position, nbytes, buffer->mutable_data());
+      }
+      std::lock_guard<std::mutex> lock(state->mutex);
+      ++state->num_finished;
+      if (!result.ok()) {
+        state->status &= result.status();
+      } else if (!state->done) {
+        // The caller is still waiting, `out` is valid
+        std::memcpy(out_data, buffer->data(), static_cast<size_t>(*result));
+        state->done = true;
+        state->bytes_read = *result;
+        if (request > 0) {
+          reader.latency_tracker_->RecordDuplicateWin();
+        }
+      }
+      state->cv.notify_all();
+    };
+
+    auto pool = io::internal::GetIOThreadPool();
+    RETURN_NOT_OK(pool->Spawn([=]() { run_request(0); }));
+    int num_spawned = 1;
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    auto all_finished = [&]() {
+      return state->done || state->num_finished == num_spawned;
+    };
+    while (!state->done) {
+      state->cv.wait_for(lock, std::chrono::microseconds(delay_us), all_finished);
+      if (state->done) {
+        break;
+      }
+      const auto not_started = std::find(state->started.begin(),
+                                         state->started.begin() + num_spawned, false);
+      if (not_started != state->started.begin() + num_spawned) {
+        // The pool is busy, adding requests wouldn't help
+        lock.unlock();
+        run_request(static_cast<int>(not_started - state->started.begin()));
+        lock.lock();
+        continue;
+      }
+      if (num_spawned == num_requests ||
+          !latency_tracker_->AcquireDuplicate(hedged_read_budget_)) {
+        state->cv.wait(lock, all_finished);
+        break;
+      }
+      const int request = num_spawned++;
+      lock.unlock();
+      RETURN_NOT_OK(pool->Spawn([=]() { run_request(request); }));
+      lock.lock();
+    }
+    if (!state->done) {
+      return state->status;
+    }
+    return state->bytes_read;
+  }
+
+  Aws::S3::S3Client* client_;
+  S3Path path_;
+  bool hedged_reads_;
+  double hedged_read_quantile_;
+  int32_t hedged_read_max_duplicates_;
+  double hedged_read_budget_;
+  std::shared_ptr<ReadLatencyTracker> latency_tracker_;
+};
+
 // A RandomAccessFile that reads from a S3 object
 class ObjectInputFile : public io::RandomAccessFile {
  public:
-  ObjectInputFile(Aws::S3::S3Client* client, const S3Path& path)
-      : client_(client), path_(path) {}
-
-  ObjectInputFile(Aws::S3::S3Client* client, const S3Path& path, int64_t size)
-      : client_(client), path_(path), content_length_(size) {}
+  ObjectInputFile(Aws::S3::S3Client* client, const S3Path& path,
+                  const S3Options& options,
+                  std::shared_ptr<ReadLatencyTracker> latency_tracker,
+                  int64_t size = kNoSize)
+      : client_(client),
+        path_(path),
+        range_reader_(client, path, options, std::move(latency_tracker)),
+        read_part_size_(options.read_part_size),
+        read_parallelism_(options.read_parallelism),
+        content_length_(size) {}
 
   Status Init() {
     // Issue a HEAD Object to get the content-length and ensure any
@@ -524,16 +781,10 @@ class ObjectInputFile : public io::RandomAccessFile {
     if (nbytes == 0) {
       return 0;
     }
-
-    // Read the desired range of bytes
-    ARROW_ASSIGN_OR_RAISE(S3Model::GetObjectResult result,
-                          GetObjectRange(client_, path_, position, nbytes, out));
-
-    auto& stream = result.GetBody();
-    stream.ignore(nbytes);
-    // NOTE: the stream is a stringstream by default, there is no actual error
-    // to check for.  However, stream.fail() may return true if EOF is reached.
-    return stream.gcount();
+    if (read_parallelism_ > 1 && read_part_size_ > 0 && nbytes > read_part_size_) {
+      return ReadAtParallel(position, nbytes, out);
+    }
+    return range_reader_.Read(position, nbytes, out);
   }
 
   Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
@@ -566,8 +817,79 @@ class ObjectInputFile : public io::RandomAccessFile {
   }
 
  protected:
+  // State shared between the tasks reading the parts of a large range
+  struct ParallelReadState {
+    std::mutex mutex;
+    std::condition_variable cv;
+    int64_t next_part = 0;
+    int64_t parts_in_progress = 0;
+    Status status;
+    std::vector<int64_t> bytes_read;
+  };
+
+  // Read a large range as several concurrent ranged GET requests.
+  //
+  // Parts are claimed from a shared counter, both by I/O pool tasks and by
+  // the calling thread.  The caller therefore never waits for a task which
+  // has not started yet, which avoids deadlocking when called from an I/O
+  // pool thread; tasks starting after all parts are claimed do nothing.
+  Result<int64_t> ReadAtParallel(int64_t position, int64_t nbytes, void* out) {
+    const int64_t num_parts = BitUtil::CeilDiv(nbytes, read_part_size_);
+    auto state = std::make_shared<ParallelReadState>();
+    state->bytes_read.resize(num_parts, 0);
+
+    const RangeReader range_reader = range_reader_;
+    const int64_t part_size = read_part_size_;
+    auto out_data = reinterpret_cast<uint8_t*>(out);
+    auto read_parts = [=]() {
+      std::unique_lock<std::mutex> lock(state->mutex);
+      while (state->next_part < num_parts) {
+        const int64_t part = state->next_part++;
+        ++state->parts_in_progress;
+        lock.unlock();
+        const int64_t part_start = part * part_size;
+        const int64_t part_length = std::min(part_size, nbytes - part_start);
+        auto result =
+            range_reader.Read(position + part_start, part_length, out_data + part_start);
+        lock.lock();
+        --state->parts_in_progress;
+        if (result.ok()) {
+          state->bytes_read[part] = *result;
+        } else {
+          state->status &= result.status();
+          // Don't issue any more requests
+          state->next_part = num_parts;
+        }
+      }
+      state->cv.notify_all();
+    };
+
+    const int64_t num_tasks = std::min<int64_t>(read_parallelism_, num_parts) - 1;
+    auto pool = io::internal::GetIOThreadPool();
+    for (int64_t i = 0; i < num_tasks; ++i) {
+      RETURN_NOT_OK(pool->Spawn(read_parts));
+    }
+    read_parts();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->cv.wait(lock, [&]() { return state->parts_in_progress == 0; });
+    RETURN_NOT_OK(state->status);
+    // Only report the bytes up to the first short read
+    int64_t total_bytes_read = 0;
+    for (int64_t part = 0; part < num_parts; ++part) {
+      total_bytes_read += state->bytes_read[part];
+      if (state->bytes_read[part] < std::min(part_size, nbytes - part * part_size)) {
+        break;
+      }
+    }
+    return total_bytes_read;
+  }
+
   Aws::S3::S3Client* client_;
   S3Path path_;
+  const RangeReader range_reader_;
+  const int64_t read_part_size_;
+  const int32_t read_parallelism_;
   bool closed_ = false;
   int64_t pos_ = 0;
   int64_t content_length_ = kNoSize;
@@ -610,6 +932,8 @@ class ObjectOutputStream : public io::OutputStream {
     }
     upload_id_ = outcome.GetResult().GetUploadId();
     upload_state_ = std::make_shared<UploadState>();
+    part_size_increment_ = std::max(options_.write_part_size, kMinimumPartUpload);
+    part_upload_threshold_ = part_size_increment_;
     closed_ = false;
     return Status::OK();
   }
@@ -772,6 +1096,7 @@ class ObjectOutputStream : public io::OutputStream {
       }
     } else {
       std::unique_lock<std::mutex> lock(upload_state_->mutex);
+      upload_state_->cv.wait(lock, [&]() { return !UploadLimitReached(nbytes); });
       auto state = upload_state_;  // Keep upload state alive in closure
       auto part_number = part_number_;
 
@@ -798,18 +1123,20 @@ class ObjectOutputStream : public io::OutputStream {
           AddCompletedPart(state, part_number, outcome.GetResult());
         }
         // Notify completion, regardless of success / error status
-        if (--state->parts_in_progress == 0) {
-          state->cv.notify_all();
-        }
+        --state->parts_in_progress;
+        state->bytes_in_progress -= owned_buffer->size();
+        state->cv.notify_all();
       };
       ++upload_state_->parts_in_progress;
+      upload_state_->bytes_in_progress += nbytes;
       client_->UploadPartAsync(req, handler);
     }
 
     ++part_number_;
     // With up to 10000 parts in an upload (S3 limit), a stream writing chunks
     // of exactly 5MB would be limited to 50GB total.  To avoid that, we bump
-    // the upload threshold every 100 parts.  So the pattern is:
+    // the upload threshold every 100 parts.  So the pattern is, with the
+    // default part size:
     // - part 1 to 99: 5MB threshold
     // - part 100 to 199: 10MB threshold
     // - part 200 to 299: 15MB threshold
@@ -817,14 +1144,29 @@ class ObjectOutputStream : public io::OutputStream {
     // - part 9900 to 9999: 500MB threshold
     // So the total size limit is 2475000MB or ~2.4TB, while keeping manageable
     // chunk sizes and avoiding too much buffering in the common case of a small-ish
-    // stream.  If the limit's not enough, we can revisit.
+    // stream.  If the limit's not enough, a larger part size can be configured.
     if (part_number_ % 100 == 0) {
-      part_upload_threshold_ += kMinimumPartUpload;
+      part_upload_threshold_ += part_size_increment_;
     }
 
     return Status::OK();
   }
 
+  // Whether a background upload of `nbytes` must wait for other uploads to finish.
+  // Should be called with the upload state mutex held.
+  bool UploadLimitReached(int64_t nbytes) const {
+    if (upload_state_->parts_in_progress == 0) {
+      // Always allow some progress
+      return false;
+    }
+    if (options_.max_concurrent_uploads > 0 &&
+        upload_state_->parts_in_progress >= options_.max_concurrent_uploads) {
+      return true;
+    }
+    return options_.upload_memory_budget > 0 &&
+           upload_state_->bytes_in_progress + nbytes > options_.upload_memory_budget;
+  }
+
   static void AddCompletedPart(const std::shared_ptr<UploadState>& state, int part_number,
                                const S3Model::UploadPartResult& result) {
     S3Model::CompletedPart part;
@@ -859,6 +1201,7 @@ class ObjectOutputStream : public io::OutputStream {
   std::shared_ptr<io::BufferOutputStream> current_part_;
   int64_t current_part_size_ = 0;
   int64_t part_upload_threshold_ = kMinimumPartUpload;
+  int64_t part_size_increment_ = kMinimumPartUpload;
 
   // This struct is kept alive through background writes to avoid problems
   // in the completion handler.
@@ -867,6 +1210,7 @@ class ObjectOutputStream : public io::OutputStream {
     std::condition_variable cv;
     Aws::Vector<S3Model::CompletedPart> completed_parts;
     int64_t parts_in_progress = 0;
+    int64_t bytes_in_progress = 0;
     Status status;
 
     UploadState() : status(Status::OK()) {}
@@ -895,6 +1239,8 @@ class S3FileSystem::Impl {
   Aws::Client::ClientConfiguration client_config_;
   std::shared_ptr<Aws::Auth::AWSCredentialsProvider> credentials_provider_;
   std::unique_ptr<Aws::S3::S3Client> client_;
+  std::shared_ptr<ReadLatencyTracker> latency_tracker_ =
+      std::make_shared<ReadLatencyTracker>();
 
   const int32_t kListObjectsMaxKeys = 1000;
   // At most 1000 keys per multiple-delete request
@@ -1066,22 +1412,18 @@ class S3FileSystem::Impl {
     return Status::OK();
   }
 
-  // Recursive workhorse for GetTargetStats(FileSelector...)
-  Status Walk(const FileSelector& select, const std::string& bucket,
-              const std::string& key, std::vector<FileInfo>* out) {
-    int32_t nesting_depth = 0;
-    return Walk(select, bucket, key, nesting_depth, out);
-  }
-
-  Status Walk(const FileSelector& select, const std::string& bucket,
-              const std::string& key, int32_t nesting_depth, std::vector<FileInfo>* out) {
+  // Workhorse for GetFileInfo(FileSelector...): list a single "directory",
+  // appending the keys of the subdirectories to recurse into to `child_keys`
+  Status ListDirectory(const FileSelector& select, const std::string& bucket,
+                       const std::string& key, int32_t nesting_depth,
+                       std::vector<FileInfo>* out, std::vector<std::string>* child_keys) {
     if (nesting_depth >= kMaxNestingDepth) {
       return Status::IOError("S3 filesystem tree exceeds maximum nesting depth (",
                              kMaxNestingDepth, ")");
     }
 
+    const bool recurse = select.recursive && nesting_depth < select.max_recursion;
     bool is_empty = true;
-    std::vector<std::string> child_keys;
 
     auto handle_results = [&](const S3Model::ListObjectsV2Result& result) -> Status {
       // Walk "files"
@@ -1110,8 +1452,8 @@ class S3FileSystem::Impl {
         info.set_path(ss.str());
         info.set_type(FileType::Directory);
         out->push_back(std::move(info));
-        if (select.recursive) {
-          child_keys.emplace_back(child_key);
+        if (recurse) {
+          child_keys->emplace_back(child_key);
         }
       }
       return Status::OK();
@@ -1129,13 +1471,6 @@ class S3FileSystem::Impl {
     RETURN_NOT_OK(
         ListObjectsV2(bucket, key, std::move(handle_results), std::move(handle_error)));
 
-    // Recurse
-    if (select.recursive && nesting_depth < select.max_recursion) {
-      for (const auto& child_key : child_keys) {
-        RETURN_NOT_OK(Walk(select, bucket, child_key, nesting_depth + 1, out));
-      }
-    }
-
     // If no contents were found, perhaps it's an empty "directory",
     // or perhaps it's a nonexistent entry.  Check.
     if (is_empty && !select.allow_not_found) {
@@ -1147,6 +1482,152 @@ class S3FileSystem::Impl {
     return Status::OK();
   }
 
+  // Walks the "directories" of a FileSelector, listing up to
+  // S3Options::list_parallelism of them at once.
+  //
+  // Background tasks on the I/O thread pool list pending directories while
+  // there are any.  The consumer also lists them itself rather than wait, so
+  // that it never depends on a pool task being scheduled.
+  class DirectoryLister : public std::enable_shared_from_this<DirectoryLister> {
+   public:
+    DirectoryLister(std::shared_ptr<FileSystem> fs, Impl* impl, FileSelector select)
+        : fs_(std::move(fs)), impl_(impl), select_(std::move(select)) {}
+
+    void AddResults(std::vector<FileInfo> infos) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (!infos.empty()) {
+        results_.push_back(std::move(infos));
+      }
+    }
+
+    void AddDirectory(std::string bucket, std::string key) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      pending_.push_back({std::move(bucket), std::move(key), 0});
+      SpawnTasks();
+    }
+
+    Result<std::vector<FileInfo>> Next() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (true) {
+        RETURN_NOT_OK(status_);
+        if (!results_.empty()) {
+          auto infos = std::move(results_.front());
+          results_.pop_front();
+          return infos;
+        }
+        if (!pending_.empty()) {
+          ListOne(&lock);
+        } else if (in_flight_ == 0) {
+          return IterationTraits<std::vector<FileInfo>>::End();
+        } else {
+          cv_.wait(lock);
+        }
+      }
+    }
+
+    // Don't start listing any other directories
+    void Cancel() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cancelled_ = true;
+      pending_.clear();
+    }
+
+   private:
+    struct Directory {
+      std::string bucket;
+      std::string key;
+      int32_t nesting_depth;
+    };
+
+    // The mutex must be held when calling this; it is released while listing
+    void ListOne(std::unique_lock<std::mutex>* lock) {
+      Directory dir = std::move(pending_.front());
+      pending_.pop_front();
+      ++in_flight_;
+      lock->unlock();
+
+      std::vector<FileInfo> infos;
+      std::vector<std::string> child_keys;
+      Status st = impl_->ListDirectory(select_, dir.bucket, dir.key, dir.nesting_depth,
+                                       &infos, &child_keys);
+
+      lock->lock();
+      --in_flight_;
+      if (cancelled_) {
+        // Nobody is interested in the results anymore
+      } else if (st.ok()) {
+        if (!infos.empty()) {
+          results_.push_back(std::move(infos));
+        }
+        for (auto& child_key : child_keys) {
+          pending_.push_back({dir.bucket, std::move(child_key), dir.nesting_depth + 1});
+        }
+        SpawnTasks();
+      } else {
+        status_ &= st;
+        pending_.clear();
+      }
+      cv_.notify_all();
+    }
+
+    void RunTask() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (!pending_.empty()) {
+        ListOne(&lock);
+      }
+      --num_tasks_;
+    }
+
+    // The mutex must be held when calling this
+    void SpawnTasks() {
+      // The consumer counts as one lister
+      const int32_t max_tasks = impl_->options_.list_parallelism - 1;
+      auto pool = io::internal::GetIOThreadPool();
+      while (num_tasks_ < max_tasks &&
+             num_tasks_ < static_cast<int32_t>(pending_.size())) {
+        auto self = shared_from_this();
+        if (!pool->Spawn([self]() { self->RunTask(); }).ok()) {
+          break;
+        }
+        ++num_tasks_;
+      }
+    }
+
+    // Keeps `impl_` alive while tasks are running
+    const std::shared_ptr<FileSystem> fs_;
+    Impl* impl_;
+    const FileSelector select_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Directory> pending_;
+    std::deque<std::vector<FileInfo>> results_;
+    // Number of directories being listed
+    int32_t in_flight_ = 0;
+    // Number of tasks spawned on the I/O thread pool
+    int32_t num_tasks_ = 0;
+    Status status_;
+    bool cancelled_ = false;
+  };
+
+  // The iterator cancels pending listings when it is destroyed
+  struct DirectoryListerIterator {
+    explicit DirectoryListerIterator(std::shared_ptr<DirectoryLister> lister)
+        : lister(std::move(lister)) {}
+    DirectoryListerIterator(DirectoryListerIterator&&) = default;
+    DirectoryListerIterator& operator=(DirectoryListerIterator&&) = default;
+
+    ~DirectoryListerIterator() {
+      if (lister) {
+        lister->Cancel();
+      }
+    }
+
+    Result<std::vector<FileInfo>> Next() { return lister->Next(); }
+
+    std::shared_ptr<DirectoryLister> lister;
+  };
+
   Status WalkForDeleteDir(const std::string& bucket, const std::string& key,
                           std::vector<std::string>* file_keys,
                           std::vector<std::string>* dir_keys) {
@@ -1300,6 +1781,10 @@ bool S3FileSystem::Equals(const FileSystem& other) const {
 
 S3Options S3FileSystem::options() const { return impl_->options(); }
 
+S3ReadLatencyHistogram S3FileSystem::GetReadLatencyHistogram() const {
+  return impl_->latency_tracker_->Snapshot();
+}
+
 Result<FileInfo> S3FileSystem::GetFileInfo(const std::string& s) {
   ARROW_ASSIGN_OR_RAISE(auto path, S3Path::FromString(s));
   FileInfo info;
@@ -1366,29 +1851,47 @@ Result<FileInfo> S3FileSystem::GetFileInfo(const std::string& s) {
 }
 
 Result<std::vector<FileInfo>> S3FileSystem::GetFileInfo(const FileSelector& select) {
+  ARROW_ASSIGN_OR_RAISE(auto it, GetFileInfoIterator(select));
+  std::vector<FileInfo> results;
+  while (true) {
+    ARROW_ASSIGN_OR_RAISE(auto infos, it.Next());
+    if (infos.empty()) {
+      break;
+    }
+    results.insert(results.end(), std::make_move_iterator(infos.begin()),
+                   std::make_move_iterator(infos.end()));
+  }
+  return results;
+}
+
+Result<FileInfoIterator> S3FileSystem::GetFileInfoIterator(const FileSelector& select) {
   ARROW_ASSIGN_OR_RAISE(auto base_path, S3Path::FromString(select.base_dir));
 
-  std::vector<FileInfo> results;
+  auto lister =
+      std::make_shared<Impl::DirectoryLister>(shared_from_this(), impl_.get(), select);
 
   if (base_path.empty()) {
     // List all buckets
     std::vector<std::string> buckets;
     RETURN_NOT_OK(impl_->ListBuckets(&buckets));
+    std::vector<FileInfo> infos;
     for (const auto& bucket : buckets) {
       FileInfo info;
       info.set_path(bucket);
       info.set_type(FileType::Directory);
-      results.push_back(std::move(info));
-      if (select.recursive) {
-        RETURN_NOT_OK(impl_->Walk(select, bucket, "", &results));
+      infos.push_back(std::move(info));
+    }
+    lister->AddResults(std::move(infos));
+    if (select.recursive) {
+      for (const auto& bucket : buckets) {
+        lister->AddDirectory(bucket, "");
       }
     }
-    return results;
+  } else {
+    // Nominal case -> walk a single bucket
+    lister->AddDirectory(base_path.bucket, base_path.key);
   }
-
-  // Nominal case -> walk a single bucket
-  RETURN_NOT_OK(impl_->Walk(select, base_path.bucket, base_path.key, &results));
-  return results;
+  return FileInfoIterator(Impl::DirectoryListerIterator(std::move(lister)));
 }
 
 Status S3FileSystem::CreateDir(const std::string& s, bool recursive) {
@@ -1531,7 +2034,8 @@ Result<std::shared_ptr<io::InputStream>> S3FileSystem::OpenInputStream(
   ARROW_ASSIGN_OR_RAISE(auto path, S3Path::FromString(s));
   RETURN_NOT_OK(ValidateFilePath(path));
 
-  auto ptr = std::make_shared<ObjectInputFile>(impl_->client_.get(), path);
+  auto ptr = std::make_shared<ObjectInputFile>(impl_->client_.get(), path,
+                                                impl_->options_, impl_->latency_tracker_);
   RETURN_NOT_OK(ptr->Init());
   return ptr;
 }
@@ -1548,7 +2052,9 @@ Result<std::shared_ptr<io::InputStream>> S3FileSystem::OpenInputStream(
   ARROW_ASSIGN_OR_RAISE(auto path, S3Path::FromString(info.path()));
   RETURN_NOT_OK(ValidateFilePath(path));
 
-  auto ptr = std::make_shared<ObjectInputFile>(impl_->client_.get(), path, info.size());
+  auto ptr = std::make_shared<ObjectInputFile>(impl_->client_.get(), path,
+                                                impl_->options_, impl_->latency_tracker_,
+                                                info.size());
   RETURN_NOT_OK(ptr->Init());
   return ptr;
 }
@@ -1558,7 +2064,8 @@ Result<std::shared_ptr<io::RandomAccessFile>> S3FileSystem::OpenInputFile(
   ARROW_ASSIGN_OR_RAISE(auto path, S3Path::FromString(s));
   RETURN_NOT_OK(ValidateFilePath(path));
 
-  auto ptr = std::make_shared<ObjectInputFile>(impl_->client_.get(), path);
+  auto ptr = std::make_shared<ObjectInputFile>(impl_->client_.get(), path,
+                                                impl_->options_, impl_->latency_tracker_);
   RETURN_NOT_OK(ptr->Init());
   return ptr;
 }
@@ -1575,7 +2082,9 @@ Result<std::shared_ptr<io::RandomAccessFile>> S3FileSystem::OpenInputFile(
   ARROW_ASSIGN_OR_RAISE(auto path, S3Path::FromString(info.path()));
   RETURN_NOT_OK(ValidateFilePath(path));
 
-  auto ptr = std::make_shared<ObjectInputFile>(impl_->client_.get(), path, info.size());
+  auto ptr = std::make_shared<ObjectInputFile>(impl_->client_.get(), path,
+                                                impl_->options_, impl_->latency_tracker_,
+                                                info.size());
   RETURN_NOT_OK(ptr->Init());
   return ptr;
 }
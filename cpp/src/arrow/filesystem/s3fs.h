@@ -67,6 +67,47 @@ struct ARROW_EXPORT S3Options {
 
   /// Whether OutputStream writes will be issued in the background, without blocking.
   bool background_writes = true;
+  /// Size of the first parts of a multipart upload (at least 5 MiB).
+  ///
+  /// The part size is raised by this amount every 100 parts, so that very large
+  /// objects fit in the 10000 parts allowed by S3.
+  int64_t write_part_size = 5 * 1024 * 1024;
+  /// Maximum number of background part uploads per OutputStream (0 for no limit).
+  ///
+  /// Writes block while the limit is reached.
+  int32_t max_concurrent_uploads = 0;
+  /// Maximum number of bytes held by background part uploads per OutputStream
+  /// (0 for no limit).
+  ///
+  /// Writes block while the budget is exhausted.  A single part larger than the
+  /// budget is still uploaded once all other uploads have finished.
+  int64_t upload_memory_budget = 0;
+
+  /// Reads larger than this many bytes are split into ranged GET requests of
+  /// this size, issued concurrently on the I/O thread pool.
+  int64_t read_part_size = 8 * 1024 * 1024;
+  /// Maximum number of concurrent ranged GET requests for a single read
+  /// (1 disables splitting reads).
+  int32_t read_parallelism = 8;
+
+  /// Whether to hedge ranged GET requests.
+  ///
+  /// A request still pending after the `hedged_read_quantile` of the latencies
+  /// observed so far gets a duplicate, and the first response wins.  A failed
+  /// request is retried the same way.  Each request then reads into its own
+  /// buffer, which costs a copy.
+  bool hedged_reads = false;
+  /// Latency quantile after which a pending request is hedged
+  double hedged_read_quantile = 0.95;
+  /// Maximum number of duplicate requests per ranged GET
+  int32_t hedged_read_max_duplicates = 1;
+  /// Maximum ratio of duplicate requests to ranged GETs, so that hedging
+  /// doesn't overload a store where all requests are slow.
+  double hedged_read_budget = 0.05;
+
+  /// Maximum number of "directories" listed concurrently when walking a tree
+  /// with a recursive FileSelector (1 lists them one after the other).
+  int32_t list_parallelism = 8;
 
   /// Configure with the default AWS credentials provider chain.
   void ConfigureDefaultCredentials();
@@ -117,6 +158,25 @@ struct ARROW_EXPORT S3Options {
                                    std::string* out_path = NULLPTR);
 };
 
+/// Latency distribution of the ranged GET requests issued by a S3FileSystem
+struct ARROW_EXPORT S3ReadLatencyHistogram {
+  /// Upper bounds of the buckets, in microseconds
+  std::vector<int64_t> bucket_upper_bounds_us;
+  /// Number of successful requests per bucket
+  std::vector<int64_t> counts;
+  /// Number of ranged GETs, not counting duplicate requests
+  int64_t num_reads = 0;
+  /// Number of duplicate requests issued by hedged reads
+  int64_t num_duplicates = 0;
+  /// Number of ranged GETs answered by a duplicate request
+  int64_t num_duplicate_wins = 0;
+
+  /// \brief Return an upper bound of the given latency quantile in microseconds
+  ///
+  /// Return -1 if no latency was recorded.
+  int64_t Quantile(double q) const;
+};
+
 /// S3-backed FileSystem implementation.
 ///
 /// Some implementation notes:
@@ -129,6 +189,9 @@ class ARROW_EXPORT S3FileSystem : public FileSystem {
   std::string type_name() const override { return "s3"; }
   S3Options options() const;
 
+  /// Latencies of the ranged GET requests issued so far, to tune hedged reads
+  S3ReadLatencyHistogram GetReadLatencyHistogram() const;
+
   bool Equals(const FileSystem& other) const override;
 
   /// \cond FALSE
@@ -136,6 +199,12 @@ class ARROW_EXPORT S3FileSystem : public FileSystem {
   /// \endcond
   Result<FileInfo> GetFileInfo(const std::string& path) override;
   Result<std::vector<FileInfo>> GetFileInfo(const FileSelector& select) override;
+  /// Stream the results of a selector.
+  ///
+  /// "Directories" are listed concurrently on the I/O thread pool, as allowed
+  /// by S3Options.list_parallelism, and each batch holds the entries of one
+  /// of them.  Batches are not yielded in any particular order.
+  Result<FileInfoIterator> GetFileInfoIterator(const FileSelector& select) override;
 
   Status CreateDir(const std::string& path, bool recursive = true) override;
 
@@ -368,6 +368,22 @@ BENCHMARK_DEFINE_F(MinioFixture, ReadAll500Mib)(benchmark::State& st) {
 }
 BENCHMARK_REGISTER_F(MinioFixture, ReadAll500Mib)->UseRealTime();
 
+// Args: read part size in MiB, number of concurrent requests
+BENCHMARK_DEFINE_F(MinioFixture, ReadAllParallel500Mib)(benchmark::State& st) {
+  S3Options options = options_;
+  options.read_part_size = st.range(0) * 1024 * 1024;
+  options.read_parallelism = static_cast<int32_t>(st.range(1));
+  ASSERT_OK_AND_ASSIGN(auto fs, S3FileSystem::Make(options));
+  NaiveRead(st, fs.get(), bucket_ + "/bytes_500mib");
+}
+BENCHMARK_REGISTER_F(MinioFixture, ReadAllParallel500Mib)
+    ->Args({8, 1})
+    ->Args({8, 4})
+    ->Args({8, 8})
+    ->Args({16, 8})
+    ->Args({32, 16})
+    ->UseRealTime();
+
 BENCHMARK_DEFINE_F(MinioFixture, ReadChunked100Mib)(benchmark::State& st) {
   ChunkedRead(st, fs_.get(), bucket_ + "/bytes_100mib");
 }
@@ -386,6 +402,45 @@ BENCHMARK_DEFINE_F(MinioFixture, ReadCoalesced500Mib)(benchmark::State& st) {
 }
 BENCHMARK_REGISTER_F(MinioFixture, ReadCoalesced500Mib)->UseRealTime();
 
+/// Write a file in 1 MiB chunks to measure upload bandwidth.
+static void ChunkedWrite(benchmark::State& st, S3FileSystem* fs, const std::string& path,
+                         int64_t size) {
+  constexpr int64_t kWriteChunkSize = 1024 * 1024;
+  const std::string chunk(kWriteChunkSize, 'a');
+  int64_t total_bytes = 0;
+  int total_items = 0;
+  for (auto _ : st) {
+    std::shared_ptr<io::OutputStream> stream;
+    ASSERT_OK_AND_ASSIGN(stream, fs->OpenOutputStream(path));
+    for (int64_t written = 0; written < size; written += kWriteChunkSize) {
+      ASSERT_OK(stream->Write(chunk.data(), kWriteChunkSize));
+    }
+    ASSERT_OK(stream->Close());
+    total_bytes += size;
+    total_items += 1;
+  }
+  st.SetBytesProcessed(total_bytes);
+  st.SetItemsProcessed(total_items);
+  std::cerr << "Wrote the file " << total_items << " times" << std::endl;
+}
+
+// Args: part size in MiB, max concurrent uploads, memory budget in MiB
+BENCHMARK_DEFINE_F(MinioFixture, WriteChunked500Mib)(benchmark::State& st) {
+  S3Options options = options_;
+  options.write_part_size = st.range(0) * 1024 * 1024;
+  options.max_concurrent_uploads = static_cast<int32_t>(st.range(1));
+  options.upload_memory_budget = st.range(2) * 1024 * 1024;
+  ASSERT_OK_AND_ASSIGN(auto fs, S3FileSystem::Make(options));
+  ChunkedWrite(st, fs.get(), bucket_ + "/written_500mib", 500 * 1024 * 1024);
+}
+BENCHMARK_REGISTER_F(MinioFixture, WriteChunked500Mib)
+    ->Args({5, 0, 0})
+    ->Args({5, 4, 0})
+    ->Args({16, 8, 0})
+    ->Args({16, 8, 64})
+    ->Args({32, 16, 256})
+    ->UseRealTime();
+
 // Helpers to generate various multiple benchmarks for a given Parquet file.
 
 // NAME: the base name of the benchmark.
@@ -220,6 +220,19 @@ TEST_F(S3OptionsTest, FromUri) {
   ASSERT_RAISES(Invalid, S3Options::FromUri("s3:///foo/bar/", &path));
 }
 
+TEST(S3ReadLatencyHistogram, Quantile) {
+  S3ReadLatencyHistogram histogram;
+  ASSERT_EQ(histogram.Quantile(0.5), -1);
+
+  histogram.bucket_upper_bounds_us = {10, 100, 1000};
+  histogram.counts = {90, 9, 1};
+  ASSERT_EQ(histogram.Quantile(0.0), 10);
+  ASSERT_EQ(histogram.Quantile(0.9), 10);
+  ASSERT_EQ(histogram.Quantile(0.95), 100);
+  ASSERT_EQ(histogram.Quantile(0.99), 100);
+  ASSERT_EQ(histogram.Quantile(1.0), 1000);
+}
+
 TEST_F(S3OptionsTest, FromAccessKey) {
   S3Options options;
 
@@ -533,6 +546,53 @@ TEST_F(TestS3FS, GetFileInfoSelectorRecursive) {
   AssertFileInfo(infos[1], "bucket/somedir/subdir/subfile", FileType::File, 8);
 }
 
+TEST_F(TestS3FS, GetFileInfoSelectorRecursiveSerial) {
+  options_.list_parallelism = 1;
+  MakeFileSystem();
+
+  FileSelector select;
+  std::vector<FileInfo> infos;
+  select.recursive = true;
+  select.base_dir = "bucket";
+  ASSERT_OK_AND_ASSIGN(infos, fs_->GetFileInfo(select));
+  SortInfos(&infos);
+  ASSERT_EQ(infos.size(), 5);
+  AssertFileInfo(infos[0], "bucket/emptydir", FileType::Directory);
+  AssertFileInfo(infos[1], "bucket/somedir", FileType::Directory);
+  AssertFileInfo(infos[2], "bucket/somedir/subdir", FileType::Directory);
+  AssertFileInfo(infos[3], "bucket/somedir/subdir/subfile", FileType::File, 8);
+  AssertFileInfo(infos[4], "bucket/somefile", FileType::File, 9);
+}
+
+TEST_F(TestS3FS, GetFileInfoIterator) {
+  FileSelector select;
+  select.recursive = true;
+  select.base_dir = "bucket";
+  ASSERT_OK_AND_ASSIGN(auto it, fs_->GetFileInfoIterator(select));
+  std::vector<FileInfo> infos;
+  while (true) {
+    ASSERT_OK_AND_ASSIGN(auto batch, it.Next());
+    if (batch.empty()) {
+      break;
+    }
+    infos.insert(infos.end(), batch.begin(), batch.end());
+  }
+  SortInfos(&infos);
+  ASSERT_EQ(infos.size(), 5);
+  AssertFileInfo(infos[0], "bucket/emptydir", FileType::Directory);
+  AssertFileInfo(infos[4], "bucket/somefile", FileType::File, 9);
+
+  // Abandoning the iterator early is fine
+  ASSERT_OK_AND_ASSIGN(it, fs_->GetFileInfoIterator(select));
+  ASSERT_OK_AND_ASSIGN(auto batch, it.Next());
+  ASSERT_FALSE(batch.empty());
+
+  // Errors are reported
+  select.base_dir = "bucket/nonexistent";
+  ASSERT_OK_AND_ASSIGN(it, fs_->GetFileInfoIterator(select));
+  ASSERT_RAISES(IOError, it.Next());
+}
+
 TEST_F(TestS3FS, CreateDir) {
   FileInfo st;
 
@@ -731,6 +791,60 @@ TEST_F(TestS3FS, OpenInputFile) {
   ASSERT_RAISES(IOError, file->Seek(10));
 }
 
+TEST_F(TestS3FS, OpenInputFileParallelReads) {
+  options_.read_part_size = 3;
+  options_.read_parallelism = 4;
+  MakeFileSystem();
+
+  std::shared_ptr<io::RandomAccessFile> file;
+  std::shared_ptr<Buffer> buf;
+
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("bucket/somefile"));
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(0, 9));
+  AssertBufferEqual(*buf, "some data");
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(1, 7));
+  AssertBufferEqual(*buf, "ome dat");
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(2, 20));
+  AssertBufferEqual(*buf, "me data");
+
+  char result[10];
+  ASSERT_OK_AND_EQ(8, file->ReadAt(1, 20, &result));
+  ASSERT_EQ(std::string(result, 8), "ome data");
+
+  ASSERT_OK(file->Seek(0));
+  ASSERT_OK_AND_ASSIGN(buf, file->Read(5));
+  AssertBufferEqual(*buf, "some ");
+  ASSERT_OK_AND_ASSIGN(buf, file->Read(5));
+  AssertBufferEqual(*buf, "data");
+}
+
+TEST_F(TestS3FS, OpenInputFileHedgedReads) {
+  // Hedge every request, once enough latencies are known
+  options_.hedged_reads = true;
+  options_.hedged_read_quantile = 0.0;
+  options_.hedged_read_max_duplicates = 2;
+  options_.hedged_read_budget = 2.0;
+  MakeFileSystem();
+
+  std::shared_ptr<io::RandomAccessFile> file;
+  std::shared_ptr<Buffer> buf;
+
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("bucket/somefile"));
+  for (int i = 0; i < 50; ++i) {
+    ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(1, 7));
+    AssertBufferEqual(*buf, "ome dat");
+    ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(2, 20));
+    AssertBufferEqual(*buf, "me data");
+  }
+
+  // Whether requests were actually hedged depends on their latencies
+  auto histogram = fs_->GetReadLatencyHistogram();
+  ASSERT_EQ(histogram.num_reads, 100);
+  ASSERT_LE(histogram.num_duplicates, 200);
+  ASSERT_LE(histogram.num_duplicate_wins, histogram.num_duplicates);
+  ASSERT_GE(histogram.Quantile(0.5), 1);
+}
+
 TEST_F(TestS3FS, OpenOutputStreamBackgroundWrites) { TestOpenOutputStream(); }
 
 TEST_F(TestS3FS, OpenOutputStreamSyncWrites) {
@@ -739,6 +853,19 @@ TEST_F(TestS3FS, OpenOutputStreamSyncWrites) {
   TestOpenOutputStream();
 }
 
+TEST_F(TestS3FS, OpenOutputStreamBackgroundWritesLimited) {
+  options_.max_concurrent_uploads = 1;
+  options_.upload_memory_budget = 1;
+  MakeFileSystem();
+  TestOpenOutputStream();
+}
+
+TEST_F(TestS3FS, OpenOutputStreamLargePartSize) {
+  options_.write_part_size = 8 * 1024 * 1024;
+  MakeFileSystem();
+  TestOpenOutputStream();
+}
+
 TEST_F(TestS3FS, OpenOutputStreamAbortBackgroundWrites) { TestOpenOutputStreamAbort(); }
 
 TEST_F(TestS3FS, OpenOutputStreamAbortSyncWrites) {
@@ -741,6 +741,66 @@ void GenericFileSystemTest::TestGetFileInfoSelectorWithRecursion(FileSystem* fs)
                          File("AA/AA.file")));
 }
 
+Result<std::vector<FileInfo>> CollectFileInfoIterator(FileSystem* fs,
+                                                       const FileSelector& s) {
+  ARROW_ASSIGN_OR_RAISE(auto it, fs->GetFileInfoIterator(s));
+  std::vector<FileInfo> infos;
+  while (true) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, it.Next());
+    if (batch.empty()) {
+      break;
+    }
+    infos.insert(infos.end(), batch.begin(), batch.end());
+  }
+  SortInfos(&infos);
+  return infos;
+}
+
+void GenericFileSystemTest::TestGetFileInfoIterator(FileSystem* fs) {
+  ASSERT_OK(fs->CreateDir("01/02/03"));
+  ASSERT_OK(fs->CreateDir("AA"));
+  ASSERT_OK(fs->CreateDir("BB"));
+  CreateFile(fs, "00.file", "00");
+  CreateFile(fs, "01/01.file", "01");
+  CreateFile(fs, "01/02/02.file", "02");
+  CreateFile(fs, "01/02/03/03.file", "03");
+  CreateFile(fs, "AA/AA.file", "aa");
+
+  std::vector<FileInfo> infos, expected;
+  FileSelector s;
+
+  ASSERT_OK_AND_ASSIGN(infos, CollectFileInfoIterator(fs, s));
+  ASSERT_EQ(infos.size(), 4);
+  AssertFileInfo(infos[0], "00.file", FileType::File, 2);
+  AssertFileInfo(infos[1], "01", FileType::Directory);
+  AssertFileInfo(infos[2], "AA", FileType::Directory);
+  AssertFileInfo(infos[3], "BB", FileType::Directory);
+
+  for (const std::string base_dir : {"", "01"}) {
+    s.base_dir = base_dir;
+    s.recursive = true;
+    for (int32_t max_recursion : {0, 1, INT32_MAX}) {
+      s.max_recursion = max_recursion;
+      ASSERT_OK_AND_ASSIGN(expected, fs->GetFileInfo(s));
+      SortInfos(&expected);
+      ASSERT_OK_AND_ASSIGN(infos, CollectFileInfoIterator(fs, s));
+      ASSERT_EQ(infos, expected);
+    }
+  }
+
+  // Empty directory
+  s.base_dir = "BB";
+  ASSERT_OK_AND_ASSIGN(infos, CollectFileInfoIterator(fs, s));
+  ASSERT_EQ(infos.size(), 0);
+
+  // Doesn't exist
+  s.base_dir = "XX";
+  ASSERT_RAISES(IOError, CollectFileInfoIterator(fs, s));
+  s.allow_not_found = true;
+  ASSERT_OK_AND_ASSIGN(infos, CollectFileInfoIterator(fs, s));
+  ASSERT_EQ(infos.size(), 0);
+}
+
 void GenericFileSystemTest::TestOpenOutputStream(FileSystem* fs) {
   std::shared_ptr<io::OutputStream> stream;
 
@@ -941,6 +1001,7 @@ GENERIC_FS_TEST_DEFINE(TestGetFileInfo)
 GENERIC_FS_TEST_DEFINE(TestGetFileInfoVector)
 GENERIC_FS_TEST_DEFINE(TestGetFileInfoSelector)
 GENERIC_FS_TEST_DEFINE(TestGetFileInfoSelectorWithRecursion)
+GENERIC_FS_TEST_DEFINE(TestGetFileInfoIterator)
 GENERIC_FS_TEST_DEFINE(TestOpenOutputStream)
 GENERIC_FS_TEST_DEFINE(TestOpenAppendStream)
 GENERIC_FS_TEST_DEFINE(TestOpenInputStream)
@@ -20,11 +20,17 @@
 // Platform-specific defines
 #include "arrow/flight/platform.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 
 #ifdef GRPCPP_PP_INCLUDE
@@ -85,6 +91,14 @@ std::shared_ptr<FlightWriteSizeStatusDetail> FlightWriteSizeStatusDetail::Unwrap
 
 FlightClientOptions FlightClientOptions::Defaults() { return FlightClientOptions(); }
 
+MultiEndpointReadOptions MultiEndpointReadOptions::Defaults() {
+  return MultiEndpointReadOptions();
+}
+
+FlightClientPoolOptions FlightClientPoolOptions::Defaults() {
+  return FlightClientPoolOptions();
+}
+
 struct ClientRpc {
   grpc::ClientContext context;
 
@@ -106,6 +120,14 @@ struct ClientRpc {
     }
     return Status::OK();
   }
+
+  /// \brief Advertise the compression codecs accepted for received data
+  void SetAcceptedCompression(const std::vector<Compression::type>& codecs) {
+    if (!codecs.empty()) {
+      context.AddMetadata(internal::kGrpcAcceptCompressionHeader,
+                          internal::FormatAcceptedCompression(codecs));
+    }
+  }
 };
 
 /// Helper that manages Finish() of a gRPC stream.
@@ -834,9 +856,182 @@ class GrpcMetadataReader : public FlightMetadataReader {
   std::shared_ptr<std::mutex> read_mutex_;
 };
 
+// A RecordBatchReader over the data of several endpoints, which are read
+// concurrently by worker threads
+class MultiEndpointReader : public RecordBatchReader {
+ public:
+  using DoGetFunc = std::function<Status(const FlightEndpoint&,
+                                         std::unique_ptr<FlightStreamReader>*)>;
+
+  MultiEndpointReader(std::shared_ptr<Schema> schema,
+                      std::vector<FlightEndpoint> endpoints,
+                      const MultiEndpointReadOptions& options, DoGetFunc do_get)
+      : schema_(std::move(schema)),
+        endpoints_(std::move(endpoints)),
+        options_(options),
+        do_get_(std::move(do_get)),
+        streams_(endpoints_.size()) {}
+
+  ~MultiEndpointReader() override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopped_ = true;
+      for (auto& stream : streams_) {
+        if (stream.active != nullptr) {
+          stream.active->Cancel();
+        }
+      }
+    }
+    cv_.notify_all();
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  void Start() {
+    const int num_workers = static_cast<int>(std::min<size_t>(
+        std::max(options_.max_parallel_streams, 1), endpoints_.size()));
+    for (int i = 0; i < num_workers; ++i) {
+      workers_.emplace_back([this] { WorkerLoop(); });
+    }
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      // Skip the endpoints which were read entirely
+      while (next_stream_ < streams_.size() && streams_[next_stream_].finished &&
+             streams_[next_stream_].batches.empty()) {
+        RETURN_NOT_OK(streams_[next_stream_].status);
+        ++next_stream_;
+      }
+      if (next_stream_ == streams_.size()) {
+        *out = nullptr;
+        return Status::OK();
+      }
+      const size_t end = options_.ordered ? next_stream_ + 1 : streams_.size();
+      for (size_t i = next_stream_; i < end; ++i) {
+        StreamState& stream = streams_[i];
+        if (!stream.batches.empty()) {
+          *out = std::move(stream.batches.front());
+          stream.batches.pop_front();
+          // Wake up the worker if it was waiting for room
+          cv_.notify_all();
+          return Status::OK();
+        }
+        if (stream.finished) {
+          RETURN_NOT_OK(stream.status);
+        }
+      }
+      cv_.wait(lock);
+    }
+  }
+
+ private:
+  struct StreamState {
+    std::deque<std::shared_ptr<RecordBatch>> batches;
+    // The stream being read, if any, so it can be cancelled
+    FlightStreamReader* active = nullptr;
+    bool finished = false;
+    Status status;
+  };
+
+  void WorkerLoop() {
+    while (true) {
+      size_t index;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopped_ || next_endpoint_ == endpoints_.size()) {
+          return;
+        }
+        index = next_endpoint_++;
+      }
+      std::unique_ptr<FlightStreamReader> stream;
+      Status status = ReadEndpoint(index, &stream);
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        streams_[index].active = nullptr;
+        streams_[index].finished = true;
+        streams_[index].status = std::move(status);
+      }
+      cv_.notify_all();
+    }
+  }
+
+  Status ReadEndpoint(size_t index, std::unique_ptr<FlightStreamReader>* stream) {
+    RETURN_NOT_OK(do_get_(endpoints_[index], stream));
+    StreamState& state = streams_[index];
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopped_) {
+        return MakeFlightError(FlightStatusCode::Cancelled, "Reader destroyed");
+      }
+      state.active = stream->get();
+    }
+    bool checked_schema = false;
+    while (true) {
+      FlightStreamChunk chunk;
+      RETURN_NOT_OK((*stream)->Next(&chunk));
+      if (chunk.data == nullptr) {
+        if (chunk.app_metadata != nullptr) {
+          continue;
+        }
+        return Status::OK();
+      }
+      if (!checked_schema) {
+        if (!chunk.data->schema()->Equals(*schema_, /*check_metadata=*/false)) {
+          return Status::Invalid("Endpoint ", index, " returned data with schema ",
+                                 chunk.data->schema()->ToString(),
+                                 " instead of the flight's schema ",
+                                 schema_->ToString());
+        }
+        checked_schema = true;
+      }
+
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [&] {
+        return stopped_ ||
+               static_cast<int64_t>(state.batches.size()) < options_.max_buffered_batches;
+      });
+      if (stopped_) {
+        return MakeFlightError(FlightStatusCode::Cancelled, "Reader destroyed");
+      }
+      state.batches.push_back(std::move(chunk.data));
+      lock.unlock();
+      cv_.notify_all();
+    }
+  }
+
+  const std::shared_ptr<Schema> schema_;
+  const std::vector<FlightEndpoint> endpoints_;
+  const MultiEndpointReadOptions options_;
+  const DoGetFunc do_get_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<StreamState> streams_;
+  // The next endpoint to be read by a worker
+  size_t next_endpoint_ = 0;
+  // The first endpoint not entirely consumed
+  size_t next_stream_ = 0;
+  bool stopped_ = false;
+  std::vector<std::thread> workers_;
+};
+
 class FlightClient::FlightClientImpl {
  public:
   Status Connect(const Location& location, const FlightClientOptions& options) {
+    std::shared_ptr<grpc::Channel> channel;
+    RETURN_NOT_OK(MakeChannel(location, options, &channel));
+    Init(location, options, channel);
+    return Status::OK();
+  }
+
+  // Set up a new connection, which clients may share
+  static Status MakeChannel(const Location& location, const FlightClientOptions& options,
+                            std::shared_ptr<grpc::Channel>* out) {
     const std::string& scheme = location.scheme();
 
     std::stringstream grpc_uri;
@@ -862,6 +1057,8 @@ class FlightClient::FlightClientImpl {
     } else if (scheme == kSchemeGrpcUnix) {
       grpc_uri << "unix://" << location.uri_->path();
       creds = grpc::InsecureChannelCredentials();
+    } else if (scheme == kSchemeGrpcInProcess) {
+      // The channel is obtained from the server itself below
     } else {
       return Status::NotImplemented("Flight scheme " + scheme + " is not supported.");
     }
@@ -894,12 +1091,21 @@ class FlightClient::FlightClientImpl {
     interceptors.emplace_back(
         new GrpcClientInterceptorAdapterFactory(std::move(options.middleware)));
 
-    stub_ = pb::FlightService::NewStub(
-        grpc::experimental::CreateCustomChannelWithInterceptors(
-            grpc_uri.str(), creds, args, std::move(interceptors)));
+    if (scheme == kSchemeGrpcInProcess) {
+      return internal::MakeInProcessChannel(location.uri_->host(), args,
+                                            std::move(interceptors), out);
+    }
+    *out = grpc::experimental::CreateCustomChannelWithInterceptors(
+        grpc_uri.str(), creds, args, std::move(interceptors));
+    return Status::OK();
+  }
 
+  void Init(const Location& location, const FlightClientOptions& options,
+            const std::shared_ptr<grpc::Channel>& channel) {
+    location_ = location;
+    options_ = options;
+    stub_ = pb::FlightService::NewStub(channel);
     write_size_limit_bytes_ = options.write_size_limit_bytes;
-    return Status::OK();
   }
 
   Status Authenticate(const FlightCallOptions& options,
@@ -1032,6 +1238,7 @@ class FlightClient::FlightClientImpl {
 
     auto rpc = std::make_shared<ClientRpc>(options);
     RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
+    rpc->SetAcceptedCompression(options_.accepted_compression);
     std::shared_ptr<grpc::ClientReader<pb::FlightData>> stream =
         stub_->DoGet(&rpc->context, pb_ticket);
     auto finishable_stream = std::make_shared<
@@ -1043,6 +1250,44 @@ class FlightClient::FlightClientImpl {
     return static_cast<StreamReader*>(out->get())->EnsureDataStarted();
   }
 
+  // Get the client through which to read the endpoint
+  Status GetEndpointClient(const FlightEndpoint& endpoint, FlightClient* self,
+                           FlightClient** out) {
+    if (endpoint.locations.empty() || endpoint.locations[0] == location_) {
+      *out = self;
+      return Status::OK();
+    }
+    const Location& location = endpoint.locations[0];
+    std::lock_guard<std::mutex> lock(pool_mutex_);
+    std::unique_ptr<FlightClient>& client = pool_[location.ToString()];
+    if (client == nullptr) {
+      std::unique_ptr<FlightClient> new_client;
+      RETURN_NOT_OK(FlightClient::Connect(location, options_, &new_client));
+      client = std::move(new_client);
+    }
+    *out = client.get();
+    return Status::OK();
+  }
+
+  Status ReadAll(const FlightCallOptions& options, const FlightInfo& info,
+                 const MultiEndpointReadOptions& read_options, FlightClient* self,
+                 std::shared_ptr<RecordBatchReader>* out) {
+    ipc::DictionaryMemo memo;
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(info.GetSchema(&memo, &schema));
+    auto do_get = [this, self, options](const FlightEndpoint& endpoint,
+                                        std::unique_ptr<FlightStreamReader>* stream) {
+      FlightClient* client;
+      RETURN_NOT_OK(GetEndpointClient(endpoint, self, &client));
+      return client->DoGet(options, endpoint.ticket, stream);
+    };
+    auto reader = std::make_shared<MultiEndpointReader>(
+        std::move(schema), info.endpoints(), read_options, std::move(do_get));
+    reader->Start();
+    *out = std::move(reader);
+    return Status::OK();
+  }
+
   Status DoPut(const FlightCallOptions& options, const FlightDescriptor& descriptor,
                const std::shared_ptr<Schema>& schema,
                std::unique_ptr<FlightStreamWriter>* out,
@@ -1074,6 +1319,7 @@ class FlightClient::FlightClientImpl {
 
     auto rpc = std::make_shared<ClientRpc>(options);
     RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
+    rpc->SetAcceptedCompression(options_.accepted_compression);
     std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>> stream =
         stub_->DoExchange(&rpc->context);
     // The writer drains the reader on close to avoid hanging inside
@@ -1094,6 +1340,12 @@ class FlightClient::FlightClientImpl {
   std::unique_ptr<pb::FlightService::Stub> stub_;
   std::shared_ptr<ClientAuthHandler> auth_handler_;
   int64_t write_size_limit_bytes_;
+  Location location_;
+  FlightClientOptions options_;
+
+  // Clients connected to other locations, for reading endpoints
+  std::mutex pool_mutex_;
+  std::unordered_map<std::string, std::unique_ptr<FlightClient>> pool_;
 };
 
 FlightClient::FlightClient() { impl_.reset(new FlightClientImpl); }
@@ -1153,6 +1405,12 @@ Status FlightClient::DoGet(const FlightCallOptions& options, const Ticket& ticke
   return impl_->DoGet(options, ticket, stream);
 }
 
+Status FlightClient::ReadAll(const FlightCallOptions& options, const FlightInfo& info,
+                             const MultiEndpointReadOptions& read_options,
+                             std::shared_ptr<RecordBatchReader>* reader) {
+  return impl_->ReadAll(options, info, read_options, this, reader);
+}
+
 Status FlightClient::DoPut(const FlightCallOptions& options,
                            const FlightDescriptor& descriptor,
                            const std::shared_ptr<Schema>& schema,
@@ -1168,5 +1426,75 @@ Status FlightClient::DoExchange(const FlightCallOptions& options,
   return impl_->DoExchange(options, descriptor, writer, reader);
 }
 
+class FlightClientPool::FlightClientPoolImpl {
+ public:
+  explicit FlightClientPoolImpl(const FlightClientPoolOptions& options)
+      : options_(options) {
+    options_.connections_per_location = std::max(1, options_.connections_per_location);
+  }
+
+  Status GetClient(const Location& location, std::unique_ptr<FlightClient>* client) {
+    std::shared_ptr<grpc::Channel> channel;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      Connections& connections = connections_[location.ToString()];
+      if (static_cast<int>(connections.channels.size()) <
+          options_.connections_per_location) {
+        // Open connections lazily, so that the pool does not hold more than
+        // the load requires.  Each channel gets its own connection thanks to
+        // GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL.
+        RETURN_NOT_OK(FlightClient::FlightClientImpl::MakeChannel(
+            location, options_.client_options, &channel));
+        connections.channels.push_back(channel);
+      } else {
+        channel = connections.channels[connections.next];
+        connections.next = (connections.next + 1) % connections.channels.size();
+      }
+    }
+    client->reset(new FlightClient);
+    (*client)->impl_->Init(location, options_.client_options, channel);
+    return Status::OK();
+  }
+
+  void Evict(const Location& location) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    connections_.erase(location.ToString());
+  }
+
+  int64_t num_connections() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    int64_t count = 0;
+    for (const auto& entry : connections_) {
+      count += static_cast<int64_t>(entry.second.channels.size());
+    }
+    return count;
+  }
+
+ private:
+  struct Connections {
+    std::vector<std::shared_ptr<grpc::Channel>> channels;
+    // The channel of the next client, once all connections are open
+    size_t next = 0;
+  };
+
+  FlightClientPoolOptions options_;
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, Connections> connections_;
+};
+
+FlightClientPool::FlightClientPool(const FlightClientPoolOptions& options)
+    : impl_(new FlightClientPoolImpl(options)) {}
+
+FlightClientPool::~FlightClientPool() {}
+
+Status FlightClientPool::GetClient(const Location& location,
+                                   std::unique_ptr<FlightClient>* client) {
+  return impl_->GetClient(location, client);
+}
+
+void FlightClientPool::Evict(const Location& location) { impl_->Evict(location); }
+
+int64_t FlightClientPool::num_connections() const { return impl_->num_connections(); }
+
 }  // namespace flight
 }  // namespace arrow
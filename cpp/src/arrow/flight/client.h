@@ -30,6 +30,7 @@
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/status.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/variant.h"
 
 #include "arrow/flight/types.h"  // IWYU pragma: keep
@@ -111,11 +112,35 @@ class ARROW_FLIGHT_EXPORT FlightClientOptions {
   /// \brief Generic connection options, passed to the underlying
   ///     transport; interpretation is implementation-dependent.
   std::vector<std::pair<std::string, util::variant<int, std::string>>> generic_options;
+  /// \brief The IPC body compression codecs this client accepts for the
+  ///     data it receives from DoGet and DoExchange.
+  ///
+  /// If given, they are advertised to the server, which may compress
+  /// its record batches with one of them (see
+  /// FlightServerOptions::compression). Decompression is transparent.
+  std::vector<Compression::type> accepted_compression;
 
   /// \brief Get default options.
   static FlightClientOptions Defaults();
 };
 
+/// \brief Options for reading all the endpoints of a flight at once.
+class ARROW_FLIGHT_EXPORT MultiEndpointReadOptions {
+ public:
+  /// \brief The maximum number of endpoints read concurrently.
+  int max_parallel_streams = 4;
+  /// \brief If true, return the batches of the first endpoint, then those
+  /// of the second one, and so on. Otherwise, return the batches as they
+  /// arrive, whatever their endpoint.
+  bool ordered = true;
+  /// \brief The maximum number of record batches received ahead of the
+  /// consumer, for each endpoint being read.
+  int64_t max_buffered_batches = 8;
+
+  /// \brief Get default options.
+  static MultiEndpointReadOptions Defaults();
+};
+
 /// \brief A RecordBatchReader exposing Flight metadata and cancel
 /// operations.
 class ARROW_FLIGHT_EXPORT FlightStreamReader : public MetadataRecordBatchReader {
@@ -260,6 +285,31 @@ class ARROW_FLIGHT_EXPORT FlightClient {
     return DoGet({}, ticket, stream);
   }
 
+  /// \brief Read the data of all the endpoints of a flight as a single
+  /// stream.
+  ///
+  /// The endpoints are read concurrently, each with DoGet. An endpoint
+  /// without locations is read through this client; otherwise, it is read
+  /// from its first location, through this client if it was connected to
+  /// that location, or else through a client connected to it with this
+  /// client's FlightClientOptions. Those clients are kept and reused for
+  /// later calls. They aren't authenticated.
+  ///
+  /// The returned reader must not outlive this client. Destroying it
+  /// cancels the streams still being read.
+  ///
+  /// \param[in] options Per-RPC options, for each DoGet
+  /// \param[in] info the flight to read
+  /// \param[in] read_options how to read the endpoints
+  /// \param[out] reader the returned RecordBatchReader
+  /// \return Status
+  Status ReadAll(const FlightCallOptions& options, const FlightInfo& info,
+                 const MultiEndpointReadOptions& read_options,
+                 std::shared_ptr<RecordBatchReader>* reader);
+  Status ReadAll(const FlightInfo& info, std::shared_ptr<RecordBatchReader>* reader) {
+    return ReadAll({}, info, MultiEndpointReadOptions::Defaults(), reader);
+  }
+
   /// \brief Upload data to a Flight described by the given
   /// descriptor. The caller must call Close() on the returned stream
   /// once they are done writing.
@@ -294,10 +344,67 @@ class ARROW_FLIGHT_EXPORT FlightClient {
   }
 
  private:
+  friend class FlightClientPool;
+
   FlightClient();
   class FlightClientImpl;
   std::unique_ptr<FlightClientImpl> impl_;
 };
 
+/// \brief Options for a FlightClientPool.
+class ARROW_FLIGHT_EXPORT FlightClientPoolOptions {
+ public:
+  /// \brief The options of the connections made by the pool.
+  ///
+  /// Since connections are shared, the middleware given here applies to
+  /// every client obtained from the pool.
+  FlightClientOptions client_options = FlightClientOptions::Defaults();
+  /// \brief The number of connections kept to each location.
+  ///
+  /// Streams of a single gRPC connection are multiplexed over one HTTP/2
+  /// connection, which limits their total throughput; clients obtained from
+  /// the pool are spread across this many connections instead.
+  int connections_per_location = 4;
+
+  /// \brief Get default options.
+  static FlightClientPoolOptions Defaults();
+};
+
+/// \brief A cache of connections to Flight services.
+///
+/// FlightClient::Connect sets up a new connection, including the TLS
+/// handshake if any, for every client.  Clients obtained from a pool instead
+/// share the pool's connections: up to connections_per_location connections
+/// are opened to each location, then clients are assigned to them in
+/// round-robin order.  Getting a client from the pool is cheap, so
+/// short-lived clients may be obtained per request.
+///
+/// The pool is thread-safe.  Clients obtained from it remain usable after
+/// the pool is destroyed.
+class ARROW_FLIGHT_EXPORT FlightClientPool {
+ public:
+  explicit FlightClientPool(
+      const FlightClientPoolOptions& options = FlightClientPoolOptions::Defaults());
+  ~FlightClientPool();
+
+  /// \brief Get a client connected to the given location.
+  /// \param[in] location The location to connect to
+  /// \param[out] client The client
+  /// \return Status OK if the connection could be set up
+  Status GetClient(const Location& location, std::unique_ptr<FlightClient>* client);
+
+  /// \brief Forget the connections to a location, e.g. after it failed.
+  ///
+  /// Clients already using them are not affected.
+  void Evict(const Location& location);
+
+  /// \brief The number of connections currently held by the pool.
+  int64_t num_connections() const;
+
+ private:
+  class FlightClientPoolImpl;
+  std::unique_ptr<FlightClientPoolImpl> impl_;
+};
+
 }  // namespace flight
 }  // namespace arrow
@@ -38,6 +38,7 @@
 #include "arrow/testing/util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/thread_pool.h"
 
 #ifdef GRPCPP_GRPCPP_H
 #error "gRPC headers should not be in public API"
@@ -45,6 +46,7 @@
 
 #include "arrow/flight/internal.h"
 #include "arrow/flight/middleware_internal.h"
+#include "arrow/flight/serialization_internal.h"
 #include "arrow/flight/test_util.h"
 
 namespace pb = arrow::flight::protocol;
@@ -279,6 +281,68 @@ TEST(TestFlight, RoundtripStatus) {
   ASSERT_THAT(status.message(), ::testing::HasSubstr("Sentinel"));
 }
 
+TEST(TestFlight, NegotiateCompression) {
+  ASSERT_EQ("LZ4,ZSTD", internal::FormatAcceptedCompression(
+                            {Compression::LZ4_FRAME, Compression::ZSTD}));
+  ASSERT_EQ("", internal::FormatAcceptedCompression({}));
+
+  const std::vector<Compression::type> preferred = {Compression::ZSTD,
+                                                    Compression::LZ4_FRAME};
+  ASSERT_EQ(Compression::UNCOMPRESSED, internal::NegotiateCompression("", preferred));
+  ASSERT_EQ(Compression::UNCOMPRESSED,
+            internal::NegotiateCompression("LZ4,ZSTD", {Compression::UNCOMPRESSED}));
+  ASSERT_EQ(Compression::UNCOMPRESSED,
+            internal::NegotiateCompression("SNAPPY, unknown", preferred));
+
+  // The server's preference wins, among the available codecs
+  Compression::type expected = Compression::UNCOMPRESSED;
+  if (util::Codec::IsAvailable(Compression::ZSTD)) {
+    expected = Compression::ZSTD;
+  } else if (util::Codec::IsAvailable(Compression::LZ4_FRAME)) {
+    expected = Compression::LZ4_FRAME;
+  }
+  ASSERT_EQ(expected, internal::NegotiateCompression("unknown, LZ4,ZSTD", preferred));
+}
+
+TEST(TestFlight, FlightDataFromSlices) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(ipc::test::MakeIntRecordBatch(&batch));
+  FlightPayload payload;
+  payload.app_metadata = Buffer::FromString("app metadata");
+  ASSERT_OK(ipc::GetRecordBatchPayload(*batch, ipc::IpcWriteOptions::Defaults(),
+                                       &payload.ipc_message));
+  grpc::ByteBuffer serialized;
+  bool own_buffer;
+  ASSERT_TRUE(internal::FlightDataSerialize(payload, &serialized, &own_buffer).ok());
+  std::vector<grpc::Slice> slices;
+  ASSERT_TRUE(serialized.Dump(&slices).ok());
+  std::string bytes;
+  for (const auto& slice : slices) {
+    bytes.append(reinterpret_cast<const char*>(slice.begin()), slice.size());
+  }
+
+  // gRPC may hand out the received message in slices of any size, possibly
+  // splitting fields and inlining small slices
+  for (size_t slice_size : {3, 100, 4096, 1 << 20}) {
+    std::vector<grpc::Slice> received;
+    for (size_t offset = 0; offset < bytes.size(); offset += slice_size) {
+      received.emplace_back(bytes.data() + offset,
+                            std::min(slice_size, bytes.size() - offset));
+    }
+    grpc::ByteBuffer buffer(received.data(), received.size());
+    internal::FlightData data;
+    ASSERT_TRUE(internal::FlightDataDeserialize(&buffer, &data).ok());
+    ASSERT_EQ(data.descriptor, nullptr);
+    ASSERT_EQ(data.app_metadata->ToString(), "app metadata");
+    ASSERT_OK_AND_ASSIGN(auto message, data.OpenMessage());
+    ipc::DictionaryMemo memo;
+    ASSERT_OK_AND_ASSIGN(auto out, ipc::ReadRecordBatch(*message, batch->schema(), &memo,
+                                                        ipc::IpcReadOptions::Defaults()));
+    ASSERT_OK(out->ValidateFull());
+    AssertBatchesEqual(*batch, *out);
+  }
+}
+
 TEST(TestFlight, GetPort) {
   Location location;
   std::unique_ptr<FlightServerBase> server = ExampleTestServer();
@@ -306,6 +370,34 @@ TEST(TestFlight, BuilderHook) {
   ASSERT_OK(server->Shutdown());
 }
 
+TEST(TestFlight, InProcessServer) {
+  Location location;
+  ASSERT_OK(Location::ForGrpcInProcess("flight-test", &location));
+  ASSERT_EQ(kSchemeGrpcInProcess, location.scheme());
+
+  std::unique_ptr<FlightServerBase> server = ExampleTestServer();
+  ASSERT_OK(server->Init(FlightServerOptions(location)));
+  // Names are unique within a process
+  std::unique_ptr<FlightServerBase> other_server = ExampleTestServer();
+  ASSERT_RAISES(Invalid, other_server->Init(FlightServerOptions(location)));
+
+  std::unique_ptr<FlightClient> client;
+  ASSERT_OK(FlightClient::Connect(location, &client));
+  std::unique_ptr<FlightStreamReader> stream;
+  ASSERT_OK(client->DoGet(Ticket{"ticket-ints-1"}, &stream));
+  BatchVector batches;
+  ASSERT_OK(stream->ReadAll(&batches));
+  BatchVector expected_batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+  ASSERT_EQ(expected_batches.size(), batches.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    ASSERT_BATCHES_EQUAL(*expected_batches[i], *batches[i]);
+  }
+
+  ASSERT_OK(server->Shutdown());
+  ASSERT_RAISES(IOError, FlightClient::Connect(location, &client));
+}
+
 // ----------------------------------------------------------------------
 // Client tests
 
@@ -542,6 +634,62 @@ class OptionsTestServer : public FlightServerBase {
   }
 };
 
+// A data stream producing its payloads on another thread, and optionally
+// failing after the schema
+class AsyncTestStream : public FlightDataStream {
+ public:
+  AsyncTestStream(std::shared_ptr<RecordBatchReader> reader, bool fail)
+      : stream_(reader), fail_(fail) {}
+
+  std::shared_ptr<Schema> schema() override { return stream_.schema(); }
+
+  Status GetSchemaPayload(FlightPayload* payload) override {
+    return stream_.GetSchemaPayload(payload);
+  }
+
+  Status Next(FlightPayload* payload) override {
+    return Status::NotImplemented("Only NextAsync() should be called");
+  }
+
+  Future<FlightPayload> NextAsync() override {
+    auto maybe_future = ::arrow::internal::GetCpuThreadPool()->Submit(
+        [this]() -> arrow::Result<FlightPayload> {
+          if (fail_) {
+            return Status::IOError("Lost the data");
+          }
+          FlightPayload payload;
+          RETURN_NOT_OK(stream_.Next(&payload));
+          return payload;
+        });
+    if (!maybe_future.ok()) {
+      return Future<FlightPayload>::MakeFinished(maybe_future.status());
+    }
+    return *maybe_future;
+  }
+
+ private:
+  RecordBatchStream stream_;
+  bool fail_;
+};
+
+class AsyncDoGetTestServer : public FlightServerBase {
+  Status DoGet(const ServerCallContext& context, const Ticket& request,
+               std::unique_ptr<FlightDataStream>* data_stream) override {
+    BatchVector batches;
+    RETURN_NOT_OK(ExampleIntBatches(&batches));
+    std::shared_ptr<RecordBatchReader> batch_reader =
+        std::make_shared<BatchIterator>(batches[0]->schema(), batches);
+
+    if (request.ticket == "sync") {
+      // Only implements Next()
+      data_stream->reset(new RecordBatchStream(batch_reader));
+    } else {
+      data_stream->reset(new AsyncTestStream(batch_reader, request.ticket == "error"));
+    }
+    return Status::OK();
+  }
+};
+
 class TestMetadata : public ::testing::Test {
  public:
   void SetUp() {
@@ -704,12 +852,21 @@ class RejectServerMiddlewareFactory : public ServerMiddlewareFactory {
 };
 
 // A server middleware that counts the number of successful and failed
-// calls.
+// calls, and the messages and bytes sent by data streams.
 class CountingServerMiddleware : public ServerMiddleware {
  public:
-  CountingServerMiddleware(std::atomic<int>* successful, std::atomic<int>* failed)
-      : successful_(successful), failed_(failed) {}
+  CountingServerMiddleware(std::atomic<int>* successful, std::atomic<int>* failed,
+                           std::atomic<int64_t>* messages_sent,
+                           std::atomic<int64_t>* bytes_sent)
+      : successful_(successful),
+        failed_(failed),
+        messages_sent_(messages_sent),
+        bytes_sent_(bytes_sent) {}
   void SendingHeaders(AddCallHeaders* outgoing_headers) override {}
+  void StreamCompleted(const ServerStreamMetrics& metrics) override {
+    ARROW_IGNORE_EXPR(*messages_sent_ += metrics.messages_sent);
+    ARROW_IGNORE_EXPR(*bytes_sent_ += metrics.bytes_sent);
+  }
   void CallCompleted(const Status& status) override {
     if (status.ok()) {
       ARROW_IGNORE_EXPR((*successful_)++);
@@ -723,20 +880,26 @@ class CountingServerMiddleware : public ServerMiddleware {
  private:
   std::atomic<int>* successful_;
   std::atomic<int>* failed_;
+  std::atomic<int64_t>* messages_sent_;
+  std::atomic<int64_t>* bytes_sent_;
 };
 
 class CountingServerMiddlewareFactory : public ServerMiddlewareFactory {
  public:
-  CountingServerMiddlewareFactory() : successful_(0), failed_(0) {}
+  CountingServerMiddlewareFactory()
+      : successful_(0), failed_(0), messages_sent_(0), bytes_sent_(0) {}
 
   Status StartCall(const CallInfo& info, const CallHeaders& incoming_headers,
                    std::shared_ptr<ServerMiddleware>* middleware) override {
-    *middleware = std::make_shared<CountingServerMiddleware>(&successful_, &failed_);
+    *middleware = std::make_shared<CountingServerMiddleware>(
+        &successful_, &failed_, &messages_sent_, &bytes_sent_);
     return Status::OK();
   }
 
   std::atomic<int> successful_;
   std::atomic<int> failed_;
+  std::atomic<int64_t> messages_sent_;
+  std::atomic<int64_t> bytes_sent_;
 };
 
 // The current span ID, used to emulate OpenTracing style distributed
@@ -1082,6 +1245,93 @@ TEST_F(TestFlightClient, DoGetInts) {
   CheckDoGet(descr, expected_batches, check_endpoints);
 }
 
+TEST_F(TestFlightClient, ClientPool) {
+  Location location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server_->port(), &location));
+  FlightClientPoolOptions options;
+  options.connections_per_location = 2;
+  FlightClientPool pool(options);
+
+  auto descr = FlightDescriptor::Path({"examples", "ints"});
+  std::vector<std::unique_ptr<FlightClient>> clients(5);
+  for (auto& client : clients) {
+    ASSERT_OK(pool.GetClient(location, &client));
+    std::unique_ptr<FlightInfo> info;
+    ASSERT_OK(client->GetFlightInfo(descr, &info));
+    ASSERT_EQ(2, info->endpoints().size());
+  }
+  // Clients share the pool's connections
+  ASSERT_EQ(2, pool.num_connections());
+
+  // Streams of different clients may be read concurrently
+  std::vector<std::unique_ptr<FlightStreamReader>> streams(clients.size());
+  for (size_t i = 0; i < clients.size(); ++i) {
+    ASSERT_OK(clients[i]->DoGet(Ticket{"ticket-ints-1"}, &streams[i]));
+  }
+  for (auto& stream : streams) {
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    ASSERT_OK(stream->ReadAll(&batches));
+    ASSERT_GT(batches.size(), 0);
+  }
+
+  pool.Evict(location);
+  ASSERT_EQ(0, pool.num_connections());
+  // Clients keep working after their connections are evicted
+  std::unique_ptr<FlightClient> client;
+  ASSERT_OK(pool.GetClient(location, &client));
+  ASSERT_EQ(1, pool.num_connections());
+  std::unique_ptr<FlightListing> listing;
+  ASSERT_OK(clients[0]->ListFlights(&listing));
+  ASSERT_OK(client->ListFlights(&listing));
+}
+
+TEST_F(TestFlightClient, ReadAllEndpoints) {
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  auto schema = batches[0]->schema();
+
+  // Endpoints without locations are read through the client itself
+  std::vector<FlightEndpoint> endpoints(3, FlightEndpoint{{"ticket-ints-1"}, {}});
+  FlightInfo::Data data;
+  ASSERT_OK(MakeFlightInfo(*schema, FlightDescriptor::Path({"examples", "ints"}),
+                           endpoints, -1, -1, &data));
+  FlightInfo info(data);
+
+  for (const bool ordered : {true, false}) {
+    auto read_options = MultiEndpointReadOptions::Defaults();
+    read_options.ordered = ordered;
+    read_options.max_parallel_streams = 2;
+    read_options.max_buffered_batches = 1;
+
+    std::shared_ptr<RecordBatchReader> reader;
+    ASSERT_OK(client_->ReadAll({}, info, read_options, &reader));
+    AssertSchemaEqual(*schema, *reader->schema());
+    BatchVector received;
+    ASSERT_OK(reader->ReadAll(&received));
+    ASSERT_EQ(batches.size() * endpoints.size(), received.size());
+    if (ordered) {
+      for (size_t i = 0; i < received.size(); ++i) {
+        ASSERT_BATCHES_EQUAL(*batches[i % batches.size()], *received[i]);
+      }
+    }
+  }
+
+  // Errors from an endpoint are surfaced to the consumer
+  endpoints.push_back(FlightEndpoint{{"unknown-ticket"}, {}});
+  ASSERT_OK(MakeFlightInfo(*schema, FlightDescriptor::Path({"examples", "ints"}),
+                           endpoints, -1, -1, &data));
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(client_->ReadAll(FlightInfo(data), &reader));
+  BatchVector received;
+  ASSERT_RAISES(NotImplemented, reader->ReadAll(&received));
+
+  // Destroying a reader before it is exhausted cancels its streams
+  ASSERT_OK(client_->ReadAll(FlightInfo(data), &reader));
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  reader.reset();
+}
+
 TEST_F(TestFlightClient, DoGetFloats) {
   auto descr = FlightDescriptor::Path({"examples", "floats"});
   BatchVector expected_batches;
@@ -2039,6 +2289,84 @@ TEST_F(TestOptions, DoExchangeServerWriteOptions) {
   ASSERT_RAISES(Invalid, writer->Close());
 }
 
+class TestAsyncDoGet : public ::testing::Test {
+ public:
+  void SetUp() {
+    const Status st = MakeServer<AsyncDoGetTestServer>(
+        &server_, &client_,
+        [](FlightServerOptions* options) {
+          options->async_do_get = true;
+          return Status::OK();
+        },
+        [](FlightClientOptions* options) { return Status::OK(); });
+    if (st.IsNotImplemented()) {
+      // The gRPC version doesn't support it
+      server_.reset();
+      return;
+    }
+    ASSERT_OK(st);
+    ASSERT_OK(ExampleIntBatches(&expected_batches_));
+  }
+
+  void TearDown() {
+    if (server_) {
+      ASSERT_OK(server_->Shutdown());
+    }
+  }
+
+ protected:
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<FlightServerBase> server_;
+  BatchVector expected_batches_;
+};
+
+TEST_F(TestAsyncDoGet, DoGet) {
+  if (!server_) return;
+  for (const std::string ticket : {"async", "sync"}) {
+    std::unique_ptr<FlightStreamReader> stream;
+    ASSERT_OK(client_->DoGet(Ticket{ticket}, &stream));
+    BatchVector batches;
+    ASSERT_OK(stream->ReadAll(&batches));
+    ASSERT_EQ(expected_batches_.size(), batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      ASSERT_BATCHES_EQUAL(*expected_batches_[i], *batches[i]);
+    }
+  }
+}
+
+TEST_F(TestAsyncDoGet, Error) {
+  if (!server_) return;
+  std::unique_ptr<FlightStreamReader> stream;
+  ASSERT_OK(client_->DoGet(Ticket{"error"}, &stream));
+  BatchVector batches;
+  const Status st = stream->ReadAll(&batches);
+  ASSERT_RAISES(IOError, st);
+  ASSERT_THAT(st.message(), ::testing::HasSubstr("Lost the data"));
+}
+
+TEST_F(TestAsyncDoGet, ConcurrentStreams) {
+  if (!server_) return;
+  // More streams than threads in the gRPC and CPU thread pools
+  const int num_streams = 64;
+  std::vector<std::unique_ptr<FlightStreamReader>> streams(num_streams);
+  for (auto& stream : streams) {
+    ASSERT_OK(client_->DoGet(Ticket{"async"}, &stream));
+  }
+  // Interleave reads across streams
+  FlightStreamChunk chunk;
+  for (const auto& expected_batch : expected_batches_) {
+    for (auto& stream : streams) {
+      ASSERT_OK(stream->Next(&chunk));
+      ASSERT_NE(nullptr, chunk.data);
+      ASSERT_BATCHES_EQUAL(*expected_batch, *chunk.data);
+    }
+  }
+  for (auto& stream : streams) {
+    ASSERT_OK(stream->Next(&chunk));
+    ASSERT_EQ(nullptr, chunk.data);
+  }
+}
+
 TEST_F(TestRejectServerMiddleware, Rejected) {
   std::unique_ptr<FlightInfo> info;
   const auto& status = client_->GetFlightInfo(FlightDescriptor{}, &info);
@@ -2069,6 +2397,28 @@ TEST_F(TestCountingServerMiddleware, Count) {
   ASSERT_EQ(1, request_counter_->failed_);
 }
 
+TEST_F(TestCountingServerMiddleware, StreamMetrics) {
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+
+  std::unique_ptr<FlightStreamReader> stream;
+  ASSERT_OK(client_->DoGet(Ticket{""}, &stream));
+  BatchVector received;
+  ASSERT_OK(stream->ReadAll(&received));
+  ASSERT_EQ(batches.size(), received.size());
+
+  // The schema, then one message per batch
+  ASSERT_EQ(static_cast<int64_t>(batches.size()) + 1, request_counter_->messages_sent_);
+  int64_t body_bytes = 0;
+  for (const auto& batch : batches) {
+    ipc::IpcPayload payload;
+    ASSERT_OK(ipc::GetRecordBatchPayload(*batch, ipc::IpcWriteOptions::Defaults(),
+                                         &payload));
+    body_bytes += payload.body_length;
+  }
+  ASSERT_GT(request_counter_->bytes_sent_, body_bytes);
+}
+
 TEST_F(TestPropagatingMiddleware, Propagate) {
   Action action;
   std::unique_ptr<ResultStream> stream;
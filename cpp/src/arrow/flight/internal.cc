@@ -17,12 +17,14 @@
 
 #include "arrow/flight/internal.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <map>
 #include <memory>
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/flight/platform.h"
 #include "arrow/flight/protocol_internal.h"
@@ -41,6 +43,7 @@
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/string.h"
 #include "arrow/util/string_builder.h"
 
 namespace arrow {
@@ -48,6 +51,7 @@ namespace flight {
 namespace internal {
 
 const char* kGrpcAuthHeader = "auth-token-bin";
+const char* kGrpcAcceptCompressionHeader = "x-arrow-accept-compression";
 const char* kGrpcStatusCodeHeader = "x-arrow-status";
 const char* kGrpcStatusMessageHeader = "x-arrow-status-message-bin";
 const char* kGrpcStatusDetailHeader = "x-arrow-status-detail-bin";
@@ -64,6 +68,7 @@ static Status StatusCodeFromString(const grpc::string_ref& code_ref, StatusCode*
     case static_cast<int>(StatusCode::IOError):
     case static_cast<int>(StatusCode::CapacityError):
     case static_cast<int>(StatusCode::IndexError):
+    case static_cast<int>(StatusCode::Cancelled):
     case static_cast<int>(StatusCode::UnknownError):
     case static_cast<int>(StatusCode::NotImplemented):
     case static_cast<int>(StatusCode::SerializationError):
@@ -198,6 +203,39 @@ static Status FromGrpcCode(const grpc::Status& grpc_status) {
   }
 }
 
+std::string FormatAcceptedCompression(const std::vector<Compression::type>& codecs) {
+  std::stringstream header;
+  for (size_t i = 0; i < codecs.size(); ++i) {
+    if (i > 0) {
+      header << ",";
+    }
+    header << util::Codec::GetCodecAsString(codecs[i]);
+  }
+  return header.str();
+}
+
+Compression::type NegotiateCompression(const std::string& accepted,
+                                       const std::vector<Compression::type>& preferred) {
+  std::vector<Compression::type> accepted_codecs;
+  std::stringstream header(accepted);
+  std::string name;
+  while (std::getline(header, name, ',')) {
+    auto maybe_codec =
+        util::Codec::GetCompressionType(::arrow::internal::TrimString(name));
+    if (maybe_codec.ok()) {
+      accepted_codecs.push_back(*maybe_codec);
+    }
+  }
+  for (const auto codec : preferred) {
+    if (codec != Compression::UNCOMPRESSED && util::Codec::IsAvailable(codec) &&
+        std::find(accepted_codecs.begin(), accepted_codecs.end(), codec) !=
+            accepted_codecs.end()) {
+      return codec;
+    }
+  }
+  return Compression::UNCOMPRESSED;
+}
+
 Status FromGrpcStatus(const grpc::Status& grpc_status, grpc::ClientContext* ctx) {
   const Status status = FromGrpcCode(grpc_status);
 
@@ -268,7 +306,7 @@ static grpc::Status ToRawGrpcStatus(const Status& arrow_status) {
 
 /// Convert an Arrow status to a gRPC status, and add extra headers to
 /// the response to encode the original Arrow status.
-grpc::Status ToGrpcStatus(const Status& arrow_status, grpc::ServerContext* ctx) {
+grpc::Status ToGrpcStatus(const Status& arrow_status, ServerContextBase* ctx) {
   grpc::Status status = ToRawGrpcStatus(arrow_status);
   if (!status.ok() && ctx) {
     const std::string code = std::to_string(static_cast<int>(arrow_status.code()));
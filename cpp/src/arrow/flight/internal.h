@@ -19,9 +19,11 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/flight/protocol_internal.h"  // IWYU pragma: keep
 #include "arrow/flight/types.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/macros.h"
 
 namespace grpc {
@@ -63,10 +65,22 @@ namespace flight {
 
 namespace internal {
 
+#ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+/// The common base of the synchronous and callback API server contexts.
+using ServerContextBase = grpc::ServerContextBase;
+#else
+using ServerContextBase = grpc::ServerContext;
+#endif
+
 /// The name of the header used to pass authentication tokens.
 ARROW_FLIGHT_EXPORT
 extern const char* kGrpcAuthHeader;
 
+/// The name of the header used by clients to advertise the IPC body
+/// compression codecs they accept.
+ARROW_FLIGHT_EXPORT
+extern const char* kGrpcAcceptCompressionHeader;
+
 /// The name of the header used to pass the exact Arrow status code.
 ARROW_FLIGHT_EXPORT
 extern const char* kGrpcStatusCodeHeader;
@@ -85,6 +99,26 @@ extern const char* kBinaryErrorDetailsKey;
 ARROW_FLIGHT_EXPORT
 Status SchemaToString(const Schema& schema, std::string* out);
 
+/// Format a list of compression codecs as a header value.
+ARROW_FLIGHT_EXPORT
+std::string FormatAcceptedCompression(const std::vector<Compression::type>& codecs);
+
+/// Pick the first of the server's preferred codecs which is available and
+/// was accepted by the client, or UNCOMPRESSED. Unknown codec names sent
+/// by the client are ignored.
+ARROW_FLIGHT_EXPORT
+Compression::type NegotiateCompression(const std::string& accepted,
+                                       const std::vector<Compression::type>& preferred);
+
+/// Open a channel to the server listening in this process under the given
+/// name (see kSchemeGrpcInProcess).
+ARROW_FLIGHT_EXPORT
+Status MakeInProcessChannel(
+    const std::string& name, const grpc::ChannelArguments& args,
+    std::vector<std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>>
+        interceptors,
+    std::shared_ptr<grpc::Channel>* out);
+
 /// Convert a gRPC status to an Arrow status. Optionally, provide a
 /// ClientContext to recover the exact Arrow status if it was passed
 /// over the wire.
@@ -93,7 +127,8 @@ Status FromGrpcStatus(const grpc::Status& grpc_status,
                       grpc::ClientContext* ctx = nullptr);
 
 ARROW_FLIGHT_EXPORT
-grpc::Status ToGrpcStatus(const Status& arrow_status, grpc::ServerContext* ctx = nullptr);
+grpc::Status ToGrpcStatus(const Status& arrow_status,
+                          ServerContextBase* ctx = nullptr);
 
 // These functions depend on protobuf types which are not exported in the Flight DLL.
 
@@ -17,7 +17,9 @@
 
 #include "arrow/flight/serialization_internal.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <string>
 #include <vector>
@@ -65,24 +67,11 @@ using arrow::ipc::IpcPayload;
 
 using google::protobuf::internal::WireFormatLite;
 using google::protobuf::io::ArrayOutputStream;
-using google::protobuf::io::CodedInputStream;
 using google::protobuf::io::CodedOutputStream;
 
 using grpc::ByteBuffer;
 
-bool ReadBytesZeroCopy(const std::shared_ptr<Buffer>& source_data,
-                       CodedInputStream* input, std::shared_ptr<Buffer>* out) {
-  uint32_t length;
-  if (!input->ReadVarint32(&length)) {
-    return false;
-  }
-  auto buf =
-      SliceBuffer(source_data, input->CurrentPosition(), static_cast<int64_t>(length));
-  *out = buf;
-  return input->Skip(static_cast<int>(length));
-}
-
-// Internal wrapper for gRPC ByteBuffer so its memory can be exposed to Arrow
+// Internal wrapper for a gRPC slice so its memory can be exposed to Arrow
 // consumers with zero-copy
 class GrpcBuffer : public MutableBuffer {
  public:
@@ -96,52 +85,104 @@ class GrpcBuffer : public MutableBuffer {
     grpc_slice_unref(slice_);
   }
 
-  static Status Wrap(ByteBuffer* cpp_buf, std::shared_ptr<Buffer>* out) {
-    // These types are guaranteed by static assertions in gRPC to have the same
-    // in-memory representation
-
-    auto buffer = *reinterpret_cast<grpc_byte_buffer**>(cpp_buf);
+ private:
+  grpc_slice slice_;
+};
 
-    // This part below is based on the Flatbuffers gRPC SerializationTraits in
-    // flatbuffers/grpc.h
+// Reads protobuf-encoded data from the slices of a gRPC byte buffer.
+//
+// gRPC usually receives a large message as several slices. Rather than
+// concatenating them, length-delimited fields which lie within a single slice
+// are exposed zero-copy by referencing the slice. Only fields spanning several
+// slices are copied, into a buffer of their own.
+class SliceReader {
+ public:
+  explicit SliceReader(const grpc_slice_buffer& slices) : slices_(slices) {}
 
-    // Check if this is a single uncompressed slice.
-    if ((buffer->type == GRPC_BB_RAW) &&
-        (buffer->data.raw.compression == GRPC_COMPRESS_NONE) &&
-        (buffer->data.raw.slice_buffer.count == 1)) {
-      // If it is, then we can reference the `grpc_slice` directly.
-      grpc_slice slice = buffer->data.raw.slice_buffer.slices[0];
+  bool AtEnd() {
+    SkipExhaustedSlices();
+    return slice_index_ == slices_.count;
+  }
 
-      if (slice.refcount) {
-        // Increment reference count so this memory remains valid
-        *out = std::make_shared<GrpcBuffer>(slice, true);
-      } else {
-        // Small slices (less than GRPC_SLICE_INLINED_SIZE bytes) are
-        // inlined into the structure and must be copied.
-        const uint8_t length = slice.data.inlined.length;
-        ARROW_ASSIGN_OR_RAISE(*out, arrow::AllocateBuffer(length));
-        std::memcpy((*out)->mutable_data(), slice.data.inlined.bytes, length);
+  bool ReadVarint32(uint32_t* out) {
+    uint32_t result = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+      SkipExhaustedSlices();
+      if (slice_index_ == slices_.count) {
+        return false;
       }
-    } else {
-      // Otherwise, we need to use `grpc_byte_buffer_reader_readall` to read
-      // `buffer` into a single contiguous `grpc_slice`. The gRPC reader gives
-      // us back a new slice with the refcount already incremented.
-      grpc_byte_buffer_reader reader;
-      if (!grpc_byte_buffer_reader_init(&reader, buffer)) {
-        return Status::IOError("Internal gRPC error reading from ByteBuffer");
+      const uint8_t byte = current_data()[slice_offset_++];
+      result |= static_cast<uint32_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) {
+        *out = result;
+        return true;
       }
-      grpc_slice slice = grpc_byte_buffer_reader_readall(&reader);
-      grpc_byte_buffer_reader_destroy(&reader);
+    }
+    return false;
+  }
 
-      // Steal the slice reference
-      *out = std::make_shared<GrpcBuffer>(slice, false);
+  // Read a length-prefixed field
+  Status ReadBytes(std::shared_ptr<Buffer>* out) {
+    uint32_t length;
+    if (!ReadVarint32(&length)) {
+      return Status::IOError("Unable to read field length");
+    }
+    SkipExhaustedSlices();
+    if (slice_index_ < slices_.count && length <= current_length() - slice_offset_ &&
+        slices_.slices[slice_index_].refcount != nullptr) {
+      if (wrapped_index_ != slice_index_ || wrapped_slice_ == nullptr) {
+        // Increment reference count so this memory remains valid
+        wrapped_slice_ = std::make_shared<GrpcBuffer>(slices_.slices[slice_index_],
+                                                      /*incref=*/true);
+        wrapped_index_ = slice_index_;
+      }
+      *out = SliceBuffer(wrapped_slice_, static_cast<int64_t>(slice_offset_),
+                         static_cast<int64_t>(length));
+      slice_offset_ += length;
+      return Status::OK();
     }
 
+    // Small slices (less than GRPC_SLICE_INLINED_SIZE bytes) are inlined into
+    // the slice structure and must be copied as well
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer, AllocateBuffer(length));
+    uint8_t* dest = buffer->mutable_data();
+    size_t remaining = length;
+    while (remaining > 0) {
+      SkipExhaustedSlices();
+      if (slice_index_ == slices_.count) {
+        return Status::IOError("Field of length ", length, " truncated");
+      }
+      const size_t chunk = std::min(remaining, current_length() - slice_offset_);
+      std::memcpy(dest, current_data() + slice_offset_, chunk);
+      dest += chunk;
+      remaining -= chunk;
+      slice_offset_ += chunk;
+    }
+    *out = std::move(buffer);
     return Status::OK();
   }
 
  private:
-  grpc_slice slice_;
+  const uint8_t* current_data() const {
+    return GRPC_SLICE_START_PTR(slices_.slices[slice_index_]);
+  }
+  size_t current_length() const {
+    return GRPC_SLICE_LENGTH(slices_.slices[slice_index_]);
+  }
+
+  void SkipExhaustedSlices() {
+    while (slice_index_ < slices_.count && slice_offset_ == current_length()) {
+      ++slice_index_;
+      slice_offset_ = 0;
+    }
+  }
+
+  const grpc_slice_buffer& slices_;
+  size_t slice_index_ = 0;
+  size_t slice_offset_ = 0;
+  // The slice referenced by the last zero-copy field
+  std::shared_ptr<Buffer> wrapped_slice_;
+  size_t wrapped_index_ = 0;
 };
 
 // Destructor callback for grpc::Slice
@@ -281,15 +322,17 @@ grpc::Status FlightDataSerialize(const FlightPayload& msg, ByteBuffer* out,
       for (const auto& buffer : ipc_msg.body_buffers) {
         // Buffer may be null when the row length is zero, or when all
         // entries are invalid.
-        if (!buffer) continue;
+        if (!buffer || buffer->size() == 0) continue;
 
         slices.push_back(SliceFromBuffer(buffer));
 
-        // Write padding if not multiple of 8
-        const auto remainder = static_cast<int>(
+        // Write padding if not multiple of 8, referencing the static padding
+        // bytes rather than copying them
+        const auto remainder = static_cast<size_t>(
             BitUtil::RoundUpToMultipleOf8(buffer->size()) - buffer->size());
         if (remainder) {
-          slices.push_back(grpc::Slice(kPaddingBytes, remainder));
+          slices.push_back(
+              grpc::Slice(kPaddingBytes, remainder, grpc::Slice::STATIC_SLICE));
         }
       }
     }
@@ -303,44 +346,37 @@ grpc::Status FlightDataSerialize(const FlightPayload& msg, ByteBuffer* out,
   return grpc::Status::OK;
 }
 
-// Read internal::FlightData from grpc::ByteBuffer containing FlightData
-// protobuf without copying
-grpc::Status FlightDataDeserialize(ByteBuffer* buffer, FlightData* out) {
-  if (!buffer) {
-    return grpc::Status(grpc::StatusCode::INTERNAL, "No payload");
-  }
-
-  // Reset fields in case the caller reuses a single allocation
-  out->descriptor = nullptr;
-  out->app_metadata = nullptr;
-  out->metadata = nullptr;
-  out->body = nullptr;
-
-  std::shared_ptr<arrow::Buffer> wrapped_buffer;
-  GRPC_RETURN_NOT_OK(GrpcBuffer::Wrap(buffer, &wrapped_buffer));
+namespace {
 
-  auto buffer_length = static_cast<int>(wrapped_buffer->size());
-  CodedInputStream pb_stream(wrapped_buffer->data(), buffer_length);
-
-  pb_stream.SetTotalBytesLimit(buffer_length);
+grpc::Status ReadFlightData(const grpc_slice_buffer& slices, FlightData* out) {
+  SliceReader reader(slices);
+  auto ReadField = [&reader](const char* name, std::shared_ptr<Buffer>* field) {
+    Status st = reader.ReadBytes(field);
+    if (!st.ok()) {
+      return grpc::Status(grpc::StatusCode::INTERNAL,
+                          std::string("Unable to read FlightData ") + name + ": " +
+                              st.message());
+    }
+    return grpc::Status::OK;
+  };
 
-  // This is the bytes remaining when using CodedInputStream like this
-  while (pb_stream.BytesUntilTotalBytesLimit()) {
-    const uint32_t tag = pb_stream.ReadTag();
-    const int field_number = WireFormatLite::GetTagFieldNumber(tag);
-    switch (field_number) {
+  while (!reader.AtEnd()) {
+    uint32_t tag;
+    if (!reader.ReadVarint32(&tag)) {
+      return grpc::Status(grpc::StatusCode::INTERNAL, "Unable to read FlightData tag");
+    }
+    if (WireFormatLite::GetTagWireType(tag) !=
+        WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+      return grpc::Status(grpc::StatusCode::INTERNAL,
+                          "Unexpected wire type in FlightData");
+    }
+    switch (WireFormatLite::GetTagFieldNumber(tag)) {
       case pb::FlightData::kFlightDescriptorFieldNumber: {
+        std::shared_ptr<Buffer> buffer;
+        GRPC_RETURN_NOT_GRPC_OK(ReadField("descriptor", &buffer));
         pb::FlightDescriptor pb_descriptor;
-        uint32_t length;
-        if (!pb_stream.ReadVarint32(&length)) {
-          return grpc::Status(grpc::StatusCode::INTERNAL,
-                              "Unable to parse length of FlightDescriptor");
-        }
-        // Can't use ParseFromCodedStream as this reads the entire
-        // rest of the stream into the descriptor command field.
-        std::string buffer;
-        pb_stream.ReadString(&buffer, length);
-        if (!pb_descriptor.ParseFromString(buffer)) {
+        if (!pb_descriptor.ParseFromArray(buffer->data(),
+                                          static_cast<int>(buffer->size()))) {
           return grpc::Status(grpc::StatusCode::INTERNAL,
                               "Unable to parse FlightDescriptor");
         }
@@ -349,34 +385,75 @@ grpc::Status FlightDataDeserialize(ByteBuffer* buffer, FlightData* out) {
             arrow::flight::internal::FromProto(pb_descriptor, &descriptor));
         out->descriptor.reset(new arrow::flight::FlightDescriptor(descriptor));
       } break;
-      case pb::FlightData::kDataHeaderFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->metadata)) {
-          return grpc::Status(grpc::StatusCode::INTERNAL,
-                              "Unable to read FlightData metadata");
-        }
+      case pb::FlightData::kDataHeaderFieldNumber:
+        GRPC_RETURN_NOT_GRPC_OK(ReadField("metadata", &out->metadata));
+        break;
+      case pb::FlightData::kAppMetadataFieldNumber:
+        GRPC_RETURN_NOT_GRPC_OK(ReadField("application metadata", &out->app_metadata));
+        break;
+      case pb::FlightData::kDataBodyFieldNumber:
+        GRPC_RETURN_NOT_GRPC_OK(ReadField("body", &out->body));
+        break;
+      default: {
+        // Skip unknown fields, for forward compatibility
+        std::shared_ptr<Buffer> unused;
+        GRPC_RETURN_NOT_GRPC_OK(ReadField("field", &unused));
       } break;
-      case pb::FlightData::kAppMetadataFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->app_metadata)) {
-          return grpc::Status(grpc::StatusCode::INTERNAL,
-                              "Unable to read FlightData application metadata");
-        }
-      } break;
-      case pb::FlightData::kDataBodyFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->body)) {
-          return grpc::Status(grpc::StatusCode::INTERNAL,
-                              "Unable to read FlightData body");
-        }
-      } break;
-      default:
-        DCHECK(false) << "cannot happen";
     }
   }
+  return grpc::Status::OK;
+}
+
+}  // namespace
+
+// Read internal::FlightData from grpc::ByteBuffer containing FlightData
+// protobuf without copying
+grpc::Status FlightDataDeserialize(ByteBuffer* buffer, FlightData* out) {
+  if (!buffer) {
+    return grpc::Status(grpc::StatusCode::INTERNAL, "No payload");
+  }
+
+  // Reset fields in case the caller reuses a single allocation
+  out->descriptor = nullptr;
+  out->app_metadata = nullptr;
+  out->metadata = nullptr;
+  out->body = nullptr;
+
+  // These types are guaranteed by static assertions in gRPC to have the same
+  // in-memory representation
+  auto raw_buffer = *reinterpret_cast<grpc_byte_buffer**>(buffer);
+
+  grpc::Status status;
+  if (raw_buffer->type == GRPC_BB_RAW &&
+      raw_buffer->data.raw.compression == GRPC_COMPRESS_NONE) {
+    // Read the fields right from the received slices
+    status = ReadFlightData(raw_buffer->data.raw.slice_buffer, out);
+  } else {
+    // Otherwise, we need to use `grpc_byte_buffer_reader_readall` to read
+    // `buffer` into a single contiguous `grpc_slice`. The gRPC reader gives
+    // us back a new slice with the refcount already incremented.
+    grpc_byte_buffer_reader reader;
+    if (!grpc_byte_buffer_reader_init(&reader, raw_buffer)) {
+      return grpc::Status(grpc::StatusCode::INTERNAL,
+                          "Internal gRPC error reading from ByteBuffer");
+    }
+    grpc_slice slice = grpc_byte_buffer_reader_readall(&reader);
+    grpc_byte_buffer_reader_destroy(&reader);
+
+    grpc_slice_buffer slices;
+    grpc_slice_buffer_init(&slices);
+    // Steal the slice reference
+    grpc_slice_buffer_add(&slices, slice);
+    status = ReadFlightData(slices, out);
+    grpc_slice_buffer_destroy(&slices);
+  }
+  // The fields hold their own references to the slices
   buffer->Clear();
 
   // TODO(wesm): Where and when should we verify that the FlightData is not
   // malformed or missing components?
 
-  return grpc::Status::OK;
+  return status;
 }
 
 ::arrow::Result<std::unique_ptr<ipc::Message>> FlightData::OpenMessage() {
@@ -20,9 +20,13 @@
 
 #include "arrow/flight/server.h"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -56,6 +60,7 @@
 
 using FlightService = arrow::flight::protocol::FlightService;
 using ServerContext = grpc::ServerContext;
+using ServerContextBase = arrow::flight::internal::ServerContextBase;
 
 template <typename T>
 using ServerWriter = grpc::ServerWriter<T>;
@@ -272,13 +277,38 @@ class GrpcServerAuthSender : public ServerAuthSender {
   grpc::ServerReaderWriter<pb::HandshakeResponse, pb::HandshakeRequest>* stream_;
 };
 
+using MetricsClock = std::chrono::steady_clock;
+
+// Write a payload, recording its size and the time it took in the metrics
+template <typename Writer>
+bool WritePayloadWithMetrics(const FlightPayload& payload, Writer* writer,
+                             ServerStreamMetrics* metrics) {
+  const auto start = MetricsClock::now();
+  const bool written = internal::WritePayload(payload, writer);
+  metrics->write_time += MetricsClock::now() - start;
+  if (written) {
+    ++metrics->messages_sent;
+    metrics->bytes_sent += payload.ipc_message.body_length;
+    if (payload.ipc_message.metadata) {
+      metrics->bytes_sent += payload.ipc_message.metadata->size();
+    }
+    if (payload.app_metadata) {
+      metrics->bytes_sent += payload.app_metadata->size();
+    }
+  }
+  return written;
+}
+
 /// The implementation of the write side of a bidirectional FlightData
 /// stream for DoExchange.
 class DoExchangeMessageWriter : public FlightMessageWriter {
  public:
-  explicit DoExchangeMessageWriter(
-      grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* stream)
-      : stream_(stream), ipc_options_(::arrow::ipc::IpcWriteOptions::Defaults()) {}
+  DoExchangeMessageWriter(
+      grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* stream,
+      ServerStreamMetrics* metrics)
+      : stream_(stream),
+        metrics_(metrics),
+        ipc_options_(::arrow::ipc::IpcWriteOptions::Defaults()) {}
 
   Status Begin(const std::shared_ptr<Schema>& schema,
                const ipc::IpcWriteOptions& options) override {
@@ -324,7 +354,7 @@ class DoExchangeMessageWriter : public FlightMessageWriter {
 
  private:
   Status WritePayload(const FlightPayload& payload) {
-    if (!internal::WritePayload(payload, stream_)) {
+    if (!WritePayloadWithMetrics(payload, stream_, metrics_)) {
       // gRPC doesn't give us any way to find what the error was (if any).
       return Status::IOError("Could not write payload to stream");
     }
@@ -355,6 +385,7 @@ class DoExchangeMessageWriter : public FlightMessageWriter {
   }
 
   grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* stream_;
+  ServerStreamMetrics* metrics_;
   ::arrow::ipc::IpcWriteOptions ipc_options_;
   ipc::DictionaryFieldMapper mapper_;
   bool started_ = false;
@@ -363,11 +394,12 @@ class DoExchangeMessageWriter : public FlightMessageWriter {
 
 class FlightServiceImpl;
 class GrpcServerCallContext : public ServerCallContext {
-  explicit GrpcServerCallContext(grpc::ServerContext* context)
+  explicit GrpcServerCallContext(ServerContextBase* context)
       : context_(context), peer_(context_->peer()) {}
 
   const std::string& peer_identity() const override { return peer_identity_; }
   const std::string& peer() const override { return peer_; }
+  Compression::type compression() const override { return compression_; }
 
   // Helper method that runs interceptors given the result of an RPC,
   // then returns the final gRPC status to send to the client
@@ -379,6 +411,9 @@ class GrpcServerCallContext : public ServerCallContext {
 
   grpc::Status FinishRequest(const arrow::Status& status) {
     for (const auto& instance : middleware_) {
+      if (is_data_stream_) {
+        instance->StreamCompleted(stream_metrics_);
+      }
       instance->CallCompleted(status);
     }
 
@@ -397,16 +432,21 @@ class GrpcServerCallContext : public ServerCallContext {
 
  private:
   friend class FlightServiceImpl;
-  ServerContext* context_;
+  friend class DoGetReactor;
+  ServerContextBase* context_;
   std::string peer_;
   std::string peer_identity_;
+  Compression::type compression_ = Compression::UNCOMPRESSED;
+  // Whether the call sends Flight data, and the statistics about it
+  bool is_data_stream_ = false;
+  ServerStreamMetrics stream_metrics_;
   std::vector<std::shared_ptr<ServerMiddleware>> middleware_;
   std::unordered_map<std::string, std::shared_ptr<ServerMiddleware>> middleware_map_;
 };
 
 class GrpcAddCallHeaders : public AddCallHeaders {
  public:
-  explicit GrpcAddCallHeaders(grpc::ServerContext* context) : context_(context) {}
+  explicit GrpcAddCallHeaders(ServerContextBase* context) : context_(context) {}
   ~GrpcAddCallHeaders() override = default;
 
   void AddHeader(const std::string& key, const std::string& value) override {
@@ -414,8 +454,100 @@ class GrpcAddCallHeaders : public AddCallHeaders {
   }
 
  private:
-  grpc::ServerContext* context_;
+  ServerContextBase* context_;
+};
+
+#ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+#define ARROW_FLIGHT_ASYNC_DO_GET
+
+/// Serves a DoGet call with the gRPC callback API.  No thread is held while
+/// waiting for the data stream to produce a payload or for the transport to
+/// accept it.  The reactor deletes itself once the call is done.
+class DoGetReactor : public grpc::ServerWriteReactor<pb::FlightData> {
+ public:
+  explicit DoGetReactor(grpc::CallbackServerContext* context)
+      : flight_context_(context) {}
+
+  GrpcServerCallContext& flight_context() { return flight_context_; }
+
+  /// Fail the call with the given status (middleware has already been run)
+  void Fail(const grpc::Status& status) { Finish(status); }
+
+  /// Start sending the given stream
+  void Start(std::unique_ptr<FlightDataStream> data_stream) {
+    data_stream_ = std::move(data_stream);
+    flight_context_.is_data_stream_ = true;
+
+    // Write the schema as the first message in the stream
+    const Status st = data_stream_->GetSchemaPayload(&payload_);
+    if (!st.ok()) {
+      FinishWithStatus(st);
+      return;
+    }
+    StartPayloadWrite();
+  }
+
+  void OnWriteDone(bool ok) override {
+    ServerStreamMetrics* metrics = &flight_context_.stream_metrics_;
+    metrics->write_time += MetricsClock::now() - write_start_;
+    if (!ok) {
+      // The connection was terminated.  As with the synchronous API, gRPC
+      // doesn't give any way for us to know why.
+      FinishWithStatus(Status::OK());
+      return;
+    }
+    ++metrics->messages_sent;
+    metrics->bytes_sent += payload_.ipc_message.body_length;
+    if (payload_.ipc_message.metadata) {
+      metrics->bytes_sent += payload_.ipc_message.metadata->size();
+    }
+    if (payload_.app_metadata) {
+      metrics->bytes_sent += payload_.app_metadata->size();
+    }
+    RequestNextPayload();
+  }
+
+  void OnDone() override { delete this; }
+
+ private:
+  void RequestNextPayload() {
+    const auto start = MetricsClock::now();
+    data_stream_->NextAsync().AddCallback(
+        [this, start](const arrow::Result<FlightPayload>& maybe_payload) {
+          flight_context_.stream_metrics_.produce_time += MetricsClock::now() - start;
+          if (!maybe_payload.ok()) {
+            FinishWithStatus(maybe_payload.status());
+            return;
+          }
+          payload_ = *maybe_payload;
+          if (payload_.ipc_message.metadata == nullptr) {
+            // No more messages to write
+            FinishWithStatus(Status::OK());
+            return;
+          }
+          StartPayloadWrite();
+        });
+  }
+
+  void StartPayloadWrite() {
+    write_start_ = MetricsClock::now();
+    // Pretend to be pb::FlightData and intercept in SerializationTraits
+    // (see internal::WritePayload()).  payload_ is kept alive until
+    // OnWriteDone().
+    StartWrite(reinterpret_cast<const pb::FlightData*>(&payload_));
+  }
+
+  // Run interceptors and end the call
+  void FinishWithStatus(const Status& status) {
+    Finish(flight_context_.FinishRequest(status));
+  }
+
+  GrpcServerCallContext flight_context_;
+  std::unique_ptr<FlightDataStream> data_stream_;
+  FlightPayload payload_;
+  MetricsClock::time_point write_start_;
 };
+#endif
 
 // This class glues an implementation of FlightServerBase together with the
 // gRPC service definition, so the latter is not exposed in the public API
@@ -425,8 +557,29 @@ class FlightServiceImpl : public FlightService::Service {
       std::shared_ptr<ServerAuthHandler> auth_handler,
       std::vector<std::pair<std::string, std::shared_ptr<ServerMiddlewareFactory>>>
           middleware,
-      FlightServerBase* server)
-      : auth_handler_(auth_handler), middleware_(middleware), server_(server) {}
+      std::vector<Compression::type> compression, FlightServerBase* server)
+      : auth_handler_(auth_handler),
+        middleware_(middleware),
+        compression_(std::move(compression)),
+        server_(server) {}
+
+  // Serve DoGet with the gRPC callback API rather than the synchronous one
+  Status EnableAsyncDoGet() {
+#ifdef ARROW_FLIGHT_ASYNC_DO_GET
+    // This is what the FlightService::WithCallbackMethod_DoGet<> generated
+    // class does, but the latter can't be chosen at runtime.
+    MarkMethodCallback(
+        kDoGetMethodIndex,
+        new grpc::internal::CallbackServerStreamingHandler<pb::Ticket, pb::FlightData>(
+            [this](grpc::CallbackServerContext* context, const pb::Ticket* request) {
+              return DoGetAsync(context, request);
+            }));
+    return Status::OK();
+#else
+    return Status::NotImplemented(
+        "Asynchronous DoGet requires a gRPC version with the callback API");
+#endif
+  }
 
   template <typename UserType, typename Iterator, typename ProtoType>
   grpc::Status WriteStream(Iterator* iterator, ServerWriter<ProtoType>* writer) {
@@ -469,7 +622,7 @@ class FlightServiceImpl : public FlightService::Service {
   }
 
   // Authenticate the client (if applicable) and construct the call context
-  grpc::Status CheckAuth(const FlightMethod& method, ServerContext* context,
+  grpc::Status CheckAuth(const FlightMethod& method, ServerContextBase* context,
                          GrpcServerCallContext& flight_context) {
     if (!auth_handler_) {
       flight_context.peer_identity_ = "";
@@ -489,7 +642,7 @@ class FlightServiceImpl : public FlightService::Service {
   }
 
   // Authenticate the client (if applicable) and construct the call context
-  grpc::Status MakeCallContext(const FlightMethod& method, ServerContext* context,
+  grpc::Status MakeCallContext(const FlightMethod& method, ServerContextBase* context,
                                GrpcServerCallContext& flight_context) {
     // Run server middleware
     const CallInfo info{method};
@@ -500,6 +653,15 @@ class FlightServiceImpl : public FlightService::Service {
            util::string_view(entry.second.data(), entry.second.length())});
     }
 
+    if (!compression_.empty()) {
+      const auto accepted =
+          incoming_headers.find(internal::kGrpcAcceptCompressionHeader);
+      if (accepted != incoming_headers.end()) {
+        flight_context.compression_ =
+            internal::NegotiateCompression(accepted->second.to_string(), compression_);
+      }
+    }
+
     GrpcAddCallHeaders outgoing_headers(context);
     for (const auto& factory : middleware_) {
       std::shared_ptr<ServerMiddleware> instance;
@@ -611,9 +773,11 @@ class FlightServiceImpl : public FlightService::Service {
     RETURN_WITH_MIDDLEWARE(flight_context, grpc::Status::OK);
   }
 
-  grpc::Status DoGet(ServerContext* context, const pb::Ticket* request,
-                     ServerWriter<pb::FlightData>* writer) {
-    GrpcServerCallContext flight_context(context);
+  // Authenticate the client and get the data stream for a DoGet call.
+  // Middleware has already been run if an error is returned.
+  grpc::Status GetDataStream(ServerContextBase* context, const pb::Ticket* request,
+                             GrpcServerCallContext& flight_context,
+                             std::unique_ptr<FlightDataStream>* data_stream) {
     GRPC_RETURN_NOT_GRPC_OK(CheckAuth(FlightMethod::DoGet, context, flight_context));
 
     CHECK_ARG_NOT_NULL(flight_context, request, "ticket cannot be null");
@@ -621,19 +785,30 @@ class FlightServiceImpl : public FlightService::Service {
     Ticket ticket;
     SERVICE_RETURN_NOT_OK(flight_context, internal::FromProto(*request, &ticket));
 
-    std::unique_ptr<FlightDataStream> data_stream;
     SERVICE_RETURN_NOT_OK(flight_context,
-                          server_->DoGet(flight_context, ticket, &data_stream));
+                          server_->DoGet(flight_context, ticket, data_stream));
 
-    if (!data_stream) {
+    if (!*data_stream) {
       RETURN_WITH_MIDDLEWARE(flight_context, grpc::Status(grpc::StatusCode::NOT_FOUND,
                                                           "No data in this flight"));
     }
+    return grpc::Status::OK;
+  }
+
+  grpc::Status DoGet(ServerContext* context, const pb::Ticket* request,
+                     ServerWriter<pb::FlightData>* writer) {
+    GrpcServerCallContext flight_context(context);
+    std::unique_ptr<FlightDataStream> data_stream;
+    GRPC_RETURN_NOT_GRPC_OK(
+        GetDataStream(context, request, flight_context, &data_stream));
+
+    flight_context.is_data_stream_ = true;
+    ServerStreamMetrics* metrics = &flight_context.stream_metrics_;
 
     // Write the schema as the first message in the stream
     FlightPayload schema_payload;
     SERVICE_RETURN_NOT_OK(flight_context, data_stream->GetSchemaPayload(&schema_payload));
-    if (!internal::WritePayload(schema_payload, writer)) {
+    if (!WritePayloadWithMetrics(schema_payload, writer, metrics)) {
       // gRPC doesn't give any way for us to know why the message
       // could not be written.
       RETURN_WITH_MIDDLEWARE(flight_context, grpc::Status::OK);
@@ -642,9 +817,12 @@ class FlightServiceImpl : public FlightService::Service {
     // Consume data stream and write out payloads
     while (true) {
       FlightPayload payload;
-      SERVICE_RETURN_NOT_OK(flight_context, data_stream->Next(&payload));
+      const auto start = MetricsClock::now();
+      const Status st = data_stream->Next(&payload);
+      metrics->produce_time += MetricsClock::now() - start;
+      SERVICE_RETURN_NOT_OK(flight_context, st);
       if (payload.ipc_message.metadata == nullptr ||
-          !internal::WritePayload(payload, writer))
+          !WritePayloadWithMetrics(payload, writer, metrics))
         // No more messages to write, or connection terminated for some other
         // reason
         break;
@@ -652,6 +830,22 @@ class FlightServiceImpl : public FlightService::Service {
     RETURN_WITH_MIDDLEWARE(flight_context, grpc::Status::OK);
   }
 
+#ifdef ARROW_FLIGHT_ASYNC_DO_GET
+  grpc::ServerWriteReactor<pb::FlightData>* DoGetAsync(
+      grpc::CallbackServerContext* context, const pb::Ticket* request) {
+    auto reactor = new DoGetReactor(context);
+    std::unique_ptr<FlightDataStream> data_stream;
+    const grpc::Status status =
+        GetDataStream(context, request, reactor->flight_context(), &data_stream);
+    if (status.ok()) {
+      reactor->Start(std::move(data_stream));
+    } else {
+      reactor->Fail(status);
+    }
+    return reactor;
+  }
+#endif
+
   grpc::Status DoPut(ServerContext* context,
                      grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader) {
     GrpcServerCallContext flight_context(context);
@@ -675,8 +869,9 @@ class FlightServiceImpl : public FlightService::Service {
     auto message_reader = std::unique_ptr<FlightMessageReaderImpl<pb::FlightData>>(
         new FlightMessageReaderImpl<pb::FlightData>(stream));
     SERVICE_RETURN_NOT_OK(flight_context, message_reader->Init());
-    auto writer =
-        std::unique_ptr<DoExchangeMessageWriter>(new DoExchangeMessageWriter(stream));
+    flight_context.is_data_stream_ = true;
+    auto writer = std::unique_ptr<DoExchangeMessageWriter>(
+        new DoExchangeMessageWriter(stream, &flight_context.stream_metrics_));
     RETURN_WITH_MIDDLEWARE(flight_context,
                            server_->DoExchange(flight_context, std::move(message_reader),
                                                std::move(writer)));
@@ -727,9 +922,13 @@ class FlightServiceImpl : public FlightService::Service {
   }
 
  private:
+  // The index of DoGet in the FlightService definition (see Flight.proto)
+  static constexpr int kDoGetMethodIndex = 4;
+
   std::shared_ptr<ServerAuthHandler> auth_handler_;
   std::vector<std::pair<std::string, std::shared_ptr<ServerMiddlewareFactory>>>
       middleware_;
+  std::vector<Compression::type> compression_;
   FlightServerBase* server_;
 };
 
@@ -748,10 +947,59 @@ FlightMetadataWriter::~FlightMetadataWriter() = default;
 using ::arrow::internal::SetSignalHandler;
 using ::arrow::internal::SignalHandler;
 
+namespace {
+
+// The servers listening in this process, by name (see kSchemeGrpcInProcess)
+std::mutex in_process_servers_mutex;
+std::unordered_map<std::string, grpc::Server*> in_process_servers;
+
+}  // namespace
+
+namespace internal {
+
+Status MakeInProcessChannel(
+    const std::string& name, const grpc::ChannelArguments& args,
+    std::vector<std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>>
+        interceptors,
+    std::shared_ptr<grpc::Channel>* out) {
+  std::lock_guard<std::mutex> lock(in_process_servers_mutex);
+  const auto it = in_process_servers.find(name);
+  if (it == in_process_servers.end()) {
+    return Status::IOError("No in-process Flight server named '", name, "'");
+  }
+  *out = it->second->experimental().InProcessChannelWithInterceptors(
+      args, std::move(interceptors));
+  return Status::OK();
+}
+
+}  // namespace internal
+
 struct FlightServerBase::Impl {
   std::unique_ptr<FlightServiceImpl> service_;
   std::unique_ptr<grpc::Server> server_;
   int port_;
+  // The name the server is registered under, if it listens in-process
+  std::string in_process_name_;
+
+  ~Impl() { UnregisterInProcess(); }
+
+  Status RegisterInProcess(const std::string& name) {
+    std::lock_guard<std::mutex> lock(in_process_servers_mutex);
+    if (!in_process_servers.emplace(name, server_.get()).second) {
+      return Status::Invalid("An in-process Flight server is already named '", name,
+                             "'");
+    }
+    in_process_name_ = name;
+    return Status::OK();
+  }
+
+  void UnregisterInProcess() {
+    if (!in_process_name_.empty()) {
+      std::lock_guard<std::mutex> lock(in_process_servers_mutex);
+      in_process_servers.erase(in_process_name_);
+      in_process_name_.clear();
+    }
+  }
 #ifdef _WIN32
   // Signal handlers are executed in a separate thread on Windows, so getting
   // the current thread instance wouldn't make sense.  This means only a single
@@ -803,7 +1051,11 @@ FlightServerBase::~FlightServerBase() {}
 
 Status FlightServerBase::Init(const FlightServerOptions& options) {
   impl_->service_.reset(
-      new FlightServiceImpl(options.auth_handler, options.middleware, this));
+      new FlightServiceImpl(options.auth_handler, options.middleware,
+                            options.compression, this));
+  if (options.async_do_get) {
+    RETURN_NOT_OK(impl_->service_->EnableAsyncDoGet());
+  }
 
   grpc::ServerBuilder builder;
   // Allow uploading messages of any length
@@ -838,6 +1090,8 @@ Status FlightServerBase::Init(const FlightServerOptions& options) {
     std::stringstream address;
     address << "unix:" << location.uri_->path();
     builder.AddListeningPort(address.str(), grpc::InsecureServerCredentials());
+  } else if (scheme == kSchemeGrpcInProcess) {
+    // No listening port: clients get a channel from the server itself
   } else {
     return Status::NotImplemented("Scheme is not supported: " + scheme);
   }
@@ -848,6 +1102,13 @@ Status FlightServerBase::Init(const FlightServerOptions& options) {
   // leftover processes can handle requests on accident
   builder.AddChannelArgument(GRPC_ARG_ALLOW_REUSEPORT, 0);
 
+  if (options.stream_write_buffer_bytes > 0) {
+    builder.AddChannelArgument(
+        GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE,
+        static_cast<int>(std::min<int64_t>(options.stream_write_buffer_bytes,
+                                           std::numeric_limits<int>::max())));
+  }
+
   if (options.builder_hook) {
     options.builder_hook(&builder);
   }
@@ -856,6 +1117,9 @@ Status FlightServerBase::Init(const FlightServerOptions& options) {
   if (!impl_->server_) {
     return Status::UnknownError("Server did not start properly");
   }
+  if (scheme == kSchemeGrpcInProcess) {
+    RETURN_NOT_OK(impl_->RegisterInProcess(location.uri_->host()));
+  }
   return Status::OK();
 }
 
@@ -902,6 +1166,7 @@ Status FlightServerBase::Shutdown() {
   if (!server) {
     return Status::Invalid("Shutdown() on uninitialized FlightServerBase");
   }
+  impl_->UnregisterInProcess();
   impl_->server_->Shutdown();
   return Status::OK();
 }
@@ -1036,6 +1301,15 @@ class RecordBatchStream::RecordBatchStreamImpl {
 
 FlightDataStream::~FlightDataStream() {}
 
+Future<FlightPayload> FlightDataStream::NextAsync() {
+  FlightPayload payload;
+  const Status st = Next(&payload);
+  if (!st.ok()) {
+    return Future<FlightPayload>::MakeFinished(st);
+  }
+  return Future<FlightPayload>::MakeFinished(std::move(payload));
+}
+
 RecordBatchStream::RecordBatchStream(const std::shared_ptr<RecordBatchReader>& reader,
                                      const ipc::IpcWriteOptions& options) {
   impl_.reset(new RecordBatchStreamImpl(reader, options));
@@ -32,6 +32,8 @@
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/options.h"
 #include "arrow/record_batch.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/future.h"
 
 namespace arrow {
 
@@ -57,6 +59,14 @@ class ARROW_FLIGHT_EXPORT FlightDataStream {
   // When the stream is completed, the last payload written will have null
   // metadata
   virtual Status Next(FlightPayload* payload) = 0;
+
+  /// \brief Asynchronous version of Next().
+  ///
+  /// Called instead of Next() by servers started with
+  /// FlightServerOptions::async_do_get, which don't hold a thread while
+  /// the returned future is pending.  The default implementation calls
+  /// Next() synchronously.
+  virtual Future<FlightPayload> NextAsync();
 };
 
 /// \brief A basic implementation of FlightDataStream that will provide
@@ -119,6 +129,12 @@ class ARROW_FLIGHT_EXPORT ServerCallContext {
   /// to the object beyond the request body.
   /// \return The middleware, or nullptr if not found.
   virtual ServerMiddleware* GetMiddleware(const std::string& key) const = 0;
+  /// \brief The IPC body compression codec negotiated with the client
+  /// (see FlightServerOptions::compression), or UNCOMPRESSED.
+  ///
+  /// Implementations of DoGet and DoExchange should use it in the
+  /// IpcWriteOptions of the data they send.
+  virtual Compression::type compression() const { return Compression::UNCOMPRESSED; }
 };
 
 class ARROW_FLIGHT_EXPORT FlightServerOptions {
@@ -145,6 +161,31 @@ class ARROW_FLIGHT_EXPORT FlightServerOptions {
   /// keys are an error.
   std::vector<std::pair<std::string, std::shared_ptr<ServerMiddlewareFactory>>>
       middleware;
+  /// \brief The IPC body compression codecs this server may use, by order
+  /// of preference.
+  ///
+  /// For each call, the first of them which the client accepts (see
+  /// FlightClientOptions::accepted_compression) and which is available in
+  /// this build is exposed as ServerCallContext::compression().
+  std::vector<Compression::type> compression;
+  /// \brief The number of bytes which may be queued in the transport for
+  /// each outgoing stream, before writes block. Only used if positive,
+  /// otherwise the gRPC default applies.
+  ///
+  /// DoGet and DoExchange produce data only as fast as it is accepted, so
+  /// this bounds the memory held by slow consumers.
+  int64_t stream_write_buffer_bytes = 0;
+  /// \brief Serve DoGet with the gRPC callback API.
+  ///
+  /// By default, each DoGet call holds a gRPC thread for the lifetime of
+  /// its stream.  If true, payloads are instead pulled with
+  /// FlightDataStream::NextAsync() and written without blocking, so that
+  /// many long-lived streams can be multiplexed over a few threads.
+  /// FlightServerBase::DoGet() itself should then return promptly.
+  ///
+  /// Init() fails with NotImplemented if the gRPC version Flight was built
+  /// against doesn't provide the (non-experimental) callback API.
+  bool async_do_get = false;
 
   /// \brief A Flight implementation-specific callback to customize
   /// transport-specific options.
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -30,6 +32,22 @@
 namespace arrow {
 namespace flight {
 
+/// \brief Statistics about the Flight data sent by a DoGet or DoExchange
+/// call.
+struct ARROW_FLIGHT_EXPORT ServerStreamMetrics {
+  /// \brief The number of FlightData messages sent.
+  int64_t messages_sent = 0;
+  /// \brief The number of bytes of IPC metadata, IPC body and application
+  /// metadata sent.
+  int64_t bytes_sent = 0;
+  /// \brief The time spent waiting for the transport to accept the
+  /// messages, i.e. blocked on a slow network or client.
+  std::chrono::nanoseconds write_time{0};
+  /// \brief The time spent producing the messages. Only measured for
+  /// DoGet, where it is the time spent in FlightDataStream::Next.
+  std::chrono::nanoseconds produce_time{0};
+};
+
 /// \brief Server-side middleware for a call, instantiated per RPC.
 ///
 /// Middleware should be fast and must be infallible: there is no way
@@ -48,6 +66,10 @@ class ARROW_FLIGHT_EXPORT ServerMiddleware {
 
   /// \brief A callback after the call has completed.
   virtual void CallCompleted(const Status& status) = 0;
+
+  /// \brief A callback right before CallCompleted(), for DoGet and
+  /// DoExchange calls, with the statistics of the data they sent.
+  virtual void StreamCompleted(const ServerStreamMetrics& metrics) {}
 };
 
 /// \brief A factory for new middleware instances.
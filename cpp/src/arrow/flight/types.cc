@@ -35,6 +35,7 @@ namespace flight {
 const char* kSchemeGrpc = "grpc";
 const char* kSchemeGrpcTcp = "grpc+tcp";
 const char* kSchemeGrpcUnix = "grpc+unix";
+const char* kSchemeGrpcInProcess = "grpc+inproc";
 const char* kSchemeGrpcTls = "grpc+tls";
 
 const char* kErrorDetailTypeId = "flight::FlightStatusDetail";
@@ -248,6 +249,12 @@ Status Location::ForGrpcUnix(const std::string& path, Location* location) {
   return Location::Parse(uri_string.str(), location);
 }
 
+Status Location::ForGrpcInProcess(const std::string& name, Location* location) {
+  std::stringstream uri_string;
+  uri_string << "grpc+inproc://" << name;
+  return Location::Parse(uri_string.str(), location);
+}
+
 std::string Location::ToString() const { return uri_->ToString(); }
 std::string Location::scheme() const {
   std::string scheme = uri_->scheme();
@@ -270,6 +270,8 @@ ARROW_FLIGHT_EXPORT
 extern const char* kSchemeGrpcUnix;
 ARROW_FLIGHT_EXPORT
 extern const char* kSchemeGrpcTls;
+ARROW_FLIGHT_EXPORT
+extern const char* kSchemeGrpcInProcess;
 
 /// \brief A host location (a URI)
 struct ARROW_FLIGHT_EXPORT Location {
@@ -300,6 +302,13 @@ struct ARROW_FLIGHT_EXPORT Location {
   /// \param[out] location The resulting location
   static Status ForGrpcUnix(const std::string& path, Location* location);
 
+  /// \brief Initialize a location for a Flight service running in the
+  /// same process, which is called without going through the network
+  /// stack
+  /// \param[in] name The name the server is registered under
+  /// \param[out] location The resulting location
+  static Status ForGrpcInProcess(const std::string& name, Location* location);
+
   /// \brief Get a representation of this URI as a string.
   std::string ToString() const;
 
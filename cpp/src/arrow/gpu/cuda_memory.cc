@@ -20,9 +20,12 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <cuda.h>
 
@@ -30,6 +33,7 @@
 #include "arrow/io/memory.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
 
 #include "arrow/gpu/cuda_context.h"
@@ -456,6 +460,134 @@ int64_t CudaBufferWriter::buffer_size() const { return impl_->buffer_size(); }
 
 int64_t CudaBufferWriter::num_bytes_buffered() const { return impl_->buffer_position(); }
 
+// ----------------------------------------------------------------------
+// CudaHostMemoryPool
+
+namespace {
+
+// A static piece of memory for 0-size allocations, so as to return
+// an aligned non-null pointer.
+alignas(64) uint8_t zero_size_area[1];
+
+}  // namespace
+
+class CudaHostMemoryPool::Impl {
+ public:
+  explicit Impl(std::shared_ptr<CudaContext> context) : context_(std::move(context)) {}
+
+  ~Impl() { ReleaseUnused(); }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (size == 0) {
+      *out = zero_size_area;
+      return Status::OK();
+    }
+    const int64_t capacity = BlockCapacity(size);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto& blocks = free_blocks_[capacity];
+      if (!blocks.empty()) {
+        *out = blocks.back();
+        blocks.pop_back();
+        stats_.UpdateAllocatedBytes(size);
+        return Status::OK();
+      }
+    }
+    ContextSaver context_saver(*context_);
+    void* data;
+    CU_RETURN_NOT_OK("cuMemHostAlloc",
+                     cuMemHostAlloc(&data, static_cast<size_t>(capacity),
+                                    CU_MEMHOSTALLOC_PORTABLE));
+    *out = reinterpret_cast<uint8_t*>(data);
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (*ptr != zero_size_area && new_size > 0 &&
+        BlockCapacity(old_size) == BlockCapacity(new_size)) {
+      // Still fits in the same block
+      stats_.UpdateAllocatedBytes(new_size - old_size);
+      return Status::OK();
+    }
+    uint8_t* out;
+    RETURN_NOT_OK(Allocate(new_size, &out));
+    if (old_size > 0 && new_size > 0) {
+      std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    }
+    Free(*ptr, old_size);
+    *ptr = out;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    if (buffer == zero_size_area) {
+      DCHECK_EQ(size, 0);
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_blocks_[BlockCapacity(size)].push_back(buffer);
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  void ReleaseUnused() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ContextSaver context_saver(*context_);
+    for (auto& size_and_blocks : free_blocks_) {
+      for (uint8_t* block : size_and_blocks.second) {
+        ARROW_CHECK_EQ(cuMemFreeHost(block), CUDA_SUCCESS);
+      }
+    }
+    free_blocks_.clear();
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+ private:
+  // Round up to a power of two, and at least a page
+  static int64_t BlockCapacity(int64_t size) {
+    return std::max<int64_t>(BitUtil::NextPower2(size), 4096);
+  }
+
+  std::shared_ptr<CudaContext> context_;
+  std::mutex mutex_;
+  std::unordered_map<int64_t, std::vector<uint8_t*>> free_blocks_;
+  ::arrow::internal::MemoryPoolStats stats_;
+};
+
+CudaHostMemoryPool::CudaHostMemoryPool(std::unique_ptr<Impl> impl)
+    : impl_(std::move(impl)) {}
+
+CudaHostMemoryPool::~CudaHostMemoryPool() = default;
+
+Result<std::shared_ptr<CudaHostMemoryPool>> CudaHostMemoryPool::Make(int device_number) {
+  ARROW_ASSIGN_OR_RAISE(auto manager, CudaDeviceManager::Instance());
+  ARROW_ASSIGN_OR_RAISE(auto context, manager->GetContext(device_number));
+  return std::shared_ptr<CudaHostMemoryPool>(
+      new CudaHostMemoryPool(std::unique_ptr<Impl>(new Impl(std::move(context)))));
+}
+
+Status CudaHostMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status CudaHostMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                      uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void CudaHostMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  impl_->Free(buffer, size);
+}
+
+void CudaHostMemoryPool::ReleaseUnused() { impl_->ReleaseUnused(); }
+
+int64_t CudaHostMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t CudaHostMemoryPool::max_memory() const { return impl_->max_memory(); }
+
 // ----------------------------------------------------------------------
 
 Result<std::shared_ptr<CudaHostBuffer>> AllocateCudaHostBuffer(int device_number,
@@ -19,9 +19,11 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 
 #include "arrow/buffer.h"
 #include "arrow/io/concurrency.h"
+#include "arrow/memory_pool.h"
 #include "arrow/type_fwd.h"
 
 namespace arrow {
@@ -249,6 +251,44 @@ ARROW_EXPORT
 Result<std::shared_ptr<CudaHostBuffer>> AllocateCudaHostBuffer(int device_number,
                                                                const int64_t size);
 
+/// \class CudaHostMemoryPool
+/// \brief MemoryPool handing out page-locked (pinned) CPU host memory
+///
+/// Memory from this pool can be transferred to and from the device by DMA,
+/// without the intermediate staging copy that pageable memory requires.
+/// Pass it as the pool of e.g. Parquet or IPC readers whose output is
+/// headed for the GPU.
+///
+/// Pinning memory is expensive, so freed blocks are kept for reuse
+/// (allocation sizes are rounded up to a power of two) until
+/// ReleaseUnused() is called or the pool is destroyed.  All memory handed
+/// out by the pool must be freed before the pool is destroyed.
+class ARROW_EXPORT CudaHostMemoryPool : public MemoryPool {
+ public:
+  ~CudaHostMemoryPool() override;
+
+  /// \brief Create a pool of host memory with fast access to the given device
+  /// \param[in] device_number the CUDA device number
+  static Result<std::shared_ptr<CudaHostMemoryPool>> Make(int device_number);
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  /// \brief Return pinned memory kept for reuse to the system
+  void ReleaseUnused();
+
+  int64_t bytes_allocated() const override;
+  int64_t max_memory() const override;
+  std::string backend_name() const override { return "cuda_host"; }
+
+ private:
+  class Impl;
+  explicit CudaHostMemoryPool(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
 /// Low-level: get a device address through which the CPU data be accessed.
 Result<uintptr_t> GetDeviceAddress(const uint8_t* cpu_data,
                                    const std::shared_ptr<CudaContext>& ctx);
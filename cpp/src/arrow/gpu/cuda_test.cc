@@ -16,6 +16,7 @@
 // under the License.
 
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <string>
 
@@ -23,6 +24,7 @@
 
 #include "gtest/gtest.h"
 
+#include "arrow/array/data.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/api.h"
 #include "arrow/ipc/dictionary.h"
@@ -377,6 +379,44 @@ TEST_F(TestCudaHostBuffer, ViewOnDevice) {
   ASSERT_EQ(buffer->parent(), device_buffer);
 }
 
+// ------------------------------------------------------------------------
+// Test CudaHostMemoryPool
+
+TEST_F(TestCudaHostBuffer, MemoryPool) {
+  ASSERT_OK_AND_ASSIGN(auto pool, CudaHostMemoryPool::Make(kGpuNumber));
+  ASSERT_EQ(pool->backend_name(), "cuda_host");
+
+  uint8_t* data;
+  ASSERT_OK(pool->Allocate(100, &data));
+  ASSERT_EQ(pool->bytes_allocated(), 100);
+  // Pinned memory is device-accessible
+  ASSERT_OK_AND_ASSIGN(auto device_address, GetDeviceAddress(data, context_));
+  ASSERT_NE(device_address, 0);
+
+  std::memset(data, 42, 100);
+  ASSERT_OK(pool->Reallocate(100, 5000, &data));
+  ASSERT_EQ(pool->bytes_allocated(), 5000);
+  ASSERT_EQ(data[99], 42);
+  pool->Free(data, 5000);
+  ASSERT_EQ(pool->bytes_allocated(), 0);
+  ASSERT_EQ(pool->max_memory(), 5000);
+
+  // Freed blocks are reused
+  uint8_t* other_data;
+  ASSERT_OK(pool->Allocate(6000, &other_data));
+  ASSERT_EQ(other_data, data);
+  pool->Free(other_data, 6000);
+  pool->ReleaseUnused();
+
+  // As the pool of a regular host buffer, copied to the device
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Buffer> host_buffer,
+                       AllocateBuffer(1024, pool.get()));
+  std::memset(host_buffer->mutable_data(), 7, 1024);
+  ASSERT_OK_AND_ASSIGN(auto device_buffer, Buffer::Copy(host_buffer, mm_));
+  ASSERT_OK_AND_ASSIGN(auto roundtripped, Buffer::Copy(device_buffer, cpu_mm_));
+  AssertBufferEqual(*roundtripped, *host_buffer);
+}
+
 // ------------------------------------------------------------------------
 // Test CudaBufferWriter
 
@@ -591,6 +631,26 @@ TEST_F(TestCudaArrowIpc, BasicWriteRead) {
   CompareBatch(*batch, *cpu_batch);
 }
 
+TEST_F(TestCudaArrowIpc, CopyRecordBatch) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(ipc::test::MakeIntRecordBatch(&batch));
+
+  // Host to device, one buffer at a time
+  ASSERT_OK_AND_ASSIGN(auto device_batch, batch->CopyTo(mm_));
+  for (const auto& column : device_batch->column_data()) {
+    ASSERT_FALSE(::arrow::internal::IsCpuData(*column));
+  }
+
+  // Device batch read from IPC back to host
+  ASSERT_OK_AND_ASSIGN(auto device_serialized,
+                       SerializeRecordBatch(*batch, context_.get()));
+  ipc::DictionaryMemo unused_memo;
+  ASSERT_OK_AND_ASSIGN(device_batch,
+                       ReadRecordBatch(batch->schema(), &unused_memo, device_serialized));
+  ASSERT_OK_AND_ASSIGN(auto cpu_batch, device_batch->CopyTo(cpu_mm_));
+  CompareBatch(*batch, *cpu_batch);
+}
+
 TEST_F(TestCudaArrowIpc, DictionaryWriteRead) {
   std::shared_ptr<RecordBatch> batch;
   ASSERT_OK(ipc::test::MakeDictionary(&batch));
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <utility>
@@ -27,6 +28,9 @@
 #include "arrow/io/util_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/future.h"
+#include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
 
@@ -248,16 +252,21 @@ std::shared_ptr<OutputStream> BufferedOutputStream::raw() const { return impl_->
 
 class BufferedInputStream::Impl : public BufferedBase {
  public:
-  Impl(std::shared_ptr<InputStream> raw, MemoryPool* pool, int64_t raw_total_bytes_bound)
+  Impl(std::shared_ptr<InputStream> raw, MemoryPool* pool, int64_t raw_total_bytes_bound,
+       int32_t readahead)
       : BufferedBase(pool),
         raw_(std::move(raw)),
         raw_read_total_(0),
         raw_read_bound_(raw_total_bytes_bound),
-        bytes_buffered_(0) {}
+        bytes_buffered_(0),
+        readahead_(std::max(readahead, 0)) {}
+
+  ~Impl() { StopReadahead(); }
 
   Status Close() {
     if (is_open_) {
       is_open_ = false;
+      StopReadahead();
       return raw_->Close();
     }
     return Status::OK();
@@ -266,12 +275,19 @@ class BufferedInputStream::Impl : public BufferedBase {
   Status Abort() {
     if (is_open_) {
       is_open_ = false;
+      StopReadahead();
       return raw_->Abort();
     }
     return Status::OK();
   }
 
   Result<int64_t> Tell() const {
+    if (chunk_generator_) {
+      // The raw stream is ahead of the consumer and being read concurrently,
+      // count from its position when readahead started
+      RETURN_NOT_OK(readahead_start_pos_.status());
+      return *readahead_start_pos_ + raw_read_total_ - bytes_buffered_;
+    }
     if (raw_pos_ == -1) {
       ARROW_ASSIGN_OR_RAISE(raw_pos_, raw_->Tell());
       DCHECK_GE(raw_pos_, 0);
@@ -315,8 +331,8 @@ class BufferedInputStream::Impl : public BufferedBase {
       }
       ARROW_ASSIGN_OR_RAISE(
           int64_t bytes_read,
-          raw_->Read(additional_bytes_to_read,
-                     buffer_->mutable_data() + buffer_pos_ + bytes_buffered_));
+          RawRead(additional_bytes_to_read,
+                  buffer_->mutable_data() + buffer_pos_ + bytes_buffered_));
       bytes_buffered_ += bytes_read;
       raw_read_total_ += bytes_read;
       nbytes = bytes_buffered_;
@@ -332,6 +348,7 @@ class BufferedInputStream::Impl : public BufferedBase {
 
   std::shared_ptr<InputStream> Detach() {
     is_open_ = false;
+    StopReadahead();
     return std::move(raw_);
   }
 
@@ -351,7 +368,7 @@ class BufferedInputStream::Impl : public BufferedBase {
       if (raw_read_bound_ >= 0) {
         bytes_to_buffer = std::min(buffer_size_, raw_read_bound_ - raw_read_total_);
       }
-      ARROW_ASSIGN_OR_RAISE(bytes_buffered_, raw_->Read(bytes_to_buffer, buffer_data_));
+      ARROW_ASSIGN_OR_RAISE(bytes_buffered_, RawRead(bytes_to_buffer, buffer_data_));
       buffer_pos_ = 0;
       raw_read_total_ += bytes_buffered_;
 
@@ -386,7 +403,7 @@ class BufferedInputStream::Impl : public BufferedBase {
       }
       ARROW_ASSIGN_OR_RAISE(
           int64_t bytes_read,
-          raw_->Read(bytes_to_read, reinterpret_cast<uint8_t*>(out) + bytes_buffered_));
+          RawRead(bytes_to_read, reinterpret_cast<uint8_t*>(out) + bytes_buffered_));
       raw_read_total_ += bytes_read;
 
       // Do not make assumptions about the raw stream position
@@ -418,6 +435,90 @@ class BufferedInputStream::Impl : public BufferedBase {
   std::shared_ptr<InputStream> raw() const { return raw_; }
 
  private:
+  // Reads chunks of the raw stream, up to the raw read bound
+  struct ChunkReader {
+    Result<std::shared_ptr<Buffer>> Next() {
+      const int64_t nbytes = remaining < 0 ? chunk_size : std::min(chunk_size, remaining);
+      if (nbytes == 0) {
+        return nullptr;
+      }
+      ARROW_ASSIGN_OR_RAISE(auto chunk, raw->Read(nbytes));
+      if (chunk->size() == 0) {
+        return nullptr;
+      }
+      if (remaining >= 0) {
+        remaining -= chunk->size();
+      }
+      return chunk;
+    }
+
+    std::shared_ptr<InputStream> raw;
+    int64_t chunk_size;
+    int64_t remaining;
+  };
+
+  // Read from the raw stream, or with readahead from the chunks read ahead of
+  // the consumer
+  Result<int64_t> RawRead(int64_t nbytes, uint8_t* out) {
+    if (readahead_ == 0) {
+      return raw_->Read(nbytes, out);
+    }
+    int64_t bytes_read = 0;
+    while (bytes_read < nbytes) {
+      if (!chunk_ || chunk_pos_ == chunk_->size()) {
+        ARROW_ASSIGN_OR_RAISE(chunk_, NextChunk());
+        chunk_pos_ = 0;
+        if (!chunk_) {
+          break;
+        }
+      }
+      const int64_t chunk_bytes =
+          std::min(nbytes - bytes_read, chunk_->size() - chunk_pos_);
+      memcpy(out + bytes_read, chunk_->data() + chunk_pos_, chunk_bytes);
+      chunk_pos_ += chunk_bytes;
+      bytes_read += chunk_bytes;
+    }
+    return bytes_read;
+  }
+
+  // Return the next chunk read ahead (null at the end of the raw stream),
+  // after issuing the reads needed to keep readahead_ reads in flight
+  Result<std::shared_ptr<Buffer>> NextChunk() {
+    if (!chunk_generator_) {
+      // Readahead starts with the first raw read
+      DCHECK_EQ(raw_read_total_, 0);
+      readahead_start_pos_ = raw_->Tell();
+      const int64_t remaining =
+          raw_read_bound_ >= 0 ? raw_read_bound_ - raw_read_total_ : -1;
+      chunk_generator_ = MakeBackgroundGenerator(
+          Iterator<std::shared_ptr<Buffer>>(ChunkReader{raw_, buffer_size_, remaining}),
+          internal::GetIOThreadPool());
+    }
+    // A failed read ends the raw stream, keep reporting its error
+    RETURN_NOT_OK(readahead_status_);
+    if (chunks_finished_) {
+      return nullptr;
+    }
+    while (static_cast<int32_t>(chunks_in_flight_.size()) <= readahead_) {
+      chunks_in_flight_.push_back(chunk_generator_());
+    }
+    auto next = std::move(chunks_in_flight_.front());
+    chunks_in_flight_.pop_front();
+    auto chunk = next.result();
+    readahead_status_ = chunk.status();
+    chunks_finished_ = !chunk.ok() || *chunk == nullptr;
+    return chunk;
+  }
+
+  // Wait for the reads in flight, which use the raw stream
+  void StopReadahead() {
+    for (const auto& chunk : chunks_in_flight_) {
+      chunk.Wait();
+    }
+    chunks_in_flight_.clear();
+    chunks_finished_ = true;
+  }
+
   std::shared_ptr<InputStream> raw_;
   int64_t raw_read_total_;
   int64_t raw_read_bound_;
@@ -425,21 +526,31 @@ class BufferedInputStream::Impl : public BufferedBase {
   // Number of remaining bytes in the buffer, to be reduced on each read from
   // the buffer
   int64_t bytes_buffered_;
+
+  // Readahead state: the chunks in flight and the chunk being consumed
+  const int32_t readahead_;
+  Result<int64_t> readahead_start_pos_;
+  Status readahead_status_;
+  AsyncGenerator<std::shared_ptr<Buffer>> chunk_generator_;
+  std::deque<Future<std::shared_ptr<Buffer>>> chunks_in_flight_;
+  bool chunks_finished_ = false;
+  std::shared_ptr<Buffer> chunk_;
+  int64_t chunk_pos_ = 0;
 };
 
 BufferedInputStream::BufferedInputStream(std::shared_ptr<InputStream> raw,
-                                         MemoryPool* pool,
-                                         int64_t raw_total_bytes_bound) {
-  impl_.reset(new Impl(std::move(raw), pool, raw_total_bytes_bound));
+                                         MemoryPool* pool, int64_t raw_total_bytes_bound,
+                                         int32_t readahead) {
+  impl_.reset(new Impl(std::move(raw), pool, raw_total_bytes_bound, readahead));
 }
 
 BufferedInputStream::~BufferedInputStream() { internal::CloseFromDestructor(this); }
 
 Result<std::shared_ptr<BufferedInputStream>> BufferedInputStream::Create(
     int64_t buffer_size, MemoryPool* pool, std::shared_ptr<InputStream> raw,
-    int64_t raw_total_bytes_bound) {
+    int64_t raw_total_bytes_bound, int32_t readahead) {
   auto result = std::shared_ptr<BufferedInputStream>(
-      new BufferedInputStream(std::move(raw), pool, raw_total_bytes_bound));
+      new BufferedInputStream(std::move(raw), pool, raw_total_bytes_bound, readahead));
   RETURN_NOT_OK(result->SetBufferSize(buffer_size));
   return result;
 }
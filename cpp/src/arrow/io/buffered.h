@@ -105,10 +105,14 @@ class ARROW_EXPORT BufferedInputStream
   /// \param[in] raw_read_bound a bound on the maximum number of bytes
   /// to read from the raw input stream. The default -1 indicates that
   /// it is unbounded
+  /// \param[in] readahead the number of buffer-sized reads of the raw input
+  /// stream to keep in flight on the I/O thread pool, ahead of the consumer.
+  /// The default 0 disables readahead: the raw input stream is then read
+  /// on the calling thread, when the buffer needs refilling
   /// \return the created BufferedInputStream
   static Result<std::shared_ptr<BufferedInputStream>> Create(
       int64_t buffer_size, MemoryPool* pool, std::shared_ptr<InputStream> raw,
-      int64_t raw_read_bound = -1);
+      int64_t raw_read_bound = -1, int32_t readahead = 0);
 
   /// \brief Resize internal read buffer; calls to Read(...) will read at least
   /// \param[in] new_buffer_size the new read buffer size
@@ -123,6 +127,9 @@ class ARROW_EXPORT BufferedInputStream
 
   /// \brief Release the raw InputStream. Any data buffered will be
   /// discarded. Further operations on this object are invalid
+  ///
+  /// With readahead, reads in flight are waited for, and the raw InputStream
+  /// is positioned after the data read ahead.
   /// \return raw the underlying InputStream
   std::shared_ptr<InputStream> Detach();
 
@@ -137,7 +144,7 @@ class ARROW_EXPORT BufferedInputStream
   friend InputStreamConcurrencyWrapper<BufferedInputStream>;
 
   explicit BufferedInputStream(std::shared_ptr<InputStream> raw, MemoryPool* pool,
-                               int64_t raw_total_bytes_bound);
+                               int64_t raw_total_bytes_bound, int32_t readahead);
 
   Status DoClose();
   Status DoAbort() override;
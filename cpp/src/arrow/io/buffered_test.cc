@@ -460,7 +460,7 @@ class TestBufferedInputStreamBound : public ::testing::Test {
  public:
   void SetUp() { CreateExample(/*bounded=*/true); }
 
-  void CreateExample(bool bounded = true) {
+  void CreateExample(bool bounded = true, int32_t readahead = 0) {
     // Create a buffer larger than source size, to check that the
     // stream end is respected
     ASSERT_OK_AND_ASSIGN(auto buf, AllocateResizableBuffer(source_size_ + 10));
@@ -472,7 +472,7 @@ class TestBufferedInputStreamBound : public ::testing::Test {
     ASSERT_OK(source_->Advance(stream_offset_));
     ASSERT_OK_AND_ASSIGN(
         stream_, BufferedInputStream::Create(chunk_size_, default_memory_pool(), source_,
-                                             bounded ? stream_size_ : -1));
+                                             bounded ? stream_size_ : -1, readahead));
   }
 
  protected:
@@ -655,5 +655,50 @@ TEST_F(TestBufferedInputStreamBound, BufferExactlyExhausted) {
   }
 }
 
+TEST_F(TestBufferedInputStreamBound, Readahead) {
+  for (const bool bounded : {true, false}) {
+    SCOPED_TRACE(bounded ? "bounded" : "unbounded");
+    CreateExample(bounded, /*readahead=*/3);
+    std::shared_ptr<Buffer> buffer;
+    util::string_view view;
+
+    // source is at offset 10
+    ASSERT_OK_AND_EQ(10, stream_->Tell());
+    ASSERT_OK_AND_ASSIGN(buffer, stream_->Read(10));
+    ASSERT_EQ(10, buffer->size());
+    for (int i = 0; i < 10; i++) {
+      ASSERT_EQ(10 + i, (*buffer)[i]) << i;
+    }
+    // The raw stream is read ahead, but the position is the consumer's
+    ASSERT_OK_AND_EQ(20, stream_->Tell());
+
+    // Peek across chunk boundary
+    ASSERT_OK_AND_ASSIGN(view, stream_->Peek(70));
+    ASSERT_EQ(70, view.size());
+    for (int i = 0; i < 70; i++) {
+      ASSERT_EQ(20 + i, static_cast<uint8_t>(view[i])) << i;
+    }
+
+    // Read more than the chunk size
+    ASSERT_OK_AND_ASSIGN(buffer, stream_->Read(130));
+    ASSERT_EQ(130, buffer->size());
+    for (int i = 0; i < 130; i++) {
+      ASSERT_EQ(20 + i, (*buffer)[i]) << i;
+    }
+    ASSERT_OK_AND_EQ(150, stream_->Tell());
+
+    // Read past the end of the stream
+    ASSERT_OK_AND_ASSIGN(buffer, stream_->Read(200));
+    ASSERT_EQ(bounded ? 106 : 116, buffer->size());
+    for (int i = 0; i < 106; i++) {
+      ASSERT_EQ(150 + i, (*buffer)[i]) << i;
+    }
+    ASSERT_OK_AND_ASSIGN(buffer, stream_->Read(1));
+    ASSERT_EQ(0, buffer->size());
+    ASSERT_OK(stream_->Close());
+    ASSERT_TRUE(source_->closed());
+  }
+}
+
 }  // namespace io
 }  // namespace arrow
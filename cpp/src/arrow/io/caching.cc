@@ -17,12 +17,14 @@
 
 #include <algorithm>
 #include <cmath>
+#include <mutex>
 #include <utility>
 
 #include "arrow/buffer.h"
 #include "arrow/io/caching.h"
 #include "arrow/io/util_internal.h"
 #include "arrow/result.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/future.h"
 #include "arrow/util/logging.h"
 
@@ -31,7 +33,9 @@ namespace io {
 
 CacheOptions CacheOptions::Defaults() {
   return CacheOptions{internal::ReadRangeCache::kDefaultHoleSizeLimit,
-                      internal::ReadRangeCache::kDefaultRangeSizeLimit};
+                      internal::ReadRangeCache::kDefaultRangeSizeLimit,
+                      internal::ReadRangeCache::kDefaultBufferLimit,
+                      internal::ReadRangeCache::kDefaultAlignment};
 }
 
 CacheOptions CacheOptions::MakeFromNetworkMetrics(int64_t time_to_first_byte_millis,
@@ -115,27 +119,59 @@ CacheOptions CacheOptions::MakeFromNetworkMetrics(int64_t time_to_first_byte_mil
                                       (1 - ideal_bandwidth_utilization_frac))));
   DCHECK_GT(range_size_limit, 0) << "Computed range_size_limit must be > 0";
 
-  return {hole_size_limit, range_size_limit};
+  return {hole_size_limit, range_size_limit,
+          internal::ReadRangeCache::kDefaultBufferLimit,
+          internal::ReadRangeCache::kDefaultAlignment};
 }
 
 namespace internal {
 
 struct RangeCacheEntry {
   ReadRange range;
+  // Invalid until the range is fetched, and again once it is released
   Future<std::shared_ptr<Buffer>> future;
+  // The number of non-empty ranges given to Cache() which this range holds
+  // and which weren't read yet (only tracked with a buffer limit)
+  int64_t num_unread;
+  bool started;
 
   friend bool operator<(const RangeCacheEntry& left, const RangeCacheEntry& right) {
     return left.range.offset < right.range.offset;
   }
 };
 
+namespace {
+
+// Expand ordered ranges to multiples of `alignment`, merging those which
+// then overlap
+std::vector<ReadRange> AlignReadRanges(const std::vector<ReadRange>& ranges,
+                                       int64_t alignment) {
+  std::vector<ReadRange> aligned;
+  aligned.reserve(ranges.size());
+  for (const auto& range : ranges) {
+    const int64_t start = BitUtil::RoundDown(range.offset, alignment);
+    const int64_t end = BitUtil::RoundUp(range.offset + range.length, alignment);
+    if (!aligned.empty() && start < aligned.back().offset + aligned.back().length) {
+      aligned.back().length = end - aligned.back().offset;
+    } else {
+      aligned.push_back({start, end - start});
+    }
+  }
+  return aligned;
+}
+
+}  // namespace
+
 struct ReadRangeCache::Impl {
   std::shared_ptr<RandomAccessFile> file;
   AsyncContext ctx;
   CacheOptions options;
 
+  std::mutex mutex;
   // Ordered by offset (so as to find a matching region by binary search)
   std::vector<RangeCacheEntry> entries;
+  // The total length of the entries fetched and not released yet
+  int64_t buffered_bytes = 0;
 
   // Add new entries, themselves ordered by offset
   void AddEntries(std::vector<RangeCacheEntry> new_entries) {
@@ -148,6 +184,43 @@ struct ReadRangeCache::Impl {
       entries = std::move(new_entries);
     }
   }
+
+  void Fetch(RangeCacheEntry* entry) {
+    entry->future = file->ReadAsync(ctx, entry->range.offset, entry->range.length);
+    entry->started = true;
+    buffered_bytes += entry->range.length;
+  }
+
+  // The entry holding the given range, or entries.end()
+  std::vector<RangeCacheEntry>::iterator FindEntry(const ReadRange& range) {
+    const auto it = std::lower_bound(
+        entries.begin(), entries.end(), range,
+        [](const RangeCacheEntry& entry, const ReadRange& range) {
+          return entry.range.offset + entry.range.length < range.offset + range.length;
+        });
+    if (it == entries.end() || !it->range.Contains(range)) {
+      return entries.end();
+    }
+    return it;
+  }
+
+  // Fetch the first entries not fetched yet, as far as the buffer limit allows,
+  // and return their ranges
+  std::vector<ReadRange> FetchAhead() {
+    std::vector<ReadRange> fetched;
+    for (auto& entry : entries) {
+      if (entry.started) {
+        continue;
+      }
+      if (options.buffer_limit > 0 && buffered_bytes > 0 &&
+          buffered_bytes + entry.range.length > options.buffer_limit) {
+        break;
+      }
+      Fetch(&entry);
+      fetched.push_back(entry.range);
+    }
+    return fetched;
+  }
 };
 
 ReadRangeCache::ReadRangeCache(std::shared_ptr<RandomAccessFile> file, AsyncContext ctx,
@@ -161,18 +234,39 @@ ReadRangeCache::ReadRangeCache(std::shared_ptr<RandomAccessFile> file, AsyncCont
 ReadRangeCache::~ReadRangeCache() {}
 
 Status ReadRangeCache::Cache(std::vector<ReadRange> ranges) {
-  ranges = internal::CoalesceReadRanges(std::move(ranges), impl_->options.hole_size_limit,
-                                        impl_->options.range_size_limit);
+  std::vector<ReadRange> coalesced = internal::CoalesceReadRanges(
+      ranges, impl_->options.hole_size_limit, impl_->options.range_size_limit);
+  if (impl_->options.alignment > 1) {
+    coalesced = AlignReadRanges(coalesced, impl_->options.alignment);
+  }
   std::vector<RangeCacheEntry> entries;
-  entries.reserve(ranges.size());
-  for (const auto& range : ranges) {
-    auto fut = impl_->file->ReadAsync(impl_->ctx, range.offset, range.length);
-    entries.push_back({range, std::move(fut)});
+  entries.reserve(coalesced.size());
+  for (const auto& range : coalesced) {
+    entries.push_back({range, Future<std::shared_ptr<Buffer>>(), 0, false});
+  }
+  if (impl_->options.buffer_limit > 0) {
+    // Count the ranges each coalesced range holds, so as to release it once
+    // they have all been read
+    for (const auto& range : ranges) {
+      if (range.length == 0) {
+        continue;
+      }
+      auto it = std::upper_bound(
+          entries.begin(), entries.end(), range.offset,
+          [](int64_t offset, const RangeCacheEntry& entry) {
+            return offset < entry.range.offset;
+          });
+      DCHECK(it != entries.begin());
+      --it;
+      DCHECK(it->range.Contains(range));
+      ++it->num_unread;
+    }
   }
 
+  std::lock_guard<std::mutex> lock(impl_->mutex);
   impl_->AddEntries(std::move(entries));
   // Prefetch immediately, regardless of executor availability, if possible
-  return impl_->file->WillNeed(ranges);
+  return impl_->file->WillNeed(impl_->FetchAhead());
 }
 
 Result<std::shared_ptr<Buffer>> ReadRangeCache::Read(ReadRange range) {
@@ -181,16 +275,58 @@ Result<std::shared_ptr<Buffer>> ReadRangeCache::Read(ReadRange range) {
     return std::make_shared<Buffer>(&byte, 0);
   }
 
-  const auto it = std::lower_bound(
-      impl_->entries.begin(), impl_->entries.end(), range,
-      [](const RangeCacheEntry& entry, const ReadRange& range) {
-        return entry.range.offset + entry.range.length < range.offset + range.length;
-      });
-  if (it != impl_->entries.end() && it->range.Contains(range)) {
-    ARROW_ASSIGN_OR_RAISE(auto buf, it->future.result());
-    return SliceBuffer(std::move(buf), range.offset - it->range.offset, range.length);
+  Future<std::shared_ptr<Buffer>> future;
+  int64_t entry_offset;
+  {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    const auto it = impl_->FindEntry(range);
+    if (it == impl_->entries.end()) {
+      return Status::Invalid("ReadRangeCache did not find matching cache entry");
+    }
+    if (!it->started) {
+      // Read ahead of the window: fetch it now rather than wait for the
+      // entries before it to be released
+      impl_->Fetch(&*it);
+    } else if (!it->future.is_valid()) {
+      return Status::Invalid("ReadRangeCache entry was already read and released");
+    }
+    future = it->future;
+    entry_offset = it->range.offset;
+
+    if (impl_->options.buffer_limit > 0 && --it->num_unread <= 0) {
+      // All the ranges of the entry were read: the callers' slices keep the
+      // buffer alive as long as needed
+      it->future = Future<std::shared_ptr<Buffer>>();
+      impl_->buffered_bytes -= it->range.length;
+      RETURN_NOT_OK(impl_->file->WillNeed(impl_->FetchAhead()));
+    }
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto buf, future.result());
+  return SliceBuffer(std::move(buf), range.offset - entry_offset, range.length);
+}
+
+Future<void> ReadRangeCache::WaitFor(std::vector<ReadRange> ranges) {
+  std::vector<Future<std::shared_ptr<Buffer>>> futures;
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  for (const auto& range : ranges) {
+    if (range.length == 0) {
+      continue;
+    }
+    const auto it = impl_->FindEntry(range);
+    if (it == impl_->entries.end()) {
+      return Future<void>::MakeFinished(
+          Status::Invalid("ReadRangeCache did not find matching cache entry"));
+    }
+    if (!it->started) {
+      impl_->Fetch(&*it);
+    } else if (!it->future.is_valid()) {
+      return Future<void>::MakeFinished(
+          Status::Invalid("ReadRangeCache entry was already read and released"));
+    }
+    futures.push_back(it->future);
   }
-  return Status::Invalid("ReadRangeCache did not find matching cache entry");
+  return AllComplete(futures);
 }
 
 }  // namespace internal
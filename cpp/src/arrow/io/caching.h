@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "arrow/io/interfaces.h"
+#include "arrow/util/future.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -40,10 +41,18 @@ struct ARROW_EXPORT CacheOptions {
   ///   combining two consecutive ranges would produce a range of a
   ///   size greater than this, they are not combined
   int64_t range_size_limit;
+  /// /brief The maximum number of bytes of combined ranges being fetched or
+  ///   held by the cache at a time; 0 means no limit
+  int64_t buffer_limit;
+  /// /brief If greater than 1, combined ranges are expanded to multiples of
+  ///   this value, e.g. the block size of a file read with direct I/O
+  ///   (see ReadableFile::alignment()); 0 means no alignment
+  int64_t alignment;
 
   bool operator==(const CacheOptions& other) const {
     return hole_size_limit == other.hole_size_limit &&
-           range_size_limit == other.range_size_limit;
+           range_size_limit == other.range_size_limit &&
+           buffer_limit == other.buffer_limit && alignment == other.alignment;
   }
 
   /// \brief Construct CacheOptions from network storage metrics (e.g. S3).
@@ -76,10 +85,18 @@ namespace internal {
 /// The cache will combine those ranges according to parameters (see constructor)
 /// and start fetching the combined ranges in the background.
 /// You can then individually fetch them using Read().
+///
+/// If CacheOptions::buffer_limit is set, the cache fetches the combined ranges
+/// in offset order, only as far ahead as the limit allows, and drops a combined
+/// range once all the ranges it holds have been read; each range given to
+/// Cache() must then be read at most once.  Reading a range which wasn't
+/// fetched yet fetches it right away, even beyond the limit.
 class ARROW_EXPORT ReadRangeCache {
  public:
   static constexpr int64_t kDefaultHoleSizeLimit = 8192;
   static constexpr int64_t kDefaultRangeSizeLimit = 32 * 1024 * 1024;
+  static constexpr int64_t kDefaultBufferLimit = 0;
+  static constexpr int64_t kDefaultAlignment = 0;
 
   /// Construct a read cache with default
   explicit ReadRangeCache(std::shared_ptr<RandomAccessFile> file, AsyncContext ctx)
@@ -97,8 +114,19 @@ class ARROW_EXPORT ReadRangeCache {
   Status Cache(std::vector<ReadRange> ranges);
 
   /// \brief Read a range previously given to Cache().
+  ///
+  /// This is thread-safe.
   Result<std::shared_ptr<Buffer>> Read(ReadRange range);
 
+  /// \brief Wait until ranges previously given to Cache() are fetched.
+  ///
+  /// The returned Future completes once reading the ranges doesn't block.
+  /// Like Read(), this fetches right away the ranges which weren't fetched
+  /// yet because of the buffer limit.
+  ///
+  /// This is thread-safe.
+  Future<void> WaitFor(std::vector<ReadRange> ranges);
+
  protected:
   struct Impl;
   std::unique_ptr<Impl> impl_;
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -29,7 +30,9 @@
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -437,5 +440,588 @@ Result<std::shared_ptr<Buffer>> CompressedInputStream::DoRead(int64_t nbytes) {
 
 std::shared_ptr<InputStream> CompressedInputStream::raw() const { return impl_->raw(); }
 
+// ----------------------------------------------------------------------
+// ParallelCompressedInputStream implementation
+
+namespace {
+
+// Decompress all of `input`, resetting the decompressor between concatenated
+// streams.  `*fresh` is set to whether the decompressor has been reset since
+// it last consumed any input.
+Result<std::shared_ptr<Buffer>> DecompressBuffer(Decompressor* decompressor,
+                                                 const Buffer& input, MemoryPool* pool,
+                                                 bool* fresh) {
+  static constexpr int64_t kMinDecompressSize = 64 * 1024;
+  ARROW_ASSIGN_OR_RAISE(
+      auto out,
+      AllocateResizableBuffer(std::max(kMinDecompressSize, input.size() * 4), pool));
+  int64_t input_pos = 0;
+  int64_t output_pos = 0;
+
+  while (input_pos < input.size()) {
+    if (decompressor->IsFinished()) {
+      RETURN_NOT_OK(decompressor->Reset());
+      *fresh = true;
+    }
+    if (output_pos == out->size()) {
+      RETURN_NOT_OK(out->Resize(out->size() * 2));
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        auto result, decompressor->Decompress(
+                         input.size() - input_pos, input.data() + input_pos,
+                         out->size() - output_pos, out->mutable_data() + output_pos));
+    if (result.bytes_read == 0 && result.bytes_written == 0) {
+      // Some output space was available, so this should not happen
+      return Status::IOError("Corrupt compressed stream");
+    }
+    input_pos += result.bytes_read;
+    output_pos += result.bytes_written;
+    if (result.bytes_read > 0) {
+      *fresh = false;
+    }
+  }
+  RETURN_NOT_OK(out->Resize(output_pos));
+  return std::move(out);
+}
+
+}  // namespace
+
+class ParallelCompressedInputStream::Impl {
+ public:
+  Impl(MemoryPool* pool, const std::shared_ptr<InputStream>& raw)
+      : pool_(pool),
+        raw_(raw),
+        executor_(::arrow::internal::GetCpuThreadPool()),
+        max_pending_(std::max(1, executor_->GetCapacity())) {}
+
+  ~Impl() {
+    // Decompression tasks don't refer to this object, but wait for them
+    // so as not to leave work behind a destroyed stream
+    for (auto& future : pending_) {
+      future.Wait();
+    }
+  }
+
+  Status Init(Codec* codec) {
+    codec_ = codec;
+    return Status::OK();
+  }
+
+  Status Close() {
+    if (is_open_) {
+      is_open_ = false;
+      return raw_->Close();
+    } else {
+      return Status::OK();
+    }
+  }
+
+  Status Abort() {
+    if (is_open_) {
+      is_open_ = false;
+      return raw_->Abort();
+    } else {
+      return Status::OK();
+    }
+  }
+
+  bool closed() { return !is_open_; }
+
+  Result<int64_t> Tell() const { return total_pos_; }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) {
+    auto out_data = reinterpret_cast<uint8_t*>(out);
+    int64_t total_read = 0;
+
+    while (total_read < nbytes) {
+      if (!decompressed_ || decompressed_pos_ == decompressed_->size()) {
+        bool has_data = false;
+        RETURN_NOT_OK(NextDecompressed(&has_data));
+        if (!has_data) {
+          break;
+        }
+      }
+      const int64_t read_bytes =
+          std::min(nbytes - total_read, decompressed_->size() - decompressed_pos_);
+      memcpy(out_data + total_read, decompressed_->data() + decompressed_pos_,
+             read_bytes);
+      decompressed_pos_ += read_bytes;
+      total_read += read_bytes;
+    }
+    total_pos_ += total_read;
+    return total_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) {
+    if (!decompressed_ || decompressed_pos_ == decompressed_->size()) {
+      bool has_data = false;
+      RETURN_NOT_OK(NextDecompressed(&has_data));
+      if (!has_data) {
+        return std::make_shared<Buffer>(nullptr, 0);
+      }
+    }
+    if (decompressed_->size() - decompressed_pos_ >= nbytes) {
+      // Avoid a copy if the decompressed data is readily available
+      auto out = SliceBuffer(decompressed_, decompressed_pos_, nbytes);
+      decompressed_pos_ += nbytes;
+      total_pos_ += nbytes;
+      return std::move(out);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto buf, AllocateResizableBuffer(nbytes, pool_));
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, Read(nbytes, buf->mutable_data()));
+    RETURN_NOT_OK(buf->Resize(bytes_read));
+    return std::move(buf);
+  }
+
+  std::shared_ptr<InputStream> raw() const { return raw_; }
+
+ private:
+  // Read 1 MB compressed data at a time
+  static const int64_t kChunkSize = 1024 * 1024;
+  // Target compressed size of a decompression task
+  static const int64_t kTaskSize = 1024 * 1024;
+
+  // Make the next decompressed buffer current, waiting for it if necessary
+  Status NextDecompressed(bool* has_data) {
+    decompressed_.reset();
+    decompressed_pos_ = 0;
+    while (!decompressed_ || decompressed_->size() == 0) {
+      RETURN_NOT_OK(Schedule());
+      if (pending_.empty()) {
+        *has_data = false;
+        return Status::OK();
+      }
+      auto future = std::move(pending_.front());
+      pending_.pop_front();
+      ARROW_ASSIGN_OR_RAISE(decompressed_, future.result());
+    }
+    *has_data = true;
+    return Status::OK();
+  }
+
+  // Keep decompression tasks in flight, up to the executor's capacity
+  Status Schedule() {
+    while (!input_exhausted_ && static_cast<int>(pending_.size()) < max_pending_) {
+      if (serial_ && !pending_.empty()) {
+        // Serial decompression only happens on demand
+        break;
+      }
+      RETURN_NOT_OK(ScheduleOne());
+    }
+    return Status::OK();
+  }
+
+  int64_t compressed_avail() const {
+    return compressed_ ? compressed_->size() - compressed_pos_ : 0;
+  }
+
+  // Append a chunk of raw data to the unconsumed compressed data
+  Status ReadCompressed() {
+    ARROW_ASSIGN_OR_RAISE(auto chunk, raw_->Read(kChunkSize));
+    if (chunk->size() == 0) {
+      raw_eof_ = true;
+    } else if (compressed_avail() == 0) {
+      compressed_ = std::move(chunk);
+      compressed_pos_ = 0;
+    } else {
+      ARROW_ASSIGN_OR_RAISE(
+          compressed_,
+          ConcatenateBuffers({SliceBuffer(compressed_, compressed_pos_), chunk}, pool_));
+      compressed_pos_ = 0;
+    }
+    return Status::OK();
+  }
+
+  Status ScheduleOne() {
+    // Gather whole frames, up to kTaskSize bytes
+    int64_t task_size = 0;
+    while (!serial_ && task_size < kTaskSize) {
+      const int64_t avail = compressed_avail() - task_size;
+      int64_t frame_size = 0;
+      if (avail > 0) {
+        const uint8_t* frame_start = compressed_->data() + compressed_pos_ + task_size;
+        auto maybe_frame_size = codec_->FindFrameSize(avail, frame_start);
+        if (maybe_frame_size.status().IsNotImplemented()) {
+          // Cannot split further, decompress the remaining input serially
+          serial_ = true;
+          break;
+        }
+        ARROW_ASSIGN_OR_RAISE(frame_size, maybe_frame_size);
+      }
+      if (frame_size > 0 && frame_size <= avail) {
+        task_size += frame_size;
+        continue;
+      }
+      if (raw_eof_) {
+        if (avail > 0) {
+          return Status::IOError("Truncated compressed stream");
+        }
+        break;
+      }
+      RETURN_NOT_OK(ReadCompressed());
+    }
+
+    if (task_size > 0) {
+      auto frames = SliceBuffer(compressed_, compressed_pos_, task_size);
+      compressed_pos_ += task_size;
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Decompressor> decompressor,
+                            codec_->MakeDecompressor());
+      MemoryPool* pool = pool_;
+      auto task = [frames, decompressor, pool]() -> Result<std::shared_ptr<Buffer>> {
+        bool fresh = true;
+        ARROW_ASSIGN_OR_RAISE(
+            auto out, DecompressBuffer(decompressor.get(), *frames, pool, &fresh));
+        if (!decompressor->IsFinished()) {
+          return Status::IOError("Truncated compressed stream");
+        }
+        return out;
+      };
+      ARROW_ASSIGN_OR_RAISE(auto future, executor_->Submit(std::move(task)));
+      pending_.push_back(std::move(future));
+    } else if (serial_) {
+      using BufferFuture = Future<std::shared_ptr<Buffer>>;
+      pending_.push_back(BufferFuture::MakeFinished(DecompressSerial()));
+    } else {
+      input_exhausted_ = true;
+    }
+    return Status::OK();
+  }
+
+  // Decompress the next chunk of input in the calling thread
+  Result<std::shared_ptr<Buffer>> DecompressSerial() {
+    if (!serial_decompressor_) {
+      ARROW_ASSIGN_OR_RAISE(serial_decompressor_, codec_->MakeDecompressor());
+    }
+    if (compressed_avail() == 0 && !raw_eof_) {
+      RETURN_NOT_OK(ReadCompressed());
+    }
+    if (compressed_avail() == 0) {
+      input_exhausted_ = true;
+      if (!serial_fresh_ && !serial_decompressor_->IsFinished()) {
+        return Status::IOError("Truncated compressed stream");
+      }
+      return std::make_shared<Buffer>(nullptr, 0);
+    }
+    auto input = SliceBuffer(compressed_, compressed_pos_);
+    compressed_.reset();
+    compressed_pos_ = 0;
+    return DecompressBuffer(serial_decompressor_.get(), *input, pool_, &serial_fresh_);
+  }
+
+  MemoryPool* pool_;
+  std::shared_ptr<InputStream> raw_;
+  Codec* codec_ = NULLPTR;
+  ::arrow::internal::ThreadPool* executor_;
+  const int max_pending_;
+  bool is_open_ = true;
+
+  // Compressed data not yet handed to a decompression task
+  std::shared_ptr<Buffer> compressed_;
+  int64_t compressed_pos_ = 0;
+  bool raw_eof_ = false;
+  bool input_exhausted_ = false;
+
+  // Set once the input cannot be split into frames anymore
+  bool serial_ = false;
+  std::shared_ptr<Decompressor> serial_decompressor_;
+  bool serial_fresh_ = true;
+
+  // Decompressed buffers, in input order
+  std::deque<Future<std::shared_ptr<Buffer>>> pending_;
+  std::shared_ptr<Buffer> decompressed_;
+  int64_t decompressed_pos_ = 0;
+  // Total number of bytes read from the stream
+  int64_t total_pos_ = 0;
+};
+
+Result<std::shared_ptr<ParallelCompressedInputStream>>
+ParallelCompressedInputStream::Make(Codec* codec, const std::shared_ptr<InputStream>& raw,
+                                    MemoryPool* pool) {
+  // CAUTION: codec is not owned
+  std::shared_ptr<ParallelCompressedInputStream> res(new ParallelCompressedInputStream);
+  res->impl_.reset(new Impl(pool, raw));
+  RETURN_NOT_OK(res->impl_->Init(codec));
+  return res;
+}
+
+ParallelCompressedInputStream::~ParallelCompressedInputStream() {
+  internal::CloseFromDestructor(this);
+}
+
+Status ParallelCompressedInputStream::DoClose() { return impl_->Close(); }
+
+Status ParallelCompressedInputStream::DoAbort() { return impl_->Abort(); }
+
+bool ParallelCompressedInputStream::closed() const { return impl_->closed(); }
+
+Result<int64_t> ParallelCompressedInputStream::DoTell() const { return impl_->Tell(); }
+
+Result<int64_t> ParallelCompressedInputStream::DoRead(int64_t nbytes, void* out) {
+  return impl_->Read(nbytes, out);
+}
+
+Result<std::shared_ptr<Buffer>> ParallelCompressedInputStream::DoRead(int64_t nbytes) {
+  return impl_->Read(nbytes);
+}
+
+std::shared_ptr<InputStream> ParallelCompressedInputStream::raw() const {
+  return impl_->raw();
+}
+
+// ----------------------------------------------------------------------
+// ParallelCompressedOutputStream implementation
+
+namespace {
+
+// Compress all of `input` as a complete stream
+Result<std::shared_ptr<Buffer>> CompressBuffer(Compressor* compressor,
+                                               const Buffer& input, MemoryPool* pool) {
+  static constexpr int64_t kMinCompressSize = 64 * 1024;
+  ARROW_ASSIGN_OR_RAISE(
+      auto out,
+      AllocateResizableBuffer(std::max(kMinCompressSize, input.size() / 2), pool));
+  int64_t input_pos = 0;
+  int64_t output_pos = 0;
+
+  while (input_pos < input.size()) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto result, compressor->Compress(
+                         input.size() - input_pos, input.data() + input_pos,
+                         out->size() - output_pos, out->mutable_data() + output_pos));
+    input_pos += result.bytes_read;
+    output_pos += result.bytes_written;
+    if (result.bytes_read == 0 || output_pos == out->size()) {
+      // Need to enlarge output buffer
+      RETURN_NOT_OK(out->Resize(out->size() * 2));
+    }
+  }
+  while (true) {
+    ARROW_ASSIGN_OR_RAISE(auto result, compressor->End(out->size() - output_pos,
+                                                       out->mutable_data() + output_pos));
+    output_pos += result.bytes_written;
+    if (!result.should_retry) {
+      break;
+    }
+    RETURN_NOT_OK(out->Resize(out->size() * 2));
+  }
+  RETURN_NOT_OK(out->Resize(output_pos));
+  return std::move(out);
+}
+
+}  // namespace
+
+class ParallelCompressedOutputStream::Impl {
+ public:
+  Impl(MemoryPool* pool, const std::shared_ptr<OutputStream>& raw, int64_t frame_size)
+      : pool_(pool),
+        raw_(raw),
+        frame_size_(frame_size),
+        executor_(::arrow::internal::GetCpuThreadPool()),
+        max_pending_(std::max(1, executor_->GetCapacity())) {}
+
+  ~Impl() {
+    // Compression tasks don't refer to this object, but wait for them
+    // so as not to leave work behind a destroyed stream
+    for (auto& future : pending_) {
+      future.Wait();
+    }
+  }
+
+  Status Init(Codec* codec) {
+    if (frame_size_ <= 0) {
+      return Status::Invalid("Frame size must be strictly positive, got ", frame_size_);
+    }
+    // Fail early if the codec doesn't support streaming compression
+    RETURN_NOT_OK(codec->MakeCompressor());
+    codec_ = codec;
+    is_open_ = true;
+    return Status::OK();
+  }
+
+  Result<int64_t> Tell() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return total_pos_;
+  }
+
+  std::shared_ptr<OutputStream> raw() const { return raw_; }
+
+  Status Write(const void* data, int64_t nbytes) {
+    std::lock_guard<std::mutex> guard(lock_);
+
+    auto input = reinterpret_cast<const uint8_t*>(data);
+    while (nbytes > 0) {
+      if (!frame_) {
+        ARROW_ASSIGN_OR_RAISE(frame_, AllocateResizableBuffer(frame_size_, pool_));
+        frame_pos_ = 0;
+      }
+      const int64_t copy_bytes = std::min(nbytes, frame_size_ - frame_pos_);
+      memcpy(frame_->mutable_data() + frame_pos_, input, copy_bytes);
+      frame_pos_ += copy_bytes;
+      input += copy_bytes;
+      nbytes -= copy_bytes;
+      total_pos_ += copy_bytes;
+      if (frame_pos_ == frame_size_) {
+        RETURN_NOT_OK(SubmitFrame());
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Flush() {
+    std::lock_guard<std::mutex> guard(lock_);
+
+    RETURN_NOT_OK(FlushFrames());
+    return raw_->Flush();
+  }
+
+  Status Close() {
+    std::lock_guard<std::mutex> guard(lock_);
+
+    if (is_open_) {
+      is_open_ = false;
+      if (!has_frames_ && !frame_) {
+        // Write a valid compressed stream even when no data was written
+        RETURN_NOT_OK(SubmitFrame());
+      }
+      RETURN_NOT_OK(FlushFrames());
+      return raw_->Close();
+    } else {
+      return Status::OK();
+    }
+  }
+
+  Status Abort() {
+    std::lock_guard<std::mutex> guard(lock_);
+
+    if (is_open_) {
+      is_open_ = false;
+      for (auto& future : pending_) {
+        future.Wait();
+      }
+      pending_.clear();
+      return raw_->Abort();
+    } else {
+      return Status::OK();
+    }
+  }
+
+  bool closed() {
+    std::lock_guard<std::mutex> guard(lock_);
+    return !is_open_;
+  }
+
+ private:
+  // Compress the current frame, even if it isn't full
+  Status SubmitFrame() {
+    std::shared_ptr<Buffer> input;
+    if (frame_) {
+      RETURN_NOT_OK(frame_->Resize(frame_pos_));
+      input = std::move(frame_);
+      frame_.reset();
+      frame_pos_ = 0;
+    } else {
+      input = std::make_shared<Buffer>(nullptr, 0);
+    }
+    // Each frame is compressed as a separate stream
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Compressor> compressor,
+                          codec_->MakeCompressor());
+    MemoryPool* pool = pool_;
+    auto task = [input, compressor, pool]() -> Result<std::shared_ptr<Buffer>> {
+      return CompressBuffer(compressor.get(), *input, pool);
+    };
+    if (executor_->OwnsThisThread()) {
+      // Waiting for the task from a thread of the pool could deadlock
+      using BufferFuture = Future<std::shared_ptr<Buffer>>;
+      pending_.push_back(BufferFuture::MakeFinished(task()));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(auto future, executor_->Submit(std::move(task)));
+      pending_.push_back(std::move(future));
+    }
+    has_frames_ = true;
+
+    // Write the frames compressed so far, and bound the number of frames in
+    // flight to limit memory use
+    while (!pending_.empty() &&
+           (static_cast<int>(pending_.size()) > max_pending_ ||
+            IsFutureFinished(pending_.front().state()))) {
+      RETURN_NOT_OK(WriteNextFrame());
+    }
+    return Status::OK();
+  }
+
+  // Write the oldest compressed frame, waiting for it if necessary
+  Status WriteNextFrame() {
+    auto future = std::move(pending_.front());
+    pending_.pop_front();
+    ARROW_ASSIGN_OR_RAISE(auto compressed, future.result());
+    return raw_->Write(compressed);
+  }
+
+  // Compress the current frame and write all pending frames
+  Status FlushFrames() {
+    if (frame_ && frame_pos_ > 0) {
+      RETURN_NOT_OK(SubmitFrame());
+    }
+    while (!pending_.empty()) {
+      RETURN_NOT_OK(WriteNextFrame());
+    }
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  std::shared_ptr<OutputStream> raw_;
+  const int64_t frame_size_;
+  Codec* codec_ = NULLPTR;
+  ::arrow::internal::ThreadPool* executor_;
+  const int max_pending_;
+  bool is_open_ = false;
+
+  // Uncompressed data of the current frame
+  std::shared_ptr<ResizableBuffer> frame_;
+  int64_t frame_pos_ = 0;
+  // Compressed frames, in output order
+  std::deque<Future<std::shared_ptr<Buffer>>> pending_;
+  bool has_frames_ = false;
+  // Total number of bytes compressed
+  int64_t total_pos_ = 0;
+
+  mutable std::mutex lock_;
+};
+
+constexpr int64_t ParallelCompressedOutputStream::kDefaultFrameSize;
+
+Result<std::shared_ptr<ParallelCompressedOutputStream>>
+ParallelCompressedOutputStream::Make(Codec* codec,
+                                     const std::shared_ptr<OutputStream>& raw,
+                                     int64_t frame_size, MemoryPool* pool) {
+  // CAUTION: codec is not owned
+  std::shared_ptr<ParallelCompressedOutputStream> res(new ParallelCompressedOutputStream);
+  res->impl_.reset(new Impl(pool, raw, frame_size));
+  RETURN_NOT_OK(res->impl_->Init(codec));
+  return res;
+}
+
+ParallelCompressedOutputStream::~ParallelCompressedOutputStream() {
+  internal::CloseFromDestructor(this);
+}
+
+Status ParallelCompressedOutputStream::Close() { return impl_->Close(); }
+
+Status ParallelCompressedOutputStream::Abort() { return impl_->Abort(); }
+
+bool ParallelCompressedOutputStream::closed() const { return impl_->closed(); }
+
+Result<int64_t> ParallelCompressedOutputStream::Tell() const { return impl_->Tell(); }
+
+Status ParallelCompressedOutputStream::Write(const void* data, int64_t nbytes) {
+  return impl_->Write(data, nbytes);
+}
+
+Status ParallelCompressedOutputStream::Flush() { return impl_->Flush(); }
+
+std::shared_ptr<OutputStream> ParallelCompressedOutputStream::raw() const {
+  return impl_->raw();
+}
+
 }  // namespace io
 }  // namespace arrow
@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -111,5 +112,101 @@ class ARROW_EXPORT CompressedInputStream
   std::unique_ptr<Impl> impl_;
 };
 
+/// \brief An input stream decompressing independent frames on several threads
+///
+/// The compressed input is split at frame boundaries, as reported by
+/// Codec::FindFrameSize(), and runs of frames are decompressed concurrently
+/// on the CPU thread pool, ahead of the reader.  This applies for example to
+/// multi-frame Zstandard data or BGZF-style gzip files.  When the input
+/// cannot be split, decompression falls back to a single streaming
+/// decompressor, like CompressedInputStream.
+class ARROW_EXPORT ParallelCompressedInputStream
+    : public internal::InputStreamConcurrencyWrapper<ParallelCompressedInputStream> {
+ public:
+  ~ParallelCompressedInputStream() override;
+
+  /// \brief Create a parallel decompressing stream wrapping the given input stream.
+  static Result<std::shared_ptr<ParallelCompressedInputStream>> Make(
+      util::Codec* codec, const std::shared_ptr<InputStream>& raw,
+      MemoryPool* pool = default_memory_pool());
+
+  // InputStream interface
+
+  bool closed() const override;
+
+  /// \brief Return the underlying raw input stream.
+  std::shared_ptr<InputStream> raw() const;
+
+ private:
+  friend InputStreamConcurrencyWrapper<ParallelCompressedInputStream>;
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ParallelCompressedInputStream);
+
+  ParallelCompressedInputStream() = default;
+
+  /// \brief Close the stream.  This implicitly closes the underlying raw
+  /// input stream.
+  Status DoClose();
+  Status DoAbort() override;
+  Result<int64_t> DoTell() const;
+  Result<int64_t> DoRead(int64_t nbytes, void* out);
+  Result<std::shared_ptr<Buffer>> DoRead(int64_t nbytes);
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief An output stream compressing independent frames on several threads
+///
+/// The written data is cut into runs of frame_size bytes, each compressed as
+/// a separate stream by its own Compressor on the CPU thread pool, and the
+/// compressed frames are written to the raw stream in order.  Whatever the
+/// codec, the output can be read back by CompressedInputStream, as a
+/// concatenation of streams.  When the codec can delimit frames without
+/// decompressing them, as Zstandard can, ParallelCompressedInputStream also
+/// decompresses it in parallel.
+///
+/// Each frame is compressed without the history of the previous ones, so
+/// smaller frames compress worse.  Flush() ends the current frame early.
+///
+/// \since 2.0.0
+class ARROW_EXPORT ParallelCompressedOutputStream : public OutputStream {
+ public:
+  static constexpr int64_t kDefaultFrameSize = 4 * 1024 * 1024;
+
+  ~ParallelCompressedOutputStream() override;
+
+  /// \brief Create a parallel compressing stream wrapping the given output stream.
+  static Result<std::shared_ptr<ParallelCompressedOutputStream>> Make(
+      util::Codec* codec, const std::shared_ptr<OutputStream>& raw,
+      int64_t frame_size = kDefaultFrameSize, MemoryPool* pool = default_memory_pool());
+
+  // OutputStream interface
+
+  /// \brief Close the stream, after writing all pending frames.  This
+  /// implicitly closes the underlying raw output stream.
+  Status Close() override;
+  Status Abort() override;
+  bool closed() const override;
+
+  Result<int64_t> Tell() const override;
+
+  Status Write(const void* data, int64_t nbytes) override;
+  /// \cond FALSE
+  using Writable::Write;
+  /// \endcond
+  Status Flush() override;
+
+  /// \brief Return the underlying raw output stream.
+  std::shared_ptr<OutputStream> raw() const;
+
+ private:
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ParallelCompressedOutputStream);
+
+  ParallelCompressedOutputStream() = default;
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace io
 }  // namespace arrow
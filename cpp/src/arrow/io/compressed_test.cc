@@ -221,6 +221,121 @@ TEST_P(CompressedInputStreamTest, ConcatenatedStreams) {
   ASSERT_EQ(decompressed, expected);
 }
 
+// ----------------------------------------------------------------------
+// ParallelCompressedInputStream tests
+
+// Turn a gzip member into a BGZF block, recording its size in the header
+std::shared_ptr<Buffer> MakeBGZFBlock(const Buffer& member) {
+  constexpr int64_t kHeaderSize = 10;
+  constexpr uint8_t kFlagExtra = 0x04;
+  const int64_t block_size = member.size() + 8;
+  std::string block(reinterpret_cast<const char*>(member.data()), kHeaderSize);
+  block[3] = static_cast<char>(block[3] | kFlagExtra);
+  const auto size_lo = static_cast<uint8_t>((block_size - 1) & 0xff);
+  const auto size_hi = static_cast<uint8_t>((block_size - 1) >> 8);
+  const uint8_t extra[] = {6, 0, 'B', 'C', 2, 0, size_lo, size_hi};
+  block.append(reinterpret_cast<const char*>(extra), sizeof(extra));
+  block.append(reinterpret_cast<const char*>(member.data()) + kHeaderSize,
+               member.size() - kHeaderSize);
+  return Buffer::FromString(std::move(block));
+}
+
+class ParallelCompressedInputStreamTest
+    : public ::testing::TestWithParam<Compression::type> {
+ protected:
+  Compression::type GetCompression() { return GetParam(); }
+
+  std::unique_ptr<Codec> MakeCodec() { return *Codec::Create(GetCompression()); }
+
+  // Compress the data as independently decompressible frames
+  std::shared_ptr<Buffer> CompressFrames(Codec* codec, const std::vector<uint8_t>& data,
+                                         int64_t frame_size) {
+    BufferVector frames;
+    for (int64_t offset = 0; offset < static_cast<int64_t>(data.size());
+         offset += frame_size) {
+      const auto end = std::min(static_cast<int64_t>(data.size()), offset + frame_size);
+      auto frame = CompressDataOneShot(
+          codec, std::vector<uint8_t>(data.begin() + offset, data.begin() + end));
+      if (GetCompression() == Compression::GZIP) {
+        frame = MakeBGZFBlock(*frame);
+      }
+      frames.push_back(std::move(frame));
+    }
+    return *ConcatenateBuffers(frames);
+  }
+
+  Status Decompress(Codec* codec, const std::shared_ptr<Buffer>& compressed,
+                    int64_t read_size, std::vector<uint8_t>* out) {
+    auto buffer_reader = std::make_shared<BufferReader>(compressed);
+    ARROW_ASSIGN_OR_RAISE(auto stream,
+                          ParallelCompressedInputStream::Make(codec, buffer_reader));
+    std::vector<uint8_t> decompressed;
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(auto buf, stream->Read(read_size));
+      if (buf->size() == 0) {
+        break;
+      }
+      decompressed.insert(decompressed.end(), buf->data(), buf->data() + buf->size());
+    }
+    ARROW_ASSIGN_OR_RAISE(auto pos, stream->Tell());
+    if (pos != static_cast<int64_t>(decompressed.size())) {
+      return Status::Invalid("Unexpected stream position");
+    }
+    *out = std::move(decompressed);
+    return Status::OK();
+  }
+};
+
+TEST_P(ParallelCompressedInputStreamTest, Frames) {
+  auto codec = MakeCodec();
+  auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
+  auto random_data = MakeRandomData(RANDOM_DATA_SIZE);
+  data.insert(data.end(), random_data.begin(), random_data.end());
+
+  // BGZF blocks are limited to 64 kB, but Zstandard frames can be larger
+  // than the stream's internal chunks
+  std::vector<int64_t> frame_sizes = {20000, 60000};
+  if (GetCompression() != Compression::GZIP) {
+    frame_sizes.push_back(3 * 1024 * 1024);
+  }
+  for (const int64_t frame_size : frame_sizes) {
+    auto compressed = CompressFrames(codec.get(), data, frame_size);
+    for (const int64_t read_size : {1111, 1 << 20}) {
+      std::vector<uint8_t> decompressed;
+      ASSERT_OK(Decompress(codec.get(), compressed, read_size, &decompressed));
+      ASSERT_EQ(decompressed.size(), data.size());
+      ASSERT_EQ(decompressed, data);
+    }
+  }
+}
+
+TEST_P(ParallelCompressedInputStreamTest, ConcatenatedStreams) {
+  // Plain gzip members don't record their size, decompression then falls back
+  // to a single decompressor
+  auto codec = MakeCodec();
+  auto data1 = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
+  auto data2 = MakeRandomData(200);
+  auto compressed1 = CompressDataOneShot(codec.get(), data1);
+  auto compressed2 = CompressDataOneShot(codec.get(), data2);
+  ASSERT_OK_AND_ASSIGN(auto concatenated, ConcatenateBuffers({compressed1, compressed2}));
+
+  std::vector<uint8_t> decompressed, expected;
+  ASSERT_OK(Decompress(codec.get(), concatenated, 1111, &decompressed));
+  std::copy(data1.begin(), data1.end(), std::back_inserter(expected));
+  std::copy(data2.begin(), data2.end(), std::back_inserter(expected));
+  ASSERT_EQ(decompressed, expected);
+}
+
+TEST_P(ParallelCompressedInputStreamTest, TruncatedData) {
+  auto codec = MakeCodec();
+  auto data = MakeRandomData(100000);
+  auto compressed = CompressFrames(codec.get(), data, 30000);
+  auto truncated = SliceBuffer(compressed, 0, compressed->size() - 3);
+
+  std::vector<uint8_t> decompressed;
+  ASSERT_RAISES(IOError, Decompress(codec.get(), truncated, 1111, &decompressed));
+}
+
 TEST_P(CompressedOutputStreamTest, CompressibleData) {
   auto codec = MakeCodec();
   auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
@@ -237,6 +352,115 @@ TEST_P(CompressedOutputStreamTest, RandomData) {
   CheckCompressedOutputStream(codec.get(), data, true /* do_flush */);
 }
 
+// ----------------------------------------------------------------------
+// ParallelCompressedOutputStream tests
+
+class ParallelCompressedOutputStreamTest
+    : public ::testing::TestWithParam<Compression::type> {
+ protected:
+  Compression::type GetCompression() { return GetParam(); }
+
+  std::unique_ptr<Codec> MakeCodec() { return *Codec::Create(GetCompression()); }
+
+  std::shared_ptr<Buffer> Compress(Codec* codec, const std::vector<uint8_t>& data,
+                                   int64_t frame_size, bool do_flush) {
+    auto buffer_writer = *BufferOutputStream::Create();
+    auto stream = *ParallelCompressedOutputStream::Make(codec, buffer_writer, frame_size);
+    EXPECT_EQ(0, *stream->Tell());
+
+    const uint8_t* input = data.data();
+    int64_t input_len = data.size();
+    const int64_t chunk_size = 11111;
+    while (input_len > 0) {
+      int64_t nbytes = std::min(chunk_size, input_len);
+      ARROW_EXPECT_OK(stream->Write(input, nbytes));
+      input += nbytes;
+      input_len -= nbytes;
+      if (do_flush) {
+        ARROW_EXPECT_OK(stream->Flush());
+      }
+    }
+    EXPECT_EQ(static_cast<int64_t>(data.size()), *stream->Tell());
+    ARROW_EXPECT_OK(stream->Close());
+    return *buffer_writer->Finish();
+  }
+
+  void CheckRoundtrip(const std::vector<uint8_t>& data, int64_t frame_size,
+                      bool do_flush) {
+    auto codec = MakeCodec();
+    auto compressed = Compress(codec.get(), data, frame_size, do_flush);
+
+    // The frames are concatenated streams
+    std::vector<uint8_t> decompressed;
+    ASSERT_OK(RunCompressedInputStream(codec.get(), compressed, &decompressed));
+    ASSERT_EQ(decompressed.size(), data.size());
+    ASSERT_EQ(decompressed, data);
+  }
+};
+
+TEST_P(ParallelCompressedOutputStreamTest, CompressibleData) {
+  auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
+  for (const int64_t frame_size :
+       {int64_t(100000), ParallelCompressedOutputStream::kDefaultFrameSize}) {
+    CheckRoundtrip(data, frame_size, false /* do_flush */);
+  }
+  CheckRoundtrip(data, 100000, true /* do_flush */);
+}
+
+TEST_P(ParallelCompressedOutputStreamTest, RandomData) {
+  auto data = MakeRandomData(RANDOM_DATA_SIZE);
+  for (const int64_t frame_size :
+       {int64_t(100000), ParallelCompressedOutputStream::kDefaultFrameSize}) {
+    CheckRoundtrip(data, frame_size, false /* do_flush */);
+  }
+}
+
+TEST_P(ParallelCompressedOutputStreamTest, EmptyData) {
+  CheckRoundtrip({}, 100000, false /* do_flush */);
+}
+
+TEST_P(ParallelCompressedOutputStreamTest, InvalidFrameSize) {
+  auto codec = MakeCodec();
+  ASSERT_OK_AND_ASSIGN(auto buffer_writer, BufferOutputStream::Create());
+  ASSERT_RAISES(Invalid,
+                ParallelCompressedOutputStream::Make(codec.get(), buffer_writer, 0));
+}
+
+#ifdef ARROW_WITH_ZSTD
+TEST(TestZSTDParallelOutputStream, ParallelRoundtrip) {
+  // Zstandard frames can be found without decompressing them, so the output
+  // is also decompressed in parallel
+  ASSERT_OK_AND_ASSIGN(auto codec, Codec::Create(Compression::ZSTD));
+  auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
+  auto random_data = MakeRandomData(RANDOM_DATA_SIZE);
+  data.insert(data.end(), random_data.begin(), random_data.end());
+
+  ASSERT_OK_AND_ASSIGN(auto buffer_writer, BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto stream, ParallelCompressedOutputStream::Make(
+                                        codec.get(), buffer_writer, 1 << 20));
+  ASSERT_OK(stream->Write(data.data(), data.size()));
+  ASSERT_OK(stream->Close());
+  ASSERT_OK_AND_ASSIGN(auto compressed, buffer_writer->Finish());
+
+  ASSERT_OK_AND_ASSIGN(auto first_frame_size,
+                       codec->FindFrameSize(compressed->size(), compressed->data()));
+  ASSERT_LT(first_frame_size, compressed->size());
+
+  auto buffer_reader = std::make_shared<BufferReader>(compressed);
+  ASSERT_OK_AND_ASSIGN(auto input,
+                       ParallelCompressedInputStream::Make(codec.get(), buffer_reader));
+  std::vector<uint8_t> decompressed;
+  while (true) {
+    ASSERT_OK_AND_ASSIGN(auto buf, input->Read(1 << 20));
+    if (buf->size() == 0) {
+      break;
+    }
+    decompressed.insert(decompressed.end(), buf->data(), buf->data() + buf->size());
+  }
+  ASSERT_EQ(decompressed, data);
+}
+#endif
+
 // NOTES:
 // - Snappy doesn't support streaming decompression
 // - BZ2 doesn't support one-shot compression
@@ -263,6 +487,10 @@ INSTANTIATE_TEST_SUITE_P(TestGZipInputStream, CompressedInputStreamTest,
                          ::testing::Values(Compression::GZIP));
 INSTANTIATE_TEST_SUITE_P(TestGZipOutputStream, CompressedOutputStreamTest,
                          ::testing::Values(Compression::GZIP));
+INSTANTIATE_TEST_SUITE_P(TestGZipParallelOutputStream, ParallelCompressedOutputStreamTest,
+                         ::testing::Values(Compression::GZIP));
+INSTANTIATE_TEST_SUITE_P(TestGZipParallelInputStream, ParallelCompressedInputStreamTest,
+                         ::testing::Values(Compression::GZIP));
 #endif
 
 #ifdef ARROW_WITH_BROTLI
@@ -270,6 +498,8 @@ INSTANTIATE_TEST_SUITE_P(TestBrotliInputStream, CompressedInputStreamTest,
                          ::testing::Values(Compression::BROTLI));
 INSTANTIATE_TEST_SUITE_P(TestBrotliOutputStream, CompressedOutputStreamTest,
                          ::testing::Values(Compression::BROTLI));
+INSTANTIATE_TEST_SUITE_P(TestBrotliParallelOutputStream,
+                         ParallelCompressedOutputStreamTest, ::testing::Values(Compression::BROTLI));
 #endif
 
 #ifdef ARROW_WITH_LZ4
@@ -277,6 +507,8 @@ INSTANTIATE_TEST_SUITE_P(TestLZ4InputStream, CompressedInputStreamTest,
                          ::testing::Values(Compression::LZ4_FRAME));
 INSTANTIATE_TEST_SUITE_P(TestLZ4OutputStream, CompressedOutputStreamTest,
                          ::testing::Values(Compression::LZ4_FRAME));
+INSTANTIATE_TEST_SUITE_P(TestLZ4ParallelOutputStream, ParallelCompressedOutputStreamTest,
+                         ::testing::Values(Compression::LZ4_FRAME));
 #endif
 
 #ifdef ARROW_WITH_ZSTD
@@ -284,6 +516,10 @@ INSTANTIATE_TEST_SUITE_P(TestZSTDInputStream, CompressedInputStreamTest,
                          ::testing::Values(Compression::ZSTD));
 INSTANTIATE_TEST_SUITE_P(TestZSTDOutputStream, CompressedOutputStreamTest,
                          ::testing::Values(Compression::ZSTD));
+INSTANTIATE_TEST_SUITE_P(TestZSTDParallelOutputStream, ParallelCompressedOutputStreamTest,
+                         ::testing::Values(Compression::ZSTD));
+INSTANTIATE_TEST_SUITE_P(TestZSTDParallelInputStream, ParallelCompressedInputStreamTest,
+                         ::testing::Values(Compression::ZSTD));
 #endif
 
 }  // namespace io
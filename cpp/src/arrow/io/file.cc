@@ -52,6 +52,7 @@
 #include "arrow/buffer.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/future.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
@@ -188,6 +189,22 @@ class OSFile {
                                         length);
   }
 
+  Status WriteBuffers(const std::vector<std::shared_ptr<Buffer>>& data) {
+    RETURN_NOT_OK(CheckClosed());
+
+    std::vector<::arrow::internal::MemoryRegion> regions;
+    regions.reserve(data.size());
+    for (const auto& buffer : data) {
+      if (buffer) {
+        regions.push_back({const_cast<uint8_t*>(buffer->data()),
+                           static_cast<size_t>(buffer->size())});
+      }
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckPositioned());
+    return ::arrow::internal::FileWriteV(fd_, regions);
+  }
+
   int fd() const { return fd_; }
 
   bool is_open() const { return is_open_; }
@@ -236,6 +253,13 @@ class OSFile {
 // ----------------------------------------------------------------------
 // ReadableFile implementation
 
+// Filesystems may report a large preferred I/O size, which isn't worth
+// expanding every direct read to
+constexpr int64_t kMinDirectAlignment = 512;
+constexpr int64_t kMaxDirectAlignment = 64 * 1024;
+constexpr int64_t kDefaultDirectAlignment = 4096;
+constexpr int64_t kMaxDirectChunkSize = 1 << 30;
+
 class ReadableFile::ReadableFileImpl : public OSFile {
  public:
   explicit ReadableFileImpl(MemoryPool* pool) : OSFile(), pool_(pool) {}
@@ -243,7 +267,53 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   Status Open(const std::string& path) { return OpenReadable(path); }
   Status Open(int fd) { return OpenReadable(fd); }
 
+  Status Open(const std::string& path, const ReadableFileOptions& options) {
+    if (options.direct_io) {
+      RETURN_NOT_OK(OpenUncached(path));
+    } else {
+      RETURN_NOT_OK(OpenReadable(path));
+    }
+    if (options.sequential && !direct_) {
+      RETURN_NOT_OK(::arrow::internal::FileAdvise(
+          fd_, 0, 0, ::arrow::internal::FileAdvice::SEQUENTIAL));
+    }
+    return Status::OK();
+  }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) {
+    if (!direct_ && !drop_cache_) {
+      return OSFile::Read(nbytes, out);
+    }
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPositioned());
+    ARROW_ASSIGN_OR_RAISE(int64_t position, ::arrow::internal::FileTell(fd_));
+    RETURN_NOT_OK(internal::ValidateRange(position, nbytes));
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                          UncachedReadAt(position, nbytes, static_cast<uint8_t*>(out)));
+    RETURN_NOT_OK(::arrow::internal::FileSeek(fd_, position + bytes_read));
+    return bytes_read;
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) {
+    if (!direct_ && !drop_cache_) {
+      return OSFile::ReadAt(position, nbytes, out);
+    }
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(internal::ValidateRange(position, nbytes));
+    need_seeking_.store(true);
+    return UncachedReadAt(position, nbytes, static_cast<uint8_t*>(out));
+  }
+
   Result<std::shared_ptr<Buffer>> ReadBuffer(int64_t nbytes) {
+    if (direct_) {
+      RETURN_NOT_OK(CheckClosed());
+      RETURN_NOT_OK(CheckPositioned());
+      ARROW_ASSIGN_OR_RAISE(int64_t position, ::arrow::internal::FileTell(fd_));
+      RETURN_NOT_OK(internal::ValidateRange(position, nbytes));
+      ARROW_ASSIGN_OR_RAISE(auto buffer, DirectReadBuffer(position, nbytes));
+      RETURN_NOT_OK(::arrow::internal::FileSeek(fd_, position + buffer->size()));
+      return std::move(buffer);
+    }
     ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
 
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, Read(nbytes, buffer->mutable_data()));
@@ -255,6 +325,12 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   }
 
   Result<std::shared_ptr<Buffer>> ReadBufferAt(int64_t position, int64_t nbytes) {
+    if (direct_) {
+      RETURN_NOT_OK(CheckClosed());
+      RETURN_NOT_OK(internal::ValidateRange(position, nbytes));
+      need_seeking_.store(true);
+      return DirectReadBuffer(position, nbytes);
+    }
     ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
 
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
@@ -268,6 +344,10 @@ class ReadableFile::ReadableFileImpl : public OSFile {
 
   Status WillNeed(const std::vector<ReadRange>& ranges) {
     RETURN_NOT_OK(CheckClosed());
+    if (direct_) {
+      // Direct reads don't go through the page cache
+      return Status::OK();
+    }
     for (const auto& range : ranges) {
       RETURN_NOT_OK(internal::ValidateRange(range.offset, range.length));
 #if defined(POSIX_FADV_WILLNEED)
@@ -287,8 +367,120 @@ class ReadableFile::ReadableFileImpl : public OSFile {
     return Status::OK();
   }
 
+  bool direct_io() const { return direct_; }
+
+  int64_t alignment() const { return alignment_; }
+
  private:
+  Status OpenUncached(const std::string& path) {
+    RETURN_NOT_OK(SetFileName(path));
+    auto maybe_fd = ::arrow::internal::FileOpenReadableDirect(file_name_);
+    if (!maybe_fd.ok() && !(maybe_fd.status().IsNotImplemented() ||
+                            ::arrow::internal::ErrnoFromStatus(maybe_fd.status()) ==
+                                EINVAL)) {
+      return maybe_fd.status();
+    }
+    if (!maybe_fd.ok()) {
+      // No direct I/O on this platform or filesystem: evict the pages read
+      // instead
+      RETURN_NOT_OK(OpenReadable(path));
+      drop_cache_ = true;
+      return Status::OK();
+    }
+    fd_ = *maybe_fd;
+    is_open_ = true;
+    mode_ = FileMode::READ;
+    ARROW_ASSIGN_OR_RAISE(size_, ::arrow::internal::FileGetSize(fd_));
+    ARROW_ASSIGN_OR_RAISE(int64_t block_size,
+                          ::arrow::internal::FileGetBlockSize(fd_));
+    if (BitUtil::IsPowerOf2(block_size) && block_size >= kMinDirectAlignment &&
+        block_size <= kMaxDirectAlignment) {
+      alignment_ = block_size;
+    } else {
+      alignment_ = kDefaultDirectAlignment;
+    }
+    direct_ = true;
+    return Status::OK();
+  }
+
+  bool IsAligned(int64_t value) const { return (value & (alignment_ - 1)) == 0; }
+
+  Result<int64_t> UncachedReadAt(int64_t position, int64_t nbytes, uint8_t* out) {
+    if (direct_) {
+      if (IsAligned(position) && IsAligned(nbytes) &&
+          IsAligned(static_cast<int64_t>(reinterpret_cast<uintptr_t>(out)))) {
+        return DirectReadAligned(position, nbytes, out);
+      }
+      ARROW_ASSIGN_OR_RAISE(auto buffer, DirectReadBuffer(position, nbytes));
+      if (buffer->size() > 0) {
+        std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+      }
+      return buffer->size();
+    }
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                          ::arrow::internal::FileReadAt(fd_, out, position, nbytes));
+    if (bytes_read > 0) {
+      RETURN_NOT_OK(::arrow::internal::FileAdvise(
+          fd_, position, bytes_read, ::arrow::internal::FileAdvice::DONT_NEED));
+    }
+    return bytes_read;
+  }
+
+  // Read the blocks covering [position, position + nbytes) into a buffer
+  // from the pool, and return a slice of the requested range
+  Result<std::shared_ptr<Buffer>> DirectReadBuffer(int64_t position, int64_t nbytes) {
+    const int64_t start = BitUtil::RoundDown(position, alignment_);
+    const int64_t length =
+        BitUtil::RoundUpToPowerOf2(position + nbytes, alignment_) - start;
+    // Memory pools only guarantee a 64-byte alignment, over-allocate and
+    // align the destination ourselves
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer,
+                          AllocateBuffer(length + alignment_, pool_));
+    const auto address = reinterpret_cast<uintptr_t>(buffer->data());
+    const auto padding = static_cast<int64_t>(
+        BitUtil::RoundUpToPowerOf2(static_cast<uint64_t>(address),
+                                   static_cast<uint64_t>(alignment_)) -
+        address);
+    ARROW_ASSIGN_OR_RAISE(
+        int64_t bytes_read,
+        DirectReadAligned(start, length, buffer->mutable_data() + padding));
+    const int64_t skip = position - start;
+    const int64_t size = std::max<int64_t>(0, std::min(bytes_read - skip, nbytes));
+    return SliceBuffer(std::move(buffer), padding + skip, size);
+  }
+
+  Result<int64_t> DirectReadAligned(int64_t position, int64_t nbytes, uint8_t* out) {
+#if defined(O_DIRECT)
+    int64_t bytes_read = 0;
+    while (bytes_read < nbytes) {
+      const int64_t chunk_size = std::min(kMaxDirectChunkSize, nbytes - bytes_read);
+      const auto ret = static_cast<int64_t>(
+          pread(fd_, out + bytes_read, static_cast<size_t>(chunk_size),
+                static_cast<off_t>(position + bytes_read)));
+      if (ret == -1) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return IOErrorFromErrno(errno, "Error reading bytes from file");
+      }
+      bytes_read += ret;
+      if (ret < chunk_size) {
+        // EOF: the next read wouldn't be aligned anymore
+        break;
+      }
+    }
+    return bytes_read;
+#else
+    return Status::NotImplemented("Direct I/O is not supported on this platform");
+#endif
+  }
+
   MemoryPool* pool_;
+  // Whether the file was opened with direct I/O
+  bool direct_ = false;
+  // Whether to evict the pages read from the page cache
+  bool drop_cache_ = false;
+  int64_t alignment_ = 1;
 };
 
 ReadableFile::ReadableFile(MemoryPool* pool) { impl_.reset(new ReadableFileImpl(pool)); }
@@ -308,6 +500,13 @@ Result<std::shared_ptr<ReadableFile>> ReadableFile::Open(int fd, MemoryPool* poo
   return file;
 }
 
+Result<std::shared_ptr<ReadableFile>> ReadableFile::Open(
+    const std::string& path, const ReadableFileOptions& options, MemoryPool* pool) {
+  auto file = std::shared_ptr<ReadableFile>(new ReadableFile(pool));
+  RETURN_NOT_OK(file->impl_->Open(path, options));
+  return file;
+}
+
 Status ReadableFile::DoClose() { return impl_->Close(); }
 
 bool ReadableFile::closed() const { return !impl_->is_open(); }
@@ -340,6 +539,10 @@ Status ReadableFile::DoSeek(int64_t pos) { return impl_->Seek(pos); }
 
 int ReadableFile::file_descriptor() const { return impl_->fd(); }
 
+bool ReadableFile::direct_io() const { return impl_->direct_io(); }
+
+int64_t ReadableFile::alignment() const { return impl_->alignment(); }
+
 // ----------------------------------------------------------------------
 // FileOutputStream
 
@@ -379,11 +582,17 @@ Status FileOutputStream::Write(const void* data, int64_t length) {
   return impl_->Write(data, length);
 }
 
+Status FileOutputStream::WriteBuffers(const std::vector<std::shared_ptr<Buffer>>& data) {
+  return impl_->WriteBuffers(data);
+}
+
 int FileOutputStream::file_descriptor() const { return impl_->fd(); }
 
 // ----------------------------------------------------------------------
 // Implement MemoryMappedFile
 
+MemoryMapOptions MemoryMapOptions::Defaults() { return MemoryMapOptions(); }
+
 class MemoryMappedFile::MemoryMap
     : public std::enable_shared_from_this<MemoryMappedFile::MemoryMap> {
  public:
@@ -439,8 +648,10 @@ class MemoryMappedFile::MemoryMap
   }
 
   Status Open(const std::string& path, FileMode::type mode, const int64_t offset = 0,
-              const int64_t length = -1) {
+              const int64_t length = -1,
+              const MemoryMapOptions& options = MemoryMapOptions::Defaults()) {
     file_.reset(new OSFile());
+    options_ = options;
 
     if (mode != FileMode::READ) {
       // Memory mapping has permission failures if PROT_READ not set
@@ -507,6 +718,7 @@ class MemoryMappedFile::MemoryMap
       if (position_ > map_len_) {
         position_ = map_len_;
       }
+      RETURN_NOT_OK(AdviseMapping());
     } else {
       DCHECK_EQ(position_, 0);
       // the mmap is not yet initialized, resize the underlying
@@ -556,7 +768,44 @@ class MemoryMappedFile::MemoryMap
 
   std::mutex& resize_lock() { return resize_lock_; }
 
+  Status AdviseAccessPattern(MemoryMapOptions::AccessPattern access_pattern) {
+    options_.access_pattern = access_pattern;
+    if (map_len_ == 0) {
+      // Applied once the file is mapped
+      return Status::OK();
+    }
+    return ::arrow::internal::MemoryAdviseAccessPattern(
+        data(), static_cast<size_t>(map_len_), ToMemoryAccessPattern(access_pattern));
+  }
+
  private:
+  static ::arrow::internal::MemoryAccessPattern ToMemoryAccessPattern(
+      MemoryMapOptions::AccessPattern access_pattern) {
+    switch (access_pattern) {
+      case MemoryMapOptions::SEQUENTIAL:
+        return ::arrow::internal::MemoryAccessPattern::SEQUENTIAL;
+      case MemoryMapOptions::RANDOM:
+        return ::arrow::internal::MemoryAccessPattern::RANDOM;
+      default:
+        return ::arrow::internal::MemoryAccessPattern::NORMAL;
+    }
+  }
+
+  // Apply the options to a new mapping
+  Status AdviseMapping() {
+    if (options_.huge_pages) {
+      // Only a hint: file-backed huge pages need recent kernels
+      ARROW_UNUSED(::arrow::internal::MemoryAdviseHugePages(
+          data(), static_cast<size_t>(map_len_)));
+    }
+    if (options_.access_pattern == MemoryMapOptions::NORMAL) {
+      return Status::OK();
+    }
+    return ::arrow::internal::MemoryAdviseAccessPattern(
+        data(), static_cast<size_t>(map_len_),
+        ToMemoryAccessPattern(options_.access_pattern));
+  }
+
   // Initialize the mmap and set size, capacity and the data pointers
   Status InitMMap(int64_t initial_size, bool resize_file = false,
                   const int64_t offset = 0, const int64_t length = -1) {
@@ -575,7 +824,13 @@ class MemoryMappedFile::MemoryMap
       mmap_length = static_cast<size_t>(length);
     }
 
-    void* result = mmap(nullptr, mmap_length, prot_flags_, map_mode_, file_->fd(),
+    int map_mode = map_mode_;
+#ifdef MAP_POPULATE
+    if (options_.populate) {
+      map_mode |= MAP_POPULATE;
+    }
+#endif
+    void* result = mmap(nullptr, mmap_length, prot_flags_, map_mode, file_->fd(),
                         static_cast<off_t>(offset));
     if (result == MAP_FAILED) {
       return Status::IOError("Memory mapping file failed: ",
@@ -587,12 +842,13 @@ class MemoryMappedFile::MemoryMap
                                        map_len_);
     file_size_ = initial_size;
 
-    return Status::OK();
+    return AdviseMapping();
   }
 
   std::unique_ptr<OSFile> file_;
   int prot_flags_;
   int map_mode_;
+  MemoryMapOptions options_;
 
   std::shared_ptr<Region> region_;
   int64_t file_size_;
@@ -623,6 +879,16 @@ Result<std::shared_ptr<MemoryMappedFile>> MemoryMappedFile::Open(const std::stri
   return result;
 }
 
+Result<std::shared_ptr<MemoryMappedFile>> MemoryMappedFile::Open(
+    const std::string& path, FileMode::type mode, const MemoryMapOptions& options) {
+  std::shared_ptr<MemoryMappedFile> result(new MemoryMappedFile());
+
+  result->memory_map_.reset(new MemoryMap());
+  RETURN_NOT_OK(result->memory_map_->Open(path, mode, /*offset=*/0, /*length=*/-1,
+                                          options));
+  return result;
+}
+
 Result<std::shared_ptr<MemoryMappedFile>> MemoryMappedFile::Open(const std::string& path,
                                                                  FileMode::type mode,
                                                                  const int64_t offset,
@@ -726,6 +992,15 @@ Status MemoryMappedFile::WillNeed(const std::vector<ReadRange>& ranges) {
   return ::arrow::internal::MemoryAdviseWillNeed(regions);
 }
 
+Status MemoryMappedFile::AdviseAccessPattern(
+    MemoryMapOptions::AccessPattern access_pattern) {
+  RETURN_NOT_OK(memory_map_->CheckClosed());
+  auto guard_resize = memory_map_->writable()
+                          ? std::unique_lock<std::mutex>(memory_map_->resize_lock())
+                          : std::unique_lock<std::mutex>();
+  return memory_map_->AdviseAccessPattern(access_pattern);
+}
+
 bool MemoryMappedFile::supports_zero_copy() const { return true; }
 
 Status MemoryMappedFile::WriteAt(int64_t position, const void* data, int64_t nbytes) {
@@ -754,6 +1029,30 @@ Status MemoryMappedFile::Write(const void* data, int64_t nbytes) {
   return WriteInternal(data, nbytes);
 }
 
+Status MemoryMappedFile::WriteBuffers(const std::vector<std::shared_ptr<Buffer>>& data) {
+  RETURN_NOT_OK(memory_map_->CheckClosed());
+  std::lock_guard<std::mutex> guard(memory_map_->write_lock());
+
+  if (!memory_map_->opened() || !memory_map_->writable()) {
+    return Status::IOError("Unable to write");
+  }
+  int64_t nbytes = 0;
+  for (const auto& buffer : data) {
+    if (buffer) {
+      nbytes += buffer->size();
+    }
+  }
+  RETURN_NOT_OK(
+      internal::ValidateWriteRange(memory_map_->position(), nbytes, memory_map_->size()));
+
+  for (const auto& buffer : data) {
+    if (buffer && buffer->size() > 0) {
+      RETURN_NOT_OK(WriteInternal(buffer->data(), buffer->size()));
+    }
+  }
+  return Status::OK();
+}
+
 Status MemoryMappedFile::WriteInternal(const void* data, int64_t nbytes) {
   memcpy(memory_map_->head(), data, static_cast<size_t>(nbytes));
   memory_map_->advance(nbytes);
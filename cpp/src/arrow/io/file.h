@@ -67,6 +67,8 @@ class ARROW_EXPORT FileOutputStream : public OutputStream {
 
   // Write bytes to the stream. Thread-safe
   Status Write(const void* data, int64_t nbytes) override;
+  // Write buffers to the stream with vectored writes. Thread-safe
+  Status WriteBuffers(const std::vector<std::shared_ptr<Buffer>>& data) override;
   /// \cond FALSE
   using Writable::Write;
   /// \endcond
@@ -80,6 +82,21 @@ class ARROW_EXPORT FileOutputStream : public OutputStream {
   std::unique_ptr<FileOutputStreamImpl> impl_;
 };
 
+/// \brief How a ReadableFile interacts with the OS page cache
+struct ARROW_EXPORT ReadableFileOptions {
+  /// Read bypassing the page cache, so that scanning large files doesn't evict
+  /// more useful data and saves a copy.
+  ///
+  /// Uses direct I/O (O_DIRECT) where both the platform and the filesystem
+  /// support it: reads are then expanded to the filesystem block size, into
+  /// suitably aligned memory.  Otherwise, the pages read are evicted from the
+  /// page cache after each read.
+  bool direct_io = false;
+  /// Advise the OS that the file will be read sequentially, which allows
+  /// for more aggressive read-ahead.
+  bool sequential = false;
+};
+
 /// \brief An operating system file open in read-only mode.
 ///
 /// Reads through this implementation are unbuffered.  If many small reads
@@ -97,6 +114,15 @@ class ARROW_EXPORT ReadableFile
   static Result<std::shared_ptr<ReadableFile>> Open(
       const std::string& path, MemoryPool* pool = default_memory_pool());
 
+  /// \brief Open a local file for reading with the given options
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] options how the file uses the page cache
+  /// \param[in] pool a MemoryPool for memory allocations
+  /// \return ReadableFile instance
+  static Result<std::shared_ptr<ReadableFile>> Open(
+      const std::string& path, const ReadableFileOptions& options,
+      MemoryPool* pool = default_memory_pool());
+
   /// \brief Open a local file for reading
   /// \param[in] fd file descriptor
   /// \param[in] pool a MemoryPool for memory allocations
@@ -111,6 +137,18 @@ class ARROW_EXPORT ReadableFile
 
   int file_descriptor() const;
 
+  /// \brief Whether reads use direct I/O
+  ///
+  /// If so, reads returning a Buffer are zero-copy slices of a larger,
+  /// block-aligned region.
+  bool direct_io() const;
+
+  /// \brief The alignment of direct I/O reads, 1 if direct I/O is not used
+  ///
+  /// Aligning read ranges to this value avoids reading the same blocks twice
+  /// (see CacheOptions::alignment).
+  int64_t alignment() const;
+
   Status WillNeed(const std::vector<ReadRange>& ranges) override;
 
  private:
@@ -136,6 +174,29 @@ class ARROW_EXPORT ReadableFile
   std::unique_ptr<ReadableFileImpl> impl_;
 };
 
+/// \brief Options for memory-mapping a file
+struct ARROW_EXPORT MemoryMapOptions {
+  /// \brief How the mapped file is expected to be accessed
+  enum AccessPattern : int8_t {
+    /// Default readahead around the pages that are touched
+    NORMAL,
+    /// Aggressive readahead, for scanning the file from start to end
+    SEQUENTIAL,
+    /// No readahead, only the pages touched or hinted with WillNeed() are read in
+    RANDOM
+  };
+
+  AccessPattern access_pattern = NORMAL;
+  /// Read the whole file in when mapping it (MAP_POPULATE, Linux only)
+  bool populate = false;
+  /// Ask for the mapping to be backed by transparent huge pages. This is a
+  /// hint that is ignored on platforms and kernels without support for huge
+  /// pages in the page cache.
+  bool huge_pages = false;
+
+  static MemoryMapOptions Defaults();
+};
+
 /// \brief A file interface that uses memory-mapped files for memory interactions
 ///
 /// This implementation supports zero-copy reads. The same class is used
@@ -155,6 +216,11 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
   static Result<std::shared_ptr<MemoryMappedFile>> Open(const std::string& path,
                                                         FileMode::type mode);
 
+  // mmap() with whole file, tuning the mapping with the given options
+  static Result<std::shared_ptr<MemoryMappedFile>> Open(const std::string& path,
+                                                        FileMode::type mode,
+                                                        const MemoryMapOptions& options);
+
   // mmap() with a region of file, the offset must be a multiple of the page size
   static Result<std::shared_ptr<MemoryMappedFile>> Open(const std::string& path,
                                                         FileMode::type mode,
@@ -190,10 +256,15 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
 
   Status WillNeed(const std::vector<ReadRange>& ranges) override;
 
+  /// Change how the whole mapping is expected to be accessed from now on
+  Status AdviseAccessPattern(MemoryMapOptions::AccessPattern access_pattern);
+
   bool supports_zero_copy() const override;
 
   /// Write data at the current position in the file. Thread-safe
   Status Write(const void* data, int64_t nbytes) override;
+  /// Copy buffers into the map at the current position in the file. Thread-safe
+  Status WriteBuffers(const std::vector<std::shared_ptr<Buffer>>& data) override;
   /// \cond FALSE
   using Writable::Write;
   /// \endcond
@@ -20,6 +20,7 @@
 #include <unistd.h>
 #endif
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <cstdio>
@@ -37,12 +38,14 @@
 #include "arrow/io/file.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/test_common.h"
+#include "arrow/io/uring_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/future.h"
 #include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
 
 namespace arrow {
 
@@ -168,6 +171,29 @@ TEST_F(TestFileOutputStream, FromFileDescriptor) {
   AssertFileContents(path_, data1 + data2);
 }
 
+TEST_F(TestFileOutputStream, WriteBuffers) {
+  OpenFile();
+
+  // More buffers than a single vectored write accepts on most systems
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  std::string expected;
+  for (int i = 0; i < 5000; ++i) {
+    auto data = std::to_string(i) + ",";
+    expected += data;
+    buffers.push_back(Buffer::FromString(data));
+  }
+  buffers.push_back(nullptr);
+  buffers.push_back(Buffer::FromString(""));
+  ASSERT_OK(file_->WriteBuffers(buffers));
+  ASSERT_OK(file_->WriteBuffers({}));
+  ASSERT_OK(file_->Write("end"));
+  ASSERT_OK_AND_EQ(static_cast<int64_t>(expected.size() + 3), file_->Tell());
+  ASSERT_OK(file_->Close());
+  ASSERT_RAISES(Invalid, file_->WriteBuffers(buffers));
+
+  AssertFileContents(path_, expected + "end");
+}
+
 TEST_F(TestFileOutputStream, InvalidWrites) {
   OpenFile();
 
@@ -486,6 +512,318 @@ TEST_F(TestReadableFile, ThreadSafety) {
   ASSERT_EQ(niter * 2, correct_count);
 }
 
+TEST_F(TestReadableFile, DirectIO) {
+  const int64_t size = 100000;
+  std::string data(static_cast<size_t>(size), '\0');
+  random_bytes(size, 42, reinterpret_cast<uint8_t*>(&data[0]));
+  {
+    std::ofstream stream;
+    stream.open(path_.c_str(), std::ios::binary);
+    stream << data;
+  }
+  auto expected = Buffer::FromString(data);
+
+  ReadableFileOptions options;
+  options.direct_io = true;
+  MyMemoryPool pool;
+  ASSERT_OK_AND_ASSIGN(file_, ReadableFile::Open(path_, options, &pool));
+  if (file_->direct_io()) {
+    ASSERT_GE(file_->alignment(), 512);
+  } else {
+    // Filesystem without direct I/O support
+    ASSERT_EQ(file_->alignment(), 1);
+  }
+  ASSERT_OK_AND_EQ(size, file_->GetSize());
+
+  // Aligned and unaligned ranges, including past the end of the file
+  std::vector<ReadRange> ranges = {{0, 4096},    {0, 1},        {1, 10},
+                                   {4000, 5000}, {8192, 100},   {12345, 54321},
+                                   {99990, 100}, {size - 1, 1}, {size, 10},
+                                   {0, size},    {0, size + 4096}};
+  for (const auto& range : ranges) {
+    SCOPED_TRACE("range = " + std::to_string(range.offset) + ", " +
+                 std::to_string(range.length));
+    const int64_t length = std::min(range.length, size - range.offset);
+    ASSERT_OK_AND_ASSIGN(auto buf, file_->ReadAt(range.offset, range.length));
+    AssertBufferEqual(*buf, *SliceBuffer(expected, range.offset, length));
+
+    std::vector<uint8_t> out(static_cast<size_t>(range.length) + 1);
+    ASSERT_OK_AND_EQ(length, file_->ReadAt(range.offset, range.length, out.data() + 1));
+    ASSERT_EQ(0, std::memcmp(out.data() + 1, data.data() + range.offset,
+                             static_cast<size_t>(length)));
+  }
+  ASSERT_RAISES(Invalid, file_->ReadAt(-1, 1));
+  ASSERT_RAISES(Invalid, file_->ReadAt(1, -1));
+
+  // Implicitly positioned reads
+  ASSERT_OK(file_->Seek(0));
+  ASSERT_OK_AND_ASSIGN(auto buf, file_->Read(1000));
+  AssertBufferEqual(*buf, *SliceBuffer(expected, 0, 1000));
+  uint8_t out[3000];
+  ASSERT_OK_AND_EQ(3000, file_->Read(3000, out));
+  ASSERT_EQ(0, std::memcmp(out, data.data() + 1000, 3000));
+  ASSERT_OK_AND_EQ(4000, file_->Tell());
+  ASSERT_OK(file_->Seek(size - 10));
+  ASSERT_OK_AND_ASSIGN(buf, file_->Read(100));
+  AssertBufferEqual(*buf, *SliceBuffer(expected, size - 10, 10));
+  ASSERT_OK_AND_EQ(size, file_->Tell());
+  ASSERT_OK_AND_ASSIGN(buf, file_->Read(100));
+  ASSERT_EQ(buf->size(), 0);
+
+  ASSERT_OK(file_->WillNeed({{0, 100}}));
+  ASSERT_GT(pool.num_allocations(), 0);
+  ASSERT_OK(file_->Close());
+  ASSERT_RAISES(Invalid, file_->ReadAt(0, 1));
+}
+
+TEST_F(TestReadableFile, SequentialHint) {
+  MakeTestFile();
+
+  ReadableFileOptions options;
+  options.sequential = true;
+  ASSERT_OK_AND_ASSIGN(file_, ReadableFile::Open(path_, options));
+  ASSERT_FALSE(file_->direct_io());
+  ASSERT_OK_AND_ASSIGN(auto buf, file_->Read(4));
+  AssertBufferEqual(*buf, "test");
+  ASSERT_OK_AND_ASSIGN(buf, file_->ReadAt(4, 10));
+  AssertBufferEqual(*buf, "data");
+}
+
+// ----------------------------------------------------------------------
+// io_uring file input tests
+
+#define SKIP_IF_NO_URING()                                   \
+  do {                                                       \
+    if (!internal::Uring::IsSupported()) {                   \
+      ARROW_LOG(INFO) << "io_uring not available, skipping"; \
+      return;                                                \
+    }                                                        \
+  } while (0)
+
+class TestUringReadableFile : public FileTestFixture {
+ public:
+  void SetUp() override {
+    FileTestFixture::SetUp();
+    if (internal::Uring::IsSupported()) {
+      ASSERT_OK_AND_ASSIGN(uring_, internal::Uring::Make(uring_options_));
+    }
+  }
+
+  void OpenFile(MemoryPool* pool = default_memory_pool()) {
+    ASSERT_OK_AND_ASSIGN(file_, internal::UringReadableFile::Open(path_, uring_, pool));
+  }
+
+  void MakeTestFile(const std::string& data = "testdata") {
+    std::ofstream stream;
+    stream.open(path_.c_str());
+    stream << data;
+  }
+
+ protected:
+  internal::UringOptions uring_options_;
+  std::shared_ptr<internal::Uring> uring_;
+  std::shared_ptr<internal::UringReadableFile> file_;
+};
+
+TEST_F(TestUringReadableFile, Close) {
+  SKIP_IF_NO_URING();
+  MakeTestFile();
+  OpenFile();
+
+  ASSERT_FALSE(file_->closed());
+  ASSERT_OK(file_->Close());
+  ASSERT_TRUE(file_->closed());
+  // Idempotent
+  ASSERT_OK(file_->Close());
+
+  ASSERT_RAISES(Invalid, file_->Read(1));
+  ASSERT_RAISES(Invalid, file_->ReadAt(0, 1));
+  ASSERT_RAISES(Invalid, file_->ReadAsync({}, 0, 1).result());
+}
+
+TEST_F(TestUringReadableFile, SeekTellSize) {
+  SKIP_IF_NO_URING();
+  MakeTestFile();
+  OpenFile();
+
+  ASSERT_OK_AND_EQ(0, file_->Tell());
+  ASSERT_OK(file_->Seek(4));
+  ASSERT_OK_AND_EQ(4, file_->Tell());
+  ASSERT_OK(file_->Seek(100));
+  ASSERT_OK_AND_EQ(100, file_->Tell());
+  ASSERT_OK_AND_EQ(8, file_->GetSize());
+}
+
+TEST_F(TestUringReadableFile, Read) {
+  SKIP_IF_NO_URING();
+  uint8_t buffer[50];
+
+  MakeTestFile();
+  OpenFile();
+
+  ASSERT_OK_AND_EQ(4, file_->Read(4, buffer));
+  ASSERT_EQ(0, std::memcmp(buffer, "test", 4));
+  ASSERT_OK_AND_EQ(4, file_->Read(10, buffer));
+  ASSERT_EQ(0, std::memcmp(buffer, "data", 4));
+  ASSERT_OK_AND_EQ(0, file_->Read(10, buffer));
+
+  ASSERT_OK(file_->Seek(1));
+  ASSERT_OK_AND_ASSIGN(auto buf, file_->Read(8));
+  AssertBufferEqual(*buf, "estdata");
+}
+
+TEST_F(TestUringReadableFile, ReadAt) {
+  SKIP_IF_NO_URING();
+  uint8_t buffer[50];
+
+  MakeTestFile();
+  OpenFile();
+
+  ASSERT_OK_AND_EQ(4, file_->ReadAt(0, 4, buffer));
+  ASSERT_EQ(0, std::memcmp(buffer, "test", 4));
+  ASSERT_OK_AND_EQ(7, file_->ReadAt(1, 10, buffer));
+  ASSERT_EQ(0, std::memcmp(buffer, "estdata", 7));
+
+  ASSERT_OK_AND_ASSIGN(auto buf, file_->ReadAt(2, 5));
+  AssertBufferEqual(*buf, "stdat");
+  ASSERT_OK_AND_ASSIGN(buf, file_->ReadAt(8, 5));
+  ASSERT_EQ(buf->size(), 0);
+
+  // Invalid reads
+  ASSERT_RAISES(Invalid, file_->ReadAt(-1, 1));
+  ASSERT_RAISES(Invalid, file_->ReadAt(1, -1));
+  ASSERT_RAISES(Invalid, file_->ReadAt(-1, 1, buffer));
+  ASSERT_RAISES(Invalid, file_->ReadAt(1, -1, buffer));
+  ASSERT_RAISES(IOError, file_->ReadAt(9, 1));
+}
+
+TEST_F(TestUringReadableFile, ReadAsync) {
+  SKIP_IF_NO_URING();
+  MakeTestFile();
+  OpenFile();
+
+  auto fut1 = file_->ReadAsync({}, 1, 10);
+  auto fut2 = file_->ReadAsync({}, 0, 4);
+  ASSERT_OK_AND_ASSIGN(auto buf1, fut1.result());
+  ASSERT_OK_AND_ASSIGN(auto buf2, fut2.result());
+  AssertBufferEqual(*buf1, "estdata");
+  AssertBufferEqual(*buf2, "test");
+
+  auto futures = file_->ReadManyAsync({{4, 4}, {-1, 2}, {0, 0}, {2, 3}});
+  ASSERT_EQ(futures.size(), 4);
+  ASSERT_OK_AND_ASSIGN(auto buf, futures[0].result());
+  AssertBufferEqual(*buf, "data");
+  ASSERT_RAISES(Invalid, futures[1].result());
+  ASSERT_OK_AND_ASSIGN(buf, futures[2].result());
+  ASSERT_EQ(buf->size(), 0);
+  ASSERT_OK_AND_ASSIGN(buf, futures[3].result());
+  AssertBufferEqual(*buf, "std");
+
+  // The file can be released while reads are pending
+  auto fut = file_->ReadAsync({}, 0, 8);
+  ASSERT_OK(file_->Close());
+  file_.reset();
+  ASSERT_OK_AND_ASSIGN(buf, fut.result());
+  AssertBufferEqual(*buf, "testdata");
+}
+
+TEST_F(TestUringReadableFile, LargeReads) {
+  SKIP_IF_NO_URING();
+  const int64_t size = 5 * 1024 * 1024 + 123;
+  std::string data(static_cast<size_t>(size), '\0');
+  random_bytes(size, 42, reinterpret_cast<uint8_t*>(&data[0]));
+  MakeTestFile(data);
+  OpenFile();
+
+  auto expected = Buffer::FromString(data);
+  ASSERT_OK_AND_ASSIGN(auto buf, file_->ReadAt(0, size));
+  AssertBufferEqual(*buf, *expected);
+  std::vector<ReadRange> ranges;
+  for (int64_t offset = 0; offset < size; offset += 100000) {
+    ranges.push_back({offset, 150000});
+  }
+  auto futures = file_->ReadManyAsync(ranges);
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    ASSERT_OK_AND_ASSIGN(buf, futures[i].result());
+    AssertBufferEqual(*buf, *SliceBuffer(expected, ranges[i].offset,
+                                         std::min(ranges[i].length,
+                                                  size - ranges[i].offset)));
+  }
+}
+
+TEST_F(TestUringReadableFile, RegisteredBuffers) {
+  SKIP_IF_NO_URING();
+  uring_options_.num_registered_buffers = 2;
+  uring_options_.registered_buffer_size = 4;
+  ASSERT_OK_AND_ASSIGN(uring_, internal::Uring::Make(uring_options_));
+  MakeTestFile();
+
+  MyMemoryPool pool;
+  OpenFile(&pool);
+  ASSERT_EQ(uring_->num_free_registered_buffers(), 2);
+
+  // Reads fitting in a registered buffer don't allocate
+  ASSERT_OK_AND_ASSIGN(auto buf1, file_->ReadAt(0, 4));
+  ASSERT_OK_AND_ASSIGN(auto buf2, file_->ReadAt(5, 4));
+  AssertBufferEqual(*buf1, "test");
+  AssertBufferEqual(*buf2, "ata");
+  ASSERT_EQ(uring_->num_free_registered_buffers(), 0);
+  ASSERT_EQ(pool.num_allocations(), 0);
+
+  // No registered buffer left, or too large a read
+  ASSERT_OK_AND_ASSIGN(auto buf3, file_->ReadAt(1, 2));
+  ASSERT_OK_AND_ASSIGN(auto buf4, file_->ReadAt(0, 8));
+  AssertBufferEqual(*buf3, "es");
+  AssertBufferEqual(*buf4, "testdata");
+  ASSERT_EQ(pool.num_allocations(), 2);
+
+  // Registered buffers are reused once released
+  buf1.reset();
+  ASSERT_EQ(uring_->num_free_registered_buffers(), 1);
+  ASSERT_OK_AND_ASSIGN(buf1, file_->ReadAsync({}, 4, 4).result());
+  AssertBufferEqual(*buf1, "data");
+  ASSERT_EQ(pool.num_allocations(), 2);
+
+  // The buffers outlive the file and the ring
+  file_.reset();
+  uring_.reset();
+  AssertBufferEqual(*buf1, "data");
+  AssertBufferEqual(*buf2, "ata");
+}
+
+TEST_F(TestUringReadableFile, ThreadSafety) {
+  SKIP_IF_NO_URING();
+  uring_options_.queue_depth = 4;
+  uring_options_.num_registered_buffers = 3;
+  ASSERT_OK_AND_ASSIGN(uring_, internal::Uring::Make(uring_options_));
+  std::string data = "foobar";
+  MakeTestFile(data);
+  OpenFile();
+
+  std::atomic<int> correct_count(0);
+  const int niter = 3000;
+  const int nthreads = 8;
+
+  auto ReadData = [&]() {
+    for (int i = 0; i < niter; ++i) {
+      const int offset = i % 3;
+      ASSERT_OK_AND_ASSIGN(auto buffer, file_->ReadAt(offset, 3));
+      if (0 == memcmp(data.c_str() + offset, buffer->data(), 3)) {
+        correct_count += 1;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < nthreads; ++i) {
+    threads.emplace_back(ReadData);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(niter * nthreads, correct_count);
+}
+
 // ----------------------------------------------------------------------
 // Pipe I/O tests using FileOutputStream
 // (cannot test using ReadableFile as it currently requires seeking)
@@ -671,6 +1009,66 @@ TEST_F(TestMemoryMappedFile, WillNeed) {
   ASSERT_RAISES(IOError, mmap->WillNeed({{1025, 1}}));  // Out of bounds
 }
 
+TEST_F(TestMemoryMappedFile, OpenWithOptions) {
+  const int64_t buffer_size = 1 << 16;
+  std::vector<uint8_t> buffer(buffer_size);
+  random_bytes(buffer_size, 0, buffer.data());
+
+  std::string path = "io-memory-map-options-test";
+  {
+    ASSERT_OK_AND_ASSIGN(auto mmap, InitMemoryMap(buffer_size, path));
+    ASSERT_OK(mmap->Write(buffer.data(), buffer_size));
+    ASSERT_OK(mmap->Close());
+  }
+
+  for (auto access_pattern : {MemoryMapOptions::NORMAL, MemoryMapOptions::SEQUENTIAL,
+                              MemoryMapOptions::RANDOM}) {
+    auto options = MemoryMapOptions::Defaults();
+    options.access_pattern = access_pattern;
+    options.populate = true;
+    options.huge_pages = true;
+    ASSERT_OK_AND_ASSIGN(auto mmap,
+                         MemoryMappedFile::Open(path, FileMode::READ, options));
+    ASSERT_OK_AND_ASSIGN(auto buf, mmap->ReadAt(100, 1000));
+    AssertBufferEqual(*buf, Buffer(buffer.data() + 100, 1000));
+
+    ASSERT_OK(mmap->AdviseAccessPattern(MemoryMapOptions::RANDOM));
+    ASSERT_OK(mmap->WillNeed({{0, 4}, {50000, 1000}}));
+    ASSERT_OK_AND_ASSIGN(buf, mmap->ReadAt(50000, 1000));
+    AssertBufferEqual(*buf, Buffer(buffer.data() + 50000, 1000));
+    ASSERT_OK(mmap->AdviseAccessPattern(MemoryMapOptions::SEQUENTIAL));
+    ASSERT_OK(mmap->Close());
+    ASSERT_RAISES(Invalid, mmap->AdviseAccessPattern(MemoryMapOptions::NORMAL));
+  }
+
+  // The access pattern survives a resize of a writable map
+  auto options = MemoryMapOptions::Defaults();
+  options.access_pattern = MemoryMapOptions::SEQUENTIAL;
+  ASSERT_OK_AND_ASSIGN(auto mmap,
+                       MemoryMappedFile::Open(path, FileMode::READWRITE, options));
+  ASSERT_OK(mmap->Resize(2 * buffer_size));
+  ASSERT_OK(mmap->WriteAt(buffer_size, buffer.data(), buffer_size));
+  ASSERT_OK_AND_ASSIGN(auto buf, mmap->ReadAt(buffer_size, buffer_size));
+  AssertBufferEqual(*buf, Buffer(buffer.data(), buffer_size));
+}
+
+TEST_F(TestMemoryMappedFile, WriteBuffers) {
+  std::string path = "io-memory-map-write-buffers-test";
+  ASSERT_OK_AND_ASSIGN(auto mmap, InitMemoryMap(10, path));
+
+  ASSERT_OK(mmap->Seek(1));
+  ASSERT_OK(mmap->WriteBuffers(
+      {Buffer::FromString("abc"), nullptr, Buffer::FromString("defg")}));
+  ASSERT_OK_AND_EQ(8, mmap->Tell());
+  // Nothing is written if the buffers don't all fit
+  ASSERT_RAISES(IOError,
+                mmap->WriteBuffers({Buffer::FromString("h"), Buffer::FromString("ijk")}));
+  ASSERT_OK_AND_EQ(8, mmap->Tell());
+
+  ASSERT_OK_AND_ASSIGN(auto buf, mmap->ReadAt(1, 7));
+  AssertBufferEqual(*buf, "abcdefg");
+}
+
 TEST_F(TestMemoryMappedFile, InvalidReads) {
   std::string path = "io-memory-map-invalid-reads-test";
   ASSERT_OK_AND_ASSIGN(auto result, InitMemoryMap(4096, path));
@@ -19,6 +19,7 @@
 #include <cerrno>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -117,6 +118,48 @@ Status GetPathInfoFailed(const std::string& path) {
 
 }  // namespace
 
+// State of a file opened for zero-copy reads, shared with the buffers mapping
+// its blocks: the file is only closed once they are all released.
+struct ZeroCopyReadState {
+  internal::LibHdfsShim* driver;
+  hdfsFS fs;
+  hdfsFile file;
+  hadoopRzOptions* options;
+
+  std::mutex mutex;
+  int64_t num_buffers = 0;
+  bool close_pending = false;
+
+  // Called with the mutex locked
+  int CloseFile() {
+    driver->RzOptionsFree(options);
+    return driver->CloseFile(fs, file);
+  }
+};
+
+// A buffer memory-mapping (part of) a local block
+class ZeroCopyBuffer : public Buffer {
+ public:
+  ZeroCopyBuffer(std::shared_ptr<ZeroCopyReadState> state, hadoopRzBuffer* rz_buffer,
+                 int64_t size)
+      : Buffer(static_cast<const uint8_t*>(state->driver->RzBufferGet(rz_buffer)), size),
+        state_(std::move(state)),
+        rz_buffer_(rz_buffer) {}
+
+  ~ZeroCopyBuffer() override {
+    std::lock_guard<std::mutex> guard(state_->mutex);
+    state_->driver->RzBufferFree(state_->file, rz_buffer_);
+    if (--state_->num_buffers == 0 && state_->close_pending) {
+      // The file was closed while this buffer was alive, errors can't be reported
+      ARROW_UNUSED(state_->CloseFile());
+    }
+  }
+
+ private:
+  std::shared_ptr<ZeroCopyReadState> state_;
+  hadoopRzBuffer* rz_buffer_;
+};
+
 // Private implementation for read-only files
 class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
  public:
@@ -129,12 +172,41 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
       // the error doesn't get propagated properly and the second close
       // initiated by the destructor raises a segfault
       is_open_ = false;
+      if (zero_copy_ != nullptr) {
+        std::lock_guard<std::mutex> guard(zero_copy_->mutex);
+        if (zero_copy_->num_buffers > 0) {
+          // Closed by the last buffer
+          zero_copy_->close_pending = true;
+          return Status::OK();
+        }
+        int ret = zero_copy_->CloseFile();
+        CHECK_FAILURE(ret, "CloseFile");
+        return Status::OK();
+      }
       int ret = driver_->CloseFile(fs_, file_);
       CHECK_FAILURE(ret, "CloseFile");
     }
     return Status::OK();
   }
 
+  void EnableZeroCopyReads(bool skip_checksums) {
+    if (!driver_->HasReadZero()) {
+      return;
+    }
+    hadoopRzOptions* options = driver_->RzOptionsAlloc();
+    if (options == nullptr) {
+      return;
+    }
+    // Without a byte buffer pool, reads which can't be mapped fail rather than
+    // being copied through the JVM, and are then done by ReadAt() as usual
+    driver_->RzOptionsSetSkipChecksum(options, skip_checksums ? 1 : 0);
+    zero_copy_ = std::make_shared<ZeroCopyReadState>();
+    zero_copy_->driver = driver_;
+    zero_copy_->fs = fs_;
+    zero_copy_->file = file_;
+    zero_copy_->options = options;
+  }
+
   bool closed() const { return !is_open_; }
 
   Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* buffer) {
@@ -151,6 +223,14 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
   }
 
   Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) {
+    if (zero_copy_ != nullptr && nbytes > 0 &&
+        nbytes <= std::numeric_limits<int32_t>::max()) {
+      ARROW_ASSIGN_OR_RAISE(auto mapped, ReadAtZeroCopy(position, nbytes));
+      if (mapped != nullptr) {
+        return mapped;
+      }
+    }
+
     ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
 
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
@@ -204,8 +284,36 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
   void set_buffer_size(int32_t buffer_size) { buffer_size_ = buffer_size; }
 
  private:
+  // Return null if the range can't be mapped in one piece, e.g. because it isn't
+  // within a single local block
+  Result<std::shared_ptr<Buffer>> ReadAtZeroCopy(int64_t position, int64_t nbytes) {
+    // Zero-copy reads are stream reads, restore the stream position afterwards
+    std::lock_guard<std::mutex> guard(lock_);
+    ARROW_ASSIGN_OR_RAISE(int64_t stream_position, Tell());
+    RETURN_NOT_OK(Seek(position));
+
+    std::shared_ptr<Buffer> mapped;
+    {
+      std::lock_guard<std::mutex> state_guard(zero_copy_->mutex);
+      hadoopRzBuffer* rz_buffer =
+          driver_->ReadZero(file_, zero_copy_->options, static_cast<int32_t>(nbytes));
+      if (rz_buffer != nullptr) {
+        if (driver_->RzBufferLength(rz_buffer) == nbytes) {
+          ++zero_copy_->num_buffers;
+          mapped = std::make_shared<ZeroCopyBuffer>(zero_copy_, rz_buffer, nbytes);
+        } else {
+          // Stopped at the end of a block, or of the file
+          driver_->RzBufferFree(file_, rz_buffer);
+        }
+      }
+    }
+    RETURN_NOT_OK(Seek(stream_position));
+    return mapped;
+  }
+
   MemoryPool* pool_;
   int32_t buffer_size_;
+  std::shared_ptr<ZeroCopyReadState> zero_copy_;
 };
 
 HdfsReadableFile::HdfsReadableFile(MemoryPool* pool) {
@@ -347,7 +455,18 @@ class HadoopFileSystem::HadoopFileSystemImpl {
       driver_->BuilderSetKerbTicketCachePath(builder, config->kerb_ticket.c_str());
     }
 
+    std::unordered_map<std::string, std::string> conf;
+    if (config->short_circuit_reads) {
+      conf["dfs.client.read.shortcircuit"] = "true";
+      if (!config->domain_socket_path.empty()) {
+        conf["dfs.domain.socket.path"] = config->domain_socket_path;
+      }
+    }
+    // Explicit settings take precedence
     for (const auto& kv : config->extra_conf) {
+      conf[kv.first] = kv.second;
+    }
+    for (const auto& kv : conf) {
       int ret = driver_->BuilderConfSetStr(builder, kv.first.c_str(), kv.second.c_str());
       CHECK_FAILURE(ret, "confsetstr");
     }
@@ -362,6 +481,8 @@ class HadoopFileSystem::HadoopFileSystemImpl {
     port_ = config->port;
     user_ = config->user;
     kerb_ticket_ = config->kerb_ticket;
+    zero_copy_reads_ = config->zero_copy_reads;
+    zero_copy_skip_checksums_ = config->zero_copy_skip_checksums;
 
     return Status::OK();
   }
@@ -496,6 +617,9 @@ class HadoopFileSystem::HadoopFileSystemImpl {
     *file = std::shared_ptr<HdfsReadableFile>(new HdfsReadableFile());
     (*file)->impl_->set_members(path, driver_, fs_, handle);
     (*file)->impl_->set_buffer_size(buffer_size);
+    if (zero_copy_reads_) {
+      (*file)->impl_->EnableZeroCopyReads(zero_copy_skip_checksums_);
+    }
 
     return Status::OK();
   }
@@ -546,6 +670,8 @@ class HadoopFileSystem::HadoopFileSystemImpl {
   std::string user_;
   int port_;
   std::string kerb_ticket_;
+  bool zero_copy_reads_ = false;
+  bool zero_copy_skip_checksums_ = false;
 
   hdfsFS fs_;
 };
@@ -90,6 +90,20 @@ struct HdfsConnectionConfig {
   std::string user;
   std::string kerb_ticket;
   std::unordered_map<std::string, std::string> extra_conf;
+  /// Read the blocks of co-located datanodes directly from their files
+  /// (dfs.client.read.shortcircuit), with file descriptors passed over the
+  /// UNIX domain socket at domain_socket_path (dfs.domain.socket.path).  The
+  /// datanodes must be configured with the same socket path.
+  bool short_circuit_reads = false;
+  std::string domain_socket_path;
+  /// Memory-map local blocks in ReadAt() instead of copying them through the
+  /// JVM, when a range lies within a block read with short-circuit reads.
+  /// Other ranges are read as usual.  The returned buffers must be released
+  /// before the filesystem is disconnected.
+  bool zero_copy_reads = false;
+  /// Skip checksum verification of zero-copy reads, without which only the
+  /// blocks cached (mlocked) by the datanodes can be memory-mapped
+  bool zero_copy_skip_checksums = false;
 };
 
 class ARROW_EXPORT HadoopFileSystem : public FileSystem {
@@ -33,6 +33,7 @@
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/future.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
@@ -150,6 +151,15 @@ Status Writable::Write(const std::shared_ptr<Buffer>& data) {
   return Write(data->data(), data->size());
 }
 
+Status Writable::WriteBuffers(const std::vector<std::shared_ptr<Buffer>>& data) {
+  for (const auto& buffer : data) {
+    if (buffer && buffer->size() > 0) {
+      RETURN_NOT_OK(Write(buffer));
+    }
+  }
+  return Status::OK();
+}
+
 Status Writable::Flush() { return Status::OK(); }
 
 // An InputStream that reads from a delimited range of a RandomAccessFile
@@ -322,8 +332,30 @@ void SharedExclusiveChecker::UnlockExclusive() {}
 
 #endif
 
+// I/O tasks mostly wait on the disk or the network, so the pool can be much
+// larger than the CPU pool without oversubscribing compute.  The default is
+// sized for high-latency object stores, where throughput requires many
+// outstanding requests.
+constexpr int kDefaultIOThreadPoolCapacity = 32;
+
+static int DefaultIOThreadPoolCapacity() {
+  auto maybe_env_var = ::arrow::internal::GetEnvVar("ARROW_IO_THREADS");
+  if (maybe_env_var.ok()) {
+    try {
+      const int capacity = std::stoi(*maybe_env_var);
+      if (capacity > 0) {
+        return capacity;
+      }
+    } catch (...) {
+    }
+    ARROW_LOG(WARNING) << "Invalid value for ARROW_IO_THREADS: '" << *maybe_env_var
+                       << "', using the default I/O thread pool capacity";
+  }
+  return kDefaultIOThreadPoolCapacity;
+}
+
 static std::shared_ptr<ThreadPool> MakeIOThreadPool() {
-  auto maybe_pool = ThreadPool::MakeEternal(/*threads=*/8);
+  auto maybe_pool = ThreadPool::MakeEternal(DefaultIOThreadPoolCapacity());
   if (!maybe_pool.ok()) {
     maybe_pool.status().Abort("Failed to create global IO thread pool");
   }
@@ -335,6 +367,16 @@ ThreadPool* GetIOThreadPool() {
   return pool.get();
 }
 
+}  // namespace internal
+
+int GetIOThreadPoolCapacity() { return internal::GetIOThreadPool()->GetCapacity(); }
+
+Status SetIOThreadPoolCapacity(int threads) {
+  return internal::GetIOThreadPool()->SetCapacity(threads);
+}
+
+namespace internal {
+
 // -----------------------------------------------------------------------
 // CoalesceReadRanges
 
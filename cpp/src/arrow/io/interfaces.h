@@ -48,6 +48,28 @@ struct ReadRange {
   }
 };
 
+/// \brief Get the capacity of the global I/O thread pool
+///
+/// Return the number of worker threads in the thread pool to which
+/// Arrow dispatches various I/O-bound tasks, such as RandomAccessFile::ReadAsync
+/// calls on filesystem files.  This is an ideal number, not necessarily the
+/// exact number of threads at a given point in time.
+///
+/// The default is taken from the ARROW_IO_THREADS environment variable if set,
+/// and is otherwise sized for high-latency object stores.  You can change this
+/// number using SetIOThreadPoolCapacity().
+ARROW_EXPORT int GetIOThreadPoolCapacity();
+
+/// \brief Set the capacity of the global I/O thread pool
+///
+/// Set the number of worker threads in the thread pool to which
+/// Arrow dispatches various I/O-bound tasks.  Since these tasks mostly block,
+/// the capacity bounds the number of outstanding I/O requests rather than
+/// the CPU usage.
+///
+/// The current number is returned by GetIOThreadPoolCapacity().
+ARROW_EXPORT Status SetIOThreadPoolCapacity(int threads);
+
 // EXPERIMENTAL
 struct ARROW_EXPORT AsyncContext {
   ::arrow::internal::Executor* executor;
@@ -124,6 +146,12 @@ class ARROW_EXPORT Writable {
   /// buffering is required.  See Write(const void*, int64_t) for details.
   virtual Status Write(const std::shared_ptr<Buffer>& data);
 
+  /// \brief Write the given buffers to the stream, one after the other
+  ///
+  /// Null buffers are skipped. Files override this to hand all the buffers
+  /// to the OS at once rather than issue one write per buffer.
+  virtual Status WriteBuffers(const std::vector<std::shared_ptr<Buffer>>& data);
+
   /// \brief Flush buffered bytes, if any
   virtual Status Flush();
 
@@ -384,5 +384,103 @@ Status BufferReader::DoSeek(int64_t position) {
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// In-memory chunked buffer reader
+
+ChunkedBufferReader::ChunkedBufferReader(std::vector<std::shared_ptr<Buffer>> buffers,
+                                         MemoryPool* pool)
+    : buffers_(std::move(buffers)), pool_(pool), position_(0), is_open_(true) {
+  offsets_.reserve(buffers_.size() + 1);
+  int64_t offset = 0;
+  for (const auto& buffer : buffers_) {
+    offsets_.push_back(offset);
+    offset += buffer->size();
+  }
+  offsets_.push_back(offset);
+}
+
+Status ChunkedBufferReader::DoClose() {
+  is_open_ = false;
+  return Status::OK();
+}
+
+bool ChunkedBufferReader::closed() const { return !is_open_; }
+
+bool ChunkedBufferReader::supports_zero_copy() const { return true; }
+
+Result<int64_t> ChunkedBufferReader::DoTell() const {
+  RETURN_NOT_OK(CheckClosed());
+  return position_;
+}
+
+Result<int64_t> ChunkedBufferReader::DoReadAt(int64_t position, int64_t nbytes,
+                                              void* out) {
+  RETURN_NOT_OK(CheckClosed());
+
+  ARROW_ASSIGN_OR_RAISE(nbytes,
+                        internal::ValidateReadRange(position, nbytes, offsets_.back()));
+  // The first buffer ending after the position
+  size_t i = std::upper_bound(offsets_.begin(), offsets_.end(), position) -
+             offsets_.begin() - 1;
+  int64_t bytes_read = 0;
+  while (bytes_read < nbytes) {
+    DCHECK_LT(i, buffers_.size());
+    const int64_t buffer_position = position + bytes_read - offsets_[i];
+    const int64_t chunk_size =
+        std::min(nbytes - bytes_read, buffers_[i]->size() - buffer_position);
+    memcpy(reinterpret_cast<uint8_t*>(out) + bytes_read,
+           buffers_[i]->data() + buffer_position, chunk_size);
+    bytes_read += chunk_size;
+    ++i;
+  }
+  return nbytes;
+}
+
+Result<std::shared_ptr<Buffer>> ChunkedBufferReader::DoReadAt(int64_t position,
+                                                              int64_t nbytes) {
+  RETURN_NOT_OK(CheckClosed());
+
+  ARROW_ASSIGN_OR_RAISE(nbytes,
+                        internal::ValidateReadRange(position, nbytes, offsets_.back()));
+  const size_t i = std::upper_bound(offsets_.begin(), offsets_.end(), position) -
+                   offsets_.begin() - 1;
+  if (i < buffers_.size() && position + nbytes <= offsets_[i + 1]) {
+    return SliceBuffer(buffers_[i], position - offsets_[i], nbytes);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateBuffer(nbytes, pool_));
+  RETURN_NOT_OK(DoReadAt(position, nbytes, buffer->mutable_data()));
+  return std::move(buffer);
+}
+
+Result<int64_t> ChunkedBufferReader::DoRead(int64_t nbytes, void* out) {
+  RETURN_NOT_OK(CheckClosed());
+  ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, DoReadAt(position_, nbytes, out));
+  position_ += bytes_read;
+  return bytes_read;
+}
+
+Result<std::shared_ptr<Buffer>> ChunkedBufferReader::DoRead(int64_t nbytes) {
+  RETURN_NOT_OK(CheckClosed());
+  ARROW_ASSIGN_OR_RAISE(auto buffer, DoReadAt(position_, nbytes));
+  position_ += buffer->size();
+  return buffer;
+}
+
+Result<int64_t> ChunkedBufferReader::DoGetSize() {
+  RETURN_NOT_OK(CheckClosed());
+  return offsets_.back();
+}
+
+Status ChunkedBufferReader::DoSeek(int64_t position) {
+  RETURN_NOT_OK(CheckClosed());
+
+  if (position < 0 || position > offsets_.back()) {
+    return Status::IOError("Seek out of bounds");
+  }
+
+  position_ = position;
+  return Status::OK();
+}
+
 }  // namespace io
 }  // namespace arrow
@@ -193,5 +193,49 @@ class ARROW_EXPORT BufferReader
   bool is_open_;
 };
 
+/// \brief Random access reads from a sequence of buffers, as if they were
+/// concatenated
+///
+/// Reads within a single buffer are zero-copy slices of it.  Only reads
+/// spanning several buffers allocate a new buffer and copy the data.
+class ARROW_EXPORT ChunkedBufferReader
+    : public internal::RandomAccessFileConcurrencyWrapper<ChunkedBufferReader> {
+ public:
+  explicit ChunkedBufferReader(std::vector<std::shared_ptr<Buffer>> buffers,
+                               MemoryPool* pool = default_memory_pool());
+
+  bool closed() const override;
+
+  bool supports_zero_copy() const override;
+
+ protected:
+  friend RandomAccessFileConcurrencyWrapper<ChunkedBufferReader>;
+
+  Status DoClose();
+
+  Result<int64_t> DoRead(int64_t nbytes, void* buffer);
+  Result<std::shared_ptr<Buffer>> DoRead(int64_t nbytes);
+  Result<int64_t> DoReadAt(int64_t position, int64_t nbytes, void* out);
+  Result<std::shared_ptr<Buffer>> DoReadAt(int64_t position, int64_t nbytes);
+
+  Result<int64_t> DoTell() const;
+  Status DoSeek(int64_t position);
+  Result<int64_t> DoGetSize();
+
+  Status CheckClosed() const {
+    if (!is_open_) {
+      return Status::Invalid("Operation forbidden on closed ChunkedBufferReader");
+    }
+    return Status::OK();
+  }
+
+  std::vector<std::shared_ptr<Buffer>> buffers_;
+  // The position of each buffer, followed by the total size
+  std::vector<int64_t> offsets_;
+  MemoryPool* pool_;
+  int64_t position_;
+  bool is_open_;
+};
+
 }  // namespace io
 }  // namespace arrow
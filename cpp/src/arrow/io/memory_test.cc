@@ -44,6 +44,7 @@
 #include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -280,6 +281,48 @@ TEST(TestBufferReader, WillNeed) {
   }
 }
 
+TEST(TestChunkedBufferReader, Basics) {
+  std::vector<std::shared_ptr<Buffer>> buffers = {
+      Buffer::FromString("data"), Buffer::FromString(""), Buffer::FromString("123"),
+      Buffer::FromString("456")};
+  ChunkedBufferReader reader(buffers);
+  ASSERT_TRUE(reader.supports_zero_copy());
+  ASSERT_OK_AND_EQ(10, reader.GetSize());
+
+  // Reads within a buffer are zero-copy
+  ASSERT_OK_AND_ASSIGN(auto buf, reader.ReadAt(1, 3));
+  AssertBufferEqual(*buf, "ata");
+  ASSERT_EQ(buf->data(), buffers[0]->data() + 1);
+  ASSERT_OK_AND_ASSIGN(buf, reader.ReadAt(4, 3));
+  ASSERT_EQ(buf->data(), buffers[2]->data());
+
+  // Reads spanning buffers are copied
+  ASSERT_OK_AND_ASSIGN(buf, reader.ReadAt(2, 6));
+  AssertBufferEqual(*buf, "ta1234");
+  ASSERT_OK_AND_ASSIGN(buf, reader.ReadAt(3, 20));
+  AssertBufferEqual(*buf, "a123456");
+  uint8_t out[10];
+  ASSERT_OK_AND_EQ(10, reader.ReadAt(0, 10, out));
+  ASSERT_EQ(0, memcmp(out, "data123456", 10));
+
+  ASSERT_OK_AND_ASSIGN(buf, reader.Read(5));
+  AssertBufferEqual(*buf, "data1");
+  ASSERT_OK_AND_EQ(5, reader.Tell());
+  ASSERT_OK(reader.Seek(8));
+  ASSERT_OK_AND_ASSIGN(buf, reader.Read(5));
+  AssertBufferEqual(*buf, "56");
+  ASSERT_OK_AND_ASSIGN(buf, reader.Read(5));
+  ASSERT_EQ(0, buf->size());
+
+  ASSERT_RAISES(IOError, reader.Seek(11));
+  ASSERT_RAISES(Invalid, reader.ReadAt(-1, 1));
+  ASSERT_RAISES(Invalid, reader.ReadAt(1, -1));
+
+  ASSERT_OK(reader.Close());
+  ASSERT_TRUE(reader.closed());
+  ASSERT_RAISES(Invalid, reader.Read(1));
+}
+
 TEST(TestRandomAccessFile, GetStream) {
   std::string data = "data1data2data3data4data5";
 
@@ -729,12 +772,118 @@ TEST(RangeReadCache, Basics) {
   ASSERT_RAISES(Invalid, cache.Read({25, 2}));
 }
 
+// A BufferReader recording the ranges read asynchronously
+class TrackingBufferReader : public BufferReader {
+ public:
+  using BufferReader::BufferReader;
+
+  Future<std::shared_ptr<Buffer>> ReadAsync(const AsyncContext& ctx, int64_t position,
+                                            int64_t nbytes) override {
+    read_ranges.push_back({position, nbytes});
+    return BufferReader::ReadAsync(ctx, position, nbytes);
+  }
+
+  std::vector<ReadRange> read_ranges;
+};
+
+TEST(RangeReadCache, BufferLimit) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  auto file = std::make_shared<TrackingBufferReader>(Buffer(data));
+  CacheOptions options = CacheOptions::Defaults();
+  options.hole_size_limit = 2;
+  options.range_size_limit = 10;
+  options.buffer_limit = 5;
+  internal::ReadRangeCache cache(file, {}, options);
+
+  // Coalesced into {1, 4}, {8, 2}, {15, 4} and {23, 2}
+  ASSERT_OK(cache.Cache({{1, 2}, {3, 2}, {8, 2}, {15, 4}, {23, 2}}));
+  ASSERT_EQ(file->read_ranges, std::vector<ReadRange>({{1, 4}}));
+
+  // The first range is released once both its parts are read
+  ASSERT_OK_AND_ASSIGN(auto buf, cache.Read({3, 2}));
+  AssertBufferEqual(*buf, "de");
+  ASSERT_EQ(file->read_ranges.size(), 1);
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({1, 2}));
+  AssertBufferEqual(*buf, "bc");
+  ASSERT_EQ(file->read_ranges, std::vector<ReadRange>({{1, 4}, {8, 2}}));
+  ASSERT_RAISES(Invalid, cache.Read({1, 2}));
+
+  // Reading ahead of the window fetches the range right away
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({23, 2}));
+  AssertBufferEqual(*buf, "xy");
+  ASSERT_EQ(file->read_ranges, std::vector<ReadRange>({{1, 4}, {8, 2}, {23, 2}}));
+
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({8, 2}));
+  AssertBufferEqual(*buf, "ij");
+  ASSERT_EQ(file->read_ranges,
+            std::vector<ReadRange>({{1, 4}, {8, 2}, {23, 2}, {15, 4}}));
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({15, 4}));
+  AssertBufferEqual(*buf, "pqrs");
+  ASSERT_EQ(file->read_ranges.size(), 4);
+
+  ASSERT_RAISES(Invalid, cache.Read({0, 3}));
+}
+
+TEST(RangeReadCache, Alignment) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  auto file = std::make_shared<TrackingBufferReader>(Buffer(data));
+  CacheOptions options = CacheOptions::Defaults();
+  options.hole_size_limit = 0;
+  options.range_size_limit = 10;
+  options.alignment = 4;
+  internal::ReadRangeCache cache(file, {}, options);
+
+  // Coalesced into {1, 4}, {6, 2}, {13, 1} and {22, 3}, then aligned
+  // into {0, 8}, {12, 4} and {20, 8}
+  ASSERT_OK(cache.Cache({{1, 2}, {3, 2}, {6, 2}, {13, 1}, {22, 3}}));
+  ASSERT_EQ(file->read_ranges, std::vector<ReadRange>({{0, 8}, {12, 4}, {20, 8}}));
+
+  ASSERT_OK_AND_ASSIGN(auto buf, cache.Read({3, 2}));
+  AssertBufferEqual(*buf, "de");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({6, 2}));
+  AssertBufferEqual(*buf, "gh");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({13, 1}));
+  AssertBufferEqual(*buf, "n");
+  // The last range is truncated at the end of the file
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({22, 3}));
+  AssertBufferEqual(*buf, "wxy");
+}
+
+TEST(RangeReadCache, WaitFor) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  auto file = std::make_shared<TrackingBufferReader>(Buffer(data));
+  CacheOptions options = CacheOptions::Defaults();
+  options.hole_size_limit = 2;
+  options.range_size_limit = 10;
+  options.buffer_limit = 5;
+  internal::ReadRangeCache cache(file, {}, options);
+
+  // Coalesced into {1, 4}, {8, 2} and {15, 4}
+  ASSERT_OK(cache.Cache({{1, 2}, {3, 2}, {8, 2}, {15, 4}}));
+  ASSERT_EQ(file->read_ranges, std::vector<ReadRange>({{1, 4}}));
+  ASSERT_OK(cache.WaitFor({{1, 2}, {3, 2}}).status());
+
+  // Waiting for ranges beyond the buffer limit fetches them right away
+  ASSERT_OK(cache.WaitFor({{15, 4}, {20, 0}}).status());
+  ASSERT_EQ(file->read_ranges, std::vector<ReadRange>({{1, 4}, {15, 4}}));
+  ASSERT_OK_AND_ASSIGN(auto buf, cache.Read({15, 4}));
+  AssertBufferEqual(*buf, "pqrs");
+
+  // Released and non-cached ranges
+  ASSERT_RAISES(Invalid, cache.WaitFor({{15, 4}}).status());
+  ASSERT_RAISES(Invalid, cache.WaitFor({{8, 2}, {0, 3}}).status());
+}
+
 TEST(CacheOptions, Basics) {
   auto check = [](const CacheOptions actual, const double expected_hole_size_limit_MiB,
                   const double expected_range_size_limit_MiB) -> void {
     const CacheOptions expected = {
         static_cast<int64_t>(std::round(expected_hole_size_limit_MiB * 1024 * 1024)),
-        static_cast<int64_t>(std::round(expected_range_size_limit_MiB * 1024 * 1024))};
+        static_cast<int64_t>(std::round(expected_range_size_limit_MiB * 1024 * 1024)),
+        0, 0};
     ASSERT_EQ(actual, expected);
   };
 
@@ -752,5 +901,22 @@ TEST(CacheOptions, Basics) {
   check(CacheOptions::MakeFromNetworkMetrics(5, 500, .75, 5), 2.5, 5);
 }
 
+TEST(IOThreadPool, Capacity) {
+  const int original = GetIOThreadPoolCapacity();
+  ASSERT_GT(original, 0);
+  ASSERT_EQ(internal::GetIOThreadPool(), AsyncContext().executor);
+
+  ASSERT_OK(SetIOThreadPoolCapacity(original + 3));
+  ASSERT_EQ(original + 3, GetIOThreadPoolCapacity());
+  ASSERT_RAISES(Invalid, SetIOThreadPoolCapacity(0));
+  ASSERT_OK(SetIOThreadPoolCapacity(original));
+  ASSERT_EQ(original, GetIOThreadPoolCapacity());
+
+  // I/O tasks don't take slots from the CPU thread pool
+  ASSERT_NE(static_cast<::arrow::internal::Executor*>(
+                ::arrow::internal::GetCpuThreadPool()),
+            AsyncContext().executor);
+}
+
 }  // namespace io
 }  // namespace arrow
@@ -0,0 +1,737 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/uring_internal.h"
+
+#ifdef ARROW_WITH_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/future.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::IOErrorFromErrno;
+
+namespace io {
+namespace internal {
+
+#ifdef ARROW_WITH_IO_URING
+
+namespace {
+
+// Older libc headers may lack the syscall numbers.  They are the same on all
+// architectures using the generic syscall table, but alpha, ia64 and MIPS
+// number them differently, so these have to get them from <sys/syscall.h>.
+#if !defined(__NR_io_uring_setup) || !defined(__NR_io_uring_enter) || \
+    !defined(__NR_io_uring_register)
+#if defined(__alpha__) || defined(__ia64__) || defined(__mips__)
+#error "io_uring syscall numbers unknown for this architecture, update the libc headers"
+#endif
+#endif
+#ifndef __NR_io_uring_setup
+#define __NR_io_uring_setup 425
+#endif
+#ifndef __NR_io_uring_enter
+#define __NR_io_uring_enter 426
+#endif
+#ifndef __NR_io_uring_register
+#define __NR_io_uring_register 427
+#endif
+
+int SysSetup(unsigned entries, struct io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int SysEnter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+  return static_cast<int>(
+      syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, NULLPTR, 0));
+}
+
+int SysRegister(int fd, unsigned opcode, const void* arg, unsigned nr_args) {
+  return static_cast<int>(syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+}
+
+// Transient errors of io_uring_enter()
+bool IsRetryable(int errnum) {
+  return errnum == EINTR || errnum == EAGAIN || errnum == EBUSY;
+}
+
+// The user_data of the request stopping the completion thread
+constexpr uint64_t kStopToken = 0;
+
+// A single request to the kernel cannot read more than this
+constexpr int64_t kMaxRequestSize = 1 << 30;
+
+}  // namespace
+
+class Uring::Ring {
+ public:
+  struct Request {
+    int fd;
+    int64_t position;
+    uint8_t* data;
+    int64_t nbytes;
+    // Index of the registered buffer `data` points into, or -1
+    int buf_index;
+    int64_t bytes_read;
+    std::function<void(Result<int64_t>)> on_done;
+    // Keeps the file descriptor open until the request completes
+    std::shared_ptr<void> fd_owner;
+  };
+
+  ~Ring() {
+    if (sqes_ != NULLPTR) {
+      munmap(sqes_, sqes_size_);
+    }
+    if (cq_ring_ != NULLPTR && cq_ring_ != sq_ring_) {
+      munmap(cq_ring_, cq_ring_size_);
+    }
+    if (sq_ring_ != NULLPTR) {
+      munmap(sq_ring_, sq_ring_size_);
+    }
+    if (fd_ >= 0) {
+      close(fd_);
+    }
+  }
+
+  static Result<std::shared_ptr<Ring>> Make(const UringOptions& options) {
+    if (options.queue_depth < 2) {
+      return Status::Invalid("io_uring queue depth must be at least 2");
+    }
+    std::shared_ptr<Ring> ring(new Ring());
+    RETURN_NOT_OK(ring->Init(options));
+    // The completion thread keeps the ring alive until it is stopped
+    ring->thread_ = std::thread([ring]() { ring->ReapCompletions(); });
+    return ring;
+  }
+
+  // Prepare the requests and hand them to the kernel.  Requests can be
+  // completed (and destroyed) as soon as this returns.
+  void Submit(const std::vector<Request*>& requests) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (Request* request : requests) {
+      // Leave room for the stop request
+      cv_.wait(lock, [this] { return in_flight_ < sq_entries_ - 1; });
+      ++in_flight_;
+      Prepare(request);
+    }
+    Flush(&lock);
+  }
+
+  void Stop() {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      ++in_flight_;
+      Prepare(NULLPTR);
+      Flush(&lock);
+    }
+    if (std::this_thread::get_id() == thread_.get_id()) {
+      // Destroyed by a completion; the thread will exit after this batch
+      thread_.detach();
+    } else {
+      thread_.join();
+    }
+  }
+
+  uint8_t* AcquireRegisteredBuffer(int64_t nbytes, int* buf_index) {
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    if (nbytes > registered_buffer_size_ || free_buffers_.empty()) {
+      return NULLPTR;
+    }
+    *buf_index = free_buffers_.back();
+    free_buffers_.pop_back();
+    return registered_memory_->mutable_data() + *buf_index * registered_buffer_size_;
+  }
+
+  void ReleaseRegisteredBuffer(int buf_index) {
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    free_buffers_.push_back(buf_index);
+  }
+
+  int32_t num_free_registered_buffers() {
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    return static_cast<int32_t>(free_buffers_.size());
+  }
+
+ private:
+  Ring() = default;
+
+  Status Init(const UringOptions& options) {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    fd_ = SysSetup(static_cast<unsigned>(options.queue_depth), &params);
+    if (fd_ < 0) {
+      fd_ = -1;
+      return IOErrorFromErrno(errno, "io_uring_setup failed");
+    }
+    sq_entries_ = params.sq_entries;
+
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+      sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+    RETURN_NOT_OK(Map(sq_ring_size_, IORING_OFF_SQ_RING, &sq_ring_));
+    if (single_mmap) {
+      cq_ring_ = sq_ring_;
+    } else {
+      RETURN_NOT_OK(Map(cq_ring_size_, IORING_OFF_CQ_RING, &cq_ring_));
+    }
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+    void* sqes = NULLPTR;
+    RETURN_NOT_OK(Map(sqes_size_, IORING_OFF_SQES, &sqes));
+    sqes_ = reinterpret_cast<io_uring_sqe*>(sqes);
+
+    auto sq_ring = reinterpret_cast<uint8_t*>(sq_ring_);
+    sq_tail_ = reinterpret_cast<unsigned*>(sq_ring + params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<unsigned*>(sq_ring + params.sq_off.ring_mask);
+    // Submission queue entries are used in order
+    auto sq_array = reinterpret_cast<unsigned*>(sq_ring + params.sq_off.array);
+    for (unsigned i = 0; i < sq_entries_; ++i) {
+      sq_array[i] = i;
+    }
+
+    auto cq_ring = reinterpret_cast<uint8_t*>(cq_ring_);
+    cq_head_ = reinterpret_cast<unsigned*>(cq_ring + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned*>(cq_ring + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<unsigned*>(cq_ring + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe*>(cq_ring + params.cq_off.cqes);
+
+    if (options.num_registered_buffers > 0) {
+      registered_buffer_size_ = options.registered_buffer_size;
+      ARROW_ASSIGN_OR_RAISE(
+          registered_memory_,
+          AllocateBuffer(options.num_registered_buffers * registered_buffer_size_,
+                         options.pool));
+      std::vector<struct iovec> iovecs(options.num_registered_buffers);
+      for (int32_t i = 0; i < options.num_registered_buffers; ++i) {
+        iovecs[i].iov_base =
+            registered_memory_->mutable_data() + i * registered_buffer_size_;
+        iovecs[i].iov_len = static_cast<size_t>(registered_buffer_size_);
+        free_buffers_.push_back(options.num_registered_buffers - 1 - i);
+      }
+      if (SysRegister(fd_, IORING_REGISTER_BUFFERS, iovecs.data(),
+                      static_cast<unsigned>(iovecs.size())) < 0) {
+        return IOErrorFromErrno(errno, "Failed registering buffers with io_uring");
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Map(size_t size, off_t offset, void** out) {
+    void* ptr = mmap(NULLPTR, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                     fd_, offset);
+    if (ptr == MAP_FAILED) {
+      return IOErrorFromErrno(errno, "Failed mapping io_uring queue");
+    }
+    *out = ptr;
+    return Status::OK();
+  }
+
+  // Fill the next submission queue entry (the mutex must be held).
+  // A null request stops the completion thread.
+  void Prepare(Request* request) {
+    const unsigned tail = *sq_tail_;
+    io_uring_sqe* sqe = &sqes_[tail & sq_mask_];
+    memset(sqe, 0, sizeof(*sqe));
+    if (request == NULLPTR) {
+      sqe->opcode = IORING_OP_NOP;
+      sqe->user_data = kStopToken;
+    } else {
+      const int64_t offset = request->bytes_read;
+      sqe->opcode = request->buf_index >= 0 ? IORING_OP_READ_FIXED : IORING_OP_READ;
+      sqe->fd = request->fd;
+      sqe->off = static_cast<uint64_t>(request->position + offset);
+      sqe->addr = reinterpret_cast<uint64_t>(request->data + offset);
+      sqe->len = static_cast<uint32_t>(
+          std::min(request->nbytes - offset, kMaxRequestSize));
+      if (request->buf_index >= 0) {
+        sqe->buf_index = static_cast<uint16_t>(request->buf_index);
+      }
+      sqe->user_data = reinterpret_cast<uint64_t>(request);
+    }
+    // Publish the entry before the new tail
+    __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+    ++to_submit_;
+  }
+
+  // Tell the kernel about the prepared entries (the mutex must be held).
+  //
+  // Only one thread enters the kernel at a time: entries prepared by other
+  // threads in the meantime are submitted with the next call, so that
+  // concurrent requests are batched.
+  void Flush(std::unique_lock<std::mutex>* lock) {
+    while (to_submit_ > 0 && !submitting_) {
+      submitting_ = true;
+      const unsigned to_submit = to_submit_;
+      lock->unlock();
+      const int ret = SysEnter(fd_, to_submit, 0, 0);
+      const int errnum = errno;
+      lock->lock();
+      submitting_ = false;
+      if (ret >= 0) {
+        to_submit_ -= static_cast<unsigned>(ret);
+      } else if (IsRetryable(errnum)) {
+        lock->unlock();
+        std::this_thread::yield();
+        lock->lock();
+      } else {
+        // Should not happen; a valid ring accepts any well-formed entry
+        ARROW_LOG(FATAL) << "io_uring_enter failed: " << std::strerror(errnum);
+      }
+    }
+  }
+
+  void ReapCompletions() {
+    std::vector<std::pair<Request*, Result<int64_t>>> finished;
+    std::vector<Request*> resubmit;
+    bool stopped = false;
+    while (!stopped) {
+      const int ret = SysEnter(fd_, 0, 1, IORING_ENTER_GETEVENTS);
+      if (ret < 0 && !IsRetryable(errno)) {
+        ARROW_LOG(FATAL) << "io_uring_enter failed: " << std::strerror(errno);
+      }
+
+      // Only this thread consumes completions
+      unsigned head = *cq_head_;
+      const unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+      for (; head != tail; ++head) {
+        const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+        if (cqe.user_data == kStopToken) {
+          stopped = true;
+          continue;
+        }
+        auto request = reinterpret_cast<Request*>(cqe.user_data);
+        if (cqe.res == -EINTR || cqe.res == -EAGAIN) {
+          resubmit.push_back(request);
+        } else if (cqe.res < 0) {
+          finished.emplace_back(request,
+                                IOErrorFromErrno(-cqe.res, "io_uring read failed"));
+        } else {
+          request->bytes_read += cqe.res;
+          if (cqe.res > 0 && request->bytes_read < request->nbytes) {
+            // Short read, not at end of file
+            resubmit.push_back(request);
+          } else {
+            finished.emplace_back(request, request->bytes_read);
+          }
+        }
+      }
+      __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        in_flight_ -= static_cast<unsigned>(finished.size()) + (stopped ? 1 : 0);
+        // Resubmitted requests keep their slot, so that this thread never
+        // waits for room in the queue
+        for (Request* request : resubmit) {
+          Prepare(request);
+        }
+        Flush(&lock);
+      }
+      cv_.notify_all();
+      resubmit.clear();
+
+      for (auto& pair : finished) {
+        std::unique_ptr<Request> request(pair.first);
+        request->on_done(std::move(pair.second));
+      }
+      finished.clear();
+    }
+  }
+
+  int fd_ = -1;
+  unsigned sq_entries_ = 0;
+
+  void* sq_ring_ = NULLPTR;
+  size_t sq_ring_size_ = 0;
+  unsigned* sq_tail_ = NULLPTR;
+  unsigned sq_mask_ = 0;
+  io_uring_sqe* sqes_ = NULLPTR;
+  size_t sqes_size_ = 0;
+
+  void* cq_ring_ = NULLPTR;
+  size_t cq_ring_size_ = 0;
+  unsigned* cq_head_ = NULLPTR;
+  unsigned* cq_tail_ = NULLPTR;
+  unsigned cq_mask_ = 0;
+  io_uring_cqe* cqes_ = NULLPTR;
+
+  // Protects the submission queue and the counters below
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  // Requests submitted and not completed, including resubmissions
+  unsigned in_flight_ = 0;
+  // Entries prepared but not yet handed to the kernel
+  unsigned to_submit_ = 0;
+  bool submitting_ = false;
+
+  std::thread thread_;
+
+  std::mutex buffers_mutex_;
+  std::shared_ptr<Buffer> registered_memory_;
+  int64_t registered_buffer_size_ = 0;
+  std::vector<int> free_buffers_;
+};
+
+namespace {
+
+// A registered buffer lent to the caller
+class RegisteredBuffer : public Buffer {
+ public:
+  RegisteredBuffer(std::shared_ptr<Uring::Ring> ring, int buf_index, uint8_t* data,
+                   int64_t size)
+      : Buffer(data, size), ring_(std::move(ring)), buf_index_(buf_index) {
+    is_mutable_ = true;
+    mutable_data_ = data;
+  }
+
+  ~RegisteredBuffer() override { ring_->ReleaseRegisteredBuffer(buf_index_); }
+
+ private:
+  std::shared_ptr<Uring::Ring> ring_;
+  int buf_index_;
+};
+
+}  // namespace
+
+bool Uring::IsSupported() {
+  static const bool supported = [] {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    const int fd = SysSetup(2, &params);
+    if (fd < 0) {
+      return false;
+    }
+    close(fd);
+    return true;
+  }();
+  return supported;
+}
+
+Result<std::shared_ptr<Uring>> Uring::Make(const UringOptions& options) {
+  ARROW_ASSIGN_OR_RAISE(auto ring, Ring::Make(options));
+  return std::shared_ptr<Uring>(new Uring(std::move(ring)));
+}
+
+Uring::Uring(std::shared_ptr<Ring> ring) : ring_(std::move(ring)) {}
+
+Uring::~Uring() { ring_->Stop(); }
+
+Future<int64_t> Uring::ReadAsync(int fd, int64_t position, int64_t nbytes, void* out,
+                                 std::shared_ptr<void> fd_owner) {
+  auto st = internal::ValidateRange(position, nbytes);
+  if (!st.ok()) {
+    return Future<int64_t>::MakeFinished(std::move(st));
+  }
+  if (nbytes == 0) {
+    return Future<int64_t>::MakeFinished(0);
+  }
+  auto fut = Future<int64_t>::Make();
+  auto on_done = [fut](Result<int64_t> res) mutable { fut.MarkFinished(std::move(res)); };
+  ring_->Submit({new Ring::Request{fd, position, reinterpret_cast<uint8_t*>(out), nbytes,
+                                   -1, 0, std::move(on_done), std::move(fd_owner)}});
+  return fut;
+}
+
+Future<std::shared_ptr<Buffer>> Uring::ReadBufferAsync(int fd, int64_t position,
+                                                      int64_t nbytes, MemoryPool* pool,
+                                                      std::shared_ptr<void> fd_owner) {
+  return std::move(
+      ReadBuffersAsync(fd, {{position, nbytes}}, pool, std::move(fd_owner))[0]);
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> Uring::ReadBuffersAsync(
+    int fd, const std::vector<ReadRange>& ranges, MemoryPool* pool,
+    std::shared_ptr<void> fd_owner) {
+  using BufferFuture = Future<std::shared_ptr<Buffer>>;
+  std::vector<BufferFuture> futures;
+  std::vector<Ring::Request*> requests;
+
+  for (const auto& range : ranges) {
+    auto st = internal::ValidateRange(range.offset, range.length);
+    if (!st.ok()) {
+      futures.push_back(BufferFuture::MakeFinished(std::move(st)));
+      continue;
+    }
+    auto fut = BufferFuture::Make();
+    futures.push_back(fut);
+
+    int buf_index = -1;
+    uint8_t* data = ring_->AcquireRegisteredBuffer(range.length, &buf_index);
+    std::function<void(Result<int64_t>)> on_done;
+    if (data != NULLPTR) {
+      std::shared_ptr<Ring> ring = ring_;
+      on_done = [fut, ring, buf_index, data](Result<int64_t> res) mutable {
+        if (!res.ok()) {
+          ring->ReleaseRegisteredBuffer(buf_index);
+          fut.MarkFinished(res.status());
+          return;
+        }
+        fut.MarkFinished(std::shared_ptr<Buffer>(
+            std::make_shared<RegisteredBuffer>(ring, buf_index, data, *res)));
+      };
+    } else {
+      auto maybe_buffer = AllocateResizableBuffer(range.length, pool);
+      if (!maybe_buffer.ok()) {
+        fut.MarkFinished(maybe_buffer.status());
+        continue;
+      }
+      std::shared_ptr<ResizableBuffer> buffer = std::move(*maybe_buffer);
+      data = buffer->mutable_data();
+      on_done = [fut, buffer](Result<int64_t> res) mutable {
+        if (!res.ok()) {
+          fut.MarkFinished(res.status());
+          return;
+        }
+        if (*res < buffer->size()) {
+          auto st = buffer->Resize(*res);
+          if (!st.ok()) {
+            fut.MarkFinished(std::move(st));
+            return;
+          }
+        }
+        buffer->ZeroPadding();
+        fut.MarkFinished(std::shared_ptr<Buffer>(std::move(buffer)));
+      };
+    }
+    if (range.length == 0) {
+      on_done(0);
+      continue;
+    }
+    requests.push_back(new Ring::Request{fd, range.offset, data, range.length, buf_index,
+                                         0, std::move(on_done), fd_owner});
+  }
+
+  if (!requests.empty()) {
+    ring_->Submit(requests);
+  }
+  return futures;
+}
+
+int32_t Uring::num_free_registered_buffers() const {
+  return ring_->num_free_registered_buffers();
+}
+
+#else  // !ARROW_WITH_IO_URING
+
+class Uring::Ring {};
+
+bool Uring::IsSupported() { return false; }
+
+Result<std::shared_ptr<Uring>> Uring::Make(const UringOptions&) {
+  return Status::NotImplemented("Arrow was built without io_uring support");
+}
+
+Uring::Uring(std::shared_ptr<Ring> ring) : ring_(std::move(ring)) {}
+
+Uring::~Uring() {}
+
+Future<int64_t> Uring::ReadAsync(int, int64_t, int64_t, void*, std::shared_ptr<void>) {
+  return Future<int64_t>::MakeFinished(
+      Status::NotImplemented("Arrow was built without io_uring support"));
+}
+
+Future<std::shared_ptr<Buffer>> Uring::ReadBufferAsync(int, int64_t, int64_t,
+                                                      MemoryPool*,
+                                                      std::shared_ptr<void>) {
+  return Future<std::shared_ptr<Buffer>>::MakeFinished(
+      Status::NotImplemented("Arrow was built without io_uring support"));
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> Uring::ReadBuffersAsync(
+    int, const std::vector<ReadRange>& ranges, MemoryPool*, std::shared_ptr<void>) {
+  std::vector<Future<std::shared_ptr<Buffer>>> futures;
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    futures.push_back(Future<std::shared_ptr<Buffer>>::MakeFinished(
+        Status::NotImplemented("Arrow was built without io_uring support")));
+  }
+  return futures;
+}
+
+int32_t Uring::num_free_registered_buffers() const { return 0; }
+
+#endif  // ARROW_WITH_IO_URING
+
+// ----------------------------------------------------------------------
+// UringReadableFile
+
+// Closes the file descriptor when the file and its pending reads are done with it
+class UringReadableFile::FileDescriptor {
+ public:
+  explicit FileDescriptor(int fd) : fd_(fd) {}
+
+  ~FileDescriptor() {
+    if (fd_ != -1) {
+      ARROW_UNUSED(::arrow::internal::FileClose(fd_));
+    }
+  }
+
+  int fd() const { return fd_; }
+
+  Status Close() {
+    const int fd = fd_;
+    fd_ = -1;
+    return ::arrow::internal::FileClose(fd);
+  }
+
+ private:
+  int fd_;
+};
+
+UringReadableFile::UringReadableFile(std::shared_ptr<Uring> uring, MemoryPool* pool)
+    : uring_(std::move(uring)), pool_(pool) {}
+
+UringReadableFile::~UringReadableFile() { internal::CloseFromDestructor(this); }
+
+Result<std::shared_ptr<UringReadableFile>> UringReadableFile::Open(
+    const std::string& path, std::shared_ptr<Uring> uring, MemoryPool* pool) {
+  ARROW_ASSIGN_OR_RAISE(auto file_name,
+                        ::arrow::internal::PlatformFilename::FromString(path));
+  std::shared_ptr<UringReadableFile> file(new UringReadableFile(std::move(uring), pool));
+  ARROW_ASSIGN_OR_RAISE(int fd, ::arrow::internal::FileOpenReadable(file_name));
+  file->fd_ = std::make_shared<FileDescriptor>(fd);
+  ARROW_ASSIGN_OR_RAISE(file->size_, ::arrow::internal::FileGetSize(fd));
+  return file;
+}
+
+bool UringReadableFile::closed() const { return fd_ == NULLPTR; }
+
+Status UringReadableFile::CheckClosed() const {
+  if (fd_ == NULLPTR) {
+    return Status::Invalid("Invalid operation on closed file");
+  }
+  return Status::OK();
+}
+
+Status UringReadableFile::DoClose() {
+  auto fd = std::move(fd_);
+  fd_.reset();
+  if (fd != NULLPTR && fd.use_count() == 1) {
+    return fd->Close();
+  }
+  // Otherwise, the descriptor is closed when pending reads complete
+  return Status::OK();
+}
+
+Result<int64_t> UringReadableFile::DoTell() const {
+  RETURN_NOT_OK(CheckClosed());
+  return position_;
+}
+
+Status UringReadableFile::DoSeek(int64_t position) {
+  RETURN_NOT_OK(CheckClosed());
+  if (position < 0) {
+    return Status::Invalid("Invalid file position");
+  }
+  position_ = position;
+  return Status::OK();
+}
+
+Result<int64_t> UringReadableFile::DoGetSize() {
+  RETURN_NOT_OK(CheckClosed());
+  return size_;
+}
+
+Result<int64_t> UringReadableFile::DoRead(int64_t nbytes, void* out) {
+  ARROW_ASSIGN_OR_RAISE(auto bytes_read, DoReadAt(position_, nbytes, out));
+  position_ += bytes_read;
+  return bytes_read;
+}
+
+Result<std::shared_ptr<Buffer>> UringReadableFile::DoRead(int64_t nbytes) {
+  ARROW_ASSIGN_OR_RAISE(auto buffer, DoReadAt(position_, nbytes));
+  position_ += buffer->size();
+  return buffer;
+}
+
+Result<int64_t> UringReadableFile::DoReadAt(int64_t position, int64_t nbytes,
+                                            void* out) {
+  RETURN_NOT_OK(CheckClosed());
+  return uring_->ReadAsync(fd_->fd(), position, nbytes, out, fd_).result();
+}
+
+Result<std::shared_ptr<Buffer>> UringReadableFile::DoReadAt(int64_t position,
+                                                            int64_t nbytes) {
+  RETURN_NOT_OK(CheckClosed());
+  ARROW_ASSIGN_OR_RAISE(nbytes, internal::ValidateReadRange(position, nbytes, size_));
+  return uring_->ReadBufferAsync(fd_->fd(), position, nbytes, pool_, fd_).result();
+}
+
+Future<std::shared_ptr<Buffer>> UringReadableFile::ReadAsync(const AsyncContext&,
+                                                             int64_t position,
+                                                             int64_t nbytes) {
+  return std::move(ReadManyAsync({{position, nbytes}})[0]);
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> UringReadableFile::ReadManyAsync(
+    const std::vector<ReadRange>& ranges) {
+  using BufferFuture = Future<std::shared_ptr<Buffer>>;
+  auto guard = lock_.shared_guard();
+  std::vector<BufferFuture> futures(ranges.size());
+  std::vector<ReadRange> valid_ranges;
+  std::vector<size_t> valid_indices;
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    auto st = CheckClosed();
+    if (st.ok()) {
+      // Don't allocate more than the file holds
+      auto maybe_length =
+          internal::ValidateReadRange(ranges[i].offset, ranges[i].length, size_);
+      if (maybe_length.ok()) {
+        valid_ranges.push_back({ranges[i].offset, *maybe_length});
+        valid_indices.push_back(i);
+        continue;
+      }
+      st = maybe_length.status();
+    }
+    futures[i] = BufferFuture::MakeFinished(std::move(st));
+  }
+  if (!valid_ranges.empty()) {
+    auto valid_futures = uring_->ReadBuffersAsync(fd_->fd(), valid_ranges, pool_, fd_);
+    for (size_t i = 0; i < valid_indices.size(); ++i) {
+      futures[valid_indices[i]] = std::move(valid_futures[i]);
+    }
+  }
+  return futures;
+}
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
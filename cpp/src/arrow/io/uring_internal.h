@@ -0,0 +1,150 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Local file reads through Linux io_uring
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/io/concurrency.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/memory_pool.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+namespace internal {
+
+struct ARROW_EXPORT UringOptions {
+  /// Number of submission queue entries, i.e. the maximum number of reads
+  /// in flight on the ring
+  int32_t queue_depth = 128;
+  /// Number of buffers registered with the kernel.  Reads returning a Buffer
+  /// and fitting in a registered buffer use it, which saves the kernel from
+  /// mapping the destination pages on each request.  The buffers are lent to
+  /// the caller until the returned Buffer is destroyed.
+  int32_t num_registered_buffers = 0;
+  /// Size of each registered buffer
+  int64_t registered_buffer_size = 1 << 20;
+  /// Pool to allocate the registered buffers from
+  MemoryPool* pool = default_memory_pool();
+};
+
+/// \brief An io_uring instance shared by several files
+///
+/// Reads are submitted by the calling threads, and their completions are
+/// reaped by a dedicated thread.  Requests submitted concurrently are handed
+/// to the kernel in batches.
+class ARROW_EXPORT Uring {
+ public:
+  ~Uring();
+
+  /// Whether io_uring was enabled at build time and is allowed by the
+  /// running kernel.
+  static bool IsSupported();
+
+  static Result<std::shared_ptr<Uring>> Make(const UringOptions& options = {});
+
+  /// \brief Read into caller-provided memory
+  ///
+  /// The future yields the number of bytes read, which is less than `nbytes`
+  /// only at end of file.  `out` must remain valid until the future completes.
+  /// `fd_owner` is released once `fd` is not needed anymore.
+  Future<int64_t> ReadAsync(int fd, int64_t position, int64_t nbytes, void* out,
+                            std::shared_ptr<void> fd_owner = NULLPTR);
+
+  /// \brief Read into a registered buffer if one is available, otherwise
+  /// into a buffer allocated from `pool`
+  Future<std::shared_ptr<Buffer>> ReadBufferAsync(
+      int fd, int64_t position, int64_t nbytes, MemoryPool* pool,
+      std::shared_ptr<void> fd_owner = NULLPTR);
+
+  /// \brief Submit several reads at once, with a single system call
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadBuffersAsync(
+      int fd, const std::vector<ReadRange>& ranges, MemoryPool* pool,
+      std::shared_ptr<void> fd_owner = NULLPTR);
+
+  /// Number of registered buffers not lent to any caller
+  int32_t num_free_registered_buffers() const;
+
+  class Ring;
+
+ private:
+  explicit Uring(std::shared_ptr<Ring> ring);
+
+  std::shared_ptr<Ring> ring_;
+};
+
+/// \brief A local file reading through an io_uring instance
+///
+/// ReadAsync() doesn't block a thread while the read is in progress.
+class ARROW_EXPORT UringReadableFile
+    : public RandomAccessFileConcurrencyWrapper<UringReadableFile> {
+ public:
+  ~UringReadableFile() override;
+
+  /// \brief Open a local file for reading
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] uring the io_uring instance to read through
+  /// \param[in] pool a MemoryPool for memory allocations
+  static Result<std::shared_ptr<UringReadableFile>> Open(
+      const std::string& path, std::shared_ptr<Uring> uring,
+      MemoryPool* pool = default_memory_pool());
+
+  bool closed() const override;
+
+  Future<std::shared_ptr<Buffer>> ReadAsync(const AsyncContext&, int64_t position,
+                                            int64_t nbytes) override;
+
+  /// \brief Read several ranges, submitting them to the kernel at once
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const std::vector<ReadRange>& ranges);
+
+ private:
+  friend RandomAccessFileConcurrencyWrapper<UringReadableFile>;
+
+  UringReadableFile(std::shared_ptr<Uring> uring, MemoryPool* pool);
+
+  Status DoClose();
+  Result<int64_t> DoTell() const;
+  Result<int64_t> DoRead(int64_t nbytes, void* out);
+  Result<std::shared_ptr<Buffer>> DoRead(int64_t nbytes);
+  Result<int64_t> DoReadAt(int64_t position, int64_t nbytes, void* out);
+  Result<std::shared_ptr<Buffer>> DoReadAt(int64_t position, int64_t nbytes);
+  Result<int64_t> DoGetSize();
+  Status DoSeek(int64_t position);
+
+  Status CheckClosed() const;
+
+  class FileDescriptor;
+
+  std::shared_ptr<Uring> uring_;
+  MemoryPool* pool_;
+  // Shared with the pending reads
+  std::shared_ptr<FileDescriptor> fd_;
+  int64_t size_ = -1;
+  int64_t position_ = 0;
+};
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
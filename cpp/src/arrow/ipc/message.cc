@@ -446,6 +446,11 @@ Status WriteMessage(const Buffer& message, const IpcWriteOptions& options,
 // ----------------------------------------------------------------------
 // Implement MessageDecoder
 
+bool MessageDecoderListener::AcceptsChunkedBody() const { return false; }
+Status MessageDecoderListener::OnChunkedMessageDecoded(std::shared_ptr<Buffer> metadata,
+                                                       BufferVector body_chunks) {
+  return Status::NotImplemented("Chunked message bodies are not supported");
+}
 Status MessageDecoderListener::OnInitial() { return Status::OK(); }
 Status MessageDecoderListener::OnMetadataLength() { return Status::OK(); }
 Status MessageDecoderListener::OnMetadata() { return Status::OK(); }
@@ -725,6 +730,27 @@ class MessageDecoder::MessageDecoderImpl {
       }
       buffered_size_ -= used_size;
       return Status::OK();
+    } else if (listener_->AcceptsChunkedBody()) {
+      // Hand over the chunks making up the body rather than concatenating them
+      BufferVector body_chunks;
+      int64_t required_size = next_required_size_;
+      while (required_size > 0) {
+        auto& chunk = chunks_[body_chunks.size()];
+        if (chunk->size() > required_size) {
+          body_chunks.push_back(SliceBuffer(chunk, 0, required_size));
+          chunk = SliceBuffer(chunk, required_size);
+          break;
+        }
+        required_size -= chunk->size();
+        body_chunks.push_back(std::move(chunk));
+      }
+      const auto n_used_chunks =
+          static_cast<int64_t>(body_chunks.size()) - (required_size > 0 ? 1 : 0);
+      chunks_.erase(chunks_.begin(), chunks_.begin() + n_used_chunks);
+      buffered_size_ -= next_required_size_;
+      RETURN_NOT_OK(
+          listener_->OnChunkedMessageDecoded(metadata_, std::move(body_chunks)));
+      return FinishMessage();
     } else {
       ARROW_ASSIGN_OR_RAISE(auto body, AllocateBuffer(next_required_size_, pool_));
       RETURN_NOT_OK(ConsumeDataChunks(next_required_size_, body->mutable_data()));
@@ -738,6 +764,10 @@ class MessageDecoder::MessageDecoderImpl {
                           Message::Open(metadata_, *buffer));
 
     RETURN_NOT_OK(listener_->OnMessageDecoded(std::move(message)));
+    return FinishMessage();
+  }
+
+  Status FinishMessage() {
     state_ = State::INITIAL;
     next_required_size_ = kMessageDecoderNextRequiredSizeInitial;
     RETURN_NOT_OK(listener_->OnInitial());
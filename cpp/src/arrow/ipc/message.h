@@ -160,6 +160,31 @@ class ARROW_EXPORT MessageDecoderListener {
   /// \return Status
   virtual Status OnMessageDecoded(std::unique_ptr<Message> message) = 0;
 
+  /// \brief Whether OnChunkedMessageDecoded() should be called for
+  /// messages whose body spans several consumed buffers.
+  ///
+  /// The default implementation returns false: such message bodies are
+  /// then concatenated and passed to OnMessageDecoded().
+  ///
+  /// \return whether the listener accepts chunked message bodies
+  virtual bool AcceptsChunkedBody() const;
+
+  /// \brief Called instead of OnMessageDecoded() when a message whose body
+  /// spans several consumed buffers is decoded, if AcceptsChunkedBody()
+  /// returns true.
+  ///
+  /// The body is given as slices of the consumed buffers, in order, so that
+  /// it can be read without concatenating them (e.g. with
+  /// io::ChunkedBufferReader).
+  ///
+  /// The default implementation returns arrow::Status::NotImplemented().
+  ///
+  /// \param[in] metadata the message metadata
+  /// \param[in] body_chunks the buffers making up the message body
+  /// \return Status
+  virtual Status OnChunkedMessageDecoded(std::shared_ptr<Buffer> metadata,
+                                         BufferVector body_chunks);
+
   /// \brief Called when the decoder state is changed to
   /// MessageDecoder::State::INITIAL.
   ///
@@ -353,7 +378,9 @@ class ARROW_EXPORT MessageDecoder {
   /// Users can use this method to avoid creating small
   /// chunks. Message body must be contiguous data. If users pass
   /// small chunks to the decoder, the decoder needs concatenate small
-  /// chunks internally. It causes performance overhead.
+  /// chunks internally, unless the listener accepts chunked message
+  /// bodies (see MessageDecoderListener::AcceptsChunkedBody()). It
+  /// causes performance overhead.
   ///
   /// Here is an example usage to reduce small chunks:
   ///
@@ -79,6 +79,9 @@ bool HasValidityBitmap(Type::type type_id, MetadataVersion version);
 
 static constexpr const char* kArrowMagicBytes = "ARROW1";
 
+// The key of the record batch statistics in the custom metadata of the file footer
+static constexpr const char* kRecordBatchStatisticsKey = "ARROW:record_batch_statistics";
+
 struct FieldMetadata {
   int64_t length;
   int64_t null_count;
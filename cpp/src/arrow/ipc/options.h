@@ -24,6 +24,7 @@
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/optional.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -62,10 +63,64 @@ struct ARROW_EXPORT IpcWriteOptions {
   Compression::type compression = Compression::UNCOMPRESSED;
   int compression_level = Compression::kUseDefaultCompressionLevel;
 
+  /// \brief Codec to compress body buffers with, if `compression` is set
+  ///
+  /// If unset, a codec is created for `compression` and `compression_level`
+  /// for each record batch. The codec must be of type `compression`. This
+  /// allows compressing with a trained dictionary (see
+  /// util::Codec::CreateWithDictionary), which improves the compression of
+  /// small record batches a lot. Readers then need IpcReadOptions::codec to be
+  /// a codec with the same dictionary.
+  std::shared_ptr<util::Codec> codec;
+
+  /// \brief Minimum space savings required for a body buffer to be compressed
+  ///
+  /// The space savings of a buffer are 1 - compressed size / uncompressed size.
+  /// Buffers that compress worse than this are written uncompressed, which is
+  /// signalled by an uncompressed length of -1 in their prefix. If unset, all
+  /// buffers are compressed.
+  util::optional<double> min_space_savings;
+
   /// \brief Use global CPU thread pool to parallelize any computational tasks
   /// like compression
   bool use_threads = true;
 
+  /// \brief Whether to emit dictionary deltas
+  ///
+  /// If a dictionary changes between two record batches, it is written
+  /// again before the second one. If this is true and the old dictionary is a
+  /// prefix of the new one, only the new entries are written, as a delta
+  /// dictionary batch. Otherwise the whole new dictionary is written, replacing
+  /// the old one; this isn't allowed in the IPC file format. Dictionary deltas
+  /// can't be read by implementations older than 1.0.0.
+  bool emit_dictionary_deltas = false;
+
+  /// \brief Coalesce small record batches into larger IPC messages
+  ///
+  /// If coalesce_rows or coalesce_bytes is positive, the record batches given
+  /// to RecordBatchWriter::WriteRecordBatch are held back until they reach
+  /// that many rows or that many bytes of buffers, then concatenated and
+  /// written as a single message. This saves the per-message overhead when
+  /// writing many small batches. RecordBatchWriter::Flush() and Close() write
+  /// whatever is held back.
+  int64_t coalesce_rows = 0;
+  int64_t coalesce_bytes = 0;
+  /// \brief If positive, the longest time in milliseconds a record batch may
+  /// be held back by coalescing
+  ///
+  /// This is only checked when writing a record batch.
+  int64_t coalesce_max_delay_ms = 0;
+
+  /// \brief Write per record batch column statistics to the file footer
+  ///
+  /// Only applies to the IPC file format. The number of rows of each record
+  /// batch, and the null count, minimum and maximum of each of its columns
+  /// are written to the custom metadata of the footer, so that readers can
+  /// skip record batches without decoding them (see ReadRecordBatchStatistics).
+  /// Minimum and maximum are only computed for boolean, numeric and temporal
+  /// columns.
+  bool write_statistics = false;
+
   /// \brief Format version to use for IPC messages and their metadata.
   ///
   /// Presently using V5 version (readable by 1.0.0 and later).
@@ -88,12 +143,24 @@ struct ARROW_EXPORT IpcReadOptions {
 
   /// \brief EXPERIMENTAL: Top-level schema fields to include when
   /// deserializing RecordBatch. If empty, return all deserialized fields
+  ///
+  /// With RecordBatchFileReader, only the buffers of the included fields are
+  /// read from the file (zero-copy if it is memory-mapped), and only they are
+  /// decompressed.
   std::vector<int> included_fields;
 
   /// \brief Use global CPU thread pool to parallelize any computational tasks
   /// like decompression
   bool use_threads = true;
 
+  /// \brief Codec to decompress body buffers with
+  ///
+  /// If unset, a codec is created for the compression of each record batch.
+  /// Otherwise it must be of the type the data was compressed with. This is
+  /// required to read data compressed with a dictionary (see
+  /// IpcWriteOptions::codec).
+  std::shared_ptr<util::Codec> codec;
+
   static IpcReadOptions Defaults();
 };
 
@@ -27,6 +27,7 @@
 #include <gtest/gtest.h>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/buffer.h"
 #include "arrow/builder.h"
 #include "arrow/io/file.h"
@@ -41,6 +42,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/tensor.h"
 #include "arrow/testing/extension_type.h"
 #include "arrow/testing/gtest_util.h"
@@ -347,6 +349,7 @@ const std::vector<test::MakeRecordBatch*> kBatchCases = {
     &MakeNestedDictionary,
     &MakeMap,
     &MakeMapOfDictionary,
+    &MakeRunEndEncoded,
     &MakeDates,
     &MakeTimestamps,
     &MakeTimes,
@@ -619,6 +622,22 @@ TEST_F(TestWriteRecordBatch, WriteWithCompression) {
     write_options.use_threads = false;
     read_options.use_threads = false;
     CheckRoundtrip(*batch, write_options, read_options);
+
+    // Buffers not compressing well enough are written uncompressed
+    write_options = IpcWriteOptions::Defaults();
+    write_options.compression = codec;
+    write_options.min_space_savings = 1.0;
+    CheckRoundtrip(*batch, write_options);
+    ASSERT_OK_AND_ASSIGN(auto fallback, SerializeRecordBatch(*batch, write_options));
+    write_options.compression = Compression::UNCOMPRESSED;
+    ASSERT_OK_AND_ASSIGN(auto uncompressed, SerializeRecordBatch(*batch, write_options));
+    // Only the length prefixes were added
+    ASSERT_GT(fallback->size(), uncompressed->size());
+    ASSERT_LT(fallback->size(), uncompressed->size() + 128);
+
+    write_options.compression = codec;
+    write_options.min_space_savings = 1.5;
+    ASSERT_RAISES(Invalid, SerializeRecordBatch(*batch, write_options));
   }
 
   std::vector<Compression::type> disallowed_codecs = {
@@ -634,6 +653,43 @@ TEST_F(TestWriteRecordBatch, WriteWithCompression) {
   }
 }
 
+TEST_F(TestWriteRecordBatch, WriteWithCompressionDictionary) {
+  if (!util::Codec::IsAvailable(Compression::ZSTD)) {
+    return;
+  }
+  random::RandomArrayGenerator rg(/*seed=*/0);
+  auto schema = ::arrow::schema({field("f0", utf8()), field("f1", int64())});
+  auto MakeBatch = [&](int64_t length) {
+    return RecordBatch::Make(
+        schema, length, {rg.String(length, 0, 4, 0.1), rg.Int64(length, 0, 10, 0.1)});
+  };
+
+  // Train the dictionary on the body buffers of small batches
+  BufferVector samples;
+  for (int i = 0; i < 200; ++i) {
+    auto batch = MakeBatch(20);
+    for (const auto& column : batch->columns()) {
+      for (const auto& buffer : column->data()->buffers) {
+        if (buffer && buffer->size() > 0) {
+          samples.push_back(buffer);
+        }
+      }
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto dictionary,
+                       util::Codec::TrainDictionary(Compression::ZSTD, samples, 1024));
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<util::Codec> codec,
+                       util::Codec::CreateWithDictionary(Compression::ZSTD, dictionary));
+
+  IpcWriteOptions write_options = IpcWriteOptions::Defaults();
+  write_options.compression = Compression::ZSTD;
+  write_options.codec = codec;
+  IpcReadOptions read_options = IpcReadOptions::Defaults();
+  read_options.codec = codec;
+  CheckRoundtrip(*MakeBatch(20), write_options, read_options);
+  CheckRoundtrip(*MakeBatch(1000), write_options, read_options);
+}
+
 TEST_F(TestWriteRecordBatch, SliceTruncatesBinaryOffsets) {
   // ARROW-6046
   std::shared_ptr<Array> array;
@@ -1056,6 +1112,18 @@ struct StreamDecoderLargeChunksWriterHelper : public StreamDecoderWriterHelper {
   }
 };
 
+struct StreamDecoderSlicedChunksWriterHelper : public StreamDecoderWriterHelper {
+  // Message bodies span several consumed buffers
+  Status DoConsume(StreamDecoder* decoder) override {
+    const int64_t chunk_size = 13;
+    for (int64_t offset = 0; offset < buffer_->size(); offset += chunk_size) {
+      RETURN_NOT_OK(decoder->Consume(SliceBuffer(
+          buffer_, offset, std::min(chunk_size, buffer_->size() - offset))));
+    }
+    return Status::OK();
+  }
+};
+
 // Parameterized mixin with tests for stream / file writer
 
 template <class WriterHelperType>
@@ -1291,6 +1359,9 @@ class TestStreamDecoderSmallChunks
 class TestStreamDecoderLargeChunks
     : public ReaderWriterMixin<StreamDecoderLargeChunksWriterHelper>,
       public ::testing::TestWithParam<MakeRecordBatch*> {};
+class TestStreamDecoderSlicedChunks
+    : public ReaderWriterMixin<StreamDecoderSlicedChunksWriterHelper>,
+      public ::testing::TestWithParam<MakeRecordBatch*> {};
 
 TEST_P(TestFileFormat, RoundTrip) {
   TestRoundTrip(*GetParam(), IpcWriteOptions::Defaults());
@@ -1503,6 +1574,16 @@ TEST_P(TestStreamDecoderLargeChunks, RoundTrip) {
   TestZeroLengthRoundTrip(*GetParam(), options);
 }
 
+TEST_P(TestStreamDecoderSlicedChunks, RoundTrip) {
+  TestRoundTrip(*GetParam(), IpcWriteOptions::Defaults());
+  TestZeroLengthRoundTrip(*GetParam(), IpcWriteOptions::Defaults());
+
+  IpcWriteOptions options;
+  options.write_legacy_ipc_format = true;
+  TestRoundTrip(*GetParam(), options);
+  TestZeroLengthRoundTrip(*GetParam(), options);
+}
+
 INSTANTIATE_TEST_SUITE_P(GenericIpcRoundTripTests, TestIpcRoundTrip,
                          ::testing::ValuesIn(kBatchCases));
 INSTANTIATE_TEST_SUITE_P(FileRoundTripTests, TestFileFormat,
@@ -1517,6 +1598,8 @@ INSTANTIATE_TEST_SUITE_P(StreamDecoderSmallChunksRoundTripTests,
                          TestStreamDecoderSmallChunks, ::testing::ValuesIn(kBatchCases));
 INSTANTIATE_TEST_SUITE_P(StreamDecoderLargeChunksRoundTripTests,
                          TestStreamDecoderLargeChunks, ::testing::ValuesIn(kBatchCases));
+INSTANTIATE_TEST_SUITE_P(StreamDecoderSlicedChunksRoundTripTests,
+                         TestStreamDecoderSlicedChunks, ::testing::ValuesIn(kBatchCases));
 
 TEST(TestIpcFileFormat, FooterMetaData) {
   // ARROW-6837
@@ -1535,6 +1618,70 @@ TEST(TestIpcFileFormat, FooterMetaData) {
   ASSERT_TRUE(out_metadata->Equals(*metadata));
 }
 
+TEST(TestIpcFileFormat, RecordBatchStatistics) {
+  auto my_schema =
+      schema({field("a", int32()), field("b", utf8()), field("c", date32())});
+  std::shared_ptr<Array> a0, a1, b0, b1, c0, c1;
+  ArrayFromVector<Int32Type, int32_t>({true, false, true}, {1, 0, -5}, &a0);
+  ArrayFromVector<Int32Type, int32_t>({false, false}, {7, 8}, &a1);
+  ArrayFromVector<StringType, std::string>({"x", "y", "z"}, &b0);
+  ArrayFromVector<StringType, std::string>({false, true}, {"", "w"}, &b1);
+  ArrayFromVector<Date32Type, int32_t>({30, 10, 20}, &c0);
+  ArrayFromVector<Date32Type, int32_t>({15, 25}, &c1);
+  auto metadata = key_value_metadata({"ARROW:example"}, {"something something"});
+
+  for (bool write_statistics : {false, true}) {
+    auto options = IpcWriteOptions::Defaults();
+    options.write_statistics = write_statistics;
+    ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create(0));
+    ASSERT_OK_AND_ASSIGN(auto writer,
+                         MakeFileWriter(sink.get(), my_schema, options, metadata));
+    ASSERT_OK(writer->WriteRecordBatch(*RecordBatch::Make(my_schema, 3, {a0, b0, c0})));
+    ASSERT_OK(writer->WriteRecordBatch(*RecordBatch::Make(my_schema, 2, {a1, b1, c1})));
+    ASSERT_OK(writer->Close());
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    auto file = std::make_shared<io::BufferReader>(buffer);
+    ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(file));
+    ASSERT_EQ(reader->metadata()->Get("ARROW:example").ValueOrDie(),
+              "something something");
+    ASSERT_OK_AND_ASSIGN(auto statistics, ReadRecordBatchStatistics(*reader));
+    if (!write_statistics) {
+      ASSERT_EQ(statistics, nullptr);
+      continue;
+    }
+    ASSERT_NE(statistics, nullptr);
+    ASSERT_OK(statistics->ValidateFull());
+    ASSERT_EQ(statistics->num_rows(), 2);
+    ASSERT_EQ(statistics->num_columns(), 4);
+
+    std::shared_ptr<Array> expected;
+    ArrayFromVector<Int64Type, int64_t>({3, 2}, &expected);
+    AssertArraysEqual(*expected, *statistics->column(0));
+
+    const auto& a_stats = checked_cast<const StructArray&>(*statistics->column(1));
+    ASSERT_EQ(a_stats.num_fields(), 3);
+    ArrayFromVector<Int64Type, int64_t>({1, 2}, &expected);
+    AssertArraysEqual(*expected, *a_stats.GetFieldByName("null_count"));
+    ArrayFromVector<Int32Type, int32_t>({true, false}, {-5, 0}, &expected);
+    AssertArraysEqual(*expected, *a_stats.GetFieldByName("min"));
+    ArrayFromVector<Int32Type, int32_t>({true, false}, {1, 0}, &expected);
+    AssertArraysEqual(*expected, *a_stats.GetFieldByName("max"));
+
+    // No min and max for strings
+    const auto& b_stats = checked_cast<const StructArray&>(*statistics->column(2));
+    ASSERT_EQ(b_stats.num_fields(), 1);
+    ArrayFromVector<Int64Type, int64_t>({0, 1}, &expected);
+    AssertArraysEqual(*expected, *b_stats.GetFieldByName("null_count"));
+
+    const auto& c_stats = checked_cast<const StructArray&>(*statistics->column(3));
+    ArrayFromVector<Date32Type, int32_t>({10, 15}, &expected);
+    AssertArraysEqual(*expected, *c_stats.GetFieldByName("min"));
+    ArrayFromVector<Date32Type, int32_t>({30, 25}, &expected);
+    AssertArraysEqual(*expected, *c_stats.GetFieldByName("max"));
+  }
+}
+
 // This test uses uninitialized memory
 
 #if !(defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER))
@@ -1583,6 +1730,322 @@ TEST_F(TestStreamFormat, ReadFieldSubset) { TestReadSubsetOfFields(); }
 
 TEST_F(TestFileFormat, ReadFieldSubset) { TestReadSubsetOfFields(); }
 
+// A file counting the bytes read from it
+class TrackedRandomAccessFile : public io::RandomAccessFile {
+ public:
+  explicit TrackedRandomAccessFile(std::shared_ptr<Buffer> buffer)
+      : reader_(std::move(buffer)) {}
+
+  Status Close() override { return reader_.Close(); }
+  bool closed() const override { return reader_.closed(); }
+  Result<int64_t> Tell() const override { return reader_.Tell(); }
+  Status Seek(int64_t position) override { return reader_.Seek(position); }
+  Result<int64_t> GetSize() override { return reader_.GetSize(); }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    bytes_read_ += nbytes;
+    return reader_.Read(nbytes, out);
+  }
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    bytes_read_ += nbytes;
+    return reader_.Read(nbytes);
+  }
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    bytes_read_ += nbytes;
+    return reader_.ReadAt(position, nbytes, out);
+  }
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    bytes_read_ += nbytes;
+    return reader_.ReadAt(position, nbytes);
+  }
+
+  int64_t bytes_read() const { return bytes_read_; }
+
+ private:
+  io::BufferReader reader_;
+  int64_t bytes_read_ = 0;
+};
+
+TEST(TestRecordBatchFileReader, ReadFieldSubsetOnlyReadsSelectedBuffers) {
+  constexpr int64_t kLength = 10000;
+  random::RandomArrayGenerator rg(/*seed=*/0);
+  auto my_schema = schema({field("a", int64()), field("b", int64()), field("c", utf8())});
+  auto batch = RecordBatch::Make(my_schema, kLength,
+                                 {rg.Int64(kLength, 0, 100, /*null_probability=*/0.1),
+                                  rg.Int64(kLength, 0, 100, /*null_probability=*/0),
+                                  rg.String(kLength, 0, 10, /*null_probability=*/0.1)});
+
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create(0));
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeFileWriter(sink.get(), my_schema));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  for (int selected = 0; selected < my_schema->num_fields(); ++selected) {
+    auto file = std::make_shared<TrackedRandomAccessFile>(buffer);
+    auto options = IpcReadOptions::Defaults();
+    options.included_fields = {selected};
+    ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(file, options));
+    const int64_t read_on_open = file->bytes_read();
+
+    ASSERT_OK_AND_ASSIGN(auto out, reader->ReadRecordBatch(0));
+    ASSERT_OK(out->ValidateFull());
+    AssertArraysEqual(*batch->column(selected), *out->column(0));
+
+    // Only the metadata and the buffers of the selected column were read
+    int64_t column_size = 0;
+    for (const auto& buf : batch->column_data(selected)->buffers) {
+      if (buf != nullptr) {
+        column_size += BitUtil::RoundUpToMultipleOf8(buf->size());
+      }
+    }
+    ASSERT_LE(file->bytes_read() - read_on_open, column_size + 1024);
+  }
+}
+
+TEST(TestRecordBatchFileReader, ReadRecordBatches) {
+  constexpr int64_t kLength = 1000;
+  constexpr int kNumBatches = 5;
+  random::RandomArrayGenerator rg(/*seed=*/0);
+  auto my_schema = schema({field("a", int64()), field("b", int64()), field("c", utf8())});
+
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create(0));
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeFileWriter(sink.get(), my_schema));
+  for (int i = 0; i < kNumBatches; ++i) {
+    auto batch = RecordBatch::Make(my_schema, kLength,
+                                   {rg.Int64(kLength, 0, 100, /*null_probability=*/0.1),
+                                    rg.Int64(kLength, 0, 100, /*null_probability=*/0),
+                                    rg.String(kLength, 0, 10, /*null_probability=*/0.1)});
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  const std::vector<int> indices = {3, 0, 4, 1};
+  auto cache_options = io::CacheOptions::Defaults();
+  // Small enough to only hold a few buffers at a time
+  cache_options.buffer_limit = 4096;
+
+  for (bool use_threads : {false, true}) {
+    for (const std::vector<int>& included_fields :
+         std::vector<std::vector<int>>{{}, {0, 2}, {1}}) {
+      auto options = IpcReadOptions::Defaults();
+      options.use_threads = use_threads;
+      options.included_fields = included_fields;
+      auto file = std::make_shared<io::BufferReader>(buffer);
+      ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(file, options));
+      ASSERT_OK_AND_ASSIGN(auto expected_reader,
+                           RecordBatchFileReader::Open(file, options));
+
+      ASSERT_OK_AND_ASSIGN(auto it,
+                           reader->ReadRecordBatches(indices, io::AsyncContext(),
+                                                     cache_options, /*readahead=*/2));
+      // The iterator keeps the reader alive
+      reader.reset();
+      for (int i : indices) {
+        ASSERT_OK_AND_ASSIGN(auto batch, it.Next());
+        ASSERT_NE(batch, nullptr);
+        ASSERT_OK(batch->ValidateFull());
+        ASSERT_OK_AND_ASSIGN(auto expected, expected_reader->ReadRecordBatch(i));
+        AssertBatchesEqual(*expected, *batch);
+      }
+      ASSERT_OK_AND_ASSIGN(auto batch, it.Next());
+      ASSERT_EQ(batch, nullptr);
+    }
+  }
+
+  auto file = std::make_shared<io::BufferReader>(buffer);
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(file));
+  ASSERT_RAISES(IndexError, reader->ReadRecordBatches({kNumBatches}, io::AsyncContext(),
+                                                      cache_options, 2));
+  ASSERT_RAISES(Invalid,
+                reader->ReadRecordBatches({1, 1}, io::AsyncContext(), cache_options, 2));
+}
+
+TEST(TestRecordBatchStreamWriter, CoalesceSmallBatches) {
+  constexpr int64_t kLength = 100;
+  constexpr int kNumBatches = 10;
+  random::RandomArrayGenerator rg(/*seed=*/0);
+  auto my_schema = schema({field("a", int64()), field("b", utf8())});
+  RecordBatchVector batches;
+  for (int i = 0; i < kNumBatches; ++i) {
+    batches.push_back(
+        RecordBatch::Make(my_schema, kLength,
+                          {rg.Int64(kLength, 0, 100, /*null_probability=*/0.1),
+                           rg.String(kLength, 0, 10, /*null_probability=*/0.1)}));
+  }
+  ASSERT_OK_AND_ASSIGN(auto expected, Table::FromRecordBatches(batches));
+
+  auto ReadBatches = [&](const std::shared_ptr<Buffer>& buffer) {
+    io::BufferReader buffer_reader(buffer);
+    RecordBatchVector out;
+    EXPECT_OK_AND_ASSIGN(auto reader, RecordBatchStreamReader::Open(&buffer_reader));
+    ARROW_EXPECT_OK(reader->ReadAll(&out));
+    return out;
+  };
+
+  auto options = IpcWriteOptions::Defaults();
+  options.coalesce_rows = 250;
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create(0));
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeStreamWriter(sink, my_schema, options));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  auto out = ReadBatches(buffer);
+  // Batches are held back until they reach 250 rows, the rest is written on close
+  ASSERT_EQ(out.size(), 4);
+  for (size_t i = 0; i < out.size(); ++i) {
+    ASSERT_OK(out[i]->ValidateFull());
+    ASSERT_EQ(out[i]->num_rows(), i < 3 ? 3 * kLength : kLength);
+  }
+  ASSERT_OK_AND_ASSIGN(auto actual, Table::FromRecordBatches(out));
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+
+  // Flush() writes the held back batches right away
+  options = IpcWriteOptions::Defaults();
+  options.coalesce_bytes = 1 << 20;
+  ASSERT_OK_AND_ASSIGN(sink, io::BufferOutputStream::Create(0));
+  ASSERT_OK_AND_ASSIGN(writer, MakeStreamWriter(sink, my_schema, options));
+  ASSERT_OK(writer->WriteRecordBatch(*batches[0]));
+  ASSERT_OK(writer->WriteRecordBatch(*batches[1]));
+  ASSERT_OK(writer->Flush());
+  ASSERT_OK(writer->WriteRecordBatch(*batches[2]));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(buffer, sink->Finish());
+
+  out = ReadBatches(buffer);
+  ASSERT_EQ(out.size(), 2);
+  ASSERT_EQ(out[0]->num_rows(), 2 * kLength);
+  ASSERT_EQ(out[1]->num_rows(), kLength);
+  ASSERT_OK_AND_ASSIGN(auto expected_first, Concatenate({batches[0]->column(1),
+                                                         batches[1]->column(1)}));
+  AssertArraysEqual(*expected_first, *out[0]->column(1));
+}
+
+class TestDictionaryChanges : public ::testing::Test {
+ public:
+  void SetUp() override {
+    auto type = dictionary(int8(), utf8());
+    schema_ = schema({field("f", type)});
+    std::shared_ptr<Array> indices, dict1, dict2, dict3;
+    ArrayFromVector<Int8Type, int8_t>({0, 1, 0}, &indices);
+    ArrayFromVector<StringType, std::string>({"foo", "bar"}, &dict1);
+    ArrayFromVector<StringType, std::string>({"foo", "bar", "quux"}, &dict2);
+    ArrayFromVector<StringType, std::string>({"quux", "foo"}, &dict3);
+    for (const auto& dict : {dict1, dict1, dict2, dict3}) {
+      ASSERT_OK_AND_ASSIGN(auto column, DictionaryArray::FromArrays(type, indices, dict));
+      batches_.push_back(RecordBatch::Make(schema_, indices->length(), {column}));
+    }
+  }
+
+  // Write the batches and return the dictionary batches, as (is_delta, length)
+  void WriteStream(const IpcWriteOptions& options,
+                   std::vector<std::pair<bool, int64_t>>* dictionary_batches) {
+    ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create(0));
+    ASSERT_OK_AND_ASSIGN(auto writer, MakeStreamWriter(sink, schema_, options));
+    for (const auto& batch : batches_) {
+      ASSERT_OK(writer->WriteRecordBatch(*batch));
+    }
+    ASSERT_OK(writer->Close());
+    ASSERT_OK_AND_ASSIGN(buffer_, sink->Finish());
+
+    io::BufferReader buffer_reader(buffer_);
+    auto message_reader = MessageReader::Open(&buffer_reader);
+    while (true) {
+      ASSERT_OK_AND_ASSIGN(auto message, message_reader->ReadNextMessage());
+      if (message == nullptr) {
+        break;
+      }
+      if (message->type() == MessageType::DICTIONARY_BATCH) {
+        auto fb_message = flatbuf::GetMessage(message->metadata()->data());
+        auto dictionary_batch = fb_message->header_as_DictionaryBatch();
+        dictionary_batches->emplace_back(dictionary_batch->isDelta(),
+                                         dictionary_batch->data()->length());
+      }
+    }
+  }
+
+  void CheckRoundtrip() {
+    io::BufferReader buffer_reader(buffer_);
+    ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchStreamReader::Open(&buffer_reader));
+    RecordBatchVector out;
+    ASSERT_OK(reader->ReadAll(&out));
+    ASSERT_EQ(out.size(), batches_.size());
+    for (size_t i = 0; i < out.size(); ++i) {
+      ASSERT_OK(out[i]->ValidateFull());
+      AssertBatchesEqual(*batches_[i], *out[i]);
+    }
+
+    auto listener = std::make_shared<CollectListener>();
+    StreamDecoder decoder(listener);
+    ASSERT_OK(decoder.Consume(buffer_));
+    out = listener->record_batches();
+    ASSERT_EQ(out.size(), batches_.size());
+    for (size_t i = 0; i < out.size(); ++i) {
+      ASSERT_OK(out[i]->ValidateFull());
+      AssertBatchesEqual(*batches_[i], *out[i]);
+    }
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_;
+  RecordBatchVector batches_;
+  std::shared_ptr<Buffer> buffer_;
+};
+
+TEST_F(TestDictionaryChanges, StreamReplacement) {
+  std::vector<std::pair<bool, int64_t>> dictionary_batches;
+  ASSERT_NO_FATAL_FAILURE(WriteStream(IpcWriteOptions::Defaults(), &dictionary_batches));
+  // Unchanged dictionaries aren't written again
+  std::vector<std::pair<bool, int64_t>> expected = {{false, 2}, {false, 3}, {false, 2}};
+  ASSERT_EQ(dictionary_batches, expected);
+  CheckRoundtrip();
+}
+
+TEST_F(TestDictionaryChanges, StreamDelta) {
+  auto options = IpcWriteOptions::Defaults();
+  options.emit_dictionary_deltas = true;
+  std::vector<std::pair<bool, int64_t>> dictionary_batches;
+  ASSERT_NO_FATAL_FAILURE(WriteStream(options, &dictionary_batches));
+  // The third dictionary extends the first one, the last one replaces it
+  std::vector<std::pair<bool, int64_t>> expected = {{false, 2}, {true, 1}, {false, 2}};
+  ASSERT_EQ(dictionary_batches, expected);
+  CheckRoundtrip();
+}
+
+TEST_F(TestDictionaryChanges, FileFormat) {
+  auto options = IpcWriteOptions::Defaults();
+  options.emit_dictionary_deltas = true;
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create(0));
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeFileWriter(sink, schema_, options));
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_OK(writer->WriteRecordBatch(*batches_[i]));
+  }
+  // Dictionary replacements are not supported by the file format
+  ASSERT_RAISES(Invalid, writer->WriteRecordBatch(*batches_[3]));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  // All the deltas are read upfront, which is fine as they only add entries
+  auto buffer_reader = std::make_shared<io::BufferReader>(buffer);
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(buffer_reader));
+  ASSERT_EQ(reader->num_record_batches(), 3);
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto batch, reader->ReadRecordBatch(i));
+    ASSERT_OK(batch->ValidateFull());
+    const auto& column = checked_cast<const DictionaryArray&>(*batch->column(0));
+    AssertArraysEqual(*column.indices(),
+                      *checked_cast<const DictionaryArray&>(*batches_[i]->column(0))
+                           .indices());
+    AssertArraysEqual(*column.dictionary(),
+                      *checked_cast<const DictionaryArray&>(*batches_[2]->column(0))
+                           .dictionary());
+  }
+}
+
 TEST(TestRecordBatchStreamReader, EmptyStreamWithDictionaries) {
   // ARROW-6006
   auto f0 = arrow::field("f0", arrow::dictionary(arrow::int8(), arrow::utf8()));
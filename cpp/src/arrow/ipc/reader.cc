@@ -21,6 +21,7 @@
 #include <climits>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -31,12 +32,14 @@
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/extension_type.h"
+#include "arrow/io/caching.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata_internal.h"
 #include "arrow/ipc/util.h"
 #include "arrow/ipc/writer.h"
+#include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
@@ -46,9 +49,12 @@
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/base64.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/future.h"
 #include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/ubsan.h"
 #include "arrow/visitor_inline.h"
 
@@ -107,14 +113,22 @@ Status InvalidMessageType(MessageType expected, MessageType actual) {
 
 /// The field_index and buffer_index are incremented based on how much of the
 /// batch is "consumed" (through nested data reconstruction, for example)
+///
+/// Buffers are read from the given file, which holds either the message body
+/// alone or, if body_length is non-negative, the body at body_offset within a
+/// larger file.  If read ranges are set, the file ranges of the buffers are
+/// recorded there instead of being read.
 class ArrayLoader {
  public:
   explicit ArrayLoader(const flatbuf::RecordBatch* metadata,
                        MetadataVersion metadata_version, const IpcReadOptions& options,
-                       io::RandomAccessFile* file)
+                       io::RandomAccessFile* file, int64_t body_offset = 0,
+                       int64_t body_length = -1)
       : metadata_(metadata),
         metadata_version_(metadata_version),
         file_(file),
+        body_offset_(body_offset),
+        body_length_(body_length),
         max_recursion_depth_(options.max_recursion_depth) {}
 
   Status ReadBuffer(int64_t offset, int64_t length, std::shared_ptr<Buffer>* out) {
@@ -132,7 +146,20 @@ class ArrayLoader {
       return Status::Invalid("Buffer ", buffer_index_,
                              " did not start on 8-byte aligned offset: ", offset);
     }
-    return file_->ReadAt(offset, length).Value(out);
+    if (body_length_ >= 0 && (offset > body_length_ || length > body_length_ - offset)) {
+      return Status::Invalid("Buffer ", buffer_index_, " at offset ", offset,
+                             " of length ", length, " exceeds the message body length ",
+                             body_length_);
+    }
+    if (read_ranges_ != nullptr) {
+      read_ranges_->push_back({body_offset_ + offset, length});
+      return Status::OK();
+    }
+    return file_->ReadAt(body_offset_ + offset, length).Value(out);
+  }
+
+  void set_read_ranges(std::vector<io::ReadRange>* read_ranges) {
+    read_ranges_ = read_ranges;
   }
 
   Status LoadType(const DataType& type) { return VisitTypeInline(type, this); }
@@ -345,6 +372,20 @@ class ArrayLoader {
     return LoadChildren(type.fields());
   }
 
+  Status Visit(const BinaryViewType& type) {
+    return Status::NotImplemented("IPC deserialization of ", type);
+  }
+
+  Status Visit(const RunEndEncodedType& type) {
+    out_->buffers.resize(1);
+    RETURN_NOT_OK(LoadCommon(type.id()));
+    if (out_->null_count != 0) {
+      return Status::Invalid("Run end encoded array cannot have a top-level null count");
+    }
+    out_->buffers[0] = nullptr;
+    return LoadChildren(type.fields());
+  }
+
   Status Visit(const DictionaryType& type) {
     // out_->dictionary will be filled later in ResolveDictionaries()
     return LoadType(*type.index_type());
@@ -356,18 +397,20 @@ class ArrayLoader {
   const flatbuf::RecordBatch* metadata_;
   const MetadataVersion metadata_version_;
   io::RandomAccessFile* file_;
+  const int64_t body_offset_;
+  const int64_t body_length_;
   int max_recursion_depth_;
   int buffer_index_ = 0;
   int field_index_ = 0;
   bool skip_io_ = false;
+  std::vector<io::ReadRange>* read_ranges_ = nullptr;
 
   const Field* field_;
   ArrayData* out_;
 };
 
 Result<std::shared_ptr<Buffer>> DecompressBuffer(const std::shared_ptr<Buffer>& buf,
-                                                 const IpcReadOptions& options,
-                                                 util::Codec* codec) {
+                                                 MemoryPool* pool, util::Codec* codec) {
   if (buf == nullptr || buf->size() == 0) {
     return buf;
   }
@@ -381,9 +424,12 @@ Result<std::shared_ptr<Buffer>> DecompressBuffer(const std::shared_ptr<Buffer>&
   const uint8_t* data = buf->data();
   int64_t compressed_size = buf->size() - sizeof(int64_t);
   int64_t uncompressed_size = BitUtil::FromLittleEndian(util::SafeLoadAs<int64_t>(data));
+  if (uncompressed_size == -1) {
+    // The buffer was written uncompressed, as compressing it didn't pay off
+    return SliceBuffer(buf, sizeof(int64_t), compressed_size);
+  }
 
-  ARROW_ASSIGN_OR_RAISE(auto uncompressed,
-                        AllocateBuffer(uncompressed_size, options.memory_pool));
+  ARROW_ASSIGN_OR_RAISE(auto uncompressed, AllocateBuffer(uncompressed_size, pool));
 
   ARROW_ASSIGN_OR_RAISE(
       int64_t actual_decompressed,
@@ -423,13 +469,16 @@ Status DecompressBuffers(Compression::type compression, const IpcReadOptions& op
   // Flatten all buffers
   auto buffers = BufferAccumulator{}.Get(*fields);
 
-  std::unique_ptr<util::Codec> codec;
-  ARROW_ASSIGN_OR_RAISE(codec, util::Codec::Create(compression));
+  std::shared_ptr<util::Codec> codec = options.codec;
+  if (codec == nullptr) {
+    ARROW_ASSIGN_OR_RAISE(codec, util::Codec::Create(compression));
+  }
+  MemoryPool* pool = GetTaggedMemoryPool(options.memory_pool, "ipc-decompression");
 
   return ::arrow::internal::OptionalParallelFor(
       options.use_threads, static_cast<int>(buffers.size()), [&](int i) {
         ARROW_ASSIGN_OR_RAISE(*buffers[i],
-                              DecompressBuffer(*buffers[i], options, codec.get()));
+                              DecompressBuffer(*buffers[i], pool, codec.get()));
         return Status::OK();
       });
 }
@@ -438,8 +487,10 @@ Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
     const flatbuf::RecordBatch* metadata, const std::shared_ptr<Schema>& schema,
     const std::vector<bool>* inclusion_mask, const DictionaryMemo* dictionary_memo,
     const IpcReadOptions& options, MetadataVersion metadata_version,
-    Compression::type compression, io::RandomAccessFile* file) {
-  ArrayLoader loader(metadata, metadata_version, options, file);
+    Compression::type compression, io::RandomAccessFile* file, int64_t body_offset,
+    int64_t body_length) {
+  ArrayLoader loader(metadata, metadata_version, options, file, body_offset,
+                     body_length);
 
   ArrayDataVector columns(schema->num_fields());
   ArrayDataVector filtered_columns;
@@ -490,13 +541,16 @@ Result<std::shared_ptr<RecordBatch>> LoadRecordBatch(
     const flatbuf::RecordBatch* metadata, const std::shared_ptr<Schema>& schema,
     const std::vector<bool>& inclusion_mask, const DictionaryMemo* dictionary_memo,
     const IpcReadOptions& options, MetadataVersion metadata_version,
-    Compression::type compression, io::RandomAccessFile* file) {
+    Compression::type compression, io::RandomAccessFile* file, int64_t body_offset = 0,
+    int64_t body_length = -1) {
   if (inclusion_mask.size() > 0) {
     return LoadRecordBatchSubset(metadata, schema, &inclusion_mask, dictionary_memo,
-                                 options, metadata_version, compression, file);
+                                 options, metadata_version, compression, file,
+                                 body_offset, body_length);
   } else {
     return LoadRecordBatchSubset(metadata, schema, nullptr, dictionary_memo, options,
-                                 metadata_version, compression, file);
+                                 metadata_version, compression, file, body_offset,
+                                 body_length);
   }
 }
 
@@ -571,17 +625,53 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
                          reader.get());
 }
 
+Status GetRecordBatchHeader(const Buffer& metadata, const flatbuf::Message** message,
+                            const flatbuf::RecordBatch** batch) {
+  RETURN_NOT_OK(internal::VerifyMessage(metadata.data(), metadata.size(), message));
+  if ((*message)->version() < internal::kMinMetadataVersion) {
+    return Status::Invalid("Old metadata version not supported");
+  }
+  *batch = (*message)->header_as_RecordBatch();
+  if (*batch == nullptr) {
+    return Status::IOError(
+        "Header-type of flatbuffer-encoded Message is not RecordBatch.");
+  }
+  return Status::OK();
+}
+
+// Append the file ranges of the buffers that ReadRecordBatchInternal() would
+// read for the record batch, without reading them
+Status GetRecordBatchReadRanges(const Buffer& metadata, const Schema& schema,
+                                const std::vector<bool>& inclusion_mask,
+                                const IpcReadOptions& options, int64_t body_offset,
+                                int64_t body_length, std::vector<io::ReadRange>* out) {
+  const flatbuf::Message* message = nullptr;
+  const flatbuf::RecordBatch* batch = nullptr;
+  RETURN_NOT_OK(GetRecordBatchHeader(metadata, &message, &batch));
+
+  ArrayLoader loader(batch, internal::GetMetadataVersion(message->version()), options,
+                     /*file=*/nullptr, body_offset, body_length);
+  loader.set_read_ranges(out);
+  for (int i = 0; i < schema.num_fields(); ++i) {
+    const Field& field = *schema.field(i);
+    if (inclusion_mask.empty() || inclusion_mask[i]) {
+      ArrayData column;
+      RETURN_NOT_OK(loader.Load(&field, &column));
+    } else {
+      RETURN_NOT_OK(loader.SkipField(&field));
+    }
+  }
+  return Status::OK();
+}
+
 Result<std::shared_ptr<RecordBatch>> ReadRecordBatchInternal(
     const Buffer& metadata, const std::shared_ptr<Schema>& schema,
     const std::vector<bool>& inclusion_mask, const DictionaryMemo* dictionary_memo,
-    const IpcReadOptions& options, io::RandomAccessFile* file) {
+    const IpcReadOptions& options, io::RandomAccessFile* file, int64_t body_offset = 0,
+    int64_t body_length = -1) {
   const flatbuf::Message* message = nullptr;
-  RETURN_NOT_OK(internal::VerifyMessage(metadata.data(), metadata.size(), &message));
-  auto batch = message->header_as_RecordBatch();
-  if (batch == nullptr) {
-    return Status::IOError(
-        "Header-type of flatbuffer-encoded Message is not RecordBatch.");
-  }
+  const flatbuf::RecordBatch* batch = nullptr;
+  RETURN_NOT_OK(GetRecordBatchHeader(metadata, &message, &batch));
 
   Compression::type compression;
   RETURN_NOT_OK(GetCompression(batch, &compression));
@@ -593,7 +683,7 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatchInternal(
   }
   return LoadRecordBatch(batch, schema, inclusion_mask, dictionary_memo, options,
                          internal::GetMetadataVersion(message->version()), compression,
-                         file);
+                         file, body_offset, body_length);
 }
 
 // If we are selecting only certain fields, populate an inclusion mask for fast lookups.
@@ -863,7 +953,44 @@ static inline FileBlock FileBlockFromFlatbuffer(const flatbuf::Block* block) {
   return FileBlock{block->offset(), block->metaDataLength(), block->bodyLength()};
 }
 
-class RecordBatchFileReaderImpl : public RecordBatchFileReader {
+// Serves the reads of ArrayLoader from a ReadRangeCache
+class CachedRandomAccessFile : public io::RandomAccessFile {
+ public:
+  explicit CachedRandomAccessFile(std::shared_ptr<io::internal::ReadRangeCache> cache)
+      : cache_(std::move(cache)) {}
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    return cache_->Read({position, nbytes});
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAt(position, nbytes));
+    std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+    return buffer->size();
+  }
+
+  Status Close() override { return Status::OK(); }
+  bool closed() const override { return false; }
+
+  Result<int64_t> GetSize() override { return NotSupported(); }
+  Result<int64_t> Tell() const override { return NotSupported(); }
+  Status Seek(int64_t position) override { return NotSupported(); }
+  Result<int64_t> Read(int64_t nbytes, void* out) override { return NotSupported(); }
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    return NotSupported();
+  }
+
+ private:
+  static Status NotSupported() {
+    return Status::NotImplemented("Only positional reads of cached ranges supported");
+  }
+
+  std::shared_ptr<io::internal::ReadRangeCache> cache_;
+};
+
+class RecordBatchFileReaderImpl
+    : public RecordBatchFileReader,
+      public std::enable_shared_from_this<RecordBatchFileReaderImpl> {
  public:
   RecordBatchFileReaderImpl() : file_(NULLPTR), footer_offset_(0), footer_(NULLPTR) {}
 
@@ -884,8 +1011,27 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
       read_dictionaries_ = true;
     }
 
+    const FileBlock block = GetRecordBatchBlock(i);
+    if (!field_inclusion_mask_.empty()) {
+      // Only some fields are selected: rather than reading the whole body,
+      // read their buffers one by one from the file. With a memory-mapped
+      // file, this doesn't touch the pages of the other fields at all.
+      ARROW_ASSIGN_OR_RAISE(auto metadata, ReadMessageMetadataFromBlock(block, file_));
+      const int64_t body_offset = block.offset + block.metadata_length;
+      // Hint all of those buffers at once, rather than have them paged in
+      // one at a time as they are read
+      std::vector<io::ReadRange> ranges;
+      RETURN_NOT_OK(GetRecordBatchReadRanges(*metadata, *schema_, field_inclusion_mask_,
+                                             options_, body_offset, block.body_length,
+                                             &ranges));
+      RETURN_NOT_OK(file_->WillNeed(ranges));
+      return ReadRecordBatchInternal(*metadata, schema_, field_inclusion_mask_,
+                                     &dictionary_memo_, options_, file_, body_offset,
+                                     block.body_length);
+    }
+
     std::unique_ptr<Message> message;
-    RETURN_NOT_OK(ReadMessageFromBlock(GetRecordBatchBlock(i), &message));
+    RETURN_NOT_OK(ReadMessageFromBlock(block, &message));
 
     CHECK_HAS_BODY(*message);
     ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
@@ -893,6 +1039,83 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
                                    &dictionary_memo_, options_, reader.get());
   }
 
+  Result<RecordBatchIterator> ReadRecordBatches(std::vector<int> indices,
+                                                const io::AsyncContext& ctx,
+                                                const io::CacheOptions& cache_options,
+                                                int readahead) override {
+    std::vector<bool> requested(num_record_batches(), false);
+    for (int i : indices) {
+      if (i < 0 || i >= num_record_batches()) {
+        return Status::IndexError("Record batch index ", i, " out of range");
+      }
+      if (requested[i]) {
+        return Status::Invalid("Record batch ", i, " requested more than once");
+      }
+      requested[i] = true;
+    }
+    if (!read_dictionaries_) {
+      RETURN_NOT_OK(ReadDictionaries());
+      read_dictionaries_ = true;
+    }
+
+    std::shared_ptr<io::RandomAccessFile> file = owned_file_;
+    if (file == nullptr) {
+      // The caller guarantees that the file outlives the reader
+      file = std::shared_ptr<io::RandomAccessFile>(file_, [](io::RandomAccessFile*) {});
+    }
+
+    auto state = std::make_shared<ReadRecordBatchesState>();
+    state->reader = shared_from_this();
+    state->options = options_;
+    // Batches are already decoded in parallel with each other
+    state->options.use_threads = false;
+
+    // First read the metadata of all the batches at once. It is small enough
+    // not to need a buffer limit.
+    std::vector<io::ReadRange> ranges;
+    for (int i : indices) {
+      const FileBlock block = GetRecordBatchBlock(i);
+      RETURN_NOT_OK(CheckMetadataBlock(block));
+      state->blocks.push_back(block);
+      ranges.push_back({block.offset, block.metadata_length});
+    }
+    io::CacheOptions metadata_cache_options = cache_options;
+    metadata_cache_options.buffer_limit = 0;
+    auto metadata_cache = std::make_shared<io::internal::ReadRangeCache>(
+        file, ctx, metadata_cache_options);
+    RETURN_NOT_OK(metadata_cache->Cache(ranges));
+    CachedRandomAccessFile metadata_file(std::move(metadata_cache));
+
+    // Then find out which parts of the bodies are needed and start fetching them
+    ranges.clear();
+    for (const FileBlock& block : state->blocks) {
+      ARROW_ASSIGN_OR_RAISE(auto metadata,
+                            ReadMessageMetadataFromBlock(block, &metadata_file));
+      RETURN_NOT_OK(GetRecordBatchReadRanges(
+          *metadata, *schema_, field_inclusion_mask_, options_,
+          block.offset + block.metadata_length, block.body_length, &ranges));
+      state->metadata.push_back(std::move(metadata));
+    }
+    std::sort(ranges.begin(), ranges.end(),
+              [](const io::ReadRange& a, const io::ReadRange& b) {
+                return a.offset < b.offset;
+              });
+    for (size_t i = 1; i < ranges.size(); ++i) {
+      if (ranges[i].offset < ranges[i - 1].offset + ranges[i - 1].length) {
+        return Status::Invalid("Overlapping buffers in IPC file at offset ",
+                               ranges[i].offset);
+      }
+    }
+    auto body_cache =
+        std::make_shared<io::internal::ReadRangeCache>(file, ctx, cache_options);
+    RETURN_NOT_OK(body_cache->Cache(std::move(ranges)));
+    state->file = std::make_shared<CachedRandomAccessFile>(std::move(body_cache));
+
+    const int max_in_flight = options_.use_threads ? std::max(readahead, 0) : 0;
+    return RecordBatchIterator(
+        ReadRecordBatchesIterator(std::move(state), max_in_flight));
+  }
+
   Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset,
               const IpcReadOptions& options) {
     owned_file_ = file;
@@ -916,6 +1139,65 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   std::shared_ptr<const KeyValueMetadata> metadata() const override { return metadata_; }
 
  private:
+  // What decoding the batches of ReadRecordBatches() needs, shared with the
+  // decoding tasks
+  struct ReadRecordBatchesState {
+    std::shared_ptr<RecordBatchFileReaderImpl> reader;
+    IpcReadOptions options;
+    std::vector<FileBlock> blocks;
+    std::vector<std::shared_ptr<Buffer>> metadata;
+    // Reads from the cache of the body ranges
+    std::shared_ptr<io::RandomAccessFile> file;
+
+    Result<std::shared_ptr<RecordBatch>> Decode(size_t i) const {
+      const FileBlock& block = blocks[i];
+      return ReadRecordBatchInternal(*metadata[i], reader->schema_,
+                                     reader->field_inclusion_mask_,
+                                     &reader->dictionary_memo_, options, file.get(),
+                                     block.offset + block.metadata_length,
+                                     block.body_length);
+    }
+  };
+
+  // Decodes up to max_in_flight batches ahead of the consumer on the CPU
+  // thread pool, or none if it is 0
+  class ReadRecordBatchesIterator {
+   public:
+    ReadRecordBatchesIterator(std::shared_ptr<ReadRecordBatchesState> state,
+                              int max_in_flight)
+        : state_(std::move(state)), max_in_flight_(max_in_flight) {}
+
+    Result<std::shared_ptr<RecordBatch>> Next() {
+      const size_t num_batches = state_->blocks.size();
+      if (max_in_flight_ == 0) {
+        if (next_ == num_batches) {
+          return IterationTraits<std::shared_ptr<RecordBatch>>::End();
+        }
+        return state_->Decode(next_++);
+      }
+      while (static_cast<int>(in_flight_.size()) < max_in_flight_ &&
+             next_ < num_batches) {
+        std::shared_ptr<ReadRecordBatchesState> state = state_;
+        const size_t i = next_++;
+        ARROW_ASSIGN_OR_RAISE(auto future, ::arrow::internal::GetCpuThreadPool()->Submit(
+                                               [state, i] { return state->Decode(i); }));
+        in_flight_.push_back(std::move(future));
+      }
+      if (in_flight_.empty()) {
+        return IterationTraits<std::shared_ptr<RecordBatch>>::End();
+      }
+      auto future = std::move(in_flight_.front());
+      in_flight_.pop_front();
+      return future.result();
+    }
+
+   private:
+    std::shared_ptr<ReadRecordBatchesState> state_;
+    const int max_in_flight_;
+    size_t next_ = 0;
+    std::deque<Future<std::shared_ptr<RecordBatch>>> in_flight_;
+  };
+
   FileBlock GetRecordBatchBlock(int i) const {
     return FileBlockFromFlatbuffer(footer_->recordBatches()->Get(i));
   }
@@ -937,6 +1219,49 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return ReadMessage(block.offset, block.metadata_length, file_).Value(out);
   }
 
+  Status CheckMetadataBlock(const FileBlock& block) {
+    if (!BitUtil::IsMultipleOf8(block.offset) ||
+        !BitUtil::IsMultipleOf8(block.metadata_length) ||
+        !BitUtil::IsMultipleOf8(block.body_length)) {
+      return Status::Invalid("Unaligned block in IPC file");
+    }
+    if (block.metadata_length < 2 * static_cast<int32_t>(sizeof(int32_t))) {
+      return Status::Invalid("Invalid metadata length ", block.metadata_length,
+                             " in IPC file block");
+    }
+    return Status::OK();
+  }
+
+  // Read the flatbuffer metadata of the message in the block, but not its body
+  Result<std::shared_ptr<Buffer>> ReadMessageMetadataFromBlock(
+      const FileBlock& block, io::RandomAccessFile* file) {
+    RETURN_NOT_OK(CheckMetadataBlock(block));
+    ARROW_ASSIGN_OR_RAISE(auto metadata,
+                          file->ReadAt(block.offset, block.metadata_length));
+    if (metadata->size() < block.metadata_length) {
+      return Status::Invalid("Expected to read ", block.metadata_length,
+                             " metadata bytes but got ", metadata->size());
+    }
+
+    // The flatbuffer is prefixed by its size, itself preceded by a
+    // continuation token since format version 0.15
+    int64_t prefix_length = sizeof(int32_t);
+    int32_t flatbuffer_length =
+        BitUtil::FromLittleEndian(util::SafeLoadAs<int32_t>(metadata->data()));
+    if (flatbuffer_length == internal::kIpcContinuationToken) {
+      prefix_length += sizeof(int32_t);
+      flatbuffer_length = BitUtil::FromLittleEndian(
+          util::SafeLoadAs<int32_t>(metadata->data() + sizeof(int32_t)));
+    }
+    if (flatbuffer_length <= 0 ||
+        flatbuffer_length > metadata->size() - prefix_length) {
+      return Status::Invalid("flatbuffer size ", flatbuffer_length,
+                             " invalid. File offset: ", block.offset,
+                             ", metadata length: ", block.metadata_length);
+    }
+    return SliceBuffer(metadata, prefix_length, flatbuffer_length);
+  }
+
   Status ReadDictionaries() {
     // Read all the dictionaries
     for (int i = 0; i < num_dictionaries(); ++i) {
@@ -1055,6 +1380,27 @@ Result<std::shared_ptr<RecordBatchFileReader>> RecordBatchFileReader::Open(
   return result;
 }
 
+Result<std::shared_ptr<RecordBatch>> ReadRecordBatchStatistics(
+    const RecordBatchFileReader& reader) {
+  const auto metadata = reader.metadata();
+  const int index =
+      metadata ? metadata->FindKey(internal::kRecordBatchStatisticsKey) : -1;
+  if (index == -1) {
+    return nullptr;
+  }
+  auto buffer = Buffer::FromString(arrow::util::base64_decode(metadata->value(index)));
+  io::BufferReader stream(buffer);
+  ARROW_ASSIGN_OR_RAISE(auto stream_reader, RecordBatchStreamReader::Open(&stream));
+  std::shared_ptr<RecordBatch> statistics;
+  RETURN_NOT_OK(stream_reader->ReadNext(&statistics));
+  if (statistics == nullptr ||
+      statistics->num_rows() != reader.num_record_batches() ||
+      statistics->num_columns() != reader.schema()->num_fields() + 1) {
+    return Status::Invalid("Record batch statistics don't match the IPC file");
+  }
+  return statistics;
+}
+
 Status Listener::OnEOS() { return Status::OK(); }
 
 Status Listener::OnSchemaDecoded(std::shared_ptr<Schema> schema) { return Status::OK(); }
@@ -1103,6 +1449,30 @@ class StreamDecoder::StreamDecoderImpl : public MessageDecoderListener {
     return Status::OK();
   }
 
+  bool AcceptsChunkedBody() const override { return true; }
+
+  Status OnChunkedMessageDecoded(std::shared_ptr<Buffer> metadata,
+                                 BufferVector body_chunks) override {
+    if (state_ == State::RECORD_BATCHES) {
+      ARROW_ASSIGN_OR_RAISE(auto message, Message::Open(metadata, nullptr));
+      if (message->type() == MessageType::RECORD_BATCH) {
+        // Read the record batch buffers straight from the consumed chunks,
+        // only buffers straddling chunk boundaries are copied
+        io::ChunkedBufferReader reader(std::move(body_chunks), options_.memory_pool);
+        ARROW_ASSIGN_OR_RAISE(
+            auto batch,
+            ReadRecordBatchInternal(*message->metadata(), schema_, field_inclusion_mask_,
+                                    &dictionary_memo_, options_, &reader));
+        return listener_->OnRecordBatchDecoded(std::move(batch));
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto body,
+                          ConcatenateBuffers(body_chunks, options_.memory_pool));
+    ARROW_ASSIGN_OR_RAISE(auto message,
+                          Message::Open(std::move(metadata), std::move(body)));
+    return OnMessageDecoded(std::move(message));
+  }
+
   Status OnEOS() override {
     state_ = State::EOS;
     return listener_->OnEOS();
@@ -25,10 +25,12 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/io/caching.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/options.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
+#include "arrow/util/iterator.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
@@ -159,8 +161,43 @@ class ARROW_EXPORT RecordBatchFileReader {
   /// \param[in] i the index of the record batch to return
   /// \return the read batch
   virtual Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(int i) = 0;
+
+  /// \brief Read several record batches, fetching their data ahead of time
+  ///
+  /// This is intended for high-latency filesystems (e.g. Amazon S3). The
+  /// metadata of all the requested batches is read at once, then the file
+  /// ranges holding their buffers (only those of the fields selected by
+  /// IpcReadOptions::included_fields) are coalesced and read in the background
+  /// through a ReadRangeCache configured by cache_options.
+  /// CacheOptions::buffer_limit can be used to bound the memory this takes.
+  ///
+  /// Up to `readahead` batches are decoded ahead of the consumer on the CPU
+  /// thread pool (if IpcReadOptions::use_threads is true).
+  ///
+  /// \param[in] indices the indices of the record batches to read, in order
+  /// \param[in] ctx the context to perform I/O in
+  /// \param[in] cache_options how to coalesce the reads
+  /// \param[in] readahead the number of batches to decode ahead
+  /// \return an iterator over the batches, which keeps the reader alive
+  virtual Result<RecordBatchIterator> ReadRecordBatches(
+      std::vector<int> indices, const io::AsyncContext& ctx,
+      const io::CacheOptions& cache_options, int readahead) = 0;
 };
 
+/// \brief Read the record batch statistics of an IPC file
+///
+/// The statistics are written with IpcWriteOptions::write_statistics. They are
+/// returned as a record batch with a row per record batch of the file: an int64
+/// "num_rows" column followed by a struct column per field of the file schema,
+/// with the "null_count" of the field and, for boolean, numeric and temporal
+/// fields, its "min" and "max" (null if all values are null).
+///
+/// \param[in] reader the reader of the file
+/// \return the statistics, or null if the file has none
+ARROW_EXPORT
+Result<std::shared_ptr<RecordBatch>> ReadRecordBatchStatistics(
+    const RecordBatchFileReader& reader);
+
 /// \class Listener
 /// \brief A general listener class to receive events.
 ///
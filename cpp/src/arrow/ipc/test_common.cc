@@ -786,6 +786,21 @@ Status MakeMapOfDictionary(std::shared_ptr<RecordBatch>* out) {
   return Status::OK();
 }
 
+Status MakeRunEndEncoded(std::shared_ptr<RecordBatch>* out) {
+  constexpr int64_t kNumRows = 7;
+  ARROW_ASSIGN_OR_RAISE(
+      auto a0, RunEndEncodedArray::Make(kNumRows, ArrayFromJSON(int16(), "[2, 3, 7]"),
+                                        ArrayFromJSON(int32(), "[-1, null, 4]")));
+  ARROW_ASSIGN_OR_RAISE(
+      auto a1,
+      RunEndEncodedArray::Make(kNumRows, ArrayFromJSON(int64(), "[1, 5, 6, 7]"),
+                               ArrayFromJSON(utf8(), R"(["foo", "bar", null, "bar"])")));
+  auto f0 = field("f0", a0->type());
+  auto f1 = field("f1", a1->type());
+  *out = RecordBatch::Make(::arrow::schema({f0, f1}), kNumRows, {a0, a1});
+  return Status::OK();
+}
+
 Status MakeDates(std::shared_ptr<RecordBatch>* out) {
   std::vector<bool> is_valid = {true, true, true, false, true, true, true};
   auto f0 = field("f0", date32());
@@ -134,6 +134,9 @@ Status MakeMap(std::shared_ptr<RecordBatch>* out);
 ARROW_TESTING_EXPORT
 Status MakeMapOfDictionary(std::shared_ptr<RecordBatch>* out);
 
+ARROW_TESTING_EXPORT
+Status MakeRunEndEncoded(std::shared_ptr<RecordBatch>* out);
+
 ARROW_TESTING_EXPORT
 Status MakeDates(std::shared_ptr<RecordBatch>* out);
 
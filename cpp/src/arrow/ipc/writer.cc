@@ -18,17 +18,24 @@
 #include "arrow/ipc/writer.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <limits>
 #include <sstream>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
 #include "arrow/buffer.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/exec.h"
 #include "arrow/device.h"
 #include "arrow/extension_type.h"
 #include "arrow/io/interfaces.h"
@@ -41,9 +48,11 @@
 #include "arrow/result_internal.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
+#include "arrow/scalar.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/base64.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
@@ -65,6 +74,7 @@ namespace ipc {
 
 using internal::FileBlock;
 using internal::kArrowMagicBytes;
+using internal::kRecordBatchStatisticsKey;
 
 namespace internal {
 
@@ -177,6 +187,20 @@ class RecordBatchSerializer {
     ARROW_ASSIGN_OR_RAISE(actual_length,
                           codec->Compress(buffer.size(), buffer.data(), maximum_length,
                                           result->mutable_data() + sizeof(int64_t)));
+
+    if (options_.min_space_savings.has_value() &&
+        1.0 - static_cast<double>(actual_length) / buffer.size() <
+            *options_.min_space_savings) {
+      // Not worth it: write the buffer as is, with an uncompressed length of -1
+      ARROW_ASSIGN_OR_RAISE(result, AllocateBuffer(buffer.size() + sizeof(int64_t)));
+      std::memcpy(result->mutable_data() + sizeof(int64_t), buffer.data(),
+                  buffer.size());
+      *reinterpret_cast<int64_t*>(result->mutable_data()) =
+          BitUtil::ToLittleEndian(static_cast<int64_t>(-1));
+      *out = std::move(result);
+      return Status::OK();
+    }
+
     *reinterpret_cast<int64_t*>(result->mutable_data()) =
         BitUtil::ToLittleEndian(buffer.size());
     *out = SliceBuffer(std::move(result), /*offset=*/0, actual_length + sizeof(int64_t));
@@ -184,12 +208,19 @@ class RecordBatchSerializer {
   }
 
   Status CompressBodyBuffers() {
-    std::unique_ptr<util::Codec> codec;
+    std::shared_ptr<util::Codec> codec = options_.codec;
 
     RETURN_NOT_OK(internal::CheckCompressionSupported(options_.compression));
+    if (options_.min_space_savings.has_value() &&
+        !(*options_.min_space_savings >= 0 && *options_.min_space_savings <= 1)) {
+      return Status::Invalid("min_space_savings must be between 0 and 1, got ",
+                             *options_.min_space_savings);
+    }
 
-    ARROW_ASSIGN_OR_RAISE(
-        codec, util::Codec::Create(options_.compression, options_.compression_level));
+    if (codec == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(
+          codec, util::Codec::Create(options_.compression, options_.compression_level));
+    }
 
     auto CompressOne = [&](size_t i) {
       if (out_->body_buffers[i]->size() > 0) {
@@ -508,6 +539,28 @@ class RecordBatchSerializer {
     return Status::OK();
   }
 
+  Status Visit(const BinaryViewArray& array) {
+    return Status::NotImplemented("IPC serialization of ", *array.type());
+  }
+
+  Status Visit(const RunEndEncodedArray& array) {
+    // There is no logical offset in the IPC format, so sliced arrays have their
+    // run ends rebased, which Concatenate does while copying only the runs in
+    // range. Otherwise only the children's trailing runs are cut off.
+    if (array.offset() != 0) {
+      ARROW_ASSIGN_OR_RAISE(auto rebased, Concatenate({MakeArray(array.data())},
+                                                      options_.memory_pool));
+      DCHECK_EQ(rebased->offset(), 0);
+      return VisitType(*rebased);
+    }
+    const int64_t physical_length = array.FindPhysicalLength();
+    --max_recursion_depth_;
+    RETURN_NOT_OK(VisitArray(*array.run_ends()->Slice(0, physical_length)));
+    RETURN_NOT_OK(VisitArray(*array.values()->Slice(0, physical_length)));
+    ++max_recursion_depth_;
+    return Status::OK();
+  }
+
   Status Visit(const DictionaryArray& array) {
     // Dictionary written out separately. Slice offset contained in the indices
     return VisitType(*array.indices());
@@ -559,6 +612,23 @@ class DictionarySerializer : public RecordBatchSerializer {
 
 }  // namespace internal
 
+namespace {
+
+// A shared buffer of zeros for each possible amount of padding to 8 bytes
+const std::shared_ptr<Buffer>& PaddingBuffer(int64_t padding) {
+  static const std::vector<std::shared_ptr<Buffer>> buffers = [] {
+    std::vector<std::shared_ptr<Buffer>> buffers;
+    for (int64_t i = 0; i < 8; ++i) {
+      buffers.push_back(std::make_shared<Buffer>(kPaddingBytes, i));
+    }
+    return buffers;
+  }();
+  DCHECK_LT(padding, 8);
+  return buffers[padding];
+}
+
+}  // namespace
+
 Status WriteIpcPayload(const IpcPayload& payload, const IpcWriteOptions& options,
                        io::OutputStream* dst, int32_t* metadata_length) {
   RETURN_NOT_OK(WriteMessage(*payload.metadata, options, dst, metadata_length));
@@ -567,26 +637,24 @@ Status WriteIpcPayload(const IpcPayload& payload, const IpcWriteOptions& options
   RETURN_NOT_OK(CheckAligned(dst));
 #endif
 
-  // Now write the buffers
+  // Now write the buffers, all at once so that a file sink can hand the whole
+  // body to the OS in one vectored write
+  std::vector<std::shared_ptr<Buffer>> body;
+  body.reserve(2 * payload.body_buffers.size());
   for (size_t i = 0; i < payload.body_buffers.size(); ++i) {
     const std::shared_ptr<Buffer>& buffer = payload.body_buffers[i];
-    int64_t size = 0;
-    int64_t padding = 0;
 
     // The buffer might be null if we are handling zero row lengths.
-    if (buffer) {
-      size = buffer->size();
-      padding = BitUtil::RoundUpToMultipleOf8(size) - size;
-    }
-
-    if (size > 0) {
-      RETURN_NOT_OK(dst->Write(buffer));
-    }
-
-    if (padding > 0) {
-      RETURN_NOT_OK(dst->Write(kPaddingBytes, padding));
+    if (buffer && buffer->size() > 0) {
+      body.push_back(buffer);
+      const int64_t padding =
+          BitUtil::RoundUpToMultipleOf8(buffer->size()) - buffer->size();
+      if (padding > 0) {
+        body.push_back(PaddingBuffer(padding));
+      }
     }
   }
+  RETURN_NOT_OK(dst->WriteBuffers(body));
 
 #ifndef NDEBUG
   RETURN_NOT_OK(CheckAligned(dst));
@@ -949,6 +1017,8 @@ Status RecordBatchWriter::WriteTable(const Table& table, int64_t max_chunksize)
 
 Status RecordBatchWriter::WriteTable(const Table& table) { return WriteTable(table, -1); }
 
+Status RecordBatchWriter::Flush() { return Status::OK(); }
+
 // ----------------------------------------------------------------------
 // Payload writer implementation
 
@@ -958,20 +1028,166 @@ IpcPayloadWriter::~IpcPayloadWriter() {}
 
 Status IpcPayloadWriter::Start() { return Status::OK(); }
 
+/// Collects the statistics of the record batches written to an IPC file, see
+/// IpcWriteOptions::write_statistics
+class RecordBatchStatisticsCollector {
+ public:
+  RecordBatchStatisticsCollector(const Schema& schema, MemoryPool* pool)
+      : schema_(schema), pool_(pool), columns_(schema.num_fields()) {}
+
+  Status Collect(const RecordBatch& batch) {
+    num_rows_.push_back(batch.num_rows());
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      const auto& column = *batch.column(i);
+      ColumnStatistics& statistics = columns_[i];
+      statistics.null_counts.push_back(column.null_count());
+      if (HasMinMax(*column.type())) {
+        std::shared_ptr<Array> min, max;
+        RETURN_NOT_OK(ColumnMinMax(column, &min, &max));
+        statistics.mins.push_back(std::move(min));
+        statistics.maxes.push_back(std::move(max));
+      }
+    }
+    return Status::OK();
+  }
+
+  int64_t num_batches() const { return static_cast<int64_t>(num_rows_.size()); }
+
+  /// Serialize the statistics as an IPC stream holding a record batch with a
+  /// row per record batch written, encoded in base64
+  Result<std::string> Finish() {
+    FieldVector fields = {field("num_rows", int64(), /*nullable=*/false)};
+    ArrayVector columns(1);
+    RETURN_NOT_OK(MakeInt64Array(num_rows_, &columns[0]));
+    for (int i = 0; i < schema_.num_fields(); ++i) {
+      const auto& type = schema_.field(i)->type();
+      ColumnStatistics& statistics = columns_[i];
+      FieldVector children_fields = {field("null_count", int64(), /*nullable=*/false)};
+      ArrayVector children(1);
+      RETURN_NOT_OK(MakeInt64Array(statistics.null_counts, &children[0]));
+      if (HasMinMax(*type)) {
+        children_fields.push_back(field("min", type));
+        children_fields.push_back(field("max", type));
+        ARROW_ASSIGN_OR_RAISE(auto mins, Concatenate(statistics.mins, pool_));
+        ARROW_ASSIGN_OR_RAISE(auto maxes, Concatenate(statistics.maxes, pool_));
+        children.push_back(std::move(mins));
+        children.push_back(std::move(maxes));
+      }
+      ARROW_ASSIGN_OR_RAISE(auto column, StructArray::Make(children, children_fields));
+      fields.push_back(field(schema_.field(i)->name(), column->type(), false));
+      columns.push_back(std::move(column));
+    }
+    auto batch = RecordBatch::Make(::arrow::schema(std::move(fields)), num_batches(),
+                                   std::move(columns));
+
+    auto options = IpcWriteOptions::Defaults();
+    options.memory_pool = pool_;
+    ARROW_ASSIGN_OR_RAISE(auto stream, io::BufferOutputStream::Create(1024, pool_));
+    ARROW_ASSIGN_OR_RAISE(auto writer,
+                          MakeStreamWriter(stream.get(), batch->schema(), options));
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+    RETURN_NOT_OK(writer->Close());
+    ARROW_ASSIGN_OR_RAISE(auto buffer, stream->Finish());
+    return arrow::util::base64_encode(buffer->data(),
+                                      static_cast<unsigned int>(buffer->size()));
+  }
+
+ private:
+  struct ColumnStatistics {
+    std::vector<int64_t> null_counts;
+    // Arrays of length 1, null if all values are null
+    ArrayVector mins, maxes;
+  };
+
+  static bool HasMinMax(const DataType& type) {
+    switch (type.id()) {
+      case Type::HALF_FLOAT:
+        return false;
+      case Type::BOOL:
+      case Type::DATE32:
+      case Type::DATE64:
+      case Type::TIMESTAMP:
+      case Type::TIME32:
+      case Type::TIME64:
+      case Type::DURATION:
+        return true;
+      default:
+        return is_integer(type.id()) || is_floating(type.id());
+    }
+  }
+
+  Status MakeInt64Array(const std::vector<int64_t>& values, std::shared_ptr<Array>* out) {
+    Int64Builder builder(pool_);
+    RETURN_NOT_OK(builder.AppendValues(values));
+    return builder.Finish(out);
+  }
+
+  Status ColumnMinMax(const Array& column, std::shared_ptr<Array>* min,
+                      std::shared_ptr<Array>* max) {
+    const auto& type = column.type();
+    if (column.null_count() == column.length()) {
+      ARROW_ASSIGN_OR_RAISE(*min, MakeArrayOfNull(type, 1, pool_));
+      *max = *min;
+      return Status::OK();
+    }
+    // The min_max kernel doesn't support temporal types, compute on their
+    // integer representation
+    std::shared_ptr<Array> values = column.Slice(0);
+    const bool is_temporal = type->id() != Type::BOOL && !is_integer(type->id()) &&
+                             !is_floating(type->id());
+    if (is_temporal) {
+      const int bit_width = checked_cast<const FixedWidthType&>(*type).bit_width();
+      ARROW_ASSIGN_OR_RAISE(values, values->View(bit_width == 32 ? int32() : int64()));
+    }
+    compute::ExecContext ctx(pool_);
+    ARROW_ASSIGN_OR_RAISE(
+        Datum min_max,
+        compute::MinMax(values, compute::MinMaxOptions::Defaults(), &ctx));
+    const auto& min_max_scalar = min_max.scalar_as<StructScalar>();
+    ARROW_ASSIGN_OR_RAISE(*min, MakeArrayFromScalar(*min_max_scalar.value[0], 1, pool_));
+    ARROW_ASSIGN_OR_RAISE(*max, MakeArrayFromScalar(*min_max_scalar.value[1], 1, pool_));
+    if (is_temporal) {
+      ARROW_ASSIGN_OR_RAISE(*min, (*min)->View(type));
+      ARROW_ASSIGN_OR_RAISE(*max, (*max)->View(type));
+    }
+    return Status::OK();
+  }
+
+  const Schema& schema_;
+  MemoryPool* pool_;
+  std::vector<int64_t> num_rows_;
+  std::vector<ColumnStatistics> columns_;
+};
+
+static std::shared_ptr<RecordBatchStatisticsCollector> MakeStatisticsCollector(
+    const Schema& schema, const IpcWriteOptions& options) {
+  if (!options.write_statistics) {
+    return nullptr;
+  }
+  return std::make_shared<RecordBatchStatisticsCollector>(schema, options.memory_pool);
+}
+
 class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
  public:
   // A RecordBatchWriter implementation that writes to a IpcPayloadWriter.
   IpcFormatWriter(std::unique_ptr<internal::IpcPayloadWriter> payload_writer,
-                  const Schema& schema, const IpcWriteOptions& options)
+                  const Schema& schema, const IpcWriteOptions& options,
+                  bool is_file_format = false,
+                  std::shared_ptr<RecordBatchStatisticsCollector> statistics = NULLPTR)
       : payload_writer_(std::move(payload_writer)),
         schema_(schema),
         mapper_(schema),
-        options_(options) {}
+        is_file_format_(is_file_format),
+        options_(options),
+        statistics_(std::move(statistics)) {}
 
   // A Schema-owning constructor variant
   IpcFormatWriter(std::unique_ptr<internal::IpcPayloadWriter> payload_writer,
-                  const std::shared_ptr<Schema>& schema, const IpcWriteOptions& options)
-      : IpcFormatWriter(std::move(payload_writer), *schema, options) {
+                  const std::shared_ptr<Schema>& schema, const IpcWriteOptions& options,
+                  bool is_file_format = false,
+                  std::shared_ptr<RecordBatchStatisticsCollector> statistics = NULLPTR)
+      : IpcFormatWriter(std::move(payload_writer), *schema, options, is_file_format,
+                        std::move(statistics)) {
     shared_schema_ = schema;
   }
 
@@ -979,23 +1195,58 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
     if (!batch.schema()->Equals(schema_, false /* check_metadata */)) {
       return Status::Invalid("Tried to write record batch with different schema");
     }
+    if (options_.coalesce_rows <= 0 && options_.coalesce_bytes <= 0) {
+      return WriteBatch(batch);
+    }
 
-    RETURN_NOT_OK(CheckStarted());
-
-    if (!wrote_dictionaries_) {
-      RETURN_NOT_OK(WriteDictionaries(batch));
-      wrote_dictionaries_ = true;
+    if (pending_batches_.empty()) {
+      pending_since_ = std::chrono::steady_clock::now();
+    }
+    pending_batches_.push_back(
+        RecordBatch::Make(batch.schema(), batch.num_rows(), batch.columns()));
+    pending_rows_ += batch.num_rows();
+    for (const auto& column : batch.column_data()) {
+      pending_bytes_ += GetBufferSize(*column);
     }
 
-    // TODO: Check for delta dictionaries. Can we scan for deltas while computing
-    // the RecordBatch payload to save time?
+    const auto delay = std::chrono::steady_clock::now() - pending_since_;
+    if ((options_.coalesce_rows > 0 && pending_rows_ >= options_.coalesce_rows) ||
+        (options_.coalesce_bytes > 0 && pending_bytes_ >= options_.coalesce_bytes) ||
+        (options_.coalesce_max_delay_ms > 0 &&
+         delay >= std::chrono::milliseconds(options_.coalesce_max_delay_ms))) {
+      return Flush();
+    }
+    return Status::OK();
+  }
 
-    IpcPayload payload;
-    RETURN_NOT_OK(GetRecordBatchPayload(batch, options_, &payload));
-    return payload_writer_->WritePayload(payload);
+  Status Flush() override {
+    if (pending_batches_.empty()) {
+      return Status::OK();
+    }
+    std::shared_ptr<RecordBatch> batch;
+    if (pending_batches_.size() == 1) {
+      batch = std::move(pending_batches_[0]);
+    } else {
+      const int num_columns = pending_batches_[0]->num_columns();
+      ArrayVector columns(num_columns);
+      for (int i = 0; i < num_columns; ++i) {
+        ArrayVector chunks;
+        for (const auto& pending : pending_batches_) {
+          chunks.push_back(pending->column(i));
+        }
+        ARROW_ASSIGN_OR_RAISE(columns[i], Concatenate(chunks, options_.memory_pool));
+      }
+      batch = RecordBatch::Make(pending_batches_[0]->schema(), pending_rows_,
+                                std::move(columns));
+    }
+    pending_batches_.clear();
+    pending_rows_ = 0;
+    pending_bytes_ = 0;
+    return WriteBatch(*batch);
   }
 
   Status Close() override {
+    RETURN_NOT_OK(Flush());
     RETURN_NOT_OK(CheckStarted());
     return payload_writer_->Close();
   }
@@ -1010,6 +1261,32 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
   }
 
  protected:
+  static int64_t GetBufferSize(const ArrayData& data) {
+    int64_t size = 0;
+    for (const auto& buffer : data.buffers) {
+      if (buffer != nullptr) {
+        size += buffer->size();
+      }
+    }
+    for (const auto& child : data.child_data) {
+      size += GetBufferSize(*child);
+    }
+    return size;
+  }
+
+  Status WriteBatch(const RecordBatch& batch) {
+    RETURN_NOT_OK(CheckStarted());
+    RETURN_NOT_OK(WriteDictionaries(batch));
+
+    if (statistics_ != nullptr) {
+      RETURN_NOT_OK(statistics_->Collect(batch));
+    }
+
+    IpcPayload payload;
+    RETURN_NOT_OK(GetRecordBatchPayload(batch, options_, &payload));
+    return payload_writer_->WritePayload(payload);
+  }
+
   Status CheckStarted() {
     if (!started_) {
       return Start();
@@ -1017,6 +1294,7 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
     return Status::OK();
   }
 
+  // Write the dictionaries of the batch which differ from the last written ones
   Status WriteDictionaries(const RecordBatch& batch) {
     ARROW_ASSIGN_OR_RAISE(const auto dictionaries, CollectDictionaries(batch, mapper_));
 
@@ -1025,8 +1303,31 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
       int64_t dictionary_id = pair.first;
       const auto& dictionary = pair.second;
 
-      RETURN_NOT_OK(GetDictionaryPayload(dictionary_id, dictionary, options_, &payload));
+      std::shared_ptr<Array>& last_dictionary = last_dictionaries_[dictionary_id];
+      if (last_dictionary == nullptr) {
+        RETURN_NOT_OK(
+            GetDictionaryPayload(dictionary_id, dictionary, options_, &payload));
+      } else if (last_dictionary->data() == dictionary->data() ||
+                 last_dictionary->Equals(dictionary)) {
+        continue;
+      } else if (options_.emit_dictionary_deltas &&
+                 dictionary->length() > last_dictionary->length() &&
+                 dictionary->RangeEquals(0, last_dictionary->length(), 0,
+                                         last_dictionary)) {
+        RETURN_NOT_OK(GetDictionaryPayload(dictionary_id, /*is_delta=*/true,
+                                           dictionary->Slice(last_dictionary->length()),
+                                           options_, &payload));
+      } else if (is_file_format_) {
+        return Status::Invalid(
+            "Dictionary replacement detected when writing IPC file format. "
+            "Arrow IPC files only support a single dictionary for a given field "
+            "across all batches, possibly extended by deltas.");
+      } else {
+        RETURN_NOT_OK(
+            GetDictionaryPayload(dictionary_id, dictionary, options_, &payload));
+      }
       RETURN_NOT_OK(payload_writer_->WritePayload(payload));
+      last_dictionary = dictionary;
     }
     return Status::OK();
   }
@@ -1035,9 +1336,19 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
   std::shared_ptr<Schema> shared_schema_;
   const Schema& schema_;
   const DictionaryFieldMapper mapper_;
+  const bool is_file_format_;
   bool started_ = false;
-  bool wrote_dictionaries_ = false;
   IpcWriteOptions options_;
+  // The dictionaries last written for each dictionary id
+  std::unordered_map<int64_t, std::shared_ptr<Array>> last_dictionaries_;
+  // Shared with the PayloadFileWriter, which writes them to the footer
+  std::shared_ptr<RecordBatchStatisticsCollector> statistics_;
+
+  // Record batches held back for coalescing
+  std::vector<std::shared_ptr<RecordBatch>> pending_batches_;
+  int64_t pending_rows_ = 0;
+  int64_t pending_bytes_ = 0;
+  std::chrono::steady_clock::time_point pending_since_;
 };
 
 class StreamBookKeeper {
@@ -1125,14 +1436,20 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
  public:
   PayloadFileWriter(const IpcWriteOptions& options, const std::shared_ptr<Schema>& schema,
                     const std::shared_ptr<const KeyValueMetadata>& metadata,
-                    io::OutputStream* sink)
-      : StreamBookKeeper(options, sink), schema_(schema), metadata_(metadata) {}
+                    io::OutputStream* sink,
+                    std::shared_ptr<RecordBatchStatisticsCollector> statistics = NULLPTR)
+      : StreamBookKeeper(options, sink),
+        schema_(schema),
+        metadata_(metadata),
+        statistics_(std::move(statistics)) {}
   PayloadFileWriter(const IpcWriteOptions& options, const std::shared_ptr<Schema>& schema,
                     const std::shared_ptr<const KeyValueMetadata>& metadata,
-                    std::shared_ptr<io::OutputStream> sink)
+                    std::shared_ptr<io::OutputStream> sink,
+                    std::shared_ptr<RecordBatchStatisticsCollector> statistics = NULLPTR)
       : StreamBookKeeper(options, std::move(sink)),
         schema_(schema),
-        metadata_(metadata) {}
+        metadata_(metadata),
+        statistics_(std::move(statistics)) {}
 
   ~PayloadFileWriter() override = default;
 
@@ -1179,11 +1496,20 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
     // Write 0 EOS message for compatibility with sequential readers
     RETURN_NOT_OK(WriteEOS());
 
+    std::shared_ptr<const KeyValueMetadata> metadata = metadata_;
+    if (statistics_ != nullptr && statistics_->num_batches() > 0) {
+      auto with_statistics =
+          metadata_ ? metadata_->Copy() : std::make_shared<KeyValueMetadata>();
+      ARROW_ASSIGN_OR_RAISE(auto statistics, statistics_->Finish());
+      RETURN_NOT_OK(with_statistics->Set(kRecordBatchStatisticsKey, statistics));
+      metadata = std::move(with_statistics);
+    }
+
     // Write file footer
     RETURN_NOT_OK(UpdatePosition());
     int64_t initial_position = position_;
     RETURN_NOT_OK(
-        WriteFileFooter(*schema_, dictionaries_, record_batches_, metadata_, sink_));
+        WriteFileFooter(*schema_, dictionaries_, record_batches_, metadata, sink_));
 
     // Write footer length
     RETURN_NOT_OK(UpdatePosition());
@@ -1203,6 +1529,7 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
  protected:
   std::shared_ptr<Schema> schema_;
   std::shared_ptr<const KeyValueMetadata> metadata_;
+  std::shared_ptr<RecordBatchStatisticsCollector> statistics_;
   std::vector<FileBlock> dictionaries_;
   std::vector<FileBlock> record_batches_;
 };
@@ -1236,20 +1563,23 @@ Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
     io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options,
     const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  auto statistics = internal::MakeStatisticsCollector(*schema, options);
   return std::make_shared<internal::IpcFormatWriter>(
       ::arrow::internal::make_unique<internal::PayloadFileWriter>(options, schema,
-                                                                  metadata, sink),
-      schema, options);
+                                                                  metadata, sink,
+                                                                  statistics),
+      schema, options, /*is_file_format=*/true, statistics);
 }
 
 Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
     std::shared_ptr<io::OutputStream> sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options,
     const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  auto statistics = internal::MakeStatisticsCollector(*schema, options);
   return std::make_shared<internal::IpcFormatWriter>(
       ::arrow::internal::make_unique<internal::PayloadFileWriter>(
-          options, schema, metadata, std::move(sink)),
-      schema, options);
+          options, schema, metadata, std::move(sink), statistics),
+      schema, options, /*is_file_format=*/true, statistics);
 }
 
 Result<std::shared_ptr<RecordBatchWriter>> NewFileWriter(
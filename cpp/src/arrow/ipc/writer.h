@@ -83,6 +83,14 @@ class ARROW_EXPORT RecordBatchWriter {
   /// \return Status
   Status WriteTable(const Table& table, int64_t max_chunksize);
 
+  /// \brief Write any record batches held back by the writer
+  ///
+  /// IPC writers hold back record batches when coalescing them (see
+  /// IpcWriteOptions::coalesce_rows). This doesn't flush the underlying sink.
+  ///
+  /// \return Status
+  virtual Status Flush();
+
   /// \brief Perform any logic necessary to finish the stream
   ///
   /// \return Status
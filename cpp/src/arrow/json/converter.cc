@@ -116,6 +116,11 @@ class NumericConverter : public PrimitiveConverter {
     if (in->type_id() == Type::NA) {
       return MakeArrayOfNull(out_type_, in->length(), pool_).Value(out);
     }
+    if (in->type()->Equals(*out_type_)) {
+      // converted by the parser
+      *out = in;
+      return Status::OK();
+    }
     const auto& dict_array = GetDictionaryArray(in);
 
     using Builder = typename TypeTraits<T>::BuilderType;
@@ -154,6 +159,11 @@ class DateTimeConverter : public PrimitiveConverter {
     if (in->type_id() == Type::NA) {
       return MakeArrayOfNull(out_type_, in->length(), pool_).Value(out);
     }
+    if (in->type()->Equals(*out_type_)) {
+      // converted by the parser
+      *out = in;
+      return Status::OK();
+    }
 
     std::shared_ptr<Array> repr;
     RETURN_NOT_OK(converter_.Convert(in, &repr));
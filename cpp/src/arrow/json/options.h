@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <memory>
 
+#include "arrow/util/cancel.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -38,6 +39,14 @@ enum class UnexpectedFieldBehavior : char {
   InferType
 };
 
+/// Implementation used by BlockParser to tokenize JSON
+enum class ParserBackend : char {
+  /// RapidJSON's SAX reader
+  RapidJSON,
+  /// A SIMD index of the block's structural characters, walked by a validating parser
+  StructuralIndex
+};
+
 struct ARROW_EXPORT ParseOptions {
   // Parsing options
 
@@ -52,6 +61,12 @@ struct ARROW_EXPORT ParseOptions {
   /// How JSON fields outside of explicit_schema (if given) are treated
   UnexpectedFieldBehavior unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
 
+  /// How JSON blocks are tokenized
+  ///
+  /// Both backends produce the same parsed arrays; they differ in speed and
+  /// in the wording of error messages.
+  ParserBackend parser_backend = ParserBackend::RapidJSON;
+
   /// Create parsing options with default values
   static ParseOptions Defaults();
 };
@@ -64,6 +79,9 @@ struct ARROW_EXPORT ReadOptions {
   /// Block size we request from the IO layer; also determines the size of
   /// chunks when use_threads is true
   int32_t block_size = 1 << 20;  // 1 MB
+  /// A token to cancel the read.  It is checked for each block, and the read
+  /// then fails with the stop error.
+  StopToken stop_token;
 
   /// Create read options with default values
   static ReadOptions Defaults();
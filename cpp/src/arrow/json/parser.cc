@@ -25,6 +25,7 @@
 #include <vector>
 
 #include "arrow/json/rapidjson_defs.h"
+#include "arrow/json/structural_index_internal.h"
 #include "rapidjson/error/en.h"
 #include "rapidjson/reader.h"
 
@@ -38,6 +39,7 @@
 #include "arrow/util/make_unique.h"
 #include "arrow/util/string_view.h"
 #include "arrow/util/trie.h"
+#include "arrow/util/value_parsing.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -100,6 +102,7 @@ Status Kind::ForType(const DataType& type, Kind::type* kind) {
     Status Visit(const NumberType&) { return SetKind(Kind::kNumber); }
     Status Visit(const TimeType&) { return SetKind(Kind::kNumber); }
     Status Visit(const DateType&) { return SetKind(Kind::kNumber); }
+    Status Visit(const TimestampType&) { return SetKind(Kind::kString); }
     Status Visit(const BinaryType&) { return SetKind(Kind::kString); }
     Status Visit(const FixedSizeBinaryType&) { return SetKind(Kind::kString); }
     Status Visit(const DictionaryType& dict_type) {
@@ -198,6 +201,116 @@ class RawArrayBuilder<Kind::kBoolean> {
   TypedBufferBuilder<bool> null_bitmap_builder_;
 };
 
+/// \brief builder for scalars converted while parsing
+///
+/// Used for the numeric and temporal fields of an explicit schema, so that
+/// their values are neither stored as characters nor parsed a second time by a
+/// Converter.
+class TypedScalarBuilder {
+ public:
+  virtual ~TypedScalarBuilder() = default;
+
+  /// Convert and append a value, Status::Invalid if it can't be converted
+  virtual Status Append(string_view repr) = 0;
+
+  virtual Status AppendNull() = 0;
+
+  virtual Status AppendNull(int64_t count) = 0;
+
+  virtual Status Finish(std::shared_ptr<Array>* out) = 0;
+
+  virtual int64_t length() = 0;
+};
+
+/// \brief TypedScalarBuilder of values parsed as ParseType
+///
+/// ParseType is the output type itself, or the integer representation of a
+/// date or time type.
+template <typename ParseType>
+class TypedScalarBuilderImpl : public TypedScalarBuilder {
+ public:
+  using value_type = typename ParseType::c_type;
+
+  TypedScalarBuilderImpl(std::shared_ptr<DataType> type,
+                         std::shared_ptr<DataType> parse_type, MemoryPool* pool)
+      : type_(std::move(type)),
+        parse_type_(std::move(parse_type)),
+        data_builder_(pool),
+        null_bitmap_builder_(pool) {}
+
+  Status Append(string_view repr) override {
+    value_type value;
+    if (ARROW_PREDICT_FALSE(!internal::ParseValue(
+            checked_cast<const ParseType&>(*parse_type_), repr.data(), repr.size(),
+            &value))) {
+      return Status::Invalid("couldn't convert ", repr, " to ", *type_);
+    }
+    RETURN_NOT_OK(data_builder_.Append(value));
+    return null_bitmap_builder_.Append(true);
+  }
+
+  Status AppendNull() override {
+    RETURN_NOT_OK(data_builder_.Append(value_type{}));
+    return null_bitmap_builder_.Append(false);
+  }
+
+  Status AppendNull(int64_t count) override {
+    RETURN_NOT_OK(data_builder_.Append(count, value_type{}));
+    return null_bitmap_builder_.Append(count, false);
+  }
+
+  Status Finish(std::shared_ptr<Array>* out) override {
+    auto size = length();
+    auto null_count = null_bitmap_builder_.false_count();
+    std::shared_ptr<Buffer> data, null_bitmap;
+    RETURN_NOT_OK(data_builder_.Finish(&data));
+    RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+    *out = MakeArray(ArrayData::Make(type_, size, {null_bitmap, data}, null_count));
+    return Status::OK();
+  }
+
+  int64_t length() override { return null_bitmap_builder_.length(); }
+
+ private:
+  std::shared_ptr<DataType> type_, parse_type_;
+  TypedBufferBuilder<value_type> data_builder_;
+  TypedBufferBuilder<bool> null_bitmap_builder_;
+};
+
+/// \brief make a TypedScalarBuilder, or leave `out` empty if values of
+/// `type` are left to a Converter
+static Status MakeTypedScalarBuilder(const std::shared_ptr<DataType>& type,
+                                     MemoryPool* pool,
+                                     std::unique_ptr<TypedScalarBuilder>* out) {
+  switch (type->id()) {
+#define TYPED_SCALAR_CASE(TYPE_ID, PARSE_TYPE, PARSE_TYPE_INSTANCE)                 \
+  case TYPE_ID:                                                                     \
+    *out = make_unique<TypedScalarBuilderImpl<PARSE_TYPE>>(type, PARSE_TYPE_INSTANCE, \
+                                                           pool);                   \
+    break
+    TYPED_SCALAR_CASE(Type::INT8, Int8Type, type);
+    TYPED_SCALAR_CASE(Type::INT16, Int16Type, type);
+    TYPED_SCALAR_CASE(Type::INT32, Int32Type, type);
+    TYPED_SCALAR_CASE(Type::INT64, Int64Type, type);
+    TYPED_SCALAR_CASE(Type::UINT8, UInt8Type, type);
+    TYPED_SCALAR_CASE(Type::UINT16, UInt16Type, type);
+    TYPED_SCALAR_CASE(Type::UINT32, UInt32Type, type);
+    TYPED_SCALAR_CASE(Type::UINT64, UInt64Type, type);
+    TYPED_SCALAR_CASE(Type::FLOAT, FloatType, type);
+    TYPED_SCALAR_CASE(Type::DOUBLE, DoubleType, type);
+    TYPED_SCALAR_CASE(Type::TIMESTAMP, TimestampType, type);
+    TYPED_SCALAR_CASE(Type::DATE32, Int32Type, int32());
+    TYPED_SCALAR_CASE(Type::TIME32, Int32Type, int32());
+    TYPED_SCALAR_CASE(Type::DATE64, Int64Type, int64());
+    TYPED_SCALAR_CASE(Type::TIME64, Int64Type, int64());
+#undef TYPED_SCALAR_CASE
+    default:
+      out->reset();
+      break;
+  }
+  return Status::OK();
+}
+
 /// \brief builder for strings or unconverted numbers
 ///
 /// Both of these are represented in the builder as an index only;
@@ -208,11 +321,17 @@ class RawArrayBuilder<Kind::kBoolean> {
 /// On completion the indices and the character storage are combined
 /// into a dictionary-encoded array, which is a convenient container
 /// for indices referring into another array.
+///
+/// If a TypedScalarBuilder is set, values are converted to its type instead.
 class ScalarBuilder {
  public:
   explicit ScalarBuilder(MemoryPool* pool)
       : values_length_(0), data_builder_(pool), null_bitmap_builder_(pool) {}
 
+  TypedScalarBuilder* typed() const { return typed_.get(); }
+
+  void typed(std::unique_ptr<TypedScalarBuilder> typed) { typed_ = std::move(typed); }
+
   Status Append(int32_t index, int32_t value_length) {
     RETURN_NOT_OK(data_builder_.Append(index));
     values_length_ += value_length;
@@ -220,11 +339,17 @@ class ScalarBuilder {
   }
 
   Status AppendNull() {
+    if (typed_) {
+      return typed_->AppendNull();
+    }
     RETURN_NOT_OK(data_builder_.Append(0));
     return null_bitmap_builder_.Append(false);
   }
 
   Status AppendNull(int64_t count) {
+    if (typed_) {
+      return typed_->AppendNull(count);
+    }
     RETURN_NOT_OK(data_builder_.Append(count, 0));
     return null_bitmap_builder_.Append(count, false);
   }
@@ -239,11 +364,14 @@ class ScalarBuilder {
     return Status::OK();
   }
 
-  int64_t length() { return null_bitmap_builder_.length(); }
+  int64_t length() {
+    return typed_ ? typed_->length() : null_bitmap_builder_.length();
+  }
 
   int32_t values_length() { return values_length_; }
 
  private:
+  std::unique_ptr<TypedScalarBuilder> typed_;
   int32_t values_length_;
   TypedBufferBuilder<int32_t> data_builder_;
   TypedBufferBuilder<bool> null_bitmap_builder_;
@@ -393,6 +521,11 @@ class RawBuilderSet {
  public:
   explicit RawBuilderSet(MemoryPool* pool) : pool_(pool) {}
 
+  /// Builders made for numeric and temporal types convert their values while
+  /// parsing.  If types may be promoted, int64 and timestamp values are left to
+  /// the Converters instead, which may promote them (see GetPromotionGraph).
+  void allow_promotion(bool allow_promotion) { allow_promotion_ = allow_promotion; }
+
   /// Retrieve a pointer to a builder from a BuilderPtr
   template <Kind::type kind>
   enable_if_t<kind != Kind::kNull, RawArrayBuilder<kind>*> Cast(BuilderPtr builder) {
@@ -411,7 +544,9 @@ class RawBuilderSet {
   }
 
   /// construct a builder of whatever kind corresponds to a DataType
-  Status MakeBuilder(const DataType& t, int64_t leading_nulls, BuilderPtr* builder) {
+  Status MakeBuilder(const std::shared_ptr<DataType>& type, int64_t leading_nulls,
+                     BuilderPtr* builder) {
+    const DataType& t = *type;
     Kind::type kind;
     RETURN_NOT_OK(Kind::ForType(t, &kind));
     switch (kind) {
@@ -423,17 +558,17 @@ class RawBuilderSet {
         return MakeBuilder<Kind::kBoolean>(leading_nulls, builder);
 
       case Kind::kNumber:
-        return MakeBuilder<Kind::kNumber>(leading_nulls, builder);
+        return MakeScalarBuilder<Kind::kNumber>(type, leading_nulls, builder);
 
       case Kind::kString:
-        return MakeBuilder<Kind::kString>(leading_nulls, builder);
+        return MakeScalarBuilder<Kind::kString>(type, leading_nulls, builder);
 
       case Kind::kArray: {
         RETURN_NOT_OK(MakeBuilder<Kind::kArray>(leading_nulls, builder));
         const auto& list_type = static_cast<const ListType&>(t);
 
         BuilderPtr value_builder;
-        RETURN_NOT_OK(MakeBuilder(*list_type.value_type(), 0, &value_builder));
+        RETURN_NOT_OK(MakeBuilder(list_type.value_type(), 0, &value_builder));
         value_builder.nullable = list_type.value_field()->nullable();
 
         Cast<Kind::kArray>(*builder)->value_builder(value_builder);
@@ -445,7 +580,7 @@ class RawBuilderSet {
 
         for (const auto& f : struct_type.fields()) {
           BuilderPtr field_builder;
-          RETURN_NOT_OK(MakeBuilder(*f->type(), leading_nulls, &field_builder));
+          RETURN_NOT_OK(MakeBuilder(f->type(), leading_nulls, &field_builder));
           field_builder.nullable = f->nullable();
 
           Cast<Kind::kObject>(*builder)->AddField(f->name(), field_builder);
@@ -543,6 +678,9 @@ class RawBuilderSet {
   /// finish a column of scalar values (string or number)
   Status FinishScalar(const std::shared_ptr<Array>& scalar_values, ScalarBuilder* builder,
                       std::shared_ptr<Array>* out) {
+    if (builder->typed()) {
+      return builder->typed()->Finish(out);
+    }
     std::shared_ptr<Array> indices;
     // TODO(bkietz) embed builder->values_length() in this output somehow
     RETURN_NOT_OK(builder->Finish(&indices));
@@ -551,12 +689,28 @@ class RawBuilderSet {
     return Status::OK();
   }
 
+  /// construct a builder of numbers or strings, converting its values to `type`
+  /// while parsing if possible
+  template <Kind::type kind>
+  Status MakeScalarBuilder(const std::shared_ptr<DataType>& type, int64_t leading_nulls,
+                           BuilderPtr* builder) {
+    RETURN_NOT_OK(MakeBuilder<kind>(0, builder));
+    const bool promotable = type->id() == Type::INT64 || type->id() == Type::TIMESTAMP;
+    if (!(allow_promotion_ && promotable)) {
+      std::unique_ptr<TypedScalarBuilder> typed;
+      RETURN_NOT_OK(MakeTypedScalarBuilder(type, pool_, &typed));
+      Cast<kind>(*builder)->typed(std::move(typed));
+    }
+    return Cast<kind>(*builder)->AppendNull(leading_nulls);
+  }
+
   template <Kind::type kind>
   std::vector<RawArrayBuilder<kind>>& arena() {
     return std::get<static_cast<std::size_t>(kind)>(arenas_);
   }
 
   MemoryPool* pool_;
+  bool allow_promotion_ = false;
   std::tuple<std::tuple<>, std::vector<RawArrayBuilder<Kind::kBoolean>>,
              std::vector<RawArrayBuilder<Kind::kNumber>>,
              std::vector<RawArrayBuilder<Kind::kString>>,
@@ -639,12 +793,18 @@ class HandlerBase : public BlockParser,
   /// @}
 
   /// \brief Set up builders using an expected Schema
-  Status Initialize(const std::shared_ptr<Schema>& s) {
+  ///
+  /// Numeric and temporal fields of the schema are converted while parsing.
+  Status Initialize(const std::shared_ptr<Schema>& s, ParserBackend backend,
+                    UnexpectedFieldBehavior unexpected_field_behavior) {
+    backend_ = backend;
     auto type = struct_({});
     if (s) {
       type = struct_(s->fields());
     }
-    return builder_set_.MakeBuilder(*type, 0, &builder_);
+    builder_set_.allow_promotion(unexpected_field_behavior ==
+                                 UnexpectedFieldBehavior::InferType);
+    return builder_set_.MakeBuilder(type, 0, &builder_);
   }
 
   Status Finish(std::shared_ptr<Array>* parsed) override {
@@ -704,6 +864,12 @@ class HandlerBase : public BlockParser,
   template <typename Handler>
   Status DoParse(Handler& handler, const std::shared_ptr<Buffer>& json) {
     RETURN_NOT_OK(ReserveScalarStorage(json->size()));
+    if (backend_ == ParserBackend::StructuralIndex) {
+      auto data = reinterpret_cast<const char*>(json->data());
+      RETURN_NOT_OK(structural_index_.Build(data, json->size()));
+      StructuralParser parser(data, json->size(), structural_index_);
+      return parser.Parse(&handler, kMaxParserNumRows, &num_rows_);
+    }
     rj::MemoryStream ms(reinterpret_cast<const char*>(json->data()), json->size());
     using InputStream = rj::EncodedInputStream<rj::UTF8<>, rj::MemoryStream>;
     return DoParse(handler, InputStream(ms));
@@ -718,6 +884,13 @@ class HandlerBase : public BlockParser,
     if (ARROW_PREDICT_FALSE(builder.kind != kind)) {
       return IllegallyChangedTo(kind);
     }
+    if (auto typed = Cast<kind>(builder)->typed()) {
+      Status st = typed->Append(scalar);
+      if (ARROW_PREDICT_FALSE(st.IsInvalid())) {
+        return ParseError("Column(", Path(), ") ", st.message(), " in row ", num_rows_);
+      }
+      return st;
+    }
     auto index = static_cast<int32_t>(scalar_values_builder_.length());
     auto value_length = static_cast<int32_t>(scalar.size());
     RETURN_NOT_OK(Cast<kind>(builder)->Append(index, value_length));
@@ -843,6 +1016,9 @@ class HandlerBase : public BlockParser,
   // top of this stack == field_index_
   std::vector<int> field_index_stack_;
   StringBuilder scalar_values_builder_;
+  ParserBackend backend_ = ParserBackend::RapidJSON;
+  // reused across blocks when backend_ == ParserBackend::StructuralIndex
+  StructuralIndex structural_index_;
 };
 
 template <UnexpectedFieldBehavior>
@@ -1086,7 +1262,9 @@ Status BlockParser::Make(MemoryPool* pool, const ParseOptions& options,
       *out = make_unique<Handler<UnexpectedFieldBehavior::InferType>>(pool);
       break;
   }
-  return static_cast<HandlerBase&>(**out).Initialize(options.explicit_schema);
+  return static_cast<HandlerBase&>(**out).Initialize(options.explicit_schema,
+                                                     options.parser_backend,
+                                                     options.unexpected_field_behavior);
 }
 
 Status BlockParser::Make(const ParseOptions& options, std::unique_ptr<BlockParser>* out) {
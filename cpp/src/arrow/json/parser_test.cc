@@ -67,7 +67,8 @@ void AssertUnconvertedArraysEqual(const Array& expected, const Array& actual) {
       return AssertUnconvertedStructArraysEqual(static_cast<const StructArray&>(expected),
                                                 static_cast<const StructArray&>(actual));
     default:
-      FAIL();
+      // converted by the parser
+      return AssertArraysEqual(expected, actual);
   }
 }
 
@@ -104,8 +105,8 @@ TEST(BlockParserWithSchema, Basics) {
   options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
   AssertParseColumns(
       options, scalars_only_src(),
-      {field("hello", utf8()), field("world", boolean()), field("yo", utf8())},
-      {"[\"3.5\", \"3.25\", \"3.125\", \"0.0\"]", "[false, null, null, true]",
+      {field("hello", float64()), field("world", boolean()), field("yo", utf8())},
+      {"[3.5, 3.25, 3.125, 0.0]", "[false, null, null, true]",
        "[\"thing\", null, \"\xe5\xbf\x8d\", null]"});
 }
 
@@ -116,7 +117,7 @@ TEST(BlockParserWithSchema, Empty) {
   options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
   AssertParseColumns(
       options, "",
-      {field("hello", utf8()), field("world", boolean()), field("yo", utf8())},
+      {field("hello", float64()), field("world", boolean()), field("yo", utf8())},
       {"[]", "[]", "[]"});
 }
 
@@ -125,8 +126,8 @@ TEST(BlockParserWithSchema, SkipFieldsOutsideSchema) {
   options.explicit_schema = schema({field("hello", float64()), field("yo", utf8())});
   options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
   AssertParseColumns(options, scalars_only_src(),
-                     {field("hello", utf8()), field("yo", utf8())},
-                     {"[\"3.5\", \"3.25\", \"3.125\", \"0.0\"]",
+                     {field("hello", float64()), field("yo", utf8())},
+                     {"[3.5, 3.25, 3.125, 0.0]",
                       "[\"thing\", null, \"\xe5\xbf\x8d\", null]"});
 }
 
@@ -184,11 +185,50 @@ TEST(BlockParserWithSchema, Nested) {
                                     field("nuf", struct_({field("ps", int32())}))});
   options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
   AssertParseColumns(options, nested_src(),
-                     {field("yo", utf8()), field("arr", list(utf8())),
-                      field("nuf", struct_({field("ps", utf8())}))},
+                     {field("yo", utf8()), field("arr", list(int32())),
+                      field("nuf", struct_({field("ps", int32())}))},
                      {"[\"thing\", null, \"\xe5\xbf\x8d\", null]",
-                      R"([["1", "2", "3"], ["2"], [], null])",
-                      R"([{"ps":null}, null, {"ps":"78"}, {"ps":"90"}])"});
+                      R"([[1, 2, 3], [2], [], null])",
+                      R"([{"ps":null}, null, {"ps":78}, {"ps":90}])"});
+}
+
+TEST(BlockParserWithSchema, ConvertTemporal) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema =
+      schema({field("ts", timestamp(TimeUnit::SECOND)), field("d", date32())});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+  AssertParseColumns(options, R"({"ts": "1970-01-01", "d": 1}
+{"ts": null, "d": null}
+{"ts": "2018-11-13 17:11:10"}
+)",
+                     {field("ts", timestamp(TimeUnit::SECOND)), field("d", date32())},
+                     {R"(["1970-01-01", null, "2018-11-13 17:11:10"])",
+                      "[1, null, null]"});
+}
+
+TEST(BlockParserWithSchema, PromotableTypesUnconverted) {
+  // With type inference, int64 and timestamp columns may be promoted to another
+  // type by the converters
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema =
+      schema({field("i", int64()), field("ts", timestamp(TimeUnit::SECOND)),
+              field("u", uint64())});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  AssertParseColumns(options, R"({"i": 1, "ts": "1970-01-01", "u": 2})",
+                     {field("i", utf8()), field("ts", utf8()), field("u", uint64())},
+                     {R"(["1"])", R"(["1970-01-01"])", "[2]"});
+}
+
+TEST(BlockParserWithSchema, FailOnUnconvertible) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema = schema({field("a", int32())});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  std::shared_ptr<Array> parsed;
+  Status error = ParseFromString(options, "{\"a\":0}\n{\"a\":1.5}", &parsed);
+  ASSERT_RAISES(Invalid, error);
+  EXPECT_THAT(error.message(),
+              testing::StartsWith(
+                  "JSON parse error: Column(/a) couldn't convert 1.5 to int32 in row 1"));
 }
 
 TEST(BlockParserWithSchema, FailOnIncompleteJson) {
@@ -233,5 +273,100 @@ TEST(BlockParser, AdHoc) {
        R"([{"c":true, "d": "1991-02-03"}, {"c":false, "d":"2019-04-01"}])"});
 }
 
+class BlockParserBackendTest : public ::testing::TestWithParam<ParserBackend> {
+ public:
+  ParseOptions Options(UnexpectedFieldBehavior behavior,
+                       std::shared_ptr<Schema> explicit_schema = nullptr) {
+    auto options = ParseOptions::Defaults();
+    options.explicit_schema = std::move(explicit_schema);
+    options.unexpected_field_behavior = behavior;
+    options.parser_backend = GetParam();
+    return options;
+  }
+};
+
+TEST_P(BlockParserBackendTest, Basics) {
+  AssertParseColumns(
+      Options(UnexpectedFieldBehavior::InferType), scalars_only_src(),
+      {field("hello", utf8()), field("world", boolean()), field("yo", utf8())},
+      {"[\"3.5\", \"3.25\", \"3.125\", \"0.0\"]", "[false, null, null, true]",
+       "[\"thing\", null, \"\xe5\xbf\x8d\", null]"});
+}
+
+TEST_P(BlockParserBackendTest, Nested) {
+  AssertParseColumns(Options(UnexpectedFieldBehavior::InferType), nested_src(),
+                     {field("yo", utf8()), field("arr", list(utf8())),
+                      field("nuf", struct_({field("ps", utf8())}))},
+                     {"[\"thing\", null, \"\xe5\xbf\x8d\", null]",
+                      R"([["1", "2", "3"], ["2"], [], null])",
+                      R"([{"ps":null}, null, {"ps":"78"}, {"ps":"90"}])"});
+}
+
+TEST_P(BlockParserBackendTest, SkipFieldsOutsideSchema) {
+  auto options = Options(UnexpectedFieldBehavior::Ignore,
+                         schema({field("a", int32()), field("c", utf8())}));
+  AssertParseColumns(options, R"({"a": 1, "b": {"x": [1, {"y": [[]]}]}, "c": "x"}
+{"b": [{}, null, "s", 2.5], "a": 2}
+)",
+                     {field("a", utf8()), field("c", utf8())},
+                     {R"(["1", "2"])", R"(["x", null])"});
+}
+
+TEST_P(BlockParserBackendTest, Escapes) {
+  AssertParseColumns(
+      Options(UnexpectedFieldBehavior::InferType),
+      R"({"s": "a\"b\\c\/d", "k\u00e9y": "\b\f\n\r\t"}
+{"s": "\u00e9\u5fcd\ud83d\ude00", "k\u00e9y": ""}
+)",
+      {field("s", utf8()), field("k\xc3\xa9y", utf8())},
+      {R"(["a\"b\\c/d", "\u00e9\u5fcd\ud83d\ude00"])", R"(["\b\f\n\r\t", ""])"});
+}
+
+TEST_P(BlockParserBackendTest, Numbers) {
+  AssertParseColumns(Options(UnexpectedFieldBehavior::InferType),
+                     R"({"n": -0}
+{"n": 1.5e+3}
+{"n": 2E-2}
+{"n": 12345678901234}
+)",
+                     {field("n", utf8())},
+                     {R"(["-0", "1.5e+3", "2E-2", "12345678901234"])"});
+}
+
+TEST_P(BlockParserBackendTest, Whitespace) {
+  AssertParseColumns(Options(UnexpectedFieldBehavior::InferType),
+                     "\t{ \"a\" :\r[ 1 ,2\t] , \"b\":true}  \n\n  {\"a\":[],\"b\":false}",
+                     {field("a", list(utf8())), field("b", boolean())},
+                     {R"([["1", "2"], []])", "[true, false]"});
+}
+
+TEST_P(BlockParserBackendTest, FailOnInconvertible) {
+  std::shared_ptr<Array> parsed;
+  Status error = ParseFromString(
+      Options(UnexpectedFieldBehavior::InferType, schema({field("a", int32())})),
+      "{\"a\":0}\n{\"a\":true}", &parsed);
+  ASSERT_RAISES(Invalid, error);
+  EXPECT_THAT(
+      error.message(),
+      testing::StartsWith(
+          "JSON parse error: Column(/a) changed from number to boolean in row 1"));
+}
+
+TEST_P(BlockParserBackendTest, FailOnMalformedJson) {
+  for (auto json : {"{\"a\":0,}", "{\"a\" 0}", "{0:1}", "{\"a\":[0 1]}", "{\"a\":[0,]}",
+                    "{\"a\":\"b}", "{\"a\":01}", "{\"a\":1.}", "{\"a\":1e}", "{\"a\":-}",
+                    "{\"a\":nul}", "{\"a\":\"\\x\"}", "{\"a\":\"\\u12g4\"}",
+                    "{\"a\":\"\\ud800\"}", "{\"a\":", "{\"a\":0}}"}) {
+    std::shared_ptr<Array> parsed;
+    SCOPED_TRACE(json);
+    ASSERT_RAISES(Invalid, ParseFromString(Options(UnexpectedFieldBehavior::InferType),
+                                           json, &parsed));
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(BlockParserBackendTest, BlockParserBackendTest,
+                         ::testing::Values(ParserBackend::RapidJSON,
+                                           ParserBackend::StructuralIndex));
+
 }  // namespace json
 }  // namespace arrow
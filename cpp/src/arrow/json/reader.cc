@@ -17,6 +17,8 @@
 
 #include "arrow/json/reader.h"
 
+#include <algorithm>
+#include <deque>
 #include <utility>
 #include <vector>
 
@@ -29,8 +31,10 @@
 #include "arrow/json/parser.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
+#include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/make_unique.h"
 #include "arrow/util/string_view.h"
 #include "arrow/util/task_group.h"
 #include "arrow/util/thread_pool.h"
@@ -45,6 +49,127 @@ using internal::ThreadPool;
 
 namespace json {
 
+namespace {
+
+// A block of JSON data, delimited into whole objects
+struct ChunkedBlock {
+  // Trailing data of the previous block, completed by `completion`
+  std::shared_ptr<Buffer> partial;
+  std::shared_ptr<Buffer> completion;
+  std::shared_ptr<Buffer> whole;
+};
+
+// Delimit blocks read from an iterator into whole objects
+class BlockChunker {
+ public:
+  BlockChunker(const ParseOptions& parse_options,
+               Iterator<std::shared_ptr<Buffer>> block_iterator)
+      : chunker_(MakeChunker(parse_options)),
+        block_iterator_(std::move(block_iterator)),
+        partial_(std::make_shared<Buffer>("")) {}
+
+  // Read the first block, returning false if the input is empty
+  Result<bool> Init() {
+    ARROW_ASSIGN_OR_RAISE(block_, block_iterator_.Next());
+    return block_ != nullptr;
+  }
+
+  // Delimit the next block, returning false at end of input
+  Result<bool> Next(ChunkedBlock* out) {
+    if (block_ == nullptr) {
+      return false;
+    }
+    std::shared_ptr<Buffer> next_block, whole, completion, next_partial;
+    ARROW_ASSIGN_OR_RAISE(next_block, block_iterator_.Next());
+
+    if (next_block == nullptr) {
+      // End of file reached => compute completion from penultimate block
+      RETURN_NOT_OK(chunker_->ProcessFinal(partial_, block_, &completion, &whole));
+    } else {
+      std::shared_ptr<Buffer> starts_with_whole;
+      // Get completion of partial from previous block.
+      RETURN_NOT_OK(chunker_->ProcessWithPartial(partial_, block_, &completion,
+                                                 &starts_with_whole));
+
+      // Get all whole objects entirely inside the current buffer
+      RETURN_NOT_OK(chunker_->Process(starts_with_whole, &whole, &next_partial));
+    }
+    *out = ChunkedBlock{partial_, completion, whole};
+    partial_ = std::move(next_partial);
+    block_ = std::move(next_block);
+    return true;
+  }
+
+ private:
+  std::unique_ptr<Chunker> chunker_;
+  Iterator<std::shared_ptr<Buffer>> block_iterator_;
+  std::shared_ptr<Buffer> block_;
+  std::shared_ptr<Buffer> partial_;
+};
+
+Result<std::shared_ptr<Array>> ParseBlock(MemoryPool* pool,
+                                          const ParseOptions& parse_options,
+                                          const ChunkedBlock& block) {
+  const auto& partial = block.partial;
+  const auto& completion = block.completion;
+  const auto& whole = block.whole;
+
+  std::unique_ptr<BlockParser> parser;
+  RETURN_NOT_OK(BlockParser::Make(pool, parse_options, &parser));
+  RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
+                                             whole->size()));
+
+  if (partial->size() != 0 || completion->size() != 0) {
+    std::shared_ptr<Buffer> straddling;
+    if (partial->size() == 0) {
+      straddling = completion;
+    } else if (completion->size() == 0) {
+      straddling = partial;
+    } else {
+      ARROW_ASSIGN_OR_RAISE(straddling, ConcatenateBuffers({partial, completion}, pool));
+    }
+    RETURN_NOT_OK(parser->Parse(straddling));
+  }
+
+  if (whole->size() != 0) {
+    RETURN_NOT_OK(parser->Parse(whole));
+  }
+
+  std::shared_ptr<Array> parsed;
+  RETURN_NOT_OK(parser->Finish(&parsed));
+  return parsed;
+}
+
+const PromotionGraph* MaybePromotionGraph(const ParseOptions& parse_options) {
+  return parse_options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
+             ? GetPromotionGraph()
+             : nullptr;
+}
+
+std::shared_ptr<DataType> GetInitialType(const ParseOptions& parse_options) {
+  return parse_options.explicit_schema
+             ? struct_(parse_options.explicit_schema->fields())
+             : struct_({});
+}
+
+// Convert parsed blocks, promoting their types to a common type if a
+// promotion graph is given
+Result<std::shared_ptr<ChunkedArray>> ConvertBlocks(
+    MemoryPool* pool, const PromotionGraph* promotion_graph,
+    const std::shared_ptr<DataType>& type, const ArrayVector& parsed) {
+  std::shared_ptr<ChunkedArrayBuilder> builder;
+  RETURN_NOT_OK(MakeChunkedArrayBuilder(TaskGroup::MakeSerial(), pool, promotion_graph,
+                                        type, &builder));
+  for (size_t i = 0; i < parsed.size(); ++i) {
+    builder->Insert(static_cast<int64_t>(i), field("", parsed[i]->type()), parsed[i]);
+  }
+  std::shared_ptr<ChunkedArray> converted;
+  RETURN_NOT_OK(builder->Finish(&converted));
+  return converted;
+}
+
+}  // namespace
+
 class TableReaderImpl : public TableReader,
                         public std::enable_shared_from_this<TableReaderImpl> {
  public:
@@ -54,56 +179,40 @@ class TableReaderImpl : public TableReader,
       : pool_(pool),
         read_options_(read_options),
         parse_options_(parse_options),
-        chunker_(MakeChunker(parse_options_)),
         task_group_(std::move(task_group)) {}
 
   Status Init(std::shared_ptr<io::InputStream> input) {
     ARROW_ASSIGN_OR_RAISE(auto it,
                           io::MakeInputStreamIterator(input, read_options_.block_size));
-    return MakeReadaheadIterator(std::move(it), task_group_->parallelism())
-        .Value(&block_iterator_);
+    ARROW_ASSIGN_OR_RAISE(it, MakeReadaheadIterator(std::move(it),
+                                                    task_group_->parallelism()));
+    chunker_ = internal::make_unique<BlockChunker>(parse_options_, std::move(it));
+    return Status::OK();
   }
 
   Result<std::shared_ptr<Table>> Read() override {
     RETURN_NOT_OK(MakeBuilder());
 
-    ARROW_ASSIGN_OR_RAISE(auto block, block_iterator_.Next());
-    if (block == nullptr) {
+    ARROW_ASSIGN_OR_RAISE(bool has_data, chunker_->Init());
+    if (!has_data) {
       return Status::Invalid("Empty JSON file");
     }
 
     auto self = shared_from_this();
-    auto empty = std::make_shared<Buffer>("");
-
     int64_t block_index = 0;
-    std::shared_ptr<Buffer> partial = empty;
-
-    while (block != nullptr) {
-      std::shared_ptr<Buffer> next_block, whole, completion, next_partial;
-
-      ARROW_ASSIGN_OR_RAISE(next_block, block_iterator_.Next());
+    ChunkedBlock block;
 
-      if (next_block == nullptr) {
-        // End of file reached => compute completion from penultimate block
-        RETURN_NOT_OK(chunker_->ProcessFinal(partial, block, &completion, &whole));
-      } else {
-        std::shared_ptr<Buffer> starts_with_whole;
-        // Get completion of partial from previous block.
-        RETURN_NOT_OK(chunker_->ProcessWithPartial(partial, block, &completion,
-                                                   &starts_with_whole));
-
-        // Get all whole objects entirely inside the current buffer
-        RETURN_NOT_OK(chunker_->Process(starts_with_whole, &whole, &next_partial));
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(has_data, chunker_->Next(&block));
+      if (!has_data) {
+        break;
       }
-
+      RETURN_NOT_OK(read_options_.stop_token.Poll());
       // Launch parse task
-      task_group_->Append([self, partial, completion, whole, block_index] {
-        return self->ParseAndInsert(partial, completion, whole, block_index);
+      task_group_->Append([self, block, block_index] {
+        return self->ParseAndInsert(block, block_index);
       });
       block_index++;
-
-      partial = next_partial;
-      block = next_block;
     }
 
     std::shared_ptr<ChunkedArray> array;
@@ -113,45 +222,15 @@ class TableReaderImpl : public TableReader,
 
  private:
   Status MakeBuilder() {
-    auto type = parse_options_.explicit_schema
-                    ? struct_(parse_options_.explicit_schema->fields())
-                    : struct_({});
-
-    auto promotion_graph =
-        parse_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
-            ? GetPromotionGraph()
-            : nullptr;
-
-    return MakeChunkedArrayBuilder(task_group_, pool_, promotion_graph, type, &builder_);
-  }
-
-  Status ParseAndInsert(const std::shared_ptr<Buffer>& partial,
-                        const std::shared_ptr<Buffer>& completion,
-                        const std::shared_ptr<Buffer>& whole, int64_t block_index) {
-    std::unique_ptr<BlockParser> parser;
-    RETURN_NOT_OK(BlockParser::Make(pool_, parse_options_, &parser));
-    RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
-                                               whole->size()));
-
-    if (partial->size() != 0 || completion->size() != 0) {
-      std::shared_ptr<Buffer> straddling;
-      if (partial->size() == 0) {
-        straddling = completion;
-      } else if (completion->size() == 0) {
-        straddling = partial;
-      } else {
-        ARROW_ASSIGN_OR_RAISE(straddling,
-                              ConcatenateBuffers({partial, completion}, pool_));
-      }
-      RETURN_NOT_OK(parser->Parse(straddling));
-    }
-
-    if (whole->size() != 0) {
-      RETURN_NOT_OK(parser->Parse(whole));
-    }
+    return MakeChunkedArrayBuilder(task_group_, pool_,
+                                   MaybePromotionGraph(parse_options_),
+                                   GetInitialType(parse_options_), &builder_);
+  }
 
-    std::shared_ptr<Array> parsed;
-    RETURN_NOT_OK(parser->Finish(&parsed));
+  Status ParseAndInsert(const ChunkedBlock& block, int64_t block_index) {
+    // Parse tasks dequeued after cancellation don't do any work
+    RETURN_NOT_OK(read_options_.stop_token.Poll());
+    ARROW_ASSIGN_OR_RAISE(auto parsed, ParseBlock(pool_, parse_options_, block));
     builder_->Insert(block_index, field("", parsed->type()), parsed);
     return Status::OK();
   }
@@ -159,9 +238,8 @@ class TableReaderImpl : public TableReader,
   MemoryPool* pool_;
   ReadOptions read_options_;
   ParseOptions parse_options_;
-  std::unique_ptr<Chunker> chunker_;
   std::shared_ptr<TaskGroup> task_group_;
-  Iterator<std::shared_ptr<Buffer>> block_iterator_;
+  std::unique_ptr<BlockChunker> chunker_;
   std::shared_ptr<ChunkedArrayBuilder> builder_;
 };
 
@@ -189,6 +267,178 @@ Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> inpu
   return TableReader::Make(pool, input, read_options, parse_options).Value(out);
 }
 
+class StreamingReaderImpl : public StreamingReader {
+ public:
+  StreamingReaderImpl(MemoryPool* pool, const ReadOptions& read_options,
+                      const ParseOptions& parse_options, ThreadPool* thread_pool)
+      : pool_(pool),
+        read_options_(read_options),
+        parse_options_(parse_options),
+        thread_pool_(thread_pool),
+        max_blocks_in_flight_(thread_pool ? std::max(1, thread_pool->GetCapacity())
+                                          : 1) {}
+
+  ~StreamingReaderImpl() override {
+    // Parse tasks hold no reference to this object, but don't leave them behind
+    for (auto& batch : pending_) {
+      batch.Wait();
+    }
+  }
+
+  Status Init(std::shared_ptr<io::InputStream> input) {
+    ARROW_ASSIGN_OR_RAISE(auto it,
+                          io::MakeInputStreamIterator(input, read_options_.block_size));
+    if (thread_pool_ != nullptr) {
+      ARROW_ASSIGN_OR_RAISE(it,
+                            MakeReadaheadIterator(std::move(it), max_blocks_in_flight_));
+    }
+    chunker_ = internal::make_unique<BlockChunker>(parse_options_, std::move(it));
+    ARROW_ASSIGN_OR_RAISE(bool has_data, chunker_->Init());
+    if (!has_data) {
+      return Status::Invalid("Empty JSON file");
+    }
+    return InferSchema();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    while (true) {
+      RETURN_NOT_OK(read_options_.stop_token.Poll());
+      if (!ready_.empty()) {
+        *out = std::move(ready_.front());
+        ready_.pop_front();
+      } else {
+        RETURN_NOT_OK(ScheduleBlocks());
+        if (pending_.empty()) {
+          // End of stream
+          out->reset();
+          return Status::OK();
+        }
+        auto batch = std::move(pending_.front());
+        pending_.pop_front();
+        ARROW_ASSIGN_OR_RAISE(*out, batch.result());
+      }
+      // Blocks without any whole object don't yield a batch
+      if ((*out)->num_rows() > 0) {
+        return Status::OK();
+      }
+    }
+  }
+
+ private:
+  // Parse and convert the first blocks together, so that the inferred types
+  // are promoted across them
+  Status InferSchema() {
+    std::vector<ChunkedBlock> blocks;
+    while (static_cast<int>(blocks.size()) < max_blocks_in_flight_) {
+      ChunkedBlock block;
+      ARROW_ASSIGN_OR_RAISE(bool has_data, chunker_->Next(&block));
+      if (!has_data) {
+        break;
+      }
+      blocks.push_back(std::move(block));
+    }
+
+    std::vector<Future<std::shared_ptr<Array>>> parse_results;
+    for (const auto& block : blocks) {
+      MemoryPool* pool = pool_;
+      const ParseOptions& parse_options = parse_options_;
+      auto parse = [pool, parse_options, block]() {
+        return ParseBlock(pool, parse_options, block);
+      };
+      if (thread_pool_ != nullptr) {
+        ARROW_ASSIGN_OR_RAISE(auto future, thread_pool_->Submit(std::move(parse)));
+        parse_results.push_back(std::move(future));
+      } else {
+        parse_results.push_back(Future<std::shared_ptr<Array>>::MakeFinished(parse()));
+      }
+    }
+    ArrayVector parsed;
+    for (auto& result : parse_results) {
+      ARROW_ASSIGN_OR_RAISE(auto array, result.result());
+      parsed.push_back(std::move(array));
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto converted,
+                          ConvertBlocks(pool_, MaybePromotionGraph(parse_options_),
+                                        GetInitialType(parse_options_), parsed));
+    schema_ = ::arrow::schema(converted->type()->fields());
+    for (const auto& chunk : converted->chunks()) {
+      ARROW_ASSIGN_OR_RAISE(auto batch, RecordBatch::FromStructArray(chunk));
+      ready_.push_back(std::move(batch));
+    }
+
+    // Later blocks are parsed and converted according to the inferred schema
+    later_parse_options_ = parse_options_;
+    later_parse_options_.explicit_schema = schema_;
+    if (later_parse_options_.unexpected_field_behavior ==
+        UnexpectedFieldBehavior::InferType) {
+      later_parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+    }
+    return Status::OK();
+  }
+
+  // Keep up to max_blocks_in_flight_ blocks being parsed and converted
+  Status ScheduleBlocks() {
+    while (!eof_ && static_cast<int>(pending_.size()) < max_blocks_in_flight_) {
+      ChunkedBlock block;
+      ARROW_ASSIGN_OR_RAISE(bool has_data, chunker_->Next(&block));
+      if (!has_data) {
+        eof_ = true;
+        break;
+      }
+      RETURN_NOT_OK(read_options_.stop_token.Poll());
+      MemoryPool* pool = pool_;
+      const ParseOptions& parse_options = later_parse_options_;
+      auto type = struct_(schema_->fields());
+      auto convert = [pool, parse_options, type,
+                      block]() -> Result<std::shared_ptr<RecordBatch>> {
+        ARROW_ASSIGN_OR_RAISE(auto parsed, ParseBlock(pool, parse_options, block));
+        ARROW_ASSIGN_OR_RAISE(auto converted,
+                              ConvertBlocks(pool, /*promotion_graph=*/nullptr, type,
+                                            {std::move(parsed)}));
+        return RecordBatch::FromStructArray(converted->chunk(0));
+      };
+      if (thread_pool_ != nullptr) {
+        ARROW_ASSIGN_OR_RAISE(auto future,
+                              thread_pool_->Submit(internal::TaskHints{},
+                                                   read_options_.stop_token,
+                                                   std::move(convert)));
+        pending_.push_back(std::move(future));
+      } else {
+        pending_.push_back(Future<std::shared_ptr<RecordBatch>>::MakeFinished(convert()));
+      }
+    }
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  ThreadPool* thread_pool_;
+  const int max_blocks_in_flight_;
+
+  std::unique_ptr<BlockChunker> chunker_;
+  bool eof_ = false;
+  std::shared_ptr<Schema> schema_;
+  ParseOptions later_parse_options_;
+  // Batches converted during schema inference
+  std::deque<std::shared_ptr<RecordBatch>> ready_;
+  // Batches being converted, in input order
+  std::deque<Future<std::shared_ptr<RecordBatch>>> pending_;
+};
+
+Result<std::shared_ptr<StreamingReader>> StreamingReader::Make(
+    MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+    const ReadOptions& read_options, const ParseOptions& parse_options) {
+  auto reader = std::make_shared<StreamingReaderImpl>(
+      pool, read_options, parse_options,
+      read_options.use_threads ? GetCpuThreadPool() : nullptr);
+  RETURN_NOT_OK(reader->Init(std::move(input)));
+  return reader;
+}
+
 Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
                                               std::shared_ptr<Buffer> json) {
   std::unique_ptr<BlockParser> parser;
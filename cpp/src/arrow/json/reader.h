@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "arrow/json/options.h"
+#include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
@@ -65,6 +66,31 @@ class ARROW_EXPORT TableReader {
                      std::shared_ptr<TableReader>* out);
 };
 
+/// Experimental
+///
+/// A class that reads a JSON file incrementally, as a stream of RecordBatches
+///
+/// The file is expected to consist of individual line-separated JSON objects.
+/// Each block of ReadOptions::block_size bytes is converted into a RecordBatch,
+/// with a bounded number of blocks in flight.
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  virtual ~StreamingReader() = default;
+
+  /// Create a StreamingReader instance
+  ///
+  /// The schema is inferred from the first blocks, promoting types across
+  /// them.  If ReadOptions::use_threads is true, this covers as many blocks
+  /// as the global CPU thread pool's capacity, which is also the number of
+  /// blocks parsed in parallel afterwards.  Otherwise, only the first block
+  /// is used for inference.  Later blocks are converted to the inferred
+  /// schema and fail to read if their values don't fit it; fields missing
+  /// from the schema are an error unless they are ignored.
+  static Result<std::shared_ptr<StreamingReader>> Make(
+      MemoryPool* pool, std::shared_ptr<io::InputStream> input, const ReadOptions&,
+      const ParseOptions&);
+};
+
 ARROW_EXPORT Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
                                                            std::shared_ptr<Buffer> json);
 
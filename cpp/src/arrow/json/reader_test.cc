@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -284,5 +285,122 @@ TEST(ReaderTest, ListArrayWithFewValues) {
   AssertTablesEqual(*actual_table, *expected_table);
 }
 
+class StreamingReaderTest : public ::testing::TestWithParam<bool> {
+ protected:
+  void SetUp() override {
+    read_options_.use_threads = GetParam();
+    // Small blocks, so as to get several batches
+    read_options_.block_size = 256;
+    parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  }
+
+  Status MakeReader(util::string_view input) {
+    std::shared_ptr<io::InputStream> stream;
+    RETURN_NOT_OK(MakeStream(input, &stream));
+    return StreamingReader::Make(default_memory_pool(), stream, read_options_,
+                                 parse_options_)
+        .Value(&reader_);
+  }
+
+  Result<std::shared_ptr<Table>> ReadAsTable(util::string_view input) {
+    std::shared_ptr<io::InputStream> stream;
+    RETURN_NOT_OK(MakeStream(input, &stream));
+    ARROW_ASSIGN_OR_RAISE(auto reader, TableReader::Make(default_memory_pool(), stream,
+                                                         read_options_, parse_options_));
+    return reader->Read();
+  }
+
+  static std::string MakeLines(int64_t num_lines, int64_t first_line = 0) {
+    std::stringstream ss;
+    for (int64_t i = first_line; i < first_line + num_lines; ++i) {
+      ss << "{\"a\": " << i << ", \"b\": \"line " << i << "\", \"c\": [" << i % 3
+         << "]}\n";
+    }
+    return ss.str();
+  }
+
+  ParseOptions parse_options_ = ParseOptions::Defaults();
+  ReadOptions read_options_ = ReadOptions::Defaults();
+  std::shared_ptr<StreamingReader> reader_;
+};
+
+INSTANTIATE_TEST_SUITE_P(StreamingReaderTest, StreamingReaderTest,
+                         ::testing::Values(false, true));
+
+TEST_P(StreamingReaderTest, Basics) {
+  auto src = MakeLines(200);
+  ASSERT_OK(MakeReader(src));
+  ASSERT_OK_AND_ASSIGN(auto expected, ReadAsTable(src));
+  AssertSchemaEqual(*expected->schema(), *reader_->schema());
+
+  RecordBatchVector batches;
+  ASSERT_OK(reader_->ReadAll(&batches));
+  ASSERT_GT(batches.size(), 1U);
+  ASSERT_OK_AND_ASSIGN(auto actual, Table::FromRecordBatches(batches));
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+
+  // The end of stream is sticky
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader_->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+}
+
+TEST_P(StreamingReaderTest, ExplicitSchema) {
+  parse_options_.explicit_schema = schema({field("a", int32()), field("d", utf8())});
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  auto src = MakeLines(100);
+  ASSERT_OK(MakeReader(src));
+  AssertSchemaEqual(*parse_options_.explicit_schema, *reader_->schema());
+
+  std::shared_ptr<Table> actual;
+  ASSERT_OK(reader_->ReadAll(&actual));
+  ASSERT_OK_AND_ASSIGN(auto expected, ReadAsTable(src));
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST_P(StreamingReaderTest, PromotionInFirstBlock) {
+  // "a" is promoted from int64 to double within the first block
+  auto src = "{\"a\": 1}\n{\"a\": null}\n{\"a\": 2.5}\n" + MakeLines(50, 3);
+  ASSERT_OK(MakeReader(src));
+  AssertTypeEqual(*float64(), *reader_->schema()->field(0)->type());
+
+  RecordBatchVector batches;
+  ASSERT_OK(reader_->ReadAll(&batches));
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(batches));
+  ASSERT_EQ(table->num_rows(), 53);
+}
+
+TEST_P(StreamingReaderTest, MismatchAfterInference) {
+  // Blocks far from the start don't take part in inference
+  {
+    auto src = MakeLines(500) + "{\"a\": \"not a number\", \"b\": \"x\", \"c\": []}\n";
+    ASSERT_OK(MakeReader(src));
+    RecordBatchVector batches;
+    ASSERT_RAISES(Invalid, reader_->ReadAll(&batches));
+  }
+  {
+    auto src = MakeLines(500) + "{\"a\": 1, \"b\": \"x\", \"c\": [], \"d\": 1}\n";
+    ASSERT_OK(MakeReader(src));
+    RecordBatchVector batches;
+    ASSERT_RAISES(Invalid, reader_->ReadAll(&batches));
+  }
+}
+
+TEST_P(StreamingReaderTest, StopToken) {
+  StopSource stop_source;
+  read_options_.stop_token = stop_source.token();
+  auto src = MakeLines(200);
+  ASSERT_OK(MakeReader(src));
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader_->ReadNext(&batch));
+  ASSERT_NE(batch, nullptr);
+
+  stop_source.RequestStop();
+  ASSERT_RAISES(Cancelled, reader_->ReadNext(&batch));
+  ASSERT_RAISES(Cancelled, ReadAsTable(src));
+}
+
+TEST_P(StreamingReaderTest, Empty) { ASSERT_RAISES(Invalid, MakeReader("")); }
+
 }  // namespace json
 }  // namespace arrow
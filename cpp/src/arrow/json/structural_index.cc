@@ -0,0 +1,204 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/json/structural_index_internal.h"
+
+#include <cstring>
+#include <limits>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/simd.h"
+
+namespace arrow {
+namespace json {
+
+namespace {
+
+constexpr int64_t kWindowSize = 64;
+
+// Bitmasks of the character classes in a 64-byte window
+struct WindowClasses {
+  uint64_t backslash = 0;
+  uint64_t quote = 0;
+  uint64_t whitespace = 0;
+  // {}[]:,
+  uint64_t op = 0;
+  // bytes below 0x20
+  uint64_t control = 0;
+};
+
+#if defined(ARROW_HAVE_SSE4_2)
+inline uint64_t MoveMask(__m128i v) {
+  return static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(v)));
+}
+
+void ClassifyWindow(const char* data, WindowClasses* out) {
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i space = _mm_set1_epi8(' ');
+  const __m128i tab = _mm_set1_epi8('\t');
+  const __m128i lf = _mm_set1_epi8('\n');
+  const __m128i cr = _mm_set1_epi8('\r');
+  // '[' and ']' only differ from '{' and '}' in bit 5
+  const __m128i bit5 = _mm_set1_epi8(0x20);
+  const __m128i open_brace = _mm_set1_epi8('{');
+  const __m128i close_brace = _mm_set1_epi8('}');
+  const __m128i colon = _mm_set1_epi8(':');
+  const __m128i comma = _mm_set1_epi8(',');
+  const __m128i max_control = _mm_set1_epi8(0x1F);
+
+  for (int64_t i = 0; i < kWindowSize; i += sizeof(__m128i)) {
+    const __m128i word = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    const __m128i folded = _mm_or_si128(word, bit5);
+    const __m128i op = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(folded, open_brace),
+                     _mm_cmpeq_epi8(folded, close_brace)),
+        _mm_or_si128(_mm_cmpeq_epi8(word, colon), _mm_cmpeq_epi8(word, comma)));
+    const __m128i whitespace =
+        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(word, space), _mm_cmpeq_epi8(word, tab)),
+                     _mm_or_si128(_mm_cmpeq_epi8(word, lf), _mm_cmpeq_epi8(word, cr)));
+    const __m128i control = _mm_cmpeq_epi8(_mm_min_epu8(word, max_control), word);
+
+    out->backslash |= MoveMask(_mm_cmpeq_epi8(word, backslash)) << i;
+    out->quote |= MoveMask(_mm_cmpeq_epi8(word, quote)) << i;
+    out->whitespace |= MoveMask(whitespace) << i;
+    out->op |= MoveMask(op) << i;
+    out->control |= MoveMask(control) << i;
+  }
+}
+#else
+void ClassifyWindow(const char* data, WindowClasses* out) {
+  for (int64_t i = 0; i < kWindowSize; ++i) {
+    const uint64_t bit = uint64_t(1) << i;
+    switch (data[i]) {
+      case '\\':
+        out->backslash |= bit;
+        break;
+      case '"':
+        out->quote |= bit;
+        break;
+      case ' ':
+      case '\t':
+      case '\n':
+      case '\r':
+        out->whitespace |= bit;
+        break;
+      case '{':
+      case '}':
+      case '[':
+      case ']':
+      case ':':
+      case ',':
+        out->op |= bit;
+        break;
+      default:
+        break;
+    }
+    if (static_cast<uint8_t>(data[i]) < 0x20) {
+      out->control |= bit;
+    }
+  }
+}
+#endif
+
+// Return the positions of characters escaped by a backslash.
+// `escaped_carry` is set if the first character of the next window is escaped.
+inline uint64_t FindEscaped(uint64_t backslash, uint64_t* escaped_carry) {
+  constexpr uint64_t kEvenBits = 0x5555555555555555ULL;
+  // An escaped backslash does not escape anything
+  backslash &= ~*escaped_carry;
+  const uint64_t follows_escape = (backslash << 1) | *escaped_carry;
+  // Starting a run of backslashes on an odd bit, and adding the run to it,
+  // carries out of the run on an even bit if the run has an odd length
+  const uint64_t odd_run_starts = backslash & ~kEvenBits & ~follows_escape;
+  const uint64_t runs_on_even_bits = odd_run_starts + backslash;
+  *escaped_carry = runs_on_even_bits < backslash ? 1 : 0;
+  const uint64_t invert_mask = runs_on_even_bits << 1;
+  return (kEvenBits ^ invert_mask) & follows_escape;
+}
+
+// Set every bit from each set bit up to (excluding) the next set bit
+inline uint64_t PrefixXor(uint64_t bits) {
+  bits ^= bits << 1;
+  bits ^= bits << 2;
+  bits ^= bits << 4;
+  bits ^= bits << 8;
+  bits ^= bits << 16;
+  bits ^= bits << 32;
+  return bits;
+}
+
+}  // namespace
+
+Status StructuralIndex::Build(const char* data, int64_t size) {
+  if (size > static_cast<int64_t>(std::numeric_limits<uint32_t>::max())) {
+    return Status::Invalid("JSON block of ", size, " bytes is too large to index");
+  }
+  const int64_t num_windows = BitUtil::CeilDiv(size, kWindowSize);
+  // Every byte is structural at most
+  if (static_cast<int64_t>(positions_.size()) < size) {
+    positions_.resize(size);
+  }
+  special_chars_.resize(num_windows);
+
+  uint32_t* out = positions_.data();
+  uint64_t escaped_carry = 0;
+  // All ones if the previous window ended inside a string
+  uint64_t in_string_carry = 0;
+  // 1 if the previous window ended inside a literal or number
+  uint64_t atom_carry = 0;
+  uint64_t any_special_chars = 0;
+
+  for (int64_t window = 0; window < num_windows; ++window) {
+    const int64_t offset = window * kWindowSize;
+    WindowClasses classes;
+    if (size - offset >= kWindowSize) {
+      ClassifyWindow(data + offset, &classes);
+    } else {
+      // Pad the last window with whitespace
+      char padded[kWindowSize];
+      std::memset(padded, ' ', kWindowSize);
+      std::memcpy(padded, data + offset, size - offset);
+      ClassifyWindow(padded, &classes);
+    }
+
+    const uint64_t escaped = FindEscaped(classes.backslash, &escaped_carry);
+    const uint64_t quotes = classes.quote & ~escaped;
+    // Opening quotes and string contents, but not closing quotes
+    const uint64_t in_string = PrefixXor(quotes) ^ in_string_carry;
+    in_string_carry = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+
+    const uint64_t atoms = ~(classes.op | classes.whitespace | quotes | in_string);
+    const uint64_t atom_starts = atoms & ~((atoms << 1) | atom_carry);
+    atom_carry = atoms >> 63;
+
+    special_chars_[window] = (classes.backslash | classes.control) & in_string;
+    any_special_chars |= special_chars_[window];
+
+    uint64_t structurals = (classes.op & ~in_string) | quotes | atom_starts;
+    while (structurals != 0) {
+      *out++ = static_cast<uint32_t>(offset + BitUtil::CountTrailingZeros(structurals));
+      structurals &= structurals - 1;
+    }
+  }
+  num_positions_ = out - positions_.data();
+  has_special_chars_ = any_special_chars != 0;
+  return Status::OK();
+}
+
+}  // namespace json
+}  // namespace arrow
@@ -0,0 +1,477 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace json {
+
+/// \brief Index of the structural characters in a block of JSON
+///
+/// This is the first stage of a two-stage parser.  The block is classified
+/// 64 bytes at a time (using SIMD when available) to find, outside of strings,
+/// every bracket, brace, colon and comma, as well as the first byte of every
+/// literal or number.  Unescaped quotes, which open and close strings, are
+/// indexed too.  The second stage (StructuralParser) only has to visit the
+/// indexed positions.
+class ARROW_EXPORT StructuralIndex {
+ public:
+  /// \brief Index a block of JSON, which must outlive the index
+  Status Build(const char* data, int64_t size);
+
+  const uint32_t* begin() const { return positions_.data(); }
+  const uint32_t* end() const { return positions_.data() + num_positions_; }
+
+  /// \brief Whether the string contents in [begin, end) contain a backslash
+  /// or a control character, and need more than a view into the block
+  bool HasSpecialChars(uint32_t begin, uint32_t end) const {
+    if (ARROW_PREDICT_TRUE(!has_special_chars_) || begin >= end) {
+      return false;
+    }
+    const uint32_t first = begin / 64, last = (end - 1) / 64;
+    for (uint32_t window = first; window <= last; ++window) {
+      uint64_t mask = special_chars_[window];
+      if (window == first) {
+        mask &= ~uint64_t(0) << (begin % 64);
+      }
+      if (window == last) {
+        mask &= ~uint64_t(0) >> (63 - (end - 1) % 64);
+      }
+      if (mask != 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  std::vector<uint32_t> positions_;
+  int64_t num_positions_ = 0;
+  // Per 64-byte window, a bitmask of backslashes and control characters in strings
+  std::vector<uint64_t> special_chars_;
+  bool has_special_chars_ = false;
+};
+
+/// \brief Parse a block of JSON from its StructuralIndex
+///
+/// The parser validates the JSON grammar from one indexed position to the
+/// next and emits the same events as a rapidjson::Reader using
+/// kParseNumbersAsStringsFlag and kParseNanAndInfFlag, so the BlockParser
+/// handlers can be driven by either.  Values are parsed iteratively, so deeply
+/// nested input does not exhaust the stack.
+class StructuralParser {
+ public:
+  StructuralParser(const char* data, int64_t size, const StructuralIndex& index)
+      : data_(data),
+        data_end_(data + size),
+        index_(index),
+        next_(index.begin()),
+        end_(index.end()) {}
+
+  /// \brief Parse all remaining root values, counting them in num_rows
+  ///
+  /// Handler errors are retrieved with handler->Error().
+  template <typename Handler>
+  Status Parse(Handler* handler, int32_t max_num_rows, int32_t* num_rows) {
+    for (; next_ != end_; ++*num_rows) {
+      if (*num_rows >= max_num_rows) {
+        return Status::Invalid("Exceeded maximum rows");
+      }
+      const char* error = ParseValue(handler);
+      if (ARROW_PREDICT_FALSE(error != NULLPTR)) {
+        if (error == kTerminated) {
+          return handler->Error();
+        }
+        return Status::Invalid("JSON parse error: ", error, " in row ", *num_rows);
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  struct Nesting {
+    bool is_object;
+    uint32_t count;
+  };
+
+  // Error messages are worded as rapidjson's
+  static constexpr const char* kTerminated = "Terminate parsing due to Handler error.";
+  static constexpr const char* kInvalidValue = "Invalid value.";
+  static constexpr const char* kMissingName = "Missing a name for object member.";
+  static constexpr const char* kMissingColon =
+      "Missing a colon after a name of object member.";
+  static constexpr const char* kMissingCommaOrCurlyBracket =
+      "Missing a comma or '}' after an object member.";
+  static constexpr const char* kMissingCommaOrSquareBracket =
+      "Missing a comma or ']' after an array element.";
+  static constexpr const char* kInvalidHex =
+      "Incorrect hex digit after \\u escape in string.";
+  static constexpr const char* kInvalidSurrogate =
+      "The surrogate pair in string is invalid.";
+  static constexpr const char* kInvalidEscape = "Invalid escape character in string.";
+  static constexpr const char* kMissingQuotationMark =
+      "Missing a closing quotation mark in string.";
+  static constexpr const char* kInvalidEncoding = "Invalid encoding in string.";
+  static constexpr const char* kMissingFraction = "Miss fraction part in number.";
+  static constexpr const char* kMissingExponent = "Miss exponent in number.";
+
+  bool AtEnd() const { return next_ == end_; }
+  char Peek() const { return data_[*next_]; }
+
+  // Parse one root value; return an error message or null
+  template <typename Handler>
+  const char* ParseValue(Handler* handler) {
+    const char* error;
+    uint32_t pos;
+    util::string_view token;
+    nesting_.clear();
+
+  value:
+    if (ARROW_PREDICT_FALSE(AtEnd())) {
+      return kInvalidValue;
+    }
+    pos = *next_++;
+    switch (data_[pos]) {
+      case '{':
+        if (ARROW_PREDICT_FALSE(!handler->StartObject())) {
+          return kTerminated;
+        }
+        if (!AtEnd() && Peek() == '}') {
+          ++next_;
+          if (ARROW_PREDICT_FALSE(!handler->EndObject(0))) {
+            return kTerminated;
+          }
+          goto value_end;
+        }
+        nesting_.push_back({true, 0});
+        goto member;
+      case '[':
+        if (ARROW_PREDICT_FALSE(!handler->StartArray())) {
+          return kTerminated;
+        }
+        if (!AtEnd() && Peek() == ']') {
+          ++next_;
+          if (ARROW_PREDICT_FALSE(!handler->EndArray(0))) {
+            return kTerminated;
+          }
+          goto value_end;
+        }
+        nesting_.push_back({false, 0});
+        goto value;
+      case '"':
+        if (ARROW_PREDICT_FALSE((error = ParseString(pos, &token)) != NULLPTR)) {
+          return error;
+        }
+        if (ARROW_PREDICT_FALSE(!handler->String(
+                token.data(), static_cast<uint32_t>(token.size()), true))) {
+          return kTerminated;
+        }
+        goto value_end;
+      case '}':
+      case ']':
+      case ',':
+      case ':':
+        return kInvalidValue;
+      default:
+        if (ARROW_PREDICT_FALSE((error = ParseAtom(handler, pos)) != NULLPTR)) {
+          return error;
+        }
+        goto value_end;
+    }
+
+  value_end:
+    if (nesting_.empty()) {
+      return NULLPTR;
+    }
+    ++nesting_.back().count;
+    if (nesting_.back().is_object) {
+      if (ARROW_PREDICT_FALSE(AtEnd())) {
+        return kMissingCommaOrCurlyBracket;
+      }
+      switch (data_[*next_++]) {
+        case ',':
+          goto member;
+        case '}':
+          pos = nesting_.back().count;
+          nesting_.pop_back();
+          if (ARROW_PREDICT_FALSE(!handler->EndObject(pos))) {
+            return kTerminated;
+          }
+          goto value_end;
+        default:
+          return kMissingCommaOrCurlyBracket;
+      }
+    } else {
+      if (ARROW_PREDICT_FALSE(AtEnd())) {
+        return kMissingCommaOrSquareBracket;
+      }
+      switch (data_[*next_++]) {
+        case ',':
+          goto value;
+        case ']':
+          pos = nesting_.back().count;
+          nesting_.pop_back();
+          if (ARROW_PREDICT_FALSE(!handler->EndArray(pos))) {
+            return kTerminated;
+          }
+          goto value_end;
+        default:
+          return kMissingCommaOrSquareBracket;
+      }
+    }
+
+  member:
+    if (ARROW_PREDICT_FALSE(AtEnd() || Peek() != '"')) {
+      return kMissingName;
+    }
+    pos = *next_++;
+    if (ARROW_PREDICT_FALSE((error = ParseString(pos, &token)) != NULLPTR)) {
+      return error;
+    }
+    if (ARROW_PREDICT_FALSE(
+            !handler->Key(token.data(), static_cast<uint32_t>(token.size()), true))) {
+      return kTerminated;
+    }
+    if (ARROW_PREDICT_FALSE(AtEnd() || Peek() != ':')) {
+      return kMissingColon;
+    }
+    ++next_;
+    goto value;
+  }
+
+  // Parse the string opened by the quote at `open`
+  const char* ParseString(uint32_t open, util::string_view* out) {
+    // Only the closing quote can be indexed after an opening quote
+    if (ARROW_PREDICT_FALSE(AtEnd())) {
+      return kMissingQuotationMark;
+    }
+    const uint32_t close = *next_++;
+    if (ARROW_PREDICT_TRUE(!index_.HasSpecialChars(open + 1, close))) {
+      *out = util::string_view(data_ + open + 1, close - open - 1);
+      return NULLPTR;
+    }
+    const char* error = Unescape(data_ + open + 1, data_ + close);
+    *out = util::string_view(unescaped_);
+    return error;
+  }
+
+  const char* Unescape(const char* data, const char* data_end) {
+    unescaped_.clear();
+    while (data < data_end) {
+      const char c = *data++;
+      if (ARROW_PREDICT_FALSE(static_cast<uint8_t>(c) < 0x20)) {
+        return kInvalidEncoding;
+      }
+      if (c != '\\') {
+        unescaped_.push_back(c);
+        continue;
+      }
+      // A backslash cannot be the last character before the closing quote
+      switch (*data++) {
+        case '"':
+          unescaped_.push_back('"');
+          break;
+        case '\\':
+          unescaped_.push_back('\\');
+          break;
+        case '/':
+          unescaped_.push_back('/');
+          break;
+        case 'b':
+          unescaped_.push_back('\b');
+          break;
+        case 'f':
+          unescaped_.push_back('\f');
+          break;
+        case 'n':
+          unescaped_.push_back('\n');
+          break;
+        case 'r':
+          unescaped_.push_back('\r');
+          break;
+        case 't':
+          unescaped_.push_back('\t');
+          break;
+        case 'u': {
+          uint32_t code_point;
+          if (ARROW_PREDICT_FALSE(!ParseHex4(data, data_end, &code_point))) {
+            return kInvalidHex;
+          }
+          data += 4;
+          if (code_point >= 0xD800 && code_point <= 0xDBFF) {
+            // A high surrogate must be followed by an escaped low surrogate
+            uint32_t low;
+            if (data_end - data < 2 || data[0] != '\\' || data[1] != 'u') {
+              return kInvalidSurrogate;
+            }
+            if (ARROW_PREDICT_FALSE(!ParseHex4(data + 2, data_end, &low))) {
+              return kInvalidHex;
+            }
+            if (low < 0xDC00 || low > 0xDFFF) {
+              return kInvalidSurrogate;
+            }
+            data += 6;
+            code_point = (((code_point - 0xD800) << 10) | (low - 0xDC00)) + 0x10000;
+          }
+          AppendUtf8(code_point);
+          break;
+        }
+        default:
+          return kInvalidEscape;
+      }
+    }
+    return NULLPTR;
+  }
+
+  static bool ParseHex4(const char* data, const char* data_end, uint32_t* out) {
+    if (data_end - data < 4) {
+      return false;
+    }
+    uint32_t value = 0;
+    for (int i = 0; i < 4; ++i) {
+      const char c = data[i];
+      value <<= 4;
+      if (c >= '0' && c <= '9') {
+        value |= c - '0';
+      } else if (c >= 'a' && c <= 'f') {
+        value |= c - 'a' + 10;
+      } else if (c >= 'A' && c <= 'F') {
+        value |= c - 'A' + 10;
+      } else {
+        return false;
+      }
+    }
+    *out = value;
+    return true;
+  }
+
+  void AppendUtf8(uint32_t code_point) {
+    if (code_point < 0x80) {
+      unescaped_.push_back(static_cast<char>(code_point));
+    } else if (code_point < 0x800) {
+      unescaped_.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+      unescaped_.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else if (code_point < 0x10000) {
+      unescaped_.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+      unescaped_.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+      unescaped_.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else {
+      unescaped_.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+      unescaped_.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+      unescaped_.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+      unescaped_.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+  }
+
+  static bool IsWhitespace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+  }
+
+  static bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+  // Parse the literal or number starting at `pos`
+  template <typename Handler>
+  const char* ParseAtom(Handler* handler, uint32_t pos) {
+    const char* begin = data_ + pos;
+    // Since the first byte of every atom is indexed, this atom is followed by
+    // whitespace at most until the next indexed position
+    const char* end = AtEnd() ? data_end_ : data_ + *next_;
+    while (IsWhitespace(end[-1])) {
+      --end;
+    }
+    const util::string_view atom(begin, end - begin);
+    bool ok;
+    if (atom == "null") {
+      ok = handler->Null();
+    } else if (atom == "true") {
+      ok = handler->Bool(true);
+    } else if (atom == "false") {
+      ok = handler->Bool(false);
+    } else {
+      const char* error = ValidateNumber(begin, end);
+      if (ARROW_PREDICT_FALSE(error != NULLPTR)) {
+        return error;
+      }
+      ok = handler->RawNumber(begin, static_cast<uint32_t>(atom.size()), false);
+    }
+    return ARROW_PREDICT_TRUE(ok) ? NULLPTR : kTerminated;
+  }
+
+  static const char* ValidateNumber(const char* data, const char* data_end) {
+    if (*data == '-') {
+      ++data;
+    }
+    const util::string_view rest(data, data_end - data);
+    if (rest == "NaN" || rest == "Inf" || rest == "Infinity") {
+      return NULLPTR;
+    }
+    if (data == data_end) {
+      return kInvalidValue;
+    }
+    if (*data == '0') {
+      ++data;
+    } else if (IsDigit(*data)) {
+      while (data != data_end && IsDigit(*data)) {
+        ++data;
+      }
+    } else {
+      return kInvalidValue;
+    }
+    if (data != data_end && *data == '.') {
+      ++data;
+      if (data == data_end || !IsDigit(*data)) {
+        return kMissingFraction;
+      }
+      while (data != data_end && IsDigit(*data)) {
+        ++data;
+      }
+    }
+    if (data != data_end && (*data == 'e' || *data == 'E')) {
+      ++data;
+      if (data != data_end && (*data == '+' || *data == '-')) {
+        ++data;
+      }
+      if (data == data_end || !IsDigit(*data)) {
+        return kMissingExponent;
+      }
+      while (data != data_end && IsDigit(*data)) {
+        ++data;
+      }
+    }
+    return data == data_end ? NULLPTR : kInvalidValue;
+  }
+
+  const char* data_;
+  const char* data_end_;
+  const StructuralIndex& index_;
+  const uint32_t* next_;
+  const uint32_t* end_;
+  std::vector<Nesting> nesting_;
+  std::string unescaped_;
+};
+
+}  // namespace json
+}  // namespace arrow
@@ -18,14 +18,29 @@
 #include "arrow/memory_pool.h"
 
 #include <algorithm>  // IWYU pragma: keep
+#include <atomic>
+#include <cerrno>
 #include <cstdlib>    // IWYU pragma: keep
 #include <cstring>    // IWYU pragma: keep
 #include <iostream>   // IWYU pragma: keep
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"  // IWYU pragma: keep
+#include "arrow/util/macros.h"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
 
 #ifdef ARROW_JEMALLOC
 // Needed to support jemalloc 3 and 4
@@ -538,4 +553,1106 @@ int64_t ProxyMemoryPool::max_memory() const { return impl_->max_memory(); }
 
 std::string ProxyMemoryPool::backend_name() const { return impl_->backend_name(); }
 
+///////////////////////////////////////////////////////////////////////
+// Tagged memory pools
+
+namespace {
+
+class TaggedMemoryPool : public MemoryPool {
+ public:
+  TaggedMemoryPool(MemoryPool* parent, internal::MemoryPoolStats* stats)
+      : parent_(parent), stats_(stats) {}
+
+  Status Allocate(int64_t size, uint8_t** out) override {
+    RETURN_NOT_OK(parent_->Allocate(size, out));
+    stats_->UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override {
+    RETURN_NOT_OK(parent_->Reallocate(old_size, new_size, ptr));
+    stats_->UpdateAllocatedBytes(new_size - old_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) override {
+    parent_->Free(buffer, size);
+    stats_->UpdateAllocatedBytes(-size);
+  }
+
+  // The statistics of the whole tag
+  int64_t bytes_allocated() const override { return stats_->bytes_allocated(); }
+
+  int64_t max_memory() const override { return stats_->max_memory(); }
+
+  std::string backend_name() const override { return parent_->backend_name(); }
+
+ private:
+  MemoryPool* parent_;
+  internal::MemoryPoolStats* stats_;
+};
+
+struct MemoryTagRegistry {
+  std::mutex mutex;
+  std::map<std::string, std::unique_ptr<internal::MemoryPoolStats>> tags;
+  std::map<std::pair<MemoryPool*, std::string>, std::unique_ptr<TaggedMemoryPool>> pools;
+};
+
+MemoryTagRegistry* GetMemoryTagRegistry() {
+  // Never destroyed, as buffers may be freed during static destruction
+  static auto registry = new MemoryTagRegistry;
+  return registry;
+}
+
+}  // namespace
+
+MemoryPool* GetTaggedMemoryPool(MemoryPool* parent, const std::string& tag) {
+  auto registry = GetMemoryTagRegistry();
+  std::lock_guard<std::mutex> lock(registry->mutex);
+  auto& pool = registry->pools[std::make_pair(parent, tag)];
+  if (pool == nullptr) {
+    auto& stats = registry->tags[tag];
+    if (stats == nullptr) {
+      stats.reset(new internal::MemoryPoolStats);
+    }
+    pool.reset(new TaggedMemoryPool(parent, stats.get()));
+  }
+  return pool.get();
+}
+
+std::vector<MemoryTagStatistics> GetMemoryTagStatistics() {
+  auto registry = GetMemoryTagRegistry();
+  std::lock_guard<std::mutex> lock(registry->mutex);
+  std::vector<MemoryTagStatistics> statistics;
+  for (const auto& entry : registry->tags) {
+    statistics.push_back(MemoryTagStatistics{entry.first, entry.second->bytes_allocated(),
+                                             entry.second->max_memory()});
+  }
+  return statistics;
+}
+
+///////////////////////////////////////////////////////////////////////
+// LimitedMemoryPool implementation
+
+namespace {
+
+// Set while a thread runs release callbacks, so that the allocations made by
+// the callbacks don't try to release memory again (which could deadlock
+// between a pool and its parent).
+thread_local bool running_release_callbacks = false;
+
+}  // namespace
+
+class LimitedMemoryPool::LimitedMemoryPoolImpl {
+ public:
+  LimitedMemoryPoolImpl(MemoryPool* parent, int64_t limit)
+      : parent_(parent), limit_(limit) {
+    auto limited_parent = dynamic_cast<LimitedMemoryPool*>(parent);
+    if (limited_parent != nullptr) {
+      parent_impl_ = limited_parent->impl_.get();
+      parent_impl_->AddChild(this);
+    }
+  }
+
+  ~LimitedMemoryPoolImpl() {
+    DCHECK(children_.empty()) << "LimitedMemoryPool destroyed before its children";
+    if (parent_impl_ != nullptr) {
+      parent_impl_->RemoveChild(this);
+    }
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (size > 0) {
+      RETURN_NOT_OK(Reserve(size));
+    }
+    Status st = parent_->Allocate(size, out);
+    if (!st.ok() && size > 0) {
+      Unreserve(size);
+    }
+    return st;
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    const int64_t diff = new_size - old_size;
+    if (diff > 0) {
+      RETURN_NOT_OK(Reserve(diff));
+    }
+    Status st = parent_->Reallocate(old_size, new_size, ptr);
+    if (st.ok() && diff < 0) {
+      Unreserve(-diff);
+    } else if (!st.ok() && diff > 0) {
+      Unreserve(diff);
+    }
+    return st;
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    parent_->Free(buffer, size);
+    Unreserve(size);
+  }
+
+  int64_t bytes_allocated() const { return bytes_allocated_.load(); }
+
+  int64_t max_memory() const { return max_memory_.load(); }
+
+  std::string backend_name() const { return parent_->backend_name(); }
+
+  int64_t limit() const { return limit_.load(); }
+
+  void set_limit(int64_t limit) { limit_.store(limit); }
+
+  int64_t AddReleaseCallback(ReleaseCallback callback) {
+    std::lock_guard<std::mutex> lock(callbacks_mutex_);
+    const int64_t id = next_callback_id_++;
+    callbacks_.emplace(id, std::move(callback));
+    return id;
+  }
+
+  void RemoveReleaseCallback(int64_t id) {
+    // Wait for the callback to return, unless we're called from a callback
+    std::unique_lock<std::mutex> release_lock(release_mutex_, std::defer_lock);
+    if (releasing_thread_.load() != std::this_thread::get_id()) {
+      release_lock.lock();
+    }
+    std::lock_guard<std::mutex> lock(callbacks_mutex_);
+    callbacks_.erase(id);
+  }
+
+  int64_t ReleaseMemory(int64_t nbytes) {
+    if (running_release_callbacks) {
+      return 0;
+    }
+    running_release_callbacks = true;
+    const int64_t released = RunReleaseCallbacks(nbytes);
+    running_release_callbacks = false;
+    return released;
+  }
+
+ private:
+  bool TryReserve(int64_t size) {
+    int64_t allocated = bytes_allocated_.load();
+    do {
+      if (allocated + size > limit_.load()) {
+        return false;
+      }
+    } while (!bytes_allocated_.compare_exchange_weak(allocated, allocated + size));
+    allocated += size;
+    int64_t max_memory = max_memory_.load();
+    while (allocated > max_memory &&
+           !max_memory_.compare_exchange_weak(max_memory, allocated)) {
+    }
+    return true;
+  }
+
+  void Unreserve(int64_t size) { bytes_allocated_.fetch_sub(size); }
+
+  Status Reserve(int64_t size) {
+    if (TryReserve(size)) {
+      return Status::OK();
+    }
+    if (!running_release_callbacks) {
+      running_release_callbacks = true;
+      // Another thread may have released enough memory while we waited
+      std::lock_guard<std::mutex> lock(release_mutex_);
+      bool reserved = TryReserve(size);
+      if (!reserved) {
+        RunReleaseCallbacksLocked(bytes_allocated_.load() + size - limit_.load());
+        reserved = TryReserve(size);
+      }
+      running_release_callbacks = false;
+      if (reserved) {
+        return Status::OK();
+      }
+    }
+    return Status::OutOfMemory("Allocation of ", size,
+                               " bytes would exceed the memory limit of ", limit_.load(),
+                               " bytes (", bytes_allocated_.load(), " bytes allocated)");
+  }
+
+  int64_t RunReleaseCallbacks(int64_t nbytes) {
+    std::lock_guard<std::mutex> lock(release_mutex_);
+    return RunReleaseCallbacksLocked(nbytes);
+  }
+
+  // Ask our own callbacks first, then the descendants' ones
+  int64_t RunReleaseCallbacksLocked(int64_t nbytes) {
+    std::vector<ReleaseCallback> callbacks;
+    std::vector<LimitedMemoryPoolImpl*> children;
+    {
+      std::lock_guard<std::mutex> lock(callbacks_mutex_);
+      for (const auto& entry : callbacks_) {
+        callbacks.push_back(entry.second);
+      }
+      children = children_;
+    }
+    releasing_thread_.store(std::this_thread::get_id());
+    int64_t released = 0;
+    for (const auto& callback : callbacks) {
+      if (released >= nbytes) {
+        break;
+      }
+      released += callback(nbytes - released);
+    }
+    // Children can't go away while we hold release_mutex_ (see RemoveChild)
+    for (auto child : children) {
+      if (released >= nbytes) {
+        break;
+      }
+      released += child->RunReleaseCallbacks(nbytes - released);
+    }
+    releasing_thread_.store(std::thread::id());
+    return released;
+  }
+
+  void AddChild(LimitedMemoryPoolImpl* child) {
+    std::lock_guard<std::mutex> lock(callbacks_mutex_);
+    children_.push_back(child);
+  }
+
+  void RemoveChild(LimitedMemoryPoolImpl* child) {
+    std::unique_lock<std::mutex> release_lock(release_mutex_, std::defer_lock);
+    if (releasing_thread_.load() != std::this_thread::get_id()) {
+      release_lock.lock();
+    }
+    std::lock_guard<std::mutex> lock(callbacks_mutex_);
+    children_.erase(std::remove(children_.begin(), children_.end(), child),
+                    children_.end());
+  }
+
+  MemoryPool* parent_;
+  LimitedMemoryPoolImpl* parent_impl_ = nullptr;
+  std::atomic<int64_t> limit_;
+  std::atomic<int64_t> bytes_allocated_{0};
+  std::atomic<int64_t> max_memory_{0};
+
+  // Serializes the releases, and protects the callbacks while they run
+  std::mutex release_mutex_;
+  std::atomic<std::thread::id> releasing_thread_{std::thread::id()};
+  // Protects callbacks_ and children_
+  std::mutex callbacks_mutex_;
+  std::map<int64_t, ReleaseCallback> callbacks_;
+  std::vector<LimitedMemoryPoolImpl*> children_;
+  int64_t next_callback_id_ = 0;
+};
+
+LimitedMemoryPool::LimitedMemoryPool(MemoryPool* parent, int64_t limit) {
+  impl_.reset(new LimitedMemoryPoolImpl(parent, limit));
+}
+
+LimitedMemoryPool::~LimitedMemoryPool() {}
+
+Status LimitedMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status LimitedMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                     uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void LimitedMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t LimitedMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t LimitedMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string LimitedMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+int64_t LimitedMemoryPool::limit() const { return impl_->limit(); }
+
+void LimitedMemoryPool::set_limit(int64_t limit) { impl_->set_limit(limit); }
+
+int64_t LimitedMemoryPool::AddReleaseCallback(ReleaseCallback callback) {
+  return impl_->AddReleaseCallback(std::move(callback));
+}
+
+void LimitedMemoryPool::RemoveReleaseCallback(int64_t id) {
+  impl_->RemoveReleaseCallback(id);
+}
+
+int64_t LimitedMemoryPool::ReleaseMemory(int64_t nbytes) {
+  return impl_->ReleaseMemory(nbytes);
+}
+
+///////////////////////////////////////////////////////////////////////
+// HugePageMemoryPool implementation
+
+HugePageMemoryPoolOptions HugePageMemoryPoolOptions::Defaults() { return {}; }
+
+class HugePageMemoryPool::HugePageMemoryPoolImpl {
+ public:
+  HugePageMemoryPoolImpl(MemoryPool* backend, const HugePageMemoryPoolOptions& options)
+      : backend_(backend),
+        options_(options),
+        page_size_(internal::GetPageSize()),
+        huge_page_size_(std::max(internal::GetHugePageSize(), page_size_)) {}
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (IsMapped(size)) {
+      RETURN_NOT_OK(Map(size, out));
+    } else {
+      RETURN_NOT_OK(backend_->Allocate(size, out));
+    }
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    const bool old_mapped = IsMapped(old_size);
+    const bool new_mapped = IsMapped(new_size);
+    if (old_mapped && new_mapped) {
+      RETURN_NOT_OK(Remap(old_size, new_size, ptr));
+    } else if (!old_mapped && !new_mapped) {
+      RETURN_NOT_OK(backend_->Reallocate(old_size, new_size, ptr));
+    } else {
+      uint8_t* out;
+      if (new_mapped) {
+        RETURN_NOT_OK(Map(new_size, &out));
+      } else {
+        RETURN_NOT_OK(backend_->Allocate(new_size, &out));
+      }
+      std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+      if (old_mapped) {
+        Unmap(*ptr, old_size);
+      } else {
+        backend_->Free(*ptr, old_size);
+      }
+      *ptr = out;
+    }
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    if (IsMapped(size)) {
+      Unmap(buffer, size);
+    } else {
+      backend_->Free(buffer, size);
+    }
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  std::string backend_name() const { return backend_->backend_name(); }
+
+  int64_t bytes_mapped() const { return bytes_mapped_.load(); }
+
+ private:
+#ifdef __linux__
+  bool IsMapped(int64_t size) const { return size > 0 && size >= options_.threshold; }
+
+  int64_t MappedSize(int64_t size) const {
+    // Explicit huge pages can only be unmapped as a whole
+    return BitUtil::RoundUp(size,
+                            options_.explicit_huge_pages ? huge_page_size_ : page_size_);
+  }
+
+  Status CheckSize(int64_t size) const {
+    if (size > std::numeric_limits<int64_t>::max() - 2 * huge_page_size_) {
+      return Status::OutOfMemory("malloc of size ", size, " failed");
+    }
+    return Status::OK();
+  }
+
+  Status Map(int64_t size, uint8_t** out) {
+    RETURN_NOT_OK(CheckSize(size));
+    const auto mapped_size = static_cast<size_t>(MappedSize(size));
+    void* addr = MAP_FAILED;
+    if (options_.explicit_huge_pages) {
+      addr = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE,
+                  MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+    if (addr == MAP_FAILED) {
+      // Map more than needed and trim to a huge page boundary, so that the
+      // whole region can be backed by transparent huge pages
+      const auto alignment = static_cast<uint64_t>(huge_page_size_);
+      void* raw = mmap(nullptr, mapped_size + alignment, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (raw == MAP_FAILED) {
+        return Status::OutOfMemory("mmap of size ", size, " failed");
+      }
+      const auto raw_begin = reinterpret_cast<uintptr_t>(raw);
+      const auto raw_end = raw_begin + mapped_size + alignment;
+      const auto begin = static_cast<uintptr_t>(
+          BitUtil::RoundUpToPowerOf2(static_cast<uint64_t>(raw_begin), alignment));
+      const auto end = begin + mapped_size;
+      if (begin > raw_begin) {
+        munmap(raw, begin - raw_begin);
+      }
+      if (raw_end > end) {
+        munmap(reinterpret_cast<void*>(end), raw_end - end);
+      }
+      addr = reinterpret_cast<void*>(begin);
+      // Transparent huge pages may be disabled, which is not an error
+      ARROW_UNUSED(internal::MemoryAdviseHugePages(addr, mapped_size));
+    }
+    if (options_.numa_local) {
+      // Best effort as well, e.g. mbind() is often forbidden in containers
+      ARROW_UNUSED(internal::MemoryBindToNumaNode(addr, mapped_size,
+                                                  internal::GetCurrentNumaNode()));
+    }
+    bytes_mapped_ += static_cast<int64_t>(mapped_size);
+    *out = reinterpret_cast<uint8_t*>(addr);
+    return Status::OK();
+  }
+
+  Status Remap(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    RETURN_NOT_OK(CheckSize(new_size));
+    const int64_t old_mapped_size = MappedSize(old_size);
+    const int64_t new_mapped_size = MappedSize(new_size);
+    if (old_mapped_size == new_mapped_size) {
+      return Status::OK();
+    }
+    // The memory policies and huge page advice are carried over to the new mapping
+    void* addr = mremap(*ptr, static_cast<size_t>(old_mapped_size),
+                        static_cast<size_t>(new_mapped_size), MREMAP_MAYMOVE);
+    if (addr == MAP_FAILED) {
+      // Older kernels can't remap explicit huge pages
+      uint8_t* out;
+      RETURN_NOT_OK(Map(new_size, &out));
+      std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+      Unmap(*ptr, old_size);
+      *ptr = out;
+      return Status::OK();
+    }
+    bytes_mapped_ += new_mapped_size - old_mapped_size;
+    *ptr = reinterpret_cast<uint8_t*>(addr);
+    return Status::OK();
+  }
+
+  void Unmap(uint8_t* buffer, int64_t size) {
+    const int64_t mapped_size = MappedSize(size);
+    if (munmap(buffer, static_cast<size_t>(mapped_size)) != 0) {
+      ARROW_LOG(WARNING) << "munmap failed: " << std::strerror(errno);
+    }
+    bytes_mapped_ -= mapped_size;
+  }
+#else
+  bool IsMapped(int64_t size) const { return false; }
+
+  Status Map(int64_t size, uint8_t** out) {
+    return Status::NotImplemented("Memory mapping allocations");
+  }
+
+  Status Remap(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    return Status::NotImplemented("Memory mapping allocations");
+  }
+
+  void Unmap(uint8_t* buffer, int64_t size) {}
+#endif
+
+  MemoryPool* backend_;
+  const HugePageMemoryPoolOptions options_;
+  const int64_t page_size_;
+  const int64_t huge_page_size_;
+  std::atomic<int64_t> bytes_mapped_{0};
+  internal::MemoryPoolStats stats_;
+};
+
+HugePageMemoryPool::HugePageMemoryPool(MemoryPool* backend,
+                                       const HugePageMemoryPoolOptions& options) {
+  impl_.reset(new HugePageMemoryPoolImpl(backend, options));
+}
+
+HugePageMemoryPool::~HugePageMemoryPool() {}
+
+Status HugePageMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status HugePageMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                      uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void HugePageMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t HugePageMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t HugePageMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string HugePageMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+int64_t HugePageMemoryPool::bytes_mapped() const { return impl_->bytes_mapped(); }
+
+///////////////////////////////////////////////////////////////////////
+// RecyclingMemoryPool implementation
+
+RecyclingMemoryPoolOptions RecyclingMemoryPoolOptions::Defaults() { return {}; }
+
+class RecyclingMemoryPool::RecyclingMemoryPoolImpl {
+ public:
+  RecyclingMemoryPoolImpl(MemoryPool* backend, const RecyclingMemoryPoolOptions& options)
+      : backend_(backend), options_(options) {}
+
+  ~RecyclingMemoryPoolImpl() { ReleaseUnused(); }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (!IsRecycled(size)) {
+      RETURN_NOT_OK(backend_->Allocate(size, out));
+    } else if (!TakeCached(Capacity(size), out)) {
+      RETURN_NOT_OK(backend_->Allocate(Capacity(size), out));
+    }
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    const bool old_recycled = IsRecycled(old_size);
+    const bool new_recycled = IsRecycled(new_size);
+    if (old_recycled && new_recycled && Capacity(old_size) == Capacity(new_size)) {
+      // Same capacity, nothing to do
+    } else if (!old_recycled && !new_recycled) {
+      RETURN_NOT_OK(backend_->Reallocate(old_size, new_size, ptr));
+    } else {
+      uint8_t* out;
+      if (!new_recycled || !TakeCached(Capacity(new_size), &out)) {
+        if (old_recycled && new_recycled) {
+          // Let the backend resize in place if it can
+          RETURN_NOT_OK(
+              backend_->Reallocate(Capacity(old_size), Capacity(new_size), ptr));
+          stats_.UpdateAllocatedBytes(new_size - old_size);
+          return Status::OK();
+        }
+        RETURN_NOT_OK(
+            backend_->Allocate(new_recycled ? Capacity(new_size) : new_size, &out));
+      }
+      std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+      FreeInternal(*ptr, old_size);
+      *ptr = out;
+    }
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    FreeInternal(buffer, size);
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  std::string backend_name() const { return backend_->backend_name(); }
+
+  int64_t bytes_cached() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_cached_;
+  }
+
+  int64_t num_recycled() const { return num_recycled_.load(); }
+
+  void ReleaseUnused() {
+    std::unordered_map<int64_t, std::vector<uint8_t*>> free_lists;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      free_lists.swap(free_lists_);
+      bytes_cached_ = 0;
+    }
+    for (const auto& entry : free_lists) {
+      for (uint8_t* buffer : entry.second) {
+        backend_->Free(buffer, entry.first);
+      }
+    }
+  }
+
+ private:
+  bool IsRecycled(int64_t size) const {
+    return size >= options_.min_size && size <= options_.max_cached_bytes;
+  }
+
+  // Buffers of sizes rounded to the same multiple of 64 are interchangeable,
+  // as builders round their capacity likewise
+  static int64_t Capacity(int64_t size) { return BitUtil::RoundUpToMultipleOf64(size); }
+
+  bool TakeCached(int64_t capacity, uint8_t** out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = free_lists_.find(capacity);
+    if (it == free_lists_.end() || it->second.empty()) {
+      return false;
+    }
+    *out = it->second.back();
+    it->second.pop_back();
+    bytes_cached_ -= capacity;
+    ++num_recycled_;
+    return true;
+  }
+
+  void FreeInternal(uint8_t* buffer, int64_t size) {
+    if (!IsRecycled(size)) {
+      backend_->Free(buffer, size);
+      return;
+    }
+    const int64_t capacity = Capacity(size);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (bytes_cached_ + capacity <= options_.max_cached_bytes) {
+        free_lists_[capacity].push_back(buffer);
+        bytes_cached_ += capacity;
+        return;
+      }
+    }
+    backend_->Free(buffer, capacity);
+  }
+
+  MemoryPool* backend_;
+  const RecyclingMemoryPoolOptions options_;
+  internal::MemoryPoolStats stats_;
+  std::atomic<int64_t> num_recycled_{0};
+
+  mutable std::mutex mutex_;
+  // Free buffers by capacity
+  std::unordered_map<int64_t, std::vector<uint8_t*>> free_lists_;
+  int64_t bytes_cached_ = 0;
+};
+
+RecyclingMemoryPool::RecyclingMemoryPool(MemoryPool* backend,
+                                         const RecyclingMemoryPoolOptions& options) {
+  impl_.reset(new RecyclingMemoryPoolImpl(backend, options));
+}
+
+RecyclingMemoryPool::~RecyclingMemoryPool() {}
+
+Status RecyclingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status RecyclingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                       uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void RecyclingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t RecyclingMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t RecyclingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string RecyclingMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+int64_t RecyclingMemoryPool::bytes_cached() const { return impl_->bytes_cached(); }
+
+int64_t RecyclingMemoryPool::num_recycled() const { return impl_->num_recycled(); }
+
+void RecyclingMemoryPool::ReleaseUnused() { impl_->ReleaseUnused(); }
+
+///////////////////////////////////////////////////////////////////////
+// ThreadCachingMemoryPool implementation
+
+ThreadCachingMemoryPoolOptions ThreadCachingMemoryPoolOptions::Defaults() { return {}; }
+
+namespace {
+
+// Size classes are the multiples of 64 bytes up to 1 KiB, then four classes
+// per power of two
+constexpr int64_t kSmallSizeClassStep = 64;
+constexpr int kSmallSizeClassLimitLog2 = 10;
+constexpr int64_t kSmallSizeClassLimit = int64_t(1) << kSmallSizeClassLimitLog2;
+constexpr int kNumSmallSizeClasses =
+    static_cast<int>(kSmallSizeClassLimit / kSmallSizeClassStep);
+constexpr int kSizeClassesPerPowerOf2 = 4;
+constexpr int64_t kMaxCachedSizeLimit = int64_t(1) << 30;
+
+// A thread publishes its statistics once they drift by this many bytes
+constexpr int64_t kStatsPublishThreshold = 1 << 20;
+
+int SizeClassIndex(int64_t size) {
+  DCHECK_GT(size, 0);
+  if (size <= kSmallSizeClassLimit) {
+    return static_cast<int>((size - 1) / kSmallSizeClassStep);
+  }
+  const int log2 = 63 - BitUtil::CountLeadingZeros(static_cast<uint64_t>(size - 1));
+  const int64_t base = int64_t(1) << log2;
+  const int64_t step = base / kSizeClassesPerPowerOf2;
+  return kNumSmallSizeClasses +
+         (log2 - kSmallSizeClassLimitLog2) * kSizeClassesPerPowerOf2 +
+         static_cast<int>((size - 1 - base) / step);
+}
+
+int64_t SizeClassSize(int index) {
+  if (index < kNumSmallSizeClasses) {
+    return (index + 1) * kSmallSizeClassStep;
+  }
+  const int large_index = index - kNumSmallSizeClasses;
+  const int log2 = kSmallSizeClassLimitLog2 + large_index / kSizeClassesPerPowerOf2;
+  const int64_t base = int64_t(1) << log2;
+  const int64_t step = base / kSizeClassesPerPowerOf2;
+  return base + (large_index % kSizeClassesPerPowerOf2 + 1) * step;
+}
+
+// Only written by the owning thread, so that no read-modify-write is needed
+inline void AddRelaxed(std::atomic<int64_t>* value, int64_t diff) {
+  value->store(value->load(std::memory_order_relaxed) + diff, std::memory_order_relaxed);
+}
+
+struct ThreadCache {
+  explicit ThreadCache(size_t num_classes) : free_lists(num_classes) {}
+
+  // Freed blocks, by size class
+  std::vector<std::vector<uint8_t*>> free_lists;
+  // Allocated bytes not published to the pool statistics yet
+  std::atomic<int64_t> unpublished_bytes{0};
+  std::atomic<int64_t> cached_bytes{0};
+};
+
+std::atomic<uint64_t> next_caching_pool_id{1};
+
+// The calling thread's cache for the pool it used last
+thread_local uint64_t current_caching_pool_id = 0;
+thread_local ThreadCache* current_thread_cache = NULLPTR;
+
+}  // namespace
+
+class ThreadCachingMemoryPool::ThreadCachingMemoryPoolImpl
+    : public std::enable_shared_from_this<ThreadCachingMemoryPoolImpl> {
+ public:
+  ThreadCachingMemoryPoolImpl(MemoryPool* backend,
+                              const ThreadCachingMemoryPoolOptions& options)
+      : backend_(backend), id_(next_caching_pool_id.fetch_add(1)) {
+    const int64_t max_cached_size =
+        std::min(options.max_cached_size, kMaxCachedSizeLimit);
+    const int num_classes = max_cached_size > 0 ? SizeClassIndex(max_cached_size) + 1 : 0;
+    max_cached_size_ = num_classes > 0 ? SizeClassSize(num_classes - 1) : 0;
+    classes_.reset(new SizeClass[num_classes]);
+    for (int i = 0; i < num_classes; ++i) {
+      auto& size_class = classes_[i];
+      size_class.size = SizeClassSize(i);
+      size_class.thread_capacity = static_cast<size_t>(
+          std::max<int64_t>(2, options.thread_cache_size_per_class / size_class.size));
+      size_class.shared_capacity = static_cast<size_t>(
+          std::max<int64_t>(0, options.shared_cache_size_per_class / size_class.size));
+      size_class.batch_size = std::max<size_t>(1, size_class.thread_capacity / 2);
+    }
+    num_classes_ = static_cast<size_t>(num_classes);
+  }
+
+  ~ThreadCachingMemoryPoolImpl() {
+    // Release() was called by the pool destructor
+    DCHECK(closed_.load());
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (size < 0) {
+      return Status::Invalid("negative malloc size");
+    }
+    if (!IsCached(size)) {
+      RETURN_NOT_OK(backend_->Allocate(size, out));
+      stats_.UpdateAllocatedBytes(size);
+      return Status::OK();
+    }
+    ThreadCache* cache = GetThreadCache();
+    const int index = SizeClassIndex(size);
+    auto& free_list = cache->free_lists[index];
+    if (free_list.empty()) {
+      RETURN_NOT_OK(Refill(cache, index));
+    }
+    *out = free_list.back();
+    free_list.pop_back();
+    AddRelaxed(&cache->cached_bytes, -classes_[index].size);
+    UpdateStats(cache, size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (new_size < 0) {
+      return Status::Invalid("negative realloc size");
+    }
+    const bool old_cached = IsCached(old_size);
+    const bool new_cached = IsCached(new_size);
+    if (!old_cached && !new_cached) {
+      RETURN_NOT_OK(backend_->Reallocate(old_size, new_size, ptr));
+      stats_.UpdateAllocatedBytes(new_size - old_size);
+      return Status::OK();
+    }
+    if (old_cached && new_cached &&
+        SizeClassIndex(old_size) == SizeClassIndex(new_size)) {
+      // The block is large enough already
+      UpdateStats(GetThreadCache(), new_size - old_size);
+      return Status::OK();
+    }
+    uint8_t* new_ptr;
+    RETURN_NOT_OK(Allocate(new_size, &new_ptr));
+    const int64_t copy_size = std::min(old_size, new_size);
+    if (copy_size > 0) {
+      std::memcpy(new_ptr, *ptr, static_cast<size_t>(copy_size));
+    }
+    Free(*ptr, old_size);
+    *ptr = new_ptr;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    if (!IsCached(size)) {
+      backend_->Free(buffer, size);
+      stats_.UpdateAllocatedBytes(-size);
+      return;
+    }
+    ThreadCache* cache = GetThreadCache();
+    const int index = SizeClassIndex(size);
+    auto& free_list = cache->free_lists[index];
+    free_list.push_back(buffer);
+    AddRelaxed(&cache->cached_bytes, classes_[index].size);
+    if (free_list.size() > classes_[index].thread_capacity) {
+      Drain(cache, index);
+    }
+    UpdateStats(cache, -size);
+  }
+
+  int64_t bytes_allocated() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    int64_t total = stats_.bytes_allocated();
+    for (const auto cache : caches_) {
+      total += cache->unpublished_bytes.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+  int64_t max_memory() const {
+    // The unpublished allocations may not be accounted for in the peak yet
+    return std::max(stats_.max_memory(), bytes_allocated());
+  }
+
+  int64_t bytes_cached() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    int64_t total = 0;
+    for (const auto cache : caches_) {
+      total += cache->cached_bytes.load(std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < num_classes_; ++i) {
+      std::lock_guard<std::mutex> class_lock(classes_[i].mutex);
+      total += static_cast<int64_t>(classes_[i].shared_blocks.size()) * classes_[i].size;
+    }
+    return total;
+  }
+
+  std::string backend_name() const { return backend_->backend_name(); }
+
+  // Return all the cached memory to the backend, when the pool is destroyed
+  void Release() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_.store(true);
+    for (const auto cache : caches_) {
+      for (size_t i = 0; i < num_classes_; ++i) {
+        FreeBlocks(&cache->free_lists[i], cache->free_lists[i].size(), classes_[i].size);
+      }
+      cache->cached_bytes.store(0);
+    }
+    caches_.clear();
+    for (size_t i = 0; i < num_classes_; ++i) {
+      std::lock_guard<std::mutex> class_lock(classes_[i].mutex);
+      FreeBlocks(&classes_[i].shared_blocks, classes_[i].shared_blocks.size(),
+                 classes_[i].size);
+    }
+  }
+
+ private:
+  struct SizeClass {
+    int64_t size;
+    // The maximum number of blocks in a thread's cache and in the shared
+    // cache, and the number of blocks a thread takes from the shared cache
+    size_t thread_capacity;
+    size_t shared_capacity;
+    size_t batch_size;
+
+    std::mutex mutex;
+    std::vector<uint8_t*> shared_blocks;
+    // Lets threads skip the lock when there is nothing to take
+    std::atomic<size_t> num_shared_blocks{0};
+  };
+
+  struct ThreadCacheEntry {
+    std::shared_ptr<ThreadCachingMemoryPoolImpl> pool;
+    std::unique_ptr<ThreadCache> cache;
+  };
+
+  // The caches of a thread for all the pools it used, released on thread exit
+  struct ThreadCacheRegistry {
+    ~ThreadCacheRegistry() {
+      current_caching_pool_id = 0;
+      current_thread_cache = NULLPTR;
+      for (auto& entry : entries) {
+        entry.pool->ReleaseThreadCache(entry.cache.get());
+      }
+    }
+
+    std::vector<ThreadCacheEntry> entries;
+  };
+
+  bool IsCached(int64_t size) const { return size > 0 && size <= max_cached_size_; }
+
+  ThreadCache* GetThreadCache() {
+    if (ARROW_PREDICT_TRUE(current_caching_pool_id == id_)) {
+      return current_thread_cache;
+    }
+    static thread_local ThreadCacheRegistry registry;
+    auto& entries = registry.entries;
+    // Forget about the pools destroyed since
+    entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                 [](const ThreadCacheEntry& entry) {
+                                   return entry.pool->closed_.load();
+                                 }),
+                  entries.end());
+    ThreadCache* cache = NULLPTR;
+    for (const auto& entry : entries) {
+      if (entry.pool.get() == this) {
+        cache = entry.cache.get();
+        break;
+      }
+    }
+    if (cache == NULLPTR) {
+      std::unique_ptr<ThreadCache> new_cache(new ThreadCache(num_classes_));
+      for (size_t i = 0; i < num_classes_; ++i) {
+        new_cache->free_lists[i].reserve(classes_[i].thread_capacity + 1);
+      }
+      cache = new_cache.get();
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        caches_.push_back(cache);
+      }
+      entries.push_back({shared_from_this(), std::move(new_cache)});
+    }
+    current_caching_pool_id = id_;
+    current_thread_cache = cache;
+    return cache;
+  }
+
+  // Called on thread exit
+  void ReleaseThreadCache(ThreadCache* cache) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closed_.load()) {
+      return;
+    }
+    caches_.erase(std::find(caches_.begin(), caches_.end(), cache));
+    stats_.UpdateAllocatedBytes(cache->unpublished_bytes.load());
+    for (size_t i = 0; i < num_classes_; ++i) {
+      auto& free_list = cache->free_lists[i];
+      GiveToShared(&free_list, i);
+      FreeBlocks(&free_list, free_list.size(), classes_[i].size);
+    }
+  }
+
+  // Take a batch of blocks from the shared cache, or allocate one from the backend
+  Status Refill(ThreadCache* cache, int index) {
+    auto& size_class = classes_[index];
+    auto& free_list = cache->free_lists[index];
+    if (size_class.num_shared_blocks.load(std::memory_order_relaxed) > 0) {
+      std::lock_guard<std::mutex> lock(size_class.mutex);
+      auto& shared_blocks = size_class.shared_blocks;
+      const size_t num_blocks = std::min(shared_blocks.size(), size_class.batch_size);
+      free_list.insert(free_list.end(), shared_blocks.end() - num_blocks,
+                       shared_blocks.end());
+      shared_blocks.resize(shared_blocks.size() - num_blocks);
+      size_class.num_shared_blocks.store(shared_blocks.size(), std::memory_order_relaxed);
+    }
+    if (free_list.empty()) {
+      uint8_t* block;
+      RETURN_NOT_OK(backend_->Allocate(size_class.size, &block));
+      free_list.push_back(block);
+    }
+    AddRelaxed(&cache->cached_bytes,
+               static_cast<int64_t>(free_list.size()) * size_class.size);
+    return Status::OK();
+  }
+
+  // Move half of a thread's blocks to the shared cache, and free those which
+  // don't fit in there
+  void Drain(ThreadCache* cache, int index) {
+    auto& free_list = cache->free_lists[index];
+    const size_t num_blocks = free_list.size() / 2;
+    const size_t num_moved = GiveToShared(&free_list, index, num_blocks);
+    FreeBlocks(&free_list, num_blocks - num_moved, classes_[index].size);
+    AddRelaxed(&cache->cached_bytes,
+               -static_cast<int64_t>(num_blocks) * classes_[index].size);
+  }
+
+  // Move up to `max_blocks` blocks from the end of `blocks` to the shared cache,
+  // return the number of blocks moved
+  size_t GiveToShared(std::vector<uint8_t*>* blocks, size_t index,
+                      size_t max_blocks = std::numeric_limits<size_t>::max()) {
+    auto& size_class = classes_[index];
+    std::lock_guard<std::mutex> lock(size_class.mutex);
+    auto& shared_blocks = size_class.shared_blocks;
+    const size_t room = size_class.shared_capacity -
+                        std::min(size_class.shared_capacity, shared_blocks.size());
+    const size_t num_blocks = std::min({max_blocks, room, blocks->size()});
+    shared_blocks.insert(shared_blocks.end(), blocks->end() - num_blocks, blocks->end());
+    blocks->resize(blocks->size() - num_blocks);
+    size_class.num_shared_blocks.store(shared_blocks.size(), std::memory_order_relaxed);
+    return num_blocks;
+  }
+
+  // Free the last `num_blocks` blocks to the backend
+  void FreeBlocks(std::vector<uint8_t*>* blocks, size_t num_blocks, int64_t size) {
+    for (size_t i = 0; i < num_blocks; ++i) {
+      backend_->Free(blocks->back(), size);
+      blocks->pop_back();
+    }
+  }
+
+  void UpdateStats(ThreadCache* cache, int64_t diff) {
+    const int64_t unpublished =
+        cache->unpublished_bytes.load(std::memory_order_relaxed) + diff;
+    if (unpublished >= kStatsPublishThreshold || unpublished <= -kStatsPublishThreshold) {
+      stats_.UpdateAllocatedBytes(unpublished);
+      cache->unpublished_bytes.store(0, std::memory_order_relaxed);
+    } else {
+      cache->unpublished_bytes.store(unpublished, std::memory_order_relaxed);
+    }
+  }
+
+  MemoryPool* backend_;
+  // Never reused, unlike the address of a destroyed pool
+  const uint64_t id_;
+  int64_t max_cached_size_;
+  size_t num_classes_;
+  std::unique_ptr<SizeClass[]> classes_;
+  internal::MemoryPoolStats stats_;
+
+  // Protects caches_
+  mutable std::mutex mutex_;
+  std::vector<ThreadCache*> caches_;
+  std::atomic<bool> closed_{false};
+};
+
+ThreadCachingMemoryPool::ThreadCachingMemoryPool(
+    MemoryPool* backend, const ThreadCachingMemoryPoolOptions& options)
+    : impl_(std::make_shared<ThreadCachingMemoryPoolImpl>(backend, options)) {}
+
+ThreadCachingMemoryPool::~ThreadCachingMemoryPool() { impl_->Release(); }
+
+Status ThreadCachingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ThreadCachingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                           uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ThreadCachingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  impl_->Free(buffer, size);
+}
+
+int64_t ThreadCachingMemoryPool::bytes_allocated() const {
+  return impl_->bytes_allocated();
+}
+
+int64_t ThreadCachingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string ThreadCachingMemoryPool::backend_name() const {
+  return impl_->backend_name();
+}
+
+int64_t ThreadCachingMemoryPool::bytes_cached() const { return impl_->bytes_cached(); }
+
 }  // namespace arrow
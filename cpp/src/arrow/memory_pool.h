@@ -19,8 +19,10 @@
 
 #include <atomic>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
@@ -149,6 +151,252 @@ class ARROW_EXPORT ProxyMemoryPool : public MemoryPool {
   std::unique_ptr<ProxyMemoryPoolImpl> impl_;
 };
 
+/// \brief A memory pool enforcing a limit on the bytes allocated through it
+///
+/// Allocations are forwarded to a parent pool, which may itself be a
+/// LimitedMemoryPool: e.g. a pool per query under a pool per tenant under
+/// the process-wide pool.  The memory allocated through a child counts
+/// towards the limits of all its ancestors.  The parent pool must outlive
+/// the pool, and all the memory allocated through it must be freed before
+/// it is destroyed.
+///
+/// When an allocation would exceed the limit, the registered release
+/// callbacks are asked to free memory (e.g. by spilling, or by dropping cached
+/// data) before the allocation fails with OutOfMemory.  The callbacks of all
+/// the descendants of a pool are asked as well, after those of the pool
+/// itself.  Release callbacks may free and allocate memory from the pool, but
+/// allocations made from a callback don't trigger other callbacks.
+class ARROW_EXPORT LimitedMemoryPool : public MemoryPool {
+ public:
+  /// \brief A callback asked to release memory
+  ///
+  /// It is given the number of bytes needed, and returns the number of bytes
+  /// it released.
+  using ReleaseCallback = std::function<int64_t(int64_t nbytes)>;
+
+  LimitedMemoryPool(MemoryPool* parent, int64_t limit);
+  ~LimitedMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// The maximum number of bytes allocated through this pool
+  int64_t limit() const;
+
+  /// \brief Change the limit
+  ///
+  /// Lowering the limit below bytes_allocated() doesn't release anything, but
+  /// makes further allocations fail until enough memory is freed.
+  void set_limit(int64_t limit);
+
+  /// \brief Register a release callback, return an id to remove it
+  int64_t AddReleaseCallback(ReleaseCallback callback);
+
+  /// \brief Remove a release callback
+  ///
+  /// Once this returns, the callback is not running and won't be called anymore.
+  void RemoveReleaseCallback(int64_t id);
+
+  /// \brief Ask the release callbacks to free `nbytes`, return the number of
+  /// bytes they reported as released
+  int64_t ReleaseMemory(int64_t nbytes);
+
+ private:
+  class LimitedMemoryPoolImpl;
+  std::unique_ptr<LimitedMemoryPoolImpl> impl_;
+};
+
+/// Options for HugePageMemoryPool
+struct ARROW_EXPORT HugePageMemoryPoolOptions {
+  /// Allocations of at least this size are mapped directly from the system,
+  /// smaller ones are forwarded to the backend pool
+  int64_t threshold = 1 << 21;
+  /// Map explicitly reserved huge pages (see /proc/sys/vm/nr_hugepages)
+  /// rather than ask for transparent huge pages.  Transparent huge pages
+  /// are used when no reserved huge page is left.
+  bool explicit_huge_pages = false;
+  /// Prefer placing the pages on the NUMA node of the allocating thread,
+  /// rather than on the node of the thread first touching them
+  bool numa_local = false;
+
+  static HugePageMemoryPoolOptions Defaults();
+};
+
+/// \brief A memory pool backing large allocations with huge pages
+///
+/// Large allocations are memory-mapped, aligned on huge page boundaries,
+/// which reduces TLB misses when scanning multi-gigabyte buffers.  On
+/// platforms other than Linux, all allocations are forwarded to the backend.
+class ARROW_EXPORT HugePageMemoryPool : public MemoryPool {
+ public:
+  explicit HugePageMemoryPool(
+      MemoryPool* backend,
+      const HugePageMemoryPoolOptions& options = HugePageMemoryPoolOptions::Defaults());
+  ~HugePageMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// The number of bytes currently mapped for large allocations
+  int64_t bytes_mapped() const;
+
+ private:
+  class HugePageMemoryPoolImpl;
+  std::unique_ptr<HugePageMemoryPoolImpl> impl_;
+};
+
+/// Options for RecyclingMemoryPool
+struct ARROW_EXPORT RecyclingMemoryPoolOptions {
+  /// Allocations smaller than this are forwarded to the backend pool
+  /// without being recycled
+  int64_t min_size = 4096;
+  /// Maximum number of bytes kept in the free lists
+  int64_t max_cached_bytes = 64 << 20;
+
+  static RecyclingMemoryPoolOptions Defaults();
+};
+
+/// \brief A memory pool recycling the freed buffers for allocations of the
+/// same capacity
+///
+/// Streaming readers allocate buffers of the same sizes for each batch and
+/// free them once the batch is consumed.  Passing this pool to a reader (e.g.
+/// the RecordBatchStreamReader, the CSV StreamingReader or the Parquet
+/// RecordBatchReader) keeps the freed buffers in free lists, so that the next
+/// batches reuse them instead of going through the allocator and faulting in
+/// fresh pages.  The pool must outlive all the buffers allocated from it.
+class ARROW_EXPORT RecyclingMemoryPool : public MemoryPool {
+ public:
+  explicit RecyclingMemoryPool(
+      MemoryPool* backend,
+      const RecyclingMemoryPoolOptions& options = RecyclingMemoryPoolOptions::Defaults());
+  ~RecyclingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// The number of bytes held in the free lists
+  int64_t bytes_cached() const;
+
+  /// The number of allocations served from the free lists
+  int64_t num_recycled() const;
+
+  /// Return the buffers held in the free lists to the backend
+  void ReleaseUnused();
+
+ private:
+  class RecyclingMemoryPoolImpl;
+  std::unique_ptr<RecyclingMemoryPoolImpl> impl_;
+};
+
+/// Options for ThreadCachingMemoryPool
+struct ARROW_EXPORT ThreadCachingMemoryPoolOptions {
+  /// Allocations larger than this (after rounding to a size class) go straight
+  /// to the backend pool
+  int64_t max_cached_size = 64 * 1024;
+  /// Maximum number of bytes cached by each thread for each size class
+  int64_t thread_cache_size_per_class = 256 * 1024;
+  /// Maximum number of bytes in the cache shared by all threads, for each size
+  /// class
+  int64_t shared_cache_size_per_class = 1024 * 1024;
+
+  static ThreadCachingMemoryPoolOptions Defaults();
+};
+
+/// \brief A memory pool caching freed memory per thread, over another pool
+///
+/// Small allocations are rounded up to a size class (the multiples of 64
+/// bytes up to 1 KiB, then four classes per power of two) and served from a
+/// cache local to the calling thread, without any locking nor atomic
+/// read-modify-write.  Reallocating within a size class is free.  A block may
+/// be freed by another thread than the one which allocated it: it then goes to
+/// the freeing thread's cache.  A thread cache exceeding its capacity hands
+/// half of its blocks to a shared cache, from which other threads refill in
+/// batches, and beyond that the blocks are freed to the backend pool.
+///
+/// Statistics are accumulated per thread and published periodically: while
+/// other threads allocate, bytes_allocated() and max_memory() are approximate.
+/// A thread's cached memory is returned when the thread exits, and all of it
+/// when the pool is destroyed.  The pool must not be destroyed while other
+/// threads use it.
+class ARROW_EXPORT ThreadCachingMemoryPool : public MemoryPool {
+ public:
+  explicit ThreadCachingMemoryPool(
+      MemoryPool* backend,
+      const ThreadCachingMemoryPoolOptions& options =
+          ThreadCachingMemoryPoolOptions::Defaults());
+  ~ThreadCachingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// The number of bytes freed into the caches, and not returned to the
+  /// backend pool yet
+  int64_t bytes_cached() const;
+
+ private:
+  class ThreadCachingMemoryPoolImpl;
+  // Shared with the threads' caches, so that they can tell when the pool is gone
+  std::shared_ptr<ThreadCachingMemoryPoolImpl> impl_;
+};
+
+/// \brief The memory allocated through the pools of a tag
+struct ARROW_EXPORT MemoryTagStatistics {
+  std::string tag;
+  /// The bytes currently allocated
+  int64_t bytes_allocated;
+  /// The peak of bytes_allocated
+  int64_t max_memory;
+};
+
+/// \brief Return a pool accounting its allocations to a subsystem tag
+///
+/// Allocations are forwarded to `parent`, and counted towards the statistics
+/// of `tag` (e.g. "parquet", "csv" or "ipc-decompression"), which are shared
+/// by all the pools of that tag.  Tagged pools may be nested, in which case
+/// an allocation counts towards each of the tags.  Accounting costs a couple
+/// of atomic operations per allocation.
+///
+/// The returned pool lives as long as the process (it is created on the first
+/// call for the pair of `parent` and `tag`), so buffers may outlive the
+/// objects which allocated them; `parent` must stay alive as usual.
+ARROW_EXPORT MemoryPool* GetTaggedMemoryPool(MemoryPool* parent, const std::string& tag);
+
+/// \brief Return the statistics of all the tags, sorted by tag
+ARROW_EXPORT std::vector<MemoryTagStatistics> GetMemoryTagStatistics();
+
 /// Return a process-wide memory pool based on the system allocator.
 ARROW_EXPORT MemoryPool* system_memory_pool();
 
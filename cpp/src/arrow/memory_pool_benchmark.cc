@@ -15,6 +15,8 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cstring>
+
 #include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/util/logging.h"
@@ -47,6 +49,30 @@ struct Mimalloc {
 };
 #endif
 
+// Per-thread caches over the system allocator, as when jemalloc isn't available
+struct ThreadCachingSystemAlloc {
+  static Result<MemoryPool*> GetAllocator() {
+    static ThreadCachingMemoryPool pool(system_memory_pool());
+    return &pool;
+  }
+};
+
+// Huge pages for the allocations of 2 MiB or more
+struct HugePageSystemAlloc {
+  static Result<MemoryPool*> GetAllocator() {
+    static HugePageMemoryPool pool(system_memory_pool());
+    return &pool;
+  }
+};
+
+// Free lists of buffers, as a streaming reader may use
+struct RecyclingSystemAlloc {
+  static Result<MemoryPool*> GetAllocator() {
+    static RecyclingMemoryPool pool(system_memory_pool());
+    return &pool;
+  }
+};
+
 static void TouchCacheLines(uint8_t* data, int64_t nbytes) {
   uint8_t total = 0;
   while (nbytes > 0) {
@@ -105,6 +131,74 @@ static void AllocateTouchDeallocate(
   }
 }
 
+// Benchmark allocating several small buffers at a time from many threads,
+// freeing them in a different order.
+template <typename Alloc>
+static void AllocateDeallocateSmall(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t nbytes = state.range(0);
+  MemoryPool* pool = *Alloc::GetAllocator();
+  constexpr int kNumBuffers = 16;
+  uint8_t* data[kNumBuffers];
+
+  for (auto _ : state) {
+    for (int i = 0; i < kNumBuffers; ++i) {
+      ARROW_CHECK_OK(pool->Allocate(nbytes + i * 8, &data[i]));
+    }
+    for (int i = 0; i < kNumBuffers; i += 2) {
+      pool->Free(data[i], nbytes + i * 8);
+    }
+    for (int i = 1; i < kNumBuffers; i += 2) {
+      pool->Free(data[i], nbytes + i * 8);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kNumBuffers);
+}
+
+// Benchmark growing a buffer by small increments, as builders do.
+template <typename Alloc>
+static void ReallocateGrow(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t nbytes = state.range(0);
+  MemoryPool* pool = *Alloc::GetAllocator();
+  constexpr int64_t kIncrement = 64;
+
+  for (auto _ : state) {
+    uint8_t* data;
+    int64_t size = kIncrement;
+    ARROW_CHECK_OK(pool->Allocate(size, &data));
+    for (; size < nbytes; size += kIncrement) {
+      ARROW_CHECK_OK(pool->Reallocate(size, size + kIncrement, &data));
+    }
+    pool->Free(data, size);
+  }
+  state.SetItemsProcessed(state.iterations() * (nbytes / kIncrement));
+}
+
+// Benchmark random accesses to a large buffer, which are dominated by TLB misses
+// when the buffer is backed by small pages.
+template <typename Alloc>
+static void RandomAccess(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t nbytes = state.range(0);
+  MemoryPool* pool = *Alloc::GetAllocator();
+  uint8_t* data;
+  ARROW_CHECK_OK(pool->Allocate(nbytes, &data));
+  std::memset(data, 1, static_cast<size_t>(nbytes));
+  constexpr int64_t kNumAccesses = 1 << 16;
+
+  uint64_t position = 0;
+  for (auto _ : state) {
+    uint8_t total = 0;
+    for (int64_t i = 0; i < kNumAccesses; ++i) {
+      // Linear congruential generator, to keep the loop cheap
+      position = position * 6364136223846793005ULL + 1442695040888963407ULL;
+      total += data[(position >> 16) % static_cast<uint64_t>(nbytes)];
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * kNumAccesses);
+  pool->Free(data, nbytes);
+}
+
 #define BENCHMARK_ALLOCATE_ARGS \
   ->RangeMultiplier(16)->Range(4096, 16 * 1024 * 1024)->ArgName("size")->UseRealTime()
 
@@ -113,8 +207,37 @@ static void AllocateTouchDeallocate(
 
 BENCHMARK(TouchArea) BENCHMARK_ALLOCATE_ARGS;
 
+#define BENCHMARK_ALLOCATE_SMALL(benchmark_func, template_param)               \
+  BENCHMARK_TEMPLATE(benchmark_func, template_param)                          \
+      ->RangeMultiplier(8)->Range(64, 4096)->ArgName("size")->ThreadRange(1, 16) \
+      ->UseRealTime()
+
+#define BENCHMARK_REALLOCATE(benchmark_func, template_param) \
+  BENCHMARK_TEMPLATE(benchmark_func, template_param)->Arg(64 * 1024)->ArgName("size")
+
 BENCHMARK_ALLOCATE(AllocateDeallocate, SystemAlloc);
 BENCHMARK_ALLOCATE(AllocateTouchDeallocate, SystemAlloc);
+BENCHMARK_ALLOCATE_SMALL(AllocateDeallocateSmall, SystemAlloc);
+BENCHMARK_REALLOCATE(ReallocateGrow, SystemAlloc);
+
+BENCHMARK_ALLOCATE(AllocateDeallocate, ThreadCachingSystemAlloc);
+BENCHMARK_ALLOCATE(AllocateTouchDeallocate, ThreadCachingSystemAlloc);
+BENCHMARK_ALLOCATE_SMALL(AllocateDeallocateSmall, ThreadCachingSystemAlloc);
+BENCHMARK_REALLOCATE(ReallocateGrow, ThreadCachingSystemAlloc);
+
+BENCHMARK_ALLOCATE(AllocateDeallocate, RecyclingSystemAlloc);
+BENCHMARK_ALLOCATE(AllocateTouchDeallocate, RecyclingSystemAlloc);
+
+BENCHMARK_ALLOCATE(AllocateDeallocate, HugePageSystemAlloc);
+BENCHMARK_ALLOCATE(AllocateTouchDeallocate, HugePageSystemAlloc);
+
+#define BENCHMARK_RANDOM_ACCESS(template_param)                    \
+  BENCHMARK_TEMPLATE(RandomAccess, template_param)                 \
+      ->RangeMultiplier(8)->Range(16 * 1024 * 1024, 1024 * 1024 * 1024) \
+      ->ArgName("size")
+
+BENCHMARK_RANDOM_ACCESS(SystemAlloc);
+BENCHMARK_RANDOM_ACCESS(HugePageSystemAlloc);
 
 #ifdef ARROW_JEMALLOC
 BENCHMARK_ALLOCATE(AllocateDeallocate, Jemalloc);
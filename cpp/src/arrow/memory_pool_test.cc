@@ -15,7 +15,14 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <atomic>
 #include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -23,6 +30,7 @@
 #include "arrow/memory_pool_test.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
 
 namespace arrow {
 
@@ -54,6 +62,40 @@ struct MimallocMemoryPoolFactory {
 };
 #endif
 
+struct ThreadCachingMemoryPoolFactory {
+  static MemoryPool* memory_pool() {
+    static ThreadCachingMemoryPool pool(system_memory_pool());
+    return &pool;
+  }
+};
+
+struct HugePageMemoryPoolFactory {
+  static MemoryPool* memory_pool() {
+    static HugePageMemoryPool pool(system_memory_pool(), MakeOptions());
+    return &pool;
+  }
+
+  static HugePageMemoryPoolOptions MakeOptions() {
+    // Exercise both the mapped and forwarded allocations
+    auto options = HugePageMemoryPoolOptions::Defaults();
+    options.threshold = 16;
+    return options;
+  }
+};
+
+struct RecyclingMemoryPoolFactory {
+  static MemoryPool* memory_pool() {
+    static RecyclingMemoryPool pool(system_memory_pool(), MakeOptions());
+    return &pool;
+  }
+
+  static RecyclingMemoryPoolOptions MakeOptions() {
+    auto options = RecyclingMemoryPoolOptions::Defaults();
+    options.min_size = 16;
+    return options;
+  }
+};
+
 template <typename Factory>
 class TestMemoryPool : public ::arrow::TestMemoryPoolBase {
  public:
@@ -76,6 +118,10 @@ REGISTER_TYPED_TEST_SUITE_P(TestMemoryPool, MemoryTracking, OOM, Reallocate);
 
 INSTANTIATE_TYPED_TEST_SUITE_P(Default, TestMemoryPool, DefaultMemoryPoolFactory);
 INSTANTIATE_TYPED_TEST_SUITE_P(System, TestMemoryPool, SystemMemoryPoolFactory);
+INSTANTIATE_TYPED_TEST_SUITE_P(ThreadCaching, TestMemoryPool,
+                               ThreadCachingMemoryPoolFactory);
+INSTANTIATE_TYPED_TEST_SUITE_P(HugePage, TestMemoryPool, HugePageMemoryPoolFactory);
+INSTANTIATE_TYPED_TEST_SUITE_P(Recycling, TestMemoryPool, RecyclingMemoryPoolFactory);
 
 #ifdef ARROW_JEMALLOC
 INSTANTIATE_TYPED_TEST_SUITE_P(Jemalloc, TestMemoryPool, JemallocMemoryPoolFactory);
@@ -145,6 +191,663 @@ TEST(ProxyMemoryPool, Logging) {
   ASSERT_EQ(0, pp.bytes_allocated());
 }
 
+TEST(TaggedMemoryPool, Statistics) {
+  ProxyMemoryPool parent(system_memory_pool());
+  MemoryPool* pool = GetTaggedMemoryPool(&parent, "test-tag");
+  ASSERT_EQ(pool, GetTaggedMemoryPool(&parent, "test-tag"));
+  // Nested tags
+  MemoryPool* nested = GetTaggedMemoryPool(pool, "test-nested");
+  ASSERT_NE(pool, nested);
+
+  auto get_stats = [](const std::string& tag) {
+    for (const auto& stats : GetMemoryTagStatistics()) {
+      if (stats.tag == tag) {
+        return stats;
+      }
+    }
+    return MemoryTagStatistics{tag, -1, -1};
+  };
+
+  uint8_t* data;
+  ASSERT_OK(pool->Allocate(100, &data));
+  uint8_t* data2;
+  ASSERT_OK(nested->Allocate(300, &data2));
+  ASSERT_OK(nested->Reallocate(300, 200, &data2));
+  ASSERT_EQ(300, parent.bytes_allocated());
+  ASSERT_EQ(300, pool->bytes_allocated());
+  ASSERT_EQ(200, nested->bytes_allocated());
+
+  auto stats = get_stats("test-tag");
+  ASSERT_EQ(300, stats.bytes_allocated);
+  ASSERT_EQ(400, stats.max_memory);
+  stats = get_stats("test-nested");
+  ASSERT_EQ(200, stats.bytes_allocated);
+  ASSERT_EQ(300, stats.max_memory);
+
+  pool->Free(data, 100);
+  nested->Free(data2, 200);
+  ASSERT_EQ(0, parent.bytes_allocated());
+  ASSERT_EQ(0, get_stats("test-tag").bytes_allocated);
+  ASSERT_EQ(0, get_stats("test-nested").bytes_allocated);
+  ASSERT_EQ(400, get_stats("test-tag").max_memory);
+}
+
+class TestThreadCachingMemoryPool : public ::testing::Test {
+ public:
+  void SetUp() override {
+    options_.thread_cache_size_per_class = 4 * 64;
+    options_.shared_cache_size_per_class = 100 * 64;
+  }
+
+  void MakePool() { pool_.reset(new ThreadCachingMemoryPool(&backend_, options_)); }
+
+ protected:
+  ThreadCachingMemoryPoolOptions options_;
+  ProxyMemoryPool backend_{system_memory_pool()};
+  std::unique_ptr<ThreadCachingMemoryPool> pool_;
+};
+
+TEST_F(TestThreadCachingMemoryPool, SizeClasses) {
+  MakePool();
+  uint8_t* data;
+  uint8_t* data2;
+
+  // Freed blocks are reused for allocations of the same size class
+  ASSERT_OK(pool_->Allocate(100, &data));
+  ASSERT_EQ(100, pool_->bytes_allocated());
+  ASSERT_EQ(128, backend_.bytes_allocated());
+  pool_->Free(data, 100);
+  ASSERT_EQ(0, pool_->bytes_allocated());
+  ASSERT_EQ(128, pool_->bytes_cached());
+  ASSERT_OK(pool_->Allocate(128, &data2));
+  ASSERT_EQ(data, data2);
+  ASSERT_EQ(0, pool_->bytes_cached());
+  ASSERT_EQ(128, backend_.bytes_allocated());
+
+  // But not for other size classes
+  ASSERT_OK(pool_->Allocate(129, &data));
+  ASSERT_EQ(128 + 192, backend_.bytes_allocated());
+  pool_->Free(data, 129);
+  pool_->Free(data2, 128);
+
+  // Four classes per power of two above 1 KiB
+  ASSERT_OK(pool_->Allocate(1025, &data));
+  ASSERT_EQ(128 + 192 + 1280, backend_.bytes_allocated());
+  pool_->Free(data, 1025);
+  ASSERT_OK(pool_->Allocate(1280, &data2));
+  ASSERT_EQ(data, data2);
+  pool_->Free(data2, 1280);
+  ASSERT_EQ(128 + 192 + 1280, pool_->bytes_cached());
+
+  // Large allocations are not cached
+  ASSERT_OK(pool_->Allocate(options_.max_cached_size + 1, &data));
+  ASSERT_EQ(options_.max_cached_size + 1, pool_->bytes_allocated());
+  pool_->Free(data, options_.max_cached_size + 1);
+  ASSERT_EQ(128 + 192 + 1280, backend_.bytes_allocated());
+
+  // Zero-sized allocations go to the backend
+  ASSERT_OK(pool_->Allocate(0, &data));
+  pool_->Free(data, 0);
+  ASSERT_EQ(0, pool_->bytes_allocated());
+  ASSERT_EQ(options_.max_cached_size + 1, pool_->max_memory());
+
+  // Destroying the pool returns the cached memory
+  pool_.reset();
+  ASSERT_EQ(0, backend_.bytes_allocated());
+}
+
+TEST_F(TestThreadCachingMemoryPool, Reallocate) {
+  MakePool();
+  uint8_t* data;
+  ASSERT_OK(pool_->Allocate(10, &data));
+  std::memset(data, 42, 10);
+
+  // Within a size class, the block is kept
+  uint8_t* original = data;
+  ASSERT_OK(pool_->Reallocate(10, 64, &data));
+  ASSERT_EQ(original, data);
+  ASSERT_EQ(64, pool_->bytes_allocated());
+  ASSERT_EQ(64, backend_.bytes_allocated());
+
+  // Across size classes and to uncached sizes, the contents are preserved
+  const int64_t large_size = options_.max_cached_size * 2;
+  for (int64_t new_size : {int64_t(300), int64_t(5000), large_size, large_size * 2,
+                           int64_t(100), int64_t(10)}) {
+    const int64_t old_size = pool_->bytes_allocated();
+    ASSERT_OK(pool_->Reallocate(old_size, new_size, &data));
+    ASSERT_EQ(new_size, pool_->bytes_allocated());
+    for (int i = 0; i < 10; ++i) {
+      ASSERT_EQ(data[i], 42);
+    }
+    std::memset(data, 42, static_cast<size_t>(new_size));
+  }
+  pool_->Free(data, 10);
+  ASSERT_EQ(0, pool_->bytes_allocated());
+  pool_.reset();
+  ASSERT_EQ(0, backend_.bytes_allocated());
+}
+
+TEST_F(TestThreadCachingMemoryPool, CrossThreadFree) {
+  MakePool();
+  const int num_blocks = 20;
+  std::vector<uint8_t*> blocks(num_blocks);
+  for (auto& block : blocks) {
+    ASSERT_OK(pool_->Allocate(64, &block));
+  }
+  ASSERT_EQ(num_blocks * 64, backend_.bytes_allocated());
+
+  // The freeing thread caches a few blocks and shares the others, then shares
+  // its cache when exiting
+  std::thread thread([&] {
+    for (auto block : blocks) {
+      pool_->Free(block, 64);
+    }
+    ASSERT_EQ(0, pool_->bytes_allocated());
+  });
+  thread.join();
+  ASSERT_EQ(num_blocks * 64, pool_->bytes_cached());
+
+  // This thread takes them back, without allocating from the backend
+  for (auto& block : blocks) {
+    ASSERT_OK(pool_->Allocate(64, &block));
+  }
+  ASSERT_EQ(num_blocks * 64, backend_.bytes_allocated());
+  ASSERT_EQ(0, pool_->bytes_cached());
+  for (auto block : blocks) {
+    pool_->Free(block, 64);
+  }
+
+  // Beyond the shared cache capacity, blocks go back to the backend
+  options_.shared_cache_size_per_class = 64 * 5;
+  MakePool();
+  for (auto& block : blocks) {
+    ASSERT_OK(pool_->Allocate(64, &block));
+  }
+  thread = std::thread([&] {
+    for (auto block : blocks) {
+      pool_->Free(block, 64);
+    }
+  });
+  thread.join();
+  ASSERT_EQ(5 * 64, pool_->bytes_cached());
+  ASSERT_EQ(5 * 64, backend_.bytes_allocated());
+  pool_.reset();
+  ASSERT_EQ(0, backend_.bytes_allocated());
+}
+
+TEST_F(TestThreadCachingMemoryPool, ThreadSafety) {
+  MakePool();
+  const int num_threads = 8;
+  const int num_iterations = 20000;
+  // Blocks allocated by one thread and freed by the next
+  std::vector<std::vector<std::pair<uint8_t*, int64_t>>> handoffs(num_threads);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < num_threads; ++i) {
+    threads.emplace_back([&, i] {
+      std::mt19937 rng(i);
+      std::uniform_int_distribution<int64_t> size_dist(1, 2 * options_.max_cached_size);
+      std::vector<std::pair<uint8_t*, int64_t>> live;
+      for (int j = 0; j < num_iterations; ++j) {
+        if (live.size() < 50 && rng() % 2 == 0) {
+          const int64_t size = rng() % 4 == 0 ? size_dist(rng) : size_dist(rng) % 512 + 1;
+          uint8_t* data;
+          ASSERT_OK(pool_->Allocate(size, &data));
+          data[0] = data[size - 1] = static_cast<uint8_t>(i);
+          live.emplace_back(data, size);
+        } else if (!live.empty()) {
+          auto block = live.back();
+          live.pop_back();
+          ASSERT_EQ(block.first[0], static_cast<uint8_t>(i));
+          ASSERT_EQ(block.first[block.second - 1], static_cast<uint8_t>(i));
+          if (rng() % 2 == 0) {
+            const int64_t new_size = size_dist(rng) % 2048 + 1;
+            ASSERT_OK(pool_->Reallocate(block.second, new_size, &block.first));
+            block.first[new_size - 1] = static_cast<uint8_t>(i);
+            block.second = new_size;
+          }
+          pool_->Free(block.first, block.second);
+        }
+      }
+      handoffs[i] = std::move(live);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  threads.clear();
+  for (int i = 0; i < num_threads; ++i) {
+    threads.emplace_back([&, i] {
+      for (auto block : handoffs[(i + 1) % num_threads]) {
+        pool_->Free(block.first, block.second);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(0, pool_->bytes_allocated());
+  ASSERT_EQ(pool_->bytes_cached(), backend_.bytes_allocated());
+  pool_.reset();
+  ASSERT_EQ(0, backend_.bytes_allocated());
+}
+
+TEST(LimitedMemoryPool, Limit) {
+  ProxyMemoryPool parent(system_memory_pool());
+  LimitedMemoryPool pool(&parent, 1000);
+  ASSERT_EQ(1000, pool.limit());
+
+  uint8_t* data;
+  ASSERT_OK(pool.Allocate(600, &data));
+  uint8_t* data2;
+  ASSERT_RAISES(OutOfMemory, pool.Allocate(500, &data2));
+  ASSERT_EQ(600, pool.bytes_allocated());
+  ASSERT_EQ(600, parent.bytes_allocated());
+
+  ASSERT_RAISES(OutOfMemory, pool.Reallocate(600, 1001, &data));
+  ASSERT_OK(pool.Reallocate(600, 1000, &data));
+  ASSERT_OK(pool.Reallocate(1000, 200, &data));
+  ASSERT_EQ(200, pool.bytes_allocated());
+  ASSERT_EQ(1000, pool.max_memory());
+
+  pool.set_limit(100);
+  ASSERT_RAISES(OutOfMemory, pool.Allocate(1, &data2));
+  pool.Free(data, 200);
+  ASSERT_OK(pool.Allocate(100, &data2));
+  pool.Free(data2, 100);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(0, parent.bytes_allocated());
+}
+
+TEST(LimitedMemoryPool, ReleaseCallbacks) {
+  LimitedMemoryPool pool(system_memory_pool(), 1000);
+
+  // A cache giving its block back when asked
+  uint8_t* cached;
+  ASSERT_OK(pool.Allocate(600, &cached));
+  std::vector<int64_t> requests;
+  auto id = pool.AddReleaseCallback([&](int64_t nbytes) -> int64_t {
+    requests.push_back(nbytes);
+    if (cached == nullptr) {
+      return 0;
+    }
+    pool.Free(cached, 600);
+    cached = nullptr;
+    return 600;
+  });
+
+  uint8_t* data;
+  ASSERT_OK(pool.Allocate(300, &data));
+  ASSERT_EQ(0, requests.size());
+  // 600 + 300 + 200 exceeds the limit by 100
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(200, &data2));
+  ASSERT_EQ(std::vector<int64_t>{100}, requests);
+  ASSERT_EQ(nullptr, cached);
+  ASSERT_EQ(500, pool.bytes_allocated());
+
+  // Nothing left to release
+  uint8_t* data3;
+  ASSERT_RAISES(OutOfMemory, pool.Allocate(600, &data3));
+  ASSERT_EQ(2, requests.size());
+  ASSERT_EQ(100, requests[1]);
+
+  pool.RemoveReleaseCallback(id);
+  ASSERT_RAISES(OutOfMemory, pool.Allocate(600, &data3));
+  ASSERT_EQ(2, requests.size());
+
+  ASSERT_EQ(0, pool.ReleaseMemory(100));
+  pool.Free(data, 300);
+  pool.Free(data2, 200);
+}
+
+TEST(LimitedMemoryPool, AllocateFromCallback) {
+  LimitedMemoryPool pool(system_memory_pool(), 1000);
+  uint8_t* data;
+  ASSERT_OK(pool.Allocate(900, &data));
+
+  // E.g. a spilling operator needing a write buffer: the nested allocation
+  // doesn't call the callbacks again
+  int num_calls = 0;
+  pool.AddReleaseCallback([&](int64_t) -> int64_t {
+    ++num_calls;
+    uint8_t* scratch;
+    EXPECT_TRUE(pool.Allocate(50, &scratch).ok());
+    EXPECT_TRUE(pool.Allocate(100, &scratch).IsOutOfMemory());
+    pool.Free(scratch, 50);
+    pool.Free(data, 900);
+    return 900;
+  });
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(500, &data2));
+  ASSERT_EQ(1, num_calls);
+  pool.Free(data2, 500);
+  ASSERT_EQ(0, pool.bytes_allocated());
+}
+
+TEST(LimitedMemoryPool, Hierarchy) {
+  ProxyMemoryPool process(system_memory_pool());
+  LimitedMemoryPool tenant(&process, 1000);
+  std::unique_ptr<LimitedMemoryPool> query1(new LimitedMemoryPool(&tenant, 800));
+  // Children may have a larger limit than their parent
+  LimitedMemoryPool query2(&tenant, 1200);
+
+  uint8_t* data1;
+  ASSERT_OK(query1->Allocate(700, &data1));
+  ASSERT_EQ(700, tenant.bytes_allocated());
+  ASSERT_EQ(700, process.bytes_allocated());
+
+  std::vector<std::string> calls;
+  tenant.AddReleaseCallback([&](int64_t) -> int64_t {
+    calls.push_back("tenant");
+    return 0;
+  });
+  query1->AddReleaseCallback([&](int64_t nbytes) -> int64_t {
+    calls.push_back("query1");
+    EXPECT_EQ(100, nbytes);
+    if (data1 == nullptr) {
+      return 0;
+    }
+    query1->Free(data1, 700);
+    data1 = nullptr;
+    return 700;
+  });
+
+  // Within query2's limit, but not within the tenant's: query1 spills
+  uint8_t* data2;
+  ASSERT_OK(query2.Allocate(400, &data2));
+  ASSERT_EQ((std::vector<std::string>{"tenant", "query1"}), calls);
+  ASSERT_EQ(0, query1->bytes_allocated());
+  ASSERT_EQ(400, tenant.bytes_allocated());
+
+  // Destroyed children aren't asked anymore
+  query1.reset();
+  calls.clear();
+  uint8_t* data3;
+  ASSERT_RAISES(OutOfMemory, query2.Allocate(700, &data3));
+  ASSERT_EQ(std::vector<std::string>{"tenant"}, calls);
+
+  query2.Free(data2, 400);
+  ASSERT_EQ(0, tenant.bytes_allocated());
+  ASSERT_EQ(0, process.bytes_allocated());
+}
+
+TEST(LimitedMemoryPool, ThreadSafety) {
+  // Each thread holds up to 20 KiB, so the limit is hit even without overlap
+  const int64_t limit = 16 * 1024;
+  LimitedMemoryPool tenant(system_memory_pool(), limit);
+  LimitedMemoryPool query(&tenant, limit);
+  std::atomic<int64_t> num_failures(0);
+  const int num_threads = 8;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < num_threads; ++i) {
+    threads.emplace_back([&, i] {
+      MemoryPool* pool = i % 2 == 0 ? static_cast<MemoryPool*>(&tenant) : &query;
+      std::vector<uint8_t*> live;
+      for (int j = 0; j < 5000; ++j) {
+        if (live.size() < 20 && j % 3 != 2) {
+          uint8_t* data;
+          if (pool->Allocate(1024, &data).ok()) {
+            live.push_back(data);
+          } else {
+            ++num_failures;
+          }
+        } else if (!live.empty()) {
+          pool->Free(live.back(), 1024);
+          live.pop_back();
+        }
+        ASSERT_LE(tenant.bytes_allocated(), limit);
+      }
+      for (auto data : live) {
+        pool->Free(data, 1024);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_GT(num_failures.load(), 0);
+  ASSERT_LE(tenant.max_memory(), limit);
+  ASSERT_EQ(0, tenant.bytes_allocated());
+  ASSERT_EQ(0, query.bytes_allocated());
+}
+
+class TestHugePageMemoryPool : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUp() override {
+    options_.threshold = 1 << 16;
+    options_.explicit_huge_pages = GetParam();
+    options_.numa_local = true;
+  }
+
+ protected:
+  HugePageMemoryPoolOptions options_;
+  ProxyMemoryPool backend_{system_memory_pool()};
+};
+
+TEST_P(TestHugePageMemoryPool, Basics) {
+  HugePageMemoryPool pool(&backend_, options_);
+
+  uint8_t* small;
+  ASSERT_OK(pool.Allocate(100, &small));
+  ASSERT_EQ(100, backend_.bytes_allocated());
+  ASSERT_EQ(0, pool.bytes_mapped());
+
+  const int64_t size = 3 << 20;
+  uint8_t* data;
+  ASSERT_OK(pool.Allocate(size, &data));
+  ASSERT_EQ(size + 100, pool.bytes_allocated());
+  ASSERT_EQ(100, backend_.bytes_allocated());
+#ifdef __linux__
+  ASSERT_GE(pool.bytes_mapped(), size);
+  const int64_t huge_page_size = internal::GetHugePageSize();
+  if (huge_page_size > 0) {
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % huge_page_size);
+  }
+#endif
+  for (int64_t i = 0; i < size; ++i) {
+    data[i] = static_cast<uint8_t>(i % 251);
+  }
+
+  auto check_data = [&](int64_t nbytes) {
+    for (int64_t i = 0; i < nbytes; ++i) {
+      ASSERT_EQ(data[i], static_cast<uint8_t>(i % 251));
+    }
+  };
+  // Grow and shrink the mapping
+  ASSERT_OK(pool.Reallocate(size, 3 * size, &data));
+  check_data(size);
+  ASSERT_OK(pool.Reallocate(3 * size, size / 2, &data));
+  check_data(size / 2);
+  ASSERT_EQ(size / 2 + 100, pool.bytes_allocated());
+  ASSERT_EQ(3 * size + 100, pool.max_memory());
+
+  // Below the threshold
+  ASSERT_OK(pool.Reallocate(size / 2, 1000, &data));
+  check_data(1000);
+  ASSERT_EQ(0, pool.bytes_mapped());
+  ASSERT_EQ(1100, backend_.bytes_allocated());
+  // And back
+  ASSERT_OK(pool.Reallocate(1000, size, &data));
+  check_data(1000);
+  ASSERT_EQ(100, backend_.bytes_allocated());
+
+  pool.Free(data, size);
+  pool.Free(small, 100);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(0, pool.bytes_mapped());
+  ASSERT_EQ(0, backend_.bytes_allocated());
+}
+
+TEST_P(TestHugePageMemoryPool, OOM) {
+  HugePageMemoryPool pool(&backend_, options_);
+  uint8_t* data;
+  ASSERT_RAISES(OutOfMemory,
+                pool.Allocate(std::numeric_limits<int64_t>::max() - 63, &data));
+  ASSERT_OK(pool.Allocate(1 << 20, &data));
+  ASSERT_RAISES(OutOfMemory,
+                pool.Reallocate(1 << 20, std::numeric_limits<int64_t>::max(), &data));
+  pool.Free(data, 1 << 20);
+  ASSERT_EQ(0, pool.bytes_mapped());
+}
+
+INSTANTIATE_TEST_SUITE_P(TransparentHugePages, TestHugePageMemoryPool,
+                         ::testing::Values(false));
+INSTANTIATE_TEST_SUITE_P(ExplicitHugePages, TestHugePageMemoryPool,
+                         ::testing::Values(true));
+
+class TestRecyclingMemoryPool : public ::testing::Test {
+ public:
+  void SetUp() override {
+    options_.min_size = 1024;
+    options_.max_cached_bytes = 16 * 1024;
+  }
+
+  void MakePool() { pool_.reset(new RecyclingMemoryPool(&backend_, options_)); }
+
+ protected:
+  RecyclingMemoryPoolOptions options_;
+  ProxyMemoryPool backend_{system_memory_pool()};
+  std::unique_ptr<RecyclingMemoryPool> pool_;
+};
+
+TEST_F(TestRecyclingMemoryPool, Recycle) {
+  MakePool();
+  // A batch of buffers, as allocated by a streaming reader
+  const std::vector<int64_t> sizes = {4000, 4096, 1000, 8000};
+  std::vector<uint8_t*> batch(sizes.size());
+
+  for (size_t i = 0; i < sizes.size(); ++i) {
+    ASSERT_OK(pool_->Allocate(sizes[i], &batch[i]));
+  }
+  ASSERT_EQ(17096, pool_->bytes_allocated());
+  for (size_t i = 0; i < sizes.size(); ++i) {
+    pool_->Free(batch[i], sizes[i]);
+  }
+  ASSERT_EQ(0, pool_->bytes_allocated());
+  // Small buffers aren't recycled
+  ASSERT_EQ(4032 + 4096 + 8000, pool_->bytes_cached());
+  ASSERT_EQ(pool_->bytes_cached(), backend_.bytes_allocated());
+
+  // The next batch reuses the buffers
+  std::vector<uint8_t*> next_batch(sizes.size());
+  for (size_t i = 0; i < sizes.size(); ++i) {
+    ASSERT_OK(pool_->Allocate(sizes[i], &next_batch[i]));
+  }
+  ASSERT_EQ(3, pool_->num_recycled());
+  ASSERT_EQ(0, pool_->bytes_cached());
+  ASSERT_EQ(batch[0], next_batch[0]);
+  ASSERT_EQ(batch[1], next_batch[1]);
+  ASSERT_EQ(batch[3], next_batch[3]);
+
+  // Sizes rounding to the same capacity are interchangeable
+  pool_->Free(next_batch[0], 4000);
+  uint8_t* data;
+  ASSERT_OK(pool_->Allocate(4030, &data));
+  ASSERT_EQ(next_batch[0], data);
+  ASSERT_EQ(4, pool_->num_recycled());
+  pool_->Free(data, 4030);
+  for (size_t i = 1; i < sizes.size(); ++i) {
+    pool_->Free(next_batch[i], sizes[i]);
+  }
+
+  pool_->ReleaseUnused();
+  ASSERT_EQ(0, pool_->bytes_cached());
+  ASSERT_EQ(0, backend_.bytes_allocated());
+}
+
+TEST_F(TestRecyclingMemoryPool, MaxCachedBytes) {
+  MakePool();
+  std::vector<uint8_t*> buffers(5);
+  for (auto& buffer : buffers) {
+    ASSERT_OK(pool_->Allocate(4096, &buffer));
+  }
+  for (auto buffer : buffers) {
+    pool_->Free(buffer, 4096);
+  }
+  ASSERT_EQ(16 * 1024, pool_->bytes_cached());
+  ASSERT_EQ(16 * 1024, backend_.bytes_allocated());
+
+  // Larger than the cache
+  uint8_t* data;
+  ASSERT_OK(pool_->Allocate(32 * 1024, &data));
+  pool_->Free(data, 32 * 1024);
+  ASSERT_EQ(16 * 1024, pool_->bytes_cached());
+
+  // The cached buffers are freed with the pool
+  pool_.reset();
+  ASSERT_EQ(0, backend_.bytes_allocated());
+}
+
+TEST_F(TestRecyclingMemoryPool, Reallocate) {
+  MakePool();
+  uint8_t* data;
+  ASSERT_OK(pool_->Allocate(100, &data));
+  std::memset(data, 42, 100);
+
+  auto check_data = [&](int64_t nbytes) {
+    for (int64_t i = 0; i < nbytes; ++i) {
+      ASSERT_EQ(data[i], 42);
+    }
+  };
+  // From a non-recycled to a recycled size
+  ASSERT_OK(pool_->Reallocate(100, 2000, &data));
+  check_data(100);
+  std::memset(data, 42, 2000);
+  // Same capacity
+  uint8_t* old_data = data;
+  ASSERT_OK(pool_->Reallocate(2000, 2020, &data));
+  ASSERT_EQ(old_data, data);
+  // Into a cached buffer
+  uint8_t* cached;
+  ASSERT_OK(pool_->Allocate(5000, &cached));
+  pool_->Free(cached, 5000);
+  ASSERT_OK(pool_->Reallocate(2020, 5000, &data));
+  ASSERT_EQ(cached, data);
+  check_data(2000);
+  ASSERT_EQ(1, pool_->num_recycled());
+  // The previous buffer was recycled
+  ASSERT_EQ(2048, pool_->bytes_cached());
+  // Growing without a cached buffer
+  ASSERT_OK(pool_->Reallocate(5000, 9000, &data));
+  check_data(2000);
+  // Beyond the recycled sizes
+  ASSERT_OK(pool_->Reallocate(9000, 20000, &data));
+  check_data(2000);
+  ASSERT_EQ(20000, pool_->bytes_allocated());
+  ASSERT_OK(pool_->Reallocate(20000, 10, &data));
+  check_data(10);
+  ASSERT_EQ(10, pool_->bytes_allocated());
+  pool_->Free(data, 10);
+
+  pool_.reset();
+  ASSERT_EQ(0, backend_.bytes_allocated());
+}
+
+TEST_F(TestRecyclingMemoryPool, ThreadSafety) {
+  options_.max_cached_bytes = 1 << 20;
+  MakePool();
+  const int num_threads = 8;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < num_threads; ++i) {
+    threads.emplace_back([&, i] {
+      for (int j = 0; j < 2000; ++j) {
+        const int64_t size = 1024 * (1 + (i + j) % 4);
+        uint8_t* data;
+        ASSERT_OK(pool_->Allocate(size, &data));
+        data[0] = data[size - 1] = static_cast<uint8_t>(i);
+        ASSERT_EQ(data[0], static_cast<uint8_t>(i));
+        pool_->Free(data, size);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(0, pool_->bytes_allocated());
+  ASSERT_GT(pool_->num_recycled(), 0);
+  ASSERT_EQ(pool_->bytes_cached(), backend_.bytes_allocated());
+}
+
 TEST(Jemalloc, SetDirtyPageDecayMillis) {
   // ARROW-6910
 #ifdef ARROW_JEMALLOC
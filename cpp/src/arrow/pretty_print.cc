@@ -221,6 +221,16 @@ class ArrayPrinter : public PrettyPrinter {
     return Status::OK();
   }
 
+  Status WriteDataValues(const BinaryViewArray& array) {
+    if (array.type_id() == Type::STRING_VIEW) {
+      WriteValues(array,
+                  [&](int64_t i) { (*sink_) << "\"" << array.GetView(i) << "\""; });
+    } else {
+      WriteValues(array, [&](int64_t i) { (*sink_) << HexEncode(array.GetView(i)); });
+    }
+    return Status::OK();
+  }
+
   Status WriteDataValues(const Decimal128Array& array) {
     WriteValues(array, [&](int64_t i) { (*sink_) << array.FormatValue(i); });
     return Status::OK();
@@ -297,6 +307,7 @@ class ArrayPrinter : public PrettyPrinter {
                   std::is_base_of<FixedSizeBinaryArray, T>::value ||
                   std::is_base_of<BinaryArray, T>::value ||
                   std::is_base_of<LargeBinaryArray, T>::value ||
+                  std::is_base_of<BinaryViewArray, T>::value ||
                   std::is_base_of<ListArray, T>::value ||
                   std::is_base_of<LargeListArray, T>::value ||
                   std::is_base_of<MapArray, T>::value ||
@@ -380,6 +391,22 @@ class ArrayPrinter : public PrettyPrinter {
     return PrettyPrint(*array.indices(), indent_ + options_.indent_size, sink_);
   }
 
+  Status Visit(const RunEndEncodedArray& array) {
+    // Only print the runs overlapping the logical range of the array
+    const int64_t physical_offset = array.FindPhysicalOffset();
+    const int64_t physical_length = array.FindPhysicalLength();
+
+    Newline();
+    Write("-- run_ends:\n");
+    RETURN_NOT_OK(PrettyPrint(*array.run_ends()->Slice(physical_offset, physical_length),
+                              indent_ + options_.indent_size, sink_));
+
+    Newline();
+    Write("-- values:\n");
+    return PrettyPrint(*array.values()->Slice(physical_offset, physical_length),
+                       indent_ + options_.indent_size, sink_);
+  }
+
   Status Print(const Array& array) {
     RETURN_NOT_OK(VisitArrayInline(array, this));
     Flush();
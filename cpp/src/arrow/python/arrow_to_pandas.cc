@@ -628,6 +628,55 @@ inline Status ConvertAsPyObjects(const PandasOptions& options, const ChunkedArra
   return Status::OK();
 }
 
+// Deduplicating conversion of binary-like values to Python objects. The values
+// are hashed without holding the GIL, which is then only taken to create one
+// object per distinct value and fill out_values with references to them.
+template <typename Type>
+inline Status ConvertBinaryLikeDeduplicated(const ChunkedArray& data,
+                                            PyObject** out_values) {
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+
+  // TODO(fsaintjacques): propagate memory pool.
+  ::arrow::internal::ScalarMemoTable<util::string_view> memo_table(default_memory_pool());
+  std::vector<util::string_view> unique_values;
+  std::vector<int32_t> indices(static_cast<size_t>(data.length()));
+  int64_t position = 0;
+  for (int c = 0; c < data.num_chunks(); c++) {
+    const auto& arr = checked_cast<const ArrayType&>(*data.chunk(c));
+    const bool has_nulls = arr.null_count() > 0;
+    for (int64_t i = 0; i < arr.length(); ++i, ++position) {
+      if (has_nulls && arr.IsNull(i)) {
+        indices[position] = -1;
+        continue;
+      }
+      const util::string_view value = arr.GetView(i);
+      int32_t memo_index;
+      RETURN_NOT_OK(memo_table.GetOrInsert(value, &memo_index));
+      if (memo_index == static_cast<int32_t>(unique_values.size())) {
+        unique_values.push_back(value);
+      }
+      indices[position] = memo_index;
+    }
+  }
+
+  PyAcquireGIL lock;
+  std::vector<OwnedRef> unique_objects(unique_values.size());
+  for (size_t i = 0; i < unique_values.size(); ++i) {
+    const util::string_view& value = unique_values[i];
+    unique_objects[i].reset(WrapBytes<Type>::Wrap(value.data(), value.length()));
+    if (unique_objects[i].obj() == nullptr) {
+      PyErr_Clear();
+      return Status::UnknownError("Wrapping ", value, " failed");
+    }
+  }
+  for (const int32_t index : indices) {
+    PyObject* value = index < 0 ? Py_None : unique_objects[index].obj();
+    Py_INCREF(value);
+    *out_values++ = value;
+  }
+  return Status::OK();
+}
+
 inline Status ConvertStruct(const PandasOptions& options, const ChunkedArray& data,
                             PyObject** out_values) {
   if (data.num_chunks() == 0) {
@@ -1049,9 +1098,25 @@ class ObjectWriter : public TypedPandasWriter<NPY_OBJECT> {
  public:
   using TypedPandasWriter<NPY_OBJECT>::TypedPandasWriter;
   Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement) override {
+    PyObject** out_values = this->GetBlockColumnStart(rel_placement);
+    if (this->options_.deduplicate_objects) {
+      switch (data->type()->id()) {
+        case Type::STRING:
+          return ConvertBinaryLikeDeduplicated<StringType>(*data, out_values);
+        case Type::LARGE_STRING:
+          return ConvertBinaryLikeDeduplicated<LargeStringType>(*data, out_values);
+        case Type::BINARY:
+          return ConvertBinaryLikeDeduplicated<BinaryType>(*data, out_values);
+        case Type::LARGE_BINARY:
+          return ConvertBinaryLikeDeduplicated<LargeBinaryType>(*data, out_values);
+        case Type::FIXED_SIZE_BINARY:
+          return ConvertBinaryLikeDeduplicated<FixedSizeBinaryType>(*data, out_values);
+        default:
+          break;
+      }
+    }
     PyAcquireGIL lock;
-    ObjectWriterVisitor visitor{this->options_, *data,
-                                this->GetBlockColumnStart(rel_placement)};
+    ObjectWriterVisitor visitor{this->options_, *data, out_values};
     return VisitTypeInline(*data->type(), &visitor);
   }
 };
@@ -2010,19 +2075,27 @@ class SplitBlockCreator : public PandasBlockCreator {
   }
 
   Status Convert(PyObject** out) override {
+    writers_.resize(num_columns_);
+    for (int i = 0; i < num_columns_; ++i) {
+      RETURN_NOT_OK(GetWriter(i, &writers_[i]));
+    }
+
+    // Each column has its own block, so the columns can be written in
+    // parallel. The writers only take the GIL to create Python objects.
+    auto WriteColumn = [this](int i) {
+      // ARROW-3789 Use std::move on the array to permit self-destructing
+      return writers_[i]->Write(std::move(arrays_[i]), i, /*rel_placement=*/0);
+    };
+    RETURN_NOT_OK(OptionalParallelFor(options_.use_threads, num_columns_, WriteColumn));
+
     PyAcquireGIL lock;
 
     PyObject* result = PyList_New(0);
     RETURN_IF_PYERROR();
 
     for (int i = 0; i < num_columns_; ++i) {
-      std::shared_ptr<PandasWriter> writer;
-      RETURN_NOT_OK(GetWriter(i, &writer));
-      // ARROW-3789 Use std::move on the array to permit self-destructing
-      RETURN_NOT_OK(writer->Write(std::move(arrays_[i]), i, /*rel_placement=*/0));
-
       PyObject* item;
-      RETURN_NOT_OK(writer->GetDataFrameResult(&item));
+      RETURN_NOT_OK(writers_[i]->GetDataFrameResult(&item));
       if (PyList_Append(result, item) < 0) {
         RETURN_IF_PYERROR();
       }
@@ -204,6 +204,13 @@ struct PyBytesView {
   }
 
   Status FromUnicode(PyObject* obj) {
+    if (PyUnicode_IS_COMPACT_ASCII(obj)) {
+      // ASCII strings are stored inline and are already valid utf-8
+      this->bytes = reinterpret_cast<const char*>(PyUnicode_DATA(obj));
+      this->size = PyUnicode_GET_LENGTH(obj);
+      this->ref.reset();
+      return Status::OK();
+    }
     Py_ssize_t size;
     // The utf-8 representation is cached on the unicode object
     const char* data = PyUnicode_AsUTF8AndSize(obj, &size);
@@ -1031,7 +1031,26 @@ class StructConverter : public TypedConverter<StructType, null_coding> {
   // Append a missing item
   Status AppendNull() override { return this->typed_builder_->AppendNull(); }
 
+  Status Extend(PyObject* obj, int64_t size) override {
+    RETURN_NOT_OK(ReserveFields(size));
+    return TypedConverter<StructType, null_coding>::Extend(obj, size);
+  }
+
+  Status ExtendMasked(PyObject* obj, PyObject* mask, int64_t size) override {
+    RETURN_NOT_OK(ReserveFields(size));
+    return TypedConverter<StructType, null_coding>::ExtendMasked(obj, mask, size);
+  }
+
  protected:
+  // Each struct value appends one item to every child, so the child builders
+  // can be sized along with the parent
+  Status ReserveFields(int64_t size) {
+    for (int i = 0; i < num_fields_; i++) {
+      RETURN_NOT_OK(this->typed_builder_->field_builder(i)->Reserve(size));
+    }
+    return Status::OK();
+  }
+
   Status AppendDictItem(PyObject* obj) {
     if (dict_key_kind_ == DictKeyKind::UNICODE) {
       return AppendDictItemWithUnicodeKeys(obj);
@@ -1132,14 +1151,45 @@ class DecimalConverter : public TypedConverter<arrow::Decimal128Type, null_codin
   std::shared_ptr<DecimalType> decimal_type_;
 };
 
+// Leaf wrapper for the flat converters: the per-item Append() issued by
+// Extend() and ExtendMasked() is resolved statically, so that converting a
+// sequence doesn't go through two virtual calls for every element.
+template <typename ConverterType, NullCoding null_coding>
+class FlatConverter final : public ConverterType {
+ public:
+  using ConverterType::ConverterType;
+
+  Status Append(PyObject* obj) override {
+    return NullChecker<null_coding>::Check(obj) ? ConverterType::AppendNull()
+                                                : ConverterType::AppendValue(obj);
+  }
+
+  Status Extend(PyObject* obj, int64_t size) override {
+    RETURN_NOT_OK(this->typed_builder_->Reserve(size));
+    return internal::VisitSequence(obj, [this](PyObject* item, bool* /* unused */) {
+      return FlatConverter::Append(item);
+    });
+  }
+
+  Status ExtendMasked(PyObject* obj, PyObject* mask, int64_t size) override {
+    RETURN_NOT_OK(this->typed_builder_->Reserve(size));
+    return internal::VisitSequenceMasked(
+        obj, mask, [this](PyObject* item, bool is_masked, bool* /* unused */) {
+          return is_masked ? ConverterType::AppendNull() : FlatConverter::Append(item);
+        });
+  }
+};
+
+template <typename ConverterType, NullCoding null_coding, typename... Args>
+std::unique_ptr<SeqConverter> MakeFlatConverter(Args&&... args) {
+  return std::unique_ptr<SeqConverter>(
+      new FlatConverter<ConverterType, null_coding>(std::forward<Args>(args)...));
+}
+
 #define PRIMITIVE(TYPE_ENUM, TYPE)                                                   \
   case Type::TYPE_ENUM:                                                              \
-    *out = std::unique_ptr<SeqConverter>(new PrimitiveConverter<TYPE, null_coding>); \
-    break;
-
-#define SIMPLE_CONVERTER_CASE(TYPE_ENUM, TYPE_CLASS)                   \
-  case Type::TYPE_ENUM:                                                \
-    *out = std::unique_ptr<SeqConverter>(new TYPE_CLASS<null_coding>); \
+    *out =                                                                           \
+        MakeFlatConverter<PrimitiveConverter<TYPE, null_coding>, null_coding>();     \
     break;
 
 // Dynamic constructor for sequence converters
@@ -1147,7 +1197,9 @@ template <NullCoding null_coding>
 Status GetConverterFlat(const std::shared_ptr<DataType>& type, bool strict_conversions,
                         bool ignore_timezone, std::unique_ptr<SeqConverter>* out) {
   switch (type->id()) {
-    SIMPLE_CONVERTER_CASE(NA, NullConverter);
+    case Type::NA:
+      *out = std::unique_ptr<SeqConverter>(new NullConverter<null_coding>);
+      break;
     PRIMITIVE(BOOL, BooleanType);
     PRIMITIVE(INT8, Int8Type);
     PRIMITIVE(INT16, Int16Type);
@@ -1162,60 +1214,62 @@ Status GetConverterFlat(const std::shared_ptr<DataType>& type, bool strict_conve
     PRIMITIVE(DOUBLE, DoubleType);
     PRIMITIVE(DATE32, Date32Type);
     PRIMITIVE(DATE64, Date64Type);
-    SIMPLE_CONVERTER_CASE(DECIMAL, DecimalConverter);
+    case Type::DECIMAL:
+      *out = MakeFlatConverter<DecimalConverter<null_coding>, null_coding>();
+      break;
     case Type::BINARY:
-      *out =
-          std::unique_ptr<SeqConverter>(new BinaryConverter<BinaryType, null_coding>());
+      *out = MakeFlatConverter<BinaryConverter<BinaryType, null_coding>, null_coding>();
       break;
     case Type::LARGE_BINARY:
-      *out = std::unique_ptr<SeqConverter>(
-          new BinaryConverter<LargeBinaryType, null_coding>());
+      *out =
+          MakeFlatConverter<BinaryConverter<LargeBinaryType, null_coding>, null_coding>();
       break;
     case Type::FIXED_SIZE_BINARY:
-      *out = std::unique_ptr<SeqConverter>(new FixedSizeBinaryConverter<null_coding>(
-          checked_cast<const FixedSizeBinaryType&>(*type).byte_width()));
+      *out = MakeFlatConverter<FixedSizeBinaryConverter<null_coding>, null_coding>(
+          checked_cast<const FixedSizeBinaryType&>(*type).byte_width());
       break;
     case Type::STRING:
       if (strict_conversions) {
-        *out = std::unique_ptr<SeqConverter>(
-            new StringConverter<StringType, true, null_coding>());
+        *out = MakeFlatConverter<StringConverter<StringType, true, null_coding>,
+                                 null_coding>();
       } else {
-        *out = std::unique_ptr<SeqConverter>(
-            new StringConverter<StringType, false, null_coding>());
+        *out = MakeFlatConverter<StringConverter<StringType, false, null_coding>,
+                                 null_coding>();
       }
       break;
     case Type::LARGE_STRING:
       if (strict_conversions) {
-        *out = std::unique_ptr<SeqConverter>(
-            new StringConverter<LargeStringType, true, null_coding>());
+        *out = MakeFlatConverter<StringConverter<LargeStringType, true, null_coding>,
+                                 null_coding>();
       } else {
-        *out = std::unique_ptr<SeqConverter>(
-            new StringConverter<LargeStringType, false, null_coding>());
+        *out = MakeFlatConverter<StringConverter<LargeStringType, false, null_coding>,
+                                 null_coding>();
       }
       break;
     case Type::TIME32: {
       auto unit = checked_cast<const Time32Type&>(*type).unit();
-      *out = std::unique_ptr<SeqConverter>(
-          new TimeConverter<Time32Type, null_coding>(unit, ignore_timezone));
+      *out = MakeFlatConverter<TimeConverter<Time32Type, null_coding>, null_coding>(
+          unit, ignore_timezone);
       break;
     }
     case Type::TIME64: {
       auto unit = checked_cast<const Time64Type&>(*type).unit();
-      *out = std::unique_ptr<SeqConverter>(
-          new TimeConverter<Time64Type, null_coding>(unit, ignore_timezone));
+      *out = MakeFlatConverter<TimeConverter<Time64Type, null_coding>, null_coding>(
+          unit, ignore_timezone);
       break;
     }
     case Type::TIMESTAMP: {
       auto unit = checked_cast<const TimestampType&>(*type).unit();
-      *out = std::unique_ptr<SeqConverter>(
-          new TemporalConverter<TimestampType, null_coding>(unit, ignore_timezone));
+      *out =
+          MakeFlatConverter<TemporalConverter<TimestampType, null_coding>, null_coding>(
+              unit, ignore_timezone);
       break;
     }
     case Type::DURATION: {
       auto unit = checked_cast<const DurationType&>(*type).unit();
       *out =
-          std::unique_ptr<SeqConverter>(new TemporalConverter<DurationType, null_coding>(
-              unit, /*ignore_timezone=*/false));
+          MakeFlatConverter<TemporalConverter<DurationType, null_coding>, null_coding>(
+              unit, /*ignore_timezone=*/false);
       break;
     }
     default:
@@ -29,10 +29,13 @@
 #include "arrow/pretty_print.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/util/atomic_shared_ptr.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/vector.h"
 
 namespace arrow {
@@ -234,6 +237,51 @@ std::shared_ptr<RecordBatch> RecordBatch::Slice(int64_t offset) const {
   return Slice(offset, this->num_rows() - offset);
 }
 
+Result<std::shared_ptr<RecordBatch>> RecordBatch::CopyTo(
+    const std::shared_ptr<MemoryManager>& to) const {
+  ArrayDataVector copied_columns;
+  copied_columns.reserve(num_columns());
+  for (const auto& column : column_data()) {
+    ARROW_ASSIGN_OR_RAISE(auto copied, column->CopyTo(to));
+    copied_columns.push_back(std::move(copied));
+  }
+  return Make(schema_, num_rows_, std::move(copied_columns));
+}
+
+Result<std::shared_ptr<RecordBatch>> RecordBatch::ViewOrCopyTo(
+    const std::shared_ptr<MemoryManager>& to) const {
+  ArrayDataVector new_columns;
+  new_columns.reserve(num_columns());
+  for (const auto& column : column_data()) {
+    ARROW_ASSIGN_OR_RAISE(auto new_column, column->ViewOrCopyTo(to));
+    new_columns.push_back(std::move(new_column));
+  }
+  return Make(schema_, num_rows_, std::move(new_columns));
+}
+
+Result<std::shared_ptr<Tensor>> RecordBatch::ToTensor(MemoryPool* pool) const {
+  return ToTensor(RecordBatchToTensorOptions::Defaults(), pool);
+}
+
+Result<std::shared_ptr<Tensor>> RecordBatch::ToTensor(
+    const RecordBatchToTensorOptions& options, MemoryPool* pool) const {
+  ARROW_ASSIGN_OR_RAISE(auto type, RecordBatchTensorType(*this, options));
+  if (!is_tensor_supported(type->id())) {
+    return Status::TypeError("Cannot convert a record batch to a Tensor of ",
+                             type->ToString());
+  }
+  const int64_t byte_width =
+      internal::checked_cast<const FixedWidthType&>(*type).bit_width() / 8;
+  const int64_t row_stride =
+      options.row_stride == 0 ? num_columns() * byte_width : options.row_stride;
+  ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateBuffer(num_rows_ * row_stride, pool));
+  RETURN_NOT_OK(
+      RecordBatchToRowMajor(*this, options, buffer->mutable_data(), buffer->size()));
+  return std::make_shared<Tensor>(type, std::move(buffer),
+                                  std::vector<int64_t>{num_rows_, num_columns()},
+                                  std::vector<int64_t>{row_stride, byte_width});
+}
+
 std::string RecordBatch::ToString() const {
   std::stringstream ss;
   ARROW_CHECK_OK(PrettyPrint(*this, 0, &ss));
@@ -258,13 +306,13 @@ Status RecordBatch::Validate() const {
   return Status::OK();
 }
 
-Status RecordBatch::ValidateFull() const {
+Status RecordBatch::ValidateFull() const { return ValidateFull(/*use_threads=*/false); }
+
+Status RecordBatch::ValidateFull(bool use_threads) const {
   RETURN_NOT_OK(Validate());
-  for (int i = 0; i < num_columns(); ++i) {
-    const auto& array = *this->column(i);
-    RETURN_NOT_OK(internal::ValidateArrayData(array));
-  }
-  return Status::OK();
+  return internal::OptionalParallelFor(use_threads, num_columns(), [this](int i) {
+    return internal::ValidateArrayData(*column(i));
+  });
 }
 
 // ----------------------------------------------------------------------
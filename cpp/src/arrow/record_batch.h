@@ -30,6 +30,8 @@
 
 namespace arrow {
 
+struct RecordBatchToTensorOptions;
+
 /// \class RecordBatch
 /// \brief Collection of equal-length arrays matching a particular Schema
 ///
@@ -158,6 +160,32 @@ class ARROW_EXPORT RecordBatch {
   /// \return new record batch
   virtual std::shared_ptr<RecordBatch> Slice(int64_t offset, int64_t length) const = 0;
 
+  /// \brief Copy the buffers of all columns to the given MemoryManager
+  ///
+  /// This supports cross-device copies, e.g. from host to CUDA memory.
+  Result<std::shared_ptr<RecordBatch>> CopyTo(
+      const std::shared_ptr<MemoryManager>& to) const;
+
+  /// \brief Like CopyTo, but view buffers on the destination device without
+  /// copying them when possible
+  Result<std::shared_ptr<RecordBatch>> ViewOrCopyTo(
+      const std::shared_ptr<MemoryManager>& to) const;
+
+  /// \brief Convert the record batch to a row-major Tensor of shape
+  /// {num_rows, num_columns}, e.g. to feed features to ML libraries.
+  ///
+  /// All the columns must be of numeric types and have no nulls.  They are
+  /// converted to their common type, see RecordBatchToTensorOptions.
+  Result<std::shared_ptr<Tensor>> ToTensor(
+      MemoryPool* pool = default_memory_pool()) const;
+
+  /// \brief Convert the record batch to a row-major Tensor of shape
+  /// {num_rows, num_columns}, with the given type promotion, null filling and
+  /// row stride.  Use RecordBatchToRowMajor to write into existing memory.
+  Result<std::shared_ptr<Tensor>> ToTensor(
+      const RecordBatchToTensorOptions& options,
+      MemoryPool* pool = default_memory_pool()) const;
+
   /// \return PrettyPrint representation suitable for debugging
   std::string ToString() const;
 
@@ -177,6 +205,12 @@ class ARROW_EXPORT RecordBatch {
   /// \return Status
   virtual Status ValidateFull() const;
 
+  /// \brief Perform extensive validation checks, validating the columns in
+  /// parallel on the CPU thread pool if use_threads is true.
+  ///
+  /// \return Status
+  Status ValidateFull(bool use_threads) const;
+
  protected:
   RecordBatch(const std::shared_ptr<Schema>& schema, int64_t num_rows);
 
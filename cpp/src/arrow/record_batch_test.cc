@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cmath>
 #include <cstdint>
 #include <memory>
 #include <vector>
@@ -29,6 +30,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/tensor.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
@@ -97,6 +99,20 @@ TEST_F(TestRecordBatch, Validate) {
   ASSERT_RAISES(Invalid, b3->ValidateFull());
 }
 
+TEST_F(TestRecordBatch, ValidateFullUseThreads) {
+  auto schema = ::arrow::schema({field("f0", utf8()), field("f1", utf8())});
+  auto valid = ArrayFromJSON(utf8(), R"(["ab", "c", "def"])");
+  auto invalid = StringArrayWithInvalidOffsets();
+
+  auto batch = RecordBatch::Make(schema, 3, {valid, valid});
+  ASSERT_OK(batch->ValidateFull(/*use_threads=*/true));
+
+  batch = RecordBatch::Make(schema, 3, {valid, invalid});
+  ASSERT_OK(batch->Validate());
+  ASSERT_RAISES(Invalid, batch->ValidateFull(/*use_threads=*/false));
+  ASSERT_RAISES(Invalid, batch->ValidateFull(/*use_threads=*/true));
+}
+
 TEST_F(TestRecordBatch, Slice) {
   const int length = 7;
 
@@ -249,4 +265,108 @@ TEST_F(TestRecordBatch, FromStructArrayInvalidNullCount) {
   ASSERT_RAISES(Invalid, RecordBatch::FromStructArray(struct_array));
 }
 
+TEST_F(TestRecordBatch, ToTensor) {
+  std::shared_ptr<Array> a0, a1, a2;
+  ArrayFromVector<Int32Type, int32_t>({1, 2, 3}, &a0);
+  ArrayFromVector<Int32Type, int32_t>({4, 5, 6}, &a1);
+  ArrayFromVector<FloatType, float>({0.5, 1.5, 2.5}, &a2);
+  auto schema = ::arrow::schema(
+      {field("f0", int32()), field("f1", int32()), field("f2", float32())});
+
+  auto batch = RecordBatch::Make(::arrow::schema({schema->field(0), schema->field(1)}),
+                                 3, {a0, a1});
+  ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor());
+  ASSERT_TRUE(tensor->type()->Equals(int32()));
+  ASSERT_EQ(tensor->shape(), std::vector<int64_t>({3, 2}));
+  ASSERT_TRUE(tensor->is_row_major());
+  const std::vector<int32_t> expected_int32 = {1, 4, 2, 5, 3, 6};
+  Tensor expected(int32(), Buffer::Wrap(expected_int32), {3, 2});
+  ASSERT_TRUE(tensor->Equals(expected));
+
+  // Mixed integer and floating point columns are promoted to float64
+  batch = RecordBatch::Make(schema, 3, {a0, a1, a2});
+  ASSERT_OK_AND_ASSIGN(tensor, batch->ToTensor());
+  ASSERT_TRUE(tensor->type()->Equals(float64()));
+  ASSERT_EQ(tensor->Value<DoubleType>({1, 2}), 1.5);
+  ASSERT_EQ(tensor->Value<DoubleType>({2, 0}), 3.0);
+
+  // Explicit output type
+  auto options = RecordBatchToTensorOptions::Defaults();
+  options.type = float32();
+  ASSERT_OK_AND_ASSIGN(tensor, batch->ToTensor(options));
+  ASSERT_TRUE(tensor->type()->Equals(float32()));
+  ASSERT_EQ(tensor->Value<FloatType>({0, 1}), 4.0f);
+
+  // Padded rows
+  options.row_stride = 16;
+  ASSERT_OK_AND_ASSIGN(tensor, batch->ToTensor(options));
+  ASSERT_EQ(tensor->strides(), std::vector<int64_t>({16, 4}));
+  ASSERT_EQ(tensor->Value<FloatType>({2, 2}), 2.5f);
+  options.row_stride = 10;
+  ASSERT_RAISES(Invalid, batch->ToTensor(options));
+
+  std::shared_ptr<Array> strings;
+  ArrayFromVector<StringType, std::string>({"a", "b", "c"}, &strings);
+  batch = RecordBatch::Make(::arrow::schema({field("f0", int32()), field("f1", utf8())}),
+                            3, {a0, strings});
+  ASSERT_RAISES(TypeError, batch->ToTensor());
+}
+
+TEST_F(TestRecordBatch, ToTensorNulls) {
+  std::shared_ptr<Array> a0, a1;
+  ArrayFromVector<Int16Type, int16_t>({true, false, true}, {1, 2, 3}, &a0);
+  ArrayFromVector<DoubleType, double>({false, true, true}, {4, 5, 6}, &a1);
+  auto batch = RecordBatch::Make(
+      ::arrow::schema({field("f0", int16()), field("f1", float64())}), 3, {a0, a1});
+  ASSERT_RAISES(Invalid, batch->ToTensor());
+
+  auto options = RecordBatchToTensorOptions::Defaults();
+  options.fill_nulls = true;
+  options.null_value = NAN;
+  ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor(options));
+  ASSERT_TRUE(tensor->type()->Equals(float64()));
+  ASSERT_EQ(tensor->Value<DoubleType>({0, 0}), 1.0);
+  ASSERT_TRUE(std::isnan(tensor->Value<DoubleType>({0, 1})));
+  ASSERT_TRUE(std::isnan(tensor->Value<DoubleType>({1, 0})));
+  ASSERT_EQ(tensor->Value<DoubleType>({2, 1}), 6.0);
+}
+
+TEST_F(TestRecordBatch, ToRowMajorLarge) {
+  // Several blocks of rows, with sliced columns
+  const int64_t length = 100000;
+  std::vector<bool> is_valid(length + 1);
+  std::vector<int64_t> values0(length + 1);
+  std::vector<uint8_t> values1(length + 1);
+  for (int64_t i = 0; i <= length; ++i) {
+    is_valid[i] = i % 7 != 0;
+    values0[i] = i * 3;
+    values1[i] = static_cast<uint8_t>(i);
+  }
+  std::shared_ptr<Array> a0, a1;
+  ArrayFromVector<Int64Type, int64_t>(is_valid, values0, &a0);
+  ArrayFromVector<UInt8Type, uint8_t>(values1, &a1);
+  auto batch = RecordBatch::Make(
+      ::arrow::schema({field("f0", int64()), field("f1", uint8())}), length,
+      {a0->Slice(1), a1->Slice(1)});
+
+  // Write into caller-provided memory, leaving the last field of each row alone
+  auto options = RecordBatchToTensorOptions::Defaults();
+  options.fill_nulls = true;
+  options.null_value = -1;
+  options.row_stride = 3 * sizeof(int64_t);
+  std::vector<int64_t> out(3 * length, 42);
+  // The padding of the last row may be omitted
+  const int64_t min_size = (3 * length - 1) * sizeof(int64_t);
+  ASSERT_RAISES(Invalid, RecordBatchToRowMajor(
+                             *batch, options, reinterpret_cast<uint8_t*>(out.data()),
+                             min_size - 1));
+  ASSERT_OK(RecordBatchToRowMajor(*batch, options, reinterpret_cast<uint8_t*>(out.data()),
+                                  out.size() * sizeof(int64_t)));
+  for (int64_t i = 0; i < length; ++i) {
+    ASSERT_EQ(out[3 * i], is_valid[i + 1] ? values0[i + 1] : -1) << i;
+    ASSERT_EQ(out[3 * i + 1], values1[i + 1]) << i;
+    ASSERT_EQ(out[3 * i + 2], 42) << i;
+  }
+}
+
 }  // namespace arrow
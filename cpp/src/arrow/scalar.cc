@@ -83,6 +83,11 @@ struct ScalarHashImpl {
   Status Visit(const DictionaryScalar& s) { return Status::OK(); }
   Status Visit(const ExtensionScalar& s) { return Status::OK(); }
 
+  Status Visit(const RunEndEncodedScalar& s) {
+    AccumulateHashFrom(*s.value);
+    return Status::OK();
+  }
+
   template <typename T>
   Status StdHash(const T& t) {
     static std::hash<T> hash;
@@ -133,6 +138,9 @@ StringScalar::StringScalar(std::string s)
 LargeStringScalar::LargeStringScalar(std::string s)
     : LargeStringScalar(Buffer::FromString(std::move(s))) {}
 
+StringViewScalar::StringViewScalar(std::string s)
+    : StringViewScalar(Buffer::FromString(std::move(s))) {}
+
 FixedSizeBinaryScalar::FixedSizeBinaryScalar(std::shared_ptr<Buffer> value,
                                              std::shared_ptr<DataType> type)
     : BinaryScalar(std::move(value), std::move(type)) {
@@ -242,6 +250,11 @@ Result<std::shared_ptr<Scalar>> DictionaryScalar::GetEncodedValue() const {
   return value.dictionary->GetScalar(index_value);
 }
 
+RunEndEncodedScalar::RunEndEncodedScalar(std::shared_ptr<DataType> type)
+    : Scalar(std::move(type)),
+      value(MakeNullScalar(
+          checked_cast<const RunEndEncodedType&>(*this->type).value_type())) {}
+
 template <typename T>
 using scalar_constructor_has_arrow_type =
     std::is_constructible<typename TypeTraits<T>::ScalarType, std::shared_ptr<DataType>>;
@@ -290,6 +303,9 @@ std::string Scalar::ToString() const {
     return dict_scalar->value.dictionary->ToString() + "[" +
            dict_scalar->value.index->ToString() + "]";
   }
+  if (type->id() == Type::RUN_END_ENCODED) {
+    return checked_cast<const RunEndEncodedScalar*>(this)->value->ToString();
+  }
   auto maybe_repr = CastTo(utf8());
   if (maybe_repr.ok()) {
     return checked_cast<const StringScalar&>(*maybe_repr.ValueOrDie()).value->ToString();
@@ -511,6 +527,12 @@ Status CastImpl(const BinaryScalar& from, StringScalar* to) {
   return Status::OK();
 }
 
+// binary view to string
+Status CastImpl(const BinaryViewScalar& from, StringScalar* to) {
+  to->value = from.value;
+  return Status::OK();
+}
+
 // formattable to string
 template <typename ScalarType, typename T = typename ScalarType::TypeClass,
           typename Formatter = internal::StringFormatter<T>,
@@ -558,6 +580,7 @@ struct FromTypeVisitor : CastImplVisitor {
   Status Visit(const SparseUnionType&) { return NotImplemented(); }
   Status Visit(const DenseUnionType&) { return NotImplemented(); }
   Status Visit(const DictionaryType&) { return NotImplemented(); }
+  Status Visit(const RunEndEncodedType&) { return NotImplemented(); }
   Status Visit(const ExtensionType&) { return NotImplemented(); }
 };
 
@@ -585,6 +608,11 @@ struct ToTypeVisitor : CastImplVisitor {
     return Int32Scalar(0).CastTo(dict_type.index_type()).Value(&out.index);
   }
 
+  Status Visit(const RunEndEncodedType& ree_type) {
+    auto& out = checked_cast<RunEndEncodedScalar*>(out_)->value;
+    return from_.CastTo(ree_type.value_type()).Value(&out);
+  }
+
   Status Visit(const SparseUnionType&) { return NotImplemented(); }
   Status Visit(const DenseUnionType&) { return NotImplemented(); }
   Status Visit(const ExtensionType&) { return NotImplemented(); }
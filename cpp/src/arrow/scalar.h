@@ -262,6 +262,31 @@ struct ARROW_EXPORT LargeStringScalar : public LargeBinaryScalar {
   LargeStringScalar() : LargeStringScalar(large_utf8()) {}
 };
 
+struct ARROW_EXPORT BinaryViewScalar : public BaseBinaryScalar {
+  using BaseBinaryScalar::BaseBinaryScalar;
+  using TypeClass = BinaryViewType;
+
+  BinaryViewScalar(std::shared_ptr<Buffer> value, std::shared_ptr<DataType> type)
+      : BaseBinaryScalar(std::move(value), std::move(type)) {}
+
+  explicit BinaryViewScalar(std::shared_ptr<Buffer> value)
+      : BinaryViewScalar(std::move(value), binary_view()) {}
+
+  BinaryViewScalar() : BinaryViewScalar(binary_view()) {}
+};
+
+struct ARROW_EXPORT StringViewScalar : public BinaryViewScalar {
+  using BinaryViewScalar::BinaryViewScalar;
+  using TypeClass = StringViewType;
+
+  explicit StringViewScalar(std::shared_ptr<Buffer> value)
+      : StringViewScalar(std::move(value), utf8_view()) {}
+
+  explicit StringViewScalar(std::string s);
+
+  StringViewScalar() : StringViewScalar(utf8_view()) {}
+};
+
 struct ARROW_EXPORT FixedSizeBinaryScalar : public BinaryScalar {
   using TypeClass = FixedSizeBinaryType;
 
@@ -434,6 +459,19 @@ struct ARROW_EXPORT DictionaryScalar : public Scalar {
   Result<std::shared_ptr<Scalar>> GetEncodedValue() const;
 };
 
+/// \brief A value of a run-end encoded type, which is the value of its run
+struct ARROW_EXPORT RunEndEncodedScalar : public Scalar {
+  using TypeClass = RunEndEncodedType;
+  using ValueType = std::shared_ptr<Scalar>;
+
+  ValueType value;
+
+  explicit RunEndEncodedScalar(std::shared_ptr<DataType> type);
+
+  RunEndEncodedScalar(std::shared_ptr<Scalar> value, std::shared_ptr<DataType> type)
+      : Scalar(std::move(type), value->is_valid), value(std::move(value)) {}
+};
+
 struct ARROW_EXPORT ExtensionScalar : public Scalar {
   using Scalar::Scalar;
   using TypeClass = ExtensionType;
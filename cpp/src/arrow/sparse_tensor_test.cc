@@ -1203,6 +1203,38 @@ TEST_F(TestSparseCSCMatrix, TestToTensor) {
   ASSERT_TRUE(tensor.Equals(*dense_tensor));
 }
 
+// Large enough to be converted on several threads
+TEST(TestSparseCSXMatrix, LargeMatrixConversion) {
+  const int64_t nrows = 1500;
+  const int64_t ncols = 1000;
+  std::vector<int32_t> values(nrows * ncols, 0);
+  int64_t non_zero_length = 0;
+  for (int64_t i = 0; i < nrows; ++i) {
+    for (int64_t j = 0; j < ncols; ++j) {
+      if ((i * 7 + j) % 13 == 0) {
+        values[i * ncols + j] = static_cast<int32_t>(i + j + 1);
+        ++non_zero_length;
+      }
+    }
+  }
+  auto buffer = Buffer::Wrap(values);
+  // Row-major, and column-major (the transposed matrix)
+  Tensor row_major(int32(), buffer, {nrows, ncols});
+  Tensor column_major(int32(), buffer, {ncols, nrows}, {4, 4 * ncols});
+
+  for (const Tensor* tensor : {&row_major, &column_major}) {
+    ASSERT_OK_AND_ASSIGN(auto csr, SparseCSRMatrix::Make(*tensor, int32()));
+    ASSERT_EQ(non_zero_length, csr->non_zero_length());
+    ASSERT_OK_AND_ASSIGN(auto dense, csr->ToTensor());
+    ASSERT_TRUE(tensor->Equals(*dense));
+
+    ASSERT_OK_AND_ASSIGN(auto csc, SparseCSCMatrix::Make(*tensor, int64()));
+    ASSERT_EQ(non_zero_length, csc->non_zero_length());
+    ASSERT_OK_AND_ASSIGN(dense, csc->ToTensor());
+    ASSERT_TRUE(tensor->Equals(*dense));
+  }
+}
+
 template <typename ValueType>
 class TestSparseCSCMatrixEquality : public TestSparseTensorBase<ValueType> {
  public:
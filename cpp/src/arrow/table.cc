@@ -29,16 +29,22 @@
 #include "arrow/array/array_nested.h"
 #include "arrow/array/concatenate.h"
 #include "arrow/array/util.h"
+#include "arrow/array/validate.h"
+#include "arrow/buffer.h"
 #include "arrow/chunked_array.h"
 #include "arrow/pretty_print.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/vector.h"
 
 namespace arrow {
@@ -271,6 +277,31 @@ std::shared_ptr<Table> Table::Make(std::shared_ptr<Schema> schema,
   return std::make_shared<SimpleTable>(std::move(schema), arrays, num_rows);
 }
 
+Status Table::ValidateFull(bool use_threads) const {
+  if (!use_threads) {
+    return ValidateFull();
+  }
+  RETURN_NOT_OK(Validate());
+  // Validate chunk by chunk rather than column by column, so that tables
+  // with few large columns still use all threads
+  std::vector<std::pair<int, int>> chunk_indices;
+  for (int i = 0; i < num_columns(); ++i) {
+    for (int j = 0; j < column(i)->num_chunks(); ++j) {
+      chunk_indices.emplace_back(i, j);
+    }
+  }
+  return internal::ParallelFor(
+      static_cast<int>(chunk_indices.size()), [&](int k) -> Status {
+        const int i = chunk_indices[k].first;
+        const int j = chunk_indices[k].second;
+        const Status st = internal::ValidateArrayData(*column(i)->chunk(j));
+        if (!st.ok()) {
+          return Status::Invalid("Column ", i, ": In chunk ", j, ": ", st.ToString());
+        }
+        return Status::OK();
+      });
+}
+
 Result<std::shared_ptr<Table>> Table::FromRecordBatchReader(RecordBatchReader* reader) {
   std::shared_ptr<Table> table = nullptr;
   RETURN_NOT_OK(reader->ReadAll(&table));
@@ -537,11 +568,11 @@ bool Table::Equals(const Table& other, bool check_metadata) const {
 Result<std::shared_ptr<Table>> Table::CombineChunks(MemoryPool* pool) const {
   const int ncolumns = num_columns();
   std::vector<std::shared_ptr<ChunkedArray>> compacted_columns(ncolumns);
-  for (int i = 0; i < ncolumns; ++i) {
+  auto combine_column = [&](int i) -> Status {
     const auto& col = column(i);
     if (col->num_chunks() <= 1) {
       compacted_columns[i] = col;
-      continue;
+      return Status::OK();
     }
 
     if (is_binary_like(col->type()->id())) {
@@ -568,10 +599,111 @@ Result<std::shared_ptr<Table>> Table::CombineChunks(MemoryPool* pool) const {
       ARROW_ASSIGN_OR_RAISE(auto compacted, Concatenate(col->chunks(), pool));
       compacted_columns[i] = std::make_shared<ChunkedArray>(compacted);
     }
-  }
+    return Status::OK();
+  };
+
+  // With at least as many columns as threads, combine the columns in parallel.
+  // Otherwise combine them in turn, each concatenation splitting its copies
+  // among the threads.
+  auto thread_pool = internal::GetCpuThreadPool();
+  const bool parallel_columns =
+      ncolumns > 1 && ncolumns >= thread_pool->GetCapacity() &&
+      !thread_pool->OwnsThisThread();
+  RETURN_NOT_OK(
+      internal::OptionalParallelFor(parallel_columns, ncolumns, combine_column));
   return Table::Make(schema(), std::move(compacted_columns));
 }
 
+namespace {
+
+// Interleave the values of a column into a row-major tensor with `ncolumns`
+// columns
+template <typename T>
+void InterleaveColumn(const uint8_t* column_data, int64_t length, int64_t ncolumns,
+                      uint8_t* out) {
+  const auto* values = reinterpret_cast<const T*>(column_data);
+  auto* out_values = reinterpret_cast<T*>(out);
+  for (int64_t i = 0; i < length; ++i) {
+    out_values[i * ncolumns] = values[i];
+  }
+}
+
+}  // namespace
+
+Result<std::shared_ptr<Tensor>> Table::ToTensor(MemoryPool* pool) const {
+  const int ncolumns = num_columns();
+  if (ncolumns == 0) {
+    return Status::Invalid("Cannot convert a table without columns to a Tensor");
+  }
+  const auto& type = schema_->field(0)->type();
+  if (!is_integer(type->id()) && !is_floating(type->id())) {
+    return Status::TypeError("Cannot convert a table with ", type->ToString(),
+                             " columns to a Tensor");
+  }
+  for (int i = 0; i < ncolumns; ++i) {
+    if (!column(i)->type()->Equals(*type)) {
+      return Status::TypeError("All columns must have the same type to convert ",
+                               "a table to a Tensor");
+    }
+    if (column(i)->null_count() > 0) {
+      return Status::Invalid("Cannot convert a table with nulls to a Tensor");
+    }
+  }
+
+  const int byte_width = checked_cast<const FixedWidthType&>(*type).bit_width() / 8;
+  const int64_t nrows = num_rows();
+  ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateBuffer(nrows * ncolumns * byte_width, pool));
+  uint8_t* out = buffer->mutable_data();
+
+  // Each task writes a block of rows, so that the strided writes of the
+  // columns hit the same cache lines
+  constexpr int64_t kRowsPerBlock = 4096;
+  const int num_blocks = static_cast<int>(BitUtil::CeilDiv(nrows, kRowsPerBlock));
+  auto interleave_block = [&](int block) -> Status {
+    const int64_t block_start = block * kRowsPerBlock;
+    const int64_t block_end = std::min(nrows, block_start + kRowsPerBlock);
+    for (int i = 0; i < ncolumns; ++i) {
+      int64_t chunk_start = 0;
+      for (const auto& chunk : column(i)->chunks()) {
+        const int64_t chunk_end = chunk_start + chunk->length();
+        const int64_t start = std::max(chunk_start, block_start);
+        const int64_t end = std::min(chunk_end, block_end);
+        if (start < end) {
+          const auto& data = *chunk->data();
+          const uint8_t* column_data =
+              data.buffers[1]->data() + (data.offset + start - chunk_start) * byte_width;
+          uint8_t* out_data = out + (start * ncolumns + i) * byte_width;
+          switch (byte_width) {
+            case 1:
+              InterleaveColumn<uint8_t>(column_data, end - start, ncolumns, out_data);
+              break;
+            case 2:
+              InterleaveColumn<uint16_t>(column_data, end - start, ncolumns, out_data);
+              break;
+            case 4:
+              InterleaveColumn<uint32_t>(column_data, end - start, ncolumns, out_data);
+              break;
+            default:
+              InterleaveColumn<uint64_t>(column_data, end - start, ncolumns, out_data);
+              break;
+          }
+        }
+        if (chunk_end >= block_end) {
+          break;
+        }
+        chunk_start = chunk_end;
+      }
+    }
+    return Status::OK();
+  };
+
+  auto thread_pool = internal::GetCpuThreadPool();
+  const bool use_threads = num_blocks > 1 && !thread_pool->OwnsThisThread();
+  RETURN_NOT_OK(internal::OptionalParallelFor(use_threads, num_blocks, interleave_block));
+  return std::make_shared<Tensor>(type, std::move(buffer),
+                                  std::vector<int64_t>{nrows, ncolumns});
+}
+
 // ----------------------------------------------------------------------
 // Convert a table to a sequence of record batches
 
@@ -611,7 +743,8 @@ Status TableBatchReader::ReadNext(std::shared_ptr<RecordBatch>* out) {
     chunks[i] = chunk;
   }
 
-  // Slice chunks and advance chunk index as appropriate
+  // Slice chunks and advance chunk index as appropriate. The chunks' data are
+  // sliced directly, without constructing an intermediate Array.
   std::vector<std::shared_ptr<ArrayData>> batch_data(table_.num_columns());
 
   for (int i = 0; i < table_.num_columns(); ++i) {
@@ -624,14 +757,14 @@ Status TableBatchReader::ReadNext(std::shared_ptr<RecordBatch>* out) {
       chunk_offsets_[i] = 0;
       if (offset > 0) {
         // Need to slice
-        slice_data = chunk->Slice(offset, chunksize)->data();
+        slice_data = chunk->data()->Slice(offset, chunksize);
       } else {
         // No slice
         slice_data = chunk->data();
       }
     } else {
       chunk_offsets_[i] += chunksize;
-      slice_data = chunk->Slice(offset, chunksize)->data();
+      slice_data = chunk->data()->Slice(offset, chunksize);
     }
     batch_data[i] = std::move(slice_data);
   }
@@ -187,6 +187,12 @@ class ARROW_EXPORT Table {
   /// \return Status
   virtual Status ValidateFull() const = 0;
 
+  /// \brief Perform extensive validation checks, validating the chunks of all
+  /// columns in parallel on the CPU thread pool if use_threads is true.
+  ///
+  /// \return Status
+  Status ValidateFull(bool use_threads) const;
+
   /// \brief Return the number of columns in the table
   int num_columns() const { return schema_->num_fields(); }
 
@@ -202,12 +208,23 @@ class ARROW_EXPORT Table {
   /// \brief Make a new table by combining the chunks this table has.
   ///
   /// All the underlying chunks in the ChunkedArray of each column are
-  /// concatenated into zero or one chunk.
+  /// concatenated into zero or one chunk. The columns, or the copies of
+  /// large columns, are processed in parallel on the CPU thread pool.
   ///
   /// \param[in] pool The pool for buffer allocations
   Result<std::shared_ptr<Table>> CombineChunks(
       MemoryPool* pool = default_memory_pool()) const;
 
+  /// \brief Convert the table to a row-major Tensor of shape
+  /// {num_rows, num_columns}, e.g. to export features to ML libraries.
+  ///
+  /// All the columns must have the same numeric type and no nulls.  The
+  /// columns are interleaved in parallel on the CPU thread pool.
+  ///
+  /// \param[in] pool The pool for the tensor allocation
+  Result<std::shared_ptr<Tensor>> ToTensor(
+      MemoryPool* pool = default_memory_pool()) const;
+
  protected:
   Table();
 
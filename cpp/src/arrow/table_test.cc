@@ -29,6 +29,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/tensor.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
@@ -126,6 +127,24 @@ TEST_F(TestTable, InvalidColumns) {
   ASSERT_RAISES(Invalid, table_->ValidateFull());
 }
 
+TEST_F(TestTable, ValidateFullUseThreads) {
+  auto schema = ::arrow::schema({field("f0", utf8()), field("f1", utf8())});
+  auto valid = ArrayFromJSON(utf8(), R"(["ab", "c", "def"])");
+  auto invalid = StringArrayWithInvalidOffsets();
+
+  auto valid_column = std::make_shared<ChunkedArray>(ArrayVector{valid, valid});
+  table_ = Table::Make(schema, {valid_column, valid_column});
+  ASSERT_OK(table_->ValidateFull(/*use_threads=*/true));
+
+  auto invalid_column = std::make_shared<ChunkedArray>(ArrayVector{valid, invalid});
+  table_ = Table::Make(schema, {valid_column, invalid_column});
+  ASSERT_OK(table_->Validate());
+  Status st = table_->ValidateFull(/*use_threads=*/false);
+  ASSERT_RAISES(Invalid, st);
+  ASSERT_THAT(st.message(), ::testing::HasSubstr("Column 1: In chunk 1"));
+  ASSERT_EQ(table_->ValidateFull(/*use_threads=*/true).ToString(), st.ToString());
+}
+
 TEST_F(TestTable, AllColumnsAndFields) {
   const int length = 100;
   MakeExample1(length);
@@ -253,6 +272,55 @@ TEST_F(TestTable, CombineChunks) {
   }
 }
 
+TEST_F(TestTable, ToTensor) {
+  auto sch = schema({field("a", int16()), field("b", int16())});
+  auto a = ChunkedArrayFromJSON(int16(), {"[1, 2]", "[3]", "[]", "[4]"});
+  auto b = ChunkedArrayFromJSON(int16(), {"[5]", "[6, 7, 8]"});
+  auto table = Table::Make(sch, {a, b});
+
+  ASSERT_OK_AND_ASSIGN(auto tensor, table->ToTensor());
+  std::vector<int16_t> expected_values = {1, 5, 2, 6, 3, 7, 4, 8};
+  Tensor expected(int16(), Buffer::Wrap(expected_values), {4, 2});
+  ASSERT_TRUE(tensor->Equals(expected));
+  ASSERT_TRUE(tensor->is_row_major());
+
+  // Mismatching types, nulls
+  table = Table::Make(schema({field("a", int16()), field("b", int32())}),
+                      {a, ChunkedArrayFromJSON(int32(), {"[5, 6, 7, 8]"})});
+  ASSERT_RAISES(TypeError, table->ToTensor());
+  table = Table::Make(sch, {a, ChunkedArrayFromJSON(int16(), {"[5, null, 7, 8]"})});
+  ASSERT_RAISES(Invalid, table->ToTensor());
+  table = Table::Make(schema({field("a", utf8())}),
+                      {ChunkedArrayFromJSON(utf8(), {R"(["x"])"})});
+  ASSERT_RAISES(TypeError, table->ToTensor());
+}
+
+TEST_F(TestTable, ToTensorSeveralBlocks) {
+  // Chunks straddling the blocks of rows converted in parallel
+  const int64_t num_rows = 10000;
+  std::vector<int64_t> a_values(num_rows), b_values(num_rows);
+  for (int64_t i = 0; i < num_rows; ++i) {
+    a_values[i] = i;
+    b_values[i] = -i;
+  }
+  std::shared_ptr<Array> a, b;
+  ArrayFromVector<Int64Type>(a_values, &a);
+  ArrayFromVector<Int64Type>(b_values, &b);
+  auto a_chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{a->Slice(0, 4000), a->Slice(4000, 5000), a->Slice(9000)});
+  auto b_chunked = std::make_shared<ChunkedArray>(ArrayVector{b});
+  auto table = Table::Make(schema({field("a", int64()), field("b", int64())}),
+                           {a_chunked, b_chunked});
+
+  ASSERT_OK_AND_ASSIGN(auto tensor, table->ToTensor());
+  ASSERT_EQ(tensor->shape(), std::vector<int64_t>({num_rows, 2}));
+  const auto* data = reinterpret_cast<const int64_t*>(tensor->raw_data());
+  for (int64_t i = 0; i < num_rows; ++i) {
+    ASSERT_EQ(data[2 * i], i);
+    ASSERT_EQ(data[2 * i + 1], -i);
+  }
+}
+
 TEST_F(TestTable, LARGE_MEMORY_TEST(CombineChunksStringColumn)) {
   schema_ = schema({field("str", utf8())});
   arrays_ = {nullptr};
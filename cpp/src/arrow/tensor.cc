@@ -27,11 +27,17 @@
 #include <type_traits>
 #include <vector>
 
+#include "arrow/array/data.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_run_reader.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -285,4 +291,189 @@ Result<int64_t> Tensor::CountNonZero() const {
   return counter.result;
 }
 
+// ----------------------------------------------------------------------
+// RecordBatch to row-major conversion
+
+namespace {
+
+// The size in bytes of the output rows converted together, so that the
+// strided writes of all the columns of a block stay in cache
+constexpr int64_t kRowMajorBlockSize = 1 << 18;
+
+using ConvertColumnFunc = void (*)(const ArrayData& data, int64_t start, int64_t length,
+                                   double null_value, int64_t out_stride, uint8_t* out);
+
+// Write `length` values of a column, starting at `start`, every `out_stride`
+// values of the output
+template <typename InType, typename OutType>
+void ConvertColumn(const ArrayData& data, int64_t start, int64_t length,
+                   double null_value, int64_t out_stride, uint8_t* out) {
+  using InT = typename InType::c_type;
+  using OutT = typename OutType::c_type;
+  const InT* in_values = data.GetValues<InT>(1) + start;
+  auto* out_values = reinterpret_cast<OutT*>(out);
+
+  auto convert_run = [&](int64_t offset, int64_t run_length) {
+    for (int64_t i = offset; i < offset + run_length; ++i) {
+      out_values[i * out_stride] = static_cast<OutT>(in_values[i]);
+    }
+  };
+  if (data.buffers[0] == nullptr || data.GetNullCount() == 0) {
+    convert_run(0, length);
+    return;
+  }
+  const auto fill_value = static_cast<OutT>(null_value);
+  internal::BitRunReader reader(data.buffers[0]->data(), data.offset + start, length);
+  int64_t offset = 0;
+  while (true) {
+    const auto run = reader.NextRun();
+    if (run.length == 0) {
+      break;
+    }
+    if (run.set) {
+      convert_run(offset, run.length);
+    } else {
+      for (int64_t i = offset; i < offset + run.length; ++i) {
+        out_values[i * out_stride] = fill_value;
+      }
+    }
+    offset += run.length;
+  }
+}
+
+template <typename OutType>
+struct ConvertColumnResolver {
+  template <typename InType>
+  enable_if_number<InType, Status> Visit(const InType&) {
+    func = ConvertColumn<InType, OutType>;
+    return Status::OK();
+  }
+
+  Status Visit(const HalfFloatType& type) {
+    return Visit(static_cast<const DataType&>(type));
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::TypeError("Cannot convert a column of type ", type.ToString(),
+                             " to a Tensor");
+  }
+
+  ConvertColumnFunc func = NULLPTR;
+};
+
+struct ConvertFuncResolver {
+  explicit ConvertFuncResolver(const DataType& in_type) : in_type(in_type) {}
+
+  template <typename OutType>
+  enable_if_number<OutType, Status> Visit(const OutType&) {
+    ConvertColumnResolver<OutType> resolver;
+    RETURN_NOT_OK(VisitTypeInline(in_type, &resolver));
+    func = resolver.func;
+    return Status::OK();
+  }
+
+  Status Visit(const HalfFloatType& type) {
+    return Visit(static_cast<const DataType&>(type));
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::TypeError("Cannot convert a record batch to a Tensor of ",
+                             type.ToString());
+  }
+
+  const DataType& in_type;
+  ConvertColumnFunc func = NULLPTR;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<DataType>> RecordBatchTensorType(
+    const RecordBatch& batch, const RecordBatchToTensorOptions& options) {
+  if (options.type != nullptr) {
+    return options.type;
+  }
+  if (batch.num_columns() == 0) {
+    return Status::Invalid("Cannot convert a record batch without columns to a Tensor");
+  }
+  const auto& schema = *batch.schema();
+  const auto& first_type = schema.field(0)->type();
+  bool all_equal = true;
+  bool any_floating = false;
+  bool all_unsigned = true;
+  for (const auto& field : schema.fields()) {
+    const auto& type = *field->type();
+    if (!is_integer(type.id()) && !is_floating(type.id())) {
+      return Status::TypeError("Cannot convert a column of type ", type.ToString(),
+                               " to a Tensor");
+    }
+    all_equal &= type.Equals(*first_type);
+    any_floating |= is_floating(type.id());
+    all_unsigned &= is_integer(type.id()) &&
+                    !checked_cast<const IntegerType&>(type).is_signed();
+  }
+  if (all_equal) {
+    return first_type;
+  } else if (any_floating) {
+    return float64();
+  } else if (all_unsigned) {
+    return uint64();
+  }
+  return int64();
+}
+
+Status RecordBatchToRowMajor(const RecordBatch& batch,
+                             const RecordBatchToTensorOptions& options, uint8_t* out,
+                             int64_t out_size) {
+  ARROW_ASSIGN_OR_RAISE(auto type, RecordBatchTensorType(batch, options));
+  const int ncolumns = batch.num_columns();
+  if (ncolumns == 0) {
+    return Status::Invalid("Cannot convert a record batch without columns to a Tensor");
+  }
+
+  // Resolve the conversion function of each column
+  const ArrayDataVector columns = batch.column_data();
+  std::vector<ConvertColumnFunc> convert_funcs(ncolumns);
+  for (int i = 0; i < ncolumns; ++i) {
+    const auto& data = *columns[i];
+    ConvertFuncResolver resolver(*data.type);
+    RETURN_NOT_OK(VisitTypeInline(*type, &resolver));
+    convert_funcs[i] = resolver.func;
+    if (!options.fill_nulls && data.GetNullCount() > 0) {
+      return Status::Invalid("Cannot convert a record batch with nulls to a Tensor ",
+                             "without fill_nulls");
+    }
+  }
+
+  const int64_t byte_width = checked_cast<const FixedWidthType&>(*type).bit_width() / 8;
+  const int64_t row_size = ncolumns * byte_width;
+  const int64_t row_stride = options.row_stride == 0 ? row_size : options.row_stride;
+  if (row_stride < row_size || row_stride % byte_width != 0) {
+    return Status::Invalid("Invalid row stride ", row_stride, " for ", ncolumns,
+                           " columns of ", type->ToString());
+  }
+  const int64_t nrows = batch.num_rows();
+  if (nrows > 0 && out_size < (nrows - 1) * row_stride + row_size) {
+    return Status::Invalid("Output of ", out_size, " bytes is too small for ", nrows,
+                           " rows of ", row_stride, " bytes");
+  }
+
+  const int64_t rows_per_block = std::max<int64_t>(1, kRowMajorBlockSize / row_stride);
+  const int num_blocks = static_cast<int>(BitUtil::CeilDiv(nrows, rows_per_block));
+  auto convert_block = [&](int block) -> Status {
+    const int64_t start = block * rows_per_block;
+    const int64_t length = std::min(nrows - start, rows_per_block);
+    for (int i = 0; i < ncolumns; ++i) {
+      uint8_t* out_column = out + start * row_stride + i * byte_width;
+      convert_funcs[i](*columns[i], start, length, options.null_value,
+                       row_stride / byte_width, out_column);
+    }
+    return Status::OK();
+  };
+
+  auto thread_pool = internal::GetCpuThreadPool();
+  const bool use_threads =
+      options.use_threads && num_blocks > 1 && !thread_pool->OwnsThisThread();
+  return internal::OptionalParallelFor(use_threads, num_blocks, convert_block);
+}
+
 }  // namespace arrow
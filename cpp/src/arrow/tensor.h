@@ -237,4 +237,47 @@ class NumericTensor : public Tensor {
   }
 };
 
+/// \brief Options for converting a RecordBatch to row-major values
+struct ARROW_EXPORT RecordBatchToTensorOptions {
+  /// The value type of the output.  If null, the columns are promoted to a
+  /// common type: their type if they all have the same, else float64 if any
+  /// of them is floating point, else uint64 if all of them are unsigned, else
+  /// int64.  Values are converted as by static_cast.
+  std::shared_ptr<DataType> type;
+  /// Whether to write `null_value` in place of nulls, rather than failing
+  bool fill_nulls = false;
+  /// The value nulls are replaced with, converted to the output type
+  double null_value = 0;
+  /// The distance in bytes between the starts of two consecutive rows, or 0
+  /// for packed rows.  A larger stride leaves room for other fields, e.g. to
+  /// write the columns into an array of fixed-layout structs.  It must be a
+  /// multiple of the output byte width.
+  int64_t row_stride = 0;
+  /// Whether to convert blocks of rows in parallel on the CPU thread pool
+  bool use_threads = true;
+
+  static RecordBatchToTensorOptions Defaults() { return RecordBatchToTensorOptions(); }
+};
+
+/// \brief Return the value type a record batch is converted to
+ARROW_EXPORT
+Result<std::shared_ptr<DataType>> RecordBatchTensorType(
+    const RecordBatch& batch,
+    const RecordBatchToTensorOptions& options = RecordBatchToTensorOptions::Defaults());
+
+/// \brief Write the values of a record batch to caller-provided memory, as
+/// a row-major matrix of shape {num_rows, num_columns}
+///
+/// The columns must be of integer or floating point types (except
+/// half-float).  Rows are transposed in blocks sized to stay in cache.
+///
+/// \param[in] batch The record batch to convert
+/// \param[in] options The conversion options
+/// \param[out] out The memory to write to, suitably aligned for the output type
+/// \param[in] out_size The size in bytes of `out`, which must hold all rows
+ARROW_EXPORT
+Status RecordBatchToRowMajor(const RecordBatch& batch,
+                             const RecordBatchToTensorOptions& options, uint8_t* out,
+                             int64_t out_size);
+
 }  // namespace arrow
@@ -15,17 +15,21 @@
 // specific language governing permissions and limitations
 // under the License.
 
-#include "arrow/tensor/converter.h"
+#include "arrow/tensor/converter_internal.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -35,13 +39,43 @@ class MemoryPool;
 namespace internal {
 namespace {
 
+// Matrices with at least this many elements are converted on several threads
+constexpr int64_t kParallelConversionSize = 1 << 20;
+
+// Count the non-zero values of a strided vector.  Values are compared as
+// unsigned integers of the same width, so that the contiguous loop is
+// vectorized by the compiler.
+template <typename c_value_type>
+int64_t CountNonZero(const c_value_type* data, int64_t length, int64_t stride) {
+  int64_t count = 0;
+  if (stride == 1) {
+    for (int64_t i = 0; i < length; ++i) {
+      count += data[i] != 0;
+    }
+  } else {
+    for (int64_t i = 0; i < length; ++i) {
+      count += data[i * stride] != 0;
+    }
+  }
+  return count;
+}
+
+template <typename c_index_type, typename c_value_type>
+void CopyNonZero(const c_value_type* data, int64_t length, int64_t stride,
+                 c_index_type* indices, c_value_type* values) {
+  for (int64_t i = 0; i < length; ++i) {
+    const c_value_type x = data[i * stride];
+    if (x != 0) {
+      *indices++ = static_cast<c_index_type>(i);
+      *values++ = x;
+    }
+  }
+}
+
 // ----------------------------------------------------------------------
 // SparseTensorConverter for SparseCSRIndex
 
 class SparseCSXMatrixConverter : private SparseTensorConverterMixin {
-  using SparseTensorConverterMixin::AssignIndex;
-  using SparseTensorConverterMixin::IsNonZero;
-
  public:
   SparseCSXMatrixConverter(SparseMatrixCompressedAxis axis, const Tensor& tensor,
                            const std::shared_ptr<DataType>& index_value_type,
@@ -59,67 +93,93 @@ class SparseCSXMatrixConverter : private SparseTensorConverterMixin {
     if (ndim > 2) {
       return Status::Invalid("Invalid tensor dimension");
     }
+    if (ndim <= 1) {
+      return Status::NotImplemented("TODO for ndim <= 1");
+    }
+
+    Status status;
+#define CONVERT_CSX_MATRIX(index_type, value_type, ...) \
+  status = ConvertMatrix<index_type, value_type>()
+    DISPATCH(CONVERT_CSX_MATRIX, index_elsize, value_elsize, /*unused=*/0);
+#undef CONVERT_CSX_MATRIX
+    return status;
+  }
+
+  std::shared_ptr<SparseIndex> sparse_index;
+  std::shared_ptr<Buffer> data;
 
+ private:
+  // Convert in two passes over ranges of the major axis, in parallel for large
+  // matrices: count the non-zero values of each row (or column, for CSC), then
+  // copy them at the offsets given by the prefix sum of the counts.
+  template <typename c_index_type, typename c_value_type>
+  Status ConvertMatrix() {
     const int major_axis = static_cast<int>(axis_);
     const int64_t n_major = tensor_.shape()[major_axis];
     const int64_t n_minor = tensor_.shape()[1 - major_axis];
-    ARROW_ASSIGN_OR_RAISE(int64_t nonzero_count, tensor_.CountNonZero());
-
-    std::shared_ptr<Buffer> indptr_buffer;
-    std::shared_ptr<Buffer> indices_buffer;
+    // Strides in number of values
+    const int64_t major_stride =
+        tensor_.strides()[major_axis] / static_cast<int64_t>(sizeof(c_value_type));
+    const int64_t minor_stride =
+        tensor_.strides()[1 - major_axis] / static_cast<int64_t>(sizeof(c_value_type));
+    const auto* tensor_data = reinterpret_cast<const c_value_type*>(tensor_.raw_data());
+
+    auto thread_pool = GetCpuThreadPool();
+    const bool use_threads = tensor_.size() >= kParallelConversionSize &&
+                             thread_pool->GetCapacity() > 1 &&
+                             !thread_pool->OwnsThisThread();
+    const int num_tasks = use_threads ? static_cast<int>(std::min<int64_t>(
+                                            n_major, 4 * thread_pool->GetCapacity()))
+                                      : 1;
+    auto task_range = [&](int task) {
+      return std::make_pair(n_major * task / num_tasks, n_major * (task + 1) / num_tasks);
+    };
+
+    std::vector<int64_t> counts(n_major);
+    RETURN_NOT_OK(OptionalParallelFor(use_threads, num_tasks, [&](int task) {
+      const auto range = task_range(task);
+      for (int64_t i = range.first; i < range.second; ++i) {
+        counts[i] = CountNonZero(tensor_data + i * major_stride, n_minor, minor_stride);
+      }
+      return Status::OK();
+    }));
+
+    ARROW_ASSIGN_OR_RAISE(auto indptr_buffer,
+                          AllocateBuffer(sizeof(c_index_type) * (n_major + 1), pool_));
+    auto* indptr = reinterpret_cast<c_index_type*>(indptr_buffer->mutable_data());
+    int64_t nonzero_count = 0;
+    indptr[0] = 0;
+    for (int64_t i = 0; i < n_major; ++i) {
+      nonzero_count += counts[i];
+      indptr[i + 1] = static_cast<c_index_type>(nonzero_count);
+    }
 
+    ARROW_ASSIGN_OR_RAISE(auto indices_buffer,
+                          AllocateBuffer(sizeof(c_index_type) * nonzero_count, pool_));
     ARROW_ASSIGN_OR_RAISE(auto values_buffer,
-                          AllocateBuffer(value_elsize * nonzero_count, pool_));
-    auto* values = values_buffer->mutable_data();
-
-    const auto* tensor_data = tensor_.raw_data();
-
-    if (ndim <= 1) {
-      return Status::NotImplemented("TODO for ndim <= 1");
-    } else {
-      ARROW_ASSIGN_OR_RAISE(indptr_buffer,
-                            AllocateBuffer(index_elsize * (n_major + 1), pool_));
-      auto* indptr = indptr_buffer->mutable_data();
-
-      ARROW_ASSIGN_OR_RAISE(indices_buffer,
-                            AllocateBuffer(index_elsize * nonzero_count, pool_));
-      auto* indices = indices_buffer->mutable_data();
-
-      std::vector<int64_t> coords(2);
-      int64_t k = 0;
-      std::fill_n(indptr, index_elsize, 0);
-      indptr += index_elsize;
-      for (int64_t i = 0; i < n_major; ++i) {
-        for (int64_t j = 0; j < n_minor; ++j) {
-          if (axis_ == SparseMatrixCompressedAxis::ROW) {
-            coords = {i, j};
-          } else {
-            coords = {j, i};
-          }
-          const int64_t offset = tensor_.CalculateValueOffset(coords);
-          if (std::any_of(tensor_data + offset, tensor_data + offset + value_elsize,
-                          IsNonZero)) {
-            std::copy_n(tensor_data + offset, value_elsize, values);
-            values += value_elsize;
-
-            AssignIndex(indices, j, index_elsize);
-            indices += index_elsize;
-
-            k++;
-          }
+                          AllocateBuffer(sizeof(c_value_type) * nonzero_count, pool_));
+    auto* indices = reinterpret_cast<c_index_type*>(indices_buffer->mutable_data());
+    auto* values = reinterpret_cast<c_value_type*>(values_buffer->mutable_data());
+
+    RETURN_NOT_OK(OptionalParallelFor(use_threads, num_tasks, [&](int task) {
+      const auto range = task_range(task);
+      for (int64_t i = range.first; i < range.second; ++i) {
+        if (counts[i] > 0) {
+          const int64_t offset = static_cast<int64_t>(indptr[i]);
+          CopyNonZero(tensor_data + i * major_stride, n_minor, minor_stride,
+                      indices + offset, values + offset);
         }
-        AssignIndex(indptr, k, index_elsize);
-        indptr += index_elsize;
       }
-    }
+      return Status::OK();
+    }));
 
     std::vector<int64_t> indptr_shape({n_major + 1});
-    std::shared_ptr<Tensor> indptr_tensor =
-        std::make_shared<Tensor>(index_value_type_, indptr_buffer, indptr_shape);
+    std::shared_ptr<Tensor> indptr_tensor = std::make_shared<Tensor>(
+        index_value_type_, std::move(indptr_buffer), indptr_shape);
 
     std::vector<int64_t> indices_shape({nonzero_count});
-    std::shared_ptr<Tensor> indices_tensor =
-        std::make_shared<Tensor>(index_value_type_, indices_buffer, indices_shape);
+    std::shared_ptr<Tensor> indices_tensor = std::make_shared<Tensor>(
+        index_value_type_, std::move(indices_buffer), indices_shape);
 
     if (axis_ == SparseMatrixCompressedAxis::ROW) {
       sparse_index = std::make_shared<SparseCSRIndex>(indptr_tensor, indices_tensor);
@@ -131,10 +191,6 @@ class SparseCSXMatrixConverter : private SparseTensorConverterMixin {
     return Status::OK();
   }
 
-  std::shared_ptr<SparseIndex> sparse_index;
-  std::shared_ptr<Buffer> data;
-
- private:
   SparseMatrixCompressedAxis axis_;
   const Tensor& tensor_;
   const std::shared_ptr<DataType>& index_value_type_;
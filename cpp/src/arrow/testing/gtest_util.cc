@@ -28,6 +28,7 @@
 #include <chrono>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <limits>
 #include <locale>
@@ -391,6 +392,16 @@ std::shared_ptr<Table> TableFromJSON(const std::shared_ptr<Schema>& schema,
   return *Table::FromRecordBatches(schema, std::move(batches));
 }
 
+std::shared_ptr<Array> StringArrayWithInvalidOffsets() {
+  const int32_t offsets[] = {0, 2, 1, 6};
+  std::shared_ptr<Buffer> offsets_buffer = *AllocateBuffer(sizeof(offsets));
+  std::memcpy(offsets_buffer->mutable_data(), offsets, sizeof(offsets));
+  auto data = ArrayData::Make(utf8(), 3,
+                              {nullptr, offsets_buffer, Buffer::FromString("abcdef")},
+                              /*null_count=*/0);
+  return MakeArray(data);
+}
+
 void AssertTablesEqual(const Table& expected, const Table& actual, bool same_chunk_layout,
                        bool combine_chunks) {
   ASSERT_EQ(expected.num_columns(), actual.num_columns());
@@ -286,6 +286,11 @@ ARROW_TESTING_EXPORT
 std::shared_ptr<Table> TableFromJSON(const std::shared_ptr<Schema>&,
                                      const std::vector<std::string>& json);
 
+// The utf8 array ["ab", "c", "def"], but with offsets going backwards, which
+// only full validation detects
+ARROW_TESTING_EXPORT
+std::shared_ptr<Array> StringArrayWithInvalidOffsets();
+
 // ArrayFromVector: construct an Array from vectors of C values
 
 template <typename TYPE, typename C_TYPE = typename TYPE::c_type>
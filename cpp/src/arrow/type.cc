@@ -56,6 +56,8 @@ constexpr Type::type MapType::type_id;
 
 constexpr Type::type FixedSizeListType::type_id;
 
+constexpr Type::type RunEndEncodedType::type_id;
+
 constexpr Type::type BinaryType::type_id;
 
 constexpr Type::type LargeBinaryType::type_id;
@@ -64,6 +66,10 @@ constexpr Type::type StringType::type_id;
 
 constexpr Type::type LargeStringType::type_id;
 
+constexpr Type::type BinaryViewType::type_id;
+
+constexpr Type::type StringViewType::type_id;
+
 constexpr Type::type FixedSizeBinaryType::type_id;
 
 constexpr Type::type StructType::type_id;
@@ -152,6 +158,9 @@ std::string ToString(Type::type id) {
     TO_STRING_CASE(DENSE_UNION)
     TO_STRING_CASE(SPARSE_UNION)
     TO_STRING_CASE(DICTIONARY)
+    TO_STRING_CASE(RUN_END_ENCODED)
+    TO_STRING_CASE(BINARY_VIEW)
+    TO_STRING_CASE(STRING_VIEW)
     TO_STRING_CASE(EXTENSION)
 
 #undef TO_STRING_CASE
@@ -464,6 +473,10 @@ std::string StringType::ToString() const { return "string"; }
 
 std::string LargeStringType::ToString() const { return "large_string"; }
 
+std::string BinaryViewType::ToString() const { return "binary_view"; }
+
+std::string StringViewType::ToString() const { return "string_view"; }
+
 int FixedSizeBinaryType::bit_width() const { return CHAR_BIT * byte_width(); }
 
 Result<std::shared_ptr<DataType>> FixedSizeBinaryType::Make(int32_t byte_width) {
@@ -805,6 +818,39 @@ std::string DictionaryType::ToString() const {
   return ss.str();
 }
 
+// ----------------------------------------------------------------------
+// Run-end encoded type
+
+bool RunEndEncodedType::RunEndTypeValid(const DataType& run_end_type) {
+  return run_end_type.id() == Type::INT16 || run_end_type.id() == Type::INT32 ||
+         run_end_type.id() == Type::INT64;
+}
+
+Result<std::shared_ptr<DataType>> RunEndEncodedType::Make(
+    const std::shared_ptr<DataType>& run_end_type,
+    const std::shared_ptr<DataType>& value_type) {
+  if (!RunEndTypeValid(*run_end_type)) {
+    return Status::TypeError("Run end type should be int16, int32 or int64, got ",
+                             run_end_type->ToString());
+  }
+  return std::make_shared<RunEndEncodedType>(run_end_type, value_type);
+}
+
+RunEndEncodedType::RunEndEncodedType(const std::shared_ptr<DataType>& run_end_type,
+                                     const std::shared_ptr<DataType>& value_type)
+    : NestedType(Type::RUN_END_ENCODED) {
+  DCHECK(RunEndTypeValid(*run_end_type));
+  children_ = {std::make_shared<Field>("run_ends", run_end_type, /*nullable=*/false),
+               std::make_shared<Field>("values", value_type)};
+}
+
+std::string RunEndEncodedType::ToString() const {
+  std::stringstream ss;
+  ss << this->name() << "<run_ends: " << run_end_type()->ToString()
+     << ", values: " << value_type()->ToString() << ">";
+  return ss.str();
+}
+
 // ----------------------------------------------------------------------
 // Null type
 
@@ -1821,8 +1867,10 @@ PARAMETER_LESS_FINGERPRINT(Float)
 PARAMETER_LESS_FINGERPRINT(Double)
 PARAMETER_LESS_FINGERPRINT(Binary)
 PARAMETER_LESS_FINGERPRINT(LargeBinary)
+PARAMETER_LESS_FINGERPRINT(BinaryView)
 PARAMETER_LESS_FINGERPRINT(String)
 PARAMETER_LESS_FINGERPRINT(LargeString)
+PARAMETER_LESS_FINGERPRINT(StringView)
 PARAMETER_LESS_FINGERPRINT(Date32)
 PARAMETER_LESS_FINGERPRINT(Date64)
 
@@ -1881,6 +1929,15 @@ std::string FixedSizeListType::ComputeFingerprint() const {
   return "";
 }
 
+std::string RunEndEncodedType::ComputeFingerprint() const {
+  const auto& run_end_fingerprint = run_end_type()->fingerprint();
+  const auto& value_fingerprint = children_[1]->fingerprint();
+  if (!run_end_fingerprint.empty() && !value_fingerprint.empty()) {
+    return TypeIdFingerprint(*this) + "{" + run_end_fingerprint + value_fingerprint + "}";
+  }
+  return "";
+}
+
 std::string FixedSizeBinaryType::ComputeFingerprint() const {
   std::stringstream ss;
   ss << TypeIdFingerprint(*this) << "[" << byte_width_ << "]";
@@ -1992,6 +2049,8 @@ TYPE_FACTORY(utf8, StringType)
 TYPE_FACTORY(large_utf8, LargeStringType)
 TYPE_FACTORY(binary, BinaryType)
 TYPE_FACTORY(large_binary, LargeBinaryType)
+TYPE_FACTORY(binary_view, BinaryViewType)
+TYPE_FACTORY(utf8_view, StringViewType)
 TYPE_FACTORY(date64, Date64Type)
 TYPE_FACTORY(date32, Date32Type)
 
@@ -2130,6 +2189,11 @@ std::shared_ptr<DataType> dictionary(const std::shared_ptr<DataType>& index_type
   return std::make_shared<DictionaryType>(index_type, dict_type, ordered);
 }
 
+std::shared_ptr<DataType> run_end_encoded(const std::shared_ptr<DataType>& run_end_type,
+                                          const std::shared_ptr<DataType>& value_type) {
+  return std::make_shared<RunEndEncodedType>(run_end_type, value_type);
+}
+
 std::shared_ptr<Field> field(std::string name, std::shared_ptr<DataType> type,
                              bool nullable,
                              std::shared_ptr<const KeyValueMetadata> metadata) {
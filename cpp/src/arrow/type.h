@@ -787,6 +787,83 @@ class ARROW_EXPORT LargeStringType : public LargeBinaryType {
   std::string ComputeFingerprint() const override;
 };
 
+/// \brief Concrete type class for variable-size binary data stored as views
+///
+/// Each value is described by a 16-byte view holding the value size, then
+/// either the value itself if it is at most kInlineSize bytes long, or its
+/// first kPrefixSize bytes followed by the index of the data buffer holding
+/// the value and the value offset in that buffer. The array buffers are the
+/// validity bitmap, the views and any number of data buffers.
+///
+/// Comparisons can often be resolved from the size and prefix alone, and
+/// selecting values only needs to move views, not character data.
+class ARROW_EXPORT BinaryViewType : public DataType {
+ public:
+  static constexpr Type::type type_id = Type::BINARY_VIEW;
+  static constexpr bool is_utf8 = false;
+  using PhysicalType = BinaryViewType;
+
+  static constexpr int32_t kInlineSize = 12;
+  static constexpr int32_t kPrefixSize = 4;
+
+  /// \brief The view of a single value
+  ///
+  /// Unused inline bytes are zeroed, so views of equal values have equal
+  /// prefixes.
+  struct c_type {
+    int32_t size;
+    uint8_t prefix[kPrefixSize];
+    int32_t buffer_index;
+    int32_t offset;
+
+    bool is_inline() const { return size <= kInlineSize; }
+
+    /// The value bytes, if stored inline (they start at the prefix)
+    const uint8_t* inline_data() const {
+      return reinterpret_cast<const uint8_t*>(this) + sizeof(size);
+    }
+  };
+
+  static constexpr const char* type_name() { return "binary_view"; }
+
+  BinaryViewType() : BinaryViewType(Type::BINARY_VIEW) {}
+
+  DataTypeLayout layout() const override {
+    return DataTypeLayout(
+        {DataTypeLayout::Bitmap(), DataTypeLayout::FixedWidth(sizeof(c_type))});
+  }
+
+  std::string ToString() const override;
+  std::string name() const override { return "binary_view"; }
+
+ protected:
+  std::string ComputeFingerprint() const override;
+
+  // Allow subclasses like StringViewType to change the logical type.
+  explicit BinaryViewType(Type::type logical_type) : DataType(logical_type) {}
+};
+
+static_assert(sizeof(BinaryViewType::c_type) == 16, "binary views must be 16 bytes");
+
+/// \brief Concrete type class for variable-size string data stored as views,
+/// utf8-encoded
+class ARROW_EXPORT StringViewType : public BinaryViewType {
+ public:
+  static constexpr Type::type type_id = Type::STRING_VIEW;
+  static constexpr bool is_utf8 = true;
+  using PhysicalType = BinaryViewType;
+
+  static constexpr const char* type_name() { return "utf8_view"; }
+
+  StringViewType() : BinaryViewType(Type::STRING_VIEW) {}
+
+  std::string ToString() const override;
+  std::string name() const override { return "utf8_view"; }
+
+ protected:
+  std::string ComputeFingerprint() const override;
+};
+
 /// \brief Concrete type class for fixed-size binary data
 class ARROW_EXPORT FixedSizeBinaryType : public FixedWidthType, public ParametricType {
  public:
@@ -1301,6 +1378,44 @@ class ARROW_EXPORT DictionaryType : public FixedWidthType {
   bool ordered_;
 };
 
+/// \brief Run-end encoded value type, for data with runs of equal values.
+///
+/// Arrays of this type have no buffers of their own, and two children: the
+/// logical index at which each run ends, strictly increasing, and the value of
+/// each run. The array offset and length are logical, and the children are
+/// never sliced. Nulls are stored as runs of null values, so the array itself
+/// has a null count of zero.
+class ARROW_EXPORT RunEndEncodedType : public NestedType {
+ public:
+  static constexpr Type::type type_id = Type::RUN_END_ENCODED;
+
+  static constexpr const char* type_name() { return "run_end_encoded"; }
+
+  RunEndEncodedType(const std::shared_ptr<DataType>& run_end_type,
+                    const std::shared_ptr<DataType>& value_type);
+
+  // A constructor variant that validates its input parameters
+  static Result<std::shared_ptr<DataType>> Make(
+      const std::shared_ptr<DataType>& run_end_type,
+      const std::shared_ptr<DataType>& value_type);
+
+  DataTypeLayout layout() const override {
+    return DataTypeLayout({DataTypeLayout::AlwaysNull()});
+  }
+
+  std::string ToString() const override;
+  std::string name() const override { return "run_end_encoded"; }
+
+  const std::shared_ptr<DataType>& run_end_type() const { return children_[0]->type(); }
+  const std::shared_ptr<DataType>& value_type() const { return children_[1]->type(); }
+
+  /// \brief Whether the type can hold the run ends, i.e. is int16, int32 or int64
+  static bool RunEndTypeValid(const DataType& run_end_type);
+
+ protected:
+  std::string ComputeFingerprint() const override;
+};
+
 /// \brief Helper class for incremental dictionary unification
 class ARROW_EXPORT DictionaryUnifier {
  public:
@@ -1329,6 +1444,39 @@ class ARROW_EXPORT DictionaryUnifier {
   /// after this is called
   virtual Status GetResult(std::shared_ptr<DataType>* out_type,
                            std::shared_ptr<Array>* out_dict) = 0;
+
+  /// \brief Return the unified dictionary, checking that its indices fit in
+  /// the given index type. The unifier cannot be used after this is called
+  virtual Status GetResultWithIndexType(const std::shared_ptr<DataType>& index_type,
+                                        std::shared_ptr<Array>* out_dict) = 0;
+
+  /// \brief Unify the dictionaries of all chunks of a dictionary-encoded
+  /// ChunkedArray
+  ///
+  /// Distinct dictionaries are merged in parallel on the CPU thread pool, and
+  /// the indices of each chunk are then transposed to the unified dictionary.
+  /// Chunks sharing a dictionary with an earlier chunk are only unified once,
+  /// and the indices of chunks whose dictionary is a prefix of the unified one
+  /// are reused without copying. The index type is unchanged; an error is
+  /// returned if the unified dictionary does not fit in it.
+  ///
+  /// \param[in] array a ChunkedArray of dictionary type
+  /// \param[in] pool MemoryPool to use for memory allocations
+  /// \return a ChunkedArray whose chunks all have the same dictionary
+  static Result<std::shared_ptr<ChunkedArray>> UnifyChunkedArray(
+      const std::shared_ptr<ChunkedArray>& array,
+      MemoryPool* pool = default_memory_pool());
+
+  /// \brief Unify the dictionaries of all dictionary-encoded columns of a Table
+  ///
+  /// Each dictionary column is unified with UnifyChunkedArray, other columns
+  /// are returned unchanged.
+  ///
+  /// \param[in] table a Table
+  /// \param[in] pool MemoryPool to use for memory allocations
+  /// \return a Table whose dictionary columns have one dictionary each
+  static Result<std::shared_ptr<Table>> UnifyTable(
+      const Table& table, MemoryPool* pool = default_memory_pool());
 };
 
 // ----------------------------------------------------------------------
@@ -1804,6 +1952,7 @@ static inline bool HasValidityBitmap(Type::type id) {
     case Type::NA:
     case Type::DENSE_UNION:
     case Type::SPARSE_UNION:
+    case Type::RUN_END_ENCODED:
       return false;
     default:
       return true;
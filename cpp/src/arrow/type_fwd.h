@@ -59,6 +59,7 @@ using FieldVector = std::vector<std::shared_ptr<Field>>;
 
 class Array;
 struct ArrayData;
+struct ArraySpan;
 class ArrayBuilder;
 class Tensor;
 struct Scalar;
@@ -80,6 +81,10 @@ class DictionaryType;
 class DictionaryArray;
 struct DictionaryScalar;
 
+class RunEndEncodedType;
+class RunEndEncodedArray;
+struct RunEndEncodedScalar;
+
 class NullType;
 class NullArray;
 class NullBuilder;
@@ -117,6 +122,16 @@ class LargeStringArray;
 class LargeStringBuilder;
 struct LargeStringScalar;
 
+class BinaryViewType;
+class BinaryViewArray;
+class BinaryViewBuilder;
+struct BinaryViewScalar;
+
+class StringViewType;
+class StringViewArray;
+class StringViewBuilder;
+struct StringViewScalar;
+
 class ListType;
 class ListArray;
 class ListBuilder;
@@ -370,6 +385,17 @@ struct Type {
     /// Like LIST, but with 64-bit offsets
     LARGE_LIST,
 
+    /// Run-end encoded, holding the values of each run of equal values and the
+    /// logical index at which each run ends
+    RUN_END_ENCODED,
+
+    /// Variable-length bytes referenced through fixed-size views, which hold
+    /// short values inline and a prefix of longer ones
+    BINARY_VIEW,
+
+    /// Like BINARY_VIEW, but utf8-encoded
+    STRING_VIEW,
+
     // Leave this at the end
     MAX_ID
   };
@@ -414,6 +440,10 @@ std::shared_ptr<DataType> ARROW_EXPORT large_utf8();
 std::shared_ptr<DataType> ARROW_EXPORT binary();
 /// \brief Return a LargeBinaryType instance
 std::shared_ptr<DataType> ARROW_EXPORT large_binary();
+/// \brief Return a BinaryViewType instance
+std::shared_ptr<DataType> ARROW_EXPORT binary_view();
+/// \brief Return a StringViewType instance
+std::shared_ptr<DataType> ARROW_EXPORT utf8_view();
 /// \brief Return a Date32Type instance
 std::shared_ptr<DataType> ARROW_EXPORT date32();
 /// \brief Return a Date64Type instance
@@ -586,6 +616,14 @@ std::shared_ptr<DataType> dictionary(const std::shared_ptr<DataType>& index_type
                                      const std::shared_ptr<DataType>& dict_type,
                                      bool ordered = false);
 
+/// \brief Create a RunEndEncodedType instance
+/// \param[in] run_end_type the type of the run ends (must be int16, int32
+/// or int64)
+/// \param[in] value_type the type of the values of the runs
+ARROW_EXPORT
+std::shared_ptr<DataType> run_end_encoded(const std::shared_ptr<DataType>& run_end_type,
+                                          const std::shared_ptr<DataType>& value_type);
+
 /// @}
 
 /// \defgroup schema-factories Factory functions for fields and schemas
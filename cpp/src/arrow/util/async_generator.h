@@ -0,0 +1,349 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/future.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+/// \brief EXPERIMENTAL The asynchronous counterpart of an Iterator
+///
+/// Each call returns a Future of the next item.  The end of the items is
+/// signalled like for an Iterator, by IterationTraits<T>::End(), and an
+/// exhausted generator keeps returning it.
+///
+/// A generator may be called again before the previous futures complete, and
+/// its futures then complete with the items in call order.  This is what lets
+/// readahead overlap the production of several items.
+template <typename T>
+using AsyncGenerator = std::function<Future<T>()>;
+
+template <typename T>
+bool IsIterationEnd(const T& value) {
+  return value == IterationTraits<T>::End();
+}
+
+/// \brief Visit all items of a generator, one at a time
+///
+/// The returned Future completes once the generator is exhausted, or fails
+/// with the first error of the generator or visitor.
+template <typename T>
+Future<void> VisitAsyncGenerator(AsyncGenerator<T> generator,
+                                 std::function<Status(const T&)> visitor) {
+  struct State {
+    AsyncGenerator<T> generator;
+    std::function<Status(const T&)> visitor;
+    Future<void> done;
+
+    // Return whether to continue the loop
+    bool Visit(const Result<T>& next) {
+      if (!next.ok()) {
+        done.MarkFinished(next.status());
+        return false;
+      }
+      if (IsIterationEnd(*next)) {
+        done.MarkFinished();
+        return false;
+      }
+      Status st = visitor(*next);
+      if (!st.ok()) {
+        done.MarkFinished(std::move(st));
+        return false;
+      }
+      return true;
+    }
+
+    // Loop over the items already available, so that a generator completing
+    // its futures immediately doesn't grow the stack
+    static void Loop(std::shared_ptr<State> state) {
+      while (true) {
+        auto next = state->generator();
+        if (!IsFutureFinished(next.state())) {
+          next.AddCallback([state](const Result<T>& result) {
+            if (state->Visit(result)) {
+              Loop(state);
+            }
+          });
+          return;
+        }
+        if (!state->Visit(next.result())) {
+          return;
+        }
+      }
+    }
+  };
+
+  auto done = Future<void>::Make();
+  auto state =
+      std::make_shared<State>(State{std::move(generator), std::move(visitor), done});
+  State::Loop(std::move(state));
+  return done;
+}
+
+/// \brief Collect all items of a generator
+template <typename T>
+Future<std::vector<T>> CollectAsyncGenerator(AsyncGenerator<T> generator) {
+  auto items = std::make_shared<std::vector<T>>();
+  auto done = VisitAsyncGenerator<T>(std::move(generator), [items](const T& item) {
+    items->push_back(item);
+    return Status::OK();
+  });
+  return done.Then([items]() { return std::move(*items); });
+}
+
+/// \brief Make a generator yielding the items of a vector
+template <typename T>
+AsyncGenerator<T> MakeVectorGenerator(std::vector<T> items) {
+  struct State {
+    explicit State(std::vector<T> v) : items(std::move(v)), index(0) {}
+
+    std::vector<T> items;
+    std::atomic<size_t> index;
+  };
+
+  auto state = std::make_shared<State>(std::move(items));
+  return [state]() {
+    const size_t index = state->index.fetch_add(1);
+    if (index >= state->items.size()) {
+      return Future<T>::MakeFinished(IterationTraits<T>::End());
+    }
+    return Future<T>::MakeFinished(state->items[index]);
+  };
+}
+
+/// \brief Make a generator running a (blocking) iterator on an executor
+///
+/// Each call submits a task pulling the next item from the iterator, so that
+/// the calling thread doesn't block on it.  The tasks pull items one at a time.
+template <typename T>
+AsyncGenerator<T> MakeBackgroundGenerator(Iterator<T> iterator,
+                                          internal::Executor* executor) {
+  struct State {
+    explicit State(Iterator<T> it) : iterator(std::move(it)) {}
+
+    std::mutex mutex;
+    Iterator<T> iterator;
+    bool finished = false;
+    // The futures of the calls, in call order
+    std::deque<Future<T>> pending;
+  };
+
+  auto state = std::make_shared<State>(std::move(iterator));
+  return [state, executor]() {
+    auto future = Future<T>::Make();
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      state->pending.push_back(future);
+    }
+    // Tasks may run in any order, but each pulls the next item for the oldest
+    // call still waiting
+    auto pull = [state]() {
+      Future<T> next;
+      Result<T> item;
+      {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        next = std::move(state->pending.front());
+        state->pending.pop_front();
+        if (state->finished) {
+          item = IterationTraits<T>::End();
+        } else {
+          item = state->iterator.Next();
+          state->finished = !item.ok() || IsIterationEnd(*item);
+        }
+      }
+      next.MarkFinished(std::move(item));
+    };
+    if (!executor->Spawn(pull).ok()) {
+      // Every call must pull an item, pull it in the calling thread
+      pull();
+    }
+    return future;
+  };
+}
+
+/// \brief Make a generator whose futures complete on the given executor
+///
+/// \see Executor::Transfer
+template <typename T>
+AsyncGenerator<T> MakeTransferredGenerator(AsyncGenerator<T> source,
+                                           internal::Executor* executor) {
+  return [source, executor]() { return executor->Transfer(source()); };
+}
+
+/// \brief Make a generator applying a function to the items of another
+///
+/// The function is called with each item as a `const T&` (but not with the
+/// end marker) and may return V, Result<V> or Future<V>.  In the latter case,
+/// the mapping of several items may overlap.
+template <typename T, typename MapFn,
+          typename MappedFuture = detail::ContinuedFuture<MapFn, T>,
+          typename V = typename MappedFuture::ValueType>
+AsyncGenerator<V> MakeMappedGenerator(AsyncGenerator<T> source, MapFn map) {
+  using MapResult = typename detail::ContinueResult<MapFn, T>::type;
+  return [source, map]() {
+    return source().Then([map](const T& item) mutable {
+      auto mapped = MappedFuture::Make();
+      if (IsIterationEnd(item)) {
+        mapped.MarkFinished(IterationTraits<V>::End());
+      } else {
+        detail::ContinueFuture<MapResult>::Run(mapped, map, item);
+      }
+      return mapped;
+    });
+  };
+}
+
+/// \brief Make a generator keeping up to max_readahead calls of its source
+/// in flight
+///
+/// The source must tolerate being called before its previous futures
+/// complete, which lets the production of several items overlap (e.g.
+/// several reads from a background generator).
+template <typename T>
+AsyncGenerator<T> MakeReadaheadGenerator(AsyncGenerator<T> source, int max_readahead) {
+  struct State {
+    std::mutex mutex;
+    AsyncGenerator<T> source;
+    int max_readahead;
+    std::deque<Future<T>> readahead;
+  };
+
+  auto state = std::make_shared<State>();
+  state->source = std::move(source);
+  state->max_readahead = std::max(1, max_readahead);
+  return [state]() {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    while (static_cast<int>(state->readahead.size()) <= state->max_readahead) {
+      state->readahead.push_back(state->source());
+    }
+    auto next = std::move(state->readahead.front());
+    state->readahead.pop_front();
+    return next;
+  };
+}
+
+/// \brief Make a generator yielding the items of several generators, in
+/// completion order
+///
+/// Each source has at most one call in flight, started when items are
+/// requested.  An error is yielded like an item, and ends its source.  The
+/// merged generator ends once all sources are exhausted.
+template <typename T>
+AsyncGenerator<T> MakeMergedGenerator(std::vector<AsyncGenerator<T>> sources) {
+  struct State {
+    explicit State(std::vector<AsyncGenerator<T>> s)
+        : sources(std::move(s)),
+          pulling(sources.size(), false),
+          ended(sources.size(), false),
+          num_active(static_cast<int>(sources.size())) {}
+
+    std::mutex mutex;
+    std::vector<AsyncGenerator<T>> sources;
+    std::vector<bool> pulling;
+    std::vector<bool> ended;
+    int num_active;
+    // Items available before being requested
+    std::deque<Result<T>> ready;
+    // Requests waiting for an item
+    std::deque<Future<T>> waiting;
+
+    static void Pull(std::shared_ptr<State> state, size_t index) {
+      state->sources[index]().AddCallback([state, index](const Result<T>& item) {
+        const bool is_end = item.ok() && IsIterationEnd(*item);
+        Future<T> receiver;
+        std::vector<Future<T>> unserved;
+        bool pull_again = false;
+        {
+          std::lock_guard<std::mutex> lock(state->mutex);
+          state->pulling[index] = false;
+          if (is_end || !item.ok()) {
+            state->ended[index] = true;
+            --state->num_active;
+          }
+          if (!is_end) {
+            if (state->waiting.empty()) {
+              state->ready.push_back(item);
+            } else {
+              receiver = std::move(state->waiting.front());
+              state->waiting.pop_front();
+            }
+          }
+          if (state->num_active == 0) {
+            // No more items will come
+            unserved.assign(state->waiting.begin(), state->waiting.end());
+            state->waiting.clear();
+          } else if (!state->ended[index] && !state->waiting.empty()) {
+            state->pulling[index] = pull_again = true;
+          }
+        }
+        if (receiver.is_valid()) {
+          receiver.MarkFinished(item);
+        }
+        for (auto& future : unserved) {
+          future.MarkFinished(IterationTraits<T>::End());
+        }
+        if (pull_again) {
+          Pull(state, index);
+        }
+      });
+    }
+  };
+
+  auto state = std::make_shared<State>(std::move(sources));
+  return [state]() {
+    std::vector<size_t> to_pull;
+    auto next = Future<T>::Make();
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      if (!state->ready.empty()) {
+        auto item = std::move(state->ready.front());
+        state->ready.pop_front();
+        return Future<T>::MakeFinished(std::move(item));
+      }
+      if (state->num_active == 0) {
+        return Future<T>::MakeFinished(IterationTraits<T>::End());
+      }
+      state->waiting.push_back(next);
+      for (size_t i = 0; i < state->sources.size(); ++i) {
+        if (!state->ended[i] && !state->pulling[i]) {
+          state->pulling[i] = true;
+          to_pull.push_back(i);
+        }
+      }
+    }
+    for (const size_t index : to_pull) {
+      State::Pull(state, index);
+    }
+    return next;
+  };
+}
+
+}  // namespace arrow
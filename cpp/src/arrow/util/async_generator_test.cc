@@ -0,0 +1,209 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/async_generator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+using internal::ThreadPool;
+
+// Let 0 mark the end of the ints yielded below
+template <>
+struct IterationTraits<int> {
+  static int End() { return 0; }
+};
+
+std::vector<int> RangeVector(int start, int stop) {
+  std::vector<int> values;
+  for (int i = start; i < stop; ++i) {
+    values.push_back(i);
+  }
+  return values;
+}
+
+// A generator completing its futures later, on a thread pool
+AsyncGenerator<int> MakeSlowGenerator(std::vector<int> values, ThreadPool* pool) {
+  return MakeBackgroundGenerator(MakeVectorIterator(std::move(values)), pool);
+}
+
+TEST(AsyncGenerator, Collect) {
+  auto gen = MakeVectorGenerator(RangeVector(1, 5));
+  ASSERT_OK_AND_EQ(RangeVector(1, 5), CollectAsyncGenerator(gen).result());
+  ASSERT_OK_AND_EQ(std::vector<int>{},
+                   CollectAsyncGenerator(MakeVectorGenerator<int>({})).result());
+
+  // Stays exhausted
+  ASSERT_OK_AND_EQ(0, gen().result());
+}
+
+TEST(AsyncGenerator, CollectLong) {
+  // Synchronously completed futures don't grow the stack
+  auto values = RangeVector(1, 1000000);
+  ASSERT_OK_AND_ASSIGN(auto collected,
+                       CollectAsyncGenerator(MakeVectorGenerator(values)).result());
+  ASSERT_EQ(collected, values);
+}
+
+TEST(AsyncGenerator, Visit) {
+  int sum = 0;
+  auto done = VisitAsyncGenerator<int>(MakeVectorGenerator(RangeVector(1, 5)),
+                                       [&](const int& x) {
+                                         sum += x;
+                                         return Status::OK();
+                                       });
+  ASSERT_OK(done.status());
+  ASSERT_EQ(sum, 10);
+
+  done = VisitAsyncGenerator<int>(MakeVectorGenerator(RangeVector(1, 5)),
+                                  [&](const int& x) {
+                                    return x == 3 ? Status::Invalid("xxx") : Status::OK();
+                                  });
+  ASSERT_RAISES(Invalid, done.status());
+}
+
+TEST(AsyncGenerator, Background) {
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::Make(/*threads=*/4));
+  auto gen = MakeSlowGenerator(RangeVector(1, 100), pool.get());
+  // Several calls in flight still yield the items in order
+  std::vector<Future<int>> futures;
+  for (int i = 0; i < 120; ++i) {
+    futures.push_back(gen());
+  }
+  for (int i = 0; i < 120; ++i) {
+    ASSERT_OK_AND_EQ(i < 99 ? i + 1 : 0, futures[i].result());
+  }
+}
+
+TEST(AsyncGenerator, BackgroundError) {
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::Make(/*threads=*/2));
+  int count = 0;
+  auto gen = MakeBackgroundGenerator(MakeFunctionIterator([&]() -> Result<int> {
+                                       if (++count == 2) {
+                                         return Status::IOError("xxx");
+                                       }
+                                       return count;
+                                     }),
+                                     pool.get());
+  ASSERT_OK_AND_EQ(1, gen().result());
+  ASSERT_RAISES(IOError, gen().result());
+  // The iterator isn't pulled after an error
+  ASSERT_OK_AND_EQ(0, gen().result());
+}
+
+TEST(AsyncGenerator, Mapped) {
+  auto gen = MakeMappedGenerator(MakeVectorGenerator(RangeVector(1, 5)),
+                                 [](const int& x) { return x * 10; });
+  ASSERT_OK_AND_EQ(std::vector<int>({10, 20, 30, 40}),
+                   CollectAsyncGenerator(gen).result());
+
+  // Asynchronous mapping
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::Make(/*threads=*/4));
+  auto async_gen = MakeMappedGenerator(
+      MakeVectorGenerator(RangeVector(1, 50)),
+      [&](const int& x) { return pool->SubmitAsFuture([x]() { return x + 1; }); });
+  ASSERT_OK_AND_EQ(RangeVector(2, 51), CollectAsyncGenerator(async_gen).result());
+
+  // Errors of the mapping are yielded
+  auto failing_gen = MakeMappedGenerator(
+      MakeVectorGenerator(RangeVector(1, 5)), [](const int& x) -> Result<int> {
+        if (x == 2) {
+          return Status::Invalid("xxx");
+        }
+        return x;
+      });
+  ASSERT_RAISES(Invalid, CollectAsyncGenerator(failing_gen).result());
+}
+
+TEST(AsyncGenerator, Readahead) {
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::Make(/*threads=*/4));
+  std::atomic<int> num_calls(0);
+  AsyncGenerator<int> source = MakeSlowGenerator(RangeVector(1, 50), pool.get());
+  AsyncGenerator<int> counting = [&]() {
+    ++num_calls;
+    return source();
+  };
+  auto gen = MakeReadaheadGenerator(counting, 4);
+  ASSERT_EQ(num_calls.load(), 0);
+  ASSERT_OK_AND_EQ(1, gen().result());
+  ASSERT_EQ(num_calls.load(), 5);
+  ASSERT_OK_AND_EQ(RangeVector(2, 50), CollectAsyncGenerator(gen).result());
+}
+
+TEST(AsyncGenerator, Transferred) {
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::Make(/*threads=*/2));
+  auto source_future = Future<int>::Make();
+  AsyncGenerator<int> source = [&]() { return source_future; };
+  auto gen = MakeTransferredGenerator(source, pool.get());
+  auto on_pool = gen().Then([&](const int&) { return pool->OwnsThisThread(); });
+  source_future.MarkFinished(1);
+  ASSERT_OK_AND_EQ(true, on_pool.result());
+}
+
+TEST(AsyncGenerator, Merged) {
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::Make(/*threads=*/4));
+  std::vector<AsyncGenerator<int>> sources = {
+      MakeSlowGenerator(RangeVector(1, 100), pool.get()),
+      MakeVectorGenerator(RangeVector(100, 150)),
+      MakeVectorGenerator<int>({}),
+      MakeSlowGenerator(RangeVector(150, 300), pool.get())};
+  auto gen = MakeMergedGenerator(std::move(sources));
+
+  // Several requests in flight
+  auto readahead = MakeReadaheadGenerator(gen, 8);
+  ASSERT_OK_AND_ASSIGN(auto collected, CollectAsyncGenerator(readahead).result());
+  std::sort(collected.begin(), collected.end());
+  ASSERT_EQ(collected, RangeVector(1, 300));
+  ASSERT_OK_AND_EQ(0, gen().result());
+
+  ASSERT_OK_AND_EQ(std::vector<int>{},
+                   CollectAsyncGenerator(MakeMergedGenerator<int>({})).result());
+}
+
+TEST(AsyncGenerator, MergedError) {
+  AsyncGenerator<int> failing = []() {
+    return Future<int>::MakeFinished(Status::IOError("xxx"));
+  };
+  auto gen = MakeMergedGenerator<int>({failing, MakeVectorGenerator(RangeVector(1, 3))});
+  std::vector<int> values;
+  int num_errors = 0;
+  while (true) {
+    auto next = gen().result();
+    if (!next.ok()) {
+      ++num_errors;
+      continue;
+    }
+    if (*next == 0) {
+      break;
+    }
+    values.push_back(*next);
+  }
+  // The failed source isn't pulled again
+  ASSERT_EQ(num_errors, 1);
+  ASSERT_EQ(values, RangeVector(1, 3));
+}
+
+}  // namespace arrow
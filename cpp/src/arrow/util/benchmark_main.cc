@@ -15,9 +15,33 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cstdlib>
+#include <cstring>
+
 #include "benchmark/benchmark.h"
 
+#include "arrow/util/io_util.h"
+
+namespace {
+
+// Consume the Arrow-specific flags, leaving the others to the benchmark library
+void ParseArrowFlags(int* argc, char** argv) {
+  int out = 1;
+  for (int i = 1; i < *argc; ++i) {
+    if (std::strcmp(argv[i], "--arrow_perf_counters") == 0) {
+      // Read by the helpers of arrow/util/benchmark_util.h
+      ARROW_UNUSED(::arrow::internal::SetEnvVar("ARROW_BENCHMARK_PERF_COUNTERS", "1"));
+    } else {
+      argv[out++] = argv[i];
+    }
+  }
+  *argc = out;
+}
+
+}  // namespace
+
 int main(int argc, char** argv) {
+  ParseArrowFlags(&argc, argv);
   benchmark::Initialize(&argc, argv);
   benchmark::RunSpecifiedBenchmarks();
   return 0;
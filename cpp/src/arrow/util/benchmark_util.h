@@ -17,7 +17,18 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
 #include <string>
+#include <utility>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #include "benchmark/benchmark.h"
 
@@ -52,6 +63,146 @@ struct BenchmarkArgsType<benchmark::internal::Benchmark* (
 using ArgsType =
     typename BenchmarkArgsType<decltype(&benchmark::internal::Benchmark::Args)>::type;
 
+// Hardware performance counters of the calling thread, read with
+// perf_event_open(2) on Linux.  They are only collected when the
+// ARROW_BENCHMARK_PERF_COUNTERS environment variable is set (e.g. by the
+// --arrow_perf_counters flag of Arrow's benchmark main), and may also be
+// unavailable because of kernel.perf_event_paranoid or in virtual machines.
+class PerfCounters {
+ public:
+  enum Event { CYCLES, INSTRUCTIONS, LLC_MISSES, BRANCH_MISSES, NUM_EVENTS };
+
+  static bool Requested() {
+    static const bool requested = [] {
+      const char* value = std::getenv("ARROW_BENCHMARK_PERF_COUNTERS");
+      return value != nullptr && value[0] != '\0' && std::strcmp(value, "0") != 0;
+    }();
+    return requested;
+  }
+
+  PerfCounters() {
+#ifdef __linux__
+    static const uint64_t kConfigs[NUM_EVENTS] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+    for (int i = 0; i < NUM_EVENTS; ++i) {
+      fds_[i] = -1;
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = kConfigs[i];
+      attr.disabled = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      // Scale for multiplexing if more events are requested than counters exist
+      attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      fds_[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, /*pid=*/0,
+                                         /*cpu=*/-1, /*group_fd=*/-1, /*flags=*/0));
+    }
+#endif
+  }
+
+  ~PerfCounters() {
+#ifdef __linux__
+    for (const int fd : fds_) {
+      if (fd >= 0) {
+        close(fd);
+      }
+    }
+#endif
+  }
+
+  void Start() {
+#ifdef __linux__
+    for (const int fd : fds_) {
+      if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+      }
+    }
+#endif
+  }
+
+  void Stop() {
+#ifdef __linux__
+    for (const int fd : fds_) {
+      if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+      }
+    }
+#endif
+  }
+
+  /// \brief The count of the event since Start(), or -1 if unavailable
+  double Value(Event event) const {
+#ifdef __linux__
+    uint64_t values[3];  // value, time enabled, time running
+    if (fds_[event] < 0 || read(fds_[event], values, sizeof(values)) != sizeof(values) ||
+        values[2] == 0) {
+      return -1;
+    }
+    return static_cast<double>(values[0]) * static_cast<double>(values[1]) /
+           static_cast<double>(values[2]);
+#else
+    return -1;
+#endif
+  }
+
+  /// \brief Report the counters as "cycles_per_<unit>", "IPC",
+  /// "llc_misses_per_<unit>" and "branch_misses_per_<unit>"
+  void Report(benchmark::State& state, int64_t num_units, const std::string& unit) {
+    const double cycles = Value(CYCLES);
+    const double instructions = Value(INSTRUCTIONS);
+    const double llc_misses = Value(LLC_MISSES);
+    const double branch_misses = Value(BRANCH_MISSES);
+    const double units = static_cast<double>(std::max<int64_t>(num_units, 1));
+    if (cycles >= 0) {
+      state.counters["cycles_per_" + unit] = cycles / units;
+    }
+    if (cycles > 0 && instructions >= 0) {
+      state.counters["IPC"] = instructions / cycles;
+    }
+    if (llc_misses >= 0) {
+      state.counters["llc_misses_per_" + unit] = llc_misses / units;
+    }
+    if (branch_misses >= 0) {
+      state.counters["branch_misses_per_" + unit] = branch_misses / units;
+    }
+  }
+
+ private:
+  int fds_[NUM_EVENTS];
+};
+
+// Collect PerfCounters over the lifetime of the scope if requested, and
+// report them per unit (e.g. item or byte) processed in state's iterations.
+// Construct it just before the benchmark loop, after generating the inputs.
+class PerfCountersScope {
+ public:
+  PerfCountersScope(benchmark::State& state, int64_t units_per_iteration,
+                    std::string unit = "item")
+      : state_(state), units_per_iteration_(units_per_iteration), unit_(std::move(unit)) {
+    if (PerfCounters::Requested()) {
+      counters_.reset(new PerfCounters);
+      counters_->Start();
+    }
+  }
+
+  ~PerfCountersScope() {
+    if (counters_) {
+      counters_->Stop();
+      counters_->Report(state_, state_.iterations() * units_per_iteration_, unit_);
+    }
+  }
+
+ private:
+  benchmark::State& state_;
+  int64_t units_per_iteration_;
+  std::string unit_;
+  std::unique_ptr<PerfCounters> counters_;
+};
+
 struct GenericItemsArgs {
   // number of items processed per iteration
   const int64_t size;
@@ -60,7 +211,7 @@ struct GenericItemsArgs {
   double null_proportion;
 
   explicit GenericItemsArgs(benchmark::State& state)
-      : size(state.range(0)), state_(state) {
+      : size(state.range(0)), state_(state), perf_counters_(state, size) {
     if (state.range(1) == 0) {
       this->null_proportion = 0.0;
     } else {
@@ -76,6 +227,8 @@ struct GenericItemsArgs {
 
  private:
   benchmark::State& state_;
+  // Includes the generation of the inputs, amortized over the iterations
+  PerfCountersScope perf_counters_;
 };
 
 void BenchmarkSetArgsWithSizes(benchmark::internal::Benchmark* bench,
@@ -112,7 +265,10 @@ struct RegressionArgs {
   // If size_is_bytes is true, then it's a number of bytes, otherwise it's the
   // number of items processed (for reporting)
   explicit RegressionArgs(benchmark::State& state, bool size_is_bytes = true)
-      : size(state.range(0)), state_(state), size_is_bytes_(size_is_bytes) {
+      : size(state.range(0)),
+        state_(state),
+        size_is_bytes_(size_is_bytes),
+        perf_counters_(state, size, size_is_bytes ? "byte" : "item") {
     if (state.range(1) == 0) {
       this->null_proportion = 0.0;
     } else {
@@ -133,6 +289,8 @@ struct RegressionArgs {
  private:
   benchmark::State& state_;
   bool size_is_bytes_;
+  // Includes the generation of the inputs, amortized over the iterations
+  PerfCountersScope perf_counters_;
 };
 
 }  // namespace arrow
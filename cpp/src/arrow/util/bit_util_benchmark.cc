@@ -24,6 +24,7 @@
 #include <cstring>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "arrow/array/array_base.h"
 #include "arrow/array/array_primitive.h"
@@ -141,6 +142,29 @@ static void BenchmarkBitmapAnd(benchmark::State& state) {
   });
 }
 
+// AND of four bitmaps with different offsets, as when intersecting the
+// validity of several sliced inputs
+static void BenchmarkBitmapAndMany(benchmark::State& state) {
+  const int64_t nbytes = state.range(0);
+  const int64_t offset = state.range(1);
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  std::vector<const uint8_t*> bitmaps;
+  std::vector<int64_t> offsets;
+  for (int i = 0; i < 4; ++i) {
+    buffers.push_back(CreateRandomBuffer(nbytes));
+    bitmaps.push_back(buffers.back()->data());
+    offsets.push_back(offset * i);
+  }
+  const int64_t num_bits = nbytes * 8 - offset * 3;
+  std::shared_ptr<Buffer> out = CreateRandomBuffer(nbytes);
+
+  for (auto _ : state) {
+    internal::BitmapAnd(bitmaps, offsets, num_bits, 0, out->mutable_data());
+    benchmark::DoNotOptimize(out->data());
+  }
+  state.SetBytesProcessed(state.iterations() * nbytes * 4);
+}
+
 static void BenchmarkBitmapVisitBitsetAnd(benchmark::State& state) {
   BenchmarkAndImpl(state, [](const internal::Bitmap(&bitmaps)[2], internal::Bitmap* out) {
     int64_t i = 0;
@@ -506,6 +530,7 @@ BENCHMARK(BitmapEqualsWithOffset)->Arg(kBufferSize);
     {kBufferSize * 4, kBufferSize * 16}, { 0, 2 } \
   }
 BENCHMARK(BenchmarkBitmapAnd)->Ranges(AND_BENCHMARK_RANGES);
+BENCHMARK(BenchmarkBitmapAndMany)->Ranges(AND_BENCHMARK_RANGES);
 BENCHMARK(BenchmarkBitmapVisitBitsetAnd)->Ranges(AND_BENCHMARK_RANGES);
 BENCHMARK(BenchmarkBitmapVisitUInt8And)->Ranges(AND_BENCHMARK_RANGES);
 BENCHMARK(BenchmarkBitmapVisitUInt64And)->Ranges(AND_BENCHMARK_RANGES);
@@ -1082,6 +1082,57 @@ TEST_F(BitmapOp, RandomXor) {
   }
 }
 
+TEST_F(BitmapOp, ManyBitmaps) {
+  const int64_t kMaxLength = 600;
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  for (int i = 0; i < 5; ++i) {
+    buffers.push_back(*AllocateBuffer(BitUtil::BytesForBits(kMaxLength + 80)));
+    random_bytes(buffers.back()->size(), i, buffers.back()->mutable_data());
+  }
+  auto out = *AllocateBuffer(BitUtil::BytesForBits(kMaxLength + 80));
+
+  for (int64_t length : {0, 1, 7, 64, 100, 129, 600}) {
+    for (size_t num_bitmaps : {0, 1, 2, 3, 5}) {
+      for (int64_t offset_step : {0, 1, 8, 13}) {
+        std::vector<const uint8_t*> bitmaps;
+        std::vector<int64_t> offsets;
+        for (size_t i = 0; i < num_bitmaps; ++i) {
+          bitmaps.push_back(buffers[i]->data());
+          offsets.push_back(static_cast<int64_t>(i) * offset_step);
+        }
+        for (int64_t out_offset : {0, 3, 64, 77}) {
+          for (bool is_and : {true, false}) {
+            random_bytes(out->size(), 42, out->mutable_data());
+            auto before = *out->CopySlice(0, out->size());
+            if (is_and) {
+              BitmapAnd(bitmaps, offsets, length, out_offset, out->mutable_data());
+            } else {
+              BitmapOr(bitmaps, offsets, length, out_offset, out->mutable_data());
+            }
+            for (int64_t i = 0; i < out->size() * 8; ++i) {
+              bool expected;
+              if (i < out_offset || i >= out_offset + length) {
+                // Bits outside of the output range are unchanged
+                expected = BitUtil::GetBit(before->data(), i);
+              } else {
+                expected = is_and;
+                for (size_t j = 0; j < num_bitmaps; ++j) {
+                  const bool bit =
+                      BitUtil::GetBit(bitmaps[j], offsets[j] + i - out_offset);
+                  expected = is_and ? (expected && bit) : (expected || bit);
+                }
+              }
+              ASSERT_EQ(expected, BitUtil::GetBit(out->data(), i))
+                  << "bit " << i << ", length " << length << ", bitmaps "
+                  << num_bitmaps << ", offset step " << offset_step;
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
 static inline int64_t SlowCountBits(const uint8_t* data, int64_t bit_offset,
                                     int64_t length) {
   int64_t count = 0;
@@ -1528,6 +1579,28 @@ TEST(BitStreamUtil, ZigZag) {
   TestZigZag(-std::numeric_limits<int32_t>::max());
 }
 
+static void TestZigZag64(int64_t v) {
+  uint8_t buffer[BitUtil::BitReader::kMaxVlqByteLengthForInt64] = {};
+  BitUtil::BitWriter writer(buffer, sizeof(buffer));
+  BitUtil::BitReader reader(buffer, sizeof(buffer));
+  EXPECT_TRUE(writer.PutZigZagVlqInt(v));
+  writer.Flush();
+  int64_t result;
+  EXPECT_TRUE(reader.GetZigZagVlqInt(&result));
+  EXPECT_EQ(v, result);
+}
+
+TEST(BitStreamUtil, ZigZag64) {
+  TestZigZag64(0);
+  TestZigZag64(1);
+  TestZigZag64(1234);
+  TestZigZag64(-1);
+  TestZigZag64(-1234);
+  TestZigZag64(std::numeric_limits<int32_t>::min());
+  TestZigZag64(std::numeric_limits<int64_t>::max());
+  TestZigZag64(std::numeric_limits<int64_t>::min());
+}
+
 TEST(BitUtil, RoundTripLittleEndianTest) {
   uint64_t value = 0xFF;
 
@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/result.h"
 #include "arrow/util/visibility.h"
@@ -115,6 +116,17 @@ ARROW_EXPORT
 void BitmapAnd(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out);
 
+/// \brief Do a "bitmap and" of any number of bitmaps starting at their
+/// respective bit-offsets for the given bit-length and put the results in out
+/// starting at the given bit-offset.
+///
+/// The bitmaps are combined in a single pass, rather than pairwise. If no
+/// bitmap is given, all output bits are set.
+ARROW_EXPORT
+void BitmapAnd(const std::vector<const uint8_t*>& bitmaps,
+               const std::vector<int64_t>& offsets, int64_t length, int64_t out_offset,
+               uint8_t* out);
+
 /// \brief Do a "bitmap or" for the given bit length on right and left buffers
 /// starting at their respective bit-offsets and put the results in out_buffer
 /// starting at the given bit-offset.
@@ -134,6 +146,17 @@ ARROW_EXPORT
 void BitmapOr(const uint8_t* left, int64_t left_offset, const uint8_t* right,
               int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out);
 
+/// \brief Do a "bitmap or" of any number of bitmaps starting at their
+/// respective bit-offsets for the given bit-length and put the results in out
+/// starting at the given bit-offset.
+///
+/// The bitmaps are combined in a single pass, rather than pairwise. If no
+/// bitmap is given, all output bits are cleared.
+ARROW_EXPORT
+void BitmapOr(const std::vector<const uint8_t*>& bitmaps,
+              const std::vector<int64_t>& offsets, int64_t length, int64_t out_offset,
+              uint8_t* out);
+
 /// \brief Do a "bitmap xor" for the given bit-length on right and left
 /// buffers starting at their respective bit-offsets and put the results in
 /// out_buffer starting at the given bit offset.
@@ -0,0 +1,213 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Word-at-a-time bitmap operations, compiled once per DispatchLevel. The
+// implementations for each level are templated on it so that the instantiations
+// compiled with different instruction sets are distinct symbols.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/dispatch.h"
+#include "arrow/util/ubsan.h"
+
+namespace arrow {
+namespace internal {
+
+enum class BitmapOpKind : int8_t { AND, OR, XOR, COPY, INVERT };
+
+/// \brief Apply `kind` to `num_bitmaps` bitmaps (a single one for COPY and
+/// INVERT) and write `length` bits to `out` starting at bit `out_offset`.
+///
+/// The bits of `out` outside of the written range are left unchanged.
+using BitmapOpFunc = void (*)(BitmapOpKind kind, const uint8_t* const* bitmaps,
+                              const int64_t* offsets, int num_bitmaps, int64_t length,
+                              uint8_t* out, int64_t out_offset);
+
+void BitmapOpAvx2(BitmapOpKind kind, const uint8_t* const* bitmaps,
+                  const int64_t* offsets, int num_bitmaps, int64_t length, uint8_t* out,
+                  int64_t out_offset);
+
+void BitmapOpAvx512(BitmapOpKind kind, const uint8_t* const* bitmaps,
+                    const int64_t* offsets, int num_bitmaps, int64_t length,
+                    uint8_t* out, int64_t out_offset);
+
+namespace bitmap_ops {
+
+struct And {
+  template <typename T>
+  static T Call(T left, T right) {
+    return left & right;
+  }
+};
+
+struct Or {
+  template <typename T>
+  static T Call(T left, T right) {
+    return left | right;
+  }
+};
+
+struct Xor {
+  template <typename T>
+  static T Call(T left, T right) {
+    return left ^ right;
+  }
+};
+
+// Words combined per pass over the inputs, small enough to stay in L1
+constexpr int64_t kBlockWords = 64;
+
+// Load the `nbits` (at most 8) bits of `bitmap` starting at `bit_offset`,
+// reading only the bytes holding them
+template <DispatchLevel kLevel>
+uint8_t LoadBits(const uint8_t* bitmap, int64_t bit_offset, int nbits) {
+  const uint8_t* data = bitmap + bit_offset / 8;
+  const int shift = static_cast<int>(bit_offset % 8);
+  unsigned bits = data[0] >> shift;
+  if (shift + nbits > 8) {
+    bits |= static_cast<unsigned>(data[1]) << (8 - shift);
+  }
+  return static_cast<uint8_t>(bits);
+}
+
+// Load word `i` of a bitmap starting at bit `shift` (less than 8) of `data`,
+// reading the 16 bytes from `data + 8 * i`. The funnel shift is written so that
+// a zero shift needs no branch.
+template <DispatchLevel kLevel>
+uint64_t LoadShiftedWord(const uint8_t* data, int shift, int64_t i) {
+  const uint64_t low = BitUtil::ToLittleEndian(util::SafeLoadAs<uint64_t>(data + 8 * i));
+  const uint64_t high =
+      BitUtil::ToLittleEndian(util::SafeLoadAs<uint64_t>(data + 8 * i + 8));
+  return (low >> shift) | ((high << 1) << (63 - shift));
+}
+
+// Combine, with Op, the bits at `position` of all bitmaps
+template <DispatchLevel kLevel, typename Op, bool kInvert>
+uint8_t CombineBits(const uint8_t* const* bitmaps, const int64_t* offsets,
+                    int num_bitmaps, int64_t position, int nbits) {
+  uint8_t bits = LoadBits<kLevel>(bitmaps[0], offsets[0] + position, nbits);
+  for (int k = 1; k < num_bitmaps; ++k) {
+    bits = Op::Call(bits, LoadBits<kLevel>(bitmaps[k], offsets[k] + position, nbits));
+  }
+  return kInvert ? static_cast<uint8_t>(~bits) : bits;
+}
+
+// Write the low `nbits` of `bits` at `bit_offset` of `out`, which must not
+// cross a byte boundary
+inline void StoreBits(uint8_t* out, int64_t bit_offset, uint8_t bits, int nbits) {
+  uint8_t* byte = out + bit_offset / 8;
+  const int shift = static_cast<int>(bit_offset % 8);
+  const auto mask = static_cast<uint8_t>(((1U << nbits) - 1) << shift);
+  *byte = static_cast<uint8_t>((*byte & ~mask) | ((bits << shift) & mask));
+}
+
+// The output is first aligned to a byte boundary. Whole output words are then
+// computed by blocks: each input is funnel shifted into place and folded into
+// the block in turn, in loops the compiler vectorizes for the dispatch level.
+// The remaining bits are computed a byte at a time.
+template <DispatchLevel kLevel, typename Op, bool kInvert>
+void BitmapOpImpl(const uint8_t* const* bitmaps, const int64_t* offsets, int num_bitmaps,
+                  int64_t length, uint8_t* out, int64_t out_offset) {
+  int64_t position = 0;
+
+  if (out_offset % 8 != 0 && length > 0) {
+    const int nbits = static_cast<int>(std::min<int64_t>(length, 8 - out_offset % 8));
+    StoreBits(out, out_offset,
+              CombineBits<kLevel, Op, kInvert>(bitmaps, offsets, num_bitmaps, 0, nbits),
+              nbits);
+    position = nbits;
+  }
+
+  // Stop before the word whose high half would be read past the last byte
+  // of any input
+  int64_t num_words = (length - position) / 64;
+  for (int k = 0; k < num_bitmaps; ++k) {
+    const int64_t input_bytes =
+        BitUtil::BytesForBits((offsets[k] + position) % 8 + length - position);
+    num_words = std::max<int64_t>(0, std::min(num_words, input_bytes / 8 - 1));
+  }
+
+  uint64_t block[kBlockWords];
+  for (int64_t word = 0; word < num_words; word += kBlockWords) {
+    const int64_t block_length = std::min(kBlockWords, num_words - word);
+    const int64_t block_position = position + word * 64;
+    {
+      const int64_t offset = offsets[0] + block_position;
+      const uint8_t* data = bitmaps[0] + offset / 8;
+      const int shift = static_cast<int>(offset % 8);
+      for (int64_t i = 0; i < block_length; ++i) {
+        block[i] = LoadShiftedWord<kLevel>(data, shift, i);
+      }
+    }
+    for (int k = 1; k < num_bitmaps; ++k) {
+      const int64_t offset = offsets[k] + block_position;
+      const uint8_t* data = bitmaps[k] + offset / 8;
+      const int shift = static_cast<int>(offset % 8);
+      for (int64_t i = 0; i < block_length; ++i) {
+        block[i] = Op::Call(block[i], LoadShiftedWord<kLevel>(data, shift, i));
+      }
+    }
+    uint8_t* dest = out + (out_offset + block_position) / 8;
+    for (int64_t i = 0; i < block_length; ++i) {
+      util::SafeStore(dest + 8 * i,
+                      BitUtil::FromLittleEndian(kInvert ? ~block[i] : block[i]));
+    }
+  }
+  position += num_words * 64;
+
+  for (; position + 8 <= length; position += 8) {
+    out[(out_offset + position) / 8] =
+        CombineBits<kLevel, Op, kInvert>(bitmaps, offsets, num_bitmaps, position, 8);
+  }
+  if (position < length) {
+    const int nbits = static_cast<int>(length - position);
+    StoreBits(out, out_offset + position,
+              CombineBits<kLevel, Op, kInvert>(bitmaps, offsets, num_bitmaps, position,
+                                               nbits),
+              nbits);
+  }
+}
+
+template <DispatchLevel kLevel>
+void BitmapOp(BitmapOpKind kind, const uint8_t* const* bitmaps, const int64_t* offsets,
+              int num_bitmaps, int64_t length, uint8_t* out, int64_t out_offset) {
+  switch (kind) {
+    case BitmapOpKind::AND:
+      return BitmapOpImpl<kLevel, And, false>(bitmaps, offsets, num_bitmaps, length, out,
+                                              out_offset);
+    case BitmapOpKind::OR:
+      return BitmapOpImpl<kLevel, Or, false>(bitmaps, offsets, num_bitmaps, length, out,
+                                             out_offset);
+    case BitmapOpKind::XOR:
+      return BitmapOpImpl<kLevel, Xor, false>(bitmaps, offsets, num_bitmaps, length, out,
+                                              out_offset);
+    case BitmapOpKind::COPY:
+      return BitmapOpImpl<kLevel, And, false>(bitmaps, offsets, 1, length, out,
+                                              out_offset);
+    case BitmapOpKind::INVERT:
+      return BitmapOpImpl<kLevel, And, true>(bitmaps, offsets, 1, length, out,
+                                             out_offset);
+  }
+}
+
+}  // namespace bitmap_ops
+}  // namespace internal
+}  // namespace arrow
@@ -27,6 +27,9 @@
 #if defined(ARROW_HAVE_RUNTIME_AVX512)
 #include "arrow/util/bpacking_avx512.h"
 #endif
+#if defined(ARROW_HAVE_NEON)
+#include "arrow/util/bpacking_neon.h"
+#endif
 
 namespace arrow {
 namespace internal {
@@ -155,6 +158,9 @@ struct Unpack32DynamicFunction {
 #endif
 #if defined(ARROW_HAVE_RUNTIME_AVX512)
       , { DispatchLevel::AVX512, unpack32_avx512 }
+#endif
+#if defined(ARROW_HAVE_NEON)
+      , { DispatchLevel::NEON, unpack32_neon }
 #endif
     };
   }
@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "arrow/util/bpacking.h"
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#include "arrow/util/bpacking_avx2.h"
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+#include "arrow/util/bpacking_avx512.h"
+#endif
+#if defined(ARROW_HAVE_NEON)
+#include "arrow/util/bpacking_neon.h"
+#endif
+
+namespace arrow {
+namespace internal {
+
+using UnpackFunc = int (*)(const uint32_t*, uint32_t*, int, int);
+
+constexpr int kNumValues = 32 * 1024;
+
+static void BenchmarkUnpack32(benchmark::State& state,  // NOLINT non-const reference
+                              UnpackFunc unpack) {
+  const int num_bits = static_cast<int>(state.range(0));
+  std::vector<uint32_t> packed(kNumValues * num_bits / 32 + 1);
+  std::mt19937 rng(42);
+  for (auto& word : packed) {
+    word = static_cast<uint32_t>(rng());
+  }
+  std::vector<uint32_t> unpacked(kNumValues);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(unpack(packed.data(), unpacked.data(), kNumValues, num_bits));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kNumValues);
+}
+
+static void BM_Unpack32(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkUnpack32(state, unpack32);
+}
+
+BENCHMARK(BM_Unpack32)->DenseRange(1, 32, 1);
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+static void BM_Unpack32_Avx2(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkUnpack32(state, unpack32_avx2);
+}
+
+BENCHMARK(BM_Unpack32_Avx2)->DenseRange(1, 32, 1);
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+static void BM_Unpack32_Avx512(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkUnpack32(state, unpack32_avx512);
+}
+
+BENCHMARK(BM_Unpack32_Avx512)->DenseRange(1, 32, 1);
+#endif
+
+#if defined(ARROW_HAVE_NEON)
+static void BM_Unpack32_Neon(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkUnpack32(state, unpack32_neon);
+}
+
+BENCHMARK(BM_Unpack32_Neon)->DenseRange(1, 32, 1);
+#endif
+
+}  // namespace internal
+}  // namespace arrow
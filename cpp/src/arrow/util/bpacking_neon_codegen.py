@@ -0,0 +1,159 @@
+#!/bin/python
+
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+
+# Usage: python bpacking_neon_codegen.py > bpacking_neon_generated.h
+
+ORDINALS = ["first", "second", "third", "fourth",
+            "fifth", "sixth", "seventh", "last"]
+
+
+def print_unpack_bit_func(bit):
+    shift = 0
+    shifts = []
+    in_index = 0
+    inls = []
+    mask = (1 << bit) - 1
+    bracket = "{"
+
+    print(
+        f"inline const uint32_t* unpack{bit}_32_neon(const uint32_t* in, uint32_t* out) {bracket}")
+    print("  uint32_t mask = 0x%x;" % mask)
+    print("  uint32_t ind[4];")
+    print("  int32_t shifts[4];")
+    print("  int32x4_t reg_shifts;")
+    print("  uint32x4_t reg_inls, reg_masks;")
+    print("  uint32x4_t results;")
+
+    print("")
+    for i in range(32):
+        if shift + bit == 32:
+            shifts.append(shift)
+            inls.append(f"in[{in_index}]")
+            in_index += 1
+            shift = 0
+        elif shift + bit > 32:  # cross the boundary
+            inls.append(
+                f"in[{in_index}] >> {shift} | in[{in_index + 1}] << {32 - shift}")
+            in_index += 1
+            shift = bit - (32 - shift)
+            shifts.append(0)  # zero shift
+        else:
+            shifts.append(shift)
+            inls.append(f"in[{in_index}]")
+            shift += bit
+
+    print("  reg_masks = vdupq_n_u32(mask);")
+
+    for group in range(8):
+        base = group * 4
+        print("")
+        print(f"  // shift the {ORDINALS[group]} 4 outs")
+        # Negative shift counts shift to the right
+        print("  shifts[0] = %d;" % -shifts[base])
+        print("  shifts[1] = %d;" % -shifts[base + 1])
+        print("  shifts[2] = %d;" % -shifts[base + 2])
+        print("  shifts[3] = %d;" % -shifts[base + 3])
+        for j in range(4):
+            print(f"  ind[{j}] = {inls[base + j]};")
+        print("  reg_shifts = vld1q_s32(shifts);")
+        print("  reg_inls = vld1q_u32(ind);")
+        print("  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);")
+        print("  vst1q_u32(out, results);")
+        print("  out += 4;")
+
+    print("")
+    print(f"  in += {bit};")
+    print("")
+    print("  return in;")
+    print("}")
+
+
+def print_unpack_bit0_func():
+    print(
+        "inline const uint32_t* unpack0_32_neon(const uint32_t* in, uint32_t* out) {")
+    print("  memset(out, 0x0, 32 * sizeof(*out));")
+    print("  out += 32;")
+    print("")
+    print("  return in;")
+    print("}")
+
+
+def print_unpack_bit32_func():
+    print(
+        "inline const uint32_t* unpack32_32_neon(const uint32_t* in, uint32_t* out) {")
+    print("  memcpy(out, in, 32 * sizeof(*out));")
+    print("  in += 32;")
+    print("  out += 32;")
+    print("")
+    print("  return in;")
+    print("}")
+
+
+def print_copyright():
+    print(
+        """// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.""")
+
+
+def print_note():
+    print("//")
+    print("// Automatically generated file; DO NOT EDIT.")
+
+
+def main():
+    print_copyright()
+    print_note()
+    print("")
+    print("#pragma once")
+    print("")
+    print("#include <stdint.h>")
+    print("#include <string.h>")
+    print("")
+    print("#include \"arrow/util/simd.h\"")
+    print("")
+    print("namespace arrow {")
+    print("namespace internal {")
+    print("")
+    print_unpack_bit0_func()
+    print("")
+    for i in range(1, 32):
+        print_unpack_bit_func(i)
+        print("")
+    print_unpack_bit32_func()
+    print("")
+    print("}  // namespace internal")
+    print("}  // namespace arrow")
+
+
+if __name__ == '__main__':
+    main()
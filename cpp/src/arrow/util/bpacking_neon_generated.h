@@ -0,0 +1,4231 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+//
+// Automatically generated file; DO NOT EDIT.
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include "arrow/util/simd.h"
+
+namespace arrow {
+namespace internal {
+
+inline const uint32_t* unpack0_32_neon(const uint32_t* in, uint32_t* out) {
+  memset(out, 0x0, 32 * sizeof(*out));
+  out += 32;
+
+  return in;
+}
+
+inline const uint32_t* unpack1_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0x1;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = -1;
+  shifts[2] = -2;
+  shifts[3] = -3;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0];
+  ind[3] = in[0];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = -4;
+  shifts[1] = -5;
+  shifts[2] = -6;
+  shifts[3] = -7;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0];
+  ind[3] = in[0];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = -8;
+  shifts[1] = -9;
+  shifts[2] = -10;
+  shifts[3] = -11;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0];
+  ind[3] = in[0];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = -12;
+  shifts[1] = -13;
+  shifts[2] = -14;
+  shifts[3] = -15;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0];
+  ind[3] = in[0];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = -16;
+  shifts[1] = -17;
+  shifts[2] = -18;
+  shifts[3] = -19;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0];
+  ind[3] = in[0];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = -20;
+  shifts[1] = -21;
+  shifts[2] = -22;
+  shifts[3] = -23;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0];
+  ind[3] = in[0];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = -24;
+  shifts[1] = -25;
+  shifts[2] = -26;
+  shifts[3] = -27;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0];
+  ind[3] = in[0];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = -28;
+  shifts[1] = -29;
+  shifts[2] = -30;
+  shifts[3] = -31;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0];
+  ind[3] = in[0];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 1;
+
+  return in;
+}
+
+inline const uint32_t* unpack2_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0x3;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = -2;
+  shifts[2] = -4;
+  shifts[3] = -6;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0];
+  ind[3] = in[0];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = -8;
+  shifts[1] = -10;
+  shifts[2] = -12;
+  shifts[3] = -14;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0];
+  ind[3] = in[0];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = -16;
+  shifts[1] = -18;
+  shifts[2] = -20;
+  shifts[3] = -22;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0];
+  ind[3] = in[0];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = -24;
+  shifts[1] = -26;
+  shifts[2] = -28;
+  shifts[3] = -30;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0];
+  ind[3] = in[0];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -2;
+  shifts[2] = -4;
+  shifts[3] = -6;
+  ind[0] = in[1];
+  ind[1] = in[1];
+  ind[2] = in[1];
+  ind[3] = in[1];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = -8;
+  shifts[1] = -10;
+  shifts[2] = -12;
+  shifts[3] = -14;
+  ind[0] = in[1];
+  ind[1] = in[1];
+  ind[2] = in[1];
+  ind[3] = in[1];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = -16;
+  shifts[1] = -18;
+  shifts[2] = -20;
+  shifts[3] = -22;
+  ind[0] = in[1];
+  ind[1] = in[1];
+  ind[2] = in[1];
+  ind[3] = in[1];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = -24;
+  shifts[1] = -26;
+  shifts[2] = -28;
+  shifts[3] = -30;
+  ind[0] = in[1];
+  ind[1] = in[1];
+  ind[2] = in[1];
+  ind[3] = in[1];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 2;
+
+  return in;
+}
+
+inline const uint32_t* unpack3_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0x7;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = -3;
+  shifts[2] = -6;
+  shifts[3] = -9;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0];
+  ind[3] = in[0];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = -12;
+  shifts[1] = -15;
+  shifts[2] = -18;
+  shifts[3] = -21;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0];
+  ind[3] = in[0];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = -24;
+  shifts[1] = -27;
+  shifts[2] = 0;
+  shifts[3] = -1;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0] >> 30 | in[1] << 2;
+  ind[3] = in[1];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = -4;
+  shifts[1] = -7;
+  shifts[2] = -10;
+  shifts[3] = -13;
+  ind[0] = in[1];
+  ind[1] = in[1];
+  ind[2] = in[1];
+  ind[3] = in[1];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = -16;
+  shifts[1] = -19;
+  shifts[2] = -22;
+  shifts[3] = -25;
+  ind[0] = in[1];
+  ind[1] = in[1];
+  ind[2] = in[1];
+  ind[3] = in[1];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = -28;
+  shifts[1] = 0;
+  shifts[2] = -2;
+  shifts[3] = -5;
+  ind[0] = in[1];
+  ind[1] = in[1] >> 31 | in[2] << 1;
+  ind[2] = in[2];
+  ind[3] = in[2];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = -8;
+  shifts[1] = -11;
+  shifts[2] = -14;
+  shifts[3] = -17;
+  ind[0] = in[2];
+  ind[1] = in[2];
+  ind[2] = in[2];
+  ind[3] = in[2];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = -20;
+  shifts[1] = -23;
+  shifts[2] = -26;
+  shifts[3] = -29;
+  ind[0] = in[2];
+  ind[1] = in[2];
+  ind[2] = in[2];
+  ind[3] = in[2];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 3;
+
+  return in;
+}
+
+inline const uint32_t* unpack4_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0xf;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = -4;
+  shifts[2] = -8;
+  shifts[3] = -12;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0];
+  ind[3] = in[0];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = -16;
+  shifts[1] = -20;
+  shifts[2] = -24;
+  shifts[3] = -28;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0];
+  ind[3] = in[0];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = 0;
+  shifts[1] = -4;
+  shifts[2] = -8;
+  shifts[3] = -12;
+  ind[0] = in[1];
+  ind[1] = in[1];
+  ind[2] = in[1];
+  ind[3] = in[1];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = -16;
+  shifts[1] = -20;
+  shifts[2] = -24;
+  shifts[3] = -28;
+  ind[0] = in[1];
+  ind[1] = in[1];
+  ind[2] = in[1];
+  ind[3] = in[1];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -4;
+  shifts[2] = -8;
+  shifts[3] = -12;
+  ind[0] = in[2];
+  ind[1] = in[2];
+  ind[2] = in[2];
+  ind[3] = in[2];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = -16;
+  shifts[1] = -20;
+  shifts[2] = -24;
+  shifts[3] = -28;
+  ind[0] = in[2];
+  ind[1] = in[2];
+  ind[2] = in[2];
+  ind[3] = in[2];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = 0;
+  shifts[1] = -4;
+  shifts[2] = -8;
+  shifts[3] = -12;
+  ind[0] = in[3];
+  ind[1] = in[3];
+  ind[2] = in[3];
+  ind[3] = in[3];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = -16;
+  shifts[1] = -20;
+  shifts[2] = -24;
+  shifts[3] = -28;
+  ind[0] = in[3];
+  ind[1] = in[3];
+  ind[2] = in[3];
+  ind[3] = in[3];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 4;
+
+  return in;
+}
+
+inline const uint32_t* unpack5_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0x1f;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = -5;
+  shifts[2] = -10;
+  shifts[3] = -15;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0];
+  ind[3] = in[0];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = -20;
+  shifts[1] = -25;
+  shifts[2] = 0;
+  shifts[3] = -3;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0] >> 30 | in[1] << 2;
+  ind[3] = in[1];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = -8;
+  shifts[1] = -13;
+  shifts[2] = -18;
+  shifts[3] = -23;
+  ind[0] = in[1];
+  ind[1] = in[1];
+  ind[2] = in[1];
+  ind[3] = in[1];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -1;
+  shifts[2] = -6;
+  shifts[3] = -11;
+  ind[0] = in[1] >> 28 | in[2] << 4;
+  ind[1] = in[2];
+  ind[2] = in[2];
+  ind[3] = in[2];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = -16;
+  shifts[1] = -21;
+  shifts[2] = -26;
+  shifts[3] = 0;
+  ind[0] = in[2];
+  ind[1] = in[2];
+  ind[2] = in[2];
+  ind[3] = in[2] >> 31 | in[3] << 1;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = -4;
+  shifts[1] = -9;
+  shifts[2] = -14;
+  shifts[3] = -19;
+  ind[0] = in[3];
+  ind[1] = in[3];
+  ind[2] = in[3];
+  ind[3] = in[3];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = -24;
+  shifts[1] = 0;
+  shifts[2] = -2;
+  shifts[3] = -7;
+  ind[0] = in[3];
+  ind[1] = in[3] >> 29 | in[4] << 3;
+  ind[2] = in[4];
+  ind[3] = in[4];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = -12;
+  shifts[1] = -17;
+  shifts[2] = -22;
+  shifts[3] = -27;
+  ind[0] = in[4];
+  ind[1] = in[4];
+  ind[2] = in[4];
+  ind[3] = in[4];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 5;
+
+  return in;
+}
+
+inline const uint32_t* unpack6_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0x3f;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = -6;
+  shifts[2] = -12;
+  shifts[3] = -18;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0];
+  ind[3] = in[0];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = -24;
+  shifts[1] = 0;
+  shifts[2] = -4;
+  shifts[3] = -10;
+  ind[0] = in[0];
+  ind[1] = in[0] >> 30 | in[1] << 2;
+  ind[2] = in[1];
+  ind[3] = in[1];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = -16;
+  shifts[1] = -22;
+  shifts[2] = 0;
+  shifts[3] = -2;
+  ind[0] = in[1];
+  ind[1] = in[1];
+  ind[2] = in[1] >> 28 | in[2] << 4;
+  ind[3] = in[2];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = -8;
+  shifts[1] = -14;
+  shifts[2] = -20;
+  shifts[3] = -26;
+  ind[0] = in[2];
+  ind[1] = in[2];
+  ind[2] = in[2];
+  ind[3] = in[2];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -6;
+  shifts[2] = -12;
+  shifts[3] = -18;
+  ind[0] = in[3];
+  ind[1] = in[3];
+  ind[2] = in[3];
+  ind[3] = in[3];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = -24;
+  shifts[1] = 0;
+  shifts[2] = -4;
+  shifts[3] = -10;
+  ind[0] = in[3];
+  ind[1] = in[3] >> 30 | in[4] << 2;
+  ind[2] = in[4];
+  ind[3] = in[4];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = -16;
+  shifts[1] = -22;
+  shifts[2] = 0;
+  shifts[3] = -2;
+  ind[0] = in[4];
+  ind[1] = in[4];
+  ind[2] = in[4] >> 28 | in[5] << 4;
+  ind[3] = in[5];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = -8;
+  shifts[1] = -14;
+  shifts[2] = -20;
+  shifts[3] = -26;
+  ind[0] = in[5];
+  ind[1] = in[5];
+  ind[2] = in[5];
+  ind[3] = in[5];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 6;
+
+  return in;
+}
+
+inline const uint32_t* unpack7_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0x7f;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = -7;
+  shifts[2] = -14;
+  shifts[3] = -21;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0];
+  ind[3] = in[0];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = 0;
+  shifts[1] = -3;
+  shifts[2] = -10;
+  shifts[3] = -17;
+  ind[0] = in[0] >> 28 | in[1] << 4;
+  ind[1] = in[1];
+  ind[2] = in[1];
+  ind[3] = in[1];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = -24;
+  shifts[1] = 0;
+  shifts[2] = -6;
+  shifts[3] = -13;
+  ind[0] = in[1];
+  ind[1] = in[1] >> 31 | in[2] << 1;
+  ind[2] = in[2];
+  ind[3] = in[2];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = -20;
+  shifts[1] = 0;
+  shifts[2] = -2;
+  shifts[3] = -9;
+  ind[0] = in[2];
+  ind[1] = in[2] >> 27 | in[3] << 5;
+  ind[2] = in[3];
+  ind[3] = in[3];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = -16;
+  shifts[1] = -23;
+  shifts[2] = 0;
+  shifts[3] = -5;
+  ind[0] = in[3];
+  ind[1] = in[3];
+  ind[2] = in[3] >> 30 | in[4] << 2;
+  ind[3] = in[4];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = -12;
+  shifts[1] = -19;
+  shifts[2] = 0;
+  shifts[3] = -1;
+  ind[0] = in[4];
+  ind[1] = in[4];
+  ind[2] = in[4] >> 26 | in[5] << 6;
+  ind[3] = in[5];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = -8;
+  shifts[1] = -15;
+  shifts[2] = -22;
+  shifts[3] = 0;
+  ind[0] = in[5];
+  ind[1] = in[5];
+  ind[2] = in[5];
+  ind[3] = in[5] >> 29 | in[6] << 3;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = -4;
+  shifts[1] = -11;
+  shifts[2] = -18;
+  shifts[3] = -25;
+  ind[0] = in[6];
+  ind[1] = in[6];
+  ind[2] = in[6];
+  ind[3] = in[6];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 7;
+
+  return in;
+}
+
+inline const uint32_t* unpack8_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0xff;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = -8;
+  shifts[2] = -16;
+  shifts[3] = -24;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0];
+  ind[3] = in[0];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = 0;
+  shifts[1] = -8;
+  shifts[2] = -16;
+  shifts[3] = -24;
+  ind[0] = in[1];
+  ind[1] = in[1];
+  ind[2] = in[1];
+  ind[3] = in[1];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = 0;
+  shifts[1] = -8;
+  shifts[2] = -16;
+  shifts[3] = -24;
+  ind[0] = in[2];
+  ind[1] = in[2];
+  ind[2] = in[2];
+  ind[3] = in[2];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -8;
+  shifts[2] = -16;
+  shifts[3] = -24;
+  ind[0] = in[3];
+  ind[1] = in[3];
+  ind[2] = in[3];
+  ind[3] = in[3];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -8;
+  shifts[2] = -16;
+  shifts[3] = -24;
+  ind[0] = in[4];
+  ind[1] = in[4];
+  ind[2] = in[4];
+  ind[3] = in[4];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -8;
+  shifts[2] = -16;
+  shifts[3] = -24;
+  ind[0] = in[5];
+  ind[1] = in[5];
+  ind[2] = in[5];
+  ind[3] = in[5];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = 0;
+  shifts[1] = -8;
+  shifts[2] = -16;
+  shifts[3] = -24;
+  ind[0] = in[6];
+  ind[1] = in[6];
+  ind[2] = in[6];
+  ind[3] = in[6];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = 0;
+  shifts[1] = -8;
+  shifts[2] = -16;
+  shifts[3] = -24;
+  ind[0] = in[7];
+  ind[1] = in[7];
+  ind[2] = in[7];
+  ind[3] = in[7];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 8;
+
+  return in;
+}
+
+inline const uint32_t* unpack9_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0x1ff;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = -9;
+  shifts[2] = -18;
+  shifts[3] = 0;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0];
+  ind[3] = in[0] >> 27 | in[1] << 5;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = -4;
+  shifts[1] = -13;
+  shifts[2] = -22;
+  shifts[3] = 0;
+  ind[0] = in[1];
+  ind[1] = in[1];
+  ind[2] = in[1];
+  ind[3] = in[1] >> 31 | in[2] << 1;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = -8;
+  shifts[1] = -17;
+  shifts[2] = 0;
+  shifts[3] = -3;
+  ind[0] = in[2];
+  ind[1] = in[2];
+  ind[2] = in[2] >> 26 | in[3] << 6;
+  ind[3] = in[3];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = -12;
+  shifts[1] = -21;
+  shifts[2] = 0;
+  shifts[3] = -7;
+  ind[0] = in[3];
+  ind[1] = in[3];
+  ind[2] = in[3] >> 30 | in[4] << 2;
+  ind[3] = in[4];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = -16;
+  shifts[1] = 0;
+  shifts[2] = -2;
+  shifts[3] = -11;
+  ind[0] = in[4];
+  ind[1] = in[4] >> 25 | in[5] << 7;
+  ind[2] = in[5];
+  ind[3] = in[5];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = -20;
+  shifts[1] = 0;
+  shifts[2] = -6;
+  shifts[3] = -15;
+  ind[0] = in[5];
+  ind[1] = in[5] >> 29 | in[6] << 3;
+  ind[2] = in[6];
+  ind[3] = in[6];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = 0;
+  shifts[1] = -1;
+  shifts[2] = -10;
+  shifts[3] = -19;
+  ind[0] = in[6] >> 24 | in[7] << 8;
+  ind[1] = in[7];
+  ind[2] = in[7];
+  ind[3] = in[7];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = 0;
+  shifts[1] = -5;
+  shifts[2] = -14;
+  shifts[3] = -23;
+  ind[0] = in[7] >> 28 | in[8] << 4;
+  ind[1] = in[8];
+  ind[2] = in[8];
+  ind[3] = in[8];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 9;
+
+  return in;
+}
+
+inline const uint32_t* unpack10_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0x3ff;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = -10;
+  shifts[2] = -20;
+  shifts[3] = 0;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0];
+  ind[3] = in[0] >> 30 | in[1] << 2;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = -8;
+  shifts[1] = -18;
+  shifts[2] = 0;
+  shifts[3] = -6;
+  ind[0] = in[1];
+  ind[1] = in[1];
+  ind[2] = in[1] >> 28 | in[2] << 4;
+  ind[3] = in[2];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = -16;
+  shifts[1] = 0;
+  shifts[2] = -4;
+  shifts[3] = -14;
+  ind[0] = in[2];
+  ind[1] = in[2] >> 26 | in[3] << 6;
+  ind[2] = in[3];
+  ind[3] = in[3];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -2;
+  shifts[2] = -12;
+  shifts[3] = -22;
+  ind[0] = in[3] >> 24 | in[4] << 8;
+  ind[1] = in[4];
+  ind[2] = in[4];
+  ind[3] = in[4];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -10;
+  shifts[2] = -20;
+  shifts[3] = 0;
+  ind[0] = in[5];
+  ind[1] = in[5];
+  ind[2] = in[5];
+  ind[3] = in[5] >> 30 | in[6] << 2;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = -8;
+  shifts[1] = -18;
+  shifts[2] = 0;
+  shifts[3] = -6;
+  ind[0] = in[6];
+  ind[1] = in[6];
+  ind[2] = in[6] >> 28 | in[7] << 4;
+  ind[3] = in[7];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = -16;
+  shifts[1] = 0;
+  shifts[2] = -4;
+  shifts[3] = -14;
+  ind[0] = in[7];
+  ind[1] = in[7] >> 26 | in[8] << 6;
+  ind[2] = in[8];
+  ind[3] = in[8];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = 0;
+  shifts[1] = -2;
+  shifts[2] = -12;
+  shifts[3] = -22;
+  ind[0] = in[8] >> 24 | in[9] << 8;
+  ind[1] = in[9];
+  ind[2] = in[9];
+  ind[3] = in[9];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 10;
+
+  return in;
+}
+
+inline const uint32_t* unpack11_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0x7ff;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = -11;
+  shifts[2] = 0;
+  shifts[3] = -1;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0] >> 22 | in[1] << 10;
+  ind[3] = in[1];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = -12;
+  shifts[1] = 0;
+  shifts[2] = -2;
+  shifts[3] = -13;
+  ind[0] = in[1];
+  ind[1] = in[1] >> 23 | in[2] << 9;
+  ind[2] = in[2];
+  ind[3] = in[2];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = 0;
+  shifts[1] = -3;
+  shifts[2] = -14;
+  shifts[3] = 0;
+  ind[0] = in[2] >> 24 | in[3] << 8;
+  ind[1] = in[3];
+  ind[2] = in[3];
+  ind[3] = in[3] >> 25 | in[4] << 7;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = -4;
+  shifts[1] = -15;
+  shifts[2] = 0;
+  shifts[3] = -5;
+  ind[0] = in[4];
+  ind[1] = in[4];
+  ind[2] = in[4] >> 26 | in[5] << 6;
+  ind[3] = in[5];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = -16;
+  shifts[1] = 0;
+  shifts[2] = -6;
+  shifts[3] = -17;
+  ind[0] = in[5];
+  ind[1] = in[5] >> 27 | in[6] << 5;
+  ind[2] = in[6];
+  ind[3] = in[6];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -7;
+  shifts[2] = -18;
+  shifts[3] = 0;
+  ind[0] = in[6] >> 28 | in[7] << 4;
+  ind[1] = in[7];
+  ind[2] = in[7];
+  ind[3] = in[7] >> 29 | in[8] << 3;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = -8;
+  shifts[1] = -19;
+  shifts[2] = 0;
+  shifts[3] = -9;
+  ind[0] = in[8];
+  ind[1] = in[8];
+  ind[2] = in[8] >> 30 | in[9] << 2;
+  ind[3] = in[9];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = -20;
+  shifts[1] = 0;
+  shifts[2] = -10;
+  shifts[3] = -21;
+  ind[0] = in[9];
+  ind[1] = in[9] >> 31 | in[10] << 1;
+  ind[2] = in[10];
+  ind[3] = in[10];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 11;
+
+  return in;
+}
+
+inline const uint32_t* unpack12_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0xfff;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = -12;
+  shifts[2] = 0;
+  shifts[3] = -4;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0] >> 24 | in[1] << 8;
+  ind[3] = in[1];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = -16;
+  shifts[1] = 0;
+  shifts[2] = -8;
+  shifts[3] = -20;
+  ind[0] = in[1];
+  ind[1] = in[1] >> 28 | in[2] << 4;
+  ind[2] = in[2];
+  ind[3] = in[2];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = 0;
+  shifts[1] = -12;
+  shifts[2] = 0;
+  shifts[3] = -4;
+  ind[0] = in[3];
+  ind[1] = in[3];
+  ind[2] = in[3] >> 24 | in[4] << 8;
+  ind[3] = in[4];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = -16;
+  shifts[1] = 0;
+  shifts[2] = -8;
+  shifts[3] = -20;
+  ind[0] = in[4];
+  ind[1] = in[4] >> 28 | in[5] << 4;
+  ind[2] = in[5];
+  ind[3] = in[5];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -12;
+  shifts[2] = 0;
+  shifts[3] = -4;
+  ind[0] = in[6];
+  ind[1] = in[6];
+  ind[2] = in[6] >> 24 | in[7] << 8;
+  ind[3] = in[7];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = -16;
+  shifts[1] = 0;
+  shifts[2] = -8;
+  shifts[3] = -20;
+  ind[0] = in[7];
+  ind[1] = in[7] >> 28 | in[8] << 4;
+  ind[2] = in[8];
+  ind[3] = in[8];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = 0;
+  shifts[1] = -12;
+  shifts[2] = 0;
+  shifts[3] = -4;
+  ind[0] = in[9];
+  ind[1] = in[9];
+  ind[2] = in[9] >> 24 | in[10] << 8;
+  ind[3] = in[10];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = -16;
+  shifts[1] = 0;
+  shifts[2] = -8;
+  shifts[3] = -20;
+  ind[0] = in[10];
+  ind[1] = in[10] >> 28 | in[11] << 4;
+  ind[2] = in[11];
+  ind[3] = in[11];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 12;
+
+  return in;
+}
+
+inline const uint32_t* unpack13_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0x1fff;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = -13;
+  shifts[2] = 0;
+  shifts[3] = -7;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0] >> 26 | in[1] << 6;
+  ind[3] = in[1];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = 0;
+  shifts[1] = -1;
+  shifts[2] = -14;
+  shifts[3] = 0;
+  ind[0] = in[1] >> 20 | in[2] << 12;
+  ind[1] = in[2];
+  ind[2] = in[2];
+  ind[3] = in[2] >> 27 | in[3] << 5;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = -8;
+  shifts[1] = 0;
+  shifts[2] = -2;
+  shifts[3] = -15;
+  ind[0] = in[3];
+  ind[1] = in[3] >> 21 | in[4] << 11;
+  ind[2] = in[4];
+  ind[3] = in[4];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -9;
+  shifts[2] = 0;
+  shifts[3] = -3;
+  ind[0] = in[4] >> 28 | in[5] << 4;
+  ind[1] = in[5];
+  ind[2] = in[5] >> 22 | in[6] << 10;
+  ind[3] = in[6];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = -16;
+  shifts[1] = 0;
+  shifts[2] = -10;
+  shifts[3] = 0;
+  ind[0] = in[6];
+  ind[1] = in[6] >> 29 | in[7] << 3;
+  ind[2] = in[7];
+  ind[3] = in[7] >> 23 | in[8] << 9;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = -4;
+  shifts[1] = -17;
+  shifts[2] = 0;
+  shifts[3] = -11;
+  ind[0] = in[8];
+  ind[1] = in[8];
+  ind[2] = in[8] >> 30 | in[9] << 2;
+  ind[3] = in[9];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = 0;
+  shifts[1] = -5;
+  shifts[2] = -18;
+  shifts[3] = 0;
+  ind[0] = in[9] >> 24 | in[10] << 8;
+  ind[1] = in[10];
+  ind[2] = in[10];
+  ind[3] = in[10] >> 31 | in[11] << 1;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = -12;
+  shifts[1] = 0;
+  shifts[2] = -6;
+  shifts[3] = -19;
+  ind[0] = in[11];
+  ind[1] = in[11] >> 25 | in[12] << 7;
+  ind[2] = in[12];
+  ind[3] = in[12];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 13;
+
+  return in;
+}
+
+inline const uint32_t* unpack14_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0x3fff;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = -14;
+  shifts[2] = 0;
+  shifts[3] = -10;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0] >> 28 | in[1] << 4;
+  ind[3] = in[1];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = 0;
+  shifts[1] = -6;
+  shifts[2] = 0;
+  shifts[3] = -2;
+  ind[0] = in[1] >> 24 | in[2] << 8;
+  ind[1] = in[2];
+  ind[2] = in[2] >> 20 | in[3] << 12;
+  ind[3] = in[3];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = -16;
+  shifts[1] = 0;
+  shifts[2] = -12;
+  shifts[3] = 0;
+  ind[0] = in[3];
+  ind[1] = in[3] >> 30 | in[4] << 2;
+  ind[2] = in[4];
+  ind[3] = in[4] >> 26 | in[5] << 6;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = -8;
+  shifts[1] = 0;
+  shifts[2] = -4;
+  shifts[3] = -18;
+  ind[0] = in[5];
+  ind[1] = in[5] >> 22 | in[6] << 10;
+  ind[2] = in[6];
+  ind[3] = in[6];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -14;
+  shifts[2] = 0;
+  shifts[3] = -10;
+  ind[0] = in[7];
+  ind[1] = in[7];
+  ind[2] = in[7] >> 28 | in[8] << 4;
+  ind[3] = in[8];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -6;
+  shifts[2] = 0;
+  shifts[3] = -2;
+  ind[0] = in[8] >> 24 | in[9] << 8;
+  ind[1] = in[9];
+  ind[2] = in[9] >> 20 | in[10] << 12;
+  ind[3] = in[10];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = -16;
+  shifts[1] = 0;
+  shifts[2] = -12;
+  shifts[3] = 0;
+  ind[0] = in[10];
+  ind[1] = in[10] >> 30 | in[11] << 2;
+  ind[2] = in[11];
+  ind[3] = in[11] >> 26 | in[12] << 6;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = -8;
+  shifts[1] = 0;
+  shifts[2] = -4;
+  shifts[3] = -18;
+  ind[0] = in[12];
+  ind[1] = in[12] >> 22 | in[13] << 10;
+  ind[2] = in[13];
+  ind[3] = in[13];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 14;
+
+  return in;
+}
+
+inline const uint32_t* unpack15_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0x7fff;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = -15;
+  shifts[2] = 0;
+  shifts[3] = -13;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[0] >> 30 | in[1] << 2;
+  ind[3] = in[1];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = 0;
+  shifts[1] = -11;
+  shifts[2] = 0;
+  shifts[3] = -9;
+  ind[0] = in[1] >> 28 | in[2] << 4;
+  ind[1] = in[2];
+  ind[2] = in[2] >> 26 | in[3] << 6;
+  ind[3] = in[3];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = 0;
+  shifts[1] = -7;
+  shifts[2] = 0;
+  shifts[3] = -5;
+  ind[0] = in[3] >> 24 | in[4] << 8;
+  ind[1] = in[4];
+  ind[2] = in[4] >> 22 | in[5] << 10;
+  ind[3] = in[5];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -3;
+  shifts[2] = 0;
+  shifts[3] = -1;
+  ind[0] = in[5] >> 20 | in[6] << 12;
+  ind[1] = in[6];
+  ind[2] = in[6] >> 18 | in[7] << 14;
+  ind[3] = in[7];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = -16;
+  shifts[1] = 0;
+  shifts[2] = -14;
+  shifts[3] = 0;
+  ind[0] = in[7];
+  ind[1] = in[7] >> 31 | in[8] << 1;
+  ind[2] = in[8];
+  ind[3] = in[8] >> 29 | in[9] << 3;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = -12;
+  shifts[1] = 0;
+  shifts[2] = -10;
+  shifts[3] = 0;
+  ind[0] = in[9];
+  ind[1] = in[9] >> 27 | in[10] << 5;
+  ind[2] = in[10];
+  ind[3] = in[10] >> 25 | in[11] << 7;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = -8;
+  shifts[1] = 0;
+  shifts[2] = -6;
+  shifts[3] = 0;
+  ind[0] = in[11];
+  ind[1] = in[11] >> 23 | in[12] << 9;
+  ind[2] = in[12];
+  ind[3] = in[12] >> 21 | in[13] << 11;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = -4;
+  shifts[1] = 0;
+  shifts[2] = -2;
+  shifts[3] = -17;
+  ind[0] = in[13];
+  ind[1] = in[13] >> 19 | in[14] << 13;
+  ind[2] = in[14];
+  ind[3] = in[14];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 15;
+
+  return in;
+}
+
+inline const uint32_t* unpack16_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0xffff;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = -16;
+  shifts[2] = 0;
+  shifts[3] = -16;
+  ind[0] = in[0];
+  ind[1] = in[0];
+  ind[2] = in[1];
+  ind[3] = in[1];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = 0;
+  shifts[1] = -16;
+  shifts[2] = 0;
+  shifts[3] = -16;
+  ind[0] = in[2];
+  ind[1] = in[2];
+  ind[2] = in[3];
+  ind[3] = in[3];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = 0;
+  shifts[1] = -16;
+  shifts[2] = 0;
+  shifts[3] = -16;
+  ind[0] = in[4];
+  ind[1] = in[4];
+  ind[2] = in[5];
+  ind[3] = in[5];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -16;
+  shifts[2] = 0;
+  shifts[3] = -16;
+  ind[0] = in[6];
+  ind[1] = in[6];
+  ind[2] = in[7];
+  ind[3] = in[7];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -16;
+  shifts[2] = 0;
+  shifts[3] = -16;
+  ind[0] = in[8];
+  ind[1] = in[8];
+  ind[2] = in[9];
+  ind[3] = in[9];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -16;
+  shifts[2] = 0;
+  shifts[3] = -16;
+  ind[0] = in[10];
+  ind[1] = in[10];
+  ind[2] = in[11];
+  ind[3] = in[11];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = 0;
+  shifts[1] = -16;
+  shifts[2] = 0;
+  shifts[3] = -16;
+  ind[0] = in[12];
+  ind[1] = in[12];
+  ind[2] = in[13];
+  ind[3] = in[13];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = 0;
+  shifts[1] = -16;
+  shifts[2] = 0;
+  shifts[3] = -16;
+  ind[0] = in[14];
+  ind[1] = in[14];
+  ind[2] = in[15];
+  ind[3] = in[15];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 16;
+
+  return in;
+}
+
+inline const uint32_t* unpack17_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0x1ffff;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = -2;
+  shifts[3] = 0;
+  ind[0] = in[0];
+  ind[1] = in[0] >> 17 | in[1] << 15;
+  ind[2] = in[1];
+  ind[3] = in[1] >> 19 | in[2] << 13;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = -4;
+  shifts[1] = 0;
+  shifts[2] = -6;
+  shifts[3] = 0;
+  ind[0] = in[2];
+  ind[1] = in[2] >> 21 | in[3] << 11;
+  ind[2] = in[3];
+  ind[3] = in[3] >> 23 | in[4] << 9;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = -8;
+  shifts[1] = 0;
+  shifts[2] = -10;
+  shifts[3] = 0;
+  ind[0] = in[4];
+  ind[1] = in[4] >> 25 | in[5] << 7;
+  ind[2] = in[5];
+  ind[3] = in[5] >> 27 | in[6] << 5;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = -12;
+  shifts[1] = 0;
+  shifts[2] = -14;
+  shifts[3] = 0;
+  ind[0] = in[6];
+  ind[1] = in[6] >> 29 | in[7] << 3;
+  ind[2] = in[7];
+  ind[3] = in[7] >> 31 | in[8] << 1;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -1;
+  shifts[2] = 0;
+  shifts[3] = -3;
+  ind[0] = in[8] >> 16 | in[9] << 16;
+  ind[1] = in[9];
+  ind[2] = in[9] >> 18 | in[10] << 14;
+  ind[3] = in[10];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -5;
+  shifts[2] = 0;
+  shifts[3] = -7;
+  ind[0] = in[10] >> 20 | in[11] << 12;
+  ind[1] = in[11];
+  ind[2] = in[11] >> 22 | in[12] << 10;
+  ind[3] = in[12];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = 0;
+  shifts[1] = -9;
+  shifts[2] = 0;
+  shifts[3] = -11;
+  ind[0] = in[12] >> 24 | in[13] << 8;
+  ind[1] = in[13];
+  ind[2] = in[13] >> 26 | in[14] << 6;
+  ind[3] = in[14];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = 0;
+  shifts[1] = -13;
+  shifts[2] = 0;
+  shifts[3] = -15;
+  ind[0] = in[14] >> 28 | in[15] << 4;
+  ind[1] = in[15];
+  ind[2] = in[15] >> 30 | in[16] << 2;
+  ind[3] = in[16];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 17;
+
+  return in;
+}
+
+inline const uint32_t* unpack18_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0x3ffff;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = -4;
+  shifts[3] = 0;
+  ind[0] = in[0];
+  ind[1] = in[0] >> 18 | in[1] << 14;
+  ind[2] = in[1];
+  ind[3] = in[1] >> 22 | in[2] << 10;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = -8;
+  shifts[1] = 0;
+  shifts[2] = -12;
+  shifts[3] = 0;
+  ind[0] = in[2];
+  ind[1] = in[2] >> 26 | in[3] << 6;
+  ind[2] = in[3];
+  ind[3] = in[3] >> 30 | in[4] << 2;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = 0;
+  shifts[1] = -2;
+  shifts[2] = 0;
+  shifts[3] = -6;
+  ind[0] = in[4] >> 16 | in[5] << 16;
+  ind[1] = in[5];
+  ind[2] = in[5] >> 20 | in[6] << 12;
+  ind[3] = in[6];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -10;
+  shifts[2] = 0;
+  shifts[3] = -14;
+  ind[0] = in[6] >> 24 | in[7] << 8;
+  ind[1] = in[7];
+  ind[2] = in[7] >> 28 | in[8] << 4;
+  ind[3] = in[8];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = -4;
+  shifts[3] = 0;
+  ind[0] = in[9];
+  ind[1] = in[9] >> 18 | in[10] << 14;
+  ind[2] = in[10];
+  ind[3] = in[10] >> 22 | in[11] << 10;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = -8;
+  shifts[1] = 0;
+  shifts[2] = -12;
+  shifts[3] = 0;
+  ind[0] = in[11];
+  ind[1] = in[11] >> 26 | in[12] << 6;
+  ind[2] = in[12];
+  ind[3] = in[12] >> 30 | in[13] << 2;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = 0;
+  shifts[1] = -2;
+  shifts[2] = 0;
+  shifts[3] = -6;
+  ind[0] = in[13] >> 16 | in[14] << 16;
+  ind[1] = in[14];
+  ind[2] = in[14] >> 20 | in[15] << 12;
+  ind[3] = in[15];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = 0;
+  shifts[1] = -10;
+  shifts[2] = 0;
+  shifts[3] = -14;
+  ind[0] = in[15] >> 24 | in[16] << 8;
+  ind[1] = in[16];
+  ind[2] = in[16] >> 28 | in[17] << 4;
+  ind[3] = in[17];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 18;
+
+  return in;
+}
+
+inline const uint32_t* unpack19_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0x7ffff;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = -6;
+  shifts[3] = 0;
+  ind[0] = in[0];
+  ind[1] = in[0] >> 19 | in[1] << 13;
+  ind[2] = in[1];
+  ind[3] = in[1] >> 25 | in[2] << 7;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = -12;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -5;
+  ind[0] = in[2];
+  ind[1] = in[2] >> 31 | in[3] << 1;
+  ind[2] = in[3] >> 18 | in[4] << 14;
+  ind[3] = in[4];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = 0;
+  shifts[1] = -11;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[4] >> 24 | in[5] << 8;
+  ind[1] = in[5];
+  ind[2] = in[5] >> 30 | in[6] << 2;
+  ind[3] = in[6] >> 17 | in[7] << 15;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = -4;
+  shifts[1] = 0;
+  shifts[2] = -10;
+  shifts[3] = 0;
+  ind[0] = in[7];
+  ind[1] = in[7] >> 23 | in[8] << 9;
+  ind[2] = in[8];
+  ind[3] = in[8] >> 29 | in[9] << 3;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -3;
+  shifts[2] = 0;
+  shifts[3] = -9;
+  ind[0] = in[9] >> 16 | in[10] << 16;
+  ind[1] = in[10];
+  ind[2] = in[10] >> 22 | in[11] << 10;
+  ind[3] = in[11];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = -2;
+  shifts[3] = 0;
+  ind[0] = in[11] >> 28 | in[12] << 4;
+  ind[1] = in[12] >> 15 | in[13] << 17;
+  ind[2] = in[13];
+  ind[3] = in[13] >> 21 | in[14] << 11;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = -8;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -1;
+  ind[0] = in[14];
+  ind[1] = in[14] >> 27 | in[15] << 5;
+  ind[2] = in[15] >> 14 | in[16] << 18;
+  ind[3] = in[16];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = 0;
+  shifts[1] = -7;
+  shifts[2] = 0;
+  shifts[3] = -13;
+  ind[0] = in[16] >> 20 | in[17] << 12;
+  ind[1] = in[17];
+  ind[2] = in[17] >> 26 | in[18] << 6;
+  ind[3] = in[18];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 19;
+
+  return in;
+}
+
+inline const uint32_t* unpack20_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0xfffff;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = -8;
+  shifts[3] = 0;
+  ind[0] = in[0];
+  ind[1] = in[0] >> 20 | in[1] << 12;
+  ind[2] = in[1];
+  ind[3] = in[1] >> 28 | in[2] << 4;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = 0;
+  shifts[1] = -4;
+  shifts[2] = 0;
+  shifts[3] = -12;
+  ind[0] = in[2] >> 16 | in[3] << 16;
+  ind[1] = in[3];
+  ind[2] = in[3] >> 24 | in[4] << 8;
+  ind[3] = in[4];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = -8;
+  shifts[3] = 0;
+  ind[0] = in[5];
+  ind[1] = in[5] >> 20 | in[6] << 12;
+  ind[2] = in[6];
+  ind[3] = in[6] >> 28 | in[7] << 4;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -4;
+  shifts[2] = 0;
+  shifts[3] = -12;
+  ind[0] = in[7] >> 16 | in[8] << 16;
+  ind[1] = in[8];
+  ind[2] = in[8] >> 24 | in[9] << 8;
+  ind[3] = in[9];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = -8;
+  shifts[3] = 0;
+  ind[0] = in[10];
+  ind[1] = in[10] >> 20 | in[11] << 12;
+  ind[2] = in[11];
+  ind[3] = in[11] >> 28 | in[12] << 4;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -4;
+  shifts[2] = 0;
+  shifts[3] = -12;
+  ind[0] = in[12] >> 16 | in[13] << 16;
+  ind[1] = in[13];
+  ind[2] = in[13] >> 24 | in[14] << 8;
+  ind[3] = in[14];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = -8;
+  shifts[3] = 0;
+  ind[0] = in[15];
+  ind[1] = in[15] >> 20 | in[16] << 12;
+  ind[2] = in[16];
+  ind[3] = in[16] >> 28 | in[17] << 4;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = 0;
+  shifts[1] = -4;
+  shifts[2] = 0;
+  shifts[3] = -12;
+  ind[0] = in[17] >> 16 | in[18] << 16;
+  ind[1] = in[18];
+  ind[2] = in[18] >> 24 | in[19] << 8;
+  ind[3] = in[19];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 20;
+
+  return in;
+}
+
+inline const uint32_t* unpack21_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0x1fffff;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = -10;
+  shifts[3] = 0;
+  ind[0] = in[0];
+  ind[1] = in[0] >> 21 | in[1] << 11;
+  ind[2] = in[1];
+  ind[3] = in[1] >> 31 | in[2] << 1;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = 0;
+  shifts[1] = -9;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[2] >> 20 | in[3] << 12;
+  ind[1] = in[3];
+  ind[2] = in[3] >> 30 | in[4] << 2;
+  ind[3] = in[4] >> 19 | in[5] << 13;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = -8;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -7;
+  ind[0] = in[5];
+  ind[1] = in[5] >> 29 | in[6] << 3;
+  ind[2] = in[6] >> 18 | in[7] << 14;
+  ind[3] = in[7];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = -6;
+  shifts[3] = 0;
+  ind[0] = in[7] >> 28 | in[8] << 4;
+  ind[1] = in[8] >> 17 | in[9] << 15;
+  ind[2] = in[9];
+  ind[3] = in[9] >> 27 | in[10] << 5;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -5;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[10] >> 16 | in[11] << 16;
+  ind[1] = in[11];
+  ind[2] = in[11] >> 26 | in[12] << 6;
+  ind[3] = in[12] >> 15 | in[13] << 17;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = -4;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -3;
+  ind[0] = in[13];
+  ind[1] = in[13] >> 25 | in[14] << 7;
+  ind[2] = in[14] >> 14 | in[15] << 18;
+  ind[3] = in[15];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = -2;
+  shifts[3] = 0;
+  ind[0] = in[15] >> 24 | in[16] << 8;
+  ind[1] = in[16] >> 13 | in[17] << 19;
+  ind[2] = in[17];
+  ind[3] = in[17] >> 23 | in[18] << 9;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = 0;
+  shifts[1] = -1;
+  shifts[2] = 0;
+  shifts[3] = -11;
+  ind[0] = in[18] >> 12 | in[19] << 20;
+  ind[1] = in[19];
+  ind[2] = in[19] >> 22 | in[20] << 10;
+  ind[3] = in[20];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 21;
+
+  return in;
+}
+
+inline const uint32_t* unpack22_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0x3fffff;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -2;
+  ind[0] = in[0];
+  ind[1] = in[0] >> 22 | in[1] << 10;
+  ind[2] = in[1] >> 12 | in[2] << 20;
+  ind[3] = in[2];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = -4;
+  shifts[3] = 0;
+  ind[0] = in[2] >> 24 | in[3] << 8;
+  ind[1] = in[3] >> 14 | in[4] << 18;
+  ind[2] = in[4];
+  ind[3] = in[4] >> 26 | in[5] << 6;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = 0;
+  shifts[1] = -6;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[5] >> 16 | in[6] << 16;
+  ind[1] = in[6];
+  ind[2] = in[6] >> 28 | in[7] << 4;
+  ind[3] = in[7] >> 18 | in[8] << 14;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = -8;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -10;
+  ind[0] = in[8];
+  ind[1] = in[8] >> 30 | in[9] << 2;
+  ind[2] = in[9] >> 20 | in[10] << 12;
+  ind[3] = in[10];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -2;
+  ind[0] = in[11];
+  ind[1] = in[11] >> 22 | in[12] << 10;
+  ind[2] = in[12] >> 12 | in[13] << 20;
+  ind[3] = in[13];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = -4;
+  shifts[3] = 0;
+  ind[0] = in[13] >> 24 | in[14] << 8;
+  ind[1] = in[14] >> 14 | in[15] << 18;
+  ind[2] = in[15];
+  ind[3] = in[15] >> 26 | in[16] << 6;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = 0;
+  shifts[1] = -6;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[16] >> 16 | in[17] << 16;
+  ind[1] = in[17];
+  ind[2] = in[17] >> 28 | in[18] << 4;
+  ind[3] = in[18] >> 18 | in[19] << 14;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = -8;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -10;
+  ind[0] = in[19];
+  ind[1] = in[19] >> 30 | in[20] << 2;
+  ind[2] = in[20] >> 20 | in[21] << 12;
+  ind[3] = in[21];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 22;
+
+  return in;
+}
+
+inline const uint32_t* unpack23_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0x7fffff;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -5;
+  ind[0] = in[0];
+  ind[1] = in[0] >> 23 | in[1] << 9;
+  ind[2] = in[1] >> 14 | in[2] << 18;
+  ind[3] = in[2];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -1;
+  ind[0] = in[2] >> 28 | in[3] << 4;
+  ind[1] = in[3] >> 19 | in[4] << 13;
+  ind[2] = in[4] >> 10 | in[5] << 22;
+  ind[3] = in[5];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = -6;
+  shifts[3] = 0;
+  ind[0] = in[5] >> 24 | in[6] << 8;
+  ind[1] = in[6] >> 15 | in[7] << 17;
+  ind[2] = in[7];
+  ind[3] = in[7] >> 29 | in[8] << 3;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = -2;
+  shifts[3] = 0;
+  ind[0] = in[8] >> 20 | in[9] << 12;
+  ind[1] = in[9] >> 11 | in[10] << 21;
+  ind[2] = in[10];
+  ind[3] = in[10] >> 25 | in[11] << 7;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -7;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[11] >> 16 | in[12] << 16;
+  ind[1] = in[12];
+  ind[2] = in[12] >> 30 | in[13] << 2;
+  ind[3] = in[13] >> 21 | in[14] << 11;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -3;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[14] >> 12 | in[15] << 20;
+  ind[1] = in[15];
+  ind[2] = in[15] >> 26 | in[16] << 6;
+  ind[3] = in[16] >> 17 | in[17] << 15;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = -8;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[17];
+  ind[1] = in[17] >> 31 | in[18] << 1;
+  ind[2] = in[18] >> 22 | in[19] << 10;
+  ind[3] = in[19] >> 13 | in[20] << 19;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = -4;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -9;
+  ind[0] = in[20];
+  ind[1] = in[20] >> 27 | in[21] << 5;
+  ind[2] = in[21] >> 18 | in[22] << 14;
+  ind[3] = in[22];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 23;
+
+  return in;
+}
+
+inline const uint32_t* unpack24_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0xffffff;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -8;
+  ind[0] = in[0];
+  ind[1] = in[0] >> 24 | in[1] << 8;
+  ind[2] = in[1] >> 16 | in[2] << 16;
+  ind[3] = in[2];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -8;
+  ind[0] = in[3];
+  ind[1] = in[3] >> 24 | in[4] << 8;
+  ind[2] = in[4] >> 16 | in[5] << 16;
+  ind[3] = in[5];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -8;
+  ind[0] = in[6];
+  ind[1] = in[6] >> 24 | in[7] << 8;
+  ind[2] = in[7] >> 16 | in[8] << 16;
+  ind[3] = in[8];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -8;
+  ind[0] = in[9];
+  ind[1] = in[9] >> 24 | in[10] << 8;
+  ind[2] = in[10] >> 16 | in[11] << 16;
+  ind[3] = in[11];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -8;
+  ind[0] = in[12];
+  ind[1] = in[12] >> 24 | in[13] << 8;
+  ind[2] = in[13] >> 16 | in[14] << 16;
+  ind[3] = in[14];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -8;
+  ind[0] = in[15];
+  ind[1] = in[15] >> 24 | in[16] << 8;
+  ind[2] = in[16] >> 16 | in[17] << 16;
+  ind[3] = in[17];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -8;
+  ind[0] = in[18];
+  ind[1] = in[18] >> 24 | in[19] << 8;
+  ind[2] = in[19] >> 16 | in[20] << 16;
+  ind[3] = in[20];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -8;
+  ind[0] = in[21];
+  ind[1] = in[21] >> 24 | in[22] << 8;
+  ind[2] = in[22] >> 16 | in[23] << 16;
+  ind[3] = in[23];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 24;
+
+  return in;
+}
+
+inline const uint32_t* unpack25_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0x1ffffff;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[0];
+  ind[1] = in[0] >> 25 | in[1] << 7;
+  ind[2] = in[1] >> 18 | in[2] << 14;
+  ind[3] = in[2] >> 11 | in[3] << 21;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = -4;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[3];
+  ind[1] = in[3] >> 29 | in[4] << 3;
+  ind[2] = in[4] >> 22 | in[5] << 10;
+  ind[3] = in[5] >> 15 | in[6] << 17;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = 0;
+  shifts[1] = -1;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[6] >> 8 | in[7] << 24;
+  ind[1] = in[7];
+  ind[2] = in[7] >> 26 | in[8] << 6;
+  ind[3] = in[8] >> 19 | in[9] << 13;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -5;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[9] >> 12 | in[10] << 20;
+  ind[1] = in[10];
+  ind[2] = in[10] >> 30 | in[11] << 2;
+  ind[3] = in[11] >> 23 | in[12] << 9;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = -2;
+  shifts[3] = 0;
+  ind[0] = in[12] >> 16 | in[13] << 16;
+  ind[1] = in[13] >> 9 | in[14] << 23;
+  ind[2] = in[14];
+  ind[3] = in[14] >> 27 | in[15] << 5;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = -6;
+  shifts[3] = 0;
+  ind[0] = in[15] >> 20 | in[16] << 12;
+  ind[1] = in[16] >> 13 | in[17] << 19;
+  ind[2] = in[17];
+  ind[3] = in[17] >> 31 | in[18] << 1;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -3;
+  ind[0] = in[18] >> 24 | in[19] << 8;
+  ind[1] = in[19] >> 17 | in[20] << 15;
+  ind[2] = in[20] >> 10 | in[21] << 22;
+  ind[3] = in[21];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -7;
+  ind[0] = in[21] >> 28 | in[22] << 4;
+  ind[1] = in[22] >> 21 | in[23] << 11;
+  ind[2] = in[23] >> 14 | in[24] << 18;
+  ind[3] = in[24];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 25;
+
+  return in;
+}
+
+inline const uint32_t* unpack26_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0x3ffffff;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[0];
+  ind[1] = in[0] >> 26 | in[1] << 6;
+  ind[2] = in[1] >> 20 | in[2] << 12;
+  ind[3] = in[2] >> 14 | in[3] << 18;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = 0;
+  shifts[1] = -2;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[3] >> 8 | in[4] << 24;
+  ind[1] = in[4];
+  ind[2] = in[4] >> 28 | in[5] << 4;
+  ind[3] = in[5] >> 22 | in[6] << 10;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = -4;
+  shifts[3] = 0;
+  ind[0] = in[6] >> 16 | in[7] << 16;
+  ind[1] = in[7] >> 10 | in[8] << 22;
+  ind[2] = in[8];
+  ind[3] = in[8] >> 30 | in[9] << 2;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -6;
+  ind[0] = in[9] >> 24 | in[10] << 8;
+  ind[1] = in[10] >> 18 | in[11] << 14;
+  ind[2] = in[11] >> 12 | in[12] << 20;
+  ind[3] = in[12];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[13];
+  ind[1] = in[13] >> 26 | in[14] << 6;
+  ind[2] = in[14] >> 20 | in[15] << 12;
+  ind[3] = in[15] >> 14 | in[16] << 18;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -2;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[16] >> 8 | in[17] << 24;
+  ind[1] = in[17];
+  ind[2] = in[17] >> 28 | in[18] << 4;
+  ind[3] = in[18] >> 22 | in[19] << 10;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = -4;
+  shifts[3] = 0;
+  ind[0] = in[19] >> 16 | in[20] << 16;
+  ind[1] = in[20] >> 10 | in[21] << 22;
+  ind[2] = in[21];
+  ind[3] = in[21] >> 30 | in[22] << 2;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -6;
+  ind[0] = in[22] >> 24 | in[23] << 8;
+  ind[1] = in[23] >> 18 | in[24] << 14;
+  ind[2] = in[24] >> 12 | in[25] << 20;
+  ind[3] = in[25];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 26;
+
+  return in;
+}
+
+inline const uint32_t* unpack27_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0x7ffffff;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[0];
+  ind[1] = in[0] >> 27 | in[1] << 5;
+  ind[2] = in[1] >> 22 | in[2] << 10;
+  ind[3] = in[2] >> 17 | in[3] << 15;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = -2;
+  shifts[3] = 0;
+  ind[0] = in[3] >> 12 | in[4] << 20;
+  ind[1] = in[4] >> 7 | in[5] << 25;
+  ind[2] = in[5];
+  ind[3] = in[5] >> 29 | in[6] << 3;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[6] >> 24 | in[7] << 8;
+  ind[1] = in[7] >> 19 | in[8] << 13;
+  ind[2] = in[8] >> 14 | in[9] << 18;
+  ind[3] = in[9] >> 9 | in[10] << 23;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = -4;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[10];
+  ind[1] = in[10] >> 31 | in[11] << 1;
+  ind[2] = in[11] >> 26 | in[12] << 6;
+  ind[3] = in[12] >> 21 | in[13] << 11;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -1;
+  ind[0] = in[13] >> 16 | in[14] << 16;
+  ind[1] = in[14] >> 11 | in[15] << 21;
+  ind[2] = in[15] >> 6 | in[16] << 26;
+  ind[3] = in[16];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[16] >> 28 | in[17] << 4;
+  ind[1] = in[17] >> 23 | in[18] << 9;
+  ind[2] = in[18] >> 18 | in[19] << 14;
+  ind[3] = in[19] >> 13 | in[20] << 19;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = 0;
+  shifts[1] = -3;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[20] >> 8 | in[21] << 24;
+  ind[1] = in[21];
+  ind[2] = in[21] >> 30 | in[22] << 2;
+  ind[3] = in[22] >> 25 | in[23] << 7;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -5;
+  ind[0] = in[23] >> 20 | in[24] << 12;
+  ind[1] = in[24] >> 15 | in[25] << 17;
+  ind[2] = in[25] >> 10 | in[26] << 22;
+  ind[3] = in[26];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 27;
+
+  return in;
+}
+
+inline const uint32_t* unpack28_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0xfffffff;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[0];
+  ind[1] = in[0] >> 28 | in[1] << 4;
+  ind[2] = in[1] >> 24 | in[2] << 8;
+  ind[3] = in[2] >> 20 | in[3] << 12;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -4;
+  ind[0] = in[3] >> 16 | in[4] << 16;
+  ind[1] = in[4] >> 12 | in[5] << 20;
+  ind[2] = in[5] >> 8 | in[6] << 24;
+  ind[3] = in[6];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[7];
+  ind[1] = in[7] >> 28 | in[8] << 4;
+  ind[2] = in[8] >> 24 | in[9] << 8;
+  ind[3] = in[9] >> 20 | in[10] << 12;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -4;
+  ind[0] = in[10] >> 16 | in[11] << 16;
+  ind[1] = in[11] >> 12 | in[12] << 20;
+  ind[2] = in[12] >> 8 | in[13] << 24;
+  ind[3] = in[13];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[14];
+  ind[1] = in[14] >> 28 | in[15] << 4;
+  ind[2] = in[15] >> 24 | in[16] << 8;
+  ind[3] = in[16] >> 20 | in[17] << 12;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -4;
+  ind[0] = in[17] >> 16 | in[18] << 16;
+  ind[1] = in[18] >> 12 | in[19] << 20;
+  ind[2] = in[19] >> 8 | in[20] << 24;
+  ind[3] = in[20];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[21];
+  ind[1] = in[21] >> 28 | in[22] << 4;
+  ind[2] = in[22] >> 24 | in[23] << 8;
+  ind[3] = in[23] >> 20 | in[24] << 12;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -4;
+  ind[0] = in[24] >> 16 | in[25] << 16;
+  ind[1] = in[25] >> 12 | in[26] << 20;
+  ind[2] = in[26] >> 8 | in[27] << 24;
+  ind[3] = in[27];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 28;
+
+  return in;
+}
+
+inline const uint32_t* unpack29_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0x1fffffff;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[0];
+  ind[1] = in[0] >> 29 | in[1] << 3;
+  ind[2] = in[1] >> 26 | in[2] << 6;
+  ind[3] = in[2] >> 23 | in[3] << 9;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[3] >> 20 | in[4] << 12;
+  ind[1] = in[4] >> 17 | in[5] << 15;
+  ind[2] = in[5] >> 14 | in[6] << 18;
+  ind[3] = in[6] >> 11 | in[7] << 21;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = -2;
+  shifts[3] = 0;
+  ind[0] = in[7] >> 8 | in[8] << 24;
+  ind[1] = in[8] >> 5 | in[9] << 27;
+  ind[2] = in[9];
+  ind[3] = in[9] >> 31 | in[10] << 1;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[10] >> 28 | in[11] << 4;
+  ind[1] = in[11] >> 25 | in[12] << 7;
+  ind[2] = in[12] >> 22 | in[13] << 10;
+  ind[3] = in[13] >> 19 | in[14] << 13;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[14] >> 16 | in[15] << 16;
+  ind[1] = in[15] >> 13 | in[16] << 19;
+  ind[2] = in[16] >> 10 | in[17] << 22;
+  ind[3] = in[17] >> 7 | in[18] << 25;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = 0;
+  shifts[1] = -1;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[18] >> 4 | in[19] << 28;
+  ind[1] = in[19];
+  ind[2] = in[19] >> 30 | in[20] << 2;
+  ind[3] = in[20] >> 27 | in[21] << 5;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[21] >> 24 | in[22] << 8;
+  ind[1] = in[22] >> 21 | in[23] << 11;
+  ind[2] = in[23] >> 18 | in[24] << 14;
+  ind[3] = in[24] >> 15 | in[25] << 17;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -3;
+  ind[0] = in[25] >> 12 | in[26] << 20;
+  ind[1] = in[26] >> 9 | in[27] << 23;
+  ind[2] = in[27] >> 6 | in[28] << 26;
+  ind[3] = in[28];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 29;
+
+  return in;
+}
+
+inline const uint32_t* unpack30_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0x3fffffff;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[0];
+  ind[1] = in[0] >> 30 | in[1] << 2;
+  ind[2] = in[1] >> 28 | in[2] << 4;
+  ind[3] = in[2] >> 26 | in[3] << 6;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[3] >> 24 | in[4] << 8;
+  ind[1] = in[4] >> 22 | in[5] << 10;
+  ind[2] = in[5] >> 20 | in[6] << 12;
+  ind[3] = in[6] >> 18 | in[7] << 14;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[7] >> 16 | in[8] << 16;
+  ind[1] = in[8] >> 14 | in[9] << 18;
+  ind[2] = in[9] >> 12 | in[10] << 20;
+  ind[3] = in[10] >> 10 | in[11] << 22;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -2;
+  ind[0] = in[11] >> 8 | in[12] << 24;
+  ind[1] = in[12] >> 6 | in[13] << 26;
+  ind[2] = in[13] >> 4 | in[14] << 28;
+  ind[3] = in[14];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[15];
+  ind[1] = in[15] >> 30 | in[16] << 2;
+  ind[2] = in[16] >> 28 | in[17] << 4;
+  ind[3] = in[17] >> 26 | in[18] << 6;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[18] >> 24 | in[19] << 8;
+  ind[1] = in[19] >> 22 | in[20] << 10;
+  ind[2] = in[20] >> 20 | in[21] << 12;
+  ind[3] = in[21] >> 18 | in[22] << 14;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[22] >> 16 | in[23] << 16;
+  ind[1] = in[23] >> 14 | in[24] << 18;
+  ind[2] = in[24] >> 12 | in[25] << 20;
+  ind[3] = in[25] >> 10 | in[26] << 22;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -2;
+  ind[0] = in[26] >> 8 | in[27] << 24;
+  ind[1] = in[27] >> 6 | in[28] << 26;
+  ind[2] = in[28] >> 4 | in[29] << 28;
+  ind[3] = in[29];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 30;
+
+  return in;
+}
+
+inline const uint32_t* unpack31_32_neon(const uint32_t* in, uint32_t* out) {
+  uint32_t mask = 0x7fffffff;
+  uint32_t ind[4];
+  int32_t shifts[4];
+  int32x4_t reg_shifts;
+  uint32x4_t reg_inls, reg_masks;
+  uint32x4_t results;
+
+  reg_masks = vdupq_n_u32(mask);
+
+  // shift the first 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[0];
+  ind[1] = in[0] >> 31 | in[1] << 1;
+  ind[2] = in[1] >> 30 | in[2] << 2;
+  ind[3] = in[2] >> 29 | in[3] << 3;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the second 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[3] >> 28 | in[4] << 4;
+  ind[1] = in[4] >> 27 | in[5] << 5;
+  ind[2] = in[5] >> 26 | in[6] << 6;
+  ind[3] = in[6] >> 25 | in[7] << 7;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the third 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[7] >> 24 | in[8] << 8;
+  ind[1] = in[8] >> 23 | in[9] << 9;
+  ind[2] = in[9] >> 22 | in[10] << 10;
+  ind[3] = in[10] >> 21 | in[11] << 11;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fourth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[11] >> 20 | in[12] << 12;
+  ind[1] = in[12] >> 19 | in[13] << 13;
+  ind[2] = in[13] >> 18 | in[14] << 14;
+  ind[3] = in[14] >> 17 | in[15] << 15;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the fifth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[15] >> 16 | in[16] << 16;
+  ind[1] = in[16] >> 15 | in[17] << 17;
+  ind[2] = in[17] >> 14 | in[18] << 18;
+  ind[3] = in[18] >> 13 | in[19] << 19;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the sixth 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[19] >> 12 | in[20] << 20;
+  ind[1] = in[20] >> 11 | in[21] << 21;
+  ind[2] = in[21] >> 10 | in[22] << 22;
+  ind[3] = in[22] >> 9 | in[23] << 23;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the seventh 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = 0;
+  ind[0] = in[23] >> 8 | in[24] << 24;
+  ind[1] = in[24] >> 7 | in[25] << 25;
+  ind[2] = in[25] >> 6 | in[26] << 26;
+  ind[3] = in[26] >> 5 | in[27] << 27;
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  // shift the last 4 outs
+  shifts[0] = 0;
+  shifts[1] = 0;
+  shifts[2] = 0;
+  shifts[3] = -1;
+  ind[0] = in[27] >> 4 | in[28] << 28;
+  ind[1] = in[28] >> 3 | in[29] << 29;
+  ind[2] = in[29] >> 2 | in[30] << 30;
+  ind[3] = in[30];
+  reg_shifts = vld1q_s32(shifts);
+  reg_inls = vld1q_u32(ind);
+  results = vandq_u32(vshlq_u32(reg_inls, reg_shifts), reg_masks);
+  vst1q_u32(out, results);
+  out += 4;
+
+  in += 31;
+
+  return in;
+}
+
+inline const uint32_t* unpack32_32_neon(const uint32_t* in, uint32_t* out) {
+  memcpy(out, in, 32 * sizeof(*out));
+  in += 32;
+  out += 32;
+
+  return in;
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -23,10 +23,10 @@
 #include <stdint.h>
 #include <algorithm>
 
-#ifdef ARROW_HAVE_SSE4_2
+#if defined(ARROW_HAVE_SSE4_2) || defined(ARROW_HAVE_NEON)
 // Enable the SIMD for ByteStreamSplit Encoder/Decoder
 #define ARROW_HAVE_SIMD_SPLIT
-#endif  // ARROW_HAVE_SSE4_2
+#endif  // ARROW_HAVE_SSE4_2 || ARROW_HAVE_NEON
 
 namespace arrow {
 namespace util {
@@ -545,6 +545,130 @@ void ByteStreamSplitEncodeAvx512(const uint8_t* raw_values, const size_t num_val
 }
 #endif  // ARROW_HAVE_AVX512
 
+#if defined(ARROW_HAVE_NEON)
+// The Neon paths follow the SSE ones, vzip1q/vzip2q being the equivalents of
+// the unpacklo/unpackhi intrinsics.
+template <typename T>
+void ByteStreamSplitDecodeNeon(const uint8_t* data, int64_t num_values, int64_t stride,
+                               T* out) {
+  constexpr size_t kNumStreams = sizeof(T);
+  static_assert(kNumStreams == 4U || kNumStreams == 8U, "Invalid number of streams.");
+  constexpr size_t kNumStreamsLog2 = (kNumStreams == 8U ? 3U : 2U);
+
+  const int64_t size = num_values * sizeof(T);
+  constexpr int64_t kBlockSize = sizeof(uint8x16_t) * kNumStreams;
+  const int64_t num_blocks = size / kBlockSize;
+  uint8_t* output_data = reinterpret_cast<uint8_t*>(out);
+
+  // First handle suffix.
+  const int64_t num_processed_elements = (num_blocks * kBlockSize) / kNumStreams;
+  for (int64_t i = num_processed_elements; i < num_values; ++i) {
+    uint8_t gathered_byte_data[kNumStreams];
+    for (size_t b = 0; b < kNumStreams; ++b) {
+      const size_t byte_index = b * stride + i;
+      gathered_byte_data[b] = data[byte_index];
+    }
+    out[i] = arrow::util::SafeLoadAs<T>(&gathered_byte_data[0]);
+  }
+
+  // Same hierarchical interleaving as the SSE path.
+  uint8x16_t stage[kNumStreamsLog2 + 1U][kNumStreams];
+  constexpr size_t kNumStreamsHalf = kNumStreams / 2U;
+
+  for (int64_t i = 0; i < num_blocks; ++i) {
+    for (size_t j = 0; j < kNumStreams; ++j) {
+      stage[0][j] = vld1q_u8(&data[i * sizeof(uint8x16_t) + j * stride]);
+    }
+    for (size_t step = 0; step < kNumStreamsLog2; ++step) {
+      for (size_t j = 0; j < kNumStreamsHalf; ++j) {
+        stage[step + 1U][j * 2] =
+            vzip1q_u8(stage[step][j], stage[step][kNumStreamsHalf + j]);
+        stage[step + 1U][j * 2 + 1U] =
+            vzip2q_u8(stage[step][j], stage[step][kNumStreamsHalf + j]);
+      }
+    }
+    for (size_t j = 0; j < kNumStreams; ++j) {
+      vst1q_u8(&output_data[(i * kNumStreams + j) * sizeof(uint8x16_t)],
+               stage[kNumStreamsLog2][j]);
+    }
+  }
+}
+
+template <typename T>
+void ByteStreamSplitEncodeNeon(const uint8_t* raw_values, const size_t num_values,
+                               uint8_t* output_buffer_raw) {
+  constexpr size_t kNumStreams = sizeof(T);
+  static_assert(kNumStreams == 4U || kNumStreams == 8U, "Invalid number of streams.");
+  uint8x16_t stage[3][kNumStreams];
+  uint8x16_t final_result[kNumStreams];
+
+  const size_t size = num_values * sizeof(T);
+  constexpr size_t kBlockSize = sizeof(uint8x16_t) * kNumStreams;
+  const size_t num_blocks = size / kBlockSize;
+  uint8_t* output_buffer_streams[kNumStreams];
+  for (size_t i = 0; i < kNumStreams; ++i) {
+    output_buffer_streams[i] = &output_buffer_raw[num_values * i];
+  }
+
+  // First handle suffix.
+  const size_t num_processed_elements = (num_blocks * kBlockSize) / sizeof(T);
+  for (size_t i = num_processed_elements; i < num_values; ++i) {
+    for (size_t j = 0U; j < kNumStreams; ++j) {
+      const uint8_t byte_in_value = raw_values[i * kNumStreams + j];
+      output_buffer_raw[j * num_values + i] = byte_in_value;
+    }
+  }
+  // Same shuffling as the SSE path, see ByteStreamSplitEncodeSse2.
+  for (size_t block_index = 0; block_index < num_blocks; ++block_index) {
+    for (size_t i = 0; i < kNumStreams; ++i) {
+      stage[0][i] =
+          vld1q_u8(&raw_values[(block_index * kNumStreams + i) * sizeof(uint8x16_t)]);
+    }
+
+    for (size_t stage_lvl = 0; stage_lvl < 2U; ++stage_lvl) {
+      for (size_t i = 0; i < kNumStreams / 2U; ++i) {
+        stage[stage_lvl + 1][i * 2] =
+            vzip1q_u8(stage[stage_lvl][i * 2], stage[stage_lvl][i * 2 + 1]);
+        stage[stage_lvl + 1][i * 2 + 1] =
+            vzip2q_u8(stage[stage_lvl][i * 2], stage[stage_lvl][i * 2 + 1]);
+      }
+    }
+    if (kNumStreams == 8U) {
+      // This is the path for double.
+      uint32x4_t tmp[8];
+      for (size_t i = 0; i < 4; ++i) {
+        tmp[i * 2] = vzip1q_u32(vreinterpretq_u32_u8(stage[2][i]),
+                                vreinterpretq_u32_u8(stage[2][i + 4]));
+        tmp[i * 2 + 1] = vzip2q_u32(vreinterpretq_u32_u8(stage[2][i]),
+                                    vreinterpretq_u32_u8(stage[2][i + 4]));
+      }
+
+      for (size_t i = 0; i < 4; ++i) {
+        final_result[i * 2] = vreinterpretq_u8_u32(vzip1q_u32(tmp[i], tmp[i + 4]));
+        final_result[i * 2 + 1] = vreinterpretq_u8_u32(vzip2q_u32(tmp[i], tmp[i + 4]));
+      }
+    } else {
+      // this is the path for float.
+      uint64x2_t tmp[4];
+      for (size_t i = 0; i < 2; ++i) {
+        tmp[i * 2] =
+            vreinterpretq_u64_u8(vzip1q_u8(stage[2][i * 2], stage[2][i * 2 + 1]));
+        tmp[i * 2 + 1] =
+            vreinterpretq_u64_u8(vzip2q_u8(stage[2][i * 2], stage[2][i * 2 + 1]));
+      }
+      for (size_t i = 0; i < 2; ++i) {
+        final_result[i * 2] = vreinterpretq_u8_u64(vzip1q_u64(tmp[i], tmp[i + 2]));
+        final_result[i * 2 + 1] = vreinterpretq_u8_u64(vzip2q_u64(tmp[i], tmp[i + 2]));
+      }
+    }
+    for (size_t i = 0; i < kNumStreams; ++i) {
+      vst1q_u8(&output_buffer_streams[i][block_index * sizeof(uint8x16_t)],
+               final_result[i]);
+    }
+  }
+}
+#endif  // ARROW_HAVE_NEON
+
 #if defined(ARROW_HAVE_SIMD_SPLIT)
 template <typename T>
 void inline ByteStreamSplitDecodeSimd(const uint8_t* data, int64_t num_values,
@@ -555,6 +679,8 @@ void inline ByteStreamSplitDecodeSimd(const uint8_t* data, int64_t num_values,
   return ByteStreamSplitDecodeAvx2(data, num_values, stride, out);
 #elif defined(ARROW_HAVE_SSE4_2)
   return ByteStreamSplitDecodeSse2(data, num_values, stride, out);
+#elif defined(ARROW_HAVE_NEON)
+  return ByteStreamSplitDecodeNeon(data, num_values, stride, out);
 #else
 #error "ByteStreamSplitDecodeSimd not implemented"
 #endif
@@ -569,6 +695,8 @@ void inline ByteStreamSplitEncodeSimd(const uint8_t* raw_values, const size_t nu
   return ByteStreamSplitEncodeAvx2<T>(raw_values, num_values, output_buffer_raw);
 #elif defined(ARROW_HAVE_SSE4_2)
   return ByteStreamSplitEncodeSse2<T>(raw_values, num_values, output_buffer_raw);
+#elif defined(ARROW_HAVE_NEON)
+  return ByteStreamSplitEncodeNeon<T>(raw_values, num_values, output_buffer_raw);
 #else
 #error "ByteStreamSplitEncodeSimd not implemented"
 #endif
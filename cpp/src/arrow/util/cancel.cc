@@ -0,0 +1,71 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/cancel.h"
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+struct StopSourceImpl {
+  // Set after `error` is written, so that a token seeing it set can read `error`
+  std::atomic<bool> requested{false};
+  std::mutex mutex;
+  Status error;
+};
+
+StopSource::StopSource() : impl_(new StopSourceImpl) {}
+
+StopSource::~StopSource() = default;
+
+void StopSource::RequestStop() { RequestStop(Status::Cancelled("Operation cancelled")); }
+
+void StopSource::RequestStop(Status error) {
+  DCHECK(!error.ok());
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  if (!impl_->requested.load()) {
+    impl_->error = std::move(error);
+    impl_->requested.store(true);
+  }
+}
+
+StopToken StopSource::token() { return StopToken(impl_); }
+
+void StopSource::Reset() {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  impl_->requested.store(false);
+  impl_->error = Status::OK();
+}
+
+bool StopToken::IsStopRequested() const {
+  return impl_ != nullptr && impl_->requested.load();
+}
+
+Status StopToken::Poll() const {
+  if (!IsStopRequested()) {
+    return Status::OK();
+  }
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  // The source may have been reset in the meantime
+  return impl_->requested.load() ? impl_->error : Status::OK();
+}
+
+}  // namespace arrow
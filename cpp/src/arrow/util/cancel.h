@@ -0,0 +1,84 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class StopToken;
+
+struct StopSourceImpl;
+
+/// \brief EXPERIMENTAL The owner side of a cooperative cancellation request
+///
+/// Requesting a stop doesn't interrupt anything by itself: the operations
+/// given a StopToken of this source check it at convenient points (e.g.
+/// between batches or tasks) and bail out with the stop error.
+class ARROW_EXPORT StopSource {
+ public:
+  StopSource();
+  ~StopSource();
+
+  /// \brief Request the operations to stop with a Cancelled error
+  void RequestStop();
+  /// \brief Request the operations to stop with the given (non-OK) error
+  ///
+  /// Only the first stop request is recorded.
+  void RequestStop(Status error);
+
+  /// \brief Return a token observing this source
+  StopToken token();
+
+  /// \brief Allow the source to be stopped again.  For internal use only.
+  void Reset();
+
+ protected:
+  std::shared_ptr<StopSourceImpl> impl_;
+};
+
+/// \brief EXPERIMENTAL The observer side of a cooperative cancellation request
+///
+/// A StopToken is cheap to copy, and checking it is a single atomic load.
+/// A default-constructed token is never stopped.
+class ARROW_EXPORT StopToken {
+ public:
+  StopToken() {}
+
+  /// \brief Return a token which is never stopped
+  static StopToken Unstoppable() { return StopToken(); }
+
+  /// \brief Return the stop error if a stop was requested, OK otherwise
+  Status Poll() const;
+  /// \brief Return whether a stop was requested
+  bool IsStopRequested() const;
+
+ protected:
+  explicit StopToken(std::shared_ptr<StopSourceImpl> impl) : impl_(std::move(impl)) {}
+
+  std::shared_ptr<StopSourceImpl> impl_;
+
+  friend class StopSource;
+};
+
+}  // namespace arrow
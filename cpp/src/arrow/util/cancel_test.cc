@@ -0,0 +1,78 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/cancel.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+
+TEST(StopToken, Unstoppable) {
+  StopToken token = StopToken::Unstoppable();
+  ASSERT_FALSE(token.IsStopRequested());
+  ASSERT_OK(token.Poll());
+}
+
+TEST(StopToken, RequestStop) {
+  StopSource source;
+  StopToken token = source.token();
+  ASSERT_FALSE(token.IsStopRequested());
+  ASSERT_OK(token.Poll());
+
+  source.RequestStop();
+  ASSERT_TRUE(token.IsStopRequested());
+  ASSERT_RAISES(Cancelled, token.Poll());
+  // Tokens taken later see the stop too
+  ASSERT_RAISES(Cancelled, source.token().Poll());
+
+  // Only the first error is recorded
+  source.RequestStop(Status::IOError("xxx"));
+  ASSERT_RAISES(Cancelled, token.Poll());
+
+  source.Reset();
+  ASSERT_FALSE(token.IsStopRequested());
+  ASSERT_OK(token.Poll());
+  source.RequestStop(Status::IOError("xxx"));
+  ASSERT_RAISES(IOError, token.Poll());
+}
+
+TEST(StopToken, Threaded) {
+  StopSource source;
+  std::atomic<int> num_stopped(0);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&](StopToken token) {
+      while (token.Poll().ok()) {
+        std::this_thread::yield();
+      }
+      ++num_stopped;
+    }, source.token());
+  }
+  source.RequestStop();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(num_stopped.load(), 4);
+}
+
+}  // namespace arrow
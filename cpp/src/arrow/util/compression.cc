@@ -38,6 +38,10 @@ int Codec::UseDefaultCompressionLevel() { return kUseDefaultCompressionLevel; }
 
 Status Codec::Init() { return Status::OK(); }
 
+Result<int64_t> Codec::FindFrameSize(int64_t input_len, const uint8_t* input) {
+  return Status::NotImplemented("Finding frame boundaries with codec '", name(), "'");
+}
+
 std::string Codec::GetCodecAsString(Compression::type t) {
   switch (t) {
     case Compression::UNCOMPRESSED:
@@ -168,6 +172,37 @@ Result<std::unique_ptr<Codec>> Codec::Create(Compression::type codec_type,
   return std::move(codec);
 }
 
+Result<std::unique_ptr<Codec>> Codec::CreateWithDictionary(
+    Compression::type codec_type, std::shared_ptr<Buffer> dictionary,
+    int compression_level) {
+  if (codec_type != Compression::ZSTD) {
+    return Status::NotImplemented("Compression dictionaries with codec ",
+                                  GetCodecAsString(codec_type));
+  }
+#ifdef ARROW_WITH_ZSTD
+  std::unique_ptr<Codec> codec =
+      internal::MakeZSTDCodec(compression_level, std::move(dictionary));
+  RETURN_NOT_OK(codec->Init());
+  return std::move(codec);
+#else
+  return Status::NotImplemented("ZSTD codec support not built");
+#endif
+}
+
+Result<std::shared_ptr<Buffer>> Codec::TrainDictionary(Compression::type codec_type,
+                                                       const BufferVector& samples,
+                                                       int64_t max_size) {
+  if (codec_type != Compression::ZSTD) {
+    return Status::NotImplemented("Compression dictionaries with codec ",
+                                  GetCodecAsString(codec_type));
+  }
+#ifdef ARROW_WITH_ZSTD
+  return internal::TrainZSTDDictionary(samples, max_size);
+#else
+  return Status::NotImplemented("ZSTD codec support not built");
+#endif
+}
+
 bool Codec::IsAvailable(Compression::type codec_type) {
   switch (codec_type) {
     case Compression::UNCOMPRESSED:
@@ -24,6 +24,7 @@
 
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/type_fwd.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -133,6 +134,29 @@ class ARROW_EXPORT Codec {
   static Result<std::unique_ptr<Codec>> Create(
       Compression::type codec, int compression_level = kUseDefaultCompressionLevel);
 
+  /// \brief Create a codec priming compression with a dictionary
+  ///
+  /// A dictionary of data representative of the inputs greatly improves the
+  /// compression of small inputs, which otherwise have too little history to
+  /// refer to. Data compressed with a dictionary can only be decompressed
+  /// with the same dictionary, which isn't stored in the compressed data.
+  /// Only ZSTD supports dictionaries.
+  ///
+  /// \since 2.0.0
+  static Result<std::unique_ptr<Codec>> CreateWithDictionary(
+      Compression::type codec, std::shared_ptr<Buffer> dictionary,
+      int compression_level = kUseDefaultCompressionLevel);
+
+  /// \brief Train a compression dictionary on samples of the data to compress
+  ///
+  /// The returned dictionary is at most max_size bytes, typically 100KB. The
+  /// samples should be many (at least hundreds) small inputs like the ones to
+  /// be compressed. Only ZSTD supports dictionaries.
+  ///
+  /// \since 2.0.0
+  static Result<std::shared_ptr<Buffer>> TrainDictionary(
+      Compression::type codec, const BufferVector& samples, int64_t max_size);
+
   /// \brief Return true if support for indicated codec has been enabled
   static bool IsAvailable(Compression::type codec);
 
@@ -167,6 +191,15 @@ class ARROW_EXPORT Codec {
   /// \brief Create a streaming compressor instance
   virtual Result<std::shared_ptr<Decompressor>> MakeDecompressor() = 0;
 
+  /// \brief Return the compressed size of the frame at the start of the input
+  ///
+  /// Some formats consist of independently decompressible frames, such as
+  /// multi-frame Zstandard data or BGZF-style gzip members.  The returned size
+  /// may be larger than input_len.  0 is returned if input_len is too small to
+  /// tell.  NotImplemented is returned if the frame cannot be delimited without
+  /// decompressing it.
+  virtual Result<int64_t> FindFrameSize(int64_t input_len, const uint8_t* input);
+
   virtual const char* name() const = 0;
 
  private:
@@ -19,6 +19,7 @@
 
 #include <memory>
 
+#include "arrow/type_fwd.h"
 #include "arrow/util/compression.h"  // IWYU pragma: export
 
 namespace arrow {
@@ -70,7 +71,11 @@ std::unique_ptr<Codec> MakeLz4FrameCodec();
 constexpr int kZSTDDefaultCompressionLevel = 1;
 
 std::unique_ptr<Codec> MakeZSTDCodec(
-    int compression_level = kZSTDDefaultCompressionLevel);
+    int compression_level = kZSTDDefaultCompressionLevel,
+    std::shared_ptr<Buffer> dictionary = NULLPTR);
+
+Result<std::shared_ptr<Buffer>> TrainZSTDDictionary(const BufferVector& samples,
+                                                    int64_t max_size);
 
 }  // namespace internal
 }  // namespace util
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <utility>
 
 #include <lz4.h>
 #include <lz4frame.h>
@@ -259,7 +260,17 @@ class Lz4FrameCodec : public Codec {
 
   Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
                              int64_t output_buffer_len, uint8_t* output_buffer) override {
-    ARROW_ASSIGN_OR_RAISE(auto decomp, MakeDecompressor());
+    // Reuse a decompression context per thread, rather than allocating one
+    // for each buffer
+    static thread_local std::unique_ptr<LZ4Decompressor> thread_decompressor;
+    if (thread_decompressor == nullptr) {
+      std::unique_ptr<LZ4Decompressor> decompressor(new LZ4Decompressor());
+      RETURN_NOT_OK(decompressor->Init());
+      thread_decompressor = std::move(decompressor);
+    } else {
+      RETURN_NOT_OK(thread_decompressor->Reset());
+    }
+    LZ4Decompressor* decomp = thread_decompressor.get();
 
     int64_t total_bytes_written = 0;
     while (!decomp->IsFinished() && input_len != 0) {
@@ -26,6 +26,7 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/buffer.h"
 #include "arrow/result.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
@@ -523,6 +524,59 @@ TEST_P(CodecTest, StreamingDecompressorReuse) {
   CheckStreamingRoundtrip(compressor, decompressor, data);
 }
 
+#ifdef ARROW_WITH_ZSTD
+// Small records sharing most of their contents
+BufferVector MakeDictionarySamples(int num_samples) {
+  BufferVector samples;
+  for (int i = 0; i < num_samples; ++i) {
+    samples.push_back(Buffer::FromString(
+        "{\"id\": " + std::to_string(i * 7919 % 1000) + ", \"name\": \"user" +
+        std::to_string(i % 37) + "\", \"active\": true}"));
+  }
+  return samples;
+}
+
+TEST(TestCodecMisc, ZSTDDictionary) {
+  ASSERT_OK_AND_ASSIGN(auto dictionary, Codec::TrainDictionary(
+                                            Compression::ZSTD,
+                                            MakeDictionarySamples(1000), 4096));
+  ASSERT_GT(dictionary->size(), 0);
+  ASSERT_LE(dictionary->size(), 4096);
+
+  std::unique_ptr<Codec> c1, c2, plain;
+  ASSERT_OK_AND_ASSIGN(c1, Codec::CreateWithDictionary(Compression::ZSTD, dictionary));
+  ASSERT_OK_AND_ASSIGN(c2, Codec::CreateWithDictionary(Compression::ZSTD, dictionary,
+                                                       /*compression_level=*/5));
+  ASSERT_OK_AND_ASSIGN(plain, Codec::Create(Compression::ZSTD));
+
+  const std::string record = R"({"id": 42, "name": "user5", "active": true})";
+  std::vector<uint8_t> data(record.begin(), record.end());
+  CheckCodecRoundtrip(c1, c2, data);
+  CheckStreamingRoundtrip(c1.get(), data);
+  CheckStreamingRoundtrip(c2.get(), MakeCompressibleData(10000));
+
+  // Small inputs compress much better with the dictionary
+  std::vector<uint8_t> compressed(plain->MaxCompressedLen(data.size(), data.data()));
+  ASSERT_OK_AND_ASSIGN(auto plain_size, plain->Compress(data.size(), data.data(),
+                                                        compressed.size(),
+                                                        compressed.data()));
+  ASSERT_OK_AND_ASSIGN(auto dict_size, c1->Compress(data.size(), data.data(),
+                                                    compressed.size(),
+                                                    compressed.data()));
+  ASSERT_LT(dict_size, plain_size);
+
+  // The dictionary is needed to decompress
+  std::vector<uint8_t> decompressed(data.size());
+  ASSERT_RAISES(IOError, plain->Decompress(dict_size, compressed.data(),
+                                           decompressed.size(), decompressed.data()));
+
+  ASSERT_RAISES(NotImplemented,
+                Codec::CreateWithDictionary(Compression::GZIP, dictionary));
+  ASSERT_RAISES(NotImplemented, Codec::TrainDictionary(Compression::GZIP,
+                                                       MakeDictionarySamples(10), 100));
+}
+#endif
+
 #ifdef ARROW_WITH_ZLIB
 INSTANTIATE_TEST_SUITE_P(TestGZip, CodecTest, ::testing::Values(Compression::GZIP));
 #endif
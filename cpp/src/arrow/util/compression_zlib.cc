@@ -463,6 +463,41 @@ class GZipCodec : public Codec {
     return InitDecompressor();
   }
 
+  // Only gzip members recording their own size, as in the BGZF format, can
+  // be delimited without decompressing them.  BGZF stores the member size
+  // minus one in a "BC" subfield of the gzip header's extra field.
+  Result<int64_t> FindFrameSize(int64_t input_len, const uint8_t* input) override {
+    if (format_ != GZipFormat::GZIP) {
+      return Codec::FindFrameSize(input_len, input);
+    }
+    constexpr int64_t kFixedHeaderSize = 12;
+    constexpr uint8_t kFlagExtra = 0x04;
+    if (input_len < kFixedHeaderSize) {
+      return 0;
+    }
+    if (input[0] != 0x1f || input[1] != 0x8b) {
+      return Status::IOError("Invalid gzip member header");
+    }
+    if ((input[3] & kFlagExtra) == 0) {
+      return Status::NotImplemented("gzip member does not record its size");
+    }
+    const int64_t extra_len = input[10] | (input[11] << 8);
+    if (input_len < kFixedHeaderSize + extra_len) {
+      return 0;
+    }
+    const uint8_t* subfield = input + kFixedHeaderSize;
+    const uint8_t* extra_end = subfield + extra_len;
+    while (extra_end - subfield >= 4) {
+      const int64_t subfield_len = subfield[2] | (subfield[3] << 8);
+      if (subfield[0] == 'B' && subfield[1] == 'C' && subfield_len == 2 &&
+          extra_end - subfield >= 6) {
+        return (subfield[4] | (subfield[5] << 8)) + 1;
+      }
+      subfield += 4 + subfield_len;
+    }
+    return Status::NotImplemented("gzip member does not record its size");
+  }
+
   const char* name() const override { return "gzip"; }
 
  private:
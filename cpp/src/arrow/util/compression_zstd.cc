@@ -20,9 +20,14 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <utility>
+#include <vector>
 
+#include <zdict.h>
 #include <zstd.h>
+#include <zstd_errors.h>
 
+#include "arrow/buffer.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
@@ -40,18 +45,71 @@ Status ZSTDError(size_t ret, const char* prefix_msg) {
   return Status::IOError(prefix_msg, ZSTD_getErrorName(ret));
 }
 
+// Digested dictionaries are shared by a codec and the streams it creates
+using CDictPtr = std::shared_ptr<ZSTD_CDict>;
+using DDictPtr = std::shared_ptr<ZSTD_DDict>;
+
+// The contexts used by one-shot compression and decompression. Creating a
+// context allocates and initializes several hundred kilobytes, which dominates
+// the cost of compressing small buffers, so each thread keeps its own.
+struct ThreadContexts {
+  ~ThreadContexts() {
+    ZSTD_freeCCtx(cctx);
+    ZSTD_freeDCtx(dctx);
+  }
+
+  ZSTD_CCtx* cctx = nullptr;
+  ZSTD_DCtx* dctx = nullptr;
+};
+
+ThreadContexts* GetThreadContexts() {
+  static thread_local ThreadContexts contexts;
+  return &contexts;
+}
+
+Result<ZSTD_CCtx*> GetCompressionContext() {
+  auto contexts = GetThreadContexts();
+  if (contexts->cctx == nullptr) {
+    contexts->cctx = ZSTD_createCCtx();
+    if (contexts->cctx == nullptr) {
+      return Status::OutOfMemory("Failed to allocate ZSTD compression context");
+    }
+  }
+  return contexts->cctx;
+}
+
+Result<ZSTD_DCtx*> GetDecompressionContext() {
+  auto contexts = GetThreadContexts();
+  if (contexts->dctx == nullptr) {
+    contexts->dctx = ZSTD_createDCtx();
+    if (contexts->dctx == nullptr) {
+      return Status::OutOfMemory("Failed to allocate ZSTD decompression context");
+    }
+  }
+  return contexts->dctx;
+}
+
 // ----------------------------------------------------------------------
 // ZSTD decompressor implementation
 
 class ZSTDDecompressor : public Decompressor {
  public:
-  ZSTDDecompressor() : stream_(ZSTD_createDStream()) {}
+  explicit ZSTDDecompressor(DDictPtr ddict = nullptr)
+      : stream_(ZSTD_createDStream()), ddict_(std::move(ddict)) {}
 
   ~ZSTDDecompressor() override { ZSTD_freeDStream(stream_); }
 
   Status Init() {
     finished_ = false;
-    size_t ret = ZSTD_initDStream(stream_);
+    size_t ret;
+    if (ddict_) {
+      ret = ZSTD_DCtx_reset(stream_, ZSTD_reset_session_only);
+      if (!ZSTD_isError(ret)) {
+        ret = ZSTD_DCtx_refDDict(stream_, ddict_.get());
+      }
+    } else {
+      ret = ZSTD_initDStream(stream_);
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD init failed: ");
     } else {
@@ -88,6 +146,7 @@ class ZSTDDecompressor : public Decompressor {
 
  protected:
   ZSTD_DStream* stream_;
+  DDictPtr ddict_;
   bool finished_;
 };
 
@@ -96,13 +155,24 @@ class ZSTDDecompressor : public Decompressor {
 
 class ZSTDCompressor : public Compressor {
  public:
-  explicit ZSTDCompressor(int compression_level)
-      : stream_(ZSTD_createCStream()), compression_level_(compression_level) {}
+  explicit ZSTDCompressor(int compression_level, CDictPtr cdict = nullptr)
+      : stream_(ZSTD_createCStream()),
+        compression_level_(compression_level),
+        cdict_(std::move(cdict)) {}
 
   ~ZSTDCompressor() override { ZSTD_freeCStream(stream_); }
 
   Status Init() {
-    size_t ret = ZSTD_initCStream(stream_, compression_level_);
+    size_t ret;
+    if (cdict_) {
+      // The compression level is the one the dictionary was digested with
+      ret = ZSTD_CCtx_reset(stream_, ZSTD_reset_session_only);
+      if (!ZSTD_isError(ret)) {
+        ret = ZSTD_CCtx_refCDict(stream_, cdict_.get());
+      }
+    } else {
+      ret = ZSTD_initCStream(stream_, compression_level_);
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD init failed: ");
     } else {
@@ -166,6 +236,7 @@ class ZSTDCompressor : public Compressor {
 
  private:
   int compression_level_;
+  CDictPtr cdict_;
 };
 
 // ----------------------------------------------------------------------
@@ -173,12 +244,29 @@ class ZSTDCompressor : public Compressor {
 
 class ZSTDCodec : public Codec {
  public:
-  explicit ZSTDCodec(int compression_level) {
+  explicit ZSTDCodec(int compression_level, std::shared_ptr<Buffer> dictionary = nullptr)
+      : dictionary_(std::move(dictionary)) {
     compression_level_ = compression_level == kUseDefaultCompressionLevel
                              ? kZSTDDefaultCompressionLevel
                              : compression_level;
   }
 
+  Status Init() override {
+    if (dictionary_ == nullptr) {
+      return Status::OK();
+    }
+    // Digest the dictionary once for all the compressions
+    const auto dict_size = static_cast<size_t>(dictionary_->size());
+    cdict_ = CDictPtr(
+        ZSTD_createCDict(dictionary_->data(), dict_size, compression_level_),
+        ZSTD_freeCDict);
+    ddict_ = DDictPtr(ZSTD_createDDict(dictionary_->data(), dict_size), ZSTD_freeDDict);
+    if (cdict_ == nullptr || ddict_ == nullptr) {
+      return Status::Invalid("Failed to load ZSTD dictionary");
+    }
+    return Status::OK();
+  }
+
   Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
                              int64_t output_buffer_len, uint8_t* output_buffer) override {
     if (output_buffer == nullptr) {
@@ -189,8 +277,17 @@ class ZSTDCodec : public Codec {
       output_buffer = empty_buffer;
     }
 
-    size_t ret = ZSTD_decompress(output_buffer, static_cast<size_t>(output_buffer_len),
-                                 input, static_cast<size_t>(input_len));
+    ARROW_ASSIGN_OR_RAISE(ZSTD_DCtx * dctx, GetDecompressionContext());
+    size_t ret;
+    if (ddict_) {
+      ret = ZSTD_decompress_usingDDict(dctx, output_buffer,
+                                       static_cast<size_t>(output_buffer_len), input,
+                                       static_cast<size_t>(input_len), ddict_.get());
+    } else {
+      ret = ZSTD_decompressDCtx(dctx, output_buffer,
+                                static_cast<size_t>(output_buffer_len), input,
+                                static_cast<size_t>(input_len));
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD decompression failed: ");
     }
@@ -208,8 +305,16 @@ class ZSTDCodec : public Codec {
 
   Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
                            int64_t output_buffer_len, uint8_t* output_buffer) override {
-    size_t ret = ZSTD_compress(output_buffer, static_cast<size_t>(output_buffer_len),
-                               input, static_cast<size_t>(input_len), compression_level_);
+    ARROW_ASSIGN_OR_RAISE(ZSTD_CCtx * cctx, GetCompressionContext());
+    size_t ret;
+    if (cdict_) {
+      ret = ZSTD_compress_usingCDict(cctx, output_buffer,
+                                     static_cast<size_t>(output_buffer_len), input,
+                                     static_cast<size_t>(input_len), cdict_.get());
+    } else {
+      ret = ZSTD_compressCCtx(cctx, output_buffer, static_cast<size_t>(output_buffer_len),
+                              input, static_cast<size_t>(input_len), compression_level_);
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD compression failed: ");
     }
@@ -217,27 +322,63 @@ class ZSTDCodec : public Codec {
   }
 
   Result<std::shared_ptr<Compressor>> MakeCompressor() override {
-    auto ptr = std::make_shared<ZSTDCompressor>(compression_level_);
+    auto ptr = std::make_shared<ZSTDCompressor>(compression_level_, cdict_);
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
 
   Result<std::shared_ptr<Decompressor>> MakeDecompressor() override {
-    auto ptr = std::make_shared<ZSTDDecompressor>();
+    auto ptr = std::make_shared<ZSTDDecompressor>(ddict_);
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
 
+  Result<int64_t> FindFrameSize(int64_t input_len, const uint8_t* input) override {
+    size_t ret = ZSTD_findFrameCompressedSize(input, static_cast<size_t>(input_len));
+    if (ZSTD_isError(ret)) {
+      if (ZSTD_getErrorCode(ret) == ZSTD_error_srcSize_wrong) {
+        // Truncated frame
+        return 0;
+      }
+      return ZSTDError(ret, "ZSTD frame delimiting failed: ");
+    }
+    return static_cast<int64_t>(ret);
+  }
+
   const char* name() const override { return "zstd"; }
 
  private:
   int compression_level_;
+  std::shared_ptr<Buffer> dictionary_;
+  CDictPtr cdict_;
+  DDictPtr ddict_;
 };
 
 }  // namespace
 
-std::unique_ptr<Codec> MakeZSTDCodec(int compression_level) {
-  return std::unique_ptr<Codec>(new ZSTDCodec(compression_level));
+std::unique_ptr<Codec> MakeZSTDCodec(int compression_level,
+                                     std::shared_ptr<Buffer> dictionary) {
+  return std::unique_ptr<Codec>(new ZSTDCodec(compression_level, std::move(dictionary)));
+}
+
+Result<std::shared_ptr<Buffer>> TrainZSTDDictionary(const BufferVector& samples,
+                                                    int64_t max_size) {
+  // The trainer takes the samples concatenated
+  std::vector<size_t> sample_sizes(samples.size());
+  for (size_t i = 0; i < samples.size(); ++i) {
+    sample_sizes[i] = static_cast<size_t>(samples[i]->size());
+  }
+  ARROW_ASSIGN_OR_RAISE(auto concatenated, ConcatenateBuffers(samples));
+
+  ARROW_ASSIGN_OR_RAISE(auto dictionary, AllocateResizableBuffer(max_size));
+  size_t ret = ZDICT_trainFromBuffer(
+      dictionary->mutable_data(), static_cast<size_t>(max_size), concatenated->data(),
+      sample_sizes.data(), static_cast<unsigned>(sample_sizes.size()));
+  if (ZDICT_isError(ret)) {
+    return Status::Invalid("ZSTD dictionary training failed: ", ZDICT_getErrorName(ret));
+  }
+  RETURN_NOT_OK(dictionary->Resize(static_cast<int64_t>(ret)));
+  return std::shared_ptr<Buffer>(std::move(dictionary));
 }
 
 }  // namespace internal
@@ -192,160 +192,124 @@ double Decimal128::ToDouble(int32_t scale) const {
   return DecimalDoubleConversion::ToReal(*this, scale);
 }
 
-template <size_t n>
-static void AppendLittleEndianArrayToString(const std::array<uint64_t, n>& array,
-                                            std::string* result) {
-  const auto most_significant_non_zero =
-      find_if(array.rbegin(), array.rend(), [](uint64_t v) { return v != 0; });
-  if (most_significant_non_zero == array.rend()) {
-    result->push_back('0');
-    return;
-  }
-
-  size_t most_significant_elem_idx = &*most_significant_non_zero - array.data();
-  std::array<uint64_t, n> copy = array;
-  constexpr uint32_t k1e9 = 1000000000U;
-  constexpr size_t kNumBits = n * 64;
-  // Segments will contain the array split into groups that map to decimal digits,
-  // in little endian order. Each segment will hold at most 9 decimal digits.
-  // For example, if the input represents 9876543210123456789, then segments will be
-  // [123456789, 876543210, 9].
-  // The max number of segments needed = ceil(kNumBits * log(2) / log(1e9))
-  // = ceil(kNumBits / 29.897352854) <= ceil(kNumBits / 29).
-  std::array<uint32_t, (kNumBits + 28) / 29> segments;
-  size_t num_segments = 0;
-  uint64_t* most_significant_elem = &copy[most_significant_elem_idx];
-  do {
-    // Compute remainder = copy % 1e9 and copy = copy / 1e9.
-    uint32_t remainder = 0;
-    uint64_t* elem = most_significant_elem;
-    do {
-      // Compute dividend = (remainder << 32) | *elem  (a virtual 96-bit integer);
-      // *elem = dividend / 1e9;
-      // remainder = dividend % 1e9.
-      uint32_t hi = static_cast<uint32_t>(*elem >> 32);
-      uint32_t lo = static_cast<uint32_t>(*elem & BitUtil::LeastSignficantBitMask(32));
-      uint64_t dividend_hi = (static_cast<uint64_t>(remainder) << 32) | hi;
-      uint64_t quotient_hi = dividend_hi / k1e9;
-      remainder = static_cast<uint32_t>(dividend_hi % k1e9);
-      uint64_t dividend_lo = (static_cast<uint64_t>(remainder) << 32) | lo;
-      uint64_t quotient_lo = dividend_lo / k1e9;
-      remainder = static_cast<uint32_t>(dividend_lo % k1e9);
-      *elem = (quotient_hi << 32) | quotient_lo;
-    } while (elem-- != copy.data());
-
-    segments[num_segments++] = remainder;
-  } while (*most_significant_elem != 0 || most_significant_elem-- != copy.data());
-
-  size_t old_size = result->size();
-  size_t new_size = old_size + num_segments * 9;
-  result->resize(new_size, '0');
-  char* output = &result->at(old_size);
-  const uint32_t* segment = &segments[num_segments - 1];
-  internal::StringFormatter<UInt32Type> format;
-  // First segment is formatted as-is.
-  format(*segment, [&output](util::string_view formatted) {
-    memcpy(output, formatted.data(), formatted.size());
-    output += formatted.size();
-  });
-  while (segment != segments.data()) {
-    --segment;
-    // Right-pad formatted segment such that e.g. 123 is formatted as "000000123".
-    output += 9;
-    format(*segment, [output](util::string_view formatted) {
-      memcpy(output - formatted.size(), formatted.data(), formatted.size());
-    });
+namespace {
+
+// Compute words / divisor in place for a little endian 128-bit unsigned integer,
+// returning the remainder.
+inline uint32_t DivideInPlace(uint64_t words[2], uint32_t divisor) {
+  uint64_t remainder = 0;
+  for (int i = 1; i >= 0; --i) {
+    // Divide the virtual 96-bit integer (remainder << 64) | words[i] 32 bits at a time
+    const uint64_t dividend_hi = (remainder << 32) | (words[i] >> 32);
+    const uint64_t quotient_hi = dividend_hi / divisor;
+    remainder = dividend_hi % divisor;
+    const uint64_t dividend_lo =
+        (remainder << 32) | (words[i] & BitUtil::LeastSignficantBitMask(32));
+    const uint64_t quotient_lo = dividend_lo / divisor;
+    remainder = dividend_lo % divisor;
+    words[i] = (quotient_hi << 32) | quotient_lo;
+  }
+  return static_cast<uint32_t>(remainder);
+}
+
+// Write the base 10 digits of a 128-bit unsigned integer right to left, ending at
+// *cursor.  The value is split into 18-digit chunks so that most of the work
+// happens on native uint64_t values.
+void FormatUnsignedDigits(uint64_t high, uint64_t low, char** cursor) {
+  uint64_t words[2] = {low, high};
+  while (words[1] != 0) {
+    // Two divisions by 1e9 give the lowest 18 digits
+    const uint64_t lower = DivideInPlace(words, 1000000000U);
+    const uint64_t upper = DivideInPlace(words, 1000000000U);
+    internal::detail::FormatAllDigitsLeftPadded(upper * 1000000000ULL + lower, 18, '0',
+                                                cursor);
   }
-  result->resize(output - result->data());
+  // The remaining value fits in a uint64_t (and is non-zero if the loop above ran)
+  internal::detail::FormatAllDigits(words[0], cursor);
 }
 
-std::string Decimal128::ToIntegerString() const {
-  std::string result;
-  if (high_bits() < 0) {
-    result.push_back('-');
+}  // namespace
+
+int32_t Decimal128::ToString(int32_t scale, char* out) const {
+  // Format the absolute value's digits into the tail of a stack buffer
+  std::array<char, 40> digits_buffer;
+  char* digits_end = digits_buffer.data() + digits_buffer.size();
+  char* digits = digits_end;
+  const bool is_negative = high_bits() < 0;
+  if (is_negative) {
     Decimal128 abs = *this;
     abs.Negate();
-    AppendLittleEndianArrayToString<2>(
-        {abs.low_bits(), static_cast<uint64_t>(abs.high_bits())}, &result);
+    FormatUnsignedDigits(static_cast<uint64_t>(abs.high_bits()), abs.low_bits(),
+                         &digits);
   } else {
-    AppendLittleEndianArrayToString<2>({low_bits(), static_cast<uint64_t>(high_bits())},
-                                       &result);
+    FormatUnsignedDigits(static_cast<uint64_t>(high_bits()), low_bits(), &digits);
   }
-  return result;
-}
-
-Decimal128::operator int64_t() const {
-  DCHECK(high_bits() == 0 || high_bits() == -1)
-      << "Trying to cast a Decimal128 greater than the value range of a "
-         "int64_t. high_bits_ must be equal to 0 or -1, got: "
-      << high_bits();
-  return static_cast<int64_t>(low_bits());
-}
+  const auto num_digits = static_cast<int32_t>(digits_end - digits);
+  // Computed in 64 bits as it may not fit in an int32_t for extreme scales
+  const int64_t adjusted_exponent = static_cast<int64_t>(num_digits) - 1 - scale;
 
-static void AdjustIntegerStringWithScale(int32_t scale, std::string* str) {
+  char* pos = out;
+  if (is_negative) {
+    *pos++ = '-';
+  }
   if (scale == 0) {
-    return;
+    std::memcpy(pos, digits, num_digits);
+    return static_cast<int32_t>(pos + num_digits - out);
   }
-  DCHECK(str != nullptr);
-  DCHECK(!str->empty());
-  const bool is_negative = str->front() == '-';
-  const auto is_negative_offset = static_cast<int32_t>(is_negative);
-  const auto len = static_cast<int32_t>(str->size());
-  const int32_t num_digits = len - is_negative_offset;
-  const int32_t adjusted_exponent = num_digits - 1 - scale;
 
   /// Note that the -6 is taken from the Java BigDecimal documentation.
   if (scale < 0 || adjusted_exponent < -6) {
-    // Example 1:
-    // Precondition: *str = "123", is_negative_offset = 0, num_digits = 3, scale = -2,
-    //               adjusted_exponent = 4
-    // After inserting decimal point: *str = "1.23"
-    // After appending exponent: *str = "1.23E+4"
-    // Example 2:
-    // Precondition: *str = "-123", is_negative_offset = 1, num_digits = 3, scale = 9,
-    //               adjusted_exponent = -7
-    // After inserting decimal point: *str = "-1.23"
-    // After appending exponent: *str = "-1.23E-7"
-    str->insert(str->begin() + 1 + is_negative_offset, '.');
-    str->push_back('E');
+    // Example 1: digits = "123", scale = -2, adjusted_exponent = 4 => "1.23E+4"
+    // Example 2: digits = "123" (negative), scale = 9, adjusted_exponent = -7
+    //            => "-1.23E-7"
+    *pos++ = digits[0];
+    *pos++ = '.';
+    std::memcpy(pos, digits + 1, num_digits - 1);
+    pos += num_digits - 1;
+    *pos++ = 'E';
     if (adjusted_exponent >= 0) {
-      str->push_back('+');
+      *pos++ = '+';
     }
-    internal::StringFormatter<Int32Type> format;
-    format(adjusted_exponent, [str](util::string_view formatted) {
-      str->append(formatted.data(), formatted.size());
+    internal::StringFormatter<Int64Type> format;
+    format(adjusted_exponent, [&pos](util::string_view formatted) {
+      std::memcpy(pos, formatted.data(), formatted.size());
+      pos += formatted.size();
     });
-    return;
+    return static_cast<int32_t>(pos - out);
   }
 
   if (num_digits > scale) {
-    const auto n = static_cast<size_t>(len - scale);
-    // Example 1:
-    // Precondition: *str = "123", len = num_digits = 3, scale = 1, n = 2
-    // After inserting decimal point: *str = "12.3"
-    // Example 2:
-    // Precondition: *str = "-123", len = 4, num_digits = 3, scale = 1, n = 3
-    // After inserting decimal point: *str = "-12.3"
-    str->insert(str->begin() + n, '.');
-    return;
-  }
-
-  // Example 1:
-  // Precondition: *str = "123", is_negative_offset = 0, num_digits = 3, scale = 4
-  // After insert: *str = "000123"
-  // After setting decimal point: *str = "0.0123"
-  // Example 2:
-  // Precondition: *str = "-123", is_negative_offset = 1, num_digits = 3, scale = 4
-  // After insert: *str = "-000123"
-  // After setting decimal point: *str = "-0.0123"
-  str->insert(is_negative_offset, scale - num_digits + 2, '0');
-  str->at(is_negative_offset + 1) = '.';
+    // Example: digits = "123", scale = 1 => "12.3"
+    const int32_t num_whole_digits = num_digits - scale;
+    std::memcpy(pos, digits, num_whole_digits);
+    pos += num_whole_digits;
+    *pos++ = '.';
+    std::memcpy(pos, digits + num_whole_digits, scale);
+    return static_cast<int32_t>(pos + scale - out);
+  }
+
+  // Example: digits = "123", scale = 4 => "0.0123"
+  *pos++ = '0';
+  *pos++ = '.';
+  std::memset(pos, '0', scale - num_digits);
+  pos += scale - num_digits;
+  std::memcpy(pos, digits, num_digits);
+  return static_cast<int32_t>(pos + num_digits - out);
+}
+
+std::string Decimal128::ToIntegerString() const { return ToString(0); }
+
+Decimal128::operator int64_t() const {
+  DCHECK(high_bits() == 0 || high_bits() == -1)
+      << "Trying to cast a Decimal128 greater than the value range of a "
+         "int64_t. high_bits_ must be equal to 0 or -1, got: "
+      << high_bits();
+  return static_cast<int64_t>(low_bits());
 }
 
 std::string Decimal128::ToString(int32_t scale) const {
-  std::string str(ToIntegerString());
-  AdjustIntegerStringWithScale(scale, &str);
-  return str;
+  std::array<char, kMaxStringLength> buffer;
+  return std::string(buffer.data(), ToString(scale, buffer.data()));
 }
 
 // Iterates over data and for each group of kInt64DecimalDigits multiple out by
@@ -355,11 +319,11 @@ static inline void ShiftAndAdd(const char* data, size_t length, Decimal128* out)
   for (size_t posn = 0; posn < length;) {
     const size_t group_size = std::min(kInt64DecimalDigits, length - posn);
     const int64_t multiple = kInt64PowersOfTen[group_size];
-    int64_t chunk = 0;
-    ARROW_CHECK(internal::ParseValue<Int64Type>(data + posn, group_size, &chunk));
+    uint64_t chunk = 0;
+    ARROW_CHECK(internal::ParseUnsigned(data + posn, group_size, &chunk));
 
     *out *= multiple;
-    *out += chunk;
+    *out += static_cast<int64_t>(chunk);
     posn += group_size;
   }
 }
@@ -517,6 +481,101 @@ Status Decimal128::FromString(const char* s, Decimal128* out, int32_t* precision
   return FromString(util::string_view(s), out, precision, scale);
 }
 
+namespace {
+
+// Drop `count` trailing digits from `whole` followed by `fractional`, returning false
+// if any of them is non-zero.
+bool DropTrailingZeros(size_t count, util::string_view* whole,
+                       util::string_view* fractional) {
+  for (util::string_view* digits : {fractional, whole}) {
+    const size_t n = std::min(count, digits->size());
+    for (size_t i = digits->size() - n; i < digits->size(); ++i) {
+      if ((*digits)[i] != '0') {
+        return false;
+      }
+    }
+    digits->remove_suffix(n);
+    count -= n;
+  }
+  return true;
+}
+
+// Parse at most kInt64DecimalDigits already validated digits
+inline uint64_t ParseDigitsChunk(const char* data, size_t length) {
+  uint64_t value = 0;
+  if (length > 0) {
+    ARROW_CHECK(internal::ParseUnsigned(data, length, &value));
+  }
+  return value;
+}
+
+}  // namespace
+
+Status Decimal128::FromStringAtScale(const util::string_view& s, int32_t precision,
+                                     int32_t scale, Decimal128* out) {
+  DecimalComponents dec;
+  if (ARROW_PREDICT_FALSE(!ParseDecimalComponents(s.data(), s.size(), &dec))) {
+    return Status::Invalid("The string '", s, "' is not a valid decimal number");
+  }
+
+  // The parsed digits represent an integer at scale (#fractional digits - exponent);
+  // bring it to the requested scale by appending or dropping trailing zeros.
+  const int64_t scale_delta = static_cast<int64_t>(scale) -
+                              static_cast<int64_t>(dec.fractional_digits.size()) +
+                              dec.exponent;
+  if (scale_delta < 0) {
+    const auto num_dropped = static_cast<uint64_t>(-scale_delta);
+    if (ARROW_PREDICT_FALSE(!DropTrailingZeros(
+            static_cast<size_t>(std::min<uint64_t>(num_dropped, s.size())),
+            &dec.whole_digits, &dec.fractional_digits))) {
+      return Status::Invalid("Cannot convert '", s, "' to Decimal128(precision = ",
+                             precision, ", scale = ", scale, "): rescaling would lose ",
+                             "digits");
+    }
+  }
+
+  // Strip leading zeros to count significant digits
+  while (!dec.whole_digits.empty() && dec.whole_digits.front() == '0') {
+    dec.whole_digits.remove_prefix(1);
+  }
+  if (dec.whole_digits.empty()) {
+    while (!dec.fractional_digits.empty() && dec.fractional_digits.front() == '0') {
+      dec.fractional_digits.remove_prefix(1);
+    }
+  }
+  const int64_t num_digits =
+      static_cast<int64_t>(dec.whole_digits.size() + dec.fractional_digits.size());
+  if (num_digits == 0) {
+    *out = 0;
+    return Status::OK();
+  }
+  const int64_t num_zeros = std::max<int64_t>(scale_delta, 0);
+  if (ARROW_PREDICT_FALSE(num_digits + num_zeros > precision)) {
+    return Status::Invalid("Cannot convert '", s, "' to Decimal128(precision = ",
+                           precision, ", scale = ", scale, "): overflow");
+  }
+
+  if (num_digits + num_zeros <= static_cast<int64_t>(kInt64DecimalDigits)) {
+    // Fast path: everything fits in a single uint64_t
+    uint64_t value = ParseDigitsChunk(dec.whole_digits.data(), dec.whole_digits.size());
+    value = value * kInt64PowersOfTen[dec.fractional_digits.size()] +
+            ParseDigitsChunk(dec.fractional_digits.data(), dec.fractional_digits.size());
+    value *= kInt64PowersOfTen[num_zeros];
+    *out = Decimal128(static_cast<int64_t>(value));
+  } else {
+    *out = 0;
+    ShiftAndAdd(dec.whole_digits.data(), dec.whole_digits.size(), out);
+    ShiftAndAdd(dec.fractional_digits.data(), dec.fractional_digits.size(), out);
+    if (num_zeros > 0) {
+      *out *= GetScaleMultiplier(static_cast<int32_t>(num_zeros));
+    }
+  }
+  if (dec.sign == '-') {
+    out->Negate();
+  }
+  return Status::OK();
+}
+
 Result<Decimal128> Decimal128::FromString(const util::string_view& s) {
   Decimal128 out;
   RETURN_NOT_OK(FromString(s, &out, nullptr, nullptr));
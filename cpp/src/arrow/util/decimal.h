@@ -81,10 +81,18 @@ class ARROW_EXPORT Decimal128 : public BasicDecimal128 {
     return std::move(result);
   }
 
+  /// \brief Maximum number of characters written by ToString(int32_t, char*)
+  static constexpr int32_t kMaxStringLength = 64;
+
   /// \brief Convert the Decimal128 value to a base 10 decimal string with the given
   /// scale.
   std::string ToString(int32_t scale) const;
 
+  /// \brief Write the base 10 decimal string with the given scale to `out`, which
+  /// must have room for kMaxStringLength characters.
+  /// \return the number of characters written
+  int32_t ToString(int32_t scale, char* out) const;
+
   /// \brief Convert the value to an integer string
   std::string ToIntegerString() const;
 
@@ -103,6 +111,14 @@ class ARROW_EXPORT Decimal128 : public BasicDecimal128 {
   static Result<Decimal128> FromString(const std::string& s);
   static Result<Decimal128> FromString(const char* s);
 
+  /// \brief Convert a decimal string directly to a Decimal128 value at the given
+  /// scale, without allocating.
+  ///
+  /// Unlike FromString() followed by Rescale(), this validates the precision of the
+  /// rescaled value and fails if rescaling would drop non-zero digits.
+  static Status FromStringAtScale(const util::string_view& s, int32_t precision,
+                                  int32_t scale, Decimal128* out);
+
   static Result<Decimal128> FromReal(double real, int32_t precision, int32_t scale);
   static Result<Decimal128> FromReal(float real, int32_t precision, int32_t scale);
 
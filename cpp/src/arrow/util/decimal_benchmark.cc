@@ -65,6 +65,18 @@ static void FromString(benchmark::State& state) {  // NOLINT non-const reference
   state.SetItemsProcessed(state.iterations() * values.size());
 }
 
+static void FromStringAtScale(benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<std::string>& values = GetValuesAsString();
+  for (auto _ : state) {
+    for (const auto& value : values) {
+      Decimal128 dec;
+      benchmark::DoNotOptimize(Decimal128::FromStringAtScale(value, 38, 12, &dec));
+      benchmark::DoNotOptimize(dec);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
 static void ToString(benchmark::State& state) {  // NOLINT non-const reference
   static const std::vector<DecimalValueAndScale> values = GetDecimalValuesAndScales();
   for (auto _ : state) {
@@ -75,6 +87,17 @@ static void ToString(benchmark::State& state) {  // NOLINT non-const reference
   state.SetItemsProcessed(state.iterations() * values.size());
 }
 
+static void ToStringIntoBuffer(benchmark::State& state) {  // NOLINT non-const reference
+  static const std::vector<DecimalValueAndScale> values = GetDecimalValuesAndScales();
+  char buffer[Decimal128::kMaxStringLength];
+  for (auto _ : state) {
+    for (const DecimalValueAndScale& item : values) {
+      benchmark::DoNotOptimize(item.decimal.ToString(item.scale, buffer));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
 constexpr int32_t kValueSize = 10;
 
 static void BinaryCompareOp(benchmark::State& state) {  // NOLINT non-const reference
@@ -172,6 +195,41 @@ static void Constants(benchmark::State& state) {  // NOLINT non-const reference
   state.SetItemsProcessed(state.iterations() * 2);
 }
 
+// The Decimal128 paths of the compute kernels rescale their operands, and round
+// the results of multiplications that exceed 38 digits
+static void Rescale(benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<BasicDecimal128> v;
+  for (int x = 0; x < kValueSize; x++) {
+    v.emplace_back(100 + x, 100 + x);
+  }
+
+  for (auto _ : state) {
+    for (int x = 0; x < kValueSize; x += 2) {
+      benchmark::DoNotOptimize(v[x].IncreaseScaleBy(2));
+      benchmark::DoNotOptimize(v[x + 1].ReduceScaleBy(3));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kValueSize);
+}
+
+static void DivideWithRemainder(benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<BasicDecimal128> v;
+  for (int x = 0; x < kValueSize; x++) {
+    v.emplace_back(100 + x, 100 + x);
+  }
+  const BasicDecimal128 divisor = BasicDecimal128::GetScaleMultiplier(20);
+
+  for (auto _ : state) {
+    for (int x = 0; x < kValueSize; x++) {
+      BasicDecimal128 quotient, remainder;
+      benchmark::DoNotOptimize(v[x].Divide(divisor, &quotient, &remainder));
+      benchmark::DoNotOptimize(quotient);
+      benchmark::DoNotOptimize(remainder);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kValueSize);
+}
+
 static void BinaryBitOp(benchmark::State& state) {  // NOLINT non-const reference
   std::vector<BasicDecimal128> v1, v2;
   for (int x = 0; x < kValueSize; x++) {
@@ -189,13 +247,17 @@ static void BinaryBitOp(benchmark::State& state) {  // NOLINT non-const referenc
 }
 
 BENCHMARK(FromString);
+BENCHMARK(FromStringAtScale);
 BENCHMARK(ToString);
+BENCHMARK(ToStringIntoBuffer);
 BENCHMARK(BinaryMathOp);
 BENCHMARK(BinaryMathOpAggregate);
 BENCHMARK(BinaryCompareOp);
 BENCHMARK(BinaryCompareOpConstant);
 BENCHMARK(UnaryOp);
 BENCHMARK(Constants);
+BENCHMARK(Rescale);
+BENCHMARK(DivideWithRemainder);
 BENCHMARK(BinaryBitOp);
 
 }  // namespace Decimal
@@ -448,6 +448,66 @@ TEST(Decimal128ParseTest, WithExponentAndNullptrScale) {
   ASSERT_OK_AND_EQ(expected_value, Decimal128::FromString("1.23E-8"));
 }
 
+TEST(Decimal128ParseTest, FromStringAtScale) {
+  auto check = [](const std::string& s, int32_t precision, int32_t scale,
+                  const std::string& expected) {
+    Decimal128 value;
+    ASSERT_OK(Decimal128::FromStringAtScale(s, precision, scale, &value));
+    ASSERT_EQ(value, Decimal128(expected)) << s;
+  };
+  check("0", 5, 2, "0");
+  check("-0.000", 1, 0, "0");
+  check("12.3", 5, 2, "1230");
+  check("-12.30", 4, 2, "-1230");
+  check("+.5", 3, 3, "500");
+  check("1.23E-8", 12, 10, "123");
+  check("1.23E+3", 4, 0, "1230");
+  check("12.3E4", 6, 0, "123000");
+  check("0.0123E2", 3, 2, "123");
+  check("000123.4500", 5, 2, "12345");
+  // Values needing more than one 18-digit chunk
+  check("12345678901234567890.123456789", 29, 9, "12345678901234567890123456789");
+  check("-99999999999999999999999999999999999999", 38, 0,
+        "-99999999999999999999999999999999999999");
+  check("1", 38, 37, "10000000000000000000000000000000000000");
+
+  Decimal128 value;
+  ASSERT_RAISES(Invalid, Decimal128::FromStringAtScale("", 5, 2, &value));
+  ASSERT_RAISES(Invalid, Decimal128::FromStringAtScale("1.2x", 5, 2, &value));
+  // Overflows the precision once rescaled
+  ASSERT_RAISES(Invalid, Decimal128::FromStringAtScale("1000", 5, 2, &value));
+  ASSERT_RAISES(Invalid, Decimal128::FromStringAtScale("1E38", 38, 0, &value));
+  // Would drop non-zero digits
+  ASSERT_RAISES(Invalid, Decimal128::FromStringAtScale("1.234", 5, 2, &value));
+  ASSERT_RAISES(Invalid, Decimal128::FromStringAtScale("1E-5", 5, 2, &value));
+}
+
+TEST(Decimal128Test, ToStringIntoBuffer) {
+  auto check = [](const Decimal128& value, int32_t scale, const std::string& expected) {
+    std::array<char, Decimal128::kMaxStringLength> buffer;
+    const int32_t length = value.ToString(scale, buffer.data());
+    ASSERT_EQ(expected, std::string(buffer.data(), length));
+    ASSERT_EQ(expected, value.ToString(scale));
+  };
+  // Values spanning several 18-digit chunks, including zeros inside a chunk
+  check(Decimal128("18446744073709551616"), 0, "18446744073709551616");
+  check(Decimal128("1000000000000000000000000000000000001"), 0,
+        "1000000000000000000000000000000000001");
+  check(Decimal128("-99999999999999999999999999999999999999"), 38,
+        "-0.99999999999999999999999999999999999999");
+  check(Decimal128::GetMaxValue(), 2, "999999999999999999999999999999999999.99");
+  check(Decimal128(BasicDecimal128(-0x8000000000000000LL, 0)), 0,
+        "-170141183460469231731687303715884105728");
+  // Longest outputs
+  check(Decimal128::GetMaxValue(), std::numeric_limits<int32_t>::min(),
+        "9.9999999999999999999999999999999999999E+2147483685");
+  check(Decimal128("-99999999999999999999999999999999999999"),
+        std::numeric_limits<int32_t>::max(),
+        "-9.9999999999999999999999999999999999999E-2147483610");
+  check(Decimal128("-1"), 43, "-1.E-43");
+  check(Decimal128("-1"), 6, "-0.000001");
+}
+
 template <typename Real>
 void CheckDecimalFromReal(Real real, int32_t precision, int32_t scale,
                           const std::string& expected) {
@@ -105,6 +105,8 @@ class DynamicDispatch {
         return cpu_info->IsSupported(CpuInfo::AVX2);
       case DispatchLevel::AVX512:
         return cpu_info->IsSupported(CpuInfo::AVX512);
+      case DispatchLevel::NEON:
+        return cpu_info->IsSupported(CpuInfo::ASIMD);
       default:
         return false;
     }
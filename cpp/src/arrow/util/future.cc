@@ -23,6 +23,8 @@
 #include <condition_variable>
 #include <mutex>
 #include <numeric>
+#include <utility>
+#include <vector>
 
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
@@ -230,6 +232,7 @@ class ConcreteFutureImpl : public FutureImpl {
   void DoMarkFailed() { DoMarkFinishedOrFailed(FutureState::FAILURE); }
 
   void DoMarkFinishedOrFailed(FutureState state) {
+    std::vector<Callback> callbacks;
     {
       // Lock the hypothetical waiter first, and the future after.
       // This matches the locking order done in FutureWaiter constructor.
@@ -241,8 +244,27 @@ class ConcreteFutureImpl : public FutureImpl {
       if (waiter_ != nullptr) {
         waiter_->MarkFutureFinishedUnlocked(waiter_arg_, state);
       }
+      callbacks = std::move(callbacks_);
+      callbacks_.clear();
     }
     cv_.notify_all();
+
+    // Callbacks run without any lock held, as they may add callbacks to this
+    // future or complete other futures
+    for (auto& callback : callbacks) {
+      callback();
+    }
+  }
+
+  void DoAddCallback(Callback callback) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (!IsFutureFinished(state_)) {
+        callbacks_.push_back(std::move(callback));
+        return;
+      }
+    }
+    callback();
   }
 
   void DoWait() {
@@ -263,6 +285,7 @@ class ConcreteFutureImpl : public FutureImpl {
   std::condition_variable cv_;
   FutureWaiter* waiter_ = nullptr;
   int waiter_arg_ = -1;
+  std::vector<Callback> callbacks_;
 };
 
 namespace {
@@ -295,4 +318,8 @@ void FutureImpl::MarkFinished() { GetConcreteFuture(this)->DoMarkFinished(); }
 
 void FutureImpl::MarkFailed() { GetConcreteFuture(this)->DoMarkFailed(); }
 
+void FutureImpl::AddCallback(Callback callback) {
+  GetConcreteFuture(this)->DoAddCallback(std::move(callback));
+}
+
 }  // namespace arrow
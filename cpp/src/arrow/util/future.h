@@ -19,6 +19,7 @@
 
 #include <atomic>
 #include <cmath>
+#include <functional>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -53,6 +54,14 @@ class ARROW_EXPORT FutureImpl {
 
   static std::unique_ptr<FutureImpl> Make();
 
+  using Callback = std::function<void()>;
+
+  /// \brief Run the callback once the future is finished
+  ///
+  /// The callback runs in the thread marking the future finished, or
+  /// immediately in the calling thread if the future is already finished.
+  void AddCallback(Callback callback);
+
  protected:
   FutureImpl();
   ARROW_DISALLOW_COPY_AND_ASSIGN(FutureImpl);
@@ -151,9 +160,12 @@ template <typename T>
 class FutureStorage : public FutureStorageBase {
  public:
   static constexpr bool HasValue = true;
+  using OutcomeType = Result<T>;
 
   Status status() const { return result_.status(); }
 
+  const OutcomeType& outcome() const { return result_; }
+
   template <typename U>
   void MarkFinished(U&& value) {
     result_ = std::forward<U>(value);
@@ -174,18 +186,25 @@ class FutureStorage : public FutureStorageBase {
   friend class Future<T>;
 };
 
-// A Future<void> just stores a Status (always ok for now, but that could change
-// if we implement cancellation).
+// A Future<void> just stores a Status, which is not ok when the Future is
+// the continuation of a failed Future.
 template <>
 class FutureStorage<void> : public FutureStorageBase {
  public:
   static constexpr bool HasValue = false;
+  using OutcomeType = Status;
 
   Status status() const { return status_; }
 
+  const OutcomeType& outcome() const { return status_; }
+
   void MarkFinished(Status st = Status::OK()) {
     status_ = std::move(st);
-    impl_->MarkFinished();
+    if (ARROW_PREDICT_TRUE(status_.ok())) {
+      impl_->MarkFinished();
+    } else {
+      impl_->MarkFailed();
+    }
   }
 
   template <typename Func>
@@ -203,9 +222,12 @@ template <>
 class FutureStorage<Status> : public FutureStorageBase {
  public:
   static constexpr bool HasValue = false;
+  using OutcomeType = Status;
 
   Status status() const { return status_; }
 
+  const OutcomeType& outcome() const { return status_; }
+
   void MarkFinished(Status st) {
     status_ = std::move(st);
     if (ARROW_PREDICT_TRUE(status_.ok())) {
@@ -224,6 +246,124 @@ class FutureStorage<Status> : public FutureStorageBase {
   Status status_;
 };
 
+// ---------------------------------------------------------------------
+// Helpers for continuations
+
+namespace detail {
+
+// The return type of a continuation called with the value of a Future<T>
+template <typename OnSuccess, typename T>
+struct ContinueResult {
+  using type = typename std::result_of<OnSuccess&(const T&)>::type;
+};
+
+template <typename OnSuccess>
+struct ContinueResult<OnSuccess, void> {
+  using type = typename std::result_of<OnSuccess&()>::type;
+};
+
+template <typename OnSuccess>
+struct ContinueResult<OnSuccess, Status> {
+  using type = typename std::result_of<OnSuccess&()>::type;
+};
+
+// Run a continuation returning R and complete the continued Future with its
+// outcome.  A continuation returning V, Result<V> or Future<V> continues into
+// a Future<V>, one returning void or Status into a Future<void>.
+template <typename R>
+struct ContinueFuture {
+  using FutureType = Future<R>;
+
+  template <typename NextFuture, typename ContinueFunc, typename... Args>
+  static void Run(NextFuture next, ContinueFunc&& func, Args&&... args) {
+    next.MarkFinished(std::forward<ContinueFunc>(func)(std::forward<Args>(args)...));
+  }
+};
+
+template <typename V>
+struct ContinueFuture<Result<V>> {
+  using FutureType = Future<V>;
+
+  template <typename NextFuture, typename ContinueFunc, typename... Args>
+  static void Run(NextFuture next, ContinueFunc&& func, Args&&... args) {
+    next.MarkFinished(std::forward<ContinueFunc>(func)(std::forward<Args>(args)...));
+  }
+};
+
+template <>
+struct ContinueFuture<void> {
+  using FutureType = Future<void>;
+
+  template <typename NextFuture, typename ContinueFunc, typename... Args>
+  static void Run(NextFuture next, ContinueFunc&& func, Args&&... args) {
+    std::forward<ContinueFunc>(func)(std::forward<Args>(args)...);
+    next.MarkFinished();
+  }
+};
+
+template <>
+struct ContinueFuture<Status> {
+  using FutureType = Future<void>;
+
+  template <typename NextFuture, typename ContinueFunc, typename... Args>
+  static void Run(NextFuture next, ContinueFunc&& func, Args&&... args) {
+    next.MarkFinished(std::forward<ContinueFunc>(func)(std::forward<Args>(args)...));
+  }
+};
+
+template <typename V>
+struct ContinueFuture<Future<V>> {
+  using FutureType = Future<V>;
+
+  template <typename NextFuture, typename ContinueFunc, typename... Args>
+  static void Run(NextFuture next, ContinueFunc&& func, Args&&... args) {
+    Future<V> inner = std::forward<ContinueFunc>(func)(std::forward<Args>(args)...);
+    inner.AddCallback([next](const typename Future<V>::OutcomeType& outcome) mutable {
+      next.MarkFinished(outcome);
+    });
+  }
+};
+
+template <typename OnSuccess, typename T>
+using ContinuedFuture =
+    typename ContinueFuture<typename ContinueResult<OnSuccess, T>::type>::FutureType;
+
+// The default failure handler of Future::Then(), which forwards the error to
+// the continued Future
+struct PropagateFailure {};
+
+inline Status OutcomeStatus(const Status& st) { return st; }
+
+template <typename T>
+Status OutcomeStatus(const Result<T>& res) {
+  return res.status();
+}
+
+template <typename NextFuture, typename OnSuccess, typename T>
+void ContinueSuccess(NextFuture next, OnSuccess& on_success, const Result<T>& res) {
+  using R = typename ContinueResult<OnSuccess, T>::type;
+  ContinueFuture<R>::Run(std::move(next), on_success, res.ValueUnsafe());
+}
+
+template <typename NextFuture, typename OnSuccess>
+void ContinueSuccess(NextFuture next, OnSuccess& on_success, const Status&) {
+  using R = typename std::result_of<OnSuccess&()>::type;
+  ContinueFuture<R>::Run(std::move(next), on_success);
+}
+
+template <typename NextFuture, typename OnFailure>
+void ContinueFailure(NextFuture next, OnFailure& on_failure, const Status& st) {
+  using R = typename std::result_of<OnFailure&(const Status&)>::type;
+  ContinueFuture<R>::Run(std::move(next), on_failure, st);
+}
+
+template <typename NextFuture>
+void ContinueFailure(NextFuture next, PropagateFailure&, const Status& st) {
+  next.MarkFinished(st);
+}
+
+}  // namespace detail
+
 // ---------------------------------------------------------------------
 // Public API
 
@@ -237,7 +377,9 @@ class FutureStorage<Status> : public FutureStorageBase {
 ///
 /// The consumer API allows querying a Future's current state, wait for it
 /// to complete, or wait on multiple Futures at once (using WaitForAll,
-/// WaitForAny or AsCompletedIterator).
+/// WaitForAny or AsCompletedIterator).  It also allows reacting to the
+/// Future's completion without blocking a thread, with callbacks and
+/// continuations (using AddCallback, Then, All or AllComplete).
 template <typename T>
 class Future {
   static constexpr bool HasValue = FutureStorage<T>::HasValue;
@@ -247,6 +389,12 @@ class Future {
  public:
   static constexpr double kInfinity = FutureImpl::kInfinity;
 
+  using ValueType = T;
+
+  /// The outcome of the Future passed to callbacks: Result<T>, or Status for
+  /// Future<void> and Future<Status>
+  using OutcomeType = typename FutureStorage<T>::OutcomeType;
+
   // The default constructor creates an invalid Future.  Use Future::Make()
   // for a valid Future.  This constructor is mostly for the convenience
   // of being able to presize a vector of Futures.
@@ -311,6 +459,48 @@ class Future {
     return impl_->Wait(seconds);
   }
 
+  /// \brief Consumer API: run a callback once the Future completes
+  ///
+  /// The callback is called with the Future's outcome, as a
+  /// `const OutcomeType&`.  It runs in the thread marking the Future
+  /// finished, or immediately if the Future is already finished, so it should
+  /// be quick; longer work should be spawned on an executor.
+  template <typename OnComplete>
+  void AddCallback(OnComplete on_complete) const {
+    CheckValid();
+    // Callbacks are owned by the storage's FutureImpl, so the storage outlives them
+    const FutureStorage<T>* storage = storage_.get();
+    impl_->AddCallback(
+        [storage, on_complete]() mutable { on_complete(storage->outcome()); });
+  }
+
+  /// \brief Consumer API: chain a continuation to the Future
+  ///
+  /// Once the Future completes successfully, on_success is called with its
+  /// value as a `const T&` (or without arguments for Future<void> and
+  /// Future<Status>).  If it fails, on_failure is called with the error
+  /// instead; by default the error is simply forwarded.  Both must have the
+  /// same return type, which determines the returned Future:
+  /// - `V`, `Result<V>` or `Future<V>` gives a Future<V>
+  /// - `void` or `Status` gives a Future<void>
+  ///
+  /// The returned Future completes with the continuation's outcome, without
+  /// any thread blocking in the meantime.  Like callbacks, continuations run
+  /// in the thread completing the Future; see Executor::Transfer().
+  template <typename OnSuccess, typename OnFailure = detail::PropagateFailure,
+            typename ContinuedFuture = detail::ContinuedFuture<OnSuccess, T>>
+  ContinuedFuture Then(OnSuccess on_success, OnFailure on_failure = OnFailure()) const {
+    auto next = ContinuedFuture::Make();
+    AddCallback([next, on_success, on_failure](const OutcomeType& outcome) mutable {
+      if (ARROW_PREDICT_TRUE(outcome.ok())) {
+        detail::ContinueSuccess(next, on_success, outcome);
+      } else {
+        detail::ContinueFailure(next, on_failure, detail::OutcomeStatus(outcome));
+      }
+    });
+    return next;
+  }
+
   // Producer API
 
   /// \brief Producer API: execute function and mark Future finished
@@ -419,6 +609,82 @@ inline std::vector<int> WaitForAny(const std::vector<Future<T>*>& futures,
   return waiter->MoveFinishedFutures();
 }
 
+/// \brief Create a Future completing once all the given futures complete
+///
+/// The returned Future's value holds the results of all futures, in order.
+/// It doesn't fail: the errors are in the results.  Unlike WaitForAll, no
+/// thread blocks waiting for the futures.
+template <typename T>
+Future<std::vector<Result<T>>> All(std::vector<Future<T>> futures) {
+  struct State {
+    explicit State(std::vector<Future<T>> f)
+        : futures(std::move(f)), n_remaining(futures.size()) {}
+
+    std::vector<Future<T>> futures;
+    std::atomic<size_t> n_remaining;
+  };
+
+  auto out = Future<std::vector<Result<T>>>::Make();
+  if (futures.empty()) {
+    out.MarkFinished(std::vector<Result<T>>{});
+    return out;
+  }
+  auto state = std::make_shared<State>(std::move(futures));
+  for (const auto& future : state->futures) {
+    future.AddCallback([state, out](const Result<T>&) mutable {
+      if (state->n_remaining.fetch_sub(1) != 1) {
+        return;
+      }
+      std::vector<Result<T>> results;
+      results.reserve(state->futures.size());
+      for (const auto& f : state->futures) {
+        results.push_back(f.result());
+      }
+      out.MarkFinished(std::move(results));
+    });
+  }
+  return out;
+}
+
+/// \brief Create a Future completing once all the given futures complete
+///
+/// The returned Future fails with the error of the first failed future, in
+/// order, if any.
+template <typename T>
+Future<void> AllComplete(const std::vector<Future<T>>& futures) {
+  struct State {
+    explicit State(const std::vector<Future<T>>& f)
+        : futures(f), n_remaining(futures.size()) {}
+
+    std::vector<Future<T>> futures;
+    std::atomic<size_t> n_remaining;
+  };
+
+  auto out = Future<void>::Make();
+  if (futures.empty()) {
+    out.MarkFinished();
+    return out;
+  }
+  auto state = std::make_shared<State>(futures);
+  for (const auto& future : state->futures) {
+    future.AddCallback(
+        [state, out](const typename Future<T>::OutcomeType&) mutable {
+          if (state->n_remaining.fetch_sub(1) != 1) {
+            return;
+          }
+          for (const auto& f : state->futures) {
+            Status st = f.status();
+            if (!st.ok()) {
+              out.MarkFinished(std::move(st));
+              return;
+            }
+          }
+          out.MarkFinished();
+        });
+  }
+  return out;
+}
+
 #define ARROW_ASSIGN_OR_RETURN_FUTURE_IMPL(result_name, lhs, T, rexpr) \
   auto result_name = (rexpr);                                          \
   if (ARROW_PREDICT_FALSE(!(result_name).ok())) {                      \
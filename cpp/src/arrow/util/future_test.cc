@@ -358,6 +358,149 @@ TEST(FutureSyncTest, Status) {
   }
 }
 
+TEST(FutureSyncTest, VoidFailure) {
+  auto fut = Future<void>::Make();
+  fut.MarkFinished(Status::IOError("xxx"));
+  AssertFailed(fut);
+  ASSERT_RAISES(IOError, fut.status());
+}
+
+// --------------------------------------------------------------------
+// Callback and continuation tests
+
+TEST(FutureCallbackTest, AddCallback) {
+  auto fut = Future<int>::Make();
+  std::vector<int> seen;
+  fut.AddCallback([&](const Result<int>& res) { seen.push_back(*res); });
+  fut.AddCallback([&](const Result<int>& res) { seen.push_back(*res + 1); });
+  ASSERT_TRUE(seen.empty());
+  fut.MarkFinished(42);
+  ASSERT_EQ(seen, std::vector<int>({42, 43}));
+
+  // Callbacks added to a finished future run immediately
+  fut.AddCallback([&](const Result<int>& res) { seen.push_back(*res + 2); });
+  ASSERT_EQ(seen, std::vector<int>({42, 43, 44}));
+
+  auto void_fut = Future<void>::Make();
+  Status seen_status;
+  void_fut.AddCallback([&](const Status& st) { seen_status = st; });
+  void_fut.MarkFinished(Status::IOError("xxx"));
+  ASSERT_RAISES(IOError, seen_status);
+}
+
+TEST(FutureCallbackTest, ThenValue) {
+  auto fut = Future<int>::Make();
+  auto plus_one = fut.Then([](const int& x) { return x + 1; });
+  auto as_result = plus_one.Then([](const int& x) -> Result<std::string> {
+    return std::to_string(x);
+  });
+  AssertNotFinished(plus_one);
+  AssertNotFinished(as_result);
+  fut.MarkFinished(41);
+  ASSERT_OK_AND_EQ(42, plus_one.result());
+  ASSERT_OK_AND_EQ("42", as_result.result());
+
+  // Continuing a finished future
+  ASSERT_OK_AND_EQ(84, plus_one.Then([](const int& x) { return 2 * x; }).result());
+}
+
+TEST(FutureCallbackTest, ThenVoidAndStatus) {
+  auto fut = Future<int>::Make();
+  int seen = 0;
+  Future<void> void_next = fut.Then([&](const int& x) { seen = x; });
+  Future<void> status_next =
+      fut.Then([](const int&) -> Status { return Status::Invalid("xxx"); });
+  fut.MarkFinished(42);
+  ASSERT_OK(void_next.status());
+  ASSERT_EQ(seen, 42);
+  ASSERT_RAISES(Invalid, status_next.status());
+
+  // Future<void> continuations take no arguments
+  auto from_void = void_next.Then([]() { return 7; });
+  ASSERT_OK_AND_EQ(7, from_void.result());
+}
+
+TEST(FutureCallbackTest, ThenFuture) {
+  auto fut = Future<int>::Make();
+  auto inner = Future<std::string>::Make();
+  auto next = fut.Then([&](const int&) { return inner; });
+  fut.MarkFinished(1);
+  AssertNotFinished(next);
+  inner.MarkFinished(std::string("xxx"));
+  ASSERT_OK_AND_EQ("xxx", next.result());
+}
+
+TEST(FutureCallbackTest, ThenFailure) {
+  auto fut = Future<int>::Make();
+  bool called = false;
+  auto next = fut.Then([&](const int& x) {
+    called = true;
+    return x;
+  });
+  auto recovered = fut.Then([](const int& x) { return x; },
+                            [](const Status&) { return -1; });
+  fut.MarkFinished(Status::IOError("xxx"));
+  ASSERT_RAISES(IOError, next.result());
+  ASSERT_FALSE(called);
+  ASSERT_OK_AND_EQ(-1, recovered.result());
+}
+
+TEST(FutureCallbackTest, All) {
+  std::vector<Future<int>> futures = {Future<int>::Make(), Future<int>::Make(),
+                                      Future<int>::Make()};
+  auto all = All(futures);
+  auto all_complete = AllComplete(futures);
+  futures[2].MarkFinished(2);
+  futures[0].MarkFinished(0);
+  AssertNotFinished(all);
+  AssertNotFinished(all_complete);
+  futures[1].MarkFinished(Status::IOError("xxx"));
+
+  ASSERT_OK_AND_ASSIGN(auto results, all.result());
+  ASSERT_EQ(results.size(), 3u);
+  ASSERT_OK_AND_EQ(0, results[0]);
+  ASSERT_RAISES(IOError, results[1]);
+  ASSERT_OK_AND_EQ(2, results[2]);
+  ASSERT_RAISES(IOError, all_complete.status());
+
+  ASSERT_OK_AND_ASSIGN(results, All(std::vector<Future<int>>{}).result());
+  ASSERT_TRUE(results.empty());
+  ASSERT_OK(AllComplete(std::vector<Future<int>>{}).status());
+}
+
+TEST(FutureCallbackTest, Transfer) {
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::Make(/*threads=*/1));
+  auto fut = Future<int>::Make();
+  auto transferred = pool->Transfer(fut);
+  auto on_pool = transferred.Then([&](const int& x) {
+    return std::make_pair(x, pool->OwnsThisThread());
+  });
+  fut.MarkFinished(42);
+  ASSERT_OK_AND_ASSIGN(auto pair, on_pool.result());
+  ASSERT_EQ(pair.first, 42);
+  ASSERT_TRUE(pair.second);
+}
+
+TEST(FutureCallbackTest, StressCallbacks) {
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::Make(/*threads=*/4));
+  const int nfutures = 1000;
+  std::vector<Future<int>> futures;
+  std::vector<Future<int>> continued;
+  for (int i = 0; i < nfutures; ++i) {
+    futures.push_back(Future<int>::Make());
+  }
+  for (int i = 0; i < nfutures; ++i) {
+    auto fut = futures[i];
+    ASSERT_OK(pool->Spawn([fut]() mutable { fut.MarkFinished(1); }));
+    // Add continuations concurrently with completion
+    continued.push_back(futures[i].Then([i](const int& x) { return x + i; }));
+  }
+  ASSERT_OK_AND_ASSIGN(auto results, All(continued).result());
+  for (int i = 0; i < nfutures; ++i) {
+    ASSERT_OK_AND_EQ(i + 1, results[i]);
+  }
+}
+
 // --------------------------------------------------------------------
 // Tests with an executor
 
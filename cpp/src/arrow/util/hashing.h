@@ -41,6 +41,7 @@
 #include "arrow/util/bitmap_builders.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/simd.h"
 #include "arrow/util/ubsan.h"
 
 #define XXH_INLINE_ALL
@@ -372,6 +373,242 @@ class HashTable {
   TypedBufferBuilder<Entry> entries_builder_;
 };
 
+// ----------------------------------------------------------------------
+// An insert-only hash table probing groups of slots at once (no deletes)
+//
+// Each slot has a control byte, stored apart from the entries, holding either
+// kEmpty or the low 7 bits of the hash of its entry.  A lookup hashes to a
+// group of kGroupSize slots and matches all their control bytes at once (with
+// SSE2 where available), so that entries are only read when their control byte
+// matches.  Probing a group thus touches a single cache line of control bytes,
+// which keeps large tables fast, and allows a higher load factor than HashTable.
+//
+// This is a drop-in replacement for HashTable, except that its entries are
+// only initialized once inserted.
+
+template <typename Payload>
+class SwissHashTable {
+ public:
+  static constexpr hash_t kSentinel = 0ULL;
+  static constexpr int kGroupSize = 16;
+
+  struct Entry {
+    hash_t h;
+    Payload payload;
+  };
+
+  SwissHashTable(MemoryPool* pool, uint64_t capacity)
+      : entries_builder_(pool), control_builder_(pool) {
+    DCHECK_NE(pool, nullptr);
+    // Minimum of 32 slots, with room for `capacity` entries
+    capacity = std::max<uint64_t>(
+        capacity * kMaxLoadDenominator / kMaxLoadNumerator + 1, 32UL);
+    capacity_ = BitUtil::NextPower2(capacity);
+    group_mask_ = capacity_ / kGroupSize - 1;
+    size_ = 0;
+
+    DCHECK_OK(UpsizeBuffers(capacity_));
+  }
+
+  // Lookup with group probing
+  // cmp_func should have signature bool(const Payload*).
+  // Return a (Entry*, found) pair.
+  template <typename CmpFunc>
+  std::pair<Entry*, bool> Lookup(hash_t h, CmpFunc&& cmp_func) {
+    auto p = Lookup<DoCompare, CmpFunc>(h, control_, entries_, group_mask_,
+                                        std::forward<CmpFunc>(cmp_func));
+    return {&entries_[p.first], p.second};
+  }
+
+  template <typename CmpFunc>
+  std::pair<const Entry*, bool> Lookup(hash_t h, CmpFunc&& cmp_func) const {
+    auto p = Lookup<DoCompare, CmpFunc>(h, control_, entries_, group_mask_,
+                                        std::forward<CmpFunc>(cmp_func));
+    return {&entries_[p.first], p.second};
+  }
+
+  Status Insert(Entry* entry, hash_t h, const Payload& payload) {
+    const uint64_t index = static_cast<uint64_t>(entry - entries_);
+    // Ensure entry is empty before inserting
+    assert(control_[index] == kEmpty);
+    entry->h = FixHash(h);
+    entry->payload = payload;
+    control_[index] = ControlByte(entry->h);
+    ++size_;
+
+    if (ARROW_PREDICT_FALSE(NeedUpsizing())) {
+      return Upsize(capacity_ * 2);
+    }
+    return Status::OK();
+  }
+
+  uint64_t size() const { return size_; }
+
+  // Visit all non-empty entries in the table
+  // The visit_func should have signature void(const Entry*)
+  template <typename VisitFunc>
+  void VisitEntries(VisitFunc&& visit_func) const {
+    for (uint64_t i = 0; i < capacity_; i++) {
+      if (control_[i] != kEmpty) {
+        visit_func(&entries_[i]);
+      }
+    }
+  }
+
+ protected:
+  // NoCompare is for when the value is known not to exist in the table
+  enum CompareKind { DoCompare, NoCompare };
+
+  static constexpr uint8_t kEmpty = 0x80;
+  // Keep the load factor <= 7/8
+  static constexpr uint64_t kMaxLoadNumerator = 7;
+  static constexpr uint64_t kMaxLoadDenominator = 8;
+
+  static uint8_t ControlByte(hash_t h) { return static_cast<uint8_t>(h & 0x7f); }
+
+  // A bit mask of the slots of a group, the i-th bit for the i-th slot
+  using GroupMask = uint32_t;
+
+#if defined(ARROW_HAVE_SSE4_2)
+  static __m128i LoadGroup(const uint8_t* group) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+  }
+
+  static GroupMask MatchByte(const uint8_t* group, uint8_t byte) {
+    const __m128i matches =
+        _mm_cmpeq_epi8(LoadGroup(group), _mm_set1_epi8(static_cast<char>(byte)));
+    return static_cast<GroupMask>(_mm_movemask_epi8(matches));
+  }
+
+  static GroupMask MatchEmpty(const uint8_t* group) {
+    // kEmpty is the only control byte with its high bit set
+    return static_cast<GroupMask>(_mm_movemask_epi8(LoadGroup(group)));
+  }
+#else
+  static constexpr uint64_t kLowBits = 0x0101010101010101ULL;
+  static constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+
+  // Gather the high bit of each byte of `word` into the low 8 bits
+  static GroupMask PackHighBits(uint64_t word) {
+    return static_cast<GroupMask>(((word >> 7) * 0x0102040810204080ULL) >> 56);
+  }
+
+  static uint64_t LoadGroupWord(const uint8_t* group, int i) {
+    return BitUtil::FromLittleEndian(util::SafeLoadAs<uint64_t>(group + 8 * i));
+  }
+
+  // This may report spurious matches for full slots next to actual matches,
+  // which is harmless since the full hash is compared afterwards
+  static GroupMask MatchByte(const uint8_t* group, uint8_t byte) {
+    GroupMask mask = 0;
+    for (int i = 0; i < kGroupSize / 8; ++i) {
+      const uint64_t word = LoadGroupWord(group, i) ^ (kLowBits * byte);
+      mask |= PackHighBits((word - kLowBits) & ~word & kHighBits) << (8 * i);
+    }
+    return mask;
+  }
+
+  static GroupMask MatchEmpty(const uint8_t* group) {
+    GroupMask mask = 0;
+    for (int i = 0; i < kGroupSize / 8; ++i) {
+      mask |= PackHighBits(LoadGroupWord(group, i) & kHighBits) << (8 * i);
+    }
+    return mask;
+  }
+#endif
+
+  // The workhorse lookup function
+  template <CompareKind CKind, typename CmpFunc>
+  std::pair<uint64_t, bool> Lookup(hash_t h, const uint8_t* control, const Entry* entries,
+                                   uint64_t group_mask, CmpFunc&& cmp_func) const {
+    h = FixHash(h);
+    const uint8_t control_byte = ControlByte(h);
+    uint64_t group = (h >> 7) & group_mask;
+
+    for (uint64_t stride = 1;; ++stride) {
+      const uint8_t* group_control = control + group * kGroupSize;
+      if (CKind == DoCompare) {
+        GroupMask matches = MatchByte(group_control, control_byte);
+        while (matches != 0) {
+          const uint64_t index =
+              group * kGroupSize + BitUtil::CountTrailingZeros(matches);
+          if (entries[index].h == h && cmp_func(&entries[index].payload)) {
+            // Found
+            return {index, true};
+          }
+          matches &= matches - 1;
+        }
+      }
+      const GroupMask empty = MatchEmpty(group_control);
+      if (empty != 0) {
+        // Empty slot
+        return {group * kGroupSize + BitUtil::CountTrailingZeros(empty), false};
+      }
+      // Triangular probing, which visits all groups since their number is
+      // a power of two
+      group = (group + stride) & group_mask;
+    }
+  }
+
+  bool NeedUpsizing() const {
+    return size_ * kMaxLoadDenominator >= capacity_ * kMaxLoadNumerator;
+  }
+
+  Status UpsizeBuffers(uint64_t capacity) {
+    RETURN_NOT_OK(entries_builder_.Resize(capacity));
+    entries_ = entries_builder_.mutable_data();
+    RETURN_NOT_OK(control_builder_.Resize(capacity));
+    control_ = control_builder_.mutable_data();
+    memset(control_, kEmpty, capacity);
+
+    return Status::OK();
+  }
+
+  Status Upsize(uint64_t new_capacity) {
+    assert(new_capacity > capacity_);
+    const uint64_t new_group_mask = new_capacity / kGroupSize - 1;
+
+    // Stash old entries and seal builders, effectively resetting the Buffers
+    const Entry* old_entries = entries_;
+    const uint8_t* old_control = control_;
+    std::shared_ptr<Buffer> previous_entries, previous_control;
+    RETURN_NOT_OK(entries_builder_.Finish(&previous_entries));
+    RETURN_NOT_OK(control_builder_.Finish(&previous_control));
+    // Allocate new buffers
+    RETURN_NOT_OK(UpsizeBuffers(new_capacity));
+
+    for (uint64_t i = 0; i < capacity_; i++) {
+      if (old_control[i] != kEmpty) {
+        const auto& entry = old_entries[i];
+        // Dummy compare function will not be called
+        auto p = Lookup<NoCompare>(entry.h, control_, entries_, new_group_mask,
+                                   [](const Payload*) { return false; });
+        assert(!p.second);
+        entries_[p.first] = entry;
+        control_[p.first] = old_control[i];
+      }
+    }
+    capacity_ = new_capacity;
+    group_mask_ = new_group_mask;
+
+    return Status::OK();
+  }
+
+  hash_t FixHash(hash_t h) const { return (h == kSentinel) ? 42U : h; }
+
+  // The number of slots available in the hash table array.
+  uint64_t capacity_;
+  // The number of groups of slots, minus one.
+  uint64_t group_mask_;
+  // The number of used slots in the hash table array.
+  uint64_t size_;
+
+  Entry* entries_;
+  uint8_t* control_;
+  TypedBufferBuilder<Entry> entries_builder_;
+  TypedBufferBuilder<uint8_t> control_builder_;
+};
+
 // XXX typedef memo_index_t int32_t ?
 
 constexpr int32_t kKeyNotFound = -1;
@@ -598,7 +835,8 @@ class SmallScalarMemoTable : public MemoTable {
 // ----------------------------------------------------------------------
 // A memoization table for variable-sized binary data.
 
-template <typename BinaryBuilderT>
+template <typename BinaryBuilderT,
+          template <class> class HashTableTemplateType = HashTable>
 class BinaryMemoTable : public MemoTable {
  public:
   using builder_offset_type = typename BinaryBuilderT::offset_type;
@@ -807,8 +1045,8 @@ class BinaryMemoTable : public MemoTable {
     int32_t memo_index;
   };
 
-  using HashTableType = HashTable<Payload>;
-  using HashTableEntry = typename HashTable<Payload>::Entry;
+  using HashTableType = HashTableTemplateType<Payload>;
+  using HashTableEntry = typename HashTableType::Entry;
   HashTableType hash_table_;
   BinaryBuilderT binary_builder_;
 
@@ -842,18 +1080,18 @@ struct HashTraits<T, enable_if_8bit_int<T>> {
 template <typename T>
 struct HashTraits<T, enable_if_t<has_c_type<T>::value && !is_8bit_int<T>::value>> {
   using c_type = typename T::c_type;
-  using MemoTableType = ScalarMemoTable<c_type, HashTable>;
+  using MemoTableType = ScalarMemoTable<c_type, SwissHashTable>;
 };
 
 template <typename T>
 struct HashTraits<T, enable_if_t<has_string_view<T>::value &&
                                  !std::is_base_of<LargeBinaryType, T>::value>> {
-  using MemoTableType = BinaryMemoTable<BinaryBuilder>;
+  using MemoTableType = BinaryMemoTable<BinaryBuilder, SwissHashTable>;
 };
 
 template <typename T>
 struct HashTraits<T, enable_if_t<std::is_base_of<LargeBinaryType, T>::value>> {
-  using MemoTableType = BinaryMemoTable<LargeBinaryBuilder>;
+  using MemoTableType = BinaryMemoTable<LargeBinaryBuilder, SwissHashTable>;
 };
 
 template <typename MemoTableType>
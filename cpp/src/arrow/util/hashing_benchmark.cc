@@ -111,6 +111,49 @@ static void HashLargeStrings(benchmark::State& state) {  // NOLINT non-const ref
   BenchmarkStringHashing(state, values);
 }
 
+template <template <class> class HashTableTemplateType>
+static void MemoTableIntegers(benchmark::State& state) {  // NOLINT non-const reference
+  // Many distinct values, so that the hash table doesn't fit in cache
+  const auto n_distinct = static_cast<int64_t>(state.range(0));
+  std::vector<int64_t> values = MakeIntegers<int64_t>(1 << 20);
+  for (auto& v : values) {
+    v %= n_distinct;
+  }
+
+  while (state.KeepRunning()) {
+    ScalarMemoTable<int64_t, HashTableTemplateType> table(default_memory_pool());
+    int32_t memo_index;
+    for (const int64_t v : values) {
+      ABORT_NOT_OK(table.GetOrInsert(v, &memo_index));
+    }
+    benchmark::DoNotOptimize(table.size());
+  }
+  state.SetBytesProcessed(state.iterations() * values.size() * sizeof(int64_t));
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <template <class> class HashTableTemplateType>
+static void MemoTableStrings(benchmark::State& state) {  // NOLINT non-const reference
+  const auto n_distinct = static_cast<int32_t>(state.range(0));
+  const std::vector<std::string> distinct = MakeStrings(n_distinct, 2, 20);
+  std::vector<util::string_view> values(1 << 20);
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int32_t> index_dist(0, n_distinct - 1);
+  for (auto& v : values) {
+    v = distinct[index_dist(gen)];
+  }
+
+  while (state.KeepRunning()) {
+    BinaryMemoTable<BinaryBuilder, HashTableTemplateType> table(default_memory_pool());
+    int32_t memo_index;
+    for (const auto& v : values) {
+      ABORT_NOT_OK(table.GetOrInsert(v, &memo_index));
+    }
+    benchmark::DoNotOptimize(table.size());
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
 // ----------------------------------------------------------------------
 // Benchmark declarations
 
@@ -119,5 +162,14 @@ BENCHMARK(HashSmallStrings);
 BENCHMARK(HashMediumStrings);
 BENCHMARK(HashLargeStrings);
 
+void MemoTableArgs(benchmark::internal::Benchmark* bench) {
+  bench->Arg(100)->Arg(1 << 16)->Arg(1 << 20);
+}
+
+BENCHMARK_TEMPLATE(MemoTableIntegers, HashTable)->Apply(MemoTableArgs);
+BENCHMARK_TEMPLATE(MemoTableIntegers, SwissHashTable)->Apply(MemoTableArgs);
+BENCHMARK_TEMPLATE(MemoTableStrings, HashTable)->Apply(MemoTableArgs);
+BENCHMARK_TEMPLATE(MemoTableStrings, SwissHashTable)->Apply(MemoTableArgs);
+
 }  // namespace internal
 }  // namespace arrow
@@ -478,5 +478,64 @@ TEST(BinaryMemoTable, Stress) {
   ASSERT_EQ(table.size(), map.size());
 }
 
+TEST(SwissHashTable, StressInt64) {
+  // Enough distinct values for many upsizes and many colliding control bytes
+#ifdef ARROW_VALGRIND
+  const int32_t n_values = 2000;
+#else
+  const int32_t n_values = 100000;
+#endif
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int64_t> value_dist(-n_values, n_values);
+
+  ScalarMemoTable<int64_t, SwissHashTable> table(default_memory_pool(), 0);
+  std::unordered_map<int64_t, int32_t> map;
+  std::vector<int64_t> inserted;
+
+  for (int32_t i = 0; i < 2 * n_values; ++i) {
+    int64_t value = value_dist(gen);
+    int32_t expected, actual;
+    auto it = map.find(value);
+    if (it == map.end()) {
+      expected = static_cast<int32_t>(map.size());
+      map[value] = expected;
+      inserted.push_back(value);
+    } else {
+      expected = it->second;
+    }
+    ASSERT_OK(table.GetOrInsert(value, &actual));
+    ASSERT_EQ(actual, expected);
+  }
+  ASSERT_EQ(table.size(), map.size());
+  ASSERT_EQ(table.Get(n_values + 1), kKeyNotFound);
+
+  std::vector<int64_t> values(table.size());
+  table.CopyValues(values.data());
+  ASSERT_EQ(values, inserted);
+}
+
+TEST(SwissHashTable, StressStrings) {
+#ifdef ARROW_VALGRIND
+  const int32_t n_values = 500;
+#else
+  const int32_t n_values = 20000;
+#endif
+
+  const auto distinct_values = MakeDistinctStrings(n_values);
+  const std::vector<std::string> values(distinct_values.begin(), distinct_values.end());
+
+  BinaryMemoTable<BinaryBuilder, SwissHashTable> table(default_memory_pool(), 0);
+  for (int32_t i = 0; i < n_values; ++i) {
+    AssertGet(table, values[i], kKeyNotFound);
+    AssertGetOrInsert(table, values[i], i);
+  }
+  AssertGetOrInsertNull(table, n_values);
+  for (int32_t i = 0; i < n_values; ++i) {
+    AssertGet(table, values[i], i);
+    AssertGetOrInsert(table, values[i], i);
+  }
+  ASSERT_EQ(table.size(), n_values + 1);
+}
+
 }  // namespace internal
 }  // namespace arrow
@@ -0,0 +1,140 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/hyperloglog.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// The estimator below is the one derived in Otmar Ertl, "New cardinality
+// estimation algorithms for HyperLogLog sketches" (2017).  It is unbiased
+// over the whole cardinality range without the empirical bias correction
+// tables of HyperLogLog++.
+
+double Sigma(double x) {
+  if (x == 1.0) {
+    return std::numeric_limits<double>::infinity();
+  }
+  double y = 1.0;
+  double z = x;
+  double prev_z;
+  do {
+    x *= x;
+    prev_z = z;
+    z += x * y;
+    y += y;
+  } while (z != prev_z);
+  return z;
+}
+
+double Tau(double x) {
+  if (x == 0.0 || x == 1.0) {
+    return 0.0;
+  }
+  double y = 1.0;
+  double z = 1.0 - x;
+  double prev_z;
+  do {
+    x = std::sqrt(x);
+    prev_z = z;
+    y *= 0.5;
+    z -= (1.0 - x) * (1.0 - x) * y;
+  } while (z != prev_z);
+  return z / 3.0;
+}
+
+}  // namespace
+
+constexpr int HyperLogLog::kMinPrecision;
+constexpr int HyperLogLog::kMaxPrecision;
+constexpr int HyperLogLog::kDefaultPrecision;
+
+Result<HyperLogLog> HyperLogLog::Make(int precision) {
+  if (precision < kMinPrecision || precision > kMaxPrecision) {
+    return Status::Invalid("HyperLogLog precision must be between ", kMinPrecision,
+                           " and ", kMaxPrecision, ", got ", precision);
+  }
+  return HyperLogLog(precision);
+}
+
+Status HyperLogLog::Merge(const HyperLogLog& other) {
+  if (other.precision_ != precision_) {
+    return Status::Invalid("Cannot merge HyperLogLog sketches of precision ",
+                           other.precision_, " and ", precision_);
+  }
+  for (size_t i = 0; i < registers_.size(); ++i) {
+    registers_[i] = std::max(registers_[i], other.registers_[i]);
+  }
+  return Status::OK();
+}
+
+double HyperLogLog::Estimate() const {
+  const int q = 64 - precision_;
+  const auto m = static_cast<double>(registers_.size());
+
+  // Histogram of the register values, which are in [0, q + 1]
+  std::vector<int64_t> counts(q + 2, 0);
+  for (uint8_t value : registers_) {
+    ++counts[value];
+  }
+
+  double z = m * Tau(1.0 - static_cast<double>(counts[q + 1]) / m);
+  for (int k = q; k >= 1; --k) {
+    z = 0.5 * (z + static_cast<double>(counts[k]));
+  }
+  z += m * Sigma(static_cast<double>(counts[0]) / m);
+  // alpha_inf = 1 / (2 ln 2)
+  return m * m / (2.0 * std::log(2.0) * z);
+}
+
+std::string HyperLogLog::Serialize() const {
+  std::string out;
+  out.reserve(1 + registers_.size());
+  out.push_back(static_cast<char>(precision_));
+  out.append(reinterpret_cast<const char*>(registers_.data()), registers_.size());
+  return out;
+}
+
+Result<HyperLogLog> HyperLogLog::Deserialize(util::string_view data) {
+  if (data.empty()) {
+    return Status::Invalid("Serialized HyperLogLog sketch is empty");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto sketch, Make(static_cast<uint8_t>(data[0])));
+  if (data.size() != 1 + sketch.registers_.size()) {
+    return Status::Invalid("Serialized HyperLogLog sketch has size ", data.size(),
+                           ", expected ", 1 + sketch.registers_.size());
+  }
+  const int max_rank = 64 - sketch.precision_ + 1;
+  for (size_t i = 0; i < sketch.registers_.size(); ++i) {
+    const auto value = static_cast<uint8_t>(data[i + 1]);
+    if (value > max_rank) {
+      return Status::Invalid("Invalid HyperLogLog register value ",
+                             static_cast<int>(value));
+    }
+    sketch.registers_[i] = value;
+  }
+  return sketch;
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,97 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief Finalize a 64-bit hash so that all of its bits are well mixed
+///
+/// The hashes in arrow/util/hashing.h are tuned for hash table indexing and
+/// may leave the high bits poorly distributed, which a cardinality sketch
+/// relies on.  This is the SplitMix64 finalizer, a bijection on 64-bit
+/// values which does not map zero to itself.
+inline uint64_t MixHash64(uint64_t h) {
+  h += 0x9e3779b97f4a7c15ULL;
+  h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+  return h ^ (h >> 31);
+}
+
+/// \brief A HyperLogLog sketch estimating the number of distinct hashes added
+///
+/// The sketch holds 2^precision one-byte registers, for a relative standard
+/// error of about 1.04 / sqrt(2^precision).  Sketches of the same precision
+/// can be merged, so partial sketches computed independently (for example
+/// one per dataset fragment) combine into the sketch of the whole input.
+class ARROW_EXPORT HyperLogLog {
+ public:
+  static constexpr int kMinPrecision = 4;
+  static constexpr int kMaxPrecision = 18;
+  static constexpr int kDefaultPrecision = 14;
+
+  /// \brief Create an empty sketch, precision must be in
+  /// [kMinPrecision, kMaxPrecision]
+  static Result<HyperLogLog> Make(int precision = kDefaultPrecision);
+
+  /// \brief Add a well mixed 64-bit hash to the sketch, see MixHash64
+  void Add(uint64_t hash) {
+    const uint64_t index = hash >> (64 - precision_);
+    // The remaining bits, with a sentinel so that the rank is at most
+    // 64 - precision + 1
+    const uint64_t rest = (hash << precision_) | (uint64_t(1) << (precision_ - 1));
+    const auto rank = static_cast<uint8_t>(BitUtil::CountLeadingZeros(rest) + 1);
+    if (rank > registers_[index]) {
+      registers_[index] = rank;
+    }
+  }
+
+  /// \brief Merge another sketch of the same precision into this one
+  Status Merge(const HyperLogLog& other);
+
+  /// \brief Estimate the number of distinct hashes added
+  double Estimate() const;
+
+  int precision() const { return precision_; }
+
+  /// \brief Serialize the sketch to a string of 1 + 2^precision bytes
+  std::string Serialize() const;
+
+  /// \brief Reconstruct a sketch produced by Serialize()
+  static Result<HyperLogLog> Deserialize(util::string_view data);
+
+ private:
+  explicit HyperLogLog(int precision)
+      : precision_(precision), registers_(size_t(1) << precision, 0) {}
+
+  int precision_;
+  std::vector<uint8_t> registers_;
+};
+
+}  // namespace internal
+}  // namespace arrow
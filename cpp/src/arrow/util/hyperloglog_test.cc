@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/hyperloglog.h"
+
+namespace arrow {
+namespace internal {
+
+HyperLogLog MakeSketch(uint64_t begin, uint64_t end, int precision = 14) {
+  auto sketch = HyperLogLog::Make(precision).ValueOrDie();
+  for (uint64_t i = begin; i < end; ++i) {
+    sketch.Add(MixHash64(i));
+  }
+  return sketch;
+}
+
+TEST(HyperLogLog, InvalidPrecision) {
+  ASSERT_RAISES(Invalid, HyperLogLog::Make(HyperLogLog::kMinPrecision - 1));
+  ASSERT_RAISES(Invalid, HyperLogLog::Make(HyperLogLog::kMaxPrecision + 1));
+  ASSERT_OK(HyperLogLog::Make(HyperLogLog::kMinPrecision));
+}
+
+TEST(HyperLogLog, SmallCardinalities) {
+  ASSERT_EQ(0, MakeSketch(0, 0).Estimate());
+  for (uint64_t n : {1, 2, 10, 100}) {
+    auto sketch = MakeSketch(0, n);
+    // Duplicates don't change the sketch
+    for (uint64_t i = 0; i < n; ++i) {
+      sketch.Add(MixHash64(i));
+    }
+    // Almost all values fall into distinct registers
+    ASSERT_NEAR(static_cast<double>(n), sketch.Estimate(), 0.5 + 0.02 * n);
+  }
+}
+
+TEST(HyperLogLog, Accuracy) {
+  for (int precision : {10, 14}) {
+    // Allow four standard errors
+    const double tolerance = 4 * 1.04 / std::sqrt(double(1 << precision));
+    for (uint64_t n : {1000, 10000, 300000}) {
+      auto estimate = MakeSketch(n, 2 * n, precision).Estimate();
+      ASSERT_NEAR(1.0, estimate / n, tolerance) << "precision " << precision;
+    }
+  }
+}
+
+TEST(HyperLogLog, Merge) {
+  auto whole = MakeSketch(0, 20000);
+  // Overlapping halves
+  auto left = MakeSketch(0, 12000);
+  ASSERT_OK(left.Merge(MakeSketch(8000, 20000)));
+  ASSERT_EQ(whole.Estimate(), left.Estimate());
+  ASSERT_EQ(whole.Serialize(), left.Serialize());
+
+  ASSERT_RAISES(Invalid, left.Merge(MakeSketch(0, 10, /*precision=*/12)));
+}
+
+TEST(HyperLogLog, Serialize) {
+  auto sketch = MakeSketch(0, 5000, /*precision=*/12);
+  auto serialized = sketch.Serialize();
+  ASSERT_EQ(1 + (1 << 12), serialized.size());
+  ASSERT_OK_AND_ASSIGN(auto roundtripped, HyperLogLog::Deserialize(serialized));
+  ASSERT_EQ(12, roundtripped.precision());
+  ASSERT_EQ(sketch.Estimate(), roundtripped.Estimate());
+
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(""));
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(serialized.substr(0, 100)));
+  serialized[1] = 100;
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(serialized));
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -45,10 +45,6 @@ static constexpr uint64_t max_uint32 =
     static_cast<uint64_t>(std::numeric_limits<uint32_t>::max());
 static constexpr uint64_t max_uint64 = std::numeric_limits<uint64_t>::max();
 
-static constexpr uint64_t mask_uint8 = ~0xffULL;
-static constexpr uint64_t mask_uint16 = ~0xffffULL;
-static constexpr uint64_t mask_uint32 = ~0xffffffffULL;
-
 //
 // Unsigned integer width detection
 //
@@ -168,95 +164,41 @@ uint8_t DetectUIntWidth(const uint64_t* values, const uint8_t* valid_bytes,
 // Signed integer width detection
 //
 
-uint8_t DetectIntWidth(const int64_t* values, int64_t length, uint8_t min_width) {
-  if (min_width == 8) {
-    return min_width;
-  }
-  uint8_t width = min_width;
-
-  auto p = values;
-  const auto end = p + length;
-  // Strategy: to determine whether `x` is between -0x80 and 0x7f,
-  // we determine whether `x + 0x80` is between 0x00 and 0xff.  The
-  // latter can be done with a simple AND mask with ~0xff and, more
-  // importantly, can be computed in a single step over multiple ORed
-  // values (so we can branch once every N items instead of once every item).
-  // This strategy could probably lend itself to explicit SIMD-ization,
-  // if more performance is needed.
-  constexpr uint64_t addend8 = 0x80ULL;
-  constexpr uint64_t addend16 = 0x8000ULL;
-  constexpr uint64_t addend32 = 0x80000000ULL;
-
-  auto test_one_item = [&](uint64_t addend, uint64_t test_mask) -> bool {
-    auto v = *p++;
-    if (ARROW_PREDICT_FALSE(((v + addend) & test_mask) != 0)) {
-      --p;
-      return false;
-    } else {
-      return true;
-    }
-  };
-
-  auto test_four_items = [&](uint64_t addend, uint64_t test_mask) -> bool {
-    auto mask = (p[0] + addend) | (p[1] + addend) | (p[2] + addend) | (p[3] + addend);
-    p += 4;
-    if (ARROW_PREDICT_FALSE((mask & test_mask) != 0)) {
-      p -= 4;
-      return false;
-    } else {
-      return true;
-    }
-  };
-
-  if (width == 1) {
-    while (p <= end - 4) {
-      if (!test_four_items(addend8, mask_uint8)) {
-        width = 2;
-        goto width2;
-      }
-    }
-    while (p < end) {
-      if (!test_one_item(addend8, mask_uint8)) {
-        width = 2;
-        goto width2;
-      }
-    }
+// Width of the narrowest signed integer holding all of [min, max]
+inline uint8_t IntWidthForRange(int64_t min, int64_t max) {
+  if (min >= std::numeric_limits<int8_t>::min() &&
+      max <= std::numeric_limits<int8_t>::max()) {
     return 1;
-  }
-width2:
-  if (width == 2) {
-    while (p <= end - 4) {
-      if (!test_four_items(addend16, mask_uint16)) {
-        width = 4;
-        goto width4;
-      }
-    }
-    while (p < end) {
-      if (!test_one_item(addend16, mask_uint16)) {
-        width = 4;
-        goto width4;
-      }
-    }
+  } else if (min >= std::numeric_limits<int16_t>::min() &&
+             max <= std::numeric_limits<int16_t>::max()) {
     return 2;
+  } else if (min >= std::numeric_limits<int32_t>::min() &&
+             max <= std::numeric_limits<int32_t>::max()) {
+    return 4;
+  } else {
+    return 8;
   }
-width4:
-  if (width == 4) {
-    while (p <= end - 4) {
-      if (!test_four_items(addend32, mask_uint32)) {
-        width = 8;
-        goto width8;
-      }
-    }
-    while (p < end) {
-      if (!test_one_item(addend32, mask_uint32)) {
-        width = 8;
-        goto width8;
-      }
+}
+
+// Strategy: compute the min and max of blocks of values, in branch-free loops
+// that the compiler vectorizes, and only check the width once per block.  Null
+// values are taken as 0, which fits in any width.
+static constexpr int64_t kIntWidthBlockSize = 256;
+
+uint8_t DetectIntWidth(const int64_t* values, int64_t length, uint8_t min_width) {
+  uint8_t width = min_width;
+  for (int64_t i = 0; i < length && width < 8; i += kIntWidthBlockSize) {
+    const int64_t block_length = std::min(kIntWidthBlockSize, length - i);
+    const int64_t* block = values + i;
+    int64_t min = 0;
+    int64_t max = 0;
+    for (int64_t j = 0; j < block_length; ++j) {
+      min = std::min(min, block[j]);
+      max = std::max(max, block[j]);
     }
-    return 4;
+    width = std::max(width, IntWidthForRange(min, max));
   }
-width8:
-  return 8;
+  return width;
 }
 
 uint8_t DetectIntWidth(const int64_t* values, const uint8_t* valid_bytes, int64_t length,
@@ -264,103 +206,21 @@ uint8_t DetectIntWidth(const int64_t* values, const uint8_t* valid_bytes, int64_
   if (valid_bytes == nullptr) {
     return DetectIntWidth(values, length, min_width);
   }
-
-  if (min_width == 8) {
-    return min_width;
-  }
   uint8_t width = min_width;
-
-  auto p = values;
-  const auto end = p + length;
-  auto b = valid_bytes;
-  // Strategy is similar to the no-nulls case above, but we also
-  // have to zero any incoming items that have a zero validity byte.
-  constexpr uint64_t addend8 = 0x80ULL;
-  constexpr uint64_t addend16 = 0x8000ULL;
-  constexpr uint64_t addend32 = 0x80000000ULL;
-
-#define MASK(p, b, addend, i) (p[i] + addend) * (b[i] != 0)
-
-  auto test_one_item = [&](uint64_t addend, uint64_t test_mask) -> bool {
-    auto v = MASK(p, b, addend, 0);
-    ++b;
-    ++p;
-    if (ARROW_PREDICT_FALSE((v & test_mask) != 0)) {
-      --b;
-      --p;
-      return false;
-    } else {
-      return true;
+  for (int64_t i = 0; i < length && width < 8; i += kIntWidthBlockSize) {
+    const int64_t block_length = std::min(kIntWidthBlockSize, length - i);
+    const int64_t* block = values + i;
+    const uint8_t* block_valid = valid_bytes + i;
+    int64_t min = 0;
+    int64_t max = 0;
+    for (int64_t j = 0; j < block_length; ++j) {
+      const int64_t value = block_valid[j] ? block[j] : 0;
+      min = std::min(min, value);
+      max = std::max(max, value);
     }
-  };
-
-  auto test_eight_items = [&](uint64_t addend, uint64_t test_mask) -> bool {
-    auto mask1 = MASK(p, b, addend, 0) | MASK(p, b, addend, 1) | MASK(p, b, addend, 2) |
-                 MASK(p, b, addend, 3);
-    auto mask2 = MASK(p, b, addend, 4) | MASK(p, b, addend, 5) | MASK(p, b, addend, 6) |
-                 MASK(p, b, addend, 7);
-    b += 8;
-    p += 8;
-    if (ARROW_PREDICT_FALSE(((mask1 | mask2) & test_mask) != 0)) {
-      b -= 8;
-      p -= 8;
-      return false;
-    } else {
-      return true;
-    }
-  };
-
-#undef MASK
-
-  if (width == 1) {
-    while (p <= end - 8) {
-      if (!test_eight_items(addend8, mask_uint8)) {
-        width = 2;
-        goto width2;
-      }
-    }
-    while (p < end) {
-      if (!test_one_item(addend8, mask_uint8)) {
-        width = 2;
-        goto width2;
-      }
-    }
-    return 1;
+    width = std::max(width, IntWidthForRange(min, max));
   }
-width2:
-  if (width == 2) {
-    while (p <= end - 8) {
-      if (!test_eight_items(addend16, mask_uint16)) {
-        width = 4;
-        goto width4;
-      }
-    }
-    while (p < end) {
-      if (!test_one_item(addend16, mask_uint16)) {
-        width = 4;
-        goto width4;
-      }
-    }
-    return 2;
-  }
-width4:
-  if (width == 4) {
-    while (p <= end - 8) {
-      if (!test_eight_items(addend32, mask_uint32)) {
-        width = 8;
-        goto width8;
-      }
-    }
-    while (p < end) {
-      if (!test_one_item(addend32, mask_uint32)) {
-        width = 8;
-        goto width8;
-      }
-    }
-    return 4;
-  }
-width8:
-  return 8;
+  return width;
 }
 
 template <typename Source, typename Dest>
@@ -609,17 +469,15 @@ Status IntegersInRange(const Datum& datum, CType bound_lower, CType bound_upper)
     BitBlockCount block = indices_bit_counter.NextBlock();
     bool block_out_of_bounds = false;
     if (block.popcount == block.length) {
-      // Fast path: branchless
-      int64_t i = 0;
-      for (int64_t chunk = 0; chunk < block.length / 8; ++chunk) {
-        // Let the compiler unroll this
-        for (int j = 0; j < 8; ++j) {
-          block_out_of_bounds |= IsOutOfBounds(indices_data[i++]);
-        }
-      }
-      for (; i < block.length; ++i) {
-        block_out_of_bounds |= IsOutOfBounds(indices_data[i]);
+      // Fast path: a min/max reduction that the compiler can vectorize, with
+      // a single bounds comparison for the whole block
+      CType block_min = indices_data[0];
+      CType block_max = indices_data[0];
+      for (int64_t i = 1; i < block.length; ++i) {
+        block_min = std::min(block_min, indices_data[i]);
+        block_max = std::max(block_max, indices_data[i]);
       }
+      block_out_of_bounds = IsOutOfBounds(block_min) || IsOutOfBounds(block_max);
     } else if (block.popcount > 0) {
       // Indices have nulls, must only boundscheck non-null values
       int64_t i = 0;
@@ -25,13 +25,18 @@
 #include "arrow/util/windows_compatibility.h"  // IWYU pragma: keep
 
 #include <algorithm>
+#include <cctype>
 #include <cerrno>
+#include <climits>
 #include <cstdint>
 #include <cstring>
+#include <fstream>
 #include <iostream>
+#include <numeric>
 #include <random>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -66,9 +71,14 @@
 #undef Free
 #else  // POSIX-like platforms
 #include <sys/mman.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #endif
 
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
 // define max read/write count
 #ifdef _WIN32
 #define ARROW_MAX_IO_CHUNKSIZE INT32_MAX
@@ -833,9 +843,36 @@ static inline Result<int> CheckFileOpResult(int fd_ret, int errno_actual,
   return fd_ret;
 }
 
+namespace {
+
+#ifndef _WIN32
+Result<int> FileOpenReadableWithFlags(const PlatformFilename& file_name, int flags) {
+  int fd = open(file_name.ToNative().c_str(), O_RDONLY | flags);
+  int errno_actual = errno;
+
+  if (fd >= 0) {
+    // open(O_RDONLY) succeeds on directories, check for it
+    struct stat st;
+    int ret = fstat(fd, &st);
+    if (ret == -1) {
+      ARROW_UNUSED(FileClose(fd));
+      // Will propagate error below
+    } else if (S_ISDIR(st.st_mode)) {
+      ARROW_UNUSED(FileClose(fd));
+      return Status::IOError("Cannot open for reading: path '", file_name.ToString(),
+                             "' is a directory");
+    }
+  }
+
+  return CheckFileOpResult(fd, errno_actual, file_name, "open local");
+}
+#endif
+
+}  // namespace
+
 Result<int> FileOpenReadable(const PlatformFilename& file_name) {
-  int fd, errno_actual;
 #if defined(_WIN32)
+  int fd, errno_actual;
   SetLastError(0);
   HANDLE file_handle = CreateFileW(file_name.ToNative().c_str(), GENERIC_READ,
                                    FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
@@ -850,26 +887,18 @@ Result<int> FileOpenReadable(const PlatformFilename& file_name) {
     return IOErrorFromWinError(last_error, "Failed to open local file '",
                                file_name.ToString(), "'");
   }
+  return CheckFileOpResult(fd, errno_actual, file_name, "open local");
 #else
-  fd = open(file_name.ToNative().c_str(), O_RDONLY);
-  errno_actual = errno;
-
-  if (fd >= 0) {
-    // open(O_RDONLY) succeeds on directories, check for it
-    struct stat st;
-    int ret = fstat(fd, &st);
-    if (ret == -1) {
-      ARROW_UNUSED(FileClose(fd));
-      // Will propagate error below
-    } else if (S_ISDIR(st.st_mode)) {
-      ARROW_UNUSED(FileClose(fd));
-      return Status::IOError("Cannot open for reading: path '", file_name.ToString(),
-                             "' is a directory");
-    }
-  }
+  return FileOpenReadableWithFlags(file_name, 0);
 #endif
+}
 
-  return CheckFileOpResult(fd, errno_actual, file_name, "open local");
+Result<int> FileOpenReadableDirect(const PlatformFilename& file_name) {
+#if defined(O_DIRECT)
+  return FileOpenReadableWithFlags(file_name, O_DIRECT);
+#else
+  return Status::NotImplemented("Direct I/O is not supported on this platform");
+#endif
 }
 
 Result<int> FileOpenWritable(const PlatformFilename& file_name, bool write_only,
@@ -1131,6 +1160,177 @@ Status MemoryAdviseWillNeed(const std::vector<MemoryRegion>& regions) {
 #endif
 }
 
+Status MemoryAdviseAccessPattern(void* addr, size_t size, MemoryAccessPattern pattern) {
+#ifdef _WIN32
+  return Status::OK();
+#else
+  int advice = POSIX_MADV_NORMAL;
+  switch (pattern) {
+    case MemoryAccessPattern::NORMAL:
+      break;
+    case MemoryAccessPattern::SEQUENTIAL:
+      advice = POSIX_MADV_SEQUENTIAL;
+      break;
+    case MemoryAccessPattern::RANDOM:
+      advice = POSIX_MADV_RANDOM;
+      break;
+  }
+  if (size == 0) {
+    return Status::OK();
+  }
+  int err = posix_madvise(addr, size, advice);
+  if (err != 0) {
+    return IOErrorFromErrno(err, "posix_madvise failed");
+  }
+  return Status::OK();
+#endif
+}
+
+//
+// Huge pages and NUMA
+//
+
+namespace {
+
+#ifdef __linux__
+Result<std::string> ReadSysFile(const std::string& path) {
+  std::ifstream stream(path);
+  if (!stream) {
+    return Status::IOError("Cannot open '", path, "'");
+  }
+  std::stringstream ss;
+  ss << stream.rdbuf();
+  return ss.str();
+}
+#endif
+
+int64_t GetHugePageSizeInternal() {
+#ifdef __linux__
+  std::ifstream meminfo("/proc/meminfo");
+  std::string line;
+  while (std::getline(meminfo, line)) {
+    // e.g. "Hugepagesize:       2048 kB"
+    if (line.compare(0, 13, "Hugepagesize:") == 0) {
+      return static_cast<int64_t>(std::strtoll(line.c_str() + 13, nullptr, 10)) * 1024;
+    }
+  }
+#endif
+  return 0;
+}
+
+}  // namespace
+
+int64_t GetHugePageSize() {
+  static const int64_t kHugePageSize = GetHugePageSizeInternal();
+  return kHugePageSize;
+}
+
+Status MemoryAdviseHugePages(void* addr, size_t size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  if (madvise(addr, size, MADV_HUGEPAGE) != 0) {
+    return IOErrorFromErrno(errno, "madvise failed");
+  }
+  return Status::OK();
+#else
+  return Status::NotImplemented("Transparent huge pages are not supported");
+#endif
+}
+
+Status MemoryBindToNumaNode(void* addr, size_t size, int node) {
+#if defined(__linux__) && defined(SYS_mbind)
+  // From <linux/mempolicy.h>
+  constexpr int kMpolPreferred = 1;
+  constexpr int kBitsPerWord = 8 * sizeof(unsigned long);  // NOLINT runtime/int
+  if (node < 0) {
+    return Status::Invalid("Invalid NUMA node: ", node);
+  }
+  std::vector<unsigned long> mask(node / kBitsPerWord + 1, 0);  // NOLINT runtime/int
+  mask[node / kBitsPerWord] = 1UL << (node % kBitsPerWord);
+  // The kernel ignores the last bit of `maxnode`
+  const unsigned long maxnode = mask.size() * kBitsPerWord + 1;  // NOLINT runtime/int
+  if (syscall(SYS_mbind, addr, size, kMpolPreferred, mask.data(), maxnode, 0) != 0) {
+    return IOErrorFromErrno(errno, "mbind failed");
+  }
+  return Status::OK();
+#else
+  return Status::NotImplemented("NUMA memory policies are not supported");
+#endif
+}
+
+Result<std::vector<int>> ParseCpuList(const std::string& list) {
+  std::vector<int> cpus;
+  std::stringstream ss(list);
+  std::string range;
+  while (std::getline(ss, range, ',')) {
+    range.erase(std::remove_if(range.begin(), range.end(), ::isspace), range.end());
+    if (range.empty()) {
+      continue;
+    }
+    char* end;
+    const long first = std::strtol(range.c_str(), &end, 10);  // NOLINT runtime/int
+    long last = first;                                         // NOLINT runtime/int
+    bool valid = end != range.c_str();
+    if (*end == '-') {
+      const char* last_begin = end + 1;
+      last = std::strtol(last_begin, &end, 10);
+      valid = valid && end != last_begin;
+    }
+    if (!valid || *end != '\0' || first < 0 || last < first) {
+      return Status::Invalid("Invalid CPU list: '", list, "'");
+    }
+    for (long cpu = first; cpu <= last; ++cpu) {  // NOLINT runtime/int
+      cpus.push_back(static_cast<int>(cpu));
+    }
+  }
+  return cpus;
+}
+
+int GetNumaNodeCount() {
+#ifdef __linux__
+  static const int kNumaNodeCount = []() {
+    auto maybe_nodes = ReadSysFile("/sys/devices/system/node/possible");
+    if (!maybe_nodes.ok()) {
+      return 1;
+    }
+    auto maybe_list = ParseCpuList(*maybe_nodes);
+    if (!maybe_list.ok() || maybe_list.ValueOrDie().empty()) {
+      return 1;
+    }
+    return maybe_list.ValueOrDie().back() + 1;
+  }();
+  return kNumaNodeCount;
+#else
+  return 1;
+#endif
+}
+
+int GetCurrentNumaNode() {
+#if defined(__linux__) && defined(SYS_getcpu)
+  unsigned int cpu, node;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+    return static_cast<int>(node);
+  }
+#endif
+  return 0;
+}
+
+Result<std::vector<int>> GetNumaNodeCpus(int node) {
+  if (node < 0 || node >= GetNumaNodeCount()) {
+    return Status::Invalid("Invalid NUMA node: ", node);
+  }
+#ifdef __linux__
+  auto maybe_cpus = ReadSysFile("/sys/devices/system/node/node" + std::to_string(node) +
+                                "/cpulist");
+  if (maybe_cpus.ok()) {
+    return ParseCpuList(*maybe_cpus);
+  }
+#endif
+  // Not a NUMA system: all CPUs are on node 0
+  std::vector<int> cpus(std::max(1U, std::thread::hardware_concurrency()));
+  std::iota(cpus.begin(), cpus.end(), 0);
+  return cpus;
+}
+
 //
 // Closing files
 //
@@ -1190,6 +1390,47 @@ Result<int64_t> FileGetSize(int fd) {
   return st.st_size;
 }
 
+Result<int64_t> FileGetBlockSize(int fd) {
+#if defined(_WIN32)
+  return Status::NotImplemented("File block size is not available on this platform");
+#else
+  struct stat st;
+  if (fstat(fd, &st) == -1) {
+    return IOErrorFromErrno(errno, "error stat()ing file");
+  }
+  return static_cast<int64_t>(st.st_blksize);
+#endif
+}
+
+Status FileAdvise(int fd, int64_t offset, int64_t nbytes, FileAdvice::type advice) {
+#if defined(POSIX_FADV_NORMAL)
+  int posix_advice = POSIX_FADV_NORMAL;
+  switch (advice) {
+    case FileAdvice::NORMAL:
+      break;
+    case FileAdvice::SEQUENTIAL:
+      posix_advice = POSIX_FADV_SEQUENTIAL;
+      break;
+    case FileAdvice::RANDOM:
+      posix_advice = POSIX_FADV_RANDOM;
+      break;
+    case FileAdvice::WILL_NEED:
+      posix_advice = POSIX_FADV_WILLNEED;
+      break;
+    case FileAdvice::DONT_NEED:
+      posix_advice = POSIX_FADV_DONTNEED;
+      break;
+  }
+  // posix_fadvise() returns the error number rather than setting errno
+  int ret = posix_fadvise(fd, static_cast<off_t>(offset), static_cast<off_t>(nbytes),
+                          posix_advice);
+  if (ret != 0) {
+    return IOErrorFromErrno(ret, "posix_fadvise failed");
+  }
+#endif
+  return Status::OK();
+}
+
 //
 // Reading data
 //
@@ -1294,6 +1535,65 @@ Status FileWrite(int fd, const uint8_t* buffer, const int64_t nbytes) {
   return Status::OK();
 }
 
+Status FileWriteV(int fd, const std::vector<MemoryRegion>& regions) {
+#if defined(_WIN32)
+  for (const auto& region : regions) {
+    RETURN_NOT_OK(FileWrite(fd, reinterpret_cast<const uint8_t*>(region.addr),
+                            static_cast<int64_t>(region.size)));
+  }
+  return Status::OK();
+#else
+#ifdef IOV_MAX
+  constexpr int kMaxIovecs = IOV_MAX;
+#else
+  constexpr int kMaxIovecs = 1024;
+#endif
+  std::vector<struct iovec> iovecs;
+  iovecs.reserve(regions.size());
+  for (const auto& region : regions) {
+    if (region.size > 0) {
+      iovecs.push_back({region.addr, region.size});
+    }
+  }
+
+  size_t next = 0;
+  while (next < iovecs.size()) {
+    // Stay within the limits of a single call on the number of regions and
+    // the total number of bytes
+    int count = 0;
+    size_t total = 0;
+    while (next + count < iovecs.size() && count < kMaxIovecs &&
+           total + iovecs[next + count].iov_len <= ARROW_MAX_IO_CHUNKSIZE) {
+      total += iovecs[next + count].iov_len;
+      ++count;
+    }
+    ssize_t ret;
+    if (count == 0) {
+      // A single region larger than the maximum chunk size
+      ret = write(fd, iovecs[next].iov_base, ARROW_MAX_IO_CHUNKSIZE);
+    } else {
+      ret = writev(fd, iovecs.data() + next, count);
+    }
+    if (ret == -1) {
+      return IOErrorFromErrno(errno, "Error writing bytes to file");
+    }
+    // Skip what was written, which may end in the middle of a region
+    auto written = static_cast<size_t>(ret);
+    while (written > 0) {
+      struct iovec& iov = iovecs[next];
+      if (written < iov.iov_len) {
+        iov.iov_base = static_cast<uint8_t*>(iov.iov_base) + written;
+        iov.iov_len -= written;
+        break;
+      }
+      written -= iov.iov_len;
+      ++next;
+    }
+  }
+  return Status::OK();
+#endif
+}
+
 Status FileTruncate(int fd, const int64_t size) {
   int ret, errno_actual;
 
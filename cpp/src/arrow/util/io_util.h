@@ -188,6 +188,16 @@ Result<bool> FileExists(const PlatformFilename& path);
 ARROW_EXPORT
 Result<int> FileOpenReadable(const PlatformFilename& file_name);
 
+/// Open a file for reading, bypassing the OS page cache, and return a file
+/// descriptor.
+///
+/// Reads on the file descriptor must then be aligned to the filesystem block
+/// size (see FileGetBlockSize()), in offset, length and memory address.
+/// Returns NotImplemented if the platform doesn't support direct I/O, and an
+/// IOError if the filesystem doesn't.
+ARROW_EXPORT
+Result<int> FileOpenReadableDirect(const PlatformFilename& file_name);
+
 /// Open a file for writing and return a file descriptor.
 ARROW_EXPORT
 Result<int> FileOpenWritable(const PlatformFilename& file_name, bool write_only = true,
@@ -213,6 +223,20 @@ ARROW_EXPORT
 Result<int64_t> FileTell(int fd);
 ARROW_EXPORT
 Result<int64_t> FileGetSize(int fd);
+/// Return the preferred block size for I/O on the file
+ARROW_EXPORT
+Result<int64_t> FileGetBlockSize(int fd);
+
+struct FileAdvice {
+  enum type { NORMAL, SEQUENTIAL, RANDOM, WILL_NEED, DONT_NEED };
+};
+
+/// \brief Advise the OS about how a file range will be accessed
+///
+/// A `nbytes` of 0 extends the range to the end of the file.  This is a no-op
+/// on platforms without posix_fadvise().
+ARROW_EXPORT
+Status FileAdvise(int fd, int64_t offset, int64_t nbytes, FileAdvice::type advice);
 
 ARROW_EXPORT
 Status FileClose(int fd);
@@ -233,12 +257,59 @@ struct MemoryRegion {
   size_t size;
 };
 
+/// \brief Write the regions one after the other at the current file position
+///
+/// This issues as few vectored writes as the system allows, rather than one
+/// write per region.
+ARROW_EXPORT
+Status FileWriteV(int fd, const std::vector<MemoryRegion>& regions);
+
 ARROW_EXPORT
 Status MemoryMapRemap(void* addr, size_t old_size, size_t new_size, int fildes,
                       void** new_addr);
 ARROW_EXPORT
 Status MemoryAdviseWillNeed(const std::vector<MemoryRegion>& regions);
 
+enum class MemoryAccessPattern { NORMAL, SEQUENTIAL, RANDOM };
+
+/// \brief Hint how a page-aligned region is going to be accessed
+///
+/// This tunes the readahead of file-backed memory. It is a no-op on Windows.
+ARROW_EXPORT
+Status MemoryAdviseAccessPattern(void* addr, size_t size, MemoryAccessPattern pattern);
+
+/// \brief Return the size of the huge pages, or 0 if the system doesn't have any
+ARROW_EXPORT
+int64_t GetHugePageSize();
+
+/// \brief Ask for a page-aligned region to be backed by transparent huge pages
+///
+/// Return NotImplemented on platforms other than Linux.
+ARROW_EXPORT
+Status MemoryAdviseHugePages(void* addr, size_t size);
+
+/// \brief Prefer allocating the pages of a page-aligned region on a NUMA node
+///
+/// Return NotImplemented on platforms other than Linux.
+ARROW_EXPORT
+Status MemoryBindToNumaNode(void* addr, size_t size, int node);
+
+/// \brief Return the number of NUMA nodes (1 if unknown)
+ARROW_EXPORT
+int GetNumaNodeCount();
+
+/// \brief Return the NUMA node of the CPU running the calling thread (0 if unknown)
+ARROW_EXPORT
+int GetCurrentNumaNode();
+
+/// \brief Return the CPUs of a NUMA node
+ARROW_EXPORT
+Result<std::vector<int>> GetNumaNodeCpus(int node);
+
+/// \brief Parse a CPU or node list in the Linux sysfs format, e.g. "0-3,8,10-11"
+ARROW_EXPORT
+Result<std::vector<int>> ParseCpuList(const std::string& list);
+
 ARROW_EXPORT
 Result<std::string> GetEnvVar(const char* name);
 ARROW_EXPORT
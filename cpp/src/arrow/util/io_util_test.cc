@@ -90,6 +90,51 @@ TEST(MemoryAdviseWillNeed, Basics) {
 #endif
 }
 
+TEST(ParseCpuList, Basics) {
+  ASSERT_OK_AND_ASSIGN(auto cpus, ParseCpuList(""));
+  ASSERT_EQ(cpus, std::vector<int>{});
+  ASSERT_OK_AND_ASSIGN(cpus, ParseCpuList("0\n"));
+  ASSERT_EQ(cpus, std::vector<int>{0});
+  ASSERT_OK_AND_ASSIGN(cpus, ParseCpuList("0-3,8,10-11"));
+  ASSERT_EQ(cpus, (std::vector<int>{0, 1, 2, 3, 8, 10, 11}));
+
+  ASSERT_RAISES(Invalid, ParseCpuList("x"));
+  ASSERT_RAISES(Invalid, ParseCpuList("1-"));
+  ASSERT_RAISES(Invalid, ParseCpuList("0-"));
+  ASSERT_RAISES(Invalid, ParseCpuList("3-1"));
+  ASSERT_RAISES(Invalid, ParseCpuList("1,-2"));
+}
+
+TEST(NumaNodes, Basics) {
+  const int num_nodes = GetNumaNodeCount();
+  ASSERT_GE(num_nodes, 1);
+  const int node = GetCurrentNumaNode();
+  ASSERT_GE(node, 0);
+  ASSERT_LT(node, num_nodes);
+  ASSERT_OK_AND_ASSIGN(auto cpus, GetNumaNodeCpus(node));
+  ASSERT_FALSE(cpus.empty());
+
+  ASSERT_RAISES(Invalid, GetNumaNodeCpus(-1));
+  ASSERT_RAISES(Invalid, GetNumaNodeCpus(num_nodes));
+}
+
+#ifdef __linux__
+TEST(MemoryBindToNumaNode, Basics) {
+  const auto page_size = GetPageSize();
+  ASSERT_OK_AND_ASSIGN(auto buf, AllocateBuffer(4 * page_size));
+  auto addr = reinterpret_cast<uintptr_t>(buf->mutable_data());
+  addr = (addr + page_size - 1) & ~static_cast<uintptr_t>(page_size - 1);
+
+  // mbind() may be forbidden (e.g. in containers), and transparent huge
+  // pages may be disabled
+  auto st = MemoryBindToNumaNode(reinterpret_cast<void*>(addr), page_size, 0);
+  ASSERT_TRUE(st.ok() || st.IsIOError()) << st.ToString();
+  st = MemoryAdviseHugePages(reinterpret_cast<void*>(addr), page_size);
+  ASSERT_TRUE(st.ok() || st.IsIOError()) << st.ToString();
+  ASSERT_RAISES(Invalid, MemoryBindToNumaNode(reinterpret_cast<void*>(addr), 1, -1));
+}
+#endif
+
 #if _WIN32
 TEST(WinErrorFromStatus, Basics) {
   Status st;
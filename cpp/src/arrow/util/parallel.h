@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -60,5 +62,20 @@ Status OptionalParallelFor(bool use_threads, int num_tasks, FUNCTION&& func) {
   }
 }
 
+// The number of tasks to split `num_items` items of work among on the CPU thread
+// pool, with at least `min_items_per_task` items per task.  This is 1, i.e. the
+// work should run inline, when the current thread belongs to the pool: it would
+// otherwise block waiting on tasks queued behind it.
+
+inline int NumParallelTasks(int64_t num_items, int64_t min_items_per_task) {
+  auto pool = GetCpuThreadPool();
+  if (pool->OwnsThisThread()) {
+    return 1;
+  }
+  const int64_t num_tasks =
+      std::min<int64_t>(pool->GetCapacity(), num_items / min_items_per_task);
+  return static_cast<int>(std::max<int64_t>(1, num_tasks));
+}
+
 }  // namespace internal
 }  // namespace arrow
@@ -172,6 +172,37 @@ TEST(BitArray, TestMixed) {
   }
 }
 
+// Reads values wider than 32 bits, written as their low and high parts
+TEST(BitArray, TestWideValues) {
+  const int num_vals = 100;
+  for (int width = 33; width <= 64; ++width) {
+    const uint64_t mask = width == 64 ? ~uint64_t(0) : (uint64_t(1) << width) - 1;
+    std::vector<uint64_t> values(num_vals);
+    for (int i = 0; i < num_vals; ++i) {
+      values[i] = (uint64_t(0x9E3779B97F4A7C15) * (i + 1)) & mask;
+    }
+    // A leading 3-bit value, so that the wide values are not byte aligned
+    const int len = static_cast<int>(BitUtil::BytesForBits(3 + width * num_vals));
+    std::vector<uint8_t> buffer(len);
+    BitUtil::BitWriter writer(buffer.data(), len);
+    EXPECT_TRUE(writer.PutValue(5, 3));
+    for (uint64_t value : values) {
+      EXPECT_TRUE(writer.PutValue(value & 0xFFFFFFFF, 32));
+      EXPECT_TRUE(writer.PutValue(value >> 32, width - 32));
+    }
+    writer.Flush();
+
+    BitUtil::BitReader reader(buffer.data(), len);
+    int leading = 0;
+    EXPECT_TRUE(reader.GetValue(3, &leading));
+    EXPECT_EQ(leading, 5);
+    std::vector<uint64_t> values_read(num_vals);
+    EXPECT_EQ(num_vals, reader.GetBatch(width, values_read.data(), num_vals));
+    EXPECT_EQ(values, values_read) << "width = " << width;
+    EXPECT_EQ(reader.bytes_left(), 0);
+  }
+}
+
 // Validates encoding of values by encoding and decoding them.  If
 // expected_encoding != NULL, also validates that the encoded buffer is
 // exactly 'expected_encoding'.
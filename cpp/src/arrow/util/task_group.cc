@@ -18,6 +18,7 @@
 #include "arrow/util/task_group.h"
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
 #include <mutex>
@@ -113,7 +114,11 @@ class ThreadedTaskGroup : public TaskGroup {
   Status Finish() override {
     std::unique_lock<std::mutex> lock(mutex_);
     if (!finished_) {
-      cv_.wait(lock, [&]() { return nremaining_.load() == 0; });
+      if (executor_->OwnsThisThread()) {
+        WaitFromWorker(&lock);
+      } else {
+        cv_.wait(lock, [&]() { return nremaining_.load() == 0; });
+      }
       // Current tasks may start other tasks, so only set this when done
       finished_ = true;
       if (parent_) {
@@ -134,6 +139,23 @@ class ThreadedTaskGroup : public TaskGroup {
   }
 
  protected:
+  // When Finish() is called from a task of the same executor (nested task groups),
+  // blocking would take a worker away from the tasks being waited for, and
+  // deadlock if all workers wait.  Instead, run pending tasks until done.
+  void WaitFromWorker(std::unique_lock<std::mutex>* lock) {
+    while (nremaining_.load() != 0) {
+      lock->unlock();
+      const bool ran_task = executor_->RunPendingTask();
+      lock->lock();
+      if (!ran_task) {
+        // The remaining tasks are running on other threads, but they may spawn
+        // tasks that we could help with, so don't wait for too long
+        cv_.wait_for(*lock, std::chrono::milliseconds(1),
+                     [&]() { return nremaining_.load() == 0; });
+      }
+    }
+  }
+
   void UpdateStatus(Status&& st) {
     // Must be called unlocked, only locks on error
     if (ARROW_PREDICT_FALSE(!st.ok())) {
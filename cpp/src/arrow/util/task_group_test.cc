@@ -276,6 +276,31 @@ void StressFailingTaskGroupLifetime(std::function<std::shared_ptr<TaskGroup>()>
   }
 }
 
+// Check that task groups waited for from tasks of the same executor neither
+// deadlock nor monopolize workers
+void TestNestedTaskGroups(Executor* executor) {
+  const int kOuter = 8;
+  const int kInner = 16;
+
+  auto outer_group = TaskGroup::MakeThreaded(executor);
+  std::atomic<int> count(0);
+  for (int i = 0; i < kOuter; ++i) {
+    outer_group->Append([&]() {
+      auto inner_group = TaskGroup::MakeThreaded(executor);
+      for (int j = 0; j < kInner; ++j) {
+        inner_group->Append([&]() {
+          SleepFor(1e-4);
+          ++count;
+          return Status::OK();
+        });
+      }
+      return inner_group->Finish();
+    });
+  }
+  ASSERT_OK(outer_group->Finish());
+  ASSERT_EQ(count.load(), kOuter * kInner);
+}
+
 TEST(SerialTaskGroup, Success) { TestTaskGroupSuccess(TaskGroup::MakeSerial()); }
 
 TEST(SerialTaskGroup, Errors) { TestTaskGroupErrors(TaskGroup::MakeSerial()); }
@@ -323,6 +348,16 @@ TEST(ThreadedTaskGroup, SubGroupsErrors) {
   TestTaskSubGroupsErrors(TaskGroup::MakeThreaded(thread_pool.get()));
 }
 
+TEST(ThreadedTaskGroup, NestedTaskGroups) {
+  // With fewer workers than outer tasks, blocking in the inner Finish() would
+  // deadlock
+  for (int threads : {1, 2, 4}) {
+    std::shared_ptr<ThreadPool> thread_pool;
+    ASSERT_OK_AND_ASSIGN(thread_pool, ThreadPool::Make(threads));
+    TestNestedTaskGroups(thread_pool.get());
+  }
+}
+
 TEST(ThreadedTaskGroup, StressTaskGroupLifetime) {
   std::shared_ptr<ThreadPool> thread_pool;
   ASSERT_OK_AND_ASSIGN(thread_pool, ThreadPool::Make(16));
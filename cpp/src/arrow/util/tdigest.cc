@@ -0,0 +1,228 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/tdigest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "arrow/util/bit_util.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+template <typename T>
+void AppendLittleEndian(T value, std::string* out) {
+  value = BitUtil::ToLittleEndian(value);
+  out->append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void AppendDouble(double value, std::string* out) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  AppendLittleEndian(bits, out);
+}
+
+template <typename T>
+T ReadLittleEndian(const char* data) {
+  T value;
+  std::memcpy(&value, data, sizeof(value));
+  return BitUtil::FromLittleEndian(value);
+}
+
+double ReadDouble(const char* data) {
+  const auto bits = ReadLittleEndian<uint64_t>(data);
+  double value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+// The largest quantile that a centroid starting at quantile q0 may reach,
+// under the arcsine scale function k(q) = delta / (2 pi) * asin(2q - 1),
+// i.e. such that the centroid spans at most one unit of k
+double QuantileLimit(double q0, double delta) {
+  const double k0 = delta / (2 * kPi) * std::asin(std::min(1.0, 2 * q0 - 1));
+  const double k1 = k0 + 1;
+  if (k1 >= delta / 4) {
+    return 1.0;
+  }
+  return (std::sin(k1 * 2 * kPi / delta) + 1) / 2;
+}
+
+// Serialized layout: delta (uint32), min, max (double), number of
+// centroids (uint64), then the (mean, weight) pair of each centroid
+constexpr size_t kHeaderSize = sizeof(uint32_t) + 2 * sizeof(double) + sizeof(uint64_t);
+constexpr size_t kCentroidSize = 2 * sizeof(double);
+
+}  // namespace
+
+constexpr uint32_t TDigest::kDefaultDelta;
+constexpr uint32_t TDigest::kDefaultBufferSize;
+
+TDigest::TDigest(uint32_t delta, uint32_t buffer_size)
+    : delta_(std::max<uint32_t>(delta, 10)),
+      buffer_size_(std::max<uint32_t>(buffer_size, 1)) {
+  buffer_.reserve(buffer_size_);
+}
+
+void TDigest::Merge(const TDigest& other) {
+  buffer_.insert(buffer_.end(), other.centroids_.begin(), other.centroids_.end());
+  buffer_.insert(buffer_.end(), other.buffer_.begin(), other.buffer_.end());
+  min_ = std::min(min_, other.min_);
+  max_ = std::max(max_, other.max_);
+  Compress();
+}
+
+double TDigest::total_weight() const {
+  double total = 0;
+  for (const auto& c : centroids_) {
+    total += c.weight;
+  }
+  for (const auto& c : buffer_) {
+    total += c.weight;
+  }
+  return total;
+}
+
+void TDigest::Compress() {
+  if (buffer_.empty()) {
+    return;
+  }
+  buffer_.insert(buffer_.end(), centroids_.begin(), centroids_.end());
+  std::sort(buffer_.begin(), buffer_.end(),
+            [](const Centroid& l, const Centroid& r) { return l.mean < r.mean; });
+  double total = 0;
+  for (const auto& c : buffer_) {
+    total += c.weight;
+  }
+
+  centroids_.clear();
+  Centroid current = buffer_[0];
+  double q0 = 0;
+  double q_limit = QuantileLimit(q0, delta_);
+  for (size_t i = 1; i < buffer_.size(); ++i) {
+    const Centroid& next = buffer_[i];
+    const double merged_weight = current.weight + next.weight;
+    if (q0 + merged_weight / total <= q_limit) {
+      current.mean += (next.mean - current.mean) * next.weight / merged_weight;
+      current.weight = merged_weight;
+    } else {
+      centroids_.push_back(current);
+      q0 += current.weight / total;
+      q_limit = QuantileLimit(q0, delta_);
+      current = next;
+    }
+  }
+  centroids_.push_back(current);
+  buffer_.clear();
+}
+
+double TDigest::Quantile(double q) {
+  Compress();
+  if (centroids_.empty()) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  if (q <= 0) {
+    return min_;
+  }
+  if (q >= 1) {
+    return max_;
+  }
+  double total = 0;
+  for (const auto& c : centroids_) {
+    total += c.weight;
+  }
+  const double target = q * total;
+
+  // Each centroid is taken to sit at the middle of its weight; between the
+  // extreme centroids and the extreme values, interpolate towards min and max
+  const Centroid& first = centroids_.front();
+  if (target < first.weight / 2) {
+    return min_ + (first.mean - min_) * target / (first.weight / 2);
+  }
+  const Centroid& last = centroids_.back();
+  if (target > total - last.weight / 2) {
+    const double from_end = total - target;
+    return max_ - (max_ - last.mean) * from_end / (last.weight / 2);
+  }
+
+  double cumulative = 0;
+  for (size_t i = 0; i + 1 < centroids_.size(); ++i) {
+    const Centroid& left = centroids_[i];
+    const Centroid& right = centroids_[i + 1];
+    const double left_center = cumulative + left.weight / 2;
+    const double right_center = cumulative + left.weight + right.weight / 2;
+    if (target <= right_center) {
+      return left.mean + (right.mean - left.mean) * (target - left_center) /
+                             (right_center - left_center);
+    }
+    cumulative += left.weight;
+  }
+  return last.mean;
+}
+
+std::string TDigest::Serialize() {
+  Compress();
+  std::string out;
+  out.reserve(kHeaderSize + centroids_.size() * kCentroidSize);
+  AppendLittleEndian(delta_, &out);
+  AppendDouble(min_, &out);
+  AppendDouble(max_, &out);
+  AppendLittleEndian(static_cast<uint64_t>(centroids_.size()), &out);
+  for (const auto& c : centroids_) {
+    AppendDouble(c.mean, &out);
+    AppendDouble(c.weight, &out);
+  }
+  return out;
+}
+
+Result<TDigest> TDigest::Deserialize(util::string_view data, uint32_t buffer_size) {
+  if (data.size() < kHeaderSize) {
+    return Status::Invalid("Serialized t-digest is truncated");
+  }
+  const char* p = data.data();
+  TDigest digest(ReadLittleEndian<uint32_t>(p), buffer_size);
+  p += sizeof(uint32_t);
+  digest.min_ = ReadDouble(p);
+  digest.max_ = ReadDouble(p + sizeof(double));
+  p += 2 * sizeof(double);
+  const auto num_centroids = ReadLittleEndian<uint64_t>(p);
+  p += sizeof(uint64_t);
+  if ((data.size() - kHeaderSize) / kCentroidSize != num_centroids ||
+      (data.size() - kHeaderSize) % kCentroidSize != 0) {
+    return Status::Invalid("Serialized t-digest has size ", data.size(),
+                           ", inconsistent with its ", num_centroids, " centroids");
+  }
+  digest.centroids_.resize(static_cast<size_t>(num_centroids));
+  for (auto& c : digest.centroids_) {
+    c.mean = ReadDouble(p);
+    c.weight = ReadDouble(p + sizeof(double));
+    p += kCentroidSize;
+    if (!(c.weight > 0) || std::isnan(c.mean)) {
+      return Status::Invalid("Invalid t-digest centroid");
+    }
+  }
+  return digest;
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,111 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief A merging t-digest sketch of a distribution of doubles
+///
+/// Values are summarized by weighted centroids which are kept small near
+/// the tails, so that extreme quantiles are estimated more accurately than
+/// the median.  The number of centroids is bounded by about delta, whatever
+/// the number of values added.  Digests can be merged, so partial digests
+/// computed independently combine into the digest of the whole input.
+///
+/// See Ted Dunning and Otmar Ertl, "Computing extremely accurate quantiles
+/// using t-digests" (2019).
+class ARROW_EXPORT TDigest {
+ public:
+  static constexpr uint32_t kDefaultDelta = 100;
+  static constexpr uint32_t kDefaultBufferSize = 500;
+
+  /// \brief Create an empty digest
+  ///
+  /// \param[in] delta the compression parameter, larger values give more
+  /// accurate quantiles at the cost of more centroids
+  /// \param[in] buffer_size the number of values buffered before they are
+  /// merged into the centroids
+  explicit TDigest(uint32_t delta = kDefaultDelta,
+                   uint32_t buffer_size = kDefaultBufferSize);
+
+  /// \brief Add a value, which must not be NaN
+  void Add(double value) {
+    buffer_.push_back({value, 1.0});
+    if (value < min_) {
+      min_ = value;
+    }
+    if (value > max_) {
+      max_ = value;
+    }
+    if (buffer_.size() >= buffer_size_) {
+      Compress();
+    }
+  }
+
+  /// \brief Merge another digest into this one
+  void Merge(const TDigest& other);
+
+  /// \brief Estimate the q-quantile, with q in [0, 1]
+  ///
+  /// Return NaN if the digest is empty.
+  double Quantile(double q);
+
+  /// \brief The total weight (number of values) added
+  double total_weight() const;
+
+  bool is_empty() const { return centroids_.empty() && buffer_.empty(); }
+
+  uint32_t delta() const { return delta_; }
+
+  /// \brief Serialize the digest to a little-endian byte string
+  std::string Serialize();
+
+  /// \brief Reconstruct a digest produced by Serialize()
+  static Result<TDigest> Deserialize(util::string_view data,
+                                     uint32_t buffer_size = kDefaultBufferSize);
+
+ private:
+  struct Centroid {
+    double mean;
+    double weight;
+  };
+
+  /// Merge the buffered values into the centroids
+  void Compress();
+
+  uint32_t delta_;
+  size_t buffer_size_;
+  double min_ = std::numeric_limits<double>::infinity();
+  double max_ = -std::numeric_limits<double>::infinity();
+  std::vector<Centroid> centroids_;
+  std::vector<Centroid> buffer_;
+};
+
+}  // namespace internal
+}  // namespace arrow
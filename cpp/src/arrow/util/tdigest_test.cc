@@ -0,0 +1,122 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/tdigest.h"
+
+namespace arrow {
+namespace internal {
+
+TEST(TDigest, Empty) {
+  TDigest digest;
+  ASSERT_TRUE(digest.is_empty());
+  ASSERT_TRUE(std::isnan(digest.Quantile(0.5)));
+}
+
+TEST(TDigest, SmallInputIsExact) {
+  TDigest digest;
+  for (double value : {5, 1, 4, 2, 3}) {
+    digest.Add(value);
+  }
+  ASSERT_FALSE(digest.is_empty());
+  ASSERT_EQ(5, digest.total_weight());
+  ASSERT_EQ(1, digest.Quantile(0));
+  ASSERT_EQ(3, digest.Quantile(0.5));
+  ASSERT_EQ(5, digest.Quantile(1));
+}
+
+class TestTDigestAccuracy : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::default_random_engine engine(42);
+    std::normal_distribution<double> dist(0, 100);
+    values_.resize(200000);
+    for (auto& value : values_) {
+      value = dist(engine);
+    }
+    sorted_ = values_;
+    std::sort(sorted_.begin(), sorted_.end());
+  }
+
+  // Check the rank error of the estimated quantiles
+  void CheckQuantiles(TDigest* digest) {
+    for (double q : {0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999}) {
+      const double estimate = digest->Quantile(q);
+      const auto rank = std::lower_bound(sorted_.begin(), sorted_.end(), estimate) -
+                        sorted_.begin();
+      const double tolerance = q < 0.01 || q > 0.99 ? 0.0005 : 0.005;
+      ASSERT_NEAR(q, static_cast<double>(rank) / sorted_.size(), tolerance)
+          << "quantile " << q;
+    }
+    ASSERT_EQ(sorted_.front(), digest->Quantile(0));
+    ASSERT_EQ(sorted_.back(), digest->Quantile(1));
+  }
+
+  std::vector<double> values_;
+  std::vector<double> sorted_;
+};
+
+TEST_F(TestTDigestAccuracy, Add) {
+  TDigest digest;
+  for (double value : values_) {
+    digest.Add(value);
+  }
+  ASSERT_EQ(values_.size(), digest.total_weight());
+  CheckQuantiles(&digest);
+}
+
+TEST_F(TestTDigestAccuracy, Merge) {
+  std::vector<TDigest> partials(7);
+  for (size_t i = 0; i < values_.size(); ++i) {
+    partials[i % partials.size()].Add(values_[i]);
+  }
+  TDigest digest;
+  for (const auto& partial : partials) {
+    digest.Merge(partial);
+  }
+  ASSERT_EQ(values_.size(), digest.total_weight());
+  CheckQuantiles(&digest);
+}
+
+TEST_F(TestTDigestAccuracy, Serialize) {
+  TDigest digest(/*delta=*/200);
+  for (double value : values_) {
+    digest.Add(value);
+  }
+  auto serialized = digest.Serialize();
+  ASSERT_OK_AND_ASSIGN(auto roundtripped, TDigest::Deserialize(serialized));
+  ASSERT_EQ(200, roundtripped.delta());
+  ASSERT_EQ(digest.total_weight(), roundtripped.total_weight());
+  for (double q : {0.0, 0.01, 0.5, 0.99, 1.0}) {
+    ASSERT_EQ(digest.Quantile(q), roundtripped.Quantile(q));
+  }
+  CheckQuantiles(&roundtripped);
+
+  ASSERT_RAISES(Invalid, TDigest::Deserialize(serialized.substr(0, 10)));
+  ASSERT_RAISES(Invalid,
+                TDigest::Deserialize(serialized.substr(0, serialized.size() - 8)));
+}
+
+}  // namespace internal
+}  // namespace arrow
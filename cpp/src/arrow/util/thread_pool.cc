@@ -18,6 +18,7 @@
 #include "arrow/util/thread_pool.h"
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <list>
@@ -29,17 +30,52 @@
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 namespace arrow {
 namespace internal {
 
 Executor::~Executor() {}
 
+// Tasks are queued in two places:
+// - each worker has a local deque, to which the tasks it spawns with the default
+//   priority are pushed.  The worker pops them in LIFO order, which tends to run
+//   a task while its data is still cache-resident, and idle workers steal them
+//   in FIFO order.  Each deque has its own mutex, which is only contended
+//   when stealing;
+// - a shared queue receives the tasks spawned from outside the pool and the
+//   tasks with a non-default priority.  It is ordered by priority, then in
+//   FIFO order.
+//
+// Workers first run the urgent (negative priority) shared tasks, then their
+// local tasks, then the other shared tasks, and finally steal from other workers.
 struct ThreadPool::State {
-  State() : desired_capacity_(0), please_shutdown_(false), quick_shutdown_(false) {}
+  using Task = std::function<void()>;
+
+  struct LocalQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+  using LocalQueues = std::vector<std::shared_ptr<LocalQueue>>;
+
+  struct SharedTask {
+    Task task;
+    int32_t priority;
+    uint64_t sequence;
 
-  // NOTE: in case locking becomes too expensive, we can investigate lock-free FIFOs
-  // such as https://github.com/cameron314/concurrentqueue
+    // The shared queue is a max-heap, so the most urgent task must compare greatest
+    bool operator<(const SharedTask& other) const {
+      if (priority != other.priority) {
+        return priority > other.priority;
+      }
+      return sequence > other.sequence;
+    }
+  };
 
+  // Protects the workers, the shutdown flags and the sleeping of idle workers
   std::mutex mutex_;
   std::condition_variable cv_;
   std::condition_variable cv_shutdown_;
@@ -47,58 +83,245 @@ struct ThreadPool::State {
   std::list<std::thread> workers_;
   // Trashcan for finished threads
   std::vector<std::thread> finished_workers_;
-  std::deque<std::function<void()>> pending_tasks_;
+
+  // The local queues of the current workers.  The vector is replaced as a whole,
+  // under mutex_, so that thieves can read it with std::atomic_load() unlocked.
+  std::shared_ptr<const LocalQueues> local_queues_ = std::make_shared<LocalQueues>();
+
+  // Protects the shared queue
+  std::mutex shared_mutex_;
+  std::vector<SharedTask> shared_tasks_;
+  uint64_t next_sequence_ = 0;
+
+  // Number of tasks in all queues, to let idle workers sleep
+  std::atomic<int64_t> num_pending_{0};
+  // Number of tasks in the shared queue, and how many of those are urgent
+  std::atomic<int64_t> num_shared_{0};
+  std::atomic<int64_t> num_urgent_{0};
+  std::atomic<int> num_sleeping_{0};
 
   // Desired number of threads
-  int desired_capacity_;
+  std::atomic<int> desired_capacity_{0};
+  // Mirrors workers_.size(), for lock-free checks
+  std::atomic<int> num_workers_{0};
+  // Mirrors finished_workers_.size(), for lock-free checks
+  std::atomic<int> num_finished_workers_{0};
   // Are we shutting down?
-  bool please_shutdown_;
-  bool quick_shutdown_;
+  std::atomic<bool> please_shutdown_{false};
+  std::atomic<bool> quick_shutdown_{false};
+
+  // The CPUs the workers are pinned to, if any (protected by mutex_)
+  std::vector<int> cpu_affinity_;
+};
+
+namespace {
+
+using Task = ThreadPool::State::Task;
+using LocalQueue = ThreadPool::State::LocalQueue;
+using LocalQueues = ThreadPool::State::LocalQueues;
+
+// The pool and local queue of the current thread, if it is a worker
+struct WorkerContext {
+  ThreadPool::State* state = NULLPTR;
+  LocalQueue* queue = NULLPTR;
 };
 
+thread_local WorkerContext current_worker;
+
+#ifdef __linux__
+// An empty list of CPUs allows all of them
+Status SetThreadCpuAffinity(pthread_t thread, const std::vector<int>& cpus) {
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  if (cpus.empty()) {
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      CPU_SET(cpu, &cpu_set);
+    }
+  }
+  for (int cpu : cpus) {
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+      return Status::Invalid("Invalid CPU number: ", cpu);
+    }
+    CPU_SET(cpu, &cpu_set);
+  }
+  int err = pthread_setaffinity_np(thread, sizeof(cpu_set), &cpu_set);
+  if (err != 0) {
+    return IOErrorFromErrno(err, "pthread_setaffinity_np failed");
+  }
+  return Status::OK();
+}
+#endif
+
+// Must be called with state->shared_mutex_ held
+void PushSharedTaskUnlocked(ThreadPool::State* state, Task task, int32_t priority) {
+  state->shared_tasks_.push_back({std::move(task), priority, state->next_sequence_++});
+  std::push_heap(state->shared_tasks_.begin(), state->shared_tasks_.end());
+  if (priority < 0) {
+    ++state->num_urgent_;
+  }
+  ++state->num_shared_;
+  ++state->num_pending_;
+}
+
+bool PopSharedTask(ThreadPool::State* state, Task* out) {
+  if (state->num_shared_.load() == 0) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(state->shared_mutex_);
+  auto& heap = state->shared_tasks_;
+  if (heap.empty()) {
+    return false;
+  }
+  std::pop_heap(heap.begin(), heap.end());
+  if (heap.back().priority < 0) {
+    --state->num_urgent_;
+  }
+  *out = std::move(heap.back().task);
+  heap.pop_back();
+  --state->num_shared_;
+  --state->num_pending_;
+  return true;
+}
+
+bool PopLocalTask(ThreadPool::State* state, LocalQueue* queue, Task* out) {
+  std::lock_guard<std::mutex> lock(queue->mutex);
+  if (queue->tasks.empty()) {
+    return false;
+  }
+  *out = std::move(queue->tasks.back());
+  queue->tasks.pop_back();
+  --state->num_pending_;
+  return true;
+}
+
+bool StealTask(ThreadPool::State* state, LocalQueue* own_queue, Task* out) {
+  // Start from a different victim for each attempt, to spread the thieves
+  static thread_local size_t next_victim = 0;
+
+  auto queues = std::atomic_load(&state->local_queues_);
+  const size_t num_queues = queues->size();
+  for (size_t i = 0; i < num_queues; ++i) {
+    LocalQueue* queue = (*queues)[(next_victim + i) % num_queues].get();
+    if (queue == own_queue) {
+      continue;
+    }
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    if (!queue->tasks.empty()) {
+      *out = std::move(queue->tasks.front());
+      queue->tasks.pop_front();
+      --state->num_pending_;
+      next_victim += i + 1;
+      return true;
+    }
+  }
+  ++next_victim;
+  return false;
+}
+
+bool TakeTask(ThreadPool::State* state, LocalQueue* own_queue, Task* out) {
+  if (state->num_urgent_.load() > 0 && PopSharedTask(state, out)) {
+    return true;
+  }
+  if (own_queue != NULLPTR && PopLocalTask(state, own_queue, out)) {
+    return true;
+  }
+  return PopSharedTask(state, out) || StealTask(state, own_queue, out);
+}
+
+// Must be called with state->mutex_ held
+void RemoveWorkerUnlocked(ThreadPool::State* state,
+                          const std::shared_ptr<LocalQueue>& queue) {
+  auto queues = std::make_shared<LocalQueues>();
+  for (const auto& other : *state->local_queues_) {
+    if (other != queue) {
+      queues->push_back(other);
+    }
+  }
+  std::atomic_store(&state->local_queues_,
+                    std::shared_ptr<const LocalQueues>(std::move(queues)));
+
+  // Hand the remaining local tasks over to the other workers
+  std::lock_guard<std::mutex> queue_lock(queue->mutex);
+  if (!queue->tasks.empty()) {
+    std::lock_guard<std::mutex> shared_lock(state->shared_mutex_);
+    for (auto& task : queue->tasks) {
+      --state->num_pending_;
+      PushSharedTaskUnlocked(state, std::move(task), /*priority=*/0);
+    }
+    queue->tasks.clear();
+    state->cv_.notify_all();
+  }
+}
+
+}  // namespace
+
 // The worker loop is an independent function so that it can keep running
 // after the ThreadPool is destroyed.
 static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
-                       std::list<std::thread>::iterator it) {
+                       std::list<std::thread>::iterator it,
+                       std::shared_ptr<LocalQueue> queue) {
+  current_worker.state = state.get();
+  current_worker.queue = queue.get();
+
   std::unique_lock<std::mutex> lock(state->mutex_);
 
   // Since we hold the lock, `it` now points to the correct thread object
   // (LaunchWorkersUnlocked has exited)
   DCHECK_EQ(std::this_thread::get_id(), it->get_id());
 
+#ifdef __linux__
+  if (!state->cpu_affinity_.empty()) {
+    ARROW_UNUSED(SetThreadCpuAffinity(pthread_self(), state->cpu_affinity_));
+  }
+#endif
+
   // If too many threads, we should secede from the pool
   const auto should_secede = [&]() -> bool {
     return state->workers_.size() > static_cast<size_t>(state->desired_capacity_);
   };
+  // Lock-free approximation of should_secede(), checked between tasks
+  const auto may_secede = [&]() -> bool {
+    return state->num_workers_.load() > state->desired_capacity_.load();
+  };
 
+  Task task;
   while (true) {
     // By the time this thread is started, some tasks may have been pushed
     // or shutdown could even have been requested.  So we only wait on the
     // condition variable at the end of the loop.
+    lock.unlock();
 
     // Execute pending tasks if any
-    while (!state->pending_tasks_.empty() && !state->quick_shutdown_) {
-      // We check this opportunistically at each loop iteration since
-      // it releases the lock below.
-      if (should_secede()) {
-        break;
-      }
-      {
-        std::function<void()> task = std::move(state->pending_tasks_.front());
-        state->pending_tasks_.pop_front();
-        lock.unlock();
-        task();
-      }
-      lock.lock();
+    while (!state->quick_shutdown_.load() && !may_secede() &&
+           TakeTask(state.get(), queue.get(), &task)) {
+      task();
+      task = nullptr;
+    }
+
+    lock.lock();
+    // Now either the queues are empty, we may have to secede, *or* a quick
+    // shutdown was requested
+    if (state->quick_shutdown_ || should_secede()) {
+      break;
+    }
+    if (state->num_pending_.load() > 0) {
+      continue;
     }
-    // Now either the queue is empty *or* a quick shutdown was requested
-    if (state->please_shutdown_ || should_secede()) {
+    if (state->please_shutdown_) {
       break;
     }
-    // Wait for next wakeup
-    state->cv_.wait(lock);
+    // Wait for next wakeup.  The spawners check num_sleeping_ after
+    // incrementing num_pending_, so the wakeup cannot be missed.
+    ++state->num_sleeping_;
+    if (state->num_pending_.load() == 0) {
+      state->cv_.wait(lock);
+    }
+    --state->num_sleeping_;
   }
 
+  RemoveWorkerUnlocked(state.get(), queue);
+  current_worker = WorkerContext{};
+
   // We're done.  Move our thread object to the trashcan of finished
   // workers.  This has two motivations:
   // 1) the thread object doesn't get destroyed before this function finishes
@@ -108,7 +331,9 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
   //    timing conditions can lead to false positives with Valgrind.
   DCHECK_EQ(std::this_thread::get_id(), it->get_id());
   state->finished_workers_.push_back(std::move(*it));
+  ++state->num_finished_workers_;
   state->workers_.erase(it);
+  state->num_workers_ = static_cast<int>(state->workers_.size());
   if (state->please_shutdown_) {
     // Notify the function waiting in Shutdown().
     state->cv_shutdown_.notify_one();
@@ -141,8 +366,9 @@ void ThreadPool::ProtectAgainstFork() {
     int capacity = state_->desired_capacity_;
 
     auto new_state = std::make_shared<ThreadPool::State>();
-    new_state->please_shutdown_ = state_->please_shutdown_;
-    new_state->quick_shutdown_ = state_->quick_shutdown_;
+    new_state->please_shutdown_ = state_->please_shutdown_.load();
+    new_state->quick_shutdown_ = state_->quick_shutdown_.load();
+    new_state->cpu_affinity_ = state_->cpu_affinity_;
 
     pid_ = current_pid;
     sp_state_ = new_state;
@@ -178,6 +404,20 @@ Status ThreadPool::SetCapacity(int threads) {
   return Status::OK();
 }
 
+Status ThreadPool::SetCpuAffinity(std::vector<int> cpus) {
+  ProtectAgainstFork();
+#ifdef __linux__
+  std::unique_lock<std::mutex> lock(state_->mutex_);
+  for (auto& worker : state_->workers_) {
+    RETURN_NOT_OK(SetThreadCpuAffinity(worker.native_handle(), cpus));
+  }
+  state_->cpu_affinity_ = std::move(cpus);
+  return Status::OK();
+#else
+  return Status::NotImplemented("Pinning threads to CPUs");
+#endif
+}
+
 int ThreadPool::GetCapacity() {
   ProtectAgainstFork();
   std::unique_lock<std::mutex> lock(state_->mutex_);
@@ -197,14 +437,24 @@ Status ThreadPool::Shutdown(bool wait) {
   if (state_->please_shutdown_) {
     return Status::Invalid("Shutdown() already called");
   }
-  state_->please_shutdown_ = true;
-  state_->quick_shutdown_ = !wait;
+  {
+    // Synchronize with SpawnReal(), so that no task is queued after the
+    // workers have exited
+    std::lock_guard<std::mutex> shared_lock(state_->shared_mutex_);
+    state_->quick_shutdown_ = !wait;
+    state_->please_shutdown_ = true;
+  }
   state_->cv_.notify_all();
   state_->cv_shutdown_.wait(lock, [this] { return state_->workers_.empty(); });
   if (!state_->quick_shutdown_) {
-    DCHECK_EQ(state_->pending_tasks_.size(), 0);
+    DCHECK_EQ(state_->num_pending_.load(), 0);
   } else {
-    state_->pending_tasks_.clear();
+    // The exiting workers moved their local tasks to the shared queue
+    std::lock_guard<std::mutex> shared_lock(state_->shared_mutex_);
+    state_->shared_tasks_.clear();
+    state_->num_shared_ = 0;
+    state_->num_urgent_ = 0;
+    state_->num_pending_ = 0;
   }
   CollectFinishedWorkersUnlocked();
   return Status::OK();
@@ -216,38 +466,81 @@ void ThreadPool::CollectFinishedWorkersUnlocked() {
     thread.join();
   }
   state_->finished_workers_.clear();
+  state_->num_finished_workers_ = 0;
 }
 
 void ThreadPool::LaunchWorkersUnlocked(int threads) {
   std::shared_ptr<State> state = sp_state_;
+  auto queues = std::make_shared<LocalQueues>(*state_->local_queues_);
 
   for (int i = 0; i < threads; i++) {
+    auto queue = std::make_shared<LocalQueue>();
+    queues->push_back(queue);
     state_->workers_.emplace_back();
     auto it = --(state_->workers_.end());
-    *it = std::thread([state, it] { WorkerLoop(state, it); });
+    *it = std::thread([state, it, queue] { WorkerLoop(state, it, queue); });
   }
+  state_->num_workers_ = static_cast<int>(state_->workers_.size());
+  std::atomic_store(&state_->local_queues_,
+                    std::shared_ptr<const LocalQueues>(std::move(queues)));
 }
 
 Status ThreadPool::SpawnReal(TaskHints hints, std::function<void()> task) {
-  {
-    ProtectAgainstFork();
-    std::lock_guard<std::mutex> lock(state_->mutex_);
+  ProtectAgainstFork();
+  if (current_worker.state == state_ && hints.priority == 0) {
+    // A worker can't exit while it is running this, so the task can't be lost
+    if (state_->please_shutdown_) {
+      return Status::Invalid("operation forbidden during or after shutdown");
+    }
+    LocalQueue* queue = current_worker.queue;
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    queue->tasks.push_back(std::move(task));
+    ++state_->num_pending_;
+  } else {
+    std::lock_guard<std::mutex> lock(state_->shared_mutex_);
     if (state_->please_shutdown_) {
       return Status::Invalid("operation forbidden during or after shutdown");
     }
+    PushSharedTaskUnlocked(state_, std::move(task), hints.priority);
+  }
+  // mutex_ is only taken when there is a sleeping worker to wake up or a finished
+  // worker to join
+  if (state_->num_sleeping_.load() > 0 || state_->num_finished_workers_.load() > 0) {
+    std::lock_guard<std::mutex> lock(state_->mutex_);
     CollectFinishedWorkersUnlocked();
-    state_->pending_tasks_.push_back(std::move(task));
+    state_->cv_.notify_one();
   }
-  state_->cv_.notify_one();
   return Status::OK();
 }
 
+bool ThreadPool::OwnsThisThread() { return current_worker.state == state_; }
+
+bool ThreadPool::RunPendingTask() {
+  if (current_worker.state != state_ || state_->quick_shutdown_) {
+    return false;
+  }
+  Task task;
+  if (!TakeTask(state_, current_worker.queue, &task)) {
+    return false;
+  }
+  task();
+  return true;
+}
+
 Result<std::shared_ptr<ThreadPool>> ThreadPool::Make(int threads) {
   auto pool = std::shared_ptr<ThreadPool>(new ThreadPool());
   RETURN_NOT_OK(pool->SetCapacity(threads));
   return pool;
 }
 
+Result<std::shared_ptr<ThreadPool>> ThreadPool::MakeForNumaNode(int threads, int node) {
+  ARROW_ASSIGN_OR_RAISE(auto cpus, GetNumaNodeCpus(node));
+  auto pool = std::shared_ptr<ThreadPool>(new ThreadPool());
+  RETURN_NOT_OK(pool->SetCpuAffinity(std::move(cpus)));
+  RETURN_NOT_OK(pool->SetCapacity(threads));
+  return pool;
+}
+
 Result<std::shared_ptr<ThreadPool>> ThreadPool::MakeEternal(int threads) {
   ARROW_ASSIGN_OR_RAISE(auto pool, Make(threads));
   // On Windows, the ThreadPool destructor may be called after non-main threads
@@ -26,9 +26,11 @@
 #include <memory>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/cancel.h"
 #include "arrow/util/future.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
@@ -76,7 +78,7 @@ struct ExecutorResultTraits<Result<T>> {
 }  // namespace detail
 
 // Hints about a task that may be used by an Executor.
-// They are ignored by the provided ThreadPool implementation.
+// The provided ThreadPool implementation only honors `priority`.
 struct TaskHints {
   // The lower, the more urgent
   int32_t priority = 0;
@@ -103,6 +105,24 @@ class ARROW_EXPORT Executor {
     return SpawnReal(std::move(hints), std::forward<Function>(func));
   }
 
+  // Spawn a fire-and-forget task which is dropped, rather than run, if
+  // `stop_token` is stopped by the time the task is dequeued.
+  template <typename Function>
+  Status Spawn(TaskHints hints, StopToken stop_token, Function&& func) {
+    struct Task {
+      typename std::decay<Function>::type func;
+      StopToken stop_token;
+
+      void operator()() {
+        if (!stop_token.IsStopRequested()) {
+          func();
+        }
+      }
+    };
+    return SpawnReal(std::move(hints),
+                     Task{std::forward<Function>(func), std::move(stop_token)});
+  }
+
   // Submit a callable and arguments for execution.  Return a future that
   // will return the callable's result value once.
   // The callable's arguments are copied before execution.
@@ -121,6 +141,20 @@ class ARROW_EXPORT Executor {
       typename RT = typename detail::ExecutorResultTraits<FunctionRetType>,
       typename ValueType = typename RT::ValueType>
   Result<Future<ValueType>> Submit(TaskHints hints, Function&& func, Args&&... args) {
+    return Submit(std::move(hints), StopToken::Unstoppable(),
+                  std::forward<Function>(func), std::forward<Args>(args)...);
+  }
+
+  // Like Submit(), but the task is dropped, rather than run, if `stop_token`
+  // is stopped by the time the task is dequeued.  The future then fails with
+  // the stop error.
+  template <
+      typename Function, typename... Args,
+      typename FunctionRetType = typename std::result_of<Function && (Args && ...)>::type,
+      typename RT = typename detail::ExecutorResultTraits<FunctionRetType>,
+      typename ValueType = typename RT::ValueType>
+  Result<Future<ValueType>> Submit(TaskHints hints, StopToken stop_token, Function&& func,
+                                   Args&&... args) {
     auto bound_func =
         std::bind(std::forward<Function>(func), std::forward<Args>(args)...);
     using BoundFuncType = decltype(bound_func);
@@ -128,11 +162,20 @@ class ARROW_EXPORT Executor {
     struct Task {
       BoundFuncType bound_func;
       Future<ValueType> future;
-
-      void operator()() { future.ExecuteAndMarkFinished(std::move(bound_func)); }
+      StopToken stop_token;
+
+      void operator()() {
+        Status st = stop_token.Poll();
+        if (!st.ok()) {
+          future.MarkFinished(std::move(st));
+          return;
+        }
+        future.ExecuteAndMarkFinished(std::move(bound_func));
+      }
     };
     auto future = Future<ValueType>::Make();
-    ARROW_RETURN_NOT_OK(SpawnReal(std::move(hints), Task{std::move(bound_func), future}));
+    ARROW_RETURN_NOT_OK(SpawnReal(
+        std::move(hints), Task{std::move(bound_func), future, std::move(stop_token)}));
     return future;
   }
 
@@ -149,10 +192,39 @@ class ARROW_EXPORT Executor {
     return future;
   }
 
+  // Return a future completing like `future`, but on one of this executor's
+  // threads.  Callbacks and continuations of the returned future then run on
+  // this executor rather than in the thread completing `future` (e.g. an IO
+  // thread handing data over to CPU-bound work).
+  template <typename T>
+  Future<T> Transfer(Future<T> future) {
+    auto transferred = Future<T>::Make();
+    future.AddCallback(
+        [this, transferred](const typename Future<T>::OutcomeType& outcome) mutable {
+          Status st = Spawn([transferred, outcome]() mutable {
+            transferred.MarkFinished(std::move(outcome));
+          });
+          if (!st.ok()) {
+            transferred.MarkFinished(std::move(st));
+          }
+        });
+    return transferred;
+  }
+
   // Return the level of parallelism (the number of tasks that may be executed
   // concurrently).  This may be an approximate number.
   virtual int GetCapacity() = 0;
 
+  // Return whether the calling thread is one of the executor's workers.
+  virtual bool OwnsThisThread() { return false; }
+
+  // If the calling thread is one of the executor's workers, run one pending
+  // task on it and return true.  Return false if no task could be run.
+  //
+  // This lets a worker which waits for other tasks of the same executor help
+  // running them, instead of blocking a slot which these tasks may need.
+  virtual bool RunPendingTask() { return false; }
+
  protected:
   ARROW_DISALLOW_COPY_AND_ASSIGN(Executor);
 
@@ -162,8 +234,14 @@ class ARROW_EXPORT Executor {
   virtual Status SpawnReal(TaskHints hints, std::function<void()> task) = 0;
 };
 
-// An Executor implementation spawning tasks in FIFO manner on a fixed-size
-// pool of worker threads.
+// An Executor implementation spawning tasks on a fixed-size pool of worker
+// threads.
+//
+// Tasks spawned from outside the pool run in order of priority, then in FIFO
+// order.  Tasks spawned by a worker with the default priority are queued on the
+// worker's own deque: the worker runs them in LIFO order, and idle workers steal
+// them in FIFO order.  This avoids contention on a single queue when tasks
+// spawn many fine-grained tasks.
 class ARROW_EXPORT ThreadPool : public Executor {
  public:
   // Construct a thread pool with the given number of worker threads
@@ -186,6 +264,15 @@ class ARROW_EXPORT ThreadPool : public Executor {
   // thread count is fully adjusted.
   Status SetCapacity(int threads);
 
+  // Pin the worker threads to the given CPUs, or unpin them if `cpus` is empty.
+  // This applies to the current workers as well as those launched later.
+  // Only supported on Linux.
+  Status SetCpuAffinity(std::vector<int> cpus);
+
+  // Construct a thread pool whose workers are pinned to the CPUs of a NUMA
+  // node, so that the tasks it runs access node-local memory.
+  static Result<std::shared_ptr<ThreadPool>> MakeForNumaNode(int threads, int node);
+
   // Heuristic for the default capacity of a thread pool for CPU-bound tasks.
   // This is exposed as a static method to help with testing.
   static int DefaultCapacity();
@@ -197,6 +284,10 @@ class ARROW_EXPORT ThreadPool : public Executor {
   // tasks are finished.
   Status Shutdown(bool wait = true);
 
+  bool OwnsThisThread() override;
+
+  bool RunPendingTask() override;
+
   struct State;
 
  protected:
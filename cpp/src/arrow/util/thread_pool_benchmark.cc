@@ -147,6 +147,37 @@ static void ThreadedTaskGroup(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * nspawns);
 }
 
+// Benchmark threaded TaskGroups appended to from tasks of the same pool,
+// which go to the workers' local queues
+static void NestedThreadedTaskGroup(benchmark::State& state) {
+  const auto nthreads = static_cast<int>(state.range(0));
+  const auto workload_size = static_cast<int32_t>(state.range(1));
+
+  std::shared_ptr<ThreadPool> pool;
+  pool = *ThreadPool::Make(nthreads);
+
+  Task task(workload_size);
+  const int32_t nouter = 100;
+  const int32_t ninner = 10000000 / workload_size / nouter + 1;
+
+  for (auto _ : state) {
+    auto task_group = TaskGroup::MakeThreaded(pool.get());
+    for (int32_t i = 0; i < nouter; ++i) {
+      task_group->Append([&]() {
+        auto inner_group = TaskGroup::MakeThreaded(pool.get());
+        for (int32_t j = 0; j < ninner; ++j) {
+          // Pass the task by reference to avoid copying it around
+          inner_group->Append(std::ref(task));
+        }
+        return inner_group->Finish();
+      });
+    }
+    ABORT_NOT_OK(task_group->Finish());
+  }
+  ABORT_NOT_OK(pool->Shutdown(true /* wait */));
+  state.SetItemsProcessed(state.iterations() * nouter * ninner);
+}
+
 static const int32_t kWorkloadSizes[] = {1000, 10000, 100000};
 
 static void WorkloadCost_Customize(benchmark::internal::Benchmark* b) {
@@ -190,6 +221,7 @@ BENCHMARK(ReferenceWorkloadCost)->Apply(WorkloadCost_Customize);
 BENCHMARK(SerialTaskGroup)->Apply(WorkloadCost_Customize);
 BENCHMARK(ThreadPoolSpawn)->Apply(ThreadPoolSpawn_Customize);
 BENCHMARK(ThreadedTaskGroup)->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK(NestedThreadedTaskGroup)->Apply(ThreadPoolSpawn_Customize);
 
 }  // namespace internal
 }  // namespace arrow
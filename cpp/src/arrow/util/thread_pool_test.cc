@@ -20,11 +20,17 @@
 #include <unistd.h>
 #endif
 
+#ifdef __linux__
+#include <sched.h>
+#endif
+
 #include <algorithm>
+#include <atomic>
 #include <cstdio>
 #include <cstdlib>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <vector>
@@ -34,6 +40,7 @@
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/thread_pool.h"
 
@@ -289,6 +296,92 @@ TEST_F(TestThreadPool, Submit) {
   }
 }
 
+TEST_F(TestThreadPool, TasksSpawnTasks) {
+  auto pool = this->MakeThreadPool(4);
+  const int kDepth = 12;
+
+  std::atomic<int> count(0);
+  std::function<void(int)> task = [&](int depth) {
+    ASSERT_TRUE(pool->OwnsThisThread());
+    ++count;
+    if (depth > 0) {
+      // Spawned from a worker: these go to the worker's local queue and get
+      // stolen by the other workers
+      ASSERT_OK(pool->Spawn([&, depth] { task(depth - 1); }));
+      ASSERT_OK(pool->Spawn([&, depth] { task(depth - 1); }));
+    }
+  };
+  ASSERT_FALSE(pool->OwnsThisThread());
+  ASSERT_OK(pool->Spawn([&] { task(kDepth); }));
+  busy_wait(10, [&] { return count.load() == (1 << (kDepth + 1)) - 1; });
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_EQ(count.load(), (1 << (kDepth + 1)) - 1);
+}
+
+TEST_F(TestThreadPool, Priority) {
+  auto pool = this->MakeThreadPool(1);
+
+  // Occupy the only worker while the other tasks are spawned
+  std::atomic<bool> unblock(false);
+  ASSERT_OK(pool->Spawn([&] { busy_wait(10, [&] { return unblock.load(); }); }));
+
+  std::mutex mutex;
+  std::vector<int> order;
+  const std::vector<int32_t> priorities = {3, 0, -2, 1, 0};
+  for (int i = 0; i < static_cast<int>(priorities.size()); ++i) {
+    TaskHints hints;
+    hints.priority = priorities[i];
+    ASSERT_OK(pool->Spawn(hints, [&, i] {
+      std::lock_guard<std::mutex> lock(mutex);
+      order.push_back(i);
+    }));
+  }
+  unblock.store(true);
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_EQ(order, std::vector<int>({2, 1, 4, 3, 0}));
+}
+
+TEST_F(TestThreadPool, StopToken) {
+  auto pool = this->MakeThreadPool(1);
+
+  // Occupy the only worker while the other tasks are queued
+  std::atomic<bool> unblock(false);
+  ASSERT_OK(pool->Spawn([&] { busy_wait(10, [&] { return unblock.load(); }); }));
+
+  StopSource stop_source;
+  std::atomic<int> count(0);
+  ASSERT_OK(pool->Spawn(TaskHints{}, stop_source.token(), [&] { ++count; }));
+  ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit(TaskHints{}, stop_source.token(),
+                                              [&] { return ++count; }));
+  ASSERT_OK_AND_ASSIGN(auto unstopped, pool->Submit(TaskHints{}, StopToken::Unstoppable(),
+                                                    add<int>, 4, 5));
+  stop_source.RequestStop();
+  unblock.store(true);
+
+  // The queued tasks were dropped
+  ASSERT_RAISES(Cancelled, fut.result());
+  ASSERT_OK_AND_EQ(9, unstopped.result());
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_EQ(count.load(), 0);
+}
+
+TEST_F(TestThreadPool, RunPendingTask) {
+  auto pool = this->MakeThreadPool(1);
+  // Not a worker
+  ASSERT_FALSE(pool->RunPendingTask());
+
+  // The only worker waits for a task it spawned, without deadlocking
+  ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit([&] {
+    std::atomic<bool> done(false);
+    ARROW_CHECK_OK(pool->Spawn([&] { done.store(true); }));
+    while (!done.load()) {
+      ARROW_CHECK(pool->RunPendingTask());
+    }
+    return pool->RunPendingTask();
+  }));
+  ASSERT_OK_AND_EQ(false, fut.result());
+}
+
 // Test fork safety on Unix
 
 #if !(defined(_WIN32) || defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER) || \
@@ -349,6 +442,54 @@ TEST_F(TestThreadPool, ForkSafety) {
 }
 #endif
 
+#ifdef __linux__
+TEST_F(TestThreadPool, SetCpuAffinity) {
+  auto pool = this->MakeThreadPool(3);
+  // Pin to a CPU we're allowed to run on
+  cpu_set_t allowed;
+  ASSERT_EQ(0, sched_getaffinity(0, sizeof(allowed), &allowed));
+  int cpu = 0;
+  while (!CPU_ISSET(cpu, &allowed)) {
+    ++cpu;
+  }
+  ASSERT_OK(pool->SetCpuAffinity({cpu}));
+
+  auto run_on = [&]() {
+    std::vector<Future<int>> futures;
+    for (int i = 0; i < 20; ++i) {
+      futures.push_back(*pool->Submit([] { return sched_getcpu(); }));
+    }
+    std::vector<int> cpus;
+    for (auto& fut : futures) {
+      cpus.push_back(*fut.result());
+    }
+    return cpus;
+  };
+  for (int actual : run_on()) {
+    ASSERT_EQ(actual, cpu);
+  }
+  // Workers launched later are pinned as well
+  ASSERT_OK(pool->SetCapacity(6));
+  for (int actual : run_on()) {
+    ASSERT_EQ(actual, cpu);
+  }
+
+  ASSERT_OK(pool->SetCpuAffinity({}));
+  ASSERT_RAISES(Invalid, pool->SetCpuAffinity({-1}));
+  ASSERT_OK(pool->Shutdown());
+}
+#endif
+
+TEST_F(TestThreadPool, MakeForNumaNode) {
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::MakeForNumaNode(2, GetCurrentNumaNode()));
+  ASSERT_EQ(pool->GetCapacity(), 2);
+  ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit([] { return 42; }));
+  ASSERT_OK_AND_EQ(42, fut.result());
+  ASSERT_OK(pool->Shutdown());
+
+  ASSERT_RAISES(Invalid, ThreadPool::MakeForNumaNode(2, GetNumaNodeCount()));
+}
+
 TEST(TestGlobalThreadPool, Capacity) {
   // Sanity check
   auto pool = GetCpuThreadPool();
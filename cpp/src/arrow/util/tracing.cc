@@ -0,0 +1,163 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/tracing.h"
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <sstream>
+#include <utility>
+
+namespace arrow {
+namespace util {
+
+namespace internal {
+
+std::atomic<bool> tracing_enabled{false};
+
+int64_t TraceNowNanos() {
+  static const auto epoch = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - epoch)
+      .count();
+}
+
+}  // namespace internal
+
+namespace {
+
+// The recorded events.  Spans are coarse (a page, a batch, a request), so a
+// mutex is cheap enough compared to the work being traced.
+struct TraceBuffer {
+  std::mutex mutex;
+  std::vector<TraceEvent> events;
+  size_t capacity = 0;
+  // The slot written next, once the buffer is full
+  size_t next = 0;
+};
+
+TraceBuffer* GetTraceBuffer() {
+  static TraceBuffer buffer;
+  return &buffer;
+}
+
+int64_t CurrentThreadId() {
+  static std::atomic<int64_t> next_id{0};
+  static thread_local const int64_t id = next_id++;
+  return id;
+}
+
+void AppendJsonString(const std::string& s, std::ostream* out) {
+  *out << '"';
+  for (const char c : s) {
+    switch (c) {
+      case '"':
+        *out << "\\\"";
+        break;
+      case '\\':
+        *out << "\\\\";
+        break;
+      case '\n':
+        *out << "\\n";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          *out << ' ';
+        } else {
+          *out << c;
+        }
+    }
+  }
+  *out << '"';
+}
+
+}  // namespace
+
+void StartTracing(int64_t capacity) {
+  TraceBuffer* buffer = GetTraceBuffer();
+  {
+    std::lock_guard<std::mutex> lock(buffer->mutex);
+    buffer->events.clear();
+    buffer->capacity = static_cast<size_t>(std::max<int64_t>(capacity, 1));
+    buffer->next = 0;
+  }
+  // Set up the clock's epoch
+  internal::TraceNowNanos();
+  internal::tracing_enabled.store(true);
+}
+
+void StopTracing() { internal::tracing_enabled.store(false); }
+
+std::vector<TraceEvent> GetTraceEvents() {
+  TraceBuffer* buffer = GetTraceBuffer();
+  std::lock_guard<std::mutex> lock(buffer->mutex);
+  // Rotate the ring so that the oldest event comes first
+  std::vector<TraceEvent> events(buffer->events.begin() + buffer->next,
+                                 buffer->events.end());
+  events.insert(events.end(), buffer->events.begin(),
+                buffer->events.begin() + buffer->next);
+  return events;
+}
+
+std::string TraceEventsToChromeJson(const std::vector<TraceEvent>& events) {
+  std::stringstream ss;
+  ss << "{\"traceEvents\":[";
+  bool first = true;
+  for (const auto& event : events) {
+    if (!first) {
+      ss << ",";
+    }
+    first = false;
+    // Complete ("X") events, with timestamps in microseconds
+    ss << "\n{\"ph\":\"X\",\"pid\":0,\"tid\":" << event.thread_id << ",\"cat\":";
+    AppendJsonString(event.category, &ss);
+    ss << ",\"name\":";
+    AppendJsonString(event.name, &ss);
+    ss << ",\"ts\":" << static_cast<double>(event.start_ns) / 1000
+       << ",\"dur\":" << static_cast<double>(event.duration_ns) / 1000;
+    if (event.bytes > 0) {
+      ss << ",\"args\":{\"bytes\":" << event.bytes << "}";
+    }
+    ss << "}";
+  }
+  ss << "\n],\"displayTimeUnit\":\"ns\"}\n";
+  return ss.str();
+}
+
+void TraceSpan::Record() {
+  TraceEvent event{category_,
+                   name_,
+                   start_ns_,
+                   internal::TraceNowNanos() - start_ns_,
+                   CurrentThreadId(),
+                   bytes_};
+  TraceBuffer* buffer = GetTraceBuffer();
+  std::lock_guard<std::mutex> lock(buffer->mutex);
+  if (buffer->capacity == 0) {
+    return;
+  }
+  if (buffer->events.size() < buffer->capacity) {
+    buffer->events.push_back(std::move(event));
+  } else {
+    buffer->events[buffer->next] = std::move(event);
+    buffer->next = (buffer->next + 1) % buffer->capacity;
+  }
+}
+
+}  // namespace util
+}  // namespace arrow
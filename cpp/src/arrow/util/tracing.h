@@ -0,0 +1,121 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// EXPERIMENTAL in-process tracing of the time spent in scans, I/O,
+// decompression, decoding and compute kernels.
+//
+// Tracing is disabled by default, in which case a TraceSpan costs a relaxed
+// atomic load.  Once enabled, completed spans are recorded in a bounded ring
+// buffer (the oldest events being overwritten), from which they can be
+// exported in the Chrome trace event format, to be viewed with
+// chrome://tracing or https://ui.perfetto.dev.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace util {
+
+namespace internal {
+
+ARROW_EXPORT extern std::atomic<bool> tracing_enabled;
+
+// Nanoseconds on a monotonic clock, since the first call
+ARROW_EXPORT int64_t TraceNowNanos();
+
+}  // namespace internal
+
+/// \brief A completed span
+struct ARROW_EXPORT TraceEvent {
+  /// The subsystem, e.g. "io", "parquet", "dataset" or "compute"
+  std::string category;
+  std::string name;
+  /// Start time in nanoseconds, since the first use of the tracing clock
+  int64_t start_ns;
+  int64_t duration_ns;
+  /// A small integer identifying the thread which recorded the span
+  int64_t thread_id;
+  /// The number of bytes processed in the span, if any (0 otherwise)
+  int64_t bytes;
+};
+
+/// The default number of events kept by StartTracing()
+constexpr int64_t kDefaultTraceCapacity = 1 << 16;
+
+/// \brief Start recording spans, discarding previously recorded events
+///
+/// At most `capacity` events are kept, the most recent ones.
+ARROW_EXPORT void StartTracing(int64_t capacity = kDefaultTraceCapacity);
+
+/// \brief Stop recording spans.  The recorded events are kept.
+ARROW_EXPORT void StopTracing();
+
+/// \brief Return whether spans are being recorded
+inline bool IsTracingEnabled() {
+  return internal::tracing_enabled.load(std::memory_order_relaxed);
+}
+
+/// \brief Return the recorded events, in completion order
+ARROW_EXPORT std::vector<TraceEvent> GetTraceEvents();
+
+/// \brief Format events as a Chrome trace event JSON document
+ARROW_EXPORT std::string TraceEventsToChromeJson(const std::vector<TraceEvent>& events);
+
+/// \brief A scope whose duration is recorded when tracing is enabled
+///
+/// The span ends when End() is called or the TraceSpan is destroyed.  The
+/// category and name are only copied when the span is recorded, so they
+/// must outlive the TraceSpan.  Spans nest naturally when viewed per thread.
+class ARROW_EXPORT TraceSpan {
+ public:
+  TraceSpan(const char* category, const char* name)
+      : category_(category),
+        name_(name),
+        start_ns_(IsTracingEnabled() ? internal::TraceNowNanos() : -1) {}
+
+  ~TraceSpan() { End(); }
+
+  /// \brief Account for bytes read, decompressed or decoded in the span
+  void AddBytes(int64_t nbytes) { bytes_ += nbytes; }
+
+  void End() {
+    if (start_ns_ >= 0) {
+      Record();
+      start_ns_ = -1;
+    }
+  }
+
+ private:
+  ARROW_DISALLOW_COPY_AND_ASSIGN(TraceSpan);
+
+  void Record();
+
+  const char* category_;
+  const char* name_;
+  int64_t start_ns_;
+  int64_t bytes_ = 0;
+};
+
+}  // namespace util
+}  // namespace arrow
@@ -0,0 +1,103 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/tracing.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace arrow {
+namespace util {
+
+TEST(Tracing, Disabled) {
+  StopTracing();
+  ASSERT_FALSE(IsTracingEnabled());
+  StartTracing();
+  StopTracing();
+  {
+    TraceSpan span("test", "disabled");
+    span.AddBytes(10);
+  }
+  ASSERT_EQ(GetTraceEvents().size(), 0u);
+}
+
+TEST(Tracing, Spans) {
+  StartTracing();
+  ASSERT_TRUE(IsTracingEnabled());
+  {
+    TraceSpan outer("test", "outer");
+    {
+      TraceSpan inner("test", "inner");
+      inner.AddBytes(42);
+    }
+    std::thread([] { TraceSpan span("test", "other thread"); }).join();
+  }
+  StopTracing();
+
+  auto events = GetTraceEvents();
+  ASSERT_EQ(events.size(), 3u);
+  ASSERT_EQ(events[0].name, "inner");
+  ASSERT_EQ(events[0].bytes, 42);
+  ASSERT_EQ(events[1].name, "other thread");
+  ASSERT_EQ(events[2].name, "outer");
+  ASSERT_EQ(events[2].category, "test");
+  ASSERT_EQ(events[2].bytes, 0);
+  // The outer span encloses the others
+  ASSERT_LE(events[2].start_ns, events[0].start_ns);
+  ASSERT_GE(events[2].start_ns + events[2].duration_ns,
+            events[0].start_ns + events[0].duration_ns);
+  ASSERT_EQ(events[0].thread_id, events[2].thread_id);
+  ASSERT_NE(events[1].thread_id, events[2].thread_id);
+
+  // Starting again discards the events
+  StartTracing();
+  StopTracing();
+  ASSERT_EQ(GetTraceEvents().size(), 0u);
+}
+
+TEST(Tracing, Ring) {
+  StartTracing(/*capacity=*/3);
+  const std::vector<std::string> names = {"a", "b", "c", "d", "e"};
+  for (const auto& name : names) {
+    TraceSpan span("test", name.c_str());
+  }
+  StopTracing();
+
+  auto events = GetTraceEvents();
+  ASSERT_EQ(events.size(), 3u);
+  ASSERT_EQ(events[0].name, "c");
+  ASSERT_EQ(events[1].name, "d");
+  ASSERT_EQ(events[2].name, "e");
+}
+
+TEST(Tracing, ChromeJson) {
+  std::vector<TraceEvent> events = {{"io", "read \"x\"", 1500, 2000, 1, 100},
+                                    {"compute", "sum", 3000, 500, 2, 0}};
+  ASSERT_EQ(TraceEventsToChromeJson(events),
+            "{\"traceEvents\":[\n"
+            "{\"ph\":\"X\",\"pid\":0,\"tid\":1,\"cat\":\"io\",\"name\":"
+            "\"read \\\"x\\\"\",\"ts\":1.5,\"dur\":2,\"args\":{\"bytes\":100}},\n"
+            "{\"ph\":\"X\",\"pid\":0,\"tid\":2,\"cat\":\"compute\",\"name\":\"sum\","
+            "\"ts\":3,\"dur\":0.5}\n"
+            "],\"displayTimeUnit\":\"ns\"}\n");
+}
+
+}  // namespace util
+}  // namespace arrow
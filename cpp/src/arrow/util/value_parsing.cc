@@ -17,6 +17,7 @@
 
 #include "arrow/util/value_parsing.h"
 
+#include <cfloat>
 #include <string>
 #include <utility>
 
@@ -51,9 +52,121 @@ static const StringToFloatConverterImpl g_string_to_float;
 constexpr double StringToFloatConverterImpl::main_junk_value_;
 constexpr double StringToFloatConverterImpl::fallback_junk_value_;
 
+// Properties of the floating-point types for Clinger's fast path: integers up
+// to kMaxExactMantissa and powers of ten up to kMaxExactPower are exactly
+// representable, so a single (correctly rounded) multiplication or division
+// of the two gives the correctly rounded value of the decimal.
+template <typename T>
+struct FastPathTraits;
+
+template <>
+struct FastPathTraits<float> {
+  static constexpr uint64_t kMaxExactMantissa = uint64_t(1) << 24;
+  static constexpr int kMaxExactPower = 10;
+  static float Power(int exponent) {
+    static const float powers[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f,
+                                   1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+    return powers[exponent];
+  }
+};
+
+template <>
+struct FastPathTraits<double> {
+  static constexpr uint64_t kMaxExactMantissa = uint64_t(1) << 53;
+  static constexpr int kMaxExactPower = 22;
+  static double Power(int exponent) {
+    static const double powers[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                    1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                    1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    return powers[exponent];
+  }
+};
+
+// Parse plain decimals such as "-123.456e7" whose value can be computed
+// exactly as above.  Return false for anything else (including valid inputs
+// such as "inf" or long mantissas), which the caller defers to double-conversion.
+template <typename T>
+bool FastStringToFloat(const char* s, size_t length, T* out) {
+#if FLT_EVAL_METHOD == 0
+  using Traits = FastPathTraits<T>;
+  const char* end = s + length;
+  bool negative = false;
+  if (s != end && *s == '-') {
+    negative = true;
+    ++s;
+  }
+  uint64_t mantissa = 0;
+  int num_digits = 0;
+  const char* digits_start = s;
+  while (s != end && static_cast<uint8_t>(*s - '0') <= 9) {
+    mantissa = mantissa * 10 + static_cast<uint8_t>(*s - '0');
+    ++s;
+  }
+  num_digits = static_cast<int>(s - digits_start);
+  if (num_digits == 0) {
+    return false;
+  }
+  int exponent = 0;
+  if (s != end && *s == '.') {
+    ++s;
+    const char* fraction_start = s;
+    while (s != end && static_cast<uint8_t>(*s - '0') <= 9) {
+      mantissa = mantissa * 10 + static_cast<uint8_t>(*s - '0');
+      ++s;
+    }
+    const int num_fraction_digits = static_cast<int>(s - fraction_start);
+    if (num_fraction_digits == 0) {
+      return false;
+    }
+    num_digits += num_fraction_digits;
+    exponent = -num_fraction_digits;
+  }
+  // More than 19 digits may have overflowed the mantissa
+  if (num_digits > 19 || mantissa > Traits::kMaxExactMantissa) {
+    return false;
+  }
+  if (s != end && (*s == 'e' || *s == 'E')) {
+    ++s;
+    bool negative_exponent = false;
+    if (s != end && (*s == '-' || *s == '+')) {
+      negative_exponent = *s == '-';
+      ++s;
+    }
+    const char* exponent_start = s;
+    int explicit_exponent = 0;
+    while (s != end && static_cast<uint8_t>(*s - '0') <= 9 && s - exponent_start < 4) {
+      explicit_exponent = explicit_exponent * 10 + static_cast<uint8_t>(*s - '0');
+      ++s;
+    }
+    if (s == exponent_start) {
+      return false;
+    }
+    exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+  }
+  if (s != end || exponent < -Traits::kMaxExactPower ||
+      exponent > Traits::kMaxExactPower) {
+    return false;
+  }
+  T value = static_cast<T>(mantissa);
+  if (exponent < 0) {
+    value /= Traits::Power(-exponent);
+  } else {
+    value *= Traits::Power(exponent);
+  }
+  *out = negative ? -value : value;
+  return true;
+#else
+  // Extended precision intermediates would round twice
+  return false;
+#endif
+}
+
 }  // namespace
 
 bool StringToFloat(const char* s, size_t length, float* out) {
+  if (FastStringToFloat(s, length, out)) {
+    return true;
+  }
   int processed_length;
   float v;
   v = g_string_to_float.main_converter_.StringToFloat(s, static_cast<int>(length),
@@ -71,6 +184,9 @@ bool StringToFloat(const char* s, size_t length, float* out) {
 }
 
 bool StringToFloat(const char* s, size_t length, double* out) {
+  if (FastStringToFloat(s, length, out)) {
+    return true;
+  }
   int processed_length;
   double v;
   v = g_string_to_float.main_converter_.StringToDouble(s, static_cast<int>(length),
@@ -23,6 +23,7 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <string>
@@ -30,6 +31,7 @@
 
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/time.h"
@@ -155,6 +157,49 @@ struct StringConverter<DoubleType> {
 
 inline uint8_t ParseDecimalDigit(char c) { return static_cast<uint8_t>(c - '0'); }
 
+#if ARROW_LITTLE_ENDIAN
+#define ARROW_HAVE_SWAR_DIGITS 1
+
+// SWAR helpers working on 8 ASCII characters loaded in a uint64_t
+
+inline uint64_t LoadEightChars(const char* s) {
+  uint64_t chunk;
+  std::memcpy(&chunk, s, sizeof(chunk));
+  return chunk;
+}
+
+// Whether all 8 characters are decimal digits: a digit has 3 as its high
+// nibble, and still does after adding 6.  (Carries out of a byte can only
+// come from a byte which fails the check itself.)
+inline bool AreEightDigits(uint64_t chunk) {
+  return ((chunk & 0xF0F0F0F0F0F0F0F0ULL) |
+          (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+         0x3333333333333333ULL;
+}
+
+// Combine each digit byte with the next one: byte i of the result holds
+// the value of the two digits starting at byte i (for even i)
+inline uint64_t CombineDigitPairs(uint64_t digits) {
+  return digits * 10 + (digits >> 8);
+}
+
+// Parse 8 decimal digits at once, return false if any character is not a digit
+inline bool ParseEightDigits(const char* s, uint32_t* out) {
+  uint64_t chunk = LoadEightChars(s);
+  if (ARROW_PREDICT_FALSE(!AreEightDigits(chunk))) {
+    return false;
+  }
+  chunk = CombineDigitPairs(chunk - 0x3030303030303030ULL);
+  // Combine pairs into 4-digit groups, then the two groups
+  chunk = (((chunk & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+           (((chunk >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >>
+          32;
+  *out = static_cast<uint32_t>(chunk);
+  return true;
+}
+
+#endif
+
 #define PARSE_UNSIGNED_ITERATION(C_TYPE)          \
   if (length > 0) {                               \
     uint8_t digit = ParseDecimalDigit(*s++);      \
@@ -214,6 +259,27 @@ inline bool ParseUnsigned(const char* s, size_t length, uint16_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
+#ifdef ARROW_HAVE_SWAR_DIGITS
+  if (length >= 8) {
+    uint32_t high;
+    if (ARROW_PREDICT_FALSE(length > 10 || !ParseEightDigits(s, &high))) {
+      return false;
+    }
+    uint64_t wide_result = high;
+    for (size_t i = 8; i < length; ++i) {
+      const uint8_t digit = ParseDecimalDigit(s[i]);
+      if (ARROW_PREDICT_FALSE(digit > 9U)) {
+        return false;
+      }
+      wide_result = wide_result * 10U + digit;
+    }
+    if (ARROW_PREDICT_FALSE(wide_result > std::numeric_limits<uint32_t>::max())) {
+      return false;
+    }
+    *out = static_cast<uint32_t>(wide_result);
+    return true;
+  }
+#endif
   uint32_t result = 0;
 
   PARSE_UNSIGNED_ITERATION(uint32_t);
@@ -232,7 +298,56 @@ inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
   return true;
 }
 
+#ifdef ARROW_HAVE_SWAR_DIGITS
+// ParseUnsigned() for 8 digits or more
+inline bool ParseLongUnsigned(const char* s, size_t length, uint64_t* out) {
+  if (ARROW_PREDICT_FALSE(length > 20)) {
+    return false;
+  }
+  // Up to 19 digits cannot overflow; parse the leading ones one at a time,
+  // then the rest 8 at a time
+  const size_t safe_length = length < 20 ? length : 19;
+  const size_t head_length = safe_length % 8;
+  uint64_t result = 0;
+  for (size_t i = 0; i < head_length; ++i) {
+    const uint8_t digit = ParseDecimalDigit(s[i]);
+    if (ARROW_PREDICT_FALSE(digit > 9U)) {
+      return false;
+    }
+    result = result * 10U + digit;
+  }
+  for (size_t i = head_length; i < safe_length; i += 8) {
+    uint32_t eight_digits;
+    if (ARROW_PREDICT_FALSE(!ParseEightDigits(s + i, &eight_digits))) {
+      return false;
+    }
+    result = result * 100000000U + eight_digits;
+  }
+  if (length == 20) {
+    const uint8_t digit = ParseDecimalDigit(s[19]);
+    if (ARROW_PREDICT_FALSE(digit > 9U)) {
+      return false;
+    }
+    if (ARROW_PREDICT_FALSE(result > std::numeric_limits<uint64_t>::max() / 10U)) {
+      return false;
+    }
+    const uint64_t new_result = result * 10U + digit;
+    if (ARROW_PREDICT_FALSE(new_result < result * 10U)) {
+      return false;
+    }
+    result = new_result;
+  }
+  *out = result;
+  return true;
+}
+#endif
+
 inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
+#ifdef ARROW_HAVE_SWAR_DIGITS
+  if (length >= 8) {
+    return ParseLongUnsigned(s, length, out);
+  }
+#endif
   uint64_t result = 0;
 
   PARSE_UNSIGNED_ITERATION(uint64_t);
@@ -708,5 +823,33 @@ enable_if_parameter_free<T, bool> ParseValue(
   return StringConverter<T>::Convert(type, s, length, out);
 }
 
+/// \brief Parse a column of strings at once.
+///
+/// Value i is the string [data + offsets[i], data + offsets[i + 1]), as laid
+/// out in the buffers of a BinaryArray or LargeBinaryArray.  Parsing stops at
+/// the first invalid value; the number of values successfully parsed (`length`
+/// if all of them were) is returned.
+template <typename T, typename OffsetType>
+int64_t ParseValues(const T& type, const char* data, const OffsetType* offsets,
+                    int64_t length, typename StringConverter<T>::value_type* out) {
+  for (int64_t i = 0; i < length; ++i) {
+    const char* value = data + offsets[i];
+    const auto value_length = static_cast<size_t>(offsets[i + 1] - offsets[i]);
+    if (ARROW_PREDICT_FALSE(
+            !StringConverter<T>::Convert(type, value, value_length, out + i))) {
+      return i;
+    }
+  }
+  return length;
+}
+
+template <typename T, typename OffsetType>
+enable_if_parameter_free<T, int64_t> ParseValues(
+    const char* data, const OffsetType* offsets, int64_t length,
+    typename StringConverter<T>::value_type* out) {
+  static T type;
+  return ParseValues(type, data, offsets, length, out);
+}
+
 }  // namespace internal
 }  // namespace arrow
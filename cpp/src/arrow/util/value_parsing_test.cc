@@ -82,9 +82,22 @@ TEST(StringConversion, ToDouble) {
   // XXX ASSERT_EQ doesn't distinguish signed zeros
   AssertConversion<DoubleType>("-0.0", -0.0);
   AssertConversion<DoubleType>("-1e100", -1e100);
+  // Values which are exactly representable through the fast path...
+  AssertConversion<DoubleType>("123456789012345", 123456789012345.0);
+  AssertConversion<DoubleType>("-0.000123", -0.000123);
+  AssertConversion<DoubleType>("4.5e22", 4.5e22);
+  AssertConversion<DoubleType>("7E-22", 7e-22);
+  // ... and values which need the slow path
+  AssertConversion<DoubleType>("9007199254740993", 9007199254740992.0);
+  AssertConversion<DoubleType>("1.7976931348623157e308", 1.7976931348623157e308);
+  AssertConversion<DoubleType>("5e-324", 5e-324);
+  AssertConversion<DoubleType>("0.1234567890123456789", 0.1234567890123456789);
 
   AssertConversionFails<DoubleType>("");
   AssertConversionFails<DoubleType>("e");
+  AssertConversionFails<DoubleType>("1.5e");
+  AssertConversionFails<DoubleType>("1.5x");
+  AssertConversionFails<DoubleType>("--1");
 }
 
 #if !defined(_WIN32) || defined(NDEBUG)
@@ -201,6 +214,8 @@ TEST(StringConversion, ToUInt32) {
   AssertConversionFails<UInt32Type>("-1");
   AssertConversionFails<UInt32Type>("4294967296");
   AssertConversionFails<UInt32Type>("12345678901");
+  AssertConversionFails<UInt32Type>("9999999999");
+  AssertConversionFails<UInt32Type>("12345678:");
 
   AssertConversionFails<UInt32Type>("");
   AssertConversionFails<UInt32Type>("-");
@@ -214,10 +229,16 @@ TEST(StringConversion, ToInt64) {
   AssertConversion<Int64Type>("09223372036854775807", 9223372036854775807LL);
   AssertConversion<Int64Type>("-9223372036854775808", -9223372036854775807LL - 1);
   AssertConversion<Int64Type>("-009223372036854775808", -9223372036854775807LL - 1);
+  AssertConversion<Int64Type>("12345678", 12345678LL);
+  AssertConversion<Int64Type>("-1234567890123", -1234567890123LL);
+  AssertConversion<Int64Type>("1000000000000000000", 1000000000000000000LL);
 
   // Non-representable values
   AssertConversionFails<Int64Type>("9223372036854775808");
   AssertConversionFails<Int64Type>("-9223372036854775809");
+  AssertConversionFails<Int64Type>("100000000000000000000");
+  AssertConversionFails<Int64Type>("1234567a");
+  AssertConversionFails<Int64Type>("123456789012345x");
 
   AssertConversionFails<Int64Type>("");
   AssertConversionFails<Int64Type>("-");
@@ -228,10 +249,14 @@ TEST(StringConversion, ToInt64) {
 TEST(StringConversion, ToUInt64) {
   AssertConversion<UInt64Type>("0", 0);
   AssertConversion<UInt64Type>("18446744073709551615", 18446744073709551615ULL);
+  AssertConversion<UInt64Type>("10000000000000000000", 10000000000000000000ULL);
+  AssertConversion<UInt64Type>("0018446744073709551615", 18446744073709551615ULL);
 
   // Non-representable values
   AssertConversionFails<UInt64Type>("-1");
   AssertConversionFails<UInt64Type>("18446744073709551616");
+  AssertConversionFails<UInt64Type>("20000000000000000000");
+  AssertConversionFails<UInt64Type>("184467440737095516150");
 
   AssertConversionFails<UInt64Type>("");
   AssertConversionFails<UInt64Type>("-");
@@ -368,6 +393,26 @@ TEST(StringConversion, ToTimestampDateTime_ISO8601) {
   }
 }
 
+TEST(StringConversion, ParseValues) {
+  const std::string data = "1234567890123-4200";
+  const std::vector<int32_t> offsets = {0, 13, 15, 18};
+  std::vector<int64_t> out(3);
+  ASSERT_EQ(ParseValues<Int64Type>(data.data(), offsets.data(), 3, out.data()), 3);
+  ASSERT_EQ(out, std::vector<int64_t>({1234567890123LL, -4, 200}));
+
+  // Parsing stops at the first invalid value
+  const std::vector<int32_t> bad_offsets = {0, 13, 14, 18};
+  ASSERT_EQ(ParseValues<Int64Type>(data.data(), bad_offsets.data(), 3, out.data()), 1);
+
+  TimestampType type(TimeUnit::SECOND);
+  const std::string timestamps = "1970-01-01 00:00:012018-11-13";
+  const std::vector<int64_t> timestamp_offsets = {0, 19, 29};
+  ASSERT_EQ(ParseValues(type, timestamps.data(), timestamp_offsets.data(), 2, out.data()),
+            2);
+  ASSERT_EQ(out[0], 1);
+  ASSERT_EQ(out[1], 1542067200LL);
+}
+
 TEST(TimestampParser, StrptimeParser) {
   std::string format = "%m/%d/%Y %H:%M:%S";
   auto parser = TimestampParser::MakeStrptime(format);
@@ -66,6 +66,9 @@ ARRAY_VISITOR_DEFAULT(StructArray)
 ARRAY_VISITOR_DEFAULT(SparseUnionArray)
 ARRAY_VISITOR_DEFAULT(DenseUnionArray)
 ARRAY_VISITOR_DEFAULT(DictionaryArray)
+ARRAY_VISITOR_DEFAULT(RunEndEncodedArray)
+ARRAY_VISITOR_DEFAULT(BinaryViewArray)
+ARRAY_VISITOR_DEFAULT(StringViewArray)
 ARRAY_VISITOR_DEFAULT(Decimal128Array)
 ARRAY_VISITOR_DEFAULT(ExtensionArray)
 
@@ -114,6 +117,9 @@ TYPE_VISITOR_DEFAULT(StructType)
 TYPE_VISITOR_DEFAULT(SparseUnionType)
 TYPE_VISITOR_DEFAULT(DenseUnionType)
 TYPE_VISITOR_DEFAULT(DictionaryType)
+TYPE_VISITOR_DEFAULT(RunEndEncodedType)
+TYPE_VISITOR_DEFAULT(BinaryViewType)
+TYPE_VISITOR_DEFAULT(StringViewType)
 TYPE_VISITOR_DEFAULT(ExtensionType)
 
 #undef TYPE_VISITOR_DEFAULT
@@ -160,6 +166,9 @@ SCALAR_VISITOR_DEFAULT(MapScalar)
 SCALAR_VISITOR_DEFAULT(FixedSizeListScalar)
 SCALAR_VISITOR_DEFAULT(StructScalar)
 SCALAR_VISITOR_DEFAULT(DictionaryScalar)
+SCALAR_VISITOR_DEFAULT(RunEndEncodedScalar)
+SCALAR_VISITOR_DEFAULT(BinaryViewScalar)
+SCALAR_VISITOR_DEFAULT(StringViewScalar)
 
 #undef SCALAR_VISITOR_DEFAULT
 
@@ -62,6 +62,9 @@ class ARROW_EXPORT ArrayVisitor {
   virtual Status Visit(const SparseUnionArray& array);
   virtual Status Visit(const DenseUnionArray& array);
   virtual Status Visit(const DictionaryArray& array);
+  virtual Status Visit(const RunEndEncodedArray& array);
+  virtual Status Visit(const BinaryViewArray& array);
+  virtual Status Visit(const StringViewArray& array);
   virtual Status Visit(const ExtensionArray& array);
 };
 
@@ -104,6 +107,9 @@ class ARROW_EXPORT TypeVisitor {
   virtual Status Visit(const SparseUnionType& type);
   virtual Status Visit(const DenseUnionType& type);
   virtual Status Visit(const DictionaryType& type);
+  virtual Status Visit(const RunEndEncodedType& type);
+  virtual Status Visit(const BinaryViewType& type);
+  virtual Status Visit(const StringViewType& type);
   virtual Status Visit(const ExtensionType& type);
 };
 
@@ -144,6 +150,9 @@ class ARROW_EXPORT ScalarVisitor {
   virtual Status Visit(const FixedSizeListScalar& scalar);
   virtual Status Visit(const StructScalar& scalar);
   virtual Status Visit(const DictionaryScalar& scalar);
+  virtual Status Visit(const RunEndEncodedScalar& scalar);
+  virtual Status Visit(const BinaryViewScalar& scalar);
+  virtual Status Visit(const StringViewScalar& scalar);
 };
 
 }  // namespace arrow
@@ -76,6 +76,9 @@ namespace arrow {
   ACTION(SparseUnion);                          \
   ACTION(DenseUnion);                           \
   ACTION(Dictionary);                           \
+  ACTION(RunEndEncoded);                        \
+  ACTION(BinaryView);                           \
+  ACTION(StringView);                           \
   ACTION(Extension)
 
 #define TYPE_VISIT_INLINE(TYPE_CLASS) \
@@ -249,6 +252,41 @@ struct ArrayDataInlineVisitor<T, enable_if_base_binary<T>> {
   }
 };
 
+// BinaryView, StringView
+template <typename T>
+struct ArrayDataInlineVisitor<T, enable_if_binary_view<T>> {
+  using c_type = util::string_view;
+
+  template <typename ValidFunc, typename NullFunc>
+  static Status VisitStatus(const ArrayData& arr, ValidFunc&& valid_func,
+                            NullFunc&& null_func) {
+    const BinaryViewType::c_type* views = arr.GetValues<BinaryViewType::c_type>(1);
+    return VisitBitBlocks(
+        arr.buffers[0], arr.offset, arr.length,
+        [&](int64_t i) { return valid_func(GetView(arr, views[i])); },
+        [&]() { return null_func(); });
+  }
+
+  template <typename ValidFunc, typename NullFunc>
+  static void VisitVoid(const ArrayData& arr, ValidFunc&& valid_func,
+                        NullFunc&& null_func) {
+    const BinaryViewType::c_type* views = arr.GetValues<BinaryViewType::c_type>(1);
+    VisitBitBlocksVoid(
+        arr.buffers[0], arr.offset, arr.length,
+        [&](int64_t i) { valid_func(GetView(arr, views[i])); },
+        [&]() { null_func(); });
+  }
+
+ private:
+  static util::string_view GetView(const ArrayData& arr,
+                                   const BinaryViewType::c_type& view) {
+    const uint8_t* data =
+        view.is_inline() ? view.inline_data()
+                         : arr.buffers[view.buffer_index + 2]->data() + view.offset;
+    return util::string_view(reinterpret_cast<const char*>(data), view.size);
+  }
+};
+
 // FixedSizeBinary, Decimal128
 template <typename T>
 struct ArrayDataInlineVisitor<T, enable_if_fixed_size_binary<T>> {
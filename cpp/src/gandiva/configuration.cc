@@ -17,17 +17,38 @@
 
 #include "gandiva/configuration.h"
 
+#include "arrow/result.h"
+#include "arrow/util/hash_util.h"
+#include "arrow/util/io_util.h"
+
 namespace gandiva {
 
 const std::shared_ptr<Configuration> ConfigurationBuilder::default_configuration_ =
     InitDefaultConfig();
 
+std::shared_ptr<Configuration> ConfigurationBuilder::InitDefaultConfig() {
+  std::shared_ptr<Configuration> configuration(new Configuration());
+  auto object_cache_dir = arrow::internal::GetEnvVar("GANDIVA_OBJECT_CACHE_DIR");
+  if (object_cache_dir.ok()) {
+    configuration->set_object_cache_dir(object_cache_dir.MoveValueUnsafe());
+  }
+  return configuration;
+}
+
 std::size_t Configuration::Hash() const {
-  return 0;  // dummy for now, no configuration properties yet
+  static const int kSeedValue = 4;
+  size_t result = kSeedValue;
+  arrow::internal::hash_combine(result, optimize_);
+  arrow::internal::hash_combine(result, object_cache_dir_);
+  arrow::internal::hash_combine(result, parallel_compilation_);
+  arrow::internal::hash_combine(result, parallel_evaluation_);
+  return result;
 }
 
 bool Configuration::operator==(const Configuration& other) const {
-  return true;  // always true, no configuration properties yet
+  return optimize_ == other.optimize_ && object_cache_dir_ == other.object_cache_dir_ &&
+         parallel_compilation_ == other.parallel_compilation_ &&
+         parallel_evaluation_ == other.parallel_evaluation_;
 }
 
 bool Configuration::operator!=(const Configuration& other) const {
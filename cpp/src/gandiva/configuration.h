@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "arrow/status.h"
 
@@ -37,6 +38,8 @@ class GANDIVA_EXPORT Configuration {
 
   Configuration() : optimize_(true) {}
   explicit Configuration(bool optimize) : optimize_(optimize) {}
+  Configuration(bool optimize, std::string object_cache_dir)
+      : optimize_(optimize), object_cache_dir_(std::move(object_cache_dir)) {}
 
   std::size_t Hash() const;
   bool operator==(const Configuration& other) const;
@@ -45,8 +48,35 @@ class GANDIVA_EXPORT Configuration {
   bool optimize() const { return optimize_; }
   void set_optimize(bool optimize) { optimize_ = optimize; }
 
+  /// Directory in which the object code of compiled modules is stored, so that
+  /// later processes load it instead of compiling again.  Disabled if empty.
+  ///
+  /// The default configuration takes it from the GANDIVA_OBJECT_CACHE_DIR
+  /// environment variable.
+  const std::string& object_cache_dir() const { return object_cache_dir_; }
+  void set_object_cache_dir(std::string object_cache_dir) {
+    object_cache_dir_ = std::move(object_cache_dir);
+  }
+
+  /// Whether the expressions of large projectors may be split into several
+  /// modules, compiled on concurrent threads.
+  bool parallel_compilation() const { return parallel_compilation_; }
+  void set_parallel_compilation(bool parallel_compilation) {
+    parallel_compilation_ = parallel_compilation;
+  }
+
+  /// Whether the projectors of large record batches may evaluate row ranges of
+  /// the batch on concurrent threads of the Arrow CPU thread pool.
+  bool parallel_evaluation() const { return parallel_evaluation_; }
+  void set_parallel_evaluation(bool parallel_evaluation) {
+    parallel_evaluation_ = parallel_evaluation;
+  }
+
  private:
   bool optimize_;
+  std::string object_cache_dir_;
+  bool parallel_compilation_ = true;
+  bool parallel_evaluation_ = false;
 };
 
 /// \brief configuration builder for gandiva
@@ -65,15 +95,18 @@ class GANDIVA_EXPORT ConfigurationBuilder {
     return configuration;
   }
 
+  std::shared_ptr<Configuration> build(bool optimize, std::string object_cache_dir) {
+    std::shared_ptr<Configuration> configuration(
+        new Configuration(optimize, std::move(object_cache_dir)));
+    return configuration;
+  }
+
   static std::shared_ptr<Configuration> DefaultConfiguration() {
     return default_configuration_;
   }
 
  private:
-  static std::shared_ptr<Configuration> InitDefaultConfig() {
-    std::shared_ptr<Configuration> configuration(new Configuration());
-    return configuration;
-  }
+  static std::shared_ptr<Configuration> InitDefaultConfig();
 
   static const std::shared_ptr<Configuration> default_configuration_;
 };
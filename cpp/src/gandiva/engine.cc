@@ -23,6 +23,7 @@
 
 #include "gandiva/engine.h"
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <mutex>
@@ -30,6 +31,7 @@
 #include <string>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #if defined(_MSC_VER)
 #pragma warning(push)
@@ -43,6 +45,7 @@
 #include <llvm/Analysis/Passes.h>
 #include <llvm/Analysis/TargetTransformInfo.h>
 #include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Config/llvm-config.h>
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
 #include <llvm/ExecutionEngine/MCJIT.h>
 #include <llvm/IR/DataLayout.h>
@@ -53,6 +56,7 @@
 #include <llvm/Linker/Linker.h>
 #include <llvm/MC/SubtargetFeature.h>
 #include <llvm/Support/DynamicLibrary.h>
+#include <llvm/Support/Host.h>
 #include <llvm/Support/TargetRegistry.h>
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Support/raw_ostream.h>
@@ -72,6 +76,8 @@
 #include "gandiva/decimal_ir.h"
 #include "gandiva/exported_funcs_registry.h"
 
+#include "arrow/util/config.h"
+#include "arrow/util/hashing.h"
 #include "arrow/util/make_unique.h"
 
 namespace gandiva {
@@ -102,7 +108,8 @@ Engine::Engine(const std::shared_ptr<Configuration>& conf,
       ir_builder_(arrow::internal::make_unique<llvm::IRBuilder<>>(*context_)),
       module_(module),
       types_(*context_),
-      optimize_(conf->optimize()) {}
+      optimize_(conf->optimize()),
+      object_cache_dir_(conf->object_cache_dir()) {}
 
 Status Engine::Init() {
   // Add mappings for functions that can be accessed from LLVM/IR module.
@@ -249,11 +256,59 @@ Status Engine::RemoveUnusedFunctions() {
   return Status::OK();
 }
 
+std::string Engine::ObjectCacheKey() {
+  static const uint64_t precompiled_hash = arrow::internal::ComputeStringHash<0>(
+      kPrecompiledBitcode, static_cast<int64_t>(kPrecompiledBitcodeSize));
+
+  std::vector<std::string> features;
+  llvm::StringMap<bool> host_features;
+  if (llvm::sys::getHostCPUFeatures(host_features)) {
+    for (auto& f : host_features) {
+      features.push_back((f.second ? "+" : "-") + f.first().str());
+    }
+  }
+  std::sort(features.begin(), features.end());
+
+  std::stringstream ss;
+  ss << "arrow " << ARROW_VERSION_STRING << ", llvm " << LLVM_VERSION_STRING << "\n";
+  ss << "precompiled " << precompiled_hash << ", optimize " << optimize_ << "\n";
+  ss << llvm::sys::getProcessTriple() << " " << llvm::sys::getHostCPUName().str();
+  for (const auto& feature : features) {
+    ss << " " << feature;
+  }
+  ss << "\n" << DumpIR();
+  return ss.str();
+}
+
+int Engine::VectorRegisterBits() {
+  static const int bits = [] {
+    llvm::StringMap<bool> host_features;
+    if (!llvm::sys::getHostCPUFeatures(host_features)) {
+      return 128;
+    }
+    // Like LLVM on AVX-512 hosts, prefer 256-bit vectors, which don't lower the
+    // clock frequency
+    if (host_features.lookup("avx2") || host_features.lookup("avx")) {
+      return 256;
+    }
+    return 128;
+  }();
+  return bits;
+}
+
 // Optimise and compile the module.
 Status Engine::FinalizeModule() {
   ARROW_RETURN_NOT_OK(RemoveUnusedFunctions());
 
-  if (optimize_) {
+  if (!object_cache_dir_.empty() && !process_specific_) {
+    object_cache_ = arrow::internal::make_unique<PersistentObjectCache>(
+        object_cache_dir_, ObjectCacheKey());
+    loaded_from_object_cache_ = object_cache_->Load();
+    execution_engine_->setObjectCache(object_cache_.get());
+  }
+
+  // The cached object code was compiled from the optimised module
+  if (optimize_ && !loaded_from_object_cache_) {
     // misc passes to allow for inlining, vectorization, ..
     std::unique_ptr<llvm::legacy::PassManager> pass_manager(
         new llvm::legacy::PassManager());
@@ -278,10 +333,11 @@ Status Engine::FinalizeModule() {
     pass_manager->run(*module_);
   }
 
-  ARROW_RETURN_IF(llvm::verifyModule(*module_, &llvm::errs()),
-                  Status::CodeGenError("Module verification failed after optimizer"));
+  ARROW_RETURN_IF(
+      !loaded_from_object_cache_ && llvm::verifyModule(*module_, &llvm::errs()),
+      Status::CodeGenError("Module verification failed after optimizer"));
 
-  // do the compilation
+  // do the compilation, or load the cached object code
   execution_engine_->finalizeObject();
   module_finalized_ = true;
 
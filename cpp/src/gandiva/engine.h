@@ -28,6 +28,7 @@
 #include "gandiva/configuration.h"
 #include "gandiva/llvm_includes.h"
 #include "gandiva/llvm_types.h"
+#include "gandiva/persistent_object_cache.h"
 #include "gandiva/visibility.h"
 
 namespace gandiva {
@@ -54,9 +55,20 @@ class GANDIVA_EXPORT Engine {
     functions_to_compile_.push_back(fname);
   }
 
-  /// Optimise and compile the module.
+  /// Note that the module embeds addresses in this process, e.g. of literals or
+  /// function holders, so that its object code can't be reused by other processes.
+  void MarkProcessSpecific() { process_specific_ = true; }
+
+  /// Optimise and compile the module, unless its object code is found in the
+  /// object cache directory of the configuration.
   Status FinalizeModule();
 
+  /// Whether FinalizeModule() loaded the object code from the object cache.
+  bool loaded_from_object_cache() const { return loaded_from_object_cache_; }
+
+  /// Width in bits of the vector registers loops are vectorized for on this host.
+  static int VectorRegisterBits();
+
   /// Get the compiled function corresponding to the irfunction.
   void* CompiledFunction(llvm::Function* irFunction);
 
@@ -89,6 +101,12 @@ class GANDIVA_EXPORT Engine {
   // Remove unused functions to reduce compile time.
   Status RemoveUnusedFunctions();
 
+  // Identify the object code of the module: its IR, the configuration, the
+  // precompiled functions and the host CPU.
+  std::string ObjectCacheKey();
+
+  // Must outlive the execution engine
+  std::unique_ptr<PersistentObjectCache> object_cache_;
   std::unique_ptr<llvm::LLVMContext> context_;
   std::unique_ptr<llvm::ExecutionEngine> execution_engine_;
   std::unique_ptr<llvm::IRBuilder<>> ir_builder_;
@@ -98,7 +116,10 @@ class GANDIVA_EXPORT Engine {
   std::vector<std::string> functions_to_compile_;
 
   bool optimize_ = true;
+  std::string object_cache_dir_;
+  bool process_specific_ = false;
   bool module_finalized_ = false;
+  bool loaded_from_object_cache_ = false;
 };
 
 }  // namespace gandiva
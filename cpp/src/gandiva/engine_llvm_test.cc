@@ -19,6 +19,7 @@
 
 #include <gtest/gtest.h>
 #include <functional>
+#include "arrow/util/io_util.h"
 #include "gandiva/llvm_types.h"
 #include "gandiva/tests/test_util.h"
 
@@ -128,4 +129,34 @@ TEST_F(TestEngine, TestAddOptimised) {
   EXPECT_EQ(add_func(my_array, 5), 17);
 }
 
+TEST_F(TestEngine, TestObjectCache) {
+  ASSERT_OK_AND_ASSIGN(auto temp_dir,
+                       arrow::internal::TemporaryDir::Make("gandiva-object-cache-"));
+  auto config =
+      ConfigurationBuilder().build(true, temp_dir->path().ToString() + "objects");
+
+  int64_t my_array[] = {1, 3, -5, 8, 10};
+  for (bool expect_loaded : {false, true}) {
+    ASSERT_OK(Engine::Make(config, &engine));
+    llvm::Function* ir_func = BuildVecAdd(engine.get());
+    ASSERT_OK(engine->FinalizeModule());
+    ASSERT_EQ(engine->loaded_from_object_cache(), expect_loaded);
+    auto add_func =
+        reinterpret_cast<add_vector_func_t>(engine->CompiledFunction(ir_func));
+    EXPECT_EQ(add_func(my_array, 5), 17);
+  }
+
+  // Modules referring to memory of the process aren't cached
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_OK(Engine::Make(config, &engine));
+    llvm::Function* ir_func = BuildVecAdd(engine.get());
+    engine->MarkProcessSpecific();
+    ASSERT_OK(engine->FinalizeModule());
+    ASSERT_FALSE(engine->loaded_from_object_cache());
+    auto add_func =
+        reinterpret_cast<add_vector_func_t>(engine->CompiledFunction(ir_func));
+    EXPECT_EQ(add_func(my_array, 5), 17);
+  }
+}
+
 }  // namespace gandiva
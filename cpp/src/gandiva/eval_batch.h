@@ -18,6 +18,7 @@
 #pragma once
 
 #include <memory>
+#include <utility>
 
 #include "arrow/util/logging.h"
 
@@ -83,6 +84,15 @@ class EvalBatch {
 
   ExecutionContext* GetExecutionContext() const { return execution_context_.get(); }
 
+  /// Replace the execution context, e.g. by one retained from previous batches.
+  void SetExecutionContext(std::unique_ptr<ExecutionContext> execution_context) {
+    execution_context_ = std::move(execution_context);
+  }
+
+  std::unique_ptr<ExecutionContext> ReleaseExecutionContext() {
+    return std::move(execution_context_);
+  }
+
  private:
   /// number of records in the current batch.
   int64_t num_records_;
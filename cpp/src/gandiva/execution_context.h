@@ -46,6 +46,12 @@ class ExecutionContext {
     arena_.Reset();
   }
 
+  /// Reset for another batch, keeping the memory of the arena.
+  void Recycle() {
+    error_msg_.clear();
+    arena_.Recycle();
+  }
+
  private:
   std::string error_msg_;
   SimpleArena arena_;
@@ -0,0 +1,112 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/filter_projector.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
+#include "arrow/record_batch.h"
+
+namespace gandiva {
+
+constexpr int64_t FilterProjector::kChunkSize;
+
+FilterProjector::FilterProjector(std::shared_ptr<Filter> filter,
+                                 std::shared_ptr<Projector> projector, SchemaPtr schema,
+                                 FieldVector output_fields)
+    : filter_(std::move(filter)),
+      projector_(std::move(projector)),
+      schema_(std::move(schema)),
+      output_fields_(std::move(output_fields)) {}
+
+Status FilterProjector::Make(SchemaPtr schema, ConditionPtr condition,
+                             const ExpressionVector& exprs,
+                             std::shared_ptr<Configuration> configuration,
+                             std::shared_ptr<FilterProjector>* filter_projector) {
+  // Both are cached, and validate their arguments
+  std::shared_ptr<Filter> filter;
+  ARROW_RETURN_NOT_OK(Filter::Make(schema, condition, configuration, &filter));
+
+  // Chunks are small enough for 16-bit selection vectors
+  static_assert(kChunkSize <= 65536, "chunks must be addressable by uint16 indices");
+  std::shared_ptr<Projector> projector;
+  ARROW_RETURN_NOT_OK(Projector::Make(schema, exprs, SelectionVector::MODE_UINT16,
+                                      configuration, &projector));
+
+  FieldVector output_fields;
+  output_fields.reserve(exprs.size());
+  for (auto& expr : exprs) {
+    output_fields.push_back(expr->result());
+  }
+
+  *filter_projector = std::shared_ptr<FilterProjector>(new FilterProjector(
+      std::move(filter), std::move(projector), schema, std::move(output_fields)));
+  return Status::OK();
+}
+
+Status FilterProjector::Evaluate(const arrow::RecordBatch& batch,
+                                 arrow::MemoryPool* pool, arrow::ArrayVector* output) {
+  ARROW_RETURN_IF(!batch.schema()->Equals(*schema_),
+                  Status::Invalid("Schema in RecordBatch must match schema in Make()"));
+  ARROW_RETURN_IF(batch.num_rows() == 0,
+                  Status::Invalid("RecordBatch must be non-empty."));
+  ARROW_RETURN_IF(output == nullptr, Status::Invalid("Output must be non-null."));
+  ARROW_RETURN_IF(pool == nullptr, Status::Invalid("Memory pool must be non-null."));
+
+  const int64_t num_rows = batch.num_rows();
+  std::shared_ptr<SelectionVector> selection;
+  ARROW_RETURN_NOT_OK(SelectionVector::MakeInt16(std::min(num_rows, kChunkSize), pool,
+                                                 &selection));
+
+  // The projected chunks of each output field
+  std::vector<arrow::ArrayVector> chunks(output_fields_.size());
+  arrow::ArrayVector chunk_output;
+  for (int64_t offset = 0; offset < num_rows; offset += kChunkSize) {
+    const auto chunk = batch.Slice(offset, std::min(kChunkSize, num_rows - offset));
+    ARROW_RETURN_NOT_OK(filter_->Evaluate(*chunk, selection));
+    if (selection->GetNumSlots() == 0) {
+      continue;
+    }
+    ARROW_RETURN_NOT_OK(
+        projector_->Evaluate(*chunk, selection.get(), pool, &chunk_output));
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      chunks[i].push_back(std::move(chunk_output[i]));
+    }
+  }
+
+  output->clear();
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    std::shared_ptr<arrow::Array> array;
+    if (chunks[i].empty()) {
+      ARROW_ASSIGN_OR_RAISE(array,
+                            arrow::MakeArrayOfNull(output_fields_[i]->type(), 0, pool));
+    } else if (chunks[i].size() == 1) {
+      array = std::move(chunks[i][0]);
+    } else {
+      ARROW_ASSIGN_OR_RAISE(array, arrow::Concatenate(chunks[i], pool));
+    }
+    output->push_back(std::move(array));
+  }
+  return Status::OK();
+}
+
+}  // namespace gandiva
@@ -0,0 +1,87 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/status.h"
+
+#include "gandiva/arrow.h"
+#include "gandiva/condition.h"
+#include "gandiva/configuration.h"
+#include "gandiva/expression.h"
+#include "gandiva/filter.h"
+#include "gandiva/projector.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief filter records based on a condition, and project the passing records.
+///
+/// Equivalent to evaluating a Filter and then a Projector with the resulting
+/// selection vector, but done chunk by chunk, so that the projection reads the input
+/// columns while they are still in cache from the evaluation of the condition.
+class GANDIVA_EXPORT FilterProjector {
+ public:
+  /// Number of rows per chunk, small enough for the input columns of a chunk to
+  /// stay in cache.
+  static constexpr int64_t kChunkSize = 8192;
+
+  /// Build a filter projector for the given schema, condition and expressions, with
+  /// the default configuration.
+  ///
+  /// \param[in] schema schema for the record batches, the condition and the
+  ///            expressions.
+  /// \param[in] condition filter condition.
+  /// \param[in] exprs vector of expressions, evaluated on the passing records.
+  /// \param[out] filter_projector the returned filter projector object
+  static Status Make(SchemaPtr schema, ConditionPtr condition,
+                     const ExpressionVector& exprs,
+                     std::shared_ptr<FilterProjector>* filter_projector) {
+    return Make(schema, condition, exprs, ConfigurationBuilder::DefaultConfiguration(),
+                filter_projector);
+  }
+
+  /// \brief Build a filter projector for the given schema, condition and
+  /// expressions.  Customize it with runtime configuration.
+  static Status Make(SchemaPtr schema, ConditionPtr condition,
+                     const ExpressionVector& exprs,
+                     std::shared_ptr<Configuration> configuration,
+                     std::shared_ptr<FilterProjector>* filter_projector);
+
+  /// Evaluate the expressions on the records of the batch satisfying the
+  /// condition.
+  ///
+  /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in] pool memory pool used to allocate output arrays (if required).
+  /// \param[out] output the vector of allocated/populated arrays, holding one
+  ///             value per record satisfying the condition.
+  Status Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                  arrow::ArrayVector* output);
+
+ private:
+  FilterProjector(std::shared_ptr<Filter> filter, std::shared_ptr<Projector> projector,
+                  SchemaPtr schema, FieldVector output_fields);
+
+  std::shared_ptr<Filter> filter_;
+  std::shared_ptr<Projector> projector_;
+  SchemaPtr schema_;
+  FieldVector output_fields_;
+};
+
+}  // namespace gandiva
@@ -17,6 +17,7 @@
 
 #include "gandiva/gdv_function_stubs.h"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -92,8 +93,17 @@ int32_t gdv_fn_populate_varlen_vector(int64_t context_ptr, int8_t* data_ptr,
   auto buffer = reinterpret_cast<arrow::ResizableBuffer*>(data_ptr);
   int32_t offset = static_cast<int32_t>(buffer->size());
 
+  // Grow the capacity geometrically, resizing to the exact size would
+  // reallocate on most entries.
+  auto status = arrow::Status::OK();
+  const int64_t new_size = static_cast<int64_t>(offset) + entry_len;
+  if (new_size > buffer->capacity()) {
+    status = buffer->Reserve(std::max(new_size, 2 * buffer->capacity()));
+  }
   // This also sets the size in the buffer.
-  auto status = buffer->Resize(offset + entry_len, false /*shrink*/);
+  if (status.ok()) {
+    status = buffer->Resize(new_size, false /*shrink*/);
+  }
   if (!status.ok()) {
     gandiva::ExecutionContext* context =
         reinterpret_cast<gandiva::ExecutionContext*>(context_ptr);
@@ -114,6 +114,8 @@ Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
                            selection_vector_mode_, " received vector with mode ", mode);
   }
 
+  eval_batch->SetExecutionContext(AcquireExecutionContext());
+  Status status;
   for (auto& compiled_expr : compiled_exprs_) {
     // generate data/offset vectors.
     const uint8_t* selection_buffer = nullptr;
@@ -129,15 +131,34 @@ Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
                  (int64_t)eval_batch->GetExecutionContext(), num_output_rows);
 
     // check for execution errors
-    ARROW_RETURN_IF(
-        eval_batch->GetExecutionContext()->has_error(),
-        Status::ExecutionError(eval_batch->GetExecutionContext()->get_error()));
+    if (eval_batch->GetExecutionContext()->has_error()) {
+      status = Status::ExecutionError(eval_batch->GetExecutionContext()->get_error());
+      break;
+    }
 
     // generate validity vectors.
     ComputeBitMapsForExpr(*compiled_expr, *eval_batch, selection_vector);
   }
+  ReleaseExecutionContext(eval_batch->ReleaseExecutionContext());
 
-  return Status::OK();
+  return status;
+}
+
+std::unique_ptr<ExecutionContext> LLVMGenerator::AcquireExecutionContext() {
+  std::lock_guard<std::mutex> lock(execution_contexts_mutex_);
+  if (idle_execution_contexts_.empty()) {
+    return std::unique_ptr<ExecutionContext>(new ExecutionContext());
+  }
+  auto execution_context = std::move(idle_execution_contexts_.back());
+  idle_execution_contexts_.pop_back();
+  return execution_context;
+}
+
+void LLVMGenerator::ReleaseExecutionContext(
+    std::unique_ptr<ExecutionContext> execution_context) {
+  execution_context->Recycle();
+  std::lock_guard<std::mutex> lock(execution_contexts_mutex_);
+  idle_execution_contexts_.push_back(std::move(execution_context));
 }
 
 llvm::Value* LLVMGenerator::LoadVectorAtIndex(llvm::Value* arg_addrs, int idx,
@@ -386,7 +407,22 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, int buffer_count,
 
   llvm::Value* loop_var_check =
       builder->CreateICmpSLT(loop_update, arg_nrecords, "loop_var < nrec");
-  builder->CreateCondBr(loop_var_check, loop_body, loop_exit);
+  llvm::BranchInst* loop_latch =
+      builder->CreateCondBr(loop_var_check, loop_body, loop_exit);
+
+  // The validity of the output is computed separately from bitmaps, so the loop
+  // only computes values: fill whole vector registers with them instead of
+  // leaving the width to the cost model, which often gives up on inlined
+  // null-handling functions.  Bit-packed and variable-length outputs aren't
+  // vectorizable.
+  if (output_type_id != arrow::Type::BOOL && arrow::is_primitive(output_type_id) &&
+      !visitor.has_arena_allocs()) {
+    const auto& fw_type = dynamic_cast<const arrow::FixedWidthType&>(*output->Type());
+    const int width = Engine::VectorRegisterBits() / fw_type.bit_width();
+    if (width > 1) {
+      AddVectorizeHint(loop_latch, width);
+    }
+  }
 
   // Loop exit
   builder->SetInsertPoint(loop_exit);
@@ -394,6 +430,22 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, int buffer_count,
   return Status::OK();
 }
 
+void LLVMGenerator::AddVectorizeHint(llvm::BranchInst* loop_latch, int width) {
+  llvm::LLVMContext& ctx = *context();
+  llvm::Metadata* enable[] = {
+      llvm::MDString::get(ctx, "llvm.loop.vectorize.enable"),
+      llvm::ConstantAsMetadata::get(llvm::ConstantInt::getTrue(ctx))};
+  llvm::Metadata* vector_width[] = {
+      llvm::MDString::get(ctx, "llvm.loop.vectorize.width"),
+      llvm::ConstantAsMetadata::get(types()->i32_constant(width))};
+  // A loop identifier refers to itself
+  llvm::Metadata* properties[] = {nullptr, llvm::MDNode::get(ctx, enable),
+                                  llvm::MDNode::get(ctx, vector_width)};
+  llvm::MDNode* loop_id = llvm::MDNode::getDistinct(ctx, properties);
+  loop_id->replaceOperandWith(0, loop_id);
+  loop_latch->setMetadata(llvm::LLVMContext::MD_loop, loop_id);
+}
+
 /// Return value of a bit in bitMap.
 llvm::Value* LLVMGenerator::GetPackedBitValue(llvm::Value* bitmap,
                                               llvm::Value* position) {
@@ -677,6 +729,8 @@ void LLVMGenerator::Visitor::Visit(const LiteralDex& dex) {
     case arrow::Type::BINARY: {
       const std::string& str = arrow::util::get<std::string>(dex.holder());
 
+      // The literal is referred to by its address in this process
+      generator_->engine_->MarkProcessSpecific();
       llvm::Constant* str_int_cast = types->i64_constant((int64_t)str.c_str());
       value = llvm::ConstantExpr::getIntToPtr(str_int_cast, types->i8_ptr_type());
       len = types->i32_constant(static_cast<int32_t>(str.length()));
@@ -1017,6 +1071,7 @@ void LLVMGenerator::Visitor::VisitInExpression(const InExprDexBase<Type>& dex) {
 
   const InExprDex<Type>& dex_instance = dynamic_cast<const InExprDex<Type>&>(dex);
   /* add the holder at the beginning */
+  generator_->engine_->MarkProcessSpecific();
   llvm::Constant* ptr_int_cast =
       types->i64_constant((int64_t)(dex_instance.in_holder().get()));
   params.push_back(ptr_int_cast);
@@ -1184,6 +1239,7 @@ std::vector<llvm::Value*> LLVMGenerator::Visitor::BuildParams(
 
   // if the function has holder, add the holder pointer.
   if (holder != nullptr) {
+    generator_->engine_->MarkProcessSpecific();
     auto ptr = types->i64_constant((int64_t)holder);
     params.push_back(ptr);
   }
@@ -1330,6 +1386,7 @@ void LLVMGenerator::AddTrace(const std::string& msg, llvm::Value* value) {
 
   // cast this to an llvm pointer.
   const char* str = trace_strings_.back().c_str();
+  engine_->MarkProcessSpecific();
   llvm::Constant* str_int_cast = types()->i64_constant((int64_t)str);
   llvm::Constant* str_ptr_cast =
       llvm::ConstantExpr::getIntToPtr(str_int_cast, types()->i8_ptr_type());
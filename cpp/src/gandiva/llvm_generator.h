@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -71,6 +72,8 @@ class GANDIVA_EXPORT LLVMGenerator {
                  const ArrayDataVector& output_vector);
 
   SelectionVector::Mode selection_vector_mode() { return selection_vector_mode_; }
+  /// \brief Number of expressions built, each filling one output.
+  size_t num_outputs() const { return compiled_exprs_.size(); }
   LLVMTypes* types() { return engine_->types(); }
   llvm::Module* module() { return engine_->module(); }
   std::string DumpIR() { return engine_->DumpIR(); }
@@ -192,6 +195,10 @@ class GANDIVA_EXPORT LLVMGenerator {
                           int suffix_idx, llvm::Function** fn,
                           SelectionVector::Mode selection_vector_mode);
 
+  /// Ask the loop vectorizer to vectorize the loop ending with 'loop_latch', with
+  /// 'width' elements per iteration.
+  void AddVectorizeHint(llvm::BranchInst* loop_latch, int width);
+
   /// Generate code to load the local bitmap specified index and cast it as bitmap.
   llvm::Value* GetLocalBitMapReference(llvm::Value* arg_bitmaps, int idx);
 
@@ -218,6 +225,12 @@ class GANDIVA_EXPORT LLVMGenerator {
   llvm::Value* AddFunctionCall(const std::string& full_name, llvm::Type* ret_type,
                                const std::vector<llvm::Value*>& args);
 
+  /// Take an execution context retained from previous batches, or a new one.
+  std::unique_ptr<ExecutionContext> AcquireExecutionContext();
+
+  /// Retain an execution context, and the memory of its arena, for later batches.
+  void ReleaseExecutionContext(std::unique_ptr<ExecutionContext> execution_context);
+
   /// Compute the result bitmap for the expression.
   ///
   /// \param[in] compiled_expr the compiled expression (includes the bitmap indices to be
@@ -242,6 +255,11 @@ class GANDIVA_EXPORT LLVMGenerator {
   Annotator annotator_;
   SelectionVector::Mode selection_vector_mode_;
 
+  // Execution contexts of finished batches.  Batches may be executed
+  // concurrently, each with its own context.
+  std::mutex execution_contexts_mutex_;
+  std::vector<std::unique_ptr<ExecutionContext>> idle_execution_contexts_;
+
   // used for debug
   bool enable_ir_traces_;
   std::vector<std::string> trace_strings_;
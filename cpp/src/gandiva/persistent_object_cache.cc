@@ -0,0 +1,124 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/persistent_object_cache.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <utility>
+
+#include "arrow/util/hashing.h"
+#include "arrow/util/io_util.h"
+
+namespace gandiva {
+
+namespace {
+
+constexpr char kMagic[] = "GDVOBJ1\n";
+constexpr size_t kMagicSize = sizeof(kMagic) - 1;
+
+std::string HexDigest(const std::string& key) {
+  std::stringstream ss;
+  ss << std::hex << std::setfill('0');
+  const auto size = static_cast<int64_t>(key.size());
+  ss << std::setw(16) << arrow::internal::ComputeStringHash<0>(key.data(), size);
+  ss << std::setw(16) << arrow::internal::ComputeStringHash<1>(key.data(), size);
+  return ss.str();
+}
+
+std::string RandomSuffix() {
+  std::random_device device;
+  std::stringstream ss;
+  ss << std::hex << device() << device();
+  return ss.str();
+}
+
+}  // namespace
+
+PersistentObjectCache::PersistentObjectCache(const std::string& dir, std::string key)
+    : dir_(dir), path_(dir + "/" + HexDigest(key) + ".o"), key_(std::move(key)) {}
+
+bool PersistentObjectCache::Load() {
+  std::ifstream file(path_, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  std::string contents((std::istreambuf_iterator<char>(file)),
+                       std::istreambuf_iterator<char>());
+  if (file.bad()) {
+    return false;
+  }
+
+  uint64_t key_size;
+  const size_t header_size = kMagicSize + sizeof(key_size);
+  if (contents.size() < header_size ||
+      std::memcmp(contents.data(), kMagic, kMagicSize) != 0) {
+    return false;
+  }
+  std::memcpy(&key_size, contents.data() + kMagicSize, sizeof(key_size));
+  if (key_size != key_.size() || contents.size() - header_size < key_size ||
+      contents.compare(header_size, key_.size(), key_) != 0) {
+    return false;
+  }
+  object_ = contents.substr(header_size + key_.size());
+  loaded_ = !object_.empty();
+  return loaded_;
+}
+
+void PersistentObjectCache::notifyObjectCompiled(const llvm::Module* module,
+                                                 llvm::MemoryBufferRef object) {
+  auto dir = arrow::internal::PlatformFilename::FromString(dir_);
+  if (!dir.ok() || !arrow::internal::CreateDirTree(*dir).ok()) {
+    return;
+  }
+
+  // Write to a private file first, then move it into place
+  const std::string temp_path = path_ + ".tmp" + RandomSuffix();
+  {
+    std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+    const uint64_t key_size = key_.size();
+    file.write(kMagic, kMagicSize);
+    file.write(reinterpret_cast<const char*>(&key_size), sizeof(key_size));
+    file.write(key_.data(), key_.size());
+    file.write(object.getBufferStart(), object.getBufferSize());
+    file.close();
+    if (!file) {
+      std::remove(temp_path.c_str());
+      return;
+    }
+  }
+  if (std::rename(temp_path.c_str(), path_.c_str()) != 0) {
+    // e.g. another process stored it first on a platform not replacing files
+    std::remove(temp_path.c_str());
+  }
+}
+
+std::unique_ptr<llvm::MemoryBuffer> PersistentObjectCache::getObject(
+    const llvm::Module* module) {
+  if (!loaded_) {
+    return nullptr;
+  }
+  return llvm::MemoryBuffer::getMemBufferCopy(object_, path_);
+}
+
+}  // namespace gandiva
@@ -0,0 +1,72 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4141)
+#pragma warning(disable : 4146)
+#pragma warning(disable : 4244)
+#pragma warning(disable : 4267)
+#pragma warning(disable : 4624)
+#endif
+
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/Support/MemoryBuffer.h>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief Object code of one module, kept in a file across processes.
+///
+/// The file is named after a digest of `key`, which must identify everything the
+/// object code depends on, and also holds `key` itself to rule out collisions.
+/// Files are written atomically, so that concurrent processes compiling the same
+/// module don't see partial objects.  I/O errors are ignored: the module is then
+/// compiled as without a cache.
+class GANDIVA_EXPORT PersistentObjectCache : public llvm::ObjectCache {
+ public:
+  PersistentObjectCache(const std::string& dir, std::string key);
+
+  /// Read the object code stored for the key, return true if found.
+  bool Load();
+
+  void notifyObjectCompiled(const llvm::Module* module,
+                            llvm::MemoryBufferRef object) override;
+
+  std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override;
+
+  const std::string& path() const { return path_; }
+
+ private:
+  std::string dir_;
+  std::string path_;
+  std::string key_;
+  std::string object_;
+  bool loaded_ = false;
+};
+
+}  // namespace gandiva
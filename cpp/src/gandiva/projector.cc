@@ -17,13 +17,19 @@
 
 #include "gandiva/projector.h"
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <thread>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/hash_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 #include "gandiva/cache.h"
 #include "gandiva/expr_validator.h"
@@ -121,13 +127,27 @@ class ProjectorCacheKey {
   uint32_t uniqifier_;
 };
 
-Projector::Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
-                     const FieldVector& output_fields,
+// Below this many expressions per module, compiling on another thread costs more
+// than it saves: each module links and optimises the precompiled functions anew.
+static constexpr size_t kMinExpressionsPerModule = 8;
+
+// Rows evaluated by each task of a parallel evaluation, at least.  Ranges start
+// at multiples of 64 rows, so that no two tasks write to the same byte (or the
+// same word) of an output bitmap.
+static constexpr int64_t kMinRowsPerTask = 64 * 1024;
+
+Projector::Projector(std::vector<std::unique_ptr<LLVMGenerator>> llvm_generators,
+                     SchemaPtr schema, const FieldVector& output_fields,
                      std::shared_ptr<Configuration> configuration)
-    : llvm_generator_(std::move(llvm_generator)),
+    : llvm_generators_(std::move(llvm_generators)),
       schema_(schema),
       output_fields_(output_fields),
-      configuration_(configuration) {}
+      configuration_(configuration),
+      var_width_bytes_per_row_(output_fields.size()) {
+  for (auto& bytes_per_row : var_width_bytes_per_row_) {
+    bytes_per_row.store(-1);
+  }
+}
 
 Projector::~Projector() {}
 
@@ -162,6 +182,67 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
     return Status::OK();
   }
 
+  // Build an LLVM generator per group of expressions, on concurrent threads
+  // except for the first group.
+  std::vector<ExpressionVector> groups = GroupExpressions(exprs, *configuration);
+  std::vector<std::unique_ptr<LLVMGenerator>> llvm_gens(groups.size());
+  std::vector<Status> statuses(groups.size());
+  auto build_group = [&](size_t i) {
+    statuses[i] = BuildGenerator(schema, groups[i], selection_vector_mode,
+                                 configuration, &llvm_gens[i]);
+  };
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < groups.size(); ++i) {
+    threads.emplace_back(build_group, i);
+  }
+  build_group(0);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& status : statuses) {
+    ARROW_RETURN_NOT_OK(status);
+  }
+
+  // save the output field types. Used for validation at Evaluate() time.
+  std::vector<FieldPtr> output_fields;
+  output_fields.reserve(exprs.size());
+  for (auto& expr : exprs) {
+    output_fields.push_back(expr->result());
+  }
+
+  // Instantiate the projector with the completely built llvm generator
+  *projector = std::shared_ptr<Projector>(
+      new Projector(std::move(llvm_gens), schema, output_fields, configuration));
+  cache.PutModule(cache_key, *projector);
+
+  return Status::OK();
+}
+
+std::vector<ExpressionVector> Projector::GroupExpressions(
+    const ExpressionVector& exprs, const Configuration& configuration) {
+  size_t num_groups = 1;
+  if (configuration.parallel_compilation()) {
+    const size_t max_groups = std::max(1u, std::thread::hardware_concurrency());
+    num_groups = std::min(max_groups, exprs.size() / kMinExpressionsPerModule);
+    num_groups = std::max<size_t>(num_groups, 1);
+  }
+
+  // Consecutive expressions, so that each module fills a contiguous range of the
+  // outputs
+  std::vector<ExpressionVector> groups(num_groups);
+  auto begin = exprs.begin();
+  for (size_t i = 0; i < num_groups; ++i) {
+    const size_t group_size = (exprs.size() + i) / num_groups;
+    groups[i].assign(begin, begin + group_size);
+    begin += group_size;
+  }
+  return groups;
+}
+
+Status Projector::BuildGenerator(SchemaPtr schema, const ExpressionVector& exprs,
+                                 SelectionVector::Mode selection_vector_mode,
+                                 std::shared_ptr<Configuration> configuration,
+                                 std::unique_ptr<LLVMGenerator>* llvm_generator) {
   // Build LLVM generator, and generate code for the specified expressions
   std::unique_ptr<LLVMGenerator> llvm_gen;
   ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, &llvm_gen));
@@ -175,19 +256,88 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
   }
 
   ARROW_RETURN_NOT_OK(llvm_gen->Build(exprs, selection_vector_mode));
+  *llvm_generator = std::move(llvm_gen);
+  return Status::OK();
+}
 
-  // save the output field types. Used for validation at Evaluate() time.
-  std::vector<FieldPtr> output_fields;
-  output_fields.reserve(exprs.size());
-  for (auto& expr : exprs) {
-    output_fields.push_back(expr->result());
+Status Projector::Execute(const arrow::RecordBatch& batch,
+                          const SelectionVector* selection_vector,
+                          const ArrayDataVector& output_data_vecs) {
+  if (llvm_generators_.size() == 1) {
+    return llvm_generators_[0]->Execute(batch, selection_vector, output_data_vecs);
+  }
+  auto begin = output_data_vecs.begin();
+  for (auto& llvm_generator : llvm_generators_) {
+    const auto end = begin + llvm_generator->num_outputs();
+    ARROW_RETURN_NOT_OK(
+        llvm_generator->Execute(batch, selection_vector, ArrayDataVector(begin, end)));
+    begin = end;
   }
+  return Status::OK();
+}
 
-  // Instantiate the projector with the completely built llvm generator
-  *projector = std::shared_ptr<Projector>(
-      new Projector(std::move(llvm_gen), schema, output_fields, configuration));
-  cache.PutModule(cache_key, *projector);
+Status Projector::ExecuteParallel(const arrow::RecordBatch& batch,
+                                  arrow::MemoryPool* pool,
+                                  ArrayDataVector* output_data_vecs) {
+  const int64_t num_rows = batch.num_rows();
+  const int64_t max_tasks = arrow::internal::GetCpuThreadPool()->GetCapacity();
+  int64_t num_tasks = std::min(max_tasks, num_rows / kMinRowsPerTask);
+  num_tasks = std::max<int64_t>(num_tasks, 1);
+  const int64_t task_rows =
+      arrow::BitUtil::RoundUp(arrow::BitUtil::CeilDiv(num_rows, num_tasks), 64);
+  num_tasks = arrow::BitUtil::CeilDiv(num_rows, task_rows);
+
+  // The ranges of variable-width outputs, concatenated once all are evaluated
+  std::vector<arrow::ArrayVector> var_width_ranges(output_data_vecs->size());
+  for (size_t i = 0; i < output_data_vecs->size(); ++i) {
+    if (arrow::is_binary_like((*output_data_vecs)[i]->type->id())) {
+      var_width_ranges[i].resize(num_tasks);
+    }
+  }
+
+  auto evaluate_range = [&](int task) {
+    const int64_t offset = task * task_rows;
+    const int64_t length = std::min(task_rows, num_rows - offset);
+    ArrayDataVector range_outputs;
+    for (const auto& output : *output_data_vecs) {
+      const auto& type = output->type;
+      ArrayDataPtr range_output;
+      if (arrow::is_binary_like(type->id())) {
+        const size_t i = range_outputs.size();
+        ARROW_RETURN_NOT_OK(
+            AllocArrayData(type, length, pool, &range_output,
+                           EstimateVarWidthOutputSize(i, batch, length)));
+      } else {
+        // Views of the range's slice of the validity and data buffers
+        const int bit_width =
+            dynamic_cast<const arrow::FixedWidthType&>(*type).bit_width();
+        auto validity = arrow::SliceMutableBuffer(output->buffers[0], offset / 8,
+                                                  arrow::BitUtil::BytesForBits(length));
+        auto data = arrow::SliceMutableBuffer(
+            output->buffers[1], offset * bit_width / 8,
+            arrow::BitUtil::BytesForBits(length * bit_width));
+        range_output = arrow::ArrayData::Make(type, length, {validity, data});
+      }
+      range_outputs.push_back(std::move(range_output));
+    }
 
+    ARROW_RETURN_NOT_OK(Execute(*batch.Slice(offset, length), nullptr, range_outputs));
+    for (size_t i = 0; i < range_outputs.size(); ++i) {
+      if (!var_width_ranges[i].empty()) {
+        var_width_ranges[i][task] = arrow::MakeArray(range_outputs[i]);
+      }
+    }
+    return Status::OK();
+  };
+  ARROW_RETURN_NOT_OK(
+      arrow::internal::ParallelFor(static_cast<int>(num_tasks), evaluate_range));
+
+  for (size_t i = 0; i < output_data_vecs->size(); ++i) {
+    if (!var_width_ranges[i].empty()) {
+      ARROW_ASSIGN_OR_RAISE(auto merged, arrow::Concatenate(var_width_ranges[i], pool));
+      (*output_data_vecs)[i] = merged->data();
+    }
+  }
   return Status::OK();
 }
 
@@ -223,7 +373,7 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
         ValidateArrayDataCapacity(*array_data, *(output_fields_[idx]), num_rows));
     ++idx;
   }
-  return llvm_generator_->Execute(batch, selection_vector, output_data_vecs);
+  return Execute(batch, selection_vector, output_data_vecs);
 }
 
 Status Projector::Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
@@ -240,18 +390,43 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
 
   auto num_rows =
       selection_vector == nullptr ? batch.num_rows() : selection_vector->GetNumSlots();
-  // Allocate the output data vecs.
+  const bool parallel = selection_vector == nullptr &&
+                        configuration_->parallel_evaluation() &&
+                        num_rows >= 2 * kMinRowsPerTask;
+
+  // Allocate the output data vecs.  Variable-width outputs evaluated in
+  // parallel are allocated per range instead.
   ArrayDataVector output_data_vecs;
   for (auto& field : output_fields_) {
     ArrayDataPtr output_data;
-
-    ARROW_RETURN_NOT_OK(AllocArrayData(field->type(), num_rows, pool, &output_data));
+    if (!arrow::is_binary_like(field->type()->id())) {
+      ARROW_RETURN_NOT_OK(AllocArrayData(field->type(), num_rows, pool, &output_data));
+    } else if (!parallel) {
+      ARROW_RETURN_NOT_OK(AllocArrayData(
+          field->type(), num_rows, pool, &output_data,
+          EstimateVarWidthOutputSize(output_data_vecs.size(), batch, num_rows)));
+    } else {
+      output_data = arrow::ArrayData::Make(field->type(), num_rows);
+    }
     output_data_vecs.push_back(output_data);
   }
 
   // Execute the expression(s).
-  ARROW_RETURN_NOT_OK(
-      llvm_generator_->Execute(batch, selection_vector, output_data_vecs));
+  if (parallel) {
+    ARROW_RETURN_NOT_OK(ExecuteParallel(batch, pool, &output_data_vecs));
+  } else {
+    ARROW_RETURN_NOT_OK(Execute(batch, selection_vector, output_data_vecs));
+  }
+
+  // Remember the sizes of variable-width outputs, to allocate them for the
+  // next batches
+  for (size_t i = 0; i < output_data_vecs.size(); ++i) {
+    const auto& array_data = *output_data_vecs[i];
+    if (arrow::is_binary_like(array_data.type->id())) {
+      const auto data_size = static_cast<double>(array_data.buffers[2]->size());
+      var_width_bytes_per_row_[i].store(data_size / num_rows);
+    }
+  }
 
   // Create and return array arrays.
   output->clear();
@@ -263,7 +438,8 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
 
 // TODO : handle complex vectors (list/map/..)
 Status Projector::AllocArrayData(const DataTypePtr& type, int64_t num_records,
-                                 arrow::MemoryPool* pool, ArrayDataPtr* array_data) {
+                                 arrow::MemoryPool* pool, ArrayDataPtr* array_data,
+                                 int64_t var_width_capacity) {
   arrow::Status astatus;
   std::vector<std::shared_ptr<arrow::Buffer>> buffers;
 
@@ -293,6 +469,10 @@ Status Projector::AllocArrayData(const DataTypePtr& type, int64_t num_records,
     return Status::Invalid("Unsupported output data type " + type->ToString());
   }
   ARROW_ASSIGN_OR_RAISE(auto data_buffer, arrow::AllocateResizableBuffer(data_len, pool));
+  if (var_width_capacity > 0) {
+    // Empty, but with room for the expected values.
+    ARROW_RETURN_NOT_OK(data_buffer->Reserve(var_width_capacity));
+  }
 
   // This is not strictly required but valgrind gets confused and detects this
   // as uninitialized memory access. See arrow::util::SetBitTo().
@@ -305,6 +485,26 @@ Status Projector::AllocArrayData(const DataTypePtr& type, int64_t num_records,
   return Status::OK();
 }
 
+int64_t Projector::EstimateVarWidthOutputSize(size_t output_index,
+                                              const arrow::RecordBatch& batch,
+                                              int64_t num_records) const {
+  const double bytes_per_row = var_width_bytes_per_row_[output_index].load();
+  if (bytes_per_row >= 0) {
+    return static_cast<int64_t>(bytes_per_row * num_records);
+  }
+
+  // Before the first batch, expect values as large as those of the largest input
+  int64_t input_bytes = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    const auto& column = *batch.column_data(i);
+    if (arrow::is_binary_like(column.type->id()) && column.length > 0) {
+      const int32_t* offsets = column.GetValues<int32_t>(1);
+      input_bytes = std::max<int64_t>(input_bytes, offsets[column.length] - offsets[0]);
+    }
+  }
+  return input_bytes * num_records / batch.num_rows();
+}
+
 Status Projector::ValidateEvaluateArgsCommon(const arrow::RecordBatch& batch) {
   ARROW_RETURN_IF(!batch.schema()->Equals(*schema_),
                   Status::Invalid("Schema in RecordBatch must match schema in Make()"));
@@ -357,6 +557,12 @@ Status Projector::ValidateArrayDataCapacity(const arrow::ArrayData& array_data,
   return Status::OK();
 }
 
-std::string Projector::DumpIR() { return llvm_generator_->DumpIR(); }
+std::string Projector::DumpIR() {
+  std::string ir;
+  for (auto& llvm_generator : llvm_generators_) {
+    ir += llvm_generator->DumpIR();
+  }
+  return ir;
+}
 
 }  // namespace gandiva
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
@@ -81,6 +82,9 @@ class GANDIVA_EXPORT Projector {
   /// arrays. The output arrays will be allocated from the memory pool 'pool', and added
   /// to the vector 'output'.
   ///
+  /// If the configuration enables parallel evaluation, large batches are split into
+  /// row ranges evaluated on the Arrow CPU thread pool.
+  ///
   /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
   /// \param[in] pool memory pool used to allocate output arrays (if required).
   /// \param[out] output the vector of allocated/populated arrays.
@@ -120,12 +124,42 @@ class GANDIVA_EXPORT Projector {
   std::string DumpIR();
 
  private:
-  Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
-            const FieldVector& output_fields, std::shared_ptr<Configuration>);
-
-  /// Allocate an ArrowData of length 'length'.
+  Projector(std::vector<std::unique_ptr<LLVMGenerator>> llvm_generators,
+            SchemaPtr schema, const FieldVector& output_fields,
+            std::shared_ptr<Configuration>);
+
+  /// Split the expressions into groups compiled into separate modules.
+  static std::vector<ExpressionVector> GroupExpressions(
+      const ExpressionVector& exprs, const Configuration& configuration);
+
+  /// Validate and generate code for a group of expressions.
+  static Status BuildGenerator(SchemaPtr schema, const ExpressionVector& exprs,
+                               SelectionVector::Mode selection_vector_mode,
+                               std::shared_ptr<Configuration> configuration,
+                               std::unique_ptr<LLVMGenerator>* llvm_generator);
+
+  /// Execute each module on its share of the outputs.
+  Status Execute(const arrow::RecordBatch& batch,
+                 const SelectionVector* selection_vector,
+                 const ArrayDataVector& output_data_vecs);
+
+  /// Execute the modules on row ranges of the batch, on concurrent threads.
+  /// Fixed-width outputs are written in place, variable-width outputs are
+  /// evaluated into arrays of their own and concatenated.
+  Status ExecuteParallel(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                         ArrayDataVector* output_data_vecs);
+
+  /// Allocate an ArrowData of length 'length'.  The data buffer of variable-width
+  /// types is empty, with a capacity of 'var_width_capacity'.
   Status AllocArrayData(const DataTypePtr& type, int64_t num_records,
-                        arrow::MemoryPool* pool, ArrayDataPtr* array_data);
+                        arrow::MemoryPool* pool, ArrayDataPtr* array_data,
+                        int64_t var_width_capacity = 0);
+
+  /// Estimate the data size of a variable-width output of 'num_records', from the
+  /// size of the output of the previous batch, or else of the inputs.
+  int64_t EstimateVarWidthOutputSize(size_t output_index,
+                                     const arrow::RecordBatch& batch,
+                                     int64_t num_records) const;
 
   /// Validate that the ArrayData has sufficient capacity to accommodate 'num_records'.
   Status ValidateArrayDataCapacity(const arrow::ArrayData& array_data,
@@ -134,10 +168,13 @@ class GANDIVA_EXPORT Projector {
   /// Validate the common args for Evaluate() APIs.
   Status ValidateEvaluateArgsCommon(const arrow::RecordBatch& batch);
 
-  std::unique_ptr<LLVMGenerator> llvm_generator_;
+  // One module per group of consecutive expressions
+  std::vector<std::unique_ptr<LLVMGenerator>> llvm_generators_;
   SchemaPtr schema_;
   FieldVector output_fields_;
   std::shared_ptr<Configuration> configuration_;
+  // Data bytes per row of the variable-width outputs of the last batch, or -1.
+  std::vector<std::atomic<double>> var_width_bytes_per_row_;
 };
 
 }  // namespace gandiva
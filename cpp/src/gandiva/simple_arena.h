@@ -51,6 +51,11 @@ class SimpleArena {
   // Reset arena state.
   void Reset();
 
+  // Reset arena state, keeping a single chunk as large as all the chunks
+  // allocated so far.  Used between batches, so that batches of similar sizes
+  // allocate nothing from the system.
+  void Recycle();
+
   // total bytes allocated from system.
   int64_t total_bytes() { return total_bytes_; }
 
@@ -146,6 +151,21 @@ inline void SimpleArena::Reset() {
   avail_bytes_ = total_bytes_ = chunks_.at(0).size_;
 }
 
+inline void SimpleArena::Recycle() {
+  if (chunks_.size() > 1) {
+    const int64_t total_bytes = total_bytes_;
+    ReleaseChunks(false /*retain_first*/);
+    chunks_.clear();
+    total_bytes_ = avail_bytes_ = 0;
+    avail_buf_ = NULL;
+    if (!AllocateChunk(total_bytes).ok()) {
+      // allocate chunks again on demand.
+      return;
+    }
+  }
+  Reset();
+}
+
 inline void SimpleArena::ReleaseChunks(bool retain_first) {
   for (auto& chunk : chunks_) {
     if (retain_first) {
@@ -99,4 +99,36 @@ TEST_F(TestSimpleArena, TestReset2) {
   EXPECT_EQ(arena.avail_bytes(), large_size - small_size);
 }
 
+// several chunks, then recycle
+TEST_F(TestSimpleArena, TestRecycle) {
+  int64_t chunk_size = 4096;
+  SimpleArena arena(arrow::default_memory_pool(), chunk_size);
+
+  int64_t small_size = 100;
+  auto p = arena.Allocate(small_size);
+  EXPECT_NE(p, nullptr);
+
+  int64_t large_size = 100 * chunk_size;
+  p = arena.Allocate(large_size);
+  EXPECT_NE(p, nullptr);
+
+  EXPECT_EQ(arena.total_bytes(), chunk_size + large_size);
+  arena.Recycle();
+  EXPECT_EQ(arena.total_bytes(), chunk_size + large_size);
+  EXPECT_EQ(arena.avail_bytes(), chunk_size + large_size);
+
+  // the same allocations fit in the single chunk.
+  p = arena.Allocate(small_size);
+  EXPECT_NE(p, nullptr);
+  p = arena.Allocate(large_size);
+  EXPECT_NE(p, nullptr);
+  EXPECT_EQ(arena.total_bytes(), chunk_size + large_size);
+  EXPECT_EQ(arena.avail_bytes(), chunk_size - small_size);
+
+  // a single chunk is kept as is.
+  arena.Recycle();
+  EXPECT_EQ(arena.total_bytes(), chunk_size + large_size);
+  EXPECT_EQ(arena.avail_bytes(), chunk_size + large_size);
+}
+
 }  // namespace gandiva
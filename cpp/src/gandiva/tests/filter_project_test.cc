@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 #include "arrow/memory_pool.h"
 #include "gandiva/filter.h"
+#include "gandiva/filter_projector.h"
 #include "gandiva/projector.h"
 #include "gandiva/selection_vector.h"
 #include "gandiva/tests/test_util.h"
@@ -273,4 +274,60 @@ TEST_F(TestFilterProject, TestSimpleIf) {
   // Validate results
   EXPECT_ARROW_ARRAY_EQUALS(exp, outputs.at(0));
 }
+
+TEST_F(TestFilterProject, TestFilterProjectorChunked) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto resultField = field("result", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // Build condition f0 < f1, and project f0 + f1
+  auto node_f0 = TreeExprBuilder::MakeField(field0);
+  auto node_f1 = TreeExprBuilder::MakeField(field1);
+  auto less_than_function =
+      TreeExprBuilder::MakeFunction("less_than", {node_f0, node_f1}, arrow::boolean());
+  auto condition = TreeExprBuilder::MakeCondition(less_than_function);
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, resultField);
+
+  std::shared_ptr<FilterProjector> filter_projector;
+  auto status = FilterProjector::Make(schema, condition, {sum_expr}, TestConfiguration(),
+                                      &filter_projector);
+  ASSERT_TRUE(status.ok()) << status.message();
+
+  // Span several chunks, with one chunk where no record passes
+  const int num_records = static_cast<int>(FilterProjector::kChunkSize) * 3 + 17;
+  std::vector<int32_t> values0(num_records), values1(num_records), expected;
+  std::vector<bool> validity(num_records), expected_validity;
+  for (int i = 0; i < num_records; ++i) {
+    bool in_empty_chunk = i / FilterProjector::kChunkSize == 1;
+    values0[i] = i % 7;
+    values1[i] = in_empty_chunk ? 0 : i % 5;
+    validity[i] = i % 11 != 0;
+    if (validity[i] && values0[i] < values1[i]) {
+      expected.push_back(values0[i] + values1[i]);
+      expected_validity.push_back(true);
+    }
+  }
+  auto array0 = MakeArrowArrayInt32(values0, validity);
+  auto array1 = MakeArrowArrayInt32(values1, std::vector<bool>(num_records, true));
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  arrow::ArrayVector outputs;
+  status = filter_projector->Evaluate(*in_batch, pool_, &outputs);
+  ASSERT_TRUE(status.ok()) << status.message();
+  ASSERT_EQ(outputs.size(), 1);
+  EXPECT_ARROW_ARRAY_EQUALS(MakeArrowArrayInt32(expected, expected_validity),
+                            outputs.at(0));
+
+  // No record passes at all
+  auto none0 = MakeArrowArrayInt32({5, 6}, {true, true});
+  auto none1 = MakeArrowArrayInt32({1, 2}, {true, true});
+  auto none_batch = arrow::RecordBatch::Make(schema, 2, {none0, none1});
+  status = filter_projector->Evaluate(*none_batch, pool_, &outputs);
+  ASSERT_TRUE(status.ok()) << status.message();
+  ASSERT_EQ(outputs.size(), 1);
+  EXPECT_EQ(outputs.at(0)->length(), 0);
+  EXPECT_TRUE(outputs.at(0)->type()->Equals(int32()));
+}
 }  // namespace gandiva
@@ -434,6 +434,39 @@ static void DecimalAdd3Large(benchmark::State& state) {
   DoDecimalAdd3(state, DecimalTypeUtil::kMaxPrecision, 18, true);
 }
 
+static void DoBuildManyExpressions(benchmark::State& state, bool parallel) {
+  auto field0 = field("f0", int64());
+  auto schema = arrow::schema({field0});
+  auto configuration = ConfigurationBuilder().build();
+  configuration->set_parallel_compilation(parallel);
+
+  const int num_exprs = 64;
+  int64_t iteration = 0;
+  for (auto _ : state) {
+    // Distinct literals in each iteration, so that projectors aren't cached
+    ExpressionVector exprs;
+    for (int i = 0; i < num_exprs; ++i) {
+      auto literal = TreeExprBuilder::MakeLiteral(iteration * num_exprs + i);
+      auto product = TreeExprBuilder::MakeFunction(
+          "multiply", {TreeExprBuilder::MakeField(field0), literal}, int64());
+      exprs.push_back(TreeExprBuilder::MakeExpression(
+          product, field("res_" + std::to_string(i), int64())));
+    }
+    ++iteration;
+
+    std::shared_ptr<Projector> projector;
+    ASSERT_OK(Projector::Make(schema, exprs, configuration, &projector));
+  }
+}
+
+static void BuildManyExpressionsSerial(benchmark::State& state) {
+  DoBuildManyExpressions(state, false);
+}
+
+static void BuildManyExpressionsParallel(benchmark::State& state) {
+  DoBuildManyExpressions(state, true);
+}
+
 BENCHMARK(TimedTestAdd3)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(TimedTestBigNested)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(TimedTestExtractYear)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
@@ -452,5 +485,7 @@ BENCHMARK(DecimalAdd3Fast)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(DecimalAdd3LeadingZeroes)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(DecimalAdd3LeadingZeroesWithDiv)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(DecimalAdd3Large)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BuildManyExpressionsSerial)->MinTime(1.0)->Unit(benchmark::kMillisecond);
+BENCHMARK(BuildManyExpressionsParallel)->MinTime(1.0)->Unit(benchmark::kMillisecond);
 
 }  // namespace gandiva
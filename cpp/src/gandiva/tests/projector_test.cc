@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cmath>
 
 #include <gtest/gtest.h>
@@ -766,4 +767,113 @@ TEST_F(TestProjector, TestOffset) {
   EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
 }
 
+TEST_F(TestProjector, TestManyExpressions) {
+  // Enough expressions to be compiled in several modules
+  auto field0 = field("f0", int32());
+  auto schema = arrow::schema({field0});
+  const int num_exprs = 20;
+  ExpressionVector exprs;
+  for (int i = 0; i < num_exprs; ++i) {
+    auto sum = TreeExprBuilder::MakeFunction(
+        "add", {TreeExprBuilder::MakeField(field0), TreeExprBuilder::MakeLiteral(i)},
+        int32());
+    exprs.push_back(
+        TreeExprBuilder::MakeExpression(sum, field("add_" + std::to_string(i), int32())));
+  }
+
+  auto configuration = ConfigurationBuilder().build();
+  configuration->set_parallel_compilation(true);
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, exprs, configuration, &projector));
+
+  int num_records = 4;
+  auto array0 = MakeArrowArrayInt32({1, 2, 3, 4}, {true, true, false, true});
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0});
+
+  arrow::ArrayVector outputs;
+  ASSERT_OK(projector->Evaluate(*in_batch, pool_, &outputs));
+  ASSERT_EQ(outputs.size(), num_exprs);
+  for (int i = 0; i < num_exprs; ++i) {
+    auto expected =
+        MakeArrowArrayInt32({1 + i, 2 + i, 0, 4 + i}, {true, true, false, true});
+    EXPECT_ARROW_ARRAY_EQUALS(expected, outputs.at(i));
+  }
+}
+
+TEST_F(TestProjector, TestParallelEvaluation) {
+  // Enough rows to be evaluated in several ranges, the last one partial
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", arrow::utf8());
+  auto schema = arrow::schema({field0, field1});
+
+  auto sum = TreeExprBuilder::MakeExpression("add", {field0, field0},
+                                             field("add", int32()));
+  auto positive = TreeExprBuilder::MakeFunction(
+      "greater_than",
+      {TreeExprBuilder::MakeField(field0), TreeExprBuilder::MakeLiteral(0)}, boolean());
+  auto is_positive =
+      TreeExprBuilder::MakeExpression(positive, field("is_positive", boolean()));
+  auto upper = TreeExprBuilder::MakeExpression("upper", {field1},
+                                               field("upper", arrow::utf8()));
+  ExpressionVector exprs = {sum, is_positive, upper};
+
+  auto serial_configuration = ConfigurationBuilder().build();
+  auto parallel_configuration = ConfigurationBuilder().build();
+  parallel_configuration->set_parallel_evaluation(true);
+  std::shared_ptr<Projector> serial_projector, parallel_projector;
+  ASSERT_OK(Projector::Make(schema, exprs, serial_configuration, &serial_projector));
+  ASSERT_OK(
+      Projector::Make(schema, exprs, parallel_configuration, &parallel_projector));
+
+  const int num_records = 1000 * 1000 + 7;
+  std::vector<int32_t> values(num_records);
+  std::vector<std::string> strings(num_records);
+  std::vector<bool> validity(num_records);
+  for (int i = 0; i < num_records; ++i) {
+    values[i] = (i % 3 == 0) ? -i : i;
+    strings[i] = "row" + std::to_string(i % 101);
+    validity[i] = i % 17 != 0;
+  }
+  auto array0 = MakeArrowArrayInt32(values, validity);
+  auto array1 = MakeArrowArrayUtf8(strings, validity);
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  arrow::ArrayVector expected, outputs;
+  ASSERT_OK(serial_projector->Evaluate(*in_batch, pool_, &expected));
+  ASSERT_OK(parallel_projector->Evaluate(*in_batch, pool_, &outputs));
+  ASSERT_EQ(outputs.size(), expected.size());
+  for (size_t i = 0; i < outputs.size(); ++i) {
+    EXPECT_ARROW_ARRAY_EQUALS(expected[i], outputs[i]);
+  }
+}
+
+TEST_F(TestProjector, TestVarWidthOutputsAcrossBatches) {
+  // The outputs of later batches are allocated from the size of the first ones
+  auto field0 = field("f0", arrow::utf8());
+  auto schema = arrow::schema({field0});
+  auto upper = TreeExprBuilder::MakeExpression("upper", {field0},
+                                               field("upper", arrow::utf8()));
+
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {upper}, TestConfiguration(), &projector));
+
+  for (const std::string& value : {"ab", "cdefghijklmnopqrstuvwxyz", "", "x"}) {
+    std::string expected_value = value;
+    std::transform(value.begin(), value.end(), expected_value.begin(), ::toupper);
+
+    int num_records = 1000;
+    std::vector<bool> validity(num_records, true);
+    validity[1] = false;
+    auto array0 = MakeArrowArrayUtf8(std::vector<std::string>(num_records, value),
+                                     validity);
+    auto expected = MakeArrowArrayUtf8(
+        std::vector<std::string>(num_records, expected_value), validity);
+    auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0});
+
+    arrow::ArrayVector outputs;
+    ASSERT_OK(projector->Evaluate(*in_batch, pool_, &outputs));
+    EXPECT_ARROW_ARRAY_EQUALS(expected, outputs.at(0));
+  }
+}
+
 }  // namespace gandiva
@@ -218,6 +218,30 @@ Java_org_apache_arrow_adapter_orc_OrcReaderJniWrapper_nextStripeReader(JNIEnv* e
   return orc_stripe_reader_holder_.Insert(stripe_reader);
 }
 
+JNIEXPORT jlong JNICALL
+Java_org_apache_arrow_adapter_orc_OrcReaderJniWrapper_openRecordBatchReader(
+    JNIEnv* env, jobject this_obj, jlong id, jlong batch_size) {
+  auto reader = GetFileReader(env, id);
+  if (!reader) {
+    return static_cast<jlong>(arrow::StatusCode::Invalid) * -1;
+  }
+
+  // Decode the following stripes on the CPU thread pool while Java consumes the
+  // batches of the current one.  The setting is captured by the returned reader,
+  // so it is restored for the other reads through the same file reader.
+  const bool use_threads = reader->use_threads();
+  reader->set_use_threads(true);
+  std::shared_ptr<RecordBatchReader> batch_reader;
+  auto status = reader->GetRecordBatchReader(batch_size, {}, &batch_reader);
+  reader->set_use_threads(use_threads);
+
+  if (!status.ok()) {
+    return static_cast<jlong>(status.code()) * -1;
+  }
+
+  return orc_stripe_reader_holder_.Insert(batch_reader);
+}
+
 JNIEXPORT jbyteArray JNICALL
 Java_org_apache_arrow_adapter_orc_OrcStripeReaderJniWrapper_getSchema(JNIEnv* env,
                                                                       jclass this_cls,
@@ -38,6 +38,7 @@
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/range.h"
@@ -1911,6 +1912,40 @@ TEST(TestArrowReadWrite, MultithreadedRead) {
   ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result));
 }
 
+TEST(TestArrowReadWrite, MultithreadedWrite) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+  const int64_t row_group_size = 300;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 2, &table));
+  std::shared_ptr<DataType> list_type;
+  std::shared_ptr<Array> list_array;
+  ASSERT_NO_FATAL_FAILURE(
+      MakeSimpleListArray(table->num_rows(), 20, "item", &list_type, &list_array));
+  ASSERT_OK_AND_ASSIGN(table,
+                       table->AddColumn(num_columns / 2, ::arrow::field("list", list_type),
+                                        std::make_shared<ChunkedArray>(list_array)));
+
+  std::shared_ptr<Buffer> expected;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(
+      table, row_group_size, default_arrow_writer_properties(), &expected));
+
+  // The threaded writer lays out the file exactly as the serial one, whether
+  // all the columns are encoded at once or one at a time
+  for (int64_t max_buffered_bytes : {kArrowDefaultMaxBufferedBytes, int64_t(1)}) {
+    auto arrow_properties = ArrowWriterProperties::Builder()
+                                .set_use_threads(true)
+                                ->set_max_buffered_bytes(max_buffered_bytes)
+                                ->build();
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_NO_FATAL_FAILURE(
+        WriteTableToBuffer(table, row_group_size, arrow_properties, &buffer));
+    ASSERT_TRUE(buffer->Equals(*expected));
+    ASSERT_NO_FATAL_FAILURE(CheckSimpleRoundtrip(table, row_group_size, arrow_properties));
+  }
+}
+
 TEST(TestArrowReadWrite, ReadSingleRowGroup) {
   const int num_columns = 10;
   const int num_rows = 100;
@@ -2084,6 +2119,79 @@ TEST(TestArrowReadWrite, GetRecordBatchReaderNoColumns) {
   ASSERT_EQ(actual_batch->num_rows(), num_rows);
 }
 
+void TestReadRowGroupsAsync(ArrowReaderProperties properties) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+  const int batch_size = 100;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 4,
+                                             default_arrow_writer_properties(), &buffer));
+
+  properties.set_batch_size(batch_size);
+
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+  const std::vector<int> row_groups = {3, 0, 2};
+  const std::vector<int> column_indices = {1, 5, 7};
+  std::shared_ptr<Table> expected;
+  ASSERT_OK(reader->ReadRowGroups(row_groups, column_indices, &expected));
+
+  auto future = reader->ReadRowGroupsAsync(row_groups, column_indices);
+  ASSERT_OK_AND_ASSIGN(auto actual, future.result());
+  ASSERT_NO_FATAL_FAILURE(
+      ::arrow::AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false));
+
+  for (int readahead : {0, 2}) {
+    SCOPED_TRACE("readahead = " + std::to_string(readahead));
+    ASSERT_OK_AND_ASSIGN(auto generator, reader->GetRecordBatchGenerator(
+                                             row_groups, column_indices,
+                                             /*cpu_executor=*/nullptr, readahead));
+    ASSERT_OK_AND_ASSIGN(auto batches,
+                         ::arrow::CollectAsyncGenerator(generator).result());
+    for (const auto& batch : batches) {
+      ASSERT_LE(batch->num_rows(), batch_size);
+    }
+    ASSERT_OK_AND_ASSIGN(actual, Table::FromRecordBatches(expected->schema(), batches));
+    ASSERT_NO_FATAL_FAILURE(
+        ::arrow::AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false));
+    // An exhausted generator keeps signalling the end
+    ASSERT_OK_AND_EQ(nullptr, generator().result());
+  }
+
+  // No columns
+  ASSERT_OK_AND_ASSIGN(auto generator, reader->GetRecordBatchGenerator({0, 1}, {}));
+  ASSERT_OK_AND_ASSIGN(auto batches, ::arrow::CollectAsyncGenerator(generator).result());
+  int64_t rows_read = 0;
+  for (const auto& batch : batches) {
+    ASSERT_EQ(batch->num_columns(), 0);
+    rows_read += batch->num_rows();
+  }
+  ASSERT_EQ(rows_read, num_rows / 2);
+
+  ASSERT_RAISES(Invalid, reader->ReadRowGroupsAsync({4}, column_indices).status());
+  ASSERT_RAISES(Invalid, reader->GetRecordBatchGenerator({4}, column_indices));
+}
+
+TEST(TestArrowReadWrite, ReadRowGroupsAsync) {
+  TestReadRowGroupsAsync(default_arrow_reader_properties());
+}
+
+// Same as the test above, but pre-buffering the column chunks and decoding
+// the columns in parallel.
+TEST(TestArrowReadWrite, ReadRowGroupsAsyncPreBuffered) {
+  ArrowReaderProperties arrow_properties = default_arrow_reader_properties();
+  arrow_properties.set_pre_buffer(true);
+  arrow_properties.set_use_threads(true);
+  TestReadRowGroupsAsync(arrow_properties);
+}
+
 TEST(TestArrowReadWrite, ScanContents) {
   const int num_columns = 20;
   const int num_rows = 1000;
@@ -2172,6 +2280,83 @@ TEST(TestArrowReadWrite, ReadCoalescedColumnSubset) {
   }
 }
 
+TEST(TestArrowReadWrite, ReadSelectedRows) {
+  const int64_t num_rows = 10000;
+  ::arrow::random::RandomArrayGenerator rag(42);
+
+  std::vector<int32_t> offsets = {0};
+  for (int64_t i = 0; i < num_rows; ++i) {
+    offsets.push_back(offsets.back() + static_cast<int32_t>(i % 3));
+  }
+  std::shared_ptr<Array> list_offsets;
+  ::arrow::ArrayFromVector<::arrow::Int32Type>(offsets, &list_offsets);
+  ASSERT_OK_AND_ASSIGN(auto list, ListArray::FromArrays(
+                                      *list_offsets, *rag.Int32(offsets.back(), 0, 100)));
+
+  auto schema = ::arrow::schema({::arrow::field("a", ::arrow::int64(), false),
+                                 ::arrow::field("b", ::arrow::utf8()),
+                                 ::arrow::field("c", list->type(), false)});
+  auto table = Table::Make(schema, {rag.Int64(num_rows, 0, 1000),
+                                    rag.String(num_rows, 0, 10, /*null_probability=*/0.1),
+                                    list});
+
+  // Small pages, so that whole pages get skipped
+  auto sink = CreateOutputStream();
+  auto write_props =
+      WriterProperties::Builder().write_batch_size(100)->data_pagesize(1024)->build();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink, num_rows,
+                                write_props, default_arrow_writer_properties()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  // Long and short runs of selected and unselected rows, and nulls
+  auto random_selection = std::static_pointer_cast<::arrow::BooleanArray>(
+      rag.Boolean(num_rows, /*true_probability=*/0.2, /*null_probability=*/0.1));
+  std::vector<bool> selected(num_rows), is_valid(num_rows, true);
+  for (int64_t i = 0; i < num_rows; ++i) {
+    if (i >= 5000 && i < 7000) {
+      selected[i] = random_selection->Value(i);
+      is_valid[i] = random_selection->IsValid(i);
+    } else {
+      selected[i] = (i >= 3000 && i < 3010) || i >= 9000;
+    }
+  }
+  std::shared_ptr<Array> selection;
+  ::arrow::ArrayFromVector<::arrow::BooleanType, bool>(is_valid, selected, &selection);
+
+  for (bool use_threads : {false, true}) {
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                                ::arrow::default_memory_pool(), &reader));
+    reader->set_use_threads(use_threads);
+
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadRowGroup(
+        0, {0, 1, 2}, static_cast<const ::arrow::BooleanArray&>(*selection), &result));
+    ASSERT_OK(result->ValidateFull());
+    ASSERT_OK_AND_ASSIGN(auto expected, ::arrow::compute::Filter(table, selection));
+    ::arrow::AssertTablesEqual(*expected.table(), *result, /*same_chunk_layout=*/false);
+
+    // Single column, and nothing selected
+    ASSERT_OK_NO_THROW(reader->ReadRowGroup(
+        0, {1}, static_cast<const ::arrow::BooleanArray&>(*selection), &result));
+    ASSERT_EQ(expected.table()->num_rows(), result->num_rows());
+    std::shared_ptr<Array> none;
+    ::arrow::ArrayFromVector<::arrow::BooleanType, bool>(
+        std::vector<bool>(num_rows, false), &none);
+    ASSERT_OK_NO_THROW(reader->ReadRowGroup(
+        0, {0, 1, 2}, static_cast<const ::arrow::BooleanArray&>(*none), &result));
+    ASSERT_OK(result->ValidateFull());
+    ASSERT_EQ(0, result->num_rows());
+  }
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+  auto too_short = std::static_pointer_cast<::arrow::BooleanArray>(selection->Slice(1));
+  std::shared_ptr<Table> result;
+  ASSERT_RAISES(Invalid, reader->ReadRowGroup(0, {0}, *too_short, &result));
+}
+
 TEST(TestArrowReadWrite, ListLargeRecords) {
   // PARQUET-1308: This test passed on Linux when num_rows was smaller
   const int num_rows = 2000;
@@ -2220,6 +2405,68 @@ TEST(TestArrowReadWrite, ListLargeRecords) {
   ASSERT_TRUE(table->Equals(*chunked_table));
 }
 
+TEST(TestArrowReadWrite, NextBatchInto) {
+  const int num_rows = 1000;
+  const int64_t row_group_size = 300;
+  const int64_t batch_size = 128;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(/*num_columns=*/1, num_rows, 1, &table));
+  std::shared_ptr<DataType> list_type;
+  std::shared_ptr<Array> list_array;
+  ASSERT_NO_FATAL_FAILURE(
+      MakeSimpleListArray(num_rows, 20, "item", &list_type, &list_array));
+  ASSERT_OK_AND_ASSIGN(table,
+                       table->AddColumn(1, ::arrow::field("list", list_type),
+                                        std::make_shared<ChunkedArray>(list_array)));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, row_group_size,
+                                             default_arrow_writer_properties(), &buffer));
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+
+  // Decode the batches one after the other into the same preallocated buffers
+  std::unique_ptr<ColumnReader> col_reader;
+  ASSERT_OK(reader->GetColumn(0, &col_reader));
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Buffer> values,
+                       ::arrow::AllocateBuffer(num_rows * sizeof(double)));
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Buffer> valid_bits,
+                       ::arrow::AllocateBitmap(num_rows));
+  int64_t offset = 0;
+  int64_t null_count = 0;
+  while (true) {
+    int64_t values_read = 0;
+    int64_t batch_null_count = 0;
+    ASSERT_OK(col_reader->NextBatchInto(std::min(batch_size, num_rows - offset), offset,
+                                        values.get(), valid_bits.get(), &values_read,
+                                        &batch_null_count));
+    if (values_read == 0) {
+      break;
+    }
+    offset += values_read;
+    null_count += batch_null_count;
+  }
+  ASSERT_EQ(num_rows, offset);
+  ::arrow::DoubleArray result(num_rows, values, valid_bits, null_count);
+  ASSERT_OK(result.ValidateFull());
+  ::arrow::AssertArraysEqual(*table->column(0)->chunk(0), result);
+
+  // The buffers must hold the whole batch
+  ASSERT_OK(reader->GetColumn(0, &col_reader));
+  int64_t values_read = 0;
+  ASSERT_RAISES(Invalid, col_reader->NextBatchInto(num_rows, 1, values.get(),
+                                                   valid_bits.get(), &values_read,
+                                                   &null_count));
+
+  // Lists can't be decoded in place
+  ASSERT_OK(reader->GetColumn(1, &col_reader));
+  ASSERT_RAISES(NotImplemented,
+                col_reader->NextBatchInto(batch_size, 0, values.get(), valid_bits.get(),
+                                          &values_read, &null_count));
+}
+
 typedef std::function<void(int, std::shared_ptr<DataType>*, std::shared_ptr<Array>*)>
     ArrayFactory;
 
@@ -2464,6 +2711,31 @@ TEST(TestArrowReadWrite, DictionaryColumnChunkedWrite) {
   ::arrow::AssertTablesEqual(*expected_table, *result, false);
 }
 
+TEST(TestArrowReadWrite, ReadRunEndEncoded) {
+  auto values = ::arrow::ArrayFromJSON(::arrow::int64(), "[1, 1, 1, null, null, 2, 2]");
+  auto names = ::arrow::ArrayFromJSON(::arrow::utf8(),
+                                      R"(["a", "a", "b", "b", "b", "c", "c"])");
+  auto table = Table::Make(::arrow::schema({::arrow::field("values", values->type()),
+                                            ::arrow::field("names", names->type())}),
+                           {values, names});
+
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_read_run_end_encoded(0, true);
+  std::shared_ptr<Table> result;
+  ASSERT_NO_FATAL_FAILURE(DoRoundtrip(table, /*row_group_size=*/4, &result,
+                                      default_writer_properties(),
+                                      default_arrow_writer_properties(), properties));
+  ASSERT_OK(result->ValidateFull());
+
+  ASSERT_TRUE(result->schema()->field(0)->type()->Equals(
+      ::arrow::run_end_encoded(::arrow::int32(), ::arrow::int64())));
+  ASSERT_OK_AND_ASSIGN(Datum decoded, ::arrow::compute::RunEndDecode(result->column(0)));
+  ::arrow::AssertChunkedEquivalent(ChunkedArray(values), *decoded.chunked_array());
+
+  ASSERT_TRUE(result->schema()->field(1)->type()->Equals(::arrow::utf8()));
+  ::arrow::AssertChunkedEquivalent(ChunkedArray(names), *result->column(1));
+}
+
 TEST(TestArrowWrite, CheckChunkSize) {
   const int num_columns = 2;
   const int num_rows = 128;
@@ -3127,6 +3399,48 @@ TEST_P(TestArrowReadDictionary, ReadWholeFileDict) {
   CheckReadWholeFile(*ex_table);
 }
 
+TEST_P(TestArrowReadDictionary, ReadIdenticalDictionaries) {
+  properties_.set_read_dictionary(0, true);
+
+  // Repeat the values of the first row group, so that all row groups have the
+  // same dictionary
+  auto chunk_size = options.num_rows / options.num_row_groups;
+  ::arrow::ArrayVector repeated(options.num_row_groups,
+                                dense_values_->Slice(0, chunk_size));
+  ASSERT_OK_AND_ASSIGN(dense_values_, ::arrow::Concatenate(repeated));
+  expected_dense_ = MakeSimpleTable(dense_values_, /*nullable=*/true);
+  WriteSimple();
+
+  // The row groups are read as a single chunk
+  ASSERT_OK_AND_ASSIGN(auto reader, GetReader());
+  std::shared_ptr<ChunkedArray> actual;
+  ASSERT_OK_NO_THROW(reader->ReadColumn(0, &actual));
+  ASSERT_EQ(1, actual->num_chunks());
+  ASSERT_OK_AND_ASSIGN(auto dense,
+                       ::arrow::compute::Cast(Datum(actual), ::arrow::utf8()));
+  AssertChunkedEqual(ChunkedArray(dense_values_), *dense.chunked_array());
+
+  // Batches read separately share the dictionary values
+  properties_.set_batch_size(chunk_size);
+  ASSERT_OK_AND_ASSIGN(reader, GetReader());
+  std::unique_ptr<::arrow::RecordBatchReader> batch_reader;
+  ASSERT_OK(reader->GetRecordBatchReader(
+      ::arrow::internal::Iota(options.num_row_groups), &batch_reader));
+  std::shared_ptr<::arrow::RecordBatch> batch;
+  std::shared_ptr<Buffer> dictionary_data;
+  while (true) {
+    ASSERT_OK(batch_reader->ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    const auto& dictionary = batch->column(0)->data()->dictionary;
+    if (dictionary_data == nullptr) {
+      dictionary_data = dictionary->buffers[2];
+    }
+    ASSERT_EQ(dictionary_data, dictionary->buffers[2]);
+  }
+}
+
 TEST_P(TestArrowReadDictionary, ZeroChunksListOfDictionary) {
   // ARROW-8799
   properties_.set_read_dictionary(0, true);
@@ -398,25 +398,38 @@ class ListPathNode {
     //
     // Given these preconditions it should be safe to fill runs on non-empty
     // lists here and expand the range in the child node accordingly.
-
-    while (!range->Empty()) {
-      ElementRange size_check = selector_.GetRange(range->start);
+    //
+    // Locate the end of the run of non-empty lists first so that their
+    // rep-levels can be filled in bulk rather than list by list.
+    const int64_t child_start = child_range->end;
+    int64_t run_end = range->start;
+    while (run_end < range->end) {
+      ElementRange size_check = selector_.GetRange(run_end);
       if (size_check.Empty()) {
         // The empty range will need to be handled after we pass down the accumulated
         // range because it affects def_level placement and we need to get the children
         // def_levels entered first.
         break;
       }
-      // This is the start of a new list. We can be sure it only applies
-      // to the previous list (and doesn't jump to the start of any list
-      // further up in nesting due to the constraints mentioned at the start
-      // of the function).
-      RETURN_IF_ERROR(context->AppendRepLevel(prev_rep_level_));
-      RETURN_IF_ERROR(context->AppendRepLevels(size_check.Size() - 1, rep_level_));
       DCHECK_EQ(size_check.start, child_range->end);
       child_range->end = size_check.end;
-      ++range->start;
+      ++run_end;
+    }
+
+    const int64_t num_levels = child_range->end - child_start;
+    if (num_levels > 0) {
+      RETURN_IF_ERROR(context->AppendRepLevels(num_levels, rep_level_));
+      // Each list in the run starts a new list, which only applies to the
+      // previous list (and doesn't jump to the start of any list further up
+      // in nesting due to the constraints mentioned at the start of the
+      // function).
+      int16_t* rep_levels =
+          context->rep_levels.mutable_data() + context->rep_levels.length() - num_levels;
+      for (int64_t i = range->start; i < run_end; ++i) {
+        rep_levels[selector_.GetRange(i).start - child_start] = prev_rep_level_;
+      }
     }
+    range->start = run_end;
 
     // Do book-keeping to track the elements of the arrays that are actually visited
     // beyond this point.  This is necessary to identify "gaps" in values that should
@@ -834,6 +847,8 @@ class PathBuilder {
 
   // Union types aren't supported in Parquet.
   NOT_IMPLEMENTED_VISIT(Union)
+  // Run-end encoded arrays can be read from Parquet but not written yet.
+  NOT_IMPLEMENTED_VISIT(RunEndEncoded)
 
 #undef NOT_IMPLEMENTED_VISIT
   std::vector<PathInfo>& paths() { return paths_; }
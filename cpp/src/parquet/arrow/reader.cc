@@ -18,22 +18,30 @@
 #include "parquet/arrow/reader.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <deque>
+#include <mutex>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/io/memory.h"
+#include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/range.h"
 #include "arrow/util/thread_pool.h"
+#include "arrow/util/tracing.h"
 #include "parquet/arrow/reader_internal.h"
 #include "parquet/column_reader.h"
 #include "parquet/exception.h"
@@ -51,6 +59,7 @@ using arrow::Future;
 using arrow::Int32Array;
 using arrow::ListArray;
 using arrow::MemoryPool;
+using arrow::RecordBatch;
 using arrow::RecordBatchReader;
 using arrow::ResizableBuffer;
 using arrow::Status;
@@ -82,6 +91,9 @@ class ColumnReaderImpl : public ColumnReader {
  public:
   enum ReaderType { PRIMITIVE, LIST, STRUCT };
 
+  /// \brief Skip the next num_records records without materializing them
+  virtual Status SkipRecords(int64_t num_records) = 0;
+
   virtual Status GetDefLevels(const int16_t** data, int64_t* length) = 0;
   virtual Status GetRepLevels(const int16_t** data, int64_t* length) = 0;
   virtual const std::shared_ptr<Field> field() = 0;
@@ -91,6 +103,101 @@ class ColumnReaderImpl : public ColumnReader {
   virtual ReaderType type() const = 0;
 };
 
+namespace {
+
+// Whether the values of |type| are laid out as the |physical_type| values
+// they are read from, so that they can be decoded in place
+bool HasPhysicalRepresentation(const DataType& type,
+                               ::parquet::Type::type physical_type) {
+  switch (type.id()) {
+    case ::arrow::Type::INT32:
+    case ::arrow::Type::UINT32:
+    case ::arrow::Type::DATE32:
+    case ::arrow::Type::TIME32:
+      return physical_type == ::parquet::Type::INT32;
+    case ::arrow::Type::INT64:
+    case ::arrow::Type::UINT64:
+    case ::arrow::Type::TIME64:
+    case ::arrow::Type::TIMESTAMP:
+      return physical_type == ::parquet::Type::INT64;
+    case ::arrow::Type::FLOAT:
+      return physical_type == ::parquet::Type::FLOAT;
+    case ::arrow::Type::DOUBLE:
+      return physical_type == ::parquet::Type::DOUBLE;
+    default:
+      return false;
+  }
+}
+
+// A run of rows of a row group to read, of which only those set in the
+// selection are kept
+struct RowRange {
+  int64_t offset;
+  int64_t length;
+  // Whether some of the rows of the range aren't selected
+  bool filtered;
+};
+
+// Runs of unselected rows shorter than this are decoded then filtered out
+// rather than skipped, to avoid slicing the columns into many small chunks
+constexpr int64_t kMinRowsToSkip = 1024;
+
+std::vector<RowRange> SelectedRowRanges(const BooleanArray& selection) {
+  auto selected = [&](int64_t i) { return selection.IsValid(i) && selection.Value(i); };
+
+  std::vector<RowRange> ranges;
+  const int64_t length = selection.length();
+  int64_t i = 0;
+  while (i < length) {
+    while (i < length && !selected(i)) {
+      ++i;
+    }
+    if (i == length) {
+      break;
+    }
+    const int64_t start = i;
+    while (i < length && selected(i)) {
+      ++i;
+    }
+    if (!ranges.empty() &&
+        start - (ranges.back().offset + ranges.back().length) < kMinRowsToSkip) {
+      ranges.back().length = i - ranges.back().offset;
+      ranges.back().filtered = true;
+    } else {
+      ranges.push_back({start, i - start, false});
+    }
+  }
+  return ranges;
+}
+
+Status ReadRowRanges(ColumnReaderImpl* reader, const BooleanArray& selection,
+                     const std::vector<RowRange>& ranges, MemoryPool* pool,
+                     std::shared_ptr<ChunkedArray>* out) {
+  ::arrow::compute::ExecContext ctx(pool);
+  ::arrow::ArrayVector chunks;
+  int64_t position = 0;
+  for (const auto& range : ranges) {
+    if (range.offset > position) {
+      RETURN_NOT_OK(reader->SkipRecords(range.offset - position));
+    }
+    std::shared_ptr<ChunkedArray> column;
+    RETURN_NOT_OK(reader->NextBatch(range.length, &column));
+    if (range.filtered) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto filtered,
+          ::arrow::compute::Filter(column, selection.Slice(range.offset, range.length),
+                                   ::arrow::compute::FilterOptions::Defaults(), &ctx));
+      column = filtered.chunked_array();
+    }
+    chunks.insert(chunks.end(), column->chunks().begin(), column->chunks().end());
+    position = range.offset + range.length;
+  }
+  *out = std::make_shared<ChunkedArray>(std::move(chunks), reader->field()->type());
+  return Status::OK();
+}
+
+}  // namespace
+
 std::shared_ptr<std::unordered_set<int>> VectorToSharedSet(
     const std::vector<int>& values) {
   std::shared_ptr<std::unordered_set<int>> result(new std::unordered_set<int>());
@@ -105,7 +212,7 @@ class FileReaderImpl : public FileReader {
  public:
   FileReaderImpl(MemoryPool* pool, std::unique_ptr<ParquetFileReader> reader,
                  ArrowReaderProperties properties)
-      : pool_(pool),
+      : pool_(::arrow::GetTaggedMemoryPool(pool, "parquet")),
         reader_(std::move(reader)),
         reader_properties_(std::move(properties)) {}
 
@@ -272,6 +379,10 @@ class FileReaderImpl : public FileReader {
     return ReadRowGroup(i, Iota(reader_->metadata()->num_columns()), table);
   }
 
+  Status ReadRowGroup(int i, const std::vector<int>& column_indices,
+                      const BooleanArray& selection,
+                      std::shared_ptr<Table>* out) override;
+
   Status GetRecordBatchReader(const std::vector<int>& row_group_indices,
                               const std::vector<int>& column_indices,
                               std::unique_ptr<RecordBatchReader>* out) override;
@@ -282,6 +393,60 @@ class FileReaderImpl : public FileReader {
                                 Iota(reader_->metadata()->num_columns()), out);
   }
 
+  Future<std::shared_ptr<Table>> ReadRowGroupsAsync(
+      const std::vector<int>& row_groups, const std::vector<int>& column_indices,
+      ::arrow::internal::Executor* cpu_executor) override;
+
+  ::arrow::Result<::arrow::AsyncGenerator<std::shared_ptr<RecordBatch>>>
+  GetRecordBatchGenerator(const std::vector<int>& row_group_indices,
+                          const std::vector<int>& column_indices,
+                          ::arrow::internal::Executor* cpu_executor,
+                          int row_group_readahead) override;
+
+  // Pre-buffer the given column chunks if pre_buffer is enabled
+  Status PreBuffer(const std::vector<int>& row_groups,
+                   const std::vector<int>& column_indices) {
+    if (reader_properties_.pre_buffer()) {
+      BEGIN_PARQUET_CATCH_EXCEPTIONS
+      reader_->PreBuffer(row_groups, column_indices, reader_properties_.async_context(),
+                         reader_properties_.cache_options());
+      END_PARQUET_CATCH_EXCEPTIONS
+    }
+    return Status::OK();
+  }
+
+  // Return a Future completing once the given column chunks are pre-buffered,
+  // right away if pre_buffer is disabled
+  Future<void> WhenBuffered(const std::vector<int>& row_groups,
+                            const std::vector<int>& column_indices) const {
+    if (!reader_properties_.pre_buffer()) {
+      return Future<void>::MakeFinished();
+    }
+    return reader_->WhenBuffered(row_groups, column_indices);
+  }
+
+  // Decode the given columns of the given row groups on the executor, once
+  // `buffered` completes
+  Future<std::shared_ptr<Table>> DecodeRowGroupsAsync(
+      std::vector<int> row_groups, std::vector<int> column_indices,
+      ::arrow::internal::Executor* executor, Future<void> buffered);
+
+  Status MakeTable(std::shared_ptr<::arrow::Schema> schema,
+                   ::arrow::ChunkedArrayVector columns,
+                   const std::vector<int>& row_groups, std::shared_ptr<Table>* out) {
+    int64_t num_rows = 0;
+    if (!columns.empty()) {
+      num_rows = columns[0]->length();
+    } else {
+      for (int i : row_groups) {
+        num_rows += parquet_reader()->metadata()->RowGroup(i)->num_rows();
+      }
+    }
+
+    *out = Table::Make(std::move(schema), std::move(columns), num_rows);
+    return (*out)->Validate();
+  }
+
   int num_columns() const { return reader_->metadata()->num_columns(); }
 
   ParquetFileReader* parquet_reader() const override { return reader_.get(); }
@@ -396,6 +561,7 @@ class LeafReader : public ColumnReaderImpl {
   }
 
   Status NextBatch(int64_t records_to_read, std::shared_ptr<ChunkedArray>* out) override {
+    ::arrow::util::TraceSpan span("parquet", "DecodeColumn");
     BEGIN_PARQUET_CATCH_EXCEPTIONS
     record_reader_->Reset();
     // Pre-allocation gives much better performance for flat columns
@@ -416,6 +582,70 @@ class LeafReader : public ColumnReaderImpl {
     END_PARQUET_CATCH_EXCEPTIONS
   }
 
+  Status NextBatchInto(int64_t batch_size, int64_t offset, ::arrow::Buffer* values,
+                       ::arrow::Buffer* valid_bits, int64_t* values_read,
+                       int64_t* null_count) override {
+    if (descr_->max_repetition_level() > 0 ||
+        !HasPhysicalRepresentation(*field_->type(), descr_->physical_type())) {
+      return Status::NotImplemented("Cannot decode ", field_->type()->ToString(),
+                                    " values read from ",
+                                    TypeToString(descr_->physical_type()),
+                                    " into caller-provided buffers");
+    }
+    const int64_t byte_width = GetTypeByteSize(descr_->physical_type());
+    if (!values->is_mutable() || values->size() < (offset + batch_size) * byte_width) {
+      return Status::Invalid("Values buffer is not mutable or too small");
+    }
+    if (valid_bits == nullptr) {
+      if (descr_->max_definition_level() > 0) {
+        return Status::Invalid("A validity bitmap is required for nullable columns");
+      }
+    } else if (!valid_bits->is_mutable() ||
+               valid_bits->size() < ::arrow::BitUtil::BytesForBits(offset + batch_size)) {
+      return Status::Invalid("Validity bitmap is not mutable or too small");
+    }
+
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    record_reader_->Reset();
+    *values_read = 0;
+    *null_count = 0;
+    while (*values_read < batch_size && record_reader_->HasMoreData()) {
+      const int64_t position = offset + *values_read;
+      int64_t batch_null_count = 0;
+      const int64_t records_read = record_reader_->ReadRecordsInto(
+          batch_size - *values_read, values->mutable_data() + position * byte_width,
+          valid_bits != nullptr ? valid_bits->mutable_data() : nullptr, position,
+          &batch_null_count);
+      if (records_read == 0) {
+        NextRowGroup();
+      }
+      *values_read += records_read;
+      *null_count += batch_null_count;
+    }
+    if (valid_bits != nullptr && !record_reader_->nullable_values()) {
+      ::arrow::BitUtil::SetBitsTo(valid_bits->mutable_data(), offset, *values_read,
+                                  true);
+    }
+    return Status::OK();
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
+  Status SkipRecords(int64_t num_records) override {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    while (num_records > 0) {
+      if (!record_reader_->HasMoreData()) {
+        break;
+      }
+      int64_t records_skipped = record_reader_->SkipRecords(num_records);
+      num_records -= records_skipped;
+      if (records_skipped == 0) {
+        NextRowGroup();
+      }
+    }
+    return Status::OK();
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
   const std::shared_ptr<Field> field() override { return field_; }
   const ColumnDescriptor* descr() const override { return descr_; }
 
@@ -489,6 +719,10 @@ class NestedListReader : public ColumnReaderImpl {
     return Status::OK();
   }
 
+  Status SkipRecords(int64_t num_records) override {
+    return item_reader_->SkipRecords(num_records);
+  }
+
   const std::shared_ptr<Field> field() override { return field_; }
 
   const ColumnDescriptor* descr() const override { return nullptr; }
@@ -516,6 +750,12 @@ class PARQUET_NO_EXPORT StructReader : public ColumnReaderImpl {
         children_(std::move(children)) {}
 
   Status NextBatch(int64_t records_to_read, std::shared_ptr<ChunkedArray>* out) override;
+  Status SkipRecords(int64_t num_records) override {
+    for (auto& child : children_) {
+      RETURN_NOT_OK(child->SkipRecords(num_records));
+    }
+    return Status::OK();
+  }
   Status GetDefLevels(const int16_t** data, int64_t* length) override;
   Status GetRepLevels(const int16_t** data, int64_t* length) override;
   const std::shared_ptr<Field> field() override { return filtered_field_; }
@@ -875,16 +1115,222 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
     }
   }
 
-  int64_t num_rows = 0;
-  if (!columns.empty()) {
-    num_rows = columns[0]->length();
-  } else {
-    for (int i : row_groups) {
-      num_rows += parquet_reader()->metadata()->RowGroup(i)->num_rows();
+  return MakeTable(std::move(result_schema), std::move(columns), row_groups, out);
+}
+
+Future<std::shared_ptr<Table>> FileReaderImpl::DecodeRowGroupsAsync(
+    std::vector<int> row_groups, std::vector<int> column_indices,
+    ::arrow::internal::Executor* executor, Future<void> buffered) {
+  using TableFuture = Future<std::shared_ptr<Table>>;
+  using ColumnReaders = std::vector<std::shared_ptr<ColumnReaderImpl>>;
+
+  // Continue on the executor rather than in the I/O thread which fetched the
+  // last column chunk
+  return executor->Transfer(std::move(buffered))
+      .Then([this, row_groups, column_indices, executor]() -> TableFuture {
+        auto readers = std::make_shared<ColumnReaders>();
+        std::shared_ptr<::arrow::Schema> result_schema;
+        Status st =
+            GetFieldReaders(column_indices, row_groups, readers.get(), &result_schema);
+        if (!st.ok()) {
+          return TableFuture::MakeFinished(std::move(st));
+        }
+
+        auto columns = std::make_shared<::arrow::ChunkedArrayVector>(readers->size());
+        auto ReadColumnFunc = [this, row_groups, readers, columns](size_t i) {
+          return ReadColumn(static_cast<int>(i), row_groups, (*readers)[i].get(),
+                            &(*columns)[i]);
+        };
+
+        std::vector<Future<Status>> futures;
+        if (reader_properties_.use_threads()) {
+          for (size_t i = 0; i < readers->size(); ++i) {
+            auto maybe_future = executor->Submit(ReadColumnFunc, i);
+            futures.push_back(maybe_future.ok()
+                                  ? *maybe_future
+                                  : Future<Status>::MakeFinished(maybe_future.status()));
+          }
+        } else {
+          for (size_t i = 0; i < readers->size() && st.ok(); ++i) {
+            st = ReadColumnFunc(i);
+          }
+          futures.push_back(Future<Status>::MakeFinished(std::move(st)));
+        }
+
+        return ::arrow::AllComplete(futures).Then(
+            [this, row_groups, result_schema,
+             columns]() -> ::arrow::Result<std::shared_ptr<Table>> {
+              std::shared_ptr<Table> table;
+              RETURN_NOT_OK(MakeTable(result_schema, std::move(*columns), row_groups,
+                                      &table));
+              return table;
+            });
+      });
+}
+
+Future<std::shared_ptr<Table>> FileReaderImpl::ReadRowGroupsAsync(
+    const std::vector<int>& row_groups, const std::vector<int>& column_indices,
+    ::arrow::internal::Executor* cpu_executor) {
+  using TableFuture = Future<std::shared_ptr<Table>>;
+  Status st = BoundsCheck(row_groups, column_indices);
+  if (st.ok()) {
+    st = PreBuffer(row_groups, column_indices);
+  }
+  if (!st.ok()) {
+    return TableFuture::MakeFinished(std::move(st));
+  }
+  if (cpu_executor == nullptr) {
+    cpu_executor = ::arrow::internal::GetCpuThreadPool();
+  }
+  return DecodeRowGroupsAsync(row_groups, column_indices, cpu_executor,
+                              WhenBuffered(row_groups, column_indices));
+}
+
+namespace {
+
+// Make a generator splitting the tables of another generator into record
+// batches of at most batch_size rows
+::arrow::AsyncGenerator<std::shared_ptr<RecordBatch>> MakeTableBatchGenerator(
+    ::arrow::AsyncGenerator<std::shared_ptr<Table>> tables, int64_t batch_size) {
+  using BatchFuture = Future<std::shared_ptr<RecordBatch>>;
+
+  struct State {
+    ::arrow::AsyncGenerator<std::shared_ptr<Table>> tables;
+    int64_t batch_size;
+    // The batches of the current table which weren't yielded yet
+    std::deque<std::shared_ptr<RecordBatch>> batches;
+    bool finished = false;
+
+    std::mutex mutex;
+    // The Future of the last call.  Each call continues it, so that calls
+    // consume the batches (and the tables) in order.
+    BatchFuture last;
+
+    Status Split(const Table& table) {
+      if (table.num_columns() == 0) {
+        // TableBatchReader doesn't support tables without columns
+        auto max_sized_batch =
+            RecordBatch::Make(table.schema(), batch_size, ::arrow::ArrayVector{});
+        for (int64_t offset = 0; offset < table.num_rows(); offset += batch_size) {
+          batches.push_back(
+              max_sized_batch->Slice(0, std::min(batch_size, table.num_rows() - offset)));
+        }
+        return Status::OK();
+      }
+      ::arrow::TableBatchReader reader(table);
+      reader.set_chunksize(batch_size);
+      while (true) {
+        std::shared_ptr<RecordBatch> batch;
+        RETURN_NOT_OK(reader.ReadNext(&batch));
+        if (batch == nullptr) {
+          return Status::OK();
+        }
+        batches.push_back(std::move(batch));
+      }
+    }
+
+    static BatchFuture Next(std::shared_ptr<State> state) {
+      if (!state->batches.empty()) {
+        auto batch = std::move(state->batches.front());
+        state->batches.pop_front();
+        return BatchFuture::MakeFinished(std::move(batch));
+      }
+      if (state->finished) {
+        return BatchFuture::MakeFinished(
+            ::arrow::IterationTraits<std::shared_ptr<RecordBatch>>::End());
+      }
+      return state->tables().Then(
+          [state](const std::shared_ptr<Table>& table) -> BatchFuture {
+            if (table == nullptr) {
+              state->finished = true;
+            } else {
+              Status st = state->Split(*table);
+              if (!st.ok()) {
+                return BatchFuture::MakeFinished(std::move(st));
+              }
+            }
+            return Next(state);
+          });
     }
+  };
+
+  auto state = std::make_shared<State>();
+  state->tables = std::move(tables);
+  state->batch_size = batch_size;
+  state->last = BatchFuture::MakeFinished(std::shared_ptr<RecordBatch>());
+  return [state]() {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->last = state->last.Then(
+        [state](const std::shared_ptr<RecordBatch>&) { return State::Next(state); });
+    return state->last;
+  };
+}
+
+}  // namespace
+
+::arrow::Result<::arrow::AsyncGenerator<std::shared_ptr<RecordBatch>>>
+FileReaderImpl::GetRecordBatchGenerator(const std::vector<int>& row_group_indices,
+                                        const std::vector<int>& column_indices,
+                                        ::arrow::internal::Executor* cpu_executor,
+                                        int row_group_readahead) {
+  using TableFuture = Future<std::shared_ptr<Table>>;
+  RETURN_NOT_OK(BoundsCheck(row_group_indices, column_indices));
+  // Pre-buffering replaces the previously buffered column chunks, so all
+  // row groups are pre-buffered at once, then waited for one at a time
+  RETURN_NOT_OK(PreBuffer(row_group_indices, column_indices));
+  if (cpu_executor == nullptr) {
+    cpu_executor = ::arrow::internal::GetCpuThreadPool();
   }
 
-  *out = Table::Make(std::move(result_schema), std::move(columns), num_rows);
+  auto next_index = std::make_shared<std::atomic<size_t>>(0);
+  ::arrow::AsyncGenerator<std::shared_ptr<Table>> tables =
+      [this, row_group_indices, column_indices, cpu_executor, next_index]() {
+        const size_t index = next_index->fetch_add(1);
+        if (index >= row_group_indices.size()) {
+          return TableFuture::MakeFinished(
+              ::arrow::IterationTraits<std::shared_ptr<Table>>::End());
+        }
+        const std::vector<int> row_groups = {row_group_indices[index]};
+        return DecodeRowGroupsAsync(row_groups, column_indices, cpu_executor,
+                                    WhenBuffered(row_groups, column_indices));
+      };
+  if (row_group_readahead > 0) {
+    tables = ::arrow::MakeReadaheadGenerator(std::move(tables), row_group_readahead);
+  }
+  return MakeTableBatchGenerator(std::move(tables), properties().batch_size());
+}
+
+Status FileReaderImpl::ReadRowGroup(int i, const std::vector<int>& column_indices,
+                                    const BooleanArray& selection,
+                                    std::shared_ptr<Table>* out) {
+  RETURN_NOT_OK(BoundsCheck({i}, column_indices));
+  const int64_t num_rows = parquet_reader()->metadata()->RowGroup(i)->num_rows();
+  if (selection.length() != num_rows) {
+    return Status::Invalid("The selection has ", selection.length(),
+                           " values but row group ", i, " has ", num_rows, " rows");
+  }
+
+  if (reader_properties_.pre_buffer()) {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    parquet_reader()->PreBuffer({i}, column_indices, reader_properties_.async_context(),
+                                reader_properties_.cache_options());
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
+  std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
+  std::shared_ptr<::arrow::Schema> result_schema;
+  RETURN_NOT_OK(GetFieldReaders(column_indices, {i}, &readers, &result_schema));
+
+  const std::vector<RowRange> ranges = SelectedRowRanges(selection);
+  ::arrow::ChunkedArrayVector columns(readers.size());
+  RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+      reader_properties_.use_threads(), static_cast<int>(readers.size()),
+      [&](int j) {
+        return ReadRowRanges(readers[j].get(), selection, ranges, pool_, &columns[j]);
+      }));
+
+  *out =
+      Table::Make(std::move(result_schema), std::move(columns), selection.true_count());
   return (*out)->Validate();
 }
 
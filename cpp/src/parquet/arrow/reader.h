@@ -21,12 +21,14 @@
 #include <memory>
 #include <vector>
 
+#include "arrow/util/async_generator.h"
 #include "parquet/file_reader.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 
 namespace arrow {
 
+class BooleanArray;
 class ChunkedArray;
 class KeyValueMetadata;
 class RecordBatchReader;
@@ -193,6 +195,19 @@ class PARQUET_EXPORT FileReader {
 
   virtual ::arrow::Status ReadRowGroup(int i, std::shared_ptr<::arrow::Table>* out) = 0;
 
+  /// \brief Read the given columns of a row group, only keeping the rows
+  /// which are selected
+  ///
+  /// The selection has one value per row of the row group; the rows for which
+  /// it is false or null are dropped. Long runs of dropped rows are skipped
+  /// without decoding them, as are the data pages which only hold dropped
+  /// rows of non-repeated columns. This allows reading the columns a
+  /// predicate depends on first, then only the matching rows of the other
+  /// columns.
+  virtual ::arrow::Status ReadRowGroup(int i, const std::vector<int>& column_indices,
+                                       const ::arrow::BooleanArray& selection,
+                                       std::shared_ptr<::arrow::Table>* out) = 0;
+
   virtual ::arrow::Status ReadRowGroups(const std::vector<int>& row_groups,
                                         const std::vector<int>& column_indices,
                                         std::shared_ptr<::arrow::Table>* out) = 0;
@@ -200,6 +215,40 @@ class PARQUET_EXPORT FileReader {
   virtual ::arrow::Status ReadRowGroups(const std::vector<int>& row_groups,
                                         std::shared_ptr<::arrow::Table>* out) = 0;
 
+  /// \brief Read the given columns of the given row groups into a Table,
+  /// without blocking
+  ///
+  /// If pre_buffer is enabled, the column chunks are fetched through the
+  /// async_context's I/O executor, and the columns are decoded on
+  /// cpu_executor (the CPU thread pool if null) once they are buffered, no
+  /// thread waiting for the I/O in the meantime. Otherwise, the column chunks
+  /// are read by the decoding tasks. The columns are decoded in parallel if
+  /// use_threads is enabled.
+  ///
+  /// The FileReader must outlive the returned Future.
+  virtual ::arrow::Future<std::shared_ptr<::arrow::Table>> ReadRowGroupsAsync(
+      const std::vector<int>& row_groups, const std::vector<int>& column_indices,
+      ::arrow::internal::Executor* cpu_executor = NULLPTR) = 0;
+
+  /// \brief Return a generator of the record batches of the given columns of
+  /// the given row groups
+  ///
+  /// This is the asynchronous counterpart of GetRecordBatchReader(): the row
+  /// groups are read like with ReadRowGroupsAsync(), one at a time, and up
+  /// to row_group_readahead row groups are read ahead of the consumer. If
+  /// pre_buffer is enabled, all the row groups are pre-buffered when the
+  /// generator is created.
+  ///
+  /// FileReaders must outlive their generators.
+  ///
+  /// \returns error Status if either row_group_indices or column_indices
+  ///     contains an invalid index
+  virtual ::arrow::Result<::arrow::AsyncGenerator<std::shared_ptr<::arrow::RecordBatch>>>
+  GetRecordBatchGenerator(const std::vector<int>& row_group_indices,
+                          const std::vector<int>& column_indices,
+                          ::arrow::internal::Executor* cpu_executor = NULLPTR,
+                          int row_group_readahead = 0) = 0;
+
   /// \brief Scan file contents with one thread, return number of rows
   virtual ::arrow::Status ScanContents(std::vector<int> columns,
                                        const int32_t column_batch_size,
@@ -264,6 +313,25 @@ class PARQUET_EXPORT ColumnReader {
   // the data available in the file.
   virtual ::arrow::Status NextBatch(int64_t batch_size,
                                     std::shared_ptr<::arrow::ChunkedArray>* out) = 0;
+
+  // Decode the next values straight into caller-provided buffers, e.g. those
+  // of a preallocated table, without allocating or copying an array.
+  //
+  // Only supported for non-repeated columns whose Arrow type has the
+  // representation of their Parquet physical type: int32, uint32, date32 and
+  // time32 from INT32, int64, uint64, time64 and timestamp from INT64, float
+  // and double.
+  //
+  // Up to batch_size values are written from the value at |offset| in
+  // |values| and from the bit at |offset| in |valid_bits| on. Both buffers
+  // must be mutable and large enough. |valid_bits| may be null if the column
+  // is required. *values_read is set to 0 once the column is exhausted.
+  virtual ::arrow::Status NextBatchInto(int64_t batch_size, int64_t offset,
+                                        ::arrow::Buffer* values,
+                                        ::arrow::Buffer* valid_bits,
+                                        int64_t* values_read, int64_t* null_count) {
+    return ::arrow::Status::NotImplemented("NextBatchInto not supported by this reader");
+  }
 };
 
 /// \brief Experimental helper class for bindings (like Python) that struggle
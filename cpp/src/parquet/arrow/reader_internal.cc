@@ -29,6 +29,7 @@
 
 #include "arrow/array.h"
 #include "arrow/builder.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/datum.h"
 #include "arrow/extension_type.h"
 #include "arrow/io/memory.h"
@@ -50,6 +51,7 @@
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/schema_internal.h"
 #include "parquet/column_reader.h"
+#include "parquet/level_conversion.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -681,6 +683,26 @@ Status TransferExtension(RecordReader* reader, std::shared_ptr<DataType> value_t
   return Status::OK();
 }
 
+Status TransferRunEndEncoded(RecordReader* reader, std::shared_ptr<DataType> value_type,
+                             const ColumnDescriptor* descr, MemoryPool* pool,
+                             Datum* out) {
+  std::shared_ptr<ChunkedArray> result;
+  const auto& ree_type = checked_cast<const ::arrow::RunEndEncodedType&>(*value_type);
+  RETURN_NOT_OK(TransferColumnData(reader, ree_type.value_type(), descr, pool, &result));
+
+  // Encode chunk by chunk, so that at most one decoded chunk is alive at a time
+  ::arrow::compute::ExecContext ctx(pool);
+  ::arrow::compute::RunEndEncodeOptions options(ree_type.run_end_type());
+  ::arrow::ArrayVector out_chunks(result->num_chunks());
+  for (int i = 0; i < result->num_chunks(); i++) {
+    ARROW_ASSIGN_OR_RAISE(Datum encoded, ::arrow::compute::RunEndEncode(
+                                             result->chunk(i), options, &ctx));
+    out_chunks[i] = encoded.make_array();
+  }
+  *out = std::make_shared<ChunkedArray>(out_chunks, value_type);
+  return Status::OK();
+}
+
 #define TRANSFER_INT32(ENUM, ArrowType)                                              \
   case ::arrow::Type::ENUM: {                                                        \
     Status s = TransferInt<ArrowType, Int32Type>(reader, pool, value_type, &result); \
@@ -779,6 +801,9 @@ Status TransferColumnData(RecordReader* reader, std::shared_ptr<DataType> value_
     case ::arrow::Type::EXTENSION: {
       RETURN_NOT_OK(TransferExtension(reader, value_type, descr, pool, &result));
     } break;
+    case ::arrow::Type::RUN_END_ENCODED: {
+      RETURN_NOT_OK(TransferRunEndEncoded(reader, value_type, descr, pool, &result));
+    } break;
     default:
       return Status::NotImplemented("No support for reading columns of type ",
                                     value_type->ToString());
@@ -804,8 +829,6 @@ Status ReconstructNestedList(const std::shared_ptr<Array>& arr,
   std::vector<std::string> item_names;
   std::vector<bool> nullable;
   std::vector<std::shared_ptr<const ::arrow::KeyValueMetadata>> field_metadata;
-  std::vector<std::shared_ptr<::arrow::Int32Builder>> offset_builders;
-  std::vector<std::shared_ptr<::arrow::BooleanBuilder>> valid_bits_builders;
   nullable.push_back(field->nullable());
   while (field->type()->num_fields() > 0) {
     if (field->type()->num_fields() > 1) {
@@ -817,15 +840,11 @@ Status ReconstructNestedList(const std::shared_ptr<Array>& arr,
       field = field->type()->field(0);
     }
     item_names.push_back(field->name());
-    offset_builders.emplace_back(
-        std::make_shared<::arrow::Int32Builder>(::arrow::int32(), pool));
-    valid_bits_builders.emplace_back(
-        std::make_shared<::arrow::BooleanBuilder>(::arrow::boolean(), pool));
     nullable.push_back(field->nullable());
     field_metadata.push_back(field->metadata());
   }
 
-  int64_t list_depth = offset_builders.size();
+  const int64_t list_depth = item_names.size();
   // This describes the minimal definition that describes a level that
   // reflects a value in the primitive values array.
   int16_t values_def_level = max_def_level;
@@ -845,56 +864,25 @@ Status ReconstructNestedList(const std::shared_ptr<Array>& arr,
     def_level++;
   }
 
-  int32_t values_offset = 0;
-  std::vector<int64_t> null_counts(list_depth, 0);
-  for (int64_t i = 0; i < total_levels; i++) {
-    int16_t rep_level = rep_levels[i];
-    if (rep_level < max_rep_level) {
-      for (int64_t j = rep_level; j < list_depth; j++) {
-        if (j == (list_depth - 1)) {
-          RETURN_NOT_OK(offset_builders[j]->Append(values_offset));
-        } else {
-          RETURN_NOT_OK(offset_builders[j]->Append(
-              static_cast<int32_t>(offset_builders[j + 1]->length())));
-        }
-
-        if (((empty_def_level[j] - 1) == def_levels[i]) && (nullable[j])) {
-          RETURN_NOT_OK(valid_bits_builders[j]->Append(false));
-          null_counts[j]++;
-          break;
-        } else {
-          RETURN_NOT_OK(valid_bits_builders[j]->Append(true));
-          if (empty_def_level[j] == def_levels[i]) {
-            break;
-          }
-        }
-      }
-    }
-    if (def_levels[i] >= values_def_level) {
-      values_offset++;
-    }
-  }
-  // Add the final offset to all lists
-  for (int64_t j = 0; j < list_depth; j++) {
-    if (j == (list_depth - 1)) {
-      RETURN_NOT_OK(offset_builders[j]->Append(values_offset));
-    } else {
-      RETURN_NOT_OK(offset_builders[j]->Append(
-          static_cast<int32_t>(offset_builders[j + 1]->length())));
-    }
-  }
-
+  // Each level starts at most one list per depth, which bounds the output sizes.
   std::vector<std::shared_ptr<Buffer>> offsets;
   std::vector<std::shared_ptr<Buffer>> valid_bits;
-  std::vector<int64_t> list_lengths;
+  std::vector<::parquet::internal::ListLevelOutput> lists(list_depth);
   for (int64_t j = 0; j < list_depth; j++) {
-    list_lengths.push_back(offset_builders[j]->length() - 1);
-    std::shared_ptr<Array> array;
-    RETURN_NOT_OK(offset_builders[j]->Finish(&array));
-    offsets.emplace_back(std::static_pointer_cast<Int32Array>(array)->values());
-    RETURN_NOT_OK(valid_bits_builders[j]->Finish(&array));
-    valid_bits.emplace_back(std::static_pointer_cast<BooleanArray>(array)->values());
+    ARROW_ASSIGN_OR_RAISE(
+        auto offsets_buffer,
+        ::arrow::AllocateBuffer((total_levels + 1) * sizeof(int32_t), pool));
+    ARROW_ASSIGN_OR_RAISE(auto valid_bits_buffer,
+                          ::arrow::AllocateBitmap(total_levels, pool));
+    lists[j].offsets = reinterpret_cast<int32_t*>(offsets_buffer->mutable_data());
+    lists[j].valid_bits = valid_bits_buffer->mutable_data();
+    offsets.emplace_back(std::move(offsets_buffer));
+    valid_bits.emplace_back(std::move(valid_bits_buffer));
   }
+  std::vector<bool> list_nullable(nullable.begin(), nullable.begin() + list_depth);
+  ::parquet::internal::DefRepLevelsToListOffsets(def_levels, rep_levels, total_levels,
+                                                 values_def_level, empty_def_level,
+                                                 list_nullable, &lists);
 
   *out = arr;
 
@@ -902,8 +890,8 @@ Status ReconstructNestedList(const std::shared_ptr<Array>& arr,
   for (int64_t j = list_depth - 1; j >= 0; j--) {
     auto list_type = ::arrow::list(::arrow::field(item_names[j], (*out)->type(),
                                                   nullable[j + 1], field_metadata[j]));
-    *out = std::make_shared<::arrow::ListArray>(list_type, list_lengths[j], offsets[j],
-                                                *out, valid_bits[j], null_counts[j]);
+    *out = std::make_shared<::arrow::ListArray>(list_type, lists[j].length, offsets[j],
+                                                *out, valid_bits[j], lists[j].null_count);
   }
   return Status::OK();
 }
@@ -18,12 +18,14 @@
 #include "benchmark/benchmark.h"
 
 #include <iostream>
+#include <numeric>
 #include <random>
 
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/writer.h"
 #include "parquet/column_reader.h"
 #include "parquet/column_writer.h"
+#include "parquet/encryption.h"
 #include "parquet/file_reader.h"
 #include "parquet/file_writer.h"
 #include "parquet/platform.h"
@@ -187,6 +189,47 @@ BENCHMARK_TEMPLATE2(BM_WriteColumn, true, DoubleType);
 BENCHMARK_TEMPLATE2(BM_WriteColumn, false, BooleanType);
 BENCHMARK_TEMPLATE2(BM_WriteColumn, true, BooleanType);
 
+static void BM_WriteListOfStruct(::benchmark::State& state) {
+  const int64_t list_length = state.range(0);
+  const int64_t num_lists = BENCHMARK_SIZE / list_length;
+
+  std::vector<int32_t> offsets(num_lists + 1);
+  for (int64_t i = 0; i <= num_lists; ++i) {
+    offsets[i] = static_cast<int32_t>(i * list_length);
+  }
+  std::vector<int32_t> ints(num_lists * list_length, 128);
+  std::vector<double> doubles(num_lists * list_length, 128.0);
+
+  ::arrow::Int32Builder offsets_builder;
+  ::arrow::Int32Builder int_builder;
+  ::arrow::DoubleBuilder double_builder;
+  EXIT_NOT_OK(offsets_builder.AppendValues(offsets));
+  EXIT_NOT_OK(int_builder.AppendValues(ints));
+  EXIT_NOT_OK(double_builder.AppendValues(doubles));
+  std::shared_ptr<::arrow::Array> offsets_array, int_array, double_array;
+  EXIT_NOT_OK(offsets_builder.Finish(&offsets_array));
+  EXIT_NOT_OK(int_builder.Finish(&int_array));
+  EXIT_NOT_OK(double_builder.Finish(&double_array));
+
+  PARQUET_ASSIGN_OR_THROW(auto struct_array,
+                          ::arrow::StructArray::Make({int_array, double_array},
+                                                     std::vector<std::string>{"a", "b"}));
+  PARQUET_ASSIGN_OR_THROW(
+      auto list_array, ::arrow::ListArray::FromArrays(*offsets_array, *struct_array));
+  auto table = ::arrow::Table::Make(
+      ::arrow::schema({::arrow::field("column", list_array->type())}), {list_array});
+
+  while (state.KeepRunning()) {
+    auto output = CreateOutputStream();
+    EXIT_NOT_OK(
+        WriteTable(*table, ::arrow::default_memory_pool(), output, BENCHMARK_SIZE));
+  }
+  state.SetBytesProcessed(state.iterations() * BENCHMARK_SIZE *
+                          (sizeof(int32_t) + sizeof(double)));
+}
+
+BENCHMARK(BM_WriteListOfStruct)->Arg(1)->Arg(8)->Arg(64);
+
 template <typename T>
 struct Examples {
   static constexpr std::array<T, 2> values() { return {127, 128}; }
@@ -348,6 +391,58 @@ static void BM_ReadMultipleRowGroups(::benchmark::State& state) {
 
 BENCHMARK(BM_ReadMultipleRowGroups);
 
+// Read an uncompressed column, plaintext or encrypted with AES-GCM, with or
+// without decrypting pages ahead on the CPU thread pool
+static void BM_ReadEncryptedColumn(::benchmark::State& state) {
+  const bool encrypted = state.range(0) != 0;
+  const int prefetch_depth = static_cast<int>(state.range(1));
+  const std::string footer_key = "0123456789012345";
+
+  std::vector<int64_t> values(BENCHMARK_SIZE);
+  std::iota(values.begin(), values.end(), 0);
+  std::shared_ptr<::arrow::Table> table = TableFromVector<Int64Type>(values, false);
+
+  WriterProperties::Builder writer_builder;
+  writer_builder.data_pagesize(64 * 1024);
+  if (encrypted) {
+    writer_builder.encryption(FileEncryptionProperties::Builder(footer_key).build());
+  }
+  auto output = CreateOutputStream();
+  try {
+    EXIT_NOT_OK(WriteTable(*table, ::arrow::default_memory_pool(), output,
+                           BENCHMARK_SIZE, writer_builder.build()));
+  } catch (const ParquetException& e) {
+    // E.g. built without OpenSSL
+    state.SkipWithError(e.what());
+    return;
+  }
+  PARQUET_ASSIGN_OR_THROW(auto buffer, output->Finish());
+
+  while (state.KeepRunning()) {
+    ReaderProperties properties;
+    properties.set_page_prefetch_depth(prefetch_depth);
+    if (encrypted) {
+      // Decryption properties with explicit keys can't be reused across files
+      properties.file_decryption_properties(
+          FileDecryptionProperties::Builder().footer_key(footer_key)->build());
+    }
+    auto reader = ParquetFileReader::Open(
+        std::make_shared<::arrow::io::BufferReader>(buffer), properties);
+    std::unique_ptr<FileReader> arrow_reader;
+    EXIT_NOT_OK(FileReader::Make(::arrow::default_memory_pool(), std::move(reader),
+                                 &arrow_reader));
+    std::shared_ptr<::arrow::Table> table;
+    EXIT_NOT_OK(arrow_reader->ReadTable(&table));
+  }
+  SetBytesProcessed<false, Int64Type>(state);
+}
+
+BENCHMARK(BM_ReadEncryptedColumn)
+    ->Args({/*encrypted=*/0, /*prefetch_depth=*/0})
+    ->Args({/*encrypted=*/1, /*prefetch_depth=*/0})
+    ->Args({/*encrypted=*/1, /*prefetch_depth=*/4})
+    ->Args({/*encrypted=*/1, /*prefetch_depth=*/16});
+
 }  // namespace benchmark
 
 }  // namespace parquet
@@ -625,6 +625,10 @@ Status NodeToSchemaField(const Node& node, LevelInfo current_levels,
       return Status::OK();
     } else {
       current_levels.Increment(node);
+      if (parent == nullptr && ctx->properties.read_run_end_encoded(column_index) &&
+          type->id() != ::arrow::Type::DICTIONARY) {
+        type = ::arrow::run_end_encoded(::arrow::int32(), type);
+      }
       // A normal (required/optional) primitive node
       return PopulateLeaf(column_index,
                           ::arrow::field(node.name(), type, node.is_optional(),
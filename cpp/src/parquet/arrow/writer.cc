@@ -33,6 +33,7 @@
 #include "arrow/util/base64.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visitor_inline.h"
 #include "parquet/arrow/path_internal.h"
 #include "parquet/arrow/reader_internal.h"
@@ -85,6 +86,39 @@ int CalculateLeafCount(const DataType& type) {
   return num_leaves;
 }
 
+// Total size of the buffers referenced by |data|, children and dictionary
+// included.  Buffers shared between arrays are counted more than once.
+int64_t TotalBufferSize(const ::arrow::ArrayData& data) {
+  int64_t total = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) {
+      total += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    total += TotalBufferSize(*child);
+  }
+  if (data.dictionary != nullptr) {
+    total += TotalBufferSize(*data.dictionary);
+  }
+  return total;
+}
+
+// Approximate size of the rows [offset, offset + size) of |data|, assuming
+// its bytes are spread evenly over its rows
+int64_t EstimateSliceSize(const ChunkedArray& data, int64_t offset, int64_t size) {
+  if (data.length() == 0) {
+    return 0;
+  }
+  int64_t total = 0;
+  for (const auto& chunk : data.chunks()) {
+    total += TotalBufferSize(*chunk->data());
+  }
+  const int64_t length = std::min(size, data.length() - offset);
+  return static_cast<int64_t>(static_cast<double>(total) * static_cast<double>(length) /
+                              static_cast<double>(data.length()));
+}
+
 // Determines if the |schema_field|'s root ancestor is nullable.
 bool HasNullableRoot(const SchemaManifest& schema_manifest,
                      const SchemaField* schema_field) {
@@ -161,6 +195,7 @@ class LevelBuilder {
   NOT_IMPLEMENTED_VISIT(FixedSizeList)
   NOT_IMPLEMENTED_VISIT(Struct)
   NOT_IMPLEMENTED_VISIT(Union)
+  NOT_IMPLEMENTED_VISIT(RunEndEncoded)
 
 #undef NOT_IMPLEMENTED_VISIT
 
@@ -349,21 +384,33 @@ class ArrowColumnWriterV2 {
   // A ChunkedArray).
   // level_builders should contain one MultipathLevelBuilder per chunk of the
   // Arrow-column to write.
+  //
+  // If buffered_column_index is non-negative the RowGroupWriter is buffered
+  // and the leaf columns are the ones starting at that index.
   ArrowColumnWriterV2(std::vector<std::unique_ptr<MultipathLevelBuilder>> level_builders,
-                      int leaf_count, RowGroupWriter* row_group_writer)
+                      int leaf_count, RowGroupWriter* row_group_writer,
+                      int buffered_column_index = -1)
       : level_builders_(std::move(level_builders)),
         leaf_count_(leaf_count),
-        row_group_writer_(row_group_writer) {}
+        row_group_writer_(row_group_writer),
+        buffered_column_index_(buffered_column_index) {}
 
   // Writes out all leaf parquet columns to the RowGroupWriter that this
   // object was constructed with.  Each leaf column is written fully before
-  // the next column is written (i.e. no buffering is assumed).
+  // the next column is written.  When the RowGroupWriter is buffered the
+  // column writers are left open, as closing them flushes their pages to the
+  // sink, which has to happen in column order.
   //
   // Columns are written in DFS order.
   Status Write(ArrowWriteContext* ctx) {
+    const bool buffered = buffered_column_index_ >= 0;
     for (int leaf_idx = 0; leaf_idx < leaf_count_; leaf_idx++) {
       ColumnWriter* column_writer;
-      PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->NextColumn());
+      if (buffered) {
+        column_writer = row_group_writer_->column(buffered_column_index_ + leaf_idx);
+      } else {
+        PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->NextColumn());
+      }
       for (auto& level_builder : level_builders_) {
         RETURN_NOT_OK(level_builder->Write(
             leaf_idx, ctx, [&](const MultipathLevelBuilderResult& result) {
@@ -383,7 +430,9 @@ class ArrowColumnWriterV2 {
             }));
       }
 
-      PARQUET_CATCH_NOT_OK(column_writer->Close());
+      if (!buffered) {
+        PARQUET_CATCH_NOT_OK(column_writer->Close());
+      }
     }
 
     return Status::OK();
@@ -397,16 +446,19 @@ class ArrowColumnWriterV2 {
   // chunks are created which need to be tracked across each leaf column-write.
   // This decision could potentially be revisited if we wanted to use "buffered"
   // RowGroupWriters (we could construct each builder on demand in that case).
+  //
+  // See the constructor for buffered_column_index.
   static ::arrow::Result<std::unique_ptr<ArrowColumnWriterV2>> Make(
       const ChunkedArray& data, int64_t offset, const int64_t size,
-      const SchemaManifest& schema_manifest, RowGroupWriter* row_group_writer) {
+      const SchemaManifest& schema_manifest, RowGroupWriter* row_group_writer,
+      int buffered_column_index = -1) {
     int64_t absolute_position = 0;
     int chunk_index = 0;
     int64_t chunk_offset = 0;
     if (data.length() == 0) {
       return ::arrow::internal::make_unique<ArrowColumnWriterV2>(
           std::vector<std::unique_ptr<MultipathLevelBuilder>>{},
-          CalculateLeafCount(*data.type()), row_group_writer);
+          CalculateLeafCount(*data.type()), row_group_writer, buffered_column_index);
     }
     while (chunk_index < data.num_chunks() && absolute_position < offset) {
       const int64_t chunk_length = data.chunk(chunk_index)->length();
@@ -431,7 +483,9 @@ class ArrowColumnWriterV2 {
     bool is_nullable = false;
     // The row_group_writer hasn't been advanced yet so add 1 to the current
     // which is the one this instance will start writing for.
-    int column_index = row_group_writer->current_column() + 1;
+    const int column_index = buffered_column_index >= 0
+                                 ? buffered_column_index
+                                 : row_group_writer->current_column() + 1;
     for (int leaf_offset = 0; leaf_offset < leaf_count; ++leaf_offset) {
       const SchemaField* schema_field = nullptr;
       RETURN_NOT_OK(
@@ -478,7 +532,7 @@ class ArrowColumnWriterV2 {
       values_written += chunk_write_size;
     }
     return ::arrow::internal::make_unique<ArrowColumnWriterV2>(
-        std::move(builders), leaf_count, row_group_writer);
+        std::move(builders), leaf_count, row_group_writer, buffered_column_index);
   }
 
  private:
@@ -486,6 +540,7 @@ class ArrowColumnWriterV2 {
   std::vector<std::unique_ptr<MultipathLevelBuilder>> level_builders_;
   int leaf_count_;
   RowGroupWriter* row_group_writer_;
+  int buffered_column_index_;
 };
 
 class ArrowColumnWriter {
@@ -679,6 +734,10 @@ class FileWriterImpl : public FileWriter {
     }
 
     auto WriteRowGroup = [&](int64_t offset, int64_t size) {
+      if (arrow_properties_->use_threads() &&
+          arrow_properties_->engine_version() == ArrowWriterProperties::V2) {
+        return WriteBufferedRowGroup(table, offset, size);
+      }
       RETURN_NOT_OK(NewRowGroup(size));
       for (int i = 0; i < table.num_columns(); i++) {
         RETURN_NOT_OK(WriteColumnChunk(table.column(i), offset, size));
@@ -703,6 +762,60 @@ class FileWriterImpl : public FileWriter {
 
   const WriterProperties& properties() const { return *writer_->properties(); }
 
+  // Encodes and compresses the columns of a row group concurrently into
+  // in-memory page buffers, and flushes them to the sink in column order.
+  // The columns are processed in batches whose estimated input size stays
+  // under max_buffered_bytes (a batch has at least one column), each batch
+  // being flushed before the next one starts.
+  Status WriteBufferedRowGroup(const Table& table, int64_t offset, int64_t size) {
+    if (row_group_writer_ != nullptr) {
+      PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+    }
+    PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendBufferedRowGroup());
+
+    const int num_columns = table.num_columns();
+    // The index of the first leaf column of each column, plus the number of
+    // leaf columns at the end
+    std::vector<int> leaf_indices(num_columns + 1, 0);
+    std::vector<int64_t> column_sizes(num_columns);
+    for (int i = 0; i < num_columns; i++) {
+      leaf_indices[i + 1] = leaf_indices[i] + CalculateLeafCount(*table.field(i)->type());
+      column_sizes[i] = EstimateSliceSize(*table.column(i), offset, size);
+    }
+
+    const int64_t max_buffered_bytes = arrow_properties_->max_buffered_bytes();
+    int batch_start = 0;
+    while (batch_start < num_columns) {
+      int batch_end = batch_start + 1;
+      int64_t batch_size = column_sizes[batch_start];
+      while (batch_end < num_columns &&
+             batch_size + column_sizes[batch_end] <= max_buffered_bytes) {
+        batch_size += column_sizes[batch_end++];
+      }
+
+      RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+          batch_end - batch_start > 1, batch_end - batch_start, [&](int j) {
+            const int i = batch_start + j;
+            // The scratch buffers of the context can't be shared across threads
+            ArrowWriteContext ctx(column_write_context_.memory_pool,
+                                  arrow_properties_.get());
+            ARROW_ASSIGN_OR_RAISE(
+                std::unique_ptr<ArrowColumnWriterV2> writer,
+                ArrowColumnWriterV2::Make(*table.column(i), offset, size,
+                                          schema_manifest_, row_group_writer_,
+                                          leaf_indices[i]));
+            return writer->Write(&ctx);
+          }));
+
+      // Flush the pages of the batch to the sink and release them
+      for (int i = leaf_indices[batch_start]; i < leaf_indices[batch_end]; i++) {
+        PARQUET_CATCH_NOT_OK(row_group_writer_->column(i)->Close());
+      }
+      batch_start = batch_end;
+    }
+    return Status::OK();
+  }
+
   ::arrow::MemoryPool* memory_pool() const override {
     return column_write_context_.memory_pool;
   }
@@ -22,13 +22,33 @@
 #include "parquet/bloom_filter.h"
 #include "parquet/exception.h"
 #include "parquet/murmur3.h"
+#include "parquet/thrift_internal.h"
+#include "parquet/xxhasher.h"
 
 namespace parquet {
 constexpr uint32_t BlockSplitBloomFilter::SALT[kBitsSetPerBlock];
 
+namespace {
+
+// The thrift BloomFilterHeader is a few bytes long, reading this much is
+// enough to get it in one go
+constexpr int64_t kBloomFilterHeaderSizeGuess = 256;
+
+std::unique_ptr<Hasher> MakeHasher(BloomFilter::HashStrategy hash_strategy) {
+  if (hash_strategy == BloomFilter::HashStrategy::XXHASH) {
+    return std::unique_ptr<Hasher>(new XxHasher());
+  }
+  return std::unique_ptr<Hasher>(new MurmurHash3());
+}
+
+}  // namespace
+
 BlockSplitBloomFilter::BlockSplitBloomFilter()
+    : BlockSplitBloomFilter(HashStrategy::MURMUR3_X64_128) {}
+
+BlockSplitBloomFilter::BlockSplitBloomFilter(HashStrategy hash_strategy)
     : pool_(::arrow::default_memory_pool()),
-      hash_strategy_(HashStrategy::MURMUR3_X64_128),
+      hash_strategy_(hash_strategy),
       algorithm_(Algorithm::BLOCK) {}
 
 void BlockSplitBloomFilter::Init(uint32_t num_bytes) {
@@ -49,7 +69,7 @@ void BlockSplitBloomFilter::Init(uint32_t num_bytes) {
   PARQUET_ASSIGN_OR_THROW(data_, ::arrow::AllocateBuffer(num_bytes_, pool_));
   memset(data_->mutable_data(), 0, num_bytes_);
 
-  this->hasher_.reset(new MurmurHash3());
+  this->hasher_ = MakeHasher(hash_strategy_);
 }
 
 void BlockSplitBloomFilter::Init(const uint8_t* bitset, uint32_t num_bytes) {
@@ -64,7 +84,7 @@ void BlockSplitBloomFilter::Init(const uint8_t* bitset, uint32_t num_bytes) {
   PARQUET_ASSIGN_OR_THROW(data_, ::arrow::AllocateBuffer(num_bytes_, pool_));
   memcpy(data_->mutable_data(), bitset, num_bytes_);
 
-  this->hasher_.reset(new MurmurHash3());
+  this->hasher_ = MakeHasher(hash_strategy_);
 }
 
 BlockSplitBloomFilter BlockSplitBloomFilter::Deserialize(ArrowInputStream* input) {
@@ -99,9 +119,65 @@ BlockSplitBloomFilter BlockSplitBloomFilter::Deserialize(ArrowInputStream* input
   return bloom_filter;
 }
 
+BlockSplitBloomFilter BlockSplitBloomFilter::DeserializeWithThriftHeader(
+    ArrowInputStream* input) {
+  // The size of the header is only known once it is parsed
+  PARQUET_ASSIGN_OR_THROW(auto header_buffer, input->Read(kBloomFilterHeaderSizeGuess));
+  format::BloomFilterHeader header;
+  uint32_t header_size = static_cast<uint32_t>(header_buffer->size());
+  DeserializeThriftMsg(header_buffer->data(), &header_size, &header);
+  if (!header.algorithm.__isset.BLOCK) {
+    throw ParquetException("Unsupported Bloom filter algorithm");
+  }
+  if (!header.hash.__isset.XXHASH) {
+    throw ParquetException("Unsupported Bloom filter hash strategy");
+  }
+  if (!header.compression.__isset.UNCOMPRESSED) {
+    throw ParquetException("Unsupported Bloom filter compression");
+  }
+  if (header.numBytes < 0) {
+    throw ParquetException("Given length of bitset is illegal");
+  }
+
+  BlockSplitBloomFilter bloom_filter(HashStrategy::XXHASH);
+  const auto num_bytes = static_cast<uint32_t>(header.numBytes);
+  const int64_t bytes_read = header_buffer->size() - header_size;
+  if (bytes_read >= num_bytes) {
+    bloom_filter.Init(header_buffer->data() + header_size, num_bytes);
+    return bloom_filter;
+  }
+  // Check the size before allocating for the rest of the bitset
+  if (num_bytes > kMaximumBloomFilterBytes) {
+    throw ParquetException("Given length of bitset is illegal");
+  }
+  PARQUET_ASSIGN_OR_THROW(auto bitset, ::arrow::AllocateBuffer(num_bytes));
+  std::memcpy(bitset->mutable_data(), header_buffer->data() + header_size,
+              static_cast<size_t>(bytes_read));
+  PARQUET_ASSIGN_OR_THROW(
+      int64_t bytes_available,
+      input->Read(num_bytes - bytes_read, bitset->mutable_data() + bytes_read));
+  if (bytes_available != num_bytes - bytes_read) {
+    throw ParquetException("Failed to deserialize from input stream");
+  }
+  bloom_filter.Init(bitset->data(), num_bytes);
+  return bloom_filter;
+}
+
 void BlockSplitBloomFilter::WriteTo(ArrowOutputStream* sink) const {
   DCHECK(sink != nullptr);
 
+  if (hash_strategy_ == HashStrategy::XXHASH) {
+    format::BloomFilterHeader header;
+    header.__set_numBytes(static_cast<int32_t>(num_bytes_));
+    header.algorithm.__set_BLOCK(format::SplitBlockAlgorithm());
+    header.hash.__set_XXHASH(format::XxHash());
+    header.compression.__set_UNCOMPRESSED(format::Uncompressed());
+    ThriftSerializer serializer;
+    serializer.Serialize(&header, sink);
+    PARQUET_THROW_NOT_OK(sink->Write(data_->data(), num_bytes_));
+    return;
+  }
+
   PARQUET_THROW_NOT_OK(
       sink->Write(reinterpret_cast<const uint8_t*>(&num_bytes_), sizeof(num_bytes_)));
   PARQUET_THROW_NOT_OK(sink->Write(reinterpret_cast<const uint8_t*>(&hash_strategy_),
@@ -125,9 +201,18 @@ void BlockSplitBloomFilter::SetMask(uint32_t key, BlockMask& block_mask) const {
   }
 }
 
+uint32_t BlockSplitBloomFilter::BlockIndex(uint64_t hash) const {
+  const uint32_t num_blocks = num_bytes_ / kBytesPerFilterBlock;
+  if (hash_strategy_ == HashStrategy::XXHASH) {
+    // As in the Parquet specification: the top 32 bits of the hash times the
+    // number of blocks, divided by 2^32
+    return static_cast<uint32_t>(((hash >> 32) * num_blocks) >> 32);
+  }
+  return static_cast<uint32_t>(hash >> 32) & (num_blocks - 1);
+}
+
 bool BlockSplitBloomFilter::FindHash(uint64_t hash) const {
-  const uint32_t bucket_index =
-      static_cast<uint32_t>((hash >> 32) & (num_bytes_ / kBytesPerFilterBlock - 1));
+  const uint32_t bucket_index = BlockIndex(hash);
   uint32_t key = static_cast<uint32_t>(hash);
   uint32_t* bitset32 = reinterpret_cast<uint32_t*>(data_->mutable_data());
 
@@ -144,8 +229,7 @@ bool BlockSplitBloomFilter::FindHash(uint64_t hash) const {
 }
 
 void BlockSplitBloomFilter::InsertHash(uint64_t hash) {
-  const uint32_t bucket_index =
-      static_cast<uint32_t>(hash >> 32) & (num_bytes_ / kBytesPerFilterBlock - 1);
+  const uint32_t bucket_index = BlockIndex(hash);
   uint32_t key = static_cast<uint32_t>(hash);
   uint32_t* bitset32 = reinterpret_cast<uint32_t*>(data_->mutable_data());
 
@@ -33,6 +33,13 @@ namespace parquet {
 // set of elements, a hash strategy and a Bloom filter algorithm.
 class PARQUET_EXPORT BloomFilter {
  public:
+  // Hash strategy available for Bloom filter. XXHASH is the one of the Parquet
+  // specification, MURMUR3_X64_128 the one of the original parquet-mr filters.
+  enum class HashStrategy : uint32_t { MURMUR3_X64_128 = 0, XXHASH = 1 };
+
+  // Bloom filter algorithm.
+  enum class Algorithm : uint32_t { BLOCK = 0 };
+
   // Maximum Bloom filter size, it sets to HDFS default block size 128MB
   // This value will be reconsidered when implementing Bloom filter producer.
   static constexpr uint32_t kMaximumBloomFilterBytes = 128 * 1024 * 1024;
@@ -101,13 +108,6 @@ class PARQUET_EXPORT BloomFilter {
   virtual uint64_t Hash(const FLBA* value, uint32_t len) const = 0;
 
   virtual ~BloomFilter() {}
-
- protected:
-  // Hash strategy available for Bloom filter.
-  enum class HashStrategy : uint32_t { MURMUR3_X64_128 = 0 };
-
-  // Bloom filter algorithm.
-  enum class Algorithm : uint32_t { BLOCK = 0 };
 };
 
 // The BlockSplitBloomFilter is implemented using block-based Bloom filters from
@@ -121,6 +121,11 @@ class PARQUET_EXPORT BlockSplitBloomFilter : public BloomFilter {
   /// The constructor of BlockSplitBloomFilter. It uses murmur3_x64_128 as hash function.
   BlockSplitBloomFilter();
 
+  /// The constructor of BlockSplitBloomFilter using the given hash strategy.
+  /// Filters written to Parquet files have to use XXHASH, as the specification
+  /// requires.
+  explicit BlockSplitBloomFilter(HashStrategy hash_strategy);
+
   /// Initialize the BlockSplitBloomFilter. The range of num_bytes should be within
   /// [kMinimumBloomFilterBytes, kMaximumBloomFilterBytes], it will be
   /// rounded up/down to lower/upper bound if num_bytes is out of range and also
@@ -194,13 +199,24 @@ class PARQUET_EXPORT BlockSplitBloomFilter : public BloomFilter {
     return hasher_->Hash(value, len);
   }
 
-  /// Deserialize the Bloom filter from an input stream. It is used when reconstructing
-  /// a Bloom filter from a parquet filter.
+  /// Deserialize the Bloom filter from an input stream, in the layout written by
+  /// WriteTo() with the MURMUR3_X64_128 hash strategy: the bitset length, hash
+  /// strategy and algorithm as 32-bit integers, followed by the bitset.
   ///
   /// @param input_stream The input stream from which to construct the Bloom filter
   /// @return The BlockSplitBloomFilter.
   static BlockSplitBloomFilter Deserialize(ArrowInputStream* input_stream);
 
+  /// Deserialize the Bloom filter from an input stream, in the layout of the
+  /// Parquet specification written by WriteTo() with the XXHASH hash strategy:
+  /// a thrift BloomFilterHeader followed by the bitset. It is used when
+  /// reconstructing a Bloom filter from a parquet file.
+  ///
+  /// @param input_stream The input stream from which to construct the Bloom filter
+  /// @return The BlockSplitBloomFilter.
+  static BlockSplitBloomFilter DeserializeWithThriftHeader(
+      ArrowInputStream* input_stream);
+
  private:
   // Bytes in a tiny Bloom filter block.
   static constexpr int kBytesPerFilterBlock = 32;
@@ -224,6 +240,9 @@ class PARQUET_EXPORT BlockSplitBloomFilter : public BloomFilter {
   /// @param mask the mask array is used to set inside a block
   void SetMask(uint32_t key, BlockMask& mask) const;
 
+  /// The index of the tiny Bloom filter a hash goes to.
+  uint32_t BlockIndex(uint64_t hash) const;
+
   // Memory pool to allocate aligned buffer for bitset
   ::arrow::MemoryPool* pool_;
 
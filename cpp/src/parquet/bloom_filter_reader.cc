@@ -0,0 +1,131 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/bloom_filter_reader.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <utility>
+
+#include "parquet/bloom_filter.h"
+#include "parquet/exception.h"
+#include "parquet/metadata.h"
+#include "parquet/thrift_internal.h"
+
+namespace parquet {
+
+namespace {
+
+// A serialized Bloom filter starts with a thrift BloomFilterHeader of a few
+// bytes, reading this much is enough to get it in one go
+constexpr int64_t kBloomFilterHeaderSizeGuess = 256;
+
+class RowGroupBloomFilterReaderImpl : public RowGroupBloomFilterReader {
+ public:
+  RowGroupBloomFilterReaderImpl(std::shared_ptr<ArrowInputFile> source,
+                                std::shared_ptr<FileMetaData> file_metadata,
+                                int row_group, const ReaderProperties& properties)
+      : source_(std::move(source)),
+        file_metadata_(std::move(file_metadata)),
+        row_group_metadata_(file_metadata_->RowGroup(row_group)),
+        properties_(properties) {}
+
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) override {
+    if (i < 0 || i >= row_group_metadata_->num_columns()) {
+      std::stringstream ss;
+      ss << "Trying to read the Bloom filter of column " << i
+         << " but the row group only has " << row_group_metadata_->num_columns()
+         << " columns";
+      throw ParquetException(ss.str());
+    }
+    auto column = row_group_metadata_->ColumnChunk(i);
+    // The Bloom filters of encrypted column chunks are encrypted as well
+    if (column->crypto_metadata() != nullptr || !column->has_bloom_filter()) {
+      return nullptr;
+    }
+
+    // Check the size of the bitset before reading it
+    const int64_t offset = column->bloom_filter_offset();
+    PARQUET_ASSIGN_OR_THROW(int64_t file_size, source_->GetSize());
+    if (offset < 0 || offset >= file_size) {
+      throw ParquetInvalidOrCorruptedFileException("Invalid Bloom filter offset ",
+                                                   offset);
+    }
+    const int64_t read_size = std::min(kBloomFilterHeaderSizeGuess, file_size - offset);
+    PARQUET_ASSIGN_OR_THROW(auto header_buffer, source_->ReadAt(offset, read_size));
+    format::BloomFilterHeader header;
+    uint32_t header_size = static_cast<uint32_t>(header_buffer->size());
+    DeserializeThriftMsg(header_buffer->data(), &header_size, &header);
+    if (header.numBytes < 0 ||
+        static_cast<uint32_t>(header.numBytes) > BloomFilter::kMaximumBloomFilterBytes ||
+        offset + header_size + header.numBytes > file_size) {
+      throw ParquetInvalidOrCorruptedFileException(
+          "Invalid Bloom filter size ", header.numBytes, " at offset ", offset);
+    }
+
+    auto stream = properties_.GetStream(source_, offset, header_size + header.numBytes);
+    std::unique_ptr<BloomFilter> bloom_filter(new BlockSplitBloomFilter(
+        BlockSplitBloomFilter::DeserializeWithThriftHeader(stream.get())));
+    return bloom_filter;
+  }
+
+ private:
+  std::shared_ptr<ArrowInputFile> source_;
+  // Keeps alive the thrift structures referenced by row_group_metadata_
+  std::shared_ptr<FileMetaData> file_metadata_;
+  std::unique_ptr<RowGroupMetaData> row_group_metadata_;
+  ReaderProperties properties_;
+};
+
+class BloomFilterReaderImpl : public BloomFilterReader {
+ public:
+  BloomFilterReaderImpl(std::shared_ptr<ArrowInputFile> source,
+                        std::shared_ptr<FileMetaData> file_metadata,
+                        const ReaderProperties& properties)
+      : source_(std::move(source)),
+        file_metadata_(std::move(file_metadata)),
+        properties_(properties) {}
+
+  std::shared_ptr<RowGroupBloomFilterReader> RowGroup(int i) override {
+    if (i < 0 || i >= file_metadata_->num_row_groups()) {
+      std::stringstream ss;
+      ss << "Trying to read the Bloom filters of row group " << i
+         << " but the file only has " << file_metadata_->num_row_groups()
+         << " row groups";
+      throw ParquetException(ss.str());
+    }
+    return std::make_shared<RowGroupBloomFilterReaderImpl>(source_, file_metadata_, i,
+                                                           properties_);
+  }
+
+ private:
+  std::shared_ptr<ArrowInputFile> source_;
+  std::shared_ptr<FileMetaData> file_metadata_;
+  ReaderProperties properties_;
+};
+
+}  // namespace
+
+std::shared_ptr<BloomFilterReader> BloomFilterReader::Make(
+    std::shared_ptr<ArrowInputFile> source, std::shared_ptr<FileMetaData> file_metadata,
+    const ReaderProperties& properties) {
+  return std::make_shared<BloomFilterReaderImpl>(std::move(source),
+                                                 std::move(file_metadata), properties);
+}
+
+}  // namespace parquet
@@ -0,0 +1,57 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "parquet/platform.h"
+#include "parquet/properties.h"
+
+namespace parquet {
+
+class BloomFilter;
+class FileMetaData;
+
+/// \brief Reads the Bloom filters of the column chunks of a row group
+class PARQUET_EXPORT RowGroupBloomFilterReader {
+ public:
+  virtual ~RowGroupBloomFilterReader() = default;
+
+  /// \brief The Bloom filter of column i, or null if it has none
+  ///
+  /// The filter is read from the file on each call.
+  virtual std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) = 0;
+};
+
+/// \brief Reads the Bloom filters of a Parquet file
+///
+/// Nothing is read until a filter is requested. The Bloom filters of encrypted
+/// column chunks aren't supported: they are reported as having none.
+class PARQUET_EXPORT BloomFilterReader {
+ public:
+  static std::shared_ptr<BloomFilterReader> Make(
+      std::shared_ptr<ArrowInputFile> source, std::shared_ptr<FileMetaData> file_metadata,
+      const ReaderProperties& properties);
+
+  virtual ~BloomFilterReader() = default;
+
+  /// \brief The Bloom filter reader of row group i
+  virtual std::shared_ptr<RowGroupBloomFilterReader> RowGroup(int i) = 0;
+};
+
+}  // namespace parquet
@@ -26,15 +26,23 @@
 
 #include "arrow/buffer.h"
 #include "arrow/io/file.h"
+#include "arrow/io/memory.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 
 #include "parquet/bloom_filter.h"
+#include "parquet/bloom_filter_reader.h"
+#include "parquet/column_writer.h"
 #include "parquet/exception.h"
+#include "parquet/file_reader.h"
+#include "parquet/file_writer.h"
+#include "parquet/metadata.h"
 #include "parquet/murmur3.h"
 #include "parquet/platform.h"
 #include "parquet/test_util.h"
+#include "parquet/thrift_internal.h"
 #include "parquet/types.h"
+#include "parquet/xxhasher.h"
 
 namespace parquet {
 namespace test {
@@ -48,6 +56,15 @@ TEST(Murmur3Test, TestBloomFilter) {
   EXPECT_EQ(result, UINT64_C(913737700387071329));
 }
 
+TEST(XxHashTest, TestBloomFilter) {
+  XxHasher xxhasher;
+  const ByteArray empty(0, nullptr);
+  EXPECT_EQ(xxhasher.Hash(&empty), UINT64_C(0xEF46DB3751D8E999));
+  const uint8_t abc[3] = {'a', 'b', 'c'};
+  const ByteArray byte_array(3, abc);
+  EXPECT_EQ(xxhasher.Hash(&byte_array), UINT64_C(0x44BC2CF5AD770999));
+}
+
 TEST(ConstructorTest, TestBloomFilter) {
   BlockSplitBloomFilter bloom_filter;
   EXPECT_NO_THROW(bloom_filter.Init(1000));
@@ -90,6 +107,47 @@ TEST(BasicTest, TestBloomFilter) {
   }
 }
 
+// Filters hashed with XXHASH are serialized as the Parquet specification
+// requires: a thrift BloomFilterHeader followed by the bitset.
+TEST(BasicTest, TestXxHashBloomFilter) {
+  // A bitset smaller and one larger than what is read along with the header
+  for (uint32_t num_bytes : {32, 1024}) {
+    BlockSplitBloomFilter bloom_filter(BloomFilter::HashStrategy::XXHASH);
+    bloom_filter.Init(num_bytes);
+    for (int i = 0; i < 10; i++) {
+      bloom_filter.InsertHash(bloom_filter.Hash(i));
+    }
+
+    auto sink = CreateOutputStream();
+    bloom_filter.WriteTo(sink.get());
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    format::BloomFilterHeader header;
+    uint32_t header_size = static_cast<uint32_t>(buffer->size());
+    DeserializeThriftMsg(buffer->data(), &header_size, &header);
+    ASSERT_EQ(static_cast<int32_t>(num_bytes), header.numBytes);
+    ASSERT_TRUE(header.algorithm.__isset.BLOCK);
+    ASSERT_TRUE(header.hash.__isset.XXHASH);
+    ASSERT_TRUE(header.compression.__isset.UNCOMPRESSED);
+    ASSERT_EQ(header_size + num_bytes, buffer->size());
+
+    ::arrow::io::BufferReader source(buffer);
+    BlockSplitBloomFilter de_bloom =
+        BlockSplitBloomFilter::DeserializeWithThriftHeader(&source);
+    ASSERT_EQ(num_bytes, de_bloom.GetBitsetSize());
+    for (int i = 0; i < 10; i++) {
+      EXPECT_TRUE(de_bloom.FindHash(de_bloom.Hash(i)));
+      EXPECT_EQ(bloom_filter.Hash(i), XxHasher().Hash(i));
+    }
+
+    // Truncated bitset
+    auto truncated_buffer = ::arrow::SliceBuffer(buffer, 0, buffer->size() - 1);
+    ::arrow::io::BufferReader truncated(truncated_buffer);
+    EXPECT_THROW(BlockSplitBloomFilter::DeserializeWithThriftHeader(&truncated),
+                 ParquetException);
+  }
+}
+
 // Helper function to generate random string.
 std::string GetRandomString(uint32_t length) {
   // Character set used to generate random string
@@ -242,6 +300,98 @@ TEST(OptimalValueTest, TestBloomFilter) {
       UINT32_C(1073741824));
 }
 
+// Write two row groups of 1000 rows: "a" holds row_group * 1000 + i, "b"
+// holds the strings of the same values, null for odd rows
+static std::shared_ptr<Buffer> WriteFile(std::shared_ptr<WriterProperties> properties) {
+  auto schema = std::static_pointer_cast<schema::GroupNode>(schema::GroupNode::Make(
+      "schema", Repetition::REQUIRED,
+      {schema::PrimitiveNode::Make("a", Repetition::REQUIRED, Type::INT32),
+       schema::PrimitiveNode::Make("b", Repetition::OPTIONAL, Type::BYTE_ARRAY,
+                                   ConvertedType::UTF8)}));
+  auto sink = CreateOutputStream();
+  auto file_writer = ParquetFileWriter::Open(sink, schema, properties);
+  constexpr int kNumRows = 1000;
+  std::vector<int32_t> values(kNumRows);
+  std::vector<std::string> strings(kNumRows);
+  std::vector<ByteArray> byte_arrays;
+  std::vector<int16_t> def_levels(kNumRows);
+  for (int row_group = 0; row_group < 2; ++row_group) {
+    byte_arrays.clear();
+    for (int i = 0; i < kNumRows; ++i) {
+      values[i] = row_group * kNumRows + i;
+      strings[i] = std::to_string(values[i]);
+      def_levels[i] = i % 2 == 0;
+      if (def_levels[i]) {
+        byte_arrays.emplace_back(strings[i]);
+      }
+    }
+    auto row_group_writer = file_writer->AppendRowGroup();
+    static_cast<Int32Writer*>(row_group_writer->NextColumn())
+        ->WriteBatch(kNumRows, nullptr, nullptr, values.data());
+    static_cast<ByteArrayWriter*>(row_group_writer->NextColumn())
+        ->WriteBatch(kNumRows, def_levels.data(), nullptr, byte_arrays.data());
+  }
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+  return buffer;
+}
+
+TEST(WriteReadTest, TestBloomFilter) {
+  BloomFilterOptions options;
+  options.ndv = 1000;
+  options.fpp = 0.01;
+  auto properties = WriterProperties::Builder()
+                        .enable_bloom_filter("a", options)
+                        ->enable_bloom_filter("b", options)
+                        ->build();
+  auto reader = ParquetFileReader::Open(
+      std::make_shared<::arrow::io::BufferReader>(WriteFile(properties)));
+  auto bloom_filter_reader = reader->GetBloomFilterReader();
+  ASSERT_NE(nullptr, bloom_filter_reader);
+
+  for (int row_group = 0; row_group < 2; ++row_group) {
+    auto row_group_metadata = reader->metadata()->RowGroup(row_group);
+    ASSERT_TRUE(row_group_metadata->ColumnChunk(0)->has_bloom_filter());
+    auto row_group_reader = bloom_filter_reader->RowGroup(row_group);
+    auto a_filter = row_group_reader->GetColumnBloomFilter(0);
+    auto b_filter = row_group_reader->GetColumnBloomFilter(1);
+    ASSERT_NE(nullptr, a_filter);
+    ASSERT_NE(nullptr, b_filter);
+
+    int a_false_positives = 0;
+    for (int32_t value = 0; value < 2000; ++value) {
+      const bool in_row_group = value / 1000 == row_group;
+      const bool found = a_filter->FindHash(a_filter->Hash(value));
+      if (in_row_group) {
+        ASSERT_TRUE(found) << value;
+      } else {
+        a_false_positives += found;
+      }
+      const std::string str = std::to_string(value);
+      const ByteArray byte_array(str);
+      if (in_row_group && value % 2 == 0) {
+        ASSERT_TRUE(b_filter->FindHash(b_filter->Hash(&byte_array))) << value;
+      }
+    }
+    ASSERT_LT(a_false_positives, 50);
+  }
+}
+
+TEST(WriteReadTest, TestBloomFilterPerColumn) {
+  auto properties = WriterProperties::Builder().enable_bloom_filter("b")->build();
+  auto reader = ParquetFileReader::Open(
+      std::make_shared<::arrow::io::BufferReader>(WriteFile(properties)));
+  auto bloom_filter_reader = reader->GetBloomFilterReader();
+  ASSERT_NE(nullptr, bloom_filter_reader);
+  ASSERT_EQ(nullptr, bloom_filter_reader->RowGroup(0)->GetColumnBloomFilter(0));
+  ASSERT_NE(nullptr, bloom_filter_reader->RowGroup(0)->GetColumnBloomFilter(1));
+
+  properties = WriterProperties::Builder().build();
+  reader = ParquetFileReader::Open(
+      std::make_shared<::arrow::io::BufferReader>(WriteFile(properties)));
+  ASSERT_EQ(nullptr, reader->GetBloomFilterReader());
+}
+
 }  // namespace test
 
 }  // namespace parquet
@@ -20,10 +20,12 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <exception>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -38,6 +40,8 @@
 #include "arrow/util/int_util_internal.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/util/tracing.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/encryption_internal.h"
@@ -180,6 +184,8 @@ class SerializedPageReader : public PageReader {
                        Compression::type codec, ::arrow::MemoryPool* pool,
                        const CryptoContext* crypto_ctx)
       : stream_(std::move(stream)),
+        pool_(pool),
+        codec_(codec),
         decompression_buffer_(AllocateBuffer(pool, 0)),
         page_ordinal_(0),
         seen_num_rows_(0),
@@ -202,20 +208,66 @@ class SerializedPageReader : public PageReader {
   void UpdateDecryption(const std::shared_ptr<Decryptor>& decryptor, int8_t module_type,
                         const std::string& page_aad);
 
+  // The AAD of the current page for the given module type
+  std::string PageAad(const Decryptor& decryptor, int8_t module_type,
+                      const std::string& page_aad);
+
   void InitDecryption();
 
-  std::shared_ptr<Buffer> DecompressPage(int compressed_len, int uncompressed_len,
-                                         const uint8_t* page_buffer);
+  // Whether the data_page_filter_ rejects the current page
+  bool ShouldSkipPage(PageType::type page_type);
+
+  // Read the header of the next page to return into current_page_header_,
+  // and its decrypted but still compressed contents.  Decrypted pages are
+  // written to decryption_buffer.  If decryption_buffer is null, encrypted
+  // pages are returned as is and current_page_aad_ holds the AAD to decrypt
+  // them with.  Returns null at the end of the column chunk.
+  std::shared_ptr<Buffer> ReadPage(
+      const std::shared_ptr<ResizableBuffer>& decryption_buffer);
+
+  // NextPage() when prefetch_depth_ > 0: the following pages are decrypted
+  // and decompressed on the CPU thread pool while the current one is decoded
+  std::shared_ptr<Page> NextPrefetchedPage();
+
+  // Submit the decryption and decompression of pages until prefetch_depth_
+  // are in flight
+  void PrefetchPages();
+
+  static ::arrow::Status DecryptPage(const Buffer& page, Decryptor* decryptor,
+                                     const std::string& aad, ResizableBuffer* out);
+
+  // levels_length is the size of the uncompressed levels of a DataPageV2
+  static ::arrow::Status DecompressPage(const Buffer& page, int uncompressed_len,
+                                        int levels_length, ::arrow::util::Codec* codec,
+                                        ResizableBuffer* out);
+
+  static std::shared_ptr<Page> MakePage(const format::PageHeader& header,
+                                        std::shared_ptr<Buffer> page_buffer);
 
   std::shared_ptr<ArrowInputStream> stream_;
+  ::arrow::MemoryPool* pool_;
 
   format::PageHeader current_page_header_;
   std::shared_ptr<Page> current_page_;
 
   // Compression codec to use.
+  Compression::type codec_;
   std::unique_ptr<::arrow::util::Codec> decompressor_;
   std::shared_ptr<ResizableBuffer> decompression_buffer_;
 
+  // The pages being decompressed on the CPU thread pool, in file order
+  struct PrefetchedPage {
+    format::PageHeader header;
+    ::arrow::Future<std::shared_ptr<Buffer>> buffer;
+  };
+  std::deque<PrefetchedPage> prefetched_pages_;
+  // One codec per page in flight, as codecs can't be shared across threads.
+  // The page i uses prefetch_codecs_[i % prefetch_codecs_.size()].  Null
+  // codecs for uncompressed (but encrypted) column chunks.
+  std::vector<std::shared_ptr<::arrow::util::Codec>> prefetch_codecs_;
+  int64_t num_prefetched_pages_ = 0;
+  bool prefetch_finished_ = false;
+
   // The fields below are used for calculation of AAD (additional authenticated data)
   // suffix which is part of the Parquet Modular Encryption.
   // The AAD suffix for a parquet module is built internally by
@@ -243,6 +295,8 @@ class SerializedPageReader : public PageReader {
   // updated by only the page ordinal.
   std::string data_page_aad_;
   std::string data_page_header_aad_;
+  // The AAD of the page last read
+  std::string current_page_aad_;
   // Encryption
   std::shared_ptr<ResizableBuffer> decryption_buffer_;
 };
@@ -267,18 +321,51 @@ void SerializedPageReader::UpdateDecryption(const std::shared_ptr<Decryptor>& de
                                             int8_t module_type,
                                             const std::string& page_aad) {
   DCHECK(decryptor != nullptr);
+  decryptor->UpdateAad(PageAad(*decryptor, module_type, page_aad));
+}
+
+std::string SerializedPageReader::PageAad(const Decryptor& decryptor,
+                                          int8_t module_type,
+                                          const std::string& page_aad) {
   if (crypto_ctx_.start_decrypt_with_dictionary_page) {
-    std::string aad = encryption::CreateModuleAad(
-        decryptor->file_aad(), module_type, crypto_ctx_.row_group_ordinal,
-        crypto_ctx_.column_ordinal, kNonPageOrdinal);
-    decryptor->UpdateAad(aad);
+    return encryption::CreateModuleAad(decryptor.file_aad(), module_type,
+                                       crypto_ctx_.row_group_ordinal,
+                                       crypto_ctx_.column_ordinal, kNonPageOrdinal);
+  }
+  encryption::QuickUpdatePageAad(page_aad, page_ordinal_);
+  return page_aad;
+}
+
+bool SerializedPageReader::ShouldSkipPage(PageType::type page_type) {
+  int32_t num_values;
+  bool skip;
+  if (page_type == PageType::DATA_PAGE) {
+    const format::DataPageHeader& header = current_page_header_.data_page_header;
+    EncodedStatistics page_statistics = ExtractStatsFromHeader(header);
+    num_values = header.num_values;
+    skip = data_page_filter_(DataPageStats(&page_statistics, num_values, -1));
+  } else if (page_type == PageType::DATA_PAGE_V2) {
+    const format::DataPageHeaderV2& header = current_page_header_.data_page_header_v2;
+    EncodedStatistics page_statistics = ExtractStatsFromHeader(header);
+    num_values = header.num_values;
+    skip =
+        data_page_filter_(DataPageStats(&page_statistics, num_values, header.num_rows));
   } else {
-    encryption::QuickUpdatePageAad(page_aad, page_ordinal_);
-    decryptor->UpdateAad(page_aad);
+    return false;
   }
+  if (skip) {
+    if (num_values < 0) {
+      throw ParquetException("Invalid page header (negative number of values)");
+    }
+    // Keep the ordinals used to compute the AAD of the next pages
+    ++page_ordinal_;
+    seen_num_rows_ += num_values;
+  }
+  return skip;
 }
 
-std::shared_ptr<Page> SerializedPageReader::NextPage() {
+std::shared_ptr<Buffer> SerializedPageReader::ReadPage(
+    const std::shared_ptr<ResizableBuffer>& decryption_buffer) {
   // Loop here because there may be unhandled page types that we skip until
   // finding a page that we do know what to do with
 
@@ -292,7 +379,7 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
     while (true) {
       PARQUET_ASSIGN_OR_THROW(auto view, stream_->Peek(allowed_page_size));
       if (view.size() == 0) {
-        return std::shared_ptr<Page>(nullptr);
+        return nullptr;
       }
 
       // This gets used, then set by DeserializeThriftMsg
@@ -319,14 +406,26 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
     // Advance the stream offset
     PARQUET_THROW_NOT_OK(stream_->Advance(header_size));
 
+    const PageType::type page_type = LoadEnumSafe(&current_page_header_.type);
+    if ((data_page_filter_ && ShouldSkipPage(page_type)) ||
+        (page_type != PageType::DICTIONARY_PAGE && page_type != PageType::DATA_PAGE &&
+         page_type != PageType::DATA_PAGE_V2)) {
+      // We don't know what this page type is. We're allowed to skip non-data
+      // pages.
+      PARQUET_THROW_NOT_OK(stream_->Advance(current_page_header_.compressed_page_size));
+      continue;
+    }
+
     int compressed_len = current_page_header_.compressed_page_size;
-    int uncompressed_len = current_page_header_.uncompressed_page_size;
     if (crypto_ctx_.data_decryptor != nullptr) {
-      UpdateDecryption(crypto_ctx_.data_decryptor, encryption::kDictionaryPage,
-                       data_page_aad_);
+      current_page_aad_ = PageAad(*crypto_ctx_.data_decryptor,
+                                  encryption::kDictionaryPage, data_page_aad_);
     }
     // Read the compressed data page.
+    ::arrow::util::TraceSpan read_span("parquet", "ReadPage");
+    read_span.AddBytes(compressed_len);
     PARQUET_ASSIGN_OR_THROW(auto page_buffer, stream_->Read(compressed_len));
+    read_span.End();
     if (page_buffer->size() != compressed_len) {
       std::stringstream ss;
       ss << "Page was smaller (" << page_buffer->size() << ") than expected ("
@@ -335,53 +434,27 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
     }
 
     // Decrypt it if we need to
-    if (crypto_ctx_.data_decryptor != nullptr) {
-      PARQUET_THROW_NOT_OK(decryption_buffer_->Resize(
-          compressed_len - crypto_ctx_.data_decryptor->CiphertextSizeDelta(), false));
-      compressed_len = crypto_ctx_.data_decryptor->Decrypt(
-          page_buffer->data(), compressed_len, decryption_buffer_->mutable_data());
-
-      page_buffer = decryption_buffer_;
-    }
-    // Uncompress it if we need to
-    if (decompressor_ != nullptr) {
-      page_buffer = DecompressPage(compressed_len, uncompressed_len, page_buffer->data());
+    if (crypto_ctx_.data_decryptor != nullptr && decryption_buffer != nullptr) {
+      PARQUET_THROW_NOT_OK(DecryptPage(*page_buffer, crypto_ctx_.data_decryptor.get(),
+                                       current_page_aad_, decryption_buffer.get()));
+      page_buffer = decryption_buffer;
     }
 
-    const PageType::type page_type = LoadEnumSafe(&current_page_header_.type);
-
     if (page_type == PageType::DICTIONARY_PAGE) {
       crypto_ctx_.start_decrypt_with_dictionary_page = false;
-      const format::DictionaryPageHeader& dict_header =
-          current_page_header_.dictionary_page_header;
-
-      bool is_sorted = dict_header.__isset.is_sorted ? dict_header.is_sorted : false;
-      if (dict_header.num_values < 0) {
+      if (current_page_header_.dictionary_page_header.num_values < 0) {
         throw ParquetException("Invalid page header (negative number of values)");
       }
-
-      return std::make_shared<DictionaryPage>(page_buffer, dict_header.num_values,
-                                              LoadEnumSafe(&dict_header.encoding),
-                                              is_sorted);
     } else if (page_type == PageType::DATA_PAGE) {
       ++page_ordinal_;
       const format::DataPageHeader& header = current_page_header_.data_page_header;
-
       if (header.num_values < 0) {
         throw ParquetException("Invalid page header (negative number of values)");
       }
-      EncodedStatistics page_statistics = ExtractStatsFromHeader(header);
       seen_num_rows_ += header.num_values;
-
-      return std::make_shared<DataPageV1>(page_buffer, header.num_values,
-                                          LoadEnumSafe(&header.encoding),
-                                          LoadEnumSafe(&header.definition_level_encoding),
-                                          LoadEnumSafe(&header.repetition_level_encoding),
-                                          uncompressed_len, page_statistics);
-    } else if (page_type == PageType::DATA_PAGE_V2) {
+    } else {
       ++page_ordinal_;
       const format::DataPageHeaderV2& header = current_page_header_.data_page_header_v2;
-
       if (header.num_values < 0) {
         throw ParquetException("Invalid page header (negative number of values)");
       }
@@ -389,53 +462,177 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
           header.repetition_levels_byte_length < 0) {
         throw ParquetException("Invalid page header (negative levels byte length)");
       }
-      bool is_compressed = header.__isset.is_compressed ? header.is_compressed : false;
-      EncodedStatistics page_statistics = ExtractStatsFromHeader(header);
       seen_num_rows_ += header.num_values;
+    }
+    return page_buffer;
+  }
+  return nullptr;
+}
 
-      return std::make_shared<DataPageV2>(
-          page_buffer, header.num_values, header.num_nulls, header.num_rows,
-          LoadEnumSafe(&header.encoding), header.definition_levels_byte_length,
-          header.repetition_levels_byte_length, uncompressed_len, is_compressed,
-          page_statistics);
-    } else {
-      // We don't know what this page type is. We're allowed to skip non-data
-      // pages.
-      continue;
+// The size of the levels of a DataPageV2, which are never compressed
+static int UncompressedLevelsLength(const format::PageHeader& header) {
+  if (header.type != format::PageType::DATA_PAGE_V2) {
+    return 0;
+  }
+  return header.data_page_header_v2.repetition_levels_byte_length +
+         header.data_page_header_v2.definition_levels_byte_length;
+}
+
+std::shared_ptr<Page> SerializedPageReader::NextPage() {
+  if (prefetch_depth_ > 0 &&
+      (decompressor_ != nullptr || crypto_ctx_.data_decryptor != nullptr)) {
+    return NextPrefetchedPage();
+  }
+
+  std::shared_ptr<Buffer> page_buffer = ReadPage(decryption_buffer_);
+  if (page_buffer == nullptr) {
+    return std::shared_ptr<Page>(nullptr);
+  }
+  // Uncompress it if we need to
+  if (decompressor_ != nullptr) {
+    PARQUET_THROW_NOT_OK(DecompressPage(
+        *page_buffer, current_page_header_.uncompressed_page_size,
+        UncompressedLevelsLength(current_page_header_), decompressor_.get(),
+        decompression_buffer_.get()));
+    page_buffer = decompression_buffer_;
+  }
+  return MakePage(current_page_header_, std::move(page_buffer));
+}
+
+std::shared_ptr<Page> SerializedPageReader::NextPrefetchedPage() {
+  PrefetchPages();
+  if (prefetched_pages_.empty()) {
+    return std::shared_ptr<Page>(nullptr);
+  }
+  PrefetchedPage next = std::move(prefetched_pages_.front());
+  prefetched_pages_.pop_front();
+  PARQUET_ASSIGN_OR_THROW(auto page_buffer, next.buffer.result());
+  // Now that the codec of the page is free again, keep prefetch_depth_ pages
+  // in flight while the caller decodes this one
+  PrefetchPages();
+  return MakePage(next.header, std::move(page_buffer));
+}
+
+void SerializedPageReader::PrefetchPages() {
+  if (prefetch_codecs_.empty()) {
+    for (int i = 0; i < prefetch_depth_; ++i) {
+      prefetch_codecs_.push_back(internal::GetReadCodec(codec_));
+    }
+  }
+  auto thread_pool = ::arrow::internal::GetCpuThreadPool();
+  while (!prefetch_finished_ && prefetched_pages_.size() < prefetch_codecs_.size()) {
+    // Encrypted pages are read as is and decrypted on the thread pool too
+    std::shared_ptr<Buffer> page_buffer = ReadPage(/*decryption_buffer=*/nullptr);
+    if (page_buffer == nullptr) {
+      prefetch_finished_ = true;
+      break;
     }
+    const int uncompressed_len = current_page_header_.uncompressed_page_size;
+    const int levels_length = UncompressedLevelsLength(current_page_header_);
+    std::shared_ptr<::arrow::util::Codec> codec =
+        prefetch_codecs_[num_prefetched_pages_++ % prefetch_codecs_.size()];
+    std::shared_ptr<Decryptor> decryptor = crypto_ctx_.data_decryptor;
+    std::string aad = current_page_aad_;
+    ::arrow::MemoryPool* pool = pool_;
+    PARQUET_ASSIGN_OR_THROW(
+        auto future,
+        thread_pool->Submit([page_buffer, uncompressed_len, levels_length, codec,
+                             decryptor, aad,
+                             pool]() -> ::arrow::Result<std::shared_ptr<Buffer>> {
+          // Each page in flight needs its own buffers
+          std::shared_ptr<Buffer> compressed = page_buffer;
+          if (decryptor != nullptr) {
+            std::shared_ptr<ResizableBuffer> decrypted = AllocateBuffer(pool, 0);
+            RETURN_NOT_OK(DecryptPage(*page_buffer, decryptor.get(), aad,
+                                      decrypted.get()));
+            compressed = std::move(decrypted);
+          }
+          if (codec == nullptr) {
+            return compressed;
+          }
+          std::shared_ptr<ResizableBuffer> out = AllocateBuffer(pool, 0);
+          RETURN_NOT_OK(DecompressPage(*compressed, uncompressed_len, levels_length,
+                                       codec.get(), out.get()));
+          return out;
+        }));
+    prefetched_pages_.push_back({current_page_header_, std::move(future)});
   }
-  return std::shared_ptr<Page>(nullptr);
 }
 
-std::shared_ptr<Buffer> SerializedPageReader::DecompressPage(int compressed_len,
-                                                             int uncompressed_len,
-                                                             const uint8_t* page_buffer) {
+std::shared_ptr<Page> SerializedPageReader::MakePage(
+    const format::PageHeader& page_header, std::shared_ptr<Buffer> page_buffer) {
+  const PageType::type page_type = LoadEnumSafe(&page_header.type);
+  const int uncompressed_len = page_header.uncompressed_page_size;
+  if (page_type == PageType::DICTIONARY_PAGE) {
+    const format::DictionaryPageHeader& dict_header = page_header.dictionary_page_header;
+
+    bool is_sorted = dict_header.__isset.is_sorted ? dict_header.is_sorted : false;
+
+    return std::make_shared<DictionaryPage>(
+        std::move(page_buffer), dict_header.num_values,
+        LoadEnumSafe(&dict_header.encoding), is_sorted);
+  } else if (page_type == PageType::DATA_PAGE) {
+    const format::DataPageHeader& header = page_header.data_page_header;
+    EncodedStatistics page_statistics = ExtractStatsFromHeader(header);
+
+    return std::make_shared<DataPageV1>(std::move(page_buffer), header.num_values,
+                                        LoadEnumSafe(&header.encoding),
+                                        LoadEnumSafe(&header.definition_level_encoding),
+                                        LoadEnumSafe(&header.repetition_level_encoding),
+                                        uncompressed_len, page_statistics);
+  } else {
+    const format::DataPageHeaderV2& header = page_header.data_page_header_v2;
+    bool is_compressed = header.__isset.is_compressed ? header.is_compressed : false;
+    EncodedStatistics page_statistics = ExtractStatsFromHeader(header);
+
+    return std::make_shared<DataPageV2>(
+        std::move(page_buffer), header.num_values, header.num_nulls, header.num_rows,
+        LoadEnumSafe(&header.encoding), header.definition_levels_byte_length,
+        header.repetition_levels_byte_length, uncompressed_len, is_compressed,
+        page_statistics);
+  }
+}
+
+::arrow::Status SerializedPageReader::DecryptPage(const Buffer& page,
+                                                  Decryptor* decryptor,
+                                                  const std::string& aad,
+                                                  ResizableBuffer* out) {
+  RETURN_NOT_OK(out->Resize(page.size() - decryptor->CiphertextSizeDelta(), false));
+  int decrypted_len;
+  try {
+    decrypted_len = decryptor->Decrypt(page.data(), static_cast<int>(page.size()),
+                                       out->mutable_data(), aad);
+  } catch (const ParquetException& e) {
+    return ::arrow::Status::IOError(e.what());
+  }
+  return out->Resize(decrypted_len, false);
+}
+
+::arrow::Status SerializedPageReader::DecompressPage(const Buffer& page,
+                                                     int uncompressed_len,
+                                                     int levels_length,
+                                                     ::arrow::util::Codec* codec,
+                                                     ResizableBuffer* out) {
+  ::arrow::util::TraceSpan span("parquet", "DecompressPage");
+  span.AddBytes(uncompressed_len);
   // Grow the uncompressed buffer if we need to.
-  if (uncompressed_len > static_cast<int>(decompression_buffer_->size())) {
-    PARQUET_THROW_NOT_OK(decompression_buffer_->Resize(uncompressed_len, false));
+  if (uncompressed_len > static_cast<int>(out->size())) {
+    RETURN_NOT_OK(out->Resize(uncompressed_len, false));
+  }
+  const auto compressed_len = static_cast<int>(page.size());
+  if (levels_length > compressed_len || levels_length > uncompressed_len) {
+    return ::arrow::Status::IOError("Invalid page header (levels larger than page)");
   }
 
-  if (current_page_header_.type != format::PageType::DATA_PAGE_V2) {
-    PARQUET_THROW_NOT_OK(
-        decompressor_->Decompress(compressed_len, page_buffer, uncompressed_len,
-                                  decompression_buffer_->mutable_data()));
-  } else {
-    // The levels are not compressed in V2 format
-    const auto& header = current_page_header_.data_page_header_v2;
-    int32_t levels_length =
-        header.repetition_levels_byte_length + header.definition_levels_byte_length;
-    uint8_t* decompressed = decompression_buffer_->mutable_data();
-    memcpy(decompressed, page_buffer, levels_length);
-    decompressed += levels_length;
-    const uint8_t* compressed_values = page_buffer + levels_length;
-
-    // Decompress the values
-    PARQUET_THROW_NOT_OK(
-        decompressor_->Decompress(compressed_len - levels_length, compressed_values,
-                                  uncompressed_len - levels_length, decompressed));
-  }
-
-  return decompression_buffer_;
+  // The levels are not compressed in V2 format
+  uint8_t* decompressed = out->mutable_data();
+  memcpy(decompressed, page.data(), levels_length);
+
+  // Decompress the values
+  return codec
+      ->Decompress(compressed_len - levels_length, page.data() + levels_length,
+                   uncompressed_len - levels_length, decompressed + levels_length)
+      .status();
 }
 
 std::unique_ptr<PageReader> PageReader::Open(std::shared_ptr<ArrowInputStream> stream,
@@ -701,8 +898,11 @@ class ColumnReaderImplBase {
           decoders_[static_cast<int>(encoding)] = std::move(decoder);
           break;
         }
-        case Encoding::BYTE_STREAM_SPLIT: {
-          auto decoder = MakeTypedDecoder<DType>(Encoding::BYTE_STREAM_SPLIT, descr_);
+        case Encoding::BYTE_STREAM_SPLIT:
+        case Encoding::DELTA_BINARY_PACKED:
+        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+        case Encoding::DELTA_BYTE_ARRAY: {
+          auto decoder = MakeTypedDecoder<DType>(encoding, descr_);
           current_decoder_ = decoder.get();
           decoders_[static_cast<int>(encoding)] = std::move(decoder);
           break;
@@ -710,11 +910,6 @@ class ColumnReaderImplBase {
         case Encoding::RLE_DICTIONARY:
           throw ParquetException("Dictionary page must be before data page.");
 
-        case Encoding::DELTA_BINARY_PACKED:
-        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
-        case Encoding::DELTA_BYTE_ARRAY:
-          ParquetException::NYI("Unsupported encoding");
-
         default:
           throw ParquetException("Unknown encoding type.");
       }
@@ -1079,28 +1274,10 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
       }
 
       if (this->max_def_level_ > 0) {
-        ReserveLevels(batch_size);
-
-        int16_t* def_levels = this->def_levels() + levels_written_;
-        int16_t* rep_levels = this->rep_levels() + levels_written_;
-
-        // Not present for non-repeated fields
-        int64_t levels_read = 0;
-        if (this->max_rep_level_ > 0) {
-          levels_read = this->ReadDefinitionLevels(batch_size, def_levels);
-          if (this->ReadRepetitionLevels(batch_size, rep_levels) != levels_read) {
-            throw ParquetException("Number of decoded rep / def levels did not match");
-          }
-        } else if (this->max_def_level_ > 0) {
-          levels_read = this->ReadDefinitionLevels(batch_size, def_levels);
-        }
-
         // Exhausted column chunk
-        if (levels_read == 0) {
+        if (ReadLevels(batch_size) == 0) {
           break;
         }
-
-        levels_written_ += levels_read;
         records_read += ReadRecordData(num_records - records_read);
       } else {
         // No repetition or definition levels
@@ -1112,6 +1289,202 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     return records_read;
   }
 
+  int64_t SkipRecords(int64_t num_records) override {
+    if (this->pager_ == nullptr) {
+      return 0;
+    }
+
+    int64_t records_skipped = 0;
+    if (has_values_to_process()) {
+      records_skipped += SkipRecordData(num_records);
+    }
+
+    int64_t level_batch_size = std::max(kMinLevelBatchSize, num_records);
+
+    // Same loop as ReadRecords, except that for non-repeated columns the pages
+    // which only hold records to skip are skipped as a whole
+    while (!at_record_start_ || records_skipped < num_records) {
+      if (this->max_rep_level_ == 0 && available_values_current_page() == 0) {
+        records_skipped += SkipDataPages(num_records - records_skipped);
+        if (records_skipped == num_records) {
+          break;
+        }
+      }
+
+      if (!this->HasNextInternal()) {
+        if (!at_record_start_) {
+          ++records_skipped;
+          at_record_start_ = true;
+        }
+        break;
+      }
+
+      int64_t batch_size = std::min(level_batch_size, available_values_current_page());
+      if (batch_size == 0) {
+        break;
+      }
+
+      if (this->max_def_level_ > 0) {
+        if (ReadLevels(batch_size) == 0) {
+          break;
+        }
+        records_skipped += SkipRecordData(num_records - records_skipped);
+      } else {
+        batch_size = std::min(num_records - records_skipped, batch_size);
+        records_skipped += SkipRecordData(batch_size);
+      }
+    }
+
+    return records_skipped;
+  }
+
+  int64_t ReadRecordsInto(int64_t num_records, uint8_t* values, uint8_t* valid_bits,
+                          int64_t valid_bits_offset, int64_t* null_count) override {
+    if (!std::is_arithmetic<T>::value || this->max_rep_level_ > 0) {
+      throw ParquetException(
+          "Reading into caller-provided buffers is only supported for non-repeated "
+          "columns of fixed-width primitive type");
+    }
+    if (values_written_ > 0) {
+      throw ParquetException(
+          "Values were read since the last Reset() of the record reader");
+    }
+    external_values_ = values;
+    external_valid_bits_ = valid_bits;
+    external_valid_bits_offset_ = valid_bits_offset;
+    int64_t records_read = 0;
+    try {
+      records_read = ReadRecords(num_records);
+    } catch (...) {
+      external_values_ = external_valid_bits_ = nullptr;
+      Reset();
+      throw;
+    }
+    *null_count = null_count_;
+    external_values_ = external_valid_bits_ = nullptr;
+    Reset();
+    return records_read;
+  }
+
+  // Decode up to batch_size repetition/definition levels of the current page
+  // after the levels written so far
+  //
+  // \return Number of levels decoded
+  int64_t ReadLevels(int64_t batch_size) {
+    ReserveLevels(batch_size);
+
+    int16_t* def_levels = this->def_levels() + levels_written_;
+    int16_t* rep_levels = this->rep_levels() + levels_written_;
+
+    // Not present for non-repeated fields
+    int64_t levels_read = 0;
+    if (this->max_rep_level_ > 0) {
+      levels_read = this->ReadDefinitionLevels(batch_size, def_levels);
+      if (this->ReadRepetitionLevels(batch_size, rep_levels) != levels_read) {
+        throw ParquetException("Number of decoded rep / def levels did not match");
+      }
+    } else if (this->max_def_level_ > 0) {
+      levels_read = this->ReadDefinitionLevels(batch_size, def_levels);
+    }
+
+    levels_written_ += levels_read;
+    return levels_read;
+  }
+
+  // Skip the data pages following the current one as long as they only hold
+  // records to skip, decompressing none of them, and load the next page.
+  // Only valid for non-repeated columns, whose pages hold whole records.
+  //
+  // \return Number of records skipped
+  int64_t SkipDataPages(int64_t num_records) {
+    DCHECK_EQ(this->max_rep_level_, 0);
+    int64_t records_skipped = 0;
+    // The pages which the filter set by the caller skips don't count as
+    // skipped records
+    DataPageFilter filter = this->pager_->data_page_filter();
+    this->pager_->set_data_page_filter([&](const DataPageStats& stats) {
+      if (filter && filter(stats)) {
+        return true;
+      }
+      if (stats.num_values > num_records - records_skipped) {
+        return false;
+      }
+      records_skipped += stats.num_values;
+      return true;
+    });
+    try {
+      this->HasNextInternal();
+    } catch (...) {
+      this->pager_->set_data_page_filter(std::move(filter));
+      throw;
+    }
+    this->pager_->set_data_page_filter(std::move(filter));
+    return records_skipped;
+  }
+
+  // Skip the values of up to num_records records from the levels written
+  // so far, and drop their levels
+  //
+  // \return Number of records skipped
+  int64_t SkipRecordData(int64_t num_records) {
+    const int64_t start_levels_position = levels_position_;
+
+    int64_t values_to_skip = 0;
+    int64_t records_skipped = 0;
+    if (this->max_rep_level_ > 0) {
+      records_skipped = DelimitRecords(num_records, &values_to_skip);
+    } else if (this->max_def_level_ > 0) {
+      records_skipped = std::min(levels_written_ - levels_position_, num_records);
+      const int16_t* def_levels = this->def_levels() + levels_position_;
+      values_to_skip =
+          std::count(def_levels, def_levels + records_skipped, this->max_def_level_);
+      levels_position_ += records_skipped;
+    } else {
+      records_skipped = values_to_skip = num_records;
+    }
+
+    SkipValues(values_to_skip);
+    if (this->max_def_level_ > 0) {
+      const int64_t levels_skipped = levels_position_ - start_levels_position;
+      this->ConsumeBufferedValues(levels_skipped);
+
+      // Shift the levels which remain to process over the skipped ones
+      int16_t* def_data = def_levels();
+      std::copy(def_data + levels_position_, def_data + levels_written_,
+                def_data + start_levels_position);
+      if (this->max_rep_level_ > 0) {
+        int16_t* rep_data = rep_levels();
+        std::copy(rep_data + levels_position_, rep_data + levels_written_,
+                  rep_data + start_levels_position);
+      }
+      levels_written_ -= levels_skipped;
+      levels_position_ = start_levels_position;
+    } else {
+      this->ConsumeBufferedValues(values_to_skip);
+    }
+    return records_skipped;
+  }
+
+  // Decode and discard values of the current page
+  void SkipValues(int64_t num_values) {
+    constexpr int kSkipBatchSize = 1024;
+    if (num_values == 0) {
+      return;
+    }
+    if (skip_buffer_ == nullptr) {
+      skip_buffer_ = AllocateBuffer(this->pool_, kSkipBatchSize * sizeof(T));
+    }
+    T* values = reinterpret_cast<T*>(skip_buffer_->mutable_data());
+    while (num_values > 0) {
+      const int batch_size =
+          static_cast<int>(std::min<int64_t>(num_values, kSkipBatchSize));
+      if (this->current_decoder_->Decode(values, batch_size) != batch_size) {
+        throw ParquetException("Could not decode the values to skip");
+      }
+      num_values -= batch_size;
+    }
+  }
+
   // We may outwardly have the appearance of having exhausted a column chunk
   // when in fact we are in the middle of processing the last batch
   bool has_values_to_process() const { return levels_position_ < levels_written_; }
@@ -1243,13 +1616,13 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     if (new_values_capacity > values_capacity_) {
       // XXX(wesm): A hack to avoid memory allocation when reading directly
       // into builder classes
-      if (uses_values_) {
+      if (uses_values_ && external_values_ == nullptr) {
         PARQUET_THROW_NOT_OK(
             values_->Resize(bytes_for_values(new_values_capacity), false));
       }
       values_capacity_ = new_values_capacity;
     }
-    if (nullable_values_) {
+    if (nullable_values_ && external_values_ == nullptr) {
       int64_t valid_bytes_new = BitUtil::BytesForBits(values_capacity_);
       if (valid_bits_->size() < valid_bytes_new) {
         int64_t valid_bytes_old = BitUtil::BytesForBits(values_written_);
@@ -1304,12 +1677,9 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
   void ResetDecoders() { this->decoders_.clear(); }
 
   virtual void ReadValuesSpaced(int64_t values_with_nulls, int64_t null_count) {
-    uint8_t* valid_bits = valid_bits_->mutable_data();
-    const int64_t valid_bits_offset = values_written_;
-
     int64_t num_decoded = this->current_decoder_->DecodeSpaced(
         ValuesHead<T>(), static_cast<int>(values_with_nulls),
-        static_cast<int>(null_count), valid_bits, valid_bits_offset);
+        static_cast<int>(null_count), ValidBitsData(), ValidBitsOffset());
     DCHECK_EQ(num_decoded, values_with_nulls);
   }
 
@@ -1349,7 +1719,7 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
       DefinitionLevelsToBitmap(
           def_levels() + start_levels_position, levels_position_ - start_levels_position,
           this->max_def_level_, this->max_rep_level_, &values_with_nulls, &null_count,
-          valid_bits_->mutable_data(), values_written_);
+          ValidBitsData(), ValidBitsOffset());
       values_to_read = values_with_nulls - null_count;
       DCHECK_GE(values_to_read, 0);
       ReadValuesSpaced(values_with_nulls, null_count);
@@ -1413,8 +1783,28 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
  protected:
   template <typename T>
   T* ValuesHead() {
-    return reinterpret_cast<T*>(values_->mutable_data()) + values_written_;
+    uint8_t* values =
+        external_values_ != nullptr ? external_values_ : values_->mutable_data();
+    return reinterpret_cast<T*>(values) + values_written_;
+  }
+
+  // The validity bitmap and the offset of the next value's bit in it
+  uint8_t* ValidBitsData() {
+    return external_values_ != nullptr ? external_valid_bits_
+                                       : valid_bits_->mutable_data();
+  }
+  int64_t ValidBitsOffset() const {
+    return external_values_ != nullptr ? external_valid_bits_offset_ + values_written_
+                                       : values_written_;
   }
+
+  // Scratch space for the values decoded by SkipValues
+  std::shared_ptr<ResizableBuffer> skip_buffer_;
+
+  // The caller-provided buffers, during ReadRecordsInto()
+  uint8_t* external_values_ = nullptr;
+  uint8_t* external_valid_bits_ = nullptr;
+  int64_t external_valid_bits_offset_ = 0;
 };
 
 class FLBARecordReader : public TypedRecordReader<FLBAType>,
@@ -1515,17 +1905,33 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
  public:
   ByteArrayDictionaryRecordReader(const ColumnDescriptor* descr,
                                   ::arrow::MemoryPool* pool)
-      : TypedRecordReader<ByteArrayType>(descr, pool), builder_(pool) {
+      : TypedRecordReader<ByteArrayType>(descr, pool),
+        builder_(pool),
+        indices_builder_(pool) {
     this->read_dictionary_ = true;
   }
 
   std::shared_ptr<::arrow::ChunkedArray> GetResult() override {
+    FlushIndices();
     FlushBuilder();
     std::vector<std::shared_ptr<::arrow::Array>> result;
     std::swap(result, result_chunks_);
     return std::make_shared<::arrow::ChunkedArray>(std::move(result), builder_.type());
   }
 
+  // Dictionary-encoded pages are decoded to indices into dictionary_, while
+  // the values of pages which fell back to another encoding go through the
+  // builder, so the decoded values are flushed when switching from one to the
+  // other to keep them in order
+  void FlushIndices() {
+    if (indices_builder_.length() > 0) {
+      std::shared_ptr<::arrow::Array> indices;
+      PARQUET_THROW_NOT_OK(indices_builder_.Finish(&indices));
+      result_chunks_.push_back(std::make_shared<::arrow::DictionaryArray>(
+          builder_.type(), std::move(indices), dictionary_));
+    }
+  }
+
   void FlushBuilder() {
     if (builder_.length() > 0) {
       std::shared_ptr<::arrow::Array> chunk;
@@ -1533,18 +1939,21 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
       result_chunks_.emplace_back(std::move(chunk));
 
       // Also clears the dictionary memo table
-      builder_.Reset();
+      builder_.ResetFull();
     }
   }
 
   void MaybeWriteNewDictionary() {
     if (this->new_dictionary_) {
-      /// If there is a new dictionary, we may need to flush the builder, then
-      /// insert the new dictionary values
-      FlushBuilder();
-      builder_.ResetFull();
+      // Consecutive column chunks often have identical dictionaries: keep
+      // appending indices to the current chunk then, so that the chunks of
+      // the result share one dictionary
       auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
-      decoder->InsertDictionary(&builder_);
+      auto dictionary = decoder->GetDictionary();
+      if (dictionary_ == nullptr || !dictionary_->Equals(*dictionary)) {
+        FlushIndices();
+        dictionary_ = CopyDictionary(*dictionary);
+      }
       this->new_dictionary_ = false;
     }
   }
@@ -1552,10 +1961,13 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
   void ReadValuesDense(int64_t values_to_read) override {
     int64_t num_decoded = 0;
     if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+      FlushBuilder();
       MaybeWriteNewDictionary();
       auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
-      num_decoded = decoder->DecodeIndices(static_cast<int>(values_to_read), &builder_);
+      num_decoded =
+          decoder->DecodeIndices(static_cast<int>(values_to_read), &indices_builder_);
     } else {
+      FlushIndices();
       num_decoded = this->current_decoder_->DecodeArrowNonNull(
           static_cast<int>(values_to_read), &builder_);
 
@@ -1568,12 +1980,14 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
   void ReadValuesSpaced(int64_t values_to_read, int64_t null_count) override {
     int64_t num_decoded = 0;
     if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+      FlushBuilder();
       MaybeWriteNewDictionary();
       auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
       num_decoded = decoder->DecodeIndicesSpaced(
           static_cast<int>(values_to_read), static_cast<int>(null_count),
-          valid_bits_->mutable_data(), values_written_, &builder_);
+          valid_bits_->mutable_data(), values_written_, &indices_builder_);
     } else {
+      FlushIndices();
       num_decoded = this->current_decoder_->DecodeArrow(
           static_cast<int>(values_to_read), static_cast<int>(null_count),
           valid_bits_->mutable_data(), values_written_, &builder_);
@@ -1587,7 +2001,23 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
  private:
   using BinaryDictDecoder = DictDecoder<ByteArrayType>;
 
+  // The decoder reuses its memory for the next dictionary page
+  std::shared_ptr<::arrow::Array> CopyDictionary(const ::arrow::Array& dictionary) {
+    const auto& data = *dictionary.data();
+    std::vector<std::shared_ptr<Buffer>> buffers = {nullptr};
+    for (size_t i = 1; i < data.buffers.size(); ++i) {
+      PARQUET_ASSIGN_OR_THROW(
+          auto buffer, data.buffers[i]->CopySlice(0, data.buffers[i]->size(), pool_));
+      buffers.push_back(std::move(buffer));
+    }
+    return ::arrow::MakeArray(
+        ::arrow::ArrayData::Make(data.type, data.length, std::move(buffers), 0));
+  }
+
   ::arrow::BinaryDictionary32Builder builder_;
+  ::arrow::Int32Builder indices_builder_;
+  // The dictionary of the indices in indices_builder_
+  std::shared_ptr<::arrow::Array> dictionary_;
   std::vector<std::shared_ptr<::arrow::Array>> result_chunks_;
 };
 
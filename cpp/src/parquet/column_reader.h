@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -45,6 +46,7 @@ class RleDecoder;
 namespace parquet {
 
 class Decryptor;
+class EncodedStatistics;
 class Page;
 
 // 16 MB is the default maximum page header size
@@ -94,6 +96,25 @@ struct CryptoContext {
   std::shared_ptr<Decryptor> data_decryptor;
 };
 
+/// \brief The header fields of a data page, as seen by a DataPageFilter
+struct PARQUET_EXPORT DataPageStats {
+  DataPageStats(const EncodedStatistics* encoded_statistics, int32_t num_values,
+                int32_t num_rows)
+      : encoded_statistics(encoded_statistics),
+        num_values(num_values),
+        num_rows(num_rows) {}
+
+  /// The statistics of the page header; none are set if the header has none
+  const EncodedStatistics* encoded_statistics;
+  /// The number of values of the page, nulls included
+  int32_t num_values;
+  /// The number of rows of the page, or -1 if unknown (V1 data pages)
+  int32_t num_rows;
+};
+
+/// \brief A callback returning true for the data pages to skip
+using DataPageFilter = std::function<bool(const DataPageStats&)>;
+
 // Abstract page iterator interface. This way, we can feed column pages to the
 // ColumnReader through whatever mechanism we choose
 class PARQUET_EXPORT PageReader {
@@ -110,6 +131,33 @@ class PARQUET_EXPORT PageReader {
   virtual std::shared_ptr<Page> NextPage() = 0;
 
   virtual void set_max_page_header_size(uint32_t size) = 0;
+
+  /// \brief Skip the data pages for which the filter returns true
+  ///
+  /// Skipped pages are neither decrypted nor decompressed, and NextPage()
+  /// doesn't return them. Since the values of the skipped pages of the
+  /// different columns of a row group generally don't belong to the same
+  /// rows, this is meant for readers of a single column, or for filters
+  /// which skip the same rows in all columns.
+  void set_data_page_filter(DataPageFilter data_page_filter) {
+    data_page_filter_ = std::move(data_page_filter);
+  }
+
+  const DataPageFilter& data_page_filter() const { return data_page_filter_; }
+
+  /// \brief Decrypt and decompress up to prefetch_depth pages ahead of the
+  /// one returned by NextPage() on the CPU thread pool
+  ///
+  /// Only has an effect on compressed or encrypted column chunks, and must be
+  /// set before the first call to NextPage(). Each prefetched page holds its
+  /// own decrypted and decompressed buffers.
+  void set_prefetch_depth(int prefetch_depth) { prefetch_depth_ = prefetch_depth; }
+
+  int prefetch_depth() const { return prefetch_depth_; }
+
+ protected:
+  DataPageFilter data_page_filter_;
+  int prefetch_depth_ = 0;
 };
 
 class PARQUET_EXPORT ColumnReader {
@@ -218,6 +266,31 @@ class RecordReader {
   /// \return number of records read
   virtual int64_t ReadRecords(int64_t num_records) = 0;
 
+  /// \brief Skip the indicated number of records from the column chunk
+  ///
+  /// The levels and values of the skipped records aren't added to those
+  /// read so far. For non-repeated columns, the data pages which only hold
+  /// skipped records are neither decompressed nor decoded.
+  /// \return number of records skipped
+  virtual int64_t SkipRecords(int64_t num_records) = 0;
+
+  /// \brief Read up to num_records records, decoding their values straight
+  /// into caller-provided memory instead of the internal values buffer
+  ///
+  /// Only supported for non-repeated columns of a physical type other than
+  /// BYTE_ARRAY, FIXED_LEN_BYTE_ARRAY and INT96, and when no values have been
+  /// read since the last Reset(). Records and values are the same for those
+  /// columns. The decoded values, nulls included, are written from values on.
+  /// The validity bits are written from bit valid_bits_offset of valid_bits
+  /// on, but only if nullable_values() is true; valid_bits may be null
+  /// otherwise. values must have room for num_records values. On return,
+  /// the reader is in the same state as after Reset().
+  /// \param[out] null_count number of null values read
+  /// \return number of records read
+  virtual int64_t ReadRecordsInto(int64_t num_records, uint8_t* values,
+                                  uint8_t* valid_bits, int64_t valid_bits_offset,
+                                  int64_t* null_count) = 0;
+
   /// \brief Pre-allocate space for data. Results in better flat read performance
   virtual void Reserve(int64_t num_values) = 0;
 
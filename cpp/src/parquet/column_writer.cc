@@ -33,15 +33,18 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_stream_utils.h"
+#include "arrow/util/bitmap_reader.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/encryption_internal.h"
 #include "parquet/internal_file_encryptor.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -154,7 +157,8 @@ class SerializedPageWriter : public PageWriter {
                        int16_t row_group_ordinal, int16_t column_chunk_ordinal,
                        MemoryPool* pool = ::arrow::default_memory_pool(),
                        std::shared_ptr<Encryptor> meta_encryptor = nullptr,
-                       std::shared_ptr<Encryptor> data_encryptor = nullptr)
+                       std::shared_ptr<Encryptor> data_encryptor = nullptr,
+                       ColumnChunkPageIndexBuilder* page_index_builder = nullptr)
       : sink_(std::move(sink)),
         metadata_(metadata),
         pool_(pool),
@@ -168,7 +172,8 @@ class SerializedPageWriter : public PageWriter {
         column_ordinal_(column_chunk_ordinal),
         meta_encryptor_(std::move(meta_encryptor)),
         data_encryptor_(std::move(data_encryptor)),
-        encryption_buffer_(AllocateBuffer(pool, 0)) {
+        encryption_buffer_(AllocateBuffer(pool, 0)),
+        page_index_builder_(page_index_builder) {
     if (data_encryptor_ != nullptr || meta_encryptor_ != nullptr) {
       InitEncryption();
     }
@@ -309,6 +314,13 @@ class SerializedPageWriter : public PageWriter {
         thrift_serializer_->Serialize(&page_header, sink_.get(), meta_encryptor_);
     PARQUET_THROW_NOT_OK(sink_->Write(output_data_buffer, output_data_len));
 
+    if (page_index_builder_ != nullptr) {
+      // Page index builders are only used for non-repeated columns, whose pages
+      // have as many rows as values
+      page_index_builder_->AddPage(page.statistics(), page.num_values(), start_pos,
+                                   static_cast<int32_t>(header_size + output_data_len));
+    }
+
     total_uncompressed_size_ += uncompressed_size + header_size;
     total_compressed_size_ += output_data_len + header_size;
     num_values_ += page.num_values();
@@ -441,6 +453,8 @@ class SerializedPageWriter : public PageWriter {
 
   std::shared_ptr<ResizableBuffer> encryption_buffer_;
 
+  ColumnChunkPageIndexBuilder* page_index_builder_;
+
   std::map<Encoding::type, int32_t> dict_encoding_stats_;
   std::map<Encoding::type, int32_t> data_encoding_stats_;
 };
@@ -453,13 +467,17 @@ class BufferedPageWriter : public PageWriter {
                      int16_t row_group_ordinal, int16_t current_column_ordinal,
                      MemoryPool* pool = ::arrow::default_memory_pool(),
                      std::shared_ptr<Encryptor> meta_encryptor = nullptr,
-                     std::shared_ptr<Encryptor> data_encryptor = nullptr)
-      : final_sink_(std::move(sink)), metadata_(metadata), has_dictionary_pages_(false) {
+                     std::shared_ptr<Encryptor> data_encryptor = nullptr,
+                     ColumnChunkPageIndexBuilder* page_index_builder = nullptr)
+      : final_sink_(std::move(sink)),
+        metadata_(metadata),
+        page_index_builder_(page_index_builder),
+        has_dictionary_pages_(false) {
     in_memory_sink_ = CreateOutputStream(pool);
-    pager_ = std::unique_ptr<SerializedPageWriter>(
-        new SerializedPageWriter(in_memory_sink_, codec, compression_level, metadata,
-                                 row_group_ordinal, current_column_ordinal, pool,
-                                 std::move(meta_encryptor), std::move(data_encryptor)));
+    pager_ = std::unique_ptr<SerializedPageWriter>(new SerializedPageWriter(
+        in_memory_sink_, codec, compression_level, metadata, row_group_ordinal,
+        current_column_ordinal, pool, std::move(meta_encryptor),
+        std::move(data_encryptor), page_index_builder));
   }
 
   int64_t WriteDictionaryPage(const DictionaryPage& page) override {
@@ -488,6 +506,9 @@ class BufferedPageWriter : public PageWriter {
     // flush everything to the serialized sink
     PARQUET_ASSIGN_OR_THROW(auto buffer, in_memory_sink_->Finish());
     PARQUET_THROW_NOT_OK(final_sink_->Write(buffer));
+    if (page_index_builder_ != nullptr) {
+      page_index_builder_->ShiftOffsets(final_position);
+    }
   }
 
   int64_t WriteDataPage(const DataPage& page) override {
@@ -503,6 +524,7 @@ class BufferedPageWriter : public PageWriter {
  private:
   std::shared_ptr<ArrowOutputStream> final_sink_;
   ColumnChunkMetaDataBuilder* metadata_;
+  ColumnChunkPageIndexBuilder* page_index_builder_;
   std::shared_ptr<::arrow::io::BufferOutputStream> in_memory_sink_;
   std::unique_ptr<SerializedPageWriter> pager_;
   bool has_dictionary_pages_;
@@ -513,17 +535,18 @@ std::unique_ptr<PageWriter> PageWriter::Open(
     int compression_level, ColumnChunkMetaDataBuilder* metadata,
     int16_t row_group_ordinal, int16_t column_chunk_ordinal, MemoryPool* pool,
     bool buffered_row_group, std::shared_ptr<Encryptor> meta_encryptor,
-    std::shared_ptr<Encryptor> data_encryptor) {
+    std::shared_ptr<Encryptor> data_encryptor,
+    ColumnChunkPageIndexBuilder* page_index_builder) {
   if (buffered_row_group) {
-    return std::unique_ptr<PageWriter>(
-        new BufferedPageWriter(std::move(sink), codec, compression_level, metadata,
-                               row_group_ordinal, column_chunk_ordinal, pool,
-                               std::move(meta_encryptor), std::move(data_encryptor)));
+    return std::unique_ptr<PageWriter>(new BufferedPageWriter(
+        std::move(sink), codec, compression_level, metadata, row_group_ordinal,
+        column_chunk_ordinal, pool, std::move(meta_encryptor), std::move(data_encryptor),
+        page_index_builder));
   } else {
-    return std::unique_ptr<PageWriter>(
-        new SerializedPageWriter(std::move(sink), codec, compression_level, metadata,
-                                 row_group_ordinal, column_chunk_ordinal, pool,
-                                 std::move(meta_encryptor), std::move(data_encryptor)));
+    return std::unique_ptr<PageWriter>(new SerializedPageWriter(
+        std::move(sink), codec, compression_level, metadata, row_group_ordinal,
+        column_chunk_ordinal, pool, std::move(meta_encryptor), std::move(data_encryptor),
+        page_index_builder));
   }
 }
 
@@ -625,6 +648,15 @@ class ColumnWriterImpl {
   // Serialize the buffered Data Pages
   void FlushBufferedDataPages();
 
+  // The size of buffer once compressed with the column's codec
+  int64_t CompressedSize(const Buffer& buffer) {
+    if (!pager_->has_compressor()) {
+      return buffer.size();
+    }
+    pager_->Compress(buffer, compressor_temp_buffer_.get());
+    return compressor_temp_buffer_->size();
+  }
+
   ColumnChunkMetaDataBuilder* metadata_;
   const ColumnDescriptor* descr_;
 
@@ -842,12 +874,13 @@ void ColumnWriterImpl::BuildDataPageV2(int64_t definition_levels_rle_size,
                             combined->CopySlice(0, combined->size(), allocator_));
     std::unique_ptr<DataPage> page_ptr(new DataPageV2(
         combined, num_values, null_count, num_values, encoding_, def_levels_byte_length,
-        rep_levels_byte_length, uncompressed_size, pager_->has_compressor()));
+        rep_levels_byte_length, uncompressed_size, pager_->has_compressor(), page_stats));
     total_compressed_bytes_ += page_ptr->size() + sizeof(format::PageHeader);
     data_pages_.push_back(std::move(page_ptr));
   } else {
     DataPageV2 page(combined, num_values, null_count, num_values, encoding_,
-                    def_levels_byte_length, rep_levels_byte_length, uncompressed_size);
+                    def_levels_byte_length, rep_levels_byte_length, uncompressed_size,
+                    pager_->has_compressor(), page_stats);
     WriteDataPage(page);
   }
 }
@@ -935,6 +968,53 @@ static inline bool IsDictionaryEncoding(Encoding::type encoding) {
   return encoding == Encoding::PLAIN_DICTIONARY;
 }
 
+// Whether a non-dictionary encoding applies to the physical type
+static bool IsValueEncodingSupported(Type::type physical_type, Encoding::type encoding) {
+  switch (encoding) {
+    case Encoding::PLAIN:
+      return true;
+    case Encoding::DELTA_BINARY_PACKED:
+      return physical_type == Type::INT32 || physical_type == Type::INT64;
+    case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+    case Encoding::DELTA_BYTE_ARRAY:
+      return physical_type == Type::BYTE_ARRAY;
+    case Encoding::BYTE_STREAM_SPLIT:
+      return physical_type == Type::FLOAT || physical_type == Type::DOUBLE;
+    default:
+      return false;
+  }
+}
+
+// The encoding used once dictionary encoding is abandoned: the column's
+// configured encoding if it applies to the physical type, else PLAIN
+static Encoding::type FallbackEncoding(Type::type physical_type,
+                                       Encoding::type configured) {
+  return IsValueEncodingSupported(physical_type, configured) ? configured
+                                                             : Encoding::PLAIN;
+}
+
+// The hash of a value for a Bloom filter, computed from its plain encoding
+template <typename T>
+inline uint64_t BloomFilterHash(const BloomFilter& filter, const ColumnDescriptor*,
+                                T value) {
+  return filter.Hash(value);
+}
+
+inline uint64_t BloomFilterHash(const BloomFilter& filter, const ColumnDescriptor*,
+                                const Int96& value) {
+  return filter.Hash(&value);
+}
+
+inline uint64_t BloomFilterHash(const BloomFilter& filter, const ColumnDescriptor*,
+                                const ByteArray& value) {
+  return filter.Hash(&value);
+}
+
+inline uint64_t BloomFilterHash(const BloomFilter& filter, const ColumnDescriptor* descr,
+                                const FLBA& value) {
+  return filter.Hash(&value, static_cast<uint32_t>(descr->type_length()));
+}
+
 template <typename DType>
 class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<DType> {
  public:
@@ -942,11 +1022,16 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
 
   TypedColumnWriterImpl(ColumnChunkMetaDataBuilder* metadata,
                         std::unique_ptr<PageWriter> pager, const bool use_dictionary,
-                        Encoding::type encoding, const WriterProperties* properties)
+                        Encoding::type encoding, const WriterProperties* properties,
+                        BloomFilter* bloom_filter)
       : ColumnWriterImpl(metadata, std::move(pager), use_dictionary, encoding,
-                         properties) {
+                         properties),
+        bloom_filter_(bloom_filter) {
     current_encoder_ = MakeEncoder(DType::type_num, encoding, use_dictionary, descr_,
                                    properties->memory_pool());
+    if (properties->adaptive_encoding_enabled(descr_->path())) {
+      InitCandidateEncoders();
+    }
 
     if (properties->statistics_enabled(descr_->path()) &&
         (SortOrder::UNKNOWN != descr_->sort_order())) {
@@ -955,7 +1040,18 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     }
   }
 
-  int64_t Close() override { return ColumnWriterImpl::Close(); }
+  int64_t Close() override {
+    if (!closed_ && !candidate_encoders_.empty()) {
+      // Choose the encoding of a chunk shorter than a page now, as the
+      // dictionary page is written first
+      if (num_buffered_values_ > 0) {
+        AddDataPage();
+      } else {
+        candidate_encoders_.clear();
+      }
+    }
+    return ColumnWriterImpl::Close();
+  }
 
   void WriteBatch(int64_t num_values, const int16_t* def_levels,
                   const int16_t* rep_levels, const T* values) override {
@@ -1022,6 +1118,9 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
 
  protected:
   std::shared_ptr<Buffer> GetValuesBuffer() override {
+    if (!candidate_encoders_.empty()) {
+      return ChooseEncoding();
+    }
     return current_encoder_->FlushValues();
   }
 
@@ -1085,8 +1184,12 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
   using ValueEncoderType = typename EncodingTraits<DType>::Encoder;
   using TypedStats = TypedStatistics<DType>;
   std::unique_ptr<Encoder> current_encoder_;
+  // With adaptive encoding, the encoders trying the other encodings on the
+  // values of the first page
+  std::vector<std::unique_ptr<Encoder>> candidate_encoders_;
   std::shared_ptr<TypedStats> page_statistics_;
   std::shared_ptr<TypedStats> chunk_statistics_;
+  BloomFilter* bloom_filter_;
 
   // If writing a sequence of ::arrow::DictionaryArray to the writer, we keep the
   // dictionary passed to DictEncoder<T>::PutDictionary so we can check
@@ -1180,6 +1283,48 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     *out_spaced_values_to_write = spaced_values_to_write;
   }
 
+  void InitCandidateEncoders() {
+    for (Encoding::type encoding :
+         {Encoding::PLAIN, Encoding::DELTA_BINARY_PACKED,
+          Encoding::DELTA_LENGTH_BYTE_ARRAY, Encoding::DELTA_BYTE_ARRAY,
+          Encoding::BYTE_STREAM_SPLIT}) {
+      if (encoding != current_encoder_->encoding() &&
+          IsValueEncodingSupported(DType::type_num, encoding)) {
+        candidate_encoders_.push_back(MakeEncoder(DType::type_num, encoding, false,
+                                                  descr_, properties_->memory_pool()));
+      }
+    }
+  }
+
+  // Keep the encoder giving the smallest compressed first page, counting the
+  // dictionary page for dictionary encoding, and return the page's values
+  std::shared_ptr<Buffer> ChooseEncoding() {
+    std::shared_ptr<Buffer> best_values = current_encoder_->FlushValues();
+    int64_t best_size = CompressedSize(*best_values);
+    if (IsDictionaryEncoding(current_encoder_->encoding())) {
+      auto dict_encoder = dynamic_cast<DictEncoder<DType>*>(current_encoder_.get());
+      std::shared_ptr<ResizableBuffer> dictionary =
+          AllocateBuffer(properties_->memory_pool(), dict_encoder->dict_encoded_size());
+      dict_encoder->WriteDict(dictionary->mutable_data());
+      best_size += CompressedSize(*dictionary);
+    }
+    for (auto& encoder : candidate_encoders_) {
+      std::shared_ptr<Buffer> values = encoder->FlushValues();
+      const int64_t size = CompressedSize(*values);
+      if (size < best_size) {
+        best_size = size;
+        best_values = std::move(values);
+        current_encoder_ = std::move(encoder);
+      }
+    }
+    candidate_encoders_.clear();
+    if (!IsDictionaryEncoding(current_encoder_->encoding())) {
+      has_dictionary_ = false;
+      encoding_ = current_encoder_->encoding();
+    }
+    return best_values;
+  }
+
   void CommitWriteAndCheckPageLimit(int64_t num_levels, int64_t num_values) {
     num_buffered_values_ += num_levels;
     num_buffered_encoded_values_ += num_values;
@@ -1195,10 +1340,10 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       // Serialize the buffered Dictionary Indices
       FlushBufferedDataPages();
       fallback_ = true;
-      // Only PLAIN encoding is supported for fallback in V1
-      current_encoder_ = MakeEncoder(DType::type_num, Encoding::PLAIN, false, descr_,
+      encoding_ =
+          FallbackEncoding(DType::type_num, properties_->encoding(descr_->path()));
+      current_encoder_ = MakeEncoder(DType::type_num, encoding_, false, descr_,
                                      properties_->memory_pool());
-      encoding_ = Encoding::PLAIN;
     }
   }
 
@@ -1209,9 +1354,10 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
   // Only one Dictionary Page is written.
   // Fallback to PLAIN if dictionary page limit is reached.
   void CheckDictionarySizeLimit() {
-    if (!has_dictionary_ || fallback_) {
+    if (!has_dictionary_ || fallback_ || !candidate_encoders_.empty()) {
       // Either not using dictionary encoding, or we have already fallen back
-      // to PLAIN encoding because the size threshold was reached
+      // to PLAIN encoding because the size threshold was reached, or the
+      // encoding is yet to be chosen
       return;
     }
 
@@ -1226,26 +1372,50 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
   void WriteValues(const T* values, int64_t num_values, int64_t num_nulls) {
     dynamic_cast<ValueEncoderType*>(current_encoder_.get())
         ->Put(values, static_cast<int>(num_values));
+    for (const auto& encoder : candidate_encoders_) {
+      dynamic_cast<ValueEncoderType*>(encoder.get())
+          ->Put(values, static_cast<int>(num_values));
+    }
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(values, num_values, num_nulls);
     }
+    if (bloom_filter_ != nullptr) {
+      for (int64_t i = 0; i < num_values; ++i) {
+        bloom_filter_->InsertHash(BloomFilterHash(*bloom_filter_, descr_, values[i]));
+      }
+    }
   }
 
   void WriteValuesSpaced(const T* values, int64_t num_values, int64_t num_spaced_values,
                          const uint8_t* valid_bits, int64_t valid_bits_offset) {
-    if (descr_->schema_node()->is_optional()) {
-      dynamic_cast<ValueEncoderType*>(current_encoder_.get())
-          ->PutSpaced(values, static_cast<int>(num_spaced_values), valid_bits,
-                      valid_bits_offset);
-    } else {
-      dynamic_cast<ValueEncoderType*>(current_encoder_.get())
-          ->Put(values, static_cast<int>(num_values));
+    auto put = [&](Encoder* encoder) {
+      if (descr_->schema_node()->is_optional()) {
+        dynamic_cast<ValueEncoderType*>(encoder)->PutSpaced(
+            values, static_cast<int>(num_spaced_values), valid_bits, valid_bits_offset);
+      } else {
+        dynamic_cast<ValueEncoderType*>(encoder)->Put(values,
+                                                      static_cast<int>(num_values));
+      }
+    };
+    put(current_encoder_.get());
+    for (const auto& encoder : candidate_encoders_) {
+      put(encoder.get());
     }
     if (page_statistics_ != nullptr) {
       const int64_t num_nulls = num_spaced_values - num_values;
       page_statistics_->UpdateSpaced(values, valid_bits, valid_bits_offset, num_values,
                                      num_nulls);
     }
+    if (bloom_filter_ != nullptr) {
+      ::arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                        num_spaced_values);
+      for (int64_t i = 0; i < num_spaced_values; ++i) {
+        if (valid_bits_reader.IsSet()) {
+          bloom_filter_->InsertHash(BloomFilterHash(*bloom_filter_, descr_, values[i]));
+        }
+        valid_bits_reader.Next();
+      }
+    }
   }
 };
 
@@ -1278,13 +1448,16 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(const int16_t* def_lev
   };
 
   if (!IsDictionaryEncoding(current_encoder_->encoding()) ||
-      !DictionaryDirectWriteSupported(array)) {
+      !DictionaryDirectWriteSupported(array) || bloom_filter_ != nullptr ||
+      !candidate_encoders_.empty()) {
     // No longer dictionary-encoding for whatever reason, maybe we never were
     // or we decided to stop. Note that WriteArrow can be invoked multiple
     // times with both dense and dictionary-encoded versions of the same data
     // without a problem. Any dense data will be hashed to indices until the
     // dictionary page limit is reached, at which everything (dictionary and
-    // dense) will fall back to plain encoding
+    // dense) will fall back to plain encoding. The values written to a Bloom
+    // filter, or compared across encodings while the encoding is chosen, are
+    // taken from the dense path.
     return WriteDense();
   }
 
@@ -1726,9 +1899,21 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(const int16_t* def_
     std::shared_ptr<::arrow::Array> data_slice =
         array.Slice(value_offset, batch_num_spaced_values);
     current_encoder_->Put(*data_slice);
+    for (const auto& encoder : candidate_encoders_) {
+      encoder->Put(*data_slice);
+    }
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(*data_slice);
     }
+    if (bloom_filter_ != nullptr) {
+      const auto& binary_slice = checked_cast<const ::arrow::BinaryArray&>(*data_slice);
+      for (int64_t i = 0; i < binary_slice.length(); ++i) {
+        if (binary_slice.IsValid(i)) {
+          const ByteArray value(binary_slice.GetView(i));
+          bloom_filter_->InsertHash(bloom_filter_->Hash(&value));
+        }
+      }
+    }
     CommitWriteAndCheckPageLimit(batch_size, batch_num_values);
     CheckDictionarySizeLimit();
     value_offset += batch_num_spaced_values;
@@ -1842,7 +2027,8 @@ Status TypedColumnWriterImpl<FLBAType>::WriteArrowDense(const int16_t* def_level
 
 std::shared_ptr<ColumnWriter> ColumnWriter::Make(ColumnChunkMetaDataBuilder* metadata,
                                                  std::unique_ptr<PageWriter> pager,
-                                                 const WriterProperties* properties) {
+                                                 const WriterProperties* properties,
+                                                 BloomFilter* bloom_filter) {
   const ColumnDescriptor* descr = metadata->descr();
   const bool use_dictionary = properties->dictionary_enabled(descr->path()) &&
                               descr->physical_type() != Type::BOOLEAN;
@@ -1853,28 +2039,28 @@ std::shared_ptr<ColumnWriter> ColumnWriter::Make(ColumnChunkMetaDataBuilder* met
   switch (descr->physical_type()) {
     case Type::BOOLEAN:
       return std::make_shared<TypedColumnWriterImpl<BooleanType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties, bloom_filter);
     case Type::INT32:
       return std::make_shared<TypedColumnWriterImpl<Int32Type>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties, bloom_filter);
     case Type::INT64:
       return std::make_shared<TypedColumnWriterImpl<Int64Type>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties, bloom_filter);
     case Type::INT96:
       return std::make_shared<TypedColumnWriterImpl<Int96Type>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties, bloom_filter);
     case Type::FLOAT:
       return std::make_shared<TypedColumnWriterImpl<FloatType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties, bloom_filter);
     case Type::DOUBLE:
       return std::make_shared<TypedColumnWriterImpl<DoubleType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties, bloom_filter);
     case Type::BYTE_ARRAY:
       return std::make_shared<TypedColumnWriterImpl<ByteArrayType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties, bloom_filter);
     case Type::FIXED_LEN_BYTE_ARRAY:
       return std::make_shared<TypedColumnWriterImpl<FLBAType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties, bloom_filter);
     default:
       ParquetException::NYI("type reader not implemented");
   }
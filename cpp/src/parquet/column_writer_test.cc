@@ -15,6 +15,8 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <numeric>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -92,7 +94,6 @@ class TestPrimitiveWriter : public PrimitiveTypedTest<TestType> {
       int64_t output_size = SMALL_SIZE,
       const ColumnProperties& column_properties = ColumnProperties(),
       const ParquetVersion::type version = ParquetVersion::PARQUET_1_0) {
-    sink_ = CreateOutputStream();
     WriterProperties::Builder wp_builder;
     wp_builder.version(version);
     if (column_properties.encoding() == Encoding::PLAIN_DICTIONARY ||
@@ -104,12 +105,17 @@ class TestPrimitiveWriter : public PrimitiveTypedTest<TestType> {
       wp_builder.encoding(column_properties.encoding());
     }
     wp_builder.max_statistics_size(column_properties.max_statistics_size());
-    writer_properties_ = wp_builder.build();
+    return BuildWriterWithProperties(wp_builder.build(), column_properties.compression());
+  }
 
+  std::shared_ptr<TypedColumnWriter<TestType>> BuildWriterWithProperties(
+      std::shared_ptr<WriterProperties> properties,
+      Compression::type compression = Compression::UNCOMPRESSED) {
+    sink_ = CreateOutputStream();
+    writer_properties_ = std::move(properties);
     metadata_ = ColumnChunkMetaDataBuilder::Make(writer_properties_, this->descr_);
-    std::unique_ptr<PageWriter> pager =
-        PageWriter::Open(sink_, column_properties.compression(),
-                         Codec::UseDefaultCompressionLevel(), metadata_.get());
+    std::unique_ptr<PageWriter> pager = PageWriter::Open(
+        sink_, compression, Codec::UseDefaultCompressionLevel(), metadata_.get());
     std::shared_ptr<ColumnWriter> writer =
         ColumnWriter::Make(metadata_.get(), std::move(pager), writer_properties_.get());
     return std::static_pointer_cast<TypedColumnWriter<TestType>>(writer);
@@ -144,6 +150,26 @@ class TestPrimitiveWriter : public PrimitiveTypedTest<TestType> {
     ASSERT_NO_FATAL_FAILURE(this->ReadAndCompare(compression, num_rows));
   }
 
+  // Write the values with adaptive encoding, check that they read back and
+  // return the encodings of the chunk
+  std::vector<Encoding::type> WriteAdaptive(Compression::type compression) {
+    auto writer = this->BuildWriterWithProperties(WriterProperties::Builder()
+                                                      .enable_dictionary()
+                                                      ->enable_adaptive_encoding()
+                                                      ->compression(compression)
+                                                      ->build(),
+                                                  compression);
+    writer->WriteBatch(this->values_.size(), nullptr, nullptr, this->values_ptr_);
+    writer->Close();
+
+    const auto num_values = static_cast<int64_t>(this->values_.size());
+    this->SetupValuesOut(num_values);
+    this->ReadColumnFully(compression);
+    EXPECT_EQ(num_values, this->values_read_);
+    EXPECT_EQ(this->values_, this->values_out_);
+    return this->metadata_encodings();
+  }
+
   void TestDictionaryFallbackEncoding(ParquetVersion::type version) {
     this->GenerateData(VERY_LARGE_SIZE);
     ColumnProperties column_properties;
@@ -434,6 +460,69 @@ TYPED_TEST(TestPrimitiveWriter, RequiredRLEDictionary) {
 }
 */
 
+using TestInt32ValuesWriter = TestPrimitiveWriter<Int32Type>;
+using TestInt64ValuesWriter = TestPrimitiveWriter<Int64Type>;
+
+TEST_F(TestInt32ValuesWriter, RequiredDeltaBinaryPacked) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_BINARY_PACKED);
+}
+
+TEST_F(TestInt64ValuesWriter, RequiredDeltaBinaryPacked) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_BINARY_PACKED);
+}
+
+TEST_F(TestInt32ValuesWriter, DictionaryFallbackToDeltaBinaryPacked) {
+  this->GenerateData(VERY_LARGE_SIZE);
+  auto writer = this->BuildWriterWithProperties(
+      WriterProperties::Builder()
+          .version(ParquetVersion::PARQUET_2_0)
+          ->enable_dictionary()
+          ->dictionary_pagesize_limit(DICTIONARY_PAGE_SIZE)
+          ->encoding(Encoding::DELTA_BINARY_PACKED)
+          ->build());
+  writer->WriteBatch(this->values_.size(), nullptr, nullptr, this->values_ptr_);
+  writer->Close();
+
+  this->SetupValuesOut(VERY_LARGE_SIZE);
+  this->ReadColumnFully();
+  ASSERT_EQ(VERY_LARGE_SIZE, this->values_read_);
+  ASSERT_EQ(this->values_, this->values_out_);
+  std::vector<Encoding::type> expected({Encoding::RLE_DICTIONARY, Encoding::PLAIN,
+                                        Encoding::RLE, Encoding::DELTA_BINARY_PACKED});
+  ASSERT_EQ(expected, this->metadata_encodings());
+}
+
+TEST_F(TestInt32ValuesWriter, AdaptiveEncodingSortedValues) {
+  this->values_.resize(LARGE_SIZE);
+  std::iota(this->values_.begin(), this->values_.end(), 1000);
+  this->values_ptr_ = this->values_.data();
+  std::vector<Encoding::type> expected({Encoding::DELTA_BINARY_PACKED, Encoding::RLE});
+  ASSERT_EQ(expected, this->WriteAdaptive(Compression::UNCOMPRESSED));
+}
+
+TEST_F(TestInt32ValuesWriter, AdaptiveEncodingRepeatedValues) {
+  this->values_.resize(LARGE_SIZE);
+  for (int i = 0; i < LARGE_SIZE; ++i) {
+    this->values_[i] = (i * 7919) % 13;
+  }
+  this->values_ptr_ = this->values_.data();
+  std::vector<Encoding::type> expected(
+      {Encoding::PLAIN_DICTIONARY, Encoding::PLAIN, Encoding::RLE});
+  ASSERT_EQ(expected, this->WriteAdaptive(Compression::UNCOMPRESSED));
+}
+
+TYPED_TEST(TestPrimitiveWriter, AdaptiveEncoding) {
+  this->GenerateData(LARGE_SIZE);
+  ASSERT_NO_FATAL_FAILURE(this->WriteAdaptive(Compression::UNCOMPRESSED));
+}
+
+#ifdef ARROW_WITH_SNAPPY
+TYPED_TEST(TestPrimitiveWriter, AdaptiveEncodingSnappy) {
+  this->GenerateData(LARGE_SIZE);
+  ASSERT_NO_FATAL_FAILURE(this->WriteAdaptive(Compression::SNAPPY));
+}
+#endif
+
 TYPED_TEST(TestPrimitiveWriter, RequiredPlainWithStats) {
   this->TestRequiredWithSettings(Encoding::PLAIN, Compression::UNCOMPRESSED, false, true,
                                  LARGE_SIZE);
@@ -657,6 +746,27 @@ TEST_F(TestBooleanValuesWriter, AlternateBooleanValues) {
 // PARQUET-979
 // Prevent writing large MIN, MAX stats
 using TestByteArrayValuesWriter = TestPrimitiveWriter<ByteArrayType>;
+TEST_F(TestByteArrayValuesWriter, RequiredDeltaLengthByteArray) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+}
+
+TEST_F(TestByteArrayValuesWriter, RequiredDeltaByteArray) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_BYTE_ARRAY);
+}
+
+TEST_F(TestByteArrayValuesWriter, AdaptiveEncodingSharedPrefixes) {
+  // Distinct values sharing long prefixes
+  std::vector<std::string> strings(SMALL_SIZE);
+  this->values_.resize(SMALL_SIZE);
+  for (int i = 0; i < SMALL_SIZE; ++i) {
+    strings[i] = "a_long_common_prefix_for_all_the_values_" + std::to_string(i);
+    this->values_[i] = ByteArray(strings[i]);
+  }
+  this->values_ptr_ = this->values_.data();
+  std::vector<Encoding::type> expected({Encoding::DELTA_BYTE_ARRAY, Encoding::RLE});
+  ASSERT_EQ(expected, this->WriteAdaptive(Compression::UNCOMPRESSED));
+}
+
 TEST_F(TestByteArrayValuesWriter, OmitStats) {
   int min_len = 1024 * 4;
   int max_len = 1024 * 8;
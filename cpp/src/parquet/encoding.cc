@@ -20,8 +20,10 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -35,6 +37,7 @@
 #include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
+#include "arrow/util/simd.h"
 #include "arrow/util/ubsan.h"
 #include "arrow/visitor_inline.h"
 
@@ -419,17 +422,22 @@ void PlainEncoder<BooleanType>::Put(const std::vector<bool>& src, int num_values
 template <typename DType>
 struct DictEncoderTraits {
   using c_type = typename DType::c_type;
-  using MemoTableType = arrow::internal::ScalarMemoTable<c_type>;
+  using MemoTableType =
+      arrow::internal::ScalarMemoTable<c_type, arrow::internal::SwissHashTable>;
 };
 
 template <>
 struct DictEncoderTraits<ByteArrayType> {
-  using MemoTableType = arrow::internal::BinaryMemoTable<arrow::BinaryBuilder>;
+  using MemoTableType =
+      arrow::internal::BinaryMemoTable<arrow::BinaryBuilder,
+                                       arrow::internal::SwissHashTable>;
 };
 
 template <>
 struct DictEncoderTraits<FLBAType> {
-  using MemoTableType = arrow::internal::BinaryMemoTable<arrow::BinaryBuilder>;
+  using MemoTableType =
+      arrow::internal::BinaryMemoTable<arrow::BinaryBuilder,
+                                       arrow::internal::SwissHashTable>;
 };
 
 // Initially 1024 elements
@@ -965,15 +973,22 @@ int PlainDecoder<DType>::DecodeArrow(
     ParquetException::EofException();
   }
 
-  PARQUET_THROW_NOT_OK(builder->Reserve(num_values));
+  if (null_count == 0) {
+    // The values are contiguous, append them at once
+    PARQUET_THROW_NOT_OK(
+        builder->AppendValues(reinterpret_cast<const value_type*>(data_), num_values));
+    data_ += sizeof(value_type) * num_values;
+  } else {
+    PARQUET_THROW_NOT_OK(builder->Reserve(num_values));
 
-  VisitNullBitmapInline(
-      valid_bits, valid_bits_offset, num_values, null_count,
-      [&]() {
-        builder->UnsafeAppend(arrow::util::SafeLoadAs<value_type>(data_));
-        data_ += sizeof(value_type);
-      },
-      [&]() { builder->UnsafeAppendNull(); });
+    VisitNullBitmapInline(
+        valid_bits, valid_bits_offset, num_values, null_count,
+        [&]() {
+          builder->UnsafeAppend(arrow::util::SafeLoadAs<value_type>(data_));
+          data_ += sizeof(value_type);
+        },
+        [&]() { builder->UnsafeAppendNull(); });
+  }
 
   num_values_ -= values_decoded;
   len_ -= sizeof(value_type) * values_decoded;
@@ -1503,9 +1518,7 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
       bit_reader.Next();
     }
 
-    auto binary_builder = checked_cast<arrow::BinaryDictionary32Builder*>(builder);
-    PARQUET_THROW_NOT_OK(
-        binary_builder->AppendIndices(indices_buffer, num_values, valid_bytes.data()));
+    AppendIndices(indices_buffer, num_values, valid_bytes.data(), builder);
     num_values_ -= num_values - null_count;
     return num_values - null_count;
   }
@@ -1524,13 +1537,25 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
     if (num_values != idx_decoder_.GetBatch(indices_buffer, num_values)) {
       ParquetException::EofException();
     }
-    auto binary_builder = checked_cast<arrow::BinaryDictionary32Builder*>(builder);
-    PARQUET_THROW_NOT_OK(binary_builder->AppendIndices(indices_buffer, num_values));
+    AppendIndices(indices_buffer, num_values, /*valid_bytes=*/nullptr, builder);
     num_values_ -= num_values;
     return num_values;
   }
 
+  std::shared_ptr<arrow::Array> GetDictionary() override;
+
  protected:
+  static void AppendIndices(const int32_t* indices, int64_t length,
+                            const uint8_t* valid_bytes, arrow::ArrayBuilder* builder) {
+    if (builder->type()->id() == arrow::Type::INT32) {
+      auto int32_builder = checked_cast<arrow::Int32Builder*>(builder);
+      PARQUET_THROW_NOT_OK(int32_builder->AppendValues(indices, length, valid_bytes));
+    } else {
+      auto binary_builder = checked_cast<arrow::BinaryDictionary32Builder*>(builder);
+      PARQUET_THROW_NOT_OK(binary_builder->AppendIndices(indices, length, valid_bytes));
+    }
+  }
+
   Status IndexInBounds(int32_t index) {
     if (ARROW_PREDICT_TRUE(0 <= index && index < dictionary_length_)) {
       return Status::OK();
@@ -1785,6 +1810,17 @@ void DictDecoderImpl<ByteArrayType>::InsertDictionary(arrow::ArrayBuilder* build
   PARQUET_THROW_NOT_OK(binary_builder->InsertMemoValues(*arr));
 }
 
+template <typename Type>
+std::shared_ptr<arrow::Array> DictDecoderImpl<Type>::GetDictionary() {
+  ParquetException::NYI("GetDictionary only implemented for BYTE_ARRAY types");
+}
+
+template <>
+std::shared_ptr<arrow::Array> DictDecoderImpl<ByteArrayType>::GetDictionary() {
+  return std::make_shared<arrow::BinaryArray>(dictionary_length_, byte_array_offsets_,
+                                              byte_array_data_);
+}
+
 class DictByteArrayDecoderImpl : public DictDecoderImpl<ByteArrayType>,
                                  virtual public ByteArrayDecoder {
  public:
@@ -1994,12 +2030,250 @@ class DictByteArrayDecoderImpl : public DictDecoderImpl<ByteArrayType>,
 };
 
 // ----------------------------------------------------------------------
-// DeltaBitPackDecoder
+// DELTA_BINARY_PACKED
+//
+// Layout, see the Parquet format specification:
+//   <header> <block 1> <block 2> ...
+//   header: <block size> <miniblocks per block> <total value count> <first value>,
+//     as ULEB128 varints (zigzag encoded for the first value)
+//   block: <min delta> <bit width of each miniblock, one byte each> <miniblocks>
+//     where each miniblock bit packs the deltas between consecutive values, minus
+//     the block's min delta (zigzag ULEB128), at the miniblock's bit width
+//
+// The last miniblock written is padded to its full size, while miniblocks
+// after it in the last block are omitted.
+
+template <typename DType>
+class DeltaBitPackEncoder : public EncoderImpl, virtual public TypedEncoder<DType> {
+ public:
+  using T = typename DType::c_type;
+  using UT = typename std::make_unsigned<T>::type;
+
+  static constexpr uint32_t kValuesPerBlock = 128;
+  static constexpr uint32_t kMiniBlocksPerBlock = 4;
+  static constexpr uint32_t kValuesPerMiniBlock = kValuesPerBlock / kMiniBlocksPerBlock;
+
+  explicit DeltaBitPackEncoder(const ColumnDescriptor* descr, MemoryPool* pool)
+      : EncoderImpl(descr, Encoding::DELTA_BINARY_PACKED, pool), sink_(pool) {
+    if (DType::type_num != Type::INT32 && DType::type_num != Type::INT64) {
+      throw ParquetException("Delta bit pack encoding should only be for integer data.");
+    }
+  }
+
+  int64_t EstimatedDataEncodedSize() override {
+    return kMaxHeaderSize + sink_.length() + kMaxBlockHeaderSize +
+           num_deltas_ * static_cast<int64_t>(sizeof(T));
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override;
+
+  using TypedEncoder<DType>::Put;
+
+  void Put(const T* src, int num_values) override;
+
+  void Put(const arrow::Array& values) override;
+
+  void PutSpaced(const T* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    PARQUET_ASSIGN_OR_THROW(
+        auto buffer, arrow::AllocateBuffer(num_values * sizeof(T), this->memory_pool()));
+    T* data = reinterpret_cast<T*>(buffer->mutable_data());
+    int num_valid_values = arrow::util::internal::SpacedCompress<T>(
+        src, num_values, valid_bits, valid_bits_offset, data);
+    Put(data, num_valid_values);
+  }
+
+ private:
+  // Three uint32 varints and an int64 varint
+  static constexpr int kMaxHeaderSize =
+      3 * arrow::BitUtil::BitReader::kMaxVlqByteLength +
+      arrow::BitUtil::BitReader::kMaxVlqByteLengthForInt64;
+  static constexpr int kMaxBlockHeaderSize =
+      arrow::BitUtil::BitReader::kMaxVlqByteLengthForInt64 + kMiniBlocksPerBlock;
+
+  /// Bit pack the buffered deltas as one block
+  void FlushBlock();
+
+  uint32_t total_value_count_ = 0;
+  T first_value_ = 0;
+  T current_value_ = 0;
+  // The deltas of the current block, wrapped around in the unsigned domain
+  UT deltas_[kValuesPerBlock];
+  uint32_t num_deltas_ = 0;
+  arrow::BufferBuilder sink_;
+};
+
+template <typename DType>
+constexpr uint32_t DeltaBitPackEncoder<DType>::kValuesPerBlock;
+template <typename DType>
+constexpr uint32_t DeltaBitPackEncoder<DType>::kMiniBlocksPerBlock;
+template <typename DType>
+constexpr uint32_t DeltaBitPackEncoder<DType>::kValuesPerMiniBlock;
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const T* src, int num_values) {
+  if (num_values == 0) {
+    return;
+  }
+  int i = 0;
+  if (total_value_count_ == 0) {
+    first_value_ = current_value_ = src[0];
+    i = 1;
+  }
+  total_value_count_ += num_values;
+  for (; i < num_values; ++i) {
+    deltas_[num_deltas_++] = static_cast<UT>(src[i]) - static_cast<UT>(current_value_);
+    current_value_ = src[i];
+    if (num_deltas_ == kValuesPerBlock) {
+      FlushBlock();
+    }
+  }
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const arrow::Array& values) {
+  using ArrayType = arrow::NumericArray<typename EncodingTraits<DType>::ArrowType>;
+  if (values.type_id() != ArrayType::TypeClass::type_id) {
+    std::string type_name = ArrayType::TypeClass::type_name();
+    throw ParquetException("direct put to " + type_name + " from " +
+                           values.type()->ToString() + " not supported");
+  }
+  const auto& data = checked_cast<const ArrayType&>(values);
+  if (data.null_count() == 0) {
+    Put(data.raw_values(), static_cast<int>(data.length()));
+  } else {
+    PutSpaced(data.raw_values(), static_cast<int>(data.length()), data.null_bitmap_data(),
+              data.offset());
+  }
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::FlushBlock() {
+  // The deltas are stored relative to the smallest one, as a signed value
+  T min_delta = static_cast<T>(deltas_[0]);
+  for (uint32_t i = 1; i < num_deltas_; ++i) {
+    min_delta = std::min(min_delta, static_cast<T>(deltas_[i]));
+  }
+  const auto umin_delta = static_cast<UT>(min_delta);
+  const uint32_t num_mini_blocks =
+      static_cast<uint32_t>(BitUtil::CeilDiv(num_deltas_, kValuesPerMiniBlock));
+  // Pad the last miniblock with deltas packing to zero
+  std::fill(deltas_ + num_deltas_, deltas_ + num_mini_blocks * kValuesPerMiniBlock,
+            umin_delta);
+
+  uint8_t bit_widths[kMiniBlocksPerBlock] = {};
+  int64_t packed_size = 0;
+  for (uint32_t m = 0; m < num_mini_blocks; ++m) {
+    UT max_delta = 0;
+    for (uint32_t i = m * kValuesPerMiniBlock; i < (m + 1) * kValuesPerMiniBlock; ++i) {
+      max_delta = std::max<UT>(max_delta, deltas_[i] - umin_delta);
+    }
+    bit_widths[m] = static_cast<uint8_t>(BitUtil::NumRequiredBits(max_delta));
+    packed_size += kValuesPerMiniBlock * bit_widths[m] / 8;
+  }
+
+  const int64_t max_size = kMaxBlockHeaderSize + packed_size;
+  PARQUET_THROW_NOT_OK(sink_.Reserve(max_size));
+  arrow::BitUtil::BitWriter writer(sink_.mutable_data() + sink_.length(),
+                                   static_cast<int>(max_size));
+  writer.PutZigZagVlqInt(static_cast<int64_t>(min_delta));
+  for (uint32_t m = 0; m < kMiniBlocksPerBlock; ++m) {
+    writer.PutAligned<uint8_t>(bit_widths[m], 1);
+  }
+  for (uint32_t m = 0; m < num_mini_blocks; ++m) {
+    const int bit_width = bit_widths[m];
+    for (uint32_t i = m * kValuesPerMiniBlock; i < (m + 1) * kValuesPerMiniBlock; ++i) {
+      const uint64_t delta = static_cast<UT>(deltas_[i] - umin_delta);
+      // BitWriter packs at most 32 bits at a time
+      if (bit_width <= 32) {
+        writer.PutValue(delta, bit_width);
+      } else {
+        writer.PutValue(delta & 0xFFFFFFFFU, 32);
+        writer.PutValue(delta >> 32, bit_width - 32);
+      }
+    }
+  }
+  writer.Flush();
+  sink_.UnsafeAdvance(writer.bytes_written());
+  num_deltas_ = 0;
+}
+
+template <typename DType>
+std::shared_ptr<Buffer> DeltaBitPackEncoder<DType>::FlushValues() {
+  if (num_deltas_ > 0) {
+    FlushBlock();
+  }
+  uint8_t header[kMaxHeaderSize];
+  arrow::BitUtil::BitWriter header_writer(header, kMaxHeaderSize);
+  if (!header_writer.PutVlqInt(kValuesPerBlock) ||
+      !header_writer.PutVlqInt(kMiniBlocksPerBlock) ||
+      !header_writer.PutVlqInt(total_value_count_) ||
+      !header_writer.PutZigZagVlqInt(static_cast<int64_t>(first_value_))) {
+    throw ParquetException("Failed to write the delta bit pack header");
+  }
+  header_writer.Flush();
+
+  std::shared_ptr<Buffer> blocks;
+  PARQUET_THROW_NOT_OK(sink_.Finish(&blocks));
+  const int64_t header_size = header_writer.bytes_written();
+  PARQUET_ASSIGN_OR_THROW(auto buffer,
+                          arrow::AllocateBuffer(header_size + blocks->size(), pool_));
+  std::memcpy(buffer->mutable_data(), header, header_size);
+  if (blocks->size() > 0) {
+    std::memcpy(buffer->mutable_data() + header_size, blocks->data(), blocks->size());
+  }
+
+  total_value_count_ = 0;
+  first_value_ = current_value_ = 0;
+  return std::move(buffer);
+}
+
+// Turn deltas relative to min_delta into the values following last_value, in
+// place, and return the last value.  Sums wrap around in the unsigned domain,
+// like the encoder's deltas.
+template <typename UT>
+UT PrefixSumDeltas(UT* values, int num_values, UT min_delta, UT last_value) {
+  // Keep the running value in a register rather than in the decoder, whose
+  // members may alias the output
+  for (int i = 0; i < num_values; ++i) {
+    last_value += min_delta + values[i];
+    values[i] = last_value;
+  }
+  return last_value;
+}
+
+#if defined(ARROW_HAVE_SSE4_2)
+template <>
+uint32_t PrefixSumDeltas(uint32_t* values, int num_values, uint32_t min_delta,
+                         uint32_t last_value) {
+  // Four values at a time: add each lane to the following ones with two
+  // shifted additions, then add the carry from the previous group
+  const __m128i min_deltas = _mm_set1_epi32(static_cast<int>(min_delta));
+  __m128i carry = _mm_set1_epi32(static_cast<int>(last_value));
+  int i = 0;
+  for (; i + 4 <= num_values; i += 4) {
+    auto p = reinterpret_cast<__m128i*>(values + i);
+    __m128i x = _mm_add_epi32(_mm_loadu_si128(p), min_deltas);
+    x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+    x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+    x = _mm_add_epi32(x, carry);
+    _mm_storeu_si128(p, x);
+    carry = _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+  }
+  last_value = static_cast<uint32_t>(_mm_cvtsi128_si32(carry));
+  for (; i < num_values; ++i) {
+    last_value += min_delta + values[i];
+    values[i] = last_value;
+  }
+  return last_value;
+}
+#endif
 
 template <typename DType>
 class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DType> {
  public:
   typedef typename DType::c_type T;
+  using UT = typename std::make_unsigned<T>::type;
 
   explicit DeltaBitPackDecoder(const ColumnDescriptor* descr,
                                MemoryPool* pool = arrow::default_memory_pool())
@@ -2011,9 +2285,9 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
 
   void SetData(int num_values, const uint8_t* data, int len) override {
     this->num_values_ = num_values;
+    this->len_ = len;
     decoder_ = arrow::BitUtil::BitReader(data, len);
-    values_current_block_ = 0;
-    values_current_mini_block_ = 0;
+    InitHeader();
   }
 
   int Decode(T* buffer, int max_values) override {
@@ -2023,102 +2297,292 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::Accumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
+    std::vector<T> values(num_values - null_count);
+    const int values_decoded = GetInternal(values.data(), num_values - null_count);
+    if (ARROW_PREDICT_FALSE(values_decoded != num_values - null_count)) {
+      ParquetException::EofException();
     }
-    std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
-    PARQUET_THROW_NOT_OK(out->AppendValues(values));
-    return num_values;
+    PARQUET_THROW_NOT_OK(out->Reserve(num_values));
+    int i = 0;
+    VisitNullBitmapInline(
+        valid_bits, valid_bits_offset, num_values, null_count,
+        [&]() { out->UnsafeAppend(values[i++]); }, [&]() { out->UnsafeAppendNull(); });
+    return values_decoded;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::DictAccumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
+    std::vector<T> values(num_values - null_count);
+    const int values_decoded = GetInternal(values.data(), num_values - null_count);
+    if (ARROW_PREDICT_FALSE(values_decoded != num_values - null_count)) {
+      ParquetException::EofException();
     }
-    std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
     PARQUET_THROW_NOT_OK(out->Reserve(num_values));
-    for (T value : values) {
-      PARQUET_THROW_NOT_OK(out->Append(value));
-    }
-    return num_values;
+    int i = 0;
+    VisitNullBitmapInline(
+        valid_bits, valid_bits_offset, num_values, null_count,
+        [&]() { PARQUET_THROW_NOT_OK(out->Append(values[i++])); },
+        [&]() { PARQUET_THROW_NOT_OK(out->AppendNull()); });
+    return values_decoded;
   }
 
+  /// The number of values encoded in the data, from its header
+  int total_value_count() const { return static_cast<int>(total_value_count_); }
+
+  /// The number of bytes read from the data; once all the values are decoded,
+  /// the size of the encoded values
+  int bytes_consumed() { return this->len_ - decoder_.bytes_left(); }
+
  private:
-  void InitBlock() {
-    // The number of values per block.
-    uint32_t block_size;
-    if (!decoder_.GetVlqInt(&block_size)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&num_mini_blocks_)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&values_current_block_)) {
+  void InitHeader() {
+    uint32_t values_per_block;
+    int64_t first_value;
+    if (!decoder_.GetVlqInt(&values_per_block) ||
+        !decoder_.GetVlqInt(&mini_blocks_per_block_) ||
+        !decoder_.GetVlqInt(&total_value_count_) ||
+        !decoder_.GetZigZagVlqInt(&first_value)) {
       ParquetException::EofException();
     }
-    if (!decoder_.GetZigZagVlqInt(&last_value_)) ParquetException::EofException();
+    if (values_per_block == 0 || values_per_block % 128 != 0) {
+      throw ParquetException("Invalid delta bit pack block size: " +
+                             std::to_string(values_per_block));
+    }
+    if (mini_blocks_per_block_ == 0 ||
+        (values_per_block / mini_blocks_per_block_) % 32 != 0) {
+      throw ParquetException("Invalid number of delta bit pack miniblocks: " +
+                             std::to_string(mini_blocks_per_block_));
+    }
+    values_per_mini_block_ = values_per_block / mini_blocks_per_block_;
+    delta_bit_widths_ = AllocateBuffer(pool_, mini_blocks_per_block_);
+
+    last_value_ = static_cast<T>(first_value);
+    total_values_remaining_ = total_value_count_;
+    first_value_pending_ = total_value_count_ > 0;
+    // The first block is read when its first delta is needed
+    mini_block_idx_ = mini_blocks_per_block_;
+    values_current_mini_block_ = 0;
+  }
 
-    delta_bit_widths_ = AllocateBuffer(pool_, num_mini_blocks_);
-    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
+  void InitBlock() {
+    int64_t min_delta;
+    if (!decoder_.GetZigZagVlqInt(&min_delta)) ParquetException::EofException();
+    min_delta_ = static_cast<UT>(min_delta);
 
-    if (!decoder_.GetZigZagVlqInt(&min_delta_)) ParquetException::EofException();
-    for (uint32_t i = 0; i < num_mini_blocks_; ++i) {
+    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
+    for (uint32_t i = 0; i < mini_blocks_per_block_; ++i) {
       if (!decoder_.GetAligned<uint8_t>(1, bit_width_data + i)) {
         ParquetException::EofException();
       }
     }
-    values_per_mini_block_ = block_size / num_mini_blocks_;
     mini_block_idx_ = 0;
-    delta_bit_width_ = bit_width_data[0];
+    InitMiniBlock(bit_width_data[0]);
+  }
+
+  void InitMiniBlock(int bit_width) {
+    if (ARROW_PREDICT_FALSE(bit_width > static_cast<int>(sizeof(T) * 8))) {
+      throw ParquetException("Invalid or corrupted delta bit width: " +
+                             std::to_string(bit_width));
+    }
+    delta_bit_width_ = bit_width;
     values_current_mini_block_ = values_per_mini_block_;
   }
 
-  template <typename T>
+  // Read num_values packed deltas of the current miniblock into buffer
+  void UnpackDeltas(UT* buffer, int num_values) {
+    if (delta_bit_width_ == 0) {
+      // All the deltas are equal to the block's minimum delta
+      std::fill(buffer, buffer + num_values, UT(0));
+      return;
+    }
+    if (decoder_.GetBatch(delta_bit_width_, buffer, num_values) != num_values) {
+      ParquetException::EofException();
+    }
+  }
+
   int GetInternal(T* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
+    max_values = static_cast<int>(
+        std::min<uint32_t>(static_cast<uint32_t>(max_values), total_values_remaining_));
+    if (max_values == 0) {
+      return 0;
+    }
+    int i = 0;
+    if (first_value_pending_) {
+      buffer[i++] = last_value_;
+      first_value_pending_ = false;
+    }
     const uint8_t* bit_width_data = delta_bit_widths_->data();
-    for (int i = 0; i < max_values; ++i) {
+    while (i < max_values) {
       if (ARROW_PREDICT_FALSE(values_current_mini_block_ == 0)) {
         ++mini_block_idx_;
-        if (mini_block_idx_ < static_cast<size_t>(delta_bit_widths_->size())) {
-          delta_bit_width_ = bit_width_data[mini_block_idx_];
-          values_current_mini_block_ = values_per_mini_block_;
+        if (mini_block_idx_ < mini_blocks_per_block_) {
+          InitMiniBlock(bit_width_data[mini_block_idx_]);
         } else {
           InitBlock();
-          buffer[i] = last_value_;
-          continue;
         }
       }
-
-      // TODO: the key to this algorithm is to decode the entire miniblock at once.
-      int64_t delta;
-      if (!decoder_.GetValue(delta_bit_width_, &delta)) ParquetException::EofException();
-      delta += min_delta_;
-      last_value_ += static_cast<int32_t>(delta);
-      buffer[i] = last_value_;
-      --values_current_mini_block_;
+      const int num_deltas = static_cast<int>(
+          std::min<uint32_t>(values_current_mini_block_, max_values - i));
+      UT* deltas = reinterpret_cast<UT*>(buffer + i);
+      UnpackDeltas(deltas, num_deltas);
+      last_value_ = static_cast<T>(
+          PrefixSumDeltas(deltas, num_deltas, min_delta_, static_cast<UT>(last_value_)));
+      values_current_mini_block_ -= num_deltas;
+      i += num_deltas;
     }
+    total_values_remaining_ -= max_values;
     this->num_values_ -= max_values;
+
+    if (total_values_remaining_ == 0) {
+      // Skip the padding of the last miniblock, so that bytes_consumed() covers
+      // all the encoded values
+      int64_t padding_bits =
+          static_cast<int64_t>(values_current_mini_block_) * delta_bit_width_;
+      while (padding_bits > 0) {
+        const int num_bits = static_cast<int>(std::min<int64_t>(padding_bits, 32));
+        uint64_t unused;
+        if (!decoder_.GetValue(num_bits, &unused)) ParquetException::EofException();
+        padding_bits -= num_bits;
+      }
+      values_current_mini_block_ = 0;
+    }
     return max_values;
   }
 
   MemoryPool* pool_;
   arrow::BitUtil::BitReader decoder_;
-  uint32_t values_current_block_;
-  uint32_t num_mini_blocks_;
-  uint64_t values_per_mini_block_;
-  uint64_t values_current_mini_block_;
-
-  int32_t min_delta_;
-  size_t mini_block_idx_;
+  uint32_t mini_blocks_per_block_;
+  uint32_t values_per_mini_block_;
+  uint32_t total_value_count_;
+  uint32_t total_values_remaining_;
+  bool first_value_pending_;
+
+  UT min_delta_;
+  uint32_t mini_block_idx_;
   std::shared_ptr<ResizableBuffer> delta_bit_widths_;
   int delta_bit_width_;
+  uint32_t values_current_mini_block_;
 
-  int32_t last_value_;
+  T last_value_;
 };
 
+// Append the num_values - null_count byte arrays decoded by decoder to an
+// Arrow builder, with nulls at the unset positions of valid_bits
+template <typename Decoder>
+int DecodeByteArraysArrow(Decoder* decoder, int num_values, int null_count,
+                          const uint8_t* valid_bits, int64_t valid_bits_offset,
+                          typename EncodingTraits<ByteArrayType>::Accumulator* out) {
+  std::vector<ByteArray> values(num_values - null_count);
+  const int values_decoded = decoder->Decode(values.data(), num_values - null_count);
+  if (ARROW_PREDICT_FALSE(values_decoded != num_values - null_count)) {
+    ParquetException::EofException();
+  }
+  ArrowBinaryHelper helper(out);
+  PARQUET_THROW_NOT_OK(helper.builder->Reserve(num_values));
+  int i = 0;
+  PARQUET_THROW_NOT_OK(VisitNullBitmapInline(
+      valid_bits, valid_bits_offset, num_values, null_count,
+      [&]() {
+        const ByteArray& value = values[i++];
+        if (ARROW_PREDICT_FALSE(!helper.CanFit(value.len))) {
+          // This element would exceed the capacity of a chunk
+          RETURN_NOT_OK(helper.PushChunk());
+        }
+        return helper.Append(value.ptr, static_cast<int32_t>(value.len));
+      },
+      [&]() { return helper.AppendNull(); }));
+  return values_decoded;
+}
+
+template <typename Decoder>
+int DecodeByteArraysArrow(Decoder* decoder, int num_values, int null_count,
+                          const uint8_t* valid_bits, int64_t valid_bits_offset,
+                          typename EncodingTraits<ByteArrayType>::DictAccumulator* out) {
+  std::vector<ByteArray> values(num_values - null_count);
+  const int values_decoded = decoder->Decode(values.data(), num_values - null_count);
+  if (ARROW_PREDICT_FALSE(values_decoded != num_values - null_count)) {
+    ParquetException::EofException();
+  }
+  PARQUET_THROW_NOT_OK(out->Reserve(num_values));
+  int i = 0;
+  PARQUET_THROW_NOT_OK(VisitNullBitmapInline(
+      valid_bits, valid_bits_offset, num_values, null_count,
+      [&]() {
+        const ByteArray& value = values[i++];
+        return out->Append(value.ptr, static_cast<int32_t>(value.len));
+      },
+      [&]() { return out->AppendNull(); }));
+  return values_decoded;
+}
+
 // ----------------------------------------------------------------------
 // DELTA_LENGTH_BYTE_ARRAY
+//
+// The lengths of the values, DELTA_BINARY_PACKED, followed by the
+// concatenated values
+
+class DeltaLengthByteArrayEncoder : public EncoderImpl,
+                                    virtual public TypedEncoder<ByteArrayType> {
+ public:
+  explicit DeltaLengthByteArrayEncoder(const ColumnDescriptor* descr, MemoryPool* pool)
+      : EncoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY, pool),
+        sink_(pool),
+        length_encoder_(nullptr, pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return length_encoder_.EstimatedDataEncodedSize() + sink_.length();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> lengths = length_encoder_.FlushValues();
+    std::shared_ptr<Buffer> data;
+    PARQUET_THROW_NOT_OK(sink_.Finish(&data));
+    PARQUET_ASSIGN_OR_THROW(auto buffer,
+                            arrow::ConcatenateBuffers({lengths, data}, pool_));
+    return buffer;
+  }
+
+  using TypedEncoder<ByteArrayType>::Put;
+
+  void Put(const ByteArray* src, int num_values) override {
+    for (int i = 0; i < num_values; ++i) {
+      Put(src[i]);
+    }
+  }
+
+  void Put(const arrow::Array& values) override {
+    AssertBinary(values);
+    const auto& data = checked_cast<const arrow::BinaryArray&>(values);
+    PARQUET_THROW_NOT_OK(
+        sink_.Reserve(data.value_offset(data.length()) - data.value_offset(0)));
+    for (int64_t i = 0; i < data.length(); i++) {
+      if (data.IsValid(i)) {
+        Put(ByteArray(data.GetView(i)));
+      }
+    }
+  }
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    PARQUET_ASSIGN_OR_THROW(auto buffer,
+                            arrow::AllocateBuffer(num_values * sizeof(ByteArray),
+                                                  this->memory_pool()));
+    auto data = reinterpret_cast<ByteArray*>(buffer->mutable_data());
+    int num_valid_values = arrow::util::internal::SpacedCompress<ByteArray>(
+        src, num_values, valid_bits, valid_bits_offset, data);
+    Put(data, num_valid_values);
+  }
+
+  void Put(const ByteArray& value) {
+    const auto length = static_cast<int32_t>(value.len);
+    length_encoder_.Put(&length, 1);
+    PARQUET_THROW_NOT_OK(sink_.Append(value.ptr, value.len));
+  }
+
+ private:
+  arrow::BufferBuilder sink_;
+  DeltaBitPackEncoder<Int32Type> length_encoder_;
+};
 
 class DeltaLengthByteArrayDecoder : public DecoderImpl,
                                     virtual public TypedDecoder<ByteArrayType> {
@@ -2127,52 +2591,140 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
                                        MemoryPool* pool = arrow::default_memory_pool())
       : DecoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY),
         len_decoder_(nullptr, pool),
-        pool_(pool) {}
+        lengths_(::arrow::stl::allocator<int32_t>(pool)) {}
 
   void SetData(int num_values, const uint8_t* data, int len) override {
     num_values_ = num_values;
-    if (len == 0) return;
-    int total_lengths_len = arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    this->len_decoder_.SetData(num_values, data, total_lengths_len);
-    data_ = data + total_lengths_len;
-    this->len_ = len - 4 - total_lengths_len;
+    // Decode all the lengths up front, to find where the values start
+    len_decoder_.SetData(num_values, data, len);
+    const int num_lengths = len_decoder_.total_value_count();
+    lengths_.resize(num_lengths);
+    if (len_decoder_.Decode(lengths_.data(), num_lengths) != num_lengths) {
+      ParquetException::EofException();
+    }
+    const int lengths_size = len_decoder_.bytes_consumed();
+    data_ = data + lengths_size;
+    len_ = len - lengths_size;
+    length_idx_ = 0;
   }
 
   int Decode(ByteArray* buffer, int max_values) override {
-    using VectorT = ArrowPoolVector<int>;
-    max_values = std::min(max_values, num_values_);
-    VectorT lengths(max_values, 0, ::arrow::stl::allocator<int>(pool_));
-    len_decoder_.Decode(lengths.data(), max_values);
+    max_values = std::min(max_values, static_cast<int>(lengths_.size()) - length_idx_);
     for (int i = 0; i < max_values; ++i) {
-      buffer[i].len = lengths[i];
+      const int32_t length = lengths_[length_idx_++];
+      if (ARROW_PREDICT_FALSE(length < 0)) {
+        throw ParquetException("Invalid or corrupted value length " +
+                               std::to_string(length));
+      }
+      if (ARROW_PREDICT_FALSE(length > len_)) {
+        ParquetException::EofException();
+      }
+      buffer[i].len = length;
       buffer[i].ptr = data_;
-      this->data_ += lengths[i];
-      this->len_ -= lengths[i];
+      data_ += length;
+      len_ -= length;
     }
-    this->num_values_ -= max_values;
+    num_values_ -= max_values;
     return max_values;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    return DecodeByteArraysArrow(this, num_values, null_count, valid_bits,
+                                 valid_bits_offset, out);
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    return DecodeByteArraysArrow(this, num_values, null_count, valid_bits,
+                                 valid_bits_offset, out);
   }
 
  private:
   DeltaBitPackDecoder<Int32Type> len_decoder_;
-  ::arrow::MemoryPool* pool_;
+  ArrowPoolVector<int32_t> lengths_;
+  int length_idx_ = 0;
 };
 
 // ----------------------------------------------------------------------
 // DELTA_BYTE_ARRAY
+//
+// The length of the prefix each value shares with the previous value,
+// DELTA_BINARY_PACKED, followed by the remaining suffixes of the values,
+// DELTA_LENGTH_BYTE_ARRAY
+
+class DeltaByteArrayEncoder : public EncoderImpl,
+                              virtual public TypedEncoder<ByteArrayType> {
+ public:
+  explicit DeltaByteArrayEncoder(const ColumnDescriptor* descr, MemoryPool* pool)
+      : EncoderImpl(descr, Encoding::DELTA_BYTE_ARRAY, pool),
+        prefix_length_encoder_(nullptr, pool),
+        suffix_encoder_(nullptr, pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return prefix_length_encoder_.EstimatedDataEncodedSize() +
+           suffix_encoder_.EstimatedDataEncodedSize();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> prefix_lengths = prefix_length_encoder_.FlushValues();
+    std::shared_ptr<Buffer> suffixes = suffix_encoder_.FlushValues();
+    last_value_.clear();
+    PARQUET_ASSIGN_OR_THROW(
+        auto buffer, arrow::ConcatenateBuffers({prefix_lengths, suffixes}, pool_));
+    return buffer;
+  }
+
+  using TypedEncoder<ByteArrayType>::Put;
+
+  void Put(const ByteArray* src, int num_values) override {
+    for (int i = 0; i < num_values; ++i) {
+      Put(src[i]);
+    }
+  }
+
+  void Put(const arrow::Array& values) override {
+    AssertBinary(values);
+    const auto& data = checked_cast<const arrow::BinaryArray&>(values);
+    for (int64_t i = 0; i < data.length(); i++) {
+      if (data.IsValid(i)) {
+        Put(ByteArray(data.GetView(i)));
+      }
+    }
+  }
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    PARQUET_ASSIGN_OR_THROW(auto buffer,
+                            arrow::AllocateBuffer(num_values * sizeof(ByteArray),
+                                                  this->memory_pool()));
+    auto data = reinterpret_cast<ByteArray*>(buffer->mutable_data());
+    int num_valid_values = arrow::util::internal::SpacedCompress<ByteArray>(
+        src, num_values, valid_bits, valid_bits_offset, data);
+    Put(data, num_valid_values);
+  }
+
+  void Put(const ByteArray& value) {
+    const auto* chars = reinterpret_cast<const char*>(value.ptr);
+    const uint32_t max_prefix =
+        std::min(value.len, static_cast<uint32_t>(last_value_.size()));
+    uint32_t prefix = 0;
+    while (prefix < max_prefix && last_value_[prefix] == chars[prefix]) {
+      ++prefix;
+    }
+    const auto prefix_length = static_cast<int32_t>(prefix);
+    prefix_length_encoder_.Put(&prefix_length, 1);
+    suffix_encoder_.Put(ByteArray(value.len - prefix, value.ptr + prefix));
+    last_value_.assign(chars, value.len);
+  }
+
+ private:
+  DeltaBitPackEncoder<Int32Type> prefix_length_encoder_;
+  DeltaLengthByteArrayEncoder suffix_encoder_;
+  std::string last_value_;
+};
 
 class DeltaByteArrayDecoder : public DecoderImpl,
                               virtual public TypedDecoder<ByteArrayType> {
@@ -2182,46 +2734,90 @@ class DeltaByteArrayDecoder : public DecoderImpl,
       : DecoderImpl(descr, Encoding::DELTA_BYTE_ARRAY),
         prefix_len_decoder_(nullptr, pool),
         suffix_decoder_(nullptr, pool),
-        last_value_(0, nullptr) {}
+        prefix_lengths_(::arrow::stl::allocator<int32_t>(pool)),
+        buffered_data_(AllocateBuffer(pool, 0)) {}
 
-  virtual void SetData(int num_values, const uint8_t* data, int len) {
+  void SetData(int num_values, const uint8_t* data, int len) override {
     num_values_ = num_values;
-    if (len == 0) return;
-    int prefix_len_length = arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    len -= 4;
-    prefix_len_decoder_.SetData(num_values, data, prefix_len_length);
-    data += prefix_len_length;
-    len -= prefix_len_length;
-    suffix_decoder_.SetData(num_values, data, len);
-  }
-
-  // TODO: this doesn't work and requires memory management. We need to allocate
-  // new strings to store the results.
-  virtual int Decode(ByteArray* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
-    for (int i = 0; i < max_values; ++i) {
-      int prefix_len = 0;
-      prefix_len_decoder_.Decode(&prefix_len, 1);
-      ByteArray suffix = {0, nullptr};
-      suffix_decoder_.Decode(&suffix, 1);
-      buffer[i].len = prefix_len + suffix.len;
+    // Decode all the prefix lengths up front, to find where the suffixes start
+    prefix_len_decoder_.SetData(num_values, data, len);
+    const int num_prefixes = prefix_len_decoder_.total_value_count();
+    prefix_lengths_.resize(num_prefixes);
+    if (prefix_len_decoder_.Decode(prefix_lengths_.data(), num_prefixes) !=
+        num_prefixes) {
+      ParquetException::EofException();
+    }
+    const int prefix_lengths_size = prefix_len_decoder_.bytes_consumed();
+    suffix_decoder_.SetData(num_values, data + prefix_lengths_size,
+                            len - prefix_lengths_size);
+    prefix_idx_ = 0;
+    last_value_.clear();
+  }
+
+  /// The values are valid until the next call to Decode
+  int Decode(ByteArray* buffer, int max_values) override {
+    max_values =
+        std::min(max_values, static_cast<int>(prefix_lengths_.size()) - prefix_idx_);
+    if (suffix_decoder_.Decode(buffer, max_values) != max_values) {
+      ParquetException::EofException();
+    }
 
-      uint8_t* result = reinterpret_cast<uint8_t*>(malloc(buffer[i].len));
-      memcpy(result, last_value_.ptr, prefix_len);
-      memcpy(result + prefix_len, suffix.ptr, suffix.len);
+    // Validate the prefix lengths and size the values
+    int64_t total_size = 0;
+    int64_t previous_length = static_cast<int64_t>(last_value_.size());
+    for (int i = 0; i < max_values; ++i) {
+      const int32_t prefix_length = prefix_lengths_[prefix_idx_ + i];
+      if (ARROW_PREDICT_FALSE(prefix_length < 0 || prefix_length > previous_length)) {
+        throw ParquetException("Invalid or corrupted prefix length " +
+                               std::to_string(prefix_length));
+      }
+      previous_length = prefix_length + static_cast<int64_t>(buffer[i].len);
+      total_size += previous_length;
+    }
+    PARQUET_THROW_NOT_OK(buffered_data_->Resize(total_size, /*shrink_to_fit=*/false));
 
-      buffer[i].ptr = result;
-      last_value_ = buffer[i];
+    uint8_t* out = buffered_data_->mutable_data();
+    const auto* previous = reinterpret_cast<const uint8_t*>(last_value_.data());
+    for (int i = 0; i < max_values; ++i) {
+      const int32_t prefix_length = prefix_lengths_[prefix_idx_ + i];
+      std::memcpy(out, previous, prefix_length);
+      std::memcpy(out + prefix_length, buffer[i].ptr, buffer[i].len);
+      buffer[i].len += prefix_length;
+      buffer[i].ptr = out;
+      previous = out;
+      out += buffer[i].len;
     }
-    this->num_values_ -= max_values;
+    if (max_values > 0) {
+      last_value_.assign(reinterpret_cast<const char*>(previous),
+                         buffer[max_values - 1].len);
+    }
+    prefix_idx_ += max_values;
+    num_values_ -= max_values;
     return max_values;
   }
 
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
+    return DecodeByteArraysArrow(this, num_values, null_count, valid_bits,
+                                 valid_bits_offset, out);
+  }
+
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
+    return DecodeByteArraysArrow(this, num_values, null_count, valid_bits,
+                                 valid_bits_offset, out);
+  }
+
  private:
   DeltaBitPackDecoder<Int32Type> prefix_len_decoder_;
   DeltaLengthByteArrayDecoder suffix_decoder_;
-  ByteArray last_value_;
+  ArrowPoolVector<int32_t> prefix_lengths_;
+  int prefix_idx_ = 0;
+  std::string last_value_;
+  // Storage of the values returned by the last call to Decode
+  std::shared_ptr<ResizableBuffer> buffered_data_;
 };
 
 // ----------------------------------------------------------------------
@@ -2407,6 +3003,26 @@ std::unique_ptr<Encoder> MakeEncoder(Type::type type_num, Encoding::type encodin
         throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int32Type>(descr, pool));
+      case Type::INT64:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int64Type>(descr, pool));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Encoder>(new DeltaLengthByteArrayEncoder(descr, pool));
+    }
+    throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Encoder>(new DeltaByteArrayEncoder(descr, pool));
+    }
+    throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
@@ -2447,6 +3063,26 @@ std::unique_ptr<Decoder> MakeDecoder(Type::type type_num, Encoding::type encodin
         throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int32Type>(descr));
+      case Type::INT64:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int64Type>(descr));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Decoder>(new DeltaLengthByteArrayDecoder(descr));
+    }
+    throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Decoder>(new DeltaByteArrayDecoder(descr));
+    }
+    throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
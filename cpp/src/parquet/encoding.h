@@ -352,10 +352,19 @@ class DictDecoder : virtual public TypedDecoder<DType> {
   /// but do not append any indices
   virtual void InsertDictionary(::arrow::ArrayBuilder* builder) = 0;
 
+  /// \brief The dictionary values as an Arrow array, without hashing them
+  ///
+  /// The array references the decoder's memory: it is only valid until the
+  /// next call to SetDict().
+  virtual std::shared_ptr<::arrow::Array> GetDictionary() = 0;
+
   /// \brief Decode only dictionary indices and append to dictionary
   /// builder. The builder must have had the dictionary from this decoder
   /// inserted already.
   ///
+  /// The builder may also be an Int32Builder, which receives the indices
+  /// into the dictionary returned by GetDictionary().
+  ///
   /// \warning Remember to reset the builder each time the dict decoder is initialized
   /// with a new dictionary page
   virtual int DecodeIndicesSpaced(int num_values, int null_count,
@@ -364,6 +373,8 @@ class DictDecoder : virtual public TypedDecoder<DType> {
 
   /// \brief Decode only dictionary indices (no nulls)
   ///
+  /// The builder may also be an Int32Builder, as in DecodeIndicesSpaced().
+  ///
   /// \warning Remember to reset the builder each time the dict decoder is initialized
   /// with a new dictionary page
   virtual int DecodeIndices(int num_values, ::arrow::ArrayBuilder* builder) = 0;
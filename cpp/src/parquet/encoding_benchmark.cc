@@ -31,6 +31,7 @@
 #include "parquet/schema.h"
 
 #include <cmath>
+#include <limits>
 #include <random>
 
 using arrow::default_memory_pool;
@@ -319,6 +320,89 @@ static void BM_PlainDecodingSpacedDouble(benchmark::State& state) {
 }
 BENCHMARK(BM_PlainDecodingSpacedDouble)->Apply(BM_PlainSpacedArgs);
 
+// Values with random steps of at most max_step, so that the deltas pack into
+// about log2(max_step) bits
+template <typename T>
+static std::vector<T> DeltaBitPackValues(int64_t num_values, uint32_t max_step) {
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<uint32_t> d(0, max_step);
+  std::vector<T> values(num_values);
+  T value = 0;
+  for (auto& v : values) {
+    value = static_cast<T>(value + d(gen));
+    v = value;
+  }
+  return values;
+}
+
+template <typename Type>
+static void BM_DeltaBitPackingEncode(benchmark::State& state, uint32_t max_step) {
+  using T = typename Type::c_type;
+  const auto values = DeltaBitPackValues<T>(state.range(0), max_step);
+  auto encoder = MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED);
+
+  for (auto _ : state) {
+    encoder->Put(values.data(), static_cast<int>(values.size()));
+    encoder->FlushValues();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template <typename Type>
+static void BM_DeltaBitPackingDecode(benchmark::State& state, uint32_t max_step) {
+  using T = typename Type::c_type;
+  auto values = DeltaBitPackValues<T>(state.range(0), max_step);
+  auto encoder = MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  std::shared_ptr<Buffer> buf = encoder->FlushValues();
+
+  for (auto _ : state) {
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED);
+    decoder->SetData(static_cast<int>(values.size()), buf->data(),
+                     static_cast<int>(buf->size()));
+    decoder->Decode(values.data(), static_cast<int>(values.size()));
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+static void BM_DeltaBitPackingEncode_Int32(benchmark::State& state) {
+  BM_DeltaBitPackingEncode<Int32Type>(state, 1000);
+}
+
+static void BM_DeltaBitPackingEncode_Int64(benchmark::State& state) {
+  BM_DeltaBitPackingEncode<Int64Type>(state, 1000);
+}
+
+// Constant steps give zero-width miniblocks
+static void BM_DeltaBitPackingDecode_Int32_Constant(benchmark::State& state) {
+  BM_DeltaBitPackingDecode<Int32Type>(state, 0);
+}
+
+static void BM_DeltaBitPackingDecode_Int32(benchmark::State& state) {
+  BM_DeltaBitPackingDecode<Int32Type>(state, 1000);
+}
+
+static void BM_DeltaBitPackingDecode_Int64_Constant(benchmark::State& state) {
+  BM_DeltaBitPackingDecode<Int64Type>(state, 0);
+}
+
+static void BM_DeltaBitPackingDecode_Int64(benchmark::State& state) {
+  BM_DeltaBitPackingDecode<Int64Type>(state, 1000);
+}
+
+static void BM_DeltaBitPackingDecode_Int64_Wide(benchmark::State& state) {
+  BM_DeltaBitPackingDecode<Int64Type>(state, std::numeric_limits<uint32_t>::max());
+}
+
+BENCHMARK(BM_DeltaBitPackingEncode_Int32)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackingEncode_Int64)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackingDecode_Int32_Constant)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackingDecode_Int32)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackingDecode_Int64_Constant)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackingDecode_Int64)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackingDecode_Int64_Wide)->Range(MIN_RANGE, MAX_RANGE);
+
 template <typename T, typename DecodeFunc>
 static void BM_ByteStreamSplitDecode(benchmark::State& state, DecodeFunc&& decode_func) {
   std::vector<T> values(state.range(0), 64.0);
@@ -452,6 +536,33 @@ BENCHMARK(BM_ByteStreamSplitEncode_Float_Avx512)->Range(MIN_RANGE, MAX_RANGE);
 BENCHMARK(BM_ByteStreamSplitEncode_Double_Avx512)->Range(MIN_RANGE, MAX_RANGE);
 #endif
 
+#if defined(ARROW_HAVE_NEON)
+static void BM_ByteStreamSplitDecode_Float_Neon(benchmark::State& state) {
+  BM_ByteStreamSplitDecode<float>(
+      state, arrow::util::internal::ByteStreamSplitDecodeNeon<float>);
+}
+
+static void BM_ByteStreamSplitDecode_Double_Neon(benchmark::State& state) {
+  BM_ByteStreamSplitDecode<double>(
+      state, arrow::util::internal::ByteStreamSplitDecodeNeon<double>);
+}
+
+static void BM_ByteStreamSplitEncode_Float_Neon(benchmark::State& state) {
+  BM_ByteStreamSplitEncode<float>(
+      state, arrow::util::internal::ByteStreamSplitEncodeNeon<float>);
+}
+
+static void BM_ByteStreamSplitEncode_Double_Neon(benchmark::State& state) {
+  BM_ByteStreamSplitEncode<double>(
+      state, arrow::util::internal::ByteStreamSplitEncodeNeon<double>);
+}
+
+BENCHMARK(BM_ByteStreamSplitDecode_Float_Neon)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_ByteStreamSplitDecode_Double_Neon)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_ByteStreamSplitEncode_Float_Neon)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_ByteStreamSplitEncode_Double_Neon)->Range(MIN_RANGE, MAX_RANGE);
+#endif
+
 template <typename Type>
 static void DecodeDict(std::vector<typename Type::c_type>& values,
                        benchmark::State& state) {
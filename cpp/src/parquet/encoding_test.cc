@@ -21,6 +21,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <limits>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -1235,5 +1236,245 @@ TEST(ByteStreamSplitEncodeDecode, InvalidDataTypes) {
   ASSERT_THROW(MakeTypedDecoder<FLBAType>(Encoding::BYTE_STREAM_SPLIT), ParquetException);
 }
 
+// ----------------------------------------------------------------------
+// DELTA_BINARY_PACKED encode/decode tests
+
+template <typename Type>
+class TestDeltaBitPackEncoding : public TestEncodingBase<Type> {
+ public:
+  typedef typename Type::c_type T;
+  static constexpr int TYPE = Type::type_num;
+
+  void CheckRoundtrip() override {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED, descr_.get());
+    encoder->Put(draws_, num_values_);
+    encode_buffer_ = encoder->FlushValues();
+
+    {
+      decoder->SetData(num_values_, encode_buffer_->data(),
+                       static_cast<int>(encode_buffer_->size()));
+      int values_decoded = decoder->Decode(decode_buf_, num_values_);
+      ASSERT_EQ(num_values_, values_decoded);
+      ASSERT_NO_FATAL_FAILURE(VerifyResults<T>(decode_buf_, draws_, num_values_));
+    }
+
+    {
+      // Try again but with a step crossing the miniblocks
+      decoder->SetData(num_values_, encode_buffer_->data(),
+                       static_cast<int>(encode_buffer_->size()));
+      int step = 37;
+      int remaining = num_values_;
+      for (int i = 0; i < num_values_; i += step) {
+        int num_decoded = decoder->Decode(decode_buf_, step);
+        ASSERT_EQ(num_decoded, std::min(step, remaining));
+        ASSERT_NO_FATAL_FAILURE(VerifyResults<T>(decode_buf_, &draws_[i], num_decoded));
+        remaining -= num_decoded;
+      }
+    }
+  }
+
+  void CheckRoundtripSpaced(const uint8_t* valid_bits,
+                            int64_t valid_bits_offset) override {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED, descr_.get());
+    int null_count = 0;
+    for (auto i = 0; i < num_values_; i++) {
+      if (!BitUtil::GetBit(valid_bits, valid_bits_offset + i)) {
+        null_count++;
+      }
+    }
+
+    encoder->PutSpaced(draws_, num_values_, valid_bits, valid_bits_offset);
+    encode_buffer_ = encoder->FlushValues();
+    decoder->SetData(num_values_ - null_count, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    auto values_decoded = decoder->DecodeSpaced(decode_buf_, num_values_, null_count,
+                                                valid_bits, valid_bits_offset);
+    ASSERT_EQ(num_values_, values_decoded);
+    ASSERT_NO_FATAL_FAILURE(VerifyResultsSpaced<T>(decode_buf_, draws_, num_values_,
+                                                   valid_bits, valid_bits_offset));
+  }
+
+  // Values whose deltas span the whole range of T
+  void ExecuteExtremes(int nvalues) {
+    this->InitData(nvalues, 1);
+    for (int i = 0; i < num_values_; ++i) {
+      if (i % 3 == 0) {
+        draws_[i] = std::numeric_limits<T>::min();
+      } else if (i % 3 == 1) {
+        draws_[i] = std::numeric_limits<T>::max();
+      } else {
+        draws_[i] = static_cast<T>(i);
+      }
+    }
+    CheckRoundtrip();
+  }
+
+ protected:
+  USING_BASE_MEMBERS();
+};
+
+typedef ::testing::Types<Int32Type, Int64Type> DeltaBitPackTypes;
+TYPED_TEST_SUITE(TestDeltaBitPackEncoding, DeltaBitPackTypes);
+
+TYPED_TEST(TestDeltaBitPackEncoding, BasicRoundTrip) {
+  // Sizes around the miniblock (32 values) and block (128 values) boundaries
+  for (int values : {0, 1, 2, 31, 32, 33, 127, 128, 129, 1000, 10000}) {
+    ASSERT_NO_FATAL_FAILURE(this->Execute(values, 1));
+  }
+  ASSERT_NO_FATAL_FAILURE(this->Execute(1000, 10));
+
+  for (auto null_prob : {0.001, 0.1, 0.5, 0.9, 0.999}) {
+    ASSERT_NO_FATAL_FAILURE(this->ExecuteSpaced(1000, 1, 0, null_prob));
+    ASSERT_NO_FATAL_FAILURE(this->ExecuteSpaced(1000, 1, 33, null_prob));
+  }
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, RoundTripExtremeDeltas) {
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteExtremes(1000));
+}
+
+TEST(DeltaBitPackEncoding, SpecExample) {
+  // From the Parquet format specification: 1, 2, 3, 4, 5 encode as a header
+  // (block size 128, 4 miniblocks, 5 values, first value 1), then one block of
+  // min delta 1 and four zero bit widths
+  auto encoder = MakeTypedEncoder<Int32Type>(Encoding::DELTA_BINARY_PACKED);
+  std::vector<int32_t> values = {1, 2, 3, 4, 5};
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  auto buffer = encoder->FlushValues();
+  std::vector<uint8_t> expected = {0x80, 0x01, 0x04, 0x05, 0x02, 0x02, 0, 0, 0, 0};
+  ASSERT_EQ(expected,
+            std::vector<uint8_t>(buffer->data(), buffer->data() + buffer->size()));
+
+  auto decoder = MakeTypedDecoder<Int32Type>(Encoding::DELTA_BINARY_PACKED);
+  decoder->SetData(5, buffer->data(), static_cast<int>(buffer->size()));
+  std::vector<int32_t> decoded(5);
+  ASSERT_EQ(5, decoder->Decode(decoded.data(), 5));
+  ASSERT_EQ(values, decoded);
+}
+
+TEST(DeltaBitPackEncoding, SortedValuesAreSmall) {
+  // Timestamps at a fixed interval: all the deltas are equal, so each block
+  // is just its min delta and bit widths
+  std::vector<int64_t> values(10000);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = 1600000000000000LL + static_cast<int64_t>(i) * 1000;
+  }
+  auto encoder = MakeTypedEncoder<Int64Type>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  auto buffer = encoder->FlushValues();
+  ASSERT_LT(buffer->size(), 1000);
+}
+
+TEST(DeltaEncodeDecode, InvalidDataTypes) {
+  for (auto encoding : {Encoding::DELTA_BINARY_PACKED}) {
+    ASSERT_THROW(MakeTypedEncoder<BooleanType>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedEncoder<FloatType>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedEncoder<ByteArrayType>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedDecoder<DoubleType>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedDecoder<FLBAType>(encoding), ParquetException);
+  }
+  for (auto encoding : {Encoding::DELTA_LENGTH_BYTE_ARRAY, Encoding::DELTA_BYTE_ARRAY}) {
+    ASSERT_THROW(MakeTypedEncoder<Int32Type>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedEncoder<FLBAType>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedDecoder<Int64Type>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedDecoder<FLBAType>(encoding), ParquetException);
+  }
+}
+
+// ----------------------------------------------------------------------
+// DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY encode/decode tests
+
+class DeltaByteArrayEncodingBase : public TestArrowBuilderDecoding {
+ public:
+  explicit DeltaByteArrayEncodingBase(Encoding::type encoding) : encoding_(encoding) {}
+
+  void SetupEncoderDecoder() override {
+    encoder_ = MakeTypedEncoder<ByteArrayType>(encoding_);
+    plain_decoder_ = MakeTypedDecoder<ByteArrayType>(encoding_);
+    decoder_ = plain_decoder_.get();
+    if (valid_bits_ != nullptr) {
+      ASSERT_NO_THROW(
+          encoder_->PutSpaced(input_data_.data(), num_values_, valid_bits_, 0));
+    } else {
+      ASSERT_NO_THROW(encoder_->Put(input_data_.data(), num_values_));
+    }
+    buffer_ = encoder_->FlushValues();
+    decoder_->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+  }
+
+  // Round trip values sharing long prefixes through Decode, in small steps
+  void CheckSortedStrings() {
+    std::vector<std::string> strings;
+    for (int i = 0; i < 1000; ++i) {
+      strings.push_back("https://example.com/items/" + std::to_string(i * 37));
+    }
+    std::sort(strings.begin(), strings.end());
+    std::vector<ByteArray> values(strings.begin(), strings.end());
+
+    auto encoder = MakeTypedEncoder<ByteArrayType>(encoding_);
+    encoder->Put(values.data(), static_cast<int>(values.size()));
+    auto buffer = encoder->FlushValues();
+
+    auto decoder = MakeTypedDecoder<ByteArrayType>(encoding_);
+    decoder->SetData(static_cast<int>(values.size()), buffer->data(),
+                     static_cast<int>(buffer->size()));
+    const int step = 37;
+    std::vector<ByteArray> decoded(step);
+    for (size_t i = 0; i < values.size(); i += step) {
+      int num_decoded = decoder->Decode(decoded.data(), step);
+      ASSERT_EQ(std::min<size_t>(step, values.size() - i), num_decoded);
+      for (int j = 0; j < num_decoded; ++j) {
+        ASSERT_EQ(values[i + j], decoded[j]);
+      }
+    }
+  }
+
+ protected:
+  Encoding::type encoding_;
+};
+
+class DeltaLengthByteArrayEncoding : public DeltaByteArrayEncodingBase {
+ public:
+  DeltaLengthByteArrayEncoding()
+      : DeltaByteArrayEncodingBase(Encoding::DELTA_LENGTH_BYTE_ARRAY) {}
+};
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowUsingDenseBuilder) {
+  this->CheckDecodeArrowUsingDenseBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowUsingDictBuilder) {
+  this->CheckDecodeArrowUsingDictBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowNonNullDenseBuilder) {
+  this->CheckDecodeArrowNonNullUsingDenseBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckSortedStrings) { this->CheckSortedStrings(); }
+
+class DeltaByteArrayEncoding : public DeltaByteArrayEncodingBase {
+ public:
+  DeltaByteArrayEncoding() : DeltaByteArrayEncodingBase(Encoding::DELTA_BYTE_ARRAY) {}
+};
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowUsingDenseBuilder) {
+  this->CheckDecodeArrowUsingDenseBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowUsingDictBuilder) {
+  this->CheckDecodeArrowUsingDictBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowNonNullDenseBuilder) {
+  this->CheckDecodeArrowNonNullUsingDenseBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckSortedStrings) { this->CheckSortedStrings(); }
+
 }  // namespace test
 }  // namespace parquet
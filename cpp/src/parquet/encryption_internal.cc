@@ -23,8 +23,10 @@
 #include <algorithm>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "parquet/exception.h"
@@ -44,11 +46,6 @@ constexpr int kBufferSizeLength = 4;
     throw ParquetException("Couldn't init ALG encryption");           \
   }
 
-#define DECRYPT_INIT(CTX, ALG)                                        \
-  if (1 != EVP_DecryptInit_ex(CTX, ALG, nullptr, nullptr, nullptr)) { \
-    throw ParquetException("Couldn't init ALG decryption");           \
-  }
-
 class AesEncryptor::AesEncryptorImpl {
  public:
   explicit AesEncryptorImpl(ParquetCipher::type alg_id, int key_len, bool metadata);
@@ -306,35 +303,45 @@ class AesDecryptor::AesDecryptorImpl {
  public:
   explicit AesDecryptorImpl(ParquetCipher::type alg_id, int key_len, bool metadata);
 
-  ~AesDecryptorImpl() {
-    if (nullptr != ctx_) {
-      EVP_CIPHER_CTX_free(ctx_);
-      ctx_ = nullptr;
-    }
-  }
+  ~AesDecryptorImpl() { WipeOut(); }
 
   int Decrypt(const uint8_t* ciphertext, int ciphertext_len, const uint8_t* key,
               int key_len, const uint8_t* aad, int aad_len, uint8_t* plaintext);
 
   void WipeOut() {
-    if (nullptr != ctx_) {
-      EVP_CIPHER_CTX_free(ctx_);
-      ctx_ = nullptr;
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& entry : free_contexts_) {
+      for (EVP_CIPHER_CTX* ctx : entry.second) {
+        EVP_CIPHER_CTX_free(ctx);
+      }
     }
+    free_contexts_.clear();
+    wiped_out_ = true;
   }
 
   int ciphertext_size_delta() { return ciphertext_size_delta_; }
 
  private:
-  EVP_CIPHER_CTX* ctx_;
+  // Cipher contexts are set up with the cipher and key once, so that the key
+  // schedule isn't expanded again for every page.  A context serves one
+  // decryption at a time: concurrent decryptions (e.g. of prefetched pages)
+  // each take their own from the pool, or create one.
+  EVP_CIPHER_CTX* AcquireContext(const uint8_t* key, int key_len);
+  void ReleaseContext(const uint8_t* key, int key_len, EVP_CIPHER_CTX* ctx);
+
+  const EVP_CIPHER* cipher_;
+  std::mutex mutex_;
+  // Idle contexts, by key
+  std::unordered_map<std::string, std::vector<EVP_CIPHER_CTX*>> free_contexts_;
+  bool wiped_out_ = false;
   int aes_mode_;
   int key_length_;
   int ciphertext_size_delta_;
-  int GcmDecrypt(const uint8_t* ciphertext, int ciphertext_len, const uint8_t* key,
-                 int key_len, const uint8_t* aad, int aad_len, uint8_t* plaintext);
+  int GcmDecrypt(EVP_CIPHER_CTX* ctx, const uint8_t* ciphertext, int ciphertext_len,
+                 const uint8_t* aad, int aad_len, uint8_t* plaintext);
 
-  int CtrDecrypt(const uint8_t* ciphertext, int ciphertext_len, const uint8_t* key,
-                 int key_len, uint8_t* plaintext);
+  int CtrDecrypt(EVP_CIPHER_CTX* ctx, const uint8_t* ciphertext, int ciphertext_len,
+                 uint8_t* plaintext);
 };
 
 int AesDecryptor::Decrypt(const uint8_t* plaintext, int plaintext_len, const uint8_t* key,
@@ -349,8 +356,6 @@ AesDecryptor::~AesDecryptor() {}
 
 AesDecryptor::AesDecryptorImpl::AesDecryptorImpl(ParquetCipher::type alg_id, int key_len,
                                                  bool metadata) {
-  ctx_ = nullptr;
-
   ciphertext_size_delta_ = kBufferSizeLength + kNonceLength;
   if (metadata || (ParquetCipher::AES_GCM_V1 == alg_id)) {
     aes_mode_ = kGcmMode;
@@ -367,32 +372,67 @@ AesDecryptor::AesDecryptorImpl::AesDecryptorImpl(ParquetCipher::type alg_id, int
 
   key_length_ = key_len;
 
-  ctx_ = EVP_CIPHER_CTX_new();
-  if (nullptr == ctx_) {
-    throw ParquetException("Couldn't init cipher context");
-  }
-
   if (kGcmMode == aes_mode_) {
-    // Init AES-GCM with specified key length
+    // AES-GCM with specified key length
     if (16 == key_len) {
-      DECRYPT_INIT(ctx_, EVP_aes_128_gcm());
+      cipher_ = EVP_aes_128_gcm();
     } else if (24 == key_len) {
-      DECRYPT_INIT(ctx_, EVP_aes_192_gcm());
-    } else if (32 == key_len) {
-      DECRYPT_INIT(ctx_, EVP_aes_256_gcm());
+      cipher_ = EVP_aes_192_gcm();
+    } else {
+      cipher_ = EVP_aes_256_gcm();
     }
   } else {
-    // Init AES-CTR with specified key length
+    // AES-CTR with specified key length
     if (16 == key_len) {
-      DECRYPT_INIT(ctx_, EVP_aes_128_ctr());
+      cipher_ = EVP_aes_128_ctr();
     } else if (24 == key_len) {
-      DECRYPT_INIT(ctx_, EVP_aes_192_ctr());
-    } else if (32 == key_len) {
-      DECRYPT_INIT(ctx_, EVP_aes_256_ctr());
+      cipher_ = EVP_aes_192_ctr();
+    } else {
+      cipher_ = EVP_aes_256_ctr();
     }
   }
 }
 
+EVP_CIPHER_CTX* AesDecryptor::AesDecryptorImpl::AcquireContext(const uint8_t* key,
+                                                               int key_len) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (wiped_out_) {
+      throw ParquetException("Decryptor was wiped out");
+    }
+    auto it = free_contexts_.find(
+        std::string(reinterpret_cast<const char*>(key), static_cast<size_t>(key_len)));
+    if (it != free_contexts_.end() && !it->second.empty()) {
+      EVP_CIPHER_CTX* ctx = it->second.back();
+      it->second.pop_back();
+      return ctx;
+    }
+  }
+
+  EVP_CIPHER_CTX* ctx = EVP_CIPHER_CTX_new();
+  if (nullptr == ctx) {
+    throw ParquetException("Couldn't init cipher context");
+  }
+  // Setting the key; the IV is set for every decryption
+  if (1 != EVP_DecryptInit_ex(ctx, cipher_, nullptr, key, nullptr)) {
+    EVP_CIPHER_CTX_free(ctx);
+    throw ParquetException("Couldn't init decryption key");
+  }
+  return ctx;
+}
+
+void AesDecryptor::AesDecryptorImpl::ReleaseContext(const uint8_t* key, int key_len,
+                                                    EVP_CIPHER_CTX* ctx) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (wiped_out_) {
+    EVP_CIPHER_CTX_free(ctx);
+    return;
+  }
+  free_contexts_[std::string(reinterpret_cast<const char*>(key),
+                             static_cast<size_t>(key_len))]
+      .push_back(ctx);
+}
+
 AesEncryptor* AesEncryptor::Make(ParquetCipher::type alg_id, int key_len, bool metadata,
                                  std::vector<AesEncryptor*>* all_encryptors) {
   if (ParquetCipher::AES_GCM_V1 != alg_id && ParquetCipher::AES_GCM_CTR_V1 != alg_id) {
@@ -427,9 +467,9 @@ AesDecryptor* AesDecryptor::Make(ParquetCipher::type alg_id, int key_len, bool m
 
 int AesDecryptor::CiphertextSizeDelta() { return impl_->ciphertext_size_delta(); }
 
-int AesDecryptor::AesDecryptorImpl::GcmDecrypt(const uint8_t* ciphertext,
-                                               int ciphertext_len, const uint8_t* key,
-                                               int key_len, const uint8_t* aad,
+int AesDecryptor::AesDecryptorImpl::GcmDecrypt(EVP_CIPHER_CTX* ctx,
+                                               const uint8_t* ciphertext,
+                                               int ciphertext_len, const uint8_t* aad,
                                                int aad_len, uint8_t* plaintext) {
   int len;
   int plaintext_len;
@@ -456,19 +496,19 @@ int AesDecryptor::AesDecryptorImpl::GcmDecrypt(const uint8_t* ciphertext,
   std::copy(ciphertext + ciphertext_len - kGcmTagLength, ciphertext + ciphertext_len,
             tag);
 
-  // Setting key and IV
-  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, key, nonce)) {
-    throw ParquetException("Couldn't set key and IV");
+  // Setting IV (the key was set when the context was created)
+  if (1 != EVP_DecryptInit_ex(ctx, nullptr, nullptr, nullptr, nonce)) {
+    throw ParquetException("Couldn't set IV");
   }
 
   // Setting additional authenticated data
-  if ((nullptr != aad) && (1 != EVP_DecryptUpdate(ctx_, nullptr, &len, aad, aad_len))) {
+  if ((nullptr != aad) && (1 != EVP_DecryptUpdate(ctx, nullptr, &len, aad, aad_len))) {
     throw ParquetException("Couldn't set AAD");
   }
 
   // Decryption
   if (!EVP_DecryptUpdate(
-          ctx_, plaintext, &len, ciphertext + kBufferSizeLength + kNonceLength,
+          ctx, plaintext, &len, ciphertext + kBufferSizeLength + kNonceLength,
           ciphertext_len - kBufferSizeLength - kNonceLength - kGcmTagLength)) {
     throw ParquetException("Failed decryption update");
   }
@@ -476,12 +516,12 @@ int AesDecryptor::AesDecryptorImpl::GcmDecrypt(const uint8_t* ciphertext,
   plaintext_len = len;
 
   // Checking the tag (authentication)
-  if (!EVP_CIPHER_CTX_ctrl(ctx_, EVP_CTRL_GCM_SET_TAG, kGcmTagLength, tag)) {
+  if (!EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_TAG, kGcmTagLength, tag)) {
     throw ParquetException("Failed authentication");
   }
 
   // Finalization
-  if (1 != EVP_DecryptFinal_ex(ctx_, plaintext + len, &len)) {
+  if (1 != EVP_DecryptFinal_ex(ctx, plaintext + len, &len)) {
     throw ParquetException("Failed decryption finalization");
   }
 
@@ -489,9 +529,9 @@ int AesDecryptor::AesDecryptorImpl::GcmDecrypt(const uint8_t* ciphertext,
   return plaintext_len;
 }
 
-int AesDecryptor::AesDecryptorImpl::CtrDecrypt(const uint8_t* ciphertext,
-                                               int ciphertext_len, const uint8_t* key,
-                                               int key_len, uint8_t* plaintext) {
+int AesDecryptor::AesDecryptorImpl::CtrDecrypt(EVP_CIPHER_CTX* ctx,
+                                               const uint8_t* ciphertext,
+                                               int ciphertext_len, uint8_t* plaintext) {
   int len;
   int plaintext_len;
 
@@ -518,13 +558,13 @@ int AesDecryptor::AesDecryptorImpl::CtrDecrypt(const uint8_t* ciphertext,
   // is set to 1.
   iv[kCtrIvLength - 1] = 1;
 
-  // Setting key and IV
-  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, key, iv)) {
-    throw ParquetException("Couldn't set key and IV");
+  // Setting IV (the key was set when the context was created)
+  if (1 != EVP_DecryptInit_ex(ctx, nullptr, nullptr, nullptr, iv)) {
+    throw ParquetException("Couldn't set IV");
   }
 
   // Decryption
-  if (!EVP_DecryptUpdate(ctx_, plaintext, &len,
+  if (!EVP_DecryptUpdate(ctx, plaintext, &len,
                          ciphertext + kBufferSizeLength + kNonceLength,
                          ciphertext_len - kNonceLength)) {
     throw ParquetException("Failed decryption update");
@@ -533,7 +573,7 @@ int AesDecryptor::AesDecryptorImpl::CtrDecrypt(const uint8_t* ciphertext,
   plaintext_len = len;
 
   // Finalization
-  if (1 != EVP_DecryptFinal_ex(ctx_, plaintext + len, &len)) {
+  if (1 != EVP_DecryptFinal_ex(ctx, plaintext + len, &len)) {
     throw ParquetException("Failed decryption finalization");
   }
 
@@ -551,11 +591,22 @@ int AesDecryptor::AesDecryptorImpl::Decrypt(const uint8_t* ciphertext, int ciphe
     throw ParquetException(ss.str());
   }
 
-  if (kGcmMode == aes_mode_) {
-    return GcmDecrypt(ciphertext, ciphertext_len, key, key_len, aad, aad_len, plaintext);
+  EVP_CIPHER_CTX* ctx = AcquireContext(key, key_len);
+  int plaintext_len;
+  try {
+    if (kGcmMode == aes_mode_) {
+      plaintext_len =
+          GcmDecrypt(ctx, ciphertext, ciphertext_len, aad, aad_len, plaintext);
+    } else {
+      plaintext_len = CtrDecrypt(ctx, ciphertext, ciphertext_len, plaintext);
+    }
+  } catch (...) {
+    // Don't reuse a context left in the middle of a decryption
+    EVP_CIPHER_CTX_free(ctx);
+    throw;
   }
-
-  return CtrDecrypt(ciphertext, ciphertext_len, key, key_len, plaintext);
+  ReleaseContext(key, key_len, ctx);
+  return plaintext_len;
 }
 
 static std::string ShortToBytesLe(int16_t input) {
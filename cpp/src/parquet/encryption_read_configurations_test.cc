@@ -99,6 +99,7 @@ class TestDecryptionConfiguration
   std::string kColumnEncryptionKey1_ = std::string(kColumnEncryptionKey1);
   std::string kColumnEncryptionKey2_ = std::string(kColumnEncryptionKey2);
   std::string kFileName_ = std::string(kFileName);
+  int page_prefetch_depth_ = 0;
 
   void CreateDecryptionConfigurations() {
     /**********************************************************************************
@@ -162,6 +163,7 @@ class TestDecryptionConfiguration
   void DecryptFile(std::string file, int decryption_config_num) {
     std::string exception_msg;
     parquet::ReaderProperties reader_properties = parquet::default_reader_properties();
+    reader_properties.set_page_prefetch_depth(page_prefetch_depth_);
     // if we get decryption_config_num = x then it means the actual number is x+1
     // and since we want decryption_config_num=4 we set the condition to 3
     if (decryption_config_num != 3) {
@@ -521,6 +523,13 @@ TEST_P(TestDecryptionConfiguration, TestDecryption) {
     unsigned decryption_config_num = index + 1;
     CheckResults(file_name, decryption_config_num, encryption_config_num);
   }
+
+  // Again, decrypting pages ahead on the thread pool
+  page_prefetch_depth_ = 3;
+  for (unsigned index = 0; index < vector_of_decryption_configurations_.size(); ++index) {
+    unsigned decryption_config_num = index + 1;
+    CheckResults(file_name, decryption_config_num, encryption_config_num);
+  }
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -88,9 +88,15 @@ class TestPageSerde : public ::testing::Test {
   void InitSerializedPageReader(int64_t num_rows,
                                 Compression::type codec = Compression::UNCOMPRESSED) {
     EndStream();
+    OpenSerializedPageReader(num_rows, codec);
+  }
 
+  // Read the pages of the finished stream (again)
+  void OpenSerializedPageReader(int64_t num_rows, Compression::type codec,
+                                int prefetch_depth = 0) {
     auto stream = std::make_shared<::arrow::io::BufferReader>(out_buffer_);
     page_reader_ = PageReader::Open(stream, num_rows, codec);
+    page_reader_->set_prefetch_depth(prefetch_depth);
   }
 
   void WriteDataPageHeader(int max_serialized_len = 1024, int32_t uncompressed_size = 0,
@@ -234,6 +240,36 @@ TEST_F(TestPageSerde, TestFailLargePageHeaders) {
   ASSERT_THROW(page_reader_->NextPage(), ParquetException);
 }
 
+TEST_F(TestPageSerde, DataPageFilter) {
+  const std::vector<int32_t> num_values = {10, 20, 30};
+  const std::string page_data(16, 'x');
+  const auto page_size = static_cast<int32_t>(page_data.size());
+  data_page_header_.__isset.statistics = true;
+  for (int32_t n : num_values) {
+    data_page_header_.num_values = n;
+    data_page_header_.statistics.__set_null_count(n / 10);
+    ASSERT_NO_FATAL_FAILURE(WriteDataPageHeader(1024, page_size, page_size));
+    ASSERT_OK(out_stream_->Write(page_data));
+  }
+  InitSerializedPageReader(/*num_rows=*/60);
+
+  std::vector<int64_t> seen_null_counts;
+  page_reader_->set_data_page_filter([&](const DataPageStats& stats) {
+    EXPECT_EQ(-1, stats.num_rows);
+    seen_null_counts.push_back(stats.encoded_statistics->null_count);
+    return stats.num_values == 20;
+  });
+
+  std::shared_ptr<Page> page = page_reader_->NextPage();
+  ASSERT_NE(nullptr, page);
+  ASSERT_EQ(10, static_cast<const DataPageV1*>(page.get())->num_values());
+  page = page_reader_->NextPage();
+  ASSERT_NE(nullptr, page);
+  ASSERT_EQ(30, static_cast<const DataPageV1*>(page.get())->num_values());
+  ASSERT_EQ(nullptr, page_reader_->NextPage());
+  ASSERT_EQ(std::vector<int64_t>({1, 2, 3}), seen_null_counts);
+}
+
 TEST_F(TestPageSerde, Compression) {
   std::vector<Compression::type> codec_types;
 
@@ -288,16 +324,31 @@ TEST_F(TestPageSerde, Compression) {
       ASSERT_OK(out_stream_->Write(buffer.data(), actual_size));
     }
 
-    InitSerializedPageReader(num_rows * num_pages, codec_type);
+    EndStream();
 
-    std::shared_ptr<Page> page;
-    const DataPageV1* data_page;
-    for (int i = 0; i < num_pages; ++i) {
-      int data_size = static_cast<int>(faux_data[i].size());
-      page = page_reader_->NextPage();
-      data_page = static_cast<const DataPageV1*>(page.get());
-      ASSERT_EQ(data_size, data_page->size());
-      ASSERT_EQ(0, memcmp(faux_data[i].data(), data_page->data(), data_size));
+    // Without prefetching, and with fewer or more pages in flight than pages
+    for (int prefetch_depth : {0, 3, 20}) {
+      OpenSerializedPageReader(num_rows * num_pages, codec_type, prefetch_depth);
+
+      std::vector<std::shared_ptr<Page>> pages;
+      auto check_page = [&](int i) {
+        int data_size = static_cast<int>(faux_data[i].size());
+        const auto data_page = static_cast<const DataPageV1*>(pages[i].get());
+        ASSERT_EQ(data_size, data_page->size());
+        ASSERT_EQ(0, memcmp(faux_data[i].data(), data_page->data(), data_size));
+      };
+      for (int i = 0; i < num_pages; ++i) {
+        pages.push_back(page_reader_->NextPage());
+        ASSERT_NE(nullptr, pages.back());
+        ASSERT_NO_FATAL_FAILURE(check_page(i));
+      }
+      ASSERT_EQ(nullptr, page_reader_->NextPage());
+      if (prefetch_depth > 0) {
+        // Prefetched pages own their buffer
+        for (int i = 0; i < num_pages; ++i) {
+          ASSERT_NO_FATAL_FAILURE(check_page(i));
+        }
+      }
     }
 
     ResetStream();
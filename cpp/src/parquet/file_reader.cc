@@ -30,6 +30,7 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/ubsan.h"
+#include "parquet/bloom_filter_reader.h"
 #include "parquet/column_reader.h"
 #include "parquet/column_scanner.h"
 #include "parquet/deprecated_io.h"
@@ -38,6 +39,7 @@
 #include "parquet/file_writer.h"
 #include "parquet/internal_file_decryptor.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -158,8 +160,7 @@ class SerializedRowGroup : public RowGroupReader::Contents {
 
     // Column is encrypted only if crypto_metadata exists.
     if (!crypto_metadata) {
-      return PageReader::Open(stream, col->num_values(), col->compression(),
-                              properties_.memory_pool());
+      return OpenPageReader(stream, *col, nullptr);
     }
 
     if (file_decryptor_ == nullptr) {
@@ -180,8 +181,7 @@ class SerializedRowGroup : public RowGroupReader::Contents {
       data_decryptor = file_decryptor_->GetFooterDecryptorForColumnData();
       CryptoContext ctx(col->has_dictionary_page(), row_group_ordinal_,
                         static_cast<int16_t>(i), meta_decryptor, data_decryptor);
-      return PageReader::Open(stream, col->num_values(), col->compression(),
-                              properties_.memory_pool(), &ctx);
+      return OpenPageReader(stream, *col, &ctx);
     }
 
     // The column is encrypted with its own key
@@ -195,11 +195,20 @@ class SerializedRowGroup : public RowGroupReader::Contents {
 
     CryptoContext ctx(col->has_dictionary_page(), row_group_ordinal_,
                       static_cast<int16_t>(i), meta_decryptor, data_decryptor);
-    return PageReader::Open(stream, col->num_values(), col->compression(),
-                            properties_.memory_pool(), &ctx);
+    return OpenPageReader(stream, *col, &ctx);
   }
 
  private:
+  std::unique_ptr<PageReader> OpenPageReader(std::shared_ptr<ArrowInputStream> stream,
+                                             const ColumnChunkMetaData& col,
+                                             const CryptoContext* ctx) {
+    std::unique_ptr<PageReader> page_reader =
+        PageReader::Open(std::move(stream), col.num_values(), col.compression(),
+                         properties_.memory_pool(), ctx);
+    page_reader->set_prefetch_depth(properties_.page_prefetch_depth());
+    return page_reader;
+  }
+
   std::shared_ptr<ArrowInputFile> source_;
   // Will be nullptr if PreBuffer() is not called.
   std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source_;
@@ -265,6 +274,47 @@ class SerializedFile : public ParquetFileReader::Contents {
     PARQUET_THROW_NOT_OK(cached_source_->Cache(ranges));
   }
 
+  ::arrow::Future<void> WhenBuffered(const std::vector<int>& row_groups,
+                                 const std::vector<int>& column_indices) const {
+    if (!cached_source_) {
+      return ::arrow::Future<void>::MakeFinished(
+          ::arrow::Status::Invalid("Must call PreBuffer before WhenBuffered"));
+    }
+    std::vector<arrow::io::ReadRange> ranges;
+    for (int row : row_groups) {
+      for (int col : column_indices) {
+        ranges.push_back(
+            ComputeColumnChunkRange(file_metadata_.get(), source_size_, row, col));
+      }
+    }
+    return cached_source_->WaitFor(std::move(ranges));
+  }
+
+  std::shared_ptr<PageIndexReader> GetPageIndexReader() {
+    for (int i = 0; i < file_metadata_->num_row_groups(); ++i) {
+      auto row_group = file_metadata_->RowGroup(i);
+      for (int j = 0; j < row_group->num_columns(); ++j) {
+        auto column = row_group->ColumnChunk(j);
+        if (column->has_column_index() || column->has_offset_index()) {
+          return PageIndexReader::Make(source_, file_metadata_, properties_);
+        }
+      }
+    }
+    return nullptr;
+  }
+
+  std::shared_ptr<BloomFilterReader> GetBloomFilterReader() {
+    for (int i = 0; i < file_metadata_->num_row_groups(); ++i) {
+      auto row_group = file_metadata_->RowGroup(i);
+      for (int j = 0; j < row_group->num_columns(); ++j) {
+        if (row_group->ColumnChunk(j)->has_bloom_filter()) {
+          return BloomFilterReader::Make(source_, file_metadata_, properties_);
+        }
+      }
+    }
+    return nullptr;
+  }
+
   void ParseMetaData() {
     if (source_size_ == 0) {
       throw ParquetInvalidOrCorruptedFileException("Parquet file size is 0 bytes");
@@ -602,6 +652,34 @@ void ParquetFileReader::PreBuffer(const std::vector<int>& row_groups,
   file->PreBuffer(row_groups, column_indices, ctx, options);
 }
 
+::arrow::Future<void> ParquetFileReader::WhenBuffered(
+    const std::vector<int>& row_groups, const std::vector<int>& column_indices) const {
+  // Access private methods here
+  SerializedFile* file =
+      ::arrow::internal::checked_cast<SerializedFile*>(contents_.get());
+  try {
+    return file->WhenBuffered(row_groups, column_indices);
+  } catch (const ParquetStatusException& e) {
+    return ::arrow::Future<void>::MakeFinished(e.status());
+  } catch (const ParquetException& e) {
+    return ::arrow::Future<void>::MakeFinished(::arrow::Status::IOError(e.what()));
+  }
+}
+
+std::shared_ptr<PageIndexReader> ParquetFileReader::GetPageIndexReader() {
+  // Access private methods here
+  SerializedFile* file =
+      ::arrow::internal::checked_cast<SerializedFile*>(contents_.get());
+  return file->GetPageIndexReader();
+}
+
+std::shared_ptr<BloomFilterReader> ParquetFileReader::GetBloomFilterReader() {
+  // Access private methods here
+  SerializedFile* file =
+      ::arrow::internal::checked_cast<SerializedFile*>(contents_.get());
+  return file->GetBloomFilterReader();
+}
+
 // ----------------------------------------------------------------------
 // File metadata helpers
 
@@ -31,6 +31,8 @@ namespace parquet {
 
 class ColumnReader;
 class FileMetaData;
+class BloomFilterReader;
+class PageIndexReader;
 class PageReader;
 class RandomAccessSource;
 class RowGroupMetaData;
@@ -118,6 +120,20 @@ class PARQUET_EXPORT ParquetFileReader {
   // Returns the file metadata. Only one instance is ever created
   std::shared_ptr<FileMetaData> metadata() const;
 
+  /// Returns a reader for the page index of the file (see page_index.h),
+  /// or null if no column chunk has one.
+  ///
+  /// The page index is stored apart from the column chunks and isn't
+  /// cached by PreBuffer().
+  std::shared_ptr<PageIndexReader> GetPageIndexReader();
+
+  /// Returns a reader for the Bloom filters of the file (see
+  /// bloom_filter_reader.h), or null if no column chunk has one.
+  ///
+  /// Like the page index, the Bloom filters are stored apart from the column
+  /// chunks and aren't cached by PreBuffer().
+  std::shared_ptr<BloomFilterReader> GetBloomFilterReader();
+
   /// Pre-buffer the specified column indices in all row groups.
   ///
   /// Readers can optionally call this to cache the necessary slices
@@ -135,12 +151,26 @@ class PARQUET_EXPORT ParquetFileReader {
   /// If memory usage is a concern, note that data will remain
   /// buffered in memory until either \a PreBuffer() is called again,
   /// or the reader itself is destructed. Reading - and buffering -
-  /// only one row group at a time may be useful.
+  /// only one row group at a time may be useful. Alternatively, setting
+  /// CacheOptions::buffer_limit bounds the amount of data buffered at a
+  /// time, column chunks then being fetched in file order and released
+  /// once read, so that each of them may only be read once.
   void PreBuffer(const std::vector<int>& row_groups,
                  const std::vector<int>& column_indices,
                  const ::arrow::io::AsyncContext& ctx,
                  const ::arrow::io::CacheOptions& options);
 
+  /// Wait for the specified row groups and column indices to be pre-buffered.
+  ///
+  /// After the returned Future completes, reading the specified row
+  /// groups/columns will not block.
+  ///
+  /// PreBuffer must be called first, and the row groups/columns must be a
+  /// subset of the pre-buffered ones. Like PreBuffer, this fetches right away
+  /// the column chunks held back by CacheOptions::buffer_limit.
+  ::arrow::Future<void> WhenBuffered(const std::vector<int>& row_groups,
+                                 const std::vector<int>& column_indices) const;
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -18,16 +18,20 @@
 #include "parquet/file_writer.h"
 
 #include <cstddef>
+#include <deque>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "parquet/bloom_filter.h"
 #include "parquet/column_writer.h"
 #include "parquet/deprecated_io.h"
 #include "parquet/encryption_internal.h"
 #include "parquet/exception.h"
 #include "parquet/internal_file_encryptor.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 #include "parquet/types.h"
@@ -77,13 +81,23 @@ inline void ThrowRowsMisMatchError(int col, int64_t prev, int64_t curr) {
 // ----------------------------------------------------------------------
 // RowGroupSerializer
 
+// The page index builders of the column chunks of a row group, null for the
+// columns whose page index isn't written
+using PageIndexBuilders = std::vector<std::unique_ptr<ColumnChunkPageIndexBuilder>>;
+
+// The Bloom filters of the column chunks of a row group, null for the columns
+// whose Bloom filter isn't written
+using BloomFilters = std::vector<std::unique_ptr<BloomFilter>>;
+
 // RowGroupWriter::Contents implementation for the Parquet file specification
 class RowGroupSerializer : public RowGroupWriter::Contents {
  public:
   RowGroupSerializer(std::shared_ptr<ArrowOutputStream> sink,
                      RowGroupMetaDataBuilder* metadata, int16_t row_group_ordinal,
                      const WriterProperties* properties, bool buffered_row_group = false,
-                     InternalFileEncryptor* file_encryptor = nullptr)
+                     InternalFileEncryptor* file_encryptor = nullptr,
+                     PageIndexBuilders* page_index_builders = nullptr,
+                     BloomFilters* bloom_filters = nullptr)
       : sink_(std::move(sink)),
         metadata_(metadata),
         properties_(properties),
@@ -93,7 +107,9 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
         next_column_index_(0),
         num_rows_(0),
         buffered_row_group_(buffered_row_group),
-        file_encryptor_(file_encryptor) {
+        file_encryptor_(file_encryptor),
+        page_index_builders_(page_index_builders),
+        bloom_filters_(bloom_filters) {
     if (buffered_row_group) {
       InitColumns();
     } else {
@@ -135,11 +151,17 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
     auto data_encryptor =
         file_encryptor_ ? file_encryptor_->GetColumnDataEncryptor(path->ToDotString())
                         : nullptr;
+    auto page_index_builder =
+        MakePageIndexBuilder(*col_meta->descr(), meta_encryptor || data_encryptor);
     std::unique_ptr<PageWriter> pager = PageWriter::Open(
         sink_, properties_->compression(path), properties_->compression_level(path),
         col_meta, row_group_ordinal_, static_cast<int16_t>(next_column_index_ - 1),
-        properties_->memory_pool(), false, meta_encryptor, data_encryptor);
-    column_writers_[0] = ColumnWriter::Make(col_meta, std::move(pager), properties_);
+        properties_->memory_pool(), false, meta_encryptor, data_encryptor,
+        page_index_builder);
+    auto bloom_filter =
+        MakeBloomFilter(*col_meta->descr(), meta_encryptor || data_encryptor);
+    column_writers_[0] =
+        ColumnWriter::Make(col_meta, std::move(pager), properties_, bloom_filter);
     return column_writers_[0].get();
   }
 
@@ -208,6 +230,47 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
   mutable int64_t num_rows_;
   bool buffered_row_group_;
   InternalFileEncryptor* file_encryptor_;
+  PageIndexBuilders* page_index_builders_;
+  BloomFilters* bloom_filters_;
+
+  // Return the page index builder of the next column, or null if the page index
+  // isn't written for the column
+  ColumnChunkPageIndexBuilder* MakePageIndexBuilder(const ColumnDescriptor& descr,
+                                                    bool encrypted) {
+    if (page_index_builders_ == nullptr) {
+      return nullptr;
+    }
+    // The pages of repeated columns may not start at row boundaries, and the
+    // page index of encrypted columns would have to be encrypted too
+    std::unique_ptr<ColumnChunkPageIndexBuilder> builder;
+    if (descr.max_repetition_level() == 0 && !encrypted) {
+      builder.reset(new ColumnChunkPageIndexBuilder());
+    }
+    page_index_builders_->push_back(std::move(builder));
+    return page_index_builders_->back().get();
+  }
+
+  // Return the Bloom filter of the next column, or null if it isn't written
+  // for the column
+  BloomFilter* MakeBloomFilter(const ColumnDescriptor& descr, bool encrypted) {
+    if (bloom_filters_ == nullptr) {
+      return nullptr;
+    }
+    // A Bloom filter would disclose the values of encrypted columns
+    std::unique_ptr<BloomFilter> bloom_filter;
+    if (properties_->bloom_filter_enabled(descr.path()) &&
+        descr.physical_type() != Type::BOOLEAN && !encrypted) {
+      const auto& options = properties_->bloom_filter_options(descr.path());
+      const uint32_t num_bits = BlockSplitBloomFilter::OptimalNumOfBits(
+          static_cast<uint32_t>(options.ndv), options.fpp);
+      std::unique_ptr<BlockSplitBloomFilter> block_split(
+          new BlockSplitBloomFilter(BloomFilter::HashStrategy::XXHASH));
+      block_split->Init(num_bits / 8);
+      bloom_filter = std::move(block_split);
+    }
+    bloom_filters_->push_back(std::move(bloom_filter));
+    return bloom_filters_->back().get();
+  }
 
   void CheckRowsWritten() const {
     // verify when only one column is written at a time
@@ -241,13 +304,17 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
       auto data_encryptor =
           file_encryptor_ ? file_encryptor_->GetColumnDataEncryptor(path->ToDotString())
                           : nullptr;
+      auto page_index_builder =
+          MakePageIndexBuilder(*col_meta->descr(), meta_encryptor || data_encryptor);
       std::unique_ptr<PageWriter> pager = PageWriter::Open(
           sink_, properties_->compression(path), properties_->compression_level(path),
           col_meta, static_cast<int16_t>(row_group_ordinal_),
           static_cast<int16_t>(next_column_index_++), properties_->memory_pool(),
-          buffered_row_group_, meta_encryptor, data_encryptor);
+          buffered_row_group_, meta_encryptor, data_encryptor, page_index_builder);
+      auto bloom_filter =
+          MakeBloomFilter(*col_meta->descr(), meta_encryptor || data_encryptor);
       column_writers_.push_back(
-          ColumnWriter::Make(col_meta, std::move(pager), properties_));
+          ColumnWriter::Make(col_meta, std::move(pager), properties_, bloom_filter));
     }
   }
 
@@ -284,6 +351,13 @@ class FileSerializer : public ParquetFileWriter::Contents {
       }
       row_group_writer_.reset();
 
+      if (properties_->write_page_index()) {
+        WritePageIndex();
+      }
+      if (write_bloom_filters_) {
+        WriteBloomFilters();
+      }
+
       // Write magic bytes and metadata
       auto file_encryption_properties = properties_->file_encryption_properties();
 
@@ -312,9 +386,20 @@ class FileSerializer : public ParquetFileWriter::Contents {
     }
     num_row_groups_++;
     auto rg_metadata = metadata_->AppendRowGroup();
+    PageIndexBuilders* page_index_builders = nullptr;
+    if (properties_->write_page_index()) {
+      page_index_builders_.emplace_back();
+      page_index_builders = &page_index_builders_.back();
+    }
+    BloomFilters* bloom_filters = nullptr;
+    if (write_bloom_filters_) {
+      bloom_filters_.emplace_back();
+      bloom_filters = &bloom_filters_.back();
+    }
     std::unique_ptr<RowGroupWriter::Contents> contents(new RowGroupSerializer(
         sink_, rg_metadata, static_cast<int16_t>(num_row_groups_ - 1), properties_.get(),
-        buffered_row_group, file_encryptor_.get()));
+        buffered_row_group, file_encryptor_.get(), page_index_builders,
+        bloom_filters));
     row_group_writer_.reset(new RowGroupWriter(std::move(contents)));
     return row_group_writer_.get();
   }
@@ -341,7 +426,13 @@ class FileSerializer : public ParquetFileWriter::Contents {
         properties_(std::move(properties)),
         num_row_groups_(0),
         num_rows_(0),
-        metadata_(FileMetaDataBuilder::Make(&schema_, properties_, key_value_metadata_)) {
+        metadata_(FileMetaDataBuilder::Make(&schema_, properties_, key_value_metadata_)),
+        write_bloom_filters_(false) {
+    for (int i = 0; i < schema_.num_columns(); ++i) {
+      if (properties_->bloom_filter_enabled(schema_.Column(i)->path())) {
+        write_bloom_filters_ = true;
+      }
+    }
     if (sink_->Tell().ValueOrDie() == 0) {
       StartFile();
     } else {
@@ -389,6 +480,57 @@ class FileSerializer : public ParquetFileWriter::Contents {
 
   std::unique_ptr<InternalFileEncryptor> file_encryptor_;
 
+  // The page index builders of each row group. A deque doesn't move its
+  // elements, which the active row group writer appends to.
+  std::deque<PageIndexBuilders> page_index_builders_;
+
+  // Whether some column has a Bloom filter, and the Bloom filters of each row
+  // group, kept like the page index builders
+  bool write_bloom_filters_;
+  std::deque<BloomFilters> bloom_filters_;
+
+  // Write the ColumnIndex of all column chunks, then their OffsetIndex, as
+  // other Parquet implementations do
+  void WritePageIndex() {
+    for (int row_group = 0; row_group < num_row_groups_; ++row_group) {
+      const auto& builders = page_index_builders_[row_group];
+      for (int column = 0; column < static_cast<int>(builders.size()); ++column) {
+        if (builders[column] != nullptr && builders[column]->has_column_index()) {
+          PARQUET_ASSIGN_OR_THROW(int64_t start, sink_->Tell());
+          builders[column]->WriteColumnIndex(sink_.get());
+          PARQUET_ASSIGN_OR_THROW(int64_t end, sink_->Tell());
+          metadata_->SetColumnIndexLocation(row_group, column, start,
+                                            static_cast<int32_t>(end - start));
+        }
+      }
+    }
+    for (int row_group = 0; row_group < num_row_groups_; ++row_group) {
+      const auto& builders = page_index_builders_[row_group];
+      for (int column = 0; column < static_cast<int>(builders.size()); ++column) {
+        if (builders[column] != nullptr) {
+          PARQUET_ASSIGN_OR_THROW(int64_t start, sink_->Tell());
+          builders[column]->WriteOffsetIndex(sink_.get());
+          PARQUET_ASSIGN_OR_THROW(int64_t end, sink_->Tell());
+          metadata_->SetOffsetIndexLocation(row_group, column, start,
+                                            static_cast<int32_t>(end - start));
+        }
+      }
+    }
+  }
+
+  void WriteBloomFilters() {
+    for (int row_group = 0; row_group < num_row_groups_; ++row_group) {
+      const auto& bloom_filters = bloom_filters_[row_group];
+      for (int column = 0; column < static_cast<int>(bloom_filters.size()); ++column) {
+        if (bloom_filters[column] != nullptr) {
+          PARQUET_ASSIGN_OR_THROW(int64_t offset, sink_->Tell());
+          bloom_filters[column]->WriteTo(sink_.get());
+          metadata_->SetBloomFilterOffset(row_group, column, offset);
+        }
+      }
+    }
+  }
+
   void StartFile() {
     auto file_encryption_properties = properties_->file_encryption_properties();
     if (file_encryption_properties == nullptr) {
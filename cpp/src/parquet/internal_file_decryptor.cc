@@ -35,9 +35,14 @@ int Decryptor::CiphertextSizeDelta() { return aes_decryptor_->CiphertextSizeDelt
 
 int Decryptor::Decrypt(const uint8_t* ciphertext, int ciphertext_len,
                        uint8_t* plaintext) {
+  return Decrypt(ciphertext, ciphertext_len, plaintext, aad_);
+}
+
+int Decryptor::Decrypt(const uint8_t* ciphertext, int ciphertext_len, uint8_t* plaintext,
+                       const std::string& aad) {
   return aes_decryptor_->Decrypt(ciphertext, ciphertext_len, str2bytes(key_),
-                                 static_cast<int>(key_.size()), str2bytes(aad_),
-                                 static_cast<int>(aad_.size()), plaintext);
+                                 static_cast<int>(key_.size()), str2bytes(aad),
+                                 static_cast<int>(aad.size()), plaintext);
 }
 
 // InternalFileDecryptor
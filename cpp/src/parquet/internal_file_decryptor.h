@@ -45,6 +45,10 @@ class PARQUET_EXPORT Decryptor {
 
   int CiphertextSizeDelta();
   int Decrypt(const uint8_t* ciphertext, int ciphertext_len, uint8_t* plaintext);
+  /// Decrypt with the given AAD rather than the one set by UpdateAad().
+  /// Unlike the above, may be called concurrently.
+  int Decrypt(const uint8_t* ciphertext, int ciphertext_len, uint8_t* plaintext,
+              const std::string& aad);
 
  private:
   encryption::AesDecryptor* aes_decryptor_;
@@ -170,6 +170,31 @@ void DefinitionLevelsToBitmapLittleEndian(
   }
 }
 
+// Appends the lists started by the level at def_level/rep_level.
+inline void AppendListLevel(int16_t def_level, int16_t rep_level, int32_t values_offset,
+                            const std::vector<int16_t>& empty_def_levels,
+                            const std::vector<bool>& nullable,
+                            std::vector<ListLevelOutput>* lists) {
+  const int list_depth = static_cast<int>(lists->size());
+  for (int j = rep_level; j < list_depth; ++j) {
+    ListLevelOutput& list = (*lists)[j];
+    list.offsets[list.length] = j == list_depth - 1
+                                    ? values_offset
+                                    : static_cast<int32_t>((*lists)[j + 1].length);
+    if (nullable[j] && def_level == empty_def_levels[j] - 1) {
+      ::arrow::BitUtil::ClearBit(list.valid_bits, list.length);
+      ++list.null_count;
+      ++list.length;
+      break;
+    }
+    ::arrow::BitUtil::SetBit(list.valid_bits, list.length);
+    ++list.length;
+    if (def_level == empty_def_levels[j]) {
+      break;
+    }
+  }
+}
+
 }  // namespace
 
 void DefinitionLevelsToBitmap(const int16_t* def_levels, int64_t num_def_levels,
@@ -190,5 +215,62 @@ void DefinitionLevelsToBitmap(const int16_t* def_levels, int64_t num_def_levels,
 #endif
 }
 
+void DefRepLevelsToListOffsets(const int16_t* def_levels, const int16_t* rep_levels,
+                               int64_t num_levels, int16_t values_def_level,
+                               const std::vector<int16_t>& empty_def_levels,
+                               const std::vector<bool>& nullable,
+                               std::vector<ListLevelOutput>* lists) {
+  DCHECK_GT(lists->size(), 0);
+  DCHECK_EQ(lists->size(), empty_def_levels.size());
+  DCHECK_EQ(lists->size(), nullable.size());
+  const auto inner_rep_level = static_cast<int16_t>(lists->size() - 1);
+  ListLevelOutput& inner_list = lists->back();
+
+  int32_t values_offset = 0;
+  int64_t i = 0;
+  while (i < num_levels) {
+#if defined(ARROW_LITTLE_ENDIAN)
+    constexpr int64_t kBatchSize = 64;
+    if (num_levels - i >= kBatchSize) {
+      // If every level in the batch has a leaf slot and at most starts a new
+      // innermost list, the batch only adds innermost offsets, which are the
+      // positions of the new lists within the batch.
+      const uint64_t present =
+          GreaterThanBitmap(def_levels + i, kBatchSize, values_def_level - 1);
+      const uint64_t inner_only =
+          GreaterThanBitmap(rep_levels + i, kBatchSize, inner_rep_level - 1);
+      if (present == ~uint64_t{0} && inner_only == ~uint64_t{0}) {
+        uint64_t starts =
+            ~GreaterThanBitmap(rep_levels + i, kBatchSize, inner_rep_level);
+        while (starts != 0) {
+          inner_list.offsets[inner_list.length] =
+              values_offset + ::arrow::BitUtil::CountTrailingZeros(starts);
+          ::arrow::BitUtil::SetBit(inner_list.valid_bits, inner_list.length);
+          ++inner_list.length;
+          starts &= starts - 1;
+        }
+        values_offset += static_cast<int32_t>(kBatchSize);
+        i += kBatchSize;
+        continue;
+      }
+    }
+#endif
+    AppendListLevel(def_levels[i], rep_levels[i], values_offset, empty_def_levels,
+                    nullable, lists);
+    if (def_levels[i] >= values_def_level) {
+      ++values_offset;
+    }
+    ++i;
+  }
+
+  // Add the final offset to all lists
+  for (size_t j = 0; j < lists->size(); ++j) {
+    ListLevelOutput& list = (*lists)[j];
+    list.offsets[list.length] = j == lists->size() - 1
+                                    ? values_offset
+                                    : static_cast<int32_t>((*lists)[j + 1].length);
+  }
+}
+
 }  // namespace internal
 }  // namespace parquet
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
 #include "parquet/platform.h"
 #include "parquet/schema.h"
@@ -137,6 +138,35 @@ void PARQUET_EXPORT DefinitionLevelsToBitmap(
     const int16_t max_repetition_level, int64_t* values_read, int64_t* null_count,
     uint8_t* valid_bits, int64_t valid_bits_offset);
 
+/// \brief Offsets and validity bitmap of the lists at one nesting depth.
+struct ListLevelOutput {
+  /// Output offsets.  Must have room for num_levels + 1 entries.
+  int32_t* offsets;
+  /// Output validity bitmap.  Must have room for num_levels bits.
+  uint8_t* valid_bits;
+  /// Number of lists written (the offsets contain one more entry).
+  int64_t length = 0;
+  int64_t null_count = 0;
+};
+
+/// \brief Reconstruct the offsets and validity bitmaps of nested lists from
+/// definition and repetition levels.
+///
+/// \param[in] def_levels, rep_levels, num_levels The levels of the leaf column.
+/// \param[in] values_def_level The minimal definition level of a level that has
+/// a slot in the leaf values array.
+/// \param[in] empty_def_levels For each depth (outermost first), the definition
+/// level of a list which is present but empty.
+/// \param[in] nullable For each depth, whether lists at that depth may be null.
+/// \param[in, out] lists For each depth, where to write the output.
+///
+/// Runs of levels which only continue or start innermost lists with all leaf
+/// slots present are handled 64 levels at a time.
+void PARQUET_EXPORT DefRepLevelsToListOffsets(
+    const int16_t* def_levels, const int16_t* rep_levels, int64_t num_levels,
+    int16_t values_def_level, const std::vector<int16_t>& empty_def_levels,
+    const std::vector<bool>& nullable, std::vector<ListLevelOutput>* lists);
+
 // These APIs are likely to be revised as part of ARROW-8494 to reduce duplicate code.
 // They currently represent minimal functionality for vectorized computation of definition
 // levels.
@@ -76,3 +76,28 @@ void BM_DefinitionLevelsToBitmapRepeatedMostPresent(::benchmark::State& state) {
 }
 
 BENCHMARK(BM_DefinitionLevelsToBitmapRepeatedMostPresent);
+
+void BM_DefRepLevelsToListOffsets(::benchmark::State& state) {
+  // Lists of state.range(0) present values.
+  std::vector<int16_t> def_levels(/*count=*/kLevelCount, kPresentDefLevel);
+  std::vector<int16_t> rep_levels(/*count=*/kLevelCount, kHasRepeatedElements);
+  for (size_t x = 0; x < rep_levels.size(); x += state.range(0)) {
+    rep_levels[x] = 0;
+  }
+  std::vector<int32_t> offsets(kLevelCount + 1);
+  std::vector<uint8_t> valid_bits(kLevelCount / 8);
+  std::vector<parquet::internal::ListLevelOutput> lists(1);
+  for (auto _ : state) {
+    lists[0].offsets = offsets.data();
+    lists[0].valid_bits = valid_bits.data();
+    lists[0].length = 0;
+    parquet::internal::DefRepLevelsToListOffsets(
+        def_levels.data(), rep_levels.data(), kLevelCount,
+        /*values_def_level=*/kPresentDefLevel, /*empty_def_levels=*/{1},
+        /*nullable=*/{true}, &lists);
+  }
+  ::benchmark::DoNotOptimize(offsets);
+  state.SetBytesProcessed(int64_t(state.iterations()) * kLevelCount);
+}
+
+BENCHMARK(BM_DefRepLevelsToListOffsets)->Arg(1)->Arg(4)->Arg(32);
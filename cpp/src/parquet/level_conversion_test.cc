@@ -25,6 +25,7 @@
 
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap.h"
+#include "arrow/util/bitmap_ops.h"
 
 namespace parquet {
 namespace internal {
@@ -126,5 +127,73 @@ TEST(DefinitionLevelsToBitmap, WithRepetitionLevelFiltersOutEmptyListValues) {
   EXPECT_EQ(values_read, 4);  // value should get overwritten.
 }
 
+TEST(DefRepLevelsToListOffsets, NestedNullableLists) {
+  // list<list<int32 not null>> where both lists are nullable:
+  // [[[1, 2], null, []], null, [], [[3]]]
+  std::vector<int16_t> def_levels = {4, 4, 2, 3, 0, 1, 4};
+  std::vector<int16_t> rep_levels = {0, 2, 1, 1, 0, 0, 0};
+
+  std::vector<int32_t> outer_offsets(def_levels.size() + 1);
+  std::vector<int32_t> inner_offsets(def_levels.size() + 1);
+  std::vector<uint8_t> outer_valid_bits(1, 0);
+  std::vector<uint8_t> inner_valid_bits(1, 0);
+  std::vector<ListLevelOutput> lists(2);
+  lists[0].offsets = outer_offsets.data();
+  lists[0].valid_bits = outer_valid_bits.data();
+  lists[1].offsets = inner_offsets.data();
+  lists[1].valid_bits = inner_valid_bits.data();
+
+  DefRepLevelsToListOffsets(def_levels.data(), rep_levels.data(), def_levels.size(),
+                            /*values_def_level=*/4, /*empty_def_levels=*/{1, 3},
+                            /*nullable=*/{true, true}, &lists);
+
+  ASSERT_EQ(lists[0].length, 4);
+  EXPECT_EQ(lists[0].null_count, 1);
+  EXPECT_THAT(outer_offsets, ElementsAreArray({0, 3, 3, 3, 4, 0, 0, 0}));
+  EXPECT_EQ(BitmapToString(outer_valid_bits, 4), "1011");
+
+  ASSERT_EQ(lists[1].length, 4);
+  EXPECT_EQ(lists[1].null_count, 1);
+  EXPECT_THAT(inner_offsets, ElementsAreArray({0, 2, 2, 2, 3, 0, 0, 0}));
+  EXPECT_EQ(BitmapToString(inner_valid_bits, 4), "1011");
+}
+
+TEST(DefRepLevelsToListOffsets, DenseRunsMixedWithEmptyLists) {
+  // list<int32> with a nullable list and nullable values: lists of three
+  // values, with every thirtieth list empty and every seventh value null.
+  const int num_lists = 200;
+  std::vector<int16_t> def_levels;
+  std::vector<int16_t> rep_levels;
+  std::vector<int32_t> expected_offsets = {0};
+  for (int i = 0; i < num_lists; ++i) {
+    if (i % 30 == 29) {
+      def_levels.push_back(1);
+      rep_levels.push_back(0);
+    } else {
+      for (int j = 0; j < 3; ++j) {
+        def_levels.push_back(def_levels.size() % 7 == 0 ? 2 : 3);
+        rep_levels.push_back(j == 0 ? 0 : 1);
+      }
+    }
+    expected_offsets.push_back(expected_offsets.back() + (i % 30 == 29 ? 0 : 3));
+  }
+
+  std::vector<int32_t> offsets(def_levels.size() + 1);
+  std::vector<uint8_t> valid_bits(arrow::BitUtil::BytesForBits(def_levels.size()), 0);
+  std::vector<ListLevelOutput> lists(1);
+  lists[0].offsets = offsets.data();
+  lists[0].valid_bits = valid_bits.data();
+
+  DefRepLevelsToListOffsets(def_levels.data(), rep_levels.data(), def_levels.size(),
+                            /*values_def_level=*/2, /*empty_def_levels=*/{1},
+                            /*nullable=*/{true}, &lists);
+
+  ASSERT_EQ(lists[0].length, num_lists);
+  EXPECT_EQ(lists[0].null_count, 0);
+  offsets.resize(num_lists + 1);
+  EXPECT_THAT(offsets, ElementsAreArray(expected_offsets));
+  EXPECT_EQ(arrow::internal::CountSetBits(valid_bits.data(), 0, num_lists), num_lists);
+}
+
 }  // namespace internal
 }  // namespace parquet
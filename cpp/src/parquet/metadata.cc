@@ -20,6 +20,7 @@
 #include <inttypes.h>
 
 #include <algorithm>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -310,6 +311,30 @@ class ColumnChunkMetaData::ColumnChunkMetaDataImpl {
     return column_metadata_->total_compressed_size;
   }
 
+  inline bool has_column_index() const {
+    return column_->__isset.column_index_offset && column_->__isset.column_index_length;
+  }
+
+  inline int64_t column_index_offset() const { return column_->column_index_offset; }
+
+  inline int32_t column_index_length() const { return column_->column_index_length; }
+
+  inline bool has_offset_index() const {
+    return column_->__isset.offset_index_offset && column_->__isset.offset_index_length;
+  }
+
+  inline int64_t offset_index_offset() const { return column_->offset_index_offset; }
+
+  inline int32_t offset_index_length() const { return column_->offset_index_length; }
+
+  inline bool has_bloom_filter() const {
+    return column_metadata_->__isset.bloom_filter_offset;
+  }
+
+  inline int64_t bloom_filter_offset() const {
+    return column_metadata_->bloom_filter_offset;
+  }
+
   inline int64_t total_uncompressed_size() const {
     return column_metadata_->total_uncompressed_size;
   }
@@ -417,17 +442,97 @@ std::unique_ptr<ColumnCryptoMetaData> ColumnChunkMetaData::crypto_metadata() con
   return impl_->crypto_metadata();
 }
 
+bool ColumnChunkMetaData::has_column_index() const { return impl_->has_column_index(); }
+
+int64_t ColumnChunkMetaData::column_index_offset() const {
+  return impl_->column_index_offset();
+}
+
+int32_t ColumnChunkMetaData::column_index_length() const {
+  return impl_->column_index_length();
+}
+
+bool ColumnChunkMetaData::has_offset_index() const { return impl_->has_offset_index(); }
+
+int64_t ColumnChunkMetaData::offset_index_offset() const {
+  return impl_->offset_index_offset();
+}
+
+int32_t ColumnChunkMetaData::offset_index_length() const {
+  return impl_->offset_index_length();
+}
+
+bool ColumnChunkMetaData::has_bloom_filter() const { return impl_->has_bloom_filter(); }
+
+int64_t ColumnChunkMetaData::bloom_filter_offset() const {
+  return impl_->bloom_filter_offset();
+}
+
 // row-group metadata
+// A row group of a file footer whose column chunks are deserialized on first
+// access, so that opening a wide file only pays for the columns that are read.
+class LazyRowGroup {
+ public:
+  // Field id of RowGroup.columns in parquet.thrift
+  static constexpr int16_t kColumnsFieldId = 1;
+
+  // Deserialize row_group from the data/len bytes of the footer, except for its
+  // column chunks which are left default constructed. The bytes must outlive
+  // this object.
+  LazyRowGroup(const uint8_t* data, uint32_t len, format::RowGroup* row_group)
+      : data_(data), row_group_(row_group) {
+    std::string row_group_bytes =
+        ScanThriftListField(data, &len, kColumnsFieldId, &column_ranges_);
+    uint32_t row_group_len = static_cast<uint32_t>(row_group_bytes.size());
+    DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(row_group_bytes.data()),
+                         &row_group_len, row_group);
+    row_group->columns.resize(column_ranges_.size());
+    column_decoded_.resize(column_ranges_.size(), false);
+  }
+
+  const format::ColumnChunk* ColumnChunk(int i) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    DecodeColumnChunk(i);
+    return &row_group_->columns[i];
+  }
+
+  void DecodeAll() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (int i = 0; i < static_cast<int>(column_ranges_.size()); ++i) {
+      DecodeColumnChunk(i);
+    }
+  }
+
+ private:
+  void DecodeColumnChunk(int i) {
+    if (column_decoded_[i]) {
+      return;
+    }
+    uint32_t len = column_ranges_[i].second;
+    DeserializeThriftMsg(data_ + column_ranges_[i].first, &len,
+                         &row_group_->columns[i]);
+    column_decoded_[i] = true;
+  }
+
+  const uint8_t* data_;
+  format::RowGroup* row_group_;
+  std::vector<std::pair<uint32_t, uint32_t>> column_ranges_;
+  std::vector<bool> column_decoded_;
+  std::mutex mutex_;
+};
+
 class RowGroupMetaData::RowGroupMetaDataImpl {
  public:
   explicit RowGroupMetaDataImpl(const format::RowGroup* row_group,
                                 const SchemaDescriptor* schema,
                                 const ApplicationVersion* writer_version,
-                                std::shared_ptr<InternalFileDecryptor> file_decryptor)
+                                std::shared_ptr<InternalFileDecryptor> file_decryptor,
+                                LazyRowGroup* lazy_row_group = NULLPTR)
       : row_group_(row_group),
         schema_(schema),
         writer_version_(writer_version),
-        file_decryptor_(file_decryptor) {}
+        file_decryptor_(file_decryptor),
+        lazy_row_group_(lazy_row_group) {}
 
   inline int num_columns() const { return static_cast<int>(row_group_->columns.size()); }
 
@@ -450,9 +555,11 @@ class RowGroupMetaData::RowGroupMetaDataImpl {
          << " columns, requested metadata for column: " << i;
       throw ParquetException(ss.str());
     }
-    return ColumnChunkMetaData::Make(&row_group_->columns[i], schema_->Column(i),
-                                     writer_version_, row_group_->ordinal, (int16_t)i,
-                                     file_decryptor_);
+    const format::ColumnChunk* column_chunk = lazy_row_group_ != NULLPTR
+                                                  ? lazy_row_group_->ColumnChunk(i)
+                                                  : &row_group_->columns[i];
+    return ColumnChunkMetaData::Make(column_chunk, schema_->Column(i), writer_version_,
+                                     row_group_->ordinal, (int16_t)i, file_decryptor_);
   }
 
  private:
@@ -460,6 +567,7 @@ class RowGroupMetaData::RowGroupMetaDataImpl {
   const SchemaDescriptor* schema_;
   const ApplicationVersion* writer_version_;
   std::shared_ptr<InternalFileDecryptor> file_decryptor_;
+  LazyRowGroup* lazy_row_group_;
 };
 
 std::unique_ptr<RowGroupMetaData> RowGroupMetaData::Make(
@@ -477,6 +585,9 @@ RowGroupMetaData::RowGroupMetaData(const void* metadata, const SchemaDescriptor*
           new RowGroupMetaDataImpl(reinterpret_cast<const format::RowGroup*>(metadata),
                                    schema, writer_version, file_decryptor))} {}
 
+RowGroupMetaData::RowGroupMetaData(std::unique_ptr<RowGroupMetaDataImpl> impl)
+    : impl_(std::move(impl)) {}
+
 RowGroupMetaData::~RowGroupMetaData() {}
 
 int RowGroupMetaData::num_columns() const { return impl_->num_columns(); }
@@ -517,8 +628,27 @@ class FileMetaData::FileMetaDataImpl {
     auto footer_decryptor =
         file_decryptor_ != nullptr ? file_decryptor->GetFooterDecryptor() : nullptr;
 
-    DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(metadata), metadata_len,
-                         metadata_.get(), footer_decryptor);
+    // Keep a copy of the (decrypted) footer and leave the row groups undecoded,
+    // they are deserialized on first access
+    const uint8_t* footer = reinterpret_cast<const uint8_t*>(metadata);
+    uint32_t footer_len = *metadata_len;
+    std::shared_ptr<ResizableBuffer> decrypted_footer;
+    if (footer_decryptor != nullptr) {
+      decrypted_footer =
+          DecryptThriftMsg(footer, metadata_len, &footer_len, footer_decryptor);
+      footer = decrypted_footer->data();
+    }
+    std::string metadata_bytes =
+        ScanThriftListField(footer, &footer_len, kRowGroupsFieldId, &row_group_ranges_);
+    if (footer_decryptor == nullptr) {
+      *metadata_len = footer_len;
+    }
+    footer_.assign(reinterpret_cast<const char*>(footer), footer_len);
+    uint32_t metadata_bytes_len = static_cast<uint32_t>(metadata_bytes.size());
+    DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(metadata_bytes.data()),
+                         &metadata_bytes_len, metadata_.get());
+    metadata_->row_groups.resize(row_group_ranges_.size());
+    lazy_row_groups_.resize(row_group_ranges_.size());
     metadata_len_ = *metadata_len;
 
     if (metadata_->__isset.created_by) {
@@ -537,11 +667,9 @@ class FileMetaData::FileMetaDataImpl {
     if (file_decryptor_ == nullptr) {
       throw ParquetException("Decryption not set properly. cannot verify signature");
     }
-    // serialize the footer
-    uint8_t* serialized_data;
-    uint32_t serialized_len = metadata_len_;
-    ThriftSerializer serializer;
-    serializer.SerializeToBuffer(metadata_.get(), &serialized_len, &serialized_data);
+    // the plaintext footer is kept as read, no need to serialize it again
+    const uint8_t* serialized_data = reinterpret_cast<const uint8_t*>(footer_.data());
+    uint32_t serialized_len = static_cast<uint32_t>(footer_.size());
 
     // encrypt with nonce
     uint8_t* nonce = const_cast<uint8_t*>(reinterpret_cast<const uint8_t*>(signature));
@@ -595,6 +723,7 @@ class FileMetaData::FileMetaDataImpl {
 
   void WriteTo(::arrow::io::OutputStream* dst,
                const std::shared_ptr<Encryptor>& encryptor) const {
+    DecodeAllRowGroups();
     ThriftSerializer serializer;
     // Only in encrypted files with plaintext footers the
     // encryption_algorithm is set in footer
@@ -630,8 +759,13 @@ class FileMetaData::FileMetaDataImpl {
          << " row groups, requested metadata for row group: " << i;
       throw ParquetException(ss.str());
     }
-    return RowGroupMetaData::Make(&metadata_->row_groups[i], &schema_, &writer_version_,
-                                  file_decryptor_);
+    LazyRowGroup* lazy_row_group = DecodeRowGroup(i);
+    return std::unique_ptr<RowGroupMetaData>(
+        new RowGroupMetaData(std::unique_ptr<RowGroupMetaData::RowGroupMetaDataImpl>(
+            new RowGroupMetaData::RowGroupMetaDataImpl(&metadata_->row_groups[i],
+                                                       &schema_, &writer_version_,
+                                                       file_decryptor_,
+                                                       lazy_row_group))));
   }
 
   const SchemaDescriptor* schema() const { return &schema_; }
@@ -641,6 +775,7 @@ class FileMetaData::FileMetaDataImpl {
   }
 
   void set_file_path(const std::string& path) {
+    DecodeAllRowGroups();
     for (format::RowGroup& row_group : metadata_->row_groups) {
       for (format::ColumnChunk& chunk : row_group.columns) {
         chunk.__set_file_path(path);
@@ -650,6 +785,10 @@ class FileMetaData::FileMetaDataImpl {
 
   format::RowGroup& row_group(int i) {
     DCHECK_LT(i, num_row_groups());
+    LazyRowGroup* lazy_row_group = DecodeRowGroup(i);
+    if (lazy_row_group != nullptr) {
+      lazy_row_group->DecodeAll();
+    }
     return metadata_->row_groups[i];
   }
 
@@ -658,6 +797,10 @@ class FileMetaData::FileMetaDataImpl {
       throw ParquetException("AppendRowGroups requires equal schemas.");
     }
 
+    // Appending may reallocate the row groups, so stop decoding them lazily
+    DecodeAllRowGroups();
+    row_group_ranges_.clear();
+    std::string().swap(footer_);
     format::RowGroup other_rg;
     for (int i = 0; i < other->num_row_groups(); i++) {
       other_rg = other->row_group(i);
@@ -672,6 +815,9 @@ class FileMetaData::FileMetaDataImpl {
 
  private:
   friend FileMetaDataBuilder;
+  // Field id of FileMetaData.row_groups in parquet.thrift
+  static constexpr int16_t kRowGroupsFieldId = 4;
+
   uint32_t metadata_len_;
   std::unique_ptr<format::FileMetaData> metadata_;
   SchemaDescriptor schema_;
@@ -679,6 +825,38 @@ class FileMetaData::FileMetaDataImpl {
   std::shared_ptr<const KeyValueMetadata> key_value_metadata_;
   std::shared_ptr<InternalFileDecryptor> file_decryptor_;
 
+  // Plaintext footer and the byte ranges of its row groups, which are only
+  // deserialized when they are accessed
+  std::string footer_;
+  std::vector<std::pair<uint32_t, uint32_t>> row_group_ranges_;
+  mutable std::vector<std::unique_ptr<LazyRowGroup>> lazy_row_groups_;
+  mutable std::mutex lazy_row_groups_mutex_;
+
+  // Return the lazily decoded row group i, deserializing it first if needed, or
+  // null if the row group was not read from a footer.
+  LazyRowGroup* DecodeRowGroup(int i) const {
+    if (i >= static_cast<int>(row_group_ranges_.size())) {
+      return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(lazy_row_groups_mutex_);
+    std::unique_ptr<LazyRowGroup>& lazy_row_group = lazy_row_groups_[i];
+    if (lazy_row_group == nullptr) {
+      const auto& range = row_group_ranges_[i];
+      lazy_row_group.reset(
+          new LazyRowGroup(reinterpret_cast<const uint8_t*>(footer_.data()) + range.first,
+                           range.second, &metadata_->row_groups[i]));
+    }
+    return lazy_row_group.get();
+  }
+
+  // Deserialize everything that was left undecoded, before the thrift metadata
+  // is serialized or modified as a whole.
+  void DecodeAllRowGroups() const {
+    for (int i = 0; i < static_cast<int>(row_group_ranges_.size()); ++i) {
+      DecodeRowGroup(i)->DecodeAll();
+    }
+  }
+
   void InitSchema() {
     if (metadata_->schema.empty()) {
       throw ParquetException("Empty file schema (no root)");
@@ -1042,14 +1220,24 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
       } else {
         thrift_encodings.push_back(ToThrift(properties_->dictionary_page_encoding()));
       }
+    } else if (!data_encoding_stats.empty()) {
+      // Dictionary not enabled, or not chosen by adaptive encoding
+      for (const auto& entry : data_encoding_stats) {
+        thrift_encodings.push_back(ToThrift(entry.first));
+      }
     } else {  // Dictionary not enabled
       thrift_encodings.push_back(ToThrift(properties_->encoding(column_->path())));
     }
     thrift_encodings.push_back(ToThrift(Encoding::RLE));
-    // Only PLAIN encoding is supported for fallback in V1
-    // TODO(majetideepak): Use user specified encoding for V2
+    // The data pages written after falling back from dictionary encoding use
+    // the non-dictionary encoding recorded in the data page stats
     if (dictionary_fallback) {
-      thrift_encodings.push_back(ToThrift(Encoding::PLAIN));
+      for (const auto& entry : data_encoding_stats) {
+        if (entry.first != Encoding::PLAIN_DICTIONARY &&
+            entry.first != Encoding::RLE_DICTIONARY) {
+          thrift_encodings.push_back(ToThrift(entry.first));
+        }
+      }
     }
     column_chunk_->meta_data.__set_encodings(thrift_encodings);
     std::vector<format::PageEncodingStats> thrift_encoding_stats;
@@ -1345,6 +1533,33 @@ class FileMetaDataBuilder::FileMetaDataBuilderImpl {
     return current_row_group_builder_.get();
   }
 
+  format::ColumnChunk* GetColumnChunk(int row_group, int column) {
+    if (row_group < 0 || row_group >= static_cast<int>(row_groups_.size()) ||
+        column < 0 ||
+        column >= static_cast<int>(row_groups_[row_group].columns.size())) {
+      throw ParquetException("Invalid column chunk index");
+    }
+    return &row_groups_[row_group].columns[column];
+  }
+
+  void SetColumnIndexLocation(int row_group, int column, int64_t offset,
+                              int32_t length) {
+    auto column_chunk = GetColumnChunk(row_group, column);
+    column_chunk->__set_column_index_offset(offset);
+    column_chunk->__set_column_index_length(length);
+  }
+
+  void SetOffsetIndexLocation(int row_group, int column, int64_t offset,
+                              int32_t length) {
+    auto column_chunk = GetColumnChunk(row_group, column);
+    column_chunk->__set_offset_index_offset(offset);
+    column_chunk->__set_offset_index_length(length);
+  }
+
+  void SetBloomFilterOffset(int row_group, int column, int64_t offset) {
+    GetColumnChunk(row_group, column)->meta_data.__set_bloom_filter_offset(offset);
+  }
+
   std::unique_ptr<FileMetaData> Finish() {
     int64_t total_rows = 0;
     for (auto row_group : row_groups_) {
@@ -1472,6 +1687,21 @@ RowGroupMetaDataBuilder* FileMetaDataBuilder::AppendRowGroup() {
   return impl_->AppendRowGroup();
 }
 
+void FileMetaDataBuilder::SetColumnIndexLocation(int row_group, int column,
+                                                 int64_t offset, int32_t length) {
+  impl_->SetColumnIndexLocation(row_group, column, offset, length);
+}
+
+void FileMetaDataBuilder::SetOffsetIndexLocation(int row_group, int column,
+                                                 int64_t offset, int32_t length) {
+  impl_->SetOffsetIndexLocation(row_group, column, offset, length);
+}
+
+void FileMetaDataBuilder::SetBloomFilterOffset(int row_group, int column,
+                                               int64_t offset) {
+  impl_->SetBloomFilterOffset(row_group, column, offset);
+}
+
 std::unique_ptr<FileMetaData> FileMetaDataBuilder::Finish() { return impl_->Finish(); }
 
 std::unique_ptr<FileCryptoMetaData> FileMetaDataBuilder::GetCryptoMetaData() {
@@ -169,6 +169,18 @@ class PARQUET_EXPORT ColumnChunkMetaData {
   int64_t total_uncompressed_size() const;
   std::unique_ptr<ColumnCryptoMetaData> crypto_metadata() const;
 
+  // page index, see page_index.h
+  bool has_column_index() const;
+  int64_t column_index_offset() const;
+  int32_t column_index_length() const;
+  bool has_offset_index() const;
+  int64_t offset_index_offset() const;
+  int32_t offset_index_length() const;
+
+  // Bloom filter, see bloom_filter_reader.h
+  bool has_bloom_filter() const;
+  int64_t bloom_filter_offset() const;
+
  private:
   explicit ColumnChunkMetaData(
       const void* metadata, const ColumnDescriptor* descr, int16_t row_group_ordinal,
@@ -223,12 +235,14 @@ class PARQUET_EXPORT RowGroupMetaData {
   bool can_decompress() const;
 
  private:
+  friend class FileMetaData;
   explicit RowGroupMetaData(
       const void* metadata, const SchemaDescriptor* schema,
       const ApplicationVersion* writer_version = NULLPTR,
       std::shared_ptr<InternalFileDecryptor> file_decryptor = NULLPTR);
   // PIMPL Idiom
   class RowGroupMetaDataImpl;
+  explicit RowGroupMetaData(std::unique_ptr<RowGroupMetaDataImpl> impl);
   std::unique_ptr<RowGroupMetaDataImpl> impl_;
 };
 
@@ -269,6 +283,9 @@ class PARQUET_EXPORT FileMetaData {
   /// WARNING, the returned object references memory location in it's parent
   /// (FileMetaData) object. Hence, the parent must outlive the returned object.
   ///
+  /// The metadata of a row group read from a file footer, and of each of its
+  /// column chunks, is only deserialized when it is first accessed.
+  ///
   /// \param[in] index of the RowGroup to retrieve.
   ///
   /// \throws ParquetException if the index is out of bound.
@@ -458,6 +475,17 @@ class PARQUET_EXPORT FileMetaDataBuilder {
   // The prior RowGroupMetaDataBuilder (if any) is destroyed
   RowGroupMetaDataBuilder* AppendRowGroup();
 
+  // Record the location of the page index of a column chunk of a row group
+  // already appended
+  void SetColumnIndexLocation(int row_group, int column, int64_t offset,
+                              int32_t length);
+  void SetOffsetIndexLocation(int row_group, int column, int64_t offset,
+                              int32_t length);
+
+  // Record the offset of the Bloom filter of a column chunk of a row group
+  // already appended
+  void SetBloomFilterOffset(int row_group, int column, int64_t offset);
+
   // Complete the Thrift structure
   std::unique_ptr<FileMetaData> Finish();
 
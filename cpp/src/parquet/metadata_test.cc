@@ -214,6 +214,48 @@ TEST(Metadata, TestBuildAccess) {
   ASSERT_EQ(3, f_accessor->num_schema_elements());
 }
 
+TEST(Metadata, TestLazyRowGroups) {
+  parquet::schema::NodeVector fields;
+  fields.push_back(parquet::schema::Int32("int_col", Repetition::REQUIRED));
+  fields.push_back(parquet::schema::Float("float_col", Repetition::REQUIRED));
+  parquet::SchemaDescriptor schema;
+  schema.Init(parquet::schema::GroupNode::Make("schema", Repetition::REPEATED, fields));
+  std::shared_ptr<WriterProperties> props = WriterProperties::Builder().build();
+
+  int64_t nrows = 1000;
+  EncodedStatistics stats_int;
+  stats_int.set_null_count(0).set_min("abcd").set_max("efgh");
+  EncodedStatistics stats_float;
+  stats_float.set_null_count(1).set_min("ijkl").set_max("mnop");
+  auto f_accessor = GenerateTableMetaData(schema, props, nrows, stats_int, stats_float);
+  std::string serialized_metadata = f_accessor->SerializeToString();
+
+  uint32_t decoded_len = static_cast<uint32_t>(serialized_metadata.length());
+  auto f_accessor_copy = FileMetaData::Make(serialized_metadata.data(), &decoded_len);
+  ASSERT_EQ(serialized_metadata.length(), decoded_len);
+  ASSERT_EQ(2, f_accessor_copy->num_row_groups());
+
+  // Access the column chunks out of order
+  auto rg2_accessor = f_accessor_copy->RowGroup(1);
+  ASSERT_EQ(2, rg2_accessor->num_columns());
+  ASSERT_EQ(nrows / 2, rg2_accessor->num_rows());
+  auto rg2_column2 = rg2_accessor->ColumnChunk(1);
+  ASSERT_EQ(26, rg2_column2->data_page_offset());
+  ASSERT_EQ(1, rg2_column2->statistics()->null_count());
+  auto rg1_column1 = f_accessor_copy->RowGroup(0)->ColumnChunk(0);
+  ASSERT_EQ(10, rg1_column1->data_page_offset());
+  ASSERT_EQ(0, rg1_column1->statistics()->null_count());
+  ASSERT_EQ(16, rg2_accessor->ColumnChunk(0)->dictionary_page_offset());
+
+  // Writing the metadata back decodes what was left undecoded
+  ASSERT_EQ(serialized_metadata, f_accessor_copy->SerializeToString());
+
+  f_accessor_copy->AppendRowGroups(*f_accessor);
+  ASSERT_EQ(4, f_accessor_copy->num_row_groups());
+  ASSERT_EQ(24, f_accessor_copy->RowGroup(2)->ColumnChunk(1)->dictionary_page_offset());
+  ASSERT_EQ(24, f_accessor_copy->RowGroup(0)->ColumnChunk(1)->dictionary_page_offset());
+}
+
 TEST(Metadata, TestV1Version) {
   // PARQUET-839
   parquet::schema::NodeVector fields;
@@ -0,0 +1,374 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/page_index.h"
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <utility>
+
+#include "arrow/util/logging.h"
+#include "parquet/exception.h"
+#include "parquet/metadata.h"
+#include "parquet/schema.h"
+#include "parquet/statistics.h"
+#include "parquet/thrift_internal.h"
+
+namespace parquet {
+
+namespace {
+
+class ColumnIndexImpl : public ColumnIndex {
+ public:
+  ColumnIndexImpl(const ColumnDescriptor* descr, format::ColumnIndex index)
+      : descr_(descr), index_(std::move(index)) {
+    const size_t num_pages = index_.null_pages.size();
+    if (index_.min_values.size() != num_pages || index_.max_values.size() != num_pages ||
+        (index_.__isset.null_counts && index_.null_counts.size() != num_pages)) {
+      throw ParquetInvalidOrCorruptedFileException(
+          "Invalid column index: inconsistent number of pages");
+    }
+  }
+
+  const ColumnDescriptor* descr() const override { return descr_; }
+
+  const std::vector<bool>& null_pages() const override { return index_.null_pages; }
+
+  const std::vector<std::string>& encoded_min_values() const override {
+    return index_.min_values;
+  }
+
+  const std::vector<std::string>& encoded_max_values() const override {
+    return index_.max_values;
+  }
+
+  BoundaryOrder::type boundary_order() const override {
+    return static_cast<BoundaryOrder::type>(index_.boundary_order);
+  }
+
+  bool has_null_counts() const override { return index_.__isset.null_counts; }
+
+  const std::vector<int64_t>& null_counts() const override { return index_.null_counts; }
+
+ private:
+  const ColumnDescriptor* descr_;
+  format::ColumnIndex index_;
+};
+
+class OffsetIndexImpl : public OffsetIndex {
+ public:
+  explicit OffsetIndexImpl(const format::OffsetIndex& index) {
+    page_locations_.reserve(index.page_locations.size());
+    for (const auto& location : index.page_locations) {
+      page_locations_.push_back(
+          {location.offset, location.compressed_page_size, location.first_row_index});
+    }
+  }
+
+  const std::vector<PageLocation>& page_locations() const override {
+    return page_locations_;
+  }
+
+ private:
+  std::vector<PageLocation> page_locations_;
+};
+
+// Return [begin, end) of the bytes spanned by the ranges, or {0, 0} if empty
+std::pair<int64_t, int64_t> Span(const std::vector<std::pair<int64_t, int32_t>>& ranges) {
+  int64_t begin = std::numeric_limits<int64_t>::max();
+  int64_t end = 0;
+  for (const auto& range : ranges) {
+    if (range.second <= 0) continue;
+    begin = std::min(begin, range.first);
+    end = std::max(end, range.first + range.second);
+  }
+  if (begin >= end) {
+    return {0, 0};
+  }
+  return {begin, end};
+}
+
+class RowGroupPageIndexReaderImpl : public RowGroupPageIndexReader {
+ public:
+  // `readable` flags the column chunks whose page index can be read
+  RowGroupPageIndexReaderImpl(std::shared_ptr<ArrowInputFile> source,
+                              std::shared_ptr<FileMetaData> file_metadata, int row_group,
+                              std::vector<bool> readable,
+                              const ReaderProperties& properties)
+      : source_(std::move(source)),
+        file_metadata_(std::move(file_metadata)),
+        row_group_metadata_(file_metadata_->RowGroup(row_group)),
+        readable_(std::move(readable)),
+        properties_(properties) {}
+
+  std::shared_ptr<ColumnIndex> GetColumnIndex(int i) override {
+    auto column = CheckColumn(i);
+    if (!readable_[i] || !column->has_column_index()) {
+      return nullptr;
+    }
+    const uint8_t* data = GetRange(&column_index_buffer_, /*column_index=*/true,
+                                   column->column_index_offset(),
+                                   column->column_index_length());
+    uint32_t length = static_cast<uint32_t>(column->column_index_length());
+    return ColumnIndex::Make(row_group_metadata_->schema()->Column(i), data, length,
+                             properties_);
+  }
+
+  std::shared_ptr<OffsetIndex> GetOffsetIndex(int i) override {
+    auto column = CheckColumn(i);
+    if (!readable_[i] || !column->has_offset_index()) {
+      return nullptr;
+    }
+    const uint8_t* data = GetRange(&offset_index_buffer_, /*column_index=*/false,
+                                   column->offset_index_offset(),
+                                   column->offset_index_length());
+    uint32_t length = static_cast<uint32_t>(column->offset_index_length());
+    return OffsetIndex::Make(data, length, properties_);
+  }
+
+ private:
+  std::unique_ptr<ColumnChunkMetaData> CheckColumn(int i) {
+    if (i < 0 || i >= row_group_metadata_->num_columns()) {
+      std::stringstream ss;
+      ss << "Trying to read the page index of column " << i
+         << " but the row group only has " << row_group_metadata_->num_columns()
+         << " columns";
+      throw ParquetException(ss.str());
+    }
+    return row_group_metadata_->ColumnChunk(i);
+  }
+
+  struct IndexBuffer {
+    std::shared_ptr<Buffer> data;
+    int64_t offset = 0;
+  };
+
+  // Read the indexes of the given kind of all column chunks the first time
+  // one of them is requested. Writers usually store all ColumnIndex before
+  // all OffsetIndex, so both kinds are read separately.
+  const uint8_t* GetRange(IndexBuffer* buffer, bool column_index, int64_t offset,
+                          int32_t length) {
+    if (buffer->data == nullptr) {
+      std::vector<std::pair<int64_t, int32_t>> ranges;
+      for (int i = 0; i < row_group_metadata_->num_columns(); ++i) {
+        if (!readable_[i]) continue;
+        auto column = row_group_metadata_->ColumnChunk(i);
+        if (column_index && column->has_column_index()) {
+          ranges.emplace_back(column->column_index_offset(),
+                              column->column_index_length());
+        } else if (!column_index && column->has_offset_index()) {
+          ranges.emplace_back(column->offset_index_offset(),
+                              column->offset_index_length());
+        }
+      }
+      auto span = Span(ranges);
+      PARQUET_ASSIGN_OR_THROW(buffer->data,
+                              source_->ReadAt(span.first, span.second - span.first));
+      buffer->offset = span.first;
+    }
+    if (offset < buffer->offset || length < 0 ||
+        offset + length > buffer->offset + buffer->data->size()) {
+      throw ParquetInvalidOrCorruptedFileException("Invalid page index location: offset ",
+                                                   offset, ", length ", length);
+    }
+    return buffer->data->data() + (offset - buffer->offset);
+  }
+
+  std::shared_ptr<ArrowInputFile> source_;
+  // Keeps alive the thrift structures referenced by row_group_metadata_
+  std::shared_ptr<FileMetaData> file_metadata_;
+  std::unique_ptr<RowGroupMetaData> row_group_metadata_;
+  std::vector<bool> readable_;
+  ReaderProperties properties_;
+  IndexBuffer column_index_buffer_;
+  IndexBuffer offset_index_buffer_;
+};
+
+class PageIndexReaderImpl : public PageIndexReader {
+ public:
+  PageIndexReaderImpl(std::shared_ptr<ArrowInputFile> source,
+                      std::shared_ptr<FileMetaData> file_metadata,
+                      const ReaderProperties& properties)
+      : source_(std::move(source)),
+        file_metadata_(std::move(file_metadata)),
+        properties_(properties) {}
+
+  std::shared_ptr<RowGroupPageIndexReader> RowGroup(int i) override {
+    if (i < 0 || i >= file_metadata_->num_row_groups()) {
+      std::stringstream ss;
+      ss << "Trying to read the page index of row group " << i
+         << " but the file only has " << file_metadata_->num_row_groups()
+         << " row groups";
+      throw ParquetException(ss.str());
+    }
+    auto row_group_metadata = file_metadata_->RowGroup(i);
+    std::vector<bool> readable(row_group_metadata->num_columns(), false);
+    bool any_readable = false;
+    for (int j = 0; j < row_group_metadata->num_columns(); ++j) {
+      auto column = row_group_metadata->ColumnChunk(j);
+      // The indexes of encrypted column chunks are encrypted as well
+      readable[j] = column->crypto_metadata() == nullptr &&
+                    (column->has_column_index() || column->has_offset_index());
+      any_readable = any_readable || readable[j];
+    }
+    if (!any_readable) {
+      return nullptr;
+    }
+    return std::make_shared<RowGroupPageIndexReaderImpl>(
+        source_, file_metadata_, i, std::move(readable), properties_);
+  }
+
+ private:
+  std::shared_ptr<ArrowInputFile> source_;
+  std::shared_ptr<FileMetaData> file_metadata_;
+  ReaderProperties properties_;
+};
+
+}  // namespace
+
+std::unique_ptr<ColumnIndex> ColumnIndex::Make(const ColumnDescriptor* descr,
+                                               const void* serialized_index,
+                                               uint32_t index_len,
+                                               const ReaderProperties& properties) {
+  format::ColumnIndex index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), &index_len,
+                       &index);
+  return std::unique_ptr<ColumnIndex>(new ColumnIndexImpl(descr, std::move(index)));
+}
+
+std::shared_ptr<Statistics> ColumnIndex::page_statistics(int i) const {
+  if (i < 0 || i >= num_pages()) {
+    std::stringstream ss;
+    ss << "Trying to read the statistics of page " << i
+       << " but the column chunk only has " << num_pages() << " pages";
+    throw ParquetException(ss.str());
+  }
+  const bool null_page = null_pages()[i];
+  const int64_t null_count = has_null_counts() ? null_counts()[i] : 0;
+  return Statistics::Make(descr(), encoded_min_values()[i], encoded_max_values()[i],
+                          /*num_values=*/0, null_count, /*distinct_count=*/0,
+                          /*has_min_max=*/!null_page);
+}
+
+std::unique_ptr<OffsetIndex> OffsetIndex::Make(const void* serialized_index,
+                                               uint32_t index_len,
+                                               const ReaderProperties& properties) {
+  format::OffsetIndex index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), &index_len,
+                       &index);
+  return std::unique_ptr<OffsetIndex>(new OffsetIndexImpl(index));
+}
+
+std::shared_ptr<PageIndexReader> PageIndexReader::Make(
+    std::shared_ptr<ArrowInputFile> source, std::shared_ptr<FileMetaData> file_metadata,
+    const ReaderProperties& properties) {
+  return std::make_shared<PageIndexReaderImpl>(std::move(source),
+                                               std::move(file_metadata), properties);
+}
+
+// ----------------------------------------------------------------------
+// ColumnChunkPageIndexBuilder
+
+class ColumnChunkPageIndexBuilder::ColumnChunkPageIndexBuilderImpl {
+ public:
+  ColumnChunkPageIndexBuilderImpl() {
+    column_index_.__set_boundary_order(format::BoundaryOrder::UNORDERED);
+  }
+
+  void AddPage(const EncodedStatistics& statistics, int64_t num_rows, int64_t offset,
+               int32_t compressed_page_size) {
+    const bool null_page = statistics.has_null_count && !statistics.has_min &&
+                           !statistics.has_max && statistics.null_count == num_rows;
+    if (!null_page && !(statistics.has_min && statistics.has_max)) {
+      has_column_index_ = false;
+    }
+    column_index_.null_pages.push_back(null_page);
+    column_index_.min_values.push_back(null_page ? "" : statistics.min());
+    column_index_.max_values.push_back(null_page ? "" : statistics.max());
+    has_null_counts_ = has_null_counts_ && statistics.has_null_count;
+    column_index_.null_counts.push_back(statistics.null_count);
+
+    format::PageLocation location;
+    location.__set_offset(offset);
+    location.__set_compressed_page_size(compressed_page_size);
+    location.__set_first_row_index(num_rows_);
+    offset_index_.page_locations.push_back(location);
+    num_rows_ += num_rows;
+  }
+
+  void ShiftOffsets(int64_t delta) {
+    for (auto& location : offset_index_.page_locations) {
+      location.offset += delta;
+    }
+  }
+
+  bool has_column_index() const { return has_column_index_; }
+
+  void WriteColumnIndex(ArrowOutputStream* sink) const {
+    DCHECK(has_column_index_);
+    format::ColumnIndex column_index = column_index_;
+    if (has_null_counts_) {
+      column_index.__isset.null_counts = true;
+    } else {
+      column_index.null_counts.clear();
+    }
+    ThriftSerializer serializer;
+    serializer.Serialize(&column_index, sink);
+  }
+
+  void WriteOffsetIndex(ArrowOutputStream* sink) const {
+    ThriftSerializer serializer;
+    serializer.Serialize(&offset_index_, sink);
+  }
+
+ private:
+  format::ColumnIndex column_index_;
+  format::OffsetIndex offset_index_;
+  bool has_column_index_ = true;
+  bool has_null_counts_ = true;
+  int64_t num_rows_ = 0;
+};
+
+ColumnChunkPageIndexBuilder::ColumnChunkPageIndexBuilder()
+    : impl_(new ColumnChunkPageIndexBuilderImpl()) {}
+
+ColumnChunkPageIndexBuilder::~ColumnChunkPageIndexBuilder() = default;
+
+void ColumnChunkPageIndexBuilder::AddPage(const EncodedStatistics& statistics,
+                                          int64_t num_rows, int64_t offset,
+                                          int32_t compressed_page_size) {
+  impl_->AddPage(statistics, num_rows, offset, compressed_page_size);
+}
+
+void ColumnChunkPageIndexBuilder::ShiftOffsets(int64_t delta) {
+  impl_->ShiftOffsets(delta);
+}
+
+bool ColumnChunkPageIndexBuilder::has_column_index() const {
+  return impl_->has_column_index();
+}
+
+void ColumnChunkPageIndexBuilder::WriteColumnIndex(ArrowOutputStream* sink) const {
+  impl_->WriteColumnIndex(sink);
+}
+
+void ColumnChunkPageIndexBuilder::WriteOffsetIndex(ArrowOutputStream* sink) const {
+  impl_->WriteOffsetIndex(sink);
+}
+
+}  // namespace parquet
@@ -0,0 +1,177 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// The page index of a Parquet file: per-page statistics (ColumnIndex) and
+// page locations (OffsetIndex) of each column chunk, stored apart from the
+// pages so that readers can select pages without reading their headers.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "parquet/platform.h"
+#include "parquet/properties.h"
+
+namespace parquet {
+
+class ColumnDescriptor;
+class EncodedStatistics;
+class FileMetaData;
+class Statistics;
+
+struct PARQUET_EXPORT BoundaryOrder {
+  enum type { UNORDERED = 0, ASCENDING = 1, DESCENDING = 2 };
+};
+
+/// \brief The location of a data page in the file
+struct PARQUET_EXPORT PageLocation {
+  /// Offset of the page (header included) in the file
+  int64_t offset;
+  /// Size of the page, header included
+  int32_t compressed_page_size;
+  /// Index of the first row of the page within its row group
+  int64_t first_row_index;
+};
+
+/// \brief The per-page statistics of a column chunk
+///
+/// The min and max values are encoded like those of Statistics, and are only
+/// meaningful for pages which aren't null pages.
+class PARQUET_EXPORT ColumnIndex {
+ public:
+  /// \brief Deserialize a ColumnIndex
+  ///
+  /// \param[in] descr the column schema; it must outlive the ColumnIndex
+  /// \param[in] serialized_index the thrift-serialized ColumnIndex
+  /// \param[in] index_len the size of serialized_index
+  /// \param[in] properties the reader properties
+  static std::unique_ptr<ColumnIndex> Make(const ColumnDescriptor* descr,
+                                           const void* serialized_index,
+                                           uint32_t index_len,
+                                           const ReaderProperties& properties);
+
+  virtual ~ColumnIndex() = default;
+
+  virtual const ColumnDescriptor* descr() const = 0;
+
+  int num_pages() const { return static_cast<int>(null_pages().size()); }
+
+  /// Whether each page only holds nulls
+  virtual const std::vector<bool>& null_pages() const = 0;
+  virtual const std::vector<std::string>& encoded_min_values() const = 0;
+  virtual const std::vector<std::string>& encoded_max_values() const = 0;
+
+  /// Whether the min and max values are sorted across pages
+  virtual BoundaryOrder::type boundary_order() const = 0;
+
+  virtual bool has_null_counts() const = 0;
+  virtual const std::vector<int64_t>& null_counts() const = 0;
+
+  /// \brief The statistics of page i
+  ///
+  /// The page index doesn't record the number of values of pages: the
+  /// statistics have num_values() == 0, and no min/max for null pages.
+  std::shared_ptr<Statistics> page_statistics(int i) const;
+};
+
+/// \brief The locations of the data pages of a column chunk
+class PARQUET_EXPORT OffsetIndex {
+ public:
+  /// \brief Deserialize an OffsetIndex
+  static std::unique_ptr<OffsetIndex> Make(const void* serialized_index,
+                                           uint32_t index_len,
+                                           const ReaderProperties& properties);
+
+  virtual ~OffsetIndex() = default;
+
+  virtual const std::vector<PageLocation>& page_locations() const = 0;
+};
+
+/// \brief Reads the page index of the column chunks of a row group
+class PARQUET_EXPORT RowGroupPageIndexReader {
+ public:
+  virtual ~RowGroupPageIndexReader() = default;
+
+  /// \brief The ColumnIndex of column i, or null if it has none
+  virtual std::shared_ptr<ColumnIndex> GetColumnIndex(int i) = 0;
+
+  /// \brief The OffsetIndex of column i, or null if it has none
+  virtual std::shared_ptr<OffsetIndex> GetOffsetIndex(int i) = 0;
+};
+
+/// \brief Reads the page index of a Parquet file
+///
+/// Writers store the indexes of the column chunks next to each other, so the
+/// reader loads the ColumnIndex of all column chunks of a row group with a
+/// single read, the first time one of them is requested, and likewise for
+/// their OffsetIndex. The page index of encrypted
+/// column chunks isn't supported: they are reported as having none.
+class PARQUET_EXPORT PageIndexReader {
+ public:
+  static std::shared_ptr<PageIndexReader> Make(
+      std::shared_ptr<ArrowInputFile> source, std::shared_ptr<FileMetaData> file_metadata,
+      const ReaderProperties& properties);
+
+  virtual ~PageIndexReader() = default;
+
+  /// \brief The page index reader of row group i, or null if none of its
+  /// column chunks has a page index
+  virtual std::shared_ptr<RowGroupPageIndexReader> RowGroup(int i) = 0;
+};
+
+/// \brief Builds the ColumnIndex and OffsetIndex of a column chunk while its
+/// data pages are written
+///
+/// The pages must start at row boundaries.
+class PARQUET_EXPORT ColumnChunkPageIndexBuilder {
+ public:
+  ColumnChunkPageIndexBuilder();
+  ~ColumnChunkPageIndexBuilder();
+
+  /// \brief Record the next data page of the column chunk
+  ///
+  /// \param[in] statistics the statistics of the page
+  /// \param[in] num_rows the number of rows of the page
+  /// \param[in] offset the offset of the page, header included
+  /// \param[in] compressed_page_size the size of the page, header included
+  void AddPage(const EncodedStatistics& statistics, int64_t num_rows, int64_t offset,
+               int32_t compressed_page_size);
+
+  /// \brief Add delta to the offsets of the pages recorded so far, for page
+  /// writers which buffer a column chunk before writing it to the file
+  void ShiftOffsets(int64_t delta);
+
+  /// \brief Whether all pages have the statistics a ColumnIndex needs
+  ///
+  /// Pages which aren't null pages must have min and max values.
+  bool has_column_index() const;
+
+  /// \brief Serialize the ColumnIndex; requires has_column_index()
+  void WriteColumnIndex(ArrowOutputStream* sink) const;
+
+  /// \brief Serialize the OffsetIndex
+  void WriteOffsetIndex(ArrowOutputStream* sink) const;
+
+ private:
+  class ColumnChunkPageIndexBuilderImpl;
+  std::unique_ptr<ColumnChunkPageIndexBuilderImpl> impl_;
+};
+
+}  // namespace parquet
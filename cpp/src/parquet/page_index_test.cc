@@ -0,0 +1,199 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/io/memory.h"
+#include "arrow/testing/gtest_util.h"
+
+#include "parquet/column_writer.h"
+#include "parquet/exception.h"
+#include "parquet/file_reader.h"
+#include "parquet/file_writer.h"
+#include "parquet/metadata.h"
+#include "parquet/page_index.h"
+#include "parquet/schema.h"
+#include "parquet/statistics.h"
+#include "parquet/thrift_internal.h"
+#include "parquet/types.h"
+
+namespace parquet {
+
+using schema::GroupNode;
+using schema::PrimitiveNode;
+
+static std::string EncodeInt32(int32_t value) {
+  return std::string(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+TEST(PageIndex, ReadColumnIndex) {
+  auto node = PrimitiveNode::Make("a", Repetition::OPTIONAL, Type::INT32);
+  ColumnDescriptor descr(node, /*max_definition_level=*/1, /*max_repetition_level=*/0);
+
+  format::ColumnIndex index;
+  index.__set_null_pages({false, true, false});
+  index.__set_min_values({EncodeInt32(1), "", EncodeInt32(-5)});
+  index.__set_max_values({EncodeInt32(10), "", EncodeInt32(3)});
+  index.__set_boundary_order(format::BoundaryOrder::UNORDERED);
+  index.__set_null_counts({0, 7, 2});
+  std::string serialized;
+  ThriftSerializer().SerializeToString(&index, &serialized);
+
+  auto column_index =
+      ColumnIndex::Make(&descr, serialized.data(),
+                        static_cast<uint32_t>(serialized.size()), ReaderProperties());
+  ASSERT_EQ(3, column_index->num_pages());
+  ASSERT_EQ(BoundaryOrder::UNORDERED, column_index->boundary_order());
+  ASSERT_EQ(std::vector<bool>({false, true, false}), column_index->null_pages());
+  ASSERT_TRUE(column_index->has_null_counts());
+  ASSERT_EQ(std::vector<int64_t>({0, 7, 2}), column_index->null_counts());
+
+  auto stats = std::static_pointer_cast<Int32Statistics>(column_index->page_statistics(2));
+  ASSERT_TRUE(stats->HasMinMax());
+  ASSERT_EQ(-5, stats->min());
+  ASSERT_EQ(3, stats->max());
+  ASSERT_EQ(2, stats->null_count());
+  ASSERT_FALSE(column_index->page_statistics(1)->HasMinMax());
+  ASSERT_THROW(column_index->page_statistics(3), ParquetException);
+
+  // Per-page vectors of different lengths
+  index.__set_null_counts({0});
+  ThriftSerializer().SerializeToString(&index, &serialized);
+  ASSERT_THROW(ColumnIndex::Make(&descr, serialized.data(),
+                                 static_cast<uint32_t>(serialized.size()),
+                                 ReaderProperties()),
+               ParquetException);
+}
+
+TEST(PageIndex, ReadOffsetIndex) {
+  format::OffsetIndex index;
+  std::vector<format::PageLocation> locations(2);
+  locations[0].__set_offset(4);
+  locations[0].__set_compressed_page_size(100);
+  locations[0].__set_first_row_index(0);
+  locations[1].__set_offset(104);
+  locations[1].__set_compressed_page_size(50);
+  locations[1].__set_first_row_index(1000);
+  index.__set_page_locations(locations);
+  std::string serialized;
+  ThriftSerializer().SerializeToString(&index, &serialized);
+
+  auto offset_index = OffsetIndex::Make(
+      serialized.data(), static_cast<uint32_t>(serialized.size()), ReaderProperties());
+  const auto& page_locations = offset_index->page_locations();
+  ASSERT_EQ(2, page_locations.size());
+  ASSERT_EQ(104, page_locations[1].offset);
+  ASSERT_EQ(50, page_locations[1].compressed_page_size);
+  ASSERT_EQ(1000, page_locations[1].first_row_index);
+}
+
+// Write a file with sorted required values in "a" and only nulls in "b",
+// with pages of 100 rows
+static std::shared_ptr<Buffer> WriteFile(std::shared_ptr<WriterProperties> properties,
+                                         int num_row_groups, int num_rows) {
+  auto schema = std::static_pointer_cast<GroupNode>(GroupNode::Make(
+      "schema", Repetition::REQUIRED,
+      {PrimitiveNode::Make("a", Repetition::REQUIRED, Type::INT32),
+       PrimitiveNode::Make("b", Repetition::OPTIONAL, Type::INT32)}));
+  auto sink = CreateOutputStream();
+  auto file_writer = ParquetFileWriter::Open(sink, schema, properties);
+  std::vector<int32_t> values(num_rows);
+  std::vector<int16_t> def_levels(num_rows, 0);
+  for (int row_group = 0; row_group < num_row_groups; ++row_group) {
+    for (int i = 0; i < num_rows; ++i) {
+      values[i] = row_group * num_rows + i;
+    }
+    auto row_group_writer = file_writer->AppendRowGroup();
+    auto a_writer = static_cast<Int32Writer*>(row_group_writer->NextColumn());
+    a_writer->WriteBatch(num_rows, nullptr, nullptr, values.data());
+    auto b_writer = static_cast<Int32Writer*>(row_group_writer->NextColumn());
+    b_writer->WriteBatch(num_rows, def_levels.data(), nullptr, nullptr);
+  }
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+  return buffer;
+}
+
+TEST(PageIndex, WriteAndRead) {
+  auto properties = WriterProperties::Builder()
+                        .disable_dictionary()
+                        ->write_batch_size(100)
+                        ->data_pagesize(1)
+                        ->enable_write_page_index()
+                        ->build();
+  auto buffer = WriteFile(properties, /*num_row_groups=*/2, /*num_rows=*/1000);
+  auto reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  auto page_index_reader = reader->GetPageIndexReader();
+  ASSERT_NE(nullptr, page_index_reader);
+
+  for (int row_group = 0; row_group < 2; ++row_group) {
+    auto row_group_metadata = reader->metadata()->RowGroup(row_group);
+    auto row_group_index = page_index_reader->RowGroup(row_group);
+    ASSERT_NE(nullptr, row_group_index);
+
+    auto a_index = row_group_index->GetColumnIndex(0);
+    ASSERT_NE(nullptr, a_index);
+    ASSERT_EQ(10, a_index->num_pages());
+    for (int page = 0; page < 10; ++page) {
+      auto stats =
+          std::static_pointer_cast<Int32Statistics>(a_index->page_statistics(page));
+      ASSERT_EQ(row_group * 1000 + page * 100, stats->min());
+      ASSERT_EQ(row_group * 1000 + page * 100 + 99, stats->max());
+    }
+
+    auto a_offsets = row_group_index->GetOffsetIndex(0);
+    ASSERT_NE(nullptr, a_offsets);
+    const auto& locations = a_offsets->page_locations();
+    ASSERT_EQ(10, locations.size());
+    ASSERT_EQ(row_group_metadata->ColumnChunk(0)->data_page_offset(),
+              locations[0].offset);
+    for (int page = 0; page < 10; ++page) {
+      ASSERT_EQ(page * 100, locations[page].first_row_index);
+      if (page > 0) {
+        const auto& previous = locations[page - 1];
+        ASSERT_EQ(previous.offset + previous.compressed_page_size,
+                  locations[page].offset);
+      }
+    }
+
+    auto b_index = row_group_index->GetColumnIndex(1);
+    ASSERT_NE(nullptr, b_index);
+    int64_t null_count = 0;
+    for (int page = 0; page < b_index->num_pages(); ++page) {
+      ASSERT_TRUE(b_index->null_pages()[page]);
+      null_count += b_index->null_counts()[page];
+    }
+    ASSERT_EQ(1000, null_count);
+  }
+}
+
+TEST(PageIndex, NotWrittenByDefault) {
+  auto properties = WriterProperties::Builder().build();
+  auto buffer = WriteFile(properties, /*num_row_groups=*/1, /*num_rows=*/10);
+  auto reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  ASSERT_FALSE(reader->metadata()->RowGroup(0)->ColumnChunk(0)->has_column_index());
+  ASSERT_EQ(nullptr, reader->GetPageIndexReader());
+}
+
+}  // namespace parquet
@@ -86,6 +86,13 @@ class PARQUET_EXPORT ReaderProperties {
   int64_t buffer_size() const { return buffer_size_; }
   void set_buffer_size(int64_t size) { buffer_size_ = size; }
 
+  /// Number of pages of a compressed or encrypted column chunk decrypted and
+  /// decompressed ahead on the CPU thread pool while the current page is
+  /// decoded, so that reading a single column uses several cores.  Disabled
+  /// (0) by default.
+  int page_prefetch_depth() const { return page_prefetch_depth_; }
+  void set_page_prefetch_depth(int depth) { page_prefetch_depth_ = depth; }
+
   void file_decryption_properties(std::shared_ptr<FileDecryptionProperties> decryption) {
     file_decryption_properties_ = std::move(decryption);
   }
@@ -98,6 +105,7 @@ class PARQUET_EXPORT ReaderProperties {
   MemoryPool* pool_;
   int64_t buffer_size_ = kDefaultBufferSize;
   bool buffered_stream_enabled_ = false;
+  int page_prefetch_depth_ = 0;
   std::shared_ptr<FileDecryptionProperties> file_decryption_properties_;
 };
 
@@ -113,6 +121,17 @@ static constexpr int64_t DEFAULT_MAX_STATISTICS_SIZE = 4096;
 static constexpr Encoding::type DEFAULT_ENCODING = Encoding::PLAIN;
 static const char DEFAULT_CREATED_BY[] = CREATED_BY_VERSION;
 static constexpr Compression::type DEFAULT_COMPRESSION_TYPE = Compression::UNCOMPRESSED;
+static constexpr int32_t DEFAULT_BLOOM_FILTER_NDV = 1024 * 1024;
+static constexpr double DEFAULT_BLOOM_FILTER_FPP = 0.05;
+
+/// Sizing of the Bloom filters of the column chunks of a column
+struct PARQUET_EXPORT BloomFilterOptions {
+  /// The expected number of distinct values in a column chunk
+  int32_t ndv = DEFAULT_BLOOM_FILTER_NDV;
+  /// The false positive probability of the filter once it holds ndv values;
+  /// must be in (0, 1)
+  double fpp = DEFAULT_BLOOM_FILTER_FPP;
+};
 
 class PARQUET_EXPORT ColumnProperties {
  public:
@@ -148,6 +167,18 @@ class PARQUET_EXPORT ColumnProperties {
     compression_level_ = compression_level;
   }
 
+  void set_bloom_filter_enabled(bool bloom_filter_enabled) {
+    bloom_filter_enabled_ = bloom_filter_enabled;
+  }
+
+  void set_bloom_filter_options(const BloomFilterOptions& bloom_filter_options) {
+    bloom_filter_options_ = bloom_filter_options;
+  }
+
+  void set_adaptive_encoding_enabled(bool adaptive_encoding_enabled) {
+    adaptive_encoding_enabled_ = adaptive_encoding_enabled;
+  }
+
   Encoding::type encoding() const { return encoding_; }
 
   Compression::type compression() const { return codec_; }
@@ -160,6 +191,12 @@ class PARQUET_EXPORT ColumnProperties {
 
   int compression_level() const { return compression_level_; }
 
+  bool bloom_filter_enabled() const { return bloom_filter_enabled_; }
+
+  const BloomFilterOptions& bloom_filter_options() const { return bloom_filter_options_; }
+
+  bool adaptive_encoding_enabled() const { return adaptive_encoding_enabled_; }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
@@ -167,6 +204,9 @@ class PARQUET_EXPORT ColumnProperties {
   bool statistics_enabled_;
   size_t max_stats_size_;
   int compression_level_;
+  bool bloom_filter_enabled_ = false;
+  BloomFilterOptions bloom_filter_options_;
+  bool adaptive_encoding_enabled_ = false;
 };
 
 class PARQUET_EXPORT WriterProperties {
@@ -181,7 +221,8 @@ class PARQUET_EXPORT WriterProperties {
           pagesize_(kDefaultDataPageSize),
           version_(ParquetVersion::PARQUET_1_0),
           data_page_version_(ParquetDataPageVersion::V1),
-          created_by_(DEFAULT_CREATED_BY) {}
+          created_by_(DEFAULT_CREATED_BY),
+          write_page_index_(false) {}
     virtual ~Builder() {}
 
     Builder* memory_pool(MemoryPool* pool) {
@@ -398,6 +439,93 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_statistics(path->ToDotString());
     }
 
+    /// Write a Bloom filter for each column chunk of the column, after the
+    /// last row group. Readers use it to skip the row groups which can't hold
+    /// a given value.
+    ///
+    /// The filters of a column have a fixed size computed from the options, so
+    /// the ndv should be about the number of distinct values of a row group.
+    /// Bloom filters aren't written for BOOLEAN columns nor for encrypted
+    /// columns. Disabled by default.
+    Builder* enable_bloom_filter(
+        const std::string& path,
+        const BloomFilterOptions& options = BloomFilterOptions()) {
+      if (options.ndv <= 0 || !(options.fpp > 0.0 && options.fpp < 1.0)) {
+        throw ParquetException("Invalid Bloom filter options for column " + path);
+      }
+      bloom_filter_options_[path] = options;
+      return this;
+    }
+
+    Builder* enable_bloom_filter(
+        const std::shared_ptr<schema::ColumnPath>& path,
+        const BloomFilterOptions& options = BloomFilterOptions()) {
+      return this->enable_bloom_filter(path->ToDotString(), options);
+    }
+
+    Builder* disable_bloom_filter(const std::string& path) {
+      bloom_filter_options_.erase(path);
+      return this;
+    }
+
+    Builder* disable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_bloom_filter(path->ToDotString());
+    }
+
+    /// Choose the encoding of each column chunk from its first data page,
+    /// instead of using the configured encoding.
+    ///
+    /// The values of the first page are encoded with every encoding applicable
+    /// to the physical type (dictionary, if enabled, PLAIN, DELTA_BINARY_PACKED,
+    /// DELTA_LENGTH_BYTE_ARRAY, DELTA_BYTE_ARRAY and BYTE_STREAM_SPLIT), and the
+    /// one giving the smallest page, after compression, is kept for the rest
+    /// of the chunk. If dictionary encoding is kept, it still falls back once
+    /// the dictionary page limit is reached. Disabled by default.
+    Builder* enable_adaptive_encoding() {
+      default_column_properties_.set_adaptive_encoding_enabled(true);
+      return this;
+    }
+
+    Builder* disable_adaptive_encoding() {
+      default_column_properties_.set_adaptive_encoding_enabled(false);
+      return this;
+    }
+
+    Builder* enable_adaptive_encoding(const std::string& path) {
+      adaptive_encoding_enabled_[path] = true;
+      return this;
+    }
+
+    Builder* enable_adaptive_encoding(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->enable_adaptive_encoding(path->ToDotString());
+    }
+
+    Builder* disable_adaptive_encoding(const std::string& path) {
+      adaptive_encoding_enabled_[path] = false;
+      return this;
+    }
+
+    Builder* disable_adaptive_encoding(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_adaptive_encoding(path->ToDotString());
+    }
+
+    /// Write the page index (see page_index.h) of the column chunks, after
+    /// the last row group. The page statistics it holds are only collected
+    /// for the columns which have statistics enabled.
+    ///
+    /// The page index isn't written for repeated columns, whose pages may
+    /// not start at row boundaries, nor for encrypted columns. Disabled by
+    /// default.
+    Builder* enable_write_page_index() {
+      write_page_index_ = true;
+      return this;
+    }
+
+    Builder* disable_write_page_index() {
+      write_page_index_ = false;
+      return this;
+    }
+
     std::shared_ptr<WriterProperties> build() {
       std::unordered_map<std::string, ColumnProperties> column_properties;
       auto get = [&](const std::string& key) -> ColumnProperties& {
@@ -416,11 +544,18 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_dictionary_enabled(item.second);
       for (const auto& item : statistics_enabled_)
         get(item.first).set_statistics_enabled(item.second);
+      for (const auto& item : bloom_filter_options_) {
+        get(item.first).set_bloom_filter_enabled(true);
+        get(item.first).set_bloom_filter_options(item.second);
+      }
+      for (const auto& item : adaptive_encoding_enabled_)
+        get(item.first).set_adaptive_encoding_enabled(item.second);
 
       return std::shared_ptr<WriterProperties>(new WriterProperties(
           pool_, dictionary_pagesize_limit_, write_batch_size_, max_row_group_length_,
           pagesize_, version_, created_by_, std::move(file_encryption_properties_),
-          default_column_properties_, column_properties, data_page_version_));
+          default_column_properties_, column_properties, data_page_version_,
+          write_page_index_));
     }
 
    private:
@@ -432,6 +567,7 @@ class PARQUET_EXPORT WriterProperties {
     ParquetVersion::type version_;
     ParquetDataPageVersion data_page_version_;
     std::string created_by_;
+    bool write_page_index_;
 
     std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
@@ -442,6 +578,8 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, int32_t> codecs_compression_level_;
     std::unordered_map<std::string, bool> dictionary_enabled_;
     std::unordered_map<std::string, bool> statistics_enabled_;
+    std::unordered_map<std::string, BloomFilterOptions> bloom_filter_options_;
+    std::unordered_map<std::string, bool> adaptive_encoding_enabled_;
   };
 
   inline MemoryPool* memory_pool() const { return pool_; }
@@ -462,6 +600,8 @@ class PARQUET_EXPORT WriterProperties {
 
   inline std::string created_by() const { return parquet_created_by_; }
 
+  inline bool write_page_index() const { return write_page_index_; }
+
   inline Encoding::type dictionary_index_encoding() const {
     if (parquet_version_ == ParquetVersion::PARQUET_1_0) {
       return Encoding::PLAIN_DICTIONARY;
@@ -509,6 +649,19 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).max_statistics_size();
   }
 
+  bool bloom_filter_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_enabled();
+  }
+
+  const BloomFilterOptions& bloom_filter_options(
+      const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_options();
+  }
+
+  bool adaptive_encoding_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).adaptive_encoding_enabled();
+  }
+
   inline FileEncryptionProperties* file_encryption_properties() const {
     return file_encryption_properties_.get();
   }
@@ -530,7 +683,7 @@ class PARQUET_EXPORT WriterProperties {
       std::shared_ptr<FileEncryptionProperties> file_encryption_properties,
       const ColumnProperties& default_column_properties,
       const std::unordered_map<std::string, ColumnProperties>& column_properties,
-      ParquetDataPageVersion data_page_version)
+      ParquetDataPageVersion data_page_version, bool write_page_index)
       : pool_(pool),
         dictionary_pagesize_limit_(dictionary_pagesize_limit),
         write_batch_size_(write_batch_size),
@@ -539,6 +692,7 @@ class PARQUET_EXPORT WriterProperties {
         parquet_data_page_version_(data_page_version),
         parquet_version_(version),
         parquet_created_by_(created_by),
+        write_page_index_(write_page_index),
         file_encryption_properties_(file_encryption_properties),
         default_column_properties_(default_column_properties),
         column_properties_(column_properties) {}
@@ -551,6 +705,7 @@ class PARQUET_EXPORT WriterProperties {
   ParquetDataPageVersion parquet_data_page_version_;
   ParquetVersion::type parquet_version_;
   std::string parquet_created_by_;
+  bool write_page_index_;
 
   std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
@@ -568,12 +723,17 @@ static constexpr bool kArrowDefaultUseThreads = false;
 // Default number of rows to read when using ::arrow::RecordBatchReader
 static constexpr int64_t kArrowDefaultBatchSize = 64 * 1024;
 
+// Default upper bound on the input size of the columns encoded concurrently
+// when writing with threads
+static constexpr int64_t kArrowDefaultMaxBufferedBytes = 256 * 1024 * 1024;
+
 /// EXPERIMENTAL: Properties for configuring FileReader behavior.
 class PARQUET_EXPORT ArrowReaderProperties {
  public:
   explicit ArrowReaderProperties(bool use_threads = kArrowDefaultUseThreads)
       : use_threads_(use_threads),
         read_dict_indices_(),
+        read_run_end_encoded_indices_(),
         batch_size_(kArrowDefaultBatchSize),
         pre_buffer_(false),
         cache_options_(::arrow::io::CacheOptions::Defaults()) {}
@@ -597,6 +757,24 @@ class PARQUET_EXPORT ArrowReaderProperties {
     }
   }
 
+  /// \brief Read a top-level flat column as run-end encoded arrays
+  ///
+  /// Each decoded chunk is run-end encoded with int32 run ends, which keeps
+  /// columns with long runs of repeated values (e.g. constant or slowly
+  /// changing sensor readings) compact once read. Ignored for nested columns
+  /// and for columns that are read as dictionary.
+  void set_read_run_end_encoded(int column_index, bool read_run_end_encoded) {
+    if (read_run_end_encoded) {
+      read_run_end_encoded_indices_.insert(column_index);
+    } else {
+      read_run_end_encoded_indices_.erase(column_index);
+    }
+  }
+  bool read_run_end_encoded(int column_index) const {
+    return read_run_end_encoded_indices_.find(column_index) !=
+           read_run_end_encoded_indices_.end();
+  }
+
   void set_batch_size(int64_t batch_size) { batch_size_ = batch_size; }
 
   int64_t batch_size() const { return batch_size_; }
@@ -624,6 +802,7 @@ class PARQUET_EXPORT ArrowReaderProperties {
  private:
   bool use_threads_;
   std::unordered_set<int> read_dict_indices_;
+  std::unordered_set<int> read_run_end_encoded_indices_;
   int64_t batch_size_;
   bool pre_buffer_;
   ::arrow::io::AsyncContext async_context_;
@@ -650,7 +829,9 @@ class PARQUET_EXPORT ArrowWriterProperties {
           store_schema_(false),
           // TODO: At some point we should flip this.
           compliant_nested_types_(false),
-          engine_version_(V2) {}
+          engine_version_(V2),
+          use_threads_(kArrowDefaultUseThreads),
+          max_buffered_bytes_(kArrowDefaultMaxBufferedBytes) {}
     virtual ~Builder() = default;
 
     Builder* disable_deprecated_int96_timestamps() {
@@ -702,11 +883,29 @@ class PARQUET_EXPORT ArrowWriterProperties {
       return this;
     }
 
+    /// \brief Encode and compress the column chunks of a row group
+    /// concurrently in FileWriter::WriteTable (V2 engine only).
+    ///
+    /// The column chunks are buffered in memory and written to the sink in
+    /// column order.
+    Builder* set_use_threads(bool use_threads) {
+      use_threads_ = use_threads;
+      return this;
+    }
+
+    /// \brief Upper bound on the input size of the columns encoded
+    /// concurrently, default 256 MiB.  Their buffered column chunks are
+    /// written to the sink before the next columns are encoded.
+    Builder* set_max_buffered_bytes(int64_t max_buffered_bytes) {
+      max_buffered_bytes_ = max_buffered_bytes;
+      return this;
+    }
+
     std::shared_ptr<ArrowWriterProperties> build() {
       return std::shared_ptr<ArrowWriterProperties>(new ArrowWriterProperties(
           write_timestamps_as_int96_, coerce_timestamps_enabled_, coerce_timestamps_unit_,
           truncated_timestamps_allowed_, store_schema_, compliant_nested_types_,
-          engine_version_));
+          engine_version_, use_threads_, max_buffered_bytes_));
     }
 
    private:
@@ -719,6 +918,9 @@ class PARQUET_EXPORT ArrowWriterProperties {
     bool store_schema_;
     bool compliant_nested_types_;
     EngineVersion engine_version_;
+
+    bool use_threads_;
+    int64_t max_buffered_bytes_;
   };
 
   bool support_deprecated_int96_timestamps() const { return write_timestamps_as_int96_; }
@@ -745,20 +947,29 @@ class PARQUET_EXPORT ArrowWriterProperties {
   /// place in case there are bugs detected in V2.
   EngineVersion engine_version() const { return engine_version_; }
 
+  /// \brief Whether the column chunks of a row group are encoded concurrently.
+  bool use_threads() const { return use_threads_; }
+
+  /// \brief Upper bound on the input size of the columns encoded concurrently.
+  int64_t max_buffered_bytes() const { return max_buffered_bytes_; }
+
  private:
   explicit ArrowWriterProperties(bool write_nanos_as_int96,
                                  bool coerce_timestamps_enabled,
                                  ::arrow::TimeUnit::type coerce_timestamps_unit,
                                  bool truncated_timestamps_allowed, bool store_schema,
                                  bool compliant_nested_types,
-                                 EngineVersion engine_version)
+                                 EngineVersion engine_version, bool use_threads,
+                                 int64_t max_buffered_bytes)
       : write_timestamps_as_int96_(write_nanos_as_int96),
         coerce_timestamps_enabled_(coerce_timestamps_enabled),
         coerce_timestamps_unit_(coerce_timestamps_unit),
         truncated_timestamps_allowed_(truncated_timestamps_allowed),
         store_schema_(store_schema),
         compliant_nested_types_(compliant_nested_types),
-        engine_version_(engine_version) {}
+        engine_version_(engine_version),
+        use_threads_(use_threads),
+        max_buffered_bytes_(max_buffered_bytes) {}
 
   const bool write_timestamps_as_int96_;
   const bool coerce_timestamps_enabled_;
@@ -767,6 +978,8 @@ class PARQUET_EXPORT ArrowWriterProperties {
   const bool store_schema_;
   const bool compliant_nested_types_;
   const EngineVersion engine_version_;
+  const bool use_threads_;
+  const int64_t max_buffered_bytes_;
 };
 
 /// \brief State object used for writing Arrow data directly to a Parquet
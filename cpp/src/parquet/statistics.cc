@@ -27,6 +27,8 @@
 #include "arrow/array.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_block_counter.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_reader.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
@@ -258,6 +260,141 @@ optional<std::pair<ByteArray, ByteArray>> CleanStatistic(
   return min_max;
 }
 
+// The type the values of fixed-width numeric types are compared as (e.g.
+// uint32_t for unsigned INT32), void for the other types
+template <typename DType, bool is_signed>
+struct MinMaxCType {
+  using type = void;
+};
+
+template <>
+struct MinMaxCType<Int32Type, true> {
+  using type = int32_t;
+};
+
+template <>
+struct MinMaxCType<Int32Type, false> {
+  using type = uint32_t;
+};
+
+template <>
+struct MinMaxCType<Int64Type, true> {
+  using type = int64_t;
+};
+
+template <>
+struct MinMaxCType<Int64Type, false> {
+  using type = uint64_t;
+};
+
+template <bool is_signed>
+struct MinMaxCType<FloatType, is_signed> {
+  using type = float;
+};
+
+template <bool is_signed>
+struct MinMaxCType<DoubleType, is_signed> {
+  using type = double;
+};
+
+// Accumulates the min and max of fixed-width numeric values.
+//
+// The values are spread over kLanes independent minimums and maximums updated
+// with branch-free selects, which compilers turn into SIMD min/max (or
+// compare and blend) instructions.  A NaN never compares less or greater than
+// the current minimum or maximum, so NaNs are ignored.
+template <typename DType, bool is_signed,
+          typename CType = typename MinMaxCType<DType, is_signed>::type>
+class MinMaxAccumulator {
+ public:
+  using T = typename DType::c_type;
+  using Helper = CompareHelper<DType, is_signed>;
+
+  static constexpr int kLanes = 64 / sizeof(CType);
+
+  explicit MinMaxAccumulator(int type_length) {
+    std::fill(mins_, mins_ + kLanes, arrow::util::SafeCopy<CType>(Helper::DefaultMin()));
+    std::fill(maxs_, maxs_ + kLanes, arrow::util::SafeCopy<CType>(Helper::DefaultMax()));
+  }
+
+  void Update(const T* values, int64_t length) {
+    // T and CType only differ by signedness, which aliasing rules allow
+    const CType* cvalues = reinterpret_cast<const CType*>(values);
+    // Local lanes, which the compiler knows the values don't alias
+    CType mins[kLanes];
+    CType maxs[kLanes];
+    std::copy(mins_, mins_ + kLanes, mins);
+    std::copy(maxs_, maxs_ + kLanes, maxs);
+    int64_t i = 0;
+    for (; i + kLanes <= length; i += kLanes) {
+      for (int j = 0; j < kLanes; ++j) {
+        mins[j] = Min(mins[j], cvalues[i + j]);
+        maxs[j] = Max(maxs[j], cvalues[i + j]);
+      }
+    }
+    for (; i < length; ++i) {
+      mins[0] = Min(mins[0], cvalues[i]);
+      maxs[0] = Max(maxs[0], cvalues[i]);
+    }
+    std::copy(mins, mins + kLanes, mins_);
+    std::copy(maxs, maxs + kLanes, maxs_);
+  }
+
+  void UpdateOne(const T& value) { Update(&value, 1); }
+
+  std::pair<T, T> Finish() const {
+    CType min = mins_[0];
+    CType max = maxs_[0];
+    for (int j = 1; j < kLanes; ++j) {
+      min = Min(min, mins_[j]);
+      max = Max(max, maxs_[j]);
+    }
+    return {arrow::util::SafeCopy<T>(min), arrow::util::SafeCopy<T>(max)};
+  }
+
+ private:
+  static CType Min(CType current, CType value) {
+    return value < current ? value : current;
+  }
+  static CType Max(CType current, CType value) {
+    return current < value ? value : current;
+  }
+
+  CType mins_[kLanes];
+  CType maxs_[kLanes];
+};
+
+// Accumulates the min and max of other types with CompareHelper
+template <typename DType, bool is_signed>
+class MinMaxAccumulator<DType, is_signed, void> {
+ public:
+  using T = typename DType::c_type;
+  using Helper = CompareHelper<DType, is_signed>;
+
+  explicit MinMaxAccumulator(int type_length)
+      : type_length_(type_length),
+        min_(Helper::DefaultMin()),
+        max_(Helper::DefaultMax()) {}
+
+  void Update(const T* values, int64_t length) {
+    for (int64_t i = 0; i < length; i++) {
+      UpdateOne(values[i]);
+    }
+  }
+
+  void UpdateOne(const T& value) {
+    min_ = Helper::Min(type_length_, min_, Helper::Coalesce(value, Helper::DefaultMin()));
+    max_ = Helper::Max(type_length_, max_, Helper::Coalesce(value, Helper::DefaultMax()));
+  }
+
+  std::pair<T, T> Finish() const { return {min_, max_}; }
+
+ private:
+  int type_length_;
+  T min_;
+  T max_;
+};
+
 template <bool is_signed, typename DType>
 class TypedComparatorImpl : virtual public TypedComparator<DType> {
  public:
@@ -275,16 +412,9 @@ class TypedComparatorImpl : virtual public TypedComparator<DType> {
   std::pair<T, T> GetMinMax(const T* values, int64_t length) override {
     DCHECK_GT(length, 0);
 
-    T min = Helper::DefaultMin();
-    T max = Helper::DefaultMax();
-
-    for (int64_t i = 0; i < length; i++) {
-      auto val = values[i];
-      min = Helper::Min(type_length_, min, Helper::Coalesce(val, Helper::DefaultMin()));
-      max = Helper::Max(type_length_, max, Helper::Coalesce(val, Helper::DefaultMax()));
-    }
-
-    return {min, max};
+    MinMaxAccumulator<DType, is_signed> accumulator(type_length_);
+    accumulator.Update(values, length);
+    return accumulator.Finish();
   }
 
   std::pair<T, T> GetMinMaxSpaced(const T* values, int64_t length,
@@ -292,19 +422,24 @@ class TypedComparatorImpl : virtual public TypedComparator<DType> {
                                   int64_t valid_bits_offset) override {
     DCHECK_GT(length, 0);
 
-    T min = Helper::DefaultMin();
-    T max = Helper::DefaultMax();
-
-    ::arrow::internal::BitmapReader reader(valid_bits, valid_bits_offset, length);
-    for (int64_t i = 0; i < length; i++, reader.Next()) {
-      if (reader.IsSet()) {
-        auto val = values[i];
-        min = Helper::Min(type_length_, min, Helper::Coalesce(val, Helper::DefaultMin()));
-        max = Helper::Max(type_length_, max, Helper::Coalesce(val, Helper::DefaultMax()));
+    MinMaxAccumulator<DType, is_signed> accumulator(type_length_);
+    // Runs of valid values are accumulated as a whole
+    ::arrow::internal::BitBlockCounter counter(valid_bits, valid_bits_offset, length);
+    int64_t position = 0;
+    while (position < length) {
+      const ::arrow::internal::BitBlockCount block = counter.NextFourWords();
+      if (block.AllSet()) {
+        accumulator.Update(values + position, block.length);
+      } else if (!block.NoneSet()) {
+        for (int64_t i = position; i < position + block.length; ++i) {
+          if (::arrow::BitUtil::GetBit(valid_bits, valid_bits_offset + i)) {
+            accumulator.UpdateOne(values[i]);
+          }
+        }
       }
+      position += block.length;
     }
-
-    return {min, max};
+    return accumulator.Finish();
   }
 
   std::pair<T, T> GetMinMax(const ::arrow::Array& values) override;
@@ -24,10 +24,13 @@
 #include <cstring>
 #include <limits>
 #include <memory>
+#include <random>
 #include <vector>
 
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
+#include "arrow/util/ubsan.h"
 
 #include "parquet/column_reader.h"
 #include "parquet/column_writer.h"
@@ -989,6 +992,79 @@ TEST(TestStatistic, NaNFloatValues) { CheckNaNs<FloatType>(); }
 
 TEST(TestStatistic, NaNDoubleValues) { CheckNaNs<DoubleType>(); }
 
+// Min/max of enough values to fill the vectorized lanes several times,
+// against a scalar scan in the sort order of the column
+template <typename ParquetType, typename CType>
+void CheckManyValuesMinMax(ConvertedType::type converted_type = ConvertedType::NONE) {
+  using T = typename ParquetType::c_type;
+
+  constexpr int64_t kNumValues = 1000;
+  NodePtr node = PrimitiveNode::Make("f", Repetition::OPTIONAL, ParquetType::type_num,
+                                     converted_type);
+  ColumnDescriptor descr(node, 1, 1);
+  auto comparator = MakeComparator<ParquetType>(&descr);
+
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int64_t> value_dist(-1000000, 1000000);
+  std::bernoulli_distribution valid_dist(0.8);
+  std::vector<T> values(kNumValues);
+  std::vector<uint8_t> valid_bits(::arrow::BitUtil::BytesForBits(kNumValues), 0);
+  for (int64_t i = 0; i < kNumValues; ++i) {
+    values[i] = static_cast<T>(value_dist(gen));
+    // Long runs of valid values, then a mix of valid and null values
+    if (i < kNumValues / 2 || valid_dist(gen)) {
+      ::arrow::BitUtil::SetBit(valid_bits.data(), i);
+    }
+  }
+  if (std::is_floating_point<T>::value) {
+    for (int64_t i = 0; i < kNumValues; i += 7) {
+      values[i] = std::numeric_limits<T>::quiet_NaN();
+    }
+  }
+
+  auto expected_min_max = [&](int64_t offset, int64_t length, bool spaced) {
+    CType min = std::numeric_limits<CType>::max();
+    CType max = std::numeric_limits<CType>::lowest();
+    for (int64_t i = offset; i < offset + length; ++i) {
+      const auto value = ::arrow::util::SafeCopy<CType>(values[i]);
+      // Skip nulls and NaNs
+      if ((spaced && !::arrow::BitUtil::GetBit(valid_bits.data(), i)) ||
+          value != value) {
+        continue;
+      }
+      min = std::min(min, value);
+      max = std::max(max, value);
+    }
+    return std::make_pair(min, max);
+  };
+
+  for (int64_t offset : {0, 3}) {
+    for (int64_t length : {1, 7, 17, 64, 100, 257, 997}) {
+      SCOPED_TRACE("offset = " + std::to_string(offset) +
+                   ", length = " + std::to_string(length));
+      auto min_max = comparator->GetMinMax(values.data() + offset, length);
+      auto expected = expected_min_max(offset, length, /*spaced=*/false);
+      ASSERT_EQ(::arrow::util::SafeCopy<CType>(min_max.first), expected.first);
+      ASSERT_EQ(::arrow::util::SafeCopy<CType>(min_max.second), expected.second);
+
+      min_max = comparator->GetMinMaxSpaced(values.data() + offset, length,
+                                            valid_bits.data(), offset);
+      expected = expected_min_max(offset, length, /*spaced=*/true);
+      ASSERT_EQ(::arrow::util::SafeCopy<CType>(min_max.first), expected.first);
+      ASSERT_EQ(::arrow::util::SafeCopy<CType>(min_max.second), expected.second);
+    }
+  }
+}
+
+TEST(TestStatistic, ManyValuesMinMax) {
+  CheckManyValuesMinMax<Int32Type, int32_t>();
+  CheckManyValuesMinMax<Int32Type, uint32_t>(ConvertedType::UINT_32);
+  CheckManyValuesMinMax<Int64Type, int64_t>();
+  CheckManyValuesMinMax<Int64Type, uint64_t>(ConvertedType::UINT_64);
+  CheckManyValuesMinMax<FloatType, float>();
+  CheckManyValuesMinMax<DoubleType, double>();
+}
+
 // ARROW-7376
 TEST(TestStatisticsSortOrderFloatNaN, NaNAndNullsInfiniteLoop) {
   constexpr int kNumValues = 8;
@@ -17,12 +17,13 @@
 
 #include "parquet/stream_reader.h"
 
+#include <algorithm>
 #include <set>
 #include <utility>
 
 namespace parquet {
 
-constexpr int64_t StreamReader::kBatchSizeOne;
+constexpr int64_t StreamReader::kDefaultReadBatchSize;
 
 // The converted type expected by the stream reader does not always
 // exactly match with the schema in the Parquet file.  The following
@@ -73,6 +74,14 @@ int64_t StreamReader::num_rows() const {
   return 0;
 }
 
+void StreamReader::SetReadBatchSize(int64_t batch_size) {
+  if (batch_size <= 0) {
+    throw ParquetException("Read batch size must be positive, got " +
+                           std::to_string(batch_size));
+  }
+  read_batch_size_ = batch_size;
+}
+
 StreamReader& StreamReader::operator>>(bool& v) {
   CheckColumn(Type::BOOLEAN, ConvertedType::NONE);
   Read<BoolReader>(&v);
@@ -282,68 +291,28 @@ void StreamReader::ReadFixedLength(char* ptr, int len) {
   std::memcpy(ptr, flba.ptr, len);
 }
 
-void StreamReader::Read(ByteArray* v) {
-  const auto& node = nodes_[column_index_];
-  auto reader = static_cast<ByteArrayReader*>(column_readers_[column_index_++].get());
-  int16_t def_level;
-  int16_t rep_level;
-  int64_t values_read;
-
-  reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
-
-  if (values_read != 1) {
-    ThrowReadFailedException(node);
-  }
-}
+void StreamReader::Read(ByteArray* v) { Read<ByteArrayReader>(v); }
 
 bool StreamReader::ReadOptional(ByteArray* v) {
-  const auto& node = nodes_[column_index_];
-  auto reader = static_cast<ByteArrayReader*>(column_readers_[column_index_++].get());
-  int16_t def_level;
-  int16_t rep_level;
-  int64_t values_read;
+  const auto value = ReadNext<ByteArrayReader>();
 
-  reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
-
-  if (values_read == 1) {
+  if (value != NULLPTR) {
+    *v = *value;
     return true;
-  } else if ((values_read == 0) && (def_level == 0)) {
-    return false;
   }
-  ThrowReadFailedException(node);
+  return false;
 }
 
-void StreamReader::Read(FixedLenByteArray* v) {
-  const auto& node = nodes_[column_index_];
-  auto reader =
-      static_cast<FixedLenByteArrayReader*>(column_readers_[column_index_++].get());
-  int16_t def_level;
-  int16_t rep_level;
-  int64_t values_read;
-
-  reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
-
-  if (values_read != 1) {
-    ThrowReadFailedException(node);
-  }
-}
+void StreamReader::Read(FixedLenByteArray* v) { Read<FixedLenByteArrayReader>(v); }
 
 bool StreamReader::ReadOptional(FixedLenByteArray* v) {
-  const auto& node = nodes_[column_index_];
-  auto reader =
-      static_cast<FixedLenByteArrayReader*>(column_readers_[column_index_++].get());
-  int16_t def_level;
-  int16_t rep_level;
-  int64_t values_read;
-
-  reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
+  const auto value = ReadNext<FixedLenByteArrayReader>();
 
-  if (values_read == 1) {
+  if (value != NULLPTR) {
+    *v = *value;
     return true;
-  } else if ((values_read == 0) && (def_level == 0)) {
-    return false;
   }
-  ThrowReadFailedException(node);
+  return false;
 }
 
 void StreamReader::EndRow() {
@@ -357,7 +326,8 @@ void StreamReader::EndRow() {
   column_index_ = 0;
   ++current_row_;
 
-  if (!column_readers_[0]->HasNext()) {
+  const ColumnBuffer& buffer = column_buffers_[0];
+  if (buffer.level_index == buffer.num_levels && !column_readers_[0]->HasNext()) {
     NextRowGroup();
   }
 }
@@ -369,6 +339,7 @@ void StreamReader::NextRowGroup() {
     ++row_group_index_;
 
     column_readers_.resize(file_metadata_->num_columns());
+    column_buffers_.assign(file_metadata_->num_columns(), ColumnBuffer{});
 
     for (int i = 0; i < file_metadata_->num_columns(); ++i) {
       column_readers_[i] = row_group_reader_->Column(i);
@@ -389,6 +360,7 @@ void StreamReader::SetEof() {
   file_reader_.reset();
   row_group_reader_.reset();
   column_readers_.clear();
+  column_buffers_.clear();
   nodes_.clear();
 }
 
@@ -404,8 +376,8 @@ int64_t StreamReader::SkipRows(int64_t num_rows_to_skip) {
         num_rows_in_row_group - current_row_ - row_group_row_offset_;
 
     if (num_rows_remaining_in_row_group > num_rows_remaining_to_skip) {
-      for (auto reader : column_readers_) {
-        SkipRowsInColumn(reader.get(), num_rows_remaining_to_skip);
+      for (int i = 0; i < static_cast<int>(column_readers_.size()); ++i) {
+        SkipRowsInColumn(i, num_rows_remaining_to_skip);
       }
       current_row_ += num_rows_remaining_to_skip;
       num_rows_remaining_to_skip = 0;
@@ -425,14 +397,35 @@ int64_t StreamReader::SkipColumns(int64_t num_columns_to_skip) {
     for (; (num_columns_to_skip > num_columns_skipped) &&
            static_cast<std::size_t>(column_index_) < nodes_.size();
          ++column_index_) {
-      SkipRowsInColumn(column_readers_[column_index_].get(), 1);
+      SkipRowsInColumn(column_index_, 1);
       ++num_columns_skipped;
     }
   }
   return num_columns_skipped;
 }
 
-void StreamReader::SkipRowsInColumn(ColumnReader* reader, int64_t num_rows_to_skip) {
+void StreamReader::SkipRowsInColumn(int column, int64_t num_rows_to_skip) {
+  // Consume the buffered values first.
+  ColumnBuffer& buffer = column_buffers_[column];
+  const int64_t num_buffered_to_skip =
+      std::min(num_rows_to_skip, buffer.num_levels - buffer.level_index);
+
+  if (buffer.def_levels.empty()) {
+    buffer.value_index += num_buffered_to_skip;
+  } else {
+    for (int64_t i = 0; i < num_buffered_to_skip; ++i) {
+      if (buffer.def_levels[buffer.level_index + i] == buffer.max_def_level) {
+        ++buffer.value_index;
+      }
+    }
+  }
+  buffer.level_index += num_buffered_to_skip;
+  num_rows_to_skip -= num_buffered_to_skip;
+
+  if (num_rows_to_skip == 0) {
+    return;
+  }
+  ColumnReader* reader = column_readers_[column].get();
   int64_t num_skipped = 0;
 
   switch (reader->type()) {
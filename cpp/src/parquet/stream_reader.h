@@ -79,6 +79,17 @@ class PARQUET_EXPORT StreamReader {
 
   int64_t num_rows() const;
 
+  /// \brief Set the number of values decoded at once for each column.
+  ///
+  /// Values are decoded in batches and then handed out one at a time
+  /// by the input operators, so a larger batch trades memory for
+  /// fewer calls into the column readers.  A batch never spans data
+  /// pages, so fewer values may be decoded.  Takes effect the next
+  /// time a column's buffered values are exhausted.
+  void SetReadBatchSize(int64_t batch_size);
+
+  int64_t read_batch_size() const { return read_batch_size_; }
+
   // Moving is possible.
   StreamReader(StreamReader&&) = default;
   StreamReader& operator=(StreamReader&&) = default;
@@ -205,56 +216,74 @@ class PARQUET_EXPORT StreamReader {
   [[noreturn]] void ThrowReadFailedException(
       const std::shared_ptr<schema::PrimitiveNode>& node);
 
-  template <typename ReaderType, typename T>
-  void Read(T* v) {
-    const auto& node = nodes_[column_index_];
-    auto reader = static_cast<ReaderType*>(column_readers_[column_index_++].get());
-    int16_t def_level;
-    int16_t rep_level;
-    int64_t values_read;
+  /// \brief Return the next value of the current column and advance
+  /// to the next column, or nullptr if the value is null.
+  ///
+  /// Values are decoded from the column reader in batches of up to
+  /// read_batch_size() rows and served from the column's buffer.
+  template <typename ReaderType>
+  const typename ReaderType::T* ReadNext() {
+    using ValueType = typename ReaderType::T;
+
+    const int column = column_index_++;
+    ColumnBuffer& buffer = column_buffers_[column];
 
-    reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
+    if (buffer.level_index == buffer.num_levels) {
+      FillBuffer<ReaderType>(column);
+    }
+    const int16_t def_level = buffer.def_levels.empty()
+                                  ? buffer.max_def_level
+                                  : buffer.def_levels[buffer.level_index];
+    ++buffer.level_index;
 
-    if (values_read != 1) {
-      ThrowReadFailedException(node);
+    if (def_level < buffer.max_def_level) {
+      return NULLPTR;
     }
+    return reinterpret_cast<const ValueType*>(buffer.values.data()) +
+           buffer.value_index++;
   }
 
-  template <typename ReaderType, typename ReadType, typename T>
-  void Read(T* v) {
-    const auto& node = nodes_[column_index_];
-    auto reader = static_cast<ReaderType*>(column_readers_[column_index_++].get());
-    int16_t def_level;
-    int16_t rep_level;
-    ReadType tmp;
+  template <typename ReaderType>
+  void FillBuffer(int column) {
+    using ValueType = typename ReaderType::T;
+
+    auto reader = static_cast<ReaderType*>(column_readers_[column].get());
+    ColumnBuffer& buffer = column_buffers_[column];
+
+    buffer.max_def_level = reader->descr()->max_definition_level();
+    buffer.def_levels.resize(buffer.max_def_level > 0 ? read_batch_size_ : 0);
+    buffer.values.resize(read_batch_size_ * sizeof(ValueType));
+
     int64_t values_read;
+    buffer.num_levels = reader->ReadBatch(
+        read_batch_size_, buffer.max_def_level > 0 ? buffer.def_levels.data() : NULLPTR,
+        NULLPTR, reinterpret_cast<ValueType*>(buffer.values.data()), &values_read);
+    buffer.level_index = 0;
+    buffer.value_index = 0;
+
+    if (buffer.num_levels == 0) {
+      ThrowReadFailedException(nodes_[column]);
+    }
+  }
 
-    reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, &tmp, &values_read);
+  template <typename ReaderType, typename ReadType = typename ReaderType::T, typename T>
+  void Read(T* v) {
+    const auto value = ReadNext<ReaderType>();
 
-    if (values_read == 1) {
-      *v = tmp;
-    } else {
-      ThrowReadFailedException(node);
+    if (value == NULLPTR) {
+      ThrowReadFailedException(nodes_[column_index_ - 1]);
     }
+    *v = static_cast<T>(static_cast<ReadType>(*value));
   }
 
   template <typename ReaderType, typename ReadType = typename ReaderType::T, typename T>
   void ReadOptional(optional<T>* v) {
-    const auto& node = nodes_[column_index_];
-    auto reader = static_cast<ReaderType*>(column_readers_[column_index_++].get());
-    int16_t def_level;
-    int16_t rep_level;
-    ReadType tmp;
-    int64_t values_read;
-
-    reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, &tmp, &values_read);
+    const auto value = ReadNext<ReaderType>();
 
-    if (values_read == 1) {
-      *v = T(tmp);
-    } else if ((values_read == 0) && (def_level == 0)) {
-      v->reset();
+    if (value != NULLPTR) {
+      *v = T(static_cast<ReadType>(*value));
     } else {
-      ThrowReadFailedException(node);
+      v->reset();
     }
   }
 
@@ -273,24 +302,37 @@ class PARQUET_EXPORT StreamReader {
   void CheckColumn(Type::type physical_type, ConvertedType::type converted_type,
                    int length = 0);
 
-  void SkipRowsInColumn(ColumnReader* reader, int64_t num_rows_to_skip);
+  void SkipRowsInColumn(int column, int64_t num_rows_to_skip);
 
   void SetEof();
 
  private:
+  // Decoded values of a single column which have not been consumed
+  // yet.  Only flat schemas are supported, so each level is one row.
+  struct ColumnBuffer {
+    std::vector<int16_t> def_levels;
+    std::vector<uint8_t> values;
+    int16_t max_def_level = 0;
+    int64_t num_levels = 0;
+    int64_t level_index = 0;
+    int64_t value_index = 0;
+  };
+
   std::unique_ptr<ParquetFileReader> file_reader_;
   std::shared_ptr<FileMetaData> file_metadata_;
   std::shared_ptr<RowGroupReader> row_group_reader_;
   std::vector<std::shared_ptr<ColumnReader>> column_readers_;
   std::vector<std::shared_ptr<schema::PrimitiveNode>> nodes_;
+  std::vector<ColumnBuffer> column_buffers_;
 
   bool eof_{true};
   int row_group_index_{0};
   int column_index_{0};
   int64_t current_row_{0};
   int64_t row_group_row_offset_{0};
+  int64_t read_batch_size_{kDefaultReadBatchSize};
 
-  static constexpr int64_t kBatchSizeOne = 1;
+  static constexpr int64_t kDefaultReadBatchSize = 1024;
 };  // namespace parquet
 
 PARQUET_EXPORT
@@ -341,6 +341,47 @@ TEST_F(TestStreamReader, ValueChecking) {
   EXPECT_EQ(i, TestData::num_rows);
 }
 
+TEST_F(TestStreamReader, ReadBatchSizes) {
+  std::string str;
+  int32_t int32;
+  double d;
+
+  for (int64_t batch_size : {1, 7, 1024, 4096}) {
+    SetUp();
+    reader_.SetReadBatchSize(batch_size);
+    EXPECT_EQ(batch_size, reader_.read_batch_size());
+
+    int i;
+
+    for (i = 0; !reader_.eof(); ++i) {
+      EXPECT_EQ(i, reader_.current_row());
+
+      if (i % 5 == 4) {
+        // Skip part of the buffered values.
+        EXPECT_EQ(1, reader_.SkipRows(1));
+        ++i;
+        if (reader_.eof()) {
+          break;
+        }
+      }
+      EXPECT_EQ(1, reader_.SkipColumns(1));
+      reader_ >> str;
+      EXPECT_EQ(4, reader_.SkipColumns(4));
+      reader_ >> int32;
+      EXPECT_EQ(3, reader_.SkipColumns(3));
+      reader_ >> d;
+      reader_ >> EndRow;
+
+      EXPECT_EQ(str, TestData::GetString(i)) << "index: " << i;
+      EXPECT_EQ(int32, TestData::GetInt32(i)) << "index: " << i;
+      EXPECT_DOUBLE_EQ(d, TestData::GetDouble(i)) << "index: " << i;
+    }
+    EXPECT_EQ(reader_.current_row(), TestData::num_rows);
+    EXPECT_EQ(i, TestData::num_rows);
+  }
+  EXPECT_THROW(reader_.SetReadBatchSize(0), ParquetException);
+}
+
 TEST_F(TestStreamReader, ReadRequiredFieldAsOptionalField) {
   /* Test that required fields can be read using optional types.
 
@@ -28,6 +28,7 @@
 #include <memory>
 #endif
 #include <string>
+#include <utility>
 #include <vector>
 
 // TCompactProtocol requires some #defines to work right.
@@ -355,20 +356,26 @@ static inline format::EncryptionAlgorithm ToThrift(EncryptionAlgorithm encryptio
 
 using ThriftBuffer = apache::thrift::transport::TMemoryBuffer;
 
-template <class T>
-inline void DeserializeThriftUnencryptedMsg(const uint8_t* buf, uint32_t* len,
-                                            T* deserialized_msg) {
-  // Deserialize msg bytes into c++ thrift msg using memory transport.
-  shared_ptr<ThriftBuffer> tmem_transport(
-      new ThriftBuffer(const_cast<uint8_t*>(buf), *len));
+// Create a compact protocol reading thrift messages from a memory transport.
+inline shared_ptr<apache::thrift::protocol::TProtocol> CreateThriftReadProtocol(
+    const shared_ptr<ThriftBuffer>& tmem_transport) {
   apache::thrift::protocol::TCompactProtocolFactoryT<ThriftBuffer> tproto_factory;
   // Protect against CPU and memory bombs
   tproto_factory.setStringSizeLimit(100 * 1000 * 1000);
   // Structs in the thrift definition are relatively large (at least 300 bytes).
   // This limits total memory to the same order of magnitude as stringSize.
   tproto_factory.setContainerSizeLimit(1000 * 1000);
+  return tproto_factory.getProtocol(tmem_transport);
+}
+
+template <class T>
+inline void DeserializeThriftUnencryptedMsg(const uint8_t* buf, uint32_t* len,
+                                            T* deserialized_msg) {
+  // Deserialize msg bytes into c++ thrift msg using memory transport.
+  shared_ptr<ThriftBuffer> tmem_transport(
+      new ThriftBuffer(const_cast<uint8_t*>(buf), *len));
   shared_ptr<apache::thrift::protocol::TProtocol> tproto =  //
-      tproto_factory.getProtocol(tmem_transport);
+      CreateThriftReadProtocol(tmem_transport);
   try {
     deserialized_msg->read(tproto.get());
   } catch (std::exception& e) {
@@ -380,6 +387,29 @@ inline void DeserializeThriftUnencryptedMsg(const uint8_t* buf, uint32_t* len,
   *len = *len - bytes_left;
 }
 
+// Decrypt an encrypted thrift message from buf/len.  On return, len will be set
+// to the length of the encrypted message and decrypted_len to the length of the
+// plaintext at the start of the returned buffer.
+inline std::shared_ptr<ResizableBuffer> DecryptThriftMsg(
+    const uint8_t* buf, uint32_t* len, uint32_t* decrypted_len,
+    const std::shared_ptr<Decryptor>& decryptor) {
+  uint32_t clen;
+  clen = *len;
+  std::shared_ptr<ResizableBuffer> decrypted_buffer =
+      std::static_pointer_cast<ResizableBuffer>(AllocateBuffer(
+          decryptor->pool(),
+          static_cast<int64_t>(clen - decryptor->CiphertextSizeDelta())));
+  const uint8_t* cipher_buf = buf;
+  uint32_t decrypted_buffer_len =
+      decryptor->Decrypt(cipher_buf, 0, decrypted_buffer->mutable_data());
+  if (decrypted_buffer_len <= 0) {
+    throw ParquetException("Couldn't decrypt buffer\n");
+  }
+  *len = decrypted_buffer_len + decryptor->CiphertextSizeDelta();
+  *decrypted_len = decrypted_buffer_len;
+  return decrypted_buffer;
+}
+
 // Deserialize a thrift message from buf/len.  buf/len must at least contain
 // all the bytes needed to store the thrift message.  On return, len will be
 // set to the actual length of the header.
@@ -390,25 +420,88 @@ inline void DeserializeThriftMsg(const uint8_t* buf, uint32_t* len, T* deseriali
   if (decryptor == NULLPTR) {
     DeserializeThriftUnencryptedMsg(buf, len, deserialized_msg);
   } else {  // thrift message is encrypted
-    uint32_t clen;
-    clen = *len;
-    // decrypt
+    uint32_t decrypted_buffer_len;
     std::shared_ptr<ResizableBuffer> decrypted_buffer =
-        std::static_pointer_cast<ResizableBuffer>(AllocateBuffer(
-            decryptor->pool(),
-            static_cast<int64_t>(clen - decryptor->CiphertextSizeDelta())));
-    const uint8_t* cipher_buf = buf;
-    uint32_t decrypted_buffer_len =
-        decryptor->Decrypt(cipher_buf, 0, decrypted_buffer->mutable_data());
-    if (decrypted_buffer_len <= 0) {
-      throw ParquetException("Couldn't decrypt buffer\n");
-    }
-    *len = decrypted_buffer_len + decryptor->CiphertextSizeDelta();
+        DecryptThriftMsg(buf, len, &decrypted_buffer_len, decryptor);
     DeserializeThriftMsg(decrypted_buffer->data(), &decrypted_buffer_len,
                          deserialized_msg);
   }
 }
 
+// Scan the thrift struct in buf/len without decoding it and record the byte
+// ranges (offset, length) of the elements of its list<struct> field field_id.
+// Returns a copy of the struct in which that list is empty, so that the rest of
+// the struct can be deserialized without paying for the elements, which can then
+// be deserialized one by one from their ranges.  On return, len will be set to
+// the actual length of the struct.
+inline std::string ScanThriftListField(
+    const uint8_t* buf, uint32_t* len, int16_t field_id,
+    std::vector<std::pair<uint32_t, uint32_t>>* element_ranges) {
+  using apache::thrift::protocol::TType;
+  // Compact protocol header of an empty list of structs: size 0, element type 12
+  constexpr char kEmptyStructListHeader = 0x0C;
+
+  shared_ptr<ThriftBuffer> tmem_transport(
+      new ThriftBuffer(const_cast<uint8_t*>(buf), *len));
+  shared_ptr<apache::thrift::protocol::TProtocol> tproto =  //
+      CreateThriftReadProtocol(tmem_transport);
+  auto position = [&]() { return *len - tmem_transport->available_read(); };
+
+  uint32_t list_begin = 0;
+  uint32_t list_end = 0;
+  element_ranges->clear();
+  try {
+    std::string name;
+    TType field_type;
+    int16_t id;
+    tproto->readStructBegin(name);
+    while (true) {
+      tproto->readFieldBegin(name, field_type, id);
+      if (field_type == apache::thrift::protocol::T_STOP) {
+        break;
+      }
+      if (id != field_id || field_type != apache::thrift::protocol::T_LIST) {
+        apache::thrift::protocol::skip(*tproto, field_type);
+        tproto->readFieldEnd();
+        continue;
+      }
+      list_begin = position();
+      TType element_type;
+      uint32_t size;
+      tproto->readListBegin(element_type, size);
+      if (element_type != apache::thrift::protocol::T_STRUCT) {
+        throw ParquetException("Expected a list of structs");
+      }
+      element_ranges->reserve(size);
+      for (uint32_t i = 0; i < size; ++i) {
+        const uint32_t element_begin = position();
+        apache::thrift::protocol::skip(*tproto, apache::thrift::protocol::T_STRUCT);
+        element_ranges->emplace_back(element_begin, position() - element_begin);
+      }
+      tproto->readListEnd();
+      list_end = position();
+      tproto->readFieldEnd();
+    }
+    tproto->readStructEnd();
+  } catch (std::exception& e) {
+    std::stringstream ss;
+    ss << "Couldn't deserialize thrift: " << e.what() << "\n";
+    throw ParquetException(ss.str());
+  }
+  *len = position();
+
+  const char* data = reinterpret_cast<const char*>(buf);
+  if (list_end == 0) {
+    return std::string(data, *len);
+  }
+  std::string result;
+  result.reserve(*len - (list_end - list_begin) + 1);
+  result.append(data, list_begin);
+  result.push_back(kEmptyStructListHeader);
+  result.append(data + list_end, *len - list_end);
+  return result;
+}
+
 /// Utility class to serialize thrift objects to a binary format.  This object
 /// should be reused if possible to reuse the underlying memory.
 /// Note: thrift will encode NULLs into the serialized buffer so it is not valid
@@ -38,6 +38,8 @@
 
 #include <algorithm>
 #include <deque>
+#include <iterator>
+#include <list>
 #include <mutex>
 #include <tuple>
 #include <unordered_map>
@@ -166,6 +168,9 @@ struct ObjectInUseEntry {
   PlasmaObject object;
   /// A flag representing whether the object has been sealed.
   bool is_sealed;
+  /// If count is zero, the position of the object in the list of released
+  /// objects that are kept for later Get calls.
+  std::list<ObjectID>::iterator released_position;
 };
 
 class ClientMmapTableEntry {
@@ -224,6 +229,8 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
   Status SetClientOptions(const std::string& client_name, int64_t output_memory_quota);
 
+  Status SetReleasedObjectCacheSize(int64_t num_bytes);
+
   Status Create(const ObjectID& object_id, int64_t data_size, const uint8_t* metadata,
                 int64_t metadata_size, std::shared_ptr<Buffer>* data, int device_num = 0,
                 bool evict_if_full = true);
@@ -252,6 +259,8 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
   Status Seal(const ObjectID& object_id);
 
+  Status Seal(const std::vector<ObjectID>& object_ids);
+
   Status Delete(const std::vector<ObjectID>& object_ids);
 
   Status Evict(int64_t num_bytes, int64_t& num_bytes_evicted);
@@ -292,6 +301,20 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
   /// \return The return status.
   Status MarkObjectUnused(const ObjectID& object_id);
 
+  /// Keep an object that is no longer used for later Get calls, and tell the
+  /// store that the least recently released objects are no longer needed when
+  /// they take more than released_object_cache_size_ bytes.
+  ///
+  /// \param object_id The object ID whose count dropped to zero.
+  /// \return The return status.
+  Status CacheReleasedObject(const ObjectID& object_id);
+
+  /// Tell the store that a released object that was kept is no longer needed.
+  ///
+  /// \param object_id The object ID of the kept object.
+  /// \return The return status.
+  Status EvictReleasedObject(const ObjectID& object_id);
+
   /// Common helper for Get() variants
   Status GetBuffers(const ObjectID* object_ids, int64_t num_objects, int64_t timeout_ms,
                     const std::function<std::shared_ptr<Buffer>(
@@ -332,6 +355,13 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
   int64_t store_capacity_;
   /// A hash set to record the ids that users want to delete but still in use.
   std::unordered_set<ObjectID> deletion_cache_;
+  /// The objects that were released but are still referenced in the store,
+  /// from the least to the most recently released, and their total size. They
+  /// stay in objects_in_use_ with a count of zero.
+  std::list<ObjectID> released_objects_;
+  int64_t released_object_bytes_ = 0;
+  /// The maximum number of bytes of released objects that are kept.
+  int64_t released_object_cache_size_ = 0;
   /// A queue of notification
   std::deque<std::tuple<ObjectID, int64_t, int64_t>> pending_notification_;
   /// A mutex which protects this class.
@@ -370,7 +400,7 @@ bool PlasmaClient::Impl::IsInUse(const ObjectID& object_id) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
   const auto elem = objects_in_use_.find(object_id);
-  return (elem != objects_in_use_.end());
+  return (elem != objects_in_use_.end() && elem->second->count > 0);
 }
 
 int PlasmaClient::Impl::GetStoreFd(int store_fd) {
@@ -401,7 +431,12 @@ void PlasmaClient::Impl::IncrementObjectCount(const ObjectID& object_id,
     object_entry = objects_in_use_[object_id].get();
   } else {
     object_entry = elem->second.get();
-    ARROW_CHECK(object_entry->count > 0);
+    if (object_entry->count == 0) {
+      // The object was released and kept, so it is in use again.
+      released_objects_.erase(object_entry->released_position);
+      released_object_bytes_ -=
+          object_entry->object.data_size + object_entry->object.metadata_size;
+    }
   }
   // Increment the count of the number of instances of this object that are
   // being used by this client. The corresponding decrement should happen in
@@ -522,8 +557,8 @@ Status PlasmaClient::Impl::CreateAndSealBatch(const std::vector<ObjectID>& objec
     // Compute the object hash.
     std::string digest;
     uint64_t hash = ComputeObjectHashCPU(
-        reinterpret_cast<const uint8_t*>(data.data()), data.size(),
-        reinterpret_cast<const uint8_t*>(metadata.data()), metadata.size());
+        reinterpret_cast<const uint8_t*>(data[i].data()), data[i].size(),
+        reinterpret_cast<const uint8_t*>(metadata[i].data()), metadata[i].size());
     digest.assign(reinterpret_cast<char*>(&hash), sizeof(hash));
     digests.push_back(digest);
   }
@@ -543,14 +578,17 @@ Status PlasmaClient::Impl::GetBuffers(
     const std::function<std::shared_ptr<Buffer>(
         const ObjectID&, const std::shared_ptr<Buffer>&)>& wrap_buffer,
     ObjectBuffer* object_buffers) {
-  // Fill out the info for the objects that are already in use locally.
-  bool all_present = true;
+  // Fill out the info for the objects that are already in use locally, or were
+  // released but kept.
+  std::vector<ObjectID> missing_ids;
+  std::vector<int64_t> missing_indices;
   for (int64_t i = 0; i < num_objects; ++i) {
     auto object_entry = objects_in_use_.find(object_ids[i]);
     if (object_entry == objects_in_use_.end()) {
       // This object is not currently in use by this client, so we need to send
       // a request to the store.
-      all_present = false;
+      missing_ids.push_back(object_ids[i]);
+      missing_indices.push_back(i);
     } else if (!object_entry->second->is_sealed) {
       // This client created the object but hasn't sealed it. If we call Get
       // with no timeout, we will deadlock, because this client won't be able to
@@ -559,7 +597,8 @@ Status PlasmaClient::Impl::GetBuffers(
           << "Plasma client called get on an unsealed object that it created";
       ARROW_LOG(WARNING)
           << "Attempting to get an object that this client created but hasn't sealed.";
-      all_present = false;
+      missing_ids.push_back(object_ids[i]);
+      missing_indices.push_back(i);
     } else {
       PlasmaObject* object = &object_entry->second->object;
       std::shared_ptr<Buffer> physical_buf;
@@ -590,22 +629,23 @@ Status PlasmaClient::Impl::GetBuffers(
     }
   }
 
-  if (all_present) {
+  if (missing_ids.empty()) {
     return Status::OK();
   }
 
   // If we get here, then the objects aren't all currently in use by this
-  // client, so we need to send a request to the plasma store.
-  RETURN_NOT_OK(SendGetRequest(store_conn_, &object_ids[0], num_objects, timeout_ms));
+  // client, so we need to send a request to the plasma store for the others.
+  const int64_t num_missing = static_cast<int64_t>(missing_ids.size());
+  RETURN_NOT_OK(SendGetRequest(store_conn_, missing_ids.data(), num_missing, timeout_ms));
   std::vector<uint8_t> buffer;
   RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaGetReply, &buffer));
-  std::vector<ObjectID> received_object_ids(num_objects);
-  std::vector<PlasmaObject> object_data(num_objects);
+  std::vector<ObjectID> received_object_ids(num_missing);
+  std::vector<PlasmaObject> object_data(num_missing);
   PlasmaObject* object;
   std::vector<int> store_fds;
   std::vector<int64_t> mmap_sizes;
   RETURN_NOT_OK(ReadGetReply(buffer.data(), buffer.size(), received_object_ids.data(),
-                             object_data.data(), num_objects, store_fds, mmap_sizes));
+                             object_data.data(), num_missing, store_fds, mmap_sizes));
 
   // We mmap all of the file descriptors here so that we can avoid look them up
   // in the subsequent loop based on just the store file descriptor and without
@@ -615,19 +655,12 @@ Status PlasmaClient::Impl::GetBuffers(
     LookupOrMmap(fd, store_fds[i], mmap_sizes[i]);
   }
 
-  for (int64_t i = 0; i < num_objects; ++i) {
-    DCHECK(received_object_ids[i] == object_ids[i]);
-    object = &object_data[i];
-    if (object_buffers[i].data) {
-      // If the object was already in use by the client, then the store should
-      // have returned it.
-      DCHECK_NE(object->data_size, -1);
-      // We've already filled out the information for this object, so we can
-      // just continue.
-      continue;
-    }
-    // If we are here, the object was not currently in use, so we need to
-    // process the reply from the object store.
+  for (int64_t j = 0; j < num_missing; ++j) {
+    const int64_t i = missing_indices[j];
+    DCHECK(received_object_ids[j] == object_ids[i]);
+    object = &object_data[j];
+    // The object was not currently in use, so we need to process the reply
+    // from the object store.
     if (object->data_size != -1) {
       std::shared_ptr<Buffer> physical_buf;
       if (object->device_num == 0) {
@@ -662,7 +695,7 @@ Status PlasmaClient::Impl::GetBuffers(
       object_buffers[i].device_num = object->device_num;
       // Increment the count of the number of instances of this object that this
       // client is using. Cache the reference to the object.
-      IncrementObjectCount(received_object_ids[i], object, true);
+      IncrementObjectCount(received_object_ids[j], object, true);
     } else {
       // The object was not retrieved.  The caller can detect this condition
       // by checking the boolean value of the metadata/data buffers.
@@ -731,6 +764,11 @@ Status PlasmaClient::Impl::Release(const ObjectID& object_id) {
   ARROW_CHECK(object_entry->second->count >= 0);
   // Check if the client is no longer using this object.
   if (object_entry->second->count == 0) {
+    if (released_object_cache_size_ > 0 && object_entry->second->is_sealed &&
+        object_entry->second->object.device_num == 0 &&
+        deletion_cache_.count(object_id) == 0) {
+      return CacheReleasedObject(object_id);
+    }
     // Tell the store that the client no longer needs the object.
     RETURN_NOT_OK(MarkObjectUnused(object_id));
     RETURN_NOT_OK(SendReleaseRequest(store_conn_, object_id));
@@ -743,6 +781,28 @@ Status PlasmaClient::Impl::Release(const ObjectID& object_id) {
   return Status::OK();
 }
 
+Status PlasmaClient::Impl::CacheReleasedObject(const ObjectID& object_id) {
+  auto& object_entry = objects_in_use_[object_id];
+  released_objects_.push_back(object_id);
+  object_entry->released_position = std::prev(released_objects_.end());
+  released_object_bytes_ +=
+      object_entry->object.data_size + object_entry->object.metadata_size;
+  while (released_object_bytes_ > released_object_cache_size_) {
+    RETURN_NOT_OK(EvictReleasedObject(released_objects_.front()));
+  }
+  return Status::OK();
+}
+
+Status PlasmaClient::Impl::EvictReleasedObject(const ObjectID& object_id) {
+  auto& object_entry = objects_in_use_[object_id];
+  DCHECK_EQ(object_entry->count, 0);
+  released_objects_.erase(object_entry->released_position);
+  released_object_bytes_ -=
+      object_entry->object.data_size + object_entry->object.metadata_size;
+  RETURN_NOT_OK(MarkObjectUnused(object_id));
+  return SendReleaseRequest(store_conn_, object_id);
+}
+
 // This method is used to query whether the plasma store contains an object.
 Status PlasmaClient::Impl::Contains(const ObjectID& object_id, bool* has_object) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
@@ -877,6 +937,44 @@ Status PlasmaClient::Impl::Seal(const ObjectID& object_id) {
   return Release(object_id);
 }
 
+Status PlasmaClient::Impl::Seal(const std::vector<ObjectID>& object_ids) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+
+  for (const auto& object_id : object_ids) {
+    auto object_entry = objects_in_use_.find(object_id);
+    if (object_entry == objects_in_use_.end()) {
+      return MakePlasmaError(PlasmaErrorCode::PlasmaObjectNotFound,
+                             "Seal() called on an object without a reference to it");
+    }
+    if (object_entry->second->is_sealed) {
+      return MakePlasmaError(PlasmaErrorCode::PlasmaObjectAlreadySealed,
+                             "Seal() called on an already sealed object");
+    }
+  }
+
+  // Send all of the seal requests before waiting for the replies, which the
+  // store sends in the same order, so that sealing takes one round trip.
+  for (const auto& object_id : object_ids) {
+    objects_in_use_[object_id]->is_sealed = true;
+    std::vector<uint8_t> digest(kDigestSize);
+    RETURN_NOT_OK(Hash(object_id, &digest[0]));
+    RETURN_NOT_OK(SendSealRequest(store_conn_, object_id,
+                                  std::string(digest.begin(), digest.end())));
+  }
+  for (const auto& object_id : object_ids) {
+    std::vector<uint8_t> buffer;
+    RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaSealReply, &buffer));
+    ObjectID sealed_id;
+    RETURN_NOT_OK(ReadSealReply(buffer.data(), buffer.size(), &sealed_id));
+    ARROW_CHECK(sealed_id == object_id);
+  }
+  // Release the references taken by Create to keep the objects until sealed.
+  for (const auto& object_id : object_ids) {
+    RETURN_NOT_OK(Release(object_id));
+  }
+  return Status::OK();
+}
+
 Status PlasmaClient::Impl::Abort(const ObjectID& object_id) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
   auto object_entry = objects_in_use_.find(object_id);
@@ -921,6 +1019,11 @@ Status PlasmaClient::Impl::Delete(const std::vector<ObjectID>& object_ids) {
 
   std::vector<ObjectID> not_in_use_ids;
   for (auto& object_id : object_ids) {
+    // Stop keeping the object if it was released.
+    auto object_entry = objects_in_use_.find(object_id);
+    if (object_entry != objects_in_use_.end() && object_entry->second->count == 0) {
+      RETURN_NOT_OK(EvictReleasedObject(object_id));
+    }
     // If the object is in used, skip it.
     if (objects_in_use_.count(object_id) == 0) {
       not_in_use_ids.push_back(object_id);
@@ -1085,6 +1188,16 @@ Status PlasmaClient::Impl::SetClientOptions(const std::string& client_name,
   return ReadSetOptionsReply(buffer.data(), buffer.size());
 }
 
+Status PlasmaClient::Impl::SetReleasedObjectCacheSize(int64_t num_bytes) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+  released_object_cache_size_ = num_bytes;
+  while (!released_objects_.empty() &&
+         released_object_bytes_ > released_object_cache_size_) {
+    RETURN_NOT_OK(EvictReleasedObject(released_objects_.front()));
+  }
+  return Status::OK();
+}
+
 Status PlasmaClient::Impl::Disconnect() {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
@@ -1134,6 +1247,10 @@ Status PlasmaClient::SetClientOptions(const std::string& client_name,
   return impl_->SetClientOptions(client_name, output_memory_quota);
 }
 
+Status PlasmaClient::SetReleasedObjectCacheSize(int64_t num_bytes) {
+  return impl_->SetReleasedObjectCacheSize(num_bytes);
+}
+
 Status PlasmaClient::Create(const ObjectID& object_id, int64_t data_size,
                             const uint8_t* metadata, int64_t metadata_size,
                             std::shared_ptr<Buffer>* data, int device_num,
@@ -1178,6 +1295,10 @@ Status PlasmaClient::Abort(const ObjectID& object_id) { return impl_->Abort(obje
 
 Status PlasmaClient::Seal(const ObjectID& object_id) { return impl_->Seal(object_id); }
 
+Status PlasmaClient::Seal(const std::vector<ObjectID>& object_ids) {
+  return impl_->Seal(object_ids);
+}
+
 Status PlasmaClient::Delete(const ObjectID& object_id) {
   return impl_->Delete(std::vector<ObjectID>{object_id});
 }
@@ -71,6 +71,17 @@ class ARROW_EXPORT PlasmaClient {
   ///        this client.
   Status SetClientOptions(const std::string& client_name, int64_t output_memory_quota);
 
+  /// Keep objects that this client released referenced and mapped, so that
+  /// getting them again does not need a request to the store. The least
+  /// recently released objects are given back to the store once they take more
+  /// than the given number of bytes. Kept objects cannot be evicted, and a
+  /// deletion by another client only takes effect once they are given back.
+  ///
+  /// \param num_bytes The maximum size in bytes of the kept objects, 0 (the
+  ///        default) to release objects right away.
+  /// \return The return status.
+  Status SetReleasedObjectCacheSize(int64_t num_bytes);
+
   /// Create an object in the Plasma Store. Any metadata for this object must be
   /// be passed in when the object is created.
   ///
@@ -210,6 +221,13 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Seal(const ObjectID& object_id);
 
+  /// Seal multiple objects in the object store, with a single round trip to
+  /// the store.
+  ///
+  /// \param object_ids The IDs of the objects to seal.
+  /// \return The return status.
+  Status Seal(const std::vector<ObjectID>& object_ids);
+
   /// Delete an object from the object store. This currently assumes that the
   /// object is present, has been sealed and not used by another client. Otherwise,
   /// it is a no operation.
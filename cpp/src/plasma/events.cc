@@ -20,6 +20,10 @@
 #include <utility>
 
 #include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "arrow/util/logging.h"
 
 extern "C" {
 #include "plasma/thirdparty/ae/ae.h"
@@ -45,7 +49,14 @@ int EventLoop::TimerEventCallback(aeEventLoop* loop, TimerID timer_id, void* con
 
 constexpr int kInitialEventLoopSize = 1024;
 
-EventLoop::EventLoop() { loop_ = aeCreateEventLoop(kInitialEventLoopSize); }
+EventLoop::EventLoop() {
+  loop_ = aeCreateEventLoop(kInitialEventLoopSize);
+  ARROW_CHECK(pipe(wakeup_fds_) == 0);
+  for (int fd : wakeup_fds_) {
+    ARROW_CHECK(fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) == 0);
+  }
+  AddFileEvent(wakeup_fds_[0], kEventLoopRead, [this](int events) { RunPostedTasks(); });
+}
 
 bool EventLoop::AddFileEvent(int fd, int events, const FileCallback& callback) {
   if (file_callbacks_.find(fd) != file_callbacks_.end()) {
@@ -76,7 +87,39 @@ void EventLoop::RemoveFileEvent(int fd) {
   file_callbacks_.erase(fd);
 }
 
-void EventLoop::Start() { aeMain(loop_); }
+void EventLoop::Post(const Task& task) {
+  {
+    std::lock_guard<std::mutex> lock(tasks_mutex_);
+    posted_tasks_.push_back(task);
+  }
+  // If the pipe is full, a wakeup is already pending.
+  char byte = 0;
+  ssize_t ignored = write(wakeup_fds_[1], &byte, 1);
+  (void)ignored;
+}
+
+void EventLoop::RunPostedTasks() {
+  char buffer[64];
+  while (read(wakeup_fds_[0], buffer, sizeof(buffer)) > 0) {
+  }
+  std::vector<Task> tasks;
+  {
+    std::lock_guard<std::mutex> lock(tasks_mutex_);
+    tasks.swap(posted_tasks_);
+  }
+  for (const auto& task : tasks) {
+    task();
+  }
+}
+
+bool EventLoop::IsLoopThread() const {
+  return loop_thread_.load() == std::this_thread::get_id();
+}
+
+void EventLoop::Start() {
+  loop_thread_.store(std::this_thread::get_id());
+  aeMain(loop_);
+}
 
 void EventLoop::Stop() { aeStop(loop_); }
 
@@ -84,6 +127,8 @@ void EventLoop::Shutdown() {
   if (loop_ != nullptr) {
     aeDeleteEventLoop(loop_);
     loop_ = nullptr;
+    close(wakeup_fds_[0]);
+    close(wakeup_fds_[1]);
   }
 }
 
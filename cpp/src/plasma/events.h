@@ -17,9 +17,13 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 struct aeEventLoop;
 
@@ -56,6 +60,9 @@ class EventLoop {
   // triggered again.
   using TimerCallback = std::function<int(int64_t)>;
 
+  // A task run once on the thread of the event loop.
+  using Task = std::function<void()>;
+
   EventLoop();
 
   ~EventLoop();
@@ -87,6 +94,15 @@ class EventLoop {
   /// \return The ae.c error code. TODO(pcm): needs to be standardized
   int RemoveTimer(int64_t timer_id);
 
+  /// Run a task on the thread of the event loop. This is the only method
+  /// that may be called from other threads than the one running the loop.
+  ///
+  /// \param task The task to run.
+  void Post(const Task& task);
+
+  /// \brief Return true if called from the thread running the event loop.
+  bool IsLoopThread() const;
+
   /// \brief Run the event loop.
   void Start();
 
@@ -100,7 +116,14 @@ class EventLoop {
 
   static int TimerEventCallback(aeEventLoop* loop, TimerID timer_id, void* context);
 
+  void RunPostedTasks();
+
   aeEventLoop* loop_;
+  /// The pipe used to wake up the loop when tasks are posted.
+  int wakeup_fds_[2];
+  std::mutex tasks_mutex_;
+  std::vector<Task> posted_tasks_;
+  std::atomic<std::thread::id> loop_thread_;
   std::unordered_map<int, std::unique_ptr<FileCallback>> file_callbacks_;
   std::unordered_map<int64_t, std::unique_ptr<TimerCallback>> timer_callbacks_;
 };
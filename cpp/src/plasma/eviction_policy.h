@@ -19,6 +19,8 @@
 
 #include <functional>
 #include <list>
+#include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -37,9 +39,20 @@ namespace plasma {
 //
 // It does not implement memory quotas; see quota_aware_policy for that.
 
-class LRUCache {
+/// The order in which objects that are not in use are evicted.
+enum class EvictionOrder {
+  /// Least recently used objects first.
+  LRU,
+  /// Greedy-Dual-Size-Frequency: objects with the fewest uses per byte first,
+  /// aged so that objects that were used a lot long ago eventually go. This
+  /// keeps hot small objects when large objects come in.
+  GDSF,
+};
+
+/// The objects that are not in use, in the order in which they are evicted.
+class EvictionCache {
  public:
-  LRUCache(const std::string& name, int64_t size)
+  EvictionCache(const std::string& name, int64_t size)
       : name_(name),
         original_capacity_(size),
         capacity_(size),
@@ -47,12 +60,24 @@ class LRUCache {
         num_evictions_total_(0),
         bytes_evicted_total_(0) {}
 
-  void Add(const ObjectID& key, int64_t size);
+  virtual ~EvictionCache() = default;
 
-  int64_t Remove(const ObjectID& key);
+  /// Create a cache evicting objects in the given order.
+  static std::unique_ptr<EvictionCache> Make(EvictionOrder order,
+                                             const std::string& name, int64_t size);
 
-  int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
-                               std::vector<ObjectID>* objects_to_evict);
+  virtual void Add(const ObjectID& key, int64_t size) = 0;
+
+  /// Remove an object, if present, and return its size, or -1 if not present.
+  virtual int64_t Remove(const ObjectID& key) = 0;
+
+  /// Remove an object that left the store, if present, and forget anything
+  /// remembered about it.
+  virtual void Forget(const ObjectID& key) { Remove(key); }
+
+  /// Choose objects to evict, without removing them from the cache.
+  virtual int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
+                                       std::vector<ObjectID>* objects_to_evict) = 0;
 
   int64_t OriginalCapacity() const;
 
@@ -62,19 +87,13 @@ class LRUCache {
 
   void AdjustCapacity(int64_t delta);
 
-  void Foreach(std::function<void(const ObjectID&)>);
+  virtual void Foreach(std::function<void(const ObjectID&)>) = 0;
 
-  std::string DebugString() const;
+  virtual int64_t Size() const = 0;
 
- private:
-  /// A doubly-linked list containing the items in the cache and
-  /// their sizes in LRU order.
-  typedef std::list<std::pair<ObjectID, int64_t>> ItemList;
-  ItemList item_list_;
-  /// A hash table mapping the object ID of an object in the cache to its
-  /// location in the doubly linked list item_list_.
-  std::unordered_map<ObjectID, ItemList::iterator> item_map_;
+  std::string DebugString() const;
 
+ protected:
   /// The name of this cache, used for debugging purposes only.
   const std::string name_;
   /// The original (max) capacity of this cache in bytes.
@@ -89,6 +108,65 @@ class LRUCache {
   int64_t bytes_evicted_total_;
 };
 
+class LRUCache : public EvictionCache {
+ public:
+  LRUCache(const std::string& name, int64_t size) : EvictionCache(name, size) {}
+
+  void Add(const ObjectID& key, int64_t size) override;
+
+  int64_t Remove(const ObjectID& key) override;
+
+  int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
+                               std::vector<ObjectID>* objects_to_evict) override;
+
+  void Foreach(std::function<void(const ObjectID&)>) override;
+
+  int64_t Size() const override { return static_cast<int64_t>(item_map_.size()); }
+
+ private:
+  /// A doubly-linked list containing the items in the cache and
+  /// their sizes in LRU order.
+  typedef std::list<std::pair<ObjectID, int64_t>> ItemList;
+  ItemList item_list_;
+  /// A hash table mapping the object ID of an object in the cache to its
+  /// location in the doubly linked list item_list_.
+  std::unordered_map<ObjectID, ItemList::iterator> item_map_;
+};
+
+/// Evicts the objects with the lowest priority, which is the number of times an
+/// object was used divided by its size, plus the priority of the last evicted
+/// object when it was last used (the "clock"), so that priorities age.
+class GDSFCache : public EvictionCache {
+ public:
+  GDSFCache(const std::string& name, int64_t size) : EvictionCache(name, size) {}
+
+  void Add(const ObjectID& key, int64_t size) override;
+
+  int64_t Remove(const ObjectID& key) override;
+
+  void Forget(const ObjectID& key) override;
+
+  int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
+                               std::vector<ObjectID>* objects_to_evict) override;
+
+  void Foreach(std::function<void(const ObjectID&)>) override;
+
+  int64_t Size() const override { return static_cast<int64_t>(item_map_.size()); }
+
+ private:
+  /// The items in the cache and their sizes, by increasing priority.
+  typedef std::multimap<double, std::pair<ObjectID, int64_t>> ItemQueue;
+  ItemQueue item_queue_;
+  /// A hash table mapping the object ID of an object in the cache to its
+  /// location in item_queue_.
+  std::unordered_map<ObjectID, ItemQueue::iterator> item_map_;
+  /// The number of times each object in the store was added, i.e. used. This
+  /// is kept while objects are in use, and so not in the cache.
+  std::unordered_map<ObjectID, int64_t> num_uses_;
+  /// The priority of the last evicted object.
+  double clock_ = 0;
+};
+
 /// The eviction policy.
 class EvictionPolicy {
  public:
@@ -97,7 +175,9 @@ class EvictionPolicy {
   /// \param store_info Information about the Plasma store that is exposed
   ///        to the eviction policy.
   /// \param max_size Max size in bytes total of objects to store.
-  explicit EvictionPolicy(PlasmaStoreInfo* store_info, int64_t max_size);
+  /// \param order The order in which objects not in use are evicted.
+  explicit EvictionPolicy(PlasmaStoreInfo* store_info, int64_t max_size,
+                          EvictionOrder order = EvictionOrder::LRU);
 
   /// Destroy an eviction policy.
   virtual ~EvictionPolicy() {}
@@ -183,9 +263,10 @@ class EvictionPolicy {
   virtual int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
                                        std::vector<ObjectID>* objects_to_evict);
 
-  /// This method will be called when an object is going to be removed
+  /// This method will be called when an object is going to be removed from the
+  /// store, other than after being chosen for eviction.
   ///
-  /// \param object_id The ID of the object that is now being used.
+  /// \param object_id The ID of the object that is removed.
   virtual void RemoveObject(const ObjectID& object_id);
 
   virtual void RefreshObjects(const std::vector<ObjectID>& object_ids);
@@ -202,8 +283,8 @@ class EvictionPolicy {
 
   /// Pointer to the plasma store info.
   PlasmaStoreInfo* store_info_;
-  /// Datastructure for the LRU cache.
-  LRUCache cache_;
+  /// Datastructure for the global cache.
+  std::unique_ptr<EvictionCache> cache_;
 };
 
 }  // namespace plasma
@@ -49,6 +49,8 @@ namespace flatbuf {
 struct ObjectInfoT;
 }  // namespace flatbuf
 
+class EventLoop;
+
 #define HANDLE_SIGPIPE(s, fd_)                                              \
   do {                                                                      \
     Status _s = (s);                                                        \
@@ -86,6 +88,9 @@ struct Client {
   /// if client subscribes to plasma store. -1 indicates invalid.
   int notification_fd;
 
+  /// The event loop serving the requests of this client.
+  EventLoop* loop = nullptr;
+
   std::string name = "anonymous_client";
 };
 
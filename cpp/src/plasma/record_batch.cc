@@ -0,0 +1,387 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/record_batch.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/data.h"
+#include "arrow/buffer.h"
+#include "arrow/extension_type.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/dictionary.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/type.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+
+namespace plasma {
+
+using arrow::ArrayData;
+using arrow::DataType;
+using arrow::internal::checked_cast;
+
+namespace {
+
+// The description of the batch ends the object with its offset, its size and
+// this magic number.
+constexpr char kMagic[8] = {'P', 'L', 'A', 'S', 'M', 'A', 'R', 'B'};
+constexpr int64_t kTrailerSize = 2 * sizeof(int64_t) + sizeof(kMagic);
+
+// Where zero-size allocations point to
+alignas(64) uint8_t kZeroSizeArea[1];
+
+void AppendInt64(int64_t value, std::string* out) {
+  out->append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+class DescriptionReader {
+ public:
+  DescriptionReader(const uint8_t* data, int64_t size) : data_(data), size_(size) {}
+
+  Status ReadInt64(int64_t* out) {
+    RETURN_NOT_OK(Check(sizeof(int64_t)));
+    std::memcpy(out, data_ + position_, sizeof(int64_t));
+    position_ += sizeof(int64_t);
+    return Status::OK();
+  }
+
+  Status ReadBytes(int64_t size, const uint8_t** out) {
+    RETURN_NOT_OK(Check(size));
+    *out = data_ + position_;
+    position_ += size;
+    return Status::OK();
+  }
+
+ private:
+  Status Check(int64_t size) const {
+    if (size < 0 || size > size_ - position_) {
+      return Status::Invalid("Truncated record batch description in Plasma object");
+    }
+    return Status::OK();
+  }
+
+  const uint8_t* data_;
+  int64_t size_;
+  int64_t position_ = 0;
+};
+
+// Read back what DescribeArray() wrote, slicing the buffers out of the first
+// buffers_end bytes of the object
+Status ReadArray(const std::shared_ptr<DataType>& type,
+                 const std::shared_ptr<Buffer>& object, int64_t buffers_end,
+                 DescriptionReader* reader, std::shared_ptr<ArrayData>* out) {
+  int64_t length, null_count, offset, num_buffers;
+  RETURN_NOT_OK(reader->ReadInt64(&length));
+  RETURN_NOT_OK(reader->ReadInt64(&null_count));
+  RETURN_NOT_OK(reader->ReadInt64(&offset));
+  RETURN_NOT_OK(reader->ReadInt64(&num_buffers));
+  if (num_buffers < 0 || num_buffers > 3) {
+    return Status::Invalid("Invalid number of buffers in Plasma object: ", num_buffers);
+  }
+  std::vector<std::shared_ptr<Buffer>> buffers(num_buffers);
+  for (auto& buffer : buffers) {
+    int64_t buffer_offset, buffer_size;
+    RETURN_NOT_OK(reader->ReadInt64(&buffer_offset));
+    RETURN_NOT_OK(reader->ReadInt64(&buffer_size));
+    if (buffer_offset == -1) {
+      continue;
+    }
+    if (buffer_offset < 0 || buffer_size < 0 || buffer_offset > buffers_end ||
+        buffer_size > buffers_end - buffer_offset) {
+      return Status::Invalid("Buffer out of bounds in Plasma object");
+    }
+    buffer = arrow::SliceBuffer(object, buffer_offset, buffer_size);
+  }
+  *out = ArrayData::Make(type, length, std::move(buffers), null_count, offset);
+
+  // Extension arrays are laid out like their storage
+  const DataType& storage_type =
+      type->id() == arrow::Type::EXTENSION
+          ? *checked_cast<const arrow::ExtensionType&>(*type).storage_type()
+          : *type;
+  int64_t num_children;
+  RETURN_NOT_OK(reader->ReadInt64(&num_children));
+  if (num_children != storage_type.num_fields()) {
+    return Status::Invalid("Expected ", storage_type.num_fields(),
+                           " children in Plasma object, got ", num_children);
+  }
+  (*out)->child_data.resize(num_children);
+  for (int i = 0; i < storage_type.num_fields(); ++i) {
+    RETURN_NOT_OK(ReadArray(storage_type.field(i)->type(), object, buffers_end, reader,
+                            &(*out)->child_data[i]));
+  }
+
+  int64_t has_dictionary;
+  RETURN_NOT_OK(reader->ReadInt64(&has_dictionary));
+  if (has_dictionary != (storage_type.id() == arrow::Type::DICTIONARY)) {
+    return Status::Invalid("Unexpected dictionary in Plasma object");
+  }
+  if (has_dictionary) {
+    const auto& dict_type = checked_cast<const arrow::DictionaryType&>(storage_type);
+    RETURN_NOT_OK(ReadArray(dict_type.value_type(), object, buffers_end, reader,
+                            &(*out)->dictionary));
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+ObjectMemoryPool::ObjectMemoryPool(uint8_t* data, int64_t capacity)
+    : data_(data), capacity_(capacity) {}
+
+Status ObjectMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return AllocateLocked(size, out);
+}
+
+Status ObjectMemoryPool::AllocateLocked(int64_t size, uint8_t** out) {
+  if (size < 0) {
+    return Status::Invalid("negative malloc size");
+  }
+  if (size == 0) {
+    *out = kZeroSizeArea;
+    return Status::OK();
+  }
+  const int64_t offset = arrow::BitUtil::RoundUpToMultipleOf64(top_);
+  if (offset > capacity_ || size > capacity_ - offset) {
+    return Status::OutOfMemory("Plasma object of ", capacity_, " bytes is full");
+  }
+  last_ = offset;
+  top_ = offset + size;
+  bytes_allocated_ += size;
+  *out = data_ + offset;
+  return Status::OK();
+}
+
+Status ObjectMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  if (new_size < 0) {
+    return Status::Invalid("negative realloc size");
+  }
+  const bool is_last = old_size > 0 && *ptr == data_ + last_;
+  if (is_last && new_size > 0 && new_size <= capacity_ - last_) {
+    top_ = last_ + new_size;
+  } else if (!is_last && new_size > 0 && new_size <= old_size) {
+    // Shrinking leaves a hole, rather than move the data
+  } else {
+    uint8_t* out;
+    RETURN_NOT_OK(AllocateLocked(new_size, &out));
+    // The new allocation is counted in full
+    bytes_allocated_ -= new_size;
+    if (old_size > 0 && new_size > 0) {
+      std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    }
+    *ptr = out;
+  }
+  bytes_allocated_ += new_size - old_size;
+  return Status::OK();
+}
+
+void ObjectMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  if (size == 0) {
+    return;
+  }
+  DCHECK(Contains(buffer, size));
+  bytes_allocated_ -= size;
+  if (buffer == data_ + last_ && last_ + size == top_) {
+    // Give back the most recent allocation
+    top_ = last_;
+    last_ = -1;
+  }
+}
+
+int64_t ObjectMemoryPool::bytes_allocated() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return bytes_allocated_;
+}
+
+bool ObjectMemoryPool::Contains(const uint8_t* data, int64_t size) const {
+  return data >= data_ && size <= capacity_ && data - data_ <= capacity_ - size;
+}
+
+int64_t ObjectMemoryPool::top() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return top_;
+}
+
+RecordBatchObjectWriter::RecordBatchObjectWriter(PlasmaClient* client,
+                                                 const ObjectID& object_id,
+                                                 std::shared_ptr<Buffer> data)
+    : client_(client),
+      object_id_(object_id),
+      data_(std::move(data)),
+      pool_(data_->mutable_data(), data_->size()) {}
+
+RecordBatchObjectWriter::~RecordBatchObjectWriter() {
+  if (!sealed_) {
+    data_.reset();
+    ARROW_UNUSED(client_->Abort(object_id_));
+  }
+}
+
+Status RecordBatchObjectWriter::Create(PlasmaClient* client, const ObjectID& object_id,
+                                       int64_t capacity,
+                                       std::unique_ptr<RecordBatchObjectWriter>* out) {
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(client->Create(object_id, capacity, nullptr, 0, &data));
+  out->reset(new RecordBatchObjectWriter(client, object_id, std::move(data)));
+  return Status::OK();
+}
+
+namespace {
+
+// Append the layout of an array, with the offsets of its buffers in the
+// object. Buffers allocated outside of the object are copied in.
+Status DescribeArray(const ArrayData& data, ObjectMemoryPool* pool, uint8_t* object,
+                     std::string* out) {
+  AppendInt64(data.length, out);
+  AppendInt64(data.GetNullCount(), out);
+  AppendInt64(data.offset, out);
+  AppendInt64(static_cast<int64_t>(data.buffers.size()), out);
+  for (const auto& buffer : data.buffers) {
+    if (buffer == nullptr) {
+      AppendInt64(-1, out);
+      AppendInt64(0, out);
+      continue;
+    }
+    if (!buffer->is_cpu()) {
+      return Status::NotImplemented("Placing non-CPU buffers in a Plasma object");
+    }
+    const uint8_t* buffer_data = buffer->data();
+    if (!pool->Contains(buffer_data, buffer->size())) {
+      uint8_t* copy;
+      RETURN_NOT_OK(pool->Allocate(buffer->size(), &copy));
+      if (buffer->size() > 0) {
+        std::memcpy(copy, buffer_data, static_cast<size_t>(buffer->size()));
+      }
+      buffer_data = copy;
+    }
+    AppendInt64(buffer->size() > 0 ? buffer_data - object : 0, out);
+    AppendInt64(buffer->size(), out);
+  }
+  AppendInt64(static_cast<int64_t>(data.child_data.size()), out);
+  for (const auto& child : data.child_data) {
+    RETURN_NOT_OK(DescribeArray(*child, pool, object, out));
+  }
+  AppendInt64(data.dictionary != nullptr, out);
+  if (data.dictionary != nullptr) {
+    RETURN_NOT_OK(DescribeArray(*data.dictionary, pool, object, out));
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status RecordBatchObjectWriter::Seal(const arrow::RecordBatch& batch) {
+  if (sealed_) {
+    return Status::Invalid("Plasma object ", object_id_.hex(), " is already sealed");
+  }
+  uint8_t* object = data_->mutable_data();
+  const int64_t capacity = data_->size();
+
+  std::string description;
+  ARROW_ASSIGN_OR_RAISE(auto schema, arrow::ipc::SerializeSchema(*batch.schema()));
+  AppendInt64(schema->size(), &description);
+  description.append(reinterpret_cast<const char*>(schema->data()),
+                     static_cast<size_t>(schema->size()));
+  AppendInt64(batch.num_rows(), &description);
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    RETURN_NOT_OK(DescribeArray(*batch.column_data(i), &pool_, object, &description));
+  }
+
+  // The description goes after the buffers, the trailer at the very end
+  const int64_t offset = arrow::BitUtil::RoundUpToMultipleOf8(pool_.top());
+  const auto size = static_cast<int64_t>(description.size());
+  if (offset + size + kTrailerSize > capacity) {
+    return Status::CapacityError("Plasma object of ", capacity,
+                                 " bytes is too small for the record batch");
+  }
+  std::memcpy(object + offset, description.data(), description.size());
+  uint8_t* trailer = object + capacity - kTrailerSize;
+  std::memcpy(trailer, &offset, sizeof(offset));
+  std::memcpy(trailer + sizeof(offset), &size, sizeof(size));
+  std::memcpy(trailer + 2 * sizeof(int64_t), kMagic, sizeof(kMagic));
+
+  RETURN_NOT_OK(client_->Seal(object_id_));
+  sealed_ = true;
+  data_.reset();
+  return client_->Release(object_id_);
+}
+
+Status RecordBatchObjectReader::Get(const ObjectID& object_id, int64_t timeout_ms,
+                                    std::shared_ptr<arrow::RecordBatch>* out) {
+  std::vector<ObjectBuffer> object_buffers;
+  RETURN_NOT_OK(client_->Get({object_id}, timeout_ms, &object_buffers));
+  const std::shared_ptr<Buffer>& object = object_buffers[0].data;
+  if (object == nullptr) {
+    return MakePlasmaError(PlasmaErrorCode::PlasmaObjectNotFound,
+                           "Plasma object " + object_id.hex() + " is not available");
+  }
+
+  const int64_t capacity = object->size();
+  const uint8_t* trailer = object->data() + capacity - kTrailerSize;
+  int64_t offset, size;
+  if (capacity < kTrailerSize ||
+      std::memcmp(trailer + 2 * sizeof(int64_t), kMagic, sizeof(kMagic)) != 0) {
+    return Status::Invalid("Plasma object ", object_id.hex(),
+                           " does not hold a record batch");
+  }
+  std::memcpy(&offset, trailer, sizeof(offset));
+  std::memcpy(&size, trailer + sizeof(offset), sizeof(size));
+  if (offset < 0 || size < 0 || offset > capacity - kTrailerSize - size) {
+    return Status::Invalid("Invalid record batch description in Plasma object");
+  }
+  DescriptionReader reader(object->data() + offset, size);
+
+  int64_t schema_size, num_rows;
+  const uint8_t* schema_data;
+  RETURN_NOT_OK(reader.ReadInt64(&schema_size));
+  RETURN_NOT_OK(reader.ReadBytes(schema_size, &schema_data));
+  std::string schema_key(reinterpret_cast<const char*>(schema_data),
+                         static_cast<size_t>(schema_size));
+  std::shared_ptr<arrow::Schema>& schema = schemas_[schema_key];
+  if (schema == nullptr) {
+    arrow::io::BufferReader schema_reader(schema_data, schema_size);
+    arrow::ipc::DictionaryMemo dictionary_memo;
+    auto maybe_schema = arrow::ipc::ReadSchema(&schema_reader, &dictionary_memo);
+    if (!maybe_schema.ok()) {
+      schemas_.erase(schema_key);
+      return maybe_schema.status();
+    }
+    schema = *std::move(maybe_schema);
+  }
+
+  RETURN_NOT_OK(reader.ReadInt64(&num_rows));
+  std::vector<std::shared_ptr<ArrayData>> columns(schema->num_fields());
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    RETURN_NOT_OK(ReadArray(schema->field(i)->type(), object, offset, &reader,
+                            &columns[i]));
+  }
+  auto batch = arrow::RecordBatch::Make(schema, num_rows, std::move(columns));
+  RETURN_NOT_OK(batch->Validate());
+  *out = std::move(batch);
+  return Status::OK();
+}
+
+}  // namespace plasma
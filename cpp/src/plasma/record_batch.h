@@ -0,0 +1,130 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+#include "plasma/client.h"
+#include "plasma/common.h"
+
+namespace plasma {
+
+/// A memory pool handing out the memory of a single Plasma object being
+/// created. Allocations are bumped from the start of the object, growing or
+/// shrinking the most recent allocation happens in place.
+class ARROW_EXPORT ObjectMemoryPool : public arrow::MemoryPool {
+ public:
+  ObjectMemoryPool(uint8_t* data, int64_t capacity);
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+  std::string backend_name() const override { return "plasma"; }
+
+  /// Whether the memory is part of the object.
+  bool Contains(const uint8_t* data, int64_t size) const;
+  /// The offset of the end of the last allocation.
+  int64_t top() const;
+
+ private:
+  Status AllocateLocked(int64_t size, uint8_t** out);
+
+  uint8_t* data_;
+  int64_t capacity_;
+  mutable std::mutex mutex_;
+  // Offset of the most recent allocation still in use, or -1.
+  int64_t last_ = -1;
+  int64_t top_ = 0;
+  int64_t bytes_allocated_ = 0;
+};
+
+/// Places a RecordBatch in a Plasma object without serializing it.
+///
+/// Arrays whose buffers are allocated from pool() are built directly in the
+/// object's memory. Seal() then only appends a small description of where the
+/// buffers are, copying in the buffers that were allocated elsewhere, and seals
+/// the object. An object that is never sealed is aborted on destruction.
+/// The writer has to outlive the arrays built with its pool.
+///
+/// Example:
+/// std::unique_ptr<RecordBatchObjectWriter> writer;
+/// RETURN_NOT_OK(RecordBatchObjectWriter::Create(&client, id, 1 << 20, &writer));
+/// arrow::Int64Builder builder(writer->pool());
+/// ... append values, finish the array and make the batch ...
+/// RETURN_NOT_OK(writer->Seal(*batch));
+class ARROW_EXPORT RecordBatchObjectWriter {
+ public:
+  ~RecordBatchObjectWriter();
+
+  /// Create an object of the given size in bytes, which has to hold the
+  /// buffers of the batch as well as its description (a few hundred bytes
+  /// plus the serialized schema).
+  static Status Create(PlasmaClient* client, const ObjectID& object_id,
+                       int64_t capacity, std::unique_ptr<RecordBatchObjectWriter>* out);
+
+  /// The pool to build the arrays of the batch with.
+  arrow::MemoryPool* pool() { return &pool_; }
+
+  /// Describe the batch in the object, then seal and release the object.
+  Status Seal(const arrow::RecordBatch& batch);
+
+ private:
+  RecordBatchObjectWriter(PlasmaClient* client, const ObjectID& object_id,
+                          std::shared_ptr<Buffer> data);
+
+  PlasmaClient* client_;
+  ObjectID object_id_;
+  std::shared_ptr<Buffer> data_;
+  ObjectMemoryPool pool_;
+  bool sealed_ = false;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(RecordBatchObjectWriter);
+};
+
+/// Reads the RecordBatches placed by RecordBatchObjectWriter as zero-copy
+/// views of the Plasma objects. The buffers of a batch keep its object in use
+/// until they are all destroyed. Schemas are only parsed the first time they
+/// are seen.
+///
+/// This class is not thread-safe.
+class ARROW_EXPORT RecordBatchObjectReader {
+ public:
+  explicit RecordBatchObjectReader(PlasmaClient* client) : client_(client) {}
+
+  /// Get the batch of an object, waiting at most timeout_ms for it to be
+  /// sealed (-1 waits forever).
+  Status Get(const ObjectID& object_id, int64_t timeout_ms,
+             std::shared_ptr<arrow::RecordBatch>* out);
+
+ private:
+  PlasmaClient* client_;
+  // Keyed by the serialized schema
+  std::unordered_map<std::string, std::shared_ptr<arrow::Schema>> schemas_;
+};
+
+}  // namespace plasma
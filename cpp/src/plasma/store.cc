@@ -18,10 +18,10 @@
 // PLASMA STORE: This is a simple object store server process
 //
 // It accepts incoming client connections on a unix domain socket
-// (name passed in via the -s option of the executable) and uses a
-// single thread to serve the clients. Each client establishes a
-// connection and can create objects, wait for objects and seal
-// objects through that connection.
+// (name passed in via the -s option of the executable) and serves the
+// clients on a single thread, or spreads them over several threads (-t
+// option). Each client establishes a connection and can create objects,
+// wait for objects and seal objects through that connection.
 //
 // It keeps a hash table that maps object_ids (which are 20 byte long,
 // just enough to store and SHA1 hash) to memory mapped files.
@@ -43,12 +43,14 @@
 #include <sys/un.h>
 #include <unistd.h>
 
+#include <condition_variable>
 #include <ctime>
 #include <deque>
 #include <iostream>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -91,6 +93,8 @@ struct GetRequest {
   /// The ID of the timer that will time out and cause this wait to return to
   ///  the client if it hasn't already returned.
   int64_t timer;
+  /// The ID of this request in the timed requests of the store, if it has a timer.
+  int64_t id;
   /// The object IDs involved in this request. This is used in the reply.
   std::vector<ObjectID> object_ids;
   /// The object information for the objects in this request. This is used in
@@ -106,6 +110,7 @@ struct GetRequest {
 GetRequest::GetRequest(Client* client, const std::vector<ObjectID>& object_ids)
     : client(client),
       timer(-1),
+      id(-1),
       object_ids(object_ids.begin(), object_ids.end()),
       objects(object_ids.size()),
       num_satisfied(0) {
@@ -117,19 +122,49 @@ Client::Client(int fd) : fd(fd), notification_fd(-1) {}
 
 PlasmaStore::PlasmaStore(EventLoop* loop, std::string directory, bool hugepages_enabled,
                          const std::string& socket_name,
-                         std::shared_ptr<ExternalStore> external_store)
+                         std::shared_ptr<ExternalStore> external_store,
+                         std::vector<EventLoop*> client_loops,
+                         EvictionOrder eviction_order, double spill_high_watermark,
+                         double spill_low_watermark)
     : loop_(loop),
-      eviction_policy_(&store_info_, PlasmaAllocator::GetFootprintLimit()),
-      external_store_(external_store) {
+      client_loops_(std::move(client_loops)),
+      eviction_policy_(&store_info_, PlasmaAllocator::GetFootprintLimit(),
+                       eviction_order),
+      external_store_(external_store),
+      spill_high_watermark_(spill_high_watermark),
+      spill_low_watermark_(spill_low_watermark) {
   store_info_.directory = directory;
   store_info_.hugepages_enabled = hugepages_enabled;
+  if (client_loops_.empty()) {
+    client_loops_.push_back(loop_);
+  }
+  if (external_store_ && spill_high_watermark_ > 0) {
+    spill_thread_ = std::thread([this]() { SpillObjects(); });
+  }
 }
 
 // TODO(pcm): Get rid of this destructor by using RAII to clean up data.
-PlasmaStore::~PlasmaStore() {}
+PlasmaStore::~PlasmaStore() {
+  if (spill_thread_.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_spilling_ = true;
+    }
+    spill_cv_.notify_one();
+    spill_thread_.join();
+  }
+}
 
 const PlasmaStoreInfo* PlasmaStore::GetPlasmaStoreInfo() { return &store_info_; }
 
+void PlasmaStore::RunInLoop(EventLoop* loop, const EventLoop::Task& task) {
+  if (loop->IsLoopThread()) {
+    task();
+  } else {
+    loop->Post(task);
+  }
+}
+
 // If this client is not already using the object, add the client to the
 // object's list of clients, otherwise do nothing.
 void PlasmaStore::AddToClientObjectIds(const ObjectID& object_id, ObjectTableEntry* entry,
@@ -197,6 +232,7 @@ uint8_t* PlasmaStore::AllocateMemory(size_t size, bool evict_if_full, int* fd,
   if (pointer != nullptr) {
     GetMallocMapinfo(pointer, fd, map_size, offset);
     ARROW_CHECK(*fd != -1);
+    MaybeSpillObjects();
   }
   return pointer;
 }
@@ -342,7 +378,15 @@ void PlasmaStore::RemoveGetRequest(GetRequest* get_request) {
   }
   // Remove the get request.
   if (get_request->timer != -1) {
-    ARROW_CHECK(loop_->RemoveTimer(get_request->timer) == kEventLoopOk);
+    timed_get_requests_.erase(get_request->id);
+    EventLoop* loop = get_request->client->loop;
+    int64_t timer = get_request->timer;
+    if (loop->IsLoopThread()) {
+      ARROW_CHECK(loop->RemoveTimer(timer) == kEventLoopOk);
+    } else {
+      // The timer may fire before this runs, and then finds no request.
+      loop->Post([loop, timer]() { loop->RemoveTimer(timer); });
+    }
   }
   delete get_request;
 }
@@ -530,8 +574,15 @@ void PlasmaStore::ProcessGetRequest(Client* client,
   } else if (timeout_ms != -1) {
     // Set a timer that will cause the get request to return to the client. Note
     // that a timeout of -1 is used to indicate that no timer should be set.
-    get_req->timer = loop_->AddTimer(timeout_ms, [this, get_req](int64_t timer_id) {
-      ReturnFromGet(get_req);
+    get_req->id = next_get_request_id_++;
+    timed_get_requests_[get_req->id] = get_req;
+    int64_t id = get_req->id;
+    get_req->timer = client->loop->AddTimer(timeout_ms, [this, id](int64_t timer_id) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = timed_get_requests_.find(id);
+      if (it != timed_get_requests_.end()) {
+        ReturnFromGet(it->second);
+      }
       return kEventLoopTimerDone;
     });
   }
@@ -551,6 +602,7 @@ int PlasmaStore::RemoveFromClientObjectIds(const ObjectID& object_id,
       if (deletion_cache_.count(object_id) == 0) {
         // Tell the eviction policy that this object is no longer being used.
         eviction_policy_.EndObjectAccess(object_id);
+        MaybeSpillObjects();
       } else {
         // Above code does not really delete an object. Instead, it just put an
         // object to LRU cache which will be cleaned when the memory is not enough.
@@ -727,19 +779,95 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
   }
 }
 
+void PlasmaStore::MaybeSpillObjects() {
+  if (spill_thread_.joinable() &&
+      PlasmaAllocator::Allocated() >
+          spill_high_watermark_ * PlasmaAllocator::GetFootprintLimit()) {
+    spill_requested_ = true;
+    spill_cv_.notify_one();
+  }
+}
+
+void PlasmaStore::SpillObjects() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    spill_cv_.wait(lock, [this]() { return spill_requested_ || stop_spilling_; });
+    if (stop_spilling_) {
+      return;
+    }
+    spill_requested_ = false;
+    int64_t num_bytes =
+        PlasmaAllocator::Allocated() -
+        static_cast<int64_t>(spill_low_watermark_ * PlasmaAllocator::GetFootprintLimit());
+    std::vector<ObjectID> object_ids;
+    eviction_policy_.ChooseObjectsToEvict(num_bytes, &object_ids);
+    if (object_ids.empty()) {
+      continue;
+    }
+
+    // Hold a reference to the objects while they are written, like a client
+    // would, so that they are neither evicted nor deleted but can still be got.
+    std::vector<std::shared_ptr<arrow::Buffer>> object_data;
+    for (const auto& object_id : object_ids) {
+      auto entry = GetObjectTableEntry(&store_info_, object_id);
+      ARROW_CHECK(entry != nullptr && entry->state == ObjectState::PLASMA_SEALED &&
+                  entry->ref_count == 0);
+      eviction_policy_.BeginObjectAccess(object_id);
+      entry->ref_count++;
+      object_data.push_back(std::make_shared<arrow::Buffer>(
+          entry->pointer, entry->data_size + entry->metadata_size));
+    }
+    ARROW_LOG(DEBUG) << "spilling " << object_ids.size() << " objects";
+    lock.unlock();
+    Status status = external_store_->Put(object_ids, object_data);
+    lock.lock();
+    if (!status.ok()) {
+      ARROW_LOG(WARNING) << "Failed to spill objects to the external store: "
+                         << status.ToString();
+    }
+
+    for (const auto& object_id : object_ids) {
+      auto entry = GetObjectTableEntry(&store_info_, object_id);
+      entry->ref_count--;
+      if (entry->ref_count > 0) {
+        // A client got the object in the meantime, so keep it in memory until
+        // it is released.
+        continue;
+      }
+      eviction_policy_.EndObjectAccess(object_id);
+      if (status.ok()) {
+        eviction_policy_.RemoveObject(object_id);
+        deletion_cache_.erase(object_id);
+        PlasmaAllocator::Free(entry->pointer, entry->data_size + entry->metadata_size);
+        entry->pointer = nullptr;
+        entry->state = ObjectState::PLASMA_EVICTED;
+      }
+    }
+    if (status.ok()) {
+      MaybeSpillObjects();
+    }
+  }
+}
+
 void PlasmaStore::ConnectClient(int listener_sock) {
   int client_fd = AcceptClient(listener_sock);
 
   Client* client = new Client(client_fd);
-  connected_clients_[client_fd] = std::unique_ptr<Client>(client);
+  client->loop = client_loops_[next_client_loop_++ % client_loops_.size()];
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    connected_clients_[client_fd] = std::unique_ptr<Client>(client);
+  }
 
   // Add a callback to handle events on this socket.
   // TODO(pcm): Check return value.
-  loop_->AddFileEvent(client_fd, kEventLoopRead, [this, client](int events) {
-    Status s = ProcessMessage(client);
-    if (!s.ok()) {
-      ARROW_LOG(FATAL) << "Failed to process file event: " << s;
-    }
+  RunInLoop(client->loop, [this, client]() {
+    client->loop->AddFileEvent(client->fd, kEventLoopRead, [this, client](int events) {
+      Status s = ProcessMessage(client);
+      if (!s.ok()) {
+        ARROW_LOG(FATAL) << "Failed to process file event: " << s;
+      }
+    });
   });
   ARROW_LOG(DEBUG) << "New connection with fd " << client_fd;
 }
@@ -748,7 +876,10 @@ void PlasmaStore::DisconnectClient(int client_fd) {
   ARROW_CHECK(client_fd > 0);
   auto it = connected_clients_.find(client_fd);
   ARROW_CHECK(it != connected_clients_.end());
-  loop_->RemoveFileEvent(client_fd);
+  // Clients are disconnected by their own event loop.
+  EventLoop* loop = it->second->loop;
+  DCHECK(loop->IsLoopThread());
+  loop->RemoveFileEvent(client_fd);
   // Close the socket.
   close(client_fd);
   ARROW_LOG(INFO) << "Disconnecting client on fd " << client_fd;
@@ -783,7 +914,7 @@ void PlasmaStore::DisconnectClient(int client_fd) {
   if (client->notification_fd > 0) {
     // This client has subscribed for notifications.
     auto notify_fd = client->notification_fd;
-    loop_->RemoveFileEvent(notify_fd);
+    loop->RemoveFileEvent(notify_fd);
     // Close socket.
     close(notify_fd);
     // Remove notification queue for this fd from global map.
@@ -827,14 +958,9 @@ PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
       ARROW_LOG(DEBUG) << "The socket's send buffer is full, so we are caching this "
                           "notification and will send it later.";
       // Add a callback to the event loop to send queued notifications whenever
-      // there is room in the socket's send buffer. Callbacks can be added
-      // more than once here and will be overwritten. The callback is removed
+      // there is room in the socket's send buffer. The callback is removed
       // at the end of the method.
-      // TODO(pcm): Introduce status codes and check in case the file descriptor
-      // is added twice.
-      loop_->AddFileEvent(client_fd, kEventLoopWrite, [this, client_fd](int events) {
-        SendNotifications(pending_notifications_.find(client_fd));
-      });
+      WaitForNotificationWrite(it);
       break;
     } else {
       ARROW_LOG(WARNING) << "Failed to send notification to client on fd " << client_fd;
@@ -849,8 +975,10 @@ PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
   notifications.erase(notifications.begin(), notifications.begin() + num_processed);
 
   // If we have sent all notifications, remove the fd from the event loop.
-  if (notifications.empty()) {
-    loop_->RemoveFileEvent(client_fd);
+  if ((notifications.empty() || closed) && it->second.waiting_for_write) {
+    it->second.waiting_for_write = false;
+    EventLoop* loop = it->second.loop;
+    RunInLoop(loop, [loop, client_fd]() { loop->RemoveFileEvent(client_fd); });
   }
 
   // Stop sending notifications if the pipe was broken.
@@ -862,6 +990,27 @@ PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
   }
 }
 
+void PlasmaStore::WaitForNotificationWrite(NotificationMap::iterator it) {
+  if (it->second.waiting_for_write) {
+    return;
+  }
+  it->second.waiting_for_write = true;
+  int client_fd = it->first;
+  EventLoop* loop = it->second.loop;
+  RunInLoop(loop, [this, loop, client_fd]() {
+    loop->AddFileEvent(client_fd, kEventLoopWrite, [this, loop, client_fd](int events) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = pending_notifications_.find(client_fd);
+      if (it != pending_notifications_.end()) {
+        SendNotifications(it);
+      } else {
+        // The subscriber went away before this callback was added.
+        loop->RemoveFileEvent(client_fd);
+      }
+    });
+  });
+}
+
 void PlasmaStore::PushNotification(fb::ObjectInfoT* object_info) {
   auto it = pending_notifications_.begin();
   while (it != pending_notifications_.end()) {
@@ -912,7 +1061,7 @@ void PlasmaStore::SubscribeToUpdates(Client* client) {
   }
 
   // Add this fd to global map, which is needed for this client to receive notifications.
-  pending_notifications_[fd];
+  pending_notifications_[fd].loop = client->loop;
   client->notification_fd = fd;
 
   // Push notifications to the new subscriber about existing sealed objects.
@@ -930,15 +1079,22 @@ void PlasmaStore::SubscribeToUpdates(Client* client) {
 }
 
 Status PlasmaStore::ProcessMessage(Client* client) {
+  // Input buffer. This is allocated only once per thread to avoid mallocs for
+  // every call to ProcessMessage.
+  static thread_local std::vector<uint8_t> input_buffer;
   fb::MessageType type;
-  Status s = ReadMessage(client->fd, &type, &input_buffer_);
+  Status s = ReadMessage(client->fd, &type, &input_buffer);
   ARROW_CHECK(s.ok() || s.IsIOError());
 
-  uint8_t* input = input_buffer_.data();
-  size_t input_size = input_buffer_.size();
+  uint8_t* input = input_buffer.data();
+  size_t input_size = input_buffer.size();
   ObjectID object_id;
   PlasmaObject object = {};
 
+  // Requests are decoded before taking the lock, and the data of the objects
+  // created and sealed at once is copied without it.
+  std::unique_lock<std::mutex> lock(mutex_, std::defer_lock);
+
   // Process the different types of requests.
   switch (type) {
     case fb::MessageType::PlasmaCreateRequest: {
@@ -948,6 +1104,7 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       int device_num;
       RETURN_NOT_OK(ReadCreateRequest(input, input_size, &object_id, &evict_if_full,
                                       &data_size, &metadata_size, &device_num));
+      lock.lock();
       PlasmaError error_code = CreateObject(object_id, evict_if_full, data_size,
                                             metadata_size, device_num, client, &object);
       int64_t mmap_size = 0;
@@ -976,6 +1133,7 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       // CreateAndSeal currently only supports device_num = 0, which corresponds
       // to the host.
       int device_num = 0;
+      lock.lock();
       PlasmaError error_code = CreateObject(object_id, evict_if_full, data.size(),
                                             metadata.size(), device_num, client, &object);
 
@@ -983,9 +1141,12 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       if (error_code == PlasmaError::OK) {
         auto entry = GetObjectTableEntry(&store_info_, object_id);
         ARROW_CHECK(entry != nullptr);
-        // Write the inlined data and metadata into the allocated object.
+        // Write the inlined data and metadata into the allocated object. Until
+        // it is sealed, only this client can abort or free it.
+        lock.unlock();
         std::memcpy(entry->pointer, data.data(), data.size());
         std::memcpy(entry->pointer + data.size(), metadata.data(), metadata.size());
+        lock.lock();
         SealObjects({object_id}, {digest});
         // Remove the client from the object's array of clients because the
         // object is not being used by any client. The client was added to the
@@ -1012,6 +1173,7 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       int device_num = 0;
       size_t i = 0;
       PlasmaError error_code = PlasmaError::OK;
+      lock.lock();
       for (i = 0; i < object_ids.size(); i++) {
         error_code = CreateObject(object_ids[i], evict_if_full, data[i].size(),
                                   metadata[i].size(), device_num, client, &object);
@@ -1023,14 +1185,20 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       // if OK, seal all the objects,
       // if error, abort the previous i objects immediately
       if (error_code == PlasmaError::OK) {
+        std::vector<uint8_t*> pointers;
         for (i = 0; i < object_ids.size(); i++) {
           auto entry = GetObjectTableEntry(&store_info_, object_ids[i]);
           ARROW_CHECK(entry != nullptr);
-          // Write the inlined data and metadata into the allocated object.
-          std::memcpy(entry->pointer, data[i].data(), data[i].size());
-          std::memcpy(entry->pointer + data[i].size(), metadata[i].data(),
+          pointers.push_back(entry->pointer);
+        }
+        // Write the inlined data and metadata into the allocated objects.
+        lock.unlock();
+        for (i = 0; i < object_ids.size(); i++) {
+          std::memcpy(pointers[i], data[i].data(), data[i].size());
+          std::memcpy(pointers[i] + data[i].size(), metadata[i].data(),
                       metadata[i].size());
         }
+        lock.lock();
 
         SealObjects(object_ids, digests);
         // Remove the client from the object's array of clients because the
@@ -1051,6 +1219,7 @@ Status PlasmaStore::ProcessMessage(Client* client) {
     } break;
     case fb::MessageType::PlasmaAbortRequest: {
       RETURN_NOT_OK(ReadAbortRequest(input, input_size, &object_id));
+      lock.lock();
       ARROW_CHECK(AbortObject(object_id, client) == 1) << "To abort an object, the only "
                                                           "client currently using it "
                                                           "must be the creator.";
@@ -1060,10 +1229,12 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       std::vector<ObjectID> object_ids_to_get;
       int64_t timeout_ms;
       RETURN_NOT_OK(ReadGetRequest(input, input_size, object_ids_to_get, &timeout_ms));
+      lock.lock();
       ProcessGetRequest(client, object_ids_to_get, timeout_ms);
     } break;
     case fb::MessageType::PlasmaReleaseRequest: {
       RETURN_NOT_OK(ReadReleaseRequest(input, input_size, &object_id));
+      lock.lock();
       ReleaseObject(object_id, client);
     } break;
     case fb::MessageType::PlasmaDeleteRequest: {
@@ -1071,6 +1242,7 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       std::vector<PlasmaError> error_codes;
       RETURN_NOT_OK(ReadDeleteRequest(input, input_size, &object_ids));
       error_codes.reserve(object_ids.size());
+      lock.lock();
       for (auto& object_id : object_ids) {
         error_codes.push_back(DeleteObject(object_id));
       }
@@ -1078,6 +1250,7 @@ Status PlasmaStore::ProcessMessage(Client* client) {
     } break;
     case fb::MessageType::PlasmaContainsRequest: {
       RETURN_NOT_OK(ReadContainsRequest(input, input_size, &object_id));
+      lock.lock();
       if (ContainsObject(object_id) == ObjectStatus::OBJECT_FOUND) {
         HANDLE_SIGPIPE(SendContainsReply(client->fd, object_id, 1), client->fd);
       } else {
@@ -1086,11 +1259,13 @@ Status PlasmaStore::ProcessMessage(Client* client) {
     } break;
     case fb::MessageType::PlasmaListRequest: {
       RETURN_NOT_OK(ReadListRequest(input, input_size));
+      lock.lock();
       HANDLE_SIGPIPE(SendListReply(client->fd, store_info_.objects), client->fd);
     } break;
     case fb::MessageType::PlasmaSealRequest: {
       std::string digest;
       RETURN_NOT_OK(ReadSealRequest(input, input_size, &object_id, &digest));
+      lock.lock();
       SealObjects({object_id}, {digest});
       HANDLE_SIGPIPE(SendSealReply(client->fd, object_id, PlasmaError::OK), client->fd);
     } break;
@@ -1098,6 +1273,7 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       // This code path should only be used for testing.
       int64_t num_bytes;
       RETURN_NOT_OK(ReadEvictRequest(input, input_size, &num_bytes));
+      lock.lock();
       std::vector<ObjectID> objects_to_evict;
       int64_t num_bytes_evicted =
           eviction_policy_.ChooseObjectsToEvict(num_bytes, &objects_to_evict);
@@ -1107,10 +1283,12 @@ Status PlasmaStore::ProcessMessage(Client* client) {
     case fb::MessageType::PlasmaRefreshLRURequest: {
       std::vector<ObjectID> object_ids;
       RETURN_NOT_OK(ReadRefreshLRURequest(input, input_size, &object_ids));
+      lock.lock();
       eviction_policy_.RefreshObjects(object_ids);
       HANDLE_SIGPIPE(SendRefreshLRUReply(client->fd), client->fd);
     } break;
     case fb::MessageType::PlasmaSubscribeRequest:
+      lock.lock();
       SubscribeToUpdates(client);
       break;
     case fb::MessageType::PlasmaConnectRequest: {
@@ -1119,6 +1297,7 @@ Status PlasmaStore::ProcessMessage(Client* client) {
     } break;
     case fb::MessageType::PlasmaDisconnectClient:
       ARROW_LOG(DEBUG) << "Disconnecting client on fd " << client->fd;
+      lock.lock();
       DisconnectClient(client->fd);
       break;
     case fb::MessageType::PlasmaSetOptionsRequest: {
@@ -1126,6 +1305,7 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       int64_t output_memory_quota;
       RETURN_NOT_OK(
           ReadSetOptionsRequest(input, input_size, &client_name, &output_memory_quota));
+      lock.lock();
       client->name = client_name;
       bool success = eviction_policy_.SetClientQuota(client, output_memory_quota);
       HANDLE_SIGPIPE(SendSetOptionsReply(client->fd, success ? PlasmaError::OK
@@ -1133,6 +1313,7 @@ Status PlasmaStore::ProcessMessage(Client* client) {
                      client->fd);
     } break;
     case fb::MessageType::PlasmaGetDebugStringRequest: {
+      lock.lock();
       HANDLE_SIGPIPE(SendGetDebugStringReply(client->fd, eviction_policy_.DebugString()),
                      client->fd);
     } break;
@@ -1148,11 +1329,22 @@ class PlasmaStoreRunner {
   PlasmaStoreRunner() {}
 
   void Start(char* socket_name, std::string directory, bool hugepages_enabled,
-             std::shared_ptr<ExternalStore> external_store) {
-    // Create the event loop.
+             std::shared_ptr<ExternalStore> external_store, int num_threads,
+             EvictionOrder eviction_order, double spill_high_watermark,
+             double spill_low_watermark) {
+    // Create the event loop. With several threads, it only accepts the
+    // connections, and each thread runs a loop serving some of the clients.
     loop_.reset(new EventLoop);
+    std::vector<EventLoop*> client_loops;
+    if (num_threads > 1) {
+      for (int i = 0; i < num_threads; ++i) {
+        client_loops_.emplace_back(new EventLoop);
+        client_loops.push_back(client_loops_.back().get());
+      }
+    }
     store_.reset(new PlasmaStore(loop_.get(), directory, hugepages_enabled, socket_name,
-                                 external_store));
+                                 external_store, client_loops, eviction_order,
+                                 spill_high_watermark, spill_low_watermark));
     plasma_config = store_->GetPlasmaStoreInfo();
 
     // We are using a single memory-mapped file by mallocing and freeing a single
@@ -1171,6 +1363,9 @@ class PlasmaStoreRunner {
     // TODO(pcm): Check return value.
     ARROW_CHECK(socket >= 0);
 
+    for (auto loop : client_loops) {
+      threads_.emplace_back([loop]() { loop->Start(); });
+    }
     loop_->AddFileEvent(socket, kEventLoopRead, [this, socket](int events) {
       this->store_->ConnectClient(socket);
     });
@@ -1180,13 +1375,24 @@ class PlasmaStoreRunner {
   void Stop() { loop_->Stop(); }
 
   void Shutdown() {
+    for (auto& loop : client_loops_) {
+      EventLoop* client_loop = loop.get();
+      client_loop->Post([client_loop]() { client_loop->Stop(); });
+    }
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+    threads_.clear();
     loop_->Shutdown();
     loop_ = nullptr;
+    client_loops_.clear();
     store_ = nullptr;
   }
 
  private:
   std::unique_ptr<EventLoop> loop_;
+  std::vector<std::unique_ptr<EventLoop>> client_loops_;
+  std::vector<std::thread> threads_;
   std::unique_ptr<PlasmaStore> store_;
 };
 
@@ -1202,14 +1408,18 @@ void HandleSignal(int signal) {
 }
 
 void StartServer(char* socket_name, std::string plasma_directory, bool hugepages_enabled,
-                 std::shared_ptr<ExternalStore> external_store) {
+                 std::shared_ptr<ExternalStore> external_store, int num_threads,
+                 EvictionOrder eviction_order, double spill_high_watermark,
+                 double spill_low_watermark) {
   // Ignore SIGPIPE signals. If we don't do this, then when we attempt to write
   // to a client that has already died, the store could die.
   signal(SIGPIPE, SIG_IGN);
 
   g_runner.reset(new PlasmaStoreRunner());
   signal(SIGTERM, HandleSignal);
-  g_runner->Start(socket_name, plasma_directory, hugepages_enabled, external_store);
+  g_runner->Start(socket_name, plasma_directory, hugepages_enabled, external_store,
+                  num_threads, eviction_order, spill_high_watermark,
+                  spill_low_watermark);
 }
 
 // Function to use (instead of ARROW_LOG(FATAL)) for usage, etc. errors before
@@ -1237,6 +1447,16 @@ DEFINE_bool(h, false, "whether to enable hugepage support");
 DEFINE_string(s, "",
               "socket name where the Plasma store will listen for requests, required");
 DEFINE_string(m, "", "amount of memory in bytes to use for Plasma store, required");
+DEFINE_int32(t, 1, "number of threads serving the client requests");
+DEFINE_string(p, "lru",
+              "order in which objects not in use are evicted: lru, or gdsf to "
+              "prefer evicting large objects that are used less often");
+DEFINE_double(w, 0,
+              "fraction of the memory above which objects are spilled to the "
+              "external storage service in the background, 0 to disable");
+DEFINE_double(l, 0.6,
+              "fraction of the memory down to which objects are spilled in the "
+              "background");
 
 int main(int argc, char* argv[]) {
   ArrowLog::StartArrowLog(argv[0], ArrowLogLevel::ARROW_INFO);
@@ -1288,6 +1508,25 @@ int main(int argc, char* argv[]) {
     plasma::ExitWithUsageError(
         "please specify the amount of memory (in bytes) to use with -m");
   }
+  if (FLAGS_t < 1) {
+    plasma::ExitWithUsageError("-t switch takes a positive number of threads");
+  }
+  plasma::EvictionOrder eviction_order = plasma::EvictionOrder::LRU;
+  if (FLAGS_p == "gdsf") {
+    eviction_order = plasma::EvictionOrder::GDSF;
+  } else if (FLAGS_p != "lru") {
+    plasma::ExitWithUsageError("-p switch takes an eviction policy, lru or gdsf");
+  }
+  if (FLAGS_w < 0 || FLAGS_w > 1) {
+    plasma::ExitWithUsageError("-w switch takes a fraction between 0 and 1");
+  }
+  if (FLAGS_w > 0 && (FLAGS_l < 0 || FLAGS_l >= FLAGS_w)) {
+    plasma::ExitWithUsageError(
+        "-l switch takes a fraction between 0 and the high watermark given with -w");
+  }
+  if (FLAGS_w > 0 && external_store_endpoint.empty()) {
+    plasma::ExitWithUsageError("-w switch requires an external store given with -e");
+  }
   if (hugepages_enabled && plasma_directory.empty()) {
     plasma::ExitWithUsageError(
         "if you want to use hugepages, please specify path to huge pages "
@@ -1343,7 +1582,8 @@ int main(int argc, char* argv[]) {
   }
 
   ARROW_LOG(DEBUG) << "starting server listening on " << socket_name;
-  plasma::StartServer(socket_name, plasma_directory, hugepages_enabled, external_store);
+  plasma::StartServer(socket_name, plasma_directory, hugepages_enabled, external_store,
+                      FLAGS_t, eviction_order, FLAGS_w, FLAGS_l);
   plasma::g_runner->Shutdown();
   plasma::g_runner = nullptr;
 
@@ -17,9 +17,12 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -51,6 +54,11 @@ struct NotificationQueue {
   /// The object notifications for clients. We notify the client about the
   /// objects in the order that the objects were sealed or deleted.
   std::deque<std::unique_ptr<uint8_t[]>> object_notifications;
+  /// The event loop of the subscriber, which waits for room in the socket's
+  /// send buffer.
+  EventLoop* loop = nullptr;
+  /// Whether the loop is waiting for room in the socket's send buffer.
+  bool waiting_for_write = false;
 };
 
 class PlasmaStore {
@@ -58,9 +66,21 @@ class PlasmaStore {
   using NotificationMap = std::unordered_map<int, NotificationQueue>;
 
   // TODO: PascalCase PlasmaStore methods.
+  /// \param loop The event loop accepting the connections.
+  /// \param client_loops The event loops serving the connected clients, each
+  ///        running on its own thread. If empty, the clients are served by loop.
+  /// \param eviction_order The order in which objects not in use are evicted.
+  /// \param spill_high_watermark The fraction of the memory limit above which
+  ///        objects are spilled to the external store by a background thread,
+  ///        or 0 to only evict objects when creating an object needs room.
+  /// \param spill_low_watermark The fraction of the memory limit down to which
+  ///        the background thread spills objects.
   PlasmaStore(EventLoop* loop, std::string directory, bool hugepages_enabled,
               const std::string& socket_name,
-              std::shared_ptr<ExternalStore> external_store);
+              std::shared_ptr<ExternalStore> external_store,
+              std::vector<EventLoop*> client_loops = {},
+              EvictionOrder eviction_order = EvictionOrder::LRU,
+              double spill_high_watermark = 0, double spill_low_watermark = 0);
 
   ~PlasmaStore();
 
@@ -119,6 +139,9 @@ class PlasmaStore {
   /// \param object_ids Object IDs of the objects to be evicted.
   void EvictObjects(const std::vector<ObjectID>& object_ids);
 
+  /// Wake up the spill thread if the memory in use is above the high watermark.
+  void MaybeSpillObjects();
+
   /// Process a get request from a client. This method assumes that we will
   /// eventually have these objects sealed. If one of the objects has not yet
   /// been sealed, the client that requested the object will be notified when it
@@ -172,9 +195,18 @@ class PlasmaStore {
 
   NotificationMap::iterator SendNotifications(NotificationMap::iterator it);
 
+  /// Read and process a request from a client. Requests of clients served by
+  /// different event loops are processed concurrently: messages are read and
+  /// decoded in parallel, then the store state is updated under a lock.
   arrow::Status ProcessMessage(Client* client);
 
  private:
+  /// Run a task on the given event loop, immediately if called from its thread.
+  void RunInLoop(EventLoop* loop, const EventLoop::Task& task);
+
+  /// Start waiting for room in the send buffer of a notification socket.
+  void WaitForNotificationWrite(NotificationMap::iterator it);
+
   void PushNotification(ObjectInfoT* object_notification);
 
   void PushNotifications(std::vector<ObjectInfoT>& object_notifications);
@@ -203,6 +235,11 @@ class PlasmaStore {
 
   void EraseFromObjectTable(const ObjectID& object_id);
 
+  /// The body of the spill thread, which writes objects chosen by the eviction
+  /// policy to the external store without holding the store lock, then frees
+  /// the ones that no client got in the meantime.
+  void SpillObjects();
+
   uint8_t* AllocateMemory(size_t size, bool evict_if_full, int* fd, int64_t* map_size,
                           ptrdiff_t* offset, Client* client, bool is_create);
 #ifdef PLASMA_CUDA
@@ -215,17 +252,25 @@ class PlasmaStore {
 
   /// Event loop of the plasma store.
   EventLoop* loop_;
+  /// Event loops serving the clients, which are assigned in turn.
+  std::vector<EventLoop*> client_loops_;
+  size_t next_client_loop_ = 0;
+  /// Guards all of the state below, as well as the memory allocator, whose
+  /// dlmalloc arena is not thread-safe. The methods of the store other than
+  /// ConnectClient and ProcessMessage expect the caller to hold it.
+  std::mutex mutex_;
   /// The plasma store information, including the object tables, that is exposed
   /// to the eviction policy.
   PlasmaStoreInfo store_info_;
   /// The state that is managed by the eviction policy.
   QuotaAwarePolicy eviction_policy_;
-  /// Input buffer. This is allocated only once to avoid mallocs for every
-  /// call to process_message.
-  std::vector<uint8_t> input_buffer_;
   /// A hash table mapping object IDs to a vector of the get requests that are
   /// waiting for the object to arrive.
   std::unordered_map<ObjectID, std::vector<GetRequest*>> object_get_requests_;
+  /// The get requests with a timer, by ID. A timer may fire after its request
+  /// was returned from another thread, and then finds no request here.
+  std::unordered_map<int64_t, GetRequest*> timed_get_requests_;
+  int64_t next_get_request_id_ = 0;
   /// The pending notifications that have not been sent to subscribers because
   /// the socket send buffers were full. This is a hash table from client file
   /// descriptor to an array of object_ids to send to that client.
@@ -240,6 +285,17 @@ class PlasmaStore {
   /// Manages worker threads for handling asynchronous/multi-threaded requests
   /// for reading/writing data to/from external store.
   std::shared_ptr<ExternalStore> external_store_;
+
+  /// The fractions of the memory limit between which the spill thread keeps
+  /// the memory in use.
+  double spill_high_watermark_;
+  double spill_low_watermark_;
+  /// Wakes up the spill thread, which waits on mutex_.
+  std::condition_variable spill_cv_;
+  bool spill_requested_ = false;
+  bool stop_spilling_ = false;
+  /// Spills objects to the external store in the background, if enabled.
+  std::thread spill_thread_;
 };
 
 }  // namespace plasma
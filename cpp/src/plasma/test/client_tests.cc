@@ -24,9 +24,13 @@
 
 #include <memory>
 #include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/record_batch.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/io_util.h"
 
@@ -34,6 +38,7 @@
 #include "plasma/common.h"
 #include "plasma/plasma.h"
 #include "plasma/protocol.h"
+#include "plasma/record_batch.h"
 #include "plasma/test_util.h"
 
 namespace plasma {
@@ -62,7 +67,8 @@ class TestPlasmaStore : public ::testing::Test {
         test_executable.substr(0, test_executable.find_last_of("/"));
     std::string plasma_command =
         plasma_directory + "/plasma-store-server -m 10000000 -s " + store_socket_name_ +
-        " 1> /dev/null 2> /dev/null & " + "echo $! > " + store_socket_name_ + ".pid";
+        StoreOptions() + " 1> /dev/null 2> /dev/null & " + "echo $! > " +
+        store_socket_name_ + ".pid";
     PLASMA_CHECK_SYSTEM(system(plasma_command.c_str()));
     ARROW_CHECK_OK(client_.Connect(store_socket_name_, ""));
     ARROW_CHECK_OK(client2_.Connect(store_socket_name_, ""));
@@ -85,6 +91,9 @@ class TestPlasmaStore : public ::testing::Test {
     PLASMA_CHECK_SYSTEM(system(plasma_kill_command.c_str()));
   }
 
+  // Extra command-line options of the store.
+  virtual std::string StoreOptions() const { return ""; }
+
   void CreateObject(PlasmaClient& client, const ObjectID& object_id,
                     const std::vector<uint8_t>& metadata,
                     const std::vector<uint8_t>& data, bool release = true) {
@@ -699,6 +708,68 @@ TEST_F(TestPlasmaStore, BatchCreateTest) {
   ASSERT_STREQ(out2.c_str(), "world");
 }
 
+TEST_F(TestPlasmaStore, BatchSealTest) {
+  ObjectID object_id1 = random_object_id();
+  ObjectID object_id2 = random_object_id();
+  std::vector<ObjectID> object_ids = {object_id1, object_id2};
+
+  std::shared_ptr<Buffer> data;
+  ARROW_CHECK_OK(client_.Create(object_id1, 1, nullptr, 0, &data));
+  data->mutable_data()[0] = 1;
+  ARROW_CHECK_OK(client_.Create(object_id2, 1, nullptr, 0, &data));
+  data->mutable_data()[0] = 2;
+  ARROW_CHECK_OK(client_.Seal(object_ids));
+  ARROW_CHECK_OK(client_.Release(object_id1));
+  ARROW_CHECK_OK(client_.Release(object_id2));
+  EXPECT_FALSE(client_.IsInUse(object_id1));
+  EXPECT_FALSE(client_.IsInUse(object_id2));
+
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client_.Get(object_ids, 0, &object_buffers));
+  ASSERT_EQ(object_buffers[0].data->data()[0], 1);
+  ASSERT_EQ(object_buffers[1].data->data()[0], 2);
+
+  // Sealing again fails.
+  ASSERT_TRUE(IsPlasmaObjectAlreadySealed(client_.Seal(object_ids)));
+}
+
+TEST_F(TestPlasmaStore, ReleasedObjectCacheTest) {
+  ARROW_CHECK_OK(client_.SetReleasedObjectCacheSize(1000));
+  ObjectID object_id = random_object_id();
+  CreateObject(client_, object_id, {42}, {3, 5, 6, 7, 9});
+
+  // The released object stays referenced in the store.
+  EXPECT_FALSE(client_.IsInUse(object_id));
+  ObjectTable objects;
+  ARROW_CHECK_OK(client_.List(&objects));
+  ASSERT_EQ(objects[object_id]->ref_count, 1);
+
+  {
+    std::vector<ObjectBuffer> object_buffers;
+    ARROW_CHECK_OK(client_.Get({object_id}, 0, &object_buffers));
+    AssertObjectBufferEqual(object_buffers[0], {42}, {3, 5, 6, 7, 9});
+    EXPECT_TRUE(client_.IsInUse(object_id));
+  }
+  EXPECT_FALSE(client_.IsInUse(object_id));
+
+  // Shrinking the cache gives the object back to the store.
+  ARROW_CHECK_OK(client_.SetReleasedObjectCacheSize(0));
+  objects.clear();
+  ARROW_CHECK_OK(client_.List(&objects));
+  ASSERT_EQ(objects[object_id]->ref_count, 0);
+
+  // Deleting a kept object deletes it right away.
+  ARROW_CHECK_OK(client_.SetReleasedObjectCacheSize(1000));
+  {
+    std::vector<ObjectBuffer> object_buffers;
+    ARROW_CHECK_OK(client_.Get({object_id}, 0, &object_buffers));
+  }
+  ARROW_CHECK_OK(client_.Delete(object_id));
+  bool has_object;
+  ARROW_CHECK_OK(client_.Contains(object_id, &has_object));
+  ASSERT_FALSE(has_object);
+}
+
 TEST_F(TestPlasmaStore, AbortTest) {
   ObjectID object_id = random_object_id();
   std::vector<ObjectBuffer> object_buffers;
@@ -864,6 +935,135 @@ TEST_F(TestPlasmaStore, ManyObjectTest) {
   }
 }
 
+class TestPlasmaStoreMultiThreaded : public TestPlasmaStore {
+ protected:
+  std::string StoreOptions() const override { return " -t 4"; }
+};
+
+TEST_F(TestPlasmaStoreMultiThreaded, ConcurrentClientsTest) {
+  constexpr int kNumThreads = 8;
+  constexpr int kNumObjects = 50;
+  std::vector<std::vector<ObjectID>> object_ids(kNumThreads);
+  for (auto& thread_object_ids : object_ids) {
+    for (int i = 0; i < kNumObjects; i++) {
+      thread_object_ids.push_back(random_object_id());
+    }
+  }
+
+  // Each thread creates, seals and gets objects on its own connection.
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; t++) {
+    threads.emplace_back([this, t, &object_ids]() {
+      PlasmaClient client;
+      ARROW_CHECK_OK(client.Connect(store_socket_name_, ""));
+      for (int i = 0; i < kNumObjects; i++) {
+        const ObjectID& object_id = object_ids[t][i];
+        std::vector<uint8_t> data = {static_cast<uint8_t>(t), static_cast<uint8_t>(i)};
+        if (i % 2 == 0) {
+          CreateObject(client, object_id, {42}, data);
+        } else {
+          ARROW_CHECK_OK(client.CreateAndSeal(
+              object_id, std::string(data.begin(), data.end()), std::string(1, 42)));
+        }
+        std::vector<ObjectBuffer> object_buffers;
+        ARROW_CHECK_OK(client.Get({object_id}, -1, &object_buffers));
+        EXPECT_EQ(object_buffers.size(), 1);
+        AssertObjectBufferEqual(object_buffers[0], {42}, data);
+      }
+      ARROW_CHECK_OK(client.Disconnect());
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // Objects of all threads are visible to all clients.
+  for (const auto& thread_object_ids : object_ids) {
+    for (const auto& object_id : thread_object_ids) {
+      bool has_object;
+      ARROW_CHECK_OK(client_.Contains(object_id, &has_object));
+      ASSERT_TRUE(has_object);
+    }
+  }
+}
+
+TEST_F(TestPlasmaStoreMultiThreaded, GetWaitsForOtherThreadTest) {
+  // The two clients are served by different threads of the store. The get
+  // request of one is satisfied when the other seals the object.
+  ObjectID object_id = random_object_id();
+  std::vector<ObjectBuffer> object_buffers;
+  std::thread getter([this, &object_id, &object_buffers]() {
+    ARROW_CHECK_OK(client2_.Get({object_id}, 10000, &object_buffers));
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  std::vector<uint8_t> data = {1, 2, 3};
+  CreateObject(client_, object_id, {42}, data);
+  getter.join();
+  ASSERT_EQ(object_buffers.size(), 1);
+  AssertObjectBufferEqual(object_buffers[0], {42}, data);
+  object_buffers.clear();
+
+  // Timeouts still fire when nothing seals the object.
+  ObjectID missing_id = random_object_id();
+  ARROW_CHECK_OK(client2_.Get({missing_id}, 50, &object_buffers));
+  ASSERT_EQ(object_buffers.size(), 1);
+  ASSERT_FALSE(object_buffers[0].data);
+}
+
+TEST_F(TestPlasmaStore, RecordBatchObjectTest) {
+  ObjectID object_id = random_object_id();
+  // The writer has to outlive the arrays built with its pool
+  std::unique_ptr<RecordBatchObjectWriter> writer;
+  ASSERT_OK(RecordBatchObjectWriter::Create(&client_, object_id, 1 << 16, &writer));
+  arrow::Int64Builder int_builder(writer->pool());
+  arrow::StringBuilder string_builder(writer->pool());
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_OK(int_builder.Append(i));
+    ASSERT_OK(string_builder.Append(std::to_string(i)));
+  }
+  ASSERT_OK(int_builder.AppendNull());
+  ASSERT_OK(string_builder.AppendNull());
+  // Allocated outside of the object, so copied in by Seal()
+  arrow::Int8Builder index_builder;
+  for (int i = 0; i < 101; ++i) {
+    ASSERT_OK(index_builder.Append(i % 2));
+  }
+  std::shared_ptr<arrow::Array> ints, strings, indices, dictionary;
+  ASSERT_OK(int_builder.Finish(&ints));
+  ASSERT_OK(string_builder.Finish(&strings));
+  ASSERT_OK(index_builder.Finish(&indices));
+  auto dictionary_type = arrow::dictionary(arrow::int8(), arrow::utf8());
+  auto dictionary_values = arrow::ArrayFromJSON(arrow::utf8(), R"(["a", "b"])");
+  ASSERT_OK_AND_ASSIGN(dictionary, arrow::DictionaryArray::FromArrays(
+                                       dictionary_type, indices, dictionary_values));
+  auto schema = arrow::schema({arrow::field("ints", ints->type()),
+                               arrow::field("strings", strings->type()),
+                               arrow::field("dictionary", dictionary_type)});
+  auto batch = arrow::RecordBatch::Make(schema, 101, {ints, strings, dictionary});
+  ASSERT_OK(writer->Seal(*batch));
+
+  RecordBatchObjectReader reader(&client2_);
+  std::shared_ptr<arrow::RecordBatch> result;
+  ASSERT_OK(reader.Get(object_id, -1, &result));
+  ASSERT_OK(result->ValidateFull());
+  AssertBatchesEqual(*batch, *result);
+  // The schema is parsed once
+  std::shared_ptr<arrow::RecordBatch> result2;
+  ASSERT_OK(reader.Get(object_id, -1, &result2));
+  ASSERT_EQ(result->schema(), result2->schema());
+
+  ASSERT_TRUE(IsPlasmaObjectNotFound(reader.Get(random_object_id(), 0, &result)));
+
+  // Unsealed objects are aborted
+  ObjectID aborted_id = random_object_id();
+  std::unique_ptr<RecordBatchObjectWriter> aborted_writer;
+  ASSERT_OK(RecordBatchObjectWriter::Create(&client_, aborted_id, 1024, &aborted_writer));
+  aborted_writer.reset();
+  bool has_object;
+  ARROW_CHECK_OK(client_.Contains(aborted_id, &has_object));
+  ASSERT_FALSE(has_object);
+}
+
 #ifdef PLASMA_CUDA
 using arrow::cuda::CudaBuffer;
 using arrow::cuda::CudaBufferReader;
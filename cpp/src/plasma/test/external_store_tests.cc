@@ -61,7 +61,8 @@ class TestPlasmaStoreWithExternal : public ::testing::Test {
         external_test_executable.substr(0, external_test_executable.find_last_of('/'));
     std::string plasma_command = plasma_directory +
                                  "/plasma-store-server -m 1024000 -e " +
-                                 "hashtable://test -s " + store_socket_name_ +
+                                 "hashtable://test" + StoreOptions() + " -s " +
+                                 store_socket_name_ +
                                  " 1> /tmp/log.stdout 2> /tmp/log.stderr & " +
                                  "echo $! > " + store_socket_name_ + ".pid";
     PLASMA_CHECK_SYSTEM(system(plasma_command.c_str()));
@@ -85,6 +86,9 @@ class TestPlasmaStoreWithExternal : public ::testing::Test {
   }
 
  protected:
+  /// Extra command-line options of the store.
+  virtual std::string StoreOptions() { return ""; }
+
   PlasmaClient client_;
   std::unique_ptr<TemporaryDir> temp_dir_;
   std::string store_socket_name_;
@@ -134,6 +138,36 @@ TEST_F(TestPlasmaStoreWithExternal, EvictionTest) {
   ASSERT_EQ(object_buffers[0].metadata, nullptr);
 }
 
+class TestPlasmaStoreWithSpilling : public TestPlasmaStoreWithExternal {
+ protected:
+  std::string StoreOptions() override { return " -p gdsf -w 0.5 -l 0.3"; }
+};
+
+TEST_F(TestPlasmaStoreWithSpilling, SpillTest) {
+  std::vector<ObjectID> object_ids;
+  std::vector<std::string> data;
+  std::string metadata;
+  for (int i = 0; i < 20; i++) {
+    ObjectID object_id = random_object_id();
+    object_ids.push_back(object_id);
+    data.emplace_back(100 * 1024, static_cast<char>('a' + i));
+    ARROW_CHECK_OK(client_.CreateAndSeal(object_id, data[i], metadata));
+  }
+
+  // Objects are spilled in the background, and fetched back from the external
+  // store when they are no longer in memory.
+  for (int i = 0; i < 20; i++) {
+    bool has_object;
+    ARROW_CHECK_OK(client_.Contains(object_ids[i], &has_object));
+    ASSERT_TRUE(has_object);
+    std::vector<ObjectBuffer> object_buffers;
+    ARROW_CHECK_OK(client_.Get({object_ids[i]}, -1, &object_buffers));
+    ASSERT_EQ(object_buffers.size(), 1);
+    ASSERT_TRUE(object_buffers[0].data);
+    AssertObjectBufferEqual(object_buffers[0], metadata, data[i]);
+  }
+}
+
 }  // namespace plasma
 
 int main(int argc, char** argv) {
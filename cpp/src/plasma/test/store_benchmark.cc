@@ -0,0 +1,148 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Throughput of concurrent clients of a store serving them on one or several
+// threads.
+
+#include <stdlib.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/result.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+#include "plasma/client.h"
+#include "plasma/common.h"
+
+namespace plasma {
+
+using arrow::internal::TemporaryDir;
+
+std::string test_executable;  // NOLINT
+
+constexpr int64_t kObjectSize = 1024;
+
+// The number of threads of each store started by main()
+const std::vector<int> kStoreThreads = {1, 4};
+
+std::unique_ptr<TemporaryDir> temp_dir;
+std::vector<std::string> store_socket_names;
+
+void StartStores() {
+  temp_dir = TemporaryDir::Make("store-bench-").ValueOrDie();
+  std::string plasma_directory =
+      test_executable.substr(0, test_executable.find_last_of("/"));
+  for (int num_threads : kStoreThreads) {
+    std::string socket_name =
+        temp_dir->path().ToString() + "store" + std::to_string(num_threads);
+    std::string plasma_command = plasma_directory +
+                                 "/plasma-store-server -m 1000000000 -s " + socket_name +
+                                 " -t " + std::to_string(num_threads) +
+                                 " 1> /dev/null 2> /dev/null & echo $! > " + socket_name +
+                                 ".pid";
+    ARROW_CHECK(system(plasma_command.c_str()) == 0);
+    store_socket_names.push_back(socket_name);
+  }
+}
+
+void StopStores() {
+  for (const auto& socket_name : store_socket_names) {
+    std::string plasma_kill_command =
+        "kill -KILL `cat " + socket_name + ".pid` || exit 0";
+    ARROW_CHECK(system(plasma_kill_command.c_str()) == 0);
+  }
+}
+
+// Distinguishes the object IDs of concurrent benchmark threads
+int NextThreadId() {
+  static std::atomic<int> next_thread_id(0);
+  return next_thread_id++;
+}
+
+// A distinct object ID for each thread and iteration
+ObjectID MakeObjectID(int thread_id, int64_t iteration) {
+  std::string binary(kUniqueIDSize, '\0');
+  std::memcpy(&binary[0], &thread_id, sizeof(thread_id));
+  std::memcpy(&binary[sizeof(thread_id)], &iteration, sizeof(iteration));
+  return ObjectID::from_binary(binary);
+}
+
+// Create, seal, release and delete objects
+static void CreateSeal(benchmark::State& state) {  // NOLINT non-const reference
+  const int thread_id = NextThreadId();
+  PlasmaClient client;
+  ARROW_CHECK_OK(client.Connect(store_socket_names[state.range(0)], ""));
+  int64_t iteration = 0;
+  for (auto _ : state) {
+    ObjectID object_id = MakeObjectID(thread_id, iteration++);
+    std::shared_ptr<Buffer> data;
+    ARROW_CHECK_OK(client.Create(object_id, kObjectSize, nullptr, 0, &data));
+    ARROW_CHECK_OK(client.Seal(object_id));
+    ARROW_CHECK_OK(client.Release(object_id));
+    ARROW_CHECK_OK(client.Delete(object_id));
+  }
+  ARROW_CHECK_OK(client.Disconnect());
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * kObjectSize);
+}
+
+// Get and release objects created by the same thread
+static void Get(benchmark::State& state) {  // NOLINT non-const reference
+  constexpr int64_t kNumObjects = 64;
+  const int thread_id = NextThreadId();
+  PlasmaClient client;
+  ARROW_CHECK_OK(client.Connect(store_socket_names[state.range(0)], ""));
+  std::vector<ObjectID> object_ids;
+  for (int64_t i = 0; i < kNumObjects; i++) {
+    object_ids.push_back(MakeObjectID(thread_id, -1 - i));
+    ARROW_CHECK_OK(client.CreateAndSeal(object_ids.back(), std::string(kObjectSize, 'x'),
+                                        ""));
+  }
+  int64_t iteration = 0;
+  for (auto _ : state) {
+    std::vector<ObjectBuffer> object_buffers;
+    ARROW_CHECK_OK(
+        client.Get({object_ids[iteration++ % kNumObjects]}, -1, &object_buffers));
+    benchmark::DoNotOptimize(object_buffers[0].data->data());
+  }
+  ARROW_CHECK_OK(client.Delete(object_ids));
+  ARROW_CHECK_OK(client.Disconnect());
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Arguments are the index of the store in kStoreThreads
+BENCHMARK(CreateSeal)->DenseRange(0, 1)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(Get)->DenseRange(0, 1)->ThreadRange(1, 16)->UseRealTime();
+
+}  // namespace plasma
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  plasma::test_executable = std::string(argv[0]);
+  plasma::StartStores();
+  benchmark::RunSpecifiedBenchmarks();
+  plasma::StopStores();
+  return 0;
+}
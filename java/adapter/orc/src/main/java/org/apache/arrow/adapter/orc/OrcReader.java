@@ -74,6 +74,23 @@ public class OrcReader implements AutoCloseable {
     return new OrcStripeReader(stripeReaderId, allocator);
   }
 
+  /**
+   * Get an ArrowReader over all the stripes with specified batchSize in each record batch.
+   * Following stripes are decoded in the background while the batches of the current
+   * stripe are consumed.
+   *
+   * @param batchSize the number of rows loaded on each iteration
+   * @return ArrowReader that iterate over all the stripes
+   */
+  public ArrowReader openRecordBatchReader(long batchSize) throws IllegalArgumentException {
+    long readerId = jniWrapper.openRecordBatchReader(nativeInstanceId, batchSize);
+    if (readerId < 0) {
+      return null;
+    }
+
+    return new OrcStripeReader(readerId, allocator);
+  }
+
   /**
    * The number of stripes in the file.
    *
@@ -76,4 +76,14 @@ class OrcReaderJniWrapper {
    * @return id of the stripe reader instance.
    */
   native long nextStripeReader(long readerId, long batchSize);
+
+  /**
+   * Get an ArrowReader over all the stripes with specified batchSize in each
+   * record batch. Following stripes are decoded in the background while the batches
+   * of the current stripe are consumed.
+   * @param readerId id of the reader instance
+   * @param batchSize the number of rows loaded on each iteration
+   * @return id of the stripe reader instance, to be used with OrcStripeReaderJniWrapper.
+   */
+  native long openRecordBatchReader(long readerId, long batchSize);
 }
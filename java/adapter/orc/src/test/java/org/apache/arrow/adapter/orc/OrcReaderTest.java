@@ -19,7 +19,9 @@ package org.apache.arrow.adapter.orc;
 
 import static org.junit.Assert.assertEquals;
 import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertNotNull;
 import static org.junit.Assert.assertNull;
+import static org.junit.Assert.assertTrue;
 
 import java.io.File;
 import java.nio.charset.StandardCharsets;
@@ -59,8 +61,7 @@ public class OrcReaderTest {
     allocator = new RootAllocator(MAX_ALLOCATION);
   }
 
-  @Test
-  public void testOrcJniReader() throws Exception {
+  private File writeTestFile() throws Exception {
     TypeDescription schema = TypeDescription.fromString("struct<x:int,y:string>");
     File testFile = new File(testFolder.getRoot(), "test-orc");
 
@@ -77,6 +78,12 @@ public class OrcReaderTest {
     }
     writer.addRowBatch(batch);
     writer.close();
+    return testFile;
+  }
+
+  @Test
+  public void testOrcJniReader() throws Exception {
+    File testFile = writeTestFile();
 
     OrcReader reader = new OrcReader(testFile.getAbsolutePath(), allocator);
     assertEquals(1, reader.getNumberOfStripes());
@@ -101,4 +108,42 @@ public class OrcReaderTest {
     stripeReader.close();
     reader.close();
   }
+
+  @Test
+  public void testOrcJniRecordBatchReader() throws Exception {
+    File testFile = writeTestFile();
+
+    OrcReader reader = new OrcReader(testFile.getAbsolutePath(), allocator);
+    ArrowReader batchReader = reader.openRecordBatchReader(256);
+    VectorSchemaRoot schemaRoot = batchReader.getVectorSchemaRoot();
+
+    int numRows = 0;
+    int numBatches = 0;
+    while (batchReader.loadNextBatch()) {
+      List<FieldVector> fields = schemaRoot.getFieldVectors();
+      assertEquals(2, fields.size());
+
+      IntVector intVector = (IntVector) fields.get(0);
+      VarCharVector varCharVector = (VarCharVector) fields.get(1);
+      for (int i = 0; i < schemaRoot.getRowCount(); ++i) {
+        int row = numRows + i;
+        assertEquals(row, intVector.get(i));
+        assertEquals("Last-" + (row * 3), new String(varCharVector.get(i), StandardCharsets.UTF_8));
+      }
+      numRows += schemaRoot.getRowCount();
+      ++numBatches;
+    }
+    assertEquals(1024, numRows);
+    assertEquals(4, numBatches);
+    batchReader.close();
+
+    // The file reader can still be read stripe by stripe
+    ArrowReader stripeReader = reader.nextStripeReader(1024);
+    assertNotNull(stripeReader);
+    assertTrue(stripeReader.loadNextBatch());
+    assertEquals(1024, stripeReader.getVectorSchemaRoot().getRowCount());
+
+    stripeReader.close();
+    reader.close();
+  }
 }
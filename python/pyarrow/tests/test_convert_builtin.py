@@ -668,6 +668,16 @@ def test_sequence_unicode():
     assert arr.to_pylist() == data
 
 
+@pytest.mark.parametrize('ty', [pa.string(), pa.large_string(), pa.binary()])
+def test_sequence_ascii_and_non_ascii_unicode(ty):
+    # ASCII str objects take a separate fast path from other str objects
+    data = ['', 'a', 'mañana', None, 'b' * 100, '\u2603', 'x\U0001f600x']
+    arr = pa.array(data, type=ty)
+    expected = [v if v is None or ty != pa.binary() else v.encode('utf8')
+                for v in data]
+    assert arr.to_pylist() == expected
+
+
 def check_array_mixed_unicode_bytes(binary_type, string_type):
     values = ['qux', b'foo', bytearray(b'barz')]
     b_values = [b'qux', b'foo', b'barz']
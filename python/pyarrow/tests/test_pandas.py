@@ -3189,6 +3189,31 @@ def test_to_pandas_split_blocks():
     _check_to_pandas_memory_unchanged(t, split_blocks=True)
 
 
+def test_to_pandas_split_blocks_threaded_strings():
+    nunique = 100
+    repeats = 10
+    values = _generate_dedup_example(nunique, repeats)
+    values[3] = None
+
+    t = pa.table([
+        pa.chunked_array([values[:500], values[500:]]),
+        pa.array(values, type=pa.binary()),
+        pa.array(range(len(values)), type='i8'),
+    ], ['f0', 'f1', 'f2'])
+
+    df = t.to_pandas(split_blocks=True, use_threads=True)
+    assert len(df._data.blocks) == 3
+    assert df['f0'].tolist() == values
+    assert df['f0'][3] is None
+    # None and the distinct strings
+    _assert_nunique(df['f0'], nunique + 1)
+    _assert_nunique(df['f1'], nunique + 1)
+
+    df = t.to_pandas(split_blocks=True, use_threads=True,
+                     deduplicate_objects=False)
+    assert df['f0'].tolist() == values
+
+
 def _check_blocks_created(t, number):
     x = t.to_pandas(split_blocks=True)
     assert len(x._data.blocks) == number